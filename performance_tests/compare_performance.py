@@ -0,0 +1,107 @@
+#!/usr/bin/env python
+"""Collect and compare the results of the EnergyPlus performance tests.
+
+Run the performance tests with PERFORMANCEREPORT=yes in the environment so that every simulation
+writes <prefix>_performance.json next to its other output files, then
+
+    compare_performance.py collect <build dir> -o results.json
+    compare_performance.py compare baseline.json results.json --threshold 0.10
+
+'collect' merges the per-case files into one results file keyed by the name of each case's output
+directory.  'compare' lists every metric that got worse by more than the threshold (a fraction of the
+baseline value) and exits with status 1 if there is any, so it can gate a CI job.
+"""
+
+from __future__ import print_function
+
+import argparse
+import json
+import os
+import sys
+
+# metrics where a larger value is a regression; simulated hours per second regress when they drop
+TIME_METRICS = ['wall_seconds', 'simulation_seconds', 'peak_rss_kb']
+SUBSYSTEMS = ['heat_balance', 'hvac', 'shading', 'output']
+RATE_METRICS = ['simulated_hours_per_second']
+
+# times below this are dominated by noise and are not compared
+MIN_SECONDS = 0.5
+
+
+def collect(build_dir):
+    results = {}
+    for root, _, files in os.walk(build_dir):
+        for name in files:
+            if name.endswith('_performance.json'):
+                with open(os.path.join(root, name)) as f:
+                    results[os.path.basename(root)] = json.load(f)
+    return results
+
+
+def flatten(result):
+    metrics = dict((key, result[key]) for key in TIME_METRICS + RATE_METRICS if key in result)
+    for subsystem in SUBSYSTEMS:
+        if subsystem in result.get('subsystem_seconds', {}):
+            metrics[subsystem + '_seconds'] = result['subsystem_seconds'][subsystem]
+    for module, kb in result.get('module_memory_kb', {}).items():
+        metrics[module + '_memory_kb'] = kb
+    return metrics
+
+
+def compare(baseline, current, threshold):
+    regressions = []
+    for case in sorted(current):
+        if case not in baseline:
+            print('{}: new case, no baseline'.format(case))
+            continue
+        old = flatten(baseline[case])
+        new = flatten(current[case])
+        for metric in sorted(new):
+            if metric not in old or old[metric] <= 0.0:
+                continue
+            if metric.endswith('_seconds') and old[metric] < MIN_SECONDS:
+                continue
+            change = (new[metric] - old[metric]) / old[metric]
+            if metric in RATE_METRICS:
+                change = -change
+            status = 'REGRESSION' if change > threshold else 'ok'
+            print('{}: {} {:.4g} -> {:.4g} ({:+.1%}) {}'.format(case, metric, old[metric], new[metric], change, status))
+            if change > threshold:
+                regressions.append((case, metric))
+    for case in sorted(set(baseline) - set(current)):
+        print('{}: missing from the current results'.format(case))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest='command')
+    collect_parser = commands.add_parser('collect', help='merge the per-case performance files under a build directory')
+    collect_parser.add_argument('build_dir')
+    collect_parser.add_argument('-o', '--output', default='performance_results.json')
+    compare_parser = commands.add_parser('compare', help='flag regressions against a baseline results file')
+    compare_parser.add_argument('baseline')
+    compare_parser.add_argument('current')
+    compare_parser.add_argument('--threshold', type=float, default=0.10, help='allowed fractional slowdown (default 0.10)')
+    args = parser.parse_args()
+
+    if args.command == 'collect':
+        results = collect(args.build_dir)
+        with open(args.output, 'w') as f:
+            json.dump(results, f, indent=4, sort_keys=True)
+        print('Collected {} cases into {}'.format(len(results), args.output))
+        return 0
+    if args.command == 'compare':
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        with open(args.current) as f:
+            current = json.load(f)
+        regressions = compare(baseline, current, args.threshold)
+        print('{} regression(s) beyond {:.0%}'.format(len(regressions), args.threshold))
+        return 1 if regressions else 0
+    parser.print_help()
+    return 2
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,258 @@
+#!/usr/bin/env python
+"""Generate a synthetic epJSON model for scaling studies of EnergyPlus run time.
+
+The model is a grid of identical box zones served by ideal loads air systems.  Each dimension that
+drives the cost of a run can be varied on its own:
+
+    --zones                number of zones (nodes grow with zones: four per ideal loads system)
+    --surfaces-per-wall    number of pieces each exterior wall is split into
+    --windows-per-surface  windows on each exterior wall piece
+    --shading-surfaces     detached building shades south of the building (shadowing combinations)
+    --output-variables     Output:Variable objects, cycling through zone variables and zone keys
+
+Walls between neighbouring zones are adiabatic, so the zone count does not change the exterior
+surface count per zone.  run_scaling_study.py drives this generator.
+"""
+
+from __future__ import print_function
+
+import argparse
+import json
+import math
+
+ZONE_WIDTH = 10.0
+ZONE_DEPTH = 10.0
+ZONE_HEIGHT = 3.0
+SILL_HEIGHT = 0.9
+HEAD_HEIGHT = 2.1
+
+ZONE_VARIABLES = [
+    'Zone Mean Air Temperature',
+    'Zone Air Relative Humidity',
+    'Zone Mean Radiant Temperature',
+    'Zone Air Heat Balance Internal Convective Heat Gain Rate',
+    'Zone Air Heat Balance Surface Convection Rate',
+    'Zone Windows Total Transmitted Solar Radiation Rate',
+    'Zone Ideal Loads Supply Air Total Heating Energy',
+    'Zone Ideal Loads Supply Air Total Cooling Energy',
+]
+
+
+def vertex(p):
+    return {'vertex_x_coordinate': p[0], 'vertex_y_coordinate': p[1], 'vertex_z_coordinate': p[2]}
+
+
+def rectangle(origin, along, length, bottom, top):
+    """Vertices of a vertical rectangle, upper left corner first, counterclockwise seen from outside.
+
+    origin is the lower left corner seen from outside and along the unit vector to the right."""
+    left = [origin[0], origin[1], 0.0]
+    right = [origin[0] + along[0] * length, origin[1] + along[1] * length, 0.0]
+    return [[left[0], left[1], top], [left[0], left[1], bottom], [right[0], right[1], bottom], [right[0], right[1], top]]
+
+
+def generate(args):
+    model = {
+        'Version': {'Version 1': {'version_identifier': '9.2'}},
+        'SimulationControl': {
+            'SimulationControl 1': {
+                'do_zone_sizing_calculation': 'No',
+                'do_system_sizing_calculation': 'No',
+                'do_plant_sizing_calculation': 'No',
+                'run_simulation_for_sizing_periods': 'No',
+                'run_simulation_for_weather_file_run_periods': 'Yes',
+            }
+        },
+        'Building': {
+            'Scaling Model': {
+                'north_axis': 0.0,
+                'terrain': 'City',
+                'loads_convergence_tolerance_value': 0.04,
+                'temperature_convergence_tolerance_value': 0.4,
+                'solar_distribution': 'FullExterior',
+                'maximum_number_of_warmup_days': 25,
+                'minimum_number_of_warmup_days': 6,
+            }
+        },
+        'Timestep': {'Timestep 1': {'number_of_timesteps_per_hour': args.timesteps}},
+        'GlobalGeometryRules': {
+            'GlobalGeometryRules 1': {
+                'starting_vertex_position': 'UpperLeftCorner',
+                'vertex_entry_direction': 'Counterclockwise',
+                'coordinate_system': 'Relative',
+            }
+        },
+        'RunPeriod': {
+            'Scaling Run': {
+                'begin_month': 1,
+                'begin_day_of_month': 1,
+                'end_month': 1,
+                'end_day_of_month': args.days,
+                'use_weather_file_holidays_and_special_days': 'No',
+                'use_weather_file_daylight_saving_period': 'No',
+                'apply_weekend_holiday_rule': 'No',
+                'use_weather_file_rain_indicators': 'Yes',
+                'use_weather_file_snow_indicators': 'Yes',
+            }
+        },
+        'Material': {
+            'Generic Mass': {'roughness': 'MediumRough', 'thickness': 0.2, 'conductivity': 1.7, 'density': 2240.0, 'specific_heat': 900.0}
+        },
+        'WindowMaterial:SimpleGlazingSystem': {'Generic Glazing': {'u_factor': 2.0, 'solar_heat_gain_coefficient': 0.4}},
+        'Construction': {'Mass': {'outside_layer': 'Generic Mass'}, 'Glazing': {'outside_layer': 'Generic Glazing'}},
+        'ScheduleTypeLimits': {'Any Number': {}},
+        'Schedule:Constant': {
+            'Always 4': {'schedule_type_limits_name': 'Any Number', 'hourly_value': 4.0},
+            'Always 20': {'schedule_type_limits_name': 'Any Number', 'hourly_value': 20.0},
+            'Always 24': {'schedule_type_limits_name': 'Any Number', 'hourly_value': 24.0},
+        },
+        'ThermostatSetpoint:DualSetpoint': {
+            'Dual Setpoint': {
+                'heating_setpoint_temperature_schedule_name': 'Always 20',
+                'cooling_setpoint_temperature_schedule_name': 'Always 24',
+            }
+        },
+        'Zone': {},
+        'BuildingSurface:Detailed': {},
+        'FenestrationSurface:Detailed': {},
+        'ZoneControl:Thermostat': {},
+        'ZoneHVAC:EquipmentConnections': {},
+        'ZoneHVAC:EquipmentList': {},
+        'ZoneHVAC:IdealLoadsAirSystem': {},
+        'Output:Variable': {},
+    }
+
+    columns = int(math.ceil(math.sqrt(args.zones)))
+    zone_names = []
+    for index in range(args.zones):
+        row, column = divmod(index, columns)
+        name = 'Zone {}'.format(index + 1)
+        zone_names.append(name)
+        model['Zone'][name] = {'x_origin': column * ZONE_WIDTH, 'y_origin': row * ZONE_DEPTH, 'z_origin': 0.0}
+        east = column == columns - 1 or index == args.zones - 1
+        add_zone_surfaces(model, args, name, row == 0, east, index + columns >= args.zones, column == 0)
+        add_ideal_loads(model, name)
+
+    if args.shading_surfaces > 0:
+        model['Shading:Building:Detailed'] = {}
+        width = columns * ZONE_WIDTH / args.shading_surfaces
+        for index in range(args.shading_surfaces):
+            corners = rectangle([index * width, -5.0], [1.0, 0.0], width, 0.0, 2.0 * ZONE_HEIGHT)
+            model['Shading:Building:Detailed']['Shade {}'.format(index + 1)] = {'vertices': [vertex(p) for p in corners]}
+
+    for index in range(args.output_variables):
+        variable = ZONE_VARIABLES[index % len(ZONE_VARIABLES)]
+        key = zone_names[(index // len(ZONE_VARIABLES)) % len(zone_names)]
+        model['Output:Variable']['Output:Variable {}'.format(index + 1)] = {
+            'key_value': key,
+            'variable_name': variable,
+            'reporting_frequency': 'Timestep',
+        }
+
+    return model
+
+
+def add_zone_surfaces(model, args, zone, south, east, north, west):
+    surfaces = model['BuildingSurface:Detailed']
+    floor = [[ZONE_WIDTH, 0.0, 0.0], [0.0, 0.0, 0.0], [0.0, ZONE_DEPTH, 0.0], [ZONE_WIDTH, ZONE_DEPTH, 0.0]]
+    roof = [[0.0, ZONE_DEPTH, ZONE_HEIGHT], [0.0, 0.0, ZONE_HEIGHT], [ZONE_WIDTH, 0.0, ZONE_HEIGHT], [ZONE_WIDTH, ZONE_DEPTH, ZONE_HEIGHT]]
+    surfaces[zone + ' Floor'] = surface(zone, 'Floor', 'Ground', floor)
+    surfaces[zone + ' Roof'] = surface(zone, 'Roof', 'Outdoors', roof)
+
+    walls = [
+        ('South', south, [0.0, 0.0], [1.0, 0.0], ZONE_WIDTH),
+        ('East', east, [ZONE_WIDTH, 0.0], [0.0, 1.0], ZONE_DEPTH),
+        ('North', north, [ZONE_WIDTH, ZONE_DEPTH], [-1.0, 0.0], ZONE_WIDTH),
+        ('West', west, [0.0, ZONE_DEPTH], [0.0, -1.0], ZONE_DEPTH),
+    ]
+    for facing, exterior, origin, along, length in walls:
+        if not exterior:
+            corners = rectangle(origin, along, length, 0.0, ZONE_HEIGHT)
+            surfaces['{} {} Wall'.format(zone, facing)] = surface(zone, 'Wall', 'Adiabatic', corners)
+            continue
+        piece = length / args.surfaces_per_wall
+        for p in range(args.surfaces_per_wall):
+            start = [origin[0] + along[0] * piece * p, origin[1] + along[1] * piece * p]
+            name = '{} {} Wall {}'.format(zone, facing, p + 1)
+            surfaces[name] = surface(zone, 'Wall', 'Outdoors', rectangle(start, along, piece, 0.0, ZONE_HEIGHT))
+            add_windows(model, args, name, start, along, piece)
+
+
+def add_windows(model, args, wall, start, along, length):
+    slot = length / args.windows_per_surface
+    for w in range(args.windows_per_surface):
+        offset = slot * w + 0.2 * slot
+        origin = [start[0] + along[0] * offset, start[1] + along[1] * offset]
+        corners = rectangle(origin, along, 0.6 * slot, SILL_HEIGHT, HEAD_HEIGHT)
+        window = {'surface_type': 'Window', 'construction_name': 'Glazing', 'building_surface_name': wall, 'number_of_vertices': 4}
+        for v, p in enumerate(corners):
+            for axis, value in zip('xyz', p):
+                window['vertex_{}_{}_coordinate'.format(v + 1, axis)] = value
+        model['FenestrationSurface:Detailed']['{} Window {}'.format(wall, w + 1)] = window
+
+
+def surface(zone, surface_type, boundary, corners):
+    outdoors = boundary == 'Outdoors'
+    return {
+        'surface_type': surface_type,
+        'construction_name': 'Mass',
+        'zone_name': zone,
+        'outside_boundary_condition': boundary,
+        'sun_exposure': 'SunExposed' if outdoors else 'NoSun',
+        'wind_exposure': 'WindExposed' if outdoors else 'NoWind',
+        'number_of_vertices': len(corners),
+        'vertices': [vertex(p) for p in corners],
+    }
+
+
+def add_ideal_loads(model, zone):
+    model['ZoneControl:Thermostat'][zone + ' Thermostat'] = {
+        'zone_or_zonelist_name': zone,
+        'control_type_schedule_name': 'Always 4',
+        'control_1_object_type': 'ThermostatSetpoint:DualSetpoint',
+        'control_1_name': 'Dual Setpoint',
+    }
+    model['ZoneHVAC:EquipmentConnections'][zone + ' Connections'] = {
+        'zone_name': zone,
+        'zone_conditioning_equipment_list_name': zone + ' Equipment',
+        'zone_air_inlet_node_or_nodelist_name': zone + ' Supply Node',
+        'zone_air_node_name': zone + ' Air Node',
+        'zone_return_air_node_or_nodelist_name': zone + ' Return Node',
+    }
+    model['ZoneHVAC:EquipmentList'][zone + ' Equipment'] = {
+        'load_distribution_scheme': 'SequentialLoad',
+        'equipment': [
+            {
+                'zone_equipment_object_type': 'ZoneHVAC:IdealLoadsAirSystem',
+                'zone_equipment_name': zone + ' Ideal Loads',
+                'zone_equipment_cooling_sequence': 1,
+                'zone_equipment_heating_or_no_load_sequence': 1,
+            }
+        ],
+    }
+    model['ZoneHVAC:IdealLoadsAirSystem'][zone + ' Ideal Loads'] = {'zone_supply_air_node_name': zone + ' Supply Node'}
+
+
+def add_arguments(parser):
+    parser.add_argument('--zones', type=int, default=10)
+    parser.add_argument('--surfaces-per-wall', type=int, default=1)
+    parser.add_argument('--windows-per-surface', type=int, default=1)
+    parser.add_argument('--shading-surfaces', type=int, default=0)
+    parser.add_argument('--output-variables', type=int, default=0)
+    parser.add_argument('--timesteps', type=int, default=4, help='time steps per hour')
+    parser.add_argument('--days', type=int, default=7, help='length of the January run period in days')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    add_arguments(parser)
+    parser.add_argument('-o', '--output', default='in.epJSON')
+    args = parser.parse_args()
+    if not 1 <= args.days <= 31:
+        parser.error('--days must be between 1 and 31')
+    with open(args.output, 'w') as f:
+        json.dump(generate(args), f, indent=2, sort_keys=True)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,98 @@
+#!/usr/bin/env python
+"""Measure how EnergyPlus run time scales with one dimension of a synthetic model.
+
+For each value of the chosen dimension a model is generated with generate_scaling_model.py, simulated
+with PERFORMANCEREPORT=yes, and its <prefix>_performance.json collected.  A power law t = a * n^k is
+then fitted to the run time of the whole run and of each subsystem, so terms that grow faster than the
+model (k well above 1) stand out, e.g.
+
+    run_scaling_study.py --energyplus build/Products/energyplus --weather USA_CO_Golden-NREL.724666_TMY3.epw \\
+        --dimension zones --values 10 20 40 80 160
+
+The other dimensions keep the generator defaults unless given, e.g. --windows-per-surface 2.
+"""
+
+from __future__ import print_function
+
+import argparse
+import json
+import math
+import os
+import subprocess
+import sys
+
+import generate_scaling_model
+
+DIMENSIONS = ['zones', 'surfaces_per_wall', 'windows_per_surface', 'shading_surfaces', 'output_variables']
+SUBSYSTEMS = ['heat_balance', 'hvac', 'shading', 'output']
+
+
+def fit_exponent(sizes, values):
+    """Least squares slope of log(value) against log(size), or None with fewer than two usable points."""
+    points = [(math.log(n), math.log(v)) for n, v in zip(sizes, values) if n > 0 and v > 0]
+    if len(points) < 2:
+        return None
+    mean_x = sum(x for x, _ in points) / len(points)
+    mean_y = sum(y for _, y in points) / len(points)
+    sxx = sum((x - mean_x) ** 2 for x, _ in points)
+    if sxx == 0.0:
+        return None
+    return sum((x - mean_x) * (y - mean_y) for x, y in points) / sxx
+
+
+def run_case(args, value):
+    directory = os.path.join(args.work_dir, '{}_{}'.format(args.dimension, value))
+    if not os.path.isdir(directory):
+        os.makedirs(directory)
+    setattr(args, args.dimension, value)
+    model = os.path.join(directory, 'in.epJSON')
+    with open(model, 'w') as f:
+        json.dump(generate_scaling_model.generate(args), f)
+
+    environment = dict(os.environ, PERFORMANCEREPORT='yes')
+    command = [args.energyplus, '-w', args.weather, '-d', directory, model]
+    with open(os.path.join(directory, 'stdout.txt'), 'w') as log:
+        if subprocess.call(command, stdout=log, stderr=subprocess.STDOUT, env=environment) != 0:
+            print('{} = {}: simulation failed, see {}'.format(args.dimension, value, directory))
+            return None
+    with open(os.path.join(directory, 'eplusout_performance.json')) as f:
+        return json.load(f)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    generate_scaling_model.add_arguments(parser)
+    parser.add_argument('--energyplus', required=True, help='path to the energyplus executable')
+    parser.add_argument('--weather', required=True, help='weather file covering January')
+    parser.add_argument('--dimension', required=True, choices=DIMENSIONS)
+    parser.add_argument('--values', required=True, type=int, nargs='+', help='values of the dimension to simulate')
+    parser.add_argument('--work-dir', default='scaling_study')
+    parser.add_argument('-o', '--output', default='scaling_results.json')
+    args = parser.parse_args()
+
+    sizes = []
+    results = []
+    for value in args.values:
+        result = run_case(args, value)
+        if result is not None:
+            sizes.append(value)
+            results.append(result)
+
+    series = {'wall_seconds': [r['wall_seconds'] for r in results], 'peak_rss_kb': [r['peak_rss_kb'] for r in results]}
+    for subsystem in SUBSYSTEMS:
+        series[subsystem + '_seconds'] = [r['subsystem_seconds'][subsystem] for r in results]
+
+    print('{:>24} {}'.format(args.dimension, ' '.join('{:>10}'.format(n) for n in sizes) + '   exponent'))
+    exponents = {}
+    for metric in sorted(series):
+        exponents[metric] = fit_exponent(sizes, series[metric])
+        exponent = '{:10.2f}'.format(exponents[metric]) if exponents[metric] is not None else '         -'
+        print('{:>24} {} {}'.format(metric, ' '.join('{:10.4g}'.format(v) for v in series[metric]), exponent))
+
+    with open(args.output, 'w') as f:
+        json.dump({'dimension': args.dimension, 'values': sizes, 'results': results, 'exponents': exponents}, f, indent=4, sort_keys=True)
+    return 0 if len(results) == len(args.values) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
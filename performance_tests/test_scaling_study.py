@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+"""Checks of the synthetic scaling model generator and of the scaling study power law fit."""
+
+from __future__ import print_function
+
+import argparse
+import unittest
+
+import generate_scaling_model
+import run_scaling_study
+
+
+def generate(*argv):
+    parser = argparse.ArgumentParser()
+    generate_scaling_model.add_arguments(parser)
+    return generate_scaling_model.generate(parser.parse_args(list(argv)))
+
+
+class GenerateScalingModelTest(unittest.TestCase):
+    def test_default_dimensions(self):
+        model = generate('--zones', '4')
+        self.assertEqual(4, len(model['Zone']))
+        # a 2 x 2 grid: two exterior and two adiabatic walls per zone, one window per exterior wall
+        surfaces = model['BuildingSurface:Detailed']
+        walls = [s for s in surfaces.values() if s['surface_type'] == 'Wall']
+        self.assertEqual(16, len(walls))
+        self.assertEqual(8, len([s for s in walls if s['outside_boundary_condition'] == 'Outdoors']))
+        self.assertEqual(8, len(model['FenestrationSurface:Detailed']))
+        self.assertNotIn('Shading:Building:Detailed', model)
+        self.assertEqual({}, model['Output:Variable'])
+
+    def test_each_dimension_scales_on_its_own(self):
+        # five zones fill a 3 x 2 grid with one corner left open, giving ten exterior walls
+        model = generate('--zones', '5', '--surfaces-per-wall', '2', '--windows-per-surface', '3', '--shading-surfaces', '4',
+                         '--output-variables', '10')
+        surfaces = model['BuildingSurface:Detailed']
+        exterior_walls = [n for n, s in surfaces.items() if s['surface_type'] == 'Wall' and s['outside_boundary_condition'] == 'Outdoors']
+        adiabatic_walls = [n for n, s in surfaces.items() if s['outside_boundary_condition'] == 'Adiabatic']
+        self.assertEqual(5, len(model['Zone']))
+        self.assertEqual(20, len(exterior_walls))
+        self.assertEqual(10, len(adiabatic_walls))
+        self.assertEqual(60, len(model['FenestrationSurface:Detailed']))
+        self.assertEqual(4, len(model['Shading:Building:Detailed']))
+        self.assertEqual(10, len(model['Output:Variable']))
+        # the variables cycle through the zone variables before moving on to the next zone
+        variable = model['Output:Variable']['Output:Variable 9']
+        self.assertEqual(generate_scaling_model.ZONE_VARIABLES[0], variable['variable_name'])
+        self.assertEqual('Zone 2', variable['key_value'])
+
+    def test_windows_lie_on_their_walls(self):
+        model = generate('--zones', '3', '--surfaces-per-wall', '2', '--windows-per-surface', '2')
+        surfaces = model['BuildingSurface:Detailed']
+        for name, window in model['FenestrationSurface:Detailed'].items():
+            wall = surfaces[window['building_surface_name']]
+            self.assertEqual('Outdoors', wall['outside_boundary_condition'], name)
+            xs = [v['vertex_x_coordinate'] for v in wall['vertices']]
+            ys = [v['vertex_y_coordinate'] for v in wall['vertices']]
+            for v in range(1, 5):
+                x = window['vertex_{}_x_coordinate'.format(v)]
+                y = window['vertex_{}_y_coordinate'.format(v)]
+                z = window['vertex_{}_z_coordinate'.format(v)]
+                self.assertTrue(min(xs) - 1e-9 <= x <= max(xs) + 1e-9, name)
+                self.assertTrue(min(ys) - 1e-9 <= y <= max(ys) + 1e-9, name)
+                self.assertTrue(generate_scaling_model.SILL_HEIGHT <= z <= generate_scaling_model.HEAD_HEIGHT, name)
+
+    def test_zone_nodes_are_unique(self):
+        model = generate('--zones', '6')
+        nodes = []
+        for connections in model['ZoneHVAC:EquipmentConnections'].values():
+            nodes += [connections['zone_air_inlet_node_or_nodelist_name'], connections['zone_air_node_name'],
+                      connections['zone_return_air_node_or_nodelist_name']]
+        self.assertEqual(18, len(nodes))
+        self.assertEqual(len(nodes), len(set(nodes)))
+
+
+class FitExponentTest(unittest.TestCase):
+    def test_power_law(self):
+        sizes = [10, 20, 40, 80]
+        self.assertAlmostEqual(1.5, run_scaling_study.fit_exponent(sizes, [3.0 * n ** 1.5 for n in sizes]))
+        self.assertAlmostEqual(1.0, run_scaling_study.fit_exponent(sizes, [0.2 * n for n in sizes]))
+
+    def test_unusable_points(self):
+        # zero times (subsystem not timed) are left out of the fit
+        self.assertAlmostEqual(2.0, run_scaling_study.fit_exponent([10, 20, 40], [0.0, 4.0, 16.0]))
+        self.assertIsNone(run_scaling_study.fit_exponent([10, 20], [0.0, 4.0]))
+        self.assertIsNone(run_scaling_study.fit_exponent([10, 10], [1.0, 2.0]))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -180,7 +180,9 @@ namespace AirflowNetwork {
         enum class Solver
         {
             SkylineLU,
-            ConjugateGradient
+            ConjugateGradient,      // Accepted as input, but solved with the skyline solver
+            SparseLDLT,             // Selected by the AirflowNetworkSparseSolver environment variable
+            SparseConjugateGradient // Selected by the AirflowNetworkSparseSolver environment variable
         };
         // Members
         std::string AirflowNetworkSimuName; // Provide a unique object name
@@ -171,16 +171,24 @@ namespace AirflowNetwork {
 
     void InitAirflowNetworkData();
 
+    void ReorderNodes();
+
     void SETSKY();
 
     void AIRMOV();
 
+    void InitCrackCoefficients();
+
     void SOLVZP(Array1A_int IK,     // pointer to the top of column/row "K"
                 Array1A<Real64> AD, // the main diagonal of [A] before and after factoring
                 Array1A<Real64> AU, // the upper triangle of [A] before and after factoring
                 int &ITER           // number of iterations
     );
 
+    void SolveJacobian(Array1D<Real64> &B,  // "B" vector (input); "X" vector (output), in equation order
+                       bool const Refactor // if false, reuse the factors of the previous Jacobian
+    );
+
     void FILJAC(int const NNZE,  // number of nonzero entries in the "AU" array.
                 bool const LFLAG // if = 1, use laminar relationship (initialization).
     );
@@ -256,6 +264,14 @@ namespace AirflowNetwork {
                 int const NSYM            // symmetry:  0 = symmetric matrix, 1 = non-symmetric
     );
 
+    void SLVSPR(Array1A<Real64> const AU, // the upper triangle of [A]
+                Array1A<Real64> const AD, // the main diagonal of [A]
+                Array1A<Real64> B,        // "B" vector (input); "X" vector (output).
+                Array1A_int const IK,     // pointer to the top of column/row "K"
+                int const NEQ,            // number of equations
+                bool const Refactor       // if false, reuse the factors of the previous [A]
+    );
+
     void FILSKY(Array1A<Real64> const X,     // element array (row-wise sequence)
                 std::array<int, 2> const LM, // location matrix
                 Array1A_int const IK,        // pointer to the top of column/row "K"
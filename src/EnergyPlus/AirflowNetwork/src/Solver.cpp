@@ -45,10 +45,18 @@
 // OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+// C++ Headers
+#include <algorithm>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Fmath.hh>
 #include <ObjexxFCL/gio.hh>
 
+// Eigen Headers
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/SparseCholesky>
+
 #include "AirflowNetwork/Solver.hpp"
 #include "AirflowNetwork/Elements.hpp"
 
@@ -58,6 +66,7 @@
 #include <DataHVACGlobals.hh>
 #include <DataLoopNode.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 
 namespace EnergyPlus {
 
@@ -154,6 +163,35 @@ namespace AirflowNetwork {
     Array1D<Real64> RhoProfT; // Density profile in TO zone [kg/m3]
     Array2D<Real64> DpL;      // Array of stack pressures in link
 
+    // Sparse solver variables, used instead of FACSKY/SLVSKY when a sparse solver is selected
+    namespace {
+        Eigen::SparseMatrix<Real64> SparseJacobian;                                   // Jacobian in compressed column form (upper triangle)
+        Eigen::SimplicialLDLT<Eigen::SparseMatrix<Real64>, Eigen::Upper> SparseLDLT;  // Fill-reducing (AMD) LDL' factorization
+        Eigen::ConjugateGradient<Eigen::SparseMatrix<Real64>, Eigen::Upper> SparseCG; // Jacobi preconditioned conjugate gradient
+        bool SparsePatternAnalyzed(false);                                            // True once the symbolic factorization matches IK
+        bool SparseFactored(false);                                                   // True if SparseLDLT holds the factors of SparseJacobian
+
+        // Factored skyline Jacobian, kept for reuse by the modified Newton iteration
+        Array1D_int FactoredIK;
+        Array1D<Real64> FactoredAD;
+        Array1D<Real64> FactoredAU;
+        bool JacobianFactored(false); // True if the factors hold a (turbulent) Newton Jacobian of the current network
+
+        // Surface crack links, evaluated as one group in FILJAC. The node properties do not change during
+        // SOLVZP, so everything but the pressure difference is set up once per AIRMOV call.
+        std::vector<int> CrackLinks;          // Linkage numbers of the surface cracks
+        std::vector<int> CrackOfLink;         // Position in CrackLinks for each linkage, or -1
+        std::vector<Real64> CrackExpn;        // Flow exponent
+        std::vector<Real64> CrackLaminarN;    // Laminar DF/DP for flow from node 1
+        std::vector<Real64> CrackLaminarM;    // Laminar DF/DP for flow from node 2
+        std::vector<Real64> CrackTurbulentN;  // Turbulent coefficient times square root of density for flow from node 1
+        std::vector<Real64> CrackTurbulentM;  // Turbulent coefficient times square root of density for flow from node 2
+        std::vector<Real64> CrackCorrectionN; // Standard condition correction for flow from node 1
+        std::vector<Real64> CrackCorrectionM; // Standard condition correction for flow from node 2
+        std::vector<Real64> CrackF;           // Flow through the crack [kg/s]
+        std::vector<Real64> CrackDF;          // Partial derivative DF/DP
+    } // namespace
+
     // Functions
 
     void AllocateAirflowNetworkData()
@@ -252,9 +290,7 @@ namespace AirflowNetwork {
         //   LIST = 5
         LIST = 0;
 
-        for (n = 1; n <= NetworkNumOfNodes; ++n) {
-            ID(n) = n;
-        }
+        ReorderNodes();
         for (i = 1; i <= NetworkNumOfLinks; ++i) {
             AFECTL(i) = 1.0;
             AFLOW(i) = 0.0;
@@ -373,9 +409,6 @@ namespace AirflowNetwork {
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
         // FLOW:
-        for (int i = 1; i <= NetworkNumOfNodes; ++i) {
-            ID(i) = i;
-        }
         for (int i = 1; i <= NetworkNumOfLinks; ++i) {
             AFECTL(i) = 1.0;
             AFLOW(i) = 0.0;
@@ -392,6 +425,113 @@ namespace AirflowNetwork {
         }
     }
 
+    void ReorderNodes()
+    {
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   na
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // This subroutine sets up the "ID" array mapping node numbers to equation numbers so that the
+        //     skyline profile of [A] does not depend on the order in which nodes were input.
+
+        // METHODOLOGY EMPLOYED:
+        // Reverse Cuthill-McKee ordering of the nodes with unknown pressures. Nodes with known pressures
+        //     have no off-diagonal terms in [A] and are numbered last. The new ordering is only kept if it
+        //     gives a smaller profile than the input order.
+
+        // REFERENCES:
+        // E. Cuthill and J. McKee, "Reducing the bandwidth of sparse symmetric matrices", Proc. 24th
+        //     National Conference of the ACM, 1969.
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+        std::vector<std::vector<int>> Adjacent(NetworkNumOfNodes + 1); // internal nodes linked to each internal node
+        std::vector<int> Order;                                        // node numbers in equation order
+        std::vector<bool> Visited(NetworkNumOfNodes + 1, false);
+        int i;
+        int j;
+        int k;
+        int n;
+        int M;
+
+        // FLOW:
+        for (n = 1; n <= NetworkNumOfNodes; ++n) {
+            ID(n) = n;
+        }
+
+        for (M = 1; M <= NetworkNumOfLinks; ++M) {
+            i = AirflowNetworkLinkageData(M).NodeNums[0];
+            j = AirflowNetworkLinkageData(M).NodeNums[1];
+            if (i == 0 || j == 0 || i == j) continue;
+            if (AirflowNetworkNodeData(i).NodeTypeNum != 0 || AirflowNetworkNodeData(j).NodeTypeNum != 0) continue;
+            Adjacent[i].push_back(j);
+            Adjacent[j].push_back(i);
+        }
+        for (n = 1; n <= NetworkNumOfNodes; ++n) {
+            std::sort(Adjacent[n].begin(), Adjacent[n].end());
+            Adjacent[n].erase(std::unique(Adjacent[n].begin(), Adjacent[n].end()), Adjacent[n].end());
+        }
+        auto const byDegree = [&Adjacent](int const a, int const b) {
+            return Adjacent[a].size() < Adjacent[b].size() || (Adjacent[a].size() == Adjacent[b].size() && a < b);
+        };
+
+        // Breadth-first search of each connected group of internal nodes, starting from a node of minimum degree
+        Order.reserve(NetworkNumOfNodes);
+        std::vector<int> Candidates;
+        for (n = 1; n <= NetworkNumOfNodes; ++n) {
+            if (AirflowNetworkNodeData(n).NodeTypeNum == 0) Candidates.push_back(n);
+        }
+        std::stable_sort(Candidates.begin(), Candidates.end(), byDegree);
+        for (int const Start : Candidates) {
+            if (Visited[Start]) continue;
+            std::size_t Head = Order.size();
+            Order.push_back(Start);
+            Visited[Start] = true;
+            while (Head < Order.size()) {
+                int const Node = Order[Head++];
+                std::size_t const First = Order.size();
+                for (int const Next : Adjacent[Node]) {
+                    if (Visited[Next]) continue;
+                    Visited[Next] = true;
+                    Order.push_back(Next);
+                }
+                std::sort(Order.begin() + First, Order.end(), byDegree);
+            }
+        }
+        std::reverse(Order.begin(), Order.end());
+        for (n = 1; n <= NetworkNumOfNodes; ++n) {
+            if (AirflowNetworkNodeData(n).NodeTypeNum != 0) Order.push_back(n);
+        }
+
+        // Compare the profiles (sum of column heights) of the input and reordered node numbering
+        std::vector<int> NewID(NetworkNumOfNodes + 1);
+        for (k = 1; k <= NetworkNumOfNodes; ++k) {
+            NewID[Order[k - 1]] = k;
+        }
+        std::vector<int> OldHeight(NetworkNumOfNodes + 1, 0);
+        std::vector<int> NewHeight(NetworkNumOfNodes + 1, 0);
+        for (n = 1; n <= NetworkNumOfNodes; ++n) {
+            for (int const Next : Adjacent[n]) {
+                OldHeight[max(n, Next)] = max(OldHeight[max(n, Next)], std::abs(n - Next));
+                k = max(NewID[n], NewID[Next]);
+                NewHeight[k] = max(NewHeight[k], std::abs(NewID[n] - NewID[Next]));
+            }
+        }
+        long OldProfile = 0;
+        long NewProfile = 0;
+        for (n = 1; n <= NetworkNumOfNodes; ++n) {
+            OldProfile += OldHeight[n];
+            NewProfile += NewHeight[n];
+        }
+        if (NewProfile < OldProfile) {
+            for (n = 1; n <= NetworkNumOfNodes; ++n) {
+                ID(n) = NewID[n];
+            }
+        }
+    }
+
     void SETSKY()
     {
         // SUBROUTINE INFORMATION:
@@ -445,8 +585,10 @@ namespace AirflowNetwork {
         for (M = 1; M <= NetworkNumOfLinks; ++M) {
             j = AirflowNetworkLinkageData(M).NodeNums[1];
             if (j == 0) continue;
-            L = ID(j);
             i = AirflowNetworkLinkageData(M).NodeNums[0];
+            // FILSKY only adds off-diagonal terms between two nodes with unknown pressures
+            if (AirflowNetworkNodeData(i).NodeTypeNum != 0 || AirflowNetworkNodeData(j).NodeTypeNum != 0) continue;
+            L = ID(j);
             k = ID(i);
             N1 = std::abs(L - k);
             N2 = max(k, L);
@@ -460,6 +602,9 @@ namespace AirflowNetwork {
             IK(k + 1) = IK(k) + j;
             j = i;
         }
+        // The sparse solvers take their nonzero pattern from IK
+        SparsePatternAnalyzed = false;
+        JacobianFactored = false;
     }
 
     void AIRMOV()
@@ -550,6 +695,7 @@ namespace AirflowNetwork {
 
         // Calculate pressure field in a large opening
         PStack();
+        InitCrackCoefficients();
         SOLVZP(IK, AD, AU, ITER);
 
         // Report element flows and zone pressures.
@@ -616,6 +762,79 @@ namespace AirflowNetwork {
         }
     }
 
+    void InitCrackCoefficients()
+    {
+        // PURPOSE OF THIS SUBROUTINE:
+        // This subroutine sets up the surface crack coefficients that only depend on the node properties,
+        // so that FILJAC can evaluate all cracks in one loop with a single power function per crack.
+
+        // METHODOLOGY EMPLOYED:
+        // Same relations as SurfaceCrack::calculate, with the terms kept in the same order.
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+        Real64 Corr;
+        Real64 RhozNorm;
+        Real64 VisczNorm;
+        Real64 expn;
+        Real64 VisAve;
+        Real64 Tave;
+        Real64 coef;
+        Real64 RhoCor;
+        Real64 Ctl;
+
+        // FLOW:
+        CrackLinks.clear();
+        CrackOfLink.assign(NetworkNumOfLinks + 1, -1);
+        for (int i = 1; i <= NetworkNumOfLinks; ++i) {
+            if (AirflowNetworkCompData(AirflowNetworkLinkageData(i).CompNum).CompTypeNum != CompTypeNum_SCR) continue;
+            CrackOfLink[i] = static_cast<int>(CrackLinks.size());
+            CrackLinks.push_back(i);
+        }
+        std::size_t const NumCracks = CrackLinks.size();
+        CrackExpn.resize(NumCracks);
+        CrackLaminarN.resize(NumCracks);
+        CrackLaminarM.resize(NumCracks);
+        CrackTurbulentN.resize(NumCracks);
+        CrackTurbulentM.resize(NumCracks);
+        CrackCorrectionN.resize(NumCracks);
+        CrackCorrectionM.resize(NumCracks);
+        CrackF.resize(NumCracks);
+        CrackDF.resize(NumCracks);
+
+        for (std::size_t c = 0; c < NumCracks; ++c) {
+            int const i = CrackLinks[c];
+            auto const &crack(MultizoneSurfaceCrackData(AirflowNetworkCompData(AirflowNetworkLinkageData(i).CompNum).TypeNum));
+            auto const &propN(properties[AirflowNetworkLinkageData(i).NodeNums[0]]);
+            auto const &propM(properties[AirflowNetworkLinkageData(i).NodeNums[1]]);
+            if (i > NetworkNumOfLinks - NumOfLinksIntraZone) {
+                Corr = 1.0;
+            } else {
+                Corr = MultizoneSurfaceData(i).Factor;
+            }
+            RhozNorm = AIRDENSITY(crack.StandardP, crack.StandardT, crack.StandardW);
+            VisczNorm = 1.71432e-5 + 4.828e-8 * crack.StandardT;
+            expn = crack.FlowExpo;
+            VisAve = (propN.viscosity + propM.viscosity) / 2.0;
+            Tave = (propN.temperature + propM.temperature) / 2.0;
+
+            coef = crack.FlowCoef / propN.sqrtDensity * Corr;
+            RhoCor = TOKELVIN(propN.temperature) / TOKELVIN(Tave);
+            Ctl = std::pow(RhozNorm / propN.density / RhoCor, expn - 1.0) * std::pow(VisczNorm / VisAve, 2.0 * expn - 1.0);
+            CrackLaminarN[c] = coef * propN.density / propN.viscosity * Ctl;
+            CrackTurbulentN[c] = coef * propN.sqrtDensity;
+            CrackCorrectionN[c] = Ctl;
+
+            coef = crack.FlowCoef / propM.sqrtDensity * Corr;
+            RhoCor = TOKELVIN(propM.temperature) / TOKELVIN(Tave);
+            Ctl = std::pow(RhozNorm / propM.density / RhoCor, expn - 1.0) * std::pow(VisczNorm / VisAve, 2.0 * expn - 1.0);
+            CrackLaminarM[c] = coef * propM.density / propM.viscosity * Ctl;
+            CrackTurbulentM[c] = coef * propM.sqrtDensity;
+            CrackCorrectionM[c] = Ctl;
+
+            CrackExpn[c] = expn;
+        }
+    }
+
     void SOLVZP(Array1A_int IK,     // pointer to the top of column/row "K"
                 Array1A<Real64> AD, // the main diagonal of [A] before and after factoring
                 Array1A<Real64> AU, // the upper triangle of [A] before and after factoring
@@ -675,10 +894,10 @@ namespace AirflowNetwork {
         //     CEF     - convergence enhancement factor.
         int n;
         int NNZE;
-        int NSYM;
         bool LFLAG;
         int CONVG;
         int ACCEL;
+        bool Refactor;
         Array1D<Real64> PCF(NetworkNumOfNodes);
         Array1D<Real64> CEF(NetworkNumOfNodes);
         Real64 C;
@@ -687,6 +906,7 @@ namespace AirflowNetwork {
         Real64 ACC0;
         Real64 ACC1;
         Array1D<Real64> CCF(NetworkNumOfNodes);
+        Array1D<Real64> B(NetworkNumOfNodes); // right-hand side and solution in equation ("ID") order
 
         // Formats
         static ObjexxFCL::gio::Fmt Format_901("(A5,I3,2E14.6,0P,F8.4,F24.14)");
@@ -694,7 +914,6 @@ namespace AirflowNetwork {
         // FLOW:
         ACC1 = 0.0;
         ACCEL = 0;
-        NSYM = 0;
         NNZE = IK(NetworkNumOfNodes + 1) - 1;
         if (LIST >= 2) ObjexxFCL::gio::write(Unit21, fmtLD) << "Initialization" << NetworkNumOfNodes << NetworkNumOfLinks << NNZE;
         ITER = 0;
@@ -711,6 +930,7 @@ namespace AirflowNetwork {
             FILJAC(NNZE, LFLAG);
             for (n = 1; n <= NetworkNumOfNodes; ++n) {
                 if (AirflowNetworkNodeData(n).NodeTypeNum == 0) PZ(n) = SUMF(n);
+                B(ID(n)) = PZ(n);
             }
             // Data dump.
             if (LIST >= 3) {
@@ -719,13 +939,11 @@ namespace AirflowNetwork {
                 DUMPVR("AF:", SUMF, NetworkNumOfNodes, Unit21);
             }
             // Solve linear system for approximate PZ.
-#ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
-            FACSKY(newAU, AD, newAU, newIK, NetworkNumOfNodes, NSYM);     // noel
-            SLVSKY(newAU, AD, newAU, PZ, newIK, NetworkNumOfNodes, NSYM); // noel
-#else
-            FACSKY(AU, AD, AU, IK, NetworkNumOfNodes, NSYM);
-            SLVSKY(AU, AD, AU, PZ, IK, NetworkNumOfNodes, NSYM);
-#endif
+            SolveJacobian(B, true);
+            JacobianFactored = false;
+            for (n = 1; n <= NetworkNumOfNodes; ++n) {
+                PZ(n) = B(ID(n));
+            }
             if (LIST >= 2) DUMPVD("PZ:", PZ, NetworkNumOfNodes, Unit21);
         }
         // Solve nonlinear airflow network equations by modified Newton's method.
@@ -764,15 +982,15 @@ namespace AirflowNetwork {
             }
             // Solve AA * CCF = SUMF.
             for (n = 1; n <= NetworkNumOfNodes; ++n) {
-                CCF(n) = SUMF(n);
+                B(ID(n)) = SUMF(n);
+            }
+            // Modified Newton: keep the factors of an earlier Jacobian while the residual keeps dropping quickly
+            Refactor = !DataSystemVariables::AirflowNetworkJacobianReuse || !JacobianFactored || (ITER > 1 && ACC1 > 0.5 * ACC0);
+            SolveJacobian(B, Refactor);
+            JacobianFactored = true;
+            for (n = 1; n <= NetworkNumOfNodes; ++n) {
+                CCF(n) = B(ID(n));
             }
-#ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
-            FACSKY(newAU, AD, newAU, newIK, NetworkNumOfNodes, NSYM);      // noel
-            SLVSKY(newAU, AD, newAU, CCF, newIK, NetworkNumOfNodes, NSYM); // noel
-#else
-            FACSKY(AU, AD, AU, IK, NetworkNumOfNodes, NSYM);
-            SLVSKY(AU, AD, AU, CCF, IK, NetworkNumOfNodes, NSYM);
-#endif
             // Revise PZ (Steffensen iteration on the N-R correction factors to handle oscillating corrections).
             if (ACCEL == 1) {
                 ACCEL = 0;
@@ -823,6 +1041,37 @@ namespace AirflowNetwork {
         }
     }
 
+    void SolveJacobian(Array1D<Real64> &B,  // "B" vector (input); "X" vector (output), in equation order
+                       bool const Refactor // if false, reuse the factors of the previous Jacobian
+    )
+    {
+        // PURPOSE OF THIS SUBROUTINE:
+        // This subroutine solves [A] * X = B for the Jacobian filled by FILJAC with the selected solver.
+
+        // METHODOLOGY EMPLOYED:
+        // The skyline factors are kept in separate arrays so that FILJAC can refill AD and AU for the
+        // residual without destroying a factorization that is still being reused.
+
+        // FLOW:
+        if (AirflowNetworkSimu.solver == AirflowNetworkSimuProp::Solver::SparseLDLT ||
+            AirflowNetworkSimu.solver == AirflowNetworkSimuProp::Solver::SparseConjugateGradient) {
+            SLVSPR(AU, AD, B, IK, NetworkNumOfNodes, Refactor);
+            return;
+        }
+        if (Refactor) {
+#ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
+            FactoredIK = newIK; // noel
+            FactoredAU = newAU; // noel
+#else
+            FactoredIK = IK;
+            FactoredAU = AU;
+#endif
+            FactoredAD = AD;
+            FACSKY(FactoredAU, FactoredAD, FactoredAU, FactoredIK, NetworkNumOfNodes, 0); // symmetric
+        }
+        SLVSKY(FactoredAU, FactoredAD, FactoredAU, B, FactoredIK, NetworkNumOfNodes, 0);
+    }
+
     void FILJAC(int const NNZE,  // number of nonzero entries in the "AU" array.
                 bool const LFLAG // if = 1, use laminar relationship (initialization).
     )
@@ -896,14 +1145,50 @@ namespace AirflowNetwork {
             SUMF(n) = 0.0;
             SUMAF(n) = 0.0;
             if (AirflowNetworkNodeData(n).NodeTypeNum == 1) {
-                AD(n) = 1.0;
+                AD(ID(n)) = 1.0;
             } else {
-                AD(n) = 0.0;
+                AD(ID(n)) = 0.0;
             }
         }
         for (n = 1; n <= NNZE; ++n) {
             AU(n) = 0.0;
         }
+        // Evaluate the surface cracks as one group
+        for (std::size_t c = 0; c < CrackLinks.size(); ++c) {
+            i = CrackLinks[c];
+            if (i > NumOfLinksMultiZone) {
+                DP = PZ(AirflowNetworkLinkageData(i).NodeNums[0]) - PZ(AirflowNetworkLinkageData(i).NodeNums[1]) + PS(i) + PW(i);
+            } else {
+                DP = PZ(AirflowNetworkLinkageData(i).NodeNums[0]) - PZ(AirflowNetworkLinkageData(i).NodeNums[1]) + DpL(i, 1) + PW(i);
+            }
+            Real64 const expn = CrackExpn[c];
+            if (LFLAG) {
+                // Initialization by linear relation.
+                CrackDF[c] = (DP >= 0.0) ? CrackLaminarN[c] : CrackLaminarM[c];
+                CrackF[c] = -CrackDF[c] * DP;
+                continue;
+            }
+            Real64 CDM;
+            Real64 FL;
+            Real64 FT;
+            if (DP >= 0.0) {
+                CDM = CrackLaminarN[c];
+                FL = CDM * DP;
+                FT = CrackTurbulentN[c] * ((expn == 0.5) ? std::sqrt(DP) : std::pow(DP, expn)) * CrackCorrectionN[c];
+            } else {
+                CDM = CrackLaminarM[c];
+                FL = CDM * DP;
+                FT = -CrackTurbulentM[c] * ((expn == 0.5) ? std::sqrt(-DP) : std::pow(-DP, expn)) * CrackCorrectionM[c];
+            }
+            // Select laminar or turbulent flow.
+            if (std::abs(FL) <= std::abs(FT)) {
+                CrackF[c] = FL;
+                CrackDF[c] = CDM;
+            } else {
+                CrackF[c] = FT;
+                CrackDF[c] = FT * expn / DP;
+            }
+        }
         //                              Set up the Jacobian matrix.
         for (i = 1; i <= NetworkNumOfLinks; ++i) {
             n = AirflowNetworkLinkageData(i).NodeNums[0];
@@ -943,8 +1228,15 @@ namespace AirflowNetwork {
                 } else if (SELECT_CASE_var == CompTypeNum_SOP) { // Simple opening
                     NF = MultizoneCompSimpleOpeningData(AirflowNetworkCompData(j).TypeNum)
                              .calculate(LFLAG, DP, i, properties[n], properties[m], F, DF);
-                } else if (SELECT_CASE_var == CompTypeNum_SCR) { // Surface crack component
-                    NF = MultizoneSurfaceCrackData(AirflowNetworkCompData(j).TypeNum).calculate(LFLAG, DP, i, properties[n], properties[m], F, DF);
+                } else if (SELECT_CASE_var == CompTypeNum_SCR) { // Surface crack component, evaluated above
+                    if (CrackOfLink.size() > std::size_t(i) && CrackOfLink[i] >= 0) {
+                        F[0] = CrackF[CrackOfLink[i]];
+                        DF[0] = CrackDF[CrackOfLink[i]];
+                        NF = 1;
+                    } else {
+                        NF = MultizoneSurfaceCrackData(AirflowNetworkCompData(j).TypeNum)
+                                 .calculate(LFLAG, DP, i, properties[n], properties[m], F, DF);
+                    }
                 } else if (SELECT_CASE_var == CompTypeNum_SEL) { // Surface effective leakage ratio component
                     NF = MultizoneSurfaceELAData(AirflowNetworkCompData(j).TypeNum).calculate(LFLAG, DP, i, properties[n], properties[m], F, DF);
                 } else if (SELECT_CASE_var == CompTypeNum_COI) { // Distribution system coil component
@@ -987,7 +1279,7 @@ namespace AirflowNetwork {
                 SUMF(m) -= F[0];
                 SUMAF(m) += std::abs(F[0]);
             }
-            if (FLAG != 1) FILSKY(X, AirflowNetworkLinkageData(i).NodeNums, IK, AU, AD, FLAG);
+            if (FLAG != 1) FILSKY(X, {{ID(n), ID(m)}}, IK, AU, AD, FLAG);
             if (NF == 1) continue;
             AFLOW2(i) = F[1];
             //if (LIST >= 3) ObjexxFCL::gio::write(Unit21, Format_901) << " NRj:" << i << n << m << AirflowNetworkLinkSimu(i).DP << F[1] << DF[1];
@@ -1006,7 +1298,7 @@ namespace AirflowNetwork {
                 SUMF(m) -= F[1];
                 SUMAF(m) += std::abs(F[1]);
             }
-            if (FLAG != 1) FILSKY(X, AirflowNetworkLinkageData(i).NodeNums, IK, AU, AD, FLAG);
+            if (FLAG != 1) FILSKY(X, {{ID(n), ID(m)}}, IK, AU, AD, FLAG);
         }
 
 #ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
@@ -1834,8 +2126,10 @@ namespace AirflowNetwork {
                 }
             }
             if (AD(k) - SUMD == 0.0) {
+                int const NodeNum = static_cast<int>(std::find(ID.begin(), ID.end(), k) - ID.begin()) + 1; // equation number to node number
                 ShowSevereError("AirflowNetworkSolver: L-U factorization in Subroutine FACSKY.");
-                ShowContinueError("The denominator used in L-U factorizationis equal to 0.0 at node = " + AirflowNetworkNodeData(k).Name + '.');
+                ShowContinueError("The denominator used in L-U factorizationis equal to 0.0 at node = " + AirflowNetworkNodeData(NodeNum).Name +
+                                  '.');
                 ShowContinueError(
                     "One possible cause is that this node may not be connected directly, or indirectly via airflow network connections ");
                 ShowContinueError(
@@ -1951,6 +2245,113 @@ namespace AirflowNetwork {
         }
     }
 
+    void SLVSPR(Array1A<Real64> const AU, // the upper triangle of [A]
+                Array1A<Real64> const AD, // the main diagonal of [A]
+                Array1A<Real64> B,        // "B" vector (input); "X" vector (output).
+                Array1A_int const IK,     // pointer to the top of column/row "K"
+                int const NEQ,            // number of equations
+                bool const Refactor       // if false, reuse the factors of the previous [A]
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   na
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // This subroutine solves simultaneous linear algebraic equations [A] * X = B with a sparse
+        // solver, as an alternative to FACSKY and SLVSKY for large networks.
+
+        // METHODOLOGY EMPLOYED:
+        // The skyline arrays are copied into a compressed column matrix holding the upper triangle of
+        // the symmetric Jacobian. The nonzero pattern only depends on IK, so the fill-reducing ordering
+        // and symbolic factorization are done once after SETSKY and only the numeric factorization is
+        // repeated for each Newton iteration. The conjugate gradient solver falls back to the direct
+        // factorization if it does not converge (e.g., when a fan makes the Jacobian indefinite).
+
+        // REFERENCES:
+        // na
+
+        // USE STATEMENTS:
+        // na
+
+        // Argument array dimensioning
+        AU.dim(IK(NetworkNumOfNodes + 1));
+        AD.dim(NetworkNumOfNodes);
+        B.dim(NetworkNumOfNodes);
+        IK.dim(NetworkNumOfNodes + 1);
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+        int i;
+        int k;
+        int LHK;
+
+        // FLOW:
+        bool Fill = Refactor;
+        if (!SparsePatternAnalyzed || SparseJacobian.cols() != NEQ || SparseJacobian.nonZeros() != IK(NEQ + 1) - 1 + NEQ) {
+            Eigen::VectorXi ColumnSize(NEQ);
+            for (k = 1; k <= NEQ; ++k) {
+                ColumnSize(k - 1) = IK(k + 1) - IK(k) + 1;
+            }
+            SparseJacobian.resize(NEQ, NEQ);
+            SparseJacobian.reserve(ColumnSize);
+            for (k = 1; k <= NEQ; ++k) {
+                LHK = IK(k + 1) - IK(k);
+                for (i = 0; i <= LHK - 1; ++i) {
+                    SparseJacobian.insert(k - LHK + i - 1, k - 1) = 0.0;
+                }
+                SparseJacobian.insert(k - 1, k - 1) = 1.0;
+            }
+            SparseJacobian.makeCompressed();
+            SparseLDLT.analyzePattern(SparseJacobian);
+            SparseCG.setTolerance(1.0e-10);
+            SparsePatternAnalyzed = true;
+            Fill = true;
+        }
+
+        // Otherwise keep solving with the previous [A] and its factors
+        if (Fill) {
+            // Column "K" holds the skyline entries of AU followed by the diagonal
+            Real64 *Values = SparseJacobian.valuePtr();
+            for (k = 1; k <= NEQ; ++k) {
+                for (i = IK(k); i <= IK(k + 1) - 1; ++i) {
+                    *Values++ = AU(i);
+                }
+                *Values++ = AD(k);
+            }
+            SparseFactored = false;
+            if (AirflowNetworkSimu.solver == AirflowNetworkSimuProp::Solver::SparseConjugateGradient) SparseCG.compute(SparseJacobian);
+        }
+
+        Eigen::Map<Eigen::VectorXd> X(&B(1), NEQ);
+        Eigen::VectorXd const RHS(X);
+        if (AirflowNetworkSimu.solver == AirflowNetworkSimuProp::Solver::SparseConjugateGradient) {
+            Eigen::VectorXd const Solution(SparseCG.solve(RHS));
+            if (SparseCG.info() == Eigen::Success) {
+                X = Solution;
+                return;
+            }
+        }
+
+        if (!SparseFactored) {
+            SparseLDLT.factorize(SparseJacobian);
+            SparseFactored = true;
+        }
+        if (SparseLDLT.info() != Eigen::Success) {
+            ShowSevereError("AirflowNetworkSolver: Sparse LDL' factorization in Subroutine SLVSPR.");
+            ShowContinueError("The Jacobian of the airflow network is singular.");
+            ShowContinueError(
+                "One possible cause is that a node may not be connected directly, or indirectly via airflow network connections ");
+            ShowContinueError(
+                "(e.g., AirflowNetwork:Multizone:SurfaceCrack, AirflowNetwork:Multizone:Component:SimpleOpening, etc.), to an external");
+            ShowContinueError("node (AirflowNetwork:MultiZone:Surface).");
+            ShowFatalError("Preceding condition causes termination.");
+        }
+        X = SparseLDLT.solve(RHS);
+    }
+
     void FILSKY(Array1A<Real64> const X,     // element array (row-wise sequence)
                 std::array<int, 2> const LM, // location matrix
                 Array1A_int const IK,        // pointer to the top of column/row "K"
@@ -50,6 +50,7 @@
 #include <cmath>
 #include <set>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -58,6 +59,9 @@
 #include <ObjexxFCL/gio.hh>
 #include <ObjexxFCL/string.functions.hh>
 
+// Eigen Headers
+#include <Eigen/SparseLU>
+
 // EnergyPlus Headers
 #include <AirflowNetwork/Elements.hpp>
 #include <AirflowNetwork/Solver.hpp>
@@ -80,6 +84,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataRoomAirModel.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEquipment.hh>
 #include <EMSManager.hh>
 #include <Fans.hh>
@@ -239,6 +244,11 @@ namespace AirflowNetworkBalanceManager {
     Array1D<Real64> MV;
     Array1D_int IVEC;
     Array1D_int SplitterNodeNumbers;
+    bool ContaminantMatrixFactored(false); // True if ContaminantLU holds the factors of the current contaminant MA
+    std::vector<std::vector<Real64>> WindPressureCoeffTables; // Cp at each whole degree from 0 to 360, by curve index
+    namespace {
+        Eigen::SparseLU<Eigen::SparseMatrix<Real64>> ContaminantLU; // Sparse LU factors of MA for the contaminant balances
+    }
 
     bool AirflowNetworkGetInputFlag(true);
     int VentilationCtrl(0);  // Hybrid ventilation control type
@@ -311,6 +321,8 @@ namespace AirflowNetworkBalanceManager {
         MV.deallocate();
         IVEC.deallocate();
         SplitterNodeNumbers.deallocate();
+        ContaminantMatrixFactored = false;
+        WindPressureCoeffTables.clear();
         AirflowNetworkGetInputFlag = true;
         VentilationCtrl = 0;
         NumOfExhaustFans = 0;
@@ -502,8 +514,11 @@ namespace AirflowNetworkBalanceManager {
 
             CalcAirflowNetworkHeatBalance();
             CalcAirflowNetworkMoisBalance();
+            // The CO2 and generic contaminant balances share the same matrix, so it is factored once for both
+            ContaminantMatrixFactored = false;
             if (Contaminant.CO2Simulation) CalcAirflowNetworkCO2Balance();
             if (Contaminant.GenericContamSimulation) CalcAirflowNetworkGCBalance();
+            ContaminantMatrixFactored = false;
         }
 
         UpdateAirflowNetwork(FirstHVACIteration);
@@ -2074,6 +2089,17 @@ namespace AirflowNetworkBalanceManager {
             ShowContinueError("..Default value \"SkylineLU\" will be used.");
         }
 
+        // The sparse solvers are not input choices, so existing ConjugateGradient inputs keep the skyline solver
+        if (UtilityRoutines::SameString(DataSystemVariables::AirflowNetworkSparseSolver, "LDLT")) {
+            AirflowNetworkSimu.solver = AirflowNetworkSimuProp::Solver::SparseLDLT;
+        } else if (UtilityRoutines::SameString(DataSystemVariables::AirflowNetworkSparseSolver, "ConjugateGradient")) {
+            AirflowNetworkSimu.solver = AirflowNetworkSimuProp::Solver::SparseConjugateGradient;
+        } else if (!DataSystemVariables::AirflowNetworkSparseSolver.empty()) {
+            ShowWarningError(RoutineName + "Environment variable " + DataSystemVariables::cAirflowNetworkSparseSolver + " = \"" +
+                             DataSystemVariables::AirflowNetworkSparseSolver + "\" is unrecognized.");
+            ShowContinueError("..Valid choices are LDLT or ConjugateGradient. The " + cAlphaFields(8) + " input will be used.");
+        }
+
         if (SimObjectError) {
             ShowFatalError(RoutineName + "Errors found getting " + CurrentModuleObject + " object. Previous error(s) cause program termination.");
         }
@@ -6582,7 +6608,22 @@ namespace AirflowNetworkBalanceManager {
                 angle = 360.0 - angle;
             }
         }
-        Cp = CurveManager::CurveValue(curve, angle);
+        if (DataSystemVariables::AirflowNetworkCpTables && !CurveManager::PerfCurve(curve).EMSOverrideOn) {
+            // Linear interpolation in a table of the curve at whole degrees, filled on first use
+            if (WindPressureCoeffTables.size() <= std::size_t(curve)) WindPressureCoeffTables.resize(curve + 1);
+            std::vector<Real64> &table(WindPressureCoeffTables[curve]);
+            if (table.empty()) {
+                table.resize(361);
+                for (int deg = 0; deg <= 360; ++deg) {
+                    table[deg] = CurveManager::CurveValue(curve, Real64(deg));
+                }
+            }
+            int const deg = std::min(std::max(int(angle), 0), 359);
+            Real64 const frac = angle - deg;
+            Cp = table[deg] + frac * (table[deg + 1] - table[deg]);
+        } else {
+            Cp = CurveManager::CurveValue(curve, angle);
+        }
 
         return Cp * 0.5 * rho * windSpeed * windSpeed;
     }
@@ -7615,7 +7656,6 @@ namespace AirflowNetworkBalanceManager {
         int TypeNum;
         std::string CompName;
         Real64 DirSign;
-        Real64 COZN;
         int ZoneNum;
         bool found;
         bool OANode;
@@ -7791,16 +7831,12 @@ namespace AirflowNetworkBalanceManager {
             }
         }
 
-        // Get an inverse matrix
-        MRXINV(AirflowNetworkNumOfNodes);
+        // Solve for node concentrations
+        MRXSLV(AirflowNetworkNumOfNodes, !ContaminantMatrixFactored);
+        ContaminantMatrixFactored = true;
 
-        // Calculate node temperatures
         for (i = 1; i <= AirflowNetworkNumOfNodes; ++i) {
-            COZN = 0.0;
-            for (j = 1; j <= AirflowNetworkNumOfNodes; ++j) {
-                COZN += MA((i - 1) * AirflowNetworkNumOfNodes + j) * MV(j);
-            }
-            AirflowNetworkNodeSimu(i).CO2Z = COZN;
+            AirflowNetworkNodeSimu(i).CO2Z = MV(i);
         }
     }
 
@@ -7847,7 +7883,6 @@ namespace AirflowNetworkBalanceManager {
         int TypeNum;
         std::string CompName;
         Real64 DirSign;
-        Real64 COZN;
         int ZoneNum;
         bool found;
         bool OANode;
@@ -8023,16 +8058,12 @@ namespace AirflowNetworkBalanceManager {
             }
         }
 
-        // Get an inverse matrix
-        MRXINV(AirflowNetworkNumOfNodes);
+        // Solve for node concentrations, reusing the factors of the CO2 balance if available
+        MRXSLV(AirflowNetworkNumOfNodes, !ContaminantMatrixFactored);
+        ContaminantMatrixFactored = true;
 
-        // Calculate node temperatures
         for (i = 1; i <= AirflowNetworkNumOfNodes; ++i) {
-            COZN = 0.0;
-            for (j = 1; j <= AirflowNetworkNumOfNodes; ++j) {
-                COZN += MA((i - 1) * AirflowNetworkNumOfNodes + j) * MV(j);
-            }
-            AirflowNetworkNodeSimu(i).GCZ = COZN;
+            AirflowNetworkNodeSimu(i).GCZ = MV(i);
         }
     }
 
@@ -8134,6 +8165,58 @@ namespace AirflowNetworkBalanceManager {
         //   ########################################################### END
     }
 
+    void MRXSLV(int const NORDER,  // Number of nodes
+                bool const Refactor // if false, reuse the factors of the previous MA
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   na
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // This subroutine solves MA * X = MV, returning X in MV.
+
+        // METHODOLOGY EMPLOYED:
+        // MA is stored densely but has only a few nonzeros per row (one per upstream link), so it is
+        // copied into a sparse matrix and solved by a sparse LU factorization with partial pivoting
+        // instead of the explicit inverse from MRXINV.
+
+        // REFERENCES:
+        // na
+
+        // USE STATEMENTS:
+        // na
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+        int i;
+        int j;
+
+        if (Refactor) {
+            std::vector<Eigen::Triplet<Real64>> Entries;
+            Entries.reserve(3 * NORDER);
+            for (i = 1; i <= NORDER; ++i) {
+                for (j = 1; j <= NORDER; ++j) {
+                    Real64 const Value = MA((i - 1) * NORDER + j);
+                    if (Value != 0.0) Entries.emplace_back(i - 1, j - 1, Value);
+                }
+            }
+            Eigen::SparseMatrix<Real64> Matrix(NORDER, NORDER);
+            Matrix.setFromTriplets(Entries.begin(), Entries.end());
+            ContaminantLU.analyzePattern(Matrix);
+            ContaminantLU.factorize(Matrix);
+            if (ContaminantLU.info() != Eigen::Success) {
+                ShowFatalError("MRXSLV: The AirflowNetwork contaminant matrix is singular.");
+            }
+        }
+
+        Eigen::Map<Eigen::VectorXd> X(&MV(1), NORDER);
+        Eigen::VectorXd const RHS(X);
+        X = ContaminantLU.solve(RHS);
+    }
+
     void ReportAirflowNetwork()
     {
 
@@ -48,6 +48,9 @@
 #ifndef AirflowNetworkBalanceManager_hh_INCLUDED
 #define AirflowNetworkBalanceManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -84,6 +87,8 @@ namespace AirflowNetworkBalanceManager {
     extern Array1D<Real64> MV;
     extern Array1D_int IVEC;
     extern Array1D_int SplitterNodeNumbers;
+    extern bool ContaminantMatrixFactored; // True if the contaminant matrix factors are current
+    extern std::vector<std::vector<Real64>> WindPressureCoeffTables; // Cp at each whole degree from 0 to 360, by curve index
 
     extern bool AirflowNetworkGetInputFlag;
     extern int VentilationCtrl;  // Hybrid ventilation control type
@@ -218,6 +223,10 @@ namespace AirflowNetworkBalanceManager {
 
     void MRXINV(int const NORDER);
 
+    void MRXSLV(int const NORDER,  // Number of nodes
+                bool const Refactor // if false, reuse the factors of the previous MA
+    );
+
     void ReportAirflowNetwork();
 
     void UpdateAirflowNetwork(Optional_bool_const FirstHVACIteration = _); // True when solution technique on first iteration
@@ -0,0 +1,151 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ArrayView_hh_INCLUDED
+#define ArrayView_hh_INCLUDED
+
+// C++ Headers
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array.hh>
+
+namespace EnergyPlus {
+
+// Non-owning view of contiguous elements for hot inner loops: a pointer and a size with 0-based element access that
+// skips the ObjexxFCL index arithmetic and is only bounds checked in debug builds. Taking the view once outside the
+// loop leaves the loop body as plain pointer arithmetic the compiler can vectorize. A view is invalidated by anything
+// that reallocates the array it was taken from, so take it just before the loop that uses it.
+template <typename T> class ArrayView
+{
+public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+    typedef T *iterator;
+
+    ArrayView() : data_(nullptr), size_(0u)
+    {
+    }
+
+    ArrayView(T *data, size_type const size) : data_(data), size_(size)
+    {
+    }
+
+    // A view of non-const elements converts to a view of const elements
+    template <typename U> ArrayView(ArrayView<U> const &v) : data_(v.data()), size_(v.size())
+    {
+    }
+
+    T &operator[](size_type const i) const
+    {
+        assert(i < size_);
+        return data_[i];
+    }
+
+    size_type size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0u;
+    }
+
+    T *data() const
+    {
+        return data_;
+    }
+
+    iterator begin() const
+    {
+        return data_;
+    }
+
+    iterator end() const
+    {
+        return data_ + size_;
+    }
+
+    // View of Count elements starting at element First of this view
+    ArrayView sub(size_type const First, size_type const Count) const
+    {
+        assert(First + Count <= size_);
+        return ArrayView(data_ + First, Count);
+    }
+
+private:
+    T *data_;
+    size_type size_;
+};
+
+// View of all elements of an array in linear (row-major) order: element [0] is the element at the lower bounds
+template <typename T> inline ArrayView<T> view(ObjexxFCL::Array<T> &a)
+{
+    return ArrayView<T>(a.data(), a.size());
+}
+
+template <typename T> inline ArrayView<T const> view(ObjexxFCL::Array<T> const &a)
+{
+    return ArrayView<T const>(a.data(), a.size());
+}
+
+template <typename T> inline ArrayView<T> view(std::vector<T> &v)
+{
+    return ArrayView<T>(v.data(), v.size());
+}
+
+template <typename T> inline ArrayView<T const> view(std::vector<T> const &v)
+{
+    return ArrayView<T const>(v.data(), v.size());
+}
+
+} // namespace EnergyPlus
+
+#endif
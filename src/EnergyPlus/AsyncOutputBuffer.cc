@@ -0,0 +1,145 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// C++ Headers
+#include <utility>
+
+// EnergyPlus Headers
+#include <AsyncOutputBuffer.hh>
+
+namespace EnergyPlus {
+
+AsyncOutputBuffer::AsyncOutputBuffer(std::streambuf *target, std::size_t const blockSize, std::size_t const maxQueuedBlocks)
+    : target(target), blockSize(blockSize > 0 ? blockSize : 1), maxQueuedBlocks(maxQueuedBlocks > 0 ? maxQueuedBlocks : 1), stopping(false),
+      failed(false)
+{
+    block.resize(this->blockSize);
+    setp(block.data(), block.data() + block.size());
+    writer = std::thread(&AsyncOutputBuffer::writeBlocks, this);
+}
+
+AsyncOutputBuffer::~AsyncOutputBuffer()
+{
+    finish();
+}
+
+std::streambuf *AsyncOutputBuffer::finish()
+{
+    if (running()) {
+        queueBlock();
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            stopping = true;
+        }
+        blockQueued.notify_one();
+        writer.join();
+        setp(nullptr, nullptr);
+        target->pubsync();
+    }
+    return target;
+}
+
+AsyncOutputBuffer::int_type AsyncOutputBuffer::overflow(int_type ch)
+{
+    if (!running()) return traits_type::eof();
+    queueBlock();
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+    }
+    return failed ? traits_type::eof() : traits_type::not_eof(ch);
+}
+
+int AsyncOutputBuffer::sync()
+{
+    // Only hands the partial block to the writer; waiting for storage here would defeat the purpose
+    if (!running()) return 0;
+    queueBlock();
+    return failed ? -1 : 0;
+}
+
+void AsyncOutputBuffer::queueBlock()
+{
+    std::size_t const n = static_cast<std::size_t>(pptr() - pbase());
+    if (n == 0) return;
+    block.resize(n);
+    {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        blockWritten.wait(lock, [this] { return queue.size() < maxQueuedBlocks; });
+        queue.push_back(std::move(block));
+        if (!spares.empty()) {
+            block = std::move(spares.back());
+            spares.pop_back();
+        } else {
+            block = std::vector<char>();
+        }
+    }
+    blockQueued.notify_one();
+    block.resize(blockSize);
+    setp(block.data(), block.data() + block.size());
+}
+
+void AsyncOutputBuffer::writeBlocks()
+{
+    std::unique_lock<std::mutex> lock(queueMutex);
+    while (true) {
+        blockQueued.wait(lock, [this] { return !queue.empty() || stopping; });
+        if (queue.empty()) break; // stopping and drained
+        std::vector<char> written(std::move(queue.front()));
+        queue.pop_front();
+        lock.unlock();
+        std::streamsize const n = static_cast<std::streamsize>(written.size());
+        bool const ok = (target->sputn(written.data(), n) == n);
+        written.clear();
+        lock.lock();
+        if (!ok) failed = true;
+        if (spares.size() < maxQueuedBlocks) spares.push_back(std::move(written));
+        blockWritten.notify_one();
+    }
+}
+
+} // namespace EnergyPlus
@@ -46,8 +46,13 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 // C++ Headers
+#include <algorithm>
 #include <cmath>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -137,6 +142,107 @@ namespace BranchInputManager {
         // use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
         // This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
         bool GetBranchInputOneTimeFlag(true);
+
+        // Hashed name lookups, built once each set of objects has been read
+        UtilityRoutines::NameIndex BranchIndex;                  // Branch%Name
+        UtilityRoutines::NameIndex BranchListIndex;              // BranchList%Name
+        UtilityRoutines::NameIndex ConnectorListIndex;           // ConnectorLists%Name
+        UtilityRoutines::NameIndex SplitterIndex;                // Splitters%Name
+        UtilityRoutines::NameIndex MixerIndex;                   // Mixers%Name
+        std::unordered_map<std::string, int> BranchListOfBranch; // first BranchList naming each branch
+
+        // Loop connections of each BranchList, read once from the PlantLoop, CondenserLoop and AirLoopHVAC objects
+        struct LoopBranchListConnection
+        {
+            std::string LoopName;
+            int LoopNum = 0;
+            std::string SupplyDemandAir; // "Supply", "Demand" or "Air"
+            Real64 VolFlowRate = 0.0;
+        };
+        bool LoopBranchListsCached(false);
+        std::unordered_map<std::string, LoopBranchListConnection> PlantLoopBranchLists;
+        std::unordered_map<std::string, LoopBranchListConnection> CondenserLoopBranchLists;
+        std::unordered_map<std::string, LoopBranchListConnection> AirLoopBranchLists;
+
+        // Index of Name in List via Index, falling back to the linear search when the index misses or is out of date
+        // (e.g. when unit tests fill the arrays directly)
+        template <typename A> int FindItemInIndexedList(std::string const &Name, UtilityRoutines::NameIndex const &Index, A const &List)
+        {
+            int const Found = Index.find(Name);
+            if (Found > 0 && Found <= List.isize() && List(Found).Name == Name) return Found;
+            return UtilityRoutines::FindItemInList(Name, List);
+        }
+
+        // First of BranchList(1:NumOfBranchLists) with BranchName anywhere in its BranchNames, 0 if none
+        int FindBranchListOfBranch(std::string const &BranchName)
+        {
+            auto const found = BranchListOfBranch.find(BranchName);
+            if (found != BranchListOfBranch.end() && found->second <= NumOfBranchLists && any_eq(BranchList(found->second).BranchNames, BranchName)) {
+                return found->second;
+            }
+            for (int Loop = 1; Loop <= NumOfBranchLists; ++Loop) {
+                if (any_eq(BranchList(Loop).BranchNames, BranchName)) return Loop;
+            }
+            return 0;
+        }
+
+        void CacheLoopBranchLists(std::string const &ObjectType,
+                                  int const SupplyField,
+                                  int const DemandField,
+                                  int const FlowField,
+                                  std::string const &SupplyLabel,
+                                  std::unordered_map<std::string, LoopBranchListConnection> &Connections)
+        {
+            int NumParams;
+            int NumAlphas;
+            int NumNumbers;
+            int IOStat;
+            Array1D_string Alphas;
+            Array1D<Real64> Numbers;
+
+            Connections.clear();
+            int const NumLoops = inputProcessor->getNumObjectsFound(ObjectType);
+            inputProcessor->getObjectDefMaxArgs(ObjectType, NumParams, NumAlphas, NumNumbers);
+            Alphas.allocate(NumAlphas);
+            Numbers.allocate(NumNumbers);
+            for (int Num = 1; Num <= NumLoops; ++Num) {
+                inputProcessor->getObjectItem(ObjectType, Num, Alphas, NumAlphas, Numbers, NumNumbers, IOStat);
+                LoopBranchListConnection Connection;
+                Connection.LoopName = Alphas(1);
+                Connection.LoopNum = Num;
+                Connection.VolFlowRate = Numbers(FlowField);
+                // emplace keeps the first loop naming a BranchList, supply side before demand side, as the loop-by-loop search did
+                Connection.SupplyDemandAir = SupplyLabel;
+                Connections.emplace(Alphas(SupplyField), Connection);
+                if (DemandField > 0) {
+                    Connection.SupplyDemandAir = "Demand";
+                    Connections.emplace(Alphas(DemandField), Connection);
+                }
+            }
+        }
+
+        // Branch list connection of BranchListName in Connections, false if not found
+        bool FindLoopBranchListConnection(std::string const &BranchListName,
+                                          std::unordered_map<std::string, LoopBranchListConnection> const &Connections,
+                                          std::string &FoundLoopName,
+                                          int &FoundLoopNum,
+                                          std::string &FoundSupplyDemandAir,
+                                          Real64 &FoundVolFlowRate)
+        {
+            if (!LoopBranchListsCached) {
+                CacheLoopBranchLists("PlantLoop", 8, 12, 3, "Supply", PlantLoopBranchLists);
+                CacheLoopBranchLists("CondenserLoop", 8, 12, 3, "Supply", CondenserLoopBranchLists);
+                CacheLoopBranchLists("AirLoopHVAC", 4, 0, 1, "Air", AirLoopBranchLists);
+                LoopBranchListsCached = true;
+            }
+            auto const found = Connections.find(BranchListName);
+            if (found == Connections.end()) return false;
+            FoundLoopName = found->second.LoopName;
+            FoundSupplyDemandAir = found->second.SupplyDemandAir;
+            FoundVolFlowRate = found->second.VolFlowRate;
+            FoundLoopNum = found->second.LoopNum;
+            return true;
+        }
     } // namespace
     // SUBROUTINE SPECIFICATIONS FOR MODULE BranchInputManager
     // PUBLIC  TestAirPathIntegrity
@@ -166,6 +272,16 @@ namespace BranchInputManager {
         GetConnectorListInputFlag = true; // Flag used to retrieve Input
         InvalidBranchDefinitions = false;
         GetBranchInputOneTimeFlag = true;
+        BranchIndex.clear();
+        BranchListIndex.clear();
+        ConnectorListIndex.clear();
+        SplitterIndex.clear();
+        MixerIndex.clear();
+        BranchListOfBranch.clear();
+        LoopBranchListsCached = false;
+        PlantLoopBranchLists.clear();
+        CondenserLoopBranchLists.clear();
+        AirLoopBranchLists.clear();
         BranchList.deallocate();     // Branch List data for each Branch List
         Branch.deallocate();         // Branch Data for each Branch
         ConnectorLists.deallocate(); // Connector List data for each Connector List
@@ -257,7 +373,7 @@ namespace BranchInputManager {
         }
 
         //  Find this BranchList in the master BranchList Names
-        Found = UtilityRoutines::FindItemInList(BranchListName, BranchList);
+        Found = FindItemInIndexedList(BranchListName, BranchListIndex, BranchList);
         if (Found == 0) {
             ShowFatalError("GetBranchList: BranchList Name not found=" + BranchListName);
         }
@@ -315,7 +431,7 @@ namespace BranchInputManager {
         }
 
         //  Find this BranchList in the master BranchList Names
-        Found = UtilityRoutines::FindItemInList(BranchListName, BranchList);
+        Found = FindItemInIndexedList(BranchListName, BranchListIndex, BranchList);
         if (Found == 0) {
             ShowFatalError("NumBranchesInBranchList: BranchList Name not found=" + BranchListName);
         }
@@ -450,7 +566,7 @@ namespace BranchInputManager {
             GetBranchInput();
         }
 
-        Found = UtilityRoutines::FindItemInList(BranchName, Branch);
+        Found = FindItemInIndexedList(BranchName, BranchIndex, Branch);
         if (Found == 0) {
             ShowSevereError("NumCompsInBranch:  Branch not found=" + BranchName);
             NumCompsInBranch = 0;
@@ -655,7 +771,7 @@ namespace BranchInputManager {
             GetBranchInputFlag = false;
         }
 
-        Found = UtilityRoutines::FindItemInList(BranchName, Branch);
+        Found = FindItemInIndexedList(BranchName, BranchIndex, Branch);
         if (Found == 0) {
             ShowSevereError("GetInternalBranchData:  Branch not found=" + BranchName);
             ErrorsFound = true;
@@ -739,7 +855,7 @@ namespace BranchInputManager {
 
         NumSplitters = 0;
         NumMixers = 0;
-        ConnNum = UtilityRoutines::FindItemInList(ConnectorListName, ConnectorLists);
+        ConnNum = FindItemInIndexedList(ConnectorListName, ConnectorListIndex, ConnectorLists);
 
         if (ConnNum > 0) {
             NumSplitters = ConnectorLists(ConnNum).NumOfSplitters;
@@ -811,7 +927,7 @@ namespace BranchInputManager {
         }
 
         if (not_blank(ConnectorListName)) {
-            Count = UtilityRoutines::FindItemInList(ConnectorListName, ConnectorLists);
+            Count = FindItemInIndexedList(ConnectorListName, ConnectorListIndex, ConnectorLists);
             if (Count == 0) {
                 ShowFatalError("GetConnectorList: Connector List not found=" + ConnectorListName);
             }
@@ -902,13 +1018,13 @@ namespace BranchInputManager {
 
         GetConnectorList(ConnectorListName, Connectoid, ConnectorNumber);
         if (UtilityRoutines::SameString(Connectoid.ConnectorType(1), cMIXER)) {
-            Count = UtilityRoutines::FindItemInList(Connectoid.ConnectorName(1), Mixers);
+            Count = FindItemInIndexedList(Connectoid.ConnectorName(1), MixerIndex, Mixers);
             if (present(MixerNumber)) ++MixerNumber;
             if (Count == 0) {
                 ShowFatalError("GetLoopMixer: No Mixer Found=" + Connectoid.ConnectorName(1));
             }
         } else if (UtilityRoutines::SameString(Connectoid.ConnectorType(2), cMIXER)) {
-            Count = UtilityRoutines::FindItemInList(Connectoid.ConnectorName(2), Mixers);
+            Count = FindItemInIndexedList(Connectoid.ConnectorName(2), MixerIndex, Mixers);
             if (Count == 0) {
                 ShowFatalError("GetLoopMixer: No Mixer Found=" + Connectoid.ConnectorName(2));
             }
@@ -1066,13 +1182,13 @@ namespace BranchInputManager {
         }
         GetConnectorList(ConnectorListName, Connectoid, ConnectorNumber);
         if (UtilityRoutines::SameString(Connectoid.ConnectorType(1), cSPLITTER)) {
-            Count = UtilityRoutines::FindItemInList(Connectoid.ConnectorName(1), Splitters);
+            Count = FindItemInIndexedList(Connectoid.ConnectorName(1), SplitterIndex, Splitters);
             if (present(SplitterNumber)) ++SplitterNumber;
             if (Count == 0) {
                 ShowFatalError("GetLoopSplitter: No Splitter Found=" + Connectoid.ConnectorName(1));
             }
         } else if (UtilityRoutines::SameString(Connectoid.ConnectorType(2), cSPLITTER)) {
-            Count = UtilityRoutines::FindItemInList(Connectoid.ConnectorName(2), Splitters);
+            Count = FindItemInIndexedList(Connectoid.ConnectorName(2), SplitterIndex, Splitters);
             if (Count == 0) {
                 ShowFatalError("GetLoopSplitter: No Splitter Found=" + Connectoid.ConnectorName(2));
             }
@@ -1202,12 +1318,12 @@ namespace BranchInputManager {
             GetBranchListInput();
         }
 
-        Found1 = UtilityRoutines::FindItemInList(BranchListName, BranchList);
+        Found1 = FindItemInIndexedList(BranchListName, BranchListIndex, BranchList);
         if (Found1 == 0) {
             ShowSevereError("GetFirstBranchInletNodeName: BranchList=\"" + BranchListName + "\", not a valid BranchList Name");
             InletNodeName = "Invalid Node Name";
         } else {
-            Found2 = UtilityRoutines::FindItemInList(BranchList(Found1).BranchNames(1), Branch);
+            Found2 = FindItemInIndexedList(BranchList(Found1).BranchNames(1), BranchIndex, Branch);
             if (Found2 == 0) {
                 ShowSevereError("GetFirstBranchInletNodeName: BranchList=\"" + BranchListName + "\", Branch=\"" + BranchList(Found1).BranchNames(1) +
                                 "\" not a valid Branch Name");
@@ -1266,12 +1382,12 @@ namespace BranchInputManager {
             GetBranchListInput();
         }
 
-        Found1 = UtilityRoutines::FindItemInList(BranchListName, BranchList);
+        Found1 = FindItemInIndexedList(BranchListName, BranchListIndex, BranchList);
         if (Found1 == 0) {
             ShowSevereError("GetLastBranchOutletNodeName: BranchList=\"" + BranchListName + "\", not a valid BranchList Name");
             OutletNodeName = "Invalid Node Name";
         } else {
-            Found2 = UtilityRoutines::FindItemInList(BranchList(Found1).BranchNames(BranchList(Found1).NumOfBranchNames), Branch);
+            Found2 = FindItemInIndexedList(BranchList(Found1).BranchNames(BranchList(Found1).NumOfBranchNames), BranchIndex, Branch);
             if (Found2 == 0) {
                 ShowSevereError("GetLastBranchOutletNodeName: BranchList=\"" + BranchListName + "\", Branch=\"" +
                                 BranchList(Found1).BranchNames(BranchList(Found1).NumOfBranchNames) + "\" not a valid Branch Name");
@@ -1399,6 +1515,7 @@ namespace BranchInputManager {
                 }
 
                 NumOfBranches = BCount;
+                BranchIndex.build(Branch, Branch.isize());
                 NodeNums.deallocate();
                 Alphas.deallocate();
                 Numbers.deallocate();
@@ -1687,7 +1804,7 @@ namespace BranchInputManager {
                         GetBranchInput();
                     }
                     if (!BranchList(BCount).BranchNames(Loop).empty()) {
-                        Found = UtilityRoutines::FindItemInList(BranchList(BCount).BranchNames(Loop), Branch);
+                        Found = FindItemInIndexedList(BranchList(BCount).BranchNames(Loop), BranchIndex, Branch);
                         if (Found == 0) {
                             ShowSevereError(RoutineName + CurrentModuleObject + "=\"" + BranchList(BCount).Name + "\", invalid data.");
                             ShowContinueError("..invalid Branch Name not found=\"" + BranchList(BCount).BranchNames(Loop) + "\".");
@@ -1716,6 +1833,13 @@ namespace BranchInputManager {
             ShowSevereError(RoutineName + " Invalid Input -- preceding condition(s) will likely cause termination.");
         }
         NumOfBranchLists = BCount;
+        BranchListIndex.build(BranchList, BranchList.isize());
+        BranchListOfBranch.clear();
+        for (Count = 1; Count <= NumOfBranchLists; ++Count) {
+            for (auto const &BranchName : BranchList(Count).BranchNames) {
+                BranchListOfBranch.emplace(BranchName, Count);
+            }
+        }
         Alphas.deallocate();
         Numbers.deallocate();
         cAlphaFields.deallocate();
@@ -1860,6 +1984,7 @@ namespace BranchInputManager {
             }
         }
         GetConnectorListInputFlag = false;
+        ConnectorListIndex.build(ConnectorLists, NumOfConnectorLists);
         Alphas.deallocate();
         Numbers.deallocate();
         cAlphaFields.deallocate();
@@ -1887,7 +2012,7 @@ namespace BranchInputManager {
                 if (UtilityRoutines::SameString(ConnectorLists(Count).ConnectorType(Loop), cSPLITTER)) {
                     CurSplitter = true;
                     CurMixer = false;
-                    SplitNum = UtilityRoutines::FindItemInList(ConnectorLists(Count).ConnectorName(Loop), Splitters);
+                    SplitNum = FindItemInIndexedList(ConnectorLists(Count).ConnectorName(Loop), SplitterIndex, Splitters);
                     // Following code sets up branch names to be matched from Splitter/Mixer data structure
                     if (SplitNum == 0) {
                         ShowSevereError("Invalid Connector:Splitter(none)=" + ConnectorLists(Count).ConnectorName(Loop) + ", referenced by " +
@@ -1900,7 +2025,7 @@ namespace BranchInputManager {
                 } else if (UtilityRoutines::SameString(ConnectorLists(Count).ConnectorType(Loop), cMIXER)) {
                     CurSplitter = true;
                     CurMixer = false;
-                    MixerNum = UtilityRoutines::FindItemInList(ConnectorLists(Count).ConnectorName(Loop), Mixers);
+                    MixerNum = FindItemInIndexedList(ConnectorLists(Count).ConnectorName(Loop), MixerIndex, Mixers);
                     if (MixerNum == 0) {
                         ShowSevereError("Invalid Connector:Mixer(none)=" + ConnectorLists(Count).ConnectorName(Loop) + ", referenced by " +
                                         CurrentModuleObject + '=' + ConnectorLists(Count).Name);
@@ -1921,7 +2046,7 @@ namespace BranchInputManager {
                         auto const SELECT_CASE_var(CurSplitter);
                         if (SELECT_CASE_var) {
                             // Current "item" is a splitter, candidate is a mixer.
-                            MixerNum = UtilityRoutines::FindItemInList(ConnectorLists(Count).ConnectorName(Loop1), Mixers);
+                            MixerNum = FindItemInIndexedList(ConnectorLists(Count).ConnectorName(Loop1), MixerIndex, Mixers);
                             if (MixerNum == 0) continue;
                             if (Mixers(MixerNum).NumInletBranches != NumBranchNames) continue;
                             MatchFound = true;
@@ -1938,7 +2063,7 @@ namespace BranchInputManager {
                             }
                         } else {
                             // Current "item" is a splitter, candidate is a mixer.
-                            SplitNum = UtilityRoutines::FindItemInList(ConnectorLists(Count).ConnectorName(Loop1), Splitters);
+                            SplitNum = FindItemInIndexedList(ConnectorLists(Count).ConnectorName(Loop1), SplitterIndex, Splitters);
                             if (SplitNum == 0) continue;
                             if (Splitters(SplitNum).NumOutletBranches != NumBranchNames) continue;
                             MatchFound = true;
@@ -2094,6 +2219,7 @@ namespace BranchInputManager {
             }
         }
         GetSplitterInputFlag = false;
+        SplitterIndex.build(Splitters, NumSplitters);
         Alphas.deallocate();
         Numbers.deallocate();
         cAlphaFields.deallocate();
@@ -2107,14 +2233,14 @@ namespace BranchInputManager {
             GetBranchInputFlag = false;
         }
         for (Count = 1; Count <= NumSplitters; ++Count) {
-            Found = UtilityRoutines::FindItemInList(Splitters(Count).InletBranchName, Branch);
+            Found = FindItemInIndexedList(Splitters(Count).InletBranchName, BranchIndex, Branch);
             if (Found == 0) {
                 ShowSevereError("GetSplitterInput: Invalid Branch=" + Splitters(Count).InletBranchName + ", referenced as Inlet Branch to " +
                                 CurrentModuleObject + '=' + Splitters(Count).Name);
                 ErrorsFound = true;
             }
             for (Loop = 1; Loop <= Splitters(Count).NumOutletBranches; ++Loop) {
-                Found = UtilityRoutines::FindItemInList(Splitters(Count).OutletBranchNames(Loop), Branch);
+                Found = FindItemInIndexedList(Splitters(Count).OutletBranchNames(Loop), BranchIndex, Branch);
                 if (Found == 0) {
                     ShowSevereError("GetSplitterInput: Invalid Branch=" + Splitters(Count).OutletBranchNames(Loop) +
                                     ", referenced as Outlet Branch # " + TrimSigDigits(Loop) + " to " + CurrentModuleObject + '=' +
@@ -2155,12 +2281,8 @@ namespace BranchInputManager {
             // 2.  Find the branch name in branchlist
             TestName = Splitters(Count).InletBranchName;
             BranchListName = BlankString;
-            for (Loop1 = 1; Loop1 <= NumOfBranchLists; ++Loop1) {
-                if (any_eq(BranchList(Loop1).BranchNames, TestName)) {
-                    BranchListName = BranchList(Loop1).Name;
-                    break;
-                }
-            }
+            Loop1 = FindBranchListOfBranch(TestName);
+            if (Loop1 > 0) BranchListName = BranchList(Loop1).Name;
 
             if (!BranchListName.empty()) {
                 FoundSupplyDemandAir = BlankString;
@@ -2187,12 +2309,8 @@ namespace BranchInputManager {
             for (Loop = 1; Loop <= Splitters(Count).NumOutletBranches; ++Loop) {
                 TestName = Splitters(Count).OutletBranchNames(Loop);
                 BranchListName = BlankString;
-                for (Loop1 = 1; Loop1 <= NumOfBranchLists; ++Loop1) {
-                    if (any_eq(BranchList(Loop1).BranchNames, TestName)) {
-                        BranchListName = BranchList(Loop1).Name;
-                        break;
-                    }
-                }
+                Loop1 = FindBranchListOfBranch(TestName);
+                if (Loop1 > 0) BranchListName = BranchList(Loop1).Name;
 
                 if (!BranchListName.empty()) {
                     FoundSupplyDemandAir = BlankString;
@@ -2341,6 +2459,7 @@ namespace BranchInputManager {
             }
         }
         GetMixerInputFlag = false;
+        MixerIndex.build(Mixers, NumMixers);
         Alphas.deallocate();
         Numbers.deallocate();
         cAlphaFields.deallocate();
@@ -2354,14 +2473,14 @@ namespace BranchInputManager {
             GetBranchInputFlag = false;
         }
         for (Count = 1; Count <= NumMixers; ++Count) {
-            Found = UtilityRoutines::FindItemInList(Mixers(Count).OutletBranchName, Branch);
+            Found = FindItemInIndexedList(Mixers(Count).OutletBranchName, BranchIndex, Branch);
             if (Found == 0) {
                 ShowSevereError("GetMixerInput: Invalid Branch=" + Mixers(Count).OutletBranchName + ", referenced as Outlet Branch in " +
                                 CurrentModuleObject + '=' + Mixers(Count).Name);
                 ErrorsFound = true;
             }
             for (Loop = 1; Loop <= Mixers(Count).NumInletBranches; ++Loop) {
-                Found = UtilityRoutines::FindItemInList(Mixers(Count).InletBranchNames(Loop), Branch);
+                Found = FindItemInIndexedList(Mixers(Count).InletBranchNames(Loop), BranchIndex, Branch);
                 if (Found == 0) {
                     ShowSevereError("GetMixerInput: Invalid Branch=" + Mixers(Count).InletBranchNames(Loop) + ", referenced as Inlet Branch # " +
                                     TrimSigDigits(Loop) + " in " + CurrentModuleObject + '=' + Mixers(Count).Name);
@@ -2401,12 +2520,8 @@ namespace BranchInputManager {
             // 2.  Find the branch name in branchlist
             TestName = Mixers(Count).OutletBranchName;
             BranchListName = BlankString;
-            for (Loop1 = 1; Loop1 <= NumOfBranchLists; ++Loop1) {
-                if (any_eq(BranchList(Loop1).BranchNames, TestName)) {
-                    BranchListName = BranchList(Loop1).Name;
-                    break;
-                }
-            }
+            Loop1 = FindBranchListOfBranch(TestName);
+            if (Loop1 > 0) BranchListName = BranchList(Loop1).Name;
 
             if (!BranchListName.empty()) {
                 FoundSupplyDemandAir = BlankString;
@@ -2433,12 +2548,8 @@ namespace BranchInputManager {
             for (Loop = 1; Loop <= Mixers(Count).NumInletBranches; ++Loop) {
                 TestName = Mixers(Count).InletBranchNames(Loop);
                 BranchListName = BlankString;
-                for (Loop1 = 1; Loop1 <= NumOfBranchLists; ++Loop1) {
-                    if (any_eq(BranchList(Loop1).BranchNames, TestName)) {
-                        BranchListName = BranchList(Loop1).Name;
-                        break;
-                    }
-                }
+                Loop1 = FindBranchListOfBranch(TestName);
+                if (Loop1 > 0) BranchListName = BranchList(Loop1).Name;
 
                 if (!BranchListName.empty()) {
                     FoundSupplyDemandAir = BlankString;
@@ -2487,14 +2598,14 @@ namespace BranchInputManager {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Linda Lawrie
         //       DATE WRITTEN   October 2007
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, PlantLoop objects read once instead of on every call
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
         // An auxiliary routine locate a plant loop and type from a BranchListName
 
         // METHODOLOGY EMPLOYED:
-        // Calls GetObject for PLANT LOOP
+        // Looks the BranchListName up in the PlantLoop connections, which are read once
 
         // REFERENCES:
         // na
@@ -2514,46 +2625,12 @@ namespace BranchInputManager {
         // DERIVED TYPE DEFINITIONS:
         // na
 
-        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        int Num;
-        int NumPlantLoops;
-        int NumParams;
-        Array1D_string Alphas;
-        int NumAlphas;
-        Array1D<Real64> Numbers;
-        int NumNumbers;
-        int IOStat;
-
-        // Get Inputs
         CurrentModuleObject = "PlantLoop";
 
-        NumPlantLoops = inputProcessor->getNumObjectsFound(CurrentModuleObject);
-        inputProcessor->getObjectDefMaxArgs(CurrentModuleObject, NumParams, NumAlphas, NumNumbers);
-        Alphas.allocate(NumAlphas);
-        Numbers.allocate(NumNumbers);
-
-        for (Num = 1; Num <= NumPlantLoops; ++Num) {
-            inputProcessor->getObjectItem(CurrentModuleObject, Num, Alphas, NumAlphas, Numbers, NumNumbers, IOStat);
-            // Only looking for BranchList here.
-            if (Alphas(8) == BranchListName) {
-                FoundPlantLoopName = Alphas(1);
-                FoundSupplyDemand = "Supply";
-                FoundVolFlowRate = Numbers(3);
-                FoundPlantLoopNum = Num;
-                MatchedPlantLoop = true;
-                break;
-            } else if (Alphas(12) == BranchListName) {
-                FoundPlantLoopName = Alphas(1);
-                FoundSupplyDemand = "Demand";
-                FoundVolFlowRate = Numbers(3);
-                FoundPlantLoopNum = Num;
-                MatchedPlantLoop = true;
-                break;
-            }
+        if (FindLoopBranchListConnection(
+                BranchListName, PlantLoopBranchLists, FoundPlantLoopName, FoundPlantLoopNum, FoundSupplyDemand, FoundVolFlowRate)) {
+            MatchedPlantLoop = true;
         }
-
-        Alphas.deallocate();
-        Numbers.deallocate();
     }
 
     void FindCondenserLoopBranchConnection(std::string const &BranchListName,
@@ -2567,14 +2644,14 @@ namespace BranchInputManager {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Linda Lawrie
         //       DATE WRITTEN   February 2008
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, CondenserLoop objects read once instead of on every call
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
         // An auxiliary routine locate a condenser loop and type from a BranchListName
 
         // METHODOLOGY EMPLOYED:
-        // calls GetObject for CONDENSER LOOP
+        // Looks the BranchListName up in the CondenserLoop connections, which are read once
 
         // REFERENCES:
         // na
@@ -2594,46 +2671,12 @@ namespace BranchInputManager {
         // DERIVED TYPE DEFINITIONS:
         // na
 
-        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        int Num;
-        int NumCondLoops;
-        int NumParams;
-        Array1D_string Alphas;
-        int NumAlphas;
-        Array1D<Real64> Numbers;
-        int NumNumbers;
-        int IOStat;
-
-        // Get Inputs
         CurrentModuleObject = "CondenserLoop";
 
-        NumCondLoops = inputProcessor->getNumObjectsFound(CurrentModuleObject);
-        inputProcessor->getObjectDefMaxArgs(CurrentModuleObject, NumParams, NumAlphas, NumNumbers);
-        Alphas.allocate(NumAlphas);
-        Numbers.allocate(NumNumbers);
-
-        for (Num = 1; Num <= NumCondLoops; ++Num) {
-            inputProcessor->getObjectItem(CurrentModuleObject, Num, Alphas, NumAlphas, Numbers, NumNumbers, IOStat);
-            // Only looking for BranchList here.
-            if (Alphas(8) == BranchListName) {
-                FoundCondLoopName = Alphas(1);
-                FoundSupplyDemand = "Supply";
-                FoundVolFlowRate = Numbers(3);
-                FoundCondLoopNum = Num;
-                MatchedCondLoop = true;
-                break;
-            } else if (Alphas(12) == BranchListName) {
-                FoundCondLoopName = Alphas(1);
-                FoundSupplyDemand = "Demand";
-                FoundVolFlowRate = Numbers(3);
-                FoundCondLoopNum = Num;
-                MatchedCondLoop = true;
-                break;
-            }
+        if (FindLoopBranchListConnection(
+                BranchListName, CondenserLoopBranchLists, FoundCondLoopName, FoundCondLoopNum, FoundSupplyDemand, FoundVolFlowRate)) {
+            MatchedCondLoop = true;
         }
-
-        Alphas.deallocate();
-        Numbers.deallocate();
     }
 
     void FindAirLoopBranchConnection(std::string const &BranchListName,
@@ -2647,14 +2690,14 @@ namespace BranchInputManager {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Linda Lawrie
         //       DATE WRITTEN   February 2008
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, AirLoopHVAC objects read once instead of on every call
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
         // An auxiliary routine locate a Airenser loop and type from a BranchListName
 
         // METHODOLOGY EMPLOYED:
-        // calls GetObject for PRIMARY AIR LOOP
+        // Looks the BranchListName up in the AirLoopHVAC connections, which are read once
 
         // REFERENCES:
         // na
@@ -2674,38 +2717,11 @@ namespace BranchInputManager {
         // DERIVED TYPE DEFINITIONS:
         // na
 
-        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        int Num;
-        int NumAirLoops;
-        int NumParams;
-        Array1D_string Alphas;
-        int NumAlphas;
-        Array1D<Real64> Numbers;
-        int NumNumbers;
-        int IOStat;
-
-        // Get Inputs
         CurrentModuleObject = "AirLoopHVAC";
-        NumAirLoops = inputProcessor->getNumObjectsFound(CurrentModuleObject);
-        inputProcessor->getObjectDefMaxArgs(CurrentModuleObject, NumParams, NumAlphas, NumNumbers);
-        Alphas.allocate(NumAlphas);
-        Numbers.allocate(NumNumbers);
-
-        for (Num = 1; Num <= NumAirLoops; ++Num) {
-            inputProcessor->getObjectItem(CurrentModuleObject, Num, Alphas, NumAlphas, Numbers, NumNumbers, IOStat);
-            // Only looking for BranchList here.
-            if (Alphas(4) == BranchListName) {
-                FoundAirLoopName = Alphas(1);
-                FoundAir = "Air";
-                FoundVolFlowRate = Numbers(1);
-                FoundAirLoopNum = Num;
-                MatchedAirLoop = true;
-                break;
-            }
-        }
 
-        Alphas.deallocate();
-        Numbers.deallocate();
+        if (FindLoopBranchListConnection(BranchListName, AirLoopBranchLists, FoundAirLoopName, FoundAirLoopNum, FoundAir, FoundVolFlowRate)) {
+            MatchedAirLoop = true;
+        }
     }
 
     void FindAirPlantCondenserLoopFromBranchList(std::string const &BranchListName, // Branch List Name
@@ -2800,7 +2816,7 @@ namespace BranchInputManager {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Linda Lawrie
         //       DATE WRITTEN   November 2011
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, branch list names hashed
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -2834,14 +2850,19 @@ namespace BranchInputManager {
         int BlNum;                   // Branch List Counter
         int BrN;                     // Branch Counter
         int CpN;                     // Components on Branch
-        int Found;                   // non-zero when found
         std::string FoundBranchName; // Branch matching compname/type
         bool NeverFound;
+        std::unordered_set<std::string> BranchNamesOnLists; // every name on BranchList(1:NumOfBranchLists)
+
+        for (BlNum = 1; BlNum <= NumOfBranchLists; ++BlNum) {
+            for (int Loop = 1; Loop <= BranchList(BlNum).NumOfBranchNames; ++Loop) {
+                BranchNamesOnLists.insert(BranchList(BlNum).BranchNames(Loop));
+            }
+        }
 
         NumDanglingCount = 0;
         NeverFound = true;
         for (BrN = 1; BrN <= NumOfBranches; ++BrN) {
-            Found = 0;
             FoundBranchName = "";
             if (present(CompType) && present(CompName)) {
                 for (CpN = 1; CpN <= Branch(BrN).NumOfComponents; ++CpN) {
@@ -2852,11 +2873,7 @@ namespace BranchInputManager {
                     NeverFound = false;
                 }
             }
-            for (BlNum = 1; BlNum <= NumOfBranchLists; ++BlNum) {
-                Found = UtilityRoutines::FindItemInList(Branch(BrN).Name, BranchList(BlNum).BranchNames, BranchList(BlNum).NumOfBranchNames);
-                if (Found != 0) break;
-            }
-            if (Found != 0) continue;
+            if (BranchNamesOnLists.count(Branch(BrN).Name) != 0) continue;
             ++NumDanglingCount;
             if (DisplayExtraWarnings || mustprint) {
                 if (mustprint) {
@@ -2887,7 +2904,7 @@ namespace BranchInputManager {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Linda Lawrie
         //       DATE WRITTEN   November 2001
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, node names hashed for the uniqueness check
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -3001,7 +3018,7 @@ namespace BranchInputManager {
             BranchPtrs.allocate(BranchList(BCount).NumOfBranchNames + 2);
             BranchPtrs = 0;
             for (Count = 1; Count <= BranchList(BCount).NumOfBranchNames; ++Count) {
-                Found = UtilityRoutines::FindItemInList(BranchList(BCount).BranchNames(Count), Branch);
+                Found = FindItemInIndexedList(BranchList(BCount).BranchNames(Count), BranchIndex, Branch);
                 if (Found > 0) {
                     NumNodesOnBranchList += Branch(Found).NumOfComponents * 2;
                     FoundBranches(Count) = Found;
@@ -3129,39 +3146,43 @@ namespace BranchInputManager {
             FoundBranches.deallocate();
         }
 
-        // Build node names in branches
+        // Build node names in branches, and the branches each node name is on
+        std::unordered_map<std::string, std::vector<int>> NodeNameBranches;
         for (Count = 1; Count <= NumOfBranches; ++Count) {
             BranchNodes(Count).UniqueNodeNames.allocate(Branch(Count).NumOfComponents * 2);
             BranchNodes(Count).UniqueNodeNames = BlankString;
             NodeNum = 0;
+            std::unordered_set<std::string> BranchNodeNames;
             for (Loop = 1; Loop <= Branch(Count).NumOfComponents; ++Loop) {
-                Found = UtilityRoutines::FindItemInList(Branch(Count).Component(Loop).InletNodeName, BranchNodes(Count).UniqueNodeNames, NodeNum);
-                if (Found == 0) {
+                if (BranchNodeNames.insert(Branch(Count).Component(Loop).InletNodeName).second) {
                     ++NodeNum;
                     BranchNodes(Count).UniqueNodeNames(NodeNum) = Branch(Count).Component(Loop).InletNodeName;
+                    NodeNameBranches[Branch(Count).Component(Loop).InletNodeName].push_back(Count);
                 }
-                Found = UtilityRoutines::FindItemInList(Branch(Count).Component(Loop).OutletNodeName, BranchNodes(Count).UniqueNodeNames, NodeNum);
-                if (Found == 0) {
+                if (BranchNodeNames.insert(Branch(Count).Component(Loop).OutletNodeName).second) {
                     ++NodeNum;
                     BranchNodes(Count).UniqueNodeNames(NodeNum) = Branch(Count).Component(Loop).OutletNodeName;
+                    NodeNameBranches[Branch(Count).Component(Loop).OutletNodeName].push_back(Count);
                 }
             }
             BranchNodes(Count).NumNodes = NodeNum;
         }
-        // Check Uniqueness branch to branch
+        // Check Uniqueness branch to branch, reported by later branch and then by node as the pairwise search did
+        std::vector<std::pair<int, int>> Duplicates; // (later branch, node) pairs for the current branch
         for (Count = 1; Count <= NumOfBranches; ++Count) {
-            for (Loop = Count + 1; Loop <= NumOfBranches; ++Loop) {
-                for (Loop2 = 1; Loop2 <= BranchNodes(Count).NumNodes; ++Loop2) {
-                    Found = UtilityRoutines::FindItemInList(
-                        BranchNodes(Count).UniqueNodeNames(Loop2), BranchNodes(Loop).UniqueNodeNames, BranchNodes(Loop).NumNodes);
-                    if (Found != 0) {
-                        ShowSevereError("Non-unique node name found, name=" + BranchNodes(Count).UniqueNodeNames(Loop2));
-                        ShowContinueError("..1st occurrence in Branch=" + Branch(Count).Name);
-                        ShowContinueError("..duplicate occurrence in Branch=" + Branch(Loop).Name);
-                        ErrFound = true;
-                    }
+            Duplicates.clear();
+            for (Loop2 = 1; Loop2 <= BranchNodes(Count).NumNodes; ++Loop2) {
+                for (int const OtherBranch : NodeNameBranches[BranchNodes(Count).UniqueNodeNames(Loop2)]) {
+                    if (OtherBranch > Count) Duplicates.emplace_back(OtherBranch, Loop2);
                 }
             }
+            std::sort(Duplicates.begin(), Duplicates.end());
+            for (auto const &Duplicate : Duplicates) {
+                ShowSevereError("Non-unique node name found, name=" + BranchNodes(Count).UniqueNodeNames(Duplicate.second));
+                ShowContinueError("..1st occurrence in Branch=" + Branch(Count).Name);
+                ShowContinueError("..duplicate occurrence in Branch=" + Branch(Duplicate.first).Name);
+                ErrFound = true;
+            }
         }
         for (Count = 1; Count <= NumOfBranches; ++Count) {
             BranchNodes(Count).UniqueNodeNames.deallocate();
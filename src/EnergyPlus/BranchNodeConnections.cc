@@ -57,6 +57,7 @@
 #include <DataGlobals.hh>
 #include <DataLoopNode.hh>
 #include <General.hh>
+#include <NodeInputManager.hh>
 #include <UtilityRoutines.hh>
 
 namespace EnergyPlus {
@@ -850,8 +851,8 @@ namespace BranchNodeConnections {
             InletNodeName = ParentNodeList(Which).InletNodeName;
             OutletNodeName = ParentNodeList(Which).OutletNodeName;
             // Get Node Numbers
-            InletNodeNum = UtilityRoutines::FindItemInList(InletNodeName, NodeID({1, NumOfNodes}), NumOfNodes);
-            OutletNodeNum = UtilityRoutines::FindItemInList(OutletNodeName, NodeID({1, NumOfNodes}), NumOfNodes);
+            InletNodeNum = NodeInputManager::FindNodeNumber(InletNodeName);
+            OutletNodeNum = NodeInputManager::FindNodeNumber(OutletNodeName);
             //    IF (InletNodeNum == 0 .and. ComponentType /= 'ZONEHVAC:AIRDISTRIBUTIONUNIT') THEN
             //      CALL ShowWarningError('GetParentData: Component Type='//TRIM(ComponentType)//  &
             //        ', Component Name='//TRIM(ComponentName))
@@ -869,8 +870,8 @@ namespace BranchNodeConnections {
             if (Which != 0) {
                 InletNodeName = CompSets(Which).InletNodeName;
                 OutletNodeName = CompSets(Which).OutletNodeName;
-                InletNodeNum = UtilityRoutines::FindItemInList(InletNodeName, NodeID({1, NumOfNodes}), NumOfNodes);
-                OutletNodeNum = UtilityRoutines::FindItemInList(OutletNodeName, NodeID({1, NumOfNodes}), NumOfNodes);
+                InletNodeNum = NodeInputManager::FindNodeNumber(InletNodeName);
+                OutletNodeNum = NodeInputManager::FindNodeNumber(OutletNodeName);
                 //      IF (InletNodeNum == 0 .and. ComponentType /= 'ZONEHVAC:AIRDISTRIBUTIONUNIT') THEN
                 //        CALL ShowWarningError('GetParentData: Component Type='//TRIM(ComponentType)//  &
                 //          ', Component Name='//TRIM(ComponentName))
@@ -1272,7 +1273,7 @@ namespace BranchNodeConnections {
                         ChildInNodeName(CountNum) = CompSets(Loop).InletNodeName;
                         ChildOutNodeName(CountNum) = CompSets(Loop).OutletNodeName;
                         // Get Node Numbers
-                        ChildInNodeNum(CountNum) = UtilityRoutines::FindItemInList(ChildInNodeName(CountNum), NodeID({1, NumOfNodes}), NumOfNodes);
+                        ChildInNodeNum(CountNum) = NodeInputManager::FindNodeNumber(ChildInNodeName(CountNum));
                         //          IF (ChildInNodeNum(CountNum) == 0) THEN
                         //            CALL ShowSevereError('GetChildrenData: Inlet Node not previously assigned, Node='//  &
                         //                    TRIM(ChildInNodeName(CountNum)))
@@ -1280,7 +1281,7 @@ namespace BranchNodeConnections {
                         //            CALL ShowContinueError('..Parent Object='//TRIM(ComponentType)//':'//TRIM(ComponentName))
                         //            ErrInObject=.TRUE.
                         //          ENDIF
-                        ChildOutNodeNum(CountNum) = UtilityRoutines::FindItemInList(ChildOutNodeName(CountNum), NodeID({1, NumOfNodes}), NumOfNodes);
+                        ChildOutNodeNum(CountNum) = NodeInputManager::FindNodeNumber(ChildOutNodeName(CountNum));
                         //          IF (ChildOutNodeNum(CountNum) == 0) THEN
                         //            CALL ShowSevereError('GetChildrenData: Outlet Node not previously assigned, Node='//  &
                         //                    TRIM(ChildOutNodeName(CountNum)))
@@ -45,6 +45,12 @@
 // OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+// C++ Headers
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
 // CLI Headers
 #include <ezOptionParser.hpp>
 
@@ -80,6 +86,48 @@ namespace CommandLineInterface {
     using namespace SolarShading;
     using namespace ez;
 
+    // ExpandObjects only rewrites the HVACTemplate and GroundHeatTransfer objects of the input, so an input
+    // without any of them is simulated unchanged and the extra read, write and parse can be skipped.
+    bool InputNeedsExpandObjects(std::string const &inputFileName)
+    {
+        std::ifstream inputFile(inputFileName);
+        if (!inputFile) return true; // let ExpandObjects report the problem
+        std::string line;
+        while (std::getline(inputFile, line)) {
+            std::string::size_type const commentPosition = line.find('!');
+            if (commentPosition != std::string::npos) line.erase(commentPosition);
+            line = UtilityRoutines::MakeUPPERCase(line);
+            if ((line.find("HVACTEMPLATE:") != std::string::npos) || (line.find("GROUNDHEATTRANSFER:") != std::string::npos)) return true;
+        }
+        return false;
+    }
+
+    // Short fingerprint (64 bit FNV-1a of the contents) of a file read by ExpandObjects
+    std::string FileFingerprint(std::string const &fileName)
+    {
+        std::ifstream file(fileName, std::ios::binary);
+        if (!file) return "none";
+        std::uint64_t hash(FileSystem::hashBasis);
+        std::vector<char> buffer(1 << 16);
+        while (file.read(buffer.data(), buffer.size()) || (file.gcount() > 0)) {
+            hash = FileSystem::hashBytes(buffer.data(), file.gcount(), hash);
+            if (!file) break;
+        }
+        return FileSystem::hashToHex(hash);
+    }
+
+    // True if the expanded input was written by a previous run from the same inputs
+    bool ExpansionIsCurrent(std::string const &keyFileName, std::string const &expandedFileName, std::string const &expandKey)
+    {
+        std::ifstream expandedFile(expandedFileName);
+        if (!expandedFile) return false;
+        std::ifstream keyFile(keyFileName);
+        if (!keyFile) return false;
+        std::ostringstream previousKey;
+        previousKey << keyFile.rdbuf();
+        return previousKey.str() == expandKey;
+    }
+
     int ProcessArgs(int argc, const char *argv[])
     {
         typedef std::string::size_type size_type;
@@ -150,6 +198,30 @@ namespace CommandLineInterface {
 
         opt.add("", 0, 0, 0, "Output IDF->epJSON or epJSON->IDF, dependent on input file type", "-c", "--convert");
 
+        opt.add("",
+                0,
+                1,
+                0,
+                "Write the surface and zone air temperature state at the end of day DAY of the weather run period to the .ckpt output file",
+                "--checkpoint-at");
+
+        opt.add("", 0, 1, 0, "Start the weather run period from a .ckpt file written by --checkpoint-at instead of warming up", "--restart-from");
+
+        opt.add("",
+                0,
+                1,
+                0,
+                "Run every simulation listed in a JSON manifest in this process, decoding each base input file only once",
+                "--batch");
+
+        opt.add("",
+                0,
+                1,
+                0,
+                "Output a binary epJSON copy of the input file (CBOR, MSGPACK, or UBJSON) that can be used directly as input",
+                "-b",
+                "--convert-binary");
+
         opt.add("L",
                 0,
                 1,
@@ -199,6 +271,29 @@ namespace CommandLineInterface {
 
         outputEpJSONConversion = opt.isSet("-c");
 
+        if (opt.isSet("--checkpoint-at")) {
+            opt.get("--checkpoint-at")->getInt(CheckpointAtDay);
+            if (CheckpointAtDay < 1) {
+                DisplayString("ERROR: The day for --checkpoint-at must be a positive integer.");
+                DisplayString(errorFollowUp);
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        if (opt.isSet("--restart-from")) {
+            opt.get("--restart-from")->getString(RestartFromFileName);
+        }
+
+        if (opt.isSet("-b")) {
+            opt.get("-b")->getString(outputEpJSONBinaryFormat);
+            std::transform(outputEpJSONBinaryFormat.begin(), outputEpJSONBinaryFormat.end(), outputEpJSONBinaryFormat.begin(), ::toupper);
+            if (outputEpJSONBinaryFormat != "CBOR" && outputEpJSONBinaryFormat != "MSGPACK" && outputEpJSONBinaryFormat != "UBJSON") {
+                DisplayString("ERROR: Unrecognized argument for binary epJSON conversion: " + outputEpJSONBinaryFormat);
+                DisplayString(errorFollowUp);
+                exit(EXIT_FAILURE);
+            }
+        }
+
         // Process standard arguments
         if (opt.isSet("-h")) {
             DisplayString(usage);
@@ -210,6 +305,18 @@ namespace CommandLineInterface {
             exit(EXIT_SUCCESS);
         }
 
+        // The manifest describes the input, weather and output of every run, so the remaining checks are done per run
+        if (opt.isSet("--batch")) {
+            if (opt.lastArgs.size() > 0) {
+                DisplayString("ERROR: An input file cannot be given together with --batch; list it in the manifest instead.");
+                DisplayString(errorFollowUp);
+                exit(EXIT_FAILURE);
+            }
+            opt.get("--batch")->getString(BatchManifestFileName);
+            makeNativePath(BatchManifestFileName);
+            return 0;
+        }
+
         if (opt.lastArgs.size() == 1) {
             for (size_type i = 0; i < opt.lastArgs.size(); ++i) {
                 std::string const &arg(*opt.lastArgs[i]);
@@ -222,6 +329,7 @@ namespace CommandLineInterface {
         makeNativePath(inputFileName);
         makeNativePath(inputWeatherFileName);
         makeNativePath(inputIddFileName);
+        makeNativePath(RestartFromFileName);
         makeNativePath(outDirPathName);
 
         std::vector<std::string> badOptions;
@@ -265,8 +373,11 @@ namespace CommandLineInterface {
         } else if (inputFileExt == "MSGPACK") {
             isEpJSON = true;
             isMsgPack = true;
+        } else if (inputFileExt == "UBJSON") {
+            isEpJSON = true;
+            isUBJSON = true;
         } else {
-            DisplayString("ERROR: Input file must have IDF, IMF, or epJSON extension.");
+            DisplayString("ERROR: Input file must have IDF, IMF, epJSON, CBOR, MSGPACK, or UBJSON extension.");
             exit(EXIT_FAILURE);
         }
 
@@ -310,6 +421,7 @@ namespace CommandLineInterface {
 
         std::string outputExpidfFileName;
         std::string outputExperrFileName;
+        std::string outputExpkeyFileName;
 
         std::string normalSuffix;
         std::string tableSuffix;
@@ -369,11 +481,14 @@ namespace CommandLineInterface {
 
         // EnergyPlus files
         outputAuditFileName = outputFilePrefix + normalSuffix + ".audit";
+        outputBinFileName = outputFilePrefix + normalSuffix + ".bin";
         outputBndFileName = outputFilePrefix + normalSuffix + ".bnd";
         outputDxfFileName = outputFilePrefix + normalSuffix + ".dxf";
         outputEioFileName = outputFilePrefix + normalSuffix + ".eio";
         outputEndFileName = outputFilePrefix + normalSuffix + ".end";
+        outputCkptFileName = outputFilePrefix + normalSuffix + ".ckpt";
         outputErrFileName = outputFilePrefix + normalSuffix + ".err";
+        outputTimersFileName = outputFilePrefix + normalSuffix + ".timers";
         outputEsoFileName = outputFilePrefix + normalSuffix + ".eso";
 
         outputJsonFileName = outputFilePrefix + normalSuffix + ".json";
@@ -407,10 +522,15 @@ namespace CommandLineInterface {
         outputMtdFileName = outputFilePrefix + normalSuffix + ".mtd";
         outputMddFileName = outputFilePrefix + normalSuffix + ".mdd";
         outputMtrFileName = outputFilePrefix + normalSuffix + ".mtr";
+        outputPsyCsvFileName = outputFilePrefix + normalSuffix + "_psychrometrics.csv";
+        outputPlantTimingCsvFileName = outputFilePrefix + normalSuffix + "_planttiming.csv";
+        outputPerformanceJsonFileName = outputFilePrefix + normalSuffix + "_performance.json";
+        outputHVACIterationCsvFileName = outputFilePrefix + normalSuffix + "_hvaciterations.csv";
         outputRddFileName = outputFilePrefix + normalSuffix + ".rdd";
         outputShdFileName = outputFilePrefix + normalSuffix + ".shd";
         outputDfsFileName = outputFilePrefix + normalSuffix + ".dfs";
         outputGLHEFileName = outputFilePrefix + normalSuffix + ".glhe";
+        outputKivaFileName = outputFilePrefix + normalSuffix + ".kiva";
         outputEddFileName = outputFilePrefix + normalSuffix + ".edd";
         outputIperrFileName = outputFilePrefix + normalSuffix + ".iperr";
         outputSlnFileName = outputFilePrefix + normalSuffix + ".sln";
@@ -461,6 +581,7 @@ namespace CommandLineInterface {
         // ExpandObjects files
         outputExpidfFileName = outputFilePrefix + normalSuffix + ".expidf";
         outputExperrFileName = outputFilePrefix + normalSuffix + ".experr";
+        outputExpkeyFileName = outputFilePrefix + normalSuffix + ".expkey";
 
         // Handle bad options
         if (!opt.gotExpected(badOptions)) {
@@ -570,6 +691,19 @@ namespace CommandLineInterface {
             }
         }
 
+        if (!RestartFromFileName.empty()) {
+            {
+                IOFlags flags;
+                ObjexxFCL::gio::inquire(RestartFromFileName, flags);
+                FileExists = flags.exists();
+            }
+            if (!FileExists) {
+                DisplayString("ERROR: Could not find restart file: " + getAbsolutePath(RestartFromFileName) + ".");
+                DisplayString(errorFollowUp);
+                exit(EXIT_FAILURE);
+            }
+        }
+
         OutputFileDebug = GetNewUnitNumber();
         {
             IOFlags flags;
@@ -608,6 +742,11 @@ namespace CommandLineInterface {
             inputFileName = outputEpmidfFileName;
         }
 
+        if (runExpandObjects && !InputNeedsExpandObjects(inputFileName)) {
+            DisplayString("No HVACTemplate or GroundHeatTransfer objects in the input, skipping ExpandObjects.");
+            runExpandObjects = false;
+        }
+
         if (runExpandObjects) {
             std::string expandObjectsPath = exeDirectory + "ExpandObjects" + exeExtension;
             {
@@ -636,20 +775,33 @@ namespace CommandLineInterface {
 
             bool iddFileNamedEnergy = (getAbsolutePath(inputIddFileName) == getAbsolutePath("Energy+.idd"));
 
-            if (!inputFileNamedIn) linkFile(inputFileName.c_str(), "in.idf");
-            if (!iddFileNamedEnergy) linkFile(inputIddFileName, "Energy+.idd");
-            systemCall(expandObjectsCommand);
-            if (!inputFileNamedIn) removeFile("in.idf");
-            if (!iddFileNamedEnergy) removeFile("Energy+.idd");
-            moveFile("expandedidf.err", outputExperrFileName);
-            {
-                IOFlags flags;
-                ObjexxFCL::gio::inquire("expanded.idf", flags);
-                FileExists = flags.exists();
-            }
-            if (FileExists) {
-                moveFile("expanded.idf", outputExpidfFileName);
+            // the expansion (including the Slab and Basement ground simulations) only depends on these files,
+            // so the expanded input of a previous run is reused as long as none of them changed
+            std::string const expandKey = "input " + FileFingerprint(inputFileName) + "\nidd " + FileFingerprint(inputIddFileName) +
+                                          "\nweather " + FileFingerprint(inputWeatherFileName) + "\nexpandobjects " +
+                                          FileFingerprint(expandObjectsPath) + "\n";
+            if (ExpansionIsCurrent(outputExpkeyFileName, outputExpidfFileName, expandKey)) {
+                DisplayString("ExpandObjects inputs unchanged, reusing " + outputExpidfFileName);
                 inputFileName = outputExpidfFileName;
+            } else {
+                removeFile(outputExpkeyFileName);
+                if (!inputFileNamedIn) linkFile(inputFileName.c_str(), "in.idf");
+                if (!iddFileNamedEnergy) linkFile(inputIddFileName, "Energy+.idd");
+                systemCall(expandObjectsCommand);
+                if (!inputFileNamedIn) removeFile("in.idf");
+                if (!iddFileNamedEnergy) removeFile("Energy+.idd");
+                moveFile("expandedidf.err", outputExperrFileName);
+                {
+                    IOFlags flags;
+                    ObjexxFCL::gio::inquire("expanded.idf", flags);
+                    FileExists = flags.exists();
+                }
+                if (FileExists) {
+                    moveFile("expanded.idf", outputExpidfFileName);
+                    inputFileName = outputExpidfFileName;
+                    std::ofstream keyFile(outputExpkeyFileName);
+                    keyFile << expandKey;
+                }
             }
         }
 
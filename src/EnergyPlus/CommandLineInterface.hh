@@ -58,6 +58,15 @@ namespace CommandLineInterface {
     // Process command line arguments
     int ENERGYPLUSLIB_API ProcessArgs(int argc, const char *argv[]);
 
+    // Whether the input has objects that ExpandObjects would rewrite
+    bool InputNeedsExpandObjects(std::string const &inputFileName);
+
+    // Short fingerprint of the contents of a file read by ExpandObjects
+    std::string FileFingerprint(std::string const &fileName);
+
+    // Whether the expanded input was written by a previous run from the same inputs
+    bool ExpansionIsCurrent(std::string const &keyFileName, std::string const &expandedFileName, std::string const &expandKey);
+
     void ReadINIFile(int const UnitNumber,               // Unit number of the opened INI file
                      std::string const &Heading,         // Heading for the parameters ('[heading]')
                      std::string const &KindofParameter, // Kind of parameter to be found (String)
@@ -46,6 +46,7 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 // C++ Headers
+#include <array>
 #include <cassert>
 #include <cmath>
 
@@ -206,6 +207,60 @@ namespace CondenserLoopTowers {
     Array1D<VSTowerData> VSTower;              // model coefficients and specific variables for VS tower
     std::unordered_map<std::string, std::string> UniqueSimpleTowerNames;
 
+    namespace {
+        // Exponents of the inputs in each term of the variable speed tower approach correlations, in coefficient order (see
+        // CalcVSTowerApproach).  The inputs are (flow, water flow, Twb, Tr): the YorkCalc flow input is the water to air flow ratio
+        // and it has no second flow input; the CoolTools flow inputs are the fan power ratio and the water flow ratio.
+        int const YorkCalcExponents[27][4] = {
+            {0, 0, 0, 0}, {0, 0, 1, 0}, {0, 0, 2, 0}, {0, 0, 0, 1}, {0, 0, 1, 1}, {0, 0, 2, 1}, {0, 0, 0, 2},
+            {0, 0, 1, 2}, {0, 0, 2, 2}, {1, 0, 0, 0}, {1, 0, 1, 0}, {1, 0, 2, 0}, {1, 0, 0, 1}, {1, 0, 1, 1},
+            {1, 0, 2, 1}, {1, 0, 0, 2}, {1, 0, 1, 2}, {1, 0, 2, 2}, {2, 0, 0, 0}, {2, 0, 1, 0}, {2, 0, 2, 0},
+            {2, 0, 0, 1}, {2, 0, 1, 1}, {2, 0, 2, 1}, {2, 0, 0, 2}, {2, 0, 1, 2}, {2, 0, 2, 2}};
+        int const CoolToolsExponents[35][4] = {
+            {0, 0, 0, 0}, {1, 0, 0, 0}, {2, 0, 0, 0}, {3, 0, 0, 0}, {0, 1, 0, 0}, {1, 1, 0, 0}, {2, 1, 0, 0},
+            {0, 2, 0, 0}, {1, 2, 0, 0}, {0, 3, 0, 0}, {0, 0, 1, 0}, {1, 0, 1, 0}, {2, 0, 1, 0}, {0, 1, 1, 0},
+            {1, 1, 1, 0}, {0, 2, 1, 0}, {0, 0, 2, 0}, {1, 0, 2, 0}, {0, 1, 2, 0}, {0, 0, 3, 0}, {0, 0, 0, 1},
+            {1, 0, 0, 1}, {2, 0, 0, 1}, {0, 1, 0, 1}, {1, 1, 0, 1}, {0, 2, 0, 1}, {0, 0, 1, 1}, {1, 0, 1, 1},
+            {0, 1, 1, 1}, {0, 0, 2, 1}, {0, 0, 0, 2}, {1, 0, 0, 2}, {0, 1, 0, 2}, {0, 0, 1, 2}, {0, 0, 0, 3}};
+    } // namespace
+
+    // Reduces the approach correlation of TowerNum to a cubic in the model input Varied with the other Inputs fixed, so that a solve
+    // varying only that input evaluates a polynomial instead of the full correlation.  Approach = sum of Coef[k] * input^k.
+    void ReduceVSTowerApproach(int const TowerNum, int const Varied, std::array<Real64, 4> const &Inputs, std::array<Real64, 4> &Coef)
+    {
+        auto const &Coeff(VSTower(SimpleTower(TowerNum).VSTower).Coeff);
+        bool const isYorkCalc(SimpleTower(TowerNum).TowerModelType == YorkCalcModel ||
+                              SimpleTower(TowerNum).TowerModelType == YorkCalcUserDefined);
+        int const NumTerms(isYorkCalc ? 27 : 35);
+        Coef.fill(0.0);
+        for (int Term = 0; Term < NumTerms; ++Term) {
+            int const *Exponents(isYorkCalc ? YorkCalcExponents[Term] : CoolToolsExponents[Term]);
+            Real64 Product(Coeff(Term + 1));
+            for (int Input = 0; Input < 4; ++Input) {
+                if (Input == Varied) continue;
+                for (int Power = 0; Power < Exponents[Input]; ++Power) {
+                    Product *= Inputs[Input];
+                }
+            }
+            Coef[Exponents[Varied]] += Product;
+        }
+    }
+
+    Real64 ReducedVSTowerApproach(std::array<Real64, 4> const &Coef, Real64 const X)
+    {
+        return Coef[0] + X * (Coef[1] + X * (Coef[2] + X * Coef[3]));
+    }
+
+    // Model inputs of the approach correlation of TowerNum in the order of the exponent tables, as CalcVSTowerApproach forms them
+    std::array<Real64, 4>
+    VSTowerModelInputs(int const TowerNum, Real64 const PctWaterFlow, Real64 const AirFlowRatio, Real64 const Twb, Real64 const Tr)
+    {
+        if (SimpleTower(TowerNum).TowerModelType == YorkCalcModel || SimpleTower(TowerNum).TowerModelType == YorkCalcUserDefined) {
+            return {{PctWaterFlow / AirFlowRatio, 0.0, Twb, Tr}};
+        }
+        return {{pow_3(AirFlowRatio), PctWaterFlow, Twb, Tr}};
+    }
+
     // MODULE SUBROUTINES:
 
     // Beginning of CondenserLoopTowers Module Driver Subroutines
@@ -6037,6 +6092,7 @@ namespace CondenserLoopTowers {
         //                      Jul. 2010, B Griffith, general fluid props
         //                      Jun. 2016, R Zhang, Applied the condenser supply water temperature sensor fault model
         //                      Jul. 2016, R Zhang, Applied the cooling tower fouling fault model
+        //                      Oct. 2026, air flow ratio solved on the approach correlation reduced to its flow input
         //       RE-ENGINEERED
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -6117,7 +6173,6 @@ namespace CondenserLoopTowers {
         Real64 AirMassFlowRate;                // Mass flow rate of air [kg/s]
         Real64 InletAirEnthalpy;               // Enthalpy of entering moist air [J/kg]
         int SolFla;                            // Flag of solver
-        Array1D<Real64> Par(6);                // Parameter array for regula falsi solver
         Real64 Twb;                            // inlet air wet-bulb temperature
         Real64 TwbCapped;                      // inlet air wet-bulb temp passed to VS tower model
         Real64 Tr;                             // range temperature
@@ -6310,17 +6365,19 @@ namespace CondenserLoopTowers {
                     // Setpoint was met with pump ON and fan ON at full flow
                     // Calculate the fraction of full air flow to exactly meet the setpoint temperature
 
-                    Par(1) = TowerNum; // Index to cooling tower
                     //         cap the water flow rate ratio and inlet air wet-bulb temperature to provide a stable output
-                    Par(2) = WaterFlowRateRatioCapped; // water flow rate ratio
-                    Par(3) = TwbCapped;                // Inlet air wet-bulb temperature [C]
                     //         do not cap desired range and approach temperature to provide a valid (balanced) output for this simulation time step
-                    Par(4) = Tr;  // Tower range temperature [C]
-                    Par(5) = Ta;  // desired approach temperature [C]
-                    Par(6) = 1.0; // calculate the air flow rate ratio required for a balance
-
-                    SolveRoot(
-                        Acc, MaxIte, SolFla, AirFlowRateRatio, SimpleTowerApproachResidual, SimpleTower(TowerNum).MinimumVSAirFlowFrac, 1.0, Par);
+                    //         the residual is that of SimpleTowerApproachResidual with the approach correlation reduced to a cubic in its flow input
+                    std::array<Real64, 4> ApproachCoef;
+                    ReduceVSTowerApproach(TowerNum, 0, VSTowerModelInputs(TowerNum, WaterFlowRateRatioCapped, 1.0, TwbCapped, Tr), ApproachCoef);
+                    bool const isYorkCalc(SimpleTower(TowerNum).TowerModelType == YorkCalcModel ||
+                                          SimpleTower(TowerNum).TowerModelType == YorkCalcUserDefined);
+                    auto const AirFlowResidual = [&](Real64 const AirFlowRatio) {
+                        Real64 const FlowInput(isYorkCalc ? WaterFlowRateRatioCapped / AirFlowRatio : pow_3(AirFlowRatio));
+                        return Ta - ReducedVSTowerApproach(ApproachCoef, FlowInput);
+                    };
+
+                    SolveRoot(Acc, MaxIte, SolFla, AirFlowRateRatio, AirFlowResidual, SimpleTower(TowerNum).MinimumVSAirFlowFrac, 1.0);
                     if (SolFla == -1) {
                         if (!WarmupFlag)
                             ShowWarningError("Cooling tower iteration limit exceeded when calculating air flow rate ratio for tower " +
@@ -6584,7 +6641,7 @@ namespace CondenserLoopTowers {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Richard Raustad, FSEC
         //       DATE WRITTEN   Feb. 2005
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, range solved on the approach correlation reduced to a cubic in the range
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -6622,16 +6679,16 @@ namespace CondenserLoopTowers {
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
         int SolFla;               // Flag of solver
-        Array1D<Real64> Par(4);   // Parameter array for regula falsi solver
         Real64 Tr;                // range temperature which results in an energy balance
         Real64 TempSetPoint(0.0); // local temporary for loop setpoint
 
         //   determine tower outlet water temperature
-        Par(1) = TowerNum;           // Index to cooling tower
-        Par(2) = WaterFlowRateRatio; // water flow rate ratio
-        Par(3) = AirFlowRateRatio;   // air flow rate ratio
-        Par(4) = Twb;                // inlet air wet-bulb temperature [C]
-        SolveRoot(Acc, MaxIte, SolFla, Tr, SimpleTowerTrResidual, 0.001, VSTower(SimpleTower(TowerNum).VSTower).MaxRangeTemp, Par);
+        //   the residual is that of SimpleTowerTrResidual with the approach correlation reduced to a cubic in the range
+        std::array<Real64, 4> ApproachCoef;
+        ReduceVSTowerApproach(TowerNum, 3, VSTowerModelInputs(TowerNum, WaterFlowRateRatio, AirFlowRateRatio, Twb, 0.0), ApproachCoef);
+        Real64 const WaterInletTemp(Node(SimpleTower(TowerNum).WaterInletNodeNum).Temp);
+        auto const TrResidual = [&](Real64 const Trange) { return (Twb + ReducedVSTowerApproach(ApproachCoef, Trange) + Trange) - WaterInletTemp; };
+        SolveRoot(Acc, MaxIte, SolFla, Tr, TrResidual, 0.001, VSTower(SimpleTower(TowerNum).VSTower).MaxRangeTemp);
 
         OutletWaterTemp = SimpleTowerInlet(TowerNum).WaterTemp - Tr;
 
@@ -48,6 +48,9 @@
 #ifndef CondenserLoopTowers_hh_INCLUDED
 #define CondenserLoopTowers_hh_INCLUDED
 
+// C++ Headers
+#include <array>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -520,6 +523,17 @@ namespace CondenserLoopTowers {
                              Real64 &Approach           // Calculated approach temperature [C]
     );
 
+    void ReduceVSTowerApproach(int const TowerNum,                  // Index to cooling tower
+                               int const Varied,                    // Model input the approach is reduced to (0 = flow, 3 = range)
+                               std::array<Real64, 4> const &Inputs, // Model inputs, see VSTowerModelInputs
+                               std::array<Real64, 4> &Coef          // Coefficients of the approach cubic in the varied input
+    );
+
+    Real64 ReducedVSTowerApproach(std::array<Real64, 4> const &Coef, Real64 const X);
+
+    std::array<Real64, 4>
+    VSTowerModelInputs(int const TowerNum, Real64 const PctWaterFlow, Real64 const AirFlowRatio, Real64 const Twb, Real64 const Tr);
+
     void CheckModelBounds(int const TowerNum,              // index to tower
                           Real64 const Twb,                // current inlet air wet-bulb temperature (C)
                           Real64 const Tr,                 // requested range temperature for current time step (C)
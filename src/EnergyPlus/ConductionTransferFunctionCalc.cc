@@ -299,6 +299,7 @@ namespace ConductionTransferFunctionCalc {
         Array1D_bool ResLayer(MaxLayersInConstruct); // Set true if the layer must be handled as a resistive
         bool RevConst;                               // Set true if one construct is the reverse of another (CTFs already
         // available)
+        bool SameConst; // Set true if one construct has the same layers as another (CTFs already available)
         Array1D<Real64> rho(MaxLayersInConstruct); // Density of a material layer
         Array1D<Real64> rk(MaxLayersInConstruct);  // Thermal conductivity of a material layer
         Real64 rs;                                 // Total thermal resistance of the building element
@@ -558,8 +559,9 @@ namespace ConductionTransferFunctionCalc {
                 // calculated unless this is a reverse of a previously defined
                 // construction.
 
-                // Check for reversed construction of interzone surfaces by checking
-                // previous constructions for same number of layers as first indicator.
+                // Check for reversed construction of interzone surfaces (or an identical
+                // layer stack defined under another name) by checking previous
+                // constructions for same number of layers as first indicator.
 
                 RevConst = false;
 
@@ -573,30 +575,55 @@ namespace ConductionTransferFunctionCalc {
                     if (Construct(ConstrNum).TotLayers == Construct(Constr).TotLayers) { // Same number of layers--now | check for reversed construct.
 
                         RevConst = true;
+                        SameConst = true;
 
                         for (Layer = 1; Layer <= Construct(ConstrNum).TotLayers; ++Layer) { // Begin layers loop ...
 
-                            // RevConst is set to FALSE anytime a mismatch in materials is found.
-                            // This will exit this DO immediately and go on to the next construct
-                            // (if any remain).
+                            // RevConst (SameConst) is set to FALSE anytime a mismatch in materials is found.
+                            // Once both are FALSE this will exit this DO immediately and go on to the next
+                            // construct (if any remain).
 
                             OppositeLayer = Construct(ConstrNum).TotLayers - Layer + 1;
 
                             if (Construct(ConstrNum).LayerPoint(Layer) != Construct(Constr).LayerPoint(OppositeLayer)) {
-
                                 RevConst = false;
-                                break; // Layer DO loop
                             }
+                            if (Construct(ConstrNum).LayerPoint(Layer) != Construct(Constr).LayerPoint(Layer)) {
+                                SameConst = false;
+                            }
+                            if (!RevConst && !SameConst) break; // Layer DO loop
 
                         } // ... end of layers loop.
 
-                        // If the reverse construction isn't used by any surfaces then the CTFs
+                        // If the reverse (or identical) construction isn't used by any surfaces then the CTFs
                         // still need to be defined.
-                        if (RevConst && !Construct(Constr).IsUsedCTF) {
+                        if (!Construct(Constr).IsUsedCTF) {
                             RevConst = false;
+                            SameConst = false;
                         }
 
-                        if (RevConst) { // Curent construction is a reverse of
+                        if (SameConst) { // Current construction has the same layers as
+                            // construction Constr.  Thus, CTFs do not need to be re-
+                            // calculated.  Copy CTF info for construction Constr to
+                            // construction ConstrNum.
+
+                            Construct(ConstrNum).CTFTimeStep = Construct(Constr).CTFTimeStep;
+                            Construct(ConstrNum).NumHistories = Construct(Constr).NumHistories;
+                            Construct(ConstrNum).NumCTFTerms = Construct(Constr).NumCTFTerms;
+
+                            for (HistTerm = 0; HistTerm <= Construct(ConstrNum).NumCTFTerms; ++HistTerm) {
+
+                                Construct(ConstrNum).CTFInside(HistTerm) = Construct(Constr).CTFInside(HistTerm);
+                                Construct(ConstrNum).CTFCross(HistTerm) = Construct(Constr).CTFCross(HistTerm);
+                                Construct(ConstrNum).CTFOutside(HistTerm) = Construct(Constr).CTFOutside(HistTerm);
+                                if (HistTerm != 0) Construct(ConstrNum).CTFFlux(HistTerm) = Construct(Constr).CTFFlux(HistTerm);
+
+                            } // ... end of CTF history terms loop.
+
+                            RevConst = true; // CTFs are available, skip the state space calculation below
+                            break;           // Constr DO loop
+
+                        } else if (RevConst) { // Curent construction is a reverse of
                             // construction Constr.  Thus, CTFs do not need to be re-
                             // calculated.  Copy CTF info for construction Constr to
                             // construction ConstrNum.
@@ -242,9 +242,15 @@ namespace ConvectionCoefficients {
     Array1D<HcInsideFaceUserCurveStruct> HcInsideUserCurve;
     Array1D<HcOutsideFaceUserCurveStruct> HcOutsideUserCurve;
     RoofGeoCharactisticsStruct RoofGeo;
+    Array1D<ExtHfWindTermStruct> ExtHfWindTerm; // Last wind driven exterior Hc term, by surface
 
     // Functions
 
+    void clear_state()
+    {
+        ExtHfWindTerm.deallocate();
+    }
+
     void InitInteriorConvectionCoeffs(Array1S<Real64> const SurfaceTemperatures, // Temperature of surfaces for evaluation of HcIn
                                       Optional_int_const ZoneToResimulate        // if passed in, then only calculate surfaces that have this zone
     )
@@ -386,6 +392,10 @@ namespace ConvectionCoefficients {
         }
         for (ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum) {
 
+            // adaptive convection zone flow regime, evaluated on first use for this zone
+            int ZoneFlowRegime = 0;
+            int ZoneForcedFlowRegime = 0;
+
             for (SurfNum = Zone(ZoneNum).SurfaceFirst; SurfNum <= Zone(ZoneNum).SurfaceLast; ++SurfNum) {
 
                 if (!Surface(SurfNum).HeatTransSurf) continue; // Skip non-heat transfer surfaces
@@ -429,7 +439,8 @@ namespace ConvectionCoefficients {
 
                     } else if (SELECT_CASE_var1 == AdaptiveConvectionAlgorithm) {
 
-                        ManageInsideAdaptiveConvectionAlgo(SurfNum);
+                        if (ZoneFlowRegime == 0) DynamicIntConvZoneFlowRegime(ZoneNum, ZoneFlowRegime, ZoneForcedFlowRegime);
+                        ManageInsideAdaptiveConvectionAlgo(SurfNum, ZoneFlowRegime, ZoneForcedFlowRegime);
 
                     } else if ((SELECT_CASE_var1 == CeilingDiffuser) || (SELECT_CASE_var1 == TrombeWall)) {
                         // Already done above and can't be at individual surface
@@ -509,7 +520,6 @@ namespace ConvectionCoefficients {
         Real64 TGround;
         Real64 Hn;        // Natural part of exterior convection
         Real64 Hf;        // Forced part of exterior convection
-        Real64 rCalcPerimeter; // approximation for Perimeter
         int BaseSurf;
         int SrdSurfsNum; // Srd surface counter
         // REAL(r64) :: flag
@@ -627,18 +637,7 @@ namespace ConvectionCoefficients {
                         return CalcASHRAETARPNatural(Ts, Tamb, cosTilt) + hfTerm;
                     };
                 } else {
-                    if (Surface(BaseSurf).GrossArea != 0.0 && Surface(BaseSurf).Height != 0.0) {
-                        rCalcPerimeter = 2.0 * (Surface(BaseSurf).GrossArea / Surface(BaseSurf).Height + Surface(BaseSurf).Height);
-                        Hf = CalcHfExteriorSparrow(SurfWindSpeed,
-                                                   Surface(BaseSurf).GrossArea,
-                                                   rCalcPerimeter,
-                                                   Surface(SurfNum).CosTilt,
-                                                   Surface(SurfNum).Azimuth,
-                                                   Roughness,
-                                                   SurfWindDir);
-                    } else {
-                        Hf = 0.0;
-                    }
+                    Hf = ExteriorWindDrivenHf(SurfNum, algoNum, SurfWindSpeed, SurfWindDir, Roughness);
 
                     if (HMovInsul > 0.0) TSurf = (HMovInsul * TSurf + Hf * TAir) / (HMovInsul + Hf);
                     Hn = CalcASHRAETARPNatural(TSurf, TAir, Surface(SurfNum).CosTilt);
@@ -668,11 +667,9 @@ namespace ConvectionCoefficients {
                     };
                 } else {
                     // NOTE: Movable insulation is not taken into account here
-                    if (Windward(Surface(SurfNum).CosTilt, Surface(SurfNum).Azimuth, SurfWindDir)) {
-                        HExt = CalcMoWITTWindward(TAir - TSurf, SurfWindSpeed);
-                    } else { // leeward
-                        HExt = CalcMoWITTLeeward(TAir - TSurf, SurfWindSpeed);
-                    }
+                    Hn = CalcMoWITTNatural(TAir - TSurf);
+                    Hf = ExteriorWindDrivenHf(SurfNum, algoNum, SurfWindSpeed, SurfWindDir, Roughness);
+                    HExt = std::sqrt(pow_2(Hn) + pow_2(Hf));
                 }
 
             } else if (SELECT_CASE_var1 == DOE2HcOutside) {
@@ -704,11 +701,9 @@ namespace ConvectionCoefficients {
                         return Hn + Hf;
                     };
                 } else {
-                    if (Windward(Surface(SurfNum).CosTilt, Surface(SurfNum).Azimuth, SurfWindDir)) {
-                        Hf = CalcDOE2Windward(TSurf, TAir, Surface(SurfNum).CosTilt, SurfWindSpeed, Roughness);
-                    } else { // leeward
-                        Hf = CalcDOE2Leeward(TSurf, TAir, Surface(SurfNum).CosTilt, SurfWindSpeed, Roughness);
-                    }
+                    // smooth surface forced term from the wind (MoWiTT windward or leeward), corrected for roughness here
+                    Hf = CalcDOE2Forced(
+                        TSurf, TAir, Surface(SurfNum).CosTilt, ExteriorWindDrivenHf(SurfNum, algoNum, SurfWindSpeed, SurfWindDir, Roughness), Roughness);
                     if (HMovInsul > 0.0) {
                         TSurf = (HMovInsul * TSurf + Hf * TAir) / (HMovInsul + Hf);
                     }
@@ -766,6 +761,56 @@ namespace ConvectionCoefficients {
 
     }
 
+    Real64 ExteriorWindDrivenHf(int const SurfNum,          // Surface number
+                                int const AlgoNum,          // Exterior convection algorithm (TARP family, DOE-2 or MoWiTT)
+                                Real64 const SurfWindSpeed, // Local wind speed at height of the heat transfer surface (m/s)
+                                Real64 const SurfWindDir,   // Local wind direction (degrees)
+                                int const Roughness         // Roughness index (1-6), see DataHeatBalance parameters
+    )
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Return the wind driven part of the exterior convection coefficient for the TARP family (Sparrow Hf),
+        // DOE-2 (smooth surface MoWiTT Hf) and MoWiTT (MoWiTT Hf) algorithms.
+
+        // METHODOLOGY EMPLOYED:
+        // The term depends only on geometry, roughness and local wind, which are fixed over the outside surface heat
+        // balance iterations of a time step. It is evaluated once and reused until the wind, roughness or algorithm changes.
+
+        if (!allocated(ExtHfWindTerm)) ExtHfWindTerm.allocate(TotSurfaces);
+        auto &term(ExtHfWindTerm(SurfNum));
+        if (term.AlgoNum == AlgoNum && term.Roughness == Roughness && term.WindSpeed == SurfWindSpeed && term.WindDir == SurfWindDir) return term.Hf;
+
+        int const BaseSurf = Surface(SurfNum).BaseSurf;
+        bool const IsWindward = Windward(Surface(SurfNum).CosTilt, Surface(SurfNum).Azimuth, SurfWindDir);
+        Real64 Hf;
+        if (AlgoNum == DOE2HcOutside || AlgoNum == MoWiTTHcOutside) {
+            Hf = IsWindward ? CalcMoWITTForcedWindward(SurfWindSpeed) : CalcMoWITTForcedLeeward(SurfWindSpeed);
+        } else if (Surface(BaseSurf).GrossArea != 0.0 && Surface(BaseSurf).Height != 0.0) {
+            Real64 const rCalcPerimeter = 2.0 * (Surface(BaseSurf).GrossArea / Surface(BaseSurf).Height + Surface(BaseSurf).Height);
+            if (IsWindward) {
+                Hf = CalcSparrowWindward(Roughness, rCalcPerimeter, Surface(BaseSurf).GrossArea, SurfWindSpeed);
+            } else {
+                Hf = CalcSparrowLeeward(Roughness, rCalcPerimeter, Surface(BaseSurf).GrossArea, SurfWindSpeed);
+            }
+        } else {
+            Hf = 0.0;
+        }
+
+        term.AlgoNum = AlgoNum;
+        term.Roughness = Roughness;
+        term.WindSpeed = SurfWindSpeed;
+        term.WindDir = SurfWindDir;
+        term.Hf = Hf;
+        return Hf;
+    }
+
     Real64 CalcHfExteriorSparrow(Real64 const SurfWindSpeed, // Local wind speed at height of the heat transfer surface (m/s)
                                  Real64 const GrossArea,     // Gross surface area {m2}
                                  Real64 const Perimeter,     // Surface perimeter length {m}
@@ -5627,7 +5672,10 @@ namespace ConvectionCoefficients {
         } // zone loop
     }
 
-    void ManageInsideAdaptiveConvectionAlgo(int const SurfNum) // surface number for which coefficients are being calculated
+    void ManageInsideAdaptiveConvectionAlgo(int const SurfNum,                      // surface number for which coefficients are being calculated
+                                            Optional_int_const ZoneFlowRegime,      // zone flow regime, if already determined
+                                            Optional_int_const ZoneForcedFlowRegime // forced regime behind a mixed zone flow regime
+    )
     {
 
         // SUBROUTINE INFORMATION:
@@ -5666,11 +5714,15 @@ namespace ConvectionCoefficients {
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
         // this next call sets up the flow regime and assigns a classification to surface
-        //  TODO: candidate for rework to do zone level calcs once rather than for each surface
-        DynamicIntConvSurfaceClassification(SurfNum);
+        //  the zone level flow regime is evaluated once per zone by InitInteriorConvectionCoeffs and passed in
+        int const PrevClassification = Surface(SurfNum).IntConvClassification;
+        DynamicIntConvSurfaceClassification(SurfNum, ZoneFlowRegime, ZoneForcedFlowRegime);
 
         // simple worker routine takes surface classification and fills in model to use (IntConvHcModelEq) for that surface
-        MapIntConvClassificationToHcModels(SurfNum);
+        //  the mapping only depends on the classification, so it is redone only when that changes
+        if (Surface(SurfNum).IntConvClassification != PrevClassification || Surface(SurfNum).IntConvHcModelEq == 0) {
+            MapIntConvClassificationToHcModels(SurfNum);
+        }
 
         EvaluateIntHcModels(SurfNum, Surface(SurfNum).IntConvHcModelEq, HConvIn(SurfNum));
         // if ( std::isnan( HConvIn( SurfNum ) ) ) { // Use IEEE_IS_NAN when GFortran supports it
@@ -5717,9 +5769,13 @@ namespace ConvectionCoefficients {
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
+        int const PrevClassification = Surface(SurfNum).OutConvClassification;
         DynamicExtConvSurfaceClassification(SurfNum);
 
-        MapExtConvClassificationToHcModels(SurfNum);
+        // the mapping only depends on the classification, so it is redone only when that changes
+        if (Surface(SurfNum).OutConvClassification != PrevClassification || Surface(SurfNum).OutConvHfModelEq == 0) {
+            MapExtConvClassificationToHcModels(SurfNum);
+        }
 
         EvaluateExtHcModels(SurfNum, Surface(SurfNum).OutConvHnModelEq, Surface(SurfNum).OutConvHfModelEq, Hc);
     }
@@ -6617,23 +6673,25 @@ namespace ConvectionCoefficients {
         }
     }
 
-    void DynamicIntConvSurfaceClassification(int const SurfNum) // surface number
+    void DynamicIntConvZoneFlowRegime(int const ZoneNum,    // zone number
+                                      int &FlowRegime,      // returned: zone flow regime (InConvFlowRegime_*)
+                                      int &ForcedFlowRegime // returned: forced regime of the dominant equipment, before mixing checks
+    )
     {
 
         // SUBROUTINE INFORMATION:
         //       AUTHOR        Brent Griffith
         //       DATE WRITTEN   Aug 2010
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, split out of DynamicIntConvSurfaceClassification
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
-        // collects dynamic updates needed for adaptive convectin algorithm
+        // Decide the zone flow regime used by the adaptive convection algorithm
 
         // METHODOLOGY EMPLOYED:
-        // Decide flow regime to set IntConvClassification
-        //  done by zone using the following rules
-
-        // Using zone flow regime, and surface's characteristics assign IntConvHcModelEq
+        // The regime depends only on zone level state (equipment operation, supply flow, surface temperature spread),
+        // so it is the same for every surface in the zone and callers classifying all of a zone's surfaces can
+        // evaluate it once and pass it to DynamicIntConvSurfaceClassification.
 
         // REFERENCES:
         // na
@@ -6661,7 +6719,6 @@ namespace ConvectionCoefficients {
         // na
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        static int ZoneNum(0);
         static int PriorityEquipOn(0);
         static Array1D_int HeatingPriorityStack({0, 10}, 0);
         static Array1D_int CoolingPriorityStack({0, 10}, 0);
@@ -6680,10 +6737,9 @@ namespace ConvectionCoefficients {
         static Real64 Ri(0.0);         // Richardson Number, Gr/Re**2 for determining mixed regime
         static Real64 AirDensity(0.0); // temporary zone air density
         static Real64 DeltaTemp(0.0);  // temporary temperature difference (Tsurf - Tair)
-        int SurfLoop;                  // local for separate looping across surfaces in the zone that has SurfNum
+        int SurfLoop;                  // local for separate looping across surfaces in the zone
 
         EquipOnCount = 0;
-        ZoneNum = Surface(SurfNum).Zone;
         ZoneNode = Zone(ZoneNum).SystemZoneNodeNumber;
         FlowRegimeStack = 0;
 
@@ -6863,6 +6919,8 @@ namespace ConvectionCoefficients {
             FinalFlowRegime = InConvFlowRegime_A3;
         }
 
+        ForcedFlowRegime = FinalFlowRegime;
+
         // now if flow regimes C or D, then check for Mixed regime or very low flow rates
         if ((FinalFlowRegime == InConvFlowRegime_C) || (FinalFlowRegime == InConvFlowRegime_D)) {
 
@@ -6894,6 +6952,51 @@ namespace ConvectionCoefficients {
             }
         }
 
+        FlowRegime = FinalFlowRegime;
+    }
+
+    void DynamicIntConvSurfaceClassification(int const SurfNum,                      // surface number
+                                             Optional_int_const ZoneFlowRegime,      // zone flow regime, if already determined
+                                             Optional_int_const ZoneForcedFlowRegime // forced regime behind a mixed zone flow regime
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR        Brent Griffith
+        //       DATE WRITTEN   Aug 2010
+        //       MODIFIED       October 2026, zone flow regime moved to DynamicIntConvZoneFlowRegime
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // collects dynamic updates needed for adaptive convectin algorithm
+
+        // METHODOLOGY EMPLOYED:
+        // Decide flow regime to set IntConvClassification
+        //  done by zone in DynamicIntConvZoneFlowRegime unless the caller supplies it
+
+        // Using zone flow regime, and surface's characteristics assign IntConvHcModelEq
+
+        // REFERENCES:
+        // na
+
+        // Using/Aliasing
+        using DataHeatBalFanSys::MAT;
+        using DataHeatBalSurface::TH;
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+        int ZoneNum;          // zone containing the surface
+        int FinalFlowRegime;  // zone flow regime
+        int ForcedFlowRegime; // forced regime of the dominant equipment, distinguishes mixed flow cases
+        Real64 DeltaTemp;     // temporary temperature difference (Tsurf - Tair)
+
+        ZoneNum = Surface(SurfNum).Zone;
+        if (present(ZoneFlowRegime)) {
+            FinalFlowRegime = ZoneFlowRegime;
+            ForcedFlowRegime = ZoneForcedFlowRegime;
+        } else {
+            DynamicIntConvZoneFlowRegime(ZoneNum, FinalFlowRegime, ForcedFlowRegime);
+        }
+
         // now finish out specific model eq for this surface
         // Surface(SurfNum)%IntConvClassification = 0 !init/check
         {
@@ -7305,7 +7408,7 @@ namespace ConvectionCoefficients {
 
                     // mixed regime, but need to know what regime it was before it was mixed
                     {
-                        auto const SELECT_CASE_var1(FlowRegimeStack(PriorityEquipOn));
+                        auto const SELECT_CASE_var1(ForcedFlowRegime);
 
                         if (SELECT_CASE_var1 == InConvFlowRegime_C) {
                             // assume forced flow is down along wall (ceiling diffuser)
@@ -432,15 +432,33 @@ namespace ConvectionCoefficients {
         }
     };
 
+    struct ExtHfWindTermStruct
+    {
+        // Members
+        int AlgoNum;      // Exterior convection algorithm the term was evaluated for (0 = not yet evaluated)
+        int Roughness;    // Roughness index the term was evaluated for
+        Real64 WindSpeed; // Local wind speed the term was evaluated for (m/s)
+        Real64 WindDir;   // Local wind direction the term was evaluated for (deg)
+        Real64 Hf;        // Wind driven (forced) part of the exterior convection coefficient (W/m2-K)
+
+        // Default Constructor
+        ExtHfWindTermStruct() : AlgoNum(0), Roughness(0), WindSpeed(0.0), WindDir(0.0), Hf(0.0)
+        {
+        }
+    };
+
     // Object Data
     extern InsideFaceAdaptiveConvAlgoStruct InsideFaceAdaptiveConvectionAlgo; // stores rules for Hc model equations
     extern OutsideFaceAdpativeConvAlgoStruct OutsideFaceAdaptiveConvectionAlgo;
     extern Array1D<HcInsideFaceUserCurveStruct> HcInsideUserCurve;
     extern Array1D<HcOutsideFaceUserCurveStruct> HcOutsideUserCurve;
     extern RoofGeoCharactisticsStruct RoofGeo;
+    extern Array1D<ExtHfWindTermStruct> ExtHfWindTerm; // Last wind driven exterior Hc term, by surface
 
     // Functions
 
+    void clear_state();
+
     void InitInteriorConvectionCoeffs(Array1S<Real64> const SurfaceTemperatures, // Temperature of surfaces for evaluation of HcIn
                                       Optional_int_const ZoneToResimulate = _    // if passed in, then only calculate surfaces that have this zone
     );
@@ -456,6 +474,13 @@ namespace ConvectionCoefficients {
                                      Real64 &HAir            // Radiation to Air Component
     );
 
+    Real64 ExteriorWindDrivenHf(int const SurfNum,          // Surface number
+                                int const AlgoNum,          // Exterior convection algorithm (TARP family, DOE-2 or MoWiTT)
+                                Real64 const SurfWindSpeed, // Local wind speed at height of the heat transfer surface (m/s)
+                                Real64 const SurfWindDir,   // Local wind direction (degrees)
+                                int const Roughness         // Roughness index (1-6), see DataHeatBalance parameters
+    );
+
     Real64 CalcHfExteriorSparrow(Real64 const SurfWindSpeed, // Local wind speed at height of the heat transfer surface (m/s)
                                  Real64 const GrossArea,     // Gross surface area {m2}
                                  Real64 const Perimeter,     // Surface perimeter length {m}
@@ -557,7 +582,10 @@ namespace ConvectionCoefficients {
 
     void SetupAdaptiveConvectionRadiantSurfaceData();
 
-    void ManageInsideAdaptiveConvectionAlgo(int const SurfNum); // surface number for which coefficients are being calculated
+    void ManageInsideAdaptiveConvectionAlgo(int const SurfNum,                          // surface number for which coefficients are being calculated
+                                            Optional_int_const ZoneFlowRegime = _,      // zone flow regime, if already determined
+                                            Optional_int_const ZoneForcedFlowRegime = _ // forced regime behind a mixed zone flow regime
+    );
 
     void ManageOutsideAdaptiveConvectionAlgo(int const SurfNum, // surface number for which coefficients are being calculated
                                              Real64 &Hc         // result for Hc Outside face, becomes HExt.
@@ -574,7 +602,15 @@ namespace ConvectionCoefficients {
 
     void MapExtConvClassificationToHcModels(int const SurfNum); // surface number
 
-    void DynamicIntConvSurfaceClassification(int const SurfNum); // surface number
+    void DynamicIntConvZoneFlowRegime(int const ZoneNum,    // zone number
+                                      int &FlowRegime,      // returned: zone flow regime (InConvFlowRegime_*)
+                                      int &ForcedFlowRegime // returned: forced regime of the dominant equipment, before mixing checks
+    );
+
+    void DynamicIntConvSurfaceClassification(int const SurfNum,                          // surface number
+                                             Optional_int_const ZoneFlowRegime = _,      // zone flow regime, if already determined
+                                             Optional_int_const ZoneForcedFlowRegime = _ // forced regime behind a mixed zone flow regime
+    );
 
     void MapIntConvClassificationToHcModels(int const SurfNum); // surface pointer index
 
@@ -310,8 +310,12 @@ namespace CurveManager {
             ShowFatalError("CurveValue: Invalid curve passed.");
         }
 
-        {
-            auto const SELECT_CASE_var(PerfCurve(CurveIndex).InterpolationType);
+        auto const &Curve(PerfCurve(CurveIndex));
+        if (Curve.Evaluator != nullptr && (Curve.NumDims == 1 || present(Var2))) {
+            // polynomial curves resolved at input skip the interpolation and curve type dispatch
+            CurveValue = Curve.Evaluator(Curve, Var1, present(Var2) ? Real64(Var2) : 0.0);
+        } else {
+            auto const SELECT_CASE_var(Curve.InterpolationType);
             if (SELECT_CASE_var == EvaluateCurveToLimits) {
                 CurveValue = PerformanceCurveObject(CurveIndex, Var1, Var2, Var3);
             } else if (SELECT_CASE_var == LinearInterpolationOfTable) {
@@ -336,6 +340,140 @@ namespace CurveManager {
         return CurveValue;
     }
 
+    void CurveValues(Array1D_int const &CurveIndexes, // indexes of curves sharing the same independent variables
+                     Array1D<Real64> &Values,         // curve results, in the order of CurveIndexes
+                     Real64 const Var1,               // 1st independent variable
+                     Optional<Real64 const> Var2      // 2nd independent variable
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Evaluates several curves that share the same independent variables, such as the capacity and EIR
+        // as a function of temperature curves of a DX coil, in one call.
+
+        // METHODOLOGY EMPLOYED:
+        // Each curve is evaluated through CurveValue so limits, EMS overrides and report variables are unchanged.
+
+        int const NumCurvesToEvaluate(isize(CurveIndexes));
+        if (size(Values) < static_cast<std::size_t>(NumCurvesToEvaluate)) Values.allocate(NumCurvesToEvaluate);
+
+        for (int Loop = 1; Loop <= NumCurvesToEvaluate; ++Loop) {
+            Values(Loop) = CurveValue(CurveIndexes(Loop), Var1, Var2);
+        }
+    }
+
+    // Evaluators for the polynomial curve types, resolved once per curve by SetCurveEvaluator.
+    // The expressions and limits are the same as in PerformanceCurveObject.
+
+    static Real64 LimitCurveOutput(PerfomanceCurveData const &Curve, Real64 CurveValue)
+    {
+        if (Curve.CurveMinPresent) CurveValue = max(CurveValue, Curve.CurveMin);
+        if (Curve.CurveMaxPresent) CurveValue = min(CurveValue, Curve.CurveMax);
+        return CurveValue;
+    }
+
+    static Real64 EvaluateLinearCurve(PerfomanceCurveData const &Curve, Real64 const Var1, Real64 const EP_UNUSED(Var2))
+    {
+        Real64 const V1(max(min(Var1, Curve.Var1Max), Curve.Var1Min));
+        return LimitCurveOutput(Curve, Curve.Coeff1 + V1 * Curve.Coeff2);
+    }
+
+    static Real64 EvaluateQuadraticCurve(PerfomanceCurveData const &Curve, Real64 const Var1, Real64 const EP_UNUSED(Var2))
+    {
+        Real64 const V1(max(min(Var1, Curve.Var1Max), Curve.Var1Min));
+        return LimitCurveOutput(Curve, Curve.Coeff1 + V1 * (Curve.Coeff2 + V1 * Curve.Coeff3));
+    }
+
+    static Real64 EvaluateCubicCurve(PerfomanceCurveData const &Curve, Real64 const Var1, Real64 const EP_UNUSED(Var2))
+    {
+        Real64 const V1(max(min(Var1, Curve.Var1Max), Curve.Var1Min));
+        return LimitCurveOutput(Curve, Curve.Coeff1 + V1 * (Curve.Coeff2 + V1 * (Curve.Coeff3 + V1 * Curve.Coeff4)));
+    }
+
+    static Real64 EvaluateQuarticCurve(PerfomanceCurveData const &Curve, Real64 const Var1, Real64 const EP_UNUSED(Var2))
+    {
+        Real64 const V1(max(min(Var1, Curve.Var1Max), Curve.Var1Min));
+        return LimitCurveOutput(Curve, Curve.Coeff1 + V1 * (Curve.Coeff2 + V1 * (Curve.Coeff3 + V1 * (Curve.Coeff4 + V1 * Curve.Coeff5))));
+    }
+
+    static Real64 EvaluateBiQuadraticCurve(PerfomanceCurveData const &Curve, Real64 const Var1, Real64 const Var2)
+    {
+        Real64 const V1(max(min(Var1, Curve.Var1Max), Curve.Var1Min));
+        Real64 const V2(max(min(Var2, Curve.Var2Max), Curve.Var2Min));
+        return LimitCurveOutput(
+            Curve, Curve.Coeff1 + V1 * (Curve.Coeff2 + V1 * Curve.Coeff3) + V2 * (Curve.Coeff4 + V2 * Curve.Coeff5) + V1 * V2 * Curve.Coeff6);
+    }
+
+    static Real64 EvaluateQuadraticLinearCurve(PerfomanceCurveData const &Curve, Real64 const Var1, Real64 const Var2)
+    {
+        Real64 const V1(max(min(Var1, Curve.Var1Max), Curve.Var1Min));
+        Real64 const V2(max(min(Var2, Curve.Var2Max), Curve.Var2Min));
+        Real64 const CurveValue((Curve.Coeff1 + V1 * (Curve.Coeff2 + V1 * Curve.Coeff3)) +
+                                (Curve.Coeff4 + V1 * (Curve.Coeff5 + V1 * Curve.Coeff6)) * V2);
+        return LimitCurveOutput(Curve, CurveValue);
+    }
+
+    static Real64 EvaluateCubicLinearCurve(PerfomanceCurveData const &Curve, Real64 const Var1, Real64 const Var2)
+    {
+        Real64 const V1(max(min(Var1, Curve.Var1Max), Curve.Var1Min));
+        Real64 const V2(max(min(Var2, Curve.Var2Max), Curve.Var2Min));
+        Real64 const CurveValue((Curve.Coeff1 + V1 * (Curve.Coeff2 + V1 * (Curve.Coeff3 + V1 * Curve.Coeff4))) +
+                                (Curve.Coeff5 + V1 * Curve.Coeff6) * V2);
+        return LimitCurveOutput(Curve, CurveValue);
+    }
+
+    static Real64 EvaluateBiCubicCurve(PerfomanceCurveData const &Curve, Real64 const Var1, Real64 const Var2)
+    {
+        Real64 const V1(max(min(Var1, Curve.Var1Max), Curve.Var1Min));
+        Real64 const V2(max(min(Var2, Curve.Var2Max), Curve.Var2Min));
+        return LimitCurveOutput(Curve,
+                                Curve.Coeff1 + V1 * Curve.Coeff2 + V1 * V1 * Curve.Coeff3 + V2 * Curve.Coeff4 + V2 * V2 * Curve.Coeff5 +
+                                    V1 * V2 * Curve.Coeff6 + V1 * V1 * V1 * Curve.Coeff7 + V2 * V2 * V2 * Curve.Coeff8 + V1 * V1 * V2 * Curve.Coeff9 +
+                                    V1 * V2 * V2 * Curve.Coeff10);
+    }
+
+    void SetCurveEvaluator(PerfomanceCurveData &Curve)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Resolves the evaluator CurveValue uses for a curve, so the polynomial curves that most equipment models
+        // call every iteration bypass the interpolation type and curve type switches.
+
+        // METHODOLOGY EMPLOYED:
+        // Only curves evaluated to limits get an evaluator; tables and the other curve types keep the general path.
+
+        Curve.Evaluator = nullptr;
+        if (Curve.InterpolationType != EvaluateCurveToLimits) return;
+
+        if (Curve.CurveType == Linear) {
+            Curve.Evaluator = EvaluateLinearCurve;
+        } else if (Curve.CurveType == Quadratic) {
+            Curve.Evaluator = EvaluateQuadraticCurve;
+        } else if (Curve.CurveType == Cubic) {
+            Curve.Evaluator = EvaluateCubicCurve;
+        } else if (Curve.CurveType == Quartic) {
+            Curve.Evaluator = EvaluateQuarticCurve;
+        } else if (Curve.CurveType == BiQuadratic) {
+            Curve.Evaluator = EvaluateBiQuadraticCurve;
+        } else if (Curve.CurveType == QuadraticLinear) {
+            Curve.Evaluator = EvaluateQuadraticLinearCurve;
+        } else if (Curve.CurveType == CubicLinear) {
+            Curve.Evaluator = EvaluateCubicLinearCurve;
+        } else if (Curve.CurveType == BiCubic) {
+            Curve.Evaluator = EvaluateBiCubicCurve;
+        }
+    }
+
     void GetCurveInput()
     {
         // wrapper for GetInput to allow unit testing when fatal inputs are detected - follow pattern from GetSetPointManagerInputs()
@@ -3094,6 +3232,14 @@ namespace CurveManager {
                 }
             }
         }
+
+        // resolve the curve type dispatch once, now that regression fits have set the final curve types
+        for (CurveIndex = 1; CurveIndex <= NumCurves; ++CurveIndex) {
+            SetCurveEvaluator(PerfCurve(CurveIndex));
+            if (PerfCurve(CurveIndex).InterpolationType == LagrangeInterpolationLinearExtrapolation && PerfCurve(CurveIndex).TableIndex > 0) {
+                SetupTableLookupGrid(PerfCurve(CurveIndex).NumDims, TableLookup(PerfCurve(CurveIndex).TableIndex));
+            }
+        }
     }
 
     void InitCurveReporting()
@@ -4723,6 +4869,197 @@ namespace CurveManager {
         return TableValue;
     }
 
+    void SetupTableLookupGrid(int const NumDims,    // number of independent variables of the table
+                              TableLookupData &Table // table to set up the grid for
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Builds the regular grid TableLookupObject uses for Lagrange interpolation of multi-variable lookup tables.
+
+        // METHODOLOGY EMPLOYED:
+        // The table output values are copied into one array with the 1st independent variable varying fastest, and the
+        // interpolation window and scratch storage for each direction are sized once. The grid is left unused (NumDims = 0)
+        // if the table data are not consistent with a regular grid, in which case the slice by slice interpolation is kept.
+
+        auto &Grid(Table.Grid);
+        Grid = TableGridData();
+        if (NumDims < 1 || NumDims > 6 || Table.InterpolationOrder < 1) return;
+
+        Array1D<Real64> const *const TableAxis[] = {&Table.X1Var, &Table.X2Var, &Table.X3Var, &Table.X4Var, &Table.X5Var, &Table.X6Var};
+        int const TableSize[] = {Table.NumX1Vars, Table.NumX2Vars, Table.NumX3Vars, Table.NumX4Vars, Table.NumX5Vars, Table.NumX6Vars};
+        int const DataSize[] = {Table.TableLookupZData.isize6(),
+                                Table.TableLookupZData.isize5(),
+                                Table.TableLookupZData.isize4(),
+                                Table.TableLookupZData.isize3(),
+                                Table.TableLookupZData.isize2(),
+                                Table.TableLookupZData.isize1()};
+
+        int Size[] = {1, 1, 1, 1, 1, 1};
+        int NumWindowPoints(1);
+        for (int Dim = 0; Dim < NumDims; ++Dim) {
+            Size[Dim] = TableSize[Dim];
+            if (Size[Dim] < 1 || Size[Dim] > isize(*TableAxis[Dim]) || Size[Dim] > DataSize[Dim]) return;
+            for (int Point = 2; Point <= Size[Dim]; ++Point) {
+                if ((*TableAxis[Dim])(Point) < (*TableAxis[Dim])(Point - 1)) return;
+            }
+            NumWindowPoints *= min(Table.InterpolationOrder, Size[Dim]);
+        }
+
+        Grid.NumDims = NumDims;
+        Grid.InterpolationOrder = Table.InterpolationOrder;
+        Grid.Axis.resize(NumDims);
+        Grid.Stride.resize(NumDims);
+        Grid.LastCell.assign(NumDims, 1);
+        Grid.WindowStart.resize(NumDims);
+        Grid.WindowSize.resize(NumDims);
+        Grid.Weight.resize(NumDims);
+        int Stride(1);
+        for (int Dim = 0; Dim < NumDims; ++Dim) {
+            Grid.Axis[Dim].assign(TableAxis[Dim]->begin(), TableAxis[Dim]->begin() + Size[Dim]);
+            Grid.Stride[Dim] = Stride;
+            Stride *= Size[Dim];
+            Grid.Weight[Dim].resize(min(Table.InterpolationOrder, Size[Dim]));
+        }
+        Grid.Work.resize(NumWindowPoints);
+
+        Grid.Values.reserve(Stride);
+        for (int I6 = 1; I6 <= Size[5]; ++I6) {
+            for (int I5 = 1; I5 <= Size[4]; ++I5) {
+                for (int I4 = 1; I4 <= Size[3]; ++I4) {
+                    for (int I3 = 1; I3 <= Size[2]; ++I3) {
+                        for (int I2 = 1; I2 <= Size[1]; ++I2) {
+                            for (int I1 = 1; I1 <= Size[0]; ++I1) {
+                                Grid.Values.push_back(Table.TableLookupZData(I6, I5, I4, I3, I2, I1));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    Real64 TableGridValue(TableGridData &Grid, // grid of the table
+                          Real64 const V1,     // 1st independent variable after limits imposed
+                          Real64 const V2,     // 2nd independent variable after limits imposed
+                          Real64 const V3,     // 3rd independent variable after limits imposed
+                          Real64 const V4,     // 4th independent variable after limits imposed
+                          Real64 const V5,     // 5th independent variable after limits imposed
+                          Real64 const V6      // 6th independent variable after limits imposed
+    )
+    {
+
+        // FUNCTION INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns the Lagrange interpolation of a table set up by SetupTableLookupGrid.
+
+        // METHODOLOGY EMPLOYED:
+        // Each direction selects the same interpolation window as DLAG (InterpolationOrder points around the lookup point,
+        // two points when extrapolating and one point on an exact match), starting from the cell found by the previous lookup.
+        // Only the values inside the windows are gathered, and they are reduced one direction at a time in the same order
+        // and with the same Lagrange weights as the slice by slice interpolation, so the result is unchanged while the work
+        // no longer grows with the size of the table.
+
+        Real64 const Variables[] = {V1, V2, V3, V4, V5, V6};
+        int const NumDims(Grid.NumDims);
+
+        int Offset(0);
+        for (int Dim = 0; Dim < NumDims; ++Dim) {
+            auto const &Axis(Grid.Axis[Dim]);
+            int const NumPoints(Axis.size());
+            Real64 const X(Variables[Dim]);
+
+            // first axis point not below X (1-based, NumPoints + 1 above the table), checking the previous cell first
+            int Cell(Grid.LastCell[Dim]);
+            if (!((Cell > NumPoints || X - Axis[Cell - 1] <= 0.0) && (Cell == 1 || X - Axis[Cell - 2] > 0.0))) {
+                Cell = 1;
+                while (Cell <= NumPoints && X - Axis[Cell - 1] > 0.0) {
+                    ++Cell;
+                }
+                Grid.LastCell[Dim] = Cell;
+            }
+
+            int NumInterpPoints(min(Grid.InterpolationOrder, NumPoints));
+            int StartPoint;
+            int EndPoint;
+            if (Cell <= NumPoints && X - Axis[Cell - 1] == 0.0) { // exact match, do not interpolate in this direction
+                StartPoint = Cell;
+                EndPoint = Cell;
+            } else if (Cell > NumPoints) { // extrapolating at the upper bound
+                if (NumInterpPoints > 2) NumInterpPoints = 2;
+                StartPoint = NumPoints - NumInterpPoints + 1;
+                EndPoint = NumPoints;
+            } else {
+                if (Cell == 1 && NumInterpPoints > 2) NumInterpPoints = 2; // extrapolating at the lower bound
+                StartPoint = Cell - ((NumInterpPoints + 1) / 2);
+                if (StartPoint <= 0) StartPoint = 1;
+                EndPoint = StartPoint + NumInterpPoints - 1;
+                if (EndPoint > NumPoints) {
+                    StartPoint = NumPoints - NumInterpPoints + 1;
+                    EndPoint = NumPoints;
+                }
+            }
+
+            auto &Weight(Grid.Weight[Dim]);
+            for (int J = StartPoint; J <= EndPoint; ++J) {
+                Real64 Lagrange(1.0);
+                Real64 const Ordinate_J(Axis[J - 1]);
+                for (int K = StartPoint; K <= EndPoint; ++K) {
+                    if (K != J) {
+                        Lagrange *= ((X - Axis[K - 1]) / (Ordinate_J - Axis[K - 1]));
+                    }
+                }
+                Weight[J - StartPoint] = Lagrange;
+            }
+            Grid.WindowStart[Dim] = StartPoint;
+            Grid.WindowSize[Dim] = EndPoint - StartPoint + 1;
+            Offset += (StartPoint - 1) * Grid.Stride[Dim];
+        }
+
+        // gather the window values with the 1st direction varying fastest
+        int NumWindowPoints(1);
+        for (int Dim = 0; Dim < NumDims; ++Dim) {
+            NumWindowPoints *= Grid.WindowSize[Dim];
+        }
+        int Point[6] = {0, 0, 0, 0, 0, 0};
+        for (int Loop = 0; Loop < NumWindowPoints; ++Loop) {
+            int Index(Offset);
+            for (int Dim = 0; Dim < NumDims; ++Dim) {
+                Index += Point[Dim] * Grid.Stride[Dim];
+            }
+            Grid.Work[Loop] = Grid.Values[Index];
+            for (int Dim = 0; Dim < NumDims; ++Dim) {
+                if (++Point[Dim] < Grid.WindowSize[Dim]) break;
+                Point[Dim] = 0;
+            }
+        }
+
+        // reduce one direction at a time, in place
+        for (int Dim = 0; Dim < NumDims; ++Dim) {
+            int const NumInterpPoints(Grid.WindowSize[Dim]);
+            auto const &Weight(Grid.Weight[Dim]);
+            NumWindowPoints /= NumInterpPoints;
+            for (int Loop = 0; Loop < NumWindowPoints; ++Loop) {
+                Real64 Value(0.0);
+                for (int J = 0; J < NumInterpPoints; ++J) {
+                    Value += Weight[J] * Grid.Work[Loop * NumInterpPoints + J];
+                }
+                Grid.Work[Loop] = Value;
+            }
+        }
+
+        return Grid.Work[0];
+    }
+
     Real64 TableLookupObject(int const CurveIndex,        // index of curve in curve array
                              Real64 const Var1,           // 1st independent variable
                              Optional<Real64 const> Var2, // 2nd independent variable
@@ -4927,7 +5264,9 @@ namespace CurveManager {
             V6 = 0.0;
         }
 
-        {
+        if (TableLookup(TableIndex).Grid.NumDims == PerfCurve(CurveIndex).NumDims) {
+            TableValue = TableGridValue(TableLookup(TableIndex).Grid, V1, V2, V3, V4, V5, V6);
+        } else {
             auto const SELECT_CASE_var(PerfCurve(CurveIndex).NumDims);
             if (SELECT_CASE_var == 1) {
                 NX = TableLookup(TableIndex).NumX1Vars;
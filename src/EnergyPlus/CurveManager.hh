@@ -48,6 +48,9 @@
 #ifndef CurveManager_hh_INCLUDED
 #define CurveManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
 #include <ObjexxFCL/Array1D.hh>
@@ -185,6 +188,11 @@ namespace CurveManager {
         }
     };
 
+    struct PerfomanceCurveData;
+
+    // Evaluator for one curve type, called with the independent variables before limits are imposed
+    typedef Real64 (*CurveEvaluator)(PerfomanceCurveData const &Curve, Real64 const Var1, Real64 const Var2);
+
     struct PerfomanceCurveData
     {
         // Members
@@ -243,6 +251,7 @@ namespace CurveManager {
         bool EMSOverrideOn;                               // if TRUE, then EMS is calling to override curve value
         Real64 EMSOverrideCurveValue;                     // Value of curve result EMS is directing to use
         bool OpticalProperty;                             // if TRUE, this table is used to store optical property
+        CurveEvaluator Evaluator;                         // pre-resolved evaluator for polynomial curves (nullptr if none)
         // report variables
         Real64 CurveOutput; // curve output or result
         Real64 CurveInput1; // curve input #1 (e.g., x or X1 variable)
@@ -261,8 +270,29 @@ namespace CurveManager {
               CurveMax(0.0), CurveMinPresent(false), CurveMaxPresent(false), Var1MinPresent(false), Var1MaxPresent(false), Var2MinPresent(false),
               Var2MaxPresent(false), Var3MinPresent(false), Var3MaxPresent(false), Var4MinPresent(false), Var4MaxPresent(false),
               Var5MinPresent(false), Var5MaxPresent(false), Var6MinPresent(false), Var6MaxPresent(false), EMSOverrideOn(false),
-              EMSOverrideCurveValue(0.0), OpticalProperty(false), CurveOutput(0.0), CurveInput1(0.0), CurveInput2(0.0), CurveInput3(0.0),
-              CurveInput4(0.0), CurveInput5(0.0), CurveInput6(0.0)
+              EMSOverrideCurveValue(0.0), OpticalProperty(false), Evaluator(nullptr), CurveOutput(0.0), CurveInput1(0.0), CurveInput2(0.0),
+              CurveInput3(0.0), CurveInput4(0.0), CurveInput5(0.0), CurveInput6(0.0)
+        {
+        }
+    };
+
+    struct TableGridData
+    {
+        // Members
+        // regular grid view of a multi-variable lookup table, built once at input for the Lagrange interpolation
+        int NumDims;                             // number of independent variables (0 if the grid is not used)
+        int InterpolationOrder;                  // number of points interpolated in each direction (2 = multilinear, 4 = cubic)
+        std::vector<std::vector<Real64>> Axis;   // independent variable values in each direction
+        std::vector<int> Stride;                 // distance between adjacent points of each direction in Values
+        std::vector<Real64> Values;              // table output values with the 1st independent variable varying fastest
+        std::vector<int> LastCell;               // first axis point not below the previous lookup, in each direction
+        std::vector<int> WindowStart;            // first axis point of the interpolation window, in each direction
+        std::vector<int> WindowSize;             // number of axis points in the interpolation window, in each direction
+        std::vector<std::vector<Real64>> Weight; // Lagrange weights of the interpolation window, in each direction
+        std::vector<Real64> Work;                // window values reduced one direction at a time
+
+        // Default Constructor
+        TableGridData() : NumDims(0), InterpolationOrder(2)
         {
         }
     };
@@ -284,6 +314,7 @@ namespace CurveManager {
         int NumX6Vars; // Number of variables for independent variable #6
         Array1D<Real64> X6Var;
         Array6D<Real64> TableLookupZData;
+        TableGridData Grid; // precomputed grid used in place of the slice by slice Lagrange interpolation
 
         // Default Constructor
         TableLookupData()
@@ -317,6 +348,14 @@ namespace CurveManager {
                       Optional<Real64 const> Var6 = _  // 6th independent variable
     );
 
+    void CurveValues(Array1D_int const &CurveIndexes, // indexes of curves sharing the same independent variables
+                     Array1D<Real64> &Values,         // curve results, in the order of CurveIndexes
+                     Real64 const Var1,               // 1st independent variable
+                     Optional<Real64 const> Var2 = _  // 2nd independent variable
+    );
+
+    void SetCurveEvaluator(PerfomanceCurveData &Curve);
+
     void GetCurveInput();
 
     void GetCurveInputData(bool &ErrorsFound);
@@ -356,6 +395,19 @@ namespace CurveManager {
                                   Optional<Real64 const> Var3 = _  // 3rd independent variable
     );
 
+    void SetupTableLookupGrid(int const NumDims,    // number of independent variables of the table
+                              TableLookupData &Table // table to set up the grid for
+    );
+
+    Real64 TableGridValue(TableGridData &Grid, // grid of the table
+                          Real64 const V1,     // 1st independent variable after limits imposed
+                          Real64 const V2,     // 2nd independent variable after limits imposed
+                          Real64 const V3,     // 3rd independent variable after limits imposed
+                          Real64 const V4,     // 4th independent variable after limits imposed
+                          Real64 const V5,     // 5th independent variable after limits imposed
+                          Real64 const V6      // 6th independent variable after limits imposed
+    );
+
     Real64 TableLookupObject(int const CurveIndex,            // index of curve in curve array
                              Real64 const Var1,               // 1st independent variable
                              Optional<Real64 const> Var2 = _, // 2nd independent variable
@@ -8977,7 +8977,46 @@ namespace DXCoils {
             //  InletAirHumRat may be modified in this ADP/BF loop, use temporary varible for calculations
             InletAirHumRatTemp = InletAirHumRat;
             AirMassFlowRatio = AirMassFlow / DXCoil(DXCoilNum).RatedAirMassFlowRate(Mode);
-            while (true) {
+
+            // The full load performance does not depend on the part load ratio, so repeated calls by the
+            // parent's part load solver with the same operating conditions reuse the previous evaluation.
+            // Not used with EMS, which can override curve outputs between calls.
+            auto &FullLoad(DXCoil(DXCoilNum).FullLoadCache);
+            bool const FullLoadCacheAllowed = !DataGlobals::AnyEnergyManagementSystemInModel;
+            bool const FullLoadCacheHit =
+                FullLoadCacheAllowed && FullLoad.Valid && FullLoad.Mode == Mode && FullLoad.RatedTotCap == DXCoil(DXCoilNum).RatedTotCap(Mode) &&
+                FullLoad.RatedAirMassFlowRate == DXCoil(DXCoilNum).RatedAirMassFlowRate(Mode) && FullLoad.RatedCBF == RatedCBF &&
+                FullLoad.AirMassFlow == AirMassFlow && FullLoad.InletAirTemp == InletAirDryBulbTemp && FullLoad.InletAirHumRat == InletAirHumRat &&
+                FullLoad.InletAirEnthalpy == InletAirEnthalpy && FullLoad.OutdoorPressure == OutdoorPressure && FullLoad.CondInletTemp == CondInletTemp;
+            bool FullLoadCurveWarning = false; // true if a capacity curve output was reset during this evaluation
+            Real64 CurveWetBulbC = InletAirWetBulbC; // inlet wet-bulb temperature of the last curve evaluations
+            if (FullLoadCacheHit) {
+                TotCap = FullLoad.TotCap;
+                SHR = FullLoad.SHR;
+                hDelta = FullLoad.hDelta;
+                InletAirWetBulbC = FullLoad.InletAirWetBulbC;
+                Counter = FullLoad.DryCoilIterations;
+                // Repeat the last curve evaluations, which set the curve output variables; their results are already in TotCap and SHR
+                if (DXCoil(DXCoilNum).DXCoilType_Num != CoilDX_HeatPumpWaterHeaterPumped &&
+                    DXCoil(DXCoilNum).DXCoilType_Num != CoilDX_HeatPumpWaterHeaterWrapped) {
+                    if (CurveManager::PerfCurve(DXCoil(DXCoilNum).CCapFTemp(Mode)).NumDims == 2) {
+                        CurveValue(DXCoil(DXCoilNum).CCapFTemp(Mode), FullLoad.CurveWetBulbC, CondInletTemp);
+                    } else {
+                        CurveValue(DXCoil(DXCoilNum).CCapFTemp(Mode), CondInletTemp);
+                    }
+                    CurveValue(DXCoil(DXCoilNum).CCapFFlow(Mode), AirMassFlowRatio);
+                }
+                if (DXCoil(DXCoilNum).UserSHRCurveExists) {
+                    CalcSHRUserDefinedCurves(InletAirDryBulbTemp,
+                                             FullLoad.CurveWetBulbC,
+                                             AirMassFlowRatio,
+                                             DXCoil(DXCoilNum).SHRFTemp(Mode),
+                                             DXCoil(DXCoilNum).SHRFFlow(Mode),
+                                             DXCoil(DXCoilNum).RatedSHR(Mode));
+                }
+            }
+            while (!FullLoadCacheHit) {
+                CurveWetBulbC = InletAirWetBulbC;
                 if (DXCoil(DXCoilNum).DXCoilType_Num == CoilDX_HeatPumpWaterHeaterPumped ||
                     DXCoil(DXCoilNum).DXCoilType_Num == CoilDX_HeatPumpWaterHeaterWrapped) {
                     // Coil:DX:HeatPumpWaterHeater does not have total cooling capacity as a function of temp or flow curve
@@ -9016,6 +9055,7 @@ namespace DXCoils {
                             TotCapTempModFac,
                             TotCapTempModFac);
                         TotCapTempModFac = 0.0;
+                        FullLoadCurveWarning = true;
                     }
 
                     //    Get total capacity modifying factor (function of mass flow) for off-rated conditions
@@ -9039,6 +9079,7 @@ namespace DXCoils {
                             TotCapFlowModFac,
                             TotCapFlowModFac);
                         TotCapFlowModFac = 0.0;
+                        FullLoadCurveWarning = true;
                     }
                 }
                 TotCap = DXCoil(DXCoilNum).RatedTotCap(Mode) * TotCapFlowModFac * TotCapTempModFac;
@@ -9086,6 +9127,27 @@ namespace DXCoils {
                 }
             } // end of DO iteration loop
 
+            // Keep the evaluation unless it issued curve warnings, which must be repeated when the conditions recur
+            if (!FullLoadCacheHit) {
+                FullLoad.Valid = FullLoadCacheAllowed && !FullLoadCurveWarning;
+                FullLoad.Mode = Mode;
+                FullLoad.RatedTotCap = DXCoil(DXCoilNum).RatedTotCap(Mode);
+                FullLoad.RatedAirMassFlowRate = DXCoil(DXCoilNum).RatedAirMassFlowRate(Mode);
+                FullLoad.RatedCBF = RatedCBF;
+                FullLoad.AirMassFlow = AirMassFlow;
+                FullLoad.InletAirTemp = InletAirDryBulbTemp;
+                FullLoad.InletAirHumRat = InletAirHumRat;
+                FullLoad.InletAirEnthalpy = InletAirEnthalpy;
+                FullLoad.OutdoorPressure = OutdoorPressure;
+                FullLoad.CondInletTemp = CondInletTemp;
+                FullLoad.TotCap = TotCap;
+                FullLoad.SHR = SHR;
+                FullLoad.hDelta = hDelta;
+                FullLoad.InletAirWetBulbC = InletAirWetBulbC;
+                FullLoad.CurveWetBulbC = CurveWetBulbC;
+                FullLoad.DryCoilIterations = Counter;
+            }
+
             if (DXCoil(DXCoilNum).PLFFPLR(Mode) > 0) {
                 PLF = CurveValue(DXCoil(DXCoilNum).PLFFPLR(Mode), PartLoadRatio); // Calculate part-load factor
             } else {
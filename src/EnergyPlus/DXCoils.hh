@@ -174,6 +174,36 @@ namespace DXCoils {
 
     // Types
 
+    struct DXCoilFullLoadData // full load cooling performance of a DX coil for one set of operating conditions
+    {
+        // Members
+        bool Valid;                  // true when the members below hold a previous evaluation
+        int Mode;                    // performance mode of the evaluation
+        Real64 RatedTotCap;          // rated total cooling capacity used [W]
+        Real64 RatedAirMassFlowRate; // rated air mass flow rate used [kg/s]
+        Real64 RatedCBF;             // rated coil bypass factor used
+        Real64 AirMassFlow;          // air mass flow rate through the coil when the compressor is on [kg/s]
+        Real64 InletAirTemp;         // inlet air dry-bulb temperature [C]
+        Real64 InletAirHumRat;       // inlet air humidity ratio [kg/kg]
+        Real64 InletAirEnthalpy;     // inlet air enthalpy [J/kg]
+        Real64 OutdoorPressure;      // outdoor barometric pressure at condenser [Pa]
+        Real64 CondInletTemp;        // condenser inlet temperature [C]
+        Real64 TotCap;               // gross total cooling capacity at these conditions [W]
+        Real64 SHR;                  // sensible heat ratio at these conditions
+        Real64 hDelta;               // change in air enthalpy across the coil at full load [J/kg]
+        Real64 InletAirWetBulbC;     // inlet wet-bulb temperature after the dry coil iteration [C]
+        Real64 CurveWetBulbC;        // inlet wet-bulb temperature of the last capacity and SHR curve evaluations [C]
+        int DryCoilIterations;       // number of dry coil iterations needed
+
+        // Default Constructor
+        DXCoilFullLoadData()
+            : Valid(false), Mode(0), RatedTotCap(0.0), RatedAirMassFlowRate(0.0), RatedCBF(0.0), AirMassFlow(0.0), InletAirTemp(0.0),
+              InletAirHumRat(0.0), InletAirEnthalpy(0.0), OutdoorPressure(0.0), CondInletTemp(0.0), TotCap(0.0), SHR(0.0), hDelta(0.0),
+              InletAirWetBulbC(0.0), CurveWetBulbC(0.0), DryCoilIterations(0)
+        {
+        }
+    };
+
     struct DXCoilData
     {
         // Members
@@ -512,6 +542,7 @@ namespace DXCoils {
         bool reportCoilFinalSizes; // one time report of sizes to coil selection report
         Real64 capModFacTotal;     // current coil capacity modification factor
         int AirLoopNum;            // Airloop number
+        DXCoilFullLoadData FullLoadCache; // last full load cooling performance evaluated by CalcDoe2DXCoil
 
         // Default Constructor
         DXCoilData()
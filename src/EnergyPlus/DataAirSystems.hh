@@ -48,6 +48,9 @@
 #ifndef DataAirSystems_hh_INCLUDED
 #define DataAirSystems_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -120,6 +123,7 @@ namespace DataAirSystems {
         int AirSysToPlantPtr;              // =0 No plant loop connection, >0 index to AirSysToPlant array
         Array1D<MeterData> MeteredVar;     // Index of energy output report data
         Array1D<SubcomponentData> SubComp; // Component list
+        std::vector<Real64> SimulatedState; // HVAC step and node state left by the last simulation (AirLoopComponentBypass)
 
         // Default Constructor
         AirLoopCompData()
@@ -433,6 +433,8 @@ namespace DataBSDFWindow {
         int VisBkReflNrows;          // No. rows in matrix
         int VisBkReflNcols;          // No. columns in matrix
         Array2D<Real64> VisBkRefl;   // Back visible reflectance matrix
+        Array1D<Real64> SolFrtTransHemi; // Front directional-hemispherical transmittance, by incident direction
+        Array1D<Real64> SolBkReflHemi;   // Back directional-hemispherical reflectance, by incident direction
         // INTEGER   :: ThermalConstruction  !Pointer to location in Construct array of thermal construction for the state
         // (to be implemented)
         int NumLayers;
@@ -48,6 +48,10 @@
 #ifndef DataErrorTracking_hh_INCLUDED
 #define DataErrorTracking_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <unordered_map>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -135,17 +139,19 @@ namespace DataErrorTracking {
         bool ReportMax;       // Flag to report max value
         bool ReportMin;       // Flag to report min value
         bool ReportSum;       // Flag to report sum value
+        int SearchMatch;      // MessageSearch entry this message counts toward in MatchCounts (0 if none)
 
         // Default Constructor
         RecurringErrorData()
             : Count(0), WarmupCount(0), SizingCount(0), MaxValue(0.0), MinValue(0.0), SumValue(0.0), ReportMax(false), ReportMin(false),
-              ReportSum(false)
+              ReportSum(false), SearchMatch(0)
         {
         }
     };
 
     // Object Data
     extern Array1D<RecurringErrorData> RecurringErrors;
+    extern std::unordered_map<std::string, int> RecurringErrorIndex; // Uppercased stored message -> first RecurringErrors index
 
     // Clears the global data in DataErrorTracking
     // Needed for unit tests, should not normally be called.
@@ -92,6 +92,11 @@ namespace DataGlobals {
     bool isEpJSON(false);
     bool isCBOR(false);
     bool isMsgPack(false);
+    bool isUBJSON(false);
+    std::string outputEpJSONBinaryFormat; // CBOR, MSGPACK or UBJSON copy of the input requested by --convert-binary
+    int CheckpointAtDay(0);               // Day of the weather run period after which the thermal state is written (--checkpoint-at)
+    std::string RestartFromFileName;      // Thermal state file the weather run period starts from (--restart-from)
+    std::string BatchManifestFileName;    // JSON manifest of runs simulated in this process one after another (--batch)
     bool preserveIDFOrder(true);
 
     // MODULE PARAMETER DEFINITIONS:
@@ -275,6 +280,11 @@ namespace DataGlobals {
         isEpJSON = false;
         isCBOR = false;
         isMsgPack = false;
+        isUBJSON = false;
+        outputEpJSONBinaryFormat.clear();
+        CheckpointAtDay = 0;
+        RestartFromFileName.clear();
+        BatchManifestFileName.clear();
         preserveIDFOrder = true;
         BeginDayFlag = false;
         BeginEnvrnFlag = false;
@@ -70,6 +70,11 @@ namespace DataGlobals {
     extern bool isEpJSON;
     extern bool isCBOR;
     extern bool isMsgPack;
+    extern bool isUBJSON;
+    extern std::string outputEpJSONBinaryFormat; // CBOR, MSGPACK or UBJSON copy of the input requested by --convert-binary
+    extern int CheckpointAtDay;                  // Day of the weather run period after which the thermal state is written (--checkpoint-at)
+    extern std::string RestartFromFileName;      // Thermal state file the weather run period starts from (--restart-from)
+    extern std::string BatchManifestFileName;    // JSON manifest of runs simulated in this process one after another (--batch)
     extern bool preserveIDFOrder;
 
     // MODULE PARAMETER DEFINITIONS:
@@ -245,6 +245,14 @@ namespace DataHeatBalSurface {
     Array2D<Real64> TuserHistM; // Master temperature history at the user specified location (SurfNum,Term)
     Array2D<Real64> QsrcHistM;  // Master heat source/sink history for the surface (SurfNum,Term)
 
+    // Per-surface copies of the construction CTF coefficients (SurfNum,Term), so that the terms of one
+    // surface are contiguous in the history sums instead of being fetched through its construction
+    Array1D_int SurfCTFConstr;      // Construction the copied coefficients belong to (0 if not copied yet)
+    Array2D<Real64> SurfCTFCross;   // Cross or Y terms of the CTF equation
+    Array2D<Real64> SurfCTFFlux;    // Flux history terms of the CTF equation (Term 0 unused)
+    Array2D<Real64> SurfCTFInside;  // Inside or Z terms of the CTF equation
+    Array2D<Real64> SurfCTFOutside; // Outside or X terms of the CTF equation
+
     Array2D<Real64> FractDifShortZtoZ; // Fraction of diffuse short radiation in Zone 2 transmitted to Zone 1
     Array1D_bool RecDifShortFromZ;     // True if Zone gets short radiation from another
     bool InterZoneWindow(false);       // True if there is an interzone window
@@ -343,6 +351,11 @@ namespace DataHeatBalSurface {
         QsrcHist.deallocate();
         TsrcHistM.deallocate();
         QsrcHistM.deallocate();
+        SurfCTFConstr.deallocate();
+        SurfCTFCross.deallocate();
+        SurfCTFFlux.deallocate();
+        SurfCTFInside.deallocate();
+        SurfCTFOutside.deallocate();
         FractDifShortZtoZ.deallocate();
         RecDifShortFromZ.deallocate();
         InterZoneWindow = false;
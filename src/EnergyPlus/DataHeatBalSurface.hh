@@ -233,6 +233,14 @@ namespace DataHeatBalSurface {
     extern Array2D<Real64> TuserHistM; // Master temperature history at the user specified location (Term,SurfNum)
     extern Array2D<Real64> QsrcHistM;  // Master heat source/sink history for the surface (Term,SurfNum)
 
+    // Per-surface copies of the construction CTF coefficients (SurfNum,Term), so that the terms of one
+    // surface are contiguous in the history sums instead of being fetched through its construction
+    extern Array1D_int SurfCTFConstr;       // Construction the copied coefficients belong to (0 if not copied yet)
+    extern Array2D<Real64> SurfCTFCross;    // Cross or Y terms of the CTF equation
+    extern Array2D<Real64> SurfCTFFlux;     // Flux history terms of the CTF equation (Term 0 unused)
+    extern Array2D<Real64> SurfCTFInside;   // Inside or Z terms of the CTF equation
+    extern Array2D<Real64> SurfCTFOutside;  // Outside or X terms of the CTF equation
+
     extern Array2D<Real64> FractDifShortZtoZ; // Fraction of diffuse short radiation in Zone 2 transmitted to Zone 1
     extern Array1D_bool RecDifShortFromZ;     // True if Zone gets short radiation from another
     extern bool InterZoneWindow;              // True if there is an interzone window
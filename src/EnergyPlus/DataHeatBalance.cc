@@ -732,12 +732,12 @@ namespace DataHeatBalance {
     Array1D<Real64> ITABSF;                  // FRACTION OF THERMAL FLUX ABSORBED (PER UNIT AREA)
     Array1D<Real64> TMULT;                   // TMULT  - MULTIPLIER TO COMPUTE 'ITABSF'
     Array1D<Real64> QL;                      // TOTAL THERMAL RADIATION ADDED TO ZONE
-    Array2D<Real64> SunlitFracHR;            // Hourly fraction of heat transfer surface that is sunlit
-    Array2D<Real64> CosIncAngHR;             // Hourly cosine of beam radiation incidence angle on surface
-    Array3D<Real64> SunlitFrac;              // TimeStep fraction of heat transfer surface that is sunlit
-    Array3D<Real64> SunlitFracWithoutReveal; // For a window with reveal, the sunlit fraction
+    Array2D<ShadingReal> SunlitFracHR;            // Hourly fraction of heat transfer surface that is sunlit
+    Array2D<ShadingReal> CosIncAngHR;             // Hourly cosine of beam radiation incidence angle on surface
+    Array3D<ShadingReal> SunlitFrac;              // TimeStep fraction of heat transfer surface that is sunlit
+    Array3D<ShadingReal> SunlitFracWithoutReveal; // For a window with reveal, the sunlit fraction
     // without shadowing by the reveal
-    Array3D<Real64> CosIncAng; // TimeStep cosine of beam radiation incidence angle on surface
+    Array3D<ShadingReal> CosIncAng; // TimeStep cosine of beam radiation incidence angle on surface
     Array4D_int BackSurfaces;  // For a given hour and timestep, a list of up to 20 surfaces receiving
     // beam solar radiation from a given exterior window
     Array4D<Real64> OverlapAreas; // For a given hour and timestep, the areas of the exterior window sending
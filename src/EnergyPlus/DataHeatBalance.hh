@@ -48,6 +48,9 @@
 #ifndef DataHeatBalance_hh_INCLUDED
 #define DataHeatBalance_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array2D.hh>
@@ -586,12 +589,17 @@ namespace DataHeatBalance {
     extern Array1D<Real64> ITABSF;                  // FRACTION OF THERMAL FLUX ABSORBED (PER UNIT AREA)
     extern Array1D<Real64> TMULT;                   // TMULT  - MULTIPLIER TO COMPUTE 'ITABSF'
     extern Array1D<Real64> QL;                      // TOTAL THERMAL RADIATION ADDED TO ZONE
-    extern Array2D<Real64> SunlitFracHR;            // Hourly fraction of heat transfer surface that is sunlit
-    extern Array2D<Real64> CosIncAngHR;             // Hourly cosine of beam radiation incidence angle on surface
-    extern Array3D<Real64> SunlitFrac;              // TimeStep fraction of heat transfer surface that is sunlit
-    extern Array3D<Real64> SunlitFracWithoutReveal; // For a window with reveal, the sunlit fraction
+#ifdef EP_COMPACT_SHADING
+    using ShadingReal = float; // storage of the sun position shading arrays, halved by ENABLE_COMPACT_SHADING
+#else
+    using ShadingReal = Real64;
+#endif
+    extern Array2D<ShadingReal> SunlitFracHR;            // Hourly fraction of heat transfer surface that is sunlit
+    extern Array2D<ShadingReal> CosIncAngHR;             // Hourly cosine of beam radiation incidence angle on surface
+    extern Array3D<ShadingReal> SunlitFrac;              // TimeStep fraction of heat transfer surface that is sunlit
+    extern Array3D<ShadingReal> SunlitFracWithoutReveal; // For a window with reveal, the sunlit fraction
     // without shadowing by the reveal
-    extern Array3D<Real64> CosIncAng; // TimeStep cosine of beam radiation incidence angle on surface
+    extern Array3D<ShadingReal> CosIncAng; // TimeStep cosine of beam radiation incidence angle on surface
     extern Array4D_int BackSurfaces;  // For a given hour and timestep, a list of up to 20 surfaces receiving
     // beam solar radiation from a given exterior window
     extern Array4D<Real64> OverlapAreas; // For a given hour and timestep, the areas of the exterior window sending
@@ -965,6 +973,9 @@ namespace DataHeatBalance {
         Array1D<Real64> ReflSolBeamFrontCoef; // Coeffs of incidence-angle polynomial for beam sol front refl,
         // bare glass or shade on
         Array1D<Real64> ReflSolBeamBackCoef; // Like ReflSolBeamFrontCoef, but for back-incident beam solar
+        std::vector<Real64> TransSolBeamTable;         // TransSolBeamCoef polynomial tabulated over cosine of incidence angle
+        std::vector<Real64> ReflSolBeamFrontTable;     // As for TransSolBeamTable but for ReflSolBeamFrontCoef
+        std::vector<std::vector<Real64>> AbsBeamTable; // As for TransSolBeamTable but for AbsBeamCoef, by glass layer
         Array2D<Real64> tBareSolCoef;        // Isolated glass solar transmittance coeffs of inc. angle polynomial
         Array2D<Real64> tBareVisCoef;        // Isolated glass visible transmittance coeffs of inc. angle polynomial
         Array2D<Real64> rfBareSolCoef;       // Isolated glass front solar reflectance coeffs of inc. angle polynomial
@@ -1042,7 +1053,7 @@ namespace DataHeatBalance {
               BlTransDiffVis(MaxSlatAngs, 0.0), ReflectSolDiffBack(0.0), BlReflectSolDiffBack(MaxSlatAngs, 0.0), ReflectSolDiffFront(0.0),
               BlReflectSolDiffFront(MaxSlatAngs, 0.0), ReflectVisDiffBack(0.0), BlReflectVisDiffBack(MaxSlatAngs, 0.0), ReflectVisDiffFront(0.0),
               BlReflectVisDiffFront(MaxSlatAngs, 0.0), TransSolBeamCoef(6, 0.0), TransVisBeamCoef(6, 0.0), ReflSolBeamFrontCoef(6, 0.0),
-              ReflSolBeamBackCoef(6, 0.0), tBareSolCoef(6, 5, 0.0), tBareVisCoef(6, 5, 0.0), rfBareSolCoef(6, 5, 0.0), rfBareVisCoef(6, 5, 0.0),
+              ReflSolBeamBackCoef(6, 0.0), AbsBeamTable(MaxSolidWinLayers), tBareSolCoef(6, 5, 0.0), tBareVisCoef(6, 5, 0.0), rfBareSolCoef(6, 5, 0.0), rfBareVisCoef(6, 5, 0.0),
               rbBareSolCoef(6, 5, 0.0), rbBareVisCoef(6, 5, 0.0), afBareSolCoef(6, 5, 0.0), abBareSolCoef(6, 5, 0.0), tBareSolDiff(5, 0.0),
               tBareVisDiff(5, 0.0), rfBareSolDiff(5, 0.0), rfBareVisDiff(5, 0.0), rbBareSolDiff(5, 0.0), rbBareVisDiff(5, 0.0), afBareSolDiff(5, 0.0),
               abBareSolDiff(5, 0.0), FromWindow5DataFile(false), W5FileMullionWidth(0.0), W5FileMullionOrientation(0), W5FileGlazingSysWidth(0.0),
@@ -1892,13 +1903,23 @@ namespace DataHeatBalance {
         int NumberOfDevices;
         int MaxNumberOfDevices;
         Array1D<GenericComponentZoneIntGainStruct> Device;
+        // Device gain rates summed once per UpdateInternalGainValues (allocated there)
+        Real64 TotConvectGainRate;                   // Convection gain rate of all devices, watts
+        Real64 TotRadiantGainRate;                   // Thermal radiation gain rate of all devices, watts
+        Real64 TotLatentGainRate;                    // Moisture gain rate of all devices, watts
+        Real64 TotCarbonDioxideGainRate;             // Carbon dioxide gain rate of all devices
+        Array1D<Real64> ConvectGainRateByType;       // Convection gain rate by device type (IntGainTypeOf_*), watts
+        Array1D<Real64> RadiantGainRateByType;       // Thermal radiation gain rate by device type (IntGainTypeOf_*), watts
+        Array1D<Real64> LatentGainRateByType;        // Moisture gain rate by device type (IntGainTypeOf_*), watts
+        Array1D<Real64> CarbonDioxideGainRateByType; // Carbon dioxide gain rate by device type (IntGainTypeOf_*)
 
         // Default Constructor
         ZoneSimData()
             : NOFOCC(0.0), QOCTOT(0.0), QOCSEN(0.0), QOCCON(0.0), QOCRAD(0.0), QOCLAT(0.0), QLTTOT(0.0), QLTCON(0.0), QLTRAD(0.0), QLTCRA(0.0),
               QLTSW(0.0), QEECON(0.0), QEERAD(0.0), QEELost(0.0), QEELAT(0.0), QGECON(0.0), QGERAD(0.0), QGELost(0.0), QGELAT(0.0), QOECON(0.0),
               QOERAD(0.0), QOELost(0.0), QOELAT(0.0), QHWCON(0.0), QHWRAD(0.0), QHWLost(0.0), QHWLAT(0.0), QSECON(0.0), QSERAD(0.0), QSELost(0.0),
-              QSELAT(0.0), QBBCON(0.0), QBBRAD(0.0), NumberOfDevices(0), MaxNumberOfDevices(0)
+              QSELAT(0.0), QBBCON(0.0), QBBRAD(0.0), NumberOfDevices(0), MaxNumberOfDevices(0), TotConvectGainRate(0.0), TotRadiantGainRate(0.0),
+              TotLatentGainRate(0.0), TotCarbonDioxideGainRate(0.0)
         {
         }
     };
@@ -120,74 +120,78 @@ namespace DataLoopNode {
     struct NodeData
     {
         // Members
-        int FluidType;               // must be one of the valid parameters
-        int FluidIndex;              // For Fluid Properties
+        // state read and written by every component in each iteration, kept together in the first cache line
         Real64 Temp;                 // {C}
-        Real64 TempMin;              // {C}
-        Real64 TempMax;              // {C}
-        Real64 TempSetPoint;         // {C}
-        Real64 TempLastTimestep;     // [C}   DSU
-        Real64 MassFlowRateRequest;  // {kg/s}  DSU
         Real64 MassFlowRate;         // {kg/s}
-        Real64 MassFlowRateMin;      // {kg/s}
-        Real64 MassFlowRateMax;      // {kg/s}
+        Real64 HumRat;               // {}
+        Real64 Enthalpy;             // {J/kg}
+        Real64 Press;                // {Pa}
         Real64 MassFlowRateMinAvail; // {kg/s}
         Real64 MassFlowRateMaxAvail; // {kg/s}
-        Real64 MassFlowRateSetPoint; // {kg/s}
         Real64 Quality;              // {0.0-1.0 vapor fraction/percent}
-        Real64 Press;                // {Pa}
-        Real64 Enthalpy;             // {J/kg}
-        Real64 EnthalpyLastTimestep; // {J/kg}  DSU for steam?
-        Real64 HumRat;               // {}
-        Real64 HumRatMin;            // {}
-        Real64 HumRatMax;            // {}
-        Real64 HumRatSetPoint;       // {}
+
+        // Flow bounds, setpoints and limits
+        Real64 MassFlowRateMin;      // {kg/s}
+        Real64 MassFlowRateMax;      // {kg/s}
+        Real64 MassFlowRateRequest;  // {kg/s}  DSU
+        Real64 MassFlowRateSetPoint; // {kg/s}
+        Real64 TempSetPoint;         // {C}
         Real64 TempSetPointHi;       // {C}
         Real64 TempSetPointLo;       // {C}
+        Real64 HumRatSetPoint;       // {}
+        Real64 TempMin;              // {C}
+        Real64 TempMax;              // {C}
+        Real64 HumRatMin;            // {}
+        Real64 HumRatMax;            // {}
+        Real64 TempLastTimestep;     // [C}   DSU
+        Real64 EnthalpyLastTimestep; // {J/kg}  DSU for steam?
         Real64 Height;               // {m}
 
-        //  Following are for Outdoor Air Nodes Scheduled Properties
-        bool IsLocalNode;
-        int OutAirDryBulbSchedNum;
-        int OutAirWetBulbSchedNum;
-        int OutAirWindSpeedSchedNum;
-        int OutAirWindDirSchedNum;
+        // Contaminant
+        Real64 CO2;               // {ppm}
+        Real64 CO2SetPoint;       // {ppm}
+        Real64 GenContam;         // {ppm}
+        Real64 GenContamSetPoint; // {ppm}
 
-        //  Following are for Outdoor Air Nodes "read only"
+        // Following are for Outdoor Air Nodes "read only"
         Real64 OutAirDryBulb;              // {C}
-        bool EMSOverrideOutAirDryBulb;     // if true, the EMS is calling to override outdoor air node drybulb setting
         Real64 EMSValueForOutAirDryBulb;   // value EMS is directing to use for outdoor air node's drybulb {C}
         Real64 OutAirWetBulb;              // {C}
-        bool EMSOverrideOutAirWetBulb;     // if true, the EMS is calling to override outdoor air node wetbulb setting
         Real64 EMSValueForOutAirWetBulb;   // value EMS is directing to use for outdoor air node's wetbulb {C}
         Real64 OutAirWindSpeed;            // {m/s}
-        bool EMSOverrideOutAirWindSpeed;   // if true, the EMS is calling to override outdoor air node wind speed setting
         Real64 EMSValueForOutAirWindSpeed; // value EMS is directing to use for outdoor air node's drybulb {m/s}
         Real64 OutAirWindDir;              // {degree}
-        bool EMSOverrideOutAirWindDir;     // if true, the EMS is calling to override outdoor air node wind direction setting
         Real64 EMSValueForOutAirWindDir;   // value EMS is directing to use for outdoor air node's wind directio {degree}
-        // Contaminant
-        Real64 CO2;                // {ppm}
-        Real64 CO2SetPoint;        // {ppm}
-        Real64 GenContam;          // {ppm}
-        Real64 GenContamSetPoint;  // {ppm}
-        bool SPMNodeWetBulbRepReq; // Set to true when node has SPM which follows wetbulb
 
-        // error message flag
+        // Fluid and Outdoor Air Nodes Scheduled Properties
+        int FluidType;               // must be one of the valid parameters
+        int FluidIndex;              // For Fluid Properties
+        int OutAirDryBulbSchedNum;
+        int OutAirWetBulbSchedNum;
+        int OutAirWindSpeedSchedNum;
+        int OutAirWindDirSchedNum;
+
+        // Flags, grouped to avoid padding between the values above
+        bool IsLocalNode;
+        bool EMSOverrideOutAirDryBulb;   // if true, the EMS is calling to override outdoor air node drybulb setting
+        bool EMSOverrideOutAirWetBulb;   // if true, the EMS is calling to override outdoor air node wetbulb setting
+        bool EMSOverrideOutAirWindSpeed; // if true, the EMS is calling to override outdoor air node wind speed setting
+        bool EMSOverrideOutAirWindDir;   // if true, the EMS is calling to override outdoor air node wind direction setting
+        bool SPMNodeWetBulbRepReq;       // Set to true when node has SPM which follows wetbulb
         bool plantNodeErrorMsgIssued;
 
         // Default Constructor
         NodeData()
-            : FluidType(0), FluidIndex(0), Temp(0.0), TempMin(0.0), TempMax(0.0), TempSetPoint(SensedNodeFlagValue), TempLastTimestep(0.0),
-              MassFlowRateRequest(0.0), MassFlowRate(0.0), MassFlowRateMin(0.0), MassFlowRateMax(SensedNodeFlagValue), MassFlowRateMinAvail(0.0),
-              MassFlowRateMaxAvail(0.0), MassFlowRateSetPoint(0.0), Quality(0.0), Press(0.0), Enthalpy(0.0), EnthalpyLastTimestep(0.0), HumRat(0.0),
-              HumRatMin(SensedNodeFlagValue), HumRatMax(SensedNodeFlagValue), HumRatSetPoint(SensedNodeFlagValue),
-              TempSetPointHi(SensedNodeFlagValue), TempSetPointLo(SensedNodeFlagValue), Height(-1.0), IsLocalNode(false), OutAirDryBulbSchedNum(0),
-              OutAirWetBulbSchedNum(0), OutAirWindSpeedSchedNum(0), OutAirWindDirSchedNum(0), OutAirDryBulb(0.0),
-              EMSOverrideOutAirDryBulb(false), EMSValueForOutAirDryBulb(0.0), OutAirWetBulb(0.0), EMSOverrideOutAirWetBulb(false),
-              EMSValueForOutAirWetBulb(0.0), OutAirWindSpeed(0.0), EMSOverrideOutAirWindSpeed(false), EMSValueForOutAirWindSpeed(0.0),
-              OutAirWindDir(0.0), EMSOverrideOutAirWindDir(false), EMSValueForOutAirWindDir(0.0), CO2(0.0), CO2SetPoint(0.0), GenContam(0.0),
-              GenContamSetPoint(0.0), SPMNodeWetBulbRepReq(false), plantNodeErrorMsgIssued(false)
+            : Temp(0.0), MassFlowRate(0.0), HumRat(0.0), Enthalpy(0.0), Press(0.0), MassFlowRateMinAvail(0.0), MassFlowRateMaxAvail(0.0), Quality(0.0),
+              MassFlowRateMin(0.0), MassFlowRateMax(SensedNodeFlagValue), MassFlowRateRequest(0.0), MassFlowRateSetPoint(0.0),
+              TempSetPoint(SensedNodeFlagValue), TempSetPointHi(SensedNodeFlagValue), TempSetPointLo(SensedNodeFlagValue),
+              HumRatSetPoint(SensedNodeFlagValue), TempMin(0.0), TempMax(0.0), HumRatMin(SensedNodeFlagValue), HumRatMax(SensedNodeFlagValue),
+              TempLastTimestep(0.0), EnthalpyLastTimestep(0.0), Height(-1.0), CO2(0.0), CO2SetPoint(0.0), GenContam(0.0), GenContamSetPoint(0.0),
+              OutAirDryBulb(0.0), EMSValueForOutAirDryBulb(0.0), OutAirWetBulb(0.0), EMSValueForOutAirWetBulb(0.0), OutAirWindSpeed(0.0),
+              EMSValueForOutAirWindSpeed(0.0), OutAirWindDir(0.0), EMSValueForOutAirWindDir(0.0), FluidType(0), FluidIndex(0),
+              OutAirDryBulbSchedNum(0), OutAirWetBulbSchedNum(0), OutAirWindSpeedSchedNum(0), OutAirWindDirSchedNum(0), IsLocalNode(false),
+              EMSOverrideOutAirDryBulb(false), EMSOverrideOutAirWetBulb(false), EMSOverrideOutAirWindSpeed(false), EMSOverrideOutAirWindDir(false),
+              SPMNodeWetBulbRepReq(false), plantNodeErrorMsgIssued(false)
         {
         }
 
@@ -240,20 +244,20 @@ namespace DataLoopNode {
                  Real64 const GenContamSetPoint,          // {ppm}
                  bool const SPMNodeWetBulbRepReq          // Set to true when node has SPM which follows wetbulb
                  )
-            : FluidType(FluidType), FluidIndex(FluidIndex), Temp(Temp), TempMin(TempMin), TempMax(TempMax), TempSetPoint(TempSetPoint),
-              TempLastTimestep(TempLastTimestep), MassFlowRateRequest(MassFlowRateRequest), MassFlowRate(MassFlowRate),
-              MassFlowRateMin(MassFlowRateMin), MassFlowRateMax(MassFlowRateMax), MassFlowRateMinAvail(MassFlowRateMinAvail),
-              MassFlowRateMaxAvail(MassFlowRateMaxAvail), MassFlowRateSetPoint(MassFlowRateSetPoint), Quality(Quality), Press(Press),
-              Enthalpy(Enthalpy), EnthalpyLastTimestep(EnthalpyLastTimestep), HumRat(HumRat), HumRatMin(HumRatMin), HumRatMax(HumRatMax),
-              HumRatSetPoint(HumRatSetPoint), TempSetPointHi(TempSetPointHi), TempSetPointLo(TempSetPointLo), Height(Height),
-              IsLocalNode(IsLocalNode), OutAirDryBulbSchedNum(OutAirDryBulbSchedNum), OutAirWetBulbSchedNum(OutAirWetBulbSchedNum),
-              OutAirWindSpeedSchedNum(OutAirWindSpeedSchedNum), OutAirWindDirSchedNum(OutAirWindDirSchedNum), OutAirDryBulb(OutAirDryBulb),
-              EMSOverrideOutAirDryBulb(EMSOverrideOutAirDryBulb), EMSValueForOutAirDryBulb(EMSValueForOutAirDryBulb), OutAirWetBulb(OutAirWetBulb),
-              EMSOverrideOutAirWetBulb(EMSOverrideOutAirWetBulb), EMSValueForOutAirWetBulb(EMSValueForOutAirWetBulb),
-              OutAirWindSpeed(OutAirWindSpeed), EMSOverrideOutAirWindSpeed(EMSOverrideOutAirWindSpeed),
-              EMSValueForOutAirWindSpeed(EMSValueForOutAirWindSpeed), OutAirWindDir(OutAirWindDir),
-              EMSOverrideOutAirWindDir(EMSOverrideOutAirWindDir), EMSValueForOutAirWindDir(EMSValueForOutAirWindDir), CO2(CO2),
-              CO2SetPoint(CO2SetPoint), GenContam(GenContam), GenContamSetPoint(GenContamSetPoint), SPMNodeWetBulbRepReq(SPMNodeWetBulbRepReq)
+            : Temp(Temp), MassFlowRate(MassFlowRate), HumRat(HumRat), Enthalpy(Enthalpy), Press(Press), MassFlowRateMinAvail(MassFlowRateMinAvail),
+              MassFlowRateMaxAvail(MassFlowRateMaxAvail), Quality(Quality), MassFlowRateMin(MassFlowRateMin), MassFlowRateMax(MassFlowRateMax),
+              MassFlowRateRequest(MassFlowRateRequest), MassFlowRateSetPoint(MassFlowRateSetPoint), TempSetPoint(TempSetPoint),
+              TempSetPointHi(TempSetPointHi), TempSetPointLo(TempSetPointLo), HumRatSetPoint(HumRatSetPoint), TempMin(TempMin), TempMax(TempMax),
+              HumRatMin(HumRatMin), HumRatMax(HumRatMax), TempLastTimestep(TempLastTimestep), EnthalpyLastTimestep(EnthalpyLastTimestep),
+              Height(Height), CO2(CO2), CO2SetPoint(CO2SetPoint), GenContam(GenContam), GenContamSetPoint(GenContamSetPoint),
+              OutAirDryBulb(OutAirDryBulb), EMSValueForOutAirDryBulb(EMSValueForOutAirDryBulb), OutAirWetBulb(OutAirWetBulb),
+              EMSValueForOutAirWetBulb(EMSValueForOutAirWetBulb), OutAirWindSpeed(OutAirWindSpeed),
+              EMSValueForOutAirWindSpeed(EMSValueForOutAirWindSpeed), OutAirWindDir(OutAirWindDir), EMSValueForOutAirWindDir(EMSValueForOutAirWindDir),
+              FluidType(FluidType), FluidIndex(FluidIndex), OutAirDryBulbSchedNum(OutAirDryBulbSchedNum), OutAirWetBulbSchedNum(OutAirWetBulbSchedNum),
+              OutAirWindSpeedSchedNum(OutAirWindSpeedSchedNum), OutAirWindDirSchedNum(OutAirWindDirSchedNum), IsLocalNode(IsLocalNode),
+              EMSOverrideOutAirDryBulb(EMSOverrideOutAirDryBulb), EMSOverrideOutAirWetBulb(EMSOverrideOutAirWetBulb),
+              EMSOverrideOutAirWindSpeed(EMSOverrideOutAirWindSpeed), EMSOverrideOutAirWindDir(EMSOverrideOutAirWindDir),
+              SPMNodeWetBulbRepReq(SPMNodeWetBulbRepReq)
         {
         }
     };
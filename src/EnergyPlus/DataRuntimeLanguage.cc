@@ -179,6 +179,13 @@ namespace DataRuntimeLanguage {
 
     int const NumPossibleOperators(68); // total number of operators and built-in functions
 
+    // Compiled expression instructions and states
+    int const ByteCodePushNumber(-1);   // push a numeric literal
+    int const ByteCodePushVariable(-2); // push the number held by an Erl variable
+    int const ByteCodeNotCompiled(0);   // expression has not been examined yet
+    int const ByteCodeCompiled(1);      // expression is evaluated from its byte code
+    int const ByteCodeNotCompilable(2); // expression needs the general interpreter
+
     // DERIVED TYPE DEFINITIONS:
 
     // MODULE VARIABLE TYPE DECLARATIONS:
@@ -242,14 +249,20 @@ namespace DataRuntimeLanguage {
     Array1D<OperatorType> PossibleOperators;                     // hard library of available operators and functions
     Array1D<TrendVariableType> TrendVariable;                    // holds Erl trend varialbes in a structure array
     Array1D<OutputVarSensorType> Sensor;                         // EMS:SENSOR objects used (from output variables)
+    std::unordered_map<int, std::vector<int>> SensorsByCallingPoint; // sensors refreshed at each calling point with programs
+    std::vector<int> SensorsAtAllCallingPoints;                  // sensors reported or trended, refreshed at every calling point
     Array1D<EMSActuatorAvailableType> EMSActuatorAvailable;      // actuators that could be used
     Array1D<ActuatorUsedType> EMSActuatorUsed;                   // actuators that are used
+    std::vector<EMSActuatorTargetType> EMSActuatorTarget;        // resolved actuators that are used, in EMSActuatorUsed order
     Array1D<InternalVarsAvailableType> EMSInternalVarsAvailable; // internal data that could be used
     Array1D<InternalVarsUsedType> EMSInternalVarsUsed;           // internal data that are used
     Array1D<EMSProgramCallManagementType> EMSProgramCallManager; // program calling managers
-    ErlValueType Null(0, 0.0, "", 0, 0, false, 0, "", true);     // special "null" Erl variable value instance
-    ErlValueType False(0, 0.0, "", 0, 0, false, 0, "", true);    // special "false" Erl variable value instance
-    ErlValueType True(0, 0.0, "", 0, 0, false, 0, "", true);     // special "True" Erl variable value instance, gets reset
+    ErlValueType Null(0, 0.0, 0, 0, 0, false, 0, 0, true);       // special "null" Erl variable value instance
+    ErlValueType False(0, 0.0, 0, 0, 0, false, 0, 0, true);      // special "false" Erl variable value instance
+    ErlValueType True(0, 0.0, 0, 0, 0, false, 0, 0, true);       // special "True" Erl variable value instance, gets reset
+    std::vector<std::string> ErlValueString;                     // text of Erl string values, ErlValueType::StringNum - 1
+    std::vector<std::string> ErlValueError;                      // text of Erl error values, ErlValueType::ErrorNum - 1
+    std::unordered_map<std::string, int> ErlValueErrorLookup;    // ErrorNum of each distinct error message
 
     // EMS Actuator fast duplicate check lookup support
     std::unordered_set<std::tuple<std::string, std::string, std::string>, EMSActuatorKey_hash> EMSActuator_lookup; // Fast duplicate lookup structure
@@ -300,12 +313,18 @@ namespace DataRuntimeLanguage {
         PossibleOperators.deallocate();        // hard library of available operators and functions
         TrendVariable.deallocate();            // holds Erl trend varialbes in a structure array
         Sensor.deallocate();                   // EMS:SENSOR objects used (from output variables)
+        SensorsByCallingPoint.clear();         // sensors refreshed at each calling point with programs
+        SensorsAtAllCallingPoints.clear();     // sensors reported or trended, refreshed at every calling point
         EMSActuatorAvailable.deallocate();     // actuators that could be used
         EMSActuatorUsed.deallocate();          // actuators that are used
+        EMSActuatorTarget.clear();             // resolved actuators that are used
         EMSInternalVarsAvailable.deallocate(); // internal data that could be used
         EMSInternalVarsUsed.deallocate();      // internal data that are used
         EMSProgramCallManager.deallocate();    // program calling managers
         EMSActuator_lookup.clear();            // Fast duplicate lookup structure
+        ErlValueString.clear();                // text of Erl string values
+        ErlValueError.clear();                 // text of Erl error values
+        ErlValueErrorLookup.clear();           // ErrorNum of each distinct error message
     }
 
     void ValidateEMSVariableName(std::string const &cModuleObject, // the current object name
@@ -50,8 +50,11 @@
 
 // C++ Headers
 #include <functional>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -177,6 +180,13 @@ namespace DataRuntimeLanguage {
 
     extern int const NumPossibleOperators; // total number of operators and built-in functions
 
+    // Compiled expression instructions and states
+    extern int const ByteCodePushNumber;    // push a numeric literal
+    extern int const ByteCodePushVariable;  // push the number held by an Erl variable
+    extern int const ByteCodeNotCompiled;   // expression has not been examined yet
+    extern int const ByteCodeCompiled;      // expression is evaluated from its byte code
+    extern int const ByteCodeNotCompilable; // expression needs the general interpreter
+
     // DERIVED TYPE DEFINITIONS:
 
     // MODULE VARIABLE TYPE DECLARATIONS:
@@ -327,6 +337,24 @@ namespace DataRuntimeLanguage {
         }
     };
 
+    struct EMSActuatorTargetType
+    {
+        // Members
+        // resolved actuator used in Erl, with direct pointers to the actuated data
+        int ErlVariableNum;  // global Erl variable holding the actuator value
+        int PntrVarTypeUsed; // data type used: integer (PntrInteger), real (PntrReal) or logical (PntrLogical)
+        bool *Actuated;      // flag that signals EMS is actuating
+        Real64 *RealValue;   // REAL value that is being actuated
+        int *IntValue;       // Integer value that is being actuated
+        bool *LogValue;      // Logical value that is being actuated
+
+        // Default Constructor
+        EMSActuatorTargetType()
+            : ErlVariableNum(0), PntrVarTypeUsed(0), Actuated(nullptr), RealValue(nullptr), IntValue(nullptr), LogValue(nullptr)
+        {
+        }
+    };
+
     struct EMSProgramCallManagementType
     {
         // Members
@@ -346,34 +374,37 @@ namespace DataRuntimeLanguage {
     {
         // Members
         // instance data structure for the values taken by Erl variables, nested structure in ErlVariable
-        int Type;           // value type, eg. ValueNumber,
-        Real64 Number;      // numeric value instance for Erl variable
-        std::string String; // string data types in Erl (not used yet)
-        int Variable;       // Pointer to another Erl variable
+        // text is kept out of the value in the ErlValueString and ErlValueError tables so values stay cheap to copy
+        int Type;      // value type, eg. ValueNumber,
+        Real64 Number; // numeric value instance for Erl variable
+        int StringNum; // index in ErlValueString for string data types in Erl (not used yet), 0 for an empty string
+        int Variable;  // Pointer to another Erl variable
         //  Might be good to change names to VariableNum and ExpressionNum just to be clear
         int Expression;      // Pointer to another Erl expression (e.g. compound operators)
         bool TrendVariable;  // true if Erl variable is really a trend variable
         int TrendVarPointer; // index to match in TrendVariable structure
-        std::string Error;   // holds error message string for reporting
+        int ErrorNum;        // index in ErlValueError of the error message for reporting, 0 if none
         bool initialized;    // true if number value has been SET (ie. has been on LHS in SET expression)
 
         // Default Constructor
-        ErlValueType() : Type(0), Number(0.0), Variable(0), Expression(0), TrendVariable(false), TrendVarPointer(0), initialized(false)
+        ErlValueType()
+            : Type(0), Number(0.0), StringNum(0), Variable(0), Expression(0), TrendVariable(false), TrendVarPointer(0), ErrorNum(0),
+              initialized(false)
         {
         }
 
         // Member Constructor
         ErlValueType(int const Type,            // value type, eg. ValueNumber,
                      Real64 const Number,       // numeric value instance for Erl variable
-                     std::string const &String, // string data types in Erl (not used yet)
+                     int const StringNum,       // index in ErlValueString for string data types in Erl (not used yet)
                      int const Variable,        // Pointer to another Erl variable
                      int const Expression,      // Pointer to another Erl expression (e.g. compound operators)
                      bool const TrendVariable,  // true if Erl variable is really a trend variable
                      int const TrendVarPointer, // index to match in TrendVariable structure
-                     std::string const &Error,  // holds error message string for reporting
+                     int const ErrorNum,        // index in ErlValueError of the error message for reporting
                      bool const initialized)
-            : Type(Type), Number(Number), String(String), Variable(Variable), Expression(Expression), TrendVariable(TrendVariable),
-              TrendVarPointer(TrendVarPointer), Error(Error), initialized(initialized)
+            : Type(Type), Number(Number), StringNum(StringNum), Variable(Variable), Expression(Expression), TrendVariable(TrendVariable),
+              TrendVarPointer(TrendVarPointer), ErrorNum(ErrorNum), initialized(initialized)
         {
         }
     };
@@ -426,15 +457,32 @@ namespace DataRuntimeLanguage {
         }
     };
 
+    struct ErlByteCodeType
+    {
+        // Members
+        // one instruction of the compiled form of a numeric Erl expression, run on a stack of numbers
+        int Operator;    // operator or function code, or ByteCodePushNumber, ByteCodePushVariable
+        int NumOperands; // count of operands taken from the stack
+        int Variable;    // Erl variable pushed by ByteCodePushVariable
+        Real64 Number;   // value pushed by ByteCodePushNumber
+
+        // Default Constructor
+        ErlByteCodeType() : Operator(0), NumOperands(0), Variable(0), Number(0.0)
+        {
+        }
+    };
+
     struct ErlExpressionType
     {
         // Members
         int Operator;                  // indicates the type of operator or function 1..64
         int NumOperands;               // count of operands in expression
         Array1D<ErlValueType> Operand; // holds Erl values for operands in expression
+        int CompileState;              // ByteCodeNotCompiled, ByteCodeCompiled or ByteCodeNotCompilable
+        std::vector<ErlByteCodeType> ByteCode; // postfix instructions when the expression is purely numeric
 
         // Default Constructor
-        ErlExpressionType() : Operator(0), NumOperands(0)
+        ErlExpressionType() : Operator(0), NumOperands(0), CompileState(0)
         {
         }
     };
@@ -476,14 +524,20 @@ namespace DataRuntimeLanguage {
     extern Array1D<OperatorType> PossibleOperators;                     // hard library of available operators and functions
     extern Array1D<TrendVariableType> TrendVariable;                    // holds Erl trend varialbes in a structure array
     extern Array1D<OutputVarSensorType> Sensor;                         // EMS:SENSOR objects used (from output variables)
+    extern std::unordered_map<int, std::vector<int>> SensorsByCallingPoint; // sensors refreshed at each calling point with programs
+    extern std::vector<int> SensorsAtAllCallingPoints;                  // sensors reported or trended, refreshed at every calling point
     extern Array1D<EMSActuatorAvailableType> EMSActuatorAvailable;      // actuators that could be used
     extern Array1D<ActuatorUsedType> EMSActuatorUsed;                   // actuators that are used
+    extern std::vector<EMSActuatorTargetType> EMSActuatorTarget;        // resolved actuators that are used, in EMSActuatorUsed order
     extern Array1D<InternalVarsAvailableType> EMSInternalVarsAvailable; // internal data that could be used
     extern Array1D<InternalVarsUsedType> EMSInternalVarsUsed;           // internal data that are used
     extern Array1D<EMSProgramCallManagementType> EMSProgramCallManager; // program calling managers
     extern ErlValueType Null;                                           // special "null" Erl variable value instance
     extern ErlValueType False;                                          // special "false" Erl variable value instance
     extern ErlValueType True;                                           // special "True" Erl variable value instance, gets reset
+    extern std::vector<std::string> ErlValueString;                     // text of Erl string values, ErlValueType::StringNum - 1
+    extern std::vector<std::string> ErlValueError;                      // text of Erl error values, ErlValueType::ErrorNum - 1
+    extern std::unordered_map<std::string, int> ErlValueErrorLookup;    // ErrorNum of each distinct error message
 
     // EMS Actuator fast duplicate check lookup support
     typedef std::tuple<std::string, std::string, std::string> EMSActuatorKey;
@@ -50,6 +50,7 @@
 
 // C++ Headers
 #include <string>
+#include <vector>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
@@ -63,10 +64,13 @@ namespace DataStringGlobals {
     // Thus, all variables in this module must be PUBLIC.
 
     extern std::string outputAuditFileName;
+    extern std::string outputBinFileName;
     extern std::string outputBndFileName;
     extern std::string outputDxfFileName;
     extern std::string outputEioFileName;
     extern std::string outputEndFileName;
+    extern std::string outputCkptFileName;
+    extern std::string outputTimersFileName;
     extern std::string outputErrFileName;
     extern std::string outputEsoFileName;
 
@@ -101,6 +105,10 @@ namespace DataStringGlobals {
     extern std::string outputMtdFileName;
     extern std::string outputMddFileName;
     extern std::string outputMtrFileName;
+    extern std::string outputPsyCsvFileName;
+    extern std::string outputPlantTimingCsvFileName;
+    extern std::string outputPerformanceJsonFileName;
+    extern std::string outputHVACIterationCsvFileName;
     extern std::string outputRddFileName;
     extern std::string outputShdFileName;
     extern std::string outputTblCsvFileName;
@@ -116,6 +124,7 @@ namespace DataStringGlobals {
     extern std::string outputAdsFileName;
     extern std::string outputDfsFileName;
     extern std::string outputGLHEFileName;
+    extern std::string outputKivaFileName;
     extern std::string outputDelightInFileName;
     extern std::string outputDelightOutFileName;
     extern std::string outputDelightEldmpFileName;
@@ -186,6 +195,8 @@ namespace DataStringGlobals {
     extern std::string CurrentDateTime;      // For printing current date and time at start of run
 
     // Functions
+    std::vector<std::string *> outputFileNames();
+
     void clear_state();
 
 } // namespace DataStringGlobals
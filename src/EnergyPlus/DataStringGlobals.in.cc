@@ -120,10 +120,13 @@ namespace DataStringGlobals {
 
     // MODULE VARIABLE DECLARATIONS:
     std::string outputAuditFileName("eplusout.audit");
+    std::string outputBinFileName("eplusout.bin");
     std::string outputBndFileName("eplusout.bnd");
     std::string outputDxfFileName("eplusout.dxf");
     std::string outputEioFileName("eplusout.eio");
     std::string outputEndFileName("eplusout.end");
+    std::string outputCkptFileName("eplusout.ckpt");
+    std::string outputTimersFileName("eplusout.timers");
     std::string outputErrFileName("eplusout.err");
     std::string outputEsoFileName("eplusout.eso");
     std::string outputJsonFileName("eplusout.json");
@@ -156,6 +159,10 @@ namespace DataStringGlobals {
     std::string outputMtdFileName("eplusout.mtd");
     std::string outputMddFileName("eplusout.mdd");
     std::string outputMtrFileName("eplusout.mtr");
+    std::string outputPsyCsvFileName("eplusout_psychrometrics.csv");
+    std::string outputPlantTimingCsvFileName("eplusout_planttiming.csv");
+    std::string outputPerformanceJsonFileName("eplusout_performance.json");
+    std::string outputHVACIterationCsvFileName("eplusout_hvaciterations.csv");
     std::string outputRddFileName("eplusout.rdd");
     std::string outputShdFileName("eplusout.shd");
     std::string outputTblCsvFileName("eplustbl.csv");
@@ -166,6 +173,7 @@ namespace DataStringGlobals {
     std::string outputAdsFileName("eplusADS.out");
     std::string outputDfsFileName("eplusout.dfs");
     std::string outputGLHEFileName("eplusout.glhe");
+    std::string outputKivaFileName("eplusout.kiva");
     std::string outputDelightInFileName("eplusout.delightin");
     std::string outputDelightOutFileName("eplusout.delightout");
     std::string outputDelightEldmpFileName("eplusout.delighteldmp");
@@ -222,6 +230,93 @@ namespace DataStringGlobals {
                                                                                                                                       // information
     std::string MatchVersion("${CMAKE_VERSION_MAJOR}.${CMAKE_VERSION_MINOR}"); // String to be matched by Version object
 
+    std::vector<std::string *> outputFileNames()
+    {
+        // The output file names set by ProcessArgs from the output directory and prefix
+        return {
+            &outputAuditFileName,
+            &outputBinFileName,
+            &outputBndFileName,
+            &outputDxfFileName,
+            &outputEioFileName,
+            &outputEndFileName,
+            &outputCkptFileName,
+            &outputTimersFileName,
+            &outputErrFileName,
+            &outputEsoFileName,
+            &outputJsonFileName,
+            &outputTSZoneJsonFileName,
+            &outputTSHvacJsonFileName,
+            &outputTSJsonFileName,
+            &outputYRJsonFileName,
+            &outputMNJsonFileName,
+            &outputDYJsonFileName,
+            &outputHRJsonFileName,
+            &outputSMJsonFileName,
+            &outputCborFileName,
+            &outputTSZoneCborFileName,
+            &outputTSHvacCborFileName,
+            &outputTSCborFileName,
+            &outputYRCborFileName,
+            &outputMNCborFileName,
+            &outputDYCborFileName,
+            &outputHRCborFileName,
+            &outputSMCborFileName,
+            &outputMsgPackFileName,
+            &outputTSZoneMsgPackFileName,
+            &outputTSHvacMsgPackFileName,
+            &outputTSMsgPackFileName,
+            &outputYRMsgPackFileName,
+            &outputMNMsgPackFileName,
+            &outputDYMsgPackFileName,
+            &outputHRMsgPackFileName,
+            &outputSMMsgPackFileName,
+            &outputMtdFileName,
+            &outputMddFileName,
+            &outputMtrFileName,
+            &outputPsyCsvFileName,
+            &outputPlantTimingCsvFileName,
+            &outputPerformanceJsonFileName,
+            &outputHVACIterationCsvFileName,
+            &outputRddFileName,
+            &outputShdFileName,
+            &outputDfsFileName,
+            &outputGLHEFileName,
+            &outputKivaFileName,
+            &outputEddFileName,
+            &outputIperrFileName,
+            &outputSlnFileName,
+            &outputSciFileName,
+            &outputWrlFileName,
+            &outputSqlFileName,
+            &outputDbgFileName,
+            &outputTblCsvFileName,
+            &outputTblHtmFileName,
+            &outputTblTabFileName,
+            &outputTblTxtFileName,
+            &outputTblXmlFileName,
+            &outputMapTabFileName,
+            &outputMapCsvFileName,
+            &outputMapTxtFileName,
+            &outputZszCsvFileName,
+            &outputZszTabFileName,
+            &outputZszTxtFileName,
+            &outputSszCsvFileName,
+            &outputSszTabFileName,
+            &outputSszTxtFileName,
+            &outputAdsFileName,
+            &outputExtShdFracFileName,
+            &outputSqliteErrFileName,
+            &outputScreenCsvFileName,
+            &outputDelightInFileName,
+            &outputDelightOutFileName,
+            &outputDelightEldmpFileName,
+            &outputDelightDfdmpFileName,
+            &outputCsvFileName,
+            &outputMtrCsvFileName,
+            &outputRvauditFileName,
+        };
+    }
 
     void clear_state()
     {
@@ -245,6 +340,7 @@ namespace DataStringGlobals {
         CurrentWorkingFolder.clear();
         CurrentDateTime.clear();
         IDDVerString.clear();
+        VerString = "EnergyPlus, Version ${CMAKE_VERSION_MAJOR}.${CMAKE_VERSION_MINOR}.${CMAKE_VERSION_PATCH}-${CMAKE_VERSION_BUILD}";
     }
 } // namespace DataStringGlobals
 
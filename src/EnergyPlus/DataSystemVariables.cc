@@ -45,6 +45,12 @@
 // OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+// C++ Headers
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/environment.hh>
 #include <ObjexxFCL/gio.hh>
@@ -56,6 +62,7 @@
 #include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
 #include <FileSystem.hh>
+#include <Parallel.hh>
 #include <UtilityRoutines.hh>
 
 namespace EnergyPlus {
@@ -118,6 +125,48 @@ namespace DataSystemVariables {
     std::string const cIgnoreBeamRadiation("IgnoreBeamRadiation");
     std::string const cIgnoreDiffuseRadiation("IgnoreDiffuseRadiation");
     std::string const cSutherlandHodgman("SutherlandHodgman");
+    std::string const cPixelCountingShading("PixelCountingShading");
+    std::string const cShadingCacheDirectory("EP_SHADING_CACHE"); // directory in which shading results are cached between runs
+    std::string const cWeatherCacheDirectory("EP_WEATHER_CACHE"); // directory in which parsed weather file records are cached between runs
+    std::string const cGroundTempCacheDirectory("EP_GROUND_TEMP_CACHE"); // directory in which finite difference ground temperatures are cached
+    std::string const cHourlyIlluminanceMaps("HourlyIlluminanceMaps");
+    std::string const cPsychrometricTables("PsychrometricTables");
+    std::string const cPsychrometricCacheBits("PsychrometricCacheBits");
+    std::string const cAirflowNetworkSparseSolver("AirflowNetworkSparseSolver"); // LDLT or ConjugateGradient
+    std::string const cRefrigerantTableInversion("RefrigerantTableInversion");
+    std::string const cBinaryOutput("BinaryOutput");
+    std::string const cAsyncOutput("AsyncOutput");
+    std::string const cStreamTimeSeriesOutput("StreamTimeSeriesOutput");
+    std::string const cLiveOutputChannel("LiveOutputChannel"); // name of the shared memory channel that time step values are published to
+    std::string const cAcceleratedWarmup("AcceleratedWarmup");
+    std::string const cWarmupStateReuse("WarmupStateReuse");
+    std::string const cCompiledSchedules("CompiledSchedules");
+    std::string const cDeduplicateSchedules("DeduplicateSchedules");
+    std::string const cLongRunMode("LongRunMode");
+    std::string const cAirflowNetworkJacobianReuse("AirflowNetworkJacobianReuse");
+    std::string const cAirflowNetworkCpTables("AirflowNetworkCpTables");
+    std::string const cPlantHalfLoopChangeDetection("PlantHalfLoopChangeDetection");
+    std::string const cPlantComponentTimings("PlantComponentTimings");
+    std::string const cAirLoopControllerSweeps("AirLoopControllerSweeps");
+    std::string const cControllerWarmStart("ControllerWarmStart");
+    std::string const cAirLoopComponentBypass("AirLoopComponentBypass");
+    std::string const cUnitaryDirectPLR("UnitaryDirectPLR");
+    std::string const cStratifiedTankImplicit("StratifiedTankImplicit");
+    std::string const cGLHEMultiLevelAggregation("GLHEMultiLevelAggregation");
+    std::string const cKivaGroundCaching("KIVAGROUNDCACHING");
+    std::string const cPipingSystemsSparseSolver("PIPINGSYSTEMSSPARSESOLVER");
+    std::string const cPipingSystemsFlatCellArrays("PIPINGSYSTEMSFLATCELLARRAYS");
+    std::string const cCondFDDirectSolve("CONDFDDIRECTSOLVE");
+    std::string const cWindowNewtonSolve("WINDOWNEWTONSOLVE");
+    std::string const cWindowAngularTables("WINDOWANGULARTABLES");
+    std::string const cTARCOGResultMemo("TARCOGRESULTMEMO");
+    std::string const cEQLWindowWarmStart("EQLWINDOWWARMSTART");
+    std::string const cDirectCsvOutput("DirectCsvOutput");
+    std::string const cBatteryWarmStart("BATTERYWARMSTART");
+    std::string const cSuppressEioOutput("SUPPRESSEIOOUTPUT");
+    std::string const cPerformanceReport("PERFORMANCEREPORT");
+    std::string const cDaylightingSkipUnlitZones("DAYLIGHTINGSKIPUNLIT");
+    std::string const cHVACIterationReport("HVACITERATIONREPORT");
     std::string const cMinimalSurfaceVariables("CreateMinimalSurfaceVariables");
     std::string const cMinimalShadowing("MinimalShadowing");
     std::string const cNumActiveSims("cntActv");
@@ -135,6 +184,9 @@ namespace DataSystemVariables {
     std::string const MinReportFrequencyEnvVar("MINREPORTFREQUENCY"); // environment var for reporting frequency.
     std::string const
         cDisplayInputInAuditEnvVar("DISPLAYINPUTINAUDIT"); // environmental variable that enables the echoing of the input file into the audit file
+    std::string const ValidationCacheEnvVar("VALIDATIONCACHEFILE"); // environment var naming a file that caches objects which passed input validation
+    std::string const cNumThreads("OMP_NUM_THREADS");                // environment var for the number of threads
+    std::string const cepNumThreads("EP_OMP_NUM_THREADS");           // environment var for the number of threads, EnergyPlus only
 
     // DERIVED TYPE DEFINITIONS
     // na
@@ -150,6 +202,43 @@ namespace DataSystemVariables {
     bool DeveloperFlag(false);                    // TRUE if developer flag is turned on. (turns on more displays to console)
     bool TimingFlag(false);                       // TRUE if timing flag is turned on. (turns on more timing displays to console)
     bool SutherlandHodgman(true);                 // TRUE if SutherlandHodgman algorithm for polygon clipping is to be used.
+    bool PixelCountingShading(false);             // TRUE if sunlit areas of surfaces without subsurfaces are found by grid counting
+    bool HourlyIlluminanceMaps(false);            // TRUE if illuminance maps are figured once per hour instead of every time step
+    bool PsychrometricTables(false);              // TRUE if psychrometric inversions may use checked interpolation tables
+    int PsychrometricCacheBits(20);               // log2 of the number of entries in each psychrometric cache
+    bool RefrigerantTableInversion(false);        // TRUE if superheated temperatures are found by inverting the enthalpy table
+    bool BinaryOutput(false);                     // TRUE if report variables and meters are also written to the binary output file
+    bool AsyncOutput(false);                      // TRUE if the eso, mtr and binary output files are written from a background thread
+    bool StreamTimeSeriesOutput(false);           // TRUE if the JSON/CBOR time series files are written row by row as the run proceeds
+    bool AcceleratedWarmup(false);                // TRUE if warmup surface histories are extrapolated toward their periodic state
+    bool WarmupStateReuse(false);                 // TRUE if a repeated design day starts from its converged warmup state
+    bool CompiledSchedules(false);                // TRUE if schedule values are only updated at the time steps where they change
+    bool DeduplicateSchedules(false);             // TRUE if schedules with identical values share one copy of their values
+    bool LongRunMode(false);                      // TRUE if long run periods batch their day boundary work
+    bool AirflowNetworkJacobianReuse(false);      // TRUE if AirflowNetwork reuses a factored Jacobian
+    bool AirflowNetworkCpTables(false);           // TRUE if wind pressure coefficients come from 1 deg tables
+    bool PlantHalfLoopChangeDetection(false);     // skip forced plant half-loop resimulation when its inputs are unchanged
+    bool PlantComponentTimings(false);            // TRUE if plant component simulation times are collected and written at end of run
+    bool AirLoopControllerSweeps(false);          // re-solve air loop controllers that lose convergence to later controllers
+    bool ControllerWarmStart(false);              // start controller root finding from the previous solution and sensitivity
+    bool AirLoopComponentBypass(false);           // skip passive air loop components whose nodes are unchanged
+    bool UnitaryDirectPLR(false);                 // solve single speed DX coil part load ratios in closed form first
+    bool StratifiedTankImplicit(false);           // Implicit full time step solve of stratified tank nodes
+    bool GLHEMultiLevelAggregation(false);        // TRUE to lump older monthly GLHE loads into blocks of doubling width
+    bool KivaGroundCaching(false);                // Reuse initialized Kiva ground temperatures stored in the .kiva file by earlier runs
+    bool PipingSystemsSparseSolver(false);        // Solve ground domain temperatures with a sparse factorization instead of sweeps
+    bool PipingSystemsFlatCellArrays(false);      // Sweep ground domain temperatures over flat neighbor index and coefficient arrays
+    bool CondFDDirectSolve(false);                // Solve linear CondFD surfaces with a direct tridiagonal solve
+    bool WindowNewtonSolve(false);                // Solve bare window face temperatures with Newton steps
+    bool WindowAngularTables(false);              // Look up window beam properties from angular tables
+    bool TARCOGResultMemo(false);                 // Reuse TARCOG solutions for repeated boundary conditions
+    bool EQLWindowWarmStart(false);               // Start equivalent-layer window solutions from the last one
+    bool DirectCsvOutput(false);                  // TRUE if the eso and mtr time series are also written as csv files during the run
+    bool BatteryWarmStart(false);                 // start the kinetic battery current iterations from the last converged current
+    bool SuppressEioOutput(false);                // send the initialization (eio) output to the null device
+    bool PerformanceReport(false);                // write <prefix>_performance.json at the end of a successful run
+    bool DaylightingSkipUnlitZones(false);        // skip daylighting in zones whose lights are scheduled off
+    bool HVACIterationReport(false);              // write <prefix>_hvaciterations.csv with the HVAC iteration counts and times
     bool DetailedSkyDiffuseAlgorithm(false);      // use detailed diffuse shading algorithm for sky (shading transmittance varies)
     bool DetailedSolarTimestepIntegration(false); // when true, use detailed timestep integration for all solar,shading, etc.
     bool TrackAirLoopEnvFlag(false);              // If TRUE generates a file with runtime statistics for each HVAC
@@ -165,6 +254,11 @@ namespace DataSystemVariables {
     bool UseScheduledSunlitFrac(false);                  // when true, the sunlit fraction for all surfaces are imported from schedule inputs
     bool ReportExtShadingSunlitFrac(false);              // when true, the sunlit fraction for all surfaces are exported as a csv format output
     bool UseImportedSunlitFrac(false);                   // when true, the sunlit fraction for all surfaces are imported altogether as a CSV/JSON file
+    std::string ShadingCacheDirectory;                   // when not empty, beam shading results are cached in this directory
+    std::string WeatherCacheDirectory;                   // when not empty, parsed weather file records are cached in this directory
+    std::string GroundTempCacheDirectory;                // when not empty, finite difference ground temperatures are cached in this directory
+    std::string LiveOutputChannel;                       // when not empty, time step values are published to this shared memory channel
+    std::string AirflowNetworkSparseSolver;              // when not empty, the airflow network is solved with this sparse solver
 
     bool DisableGroupSelfShading(false); // when true, defined shadowing surfaces group is ignored when calculating sunlit fraction
     bool DisableAllSelfShading(false);   // when true, all external shadowing surfaces is ignored when calculating sunlit fraction
@@ -366,6 +460,52 @@ namespace DataSystemVariables {
         }
     }
 
+    void InitializeThreading()
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Set the number of threads used by the threaded loops from the EP_OMP_NUM_THREADS or
+        // OMP_NUM_THREADS environment variables.  Threading is opt-in: when neither is set, or
+        // EnergyPlus was built without OpenMP, everything runs on a single thread.  The count is
+        // capped by Parallel::ThreadLimit and then used to size the shared thread team.
+
+        std::string cEnvValue;
+        bool ErrFlag(false);
+
+        get_environment_variable(cNumThreads, cEnvValue);
+        if (!cEnvValue.empty()) {
+            iEnvSetThreads = int(UtilityRoutines::ProcessNumber(cEnvValue, ErrFlag));
+            lEnvSetThreadsInput = (!ErrFlag && iEnvSetThreads > 0);
+            if (!lEnvSetThreadsInput) iEnvSetThreads = 0;
+        }
+
+        ErrFlag = false;
+        get_environment_variable(cepNumThreads, cEnvValue);
+        if (!cEnvValue.empty()) {
+            iepEnvSetThreads = int(UtilityRoutines::ProcessNumber(cEnvValue, ErrFlag));
+            lepSetThreadsInput = (!ErrFlag && iepEnvSetThreads > 0);
+            if (!lepSetThreadsInput) iepEnvSetThreads = 0;
+        }
+
+#ifdef _OPENMP
+        Threading = true;
+        MaxNumberOfThreads = omp_get_num_procs();
+#else
+        Threading = false;
+        MaxNumberOfThreads = 1;
+#endif
+
+        int RequestedThreads(1);
+        if (lepSetThreadsInput) {
+            RequestedThreads = iepEnvSetThreads;
+        } else if (lEnvSetThreadsInput) {
+            RequestedThreads = iEnvSetThreads;
+        }
+        if (Parallel::ThreadLimit() > 0) RequestedThreads = std::min(RequestedThreads, Parallel::ThreadLimit());
+        NumberIntRadThreads = std::max(1, std::min(RequestedThreads, MaxNumberOfThreads));
+        Parallel::ConfigureThreads();
+    }
+
     void clear_state()
     {
         DDOnly = false;
@@ -375,6 +515,43 @@ namespace DataSystemVariables {
         DeveloperFlag = false;
         TimingFlag = false;
         SutherlandHodgman = true;
+        PixelCountingShading = false;
+        HourlyIlluminanceMaps = false;
+        PsychrometricTables = false;
+        PsychrometricCacheBits = 20;
+        RefrigerantTableInversion = false;
+        BinaryOutput = false;
+        AsyncOutput = false;
+        StreamTimeSeriesOutput = false;
+        AcceleratedWarmup = false;
+        WarmupStateReuse = false;
+        CompiledSchedules = false;
+        DeduplicateSchedules = false;
+        LongRunMode = false;
+        AirflowNetworkJacobianReuse = false;
+        AirflowNetworkCpTables = false;
+        PlantHalfLoopChangeDetection = false;
+        PlantComponentTimings = false;
+        AirLoopControllerSweeps = false;
+        ControllerWarmStart = false;
+        AirLoopComponentBypass = false;
+        UnitaryDirectPLR = false;
+        StratifiedTankImplicit = false;
+        GLHEMultiLevelAggregation = false;
+        KivaGroundCaching = false;
+        PipingSystemsSparseSolver = false;
+        PipingSystemsFlatCellArrays = false;
+        CondFDDirectSolve = false;
+        WindowNewtonSolve = false;
+        WindowAngularTables = false;
+        TARCOGResultMemo = false;
+        EQLWindowWarmStart = false;
+        DirectCsvOutput = false;
+        BatteryWarmStart = false;
+        SuppressEioOutput = false;
+        PerformanceReport = false;
+        DaylightingSkipUnlitZones = false;
+        HVACIterationReport = false;
         DetailedSkyDiffuseAlgorithm = false;
         DetailedSolarTimestepIntegration = false;
         TrackAirLoopEnvFlag = false;
@@ -387,6 +564,11 @@ namespace DataSystemVariables {
         UseScheduledSunlitFrac = false;
         ReportExtShadingSunlitFrac = false;
         UseImportedSunlitFrac = false;
+        ShadingCacheDirectory.clear();
+        WeatherCacheDirectory.clear();
+        GroundTempCacheDirectory.clear();
+        LiveOutputChannel.clear();
+        AirflowNetworkSparseSolver.clear();
         DisableGroupSelfShading = false;
         DisableAllSelfShading = false;
         Elapsed_Time = 0.0;
@@ -87,6 +87,48 @@ namespace DataSystemVariables {
     extern std::string const cIgnoreBeamRadiation;
     extern std::string const cIgnoreDiffuseRadiation;
     extern std::string const cSutherlandHodgman;
+    extern std::string const cPixelCountingShading;
+    extern std::string const cShadingCacheDirectory; // directory in which shading results are cached between runs
+    extern std::string const cWeatherCacheDirectory; // directory in which parsed weather file records are cached between runs
+    extern std::string const cGroundTempCacheDirectory; // directory in which finite difference ground temperatures are cached
+    extern std::string const cHourlyIlluminanceMaps;
+    extern std::string const cPsychrometricTables;
+    extern std::string const cPsychrometricCacheBits;
+    extern std::string const cAirflowNetworkSparseSolver; // LDLT or ConjugateGradient
+    extern std::string const cRefrigerantTableInversion;
+    extern std::string const cBinaryOutput;
+    extern std::string const cAsyncOutput;
+    extern std::string const cStreamTimeSeriesOutput;
+    extern std::string const cLiveOutputChannel; // name of the shared memory channel that time step values are published to
+    extern std::string const cAcceleratedWarmup;
+    extern std::string const cWarmupStateReuse;
+    extern std::string const cCompiledSchedules;
+    extern std::string const cDeduplicateSchedules;
+    extern std::string const cLongRunMode;
+    extern std::string const cAirflowNetworkJacobianReuse;
+    extern std::string const cAirflowNetworkCpTables;
+    extern std::string const cPlantHalfLoopChangeDetection;
+    extern std::string const cPlantComponentTimings;
+    extern std::string const cAirLoopControllerSweeps;
+    extern std::string const cControllerWarmStart;
+    extern std::string const cAirLoopComponentBypass;
+    extern std::string const cUnitaryDirectPLR;
+    extern std::string const cStratifiedTankImplicit;
+    extern std::string const cGLHEMultiLevelAggregation;
+    extern std::string const cKivaGroundCaching;
+    extern std::string const cPipingSystemsSparseSolver;
+    extern std::string const cPipingSystemsFlatCellArrays;
+    extern std::string const cCondFDDirectSolve;
+    extern std::string const cWindowNewtonSolve;
+    extern std::string const cWindowAngularTables;
+    extern std::string const cTARCOGResultMemo;
+    extern std::string const cEQLWindowWarmStart;
+    extern std::string const cDirectCsvOutput;
+    extern std::string const cBatteryWarmStart;
+    extern std::string const cSuppressEioOutput;
+    extern std::string const cPerformanceReport;
+    extern std::string const cDaylightingSkipUnlitZones;
+    extern std::string const cHVACIterationReport;
     extern std::string const cMinimalSurfaceVariables;
     extern std::string const cMinimalShadowing;
     extern std::string const cNumActiveSims;
@@ -103,6 +145,9 @@ namespace DataSystemVariables {
 
     extern std::string const MinReportFrequencyEnvVar;   // environment var for reporting frequency.
     extern std::string const cDisplayInputInAuditEnvVar; // environmental variable that enables the echoing of the input file into the audit file
+    extern std::string const ValidationCacheEnvVar;      // environment var naming a file that caches objects which passed input validation
+    extern std::string const cNumThreads;                // environment var for the number of threads
+    extern std::string const cepNumThreads;              // environment var for the number of threads, EnergyPlus only
 
     // DERIVED TYPE DEFINITIONS
     // na
@@ -118,6 +163,43 @@ namespace DataSystemVariables {
     extern bool DeveloperFlag;                    // TRUE if developer flag is turned on. (turns on more displays to console)
     extern bool TimingFlag;                       // TRUE if timing flag is turned on. (turns on more timing displays to console)
     extern bool SutherlandHodgman;                // TRUE if SutherlandHodgman algorithm for polygon clipping is to be used.
+    extern bool PixelCountingShading;             // TRUE if sunlit areas of surfaces without subsurfaces are found by grid counting
+    extern bool HourlyIlluminanceMaps;            // TRUE if illuminance maps are figured once per hour instead of every time step
+    extern bool PsychrometricTables;              // TRUE if psychrometric inversions may use checked interpolation tables
+    extern int PsychrometricCacheBits;            // log2 of the number of entries in each psychrometric cache
+    extern bool RefrigerantTableInversion;        // TRUE if superheated temperatures are found by inverting the enthalpy table
+    extern bool BinaryOutput;                     // TRUE if report variables and meters are also written to the binary output file
+    extern bool AsyncOutput;                      // TRUE if the eso, mtr and binary output files are written from a background thread
+    extern bool StreamTimeSeriesOutput;           // TRUE if the JSON/CBOR time series files are written row by row as the run proceeds
+    extern bool AcceleratedWarmup;                // TRUE if warmup surface histories are extrapolated toward their periodic state
+    extern bool WarmupStateReuse;                 // TRUE if a repeated design day starts from its converged warmup state
+    extern bool CompiledSchedules;                // TRUE if schedule values are only updated at the time steps where they change
+    extern bool DeduplicateSchedules;             // TRUE if schedules with identical values share one copy of their values
+    extern bool LongRunMode;                      // TRUE if long run periods batch their day boundary work
+    extern bool AirflowNetworkJacobianReuse;      // TRUE if AirflowNetwork reuses a factored Jacobian
+    extern bool AirflowNetworkCpTables;           // TRUE if wind pressure coefficients come from 1 deg tables
+    extern bool PlantHalfLoopChangeDetection;     // skip forced plant half-loop resimulation when its inputs are unchanged
+    extern bool PlantComponentTimings;            // TRUE if plant component simulation times are collected and written at end of run
+    extern bool AirLoopControllerSweeps;          // re-solve air loop controllers that lose convergence to later controllers
+    extern bool ControllerWarmStart;              // start controller root finding from the previous solution and sensitivity
+    extern bool AirLoopComponentBypass;           // skip passive air loop components whose nodes are unchanged
+    extern bool UnitaryDirectPLR;                 // solve single speed DX coil part load ratios in closed form first
+    extern bool StratifiedTankImplicit;           // Implicit full time step solve of stratified tank nodes
+    extern bool GLHEMultiLevelAggregation;        // TRUE to lump older monthly GLHE loads into blocks of doubling width
+    extern bool KivaGroundCaching;                // Reuse initialized Kiva ground temperatures stored in the .kiva file by earlier runs
+    extern bool PipingSystemsSparseSolver;        // Solve ground domain temperatures with a sparse factorization instead of sweeps
+    extern bool PipingSystemsFlatCellArrays;      // Sweep ground domain temperatures over flat neighbor index and coefficient arrays
+    extern bool CondFDDirectSolve;                // Solve linear CondFD surfaces with a direct tridiagonal solve
+    extern bool WindowNewtonSolve;                // Solve bare window face temperatures with Newton steps
+    extern bool WindowAngularTables;              // Look up window beam properties from angular tables
+    extern bool TARCOGResultMemo;                 // Reuse TARCOG solutions for repeated boundary conditions
+    extern bool EQLWindowWarmStart;               // Start equivalent-layer window solutions from the last one
+    extern bool DirectCsvOutput;                  // TRUE if the eso and mtr time series are also written as csv files during the run
+    extern bool BatteryWarmStart;                 // start the kinetic battery current iterations from the last converged current
+    extern bool SuppressEioOutput;                // send the initialization (eio) output to the null device
+    extern bool PerformanceReport;                // write <prefix>_performance.json at the end of a successful run
+    extern bool DaylightingSkipUnlitZones;        // skip daylighting in zones whose lights are scheduled off
+    extern bool HVACIterationReport;              // write <prefix>_hvaciterations.csv with the HVAC iteration counts and times
     extern bool DetailedSkyDiffuseAlgorithm;      // use detailed diffuse shading algorithm for sky (shading transmittance varies)
     extern bool DetailedSolarTimestepIntegration; // when true, use detailed timestep integration for all solar,shading, etc.
     extern bool TrackAirLoopEnvFlag;              // If TRUE generates a file with runtime statistics for each HVAC
@@ -133,6 +215,11 @@ namespace DataSystemVariables {
     extern bool UseScheduledSunlitFrac;                  // when true, the external shading calculation results will be exported
     extern bool ReportExtShadingSunlitFrac;              // when true, the sunlit fraction for all surfaces are exported as a csv format output
     extern bool UseImportedSunlitFrac;                   // when true, the sunlit fraction for all surfaces are imported altogether as a CSV file
+    extern std::string ShadingCacheDirectory;            // when not empty, beam shading results are cached in this directory
+    extern std::string WeatherCacheDirectory;            // when not empty, parsed weather file records are cached in this directory
+    extern std::string GroundTempCacheDirectory;         // when not empty, finite difference ground temperatures are cached in this directory
+    extern std::string LiveOutputChannel;                // when not empty, time step values are published to this shared memory channel
+    extern std::string AirflowNetworkSparseSolver;       // when not empty, the airflow network is solved with this sparse solver
 
     extern bool DisableGroupSelfShading; // when true, defined shadowing surfaces group is ignored when calculating sunlit fraction
     extern bool DisableAllSelfShading;   // when true, all external shadowing surfaces is ignored when calculating sunlit fraction
@@ -158,7 +245,7 @@ namespace DataSystemVariables {
     extern int inumActiveSims;
     extern bool lnumActiveSims;
     extern int MaxNumberOfThreads;
-    extern int NumberIntRadThreads;
+    extern int NumberIntRadThreads; // threads used by the threaded loops (see Parallel), 1 unless requested
     extern int iNominalTotSurfaces;
     extern bool Threading;
 
@@ -169,6 +256,8 @@ namespace DataSystemVariables {
                                 std::string &CheckedFileName              // Blank if not found.
     );
 
+    void InitializeThreading();
+
     // Needed for unit tests, should not be normally called.
     void clear_state();
 
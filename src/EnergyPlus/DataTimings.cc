@@ -45,6 +45,11 @@
 // OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+// C++ Headers
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/gio.hh>
 #include <ObjexxFCL/time.hh>
@@ -53,6 +58,7 @@
 #include <CommandLineInterface.hh>
 #include <DataErrorTracking.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
 #include <DataTimings.hh>
 #include <General.hh>
@@ -140,6 +146,8 @@ namespace DataTimings {
 
     // Object Data
     Array1D<timings> Timing;
+    std::vector<TimerScopeNode> TimerScopes;
+    int CurrentTimerScope(0);
 
     // Functions
 
@@ -616,6 +624,141 @@ namespace DataTimings {
         return calctime;
     }
 
+    // Clears the global data in DataTimings.
+    // Needed for unit tests, should not be normally called.
+    void clear_state()
+    {
+        TimerScopes.clear();
+        CurrentTimerScope = 0;
+    }
+
+    int findOrAddTimerScope(char const *Name)
+    {
+        // Find the child of the current timer scope called Name, adding it (and the root) when first seen
+        if (TimerScopes.empty()) {
+            TimerScopes.emplace_back();
+            TimerScopes[0].Name = "EnergyPlus";
+            TimerScopes[0].Start = std::chrono::steady_clock::now();
+            CurrentTimerScope = 0;
+        }
+
+        for (int Child : TimerScopes[CurrentTimerScope].Children) {
+            if (TimerScopes[Child].Name == Name || std::strcmp(TimerScopes[Child].Name, Name) == 0) {
+                return Child;
+            }
+        }
+        int const Node = static_cast<int>(TimerScopes.size());
+        TimerScopes.emplace_back();
+        TimerScopes[Node].Name = Name;
+        TimerScopes[Node].Parent = CurrentTimerScope;
+        TimerScopes[CurrentTimerScope].Children.push_back(Node);
+        return Node;
+    }
+
+    int epEnterTimerScope(char const *Name)
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Open the timer scope Name inside the current scope and return its node in the call tree.
+
+        // METHODOLOGY EMPLOYED:
+        // Children are looked up by name under the current node (a handful per node, so a linear search is
+        // cheaper than a map), and a new node is appended the first time a name is seen from a given caller.
+
+        int const Node = findOrAddTimerScope(Name);
+        CurrentTimerScope = Node;
+        TimerScopes[Node].Start = std::chrono::steady_clock::now();
+        return Node;
+    }
+
+    void epExitTimerScope(int const Node)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Close the timer scope opened by epEnterTimerScope and charge the elapsed time to its node.
+
+        // A clear_state between entry and exit (unit tests) leaves nothing to charge
+        if (Node >= static_cast<int>(TimerScopes.size())) return;
+
+        auto &Scope(TimerScopes[Node]);
+        Scope.Seconds += std::chrono::duration<Real64>(std::chrono::steady_clock::now() - Scope.Start).count();
+        ++Scope.Calls;
+        CurrentTimerScope = Scope.Parent;
+    }
+
+    void epAddTimerScopeTime(char const *Name, Real64 const Seconds)
+    {
+        // Charge time measured elsewhere (e.g. inside a threaded loop, where scopes cannot be opened) to the child
+        // Name of the current timer scope. Name must outlive the timer tree.
+        auto &Scope(TimerScopes[findOrAddTimerScope(Name)]);
+        Scope.Seconds += Seconds;
+        ++Scope.Calls;
+    }
+
+    void epWriteTimerScopes(std::ostream &os)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Write the timer scope call tree in the folded stack format read by flame graph tools: one line per node,
+        // the semicolon separated path from the root followed by the time spent in the node itself (excluding its
+        // children) in microseconds.
+
+        // METHODOLOGY EMPLOYED:
+        // Scopes still open (the root, or everything on the stack when called from a fatal error) are charged up to now.
+        // Children charged with epAddTimerScopeTime from a threaded loop can add up to more than their parent; the
+        // parent's self time is then reported as zero.
+        // Nodes are appended after their parent, so one pass in index order sees every parent path before its children.
+
+        if (TimerScopes.empty()) return;
+
+        auto const Now(std::chrono::steady_clock::now());
+        std::vector<Real64> Inclusive(TimerScopes.size());
+        for (std::size_t Node = 0; Node < TimerScopes.size(); ++Node) {
+            Inclusive[Node] = TimerScopes[Node].Seconds;
+        }
+        for (int Node = CurrentTimerScope; Node >= 0; Node = TimerScopes[Node].Parent) {
+            Inclusive[Node] += std::chrono::duration<Real64>(Now - TimerScopes[Node].Start).count();
+        }
+
+        std::vector<std::string> Path(TimerScopes.size());
+        for (std::size_t Node = 0; Node < TimerScopes.size(); ++Node) {
+            auto const &Scope(TimerScopes[Node]);
+            Path[Node] = (Scope.Parent < 0) ? std::string(Scope.Name) : Path[Scope.Parent] + ';' + Scope.Name;
+            Real64 Self = Inclusive[Node];
+            for (int Child : Scope.Children) {
+                Self -= Inclusive[Child];
+            }
+            os << Path[Node] << ' ' << static_cast<long long>(std::max(Self, 0.0) * 1.0e6 + 0.5) << '\n';
+        }
+    }
+
+    void epWriteTimerScopes()
+    {
+        // Write the timer scope call tree to the timers output file
+        if (TimerScopes.empty()) return;
+        std::ofstream os(DataStringGlobals::outputTimersFileName, std::ofstream::out | std::ofstream::trunc);
+        if (!os.good()) return;
+        epWriteTimerScopes(os);
+    }
+
 } // namespace DataTimings
 
 } // namespace EnergyPlus
@@ -48,6 +48,11 @@
 #ifndef DataTimings_hh_INCLUDED
 #define DataTimings_hh_INCLUDED
 
+// C++ Headers
+#include <chrono>
+#include <ostream>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -127,8 +132,26 @@ namespace DataTimings {
         }
     };
 
+    struct TimerScopeNode
+    {
+        // Members
+        char const *Name;                            // name given to EP_TIMER_SCOPE
+        int Parent;                                  // enclosing scope (-1 for the root)
+        std::vector<int> Children;                   // nested scopes, in order of first entry
+        std::chrono::steady_clock::time_point Start; // time of the current entry
+        Real64 Seconds;                              // inclusive elapsed time {s}
+        long Calls;                                  // number of completed entries
+
+        // Default Constructor
+        TimerScopeNode() : Name(""), Parent(-1), Seconds(0.0), Calls(0)
+        {
+        }
+    };
+
     // Object Data
     extern Array1D<timings> Timing;
+    extern std::vector<TimerScopeNode> TimerScopes; // call tree of EP_TIMER_SCOPE timers, index 0 is the root
+    extern int CurrentTimerScope;                   // innermost open scope
 
     // Functions
 
@@ -149,8 +172,50 @@ namespace DataTimings {
 
     Real64 epElapsedTime();
 
+    void clear_state();
+
+    int findOrAddTimerScope(char const *Name);
+
+    int epEnterTimerScope(char const *Name);
+
+    void epExitTimerScope(int Node);
+
+    void epAddTimerScopeTime(char const *Name, Real64 Seconds);
+
+    void epWriteTimerScopes(std::ostream &os);
+
+    void epWriteTimerScopes();
+
+    // Scoped timer for hot paths: the time spent between construction and destruction is charged to a node of the
+    // call tree keyed by the enclosing timer scopes, so the same routine reached from different callers is reported separately.
+    class TimerScope
+    {
+    public:
+        explicit TimerScope(char const *Name) : Node(epEnterTimerScope(Name))
+        {
+        }
+
+        ~TimerScope()
+        {
+            epExitTimerScope(Node);
+        }
+
+        TimerScope(TimerScope const &) = delete;
+        TimerScope &operator=(TimerScope const &) = delete;
+
+    private:
+        int Node;
+    };
+
 } // namespace DataTimings
 
 } // namespace EnergyPlus
 
+// EP_TIMER_SCOPE(name) times the rest of the enclosing block; it compiles away unless EP_Detailed_Timings is defined
+#ifdef EP_Detailed_Timings
+#define EP_TIMER_SCOPE(name) EnergyPlus::DataTimings::TimerScope epTimerScope_(name)
+#else
+#define EP_TIMER_SCOPE(name)
+#endif
+
 #endif
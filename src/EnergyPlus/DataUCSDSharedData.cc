@@ -110,6 +110,9 @@ namespace DataUCSDSharedData {
     Array1D<Real64> HInternal;
     Array1D<Real64> HWindow;
     Array1D<Real64> HDoor;
+    // Lowest and highest vertex heights of the non internal mass surfaces, fixed after input
+    Array1D<Real64> SurfMinZ;
+    Array1D<Real64> SurfMaxZ;
 
     // Clears the global data in DataAirLoop.
     // Needed for unit tests, should not be normally called.
@@ -133,6 +136,8 @@ namespace DataUCSDSharedData {
         HInternal.deallocate();
         HWindow.deallocate();
         HDoor.deallocate();
+        SurfMinZ.deallocate();
+        SurfMaxZ.deallocate();
     }
 
 } // namespace DataUCSDSharedData
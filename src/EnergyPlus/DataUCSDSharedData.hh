@@ -89,6 +89,9 @@ namespace DataUCSDSharedData {
     extern Array1D<Real64> HInternal;
     extern Array1D<Real64> HWindow;
     extern Array1D<Real64> HDoor;
+    // Lowest and highest vertex heights of the non internal mass surfaces, fixed after input
+    extern Array1D<Real64> SurfMinZ;
+    extern Array1D<Real64> SurfMaxZ;
 
     void clear_state();
 
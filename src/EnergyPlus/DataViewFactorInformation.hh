@@ -84,6 +84,7 @@ namespace DataViewFactorInformation {
         Array1D<Real64> Azimuth;    // Azimuth angle of the surface (in degrees)
         Array1D<Real64> Tilt;       // Tilt angle of the surface (in degrees)
         Array1D_int SurfacePtr;     // Surface ALLOCATABLE (to Surface derived type)
+        Array1D<Real64> SurfaceTempInKTo4th; // Inside surface temperatures in K to the 4th power, in SurfacePtr order
         Array1D_string Class;       // Class of surface (Wall, Roof, etc.)
 
         // Default Constructor
@@ -49,7 +49,10 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -62,6 +65,9 @@
 #include <ObjexxFCL/random.hh>
 #include <ObjexxFCL/string.functions.hh>
 
+// Eigen Headers
+#include <Eigen/Core>
+
 // EnergyPlus Headers
 #include <CommandLineInterface.hh>
 #include <DElightManagerF.hh>
@@ -80,6 +86,7 @@
 #include <DaylightingDevices.hh>
 #include <DaylightingManager.hh>
 #include <DisplayRoutines.hh>
+#include <FileSystem.hh>
 #include <General.hh>
 #include <InputProcessing/InputProcessor.hh>
 #include <InternalHeatGains.hh>
@@ -186,42 +193,44 @@ namespace DaylightingManager {
     //  experience is gained.
     int const octreeCrossover(100); // Octree surface count crossover
 
+    int const DaylightingCacheVersion(1); // Layout version of the daylighting cache files
+
     // MODULE VARIABLE DECLARATIONS:
-    int TotWindowsWithDayl(0);         // Total number of exterior windows in all daylit zones
-    int OutputFileDFS(0);              // Unit number for daylight factors
-    Array1D<Real64> DaylIllum;         // Daylight illuminance at reference points (lux)
-    int maxNumRefPtInAnyZone(0);       // The most number of reference points that any single zone has
-    Real64 PHSUN(0.0);                 // Solar altitude (radians)
-    Real64 SPHSUN(0.0);                // Sine of solar altitude
-    Real64 CPHSUN(0.0);                // Cosine of solar altitude
-    Real64 THSUN(0.0);                 // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
-    Array1D<Real64> PHSUNHR(24, 0.0);  // Hourly values of PHSUN
-    Array1D<Real64> SPHSUNHR(24, 0.0); // Hourly values of the sine of PHSUN
-    Array1D<Real64> CPHSUNHR(24, 0.0); // Hourly values of the cosine of PHSUN
-    Array1D<Real64> THSUNHR(24, 0.0);  // Hourly values of THSUN
+    int TotWindowsWithDayl(0);                // Total number of exterior windows in all daylit zones
+    int OutputFileDFS(0);                     // Unit number for daylight factors
+    Array1D<Real64> DaylIllum;                // Daylight illuminance at reference points (lux)
+    int maxNumRefPtInAnyZone(0);              // The most number of reference points that any single zone has
+    EP_DAYLT_THREAD_LOCAL Real64 PHSUN(0.0);  // Solar altitude (radians)
+    EP_DAYLT_THREAD_LOCAL Real64 SPHSUN(0.0); // Sine of solar altitude
+    EP_DAYLT_THREAD_LOCAL Real64 CPHSUN(0.0); // Cosine of solar altitude
+    EP_DAYLT_THREAD_LOCAL Real64 THSUN(0.0);  // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
+    Array1D<Real64> PHSUNHR(24, 0.0);         // Hourly values of PHSUN
+    Array1D<Real64> SPHSUNHR(24, 0.0);        // Hourly values of the sine of PHSUN
+    Array1D<Real64> CPHSUNHR(24, 0.0);        // Hourly values of the cosine of PHSUN
+    Array1D<Real64> THSUNHR(24, 0.0);         // Hourly values of THSUN
 
     // In the following I,J,K arrays:
     // I = 1 for clear sky, 2 for clear turbid, 3 for intermediate, 4 for overcast;
     // J = 1 for bare window, 2 - 12 for shaded;
     // K = sun position index.
-    Array3D<Real64> EINTSK(24, MaxSlatAngs + 1, 4, 0.0); // Sky-related portion of internally reflected illuminance
-    Array2D<Real64> EINTSU(24, MaxSlatAngs + 1, 0.0);    // Sun-related portion of internally reflected illuminance,
+    EP_DAYLT_THREAD_LOCAL Array3D<Real64> EINTSK(24, MaxSlatAngs + 1, 4, 0.0); // Sky-related portion of internally reflected illuminance
+    EP_DAYLT_THREAD_LOCAL Array2D<Real64> EINTSU(24, MaxSlatAngs + 1, 0.0);    // Sun-related portion of internally reflected illuminance,
     // excluding entering beam
-    Array2D<Real64> EINTSUdisk(24, MaxSlatAngs + 1, 0.0); // Sun-related portion of internally reflected illuminance
+    EP_DAYLT_THREAD_LOCAL Array2D<Real64> EINTSUdisk(24, MaxSlatAngs + 1, 0.0); // Sun-related portion of internally reflected illuminance
     // due to entering beam
-    Array3D<Real64> WLUMSK(24, MaxSlatAngs + 1, 4, 0.0);  // Sky-related window luminance
-    Array2D<Real64> WLUMSU(24, MaxSlatAngs + 1, 0.0);     // Sun-related window luminance, excluding view of solar disk
-    Array2D<Real64> WLUMSUdisk(24, MaxSlatAngs + 1, 0.0); // Sun-related window luminance, due to view of solar disk
+    EP_DAYLT_THREAD_LOCAL Array3D<Real64> WLUMSK(24, MaxSlatAngs + 1, 4, 0.0);  // Sky-related window luminance
+    EP_DAYLT_THREAD_LOCAL Array2D<Real64> WLUMSU(24, MaxSlatAngs + 1, 0.0);     // Sun-related window luminance, excluding view of solar disk
+    EP_DAYLT_THREAD_LOCAL Array2D<Real64> WLUMSUdisk(24, MaxSlatAngs + 1, 0.0); // Sun-related window luminance, due to view of solar disk
 
     Array2D<Real64> GILSK(24, 4, 0.0); // Horizontal illuminance from sky, by sky type, for each hour of the day
     Array1D<Real64> GILSU(24, 0.0);    // Horizontal illuminance from sun for each hour of the day
 
-    Array3D<Real64> EDIRSK(24, MaxSlatAngs + 1, 4);  // Sky-related component of direct illuminance
-    Array2D<Real64> EDIRSU(24, MaxSlatAngs + 1);     // Sun-related component of direct illuminance (excluding beam solar at ref pt)
-    Array2D<Real64> EDIRSUdisk(24, MaxSlatAngs + 1); // Sun-related component of direct illuminance due to beam solar at ref pt
-    Array3D<Real64> AVWLSK(24, MaxSlatAngs + 1, 4);  // Sky-related average window luminance
-    Array2D<Real64> AVWLSU(24, MaxSlatAngs + 1);     // Sun-related average window luminance, excluding view of solar disk
-    Array2D<Real64> AVWLSUdisk(24, MaxSlatAngs + 1); // Sun-related average window luminance due to view of solar disk
+    EP_DAYLT_THREAD_LOCAL Array3D<Real64> EDIRSK(24, MaxSlatAngs + 1, 4);  // Sky-related component of direct illuminance
+    EP_DAYLT_THREAD_LOCAL Array2D<Real64> EDIRSU(24, MaxSlatAngs + 1);     // Sun-related component of direct illuminance (excluding beam solar at ref pt)
+    EP_DAYLT_THREAD_LOCAL Array2D<Real64> EDIRSUdisk(24, MaxSlatAngs + 1); // Sun-related component of direct illuminance due to beam solar at ref pt
+    EP_DAYLT_THREAD_LOCAL Array3D<Real64> AVWLSK(24, MaxSlatAngs + 1, 4);  // Sky-related average window luminance
+    EP_DAYLT_THREAD_LOCAL Array2D<Real64> AVWLSU(24, MaxSlatAngs + 1);     // Sun-related average window luminance, excluding view of solar disk
+    EP_DAYLT_THREAD_LOCAL Array2D<Real64> AVWLSUdisk(24, MaxSlatAngs + 1); // Sun-related average window luminance due to view of solar disk
 
     // Allocatable daylight factor arrays  -- are in the ZoneDaylight Structure
 
@@ -236,6 +245,13 @@ namespace DaylightingManager {
 
     std::string mapLine; // character variable to hold map outputs
 
+    namespace {
+        // These are purposefully not in the header file as an extern variable. No one outside of this module should
+        // use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+        std::vector<std::vector<int>> ZoneLightsNums;   // Lights objects of each zone, for DayltgZoneLightsAreOff
+        std::vector<bool> ZoneHasControlledDaylWindows; // true when a daylighting window of the zone has shading control
+    } // namespace
+
     // SUBROUTINE SPECIFICATIONS FOR MODULE DaylightingModule
 
     // MODULE SUBROUTINES:
@@ -281,6 +297,8 @@ namespace DaylightingManager {
         RefErrIndex.deallocate();
         CheckTDDZone.deallocate();
         mapLine = "";
+        ZoneLightsNums.clear();
+        ZoneHasControlledDaylWindows.clear();
     }
 
     void DayltgAveInteriorReflectance(int &ZoneNum) // Zone number
@@ -728,18 +746,23 @@ namespace DaylightingManager {
         // ---------- ZONE LOOP ----------
         //           -----------
 
-        for (ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum) {
-            // Skip zones that are not Daylighting:Detailed zones.
-            // TotalDaylRefPoints = 0 means zone has (1) no daylighting or
-            // (3) Daylighting:DElight
-            if (ZoneDaylight(ZoneNum).TotalDaylRefPoints == 0 || ZoneDaylight(ZoneNum).DaylightMethod != SplitFluxDaylighting) continue;
+        // Factors figured by an earlier run with the same inputs are loaded from the daylighting cache instead
+        std::string const CacheFileName(DaylightingCacheFileName());
+        if (CacheFileName.empty() || !ReadDaylightingCache(CacheFileName)) {
+            for (ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum) {
+                // Skip zones that are not Daylighting:Detailed zones.
+                // TotalDaylRefPoints = 0 means zone has (1) no daylighting or
+                // (3) Daylighting:DElight
+                if (ZoneDaylight(ZoneNum).TotalDaylRefPoints == 0 || ZoneDaylight(ZoneNum).DaylightMethod != SplitFluxDaylighting) continue;
 
-            // Skip zones with no exterior windows in the zone or in adjacent zone with which an interior window is shared
-            if (ZoneDaylight(ZoneNum).NumOfDayltgExtWins == 0) continue;
+                // Skip zones with no exterior windows in the zone or in adjacent zone with which an interior window is shared
+                if (ZoneDaylight(ZoneNum).NumOfDayltgExtWins == 0) continue;
 
-            CalcDayltgCoeffsRefMapPoints(ZoneNum);
+                CalcDayltgCoeffsRefMapPoints(ZoneNum);
 
-        } // End of zone loop, ZoneNum
+            } // End of zone loop, ZoneNum
+            if (!CacheFileName.empty()) WriteDaylightingCache(CacheFileName);
+        }
 
         if (doSkyReporting) {
             if (!KickOffSizing && !KickOffSimulation) {
@@ -999,6 +1022,274 @@ namespace DaylightingManager {
         }
     }
 
+    namespace {
+        bool cachedDayltgZone(int const ZoneNum)
+        {
+            // Same zone selection as the zone loop of CalcDayltgCoefficients
+            return ZoneDaylight(ZoneNum).TotalDaylRefPoints > 0 && ZoneDaylight(ZoneNum).DaylightMethod == SplitFluxDaylighting &&
+                   ZoneDaylight(ZoneNum).NumOfDayltgExtWins > 0;
+        }
+
+        bool cachedDayltgMaps()
+        {
+            // CalcDayltgCoeffsRefMapPoints only figures the map points outside of sizing
+            return !DoingSizing && !KickOffSimulation;
+        }
+
+        // The daylighting cache files are the raw memory of these arrays and values, in this order
+        FileSystem::CacheBlocks daylightingCacheBlocks()
+        {
+            using FileSystem::addCacheArray;
+            using FileSystem::addCacheValue;
+
+            FileSystem::CacheBlocks Blocks;
+            for (int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum) {
+                if (!cachedDayltgZone(ZoneNum)) continue;
+                auto &zoneDaylight(ZoneDaylight(ZoneNum));
+                addCacheArray(Blocks, zoneDaylight.SolidAngAtRefPt);
+                addCacheArray(Blocks, zoneDaylight.SolidAngAtRefPtWtd);
+                addCacheArray(Blocks, zoneDaylight.DaylIllFacSky);
+                addCacheArray(Blocks, zoneDaylight.DaylSourceFacSky);
+                addCacheArray(Blocks, zoneDaylight.DaylBackFacSky);
+                addCacheArray(Blocks, zoneDaylight.DaylIllFacSun);
+                addCacheArray(Blocks, zoneDaylight.DaylIllFacSunDisk);
+                addCacheArray(Blocks, zoneDaylight.DaylSourceFacSun);
+                addCacheArray(Blocks, zoneDaylight.DaylSourceFacSunDisk);
+                addCacheArray(Blocks, zoneDaylight.DaylBackFacSun);
+                addCacheArray(Blocks, zoneDaylight.DaylBackFacSunDisk);
+                for (int loopwin = 1; loopwin <= zoneDaylight.NumOfDayltgExtWins; ++loopwin) {
+                    auto &surfaceWindow(SurfaceWindow(zoneDaylight.DayltgExtWinSurfNums(loopwin)));
+                    addCacheArray(Blocks, surfaceWindow.SolidAngAtRefPt);
+                    addCacheArray(Blocks, surfaceWindow.SolidAngAtRefPtWtd);
+                    addCacheArray(Blocks, surfaceWindow.WinCenter);
+                    addCacheValue(Blocks, surfaceWindow.VisTransSelected);
+                    addCacheValue(Blocks, surfaceWindow.VisTransRatio);
+                    addCacheValue(Blocks, surfaceWindow.Theta);
+                    addCacheValue(Blocks, surfaceWindow.Phi);
+                }
+                if (!cachedDayltgMaps()) continue;
+                for (int MapNum = 1; MapNum <= TotIllumMaps; ++MapNum) {
+                    auto &illumMapCalc(IllumMapCalc(MapNum));
+                    if (illumMapCalc.Zone != ZoneNum) continue;
+                    addCacheArray(Blocks, illumMapCalc.SolidAngAtMapPt);
+                    addCacheArray(Blocks, illumMapCalc.SolidAngAtMapPtWtd);
+                    addCacheArray(Blocks, illumMapCalc.DaylIllFacSky);
+                    addCacheArray(Blocks, illumMapCalc.DaylSourceFacSky);
+                    addCacheArray(Blocks, illumMapCalc.DaylBackFacSky);
+                    addCacheArray(Blocks, illumMapCalc.DaylIllFacSun);
+                    addCacheArray(Blocks, illumMapCalc.DaylIllFacSunDisk);
+                    addCacheArray(Blocks, illumMapCalc.DaylSourceFacSun);
+                    addCacheArray(Blocks, illumMapCalc.DaylSourceFacSunDisk);
+                    addCacheArray(Blocks, illumMapCalc.DaylBackFacSun);
+                    addCacheArray(Blocks, illumMapCalc.DaylBackFacSunDisk);
+                }
+            }
+            return Blocks;
+        }
+    } // namespace
+
+    std::string DaylightingCacheFileName()
+    {
+
+        // FUNCTION INFORMATION:
+        //       DATE WRITTEN   October 2026
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns the daylighting cache file for the current daylight factor calculation, named by a hash of
+        // everything the factors depend on: the hourly sun positions, surface geometry and window, blind and
+        // light shelf properties, reference and map points, interior reflectances and ground reflectance.
+        // Returns an empty string when the daylit zones have windows whose calculation updates data the
+        // cache does not hold (complex fenestration, tubular daylighting devices and screens) or when the
+        // factors are figured hour by hour for timestep integration.
+
+        using DataSystemVariables::DetailedSolarTimestepIntegration;
+        using DataSystemVariables::ShadingCacheDirectory;
+
+        if (DetailedSolarTimestepIntegration || ShadingCacheDirectory.empty()) return std::string();
+        for (int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum) {
+            if (cachedDayltgZone(ZoneNum) && !MapPointsCanBeThreaded(ZoneNum)) return std::string();
+        }
+
+        // Hash of the bytes of the inputs
+        std::uint64_t Hash(FileSystem::hashBasis);
+        auto hashBytes = [&Hash](void const *Bytes, std::size_t const NumBytes) { Hash = FileSystem::hashBytes(Bytes, NumBytes, Hash); };
+        auto hashReal = [&hashBytes](Real64 const Value) { hashBytes(&Value, sizeof(Value)); };
+        auto hashInt = [&hashBytes](int const Value) { hashBytes(&Value, sizeof(Value)); };
+        auto hashReals = [&hashBytes](ObjexxFCL::Array<Real64> const &Values) { hashBytes(Values.data(), Values.size() * sizeof(Real64)); };
+        auto hashInts = [&hashBytes](ObjexxFCL::Array<int> const &Values) { hashBytes(Values.data(), Values.size() * sizeof(int)); };
+
+        hashInt(DaylightingCacheVersion);
+        hashInt(cachedDayltgMaps());
+        hashReals(SUNCOSHR);
+        hashReals(GILSK);
+        hashReals(GILSU);
+        hashReal(GndReflectanceForDayltg);
+        hashInt(CalcSolRefl);
+        hashReal(BuildingAzimuth);
+        hashReal(BuildingRotationAppendixG);
+        hashInt(TotSurfaces);
+        for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+            auto const &surface(Surface(SurfNum));
+            hashInt(surface.Sides);
+            for (int N = 1; N <= surface.Sides; ++N) {
+                hashReal(surface.Vertex(N).x);
+                hashReal(surface.Vertex(N).y);
+                hashReal(surface.Vertex(N).z);
+            }
+            hashInt(surface.Class);
+            hashInt(surface.Zone);
+            hashInt(surface.BaseSurf);
+            hashInt(surface.ExtBoundCond);
+            hashInt(surface.HeatTransSurf);
+            hashInt(surface.ShadowingSurf);
+            hashInt(surface.Construction);
+            hashInt(surface.ShadedConstruction);
+            hashInt(surface.StormWinConstruction);
+            hashInt(surface.StormWinShadedConstruction);
+            hashInt(surface.HasShadeControl);
+            hashInt(surface.WindowShadingControlPtr);
+            if (surface.HasShadeControl) hashInt(WindowShadingControl(surface.WindowShadingControlPtr).ShadingType);
+            hashReal(surface.Area);
+            hashReal(surface.Multiplier);
+            hashReal(surface.ViewFactorSky);
+            hashInt(surface.ShadowSurfPossibleObstruction);
+            hashReal(surface.ShadowSurfDiffuseVisRefl);
+            hashReal(surface.ShadowSurfGlazingFrac);
+            hashInt(surface.ShadowSurfGlazingConstruct);
+            if (surface.SchedShadowSurfIndex > 0) {
+                for (int IHR = 1; IHR <= 24; ++IHR) {
+                    hashReal(LookUpScheduleValue(surface.SchedShadowSurfIndex, IHR, 1));
+                }
+            }
+            if (surface.Shelf > 0) {
+                auto const &shelf(Shelf(surface.Shelf));
+                hashInt(shelf.InSurf);
+                hashInt(shelf.OutSurf);
+                hashReal(shelf.OutReflectVis);
+                hashReal(shelf.ViewFactor);
+            }
+            if (surface.Class == SurfaceClass_Window) {
+                auto const &surfaceWindow(SurfaceWindow(SurfNum));
+                hashInt(surfaceWindow.StormWinFlag);
+                hashInt(surfaceWindow.BlindNumber);
+                hashInt(surfaceWindow.MovableSlats);
+                hashInt(surfaceWindow.SolarDiffusing);
+                hashReal(surfaceWindow.GlazedFrac);
+                hashReal(surfaceWindow.DividerArea);
+                hashReal(surfaceWindow.LightWellEff);
+                hashReal(surfaceWindow.RhoCeilingWall);
+                hashReal(surfaceWindow.RhoFloorWall);
+                hashReal(surfaceWindow.FractionUpgoing);
+            }
+        }
+        for (int ConstrNum = 1; ConstrNum <= TotConstructs; ++ConstrNum) {
+            auto const &construct(Construct(ConstrNum));
+            hashInt(construct.TypeIsWindow);
+            if (!construct.TypeIsWindow) continue;
+            hashInt(construct.TotGlassLayers);
+            hashInts(construct.LayerPoint);
+            hashInt(construct.TCFlag);
+            hashInt(construct.TCMasterConst);
+            hashReal(construct.TransDiffVis);
+            hashReal(construct.ReflectVisDiffBack);
+            hashReal(construct.ReflectVisDiffFront);
+            hashReals(construct.TransVisBeamCoef);
+            hashReals(construct.ReflSolBeamFrontCoef);
+            hashReals(construct.tBareVisCoef);
+            hashReals(construct.tBareVisDiff);
+            hashReals(construct.rfBareVisDiff);
+            hashReals(construct.rbBareVisDiff);
+        }
+        for (int BlNum = 1; BlNum <= TotBlinds; ++BlNum) {
+            auto const &blind(Blind(BlNum));
+            hashInt(blind.SlatOrientation);
+            hashReal(blind.SlatWidth);
+            hashReal(blind.SlatSeparation);
+            hashReal(blind.SlatThickness);
+            hashReal(blind.SlatAngle);
+            hashReals(blind.VisFrontBeamDiffTrans);
+            hashReals(blind.VisFrontBeamDiffRefl);
+            hashReals(blind.VisFrontDiffDiffTrans);
+            hashReals(blind.VisFrontDiffDiffRefl);
+            hashReals(blind.VisBackDiffDiffRefl);
+        }
+        hashInt(NumOfZones);
+        for (int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum) {
+            auto const &zoneDaylight(ZoneDaylight(ZoneNum));
+            hashInt(cachedDayltgZone(ZoneNum));
+            if (!cachedDayltgZone(ZoneNum)) continue;
+            hashReals(zoneDaylight.DaylRefPtAbsCoord);
+            hashInts(zoneDaylight.DayltgExtWinSurfNums);
+            hashReal(zoneDaylight.ViewAzimuthForGlare);
+            hashReal(zoneDaylight.AveVisDiffReflect);
+            hashReal(zoneDaylight.TotInsSurfArea);
+            hashReal(zoneDaylight.FloorVisRefl);
+            hashReal(zoneDaylight.MinIntWinSolidAng);
+            hashReal(Zone(ZoneNum).RelNorth);
+        }
+        hashInt(TotIllumMaps);
+        for (int MapNum = 1; MapNum <= TotIllumMaps; ++MapNum) {
+            hashInt(IllumMapCalc(MapNum).Zone);
+            hashReals(IllumMapCalc(MapNum).MapRefPtAbsCoord);
+        }
+
+        return ShadingCacheDirectory + DataStringGlobals::pathChar + FileSystem::hashToHex(Hash) + ".dlcache";
+    }
+
+    bool ReadDaylightingCache(std::string const &FileName)
+    {
+
+        // FUNCTION INFORMATION:
+        //       DATE WRITTEN   October 2026
+
+        // PURPOSE OF THIS FUNCTION:
+        // Loads the daylight factors written by WriteDaylightingCache and resets the illuminance and glare values
+        // the way CalcDayltgCoeffsRefMapPoints does.  Returns false, leaving the factors to be calculated, when
+        // the file is missing or does not match the current model dimensions.
+
+        bool SizeMismatch(false);
+        if (!FileSystem::readCacheFile(FileName, {DaylightingCacheVersion, TotSurfaces, NumOfZones, TotIllumMaps}, daylightingCacheBlocks(), SizeMismatch)) {
+            if (SizeMismatch) {
+                ShowWarningError("ReadDaylightingCache: " + FileName + " does not match this model, daylight factors will be calculated.");
+            }
+            return false;
+        }
+
+        for (int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum) {
+            if (!cachedDayltgZone(ZoneNum)) continue;
+            ZoneDaylight(ZoneNum).DaylIllumAtRefPt = 0.0;
+            ZoneDaylight(ZoneNum).GlareIndexAtRefPt = 0.0;
+            ZoneDaylight(ZoneNum).IllumFromWinAtRefPt = 0.0;
+            ZoneDaylight(ZoneNum).BackLumFromWinAtRefPt = 0.0;
+            ZoneDaylight(ZoneNum).SourceLumFromWinAtRefPt = 0.0;
+            if (!cachedDayltgMaps()) continue;
+            for (int MapNum = 1; MapNum <= TotIllumMaps; ++MapNum) {
+                if (IllumMapCalc(MapNum).Zone != ZoneNum) continue;
+                IllumMapCalc(MapNum).DaylIllumAtMapPt = 0.0;
+                IllumMapCalc(MapNum).GlareIndexAtMapPt = 0.0;
+                IllumMapCalc(MapNum).IllumFromWinAtMapPt = 0.0;
+                IllumMapCalc(MapNum).BackLumFromWinAtMapPt = 0.0;
+                IllumMapCalc(MapNum).SourceLumFromWinAtMapPt = 0.0;
+            }
+        }
+        return true;
+    }
+
+    void WriteDaylightingCache(std::string const &FileName)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Stores the daylight factors of the daylit zones for ReadDaylightingCache.  Like the shading cache the
+        // arrays are written in their own memory layout, so a file is only meant for the same build and platform.
+
+        if (!FileSystem::writeCacheFile(FileName, {DaylightingCacheVersion, TotSurfaces, NumOfZones, TotIllumMaps}, daylightingCacheBlocks())) {
+            ShowWarningError("WriteDaylightingCache: could not write " + FileName + ", daylight factors will not be cached.");
+        }
+    }
+
     void CalcDayltgCoeffsRefPoints(int const ZoneNum)
     {
 
@@ -1414,6 +1705,141 @@ namespace DaylightingManager {
         // REFERENCES:
         // na
 
+        // Using/Aliasing
+        using DataSystemVariables::DetailedSolarTimestepIntegration;
+        using DataSystemVariables::NumberIntRadThreads;
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+        static Vector3<Real64> VIEWVC; // View vector in absolute coordinate system
+        int NRF;                       // Number of daylighting reference points in a zone
+        int IL;                        // Reference point counter
+        Real64 AZVIEW;                 // Azimuth of view vector in absolute coord system for
+        //  glare calculation (radians)
+        int MapNum; // Loop for map number
+
+        if (mapFirstTime && TotIllumMaps > 0) {
+            IL = -999;
+            for (MapNum = 1; MapNum <= TotIllumMaps; ++MapNum) {
+                IL = max(IL, IllumMapCalc(MapNum).TotalMapRefPoints);
+            }
+            MapErrIndex.dimension(IL, TotSurfaces, 0);
+            mapFirstTime = false;
+        }
+
+        // Azimuth of view vector in absolute coord sys
+        AZVIEW = (ZoneDaylight(ZoneNum).ViewAzimuthForGlare + Zone(ZoneNum).RelNorth + BuildingAzimuth + BuildingRotationAppendixG) * DegToRadians;
+        // View vector components in absolute coord sys
+        VIEWVC(1) = std::sin(AZVIEW);
+        VIEWVC(2) = std::cos(AZVIEW);
+        VIEWVC(3) = 0.0;
+
+        for (MapNum = 1; MapNum <= TotIllumMaps; ++MapNum) {
+
+            if (IllumMapCalc(MapNum).Zone != ZoneNum) continue;
+
+            IllumMapCalc(MapNum).DaylIllumAtMapPt = 0.0;  // Daylight illuminance at reference points (lux)
+            IllumMapCalc(MapNum).GlareIndexAtMapPt = 0.0; // Glare index at reference points
+            IllumMapCalc(MapNum).SolidAngAtMapPt = 0.0;
+            IllumMapCalc(MapNum).SolidAngAtMapPtWtd = 0.0;
+            IllumMapCalc(MapNum).IllumFromWinAtMapPt = 0.0;
+            IllumMapCalc(MapNum).BackLumFromWinAtMapPt = 0.0;
+            IllumMapCalc(MapNum).SourceLumFromWinAtMapPt = 0.0;
+            if (!DetailedSolarTimestepIntegration) {
+                IllumMapCalc(MapNum).DaylIllFacSky = 0.0;
+                IllumMapCalc(MapNum).DaylSourceFacSky = 0.0;
+                IllumMapCalc(MapNum).DaylBackFacSky = 0.0;
+                IllumMapCalc(MapNum).DaylIllFacSun = 0.0;
+                IllumMapCalc(MapNum).DaylIllFacSunDisk = 0.0;
+                IllumMapCalc(MapNum).DaylSourceFacSun = 0.0;
+                IllumMapCalc(MapNum).DaylSourceFacSunDisk = 0.0;
+                IllumMapCalc(MapNum).DaylBackFacSun = 0.0;
+                IllumMapCalc(MapNum).DaylBackFacSunDisk = 0.0;
+            } else {
+                IllumMapCalc(MapNum).DaylIllFacSky(
+                    HourOfDay, {1, MaxSlatAngs + 1}, {1, 4}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
+                IllumMapCalc(MapNum).DaylSourceFacSky(
+                    HourOfDay, {1, MaxSlatAngs + 1}, {1, 4}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
+                IllumMapCalc(MapNum).DaylBackFacSky(
+                    HourOfDay, {1, MaxSlatAngs + 1}, {1, 4}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
+                IllumMapCalc(MapNum).DaylIllFacSun(
+                    HourOfDay, {1, MaxSlatAngs + 1}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
+                IllumMapCalc(MapNum).DaylIllFacSunDisk(
+                    HourOfDay, {1, MaxSlatAngs + 1}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
+                IllumMapCalc(MapNum).DaylSourceFacSun(
+                    HourOfDay, {1, MaxSlatAngs + 1}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
+                IllumMapCalc(MapNum).DaylSourceFacSunDisk(
+                    HourOfDay, {1, MaxSlatAngs + 1}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
+                IllumMapCalc(MapNum).DaylBackFacSun(
+                    HourOfDay, {1, MaxSlatAngs + 1}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
+                IllumMapCalc(MapNum).DaylBackFacSunDisk(
+                    HourOfDay, {1, MaxSlatAngs + 1}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
+            }
+            NRF = IllumMapCalc(MapNum).TotalMapRefPoints;
+
+#ifdef _OPENMP
+            // The map points only write their own slices of the map daylight factors, so with the daylight factor work
+            // buffers thread local they can be spread over threads.  Windows whose calculation writes shared state for
+            // each point (complex fenestration, tubular devices and screens) keep the map serial, as does the detailed
+            // time step integration that only figures the current hour.
+            bool const ThreadedMapPoints(NumberIntRadThreads > 1 && NRF > 1 && !DetailedSolarTimestepIntegration &&
+                                         MapPointsCanBeThreaded(ZoneNum));
+            if (ThreadedMapPoints) {
+#pragma omp parallel for num_threads(NumberIntRadThreads) schedule(dynamic)
+                for (int ILThread = 1; ILThread <= NRF; ++ILThread) {
+                    FigureDayltgCoeffsAtMapPoint(ZoneNum, MapNum, ILThread, VIEWVC, AZVIEW);
+                }
+            }
+#else
+            bool const ThreadedMapPoints(false);
+#endif
+            if (!ThreadedMapPoints) {
+                for (IL = 1; IL <= NRF; ++IL) {
+                    FigureDayltgCoeffsAtMapPoint(ZoneNum, MapNum, IL, VIEWVC, AZVIEW);
+                }
+            }
+
+        } // MapNum
+    }
+
+    bool MapPointsCanBeThreaded(int const ZoneNum)
+    {
+
+        // FUNCTION INFORMATION:
+        //       DATE WRITTEN   October 2026
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns true when none of the daylighting windows of a zone needs the per point calculations that update
+        // shared window data: complex fenestration daylighting geometry, tubular daylighting device fluxes and the
+        // screen transmittance that CalcScreenTransmittance stores on the screen.
+
+        for (int loopwin = 1; loopwin <= ZoneDaylight(ZoneNum).NumOfDayltgExtWins; ++loopwin) {
+            int const IWin(ZoneDaylight(ZoneNum).DayltgExtWinSurfNums(loopwin));
+            if (SurfaceWindow(IWin).WindowModelType == WindowBSDFModel) return false;
+            if (SurfaceWindow(IWin).OriginalClass == SurfaceClass_TDD_Diffuser) return false;
+            if (SurfaceWindow(IWin).ScreenNumber > 0) return false;
+            int const ICtrl(Surface(IWin).WindowShadingControlPtr);
+            if (Surface(IWin).HasShadeControl && WindowShadingControl(ICtrl).ShadingType == WSC_ST_ExteriorScreen) return false;
+        }
+        return true;
+    }
+
+    void FigureDayltgCoeffsAtMapPoint(int const ZoneNum,
+                                      int const MapNum,              // Illuminance map number
+                                      int const IL,                  // Map point number
+                                      Vector3<Real64> const &VIEWVC, // View vector in absolute coordinate system
+                                      Real64 const AZVIEW            // Azimuth of view vector in absolute coord system for glare calculation (radians)
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         Linda Lawrie
+        //       DATE WRITTEN   April 2012
+        //       MODIFIED       October 2026, broken out of CalcDayltgCoeffsMapPoints so map points can be figured in parallel
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Provides calculations for Daylighting Coefficients for one illuminance map point
+
         // Using/Aliasing
         using DaylightingDevices::FindTDDPipe;
         using DaylightingDevices::TransTDD;
@@ -1439,28 +1865,23 @@ namespace DaylightingManager {
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-        static Vector3<Real64> W2;      // Second vertex of window
-        static Vector3<Real64> W3;      // Third vertex of window
-        static Vector3<Real64> U2;      // Second vertex of window for TDD:DOME (if exists)
-        static Vector3<Real64> RREF;    // Location of a reference point in absolute coordinate system
-        static Vector3<Real64> RREF2;   // Location of virtual reference point in absolute coordinate system
-        static Vector3<Real64> RWIN;    // Center of a window element in absolute coordinate system
-        static Vector3<Real64> RWIN2;   // Center of a window element for TDD:DOME (if exists) in abs coord sys
-        static Vector3<Real64> Ray;     // Unit vector along ray from reference point to window element
-        static Vector3<Real64> W21;     // Vector from window vertex 2 to window vertex 1
-        static Vector3<Real64> W23;     // Vector from window vertex 2 to window vertex 3
-        static Vector3<Real64> U21;     // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
-        static Vector3<Real64> U23;     // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
-        static Vector3<Real64> WNORM2;  // Unit vector normal to TDD:DOME (if exists)
-        static Vector3<Real64> VIEWVC;  // View vector in absolute coordinate system
-        static Vector3<Real64> VIEWVC2; // Virtual view vector in absolute coordinate system
-                                        //		static Vector2< Real64 > ZF; // Fraction of zone controlled by each reference point //Unused
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> W2;      // Second vertex of window
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> W3;      // Third vertex of window
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> U2;      // Second vertex of window for TDD:DOME (if exists)
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> RREF;    // Location of a reference point in absolute coordinate system
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> RREF2;   // Location of virtual reference point in absolute coordinate system
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> RWIN;    // Center of a window element in absolute coordinate system
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> RWIN2;   // Center of a window element for TDD:DOME (if exists) in abs coord sys
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> Ray;     // Unit vector along ray from reference point to window element
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> W21;     // Vector from window vertex 2 to window vertex 1
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> W23;     // Vector from window vertex 2 to window vertex 3
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> U21;     // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> U23;     // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> WNORM2;  // Unit vector normal to TDD:DOME (if exists)
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> VIEWVC2; // Virtual view vector in absolute coordinate system
+                                                              //		static Vector2< Real64 > ZF; // Fraction of zone controlled by each reference point //Unused
         //  In the following four variables, I=1 for clear sky, 2 for overcast.
-        int IHR;       // Hour of day counter
-        int NRF;       // Number of daylighting reference points in a zone
-        int IL;        // Reference point counter
-        Real64 AZVIEW; // Azimuth of view vector in absolute coord system for
-        //  glare calculation (radians)
+        int IHR;         // Hour of day counter
         int IConst;      // Construction counter
         int ICtrl;       // Window control counter
         int IWin;        // Window counter
@@ -1495,7 +1916,6 @@ namespace DaylightingManager {
         Real64 SkyObstructionMult; // Ratio of obstructed to unobstructed sky diffuse at a ground point
         int ExtWinType;            // Exterior window type (InZoneExtWin, AdjZoneExtWin, NotInOrAdjZoneExtWin)
         int ILB;
-        int MapNum;            // Loop for map number
         bool hitIntObs;        // True iff interior obstruction hit
         bool hitExtObs;        // True iff ray from ref pt to ext win hits an exterior obstruction
         Real64 TVISIntWin;     // Visible transmittance of int win at COSBIntWin for light from ext win
@@ -1506,292 +1926,225 @@ namespace DaylightingManager {
         static bool MySunIsUpFlag(false);
         int WinEl; // window elements counter
 
-        if (mapFirstTime && TotIllumMaps > 0) {
-            IL = -999;
-            for (MapNum = 1; MapNum <= TotIllumMaps; ++MapNum) {
-                IL = max(IL, IllumMapCalc(MapNum).TotalMapRefPoints);
-            }
-            MapErrIndex.dimension(IL, TotSurfaces, 0);
-            mapFirstTime = false;
-        }
-
-        // Azimuth of view vector in absolute coord sys
-        AZVIEW = (ZoneDaylight(ZoneNum).ViewAzimuthForGlare + Zone(ZoneNum).RelNorth + BuildingAzimuth + BuildingRotationAppendixG) * DegToRadians;
-        // View vector components in absolute coord sys
-        VIEWVC(1) = std::sin(AZVIEW);
-        VIEWVC(2) = std::cos(AZVIEW);
-        VIEWVC(3) = 0.0;
-
-        for (MapNum = 1; MapNum <= TotIllumMaps; ++MapNum) {
-
-            if (IllumMapCalc(MapNum).Zone != ZoneNum) continue;
-
-            IllumMapCalc(MapNum).DaylIllumAtMapPt = 0.0;  // Daylight illuminance at reference points (lux)
-            IllumMapCalc(MapNum).GlareIndexAtMapPt = 0.0; // Glare index at reference points
-            IllumMapCalc(MapNum).SolidAngAtMapPt = 0.0;
-            IllumMapCalc(MapNum).SolidAngAtMapPtWtd = 0.0;
-            IllumMapCalc(MapNum).IllumFromWinAtMapPt = 0.0;
-            IllumMapCalc(MapNum).BackLumFromWinAtMapPt = 0.0;
-            IllumMapCalc(MapNum).SourceLumFromWinAtMapPt = 0.0;
-            if (!DetailedSolarTimestepIntegration) {
-                IllumMapCalc(MapNum).DaylIllFacSky = 0.0;
-                IllumMapCalc(MapNum).DaylSourceFacSky = 0.0;
-                IllumMapCalc(MapNum).DaylBackFacSky = 0.0;
-                IllumMapCalc(MapNum).DaylIllFacSun = 0.0;
-                IllumMapCalc(MapNum).DaylIllFacSunDisk = 0.0;
-                IllumMapCalc(MapNum).DaylSourceFacSun = 0.0;
-                IllumMapCalc(MapNum).DaylSourceFacSunDisk = 0.0;
-                IllumMapCalc(MapNum).DaylBackFacSun = 0.0;
-                IllumMapCalc(MapNum).DaylBackFacSunDisk = 0.0;
-            } else {
-                IllumMapCalc(MapNum).DaylIllFacSky(
-                    HourOfDay, {1, MaxSlatAngs + 1}, {1, 4}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
-                IllumMapCalc(MapNum).DaylSourceFacSky(
-                    HourOfDay, {1, MaxSlatAngs + 1}, {1, 4}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
-                IllumMapCalc(MapNum).DaylBackFacSky(
-                    HourOfDay, {1, MaxSlatAngs + 1}, {1, 4}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
-                IllumMapCalc(MapNum).DaylIllFacSun(
-                    HourOfDay, {1, MaxSlatAngs + 1}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
-                IllumMapCalc(MapNum).DaylIllFacSunDisk(
-                    HourOfDay, {1, MaxSlatAngs + 1}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
-                IllumMapCalc(MapNum).DaylSourceFacSun(
-                    HourOfDay, {1, MaxSlatAngs + 1}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
-                IllumMapCalc(MapNum).DaylSourceFacSunDisk(
-                    HourOfDay, {1, MaxSlatAngs + 1}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
-                IllumMapCalc(MapNum).DaylBackFacSun(
-                    HourOfDay, {1, MaxSlatAngs + 1}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
-                IllumMapCalc(MapNum).DaylBackFacSunDisk(
-                    HourOfDay, {1, MaxSlatAngs + 1}, {1, MaxRefPoints}, {1, ZoneDaylight(ZoneNum).NumOfDayltgExtWins}) = 0.0;
-            }
-            NRF = IllumMapCalc(MapNum).TotalMapRefPoints;
-
-            //			MapWindowSolidAngAtRefPt.allocate( NRF, ZoneDaylight( ZoneNum ).NumOfDayltgExtWins ); //Inactive
-            //			MapWindowSolidAngAtRefPtWtd.allocate( NRF, ZoneDaylight( ZoneNum ).NumOfDayltgExtWins ); // Not an array anymore
-
-            for (IL = 1; IL <= NRF; ++IL) {
-
-                RREF = IllumMapCalc(MapNum).MapRefPtAbsCoord({1, 3}, IL); // (x, y, z)
-
-                //           -------------
-                // ---------- WINDOW LOOP ----------
-                //           -------------
-
-                //				MapWindowSolidAngAtRefPt = 0.0; //Inactive
-                MapWindowSolidAngAtRefPtWtd = 0.0;
-
-                for (loopwin = 1; loopwin <= ZoneDaylight(ZoneNum).NumOfDayltgExtWins; ++loopwin) {
-
-                    FigureDayltgCoeffsAtPointsSetupForWindow(ZoneNum,
-                                                             IL,
-                                                             loopwin,
-                                                             CalledForMapPoint,
-                                                             RREF,
-                                                             VIEWVC,
-                                                             IWin,
-                                                             IWin2,
-                                                             NWX,
-                                                             NWY,
-                                                             W2,
-                                                             W3,
-                                                             W21,
-                                                             W23,
-                                                             LSHCAL,
-                                                             InShelfSurf,
-                                                             ICtrl,
-                                                             ShType,
-                                                             BlNum,
-                                                             WNORM2,
-                                                             ExtWinType,
-                                                             IConst,
-                                                             RREF2,
-                                                             DWX,
-                                                             DWY,
-                                                             DAXY,
-                                                             U2,
-                                                             U23,
-                                                             U21,
-                                                             VIEWVC2,
-                                                             is_Rectangle,
-                                                             is_Triangle,
-                                                             MapNum,
-                                                             MapWindowSolidAngAtRefPtWtd); // Inactive MapWindowSolidAngAtRefPt arg removed
-                    //           ---------------------
-                    // ---------- WINDOW ELEMENT LOOP ----------
-                    //           ---------------------
-                    WinEl = 0;
-
-                    for (IX = 1; IX <= NWX; ++IX) {
-                        if (is_Rectangle) {
-                            NWYlim = NWY;
-                        } else if (is_Triangle) {
-                            NWYlim = NWY - IX + 1;
-                        }
-
-                        for (IY = 1; IY <= NWYlim; ++IY) {
-
-                            ++WinEl;
-
-                            FigureDayltgCoeffsAtPointsForWindowElements(ZoneNum,
-                                                                        IL,
-                                                                        loopwin,
-                                                                        CalledForMapPoint,
-                                                                        WinEl,
-                                                                        IWin,
-                                                                        IWin2,
-                                                                        IX,
-                                                                        IY,
-                                                                        SkyObstructionMult,
-                                                                        W2,
-                                                                        W21,
-                                                                        W23,
-                                                                        RREF,
-                                                                        NWYlim,
-                                                                        VIEWVC2,
-                                                                        DWX,
-                                                                        DWY,
-                                                                        DAXY,
-                                                                        U2,
-                                                                        U23,
-                                                                        U21,
-                                                                        RWIN,
-                                                                        RWIN2,
-                                                                        Ray,
-                                                                        PHRAY,
-                                                                        LSHCAL,
-                                                                        COSB,
-                                                                        ObTrans,
-                                                                        TVISB,
-                                                                        DOMEGA,
-                                                                        THRAY,
-                                                                        hitIntObs,
-                                                                        hitExtObs,
-                                                                        WNORM2,
-                                                                        ExtWinType,
-                                                                        IConst,
-                                                                        RREF2,
-                                                                        is_Triangle,
-                                                                        TVISIntWin,
-                                                                        TVISIntWinDisk,
-                                                                        MapNum,
-                                                                        MapWindowSolidAngAtRefPtWtd); // Inactive MapWindowSolidAngAtRefPt arg removed
-                            //           -------------------
-                            // ---------- SUN POSITION LOOP ----------
-                            //           -------------------
-
-                            // Sun position counter. Used to avoid calculating various quantities
-                            // that do not depend on sun position.
-                            if (!DetailedSolarTimestepIntegration) {
-                                ISunPos = 0;
-                                for (IHR = 1; IHR <= 24; ++IHR) {
-                                    FigureDayltgCoeffsAtPointsForSunPosition(ZoneNum,
-                                                                             IL,
-                                                                             IX,
-                                                                             NWX,
-                                                                             IY,
-                                                                             NWYlim,
-                                                                             WinEl,
-                                                                             IWin,
-                                                                             IWin2,
-                                                                             IHR,
-                                                                             ISunPos,
-                                                                             SkyObstructionMult,
-                                                                             RWIN2,
-                                                                             Ray,
-                                                                             PHRAY,
-                                                                             LSHCAL,
-                                                                             InShelfSurf,
-                                                                             COSB,
-                                                                             ObTrans,
-                                                                             TVISB,
-                                                                             DOMEGA,
-                                                                             ICtrl,
-                                                                             ShType,
-                                                                             BlNum,
-                                                                             THRAY,
-                                                                             WNORM2,
-                                                                             ExtWinType,
-                                                                             IConst,
-                                                                             AZVIEW,
-                                                                             RREF2,
-                                                                             hitIntObs,
-                                                                             hitExtObs,
-                                                                             CalledForMapPoint,
-                                                                             TVISIntWin,
-                                                                             TVISIntWinDisk,
-                                                                             MapNum,
-                                                                             MapWindowSolidAngAtRefPtWtd);
-                                } // End of hourly sun position loop, IHR
-                            } else {
-                                if (SunIsUp && !MySunIsUpFlag) {
-                                    ISunPos = 0;
-                                    MySunIsUpFlag = true;
-                                } else if (SunIsUp && MySunIsUpFlag) {
-                                    ISunPos = 1;
-                                } else if (!SunIsUp && MySunIsUpFlag) {
-                                    MySunIsUpFlag = false;
-                                    ISunPos = -1;
-                                } else if (!SunIsUp && !MySunIsUpFlag) {
-                                    ISunPos = -1;
-                                }
-                                FigureDayltgCoeffsAtPointsForSunPosition(ZoneNum,
-                                                                         IL,
-                                                                         IX,
-                                                                         NWX,
-                                                                         IY,
-                                                                         NWYlim,
-                                                                         WinEl,
-                                                                         IWin,
-                                                                         IWin2,
-                                                                         HourOfDay,
-                                                                         ISunPos,
-                                                                         SkyObstructionMult,
-                                                                         RWIN2,
-                                                                         Ray,
-                                                                         PHRAY,
-                                                                         LSHCAL,
-                                                                         InShelfSurf,
-                                                                         COSB,
-                                                                         ObTrans,
-                                                                         TVISB,
-                                                                         DOMEGA,
-                                                                         ICtrl,
-                                                                         ShType,
-                                                                         BlNum,
-                                                                         THRAY,
-                                                                         WNORM2,
-                                                                         ExtWinType,
-                                                                         IConst,
-                                                                         AZVIEW,
-                                                                         RREF2,
-                                                                         hitIntObs,
-                                                                         hitExtObs,
-                                                                         CalledForMapPoint,
-                                                                         TVISIntWin,
-                                                                         TVISIntWinDisk,
-                                                                         MapNum,
-                                                                         MapWindowSolidAngAtRefPtWtd);
-                            }
-                        } // End of window Y-element loop, IY
-                    }     // End of window X-element loop, IX
-
+        RREF = IllumMapCalc(MapNum).MapRefPtAbsCoord({1, 3}, IL); // (x, y, z)
+
+        //           -------------
+        // ---------- WINDOW LOOP ----------
+        //           -------------
+
+        //				MapWindowSolidAngAtRefPt = 0.0; //Inactive
+        MapWindowSolidAngAtRefPtWtd = 0.0;
+
+        for (loopwin = 1; loopwin <= ZoneDaylight(ZoneNum).NumOfDayltgExtWins; ++loopwin) {
+
+            FigureDayltgCoeffsAtPointsSetupForWindow(ZoneNum,
+                                                     IL,
+                                                     loopwin,
+                                                     CalledForMapPoint,
+                                                     RREF,
+                                                     VIEWVC,
+                                                     IWin,
+                                                     IWin2,
+                                                     NWX,
+                                                     NWY,
+                                                     W2,
+                                                     W3,
+                                                     W21,
+                                                     W23,
+                                                     LSHCAL,
+                                                     InShelfSurf,
+                                                     ICtrl,
+                                                     ShType,
+                                                     BlNum,
+                                                     WNORM2,
+                                                     ExtWinType,
+                                                     IConst,
+                                                     RREF2,
+                                                     DWX,
+                                                     DWY,
+                                                     DAXY,
+                                                     U2,
+                                                     U23,
+                                                     U21,
+                                                     VIEWVC2,
+                                                     is_Rectangle,
+                                                     is_Triangle,
+                                                     MapNum,
+                                                     MapWindowSolidAngAtRefPtWtd); // Inactive MapWindowSolidAngAtRefPt arg removed
+            //           ---------------------
+            // ---------- WINDOW ELEMENT LOOP ----------
+            //           ---------------------
+            WinEl = 0;
+
+            for (IX = 1; IX <= NWX; ++IX) {
+                if (is_Rectangle) {
+                    NWYlim = NWY;
+                } else if (is_Triangle) {
+                    NWYlim = NWY - IX + 1;
+                }
+
+                for (IY = 1; IY <= NWYlim; ++IY) {
+
+                    ++WinEl;
+
+                    FigureDayltgCoeffsAtPointsForWindowElements(ZoneNum,
+                                                                IL,
+                                                                loopwin,
+                                                                CalledForMapPoint,
+                                                                WinEl,
+                                                                IWin,
+                                                                IWin2,
+                                                                IX,
+                                                                IY,
+                                                                SkyObstructionMult,
+                                                                W2,
+                                                                W21,
+                                                                W23,
+                                                                RREF,
+                                                                NWYlim,
+                                                                VIEWVC2,
+                                                                DWX,
+                                                                DWY,
+                                                                DAXY,
+                                                                U2,
+                                                                U23,
+                                                                U21,
+                                                                RWIN,
+                                                                RWIN2,
+                                                                Ray,
+                                                                PHRAY,
+                                                                LSHCAL,
+                                                                COSB,
+                                                                ObTrans,
+                                                                TVISB,
+                                                                DOMEGA,
+                                                                THRAY,
+                                                                hitIntObs,
+                                                                hitExtObs,
+                                                                WNORM2,
+                                                                ExtWinType,
+                                                                IConst,
+                                                                RREF2,
+                                                                is_Triangle,
+                                                                TVISIntWin,
+                                                                TVISIntWinDisk,
+                                                                MapNum,
+                                                                MapWindowSolidAngAtRefPtWtd); // Inactive MapWindowSolidAngAtRefPt arg removed
+                    //           -------------------
+                    // ---------- SUN POSITION LOOP ----------
+                    //           -------------------
+
+                    // Sun position counter. Used to avoid calculating various quantities
+                    // that do not depend on sun position.
                     if (!DetailedSolarTimestepIntegration) {
-                        // Loop again over hourly sun positions and calculate daylight factors by adding
-                        // direct and inter-reflected illum components, then dividing by exterior horiz illum.
-                        // Also calculate corresponding glare factors.
-                        ILB = IL;
+                        ISunPos = 0;
                         for (IHR = 1; IHR <= 24; ++IHR) {
-                            FigureMapPointDayltgFactorsToAddIllums(ZoneNum, MapNum, ILB, IHR, IWin, loopwin, NWX, NWY, ICtrl);
-                        } // End of sun position loop, IHR
+                            FigureDayltgCoeffsAtPointsForSunPosition(ZoneNum,
+                                                                     IL,
+                                                                     IX,
+                                                                     NWX,
+                                                                     IY,
+                                                                     NWYlim,
+                                                                     WinEl,
+                                                                     IWin,
+                                                                     IWin2,
+                                                                     IHR,
+                                                                     ISunPos,
+                                                                     SkyObstructionMult,
+                                                                     RWIN2,
+                                                                     Ray,
+                                                                     PHRAY,
+                                                                     LSHCAL,
+                                                                     InShelfSurf,
+                                                                     COSB,
+                                                                     ObTrans,
+                                                                     TVISB,
+                                                                     DOMEGA,
+                                                                     ICtrl,
+                                                                     ShType,
+                                                                     BlNum,
+                                                                     THRAY,
+                                                                     WNORM2,
+                                                                     ExtWinType,
+                                                                     IConst,
+                                                                     AZVIEW,
+                                                                     RREF2,
+                                                                     hitIntObs,
+                                                                     hitExtObs,
+                                                                     CalledForMapPoint,
+                                                                     TVISIntWin,
+                                                                     TVISIntWinDisk,
+                                                                     MapNum,
+                                                                     MapWindowSolidAngAtRefPtWtd);
+                        } // End of hourly sun position loop, IHR
                     } else {
-                        ILB = IL;
-                        FigureMapPointDayltgFactorsToAddIllums(ZoneNum, MapNum, ILB, HourOfDay, IWin, loopwin, NWX, NWY, ICtrl);
+                        if (SunIsUp && !MySunIsUpFlag) {
+                            ISunPos = 0;
+                            MySunIsUpFlag = true;
+                        } else if (SunIsUp && MySunIsUpFlag) {
+                            ISunPos = 1;
+                        } else if (!SunIsUp && MySunIsUpFlag) {
+                            MySunIsUpFlag = false;
+                            ISunPos = -1;
+                        } else if (!SunIsUp && !MySunIsUpFlag) {
+                            ISunPos = -1;
+                        }
+                        FigureDayltgCoeffsAtPointsForSunPosition(ZoneNum,
+                                                                 IL,
+                                                                 IX,
+                                                                 NWX,
+                                                                 IY,
+                                                                 NWYlim,
+                                                                 WinEl,
+                                                                 IWin,
+                                                                 IWin2,
+                                                                 HourOfDay,
+                                                                 ISunPos,
+                                                                 SkyObstructionMult,
+                                                                 RWIN2,
+                                                                 Ray,
+                                                                 PHRAY,
+                                                                 LSHCAL,
+                                                                 InShelfSurf,
+                                                                 COSB,
+                                                                 ObTrans,
+                                                                 TVISB,
+                                                                 DOMEGA,
+                                                                 ICtrl,
+                                                                 ShType,
+                                                                 BlNum,
+                                                                 THRAY,
+                                                                 WNORM2,
+                                                                 ExtWinType,
+                                                                 IConst,
+                                                                 AZVIEW,
+                                                                 RREF2,
+                                                                 hitIntObs,
+                                                                 hitExtObs,
+                                                                 CalledForMapPoint,
+                                                                 TVISIntWin,
+                                                                 TVISIntWinDisk,
+                                                                 MapNum,
+                                                                 MapWindowSolidAngAtRefPtWtd);
                     }
+                } // End of window Y-element loop, IY
+            }     // End of window X-element loop, IX
 
-                } // End of window loop, loopwin - IWin
+            if (!DetailedSolarTimestepIntegration) {
+                // Loop again over hourly sun positions and calculate daylight factors by adding
+                // direct and inter-reflected illum components, then dividing by exterior horiz illum.
+                // Also calculate corresponding glare factors.
+                ILB = IL;
+                for (IHR = 1; IHR <= 24; ++IHR) {
+                    FigureMapPointDayltgFactorsToAddIllums(ZoneNum, MapNum, ILB, IHR, IWin, loopwin, NWX, NWY, ICtrl);
+                } // End of sun position loop, IHR
+            } else {
+                ILB = IL;
+                FigureMapPointDayltgFactorsToAddIllums(ZoneNum, MapNum, ILB, HourOfDay, IWin, loopwin, NWX, NWY, ICtrl);
+            }
 
-            } // End of reference point loop, IL
+        } // End of window loop, loopwin - IWin
 
-        } // MapNum
     }
 
     void FigureDayltgCoeffsAtPointsSetupForWindow(int const ZoneNum,
@@ -1870,40 +2223,40 @@ namespace DaylightingManager {
         int ZoneNumThisWin; // A window's zone number
         int ShelfNum;       // Daylighting shelf object number
 
-        static Vector3<Real64> W1; // First vertex of window (where vertices are numbered
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> W1; // First vertex of window (where vertices are numbered
         // counter-clockwise starting at upper left as viewed
         // from inside of room
-        int IConstShaded;             // Shaded construction counter
-                                      //		int ScNum; // Window screen number //Unused Set but never used
-        Real64 WW;                    // Window width (m)
-        Real64 HW;                    // Window height (m)
-        static Vector3<Real64> WC;    // Center point of window
-        static Vector3<Real64> REFWC; // Vector from reference point to center of window
-        static Vector3<Real64> WNORM; // Unit vector normal to window (pointing away from room)
-        int NDIVX;                    // Number of window x divisions for daylighting calc
-        int NDIVY;                    // Number of window y divisions for daylighting calc
-        Real64 ALF;                   // Distance from reference point to window plane (m)
-        static Vector3<Real64> W2REF; // Vector from window origin to project of ref. pt. on window plane
-        Real64 D1a;                   // Projection of vector from window origin to reference
+        int IConstShaded;                                   // Shaded construction counter
+                                                            //		int ScNum; // Window screen number //Unused Set but never used
+        Real64 WW;                                          // Window width (m)
+        Real64 HW;                                          // Window height (m)
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> WC;    // Center point of window
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> REFWC; // Vector from reference point to center of window
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> WNORM; // Unit vector normal to window (pointing away from room)
+        int NDIVX;                                          // Number of window x divisions for daylighting calc
+        int NDIVY;                                          // Number of window y divisions for daylighting calc
+        Real64 ALF;                                         // Distance from reference point to window plane (m)
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> W2REF; // Vector from window origin to project of ref. pt. on window plane
+        Real64 D1a;                                         // Projection of vector from window origin to reference
         //  on window X  axis (m)
         Real64 D1b; // Projection of vector from window origin to reference
         //  on window Y axis (m)
-        Real64 SolidAngExtWin;         // Approx. solid angle subtended by an ext. window wrt ref pt
-        Real64 SolidAngMinIntWin;      // Approx. smallest solid angle subtended by an int. window wrt ref pt
-        Real64 SolidAngRatio;          // Ratio of SolidAngExtWin and SolidAngMinIntWin
-        int PipeNum;                   // TDD pipe object number
-        static Vector3<Real64> REFD;   // Vector from ref pt to center of win in TDD:DIFFUSER coord sys (if exists)
-        static Vector3<Real64> VIEWVD; // Virtual view vector in TDD:DIFFUSER coord sys (if exists)
-        static Vector3<Real64> U1;     // First vertex of window for TDD:DOME (if exists)
-        static Vector3<Real64> U3;     // Third vertex of window for TDD:DOME (if exists)
-        Real64 SinCornerAng;           // For triangle, sine of corner angle of window element
+        Real64 SolidAngExtWin;                               // Approx. solid angle subtended by an ext. window wrt ref pt
+        Real64 SolidAngMinIntWin;                            // Approx. smallest solid angle subtended by an int. window wrt ref pt
+        Real64 SolidAngRatio;                                // Ratio of SolidAngExtWin and SolidAngMinIntWin
+        int PipeNum;                                         // TDD pipe object number
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> REFD;   // Vector from ref pt to center of win in TDD:DIFFUSER coord sys (if exists)
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> VIEWVD; // Virtual view vector in TDD:DIFFUSER coord sys (if exists)
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> U1;     // First vertex of window for TDD:DOME (if exists)
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> U3;     // Third vertex of window for TDD:DOME (if exists)
+        Real64 SinCornerAng;                                 // For triangle, sine of corner angle of window element
 
         // Complex fenestration variables
         //		int CplxFenState; // Current complex fenestration state //Unused Set but never used
         //		int NReflSurf; // Number of blocked beams for complex fenestration //Unused Set but never used
         int NRefPts; // number of reference points
                      //		int WinEl; // Current window element //Unused Set but never used
-        static Vector3<Real64> RayVector;
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> RayVector;
         //		Real64 TransBeam; // Obstructions transmittance for incoming BSDF rays (temporary variable) //Unused Set but never used
 
         // Complex fenestration variables
@@ -2049,10 +2402,16 @@ namespace DaylightingManager {
         } else if (CalledFrom == CalledForMapPoint) {
             if (ALF < 0.1524 && ExtWinType == AdjZoneExtWin) {
                 if (MapErrIndex(iRefPoint, IWin) == 0) { // only show error message once
-                    ShowWarningError("CalcDaylightCoeffMapPoints: For Zone=\"" + Zone(ZoneNum).Name + "\" External Window=\"" + Surface(IWin).Name +
-                                     "\"in Zone=\"" + Zone(Surface(IWin).Zone).Name + "\" map point is less than 0.15m (6\") from window plane ");
-                    ShowContinueError("Distance=[" + RoundSigDigits(ALF, 1) + " m] map point=[" + RoundSigDigits(RREF(1), 1) + ',' +
-                                      RoundSigDigits(RREF(2), 1) + ',' + RoundSigDigits(RREF(3), 1) + "], Inaccuracy in Map Calcs may result.");
+#ifdef _OPENMP
+#pragma omp critical(DaylightingMapPointWarnings)
+#endif
+                    {
+                        ShowWarningError("CalcDaylightCoeffMapPoints: For Zone=\"" + Zone(ZoneNum).Name + "\" External Window=\"" +
+                                         Surface(IWin).Name + "\"in Zone=\"" + Zone(Surface(IWin).Zone).Name +
+                                         "\" map point is less than 0.15m (6\") from window plane ");
+                        ShowContinueError("Distance=[" + RoundSigDigits(ALF, 1) + " m] map point=[" + RoundSigDigits(RREF(1), 1) + ',' +
+                                          RoundSigDigits(RREF(2), 1) + ',' + RoundSigDigits(RREF(3), 1) + "], Inaccuracy in Map Calcs may result.");
+                    }
                     MapErrIndex(iRefPoint, IWin) = 1;
                 }
             }
@@ -2332,28 +2691,28 @@ namespace DaylightingManager {
         Real64 XR;  // Horizontal displacement ratio
         Real64 YR;  // Vertical displacement ratio
 
-        int IntWinHitNum;                   // Surface number of interior window that is intersected
-        bool hitIntWin;                     // Ray from ref pt passes through interior window
-        int PipeNum;                        // TDD pipe object number
-        int IntWin;                         // Interior window surface index
-        static Vector3<Real64> HitPtIntWin; // Intersection point on an interior window for ray from ref pt to ext win (m)
-        Real64 COSBIntWin;                  // Cos of angle between int win outward normal and ray betw ref pt and
+        int IntWinHitNum;                                         // Surface number of interior window that is intersected
+        bool hitIntWin;                                           // Ray from ref pt passes through interior window
+        int PipeNum;                                              // TDD pipe object number
+        int IntWin;                                               // Interior window surface index
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> HitPtIntWin; // Intersection point on an interior window for ray from ref pt to ext win (m)
+        Real64 COSBIntWin;                                        // Cos of angle between int win outward normal and ray betw ref pt and
         //  exterior window element or between ref pt and sun
 
         Real64 Alfa;   // Intermediate variable
         Real64 Beta;   // Intermediate variable
         Real64 HorDis; // Distance between ground hit point and proj'n of center
         //  of window element onto ground (m)
-        static Vector3<Real64> GroundHitPt; // Coordinates of point that ray hits ground (m)
-        static Vector3<Real64> URay;        // Unit vector in (Phi,Theta) direction
-        static Vector3<Real64> ObsHitPt;    // Coordinates of hit point on an obstruction (m)
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> GroundHitPt; // Coordinates of point that ray hits ground (m)
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> URay;        // Unit vector in (Phi,Theta) direction
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> ObsHitPt;    // Coordinates of hit point on an obstruction (m)
 
         // Local complex fenestration variables
         int CplxFenState; // Current complex fenestration state
         int NReflSurf;    // Number of blocked beams for complex fenestration
         int ICplxFen;     // Complex fenestration counter
         int RayIndex;
-        static Vector3<Real64> RayVector;
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> RayVector;
         Real64 TransBeam; // Obstructions transmittance for incoming BSDF rays (temporary variable)
 
         ++LSHCAL;
@@ -3306,28 +3665,29 @@ namespace DaylightingManager {
         Real64 ObstrMultiplier;
 
         // Locals
-        static Vector3<Real64> URay; // Unit vector in (Phi,Theta) direction
-        Real64 DPhi;                 // Phi increment (radians)
-        Real64 DTheta;               // Theta increment (radians)
-        Real64 SkyGndUnObs;          // Unobstructed sky irradiance at a ground point
-        Real64 SkyGndObs;            // Obstructed sky irradiance at a ground point
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> URay; // Unit vector in (Phi,Theta) direction
+        Real64 DPhi;                                       // Phi increment (radians)
+        Real64 DTheta;                                     // Theta increment (radians)
+        Real64 SkyGndUnObs;                                // Unobstructed sky irradiance at a ground point
+        Real64 SkyGndObs;                                  // Obstructed sky irradiance at a ground point
 
         Real64 Phi;   // Altitude  angle of ray from a ground point (radians)
         Real64 SPhi;  // Sin of Phi
         Real64 CPhi;  // cos of Phi
         Real64 Theta; // Azimuth angle of ray from a ground point (radians)
 
-        Real64 CosIncAngURay;            // Cosine of incidence angle of URay on ground plane
-        Real64 dOmegaGnd;                // Solid angle element of ray from ground point (steradians)
-        Real64 IncAngSolidAngFac;        // CosIncAngURay*dOmegaGnd/Pi
-        bool hitObs;                     // True iff obstruction is hit
-        static Vector3<Real64> ObsHitPt; // Coordinates of hit point on an obstruction (m)
-        static int AltSteps_last(0);
-        static Array1D<Real64> cos_Phi(AltAngStepsForSolReflCalc / 2); // cos( Phi ) table
-        static Array1D<Real64> sin_Phi(AltAngStepsForSolReflCalc / 2); // sin( Phi ) table
-        static int AzimSteps_last(0);
-        static Array1D<Real64> cos_Theta(2 * AzimAngStepsForSolReflCalc); // cos( Theta ) table
-        static Array1D<Real64> sin_Theta(2 * AzimAngStepsForSolReflCalc); // sin( Theta ) table
+        Real64 CosIncAngURay;                                                  // Cosine of incidence angle of URay on ground plane
+        Real64 dOmegaGnd;                                                      // Solid angle element of ray from ground point (steradians)
+        Real64 IncAngSolidAngFac;                                              // CosIncAngURay*dOmegaGnd/Pi
+        static EP_DAYLT_THREAD_LOCAL RayPacket rays;                           // Ground rays from the ground point
+        static EP_DAYLT_THREAD_LOCAL std::vector<Vector3<Real64>> rayDirs;     // Ground ray unit vectors for the octree search
+        static EP_DAYLT_THREAD_LOCAL std::vector<Vector3<Real64>> rayDirs_inv; // Octree-safe inverses of the ground ray unit vectors
+        static EP_DAYLT_THREAD_LOCAL int AltSteps_last(0);
+        static EP_DAYLT_THREAD_LOCAL Array1D<Real64> cos_Phi(AltAngStepsForSolReflCalc / 2); // cos( Phi ) table
+        static EP_DAYLT_THREAD_LOCAL Array1D<Real64> sin_Phi(AltAngStepsForSolReflCalc / 2); // sin( Phi ) table
+        static EP_DAYLT_THREAD_LOCAL int AzimSteps_last(0);
+        static EP_DAYLT_THREAD_LOCAL Array1D<Real64> cos_Theta(2 * AzimAngStepsForSolReflCalc); // cos( Theta ) table
+        static EP_DAYLT_THREAD_LOCAL Array1D<Real64> sin_Theta(2 * AzimAngStepsForSolReflCalc); // sin( Theta ) table
 
         assert(AzimSteps <= AzimAngStepsForSolReflCalc);
 
@@ -3337,6 +3697,7 @@ namespace DaylightingManager {
         SkyGndUnObs = 0.0;
 
         // Tuned Precompute Phi trig table
+        bool const raysChanged((AltSteps != AltSteps_last) || (AzimSteps != AzimSteps_last));
         if (AltSteps != AltSteps_last) {
             for (int IPhi = 1, IPhi_end = (AltSteps / 2); IPhi <= IPhi_end; ++IPhi) {
                 Phi = (IPhi - 0.5) * DPhi;
@@ -3356,51 +3717,65 @@ namespace DaylightingManager {
             AzimSteps_last = AzimSteps;
         }
 
+        // Ground ray unit vectors in (Theta,Phi) order: The same for every ground point
+        if (raysChanged) {
+            rays.clear();
+            rayDirs.clear();
+            rayDirs_inv.clear();
+            for (int IPhi = 1, IPhi_end = (AltSteps / 2); IPhi <= IPhi_end; ++IPhi) {
+                for (int ITheta = 1; ITheta <= 2 * AzimSteps; ++ITheta) {
+                    URay(1) = cos_Phi(IPhi) * cos_Theta(ITheta);
+                    URay(2) = cos_Phi(IPhi) * sin_Theta(ITheta);
+                    URay(3) = sin_Phi(IPhi);
+                    rays.add(URay);
+                    rayDirs.push_back(URay);
+                    rayDirs_inv.push_back(SurfaceOctreeCube::safe_inverse(URay));
+                }
+            }
+        }
+
+        // Which ground rays hit an obstruction?  All rays of the hemisphere are tested against each surface together.
+        rays.ori = GroundHitPt;
+        rays.reset();
+        if (TotSurfaces < octreeCrossover) { // Linear search through surfaces
+
+            for (int ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum) {
+                if (Surface(ObsSurfNum).ShadowSurfPossibleObstruction) {
+                    PierceSurface(Surface(ObsSurfNum), rays); // Check which rays pierce surface
+                    if (rays.allHit()) break;
+                }
+            }
+
+        } else { // Surface octree search
+
+            // Lambda function for the octree to test the rays still unobstructed for surface hits
+            auto surfaceHit = [](SurfaceData const &surface) -> bool {
+                if (surface.ShadowSurfPossibleObstruction) {
+                    PierceSurface(surface, rays); // Check which rays pierce surface
+                    return rays.allHit();         // Every ray is obstructed
+                } else {
+                    return false;
+                }
+            };
+
+            // Check octree surface candidates until every ray is obstructed, if ever
+            surfaceOctree.processSomeSurfaceRayPacketIntersectsCube(GroundHitPt, rayDirs, rayDirs_inv, rays.hit, surfaceHit);
+        }
+
         // Altitude loop
+        RayPacket::size_type iRay(0u);
         for (int IPhi = 1, IPhi_end = (AltSteps / 2); IPhi <= IPhi_end; ++IPhi) {
             SPhi = sin_Phi(IPhi);
             CPhi = cos_Phi(IPhi);
 
-            // Third component of ground ray unit vector in (Theta,Phi) direction
-            URay(3) = SPhi;
             dOmegaGnd = CPhi * DTheta * DPhi;
             // Cosine of angle of incidence of ground ray on ground plane
             CosIncAngURay = SPhi;
             IncAngSolidAngFac = CosIncAngURay * dOmegaGnd / Pi;
             // Azimuth loop
-            for (int ITheta = 1; ITheta <= 2 * AzimSteps; ++ITheta) {
-                URay(1) = CPhi * cos_Theta(ITheta);
-                URay(2) = CPhi * sin_Theta(ITheta);
+            for (int ITheta = 1; ITheta <= 2 * AzimSteps; ++ITheta, ++iRay) {
                 SkyGndUnObs += IncAngSolidAngFac;
-                // Does this ground ray hit an obstruction?
-                hitObs = false;
-                if (TotSurfaces < octreeCrossover) { // Linear search through surfaces
-
-                    for (int ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum) {
-                        if (Surface(ObsSurfNum).ShadowSurfPossibleObstruction) {
-                            PierceSurface(ObsSurfNum, GroundHitPt, URay, ObsHitPt, hitObs); // Check if ray pierces surface
-                            if (hitObs) break;
-                        }
-                    }
-
-                } else { // Surface octree search
-
-                    // Lambda function for the octree to test for surface hit
-                    auto surfaceHit = [&GroundHitPt, &hitObs](SurfaceData const &surface) -> bool {
-                        if (surface.ShadowSurfPossibleObstruction) {
-                            PierceSurface(surface, GroundHitPt, URay, ObsHitPt, hitObs); // Check if ray pierces surface
-                            return hitObs;                                               // Ray pierces surface
-                        } else {
-                            return false;
-                        }
-                    };
-
-                    // Check octree surface candidates until a hit is found, if any
-                    Vector3<Real64> const URay_inv(SurfaceOctreeCube::safe_inverse(URay));
-                    surfaceOctree.hasSurfaceRayIntersectsCube(GroundHitPt, URay, URay_inv, surfaceHit);
-                }
-
-                if (hitObs) continue; // Obstruction hit
+                if (rays.hit[iRay]) continue; // Obstruction hit
                 // Sky is hit
                 SkyGndObs += IncAngSolidAngFac;
             } // End of azimuth loop
@@ -3493,25 +3868,25 @@ namespace DaylightingManager {
         if (SUNCOSHR(iHour, 3) < SunIsUpValue) return;
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        static Vector3<Real64> const RREF(0.0); // Location of a reference point in absolute coordinate system //Autodesk Was used uninitialized:
-                                                // Never set here // Made static for performance and const for now until issue addressed
-        static Vector4<Real64> XEDIRSK;         // Illuminance contribution from luminance element, sky-related
+        static Vector3<Real64> const RREF(0.0);               // Location of a reference point in absolute coordinate system //Autodesk Was used uninitialized:
+                                                              // Never set here // Made static for performance and const for now until issue addressed
+        static EP_DAYLT_THREAD_LOCAL Vector4<Real64> XEDIRSK; // Illuminance contribution from luminance element, sky-related
         //		Real64 XEDIRSU; // Illuminance contribution from luminance element, sun-related //Unused Set but never used
-        static Vector4<Real64> XAVWLSK;                        // Luminance of window element, sky-related
-        static Vector3<Real64> RAYCOS;                         // Unit vector from reference point to sun
-        int JB;                                                // Slat angle counter
-        static Array1D<Real64> TransBmBmMult(MaxSlatAngs);     // Beam-beam transmittance of isolated blind
-        static Array1D<Real64> TransBmBmMultRefl(MaxSlatAngs); // As above but for beam reflected from exterior obstruction
-        Real64 ProfAng;                                        // Solar profile angle on a window (radians)
-        Real64 POSFAC;                                         // Position factor for a window element / ref point / view vector combination
-        Real64 XR;                                             // Horizontal displacement ratio
-        Real64 YR;                                             // Vertical displacement ratio
-        bool hit;                                              // True iff ray from ref point thru window element hits an obstruction
+        static EP_DAYLT_THREAD_LOCAL Vector4<Real64> XAVWLSK;                        // Luminance of window element, sky-related
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> RAYCOS;                         // Unit vector from reference point to sun
+        int JB;                                                                      // Slat angle counter
+        static EP_DAYLT_THREAD_LOCAL Array1D<Real64> TransBmBmMult(MaxSlatAngs);     // Beam-beam transmittance of isolated blind
+        static EP_DAYLT_THREAD_LOCAL Array1D<Real64> TransBmBmMultRefl(MaxSlatAngs); // As above but for beam reflected from exterior obstruction
+        Real64 ProfAng;                                                              // Solar profile angle on a window (radians)
+        Real64 POSFAC;                                                               // Position factor for a window element / ref point / view vector combination
+        Real64 XR;                                                                   // Horizontal displacement ratio
+        Real64 YR;                                                                   // Vertical displacement ratio
+        bool hit;                                                                    // True iff ray from ref point thru window element hits an obstruction
 
         Real64 ObTransDisk; // Product of solar transmittances of exterior obstructions hit by ray
         // from reference point to sun
-        static Vector3<Real64> HP; // Hit coordinates, if ray hits
-        Real64 LumAtHitPtFrSun;    // Luminance at hit point of obstruction by reflection of direct light from
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> HP; // Hit coordinates, if ray hits
+        Real64 LumAtHitPtFrSun;                          // Luminance at hit point of obstruction by reflection of direct light from
         //  sun (cd/m2)
         int ISky; // Sky type index: 1=clear, 2=clear turbid, 3=intermediate, 4=overcast
 
@@ -3523,36 +3898,36 @@ namespace DaylightingManager {
         //  (times light well efficiency, if appropriate)
         Real64 XAVWL; // XAVWL*TVISS is contribution of window luminance from solar disk (cd/m2)
 
-        Real64 SlatAng;                      // Blind slat angle (rad)
-        int NearestHitSurfNum;               // Surface number of nearest obstruction
-        int NearestHitSurfNumX;              // Surface number to use when obstruction is a shadowing surface
-        static Vector3<Real64> NearestHitPt; // Hit point of ray on nearest obstruction
-                                             //		Real64 SunObstructionMult; // = 1.0 if sun hits a ground point; otherwise = 0.0
-        Real64 Alfa;                         // Intermediate variables
-                                             //		Real64 Beta; //Unused
-        static Vector3<Real64> GroundHitPt;  // Coordinates of point that ray hits ground (m)
-        bool hitObs;                         // True iff obstruction is hit
-        static Vector3<Real64> ObsHitPt;     // Coordinates of hit point on an obstruction (m)
-        int ObsConstrNum;                    // Construction number of obstruction
-        Real64 ObsVisRefl;                   // Visible reflectance of obstruction
-        Real64 SkyReflVisLum;                // Reflected sky luminance at hit point divided by
+        Real64 SlatAng;                                            // Blind slat angle (rad)
+        int NearestHitSurfNum;                                     // Surface number of nearest obstruction
+        int NearestHitSurfNumX;                                    // Surface number to use when obstruction is a shadowing surface
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> NearestHitPt; // Hit point of ray on nearest obstruction
+                                                                   //		Real64 SunObstructionMult; // = 1.0 if sun hits a ground point; otherwise = 0.0
+        Real64 Alfa;                                               // Intermediate variables
+                                                                   //		Real64 Beta; //Unused
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> GroundHitPt;  // Coordinates of point that ray hits ground (m)
+        bool hitObs;                                               // True iff obstruction is hit
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> ObsHitPt;     // Coordinates of hit point on an obstruction (m)
+        int ObsConstrNum;                                          // Construction number of obstruction
+        Real64 ObsVisRefl;                                         // Visible reflectance of obstruction
+        Real64 SkyReflVisLum;                                      // Reflected sky luminance at hit point divided by
 
         int RecSurfNum;  // Receiving surface number
         int ReflSurfNum; // Reflecting surface number
         int ReflSurfNumX;
-        static Vector3<Real64> ReflNorm;  // Normal vector to reflecting surface
-        Real64 CosIncAngRefl;             // Cos of angle of incidence of beam on reflecting surface
-        static Vector3<Real64> SunVecMir; // Sun ray mirrored in reflecting surface
-        Real64 CosIncAngRec;              // Cos of angle of incidence of reflected beam on receiving window
-        bool hitRefl;                     // True iff ray hits reflecting surface
-        static Vector3<Real64> HitPtRefl; // Point that ray hits reflecting surface
-        Real64 ReflDistanceSq;            // Distance squared between ref pt and hit point on reflecting surf (m^2)
-        Real64 ReflDistance;              // Distance between ref pt and hit point on reflecting surf (m)
-        bool hitObsRefl;                  // True iff obstruction hit between ref pt and reflection point
-        static Vector3<Real64> HitPtObs;  // Hit point on obstruction
-        int ReflSurfRecNum;               // Receiving surface number for a reflecting window
-        Real64 SpecReflectance;           // Specular reflectance of a reflecting surface
-        Real64 TVisRefl;                  // Bare window vis trans for reflected beam
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> ReflNorm;  // Normal vector to reflecting surface
+        Real64 CosIncAngRefl;                                   // Cos of angle of incidence of beam on reflecting surface
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> SunVecMir; // Sun ray mirrored in reflecting surface
+        Real64 CosIncAngRec;                                    // Cos of angle of incidence of reflected beam on receiving window
+        bool hitRefl;                                           // True iff ray hits reflecting surface
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> HitPtRefl; // Point that ray hits reflecting surface
+        Real64 ReflDistanceSq;                                  // Distance squared between ref pt and hit point on reflecting surf (m^2)
+        Real64 ReflDistance;                                    // Distance between ref pt and hit point on reflecting surf (m)
+        bool hitObsRefl;                                        // True iff obstruction hit between ref pt and reflection point
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> HitPtObs;  // Hit point on obstruction
+        int ReflSurfRecNum;                                     // Receiving surface number for a reflecting window
+        Real64 SpecReflectance;                                 // Specular reflectance of a reflecting surface
+        Real64 TVisRefl;                                        // Bare window vis trans for reflected beam
         //  (times light well efficiency, if appropriate)
         int ConstrNumRefl; // Window construction number for a specularly reflecting shading surf
         Real64 PHSUNrefl;  // Altitude angle of reflected sun (radians)
@@ -3563,9 +3938,9 @@ namespace DaylightingManager {
                             //		bool hitExtObsDisk; // True iff ray from ref pt to sun hits an exterior obstruction //Unused Set but never
                             // used
 
-        static Vector3<Real64> HitPtIntWinDisk; // Intersection point on an interior window for ray from ref pt to sun (m)
-        int IntWinDiskHitNum;                   // Surface number of int window intersected by ray betw ref pt and sun
-        Real64 COSBIntWin;                      // Cos of angle between int win outward normal and ray betw ref pt and
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> HitPtIntWinDisk; // Intersection point on an interior window for ray from ref pt to sun (m)
+        int IntWinDiskHitNum;                                         // Surface number of int window intersected by ray betw ref pt and sun
+        Real64 COSBIntWin;                                            // Cos of angle between int win outward normal and ray betw ref pt and
         //  exterior window element or between ref pt and sun
         Real64 TVisIntWinMult;     // Interior window vis trans multiplier for ext win in adjacent zone
         Real64 TVisIntWinDiskMult; // Interior window vis trans solar disk multiplier for ext win in adj zone
@@ -6085,9 +6460,9 @@ namespace DaylightingManager {
         using ScheduleManager::LookUpScheduleValue;
 
         // Local declarations
-        int IType;                 // Surface type/class:  mirror surfaces of shading surfaces
-        static Vector3<Real64> HP; // Hit coordinates, if ray hits an obstruction
-        bool hit;                  // True iff a particular obstruction is hit
+        int IType;                                       // Surface type/class:  mirror surfaces of shading surfaces
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> HP; // Hit coordinates, if ray hits an obstruction
+        bool hit;                                        // True iff a particular obstruction is hit
 
         ObTrans = 1.0;
 
@@ -6182,9 +6557,9 @@ namespace DaylightingManager {
         assert(magnitude(R2 - R1) > 0.0); // Protect normalize() from divide by zero
 
         // Local declarations
-        int IType;                 // Surface type/class
-        static Vector3<Real64> HP; // Hit coordinates, if ray hits an obstruction
-        static Vector3<Real64> RN; // Unit vector along ray
+        int IType;                                       // Surface type/class
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> HP; // Hit coordinates, if ray hits an obstruction
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> RN; // Unit vector along ray
 
         hit = false;
         RN = (R2 - R1).normalize();         // Make unit vector
@@ -6260,9 +6635,9 @@ namespace DaylightingManager {
         assert(magnitude(R2 - R1) > 0.0); // Protect normalize() from divide by zero
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        int IType;                 // Surface type/class
-        static Vector3<Real64> HP; // Hit coordinates, if ray hits an obstruction surface (m)
-        static Vector3<Real64> RN; // Unit vector along ray from R1 to R2
+        int IType;                                       // Surface type/class
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> HP; // Hit coordinates, if ray hits an obstruction surface (m)
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> RN; // Unit vector along ray from R1 to R2
 
         hit = false;
         RN = (R2 - R1).normalize();         // Unit vector
@@ -6331,6 +6706,52 @@ namespace DaylightingManager {
         }
     }
 
+    bool DayltgZoneLightsAreOff(int const ZoneNum)
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns true when the interior illuminance of a zone can be skipped this time step because no lighting
+        // would be controlled: the DaylightingSkipUnlitZones environment variable is set, the zone uses split flux
+        // daylighting, none of its daylighting windows has shading control (whose glare and setpoint decisions
+        // are made in DayltgInteriorIllum), and every Lights object of the zone is scheduled off.
+
+        // METHODOLOGY EMPLOYED:
+        // The Lights objects and shading controls of each zone are gathered on the first call.  A skipped zone
+        // reports zero illuminance and glare at its reference points, as it does at night.
+
+        if (!DataSystemVariables::DaylightingSkipUnlitZones || ZoneDaylight(ZoneNum).DaylightMethod != SplitFluxDaylighting) return false;
+
+        if (ZoneLightsNums.empty()) {
+            ZoneLightsNums.resize(NumOfZones + 1);
+            for (int LightsNum = 1; LightsNum <= TotLights; ++LightsNum) {
+                ZoneLightsNums[Lights(LightsNum).ZonePtr].push_back(LightsNum);
+            }
+            ZoneHasControlledDaylWindows.assign(NumOfZones + 1, false);
+            for (int ZoneNum2 = 1; ZoneNum2 <= NumOfZones; ++ZoneNum2) {
+                for (int loop = 1; loop <= ZoneDaylight(ZoneNum2).NumOfDayltgExtWins; ++loop) {
+                    if (Surface(ZoneDaylight(ZoneNum2).DayltgExtWinSurfNums(loop)).HasShadeControl) ZoneHasControlledDaylWindows[ZoneNum2] = true;
+                }
+            }
+        }
+        if (ZoneHasControlledDaylWindows[ZoneNum]) return false;
+
+        for (int const LightsNum : ZoneLightsNums[ZoneNum]) {
+            auto const &lights(Lights(LightsNum));
+            if (lights.EMSLightsOn) {
+                if (lights.EMSLightingPower > 0.0) return false;
+            } else if (lights.DesignLevel > 0.0 && GetCurrentScheduleValue(lights.SchedPtr) > 0.0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     void DayltgInteriorIllum(int &ZoneNum) // Zone number
     {
 
@@ -7423,6 +7844,7 @@ namespace DaylightingManager {
         // Based on DOE-2.1E subroutine DLTSYS.
 
         // Using/Aliasing
+        using DataSystemVariables::HourlyIlluminanceMaps;
         using ScheduleManager::GetCurrentScheduleValue;
 
         // Locals
@@ -7541,10 +7963,13 @@ namespace DaylightingManager {
         if (TotIllumMaps > 0 && !DoingSizing && !WarmupFlag) {
             // If an illuminance map is associated with this zone, generate the map
             if (TimeStep == 1) mapResultsToReport = false;
+            // With hourly maps the single evaluation of the hour stands for the whole hour
+            bool const AccumulateMap(EvaluateIllumMapsAtTimeStep());
+            Real64 const MapWeight(HourlyIlluminanceMaps ? 1.0 : 1.0 / double(NumOfTimeStepInHour));
             for (ILM = 1; ILM <= ZoneDaylight(ZoneNum).MapCount; ++ILM) {
                 MapNum = ZoneDaylight(ZoneNum).ZoneToMap(ILM);
                 for (IL = 1; IL <= IllumMapCalc(MapNum).TotalMapRefPoints; ++IL) {
-                    IllumMapCalc(MapNum).DaylIllumAtMapPtHr(IL) += IllumMapCalc(MapNum).DaylIllumAtMapPt(IL) / double(NumOfTimeStepInHour);
+                    if (AccumulateMap) IllumMapCalc(MapNum).DaylIllumAtMapPtHr(IL) += IllumMapCalc(MapNum).DaylIllumAtMapPt(IL) * MapWeight;
                     if (IllumMapCalc(MapNum).DaylIllumAtMapPtHr(IL) > 0.0) {
                         mapResultsToReport = true;
                         mapResultsReported = true;
@@ -7721,17 +8146,17 @@ namespace DaylightingManager {
         // In the following I,J arrays:
         // I = sky type;
         // J = 1 for bare window, 2 and above for window with shade or blind.
-        static Array2D<Real64> FLFWSK(MaxSlatAngs + 1, 4);  // Sky-related downgoing luminous flux
-        static Array1D<Real64> FLFWSU(MaxSlatAngs + 1);     // Sun-related downgoing luminous flux, excluding entering beam
-        static Array1D<Real64> FLFWSUdisk(MaxSlatAngs + 1); // Sun-related downgoing luminous flux, due to entering beam
-        static Array2D<Real64> FLCWSK(MaxSlatAngs + 1, 4);  // Sky-related upgoing luminous flux
-        static Array1D<Real64> FLCWSU(MaxSlatAngs + 1);     // Sun-related upgoing luminous flux
+        static EP_DAYLT_THREAD_LOCAL Array2D<Real64> FLFWSK(MaxSlatAngs + 1, 4);  // Sky-related downgoing luminous flux
+        static EP_DAYLT_THREAD_LOCAL Array1D<Real64> FLFWSU(MaxSlatAngs + 1);     // Sun-related downgoing luminous flux, excluding entering beam
+        static EP_DAYLT_THREAD_LOCAL Array1D<Real64> FLFWSUdisk(MaxSlatAngs + 1); // Sun-related downgoing luminous flux, due to entering beam
+        static EP_DAYLT_THREAD_LOCAL Array2D<Real64> FLCWSK(MaxSlatAngs + 1, 4);  // Sky-related upgoing luminous flux
+        static EP_DAYLT_THREAD_LOCAL Array1D<Real64> FLCWSU(MaxSlatAngs + 1);     // Sun-related upgoing luminous flux
 
         int ISky; // Sky type index: 1=clear, 2=clear turbid,
         //  3=intermediate, 4=overcast
-        static Array1D<Real64> TransMult(MaxSlatAngs);     // Transmittance multiplier
-        static Array1D<Real64> TransBmBmMult(MaxSlatAngs); // Isolated blind beam-beam transmittance
-        Real64 DPH;                                        // Sky/ground element altitude and azimuth increments (radians)
+        static EP_DAYLT_THREAD_LOCAL Array1D<Real64> TransMult(MaxSlatAngs);     // Transmittance multiplier
+        static EP_DAYLT_THREAD_LOCAL Array1D<Real64> TransBmBmMult(MaxSlatAngs); // Isolated blind beam-beam transmittance
+        Real64 DPH;                                                              // Sky/ground element altitude and azimuth increments (radians)
         Real64 DTH;
         int IPH; // Sky/ground element altitude and azimuth indices
         int ITH;
@@ -7751,12 +8176,12 @@ namespace DaylightingManager {
         Real64 COSB;       // Cosine of angle of incidence of light from sky or ground
         Real64 TVISBR;     // Transmittance of window without shading at COSB
         //  (times light well efficiency, if appropriate)
-        static Vector4<Real64> ZSK; // Sky-related and sun-related illuminance on window from sky/ground
+        static EP_DAYLT_THREAD_LOCAL Vector4<Real64> ZSK; // Sky-related and sun-related illuminance on window from sky/ground
         Real64 ZSU;
         //  element for clear and overcast sky
-        static Vector3<Real64> U;                        // Unit vector in (PH,TH) direction
-        Real64 ObTrans;                                  // Product of solar transmittances of obstructions seen by a light ray
-        static Array2D<Real64> ObTransM(NPHMAX, NTHMAX); // ObTrans value for each (TH,PH) direction
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> U;                        // Unit vector in (PH,TH) direction
+        Real64 ObTrans;                                                        // Product of solar transmittances of obstructions seen by a light ray
+        static EP_DAYLT_THREAD_LOCAL Array2D<Real64> ObTransM(NPHMAX, NTHMAX); // ObTrans value for each (TH,PH) direction
         // unused  REAL(r64)         :: HitPointLumFrClearSky     ! Luminance of obstruction from clear sky (cd/m2)
         // unused  REAL(r64)         :: HitPointLumFrOvercSky     ! Luminance of obstruction from overcast sky (cd/m2)
         // unused  REAL(r64)         :: HitPointLumFrSun          ! Luminance of obstruction from sun (cd/m2)
@@ -7806,29 +8231,29 @@ namespace DaylightingManager {
         // unused  REAL(r64)         :: A                         ! Intermediate value for azimuth limits calculation
         Real64 ZSUObsRefl; // Illuminance on window from beam solar reflected by an
         //  obstruction (for unit beam normal illuminance)
-        int NearestHitSurfNum;               // Surface number of nearest obstruction
-        int NearestHitSurfNumX;              // Surface number to use when obstruction is a shadowing surface
-        static Vector3<Real64> NearestHitPt; // Hit point of ray on nearest obstruction (m)
-        Real64 LumAtHitPtFrSun;              // Luminance at hit point on obstruction from solar reflection
+        int NearestHitSurfNum;                                     // Surface number of nearest obstruction
+        int NearestHitSurfNumX;                                    // Surface number to use when obstruction is a shadowing surface
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> NearestHitPt; // Hit point of ray on nearest obstruction (m)
+        Real64 LumAtHitPtFrSun;                                    // Luminance at hit point on obstruction from solar reflection
         //  for unit beam normal illuminance (cd/m2)
-        Real64 SunObstructionMult;                                 // = 1 if sun hits a ground point; otherwise = 0
-        static Array2D<Real64> SkyObstructionMult(NPHMAX, NTHMAX); // Ratio of obstructed to unobstructed sky diffuse at
+        Real64 SunObstructionMult;                                                       // = 1 if sun hits a ground point; otherwise = 0
+        static EP_DAYLT_THREAD_LOCAL Array2D<Real64> SkyObstructionMult(NPHMAX, NTHMAX); // Ratio of obstructed to unobstructed sky diffuse at
         // a ground point for each (TH,PH) direction
         Real64 Alfa; // Direction angles for ray heading towards the ground (radians)
         Real64 Beta;
-        Real64 HorDis;                      // Distance between ground hit point and proj'n of window center onto ground (m)
-        static Vector3<Real64> GroundHitPt; // Coordinates of point that ray from window center hits the ground (m)
-        int ObsSurfNum;                     // Obstruction surface number
-        bool hitObs;                        // True iff obstruction is hit
-        static Vector3<Real64> ObsHitPt;    // Coordinates of hit point on an obstruction (m)
-        int ObsConstrNum;                   // Construction number of obstruction
-        Real64 ObsVisRefl;                  // Visible reflectance of obstruction
-        Real64 SkyReflVisLum;               // Reflected sky luminance at hit point divided by unobstructed sky
+        Real64 HorDis;                                            // Distance between ground hit point and proj'n of window center onto ground (m)
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> GroundHitPt; // Coordinates of point that ray from window center hits the ground (m)
+        int ObsSurfNum;                                           // Obstruction surface number
+        bool hitObs;                                              // True iff obstruction is hit
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> ObsHitPt;    // Coordinates of hit point on an obstruction (m)
+        int ObsConstrNum;                                         // Construction number of obstruction
+        Real64 ObsVisRefl;                                        // Visible reflectance of obstruction
+        Real64 SkyReflVisLum;                                     // Reflected sky luminance at hit point divided by unobstructed sky
         //  diffuse horizontal illuminance [(cd/m2)/lux]
         Real64 dReflObsSky; // Contribution to sky-related illuminance on window due to sky diffuse
         //  reflection from an obstruction
-        static Vector3<Real64> URay; // Unit vector in (Phi,Theta) direction
-        Real64 TVisSunRefl;          // Diffuse vis trans of bare window for beam reflection calc
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> URay; // Unit vector in (Phi,Theta) direction
+        Real64 TVisSunRefl;                                // Diffuse vis trans of bare window for beam reflection calc
         //  (times light well efficiency, if appropriate)
         Real64 ZSU1refl; // Beam normal illuminance times ZSU1refl = illuminance on window
         //  due to specular reflection from exterior surfaces
@@ -8821,7 +9246,6 @@ namespace DaylightingManager {
 
         Real64 LambdaInc; // current lambda value for incoming direction
         // REAL(r64) :: LambdaTrn  ! current lambda value for incoming direction
-        Real64 dirTrans; // directional bsdf transmittance
         Real64 ZoneInsideSurfArea;
 
         CurCplxFenState = SurfaceWindow(IWin).ComplexFen.CurrentState;
@@ -8865,19 +9289,30 @@ namespace DaylightingManager {
         FFSKTot = 0.0;
         FFSUTot = 0.0;
         FFSUdiskTot = 0.0;
-        // now calculate flux into each outgoing direction by integrating over all incoming directions
-        for (iBackElem = 1; iBackElem <= NTrnBasis; ++iBackElem) {
-            for (iIncElem = 1; iIncElem <= NIncBasis; ++iIncElem) {
-                LambdaInc = ComplexWind(IWin).Geom(CurCplxFenState).Inc.Lamda(iIncElem);
-                dirTrans = Construct(iConst).BSDFInput.VisFrtTrans(iBackElem, iIncElem);
-
-                for (iSky = 1; iSky <= 4; ++iSky) {
-                    FLSK(iSky, iBackElem) += dirTrans * LambdaInc * ElementLuminanceSky(iSky, iIncElem);
-                }
+        // now calculate flux into each outgoing direction by integrating over all incoming directions: one product of the
+        // transmittance matrix with the lambda-weighted luminances of the four skies, the sun and the sun disk
+        auto const &VisFrtTrans(Construct(iConst).BSDFInput.VisFrtTrans);
+        Eigen::Matrix<Real64, Eigen::Dynamic, 6> WeightedLuminance(NIncBasis, 6);
+        for (iIncElem = 1; iIncElem <= NIncBasis; ++iIncElem) {
+            LambdaInc = ComplexWind(IWin).Geom(CurCplxFenState).Inc.Lamda(iIncElem);
+            for (iSky = 1; iSky <= 4; ++iSky) {
+                WeightedLuminance(iIncElem - 1, iSky - 1) = LambdaInc * ElementLuminanceSky(iSky, iIncElem);
+            }
+            WeightedLuminance(iIncElem - 1, 4) = LambdaInc * ElementLuminanceSun(iIncElem);
+            WeightedLuminance(iIncElem - 1, 5) = LambdaInc * ElementLuminanceSunDisk(iIncElem);
+        }
+        Eigen::Matrix<Real64, Eigen::Dynamic, 6> TransmittedFlux =
+            Eigen::Map<Eigen::Matrix<Real64, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> const>(
+                VisFrtTrans.data(), VisFrtTrans.isize1(), VisFrtTrans.isize2())
+                .topLeftCorner(NTrnBasis, NIncBasis) *
+            WeightedLuminance;
 
-                FLSU(iBackElem) += dirTrans * LambdaInc * ElementLuminanceSun(iIncElem);
-                FLSUdisk(iBackElem) += dirTrans * LambdaInc * ElementLuminanceSunDisk(iIncElem);
+        for (iBackElem = 1; iBackElem <= NTrnBasis; ++iBackElem) {
+            for (iSky = 1; iSky <= 4; ++iSky) {
+                FLSK(iSky, iBackElem) = TransmittedFlux(iBackElem - 1, iSky - 1);
             }
+            FLSU(iBackElem) = TransmittedFlux(iBackElem - 1, 4);
+            FLSUdisk(iBackElem) = TransmittedFlux(iBackElem - 1, 5);
 
             for (iSky = 1; iSky <= 4; ++iSky) {
                 FirstFluxSK(iSky, iBackElem) = FLSK(iSky, iBackElem) * ComplexWind(IWin).Geom(CurCplxFenState).AveRhoVisOverlap(iBackElem);
@@ -9300,16 +9735,16 @@ namespace DaylightingManager {
         // DERIVED TYPE DEFINITIONS: na
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        Real64 ElevSun;                  // Sun elevation; angle between sun and horizontal (radians)
-        Real64 ElevWin;                  // Window elevation: angle between window outward normal and horizontal (radians)
-        Real64 AzimWin;                  // Window azimuth (radians)
-        Real64 AzimSun;                  // Sun azimuth (radians)
-        static Vector3<Real64> WinNorm;  // Window outward normal unit vector
-        Real64 ThWin;                    // Azimuth angle of WinNorm
-        static Vector3<Real64> SunPrime; // Projection of sun vector onto plane (perpendicular to
+        Real64 ElevSun;                                        // Sun elevation; angle between sun and horizontal (radians)
+        Real64 ElevWin;                                        // Window elevation: angle between window outward normal and horizontal (radians)
+        Real64 AzimWin;                                        // Window azimuth (radians)
+        Real64 AzimSun;                                        // Sun azimuth (radians)
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> WinNorm;  // Window outward normal unit vector
+        Real64 ThWin;                                          // Azimuth angle of WinNorm
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> SunPrime; // Projection of sun vector onto plane (perpendicular to
         //  window plane) determined by WinNorm and vector along
         //  baseline of window
-        static Vector3<Real64> WinNormCrossBase; // Cross product of WinNorm and vector along window baseline
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> WinNormCrossBase; // Cross product of WinNorm and vector along window baseline
         //  INTEGER            :: IComp             ! Vector component index
 
         // FLOW:
@@ -9380,8 +9815,8 @@ namespace DaylightingManager {
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
         // na
-        static Vector3<Real64> HitPt; // Hit point on an obstruction (m)
-        bool hit;                     // True iff obstruction is hit
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> HitPt; // Hit point on an obstruction (m)
+        bool hit;                                           // True iff obstruction is hit
 
         // FLOW:
 
@@ -9494,12 +9929,12 @@ namespace DaylightingManager {
         // na
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        static Vector3<Real64> ReflNorm; // Unit normal to reflecting surface (m)
-        int ObsSurfNum;                  // Obstruction surface number
-        bool hitObs;                     // True iff obstruction is hit
-        static Vector3<Real64> ObsHitPt; // Hit point on obstruction (m)
-        Real64 CosIncAngAtHitPt;         // Cosine of angle of incidence of sun at HitPt
-        Real64 DiffVisRefl;              // Diffuse visible reflectance of ReflSurfNum
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> ReflNorm; // Unit normal to reflecting surface (m)
+        int ObsSurfNum;                                        // Obstruction surface number
+        bool hitObs;                                           // True iff obstruction is hit
+        static EP_DAYLT_THREAD_LOCAL Vector3<Real64> ObsHitPt; // Hit point on obstruction (m)
+        Real64 CosIncAngAtHitPt;                               // Cosine of angle of incidence of sun at HitPt
+        Real64 DiffVisRefl;                                    // Diffuse visible reflectance of ReflSurfNum
 
         // FLOW:
 
@@ -9546,6 +9981,22 @@ namespace DaylightingManager {
         LumAtReflHitPtFrSun = CosIncAngAtHitPt * DiffVisRefl / Pi;
     }
 
+    bool EvaluateIllumMapsAtTimeStep()
+    {
+
+        // FUNCTION INFORMATION:
+        //       DATE WRITTEN   October 2026
+
+        // PURPOSE OF THIS FUNCTION:
+        // Illuminance maps are only reported hourly.  With HourlyIlluminanceMaps they are figured once per hour,
+        // at the time step nearest the middle of the hour, and that value is reported for the hour instead of
+        // the average over all time steps.
+
+        using DataSystemVariables::HourlyIlluminanceMaps;
+
+        return !HourlyIlluminanceMaps || TimeStep == (NumOfTimeStepInHour + 1) / 2;
+    }
+
     void DayltgInteriorMapIllum(int &ZoneNum) // Zone number
     {
 
@@ -9565,6 +10016,7 @@ namespace DaylightingManager {
         //                        daylight illum at ref pt was calculated as though it was off
         //                      June 2009, TH: modified for thermochromic windows
         //                      March 2010, TH: fix bug (CR 8057) for electrochromic windows
+        //                      October 2026: skip time steps that hourly illuminance maps do not evaluate
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -9652,6 +10104,7 @@ namespace DaylightingManager {
         }
 
         if (WarmupFlag) return;
+        if (!EvaluateIllumMapsAtTimeStep()) return;
         //              Initialize reference point illuminance and window background luminance
 
         for (ILM = 1; ILM <= ZoneDaylight(ZoneNum).MapCount; ++ILM) {
@@ -60,6 +60,13 @@
 #include <DataBSDFWindow.hh>
 #include <EnergyPlus.hh>
 
+// The daylight factor work buffers are thread local in OpenMP builds so that CalcDayltgCoeffsMapPoints can process several map points at once
+#ifdef _OPENMP
+#define EP_DAYLT_THREAD_LOCAL thread_local
+#else
+#define EP_DAYLT_THREAD_LOCAL
+#endif
+
 namespace EnergyPlus {
 
 namespace DaylightingManager {
@@ -73,41 +80,41 @@ namespace DaylightingManager {
     extern int const octreeCrossover; // Surface count crossover for switching to octree algorithm
 
     // MODULE VARIABLE DECLARATIONS:
-    extern int TotWindowsWithDayl;    // Total number of exterior windows in all daylit zones
-    extern int OutputFileDFS;         // Unit number for daylight factors
-    extern Array1D<Real64> DaylIllum; // Daylight illuminance at reference points (lux)
-    extern int maxNumRefPtInAnyZone;  // The most number of reference points that any single zone has
-    extern Real64 PHSUN;              // Solar altitude (radians)
-    extern Real64 SPHSUN;             // Sine of solar altitude
-    extern Real64 CPHSUN;             // Cosine of solar altitude
-    extern Real64 THSUN;              // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
-    extern Array1D<Real64> PHSUNHR;   // Hourly values of PHSUN
-    extern Array1D<Real64> SPHSUNHR;  // Hourly values of the sine of PHSUN
-    extern Array1D<Real64> CPHSUNHR;  // Hourly values of the cosine of PHSUN
-    extern Array1D<Real64> THSUNHR;   // Hourly values of THSUN
+    extern int TotWindowsWithDayl;              // Total number of exterior windows in all daylit zones
+    extern int OutputFileDFS;                   // Unit number for daylight factors
+    extern Array1D<Real64> DaylIllum;           // Daylight illuminance at reference points (lux)
+    extern int maxNumRefPtInAnyZone;            // The most number of reference points that any single zone has
+    extern EP_DAYLT_THREAD_LOCAL Real64 PHSUN;  // Solar altitude (radians)
+    extern EP_DAYLT_THREAD_LOCAL Real64 SPHSUN; // Sine of solar altitude
+    extern EP_DAYLT_THREAD_LOCAL Real64 CPHSUN; // Cosine of solar altitude
+    extern EP_DAYLT_THREAD_LOCAL Real64 THSUN;  // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
+    extern Array1D<Real64> PHSUNHR;             // Hourly values of PHSUN
+    extern Array1D<Real64> SPHSUNHR;            // Hourly values of the sine of PHSUN
+    extern Array1D<Real64> CPHSUNHR;            // Hourly values of the cosine of PHSUN
+    extern Array1D<Real64> THSUNHR;             // Hourly values of THSUN
 
     // In the following I,J,K arrays:
     // I = 1 for clear sky, 2 for clear turbid, 3 for intermediate, 4 for overcast;
     // J = 1 for bare window, 2 - 12 for shaded;
     // K = sun position index.
-    extern Array3D<Real64> EINTSK; // Sky-related portion of internally reflected illuminance
-    extern Array2D<Real64> EINTSU; // Sun-related portion of internally reflected illuminance,
+    extern EP_DAYLT_THREAD_LOCAL Array3D<Real64> EINTSK; // Sky-related portion of internally reflected illuminance
+    extern EP_DAYLT_THREAD_LOCAL Array2D<Real64> EINTSU; // Sun-related portion of internally reflected illuminance,
     // excluding entering beam
-    extern Array2D<Real64> EINTSUdisk; // Sun-related portion of internally reflected illuminance
+    extern EP_DAYLT_THREAD_LOCAL Array2D<Real64> EINTSUdisk; // Sun-related portion of internally reflected illuminance
     // due to entering beam
-    extern Array3D<Real64> WLUMSK;     // Sky-related window luminance
-    extern Array2D<Real64> WLUMSU;     // Sun-related window luminance, excluding view of solar disk
-    extern Array2D<Real64> WLUMSUdisk; // Sun-related window luminance, due to view of solar disk
+    extern EP_DAYLT_THREAD_LOCAL Array3D<Real64> WLUMSK;     // Sky-related window luminance
+    extern EP_DAYLT_THREAD_LOCAL Array2D<Real64> WLUMSU;     // Sun-related window luminance, excluding view of solar disk
+    extern EP_DAYLT_THREAD_LOCAL Array2D<Real64> WLUMSUdisk; // Sun-related window luminance, due to view of solar disk
 
     extern Array2D<Real64> GILSK; // Horizontal illuminance from sky, by sky type, for each hour of the day
     extern Array1D<Real64> GILSU; // Horizontal illuminance from sun for each hour of the day
 
-    extern Array3D<Real64> EDIRSK;     // Sky-related component of direct illuminance
-    extern Array2D<Real64> EDIRSU;     // Sun-related component of direct illuminance (excluding beam solar at ref pt)
-    extern Array2D<Real64> EDIRSUdisk; // Sun-related component of direct illuminance due to beam solar at ref pt
-    extern Array3D<Real64> AVWLSK;     // Sky-related average window luminance
-    extern Array2D<Real64> AVWLSU;     // Sun-related average window luminance, excluding view of solar disk
-    extern Array2D<Real64> AVWLSUdisk; // Sun-related average window luminance due to view of solar disk
+    extern EP_DAYLT_THREAD_LOCAL Array3D<Real64> EDIRSK;     // Sky-related component of direct illuminance
+    extern EP_DAYLT_THREAD_LOCAL Array2D<Real64> EDIRSU;     // Sun-related component of direct illuminance (excluding beam solar at ref pt)
+    extern EP_DAYLT_THREAD_LOCAL Array2D<Real64> EDIRSUdisk; // Sun-related component of direct illuminance due to beam solar at ref pt
+    extern EP_DAYLT_THREAD_LOCAL Array3D<Real64> AVWLSK;     // Sky-related average window luminance
+    extern EP_DAYLT_THREAD_LOCAL Array2D<Real64> AVWLSU;     // Sun-related average window luminance, excluding view of solar disk
+    extern EP_DAYLT_THREAD_LOCAL Array2D<Real64> AVWLSUdisk; // Sun-related average window luminance due to view of solar disk
 
     // Allocatable daylight factor arrays  -- are in the ZoneDaylight Structure
 
@@ -131,10 +138,25 @@ namespace DaylightingManager {
 
     void CalcDayltgCoeffsRefMapPoints(int const ZoneNum);
 
+    std::string DaylightingCacheFileName();
+
+    bool ReadDaylightingCache(std::string const &FileName);
+
+    void WriteDaylightingCache(std::string const &FileName);
+
     void CalcDayltgCoeffsRefPoints(int const ZoneNum);
 
     void CalcDayltgCoeffsMapPoints(int const ZoneNum);
 
+    bool MapPointsCanBeThreaded(int const ZoneNum);
+
+    void FigureDayltgCoeffsAtMapPoint(int const ZoneNum,
+                                      int const MapNum,              // Illuminance map number
+                                      int const IL,                  // Map point number
+                                      Vector3<Real64> const &VIEWVC, // View vector in absolute coordinate system
+                                      Real64 const AZVIEW            // Azimuth of view vector in absolute coord system for glare calculation (radians)
+    );
+
     void FigureDayltgCoeffsAtPointsSetupForWindow(int const ZoneNum,
                                                   int const iRefPoint,
                                                   int const loopwin,
@@ -385,6 +407,8 @@ namespace DaylightingManager {
                                     bool &hit                  // True iff ray hits an obstruction
     );
 
+    bool DayltgZoneLightsAreOff(int const ZoneNum);
+
     void DayltgInteriorIllum(int &ZoneNum); // Zone number
 
     void DayltgInteriorTDDIllum();
@@ -460,6 +484,8 @@ namespace DaylightingManager {
                                  Real64 &LumAtReflHitPtFrSun       // Luminance at ReflHitPt from beam solar reflection for unit
     );
 
+    bool EvaluateIllumMapsAtTimeStep();
+
     void DayltgInteriorMapIllum(int &ZoneNum); // Zone number
 
     void ReportIllumMap(int const MapNum);
@@ -133,6 +133,11 @@ namespace DemandManager {
     int DemandManagerHVACIterations(0);
     bool GetInput(true); // Flag to prevent input from being read multiple times
 
+    namespace {
+        // The load survey only matters to a list that is over its limit, so it is deferred until one is found
+        bool SurveyPending(true); // TRUE until SurveyDemandManagers has run in the current demand pass
+    } // namespace
+
     // SUBROUTINE SPECIFICATIONS:
 
     // Object Data
@@ -154,6 +159,7 @@ namespace DemandManager {
         DemandManagerHBIterations = 0;
         DemandManagerHVACIterations = 0;
         GetInput = true;
+        SurveyPending = true;
         DemandManagerList.deallocate();
         DemandMgr.deallocate();
         UniqueDemandMgrNames.clear();
@@ -247,7 +253,7 @@ namespace DemandManager {
                     ResimHB = false;
                     ResimHVAC = false;
 
-                    SurveyDemandManagers(); // Determines which Demand Managers can reduce demand
+                    SurveyPending = true; // Which Demand Managers can reduce demand is determined when a list first needs it
 
                     for (ListNum = 1; ListNum <= NumDemandManagerList; ++ListNum) {
                         SimulateDemandManagerList(ListNum, ResimExt, ResimHB, ResimHVAC);
@@ -280,6 +286,7 @@ namespace DemandManager {
         //       AUTHOR         Peter Graham Ellis
         //       DATE WRITTEN   July 2005
         //       MODIFIED       Simon Vidanovic (March 2015) - Introduced DemandManager:Ventilation
+        //                      October 2026, survey the loads only once a list is over its limit
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -328,6 +335,11 @@ namespace DemandManager {
 
             if (OverLimit > 0.0) {
 
+                if (SurveyPending) {
+                    SurveyDemandManagers(); // Determines which Demand Managers can reduce demand
+                    SurveyPending = false;
+                }
+
                 {
                     auto const SELECT_CASE_var(DemandManagerList(ListNum).ManagerPriority);
 
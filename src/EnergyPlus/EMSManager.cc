@@ -65,12 +65,14 @@
 #include <DataRuntimeLanguage.hh>
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataTimings.hh>
 #include <DataZoneControls.hh>
 #include <EMSManager.hh>
 #include <General.hh>
 #include <InputProcessing/InputProcessor.hh>
 #include <OutAirNodeManager.hh>
 #include <OutputProcessor.hh>
+#include <RuntimeExchange.hh>
 #include <RuntimeLanguageProcessor.hh>
 #include <ScheduleManager.hh>
 #include <UtilityRoutines.hh>
@@ -119,6 +121,8 @@ namespace EMSManager {
     bool GetEMSUserInput(true); // Flag to prevent input from being read multiple times
     bool ZoneThermostatActuatorsHaveBeenSetup(false);
     bool FinishProcessingUserInput(true); // Flag to indicate still need to process input
+    bool SensorsByCallingPointHaveBeenSetup(false); // Flag to collect the sensors used at each calling point once
+    bool ActuatorTargetsAreCurrent(false);          // Flag to rebuild EMSActuatorTarget after actuators are matched
 
     // SUBROUTINE SPECIFICATIONS:
 
@@ -128,6 +132,8 @@ namespace EMSManager {
         GetEMSUserInput = true;
         ZoneThermostatActuatorsHaveBeenSetup = false;
         FinishProcessingUserInput = true;
+        SensorsByCallingPointHaveBeenSetup = false;
+        ActuatorTargetsAreCurrent = false;
     }
 
     void CheckIfAnyEMS()
@@ -218,7 +224,8 @@ namespace EMSManager {
              NumEMSOutputVariables + NumEMSCurveIndices + NumExternalInterfaceGlobalVariables + NumExternalInterfaceActuatorsUsed +
              NumEMSConstructionIndices + NumEMSMeteredOutputVariables + NumExternalInterfaceFunctionalMockupUnitImportActuatorsUsed +
              NumExternalInterfaceFunctionalMockupUnitImportGlobalVariables + NumExternalInterfaceFunctionalMockupUnitExportActuatorsUsed +
-             NumExternalInterfaceFunctionalMockupUnitExportGlobalVariables + NumOutputEMSs) > 0) {
+             NumExternalInterfaceFunctionalMockupUnitExportGlobalVariables + NumOutputEMSs) > 0 ||
+            RuntimeExchange::AnyCallbacks()) {
             AnyEnergyManagementSystemInModel = true;
         } else {
             AnyEnergyManagementSystemInModel = false;
@@ -286,18 +293,15 @@ namespace EMSManager {
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-        int ErlVariableNum;    // local index
         int ProgramManagerNum; // local index and loop
         int ErlProgramNum;     // local index
-        int ActuatorUsedLoop;  // local loop
-        int EMSActuatorVariableNum;
 
-        int tmpInteger;
         //  INTEGER  :: ProgramNum
 
         // FLOW:
         anyProgramRan = false;
         if (!AnyEnergyManagementSystemInModel) return; // quick return if nothing to do
+        EP_TIMER_SCOPE("ManageEMS");
 
         if (iCalledFrom == emsCallFromBeginNewEvironment) BeginEnvrnInitializeRuntimeLanguage();
 
@@ -320,6 +324,8 @@ namespace EMSManager {
                     }
                 }
             }
+            // host programs registered through the runtime exchange API run after the Erl programs
+            if (RuntimeExchange::RunCallbacks(iCalledFrom)) anyProgramRan = true;
         } else { // call specific program manager
             if (present(ProgramManagerToRun)) {
                 for (ErlProgramNum = 1; ErlProgramNum <= EMSProgramCallManager(ProgramManagerToRun).NumErlPrograms; ++ErlProgramNum) {
@@ -335,44 +341,28 @@ namespace EMSManager {
 
         if (!anyProgramRan) return;
 
-        // Set actuated variables with new values
-        for (ActuatorUsedLoop = 1;
-             ActuatorUsedLoop <= numActuatorsUsed + NumExternalInterfaceActuatorsUsed + NumExternalInterfaceFunctionalMockupUnitImportActuatorsUsed +
-                                     NumExternalInterfaceFunctionalMockupUnitExportActuatorsUsed;
-             ++ActuatorUsedLoop) {
-            ErlVariableNum = EMSActuatorUsed(ActuatorUsedLoop).ErlVariableNum;
-            if (!(ErlVariableNum > 0)) continue; // this can happen for good reason during sizing
-
-            EMSActuatorVariableNum = EMSActuatorUsed(ActuatorUsedLoop).ActuatorVariableNum;
-            if (!(EMSActuatorVariableNum > 0)) continue; // this can happen for good reason during sizing
-
-            if (ErlVariable(ErlVariableNum).Value.Type == ValueNull) {
-                EMSActuatorAvailable(EMSActuatorVariableNum).Actuated = false;
-            } else {
-                // Set the value and the actuated flag remotely on the actuated object via the pointer
-                {
-                    auto const SELECT_CASE_var(EMSActuatorAvailable(EMSActuatorVariableNum).PntrVarTypeUsed);
+        if (!ActuatorTargetsAreCurrent) {
+            SetupActuatorTargets();
+            ActuatorTargetsAreCurrent = true;
+        }
 
-                    if (SELECT_CASE_var == PntrReal) {
-                        EMSActuatorAvailable(EMSActuatorVariableNum).Actuated = true;
-                        EMSActuatorAvailable(EMSActuatorVariableNum).RealValue = ErlVariable(ErlVariableNum).Value.Number;
-                    } else if (SELECT_CASE_var == PntrInteger) {
-                        EMSActuatorAvailable(EMSActuatorVariableNum).Actuated = true;
-                        tmpInteger = std::floor(ErlVariable(ErlVariableNum).Value.Number);
-                        EMSActuatorAvailable(EMSActuatorVariableNum).IntValue = tmpInteger;
-                    } else if (SELECT_CASE_var == PntrLogical) {
-                        EMSActuatorAvailable(EMSActuatorVariableNum).Actuated = true;
-                        if (ErlVariable(ErlVariableNum).Value.Number == 0.0) {
-                            EMSActuatorAvailable(EMSActuatorVariableNum).LogValue = false;
-                        } else if (ErlVariable(ErlVariableNum).Value.Number == 1.0) {
-                            EMSActuatorAvailable(EMSActuatorVariableNum).LogValue = true;
-                        } else {
-                            EMSActuatorAvailable(EMSActuatorVariableNum).LogValue = false;
-                        }
+        // Set actuated variables with new values, remotely on the actuated objects via the pointers
+        for (auto const &thisTarget : EMSActuatorTarget) {
+            ErlValueType const &thisValue = ErlVariable(thisTarget.ErlVariableNum).Value;
+            if (thisValue.Type == ValueNull) {
+                *thisTarget.Actuated = false;
+                continue;
+            }
 
-                    } else {
-                    }
-                }
+            if (thisTarget.PntrVarTypeUsed == PntrReal) {
+                *thisTarget.Actuated = true;
+                *thisTarget.RealValue = thisValue.Number;
+            } else if (thisTarget.PntrVarTypeUsed == PntrInteger) {
+                *thisTarget.Actuated = true;
+                *thisTarget.IntValue = std::floor(thisValue.Number);
+            } else if (thisTarget.PntrVarTypeUsed == PntrLogical) {
+                *thisTarget.Actuated = true;
+                *thisTarget.LogValue = (thisValue.Number == 1.0);
             }
         }
 
@@ -425,7 +415,6 @@ namespace EMSManager {
 
         int InternalVarUsedNum; // local index and loop
         int InternVarAvailNum;  // local index
-        int SensorNum;          // local loop and index
         int ErlVariableNum;     // local index
         Real64 tmpReal;         // temporary local integer
 
@@ -486,8 +475,16 @@ namespace EMSManager {
             }
         }
 
-        // Update sensors with current data
-        for (SensorNum = 1; SensorNum <= NumSensors; ++SensorNum) {
+        if (!SensorsByCallingPointHaveBeenSetup) {
+            SetupSensorsByCallingPoint();
+            SensorsByCallingPointHaveBeenSetup = true;
+        }
+
+        // Update sensors with current data, only those read by the programs at this calling point or reported every call
+        auto const CallingPointSensors = SensorsByCallingPoint.find(iCalledFrom);
+        std::vector<int> const &SensorsToUpdate =
+            (CallingPointSensors != SensorsByCallingPoint.end()) ? CallingPointSensors->second : SensorsAtAllCallingPoints;
+        for (int const SensorNum : SensorsToUpdate) {
             ErlVariableNum = Sensor(SensorNum).VariableNum;
             if ((ErlVariableNum > 0) && (Sensor(SensorNum).Index > 0)) {
                 if (Sensor(SensorNum).SchedNum == 0) { // not a schedule so get from output processor
@@ -503,6 +500,111 @@ namespace EMSManager {
         }
     }
 
+    void SetupSensorsByCallingPoint()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Collect the EMS sensors that need to be refreshed at each calling point, so InitEMS does not query
+        // every sensor at calling points whose programs never read them.
+
+        // METHODOLOGY EMPLOYED:
+        // A sensor is refreshed at a calling point if any Erl program run there, or any subroutine those programs
+        // run, uses its Erl variable.  Sensors whose variables are reported as EMS output variables or logged by
+        // trend variables are refreshed at every calling point as before.  Calling points with no programs only
+        // refresh those.
+
+        using RuntimeLanguageProcessor::MarkStackVariables;
+        using RuntimeLanguageProcessor::RuntimeReportVar;
+
+        SensorsByCallingPoint.clear();
+        SensorsAtAllCallingPoints.clear();
+
+        Array1D_bool UsedEveryCall(NumErlVariables, false);
+        for (int RuntimeReportVarNum = 1; RuntimeReportVarNum <= NumEMSOutputVariables + NumEMSMeteredOutputVariables; ++RuntimeReportVarNum) {
+            int const VariableNum = RuntimeReportVar(RuntimeReportVarNum).VariableNum;
+            if (VariableNum > 0 && VariableNum <= NumErlVariables) UsedEveryCall(VariableNum) = true;
+        }
+        for (int TrendNum = 1; TrendNum <= NumErlTrendVariables; ++TrendNum) {
+            int const VariableNum = TrendVariable(TrendNum).ErlVariablePointer;
+            if (VariableNum > 0 && VariableNum <= NumErlVariables) UsedEveryCall(VariableNum) = true;
+        }
+        for (int SensorNum = 1; SensorNum <= NumSensors; ++SensorNum) {
+            int const VariableNum = Sensor(SensorNum).VariableNum;
+            if (VariableNum > 0 && VariableNum <= NumErlVariables && UsedEveryCall(VariableNum)) SensorsAtAllCallingPoints.push_back(SensorNum);
+        }
+
+        for (int ProgramManagerNum = 1; ProgramManagerNum <= NumProgramCallManagers; ++ProgramManagerNum) {
+            int const CallingPoint = EMSProgramCallManager(ProgramManagerNum).CallingPoint;
+            if (SensorsByCallingPoint.find(CallingPoint) != SensorsByCallingPoint.end()) continue; // already collected
+
+            Array1D_bool VariableUsed(UsedEveryCall);
+            Array1D_bool StackVisited(NumErlStacks, false);
+            for (int ManagerNum = ProgramManagerNum; ManagerNum <= NumProgramCallManagers; ++ManagerNum) {
+                if (EMSProgramCallManager(ManagerNum).CallingPoint != CallingPoint) continue;
+                for (int ErlProgramNum = 1; ErlProgramNum <= EMSProgramCallManager(ManagerNum).NumErlPrograms; ++ErlProgramNum) {
+                    MarkStackVariables(EMSProgramCallManager(ManagerNum).ErlProgramARR(ErlProgramNum), VariableUsed, StackVisited);
+                }
+            }
+
+            std::vector<int> &CallingPointSensors = SensorsByCallingPoint[CallingPoint];
+            for (int SensorNum = 1; SensorNum <= NumSensors; ++SensorNum) {
+                int const VariableNum = Sensor(SensorNum).VariableNum;
+                if (VariableNum > 0 && VariableNum <= NumErlVariables && VariableUsed(VariableNum)) CallingPointSensors.push_back(SensorNum);
+            }
+        }
+    }
+
+    void SetupActuatorTargets()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Build the dense table of actuators applied after the Erl programs run.
+
+        // METHODOLOGY EMPLOYED:
+        // Only actuators matched to an Erl variable and an available actuator are kept, with the pointers taken out of
+        // their EMSActuatorAvailable references.  The EMSActuatorUsed order is kept so that when two actuators drive
+        // the same data the last one still wins.  ProcessEMSInput clears ActuatorTargetsAreCurrent so the table is
+        // rebuilt once more actuators are matched.
+
+        EMSActuatorTarget.clear();
+        int const NumActuatorsUsed = numActuatorsUsed + NumExternalInterfaceActuatorsUsed +
+                                     NumExternalInterfaceFunctionalMockupUnitImportActuatorsUsed +
+                                     NumExternalInterfaceFunctionalMockupUnitExportActuatorsUsed;
+        for (int ActuatorUsedLoop = 1; ActuatorUsedLoop <= NumActuatorsUsed; ++ActuatorUsedLoop) {
+            int const ErlVariableNum = EMSActuatorUsed(ActuatorUsedLoop).ErlVariableNum;
+            if (!(ErlVariableNum > 0)) continue; // this can happen for good reason during sizing
+
+            int const EMSActuatorVariableNum = EMSActuatorUsed(ActuatorUsedLoop).ActuatorVariableNum;
+            if (!(EMSActuatorVariableNum > 0)) continue; // this can happen for good reason during sizing
+
+            auto &thisActuator = EMSActuatorAvailable(EMSActuatorVariableNum);
+            EMSActuatorTargetType thisTarget;
+            thisTarget.ErlVariableNum = ErlVariableNum;
+            thisTarget.PntrVarTypeUsed = thisActuator.PntrVarTypeUsed;
+            thisTarget.Actuated = &thisActuator.Actuated();
+            if (thisActuator.PntrVarTypeUsed == PntrReal) {
+                thisTarget.RealValue = &thisActuator.RealValue();
+            } else if (thisActuator.PntrVarTypeUsed == PntrInteger) {
+                thisTarget.IntValue = &thisActuator.IntValue();
+            } else if (thisActuator.PntrVarTypeUsed == PntrLogical) {
+                thisTarget.LogValue = &thisActuator.LogValue();
+            }
+            EMSActuatorTarget.push_back(thisTarget);
+        }
+    }
+
     void ReportEMS()
     {
 
@@ -1086,6 +1188,8 @@ namespace EMSManager {
         int InternalVarAvailNum; // local do loop index
         std::string cCurrentModuleObject;
 
+        ActuatorTargetsAreCurrent = false; // actuators may be matched below
+
         cCurrentModuleObject = "EnergyManagementSystem:Sensor";
         for (SensorNum = 1; SensorNum <= NumSensors; ++SensorNum) {
             if (Sensor(SensorNum).CheckedOkay) continue;
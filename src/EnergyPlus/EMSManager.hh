@@ -80,6 +80,8 @@ namespace EMSManager {
     extern bool GetEMSUserInput; // Flag to prevent input from being read multiple times
     extern bool ZoneThermostatActuatorsHaveBeenSetup;
     extern bool FinishProcessingUserInput; // Flag to indicate still need to process input
+    extern bool SensorsByCallingPointHaveBeenSetup; // Flag to collect the sensors used at each calling point once
+    extern bool ActuatorTargetsAreCurrent;          // Flag to rebuild EMSActuatorTarget after actuators are matched
 
     // SUBROUTINE SPECIFICATIONS:
 
@@ -97,6 +99,10 @@ namespace EMSManager {
 
     void InitEMS(int const iCalledFrom); // indicates where subroutine was called from, parameters in DataGlobals.
 
+    void SetupSensorsByCallingPoint();
+
+    void SetupActuatorTargets();
+
     void ReportEMS();
 
     void GetEMSInput();
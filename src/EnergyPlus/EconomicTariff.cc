@@ -848,6 +848,21 @@ namespace EconomicTariff {
                 tariff(iInObj).resourceNum = AssignResourceTypeNum(EnergyMeters(tariff(iInObj).reportMeterIndx).ResourceType);
             }
         }
+        // tariffs that would gather identical values share the gathering of the first of them
+        for (iInObj = 1; iInObj <= numTariff; ++iInObj) {
+            tariff(iInObj).gatherTariff = iInObj;
+            for (int jTariff = 1; jTariff < iInObj; ++jTariff) {
+                if ((tariff(jTariff).gatherTariff == jTariff) && (tariff(jTariff).reportMeterIndx == tariff(iInObj).reportMeterIndx) &&
+                    (tariff(jTariff).demWinTime == tariff(iInObj).demWinTime) && (tariff(jTariff).energyConv == tariff(iInObj).energyConv) &&
+                    (tariff(jTariff).demandConv == tariff(iInObj).demandConv) &&
+                    (tariff(jTariff).seasonSchIndex == tariff(iInObj).seasonSchIndex) &&
+                    (tariff(jTariff).periodSchIndex == tariff(iInObj).periodSchIndex) &&
+                    (tariff(jTariff).monthSchIndex == tariff(iInObj).monthSchIndex)) {
+                    tariff(iInObj).gatherTariff = jTariff;
+                    break;
+                }
+            }
+        }
     }
 
     void GetInputEconomicsQualify(bool &ErrorsFound) // true if errors found during getting input objects.
@@ -2731,10 +2746,15 @@ namespace EconomicTariff {
     {
         //    AUTHOR         Jason Glazer of GARD Analytics, Inc.
         //    DATE WRITTEN   June 2004
+        //    MODIFIED       October 2026, gather once for each group of tariffs sharing a meter
 
         //   Gathers the data each timestep and updates the arrays
         //   holding the data that will be used by the tariff
-        //   calculation.
+        //   calculation. Tariffs with the same meter, conversions,
+        //   demand window and schedules gather identical values so
+        //   only the first of them gathers and the others are
+        //   copied from it in setNativeVariables. Real time pricing
+        //   is still gathered for each tariff.
 
         using DataEnvironment::Month;
         using DataGlobals::SecInHour;
@@ -2742,6 +2762,7 @@ namespace EconomicTariff {
         using ScheduleManager::GetCurrentScheduleValue;
 
         int iTariff;
+        int jTariff;
         Real64 curInstantValue;
         Real64 curDemand;
         Real64 curEnergy;
@@ -2756,6 +2777,8 @@ namespace EconomicTariff {
 
         if (numTariff >= 1) {
             for (iTariff = 1; iTariff <= numTariff; ++iTariff) {
+                // tariffs sharing the gathering of an earlier tariff are handled with it
+                if ((tariff(iTariff).gatherTariff != 0) && (tariff(iTariff).gatherTariff != iTariff)) continue;
                 isGood = false;
                 // if the meter is defined get the value
                 if (tariff(iTariff).reportMeterIndx != 0) {
@@ -2802,33 +2825,37 @@ namespace EconomicTariff {
                         if (tariff(iTariff).gatherDemand(curMonth, curPeriod) < curDemand) {
                             tariff(iTariff).gatherDemand(curMonth, curPeriod) = curDemand;
                         }
-                    } else {
-                        ShowWarningError("UtilityCost:Tariff: While gathering for: " + tariff(iTariff).tariffName);
-                        ShowContinueError("Invalid schedule values - outside of range");
                     }
-                    // Real Time Pricing
-                    if (tariff(iTariff).chargeSchIndex != 0) {
-                        curRTPprice = GetCurrentScheduleValue(tariff(iTariff).chargeSchIndex);
-                        // if customer baseline load schedule is used, subtract that off of the
-                        // current energy
-                        if (tariff(iTariff).baseUseSchIndex != 0) {
-                            curRTPbaseline = GetCurrentScheduleValue(tariff(iTariff).baseUseSchIndex);
-                            curRTPenergy = curEnergy - curRTPbaseline;
-                        } else {
-                            curRTPenergy = curEnergy;
-                        }
-                        // calculate the real time cost for current times energy
-                        curRTPcost = curRTPenergy * curRTPprice;
-                        tariff(iTariff).RTPcost(curMonth) += curRTPcost;
-                        if (curRTPcost > 0) {
-                            tariff(iTariff).RTPaboveBaseCost(curMonth) += curRTPcost;
-                        } else {
-                            tariff(iTariff).RTPbelowBaseCost(curMonth) += curRTPcost;
+                    for (jTariff = iTariff; jTariff <= numTariff; ++jTariff) {
+                        if ((jTariff != iTariff) && (tariff(jTariff).gatherTariff != iTariff)) continue;
+                        if (!isGood) {
+                            ShowWarningError("UtilityCost:Tariff: While gathering for: " + tariff(jTariff).tariffName);
+                            ShowContinueError("Invalid schedule values - outside of range");
                         }
-                        if (curRTPenergy > 0) {
-                            tariff(iTariff).RTPaboveBaseEnergy(curMonth) += curRTPenergy;
-                        } else {
-                            tariff(iTariff).RTPbelowBaseEnergy(curMonth) += curRTPenergy;
+                        // Real Time Pricing
+                        if (tariff(jTariff).chargeSchIndex != 0) {
+                            curRTPprice = GetCurrentScheduleValue(tariff(jTariff).chargeSchIndex);
+                            // if customer baseline load schedule is used, subtract that off of the
+                            // current energy
+                            if (tariff(jTariff).baseUseSchIndex != 0) {
+                                curRTPbaseline = GetCurrentScheduleValue(tariff(jTariff).baseUseSchIndex);
+                                curRTPenergy = curEnergy - curRTPbaseline;
+                            } else {
+                                curRTPenergy = curEnergy;
+                            }
+                            // calculate the real time cost for current times energy
+                            curRTPcost = curRTPenergy * curRTPprice;
+                            tariff(jTariff).RTPcost(curMonth) += curRTPcost;
+                            if (curRTPcost > 0) {
+                                tariff(jTariff).RTPaboveBaseCost(curMonth) += curRTPcost;
+                            } else {
+                                tariff(jTariff).RTPbelowBaseCost(curMonth) += curRTPcost;
+                            }
+                            if (curRTPenergy > 0) {
+                                tariff(jTariff).RTPaboveBaseEnergy(curMonth) += curRTPenergy;
+                            } else {
+                                tariff(jTariff).RTPbelowBaseEnergy(curMonth) += curRTPenergy;
+                            }
                         }
                     }
                     // reset the counters
@@ -3851,6 +3878,7 @@ namespace EconomicTariff {
     {
         //    AUTHOR         Jason Glazer of GARD Analytics, Inc.
         //    DATE WRITTEN   July 2004
+        //    MODIFIED       October 2026, copy the values of tariffs sharing their gathering
 
         //    Set up the "built in" i.e. native variables that hold
         //    the energy and demand from the simulation.
@@ -3863,6 +3891,13 @@ namespace EconomicTariff {
 
         bigNumber = HUGE_(bigNumber);
         for (iTariff = 1; iTariff <= numTariff; ++iTariff) {
+            // pick up the values gathered by the tariff sharing the same meter
+            int const gatherTariff = tariff(iTariff).gatherTariff;
+            if ((gatherTariff != 0) && (gatherTariff != iTariff)) {
+                tariff(iTariff).gatherEnergy = tariff(gatherTariff).gatherEnergy;
+                tariff(iTariff).gatherDemand = tariff(gatherTariff).gatherDemand;
+                tariff(iTariff).seasonForMonth = tariff(gatherTariff).seasonForMonth;
+            }
             // nativeTotalEnergy
             monthVal = 0.0;
             for (jPeriod = 1; jPeriod <= countPeriod; ++jPeriod) {
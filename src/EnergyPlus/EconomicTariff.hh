@@ -406,6 +406,7 @@ namespace EconomicTariff {
         Array1D<Real64> RTPaboveBaseEnergy;
         Array1D<Real64> RTPbelowBaseEnergy;
         Array1D_int seasonForMonth;
+        int gatherTariff; // tariff that gathers the energy and demand for this one (same meter, conversions, window and schedules)
         // overall qualification of the rate
         bool isQualified;
         int ptDisqualifier;
@@ -431,7 +432,7 @@ namespace EconomicTariff {
               nativeBelowCustomerBaseEnergy(0), gatherEnergy(MaxNumMonths, countPeriod, 0.0), gatherDemand(MaxNumMonths, countPeriod, 0.0),
               collectTime(0.0), collectEnergy(0.0), RTPcost(MaxNumMonths, 0.0), RTPaboveBaseCost(MaxNumMonths, 0.0),
               RTPbelowBaseCost(MaxNumMonths, 0.0), RTPaboveBaseEnergy(MaxNumMonths, 0.0), RTPbelowBaseEnergy(MaxNumMonths, 0.0),
-              seasonForMonth(MaxNumMonths, 0), isQualified(false), ptDisqualifier(0), isSelected(false), totalAnnualCost(0.0), totalAnnualEnergy(0.0)
+              seasonForMonth(MaxNumMonths, 0), gatherTariff(0), isQualified(false), ptDisqualifier(0), isSelected(false), totalAnnualCost(0.0), totalAnnualEnergy(0.0)
         {
         }
     };
@@ -62,6 +62,7 @@
 #include <DataIPShortCuts.hh>
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <EMSManager.hh>
 #include <ElectricPowerServiceManager.hh>
 #include <FuelCellElectricGenerator.hh>
@@ -2850,7 +2851,8 @@ ElectricStorage::ElectricStorage( // main constructor
       maxChargeRate_(0.0), lifeCalculation_(BatteyDegredationModelType::degredationNotSet), lifeCurveNum_(0), thisTimeStepStateOfCharge_(0.0),
       lastTimeStepStateOfCharge_(0.0), pelNeedFromStorage_(0.0), pelFromStorage_(0.0), pelIntoStorage_(0.0), qdotConvZone_(0.0), qdotRadZone_(0.0),
       timeElapsed_(0.0), thisTimeStepAvailable_(0.0), thisTimeStepBound_(0.0), lastTimeStepAvailable_(0.0), lastTimeStepBound_(0.0),
-      lastTwoTimeStepAvailable_(0.0), lastTwoTimeStepBound_(0.0), count0_(0), electEnergyinStorage_(0.0), thermLossRate_(0.0), thermLossEnergy_(0.0),
+      lastTwoTimeStepAvailable_(0.0), lastTwoTimeStepBound_(0.0), chargeCurrentGuess_(0.0),
+      dischargeCurrentGuess_(0.0), count0_(0), electEnergyinStorage_(0.0), thermLossRate_(0.0), thermLossEnergy_(0.0),
       storageMode_(0), absoluteSOC_(0.0), fractionSOC_(0.0), batteryCurrent_(0.0), batteryVoltage_(0.0), batteryDamage_(0.0)
 {
 
@@ -3151,6 +3153,8 @@ void ElectricStorage::reinitAtBeginEnvironment()
     thermLossEnergy_ = 0.0;
     lastTimeStepStateOfCharge_ = startingEnergyStored_;
     thisTimeStepStateOfCharge_ = startingEnergyStored_;
+    chargeCurrentGuess_ = 0.0;
+    dischargeCurrentGuess_ = 0.0;
 
     if (storageModelMode_ == StorageModelType::kiBaMBattery) {
         Real64 initialCharge = maxAhCapacity_ * startingSOC_;
@@ -3435,7 +3439,9 @@ void ElectricStorage::simulateKineticBatteryModel(Real64 &powerCharge,
             return;
         }
 
-        I0 = 1.0;                                                                                       // Initial assumption
+        I0 = 1.0; // Initial assumption
+        // optionally start from the current that converged the last time the battery was charging
+        if (DataSystemVariables::BatteryWarmStart && (chargeCurrentGuess_ != 0.0)) I0 = chargeCurrentGuess_;
         T0 = std::abs(qmax / I0);                                                                       // Initial Assumption
         qmaxf = qmax * k * c * T0 / (1.0 - std::exp(-k * T0) + c * (k * T0 - 1.0 + std::exp(-k * T0))); // Initial calculation of a function qmax(I)
         Real64 Xf = q0 / qmaxf;
@@ -3462,6 +3468,7 @@ void ElectricStorage::simulateKineticBatteryModel(Real64 &powerCharge,
             Tnew = std::abs(qmaxf / Inew); // ***Always positive here
             error = std::abs(Inew - I0);
         }
+        chargeCurrentGuess_ = Inew;
 
         Real64 dividend = -k * c * qmax + k * lastTimeStepAvailable_ * std::exp(-k * DataHVACGlobals::TimeStepSys) +
                           q0 * k * c * (1.0 - std::exp(-k * DataHVACGlobals::TimeStepSys));
@@ -3638,7 +3645,9 @@ bool ElectricStorage::determineCurrentForBatteryDischarge(Real64 &curI0,
                                                           Real64 const E0c,
                                                           Real64 const InternalR)
 {
-    curI0 = 10.0;         // Initial assumption
+    curI0 = 10.0; // Initial assumption
+    // optionally start from the current that converged the last time the battery was discharging
+    if (DataSystemVariables::BatteryWarmStart && (dischargeCurrentGuess_ > 0.0)) curI0 = dischargeCurrentGuess_;
     curT0 = qmax / curI0; // Initial Assumption
     Real64 qmaxf = qmax * k * c * curT0 /
                    (1.0 - std::exp(-k * curT0) + c * (k * curT0 - 1.0 + std::exp(-k * curT0))); // Initial calculation of a function qmax(I)
@@ -3708,6 +3717,7 @@ bool ElectricStorage::determineCurrentForBatteryDischarge(Real64 &curI0,
             break;
         }
     }
+    if (!exceedIterationLimit) dischargeCurrentGuess_ = curI0;
     return (!exceedIterationLimit);
 }
 
@@ -363,6 +363,8 @@ private: // data
     Real64 lastTimeStepBound_;         // [Ah] bound charge at the previous timestep
     Real64 lastTwoTimeStepAvailable_;  // [Ah] available charge at the previous two timesteps
     Real64 lastTwoTimeStepBound_;      // [Ah] bound charge at the previous two timesteps
+    Real64 chargeCurrentGuess_;        // [A] last converged charging current, starting point of the next iteration
+    Real64 dischargeCurrentGuess_;     // [A] last converged discharging current, starting point of the next iteration
     // battery life calculation variables
     int count0_;
     std::vector<Real64> b10_;
@@ -180,6 +180,7 @@
 #include <exception>
 #include <fstream>
 #include <iostream>
+#include <vector>
 #ifndef NDEBUG
 #ifdef __unix__
 #include <cfenv>
@@ -206,15 +207,20 @@
 #include <EnergyPlusPgm.hh>
 #include <FileSystem.hh>
 #include <FluidProperties.hh>
+#include <HVACManager.hh>
 #include <InputProcessing/DataStorage.hh>
 #include <InputProcessing/IdfParser.hh>
 #include <InputProcessing/InputProcessor.hh>
 #include <InputProcessing/InputValidation.hh>
 #include <OutputProcessor.hh>
+#include <Parallel.hh>
+#include <Plant/PlantManager.hh>
 #include <Psychrometrics.hh>
 #include <ResultsSchema.hh>
 #include <ScheduleManager.hh>
 #include <SimulationManager.hh>
+#include <SimulationTelemetry.hh>
+#include <StateManagement.hh>
 #include <UtilityRoutines.hh>
 
 #ifdef _WIN32
@@ -226,6 +232,9 @@
 
 void EnergyPlusPgm(std::string const &filepath)
 {
+    if (filepath.empty() && !EnergyPlus::DataGlobals::BatchManifestFileName.empty()) {
+        std::exit(RunEnergyPlusBatch(EnergyPlus::DataGlobals::BatchManifestFileName));
+    }
     std::exit(RunEnergyPlus(filepath));
 }
 
@@ -266,6 +275,8 @@ int RunEnergyPlus(std::string const & filepath)
     using namespace OutputProcessor;
     using namespace SimulationManager;
     using FluidProperties::ReportOrphanFluids;
+    using HVACManager::ReportHVACIterations;
+    using PlantManager::ReportPlantComponentTimings;
     using Psychrometrics::ShowPsychrometricSummary;
     using ScheduleManager::ReportOrphanSchedules;
 
@@ -303,6 +314,9 @@ int RunEnergyPlus(std::string const & filepath)
     // PROGRAM LOCAL VARIABLE DECLARATIONS:
     static std::string cEnvValue;
 
+    // When called as a library the process may already have run a simulation, so start from a clean slate
+    if (!filepath.empty()) clearAllStates();
+
     //                           INITIALIZE VARIABLES
     Time_Start = epElapsedTime();
 #ifdef EP_Detailed_Timings
@@ -389,6 +403,136 @@ int RunEnergyPlus(std::string const & filepath)
     get_environment_variable(cSutherlandHodgman, cEnvValue);
     if (!cEnvValue.empty()) SutherlandHodgman = env_var_on(cEnvValue); // Yes or True
 
+    get_environment_variable(cPixelCountingShading, cEnvValue);
+    if (!cEnvValue.empty()) PixelCountingShading = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cShadingCacheDirectory, cEnvValue);
+    if (!cEnvValue.empty()) ShadingCacheDirectory = cEnvValue; // directory path
+
+    get_environment_variable(cWeatherCacheDirectory, cEnvValue);
+    if (!cEnvValue.empty()) WeatherCacheDirectory = cEnvValue; // directory path
+
+    get_environment_variable(cGroundTempCacheDirectory, cEnvValue);
+    if (!cEnvValue.empty()) GroundTempCacheDirectory = cEnvValue; // directory path
+
+    get_environment_variable(cHourlyIlluminanceMaps, cEnvValue);
+    if (!cEnvValue.empty()) HourlyIlluminanceMaps = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cPsychrometricTables, cEnvValue);
+    if (!cEnvValue.empty()) PsychrometricTables = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cPsychrometricCacheBits, cEnvValue);
+    if (!cEnvValue.empty()) {
+        bool ErrFlag(false);
+        int const CacheBits(int(UtilityRoutines::ProcessNumber(cEnvValue, ErrFlag)));
+        if (!ErrFlag && (CacheBits >= 10) && (CacheBits <= 24)) PsychrometricCacheBits = CacheBits; // 1K to 16M entries
+    }
+
+    get_environment_variable(cAirflowNetworkSparseSolver, cEnvValue);
+    if (!cEnvValue.empty()) AirflowNetworkSparseSolver = cEnvValue; // LDLT or ConjugateGradient
+
+    get_environment_variable(cRefrigerantTableInversion, cEnvValue);
+    if (!cEnvValue.empty()) RefrigerantTableInversion = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cBinaryOutput, cEnvValue);
+    if (!cEnvValue.empty()) BinaryOutput = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cAsyncOutput, cEnvValue);
+    if (!cEnvValue.empty()) AsyncOutput = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cStreamTimeSeriesOutput, cEnvValue);
+    if (!cEnvValue.empty()) StreamTimeSeriesOutput = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cLiveOutputChannel, cEnvValue);
+    if (!cEnvValue.empty()) LiveOutputChannel = cEnvValue; // shared memory name
+
+    get_environment_variable(cAcceleratedWarmup, cEnvValue);
+    if (!cEnvValue.empty()) AcceleratedWarmup = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cWarmupStateReuse, cEnvValue);
+    if (!cEnvValue.empty()) WarmupStateReuse = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cCompiledSchedules, cEnvValue);
+    if (!cEnvValue.empty()) CompiledSchedules = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cDeduplicateSchedules, cEnvValue);
+    if (!cEnvValue.empty()) DeduplicateSchedules = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cLongRunMode, cEnvValue);
+    if (!cEnvValue.empty()) LongRunMode = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cAirflowNetworkJacobianReuse, cEnvValue);
+    if (!cEnvValue.empty()) AirflowNetworkJacobianReuse = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cAirflowNetworkCpTables, cEnvValue);
+    if (!cEnvValue.empty()) AirflowNetworkCpTables = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cPlantHalfLoopChangeDetection, cEnvValue);
+    if (!cEnvValue.empty()) PlantHalfLoopChangeDetection = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cPlantComponentTimings, cEnvValue);
+    if (!cEnvValue.empty()) PlantComponentTimings = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cAirLoopControllerSweeps, cEnvValue);
+    if (!cEnvValue.empty()) AirLoopControllerSweeps = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cControllerWarmStart, cEnvValue);
+    if (!cEnvValue.empty()) ControllerWarmStart = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cAirLoopComponentBypass, cEnvValue);
+    if (!cEnvValue.empty()) AirLoopComponentBypass = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cUnitaryDirectPLR, cEnvValue);
+    if (!cEnvValue.empty()) UnitaryDirectPLR = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cStratifiedTankImplicit, cEnvValue);
+    if (!cEnvValue.empty()) StratifiedTankImplicit = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cGLHEMultiLevelAggregation, cEnvValue);
+    if (!cEnvValue.empty()) GLHEMultiLevelAggregation = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cKivaGroundCaching, cEnvValue);
+    if (!cEnvValue.empty()) KivaGroundCaching = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cPipingSystemsSparseSolver, cEnvValue);
+    if (!cEnvValue.empty()) PipingSystemsSparseSolver = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cPipingSystemsFlatCellArrays, cEnvValue);
+    if (!cEnvValue.empty()) PipingSystemsFlatCellArrays = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cCondFDDirectSolve, cEnvValue);
+    if (!cEnvValue.empty()) CondFDDirectSolve = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cWindowNewtonSolve, cEnvValue);
+    if (!cEnvValue.empty()) WindowNewtonSolve = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cWindowAngularTables, cEnvValue);
+    if (!cEnvValue.empty()) WindowAngularTables = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cTARCOGResultMemo, cEnvValue);
+    if (!cEnvValue.empty()) TARCOGResultMemo = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cEQLWindowWarmStart, cEnvValue);
+    if (!cEnvValue.empty()) EQLWindowWarmStart = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cDirectCsvOutput, cEnvValue);
+    if (!cEnvValue.empty()) DirectCsvOutput = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cBatteryWarmStart, cEnvValue);
+    if (!cEnvValue.empty()) BatteryWarmStart = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cSuppressEioOutput, cEnvValue);
+    if (!cEnvValue.empty()) SuppressEioOutput = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cPerformanceReport, cEnvValue);
+    if (!cEnvValue.empty()) PerformanceReport = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cDaylightingSkipUnlitZones, cEnvValue);
+    if (!cEnvValue.empty()) DaylightingSkipUnlitZones = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(cHVACIterationReport, cEnvValue);
+    if (!cEnvValue.empty()) HVACIterationReport = env_var_on(cEnvValue); // Yes or True
+
     get_environment_variable(cMinimalShadowing, cEnvValue);
     if (!cEnvValue.empty()) lMinimalShadowing = env_var_on(cEnvValue); // Yes or True
 
@@ -408,6 +552,8 @@ int RunEnergyPlus(std::string const & filepath)
     get_environment_variable(cDisplayInputInAuditEnvVar, cEnvValue);
     if (!cEnvValue.empty()) DisplayInputInAudit = env_var_on(cEnvValue); // Yes or True
 
+    InitializeThreading();
+
     if (!filepath.empty()) {
         // if filepath is not empty, then we are using E+ as a library API call
         // change the directory to the specified folder, and pass in dummy args to command line parser
@@ -466,11 +612,15 @@ int RunEnergyPlus(std::string const & filepath)
 
         ShowPsychrometricSummary();
 
+        ReportPlantComponentTimings();
+
+        ReportHVACIterations();
+
         EnergyPlus::inputProcessor->reportOrphanRecordObjects();
         ReportOrphanFluids();
         ReportOrphanSchedules();
 
-        if (runReadVars) {
+        if (runReadVars && !DirectCsvOutput) { // With DirectCsvOutput the csv files were written during the simulation
             std::string readVarsPath = exeDirectory + "ReadVarsESO" + exeExtension;
             bool FileExists;
             {
@@ -569,6 +719,128 @@ int RunEnergyPlus(std::string const & filepath)
     return EndEnergyPlus();
 }
 
+int RunEnergyPlusBatch(std::string const &manifestPath)
+{
+    // FUNCTION INFORMATION:
+    //       AUTHOR         na
+    //       DATE WRITTEN   October 2026
+    //       MODIFIED       na
+    //       RE-ENGINEERED  na
+
+    // PURPOSE OF THIS FUNCTION:
+    // Runs every simulation listed in a JSON manifest (--batch) one after another in this process.
+
+    // METHODOLOGY EMPLOYED:
+    // The manifest holds defaults for all runs and a list of runs, each of which may override them:
+    //   { "input": "base.idf", "weather": "in.epw", "options": [ "-a" ],
+    //     "runs": [ { "output-directory": "run1", "objects": { "Material": { "Insulation": { "thickness": 0.1 } } } } ] }
+    // Each run is set up by passing the equivalent command line to ProcessArgs and simulated by RunEnergyPlus
+    // after clearing all states. The schema is decoded once per process and the input processor decodes each
+    // base input file once, then applies the run's "objects" as a JSON merge patch (null removes a field or
+    // an object) to a copy of it. Runs are sequential because the simulation state is process wide.
+    // An optional "threads" caps the threads of every run below what the environment asks for, so that
+    // several batch processes can share a machine without oversubscribing it.
+
+    using namespace EnergyPlus;
+    using json = nlohmann::json;
+
+    // clearAllStates resets the global this may refer to, so keep a copy
+    std::string const manifestFileName(manifestPath);
+
+    json manifest;
+    {
+        std::ifstream manifestStream(manifestFileName, std::ifstream::in);
+        if (!manifestStream.is_open()) {
+            DisplayString("ERROR: Could not find batch manifest file: " + FileSystem::getAbsolutePath(manifestFileName) + ".");
+            return EXIT_FAILURE;
+        }
+        try {
+            manifestStream >> manifest;
+        } catch (const std::exception &e) {
+            DisplayString("ERROR: Could not read batch manifest file " + manifestFileName + ": " + e.what());
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto const runs = manifest.find("runs");
+    if (!manifest.is_object() || runs == manifest.end() || !runs->is_array() || runs->empty()) {
+        DisplayString("ERROR: Batch manifest file " + manifestFileName + " must be an object with a non-empty \"runs\" array.");
+        return EXIT_FAILURE;
+    }
+
+    int const previousThreadLimit = Parallel::ThreadLimit();
+    auto const threads = manifest.find("threads");
+    if (threads != manifest.end() && threads->is_number_integer()) Parallel::SetThreadLimit(threads->get<int>());
+
+    int numFailedRuns = 0;
+    int runNum = 0;
+    for (auto const &run : *runs) {
+        ++runNum;
+        std::string const runLabel = "Batch run " + std::to_string(runNum) + " of " + std::to_string(runs->size());
+        if (!run.is_object()) {
+            DisplayString("ERROR: " + runLabel + " is not an object; skipping it.");
+            ++numFailedRuns;
+            continue;
+        }
+
+        // Per-run values override the manifest defaults; each run writes to its own directory unless told otherwise
+        auto const setting = [&](std::string const &key, std::string const &defaultValue) {
+            auto it = run.find(key);
+            if (it != run.end() && it->is_string()) return it->get<std::string>();
+            it = manifest.find(key);
+            if (it != manifest.end() && it->is_string()) return it->get<std::string>();
+            return defaultValue;
+        };
+
+        std::vector<std::string> arguments{"energyplus"};
+        for (json const *options : std::vector<json const *>{&manifest, &run}) {
+            auto const it = options->find("options");
+            if (it == options->end() || !it->is_array()) continue;
+            for (auto const &option : *it) {
+                if (option.is_string()) arguments.push_back(option.get<std::string>());
+            }
+        }
+        std::string const outputDirectory = setting("output-directory", "run" + std::to_string(runNum));
+        arguments.push_back("--output-directory");
+        arguments.push_back(outputDirectory);
+        std::string const weather = setting("weather", "");
+        if (!weather.empty()) {
+            arguments.push_back("--weather");
+            arguments.push_back(weather);
+        }
+        std::string const prefix = setting("output-prefix", "");
+        if (!prefix.empty()) {
+            arguments.push_back("--output-prefix");
+            arguments.push_back(prefix);
+        }
+        std::string const input = setting("input", "in.idf");
+        arguments.push_back(input);
+
+        std::vector<const char *> argv;
+        argv.reserve(arguments.size());
+        for (auto const &argument : arguments) {
+            argv.push_back(argument.c_str());
+        }
+
+        DisplayString(runLabel + ": " + input + " -> " + outputDirectory);
+
+        clearAllStates();
+        CommandLineInterface::ProcessArgs(static_cast<int>(argv.size()), argv.data());
+
+        auto const objects = run.find("objects");
+        InputProcessor::setBatchRun(objects != run.end() ? *objects : json());
+
+        if (RunEnergyPlus() != EXIT_SUCCESS) ++numFailedRuns;
+    }
+
+    InputProcessor::clearBatchRuns();
+    Parallel::SetThreadLimit(previousThreadLimit);
+
+    DisplayString("EnergyPlus Batch Completed: " + std::to_string(runs->size() - numFailedRuns) + " of " + std::to_string(runs->size()) +
+                  " runs succeeded.");
+    return (numFailedRuns == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 void StoreProgressCallback(void (*f)(int const))
 {
     using namespace EnergyPlus::DataGlobals;
@@ -579,6 +851,13 @@ void StoreMessageCallback(void (*f)(std::string const &))
     using namespace EnergyPlus::DataGlobals;
     fMessagePtr = f;
 }
+void StoreTelemetryCallback(void (*f)(EnergyPlusTelemetry const &), double reportingIntervalHours)
+{
+    using namespace EnergyPlus::SimulationTelemetry;
+    fTelemetryPtr = f;
+    ReportingIntervalHours = (reportingIntervalHours > 0.0) ? reportingIntervalHours : 24.0;
+    Enabled = (f != nullptr);
+}
 
 void CreateCurrentDateTimeString(std::string &CurrentDateTimeString)
 {
@@ -0,0 +1,172 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+
+// EnergyPlus Headers
+#include <EsoDictionary.hh>
+
+namespace EnergyPlus {
+
+namespace EsoDictionary {
+
+    // MODULE INFORMATION:
+    //       AUTHOR         na
+    //       DATE WRITTEN   October 2026
+    //       MODIFIED       na
+    //       RE-ENGINEERED  na
+
+    // PURPOSE OF THIS MODULE:
+    // Formats and parses the report variable and meter lines of the eso and mtr data dictionaries so that the
+    // writer (OutputProcessor) and the reader (EsoReader) cannot drift apart. This file is also compiled into
+    // the stand-alone energyplusesoreader library and must not depend on anything else in EnergyPlus.
+
+    namespace {
+
+        // Reads an unsigned integer followed by a comma and moves p past the comma
+        bool parseIntField(char const *&p, char const *const end, int &value)
+        {
+            if (p == end || *p < '0' || *p > '9') return false;
+            value = 0;
+            while (p != end && *p >= '0' && *p <= '9') {
+                value = value * 10 + (*p - '0');
+                ++p;
+            }
+            if (p == end || *p != ',') return false;
+            ++p;
+            return true;
+        }
+
+        bool isFrequency(std::string const &frequency)
+        {
+            return frequency == "Each Call" || frequency == "TimeStep" || frequency == "Hourly" || frequency == "Daily" ||
+                   frequency == "Monthly" || frequency == "RunPeriod" || frequency == "Annual";
+        }
+
+    } // namespace
+
+    std::string formatItem(std::string const &reportIDChr,
+                           int const numFields,
+                           bool const hasKey,
+                           std::string const &keyedValue,
+                           std::string const &name,
+                           std::string const &units,
+                           std::string const &frequencyNotice)
+    {
+        std::string line(reportIDChr);
+        line += ',';
+        line += std::to_string(numFields);
+        line += ',';
+        if (hasKey) {
+            line += keyedValue;
+            line += ',';
+        }
+        line += name;
+        line += " [";
+        line += units;
+        line += ']';
+        line += frequencyNotice;
+        return line;
+    }
+
+    bool parseItem(char const *begin, char const *end, Item &item)
+    {
+        while (end != begin && (end[-1] == '\n' || end[-1] == '\r')) {
+            --end;
+        }
+
+        char const *p(begin);
+        int reportID(0);
+        int numFields(0);
+        if (!parseIntField(p, end, reportID) || !parseIntField(p, end, numFields)) return false;
+
+        // Everything up to the notice is "Key,Name [Units]" or "Name [Units]"
+        std::string const line(p, end);
+        std::string::size_type const notice(line.find(" !"));
+        if (notice == std::string::npos || notice == 0 || line[notice - 1] != ']') return false;
+        std::string::size_type const unitsStart(line.rfind(" [", notice - 1));
+        if (unitsStart == std::string::npos) return false;
+
+        // The notice is the frequency, optionally followed by the field list and the schedule name
+        std::string::size_type const frequencyStart(notice + 2);
+        std::string::size_type frequencyEnd;
+        if (line.compare(frequencyStart, 9, "Each Call") == 0) {
+            frequencyEnd = frequencyStart + 9;
+        } else {
+            frequencyEnd = line.find_first_of(" [,", frequencyStart);
+            if (frequencyEnd == std::string::npos) frequencyEnd = line.size();
+        }
+        std::string frequency(line.substr(frequencyStart, frequencyEnd - frequencyStart));
+        if (!isFrequency(frequency)) return false;
+
+        std::string::size_type rest(line.find_first_not_of(' ', frequencyEnd));
+        if (rest != std::string::npos && line[rest] == '[') {
+            rest = line.find(']', rest);
+            if (rest != std::string::npos) ++rest;
+        }
+
+        item.reportID = reportID;
+        item.numFields = numFields;
+        std::string::size_type const comma(line.find(','));
+        item.hasKey = comma < unitsStart;
+        if (item.hasKey) {
+            item.keyedValue = line.substr(0, comma);
+            item.name = line.substr(comma + 1, unitsStart - comma - 1);
+        } else {
+            item.keyedValue.clear();
+            item.name = line.substr(0, unitsStart);
+        }
+        item.units = line.substr(unitsStart + 2, notice - 1 - unitsStart - 2);
+        item.frequency.swap(frequency);
+        if (rest != std::string::npos && rest < line.size() && line[rest] == ',') {
+            item.scheduleName = line.substr(rest + 1);
+        } else {
+            item.scheduleName.clear();
+        }
+        return true;
+    }
+
+} // namespace EsoDictionary
+
+} // namespace EnergyPlus
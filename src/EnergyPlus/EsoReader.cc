@@ -0,0 +1,499 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+
+// C++ Headers
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// EnergyPlus Headers
+#include <EsoReader.hh>
+
+namespace EnergyPlus {
+
+// MODULE INFORMATION:
+//       AUTHOR         na
+//       DATE WRITTEN   October 2026
+//       MODIFIED       na
+//       RE-ENGINEERED  na
+
+// PURPOSE OF THIS MODULE:
+// Random access to the time series in an eso or mtr file without reading the whole file for every request,
+// as ReadVarsESO does. The layout is the one OutputProcessor writes: the program version, the data dictionary
+// up to "End of Data Dictionary" (the environment and time stamp definitions first, then one line per report
+// variable or meter), and the data up to "End of Data", where each environment line is followed by time stamp
+// lines and each time stamp by the data lines reported at that time.
+
+namespace {
+
+    enum class StampKind
+    {
+        None,
+        TimeStep, // Also used by hourly and each call data
+        Daily,
+        Monthly,
+        RunPeriod,
+        Annual
+    };
+
+    typedef std::pair<char const *, char const *> Field;
+
+    // Strips the line end from [begin, end)
+    char const *trimLineEnd(char const *begin, char const *end)
+    {
+        while (end != begin && (end[-1] == '\n' || end[-1] == '\r')) {
+            --end;
+        }
+        return end;
+    }
+
+    bool lineEquals(char const *begin, char const *end, char const *text)
+    {
+        std::size_t const length(std::strlen(text));
+        return std::size_t(end - begin) == length && std::memcmp(begin, text, length) == 0;
+    }
+
+    // Reads the report ID at the start of a line; false if the line does not start with one
+    bool parseReportID(char const *p, char const *end, int &reportID, char const *&rest)
+    {
+        if (p == end || *p < '0' || *p > '9') return false;
+        reportID = 0;
+        while (p != end && *p >= '0' && *p <= '9') {
+            reportID = reportID * 10 + (*p - '0');
+            ++p;
+        }
+        if (p == end || *p != ',') return false;
+        rest = p + 1;
+        return true;
+    }
+
+    void splitFields(char const *p, char const *end, std::vector<Field> &fields)
+    {
+        fields.clear();
+        while (true) {
+            char const *comma(static_cast<char const *>(std::memchr(p, ',', end - p)));
+            if (comma == nullptr) {
+                fields.emplace_back(p, end);
+                return;
+            }
+            fields.emplace_back(p, comma);
+            p = comma + 1;
+        }
+    }
+
+    // The mapped file is not null terminated, so fields are copied before they are converted
+    double toDouble(Field const &field)
+    {
+        char buffer[64];
+        std::size_t const length((std::min)(std::size_t(field.second - field.first), sizeof(buffer) - 1));
+        std::memcpy(buffer, field.first, length);
+        buffer[length] = '\0';
+        return std::strtod(buffer, nullptr);
+    }
+
+    int toInt(Field const &field)
+    {
+        char buffer[32];
+        std::size_t const length((std::min)(std::size_t(field.second - field.first), sizeof(buffer) - 1));
+        std::memcpy(buffer, field.first, length);
+        buffer[length] = '\0';
+        return int(std::strtol(buffer, nullptr, 10));
+    }
+
+    std::string toString(Field const &field)
+    {
+        char const *begin(field.first);
+        char const *end(field.second);
+        while (begin != end && *begin == ' ') {
+            ++begin;
+        }
+        while (end != begin && end[-1] == ' ') {
+            --end;
+        }
+        return std::string(begin, end);
+    }
+
+    // Classifies the environment and time stamp definitions written by WeatherManager::ReportOutputFileHeaders
+    StampKind stampKind(int const numFields, char const *begin, char const *end)
+    {
+        std::string const line(begin, end);
+        switch (numFields) {
+        case 8:
+            return StampKind::TimeStep;
+        case 5:
+            return (line.find("Environment Title") == std::string::npos) ? StampKind::Daily : StampKind::None;
+        case 2:
+            return StampKind::Monthly;
+        case 1:
+            return (line.find("Calendar Year") == std::string::npos) ? StampKind::RunPeriod : StampKind::Annual;
+        default:
+            return StampKind::None;
+        }
+    }
+
+} // namespace
+
+struct EsoReader::Impl
+{
+    // A data line and the time stamp line it belongs to, as offsets into the mapped file
+    struct Line
+    {
+        std::uint64_t offset;
+        std::uint64_t stampOffset;
+    };
+
+    // Members
+    char const *base;
+    std::size_t size;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#endif
+    bool dictionaryRead;
+    std::string programVersion;
+    std::vector<EsoDictionary::Item> dictionary;
+    std::vector<int> itemIndex;         // Dictionary index by report ID, -1 if none
+    std::vector<StampKind> stampKinds;  // Time stamp kind by report ID
+    int environmentReportID;
+    std::vector<std::string> environments;
+    std::vector<std::vector<std::vector<Line>>> lines; // Data lines by dictionary index and environment
+
+    // Default Constructor
+    Impl()
+        : base(nullptr), size(0),
+#ifdef _WIN32
+          file(INVALID_HANDLE_VALUE), mapping(NULL),
+#endif
+          dictionaryRead(false), environmentReportID(0)
+    {
+    }
+
+    bool map(std::string const &fileName);
+
+    void unmap();
+
+    void index();
+
+    void parseStamp(std::uint64_t offset, TimeStamp &stamp, std::vector<Field> &fields) const;
+};
+
+bool EsoReader::Impl::map(std::string const &fileName)
+{
+#ifdef _WIN32
+    LARGE_INTEGER fileSize;
+    file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) return false;
+    mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL) return false;
+    void *view(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (view == NULL) return false;
+    base = static_cast<char const *>(view);
+    size = std::size_t(fileSize.QuadPart);
+#else
+    struct stat status;
+    int const fd(open(fileName.c_str(), O_RDONLY));
+    if (fd == -1) return false;
+    if (fstat(fd, &status) != 0 || status.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    void *view(mmap(nullptr, std::size_t(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0));
+    close(fd);
+    if (view == MAP_FAILED) return false;
+    base = static_cast<char const *>(view);
+    size = std::size_t(status.st_size);
+#endif
+    return true;
+}
+
+void EsoReader::Impl::unmap()
+{
+#ifdef _WIN32
+    if (base != nullptr) UnmapViewOfFile(base);
+    if (mapping != NULL) CloseHandle(mapping);
+    if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+    mapping = NULL;
+    file = INVALID_HANDLE_VALUE;
+#else
+    if (base != nullptr) munmap(const_cast<char *>(base), size);
+#endif
+    base = nullptr;
+    size = 0;
+}
+
+void EsoReader::Impl::index()
+{
+    static std::string const versionPrefix("Program Version,");
+
+    char const *const fileEnd(base + size);
+    char const *lineBegin(base);
+    bool inDictionary(true);
+    bool first(true);
+    std::uint64_t stampOffset(0);
+
+    while (lineBegin < fileEnd) {
+        char const *newLine(static_cast<char const *>(std::memchr(lineBegin, '\n', fileEnd - lineBegin)));
+        char const *next(newLine == nullptr ? fileEnd : newLine + 1);
+        char const *lineEnd(trimLineEnd(lineBegin, next));
+
+        if (first) {
+            first = false;
+            if (std::size_t(lineEnd - lineBegin) >= versionPrefix.size() &&
+                std::memcmp(lineBegin, versionPrefix.data(), versionPrefix.size()) == 0) {
+                programVersion.assign(lineBegin + versionPrefix.size(), lineEnd);
+                lineBegin = next;
+                continue;
+            }
+        }
+
+        int reportID(0);
+        char const *rest(nullptr);
+        if (inDictionary) {
+            EsoDictionary::Item item;
+            if (lineEquals(lineBegin, lineEnd, "End of Data Dictionary")) {
+                inDictionary = false;
+                dictionaryRead = true;
+                lines.resize(dictionary.size());
+            } else if (EsoDictionary::parseItem(lineBegin, lineEnd, item)) {
+                if (std::size_t(item.reportID) >= itemIndex.size()) itemIndex.resize(item.reportID + 1, -1);
+                itemIndex[item.reportID] = int(dictionary.size());
+                dictionary.push_back(std::move(item));
+            } else if (parseReportID(lineBegin, lineEnd, reportID, rest)) {
+                int numFields(0);
+                char const *definition(nullptr);
+                if (parseReportID(rest, lineEnd, numFields, definition)) {
+                    StampKind const kind(stampKind(numFields, definition, lineEnd));
+                    if (kind == StampKind::None) {
+                        environmentReportID = reportID;
+                    } else {
+                        if (std::size_t(reportID) >= stampKinds.size()) stampKinds.resize(reportID + 1, StampKind::None);
+                        stampKinds[reportID] = kind;
+                    }
+                }
+            }
+        } else if (lineEquals(lineBegin, lineEnd, "End of Data")) {
+            break;
+        } else if (parseReportID(lineBegin, lineEnd, reportID, rest)) {
+            if (reportID == environmentReportID) {
+                char const *comma(static_cast<char const *>(std::memchr(rest, ',', lineEnd - rest)));
+                environments.push_back(toString(Field(rest, comma == nullptr ? lineEnd : comma)));
+            } else if (std::size_t(reportID) < stampKinds.size() && stampKinds[reportID] != StampKind::None) {
+                stampOffset = std::uint64_t(lineBegin - base);
+            } else if (std::size_t(reportID) < itemIndex.size() && itemIndex[reportID] >= 0 && !environments.empty()) {
+                std::vector<std::vector<Line>> &itemLines(lines[itemIndex[reportID]]);
+                if (itemLines.size() < environments.size()) itemLines.resize(environments.size());
+                itemLines[environments.size() - 1].push_back(Line{std::uint64_t(lineBegin - base), stampOffset});
+            }
+        }
+        lineBegin = next;
+    }
+}
+
+void EsoReader::Impl::parseStamp(std::uint64_t const offset, TimeStamp &stamp, std::vector<Field> &fields) const
+{
+    char const *const fileEnd(base + size);
+    char const *lineBegin(base + offset);
+    char const *newLine(static_cast<char const *>(std::memchr(lineBegin, '\n', fileEnd - lineBegin)));
+    char const *lineEnd(trimLineEnd(lineBegin, newLine == nullptr ? fileEnd : newLine));
+
+    int reportID(0);
+    char const *rest(nullptr);
+    if (!parseReportID(lineBegin, lineEnd, reportID, rest) || std::size_t(reportID) >= stampKinds.size()) return;
+    splitFields(rest, lineEnd, fields);
+
+    switch (stampKinds[reportID]) {
+    case StampKind::TimeStep:
+        if (fields.size() < 8) return;
+        stamp.dayOfSimulation = toInt(fields[0]);
+        stamp.month = toInt(fields[1]);
+        stamp.dayOfMonth = toInt(fields[2]);
+        stamp.dst = toInt(fields[3]);
+        stamp.hour = toInt(fields[4]);
+        stamp.startMinute = toDouble(fields[5]);
+        stamp.endMinute = toDouble(fields[6]);
+        stamp.dayType = toString(fields[7]);
+        break;
+    case StampKind::Daily:
+        if (fields.size() < 5) return;
+        stamp.dayOfSimulation = toInt(fields[0]);
+        stamp.month = toInt(fields[1]);
+        stamp.dayOfMonth = toInt(fields[2]);
+        stamp.dst = toInt(fields[3]);
+        stamp.dayType = toString(fields[4]);
+        break;
+    case StampKind::Monthly:
+        if (fields.size() < 2) return;
+        stamp.dayOfSimulation = toInt(fields[0]);
+        stamp.month = toInt(fields[1]);
+        break;
+    case StampKind::RunPeriod:
+        stamp.dayOfSimulation = toInt(fields[0]);
+        break;
+    case StampKind::Annual:
+        stamp.year = toInt(fields[0]);
+        break;
+    case StampKind::None:
+        break;
+    }
+}
+
+EsoReader::EsoReader(std::string const &fileName) : impl(new Impl)
+{
+    if (impl->map(fileName)) {
+        impl->index();
+    } else {
+        impl->unmap();
+    }
+}
+
+EsoReader::~EsoReader()
+{
+    impl->unmap();
+    delete impl;
+}
+
+bool EsoReader::isOpen() const
+{
+    return impl->base != nullptr && impl->dictionaryRead;
+}
+
+std::string const &EsoReader::programVersion() const
+{
+    return impl->programVersion;
+}
+
+std::vector<EsoDictionary::Item> const &EsoReader::dictionary() const
+{
+    return impl->dictionary;
+}
+
+EsoDictionary::Item const *EsoReader::item(int const reportID) const
+{
+    if (reportID < 0 || std::size_t(reportID) >= impl->itemIndex.size() || impl->itemIndex[reportID] < 0) return nullptr;
+    return &impl->dictionary[impl->itemIndex[reportID]];
+}
+
+int EsoReader::findReportID(std::string const &keyedValue, std::string const &name, std::string const &frequency) const
+{
+    for (EsoDictionary::Item const &item : impl->dictionary) {
+        if (item.keyedValue == keyedValue && item.name == name && item.frequency == frequency) return item.reportID;
+    }
+    return 0;
+}
+
+std::vector<std::string> const &EsoReader::environments() const
+{
+    return impl->environments;
+}
+
+std::size_t EsoReader::numValues(int const reportID, std::size_t const environment) const
+{
+    EsoDictionary::Item const *found(item(reportID));
+    if (found == nullptr) return 0;
+    std::vector<std::vector<Impl::Line>> const &itemLines(impl->lines[impl->itemIndex[reportID]]);
+    return (environment < itemLines.size()) ? itemLines[environment].size() : 0;
+}
+
+std::vector<EsoReader::Value> EsoReader::values(int const reportID, std::size_t const environment) const
+{
+    std::vector<Value> result;
+    EsoDictionary::Item const *found(item(reportID));
+    if (found == nullptr) return result;
+    std::vector<std::vector<Impl::Line>> const &itemLines(impl->lines[impl->itemIndex[reportID]]);
+    if (environment >= itemLines.size()) return result;
+
+    // Min/max lines are Value,Min,<date>,Max,<date>, where the date has two (daily), three (monthly) or four fields
+    std::size_t const maximumField(found->numFields > 1 ? 2 + (found->numFields - 3) / 2 : 0);
+    char const *const fileEnd(impl->base + impl->size);
+    std::vector<Field> fields;
+    std::uint64_t lastStampOffset(0);
+    TimeStamp stamp;
+    bool haveStamp(false);
+
+    result.reserve(itemLines[environment].size());
+    for (Impl::Line const &line : itemLines[environment]) {
+        if (!haveStamp || line.stampOffset != lastStampOffset) {
+            stamp = TimeStamp();
+            impl->parseStamp(line.stampOffset, stamp, fields);
+            lastStampOffset = line.stampOffset;
+            haveStamp = true;
+        }
+
+        char const *lineBegin(impl->base + line.offset);
+        char const *newLine(static_cast<char const *>(std::memchr(lineBegin, '\n', fileEnd - lineBegin)));
+        char const *lineEnd(trimLineEnd(lineBegin, newLine == nullptr ? fileEnd : newLine));
+        int id(0);
+        char const *rest(nullptr);
+        parseReportID(lineBegin, lineEnd, id, rest);
+        splitFields(rest, lineEnd, fields);
+
+        Value value;
+        value.stamp = stamp;
+        value.value = toDouble(fields[0]);
+        if (maximumField > 0 && fields.size() > maximumField) {
+            value.minimum = toDouble(fields[1]);
+            value.maximum = toDouble(fields[maximumField]);
+        } else {
+            value.minimum = value.maximum = value.value;
+        }
+        result.push_back(std::move(value));
+    }
+    return result;
+}
+
+} // namespace EnergyPlus
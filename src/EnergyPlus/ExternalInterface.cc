@@ -733,100 +733,32 @@ namespace ExternalInterface {
                         FMU(i).Instance(j).fmuOutputVariableActuator(k).RealVarValue =
                             FMUTemp(i).Instance(j).fmuOutputVariableActuator(k).RealVarValue;
                     }
-                } else {
-                    // Get from FMUs, values that will be set in EnergyPlus (Schedule)
-
-                    if (size(FMU(i).Instance(j).fmuOutputVariableSchedule) > 0) {
-
-                        // generate vectors here first
-                        std::vector<unsigned int> valueReferenceVec;
-                        std::vector<Real64> realVarValueVec;
-                        for (unsigned long x = 1; x <= size(FMU(i).Instance(j).fmuOutputVariableSchedule); ++x) {
-                            valueReferenceVec.push_back(FMU(i).Instance(j).fmuOutputVariableSchedule(x).ValueReference);
-                            realVarValueVec.push_back(FMU(i).Instance(j).fmuOutputVariableSchedule(x).RealVarValue);
-                        }
-
-                        // pass in the vectors as pointers to the first member of the vector
-                        FMU(i).Instance(j).fmistatus = fmiEPlusGetReal(&FMU(i).Instance(j).fmicomponent,
-                                                                       &valueReferenceVec[0],
-                                                                       &realVarValueVec[0],
-                                                                       &FMU(i).Instance(j).NumOutputVariablesSchedule,
-                                                                       &FMU(i).Instance(j).Index);
-
-                        for (unsigned long x = 1; x <= size(FMU(i).Instance(j).fmuOutputVariableSchedule); ++x) {
-                            FMU(i).Instance(j).fmuOutputVariableSchedule(x).ValueReference = valueReferenceVec[x - 1];
-                            FMU(i).Instance(j).fmuOutputVariableSchedule(x).RealVarValue = realVarValueVec[x - 1];
-                        }
+                } else if (FMU(i).Instance(j).NumOutputValueReferences > 0) {
+                    // Get from FMUs, in one call, values that will be set in EnergyPlus (Schedule, Variable and Actuator)
+                    FMU(i).Instance(j).fmistatus = fmiEPlusGetReal(&FMU(i).Instance(j).fmicomponent,
+                                                                   FMU(i).Instance(j).outputValueReference.data(),
+                                                                   FMU(i).Instance(j).outputValue.data(),
+                                                                   &FMU(i).Instance(j).NumOutputValueReferences,
+                                                                   &FMU(i).Instance(j).Index);
 
-                        if (FMU(i).Instance(j).fmistatus != fmiOK) {
-                            ShowSevereError("ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs");
-                            ShowContinueError("in instance \"" + FMU(i).Instance(j).Name + "\" of FMU \"" + FMU(i).Name + "\"");
-                            ShowContinueError("Error Code = \"" + TrimSigDigits(FMU(i).Instance(j).fmistatus) + "\"");
-                            ErrorsFound = true;
-                            StopExternalInterfaceIfError();
-                        }
+                    if (FMU(i).Instance(j).fmistatus != fmiOK) {
+                        ShowSevereError("ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs");
+                        ShowContinueError("in instance \"" + FMU(i).Instance(j).Name + "\" of FMU \"" + FMU(i).Name + "\"");
+                        ShowContinueError("Error Code = \"" + TrimSigDigits(FMU(i).Instance(j).fmistatus) + "\"");
+                        ErrorsFound = true;
+                        StopExternalInterfaceIfError();
                     }
 
-                    // generate vectors here first
-                    if (size(FMU(i).Instance(j).fmuOutputVariableVariable) > 0) {
-
-                        std::vector<unsigned int> valueReferenceVec2;
-                        std::vector<Real64> realVarValueVec2;
-                        for (unsigned long x = 1; x <= size(FMU(i).Instance(j).fmuOutputVariableVariable); ++x) {
-                            valueReferenceVec2.push_back(FMU(i).Instance(j).fmuOutputVariableVariable(x).ValueReference);
-                            realVarValueVec2.push_back(FMU(i).Instance(j).fmuOutputVariableVariable(x).RealVarValue);
-                        }
-
-                        // pass in the vectors as pointers to the first member of the vector
-                        FMU(i).Instance(j).fmistatus = fmiEPlusGetReal(&FMU(i).Instance(j).fmicomponent,
-                                                                       &valueReferenceVec2[0],
-                                                                       &realVarValueVec2[0],
-                                                                       &FMU(i).Instance(j).NumOutputVariablesVariable,
-                                                                       &FMU(i).Instance(j).Index);
-
-                        for (unsigned long x = 1; x <= size(FMU(i).Instance(j).fmuOutputVariableVariable); ++x) {
-                            FMU(i).Instance(j).fmuOutputVariableVariable(x).ValueReference = valueReferenceVec2[x - 1];
-                            FMU(i).Instance(j).fmuOutputVariableVariable(x).RealVarValue = realVarValueVec2[x - 1];
-                        }
-
-                        if (FMU(i).Instance(j).fmistatus != fmiOK) {
-                            ShowSevereError("ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs");
-                            ShowContinueError("in instance \"" + FMU(i).Instance(j).Name + "\" of FMU \"" + FMU(i).Name + "\"");
-                            ShowContinueError("Error Code = \"" + TrimSigDigits(FMU(i).Instance(j).fmistatus) + "\"");
-                            ErrorsFound = true;
-                            StopExternalInterfaceIfError();
-                        }
+                    // Scatter the values in the order they were packed by SetupFMUValueReferences
+                    std::vector<fmiReal>::size_type x = 0;
+                    for (k = 1; k <= FMU(i).Instance(j).NumOutputVariablesSchedule; ++k) {
+                        FMU(i).Instance(j).fmuOutputVariableSchedule(k).RealVarValue = FMU(i).Instance(j).outputValue[x++];
                     }
-
-                    if (size(FMU(i).Instance(j).fmuOutputVariableActuator) > 0) {
-
-                        // generate vectors here first
-                        std::vector<unsigned int> valueReferenceVec3;
-                        std::vector<Real64> realVarValueVec3;
-                        for (unsigned long x = 1; x <= size(FMU(i).Instance(j).fmuOutputVariableActuator); ++x) {
-                            valueReferenceVec3.push_back(FMU(i).Instance(j).fmuOutputVariableActuator(x).ValueReference);
-                            realVarValueVec3.push_back(FMU(i).Instance(j).fmuOutputVariableActuator(x).RealVarValue);
-                        }
-
-                        // pass in the vectors as pointers to the first member of the vector
-                        FMU(i).Instance(j).fmistatus = fmiEPlusGetReal(&FMU(i).Instance(j).fmicomponent,
-                                                                       &valueReferenceVec3[0],
-                                                                       &realVarValueVec3[0],
-                                                                       &FMU(i).Instance(j).NumOutputVariablesActuator,
-                                                                       &FMU(i).Instance(j).Index);
-
-                        for (unsigned long x = 1; x <= size(FMU(i).Instance(j).fmuOutputVariableActuator); ++x) {
-                            FMU(i).Instance(j).fmuOutputVariableActuator(x).ValueReference = valueReferenceVec3[x - 1];
-                            FMU(i).Instance(j).fmuOutputVariableActuator(x).RealVarValue = realVarValueVec3[x - 1];
-                        }
-
-                        if (FMU(i).Instance(j).fmistatus != fmiOK) {
-                            ShowSevereError("ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs");
-                            ShowContinueError("in instance \"" + FMU(i).Instance(j).Name + "\" of FMU \"" + FMU(i).Name + "\"");
-                            ShowContinueError("Error Code = \"" + TrimSigDigits(FMU(i).Instance(j).fmistatus) + "\"");
-                            ErrorsFound = true;
-                            StopExternalInterfaceIfError();
-                        }
+                    for (k = 1; k <= FMU(i).Instance(j).NumOutputVariablesVariable; ++k) {
+                        FMU(i).Instance(j).fmuOutputVariableVariable(k).RealVarValue = FMU(i).Instance(j).outputValue[x++];
+                    }
+                    for (k = 1; k <= FMU(i).Instance(j).NumOutputVariablesActuator; ++k) {
+                        FMU(i).Instance(j).fmuOutputVariableActuator(k).RealVarValue = FMU(i).Instance(j).outputValue[x++];
                     }
                 }
 
@@ -866,20 +798,13 @@ namespace ExternalInterface {
 
                 if (!FlagReIni) {
 
-                    // generate vectors here first
-                    std::vector<unsigned int> valueReferenceVec4;
-                    for (unsigned long x = 1; x <= size(FMU(i).Instance(j).fmuInputVariable); ++x) {
-                        valueReferenceVec4.push_back(FMU(i).Instance(j).fmuInputVariable(x).ValueReference);
-                    }
-
-                    std::vector<Real64> rtsValueVec4;
-                    for (unsigned long x = 1; x <= size(FMU(i).Instance(j).eplusOutputVariable); ++x) {
-                        rtsValueVec4.push_back(FMU(i).Instance(j).eplusOutputVariable(x).RTSValue);
+                    for (k = 1; k <= FMU(i).Instance(j).NumInputVariablesInIDF; ++k) {
+                        FMU(i).Instance(j).inputValue[k - 1] = FMU(i).Instance(j).eplusOutputVariable(k).RTSValue;
                     }
 
                     FMU(i).Instance(j).fmistatus = fmiEPlusSetReal(&FMU(i).Instance(j).fmicomponent,
-                                                                   &valueReferenceVec4[0],
-                                                                   &rtsValueVec4[0],
+                                                                   FMU(i).Instance(j).inputValueReference.data(),
+                                                                   FMU(i).Instance(j).inputValue.data(),
                                                                    &FMU(i).Instance(j).NumInputVariablesInIDF,
                                                                    &FMU(i).Instance(j).Index);
 
@@ -967,6 +892,53 @@ namespace ExternalInterface {
                 }
             }
         }
+
+        SetupFMUValueReferences();
+    }
+
+    void SetupFMUValueReferences()
+    {
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // This routine packs the value references of each FMU instance into contiguous arrays
+        // so that a time step needs no per-variable lookups or temporary allocations.
+
+        // METHODOLOGY EMPLOYED:
+        // The output value references of the schedules, variables and actuators are stored back to back,
+        // so a single fmiEPlusGetReal call per instance returns all of them.
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+        int i, j, k; // Loop counters
+
+        for (i = 1; i <= NumFMUObjects; ++i) {
+            for (j = 1; j <= FMU(i).NumInstances; ++j) {
+                auto &thisInstance(FMU(i).Instance(j));
+
+                thisInstance.outputValueReference.clear();
+                for (k = 1; k <= thisInstance.NumOutputVariablesSchedule; ++k) {
+                    thisInstance.outputValueReference.push_back(thisInstance.fmuOutputVariableSchedule(k).ValueReference);
+                }
+                for (k = 1; k <= thisInstance.NumOutputVariablesVariable; ++k) {
+                    thisInstance.outputValueReference.push_back(thisInstance.fmuOutputVariableVariable(k).ValueReference);
+                }
+                for (k = 1; k <= thisInstance.NumOutputVariablesActuator; ++k) {
+                    thisInstance.outputValueReference.push_back(thisInstance.fmuOutputVariableActuator(k).ValueReference);
+                }
+                thisInstance.NumOutputValueReferences = static_cast<int>(thisInstance.outputValueReference.size());
+                thisInstance.outputValue.assign(thisInstance.outputValueReference.size(), 0.0);
+
+                thisInstance.inputValueReference.clear();
+                for (k = 1; k <= thisInstance.NumInputVariablesInIDF; ++k) {
+                    thisInstance.inputValueReference.push_back(thisInstance.fmuInputVariable(k).ValueReference);
+                }
+                thisInstance.inputValue.assign(thisInstance.inputValueReference.size(), 0.0);
+            }
+        }
     }
 
     void InitializeFMU()
@@ -2430,6 +2402,7 @@ namespace ExternalInterface {
                     if (NamesOfKeys(iKey) == varKeys(Loop)) {
                         keyVarIndexes(Loop) = keyIndexes(iKey);
                         varTypes(Loop) = varType;
+                        SetInternalVariableUsedByExternalInterface(varType, keyIndexes(iKey));
                         break;
                     }
                 }
@@ -59,6 +59,7 @@ extern "C" {
 
 // C++ Standard Library Headers
 #include <string>
+#include <vector>
 
 // Objexx Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -250,13 +251,20 @@ namespace ExternalInterface {
         Array1D<fmuOutputVariableActuatorType> fmuOutputVariableActuator;
         // Variable Types structure for energyplus input variables from type actuator
         Array1D<eplusInputVariableActuatorType> eplusInputVariableActuator;
+        // Value references of the fmu outputs (schedules, then variables, then actuators), resolved once per instantiation
+        std::vector<fmiValueReference> outputValueReference;
+        std::vector<fmiReal> outputValue; // Values returned by the fmu for outputValueReference
+        int NumOutputValueReferences;     // Number of entries in outputValueReference
+        // Value references of the fmu inputs, resolved once per instantiation
+        std::vector<fmiValueReference> inputValueReference;
+        std::vector<fmiReal> inputValue; // Values passed to the fmu for inputValueReference
 
         // Default Constructor
         InstanceType()
             : Name(BlankString), modelID(BlankString), modelGUID(BlankString), WorkingFolder(BlankString), WorkingFolder_wLib(BlankString),
               fmiVersionNumber(BlankString), NumInputVariablesInFMU(0), NumInputVariablesInIDF(0), NumOutputVariablesInFMU(0),
               NumOutputVariablesInIDF(0), NumOutputVariablesSchedule(0), NumOutputVariablesVariable(0), NumOutputVariablesActuator(0), LenModelID(0),
-              LenModelGUID(0), LenWorkingFolder(0), LenWorkingFolder_wLib(0)
+              LenModelGUID(0), LenWorkingFolder(0), LenWorkingFolder_wLib(0), NumOutputValueReferences(0)
         {
             // fmiStatus, Index, and arrays not initialized in default constructor
         }
@@ -351,6 +359,8 @@ namespace ExternalInterface {
 
     void InstantiateInitializeFMUImport();
 
+    void SetupFMUValueReferences();
+
     void TerminateResetFreeFMUImport(int fmiEndSimulation);
 
     void GetSetVariablesAndDoStepFMUImport();
@@ -47,7 +47,10 @@
 
 // Standard C++ library
 #include <errno.h>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -82,6 +85,8 @@ namespace FileSystem {
     std::string const exeExtension;
 #endif
 
+    std::uint64_t const hashBasis(14695981039346656037ULL); // 64 bit FNV-1a offset basis
+
     void makeNativePath(std::string &path)
     {
         std::replace(path.begin(), path.end(), altpathChar, pathChar);
@@ -246,6 +251,13 @@ namespace FileSystem {
         rename(filePath.c_str(), destination.c_str());
     }
 
+    void copyFile(std::string const &filePath, std::string const &destination)
+    {
+        std::ifstream source(filePath, std::ios::binary);
+        std::ofstream target(destination, std::ios::binary | std::ios::trunc);
+        if (source.is_open() && target.is_open()) target << source.rdbuf();
+    }
+
     int systemCall(std::string const &command)
     {
 #ifdef _WIN32
@@ -276,5 +288,61 @@ namespace FileSystem {
 #endif
     }
 
+    std::uint64_t hashBytes(void const *bytes, std::size_t const numBytes, std::uint64_t hash)
+    {
+        auto const *b(static_cast<unsigned char const *>(bytes));
+        for (std::size_t i = 0; i < numBytes; ++i) {
+            hash ^= b[i];
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    std::string hashToHex(std::uint64_t const hash)
+    {
+        std::ostringstream hex;
+        hex << std::hex << std::setw(16) << std::setfill('0') << hash;
+        return hex.str();
+    }
+
+    bool readCacheFile(std::string const &fileName, std::vector<int> const &header, CacheBlocks const &blocks, bool &sizeMismatch)
+    {
+        sizeMismatch = false;
+        std::ifstream ifs(fileName, std::ios::binary);
+        if (!ifs) return false;
+
+        std::vector<int> fileHeader(header.size(), 0);
+        ifs.read(reinterpret_cast<char *>(fileHeader.data()), fileHeader.size() * sizeof(int));
+        if (!ifs || fileHeader != header) return false;
+
+        // Check the length first so a truncated file cannot leave partly loaded blocks behind
+        std::streamoff expectedSize(header.size() * sizeof(int));
+        for (auto const &block : blocks) {
+            expectedSize += block.second;
+        }
+        ifs.seekg(0, std::ios::end);
+        if (ifs.tellg() != expectedSize) {
+            sizeMismatch = true;
+            return false;
+        }
+        ifs.seekg(header.size() * sizeof(int), std::ios::beg);
+
+        for (auto const &block : blocks) {
+            ifs.read(block.first, block.second);
+        }
+        return bool(ifs);
+    }
+
+    bool writeCacheFile(std::string const &fileName, std::vector<int> const &header, CacheBlocks const &blocks)
+    {
+        std::ofstream ofs(fileName, std::ios::binary | std::ios::trunc);
+        if (!ofs) return false;
+        ofs.write(reinterpret_cast<char const *>(header.data()), header.size() * sizeof(int));
+        for (auto const &block : blocks) {
+            ofs.write(block.first, block.second);
+        }
+        return bool(ofs);
+    }
+
 } // namespace FileSystem
 } // namespace EnergyPlus
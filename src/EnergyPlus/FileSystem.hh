@@ -49,6 +49,11 @@
 #define FileSystem_hh_INCLUDED
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace EnergyPlus {
 
@@ -56,6 +61,8 @@ namespace FileSystem {
 
     extern std::string const exeExtension;
 
+    extern std::uint64_t const hashBasis; // Hash of no bytes, which hashes of several pieces start from
+
     void makeNativePath(std::string &path);
 
     std::string getFileName(std::string const &filePath);
@@ -81,12 +88,47 @@ namespace FileSystem {
 
     void moveFile(std::string const &filePath, std::string const &destination);
 
+    void copyFile(std::string const &filePath, std::string const &destination);
+
     int systemCall(std::string const &command);
 
     void removeFile(std::string const &fileName);
 
     void linkFile(std::string const &fileName, std::string const &link);
 
+    // 64 bit FNV-1a hash of a byte range, continuing from hash. Unlike std::hash it is the same in every build and run,
+    // so it can be used to name and check files that are kept between runs.
+    std::uint64_t hashBytes(void const *bytes, std::size_t const numBytes, std::uint64_t hash = hashBasis);
+
+    inline std::uint64_t hashString(std::string const &text, std::uint64_t const hash = hashBasis)
+    {
+        return hashBytes(text.data(), text.size(), hash);
+    }
+
+    // The 16 hex digits of a hash, as used in cache file names
+    std::string hashToHex(std::uint64_t const hash);
+
+    // A binary cache file is a header of ints followed by the raw memory of a list of blocks, so it is only meant to be
+    // read back by the same build on the same platform
+    typedef std::vector<std::pair<char *, std::size_t>> CacheBlocks;
+
+    template <typename A> void addCacheArray(CacheBlocks &blocks, A &values)
+    {
+        blocks.emplace_back(reinterpret_cast<char *>(values.data()), values.size() * sizeof(values[0]));
+    }
+
+    template <typename T> void addCacheValue(CacheBlocks &blocks, T &value)
+    {
+        blocks.emplace_back(reinterpret_cast<char *>(&value), sizeof(value));
+    }
+
+    // Fills the blocks from a cache file. Returns false, leaving the blocks untouched, when the file is missing, its
+    // header differs or its length does not match the blocks; sizeMismatch is set in the last case.
+    bool readCacheFile(std::string const &fileName, std::vector<int> const &header, CacheBlocks const &blocks, bool &sizeMismatch);
+
+    // Returns false if the file cannot be opened
+    bool writeCacheFile(std::string const &fileName, std::vector<int> const &header, CacheBlocks const &blocks);
+
 } // namespace FileSystem
 } // namespace EnergyPlus
 #endif
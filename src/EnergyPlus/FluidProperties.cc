@@ -57,6 +57,7 @@
 
 // EnergyPlus Headers
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
 #include <InputProcessing/InputProcessor.hh>
@@ -5088,6 +5089,11 @@ namespace FluidProperties {
                     break;
                 }
             }
+            // Grids to find the table interval of the property functions directly
+            if (GlycolData(GlycolNum).CpDataPresent) SetupTableGrid(GlycolData(GlycolNum).CpTempGrid, GlycolData(GlycolNum).CpTemps);
+            if (GlycolData(GlycolNum).RhoDataPresent) SetupTableGrid(GlycolData(GlycolNum).RhoTempGrid, GlycolData(GlycolNum).RhoTemps);
+            if (GlycolData(GlycolNum).CondDataPresent) SetupTableGrid(GlycolData(GlycolNum).CondTempGrid, GlycolData(GlycolNum).CondTemps);
+            if (GlycolData(GlycolNum).ViscDataPresent) SetupTableGrid(GlycolData(GlycolNum).ViscTempGrid, GlycolData(GlycolNum).ViscTemps);
             Failure = false;
             // Check to see that all are set to non-zero
             if (GlycolData(GlycolNum).CpDataPresent) {
@@ -5122,7 +5128,7 @@ namespace FluidProperties {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Linda Lawrie
         //       DATE WRITTEN   March 2008
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, set up the table search grids
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -5246,6 +5252,12 @@ namespace FluidProperties {
                 RefrigData(RefrigNum).RhofgHighTempIndex = IndexNum;
                 break;
             }
+            // Grids to start the table searches of the property functions near the answer
+            SetupTableGrid(RefrigData(RefrigNum).PsTempGrid, RefrigData(RefrigNum).PsTemps);
+            SetupTableGrid(RefrigData(RefrigNum).PsPresGrid, RefrigData(RefrigNum).PsValues);
+            SetupTableGrid(RefrigData(RefrigNum).HTempGrid, RefrigData(RefrigNum).HTemps);
+            SetupTableGrid(RefrigData(RefrigNum).SHTempGrid, RefrigData(RefrigNum).SHTemps);
+            SetupTableGrid(RefrigData(RefrigNum).SHPressGrid, RefrigData(RefrigNum).SHPress);
             Failure = false;
             // Check to see that all are set to non-zero
             if (RefrigData(RefrigNum).NumPsPoints > 0) {
@@ -6481,15 +6493,14 @@ namespace FluidProperties {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Simon Rees
         //       DATE WRITTEN   24 May 2002
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, calculation moved to the refrigerant index version
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS FUNCTION:
         // This finds the saturation pressure for given temperature.
 
         // METHODOLOGY EMPLOYED:
-        // Calls FindArrayIndex to find indices either side of requested temperature
-        // and linearly interpolates the corresponding saturation pressure values.
+        // Finds the refrigerant index and calls the index version without an interval hint.
 
         // REFERENCES:
         // na
@@ -6497,14 +6508,11 @@ namespace FluidProperties {
         // USE STATEMENTS:
         // na
 
-        // Return value
-        Real64 ReturnValue;
-
         // Locals
         // FUNCTION ARGUMENT DEFINITIONS:
 
         // FUNCTION PARAMETER DEFINITIONS:
-        static std::string const RoutineName("GetSatPressureRefrig: ");
+        // na
 
         // INTERFACE BLOCK SPECIFICATIONS:
         // na
@@ -6513,12 +6521,7 @@ namespace FluidProperties {
         // na
 
         // FUNCTION LOCAL VARIABLE DECLARATIONS:
-        int HiTempIndex;        // index value of next highest Temperature from table
-        int LoTempIndex;        // index value of next lowest Temperature from table
-        int RefrigNum;          // index for refrigerant under consideration
-        Real64 TempInterpRatio; // ratio to interpolate in temperature domain
-        // error counters and dummy string
-        bool ErrorFlag; // error flag for current call
+        int RefrigNum; // index for refrigerant under consideration
 
         // FLOW:
         if (GetInput) {
@@ -6531,8 +6534,6 @@ namespace FluidProperties {
             ReportFatalRefrigerantErrors(NumOfRefrigerants, RefrigNum, true, Refrigerant, "GetSatPressureRefrig", "properties", CalledFrom);
         }
 
-        ErrorFlag = false;
-
         if (RefrigIndex > 0) {
             RefrigNum = RefrigIndex;
         } else {
@@ -6543,10 +6544,50 @@ namespace FluidProperties {
             }
             RefrigIndex = RefrigNum;
         }
+        RefrigPropertyHint Hint;
+        return GetSatPressureRefrig(RefrigNum, Temperature, Hint, CalledFrom);
+    }
+
+    Real64 GetSatPressureRefrig(int const RefrigNum,          // Index to Refrigerant Properties
+                                Real64 const Temperature,     // actual temperature given as input
+                                RefrigPropertyHint &Hint,     // table intervals found by the previous call of this caller
+                                std::string const &CalledFrom // routine this function was called from (error messages)
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         Simon Rees
+        //       DATE WRITTEN   24 May 2002
+        //       MODIFIED       October 2026, refrigerant index and interval hint instead of the name
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // This finds the saturation pressure for given temperature for a refrigerant
+        // whose index is already known (e.g. from an earlier call of the name version).
+
+        // METHODOLOGY EMPLOYED:
+        // Calls FindArrayIndex to find indices either side of requested temperature,
+        // starting from the caller's last interval, and linearly interpolates the
+        // corresponding saturation pressure values.
+
+        // Return value
+        Real64 ReturnValue;
+
+        // FUNCTION PARAMETER DEFINITIONS:
+        static std::string const RoutineName("GetSatPressureRefrig: ");
+
+        // FUNCTION LOCAL VARIABLE DECLARATIONS:
+        int HiTempIndex;        // index value of next highest Temperature from table
+        int LoTempIndex;        // index value of next lowest Temperature from table
+        Real64 TempInterpRatio; // ratio to interpolate in temperature domain
+        // error counters and dummy string
+        bool ErrorFlag(false); // error flag for current call
+
+        assert((RefrigNum > 0) && (RefrigNum <= NumOfRefrigerants));
         auto const &refrig(RefrigData(RefrigNum));
 
         // determine array indices for
-        LoTempIndex = FindArrayIndex(Temperature, refrig.PsTemps, refrig.PsLowTempIndex, refrig.PsHighTempIndex);
+        LoTempIndex = FindArrayIndex(Temperature, refrig.PsTemps, refrig.PsLowTempIndex, refrig.PsHighTempIndex, refrig.PsTempGrid, Hint.PsTemp);
         HiTempIndex = LoTempIndex + 1;
 
         // check for out of data bounds problems
@@ -6602,15 +6643,14 @@ namespace FluidProperties {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Simon Rees
         //       DATE WRITTEN   24 May 2002
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, calculation moved to the refrigerant index version
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS FUNCTION:
         // This finds the saturation temperature for given pressure.
 
         // METHODOLOGY EMPLOYED:
-        // Calls FindArrayIndex to find indices either side of requested pressure
-        // and linearly interpolates the corresponding saturation temperature values.
+        // Finds the refrigerant index and calls the index version without an interval hint.
 
         // REFERENCES:
         // na
@@ -6618,14 +6658,11 @@ namespace FluidProperties {
         // USE STATEMENTS:
         // na
 
-        // Return value
-        Real64 ReturnValue;
-
         // Locals
         // FUNCTION ARGUMENT DEFINITIONS:
 
         // FUNCTION PARAMETER DEFINITIONS:
-        static std::string const RoutineName("GetSatTemperatureRefrig: ");
+        // na
 
         // INTERFACE BLOCK SPECIFICATIONS:
         // na
@@ -6634,12 +6671,7 @@ namespace FluidProperties {
         // na
 
         // FUNCTION LOCAL VARIABLE DECLARATIONS:
-        int HiPresIndex;        // index value of next highest Temperature from table
-        int LoPresIndex;        // index value of next lowest Temperature from table
-        int RefrigNum;          // index for refrigerant under consideration
-        Real64 PresInterpRatio; // ratio to interpolate in temperature domain
-        // error counters and dummy string
-        bool ErrorFlag; // error flag for current call
+        int RefrigNum; // index for refrigerant under consideration
 
         // FLOW:
         if (GetInput) {
@@ -6652,8 +6684,6 @@ namespace FluidProperties {
             ReportFatalRefrigerantErrors(NumOfRefrigerants, RefrigNum, true, Refrigerant, "GetSatTemperatureRefrig", "properties", CalledFrom);
         }
 
-        ErrorFlag = false;
-
         if (RefrigIndex > 0) {
             RefrigNum = RefrigIndex;
         } else {
@@ -6664,10 +6694,50 @@ namespace FluidProperties {
             }
             RefrigIndex = RefrigNum;
         }
+        RefrigPropertyHint Hint;
+        return GetSatTemperatureRefrig(RefrigNum, Pressure, Hint, CalledFrom);
+    }
+
+    Real64 GetSatTemperatureRefrig(int const RefrigNum,          // Index to Refrigerant Properties
+                                   Real64 const Pressure,        // actual pressure given as input
+                                   RefrigPropertyHint &Hint,     // table intervals found by the previous call of this caller
+                                   std::string const &CalledFrom // routine this function was called from (error messages)
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         Simon Rees
+        //       DATE WRITTEN   24 May 2002
+        //       MODIFIED       October 2026, refrigerant index and interval hint instead of the name
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // This finds the saturation temperature for given pressure for a refrigerant
+        // whose index is already known.
+
+        // METHODOLOGY EMPLOYED:
+        // Calls FindArrayIndex to find indices either side of requested pressure,
+        // starting from the caller's last interval, and linearly interpolates the
+        // corresponding saturation temperature values.
+
+        // Return value
+        Real64 ReturnValue;
+
+        // FUNCTION PARAMETER DEFINITIONS:
+        static std::string const RoutineName("GetSatTemperatureRefrig: ");
+
+        // FUNCTION LOCAL VARIABLE DECLARATIONS:
+        int HiPresIndex;        // index value of next highest Temperature from table
+        int LoPresIndex;        // index value of next lowest Temperature from table
+        Real64 PresInterpRatio; // ratio to interpolate in temperature domain
+        // error counters and dummy string
+        bool ErrorFlag(false); // error flag for current call
+
+        assert((RefrigNum > 0) && (RefrigNum <= NumOfRefrigerants));
         auto const &refrig(RefrigData(RefrigNum));
 
         // get the array indices
-        LoPresIndex = FindArrayIndex(Pressure, refrig.PsValues, refrig.PsLowPresIndex, refrig.PsHighPresIndex);
+        LoPresIndex = FindArrayIndex(Pressure, refrig.PsValues, refrig.PsLowPresIndex, refrig.PsHighPresIndex, refrig.PsPresGrid, Hint.PsPres);
         HiPresIndex = LoPresIndex + 1;
 
         // check for out of data bounds problems
@@ -6725,6 +6795,7 @@ namespace FluidProperties {
         //       DATE WRITTEN   10 December 99
         //       MODIFIED       Rick Strand (April 2000, May 2000)
         //                      Simon Rees (May 2002)
+        //                      October 2026, calculation moved to the refrigerant index version
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS FUNCTION:
@@ -6769,12 +6840,6 @@ namespace FluidProperties {
             ReportFatalRefrigerantErrors(NumOfRefrigerants, RefrigNum, true, Refrigerant, RoutineName, "properties", CalledFrom);
         }
 
-        if ((Quality < 0.0) || (Quality > 1.0)) {
-            ShowSevereError(RoutineName + ": Refrigerant \"" + Refrigerant + "\", invalid quality, called from " + CalledFrom);
-            ShowContinueError("Saturated refrigerant quality must be between 0 and 1, entered value=[" + RoundSigDigits(Quality, 4) + "].");
-            ShowFatalError("Program terminates due to preceding condition.");
-        }
-
         if (RefrigIndex > 0) {
             RefrigNum = RefrigIndex;
         } else {
@@ -6785,11 +6850,55 @@ namespace FluidProperties {
             }
             RefrigIndex = RefrigNum;
         }
+        RefrigPropertyHint Hint;
+        return GetSatEnthalpyRefrig(RefrigNum, Temperature, Quality, Hint, CalledFrom);
+    }
+
+    Real64 GetSatEnthalpyRefrig(int const RefrigNum,          // Index to Refrigerant Properties
+                                Real64 const Temperature,     // actual temperature given as input
+                                Real64 const Quality,         // actual quality given as input
+                                RefrigPropertyHint &Hint,     // table intervals found by the previous call of this caller
+                                std::string const &CalledFrom // routine this function was called from (error messages)
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         Mike Turner
+        //       DATE WRITTEN   10 December 99
+        //       MODIFIED       October 2026, refrigerant index and interval hint instead of the name
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // This finds enthalpy for given temperature and a quality under the vapor dome
+        // for a refrigerant whose index is already known.
+
+        // METHODOLOGY EMPLOYED:
+        // Calls GetInterpolatedSatProp, starting from the caller's last temperature interval,
+        // to linearly interpolate between the saturated liquid and vapour enthalpies.
+
+        // FUNCTION PARAMETER DEFINITIONS:
+        static std::string const RoutineName("GetSatEnthalpyRefrig");
+
+        assert((RefrigNum > 0) && (RefrigNum <= NumOfRefrigerants));
         auto const &refrig(RefrigData(RefrigNum));
 
+        if ((Quality < 0.0) || (Quality > 1.0)) {
+            ShowSevereError(RoutineName + ": Refrigerant \"" + refrig.Name + "\", invalid quality, called from " + CalledFrom);
+            ShowContinueError("Saturated refrigerant quality must be between 0 and 1, entered value=[" + RoundSigDigits(Quality, 4) + "].");
+            ShowFatalError("Program terminates due to preceding condition.");
+        }
+
         // Apply linear interpolation function
-        return GetInterpolatedSatProp(
-            Temperature, refrig.HTemps, refrig.HfValues, refrig.HfgValues, Quality, CalledFrom, refrig.HfLowTempIndex, refrig.HfHighTempIndex);
+        return GetInterpolatedSatProp(Temperature,
+                                      refrig.HTemps,
+                                      refrig.HfValues,
+                                      refrig.HfgValues,
+                                      Quality,
+                                      CalledFrom,
+                                      refrig.HfLowTempIndex,
+                                      refrig.HfHighTempIndex,
+                                      refrig.HTempGrid,
+                                      Hint.HTemp);
     }
 
     //*****************************************************************************
@@ -7049,6 +7158,7 @@ namespace FluidProperties {
         //       DATE WRITTEN   10 December 99
         //       MODIFIED       Rick Strand (April 2000, May 2000)
         //       MODIFIED       Simon Rees (May 2002)
+        //       MODIFIED       October 2026, calculation moved to the refrigerant index version
         //       RE-ENGINEERED  N/A
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -7073,23 +7183,70 @@ namespace FluidProperties {
         // USE STATEMENTS:
         // na
 
+        // SUBROUTINE PARAMETER DEFINITIONS:
+        static std::string const RoutineNameNoColon("GetSupHeatEnthalpyRefrig");
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+        int RefrigNum; // index for refrigerant under consideration
+
+        // see if data is there
+        if (GetInput) {
+            GetFluidPropertiesData();
+            GetInput = false;
+        }
+
+        RefrigNum = 0;
+        if (NumOfRefrigerants == 0) {
+            ReportFatalRefrigerantErrors(NumOfRefrigerants, RefrigNum, true, Refrigerant, RoutineNameNoColon, "properties", CalledFrom);
+        }
+
+        if (RefrigIndex > 0) {
+            RefrigNum = RefrigIndex;
+        } else {
+            // Find which refrigerant (index) is being requested
+            RefrigNum = FindRefrigerant(Refrigerant);
+            if (RefrigNum == 0) {
+                ReportFatalRefrigerantErrors(NumOfRefrigerants, RefrigNum, true, Refrigerant, RoutineNameNoColon, "properties", CalledFrom);
+            }
+            RefrigIndex = RefrigNum;
+        }
+        RefrigPropertyHint Hint;
+        return GetSupHeatEnthalpyRefrig(RefrigNum, Temperature, Pressure, Hint, CalledFrom);
+    }
+
+    Real64 GetSupHeatEnthalpyRefrig(int const RefrigNum,          // Index to Refrigerant Properties
+                                    Real64 const Temperature,     // actual temperature given as input
+                                    Real64 const Pressure,        // actual pressure given as input
+                                    RefrigPropertyHint &Hint,     // table intervals found by the previous call of this caller
+                                    std::string const &CalledFrom // routine this function was called from (error messages)
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         Mike Turner
+        //       DATE WRITTEN   10 December 99
+        //       MODIFIED       Rick Strand (April 2000, May 2000)
+        //       MODIFIED       Simon Rees (May 2002)
+        //       MODIFIED       October 2026, refrigerant index and interval hint instead of the name
+        //       RE-ENGINEERED  N/A
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Performs linear interpolation between pressures and temperatures and
+        // returns enthalpy values for a refrigerant whose index is already known.
+        // Works only in superheated region.
+
+        // METHODOLOGY EMPLOYED:
+        // See the name version of this function. The table intervals are searched
+        // starting from the caller's last intervals.
+
         // Return value
         Real64 ReturnValue;
 
-        // Locals
-        // FUNCTION ARGUMENT DEFINITIONS:
-
         // FUNCTION PARAMETER DEFINITIONS:
         static std::string const RoutineName("GetSupHeatEnthalpyRefrig: ");
         static std::string const RoutineNameNoSpace("GetSupHeatEnthalpyRefrig:");
         static std::string const RoutineNameNoColon("GetSupHeatEnthalpyRefrig");
 
-        // INTERFACE BLOCK SPECIFICATIONS:
-        // na
-
-        // DERIVED TYPE DEFINITIONS:
-        // na
-
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
         Real64 PressInterpRatio; // Interpolation factor w.r.t pressure
         Real64 TempInterpRatio;  // Interpolation factor w.r.t temperature
@@ -7103,47 +7260,19 @@ namespace FluidProperties {
         int HiTempIndex;  // high temperature index value
         int HiPressIndex; // high pressure index value
         int LoPressIndex; // low index value of Pressure from table
-        int RefrigNum;    // index for refrigerant under consideration
         int TempIndex;    // low index value of Temperature from table
 
         // error counters and dummy string
-        int ErrCount;             // error counter for current call
-        int CurTempRangeErrCount; // error counter for current call
-        int CurPresRangeErrCount; // error counter for current call
+        int ErrCount(0);             // error counter for current call
+        int CurTempRangeErrCount(0); // error counter for current call
+        int CurPresRangeErrCount(0); // error counter for current call
         static int SatErrCount(0);
 
-        // see if data is there
-        if (GetInput) {
-            GetFluidPropertiesData();
-            GetInput = false;
-        }
-
-        RefrigNum = 0;
-        if (NumOfRefrigerants == 0) {
-            ReportFatalRefrigerantErrors(NumOfRefrigerants, RefrigNum, true, Refrigerant, RoutineNameNoColon, "properties", CalledFrom);
-        }
-
-        ErrCount = 0;
-        CurTempRangeErrCount = 0;
-        CurPresRangeErrCount = 0;
-
-        // Find which refrigerant (index) is being requested and then determine
-        // where the temperature and pressure are within the temperature and
-        // pressure arrays, respectively
-        if (RefrigIndex > 0) {
-            RefrigNum = RefrigIndex;
-        } else {
-            // Find which refrigerant (index) is being requested
-            RefrigNum = FindRefrigerant(Refrigerant);
-            if (RefrigNum == 0) {
-                ReportFatalRefrigerantErrors(NumOfRefrigerants, RefrigNum, true, Refrigerant, RoutineNameNoColon, "properties", CalledFrom);
-            }
-            RefrigIndex = RefrigNum;
-        }
+        assert((RefrigNum > 0) && (RefrigNum <= NumOfRefrigerants));
         auto const &refrig(RefrigData(RefrigNum));
 
-        TempIndex = FindArrayIndex(Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts);
-        LoPressIndex = FindArrayIndex(Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts);
+        TempIndex = FindArrayIndex(Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts, refrig.SHTempGrid, Hint.SHTemp);
+        LoPressIndex = FindArrayIndex(Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts, refrig.SHPressGrid, Hint.SHPress);
 
         // check temperature data range and attempt to cap if necessary
         if ((TempIndex > 0) && (TempIndex < refrig.NumSuperTempPts)) { // in range
@@ -7190,16 +7319,16 @@ namespace FluidProperties {
         // to give reasonable interpolation near saturation reset any point with zero value
         // in table to saturation value
         if (LoTempLoEnthalpy <= 0.0) {
-            LoTempLoEnthalpy = GetSatEnthalpyRefrig(Refrigerant, Temperature, 1.0, RefrigNum, RoutineNameNoColon);
+            LoTempLoEnthalpy = GetSatEnthalpyRefrig(RefrigNum, Temperature, 1.0, Hint, RoutineNameNoColon);
         }
         if (LoTempHiEnthalpy <= 0.0) {
-            LoTempHiEnthalpy = GetSatEnthalpyRefrig(Refrigerant, Temperature, 1.0, RefrigNum, RoutineNameNoColon);
+            LoTempHiEnthalpy = GetSatEnthalpyRefrig(RefrigNum, Temperature, 1.0, Hint, RoutineNameNoColon);
         }
         if (HiTempLoEnthalpy <= 0.0) {
-            HiTempLoEnthalpy = GetSatEnthalpyRefrig(Refrigerant, Temperature, 1.0, RefrigNum, RoutineNameNoColon);
+            HiTempLoEnthalpy = GetSatEnthalpyRefrig(RefrigNum, Temperature, 1.0, Hint, RoutineNameNoColon);
         }
         if (HiTempHiEnthalpy <= 0.0) {
-            HiTempHiEnthalpy = GetSatEnthalpyRefrig(Refrigerant, Temperature, 1.0, RefrigNum, RoutineNameNoColon);
+            HiTempHiEnthalpy = GetSatEnthalpyRefrig(RefrigNum, Temperature, 1.0, Hint, RoutineNameNoColon);
         }
 
         // interpolate w.r.t. pressure
@@ -7216,7 +7345,7 @@ namespace FluidProperties {
             (refrig.HshValues(LoPressIndex, HiTempIndex) <= 0.0) && (refrig.HshValues(HiPressIndex, HiTempIndex) <= 0.0)) {
             ++SatErrCount;
             // set return value
-            ReturnValue = GetSatEnthalpyRefrig(Refrigerant, Temperature, 1.0, RefrigNum, RoutineNameNoSpace + CalledFrom);
+            ReturnValue = GetSatEnthalpyRefrig(RefrigNum, Temperature, 1.0, Hint, RoutineNameNoSpace + CalledFrom);
             // send warning
             if (!WarmupFlag) {
                 RefrigErrorTracking(RefrigNum).SatSupEnthalpyErrCount += SatErrCount;
@@ -7604,6 +7733,7 @@ namespace FluidProperties {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Rongpeng Zhang
         //       DATE WRITTEN   Jan 2016
+        //       MODIFIED       October 2026, optional direct inversion of the enthalpy table
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -7612,6 +7742,8 @@ namespace FluidProperties {
 
         // METHODOLOGY EMPLOYED:
         // Perform iterations to identify the temperature by calling GetSupHeatEnthalpyRefrig.
+        // With RefrigerantTableInversion the temperature is found without iterating by
+        // InvertSupHeatEnthalpyRefrig where the table allows it.
 
         // USE STATEMENTS:
         using General::SolveRoot;
@@ -7695,6 +7827,11 @@ namespace FluidProperties {
             return ReturnValue;
         }
 
+        // Superheated region away from the saturation dome: invert the enthalpy table directly
+        if (DataSystemVariables::RefrigerantTableInversion && InvertSupHeatEnthalpyRefrig(RefrigNum, Pressure, Enthalpy, TempLow, TempUp, Temp)) {
+            return Temp;
+        }
+
         // Perform iterations to obtain the temperature level
         {
             Array1D<Real64> Par(6);       // Parameters passed to RegulaFalsi
@@ -7713,6 +7850,77 @@ namespace FluidProperties {
         return ReturnValue;
     }
 
+    bool InvertSupHeatEnthalpyRefrig(int const RefrigNum,     // index for refrigerant under consideration
+                                     Real64 const Pressure,   // actual pressure given as input
+                                     Real64 const Enthalpy,   // actual enthalpy given as input
+                                     Real64 const TempLow,    // lower bound of temperature
+                                     Real64 const TempUp,     // upper bound of temperature
+                                     Real64 &Temperature      // temperature at which GetSupHeatEnthalpyRefrig returns Enthalpy
+    )
+    {
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Finds the superheated temperature for the given pressure and enthalpy between TempLow
+        // and TempUp without iterating. Returns false where the caller has to iterate instead:
+        // pressure outside the table, bounds outside the table, or a table cell touching the
+        // saturation dome (zero enthalpy entries, which GetSupHeatEnthalpyRefrig replaces).
+
+        // METHODOLOGY EMPLOYED:
+        // GetSupHeatEnthalpyRefrig interpolates the table bilinearly, so along an isobar the enthalpy
+        // is linear in temperature within each table interval. The enthalpies at the interval
+        // temperatures are interpolated in pressure on the fly, the interval holding the enthalpy is
+        // found by interval halving and the temperature follows from one linear inversion. This is
+        // the exact root of the table, where SolveRoot stops at its residual tolerance.
+
+        auto const &refrig(RefrigData(RefrigNum));
+        int const NumTemps(refrig.NumSuperTempPts);
+        int const NumPress(refrig.NumSuperPressPts);
+
+        // Same scaling threshold as GetSupHeatTempRefrigResidual
+        if (std::abs(Enthalpy) < 100.0) return false;
+
+        int const LoPressIndex(FindArrayIndex(Pressure, refrig.SHPress, 1, NumPress, refrig.SHPressGrid));
+        if ((LoPressIndex < 1) || (LoPressIndex >= NumPress)) return false;
+        int const HiPressIndex(LoPressIndex + 1);
+        Real64 const PressInterpRatio((Pressure - refrig.SHPress(LoPressIndex)) / (refrig.SHPress(HiPressIndex) - refrig.SHPress(LoPressIndex)));
+
+        int const LoTempIndex(FindArrayIndex(TempLow, refrig.SHTemps, 1, NumTemps, refrig.SHTempGrid));
+        int const UpTempIndex(FindArrayIndex(TempUp, refrig.SHTemps, 1, NumTemps, refrig.SHTempGrid));
+        if ((LoTempIndex < 1) || (UpTempIndex >= NumTemps)) return false;
+
+        // Enthalpy along the isobar at a table temperature, or zero if a table entry lies in the dome
+        auto IsobarEnthalpy = [&](int const TempIndex) -> Real64 {
+            Real64 const LoPressEnthalpy(refrig.HshValues(LoPressIndex, TempIndex));
+            Real64 const HiPressEnthalpy(refrig.HshValues(HiPressIndex, TempIndex));
+            if ((LoPressEnthalpy <= 0.0) || (HiPressEnthalpy <= 0.0)) return 0.0;
+            return PressInterpRatio * HiPressEnthalpy + (1.0 - PressInterpRatio) * LoPressEnthalpy;
+        };
+
+        // Interval halving over the table temperatures between the bounds, the bounds
+        // themselves being known to bracket the enthalpy
+        int Lo(LoTempIndex);
+        int Hi(UpTempIndex + 1);
+        while (Hi - Lo > 1) {
+            int const Mid((Lo + Hi) >> 1);
+            Real64 const MidEnthalpy(IsobarEnthalpy(Mid));
+            if (MidEnthalpy <= 0.0) return false;
+            (MidEnthalpy < Enthalpy ? Lo : Hi) = Mid;
+        }
+
+        Real64 const LoEnthalpy(IsobarEnthalpy(Lo));
+        Real64 const HiEnthalpy(IsobarEnthalpy(Lo + 1));
+        if ((LoEnthalpy <= 0.0) || (HiEnthalpy <= LoEnthalpy)) return false;
+
+        Temperature = refrig.SHTemps(Lo) + (Enthalpy - LoEnthalpy) / (HiEnthalpy - LoEnthalpy) * (refrig.SHTemps(Lo + 1) - refrig.SHTemps(Lo));
+        Temperature = max(TempLow, min(Temperature, TempUp));
+        return true;
+    }
+
     Real64 GetSupHeatTempRefrigResidual(Real64 const Temp, // temperature of the refrigerant
                                         Array1<Real64> const &Par)
     {
@@ -8042,7 +8250,7 @@ namespace FluidProperties {
         // FUNCTION INFORMATION:
         //       AUTHOR         Rick Strand
         //       DATE WRITTEN   June 2004
-        //       MODIFIED       N/A
+        //       MODIFIED       October 2026, table interval from the temperature grid
         //       RE-ENGINEERED  N/A
 
         // PURPOSE OF THIS FUNCTION:
@@ -8118,14 +8326,16 @@ namespace FluidProperties {
                                       RoundSigDigits(glycol_data.CpLowTempValue, 2) + ',' + RoundSigDigits(glycol_data.CpHighTempValue, 2) + ']');
                     ShowContinueErrorTimeStamp("");
                 }
-                ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too low) for fluid [" + glycol_data.Name +
-                                                   "] specific heat **",
-                                               GlycolErrorTracking(GlycolIndex).SpecHeatLowErrIndex,
-                                               Temperature,
-                                               Temperature,
-                                               _,
-                                               "{C}",
-                                               "{C}");
+                if (!UpdateRecurringErrorAtEnd(GlycolErrorTracking(GlycolIndex).SpecHeatLowErrIndex, Temperature, Temperature)) {
+                    ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too low) for fluid [" + glycol_data.Name +
+                                                       "] specific heat **",
+                                                   GlycolErrorTracking(GlycolIndex).SpecHeatLowErrIndex,
+                                                   Temperature,
+                                                   Temperature,
+                                                   _,
+                                                   "{C}",
+                                                   "{C}");
+                }
             }
             return glycol_data.CpValues(glycol_data.CpLowTempIndex);
         } else if (Temperature > glycol_data.CpHighTempValue) { // Temperature too high
@@ -8137,34 +8347,24 @@ namespace FluidProperties {
                                       RoundSigDigits(glycol_data.CpLowTempValue, 2) + ',' + RoundSigDigits(glycol_data.CpHighTempValue, 2) + ']');
                     ShowContinueErrorTimeStamp("");
                 }
-                ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too high) for fluid [" + glycol_data.Name +
-                                                   "] specific heat **",
-                                               GlycolErrorTracking(GlycolIndex).SpecHeatHighErrIndex,
-                                               Temperature,
-                                               Temperature,
-                                               _,
-                                               "{C}",
-                                               "{C}");
+                if (!UpdateRecurringErrorAtEnd(GlycolErrorTracking(GlycolIndex).SpecHeatHighErrIndex, Temperature, Temperature)) {
+                    ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too high) for fluid [" + glycol_data.Name +
+                                                       "] specific heat **",
+                                                   GlycolErrorTracking(GlycolIndex).SpecHeatHighErrIndex,
+                                                   Temperature,
+                                                   Temperature,
+                                                   _,
+                                                   "{C}",
+                                                   "{C}");
+                }
             }
             return glycol_data.CpValues(glycol_data.CpHighTempIndex);
         } else { // Temperature somewhere between the lowest and highest value
             auto const &glycol_CpTemps(glycol_data.CpTemps);
             auto const &glycol_CpValues(glycol_data.CpValues);
             // bracket is temp > low, <= high (for interpolation
-            // for ( int Loop = glycol_data.CpLowTempIndex + 1; Loop <= glycol_data.CpHighTempIndex; ++Loop ) { //Tuned Replaced by binary search
-            // below 	if ( Temperature > glycol_data.CpTemps( Loop ) ) continue; 	return GetInterpValue( Temperature, glycol_CpTemps( Loop - 1
-            //), glycol_CpTemps( Loop ), glycol_CpValues( Loop - 1 ), glycol_CpValues( Loop ) ); 	break; // DO loop
-            //}
-            // assert( std::is_sorted( glycol_CpTemps.begin(), glycol_CpTemps.end() ) ); // Sorted temperature array is assumed: Enable if/when arrays
-            // have begin()/end()
-            assert(glycol_CpTemps.size() <=
-                   static_cast<std::size_t>(std::numeric_limits<int>::max())); // Array indexes are int now so this is future protection
-            int beg(1), mid, end(glycol_CpTemps.isize());                      // 1-based indexing
-            assert(end > 0);
-            while (beg + 1 < end) {
-                mid = ((beg + end) >> 1); // bit shifting is faster than /2
-                (Temperature > glycol_CpTemps(mid) ? beg : end) = mid;
-            } // Invariant: glycol_CpTemps[beg] <= Temperature <= glycol_CpTemps[end]
+            int const beg(FindArrayIndex(Temperature, glycol_CpTemps, 1, glycol_CpTemps.isize(), glycol_data.CpTempGrid)); // 1-based indexing
+            int const end(min(beg + 1, glycol_CpTemps.isize()));
             return GetInterpValue_fast(Temperature, glycol_CpTemps(beg), glycol_CpTemps(end), glycol_CpValues(beg), glycol_CpValues(end));
         }
     }
@@ -8181,7 +8381,7 @@ namespace FluidProperties {
         // FUNCTION INFORMATION:
         //       AUTHOR         Rick Strand
         //       DATE WRITTEN   June 2004
-        //       MODIFIED       N/A
+        //       MODIFIED       October 2026, table interval from the temperature grid
         //       RE-ENGINEERED  N/A
 
         // PURPOSE OF THIS FUNCTION:
@@ -8217,7 +8417,6 @@ namespace FluidProperties {
         // na
 
         // FUNCTION LOCAL VARIABLE DECLARATIONS:
-        int Loop; // DO loop counter
         static int HighTempLimitErr(0);
         static int LowTempLimitErr(0);
         int GlycolNum;
@@ -8263,16 +8462,21 @@ namespace FluidProperties {
             HighErrorThisTime = true;
             ReturnValue = GlycolData(GlycolIndex).RhoValues(GlycolData(GlycolIndex).RhoHighTempIndex);
         } else { // Temperature somewhere between the lowest and highest value
-            ReturnValue = GlycolData(GlycolIndex).RhoValues(GlycolData(GlycolIndex).RhoLowTempIndex);
+            auto const &glycol_data(GlycolData(GlycolIndex));
             // bracket is temp > low, <= high (for interpolation
-            for (Loop = GlycolData(GlycolIndex).RhoLowTempIndex + 1; Loop <= GlycolData(GlycolIndex).RhoHighTempIndex; ++Loop) {
-                if (Temperature > GlycolData(GlycolIndex).RhoTemps(Loop)) continue;
+            int const LoTempIndex(FindArrayIndex(Temperature,
+                                                 glycol_data.RhoTemps,
+                                                 glycol_data.RhoLowTempIndex,
+                                                 glycol_data.RhoHighTempIndex,
+                                                 glycol_data.RhoTempGrid));
+            if (LoTempIndex < glycol_data.RhoHighTempIndex) {
                 ReturnValue = GetInterpValue(Temperature,
-                                             GlycolData(GlycolIndex).RhoTemps(Loop - 1),
-                                             GlycolData(GlycolIndex).RhoTemps(Loop),
-                                             GlycolData(GlycolIndex).RhoValues(Loop - 1),
-                                             GlycolData(GlycolIndex).RhoValues(Loop));
-                break; // DO loop
+                                             glycol_data.RhoTemps(LoTempIndex),
+                                             glycol_data.RhoTemps(LoTempIndex + 1),
+                                             glycol_data.RhoValues(LoTempIndex),
+                                             glycol_data.RhoValues(LoTempIndex + 1));
+            } else {
+                ReturnValue = glycol_data.RhoValues(glycol_data.RhoLowTempIndex);
             }
         }
 
@@ -8298,14 +8502,16 @@ namespace FluidProperties {
                 ShowContinueErrorTimeStamp("");
             }
             if (LowErrorThisTime) {
-                ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too low) for fluid [" + GlycolData(GlycolIndex).Name +
-                                                   "] density **",
-                                               GlycolErrorTracking(GlycolIndex).DensityLowErrIndex,
-                                               Temperature,
-                                               Temperature,
-                                               _,
-                                               "{C}",
-                                               "{C}");
+                if (!UpdateRecurringErrorAtEnd(GlycolErrorTracking(GlycolIndex).DensityLowErrIndex, Temperature, Temperature)) {
+                    ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too low) for fluid [" + GlycolData(GlycolIndex).Name +
+                                                       "] density **",
+                                                   GlycolErrorTracking(GlycolIndex).DensityLowErrIndex,
+                                                   Temperature,
+                                                   Temperature,
+                                                   _,
+                                                   "{C}",
+                                                   "{C}");
+                }
             }
 
             if ((HighErrorThisTime) && (HighTempLimitErr <= GlycolErrorLimitTest)) {
@@ -8317,20 +8523,69 @@ namespace FluidProperties {
                 ShowContinueErrorTimeStamp("");
             }
             if (HighErrorThisTime) {
-                ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too high) for fluid [" + GlycolData(GlycolIndex).Name +
-                                                   "] density **",
-                                               GlycolErrorTracking(GlycolIndex).DensityHighErrIndex,
-                                               Temperature,
-                                               Temperature,
-                                               _,
-                                               "{C}",
-                                               "{C}");
+                if (!UpdateRecurringErrorAtEnd(GlycolErrorTracking(GlycolIndex).DensityHighErrIndex, Temperature, Temperature)) {
+                    ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too high) for fluid [" + GlycolData(GlycolIndex).Name +
+                                                       "] density **",
+                                                   GlycolErrorTracking(GlycolIndex).DensityHighErrIndex,
+                                                   Temperature,
+                                                   Temperature,
+                                                   _,
+                                                   "{C}",
+                                                   "{C}");
+                }
             }
         }
 
         return ReturnValue;
     }
 
+    void GetSpecificHeatGlycol(std::string const &Glycol,            // carries in substance name
+                               Array1D<Real64> const &Temperatures, // actual temperatures given as input
+                               int &GlycolIndex,                    // Index to Glycol Properties
+                               std::string const &CalledFrom,       // routine this function was called from (error messages)
+                               Array1D<Real64> &SpecificHeats       // specific heats at Temperatures
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Finds the specific heats of a glycol at a set of temperatures, e.g. for all
+        // the components on a plant loop side, with one glycol lookup.
+
+        SpecificHeats.dimension(Temperatures);
+        for (int Loop = Temperatures.l(), Loop_end = Temperatures.u(); Loop <= Loop_end; ++Loop) {
+            SpecificHeats(Loop) = GetSpecificHeatGlycol(Glycol, Temperatures(Loop), GlycolIndex, CalledFrom);
+        }
+    }
+
+    void GetDensityGlycol(std::string const &Glycol,            // carries in substance name
+                          Array1D<Real64> const &Temperatures, // actual temperatures given as input
+                          int &GlycolIndex,                    // Index to Glycol Properties
+                          std::string const &CalledFrom,       // routine this function was called from (error messages)
+                          Array1D<Real64> &Densities           // densities at Temperatures
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Finds the densities of a glycol at a set of temperatures with one glycol lookup.
+
+        Densities.dimension(Temperatures);
+        for (int Loop = Temperatures.l(), Loop_end = Temperatures.u(); Loop <= Loop_end; ++Loop) {
+            Densities(Loop) = GetDensityGlycol(Glycol, Temperatures(Loop), GlycolIndex, CalledFrom);
+        }
+    }
+
     //*****************************************************************************
 
     Real64 GetConductivityGlycol(std::string const &Glycol,    // carries in substance name
@@ -8343,7 +8598,7 @@ namespace FluidProperties {
         // FUNCTION INFORMATION:
         //       AUTHOR         Rick Strand
         //       DATE WRITTEN   June 2004
-        //       MODIFIED       N/A
+        //       MODIFIED       October 2026, table interval from the temperature grid
         //       RE-ENGINEERED  N/A
 
         // PURPOSE OF THIS FUNCTION:
@@ -8379,7 +8634,6 @@ namespace FluidProperties {
         // na
 
         // FUNCTION LOCAL VARIABLE DECLARATIONS:
-        int Loop; // DO loop counter
         static int HighTempLimitErr(0);
         static int LowTempLimitErr(0);
         int GlycolNum;
@@ -8425,16 +8679,21 @@ namespace FluidProperties {
             HighErrorThisTime = true;
             ReturnValue = GlycolData(GlycolIndex).CondValues(GlycolData(GlycolIndex).CondHighTempIndex);
         } else { // Temperature somewhere between the lowest and highest value
-            ReturnValue = GlycolData(GlycolIndex).CondValues(GlycolData(GlycolIndex).CondLowTempIndex);
+            auto const &glycol_data(GlycolData(GlycolIndex));
             // bracket is temp > low, <= high (for interpolation
-            for (Loop = GlycolData(GlycolIndex).CondLowTempIndex + 1; Loop <= GlycolData(GlycolIndex).CondHighTempIndex; ++Loop) {
-                if (Temperature > GlycolData(GlycolIndex).CondTemps(Loop)) continue;
+            int const LoTempIndex(FindArrayIndex(Temperature,
+                                                 glycol_data.CondTemps,
+                                                 glycol_data.CondLowTempIndex,
+                                                 glycol_data.CondHighTempIndex,
+                                                 glycol_data.CondTempGrid));
+            if (LoTempIndex < glycol_data.CondHighTempIndex) {
                 ReturnValue = GetInterpValue(Temperature,
-                                             GlycolData(GlycolIndex).CondTemps(Loop - 1),
-                                             GlycolData(GlycolIndex).CondTemps(Loop),
-                                             GlycolData(GlycolIndex).CondValues(Loop - 1),
-                                             GlycolData(GlycolIndex).CondValues(Loop));
-                break; // DO loop
+                                             glycol_data.CondTemps(LoTempIndex),
+                                             glycol_data.CondTemps(LoTempIndex + 1),
+                                             glycol_data.CondValues(LoTempIndex),
+                                             glycol_data.CondValues(LoTempIndex + 1));
+            } else {
+                ReturnValue = glycol_data.CondValues(glycol_data.CondLowTempIndex);
             }
         }
 
@@ -8461,14 +8720,16 @@ namespace FluidProperties {
                 ShowContinueErrorTimeStamp("");
             }
             if (LowErrorThisTime) {
-                ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too low) for fluid [" + GlycolData(GlycolIndex).Name +
-                                                   "] conductivity **",
-                                               GlycolErrorTracking(GlycolIndex).ConductivityLowErrIndex,
-                                               Temperature,
-                                               Temperature,
-                                               _,
-                                               "{C}",
-                                               "{C}");
+                if (!UpdateRecurringErrorAtEnd(GlycolErrorTracking(GlycolIndex).ConductivityLowErrIndex, Temperature, Temperature)) {
+                    ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too low) for fluid [" + GlycolData(GlycolIndex).Name +
+                                                       "] conductivity **",
+                                                   GlycolErrorTracking(GlycolIndex).ConductivityLowErrIndex,
+                                                   Temperature,
+                                                   Temperature,
+                                                   _,
+                                                   "{C}",
+                                                   "{C}");
+                }
             }
 
             if ((HighErrorThisTime) && (HighTempLimitErr <= GlycolErrorLimitTest)) {
@@ -8480,14 +8741,16 @@ namespace FluidProperties {
                 ShowContinueErrorTimeStamp("");
             }
             if (HighErrorThisTime) {
-                ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too high) for fluid [" + GlycolData(GlycolIndex).Name +
-                                                   "] conductivity **",
-                                               GlycolErrorTracking(GlycolIndex).ConductivityHighErrIndex,
-                                               Temperature,
-                                               Temperature,
-                                               _,
-                                               "{C}",
-                                               "{C}");
+                if (!UpdateRecurringErrorAtEnd(GlycolErrorTracking(GlycolIndex).ConductivityHighErrIndex, Temperature, Temperature)) {
+                    ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too high) for fluid [" + GlycolData(GlycolIndex).Name +
+                                                       "] conductivity **",
+                                                   GlycolErrorTracking(GlycolIndex).ConductivityHighErrIndex,
+                                                   Temperature,
+                                                   Temperature,
+                                                   _,
+                                                   "{C}",
+                                                   "{C}");
+                }
             }
         }
 
@@ -8506,7 +8769,7 @@ namespace FluidProperties {
         // FUNCTION INFORMATION:
         //       AUTHOR         Rick Strand
         //       DATE WRITTEN   June 2004
-        //       MODIFIED       N/A
+        //       MODIFIED       October 2026, table interval from the temperature grid
         //       RE-ENGINEERED  N/A
 
         // PURPOSE OF THIS FUNCTION:
@@ -8542,7 +8805,6 @@ namespace FluidProperties {
         // na
 
         // FUNCTION LOCAL VARIABLE DECLARATIONS:
-        int Loop; // DO loop counter
         static int HighTempLimitErr(0);
         static int LowTempLimitErr(0);
         int GlycolNum;
@@ -8588,16 +8850,21 @@ namespace FluidProperties {
             HighErrorThisTime = true;
             ReturnValue = GlycolData(GlycolIndex).ViscValues(GlycolData(GlycolIndex).ViscHighTempIndex);
         } else { // Temperature somewhere between the lowest and highest value
-            ReturnValue = GlycolData(GlycolIndex).ViscValues(GlycolData(GlycolIndex).ViscLowTempIndex);
+            auto const &glycol_data(GlycolData(GlycolIndex));
             // bracket is temp > low, <= high (for interpolation
-            for (Loop = GlycolData(GlycolIndex).ViscLowTempIndex + 1; Loop <= GlycolData(GlycolIndex).ViscHighTempIndex; ++Loop) {
-                if (Temperature > GlycolData(GlycolIndex).ViscTemps(Loop)) continue;
+            int const LoTempIndex(FindArrayIndex(Temperature,
+                                                 glycol_data.ViscTemps,
+                                                 glycol_data.ViscLowTempIndex,
+                                                 glycol_data.ViscHighTempIndex,
+                                                 glycol_data.ViscTempGrid));
+            if (LoTempIndex < glycol_data.ViscHighTempIndex) {
                 ReturnValue = GetInterpValue(Temperature,
-                                             GlycolData(GlycolIndex).ViscTemps(Loop - 1),
-                                             GlycolData(GlycolIndex).ViscTemps(Loop),
-                                             GlycolData(GlycolIndex).ViscValues(Loop - 1),
-                                             GlycolData(GlycolIndex).ViscValues(Loop));
-                break; // DO loop
+                                             glycol_data.ViscTemps(LoTempIndex),
+                                             glycol_data.ViscTemps(LoTempIndex + 1),
+                                             glycol_data.ViscValues(LoTempIndex),
+                                             glycol_data.ViscValues(LoTempIndex + 1));
+            } else {
+                ReturnValue = glycol_data.ViscValues(glycol_data.ViscLowTempIndex);
             }
         }
 
@@ -8624,14 +8891,16 @@ namespace FluidProperties {
                 ShowContinueErrorTimeStamp("");
             }
             if (LowErrorThisTime) {
-                ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too low) for fluid [" + GlycolData(GlycolIndex).Name +
-                                                   "] viscosity **",
-                                               GlycolErrorTracking(GlycolIndex).ViscosityLowErrIndex,
-                                               Temperature,
-                                               Temperature,
-                                               _,
-                                               "{C}",
-                                               "{C}");
+                if (!UpdateRecurringErrorAtEnd(GlycolErrorTracking(GlycolIndex).ViscosityLowErrIndex, Temperature, Temperature)) {
+                    ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too low) for fluid [" + GlycolData(GlycolIndex).Name +
+                                                       "] viscosity **",
+                                                   GlycolErrorTracking(GlycolIndex).ViscosityLowErrIndex,
+                                                   Temperature,
+                                                   Temperature,
+                                                   _,
+                                                   "{C}",
+                                                   "{C}");
+                }
             }
 
             if ((HighErrorThisTime) && (HighTempLimitErr <= GlycolErrorLimitTest)) {
@@ -8643,14 +8912,16 @@ namespace FluidProperties {
                 ShowContinueErrorTimeStamp("");
             }
             if (HighErrorThisTime) {
-                ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too high) for fluid [" + GlycolData(GlycolIndex).Name +
-                                                   "] viscosity **",
-                                               GlycolErrorTracking(GlycolIndex).ViscosityHighErrIndex,
-                                               Temperature,
-                                               Temperature,
-                                               _,
-                                               "{C}",
-                                               "{C}");
+                if (!UpdateRecurringErrorAtEnd(GlycolErrorTracking(GlycolIndex).ViscosityHighErrIndex, Temperature, Temperature)) {
+                    ShowRecurringWarningErrorAtEnd(RoutineName + "Temperature out of range (too high) for fluid [" + GlycolData(GlycolIndex).Name +
+                                                       "] viscosity **",
+                                                   GlycolErrorTracking(GlycolIndex).ViscosityHighErrIndex,
+                                                   Temperature,
+                                                   Temperature,
+                                                   _,
+                                                   "{C}",
+                                                   "{C}");
+                }
             }
         }
 
@@ -9052,6 +9323,108 @@ namespace FluidProperties {
         }
     }
 
+    int FindArrayIndex(Real64 const Value,              // Value to be placed/found within the array of values
+                       Array1D<Real64> const &Array,    // Array of values in ascending order
+                       int const LowBound,              // Valid values lower bound (set by calling program)
+                       int const UpperBound,            // Valid values upper bound (set by calling program)
+                       FluidPropsTableGrid const &Grid  // Grid set up over Array by SetupTableGrid (may be empty)
+    )
+    {
+        // FUNCTION INFORMATION:
+        //       AUTHOR         Rick Strand
+        //       DATE WRITTEN   May 2000
+        //       MODIFIED       October 2026, grid instead of interval halving
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns the same index as FindArrayIndex(Value, Array, LowBound, UpperBound)
+        // in constant time.
+
+        // METHODOLOGY EMPLOYED:
+        // The search starts at the interval stored in the grid cell holding the value and
+        // steps to the neighbouring intervals, which takes a step or two for the property tables.
+        // Without a grid (tables set up outside GetFluidPropertiesData) interval halving is used.
+
+        if (Grid.CellIndex.empty()) return FindArrayIndex(Value, Array, LowBound, UpperBound);
+        if (Value < Array(LowBound)) return 0;
+        if (Value > Array(UpperBound)) return UpperBound;
+
+        int const Cell(max(0, min(int((Value - Grid.Low) * Grid.InvDelta), Grid.CellIndex.u())));
+        int Index(max(LowBound, min(Grid.CellIndex(Cell), UpperBound - 1)));
+        while ((Index > LowBound) && (Array(Index) >= Value)) {
+            --Index;
+        }
+        while ((Index + 1 < UpperBound) && (Array(Index + 1) < Value)) {
+            ++Index;
+        }
+        return Index;
+    }
+
+    int FindArrayIndex(Real64 const Value,              // Value to be placed/found within the array of values
+                       Array1D<Real64> const &Array,    // Array of values in ascending order
+                       int const LowBound,              // Valid values lower bound (set by calling program)
+                       int const UpperBound,            // Valid values upper bound (set by calling program)
+                       FluidPropsTableGrid const &Grid, // Grid set up over Array by SetupTableGrid (may be empty)
+                       int &Hint                        // Interval returned by the previous search of the caller
+    )
+    {
+        // FUNCTION INFORMATION:
+        //       AUTHOR         Rick Strand
+        //       DATE WRITTEN   May 2000
+        //       MODIFIED       October 2026, interval hint and grid instead of interval halving
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns the same index as FindArrayIndex(Value, Array, LowBound, UpperBound),
+        // trying the caller's previous interval first since the value barely moves between calls.
+
+        if (Value < Array(LowBound)) return 0;
+        if (Value > Array(UpperBound)) return UpperBound;
+
+        // Same interval as the previous call: Array(Hint) < Value <= Array(Hint+1)
+        if ((Hint >= LowBound) && (Hint < UpperBound) && ((Hint == LowBound) || (Array(Hint) < Value)) && (Value <= Array(Hint + 1))) {
+            return Hint;
+        }
+
+        Hint = FindArrayIndex(Value, Array, LowBound, UpperBound, Grid);
+        return Hint;
+    }
+
+    void SetupTableGrid(FluidPropsTableGrid &Grid,   // Grid to set up
+                        Array1D<Real64> const &Array // Array of values in ascending order
+    )
+    {
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Sets up a uniform grid over the range of an ascending property table so that
+        // FindArrayIndex can start its search in the right interval.
+
+        // METHODOLOGY EMPLOYED:
+        // The grid has a few cells per table interval. Each cell stores the interval
+        // holding its low edge, found once here by interval halving.
+
+        // SUBROUTINE PARAMETER DEFINITIONS:
+        int const CellsPerInterval(4); // grid cells per table interval
+
+        Grid.CellIndex.deallocate();
+        if (Array.size() < 2u) return;
+        Real64 const High(Array(Array.u()));
+        Grid.Low = Array(Array.l());
+        if (!(High > Grid.Low)) return;
+
+        int const NumCells(CellsPerInterval * (Array.isize() - 1));
+        Grid.InvDelta = NumCells / (High - Grid.Low);
+        Grid.CellIndex.allocate({0, NumCells});
+        for (int Cell = 0; Cell <= NumCells; ++Cell) {
+            Grid.CellIndex(Cell) = max(Array.l(), FindArrayIndex(Grid.Low + Cell / Grid.InvDelta, Array));
+        }
+    }
+
     //*****************************************************************************
 
     Real64 GetInterpolatedSatProp(Real64 const Temperature,         // Saturation Temp.
@@ -9063,12 +9436,30 @@ namespace FluidProperties {
                                   int const LowBound,               // Valid values lower bound (set by calling program)
                                   int const UpperBound              // Valid values upper bound (set by calling program)
     )
+    {
+        // Search without a hint or grid
+        static FluidPropsTableGrid const NoGrid;
+        int Hint(0);
+        return GetInterpolatedSatProp(Temperature, PropTemps, LiqProp, VapProp, Quality, CalledFrom, LowBound, UpperBound, NoGrid, Hint);
+    }
+
+    Real64 GetInterpolatedSatProp(Real64 const Temperature,         // Saturation Temp.
+                                  Array1D<Real64> const &PropTemps, // Array of temperature at which props are available
+                                  Array1D<Real64> const &LiqProp,   // Array of saturated liquid properties
+                                  Array1D<Real64> const &VapProp,   // Array of saturatedvapour properties
+                                  Real64 const Quality,             // Quality
+                                  std::string const &CalledFrom,    // routine this function was called from (error messages)
+                                  int const LowBound,               // Valid values lower bound (set by calling program)
+                                  int const UpperBound,             // Valid values upper bound (set by calling program)
+                                  FluidPropsTableGrid const &Grid,  // Grid over PropTemps
+                                  int &Hint                         // Interval in PropTemps found by the previous call of this caller
+    )
     {
 
         // FUNCTION INFORMATION:
         //       AUTHOR         Simon Rees
         //       DATE WRITTEN   May 2002
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, table search started from the caller's interval hint
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS FUNCTION:
@@ -9113,7 +9504,7 @@ namespace FluidProperties {
         static int TempRangeErrCount(0); // cumulative error counter
         static int TempRangeErrIndex(0);
 
-        int const LoTempIndex = FindArrayIndex(Temperature, PropTemps, LowBound, UpperBound); // array index for temp above input temp
+        int const LoTempIndex = FindArrayIndex(Temperature, PropTemps, LowBound, UpperBound, Grid, Hint); // array index for temp above input temp
 
         if (LoTempIndex == 0) {
             ReturnValue = LiqProp(LowBound) + Quality * (VapProp(LowBound) - LiqProp(LowBound));
@@ -111,6 +111,34 @@ namespace FluidProperties {
 
     // Types
 
+    struct FluidPropsTableGrid // Uniform grid over an ascending property table to start FindArrayIndex near the answer
+    {
+        // Members
+        Real64 Low;            // First value in the table
+        Real64 InvDelta;       // Grid cells per unit of the tabulated variable
+        Array1D_int CellIndex; // Table interval at the low edge of each grid cell, DIMENSION(0:number of cells)
+
+        // Default Constructor
+        FluidPropsTableGrid() : Low(0.0), InvDelta(0.0)
+        {
+        }
+    };
+
+    struct RefrigPropertyHint // Last table intervals found for one caller of the refrigerant property functions
+    {
+        // Members
+        int PsTemp;  // Interval in PsTemps
+        int PsPres;  // Interval in PsValues
+        int HTemp;   // Interval in HTemps
+        int SHTemp;  // Interval in SHTemps
+        int SHPress; // Interval in SHPress
+
+        // Default Constructor
+        RefrigPropertyHint() : PsTemp(0), PsPres(0), HTemp(0), SHTemp(0), SHPress(0)
+        {
+        }
+    };
+
     struct FluidPropsRefrigerantData
     {
         // Members
@@ -168,6 +196,11 @@ namespace FluidProperties {
         Array1D<Real64> SHPress;     // Pressures for superheated gas
         Array2D<Real64> HshValues;   // Enthalpy of superheated gas at HshTemps, HshPress
         Array2D<Real64> RhoshValues; // Density of superheated gas at HshTemps, HshPress
+        FluidPropsTableGrid PsTempGrid;  // Grid over PsTemps
+        FluidPropsTableGrid PsPresGrid;  // Grid over PsValues
+        FluidPropsTableGrid HTempGrid;   // Grid over HTemps
+        FluidPropsTableGrid SHTempGrid;  // Grid over SHTemps
+        FluidPropsTableGrid SHPressGrid; // Grid over SHPress
 
         // Default Constructor
         FluidPropsRefrigerantData()
@@ -260,6 +293,10 @@ namespace FluidProperties {
         int ViscHighTempIndex;      // High Temperature Max Index for Visc (>0.0)
         Array1D<Real64> ViscTemps;  // Temperatures for viscosity of glycol
         Array1D<Real64> ViscValues; // viscosity values (mPa-s)
+        FluidPropsTableGrid CpTempGrid;   // Grid over CpTemps
+        FluidPropsTableGrid RhoTempGrid;  // Grid over RhoTemps
+        FluidPropsTableGrid CondTempGrid; // Grid over CondTemps
+        FluidPropsTableGrid ViscTempGrid; // Grid over ViscTemps
 
         // Default Constructor
         FluidPropsGlycolData()
@@ -401,6 +438,12 @@ namespace FluidProperties {
                                 std::string const &CalledFrom   // routine this function was called from (error messages)
     );
 
+    Real64 GetSatPressureRefrig(int RefrigNum,                // Index to Refrigerant Properties
+                                Real64 Temperature,           // actual temperature given as input
+                                RefrigPropertyHint &Hint,     // table intervals found by the previous call of this caller
+                                std::string const &CalledFrom // routine this function was called from (error messages)
+    );
+
     //*****************************************************************************
 
     Real64 GetSatTemperatureRefrig(std::string const &Refrigerant, // carries in substance name
@@ -409,6 +452,12 @@ namespace FluidProperties {
                                    std::string const &CalledFrom   // routine this function was called from (error messages)
     );
 
+    Real64 GetSatTemperatureRefrig(int RefrigNum,                // Index to Refrigerant Properties
+                                   Real64 Pressure,              // actual pressure given as input
+                                   RefrigPropertyHint &Hint,     // table intervals found by the previous call of this caller
+                                   std::string const &CalledFrom // routine this function was called from (error messages)
+    );
+
     //*****************************************************************************
 
     Real64 GetSatEnthalpyRefrig(std::string const &Refrigerant, // carries in substance name
@@ -418,6 +467,13 @@ namespace FluidProperties {
                                 std::string const &CalledFrom   // routine this function was called from (error messages)
     );
 
+    Real64 GetSatEnthalpyRefrig(int RefrigNum,                // Index to Refrigerant Properties
+                                Real64 Temperature,           // actual temperature given as input
+                                Real64 Quality,               // actual quality given as input
+                                RefrigPropertyHint &Hint,     // table intervals found by the previous call of this caller
+                                std::string const &CalledFrom // routine this function was called from (error messages)
+    );
+
     //*****************************************************************************
 
     Real64 GetSatDensityRefrig(std::string const &Refrigerant, // carries in substance name
@@ -445,6 +501,13 @@ namespace FluidProperties {
                                     std::string const &CalledFrom   // routine this function was called from (error messages)
     );
 
+    Real64 GetSupHeatEnthalpyRefrig(int RefrigNum,                // Index to Refrigerant Properties
+                                    Real64 Temperature,           // actual temperature given as input
+                                    Real64 Pressure,              // actual pressure given as input
+                                    RefrigPropertyHint &Hint,     // table intervals found by the previous call of this caller
+                                    std::string const &CalledFrom // routine this function was called from (error messages)
+    );
+
     //*****************************************************************************
 
     Real64 GetSupHeatPressureRefrig(std::string const &Refrigerant, // carries in substance name
@@ -465,6 +528,14 @@ namespace FluidProperties {
                                 std::string const &CalledFrom   // routine this function was called from (error messages)
     );
 
+    bool InvertSupHeatEnthalpyRefrig(int RefrigNum,       // index for refrigerant under consideration
+                                     Real64 Pressure,     // actual pressure given as input
+                                     Real64 Enthalpy,     // actual enthalpy given as input
+                                     Real64 TempLow,      // lower bound of temperature
+                                     Real64 TempUp,       // upper bound of temperature
+                                     Real64 &Temperature  // temperature at which GetSupHeatEnthalpyRefrig returns Enthalpy
+    );
+
     Real64 GetSupHeatTempRefrigResidual(Real64 Temperature, // temperature of the refrigerant
                                         Array1<Real64> const &Par);
 
@@ -493,6 +564,20 @@ namespace FluidProperties {
                             std::string const &CalledFrom // routine this function was called from (error messages)
     );
 
+    void GetSpecificHeatGlycol(std::string const &Glycol,            // carries in substance name
+                               Array1D<Real64> const &Temperatures, // actual temperatures given as input
+                               int &GlycolIndex,                    // Index to Glycol Properties
+                               std::string const &CalledFrom,       // routine this function was called from (error messages)
+                               Array1D<Real64> &SpecificHeats       // specific heats at Temperatures
+    );
+
+    void GetDensityGlycol(std::string const &Glycol,            // carries in substance name
+                          Array1D<Real64> const &Temperatures, // actual temperatures given as input
+                          int &GlycolIndex,                    // Index to Glycol Properties
+                          std::string const &CalledFrom,       // routine this function was called from (error messages)
+                          Array1D<Real64> &Densities           // densities at Temperatures
+    );
+
     //*****************************************************************************
 
     Real64 GetConductivityGlycol(std::string const &Glycol,    // carries in substance name
@@ -608,6 +693,25 @@ namespace FluidProperties {
                        Array1D<Real64> const &Array // Array of values in ascending order
     );
 
+    int FindArrayIndex(Real64 Value,                    // Value to be placed/found within the array of values
+                       Array1D<Real64> const &Array,    // Array of values in ascending order
+                       int LowBound,                    // Valid values lower bound (set by calling program)
+                       int UpperBound,                  // Valid values upper bound (set by calling program)
+                       FluidPropsTableGrid const &Grid  // Grid set up over Array by SetupTableGrid (may be empty)
+    );
+
+    int FindArrayIndex(Real64 Value,                     // Value to be placed/found within the array of values
+                       Array1D<Real64> const &Array,     // Array of values in ascending order
+                       int LowBound,                     // Valid values lower bound (set by calling program)
+                       int UpperBound,                   // Valid values upper bound (set by calling program)
+                       FluidPropsTableGrid const &Grid,  // Grid set up over Array by SetupTableGrid (may be empty)
+                       int &Hint                         // Interval returned by the previous search of the caller
+    );
+
+    void SetupTableGrid(FluidPropsTableGrid &Grid,   // Grid to set up
+                        Array1D<Real64> const &Array // Array of values in ascending order
+    );
+
     //*****************************************************************************
 
     Real64 GetInterpolatedSatProp(Real64 Temperature,         // Saturation Temp.
@@ -620,6 +724,18 @@ namespace FluidProperties {
                                   int UpperBound              // Valid values upper bound (set by calling program)
     );
 
+    Real64 GetInterpolatedSatProp(Real64 Temperature,               // Saturation Temp.
+                                  Array1D<Real64> const &PropTemps, // Array of temperature at which props are available
+                                  Array1D<Real64> const &LiqProp,   // Array of saturated liquid properties
+                                  Array1D<Real64> const &VapProp,   // Array of saturatedvapour properties
+                                  Real64 Quality,                   // Quality
+                                  std::string const &CalledFrom,    // routine this function was called from (error messages)
+                                  int LowBound,                     // Valid values lower bound (set by calling program)
+                                  int UpperBound,                   // Valid values upper bound (set by calling program)
+                                  FluidPropsTableGrid const &Grid,  // Grid over PropTemps
+                                  int &Hint                         // Interval in PropTemps found by the previous call of this caller
+    );
+
     //*****************************************************************************
 
     int CheckFluidPropertyName(std::string const &NameToCheck); // Name from input(?) to be checked against valid FluidPropertyNames
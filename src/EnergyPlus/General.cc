@@ -46,9 +46,12 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Fmath.hh>
@@ -648,151 +651,8 @@ namespace General {
         // See Press et al., Numerical Recipes in Fortran, Cambridge University Press,
         // 2nd edition, 1992. Page 347 ff.
 
-        // USE STATEMENTS:
-        // na
-
-        // Argument array dimensioning
-
-        // Locals
-        // SUBROUTINE ARGUMENT DEFINITIONS:
-        // = -2: f(x0) and f(x1) have the same sign
-        // = -1: no convergence
-        // >  0: number of iterations performed
-        // optional
-        // SUBROUTINE PARAMETER DEFINITIONS:
-        Real64 const SMALL(1.e-10);
-
-        // INTERFACE BLOCK SPECIFICATIONS
-
-        // DERIVED TYPE DEFINITIONS
-        // na
-
-        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        Real64 X0;       // present 1st bound
-        Real64 X1;       // present 2nd bound
-        Real64 XTemp;    // new estimate
-        Real64 Y0;       // f at X0
-        Real64 Y1;       // f at X1
-        Real64 YTemp;    // f at XTemp
-        Real64 DY;       // DY = Y0 - Y1
-        bool Conv;       // flag, true if convergence is achieved
-        bool StopMaxIte; // stop due to exceeding of maximum # of iterations
-        bool Cont;       // flag, if true, continue searching
-        int NIte;        // number of interations
-        int AltIte;      // used for Alternation choice
-
-        X0 = X_0;
-        X1 = X_1;
-        XTemp = X0;
-        Conv = false;
-        StopMaxIte = false;
-        Cont = true;
-        NIte = 0;
-        AltIte = 0;
-
-        Y0 = f(X0);
-        Y1 = f(X1);
-        // check initial values
-        if (Y0 * Y1 > 0) {
-            Flag = -2;
-            XRes = X0;
-            return;
-        }
-
-        while (Cont) {
-
-            DY = Y0 - Y1;
-            if (std::abs(DY) < SMALL) DY = SMALL;
-            if (std::abs(X1 - X0) < SMALL) {
-                break;
-            }
-            // new estimation
-            switch (HVACSystemRootFinding.HVACSystemRootSolver) {
-            case DataHVACGlobals::HVACSystemRootSolverAlgorithm::RegulaFalsi: {
-                XTemp = (Y0 * X1 - Y1 * X0) / DY;
-                break;
-            }
-            case DataHVACGlobals::HVACSystemRootSolverAlgorithm::Bisection: {
-                XTemp = (X1 + X0) / 2.0;
-                break;
-            }
-            case DataHVACGlobals::HVACSystemRootSolverAlgorithm::RegulaFalsiThenBisection: {
-                if (NIte > HVACSystemRootFinding.NumOfIter) {
-                    XTemp = (X1 + X0) / 2.0;
-                } else {
-                    XTemp = (Y0 * X1 - Y1 * X0) / DY;
-                }
-                break;
-            }
-            case DataHVACGlobals::HVACSystemRootSolverAlgorithm::BisectionThenRegulaFalsi: {
-                if (NIte <= HVACSystemRootFinding.NumOfIter) {
-                    XTemp = (X1 + X0) / 2.0;
-                } else {
-                    XTemp = (Y0 * X1 - Y1 * X0) / DY;
-                }
-                break;
-            }
-            case DataHVACGlobals::HVACSystemRootSolverAlgorithm::Alternation: {
-                if (AltIte > HVACSystemRootFinding.NumOfIter) {
-                    XTemp = (X1 + X0) / 2.0;
-                    if (AltIte >= 2 * HVACSystemRootFinding.NumOfIter) AltIte = 0;
-                } else {
-                    XTemp = (Y0 * X1 - Y1 * X0) / DY;
-                }
-                break;
-            }
-            default: {
-                XTemp = (Y0 * X1 - Y1 * X0) / DY;
-            }
-            }
-
-            YTemp = f(XTemp);
-
-            ++NIte;
-            ++AltIte;
-
-            // check convergence
-            if (std::abs(YTemp) < Eps) Conv = true;
-
-            if (NIte > MaxIte) StopMaxIte = true;
-
-            if ((!Conv) && (!StopMaxIte)) {
-                Cont = true;
-            } else {
-                Cont = false;
-            }
-
-            if (Cont) {
-
-                // reassign values (only if further iteration required)
-                if (Y0 < 0.0) {
-                    if (YTemp < 0.0) {
-                        X0 = XTemp;
-                        Y0 = YTemp;
-                    } else {
-                        X1 = XTemp;
-                        Y1 = YTemp;
-                    }
-                } else {
-                    if (YTemp < 0.0) {
-                        X1 = XTemp;
-                        Y1 = YTemp;
-                    } else {
-                        X0 = XTemp;
-                        Y0 = YTemp;
-                    }
-                } // ( Y0 < 0 )
-
-            } // (Cont)
-
-        } // Cont
-
-        if (Conv) {
-            Flag = NIte;
-        } else {
-            Flag = -1;
-        }
-        XRes = XTemp;
+        // The iteration itself is the SolveRoot template in General.hh, shared with callers passing a residual callable directly
+        SolveRoot<std::function<Real64(Real64 const)>>(Eps, MaxIte, Flag, XRes, f, X_0, X_1);
     }
 
     void SolveRoot(Real64 const Eps, // required absolute accuracy
@@ -940,6 +800,154 @@ namespace General {
         XX_1 = X1;
     }
 
+    void SolveRoot(Real64 const Eps, // required absolute accuracy
+                   int const MaxIte, // maximum number of allowed iterations
+                   int &Flag,        // integer storing exit status
+                   Real64 &XRes,     // value of x that solves f(x) = 0
+                   std::function<Real64(Real64 const)> f,
+                   Real64 const X_0,          // 1st bound of interval that contains the solution
+                   Real64 const X_1,          // 2nd bound of interval that contains the solution
+                   SolveRootContext &Context  // warm start state carried between calls for the same component
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Find the value of x between x0 and x1 such that f(x) is equal to zero, starting
+        // from the root found by the previous converged call made with the same context.
+
+        // METHODOLOGY EMPLOYED:
+        // Secant steps from the previous root, using the residual slope saved with it, look for a
+        // sign change close to the previous solution. A bracket found that way is closed with the
+        // Illinois variant of regula falsi. Otherwise the full interval is searched with the
+        // standard SolveRoot, so a cold start behaves exactly like the call without a context.
+        // Flag has the same meaning as for the standard SolveRoot and counts all residual calls.
+
+        // SUBROUTINE PARAMETER DEFINITIONS:
+        Real64 const SMALL(1.e-10);
+        int const MaxBracketSteps(3);     // Secant steps tried from the previous root before searching the full interval
+        Real64 const ProbeFraction(0.01); // Interval fraction of the first step when no slope is known
+        Real64 const Overshoot(1.5);      // Secant step multiplier so a good step crosses the root
+
+        Real64 const XMin(min(X_0, X_1));
+        Real64 const XMax(max(X_0, X_1));
+        int NIte(0); // Residual calls made by the warm start
+
+        if (Context.Valid && (Context.XLast >= XMin) && (Context.XLast <= XMax) && (XMax - XMin > SMALL)) {
+            Real64 XA(Context.XLast);
+            Real64 YA(f(XA));
+            ++NIte;
+            if (std::abs(YA) < Eps) {
+                Flag = NIte;
+                XRes = XA;
+                return;
+            }
+
+            // Bracket the root close to the previous one
+            Real64 XB(XA);
+            Real64 YB(YA);
+            Real64 DX;
+            if (Context.Slope != 0.0) {
+                DX = -Overshoot * YA / Context.Slope;
+            } else {
+                DX = (XA - XMin < XMax - XA ? ProbeFraction : -ProbeFraction) * (XMax - XMin);
+            }
+            bool Bracketed(false);
+            for (int Step = 1; (Step <= MaxBracketSteps) && (NIte <= MaxIte); ++Step) {
+                Real64 const XNew(max(XMin, min(XMax, XB + DX)));
+                if (std::abs(XNew - XB) < SMALL) break; // Step pinned at an interval limit
+                Real64 const YNew(f(XNew));
+                ++NIte;
+                Real64 const Slope((YNew - YB) / (XNew - XB));
+                if (std::abs(YNew) < Eps) {
+                    Context.XLast = XNew;
+                    Context.Slope = Slope;
+                    Flag = NIte;
+                    XRes = XNew;
+                    return;
+                }
+                XA = XB;
+                YA = YB;
+                XB = XNew;
+                YB = YNew;
+                if (YA * YB < 0.0) {
+                    Bracketed = true;
+                    break;
+                }
+                if (Slope == 0.0) break;
+                DX = -Overshoot * YB / Slope;
+            }
+
+            // Close the bracket with the Illinois method
+            if (Bracketed) {
+                Real64 XPrev(XB); // Last residual evaluation, for the slope saved with the root
+                Real64 YPrev(YB);
+                int Side(0); // Bracket end replaced by the last iterate: -1 = B, 1 = A
+                while ((NIte <= MaxIte) && (std::abs(XB - XA) >= SMALL)) {
+                    Real64 DY(YA - YB);
+                    if (std::abs(DY) < SMALL) DY = SMALL;
+                    Real64 const XTemp((YA * XB - YB * XA) / DY);
+                    Real64 const YTemp(f(XTemp));
+                    ++NIte;
+                    if (std::abs(YTemp) < Eps) {
+                        Context.XLast = XTemp;
+                        if (XTemp != XPrev) Context.Slope = (YTemp - YPrev) / (XTemp - XPrev);
+                        Flag = NIte;
+                        XRes = XTemp;
+                        return;
+                    }
+                    if (YTemp * YB > 0.0) {
+                        XB = XTemp;
+                        YB = YTemp;
+                        if (Side == -1) YA *= 0.5;
+                        Side = -1;
+                    } else {
+                        XA = XTemp;
+                        YA = YTemp;
+                        if (Side == 1) YB *= 0.5;
+                        Side = 1;
+                    }
+                    XPrev = XTemp;
+                    YPrev = YTemp;
+                }
+                Context.Valid = false;
+                Flag = -1;
+                XRes = XPrev;
+                return;
+            }
+        }
+
+        // Cold start over the full interval
+        SolveRoot(Eps, MaxIte, Flag, XRes, f, X_0, X_1);
+        if (Flag > 0) {
+            Flag += NIte;
+            Context.Valid = true;
+            Context.XLast = XRes;
+            Context.Slope = 0.0;
+        } else {
+            Context.Valid = false;
+        }
+    }
+
+    void SolveRoot(Real64 const Eps, // required absolute accuracy
+                   int const MaxIte, // maximum number of allowed iterations
+                   int &Flag,        // integer storing exit status
+                   Real64 &XRes,     // value of x that solves f(x,Par) = 0
+                   std::function<Real64(Real64 const, Array1<Real64> const &)> f,
+                   Real64 const X_0,          // 1st bound of interval that contains the solution
+                   Real64 const X_1,          // 2nd bound of interval that contains the solution
+                   Array1<Real64> const &Par, // array with additional parameters used for function evaluation
+                   SolveRootContext &Context  // warm start state carried between calls for the same component
+    )
+    {
+        // Warm started solve of f(x,Par) = 0: see the single argument residual version
+        SolveRoot(Eps, MaxIte, Flag, XRes, [&f, &Par](Real64 const X) { return f(X, Par); }, X_0, X_1, Context);
+    }
+
     Real64 InterpSw(Real64 const SwitchFac, // Switching factor: 0.0 if glazing is unswitched, = 1.0 if fully switched
                     Real64 const A,         // Glazing property in unswitched state
                     Real64 const B          // Glazing property in fully switched state
@@ -1457,6 +1465,60 @@ namespace General {
         return POLYF;
     }
 
+    // Lookup of a POLYF polynomial from its tabulated values
+    inline Real64 POLYFTableLookup(Real64 const X, std::vector<Real64> const &Table)
+    {
+        if (X < 0.0 || X > 1.0) return 0.0;
+        int const NumIntervals(static_cast<int>(Table.size()) - 1);
+        Real64 const Pos(X * NumIntervals);
+        int const Interval(min(static_cast<int>(Pos), NumIntervals - 1));
+        return Table[Interval] + (Pos - Interval) * (Table[Interval + 1] - Table[Interval]);
+    }
+
+    Real64 POLYF(Real64 const X,                   // Cosine of angle of incidence
+                 Array1<Real64> const &A,          // Polynomial coefficients
+                 std::vector<Real64> const &Table // Polynomial tabulated by TabulatePOLYF, or empty
+    )
+    {
+        if (Table.empty()) return POLYF(X, A);
+        return POLYFTableLookup(X, Table);
+    }
+
+    Real64 POLYF(Real64 const X,                   // Cosine of angle of incidence
+                 Array1S<Real64> const &A,         // Polynomial coefficients
+                 std::vector<Real64> const &Table // Polynomial tabulated by TabulatePOLYF, or empty
+    )
+    {
+        if (Table.empty()) return POLYF(X, A);
+        return POLYFTableLookup(X, Table);
+    }
+
+    void TabulatePOLYF(Array1S<Real64> const &A, // Polynomial coefficients
+                       std::vector<Real64> &Table // Polynomial values at uniformly spaced cosines of incidence from 0 to 1
+    )
+    {
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Tabulates a glazing beam property polynomial of the form used by POLYF so that it can be
+        // evaluated per time step by linear interpolation instead of polynomial evaluation.
+
+        // METHODOLOGY EMPLOYED:
+        // The polynomial is evaluated at NumIntervals+1 uniformly spaced cosines of incidence. With 400
+        // intervals the interpolation error of the sixth order fits is well below the accuracy of the fits.
+
+        int const NumIntervals(400);
+
+        Table.resize(NumIntervals + 1);
+        for (int i = 0; i <= NumIntervals; ++i) {
+            Table[i] = POLYF(double(i) / NumIntervals, A);
+        }
+    }
+
     Real64 POLY1F(Real64 &X,         // independent variable
                   Array1A<Real64> A, // array of polynomial coefficients
                   int &N             // number of terms in polynomial
@@ -1570,6 +1632,54 @@ namespace General {
         return POLY2F;
     }
 
+    namespace {
+        // Produces the same text as ObjexxFCL::gio::write(String, "*") << RealValue, the list-directed G24.15E3
+        // field that TrimSigDigits and RoundSigDigits take apart. The digits come from one snprintf call instead of
+        // the gio stream machinery; the E editing repeats the scaling and rounding steps of ObjexxFCL's exponent
+        // facet, so the digits agree with it even where they differ from a correctly rounded %E conversion.
+        void ListDirectedString(Real64 const RealValue, std::string &String)
+        {
+            static ObjexxFCL::gio::Fmt fmtLD("*");
+
+            if (std::isfinite(RealValue) && (RealValue != 0.0)) {
+                Real64 const AbsValue(std::abs(RealValue));
+                char Buffer[48];
+                int const Digits(static_cast<int>(std::floor(std::log10(AbsValue) + 1.0))); // digits before the decimal point
+                if ((0 <= Digits) && (Digits <= 17)) { // F editing: F19.d followed by 5 blanks
+                    int const n(std::snprintf(Buffer, sizeof(Buffer), "%#19.*f", 15 - std::min(Digits, 15), RealValue));
+                    if (n <= 19) {
+                        String.assign(Buffer, n);
+                        String.append(5, ' ');
+                        return;
+                    }
+                } else { // E editing: 1P, 15 digits after the decimal point and a three digit exponent
+                    int Exponent(static_cast<int>(std::floor(std::log10(AbsValue))));
+                    Real64 Mantissa((-Exponent < 309) ? AbsValue * std::pow(10.0, -Exponent)
+                                                      : static_cast<Real64>(AbsValue * std::pow(10.0L, static_cast<long double>(-Exponent))));
+                    std::snprintf(Buffer, sizeof(Buffer), "%f", Mantissa);
+                    if (std::strncmp(Buffer, "10.", 3) == 0) { // rounding adjustment
+                        Mantissa /= 10.0;
+                        ++Exponent;
+                    }
+                    int const n(std::snprintf(Buffer,
+                                              sizeof(Buffer),
+                                              "%s%.15fE%c%03d",
+                                              RealValue < 0.0 ? "-" : "",
+                                              Mantissa,
+                                              Exponent < 0 ? '-' : '+',
+                                              std::abs(Exponent)));
+                    if (n <= 24) {
+                        String.assign(24 - n, ' ');
+                        String.append(Buffer, n);
+                        return;
+                    }
+                }
+            }
+            String.clear();
+            ObjexxFCL::gio::write(String, fmtLD) << RealValue; // non-finite or too wide for the field
+        }
+    } // namespace
+
     std::string TrimSigDigits(Real64 const RealValue, int const SigDigits)
     {
 
@@ -1601,7 +1711,6 @@ namespace General {
         // FUNCTION PARAMETER DEFINITIONS:
         static std::string const NAN_string("NAN");
         static std::string const ZEROOOO("0.000000000000000000000000000");
-        static ObjexxFCL::gio::Fmt fmtLD("*");
 
         // INTERFACE BLOCK SPECIFICATIONS
         // na
@@ -1615,7 +1724,7 @@ namespace General {
 
         std::string String; // Working string
         if (RealValue != 0.0) {
-            ObjexxFCL::gio::write(String, fmtLD) << RealValue;
+            ListDirectedString(RealValue, String);
         } else {
             String = ZEROOOO;
         }
@@ -1718,7 +1827,6 @@ namespace General {
         static std::string const DigitChar("01234567890");
         static std::string const NAN_string("NAN");
         static std::string const ZEROOOO("0.000000000000000000000000000");
-        static ObjexxFCL::gio::Fmt fmtLD("*");
 
         // INTERFACE BLOCK SPECIFICATIONS
         // na
@@ -1732,7 +1840,7 @@ namespace General {
 
         std::string String; // Working string
         if (RealValue != 0.0) {
-            ObjexxFCL::gio::write(String, fmtLD) << RealValue;
+            ListDirectedString(RealValue, String);
         } else {
             String = ZEROOOO;
         }
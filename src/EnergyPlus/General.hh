@@ -49,8 +49,10 @@
 #define General_hh_INCLUDED
 
 // C++ Headers
+#include <cmath>
 #include <functional>
 #include <type_traits>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
@@ -60,6 +62,7 @@
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
+#include <DataHVACGlobals.hh>
 #include <EnergyPlus.hh>
 
 namespace EnergyPlus {
@@ -75,7 +78,18 @@ namespace General {
     // na
 
     // DERIVED TYPE DEFINITIONS
-    // na
+    struct SolveRootContext
+    {
+        // Members
+        bool Valid;   // True once a solve with this context has converged
+        Real64 XLast; // Root found by the last converged solve
+        Real64 Slope; // Residual slope near XLast (0.0 if unknown)
+
+        // Default Constructor
+        SolveRootContext() : Valid(false), XLast(0.0), Slope(0.0)
+        {
+        }
+    };
 
     // INTERFACE DEFINITIONS
 
@@ -142,6 +156,171 @@ namespace General {
                    Real64 &XX_1                // Hign bound obtained with maximum number of allowed iterations
     );
 
+    void SolveRoot(Real64 const Eps, // required absolute accuracy
+                   int const MaxIte, // maximum number of allowed iterations
+                   int &Flag,        // integer storing exit status
+                   Real64 &XRes,     // value of x that solves f(x) = 0
+                   std::function<Real64(Real64 const)> f,
+                   Real64 const X_0,          // 1st bound of interval that contains the solution
+                   Real64 const X_1,          // 2nd bound of interval that contains the solution
+                   SolveRootContext &Context  // warm start state carried between calls for the same component
+    );
+
+    void SolveRoot(Real64 const Eps, // required absolute accuracy
+                   int const MaxIte, // maximum number of allowed iterations
+                   int &Flag,        // integer storing exit status
+                   Real64 &XRes,     // value of x that solves f(x,Par) = 0
+                   std::function<Real64(Real64 const, Array1<Real64> const &)> f,
+                   Real64 const X_0,          // 1st bound of interval that contains the solution
+                   Real64 const X_1,          // 2nd bound of interval that contains the solution
+                   Array1<Real64> const &Par, // array with additional parameters used for function evaluation
+                   SolveRootContext &Context  // warm start state carried between calls for the same component
+    );
+
+    // Regula falsi root solve of f(x) = 0 on [X_0, X_1] for a residual callable f(x) passed by type so it can be inlined.
+    // Residual state is captured by the callable (e.g. a lambda) instead of being packed into a Par array.
+    // Flag: -2 = f(X_0) and f(X_1) have the same sign, -1 = no convergence, > 0 = number of iterations performed
+    template <typename ResidualFunction>
+    inline void SolveRoot(Real64 const Eps,           // required absolute accuracy
+                          int const MaxIte,           // maximum number of allowed iterations
+                          int &Flag,                  // integer storing exit status
+                          Real64 &XRes,               // value of x that solves f(x) = 0
+                          ResidualFunction const &f,  // residual: Real64 f(Real64 const x)
+                          Real64 const X_0,           // 1st bound of interval that contains the solution
+                          Real64 const X_1            // 2nd bound of interval that contains the solution
+    )
+    {
+        // SUBROUTINE PARAMETER DEFINITIONS:
+        Real64 const SMALL(1.e-10);
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+        Real64 X0;       // present 1st bound
+        Real64 X1;       // present 2nd bound
+        Real64 XTemp;    // new estimate
+        Real64 Y0;       // f at X0
+        Real64 Y1;       // f at X1
+        Real64 YTemp;    // f at XTemp
+        Real64 DY;       // DY = Y0 - Y1
+        bool Conv;       // flag, true if convergence is achieved
+        bool StopMaxIte; // stop due to exceeding of maximum # of iterations
+        bool Cont;       // flag, if true, continue searching
+        int NIte;        // number of interations
+        int AltIte;      // used for Alternation choice
+
+        X0 = X_0;
+        X1 = X_1;
+        XTemp = X0;
+        Conv = false;
+        StopMaxIte = false;
+        Cont = true;
+        NIte = 0;
+        AltIte = 0;
+
+        Y0 = f(X0);
+        Y1 = f(X1);
+        // check initial values
+        if (Y0 * Y1 > 0) {
+            Flag = -2;
+            XRes = X0;
+            return;
+        }
+
+        while (Cont) {
+
+            DY = Y0 - Y1;
+            if (std::abs(DY) < SMALL) DY = SMALL;
+            if (std::abs(X1 - X0) < SMALL) {
+                break;
+            }
+            // new estimation
+            switch (DataHVACGlobals::HVACSystemRootFinding.HVACSystemRootSolver) {
+            case DataHVACGlobals::HVACSystemRootSolverAlgorithm::RegulaFalsi: {
+                XTemp = (Y0 * X1 - Y1 * X0) / DY;
+                break;
+            }
+            case DataHVACGlobals::HVACSystemRootSolverAlgorithm::Bisection: {
+                XTemp = (X1 + X0) / 2.0;
+                break;
+            }
+            case DataHVACGlobals::HVACSystemRootSolverAlgorithm::RegulaFalsiThenBisection: {
+                if (NIte > DataHVACGlobals::HVACSystemRootFinding.NumOfIter) {
+                    XTemp = (X1 + X0) / 2.0;
+                } else {
+                    XTemp = (Y0 * X1 - Y1 * X0) / DY;
+                }
+                break;
+            }
+            case DataHVACGlobals::HVACSystemRootSolverAlgorithm::BisectionThenRegulaFalsi: {
+                if (NIte <= DataHVACGlobals::HVACSystemRootFinding.NumOfIter) {
+                    XTemp = (X1 + X0) / 2.0;
+                } else {
+                    XTemp = (Y0 * X1 - Y1 * X0) / DY;
+                }
+                break;
+            }
+            case DataHVACGlobals::HVACSystemRootSolverAlgorithm::Alternation: {
+                if (AltIte > DataHVACGlobals::HVACSystemRootFinding.NumOfIter) {
+                    XTemp = (X1 + X0) / 2.0;
+                    if (AltIte >= 2 * DataHVACGlobals::HVACSystemRootFinding.NumOfIter) AltIte = 0;
+                } else {
+                    XTemp = (Y0 * X1 - Y1 * X0) / DY;
+                }
+                break;
+            }
+            default: {
+                XTemp = (Y0 * X1 - Y1 * X0) / DY;
+            }
+            }
+
+            YTemp = f(XTemp);
+
+            ++NIte;
+            ++AltIte;
+
+            // check convergence
+            if (std::abs(YTemp) < Eps) Conv = true;
+
+            if (NIte > MaxIte) StopMaxIte = true;
+
+            if ((!Conv) && (!StopMaxIte)) {
+                Cont = true;
+            } else {
+                Cont = false;
+            }
+
+            if (Cont) {
+
+                // reassign values (only if further iteration required)
+                if (Y0 < 0.0) {
+                    if (YTemp < 0.0) {
+                        X0 = XTemp;
+                        Y0 = YTemp;
+                    } else {
+                        X1 = XTemp;
+                        Y1 = YTemp;
+                    }
+                } else {
+                    if (YTemp < 0.0) {
+                        X1 = XTemp;
+                        Y1 = YTemp;
+                    } else {
+                        X0 = XTemp;
+                        Y0 = YTemp;
+                    }
+                } // ( Y0 < 0 )
+
+            } // (Cont)
+
+        } // Cont
+
+        if (Conv) {
+            Flag = NIte;
+        } else {
+            Flag = -1;
+        }
+        XRes = XTemp;
+    }
+
     Real64 InterpSw(Real64 const SwitchFac, // Switching factor: 0.0 if glazing is unswitched, = 1.0 if fully switched
                     Real64 const A,         // Glazing property in unswitched state
                     Real64 const B          // Glazing property in fully switched state
@@ -192,6 +371,20 @@ namespace General {
                  Array1S<Real64> const &A // Polynomial coefficients
     );
 
+    Real64 POLYF(Real64 const X,                   // Cosine of angle of incidence
+                 Array1<Real64> const &A,          // Polynomial coefficients
+                 std::vector<Real64> const &Table // Polynomial tabulated by TabulatePOLYF, or empty
+    );
+
+    Real64 POLYF(Real64 const X,                   // Cosine of angle of incidence
+                 Array1S<Real64> const &A,         // Polynomial coefficients
+                 std::vector<Real64> const &Table // Polynomial tabulated by TabulatePOLYF, or empty
+    );
+
+    void TabulatePOLYF(Array1S<Real64> const &A, // Polynomial coefficients
+                       std::vector<Real64> &Table // Polynomial values at uniformly spaced cosines of incidence from 0 to 1
+    );
+
     Real64 POLY1F(Real64 &X,         // independent variable
                   Array1A<Real64> A, // array of polynomial coefficients
                   int &N             // number of terms in polynomial
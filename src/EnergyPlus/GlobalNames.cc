@@ -93,10 +93,6 @@ namespace GlobalNames {
     int NumBaseboards(0);
     int NumCoils(0);
     int numAirDistUnits(0);
-    int CurMaxChillers(0);
-    int CurMaxBoilers(0);
-    int CurMaxBaseboards(0);
-    int CurMaxCoils(0);
 
     // SUBROUTINE SPECIFICATIONS FOR MODULE GlobalNames:
 
@@ -176,6 +172,39 @@ namespace GlobalNames {
         return false;
     }
 
+    void VerifyUniqueName(std::unordered_set<std::string> &names,
+                          std::string const &NameToVerify,
+                          bool &ErrorFound,
+                          bool &IsBlank,
+                          std::string const &StringToDisplay)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Hashed replacement for UtilityRoutines::VerifyName when the names of an object are read
+        // in order: the names accepted so far are kept in names rather than searched for in the
+        // object array, with the same error messages.  A valid new name is added before returning.
+        // Like VerifyName, names that differ only in case are duplicates, so they are kept in upper case.
+
+        ErrorFound = false;
+        IsBlank = false;
+        if (NameToVerify.empty()) {
+            ShowSevereError(StringToDisplay + ", cannot be blank");
+            ErrorFound = true;
+            IsBlank = true;
+            return;
+        }
+        if (!names.emplace(UtilityRoutines::MakeUPPERCase(NameToVerify)).second) {
+            ShowSevereError(StringToDisplay + ", duplicate name=" + NameToVerify);
+            ErrorFound = true;
+        }
+    }
+
     void
     VerifyUniqueChillerName(std::string const &TypeToVerify, std::string const &NameToVerify, bool &ErrorsFound, std::string const &StringToDisplay)
     {
@@ -304,10 +333,6 @@ namespace GlobalNames {
         NumBaseboards = 0;
         NumCoils = 0;
         numAirDistUnits = 0;
-        CurMaxChillers = 0;
-        CurMaxBoilers = 0;
-        CurMaxBaseboards = 0;
-        CurMaxCoils = 0;
 
         ChillerNames.clear();
         BoilerNames.clear();
@@ -74,10 +74,6 @@ namespace GlobalNames {
     extern int NumBoilers;
     extern int NumBaseboards;
     extern int NumCoils;
-    extern int CurMaxChillers;
-    extern int CurMaxBoilers;
-    extern int CurMaxBaseboards;
-    extern int CurMaxCoils;
     extern int numAirDistUnits; // count of air distribution units
 
     // SUBROUTINE SPECIFICATIONS FOR MODULE GlobalNames:
@@ -128,6 +124,12 @@ namespace GlobalNames {
                                      bool &ErrorsFound
     );
 
+    void VerifyUniqueName(std::unordered_set<std::string> &names,
+                          std::string const &NameToVerify,
+                          bool &ErrorFound, // returns true if blank or duplicate name found
+                          bool &IsBlank,
+                          std::string const &StringToDisplay);
+
     void
     VerifyUniqueChillerName(std::string const &TypeToVerify,
                             std::string const &NameToVerify,
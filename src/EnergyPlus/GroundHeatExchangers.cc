@@ -48,6 +48,7 @@
 // C++ Headers
 #include <cmath>
 #include <fstream>
+#include <map>
 #include <vector>
 
 // ObjexxFCL Headers
@@ -76,6 +77,7 @@
 #include <InputProcessing/InputProcessor.hh>
 #include <NodeInputManager.hh>
 #include <OutputProcessor.hh>
+#include <Parallel.hh>
 #include <PlantUtilities.hh>
 #include <UtilityRoutines.hh>
 
@@ -647,16 +649,62 @@ namespace GroundHeatExchangers {
 
         DisplayString("Initializing GroundHeatExchanger:System: " + name);
 
-        // Calculate the g-functions
-        for (size_t lntts_index = 1; lntts_index <= myRespFactors->LNTTS.size(); ++lntts_index) {
-            for (auto &bh_i : myRespFactors->myBorholes) {
-                Real64 sum_T_ji = 0;
-                for (auto &bh_j : myRespFactors->myBorholes) {
-                    sum_T_ji += doubleIntegral(bh_i, bh_j, myRespFactors->time(lntts_index));
+        // The g-function sums the response of every borehole on every other one. When all boreholes share the same
+        // length, depth and diameter the response between two of them depends only on their horizontal spacing, so each
+        // distinct spacing is integrated once and weighted by the number of ordered pairs sharing it. This reduces a
+        // regular n x m array from (n m)^2 double integrals per time to roughly n m.
+        auto const &boreholes(myRespFactors->myBorholes);
+        bool identicalBoreholes(true);
+        for (auto const &thisBH : boreholes) {
+            auto const &firstProps(boreholes.front()->props);
+            if (thisBH->props->bhLength != firstProps->bhLength || thisBH->props->bhTopDepth != firstProps->bhTopDepth ||
+                thisBH->props->bhDiameter != firstProps->bhDiameter) {
+                identicalBoreholes = false;
+                break;
+            }
+        }
+
+        struct BoreholePair
+        {
+            int i;        // borehole whose temperature response is computed
+            int j;        // borehole producing the response
+            Real64 count; // number of ordered pairs represented by (i, j)
+        };
+        std::vector<BoreholePair> pairs;
+        int const numBoreholes = boreholes.size();
+        if (identicalBoreholes) {
+            pairs.push_back({0, 0, Real64(numBoreholes)});
+            std::map<long long, std::size_t> pairBySpacing; // spacing rounded to a micrometre
+            for (int i = 0; i < numBoreholes; ++i) {
+                for (int j = i + 1; j < numBoreholes; ++j) {
+                    long long const spacing =
+                        std::llround(1.0e6 * std::hypot(boreholes[i]->xLoc - boreholes[j]->xLoc, boreholes[i]->yLoc - boreholes[j]->yLoc));
+                    auto const found = pairBySpacing.find(spacing);
+                    if (found == pairBySpacing.end()) {
+                        pairBySpacing[spacing] = pairs.size();
+                        pairs.push_back({i, j, 2.0});
+                    } else {
+                        pairs[found->second].count += 2.0;
+                    }
+                }
+            }
+        } else {
+            for (int i = 0; i < numBoreholes; ++i) {
+                for (int j = 0; j < numBoreholes; ++j) {
+                    pairs.push_back({i, j, 1.0});
                 }
-                myRespFactors->GFNC(lntts_index) += sum_T_ji;
             }
-            myRespFactors->GFNC(lntts_index) /= (2 * totalTubeLength);
+        }
+        int const numPairs = pairs.size();
+
+        // Calculate the g-functions
+        for (size_t lntts_index = 1; lntts_index <= myRespFactors->LNTTS.size(); ++lntts_index) {
+            Real64 const currTime = myRespFactors->time(lntts_index);
+            Real64 const sum_T_ji = Parallel::Sum(numPairs, [&](int const pairNum) {
+                auto const &thisPair(pairs[pairNum]);
+                return thisPair.count * doubleIntegral(boreholes[thisPair.i], boreholes[thisPair.j], currTime);
+            });
+            myRespFactors->GFNC(lntts_index) = sum_T_ji / (2 * totalTubeLength);
 
             std::stringstream ss;
             ss << std::fixed << std::setprecision(1) << float(lntts_index) / myRespFactors->LNTTS.size() * 100;
@@ -1802,6 +1850,7 @@ namespace GroundHeatExchangers {
             prevTimeSteps = 0.0;
             QnHr = 0.0;
             QnMonthlyAgg = 0.0;
+            QnMonthlyAggSum.clear();
             QnSubHr = 0.0;
             LastHourN = 1;
             N = 1;
@@ -1940,16 +1989,20 @@ namespace GroundHeatExchangers {
 
                 // Monthly superposition
                 sumQnMonthly = 0.0;
-                for (I = 1; I <= currentMonth; ++I) {
-                    if (I == 1) {
-                        gFuncVal = getGFunc(currentSimTime / (timeSSFactor));
+                if (DataSystemVariables::GLHEMultiLevelAggregation) {
+                    sumQnMonthly = calcMultiLevelMonthlySuperposition(currentMonth, kGroundFactor);
+                } else {
+                    for (I = 1; I <= currentMonth; ++I) {
+                        if (I == 1) {
+                            gFuncVal = getGFunc(currentSimTime / (timeSSFactor));
+                            RQMonth = gFuncVal / (kGroundFactor);
+                            sumQnMonthly += QnMonthlyAgg(I) * RQMonth;
+                            continue;
+                        }
+                        gFuncVal = getGFunc((currentSimTime - (I - 1) * hrsPerMonth) / (timeSSFactor));
                         RQMonth = gFuncVal / (kGroundFactor);
-                        sumQnMonthly += QnMonthlyAgg(I) * RQMonth;
-                        continue;
+                        sumQnMonthly += (QnMonthlyAgg(I) - QnMonthlyAgg(I - 1)) * RQMonth;
                     }
-                    gFuncVal = getGFunc((currentSimTime - (I - 1) * hrsPerMonth) / (timeSSFactor));
-                    RQMonth = gFuncVal / (kGroundFactor);
-                    sumQnMonthly += (QnMonthlyAgg(I) - QnMonthlyAgg(I - 1)) * RQMonth;
                 }
 
                 // Hourly Superposition
@@ -2128,6 +2181,14 @@ namespace GroundHeatExchangers {
             }
             SumQnMonth /= hrsPerMonth;
             QnMonthlyAgg(MonthNum) = SumQnMonth;
+
+            if (DataSystemVariables::GLHEMultiLevelAggregation) {
+                // Months are not necessarily written in sequence after a reset, so rebuild the running sum (once a month)
+                QnMonthlyAggSum.assign(QnMonthlyAgg.size() + 1, 0.0);
+                for (J = 1; J <= int(QnMonthlyAgg.size()); ++J) {
+                    QnMonthlyAggSum[J] = QnMonthlyAggSum[J - 1] + QnMonthlyAgg(J);
+                }
+            }
         }
         if (prevHour != locHourOfDay) {
             prevHour = locHourOfDay;
@@ -2136,6 +2197,78 @@ namespace GroundHeatExchangers {
 
     //******************************************************************************
 
+    Real64 GLHEBase::calcMultiLevelMonthlySuperposition(int const currentMonth, Real64 const kGroundFactor)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR:          na
+        //       DATE WRITTEN:    October 2026
+        //       MODIFIED:        na
+        //       RE-ENGINEERED:   na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Superpose the monthly aggregated loads up to currentMonth with a bounded number of g-function evaluations.
+
+        // METHODOLOGY EMPLOYED:
+        // The most recent months are superposed individually as in the standard monthly aggregation. Older months are
+        // lumped into blocks whose width doubles every monthsPerLevel blocks going back in time, each carrying the mean
+        // load of its months (taken from the running sum in QnMonthlyAggSum). The far past is seen through the flat tail
+        // of the g-function, so its detail barely matters, and the number of terms grows with the log of the simulation
+        // length instead of linearly, e.g. 52 terms instead of 240 for a 20-year simulation.
+
+        // REFERENCES:
+        // Claesson, J. and S. Javed. 2012. 'A Load-Aggregation Method to Calculate Extraction Temperatures of Borehole
+        //   Heat Exchangers.' ASHRAE Transactions 118(1): 530-539.
+
+        int const monthsPerLevel(12); // blocks of each width, the first level resolves the annual cycle month by month
+
+        if (int(QnMonthlyAggSum.size()) <= currentMonth) {
+            // Running sum not available yet (first month after a reset), nothing older than a month to lump
+            QnMonthlyAggSum.assign(QnMonthlyAgg.size() + 1, 0.0);
+            for (int month = 1; month <= int(QnMonthlyAgg.size()); ++month) {
+                QnMonthlyAggSum[month] = QnMonthlyAggSum[month - 1] + QnMonthlyAgg(month);
+            }
+        }
+
+        // Block start months, newest first
+        std::vector<int> blockStart;
+        int width = 1;
+        int blocksAtWidth = 0;
+        for (int lastMonth = currentMonth; lastMonth >= 1;) {
+            int const firstMonth = max(1, lastMonth - width + 1);
+            blockStart.push_back(firstMonth);
+            lastMonth = firstMonth - 1;
+            if (++blocksAtWidth == monthsPerLevel) {
+                width *= 2;
+                blocksAtWidth = 0;
+            }
+        }
+
+        // Superpose the load steps between blocks, oldest first
+        Real64 sumQn = 0.0;
+        Real64 prevQn = 0.0;
+        int lastMonth = currentMonth;
+        std::vector<Real64> blockQn(blockStart.size());
+        for (std::size_t block = 0; block < blockStart.size(); ++block) {
+            if (lastMonth == blockStart[block]) {
+                // Single month, take it as stored so the first level reproduces the month-by-month superposition exactly
+                blockQn[block] = QnMonthlyAgg(lastMonth);
+            } else {
+                blockQn[block] = (QnMonthlyAggSum[lastMonth] - QnMonthlyAggSum[blockStart[block] - 1]) / (lastMonth - blockStart[block] + 1);
+            }
+            lastMonth = blockStart[block] - 1;
+        }
+        for (int block = int(blockStart.size()) - 1; block >= 0; --block) {
+            Real64 const RQMonth = getGFunc((currentSimTime - (blockStart[block] - 1) * hrsPerMonth) / (timeSSFactor)) / (kGroundFactor);
+            sumQn += (blockQn[block] - prevQn) * RQMonth;
+            prevQn = blockQn[block];
+        }
+
+        return sumQn;
+    }
+
+    //******************************************************************************
+
     void GetGroundHeatExchangerInput()
     {
         // SUBROUTINE INFORMATION:
@@ -3351,6 +3484,7 @@ namespace GroundHeatExchangers {
 
             QnHr = 0.0;
             QnMonthlyAgg = 0.0;
+            QnMonthlyAggSum.clear();
             QnSubHr = 0.0;
             LastHourN = 0;
             prevTimeSteps = 0.0;
@@ -3460,6 +3594,7 @@ namespace GroundHeatExchangers {
 
             QnHr = 0.0;
             QnMonthlyAgg = 0.0;
+            QnMonthlyAggSum.clear();
             QnSubHr = 0.0;
             LastHourN = 0;
             prevTimeSteps = 0.0;
@@ -76,7 +76,7 @@ namespace EnergyPlus {
         extern int const maxTSinHr;      // Max number of time step in a hour
 
         // MODULE VARIABLE DECLARATIONS:
-        // na
+        extern Real64 currentSimTime; // Current simulation time in hours
 
         // Types
 
@@ -225,6 +225,7 @@ namespace EnergyPlus {
             Real64 designMassFlow;        // Design mass flow rate				[kg/s]
             Real64 tempGround;            // The far field temperature of the ground   [degC]
             Array1D<Real64> QnMonthlyAgg; // Monthly aggregated normalized heat extraction/rejection rate [W/m]
+            std::vector<Real64> QnMonthlyAggSum; // Running sum of QnMonthlyAgg, for multi-level aggregation [W/m]
             Array1D<Real64> QnHr;         // Hourly aggregated normalized heat extraction/rejection rate [W/m]
             Array1D<Real64> QnSubHr; // Contains the sub-hourly heat extraction/rejection rate normalized by the total active length of bore holes  [W/m]
             int prevHour;
@@ -270,6 +271,8 @@ namespace EnergyPlus {
 
             void calcAggregateLoad();
 
+            Real64 calcMultiLevelMonthlySuperposition(int const currentMonth, Real64 const kGroundFactor);
+
             void updateGHX();
 
             void calcGroundHeatExchanger();
@@ -47,7 +47,12 @@
 
 // C++ Headers
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <memory>
+#include <sstream>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Fmath.hh>
@@ -58,6 +63,9 @@
 #include <DataGlobals.hh>
 #include <DataIPShortCuts.hh>
 #include <DataReportingFlags.hh>
+#include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
+#include <FileSystem.hh>
 #include <General.hh>
 #include <GroundTemperatureModeling/FiniteDifferenceGroundTemperatureModel.hh>
 #include <GroundTemperatureModeling/GroundTemperatureModelManager.hh>
@@ -75,6 +83,7 @@ int numIterYears = 0;
 int const maxYearsToIterate = 10;
 Real64 finalTempConvergenceCriteria = 0.05;
 Real64 iterationTempConvergenceCriteria = 0.00001;
+std::uint64_t const groundTempCacheVersion(1);
 
 //******************************************************************************
 
@@ -151,17 +160,169 @@ void FiniteDiffGroundTempsModel::initAndSim()
     // SUBROUTINE INFORMATION:
     //       AUTHOR         Matt Mitchell
     //       DATE WRITTEN   Summer 2015
-    //       MODIFIED       na
+    //       MODIFIED       October 2026, reuse the results of identical models and of earlier runs
     //       RE-ENGINEERED  na
 
     // PURPOSE OF THIS SUBROUTINE:
     // Initalizes and simulated finite difference ground temps model
 
-    FiniteDiffGroundTempsModel::getWeatherData();
+    // METHODOLOGY EMPLOYED:
+    // The converged annual profile only depends on the soil properties and the weather file, so a model with the
+    // same soil as one already simulated copies its results, and one simulated by an earlier run is read from the
+    // ground temperature cache when EP_GROUND_TEMP_CACHE names a directory.  The daily weather averages do not
+    // depend on the soil, so the weather file is read only once for all models.
+
+    using GroundTemperatureManager::groundTempModels;
+    using GroundTemperatureManager::objectType_FiniteDiffGroundTemp;
+
+    std::shared_ptr<FiniteDiffGroundTempsModel> simulatedModel;
+    for (auto const &model : groundTempModels) {
+        if (model.get() == this || model->objectType != objectType_FiniteDiffGroundTemp) continue;
+        auto const otherModel = std::static_pointer_cast<FiniteDiffGroundTempsModel>(model);
+        if (otherModel->groundTemps.empty() || otherModel->weatherDataArray.empty()) continue;
+        if (hasSameSoilProperties(*otherModel)) {
+            totalNumCells = otherModel->totalNumCells;
+            cellDepths = otherModel->cellDepths;
+            groundTemps = otherModel->groundTemps;
+            return;
+        }
+        if (!simulatedModel) simulatedModel = otherModel;
+    }
+
+    std::string const cacheFileName(groundTempCacheFileName());
+    if (!cacheFileName.empty() && readGroundTempCache(cacheFileName)) return;
+
+    if (simulatedModel) {
+        weatherDataArray = simulatedModel->weatherDataArray;
+        annualAveAirTemp = simulatedModel->annualAveAirTemp;
+        minDailyAirTemp = simulatedModel->minDailyAirTemp;
+        maxDailyAirTemp = simulatedModel->maxDailyAirTemp;
+        dayOfMinDailyAirTemp = simulatedModel->dayOfMinDailyAirTemp;
+    } else {
+        FiniteDiffGroundTempsModel::getWeatherData();
+    }
 
     FiniteDiffGroundTempsModel::developMesh();
 
     FiniteDiffGroundTempsModel::performSimulation();
+
+    if (!cacheFileName.empty()) writeGroundTempCache(cacheFileName);
+}
+
+//******************************************************************************
+
+bool FiniteDiffGroundTempsModel::hasSameSoilProperties(FiniteDiffGroundTempsModel const &other) const
+{
+    // FUNCTION INFORMATION:
+    //       DATE WRITTEN   October 2026
+
+    // PURPOSE OF THIS FUNCTION:
+    // True when the other model has the inputs that determine the simulated ground temperatures.
+
+    return baseConductivity == other.baseConductivity && baseDensity == other.baseDensity && baseSpecificHeat == other.baseSpecificHeat &&
+           waterContent == other.waterContent && saturatedWaterContent == other.saturatedWaterContent && evapotransCoeff == other.evapotransCoeff;
+}
+
+//******************************************************************************
+
+std::string FiniteDiffGroundTempsModel::groundTempCacheFileName() const
+{
+    // FUNCTION INFORMATION:
+    //       DATE WRITTEN   October 2026
+
+    // PURPOSE OF THIS FUNCTION:
+    // Name of the ground temperature cache file for this model, or empty when the results are not cached.
+
+    // METHODOLOGY EMPLOYED:
+    // The name is a hash of the weather file contents, the soil properties and the number of time steps per hour,
+    // which the daily weather averages are taken over.
+
+    using DataSystemVariables::GroundTempCacheDirectory;
+
+    if (GroundTempCacheDirectory.empty() || !WeatherManager::WeatherFileExists) return std::string();
+
+    std::ifstream ifs(DataStringGlobals::inputWeatherFileName, std::ios::binary);
+    if (!ifs) return std::string();
+    std::ostringstream WeatherFileText;
+    WeatherFileText << ifs.rdbuf();
+
+    std::uint64_t Hash = WeatherManager::WeatherFileHash(WeatherFileText.str());
+    Real64 const Properties[6] = {baseConductivity, baseDensity, baseSpecificHeat, waterContent, saturatedWaterContent, evapotransCoeff};
+    Hash = FileSystem::hashBytes(Properties, sizeof(Properties), Hash);
+    Hash = FileSystem::hashBytes(&DataGlobals::NumOfTimeStepInHour, sizeof(DataGlobals::NumOfTimeStepInHour), Hash);
+
+    return GroundTempCacheDirectory + DataStringGlobals::pathChar + FileSystem::hashToHex(Hash) + ".gtcache";
+}
+
+//******************************************************************************
+
+bool FiniteDiffGroundTempsModel::readGroundTempCache(std::string const &fileName)
+{
+    // FUNCTION INFORMATION:
+    //       DATE WRITTEN   October 2026
+
+    // PURPOSE OF THIS FUNCTION:
+    // Loads the cell depths and annual ground temperatures written by writeGroundTempCache.  Returns false, leaving
+    // the model untouched, when the file is missing or was not written by this version of the model.
+
+    std::ifstream ifs(fileName, std::ios::binary);
+    if (!ifs) return false;
+
+    std::uint64_t Header[3] = {0, 0, 0};
+    ifs.read(reinterpret_cast<char *>(Header), sizeof(Header));
+    if (!ifs || Header[0] != groundTempCacheVersion || Header[1] != std::uint64_t(NumDaysInYear) || Header[2] == 0) return false;
+
+    // Check the length first so a truncated file cannot leave a partly loaded profile behind
+    std::size_t const numCells(Header[2]);
+    std::streamoff const ExpectedSize(sizeof(Header) + sizeof(Real64) * numCells * (NumDaysInYear + 1));
+    ifs.seekg(0, std::ios::end);
+    if (ifs.tellg() != ExpectedSize) return false;
+    ifs.seekg(sizeof(Header), std::ios::beg);
+
+    Array1D<Real64> depths(numCells);
+    Array2D<Real64> temps({1, NumDaysInYear}, {1, int(numCells)});
+    ifs.read(reinterpret_cast<char *>(depths.data()), sizeof(Real64) * depths.size());
+    ifs.read(reinterpret_cast<char *>(temps.data()), sizeof(Real64) * temps.size());
+    if (!ifs) return false;
+
+    totalNumCells = int(numCells);
+    cellDepths.swap(depths);
+    groundTemps.swap(temps);
+    return true;
+}
+
+//******************************************************************************
+
+void FiniteDiffGroundTempsModel::writeGroundTempCache(std::string const &fileName) const
+{
+    // SUBROUTINE INFORMATION:
+    //       DATE WRITTEN   October 2026
+
+    // PURPOSE OF THIS SUBROUTINE:
+    // Stores the cell depths and annual ground temperatures for readGroundTempCache.
+
+    // METHODOLOGY EMPLOYED:
+    // The file is written under a temporary name and renamed into place, so runs sharing the cache directory
+    // never read a partly written file.  Failing to store the cache only costs the next run the simulation.
+
+    std::string const TempFileName = fileName + '.' + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".tmp";
+    {
+        std::ofstream ofs(TempFileName, std::ios::binary | std::ios::trunc);
+        if (!ofs) {
+            ShowWarningError("Site:GroundTemperature:Undisturbed:FiniteDifference: could not open " + TempFileName +
+                             ", ground temperatures will not be cached.");
+            return;
+        }
+        std::uint64_t const Header[3] = {groundTempCacheVersion, std::uint64_t(NumDaysInYear), std::uint64_t(totalNumCells)};
+        ofs.write(reinterpret_cast<char const *>(Header), sizeof(Header));
+        ofs.write(reinterpret_cast<char const *>(cellDepths.data()), sizeof(Real64) * cellDepths.size());
+        ofs.write(reinterpret_cast<char const *>(groundTemps.data()), sizeof(Real64) * groundTemps.size());
+    }
+    if (std::rename(TempFileName.c_str(), fileName.c_str()) != 0) {
+        // rename does not replace an existing file everywhere
+        std::remove(fileName.c_str());
+        if (std::rename(TempFileName.c_str(), fileName.c_str()) != 0) std::remove(TempFileName.c_str());
+    }
 }
 
 //******************************************************************************
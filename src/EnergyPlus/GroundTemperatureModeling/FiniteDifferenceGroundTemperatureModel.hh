@@ -50,6 +50,7 @@
 
 // C++ Headers
 #include <memory>
+#include <string>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -134,6 +135,14 @@ public:
 
     void initAndSim();
 
+    bool hasSameSoilProperties(FiniteDiffGroundTempsModel const &other) const;
+
+    std::string groundTempCacheFileName() const;
+
+    bool readGroundTempCache(std::string const &fileName);
+
+    void writeGroundTempCache(std::string const &fileName) const;
+
     void developMesh();
 
     void performSimulation();
@@ -907,6 +907,7 @@ namespace HVACControllers {
         ControllerProps(ControlNum).ReusePreviousSolutionFlag = true;
         // Always reset to false by default. Set in CalcSimpleController() on the first controller iteration.
         ControllerProps(ControlNum).ReuseIntermediateSolutionFlag = false;
+        ControllerProps(ControlNum).WarmStartFlag = false;
         // By default not converged
         IsConvergedFlag = false;
 
@@ -1212,6 +1213,7 @@ namespace HVACControllers {
                 e.DefinedFlag = false;
                 e.Mode = iModeNone;
                 e.ActuatedValue = 0.0;
+                e.Sensitivity = 0.0;
             }
 
             MyEnvrnFlag(ControlNum) = false;
@@ -1528,6 +1530,14 @@ namespace HVACControllers {
                 // and fire root finder to get next root candidate
                 FindRootSimpleController(ControlNum, FirstHVACIteration, IsConvergedFlag, IsUpToDateFlag, ControllerName);
 
+            } else if (DataSystemVariables::ControllerWarmStart && WarmStartCandidate(ControlNum, FirstHVACIteration)) {
+                // Start from the solution of the previous call to SimAirLoop() instead of the min point,
+                // the bracketing phase must not propose it a second time.
+                ControllerProps(ControlNum).NextActuatedValue =
+                    ControllerProps(ControlNum).SolutionTrackers(FirstHVACIteration ? 1 : 2).ActuatedValue;
+                ControllerProps(ControlNum).ReusePreviousSolutionFlag = false;
+                ControllerProps(ControlNum).WarmStartFlag = true;
+
             } else {
                 // Always start with min point by default
                 ControllerProps(ControlNum).NextActuatedValue = RootFinders(ControlNum).MinPoint.X;
@@ -1572,6 +1582,36 @@ namespace HVACControllers {
         }
     }
 
+    bool WarmStartCandidate(int const ControlNum, bool const FirstHVACIteration)
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns true if the solution saved at the previous HVAC step can be used as the first
+        // candidate of the root finder for the current HVAC step.
+
+        // METHODOLOGY EMPLOYED:
+        // The previous solution must have been obtained in active mode and must lie within the
+        // min/max bounds of the root finder, which must have been initialized beforehand.
+        // Dual temperature and humidity ratio controllers switch setpoint between iterations and
+        // are always started from the min point.
+
+        // Using/Aliasing
+        using RootFinder::CheckRootFinderCandidate;
+
+        auto const &Controller(ControllerProps(ControlNum));
+        if (Controller.ControlVar == iTemperatureAndHumidityRatio) return false;
+
+        auto const &PreviousSolution(Controller.SolutionTrackers(FirstHVACIteration ? 1 : 2));
+        return PreviousSolution.DefinedFlag && PreviousSolution.Mode == iModeActive &&
+               CheckRootFinderCandidate(RootFinders(ControlNum), PreviousSolution.ActuatedValue);
+    }
+
     void FindRootSimpleController(int const ControlNum,
                                   bool const FirstHVACIteration,
                                   bool &IsConvergedFlag,
@@ -1622,6 +1662,8 @@ namespace HVACControllers {
         bool PreviousSolutionDefinedFlag;
         int PreviousSolutionMode;
         Real64 PreviousSolutionValue;
+        bool WarmStartStepFlag;     // TRUE if the next candidate is a step from the previous solution
+        Real64 WarmStartValue(0.0); // Step from the previous solution using its saved sensitivity
 
         // Obtain actuated and sensed nodes
         ActuatedNode = ControllerProps(ControlNum).ActuatedNode;
@@ -1653,6 +1695,18 @@ namespace HVACControllers {
                 PreviousSolutionMode = ControllerProps(ControlNum).SolutionTrackers(PreviousSolutionIndex).Mode;
                 PreviousSolutionValue = ControllerProps(ControlNum).SolutionTrackers(PreviousSolutionIndex).ActuatedValue;
 
+                // With a warm start, the point just evaluated is the previous solution: step from it with the
+                // sensitivity saved with it.  The previous solution has then been used for this HVAC iteration.
+                WarmStartStepFlag = false;
+                if (ControllerProps(ControlNum).WarmStartFlag) {
+                    ControllerProps(ControlNum).WarmStartFlag = false;
+                    Real64 const Sensitivity = ControllerProps(ControlNum).SolutionTrackers(PreviousSolutionIndex).Sensitivity;
+                    if (Sensitivity != 0.0) {
+                        WarmStartValue = ControllerProps(ControlNum).ActuatedValue - ControllerProps(ControlNum).DeltaSensed / Sensitivity;
+                        WarmStartStepFlag = CheckRootFinderCandidate(RootFinders(ControlNum), WarmStartValue);
+                    }
+                }
+
                 // Attempt to use root at previous HVAC step in place of the candidate produced by the
                 // root finder.
                 // Set in InitController() depending on controller mode at previous HVAC step iteration
@@ -1665,13 +1719,17 @@ namespace HVACControllers {
                                             (PreviousSolutionMode == iModeActive) &&
                                             CheckRootFinderCandidate(RootFinders(ControlNum), PreviousSolutionValue);
 
-                if (ReusePreviousSolutionFlag) {
+                if (WarmStartStepFlag) {
+                    ControllerProps(ControlNum).NextActuatedValue = WarmStartValue;
+                } else if (ReusePreviousSolutionFlag) {
                     // Try to reuse saved solution from previous call to SolveAirLoopControllers()
                     // instead of candidate proposed by the root finder
                     ControllerProps(ControlNum).NextActuatedValue = PreviousSolutionValue;
 
                     // Turn off flag since we can only use the previous solution once per HVAC iteration
                     ControllerProps(ControlNum).ReusePreviousSolutionFlag = false;
+                    // With a warm start, the next candidate steps from the previous solution
+                    ControllerProps(ControlNum).WarmStartFlag = DataSystemVariables::ControllerWarmStart;
                 } else {
                     // By default, use candidate value computed by root finder
                     ControllerProps(ControlNum).NextActuatedValue = RootFinders(ControlNum).XCandidate;
@@ -2170,6 +2228,14 @@ namespace HVACControllers {
                 ControllerProps(ControlNum).SolutionTrackers(PreviousSolutionIndex).DefinedFlag = true;
                 ControllerProps(ControlNum).SolutionTrackers(PreviousSolutionIndex).Mode = ControllerProps(ControlNum).Mode;
                 ControllerProps(ControlNum).SolutionTrackers(PreviousSolutionIndex).ActuatedValue = ControllerProps(ControlNum).NextActuatedValue;
+                // Local sensitivity from the tightest pair of points bracketing the root, kept from the last
+                // solution when the root was found without a bracket
+                auto const &RootFinder(RootFinders(ControlNum));
+                if (RootFinder.LowerPoint.DefinedFlag && RootFinder.UpperPoint.DefinedFlag &&
+                    RootFinder.UpperPoint.X != RootFinder.LowerPoint.X) {
+                    ControllerProps(ControlNum).SolutionTrackers(PreviousSolutionIndex).Sensitivity =
+                        (RootFinder.UpperPoint.Y - RootFinder.LowerPoint.Y) / (RootFinder.UpperPoint.X - RootFinder.LowerPoint.X);
+                }
             } else {
                 ControllerProps(ControlNum).SolutionTrackers(PreviousSolutionIndex).DefinedFlag = false;
                 ControllerProps(ControlNum).SolutionTrackers(PreviousSolutionIndex).Mode = ControllerProps(ControlNum).Mode;
@@ -139,9 +139,10 @@ namespace HVACControllers {
         bool DefinedFlag;     // Flag set to TRUE when tracker is up-to-date. FALSE otherwise.
         Real64 ActuatedValue; // Actuated value
         int Mode;             // Operational model of controller
+        Real64 Sensitivity;   // Change of DeltaSensed per unit actuated value around the solution, 0 if unknown
 
         // Default Constructor
-        SolutionTrackerType() : DefinedFlag(true), ActuatedValue(0.0), Mode(iModeNone)
+        SolutionTrackerType() : DefinedFlag(true), ActuatedValue(0.0), Mode(iModeNone), Sensitivity(0.0)
         {
         }
     };
@@ -173,6 +174,9 @@ namespace HVACControllers {
         // Flag used to decide whether or not it is possible to reuse the solution from
         // the last call to SimAirLoop() as a possible candidate.
         bool ReusePreviousSolutionFlag;
+        // Flag set when the root search of the current HVAC iteration started from the previous solution
+        // (ControllerWarmStart). The next candidate is then a Newton step with the stored sensitivity.
+        bool WarmStartFlag;
         // Array of solution trackers. Saved at last call to SimAirLoop() in ManageControllers(iControllerOpEnd)
         // The first tracker is used to track the solution when FirstHVACIteration is TRUE.
         // The second tracker is used to track the solution at FirstHVACIteration is FALSE.
@@ -239,9 +243,9 @@ namespace HVACControllers {
         ControllerPropsType()
             : ControllerType_Num(ControllerSimple_Type), ControlVar(iNoControlVariable), ActuatorVar(0), Action(iNoAction), InitFirstPass(true),
               NumCalcCalls(0), Mode(iModeNone), DoWarmRestartFlag(false), ReuseIntermediateSolutionFlag(false), ReusePreviousSolutionFlag(false),
-              SolutionTrackers(2), MaxAvailActuated(0.0), MaxAvailSensed(0.0), MinAvailActuated(0.0), MinAvailSensed(0.0), MaxVolFlowActuated(0.0),
-              MinVolFlowActuated(0.0), MaxActuated(0.0), MinActuated(0.0), ActuatedNode(0), ActuatedValue(0.0), NextActuatedValue(0.0),
-              ActuatedNodePlantLoopNum(0), ActuatedNodePlantLoopSide(0), ActuatedNodePlantLoopBranchNum(0), SensedNode(0),
+              WarmStartFlag(false), SolutionTrackers(2), MaxAvailActuated(0.0), MaxAvailSensed(0.0), MinAvailActuated(0.0), MinAvailSensed(0.0),
+              MaxVolFlowActuated(0.0), MinVolFlowActuated(0.0), MaxActuated(0.0), MinActuated(0.0), ActuatedNode(0), ActuatedValue(0.0),
+              NextActuatedValue(0.0), ActuatedNodePlantLoopNum(0), ActuatedNodePlantLoopSide(0), ActuatedNodePlantLoopBranchNum(0), SensedNode(0),
               IsSetPointDefinedFlag(false), SetPointValue(0.0), SensedValue(0.0), DeltaSensed(0.0), Offset(0.0), HumRatCntrlType(0), Range(0.0),
               Limit(0.0), TraceFileUnit(0), FirstTraceFlag(true), BadActionErrCount(0), BadActionErrIndex(0), FaultyCoilSATFlag(false),
               FaultyCoilSATIndex(0), FaultyCoilSATOffset(0.0), BypassControllerCalc(false), AirLoopControllerIndex(0), HumRatCtrlOverride(false)
@@ -338,6 +342,8 @@ namespace HVACControllers {
                               std::string const &ControllerName // used when errors occur
     );
 
+    bool WarmStartCandidate(int const ControlNum, bool const FirstHVACIteration);
+
     void FindRootSimpleController(int const ControlNum,
                                   bool const FirstHVACIteration,
                                   bool &IsConvergedFlag,
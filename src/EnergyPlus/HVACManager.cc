@@ -46,8 +46,14 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 // C++ Headers
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <fstream>
+#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -75,8 +81,10 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataReportingFlags.hh>
 #include <DataRoomAirModel.hh>
+#include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataZoneEquipment.hh>
 #include <DemandManager.hh>
 #include <DisplayRoutines.hh>
@@ -101,6 +109,7 @@
 #include <ScheduleManager.hh>
 #include <SetPointManager.hh>
 #include <SimAirServingZones.hh>
+#include <SimulationTelemetry.hh>
 #include <SizingManager.hh>
 #include <SystemAvailabilityManager.hh>
 #include <SystemReports.hh>
@@ -206,6 +215,14 @@ namespace HVACManager {
         bool SimHVACIterSetup(false);
         bool TriggerGetAFN(true);
         bool ReportAirHeatBalanceFirstTimeFlag(true);
+        // Mixing and cross mixing objects that touch each zone, in input order, for the mixing load reports
+        Array1D<std::vector<int>> ZoneMixingReportList;
+        Array1D<std::vector<int>> ZoneCrossMixingReportList;
+        // HVAC iteration report: system time steps and their wall time by HVACManageIteration, and the
+        // system time steps that ended at MaxIter by the subsystem that had not converged
+        std::vector<int> IterationSteps;
+        std::vector<Real64> IterationSeconds;
+        std::map<std::string, int> NotConvergedSteps;
     } // namespace
     // SUBROUTINE SPECIFICATIONS FOR MODULE PrimaryPlantLoops
     // and zone equipment simulations
@@ -220,6 +237,11 @@ namespace HVACManager {
         SimHVACIterSetup = false;
         TriggerGetAFN = true;
         ReportAirHeatBalanceFirstTimeFlag = true;
+        ZoneMixingReportList.deallocate();
+        ZoneCrossMixingReportList.deallocate();
+        IterationSteps.clear();
+        IterationSeconds.clear();
+        NotConvergedSteps.clear();
     }
 
     void ManageHVAC()
@@ -240,6 +262,9 @@ namespace HVACManager {
         // METHODOLOGY EMPLOYED:
         //  manage calls to Predictor and Corrector and other updates in ZoneTempPredictorCorrector
         //  manage variable time step and when zone air histories are updated.
+        //  Only the system time step varies.  The zone time step stays fixed for the run because the conduction
+        //  transfer functions are calculated for it, and the weather, schedule and report arrays are laid out
+        //  per zone time step; a quiet zone time step already runs as a single system time step.
 
         // REFERENCES:
 
@@ -340,6 +365,9 @@ namespace HVACManager {
         static ObjexxFCL::gio::Fmt Format_20("(1x,I3,1x,F8.2,2(2x,F8.3),2x,F8.2,4(1x,F13.2),2x,F8.0,2x,F11.2,2x,F9.5,2x,A)");
         static ObjexxFCL::gio::Fmt Format_30("(1x,I3,5x,A)");
 
+        SimulationTelemetry::ScopedTimer telemetryTimer(SimulationTelemetry::Subsystem::HVAC);
+        EP_TIMER_SCOPE("ManageHVAC");
+
         // SYSTEM INITIALIZATION
         if (TriggerGetAFN) {
             TriggerGetAFN = false;
@@ -819,6 +847,9 @@ namespace HVACManager {
             return;
         }
 
+        std::chrono::steady_clock::time_point IterationStart;
+        if (DataSystemVariables::HVACIterationReport) IterationStart = std::chrono::steady_clock::now();
+
         // Before the HVAC simulation, reset control flags and specified flow
         // rates that might have been set by the set point and availability
         // managers.
@@ -964,6 +995,15 @@ namespace HVACManager {
             }
         }
 
+        if (DataSystemVariables::HVACIterationReport) {
+            RecordHVACIteration(std::chrono::duration<Real64>(std::chrono::steady_clock::now() - IterationStart).count(),
+                                SimAirLoopsFlag,
+                                SimZoneEquipmentFlag,
+                                SimNonZoneEquipmentFlag,
+                                SimPlantLoopsFlag,
+                                SimElecCircuitsFlag);
+        }
+
         if ((HVACManageIteration > MaxIter) && (!WarmupFlag)) {
             ++ErrCount;
             if (ErrCount < 15) {
@@ -2322,6 +2362,7 @@ namespace HVACManager {
         //       AUTHOR         Linda Lawrie
         //       DATE WRITTEN   July 2000
         //       MODIFIED       Shirey, Jan 2008 (MIXING/CROSS MIXING outputs)
+        //                      October 2026, per zone mixing object lists for the mixing outputs
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -2458,6 +2499,18 @@ namespace HVACManager {
         if (ReportAirHeatBalanceFirstTimeFlag) {
             MixSenLoad.allocate(NumOfZones);
             MixLatLoad.allocate(NumOfZones);
+            // map each zone to the mixing objects that report into it once, rather than scanning every object for every zone
+            ZoneMixingReportList.allocate(NumOfZones);
+            ZoneCrossMixingReportList.allocate(NumOfZones);
+            for (MixNum = 1; MixNum <= TotMixing; ++MixNum) {
+                if (Mixing(MixNum).ZonePtr > 0) ZoneMixingReportList(Mixing(MixNum).ZonePtr).push_back(MixNum);
+            }
+            for (MixNum = 1; MixNum <= TotCrossMixing; ++MixNum) {
+                if (CrossMixing(MixNum).ZonePtr > 0) ZoneCrossMixingReportList(CrossMixing(MixNum).ZonePtr).push_back(MixNum);
+                if (CrossMixing(MixNum).FromZone > 0 && CrossMixing(MixNum).FromZone != CrossMixing(MixNum).ZonePtr) {
+                    ZoneCrossMixingReportList(CrossMixing(MixNum).FromZone).push_back(MixNum);
+                }
+            }
             ReportAirHeatBalanceFirstTimeFlag = false;
         }
 
@@ -2609,7 +2662,7 @@ namespace HVACManager {
             ZnAirRpt(ZoneLoop).MixMdot = 0.0;           // ! zero reported mass flow rate prior to summations below
             //    MixingLoad = 0.0d0
 
-            for (MixNum = 1; MixNum <= TotMixing; ++MixNum) {
+            for (int const MixNum : ZoneMixingReportList(ZoneLoop)) {
                 if ((Mixing(MixNum).ZonePtr == ZoneLoop) && MixingReportFlag(MixNum)) {
                     //        MixSenLoad(ZoneLoop) = MixSenLoad(ZoneLoop)+MCPM(ZoneLoop)*MAT(Mixing(MixNum)%FromZone)
                     //        H2OHtOfVap = PsyHgAirFnWTdb(ZoneAirHumRat(ZoneLoop), MAT(ZoneLoop))
@@ -2636,7 +2689,7 @@ namespace HVACManager {
                 }
             }
 
-            for (MixNum = 1; MixNum <= TotCrossMixing; ++MixNum) {
+            for (int const MixNum : ZoneCrossMixingReportList(ZoneLoop)) {
                 if ((CrossMixing(MixNum).ZonePtr == ZoneLoop) && CrossMixingReportFlag(MixNum)) {
                     //        MixSenLoad(ZoneLoop) = MixSenLoad(ZoneLoop)+MCPM(ZoneLoop)*MAT(CrossMixing(MixNum)%FromZone)
                     //        Per Jan 17, 2008 conference call, agreed to use average conditions for Rho, Cp and Hfg
@@ -3106,6 +3159,132 @@ namespace HVACManager {
         }
     }
 
+    void RecordHVACIteration(Real64 const Seconds,
+                             bool const SimAirLoops,
+                             bool const SimZoneEquipment,
+                             bool const SimNonZoneEquipment,
+                             bool const SimPlantLoops,
+                             bool const SimElecCircuits)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Add one system time step to the HVAC iteration report when the HVACIterationReport environment
+        // variable is set
+
+        // METHODOLOGY EMPLOYED:
+        // The time step is counted under its HVACManageIteration.  When the iteration loop stopped at MaxIter,
+        // the simulation flags still set name the subsystems that had not converged; air loops and plant
+        // half loops are named individually from their convergence logs and resimulation flags.  Warmup
+        // time steps are included, since they cost as much as any other.
+
+        using DataAirLoop::AirToZoneNodeInfo;
+        using DataConvergParams::AirLoopConvergence;
+        using DataConvergParams::MaxIter;
+        using DataPlant::DemandSide;
+        using DataPlant::PlantLoop;
+        using DataPlant::SupplySide;
+        using DataPlant::TotNumLoops;
+
+        std::size_t const Bin = static_cast<std::size_t>(max(HVACManageIteration, 0));
+        if (Bin >= IterationSteps.size()) {
+            IterationSteps.resize(Bin + 1, 0);
+            IterationSeconds.resize(Bin + 1, 0.0);
+        }
+        ++IterationSteps[Bin];
+        IterationSeconds[Bin] += Seconds;
+
+        if (HVACManageIteration <= MaxIter) return;
+
+        if (SimAirLoops) {
+            bool Named = false;
+            if (allocated(AirLoopConvergence) && allocated(AirToZoneNodeInfo)) {
+                for (int AirSysNum = 1; AirSysNum <= min(isize(AirLoopConvergence), isize(AirToZoneNodeInfo)); ++AirSysNum) {
+                    auto const &convergence(AirLoopConvergence(AirSysNum));
+                    if (any(convergence.HVACMassFlowNotConverged) || any(convergence.HVACHumRatNotConverged) ||
+                        any(convergence.HVACTempNotConverged) || any(convergence.HVACEnergyNotConverged)) {
+                        ++NotConvergedSteps["Air Loop " + AirToZoneNodeInfo(AirSysNum).AirLoopName];
+                        Named = true;
+                    }
+                }
+            }
+            if (!Named) ++NotConvergedSteps["Air Loops"];
+        }
+        if (SimZoneEquipment) ++NotConvergedSteps["Zone Equipment"];
+        if (SimNonZoneEquipment) ++NotConvergedSteps["Non-Zone Equipment"];
+        if (SimPlantLoops) {
+            bool Named = false;
+            for (int LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum) {
+                for (int LoopSideNum = DemandSide; LoopSideNum <= SupplySide; ++LoopSideNum) {
+                    if (!PlantLoop(LoopNum).LoopSide(LoopSideNum).SimLoopSideNeeded) continue;
+                    ++NotConvergedSteps["Plant Loop " + PlantLoop(LoopNum).Name + (LoopSideNum == DemandSide ? " Demand Side" : " Supply Side")];
+                    Named = true;
+                }
+            }
+            if (!Named) ++NotConvergedSteps["Plant Loops"];
+        }
+        if (SimElecCircuits) ++NotConvergedSteps["Electric Load Centers"];
+    }
+
+    void ReportHVACIterations()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Write the HVAC iteration report to <prefix>_hvaciterations.csv at the end of the run
+        // when the HVACIterationReport environment variable is set
+
+        if (!DataSystemVariables::HVACIterationReport || IterationSteps.empty()) return;
+
+        std::ofstream Iterations(DataStringGlobals::outputHVACIterationCsvFileName);
+        if (Iterations) WriteHVACIterations(Iterations);
+    }
+
+    void WriteHVACIterations(std::ostream &Iterations)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Write the HVAC iteration histogram and the non-converged subsystems as CSV
+
+        // METHODOLOGY EMPLOYED:
+        // The first table has one row per HVAC iteration count that occurred, with the number of system time
+        // steps that needed it and their wall time; iteration counts above MaxIter are time steps that did not
+        // converge.  The second table lists the subsystems that had not converged at MaxIter, the most
+        // frequent first.
+
+        Iterations << "HVAC Iterations,System Time Steps,Total Time {s},Average Time {us}\n";
+        for (std::size_t Bin = 0; Bin < IterationSteps.size(); ++Bin) {
+            if (IterationSteps[Bin] == 0) continue;
+            Iterations << Bin << ',' << IterationSteps[Bin] << ',' << IterationSeconds[Bin] << ','
+                       << 1.0e6 * IterationSeconds[Bin] / IterationSteps[Bin] << '\n';
+        }
+
+        std::vector<std::pair<std::string, int>> Subsystems(NotConvergedSteps.begin(), NotConvergedSteps.end());
+        std::stable_sort(Subsystems.begin(), Subsystems.end(), [](std::pair<std::string, int> const &a, std::pair<std::string, int> const &b) {
+            return a.second > b.second;
+        });
+        Iterations << "\nNot Converged Subsystem,System Time Steps\n";
+        for (auto const &subsystem : Subsystems) {
+            Iterations << subsystem.first << ',' << subsystem.second << '\n';
+        }
+    }
+
 } // namespace HVACManager
 
 } // namespace EnergyPlus
@@ -48,6 +48,9 @@
 #ifndef HVACManager_hh_INCLUDED
 #define HVACManager_hh_INCLUDED
 
+// C++ Headers
+#include <ostream>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -105,6 +108,17 @@ namespace HVACManager {
 
     void CheckAirLoopFlowBalance();
 
+    void RecordHVACIteration(Real64 const Seconds,       // wall time of the system time step
+                             bool const SimAirLoops,         // True when the air loops did not converge
+                             bool const SimZoneEquipment,    // True when the zone equipment did not converge
+                             bool const SimNonZoneEquipment, // True when the non-zone equipment did not converge
+                             bool const SimPlantLoops,       // True when the plant loops did not converge
+                             bool const SimElecCircuits);    // True when the electric circuits did not converge
+
+    void ReportHVACIterations();
+
+    void WriteHVACIterations(std::ostream &Iterations);
+
 } // namespace HVACManager
 
 } // namespace EnergyPlus
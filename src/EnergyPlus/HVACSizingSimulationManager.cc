@@ -288,6 +288,10 @@ void ManageHVACSizingSimulation(bool &ErrorsFound)
 
             DisplayString("Initializing New Environment Parameters, HVAC Sizing Simulation");
 
+            // With WarmupStateReuse the pass starts from the surface and zone air histories its design day converged
+            // to in the sizing period or the previous pass (HeatBalanceManager::SeedWarmupState), so only the days
+            // needed to confirm convergence with the resized plant are warmed up again.
+
             BeginEnvrnFlag = true;
             EndEnvrnFlag = false;
             // EndMonthFlag = false;
@@ -9092,6 +9092,23 @@ namespace HVACVariableRefrigerantFlow {
         }
     }
 
+    int VRFCondenserEquipment::GetRefrigerantIndex()
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns the index of the refrigerant of the outdoor unit. The name lookup is done on the first call only,
+        // since the VRF-FluidTCtrl routines need the index in every iteration of their refrigerant side loops.
+
+        if (this->RefIndex == 0) this->RefIndex = FluidProperties::FindRefrigerant(this->RefrigerantName);
+        return this->RefIndex;
+    }
+
     void VRFCondenserEquipment::CalcVRFIUTeTc_FluidTCtrl()
     {
         // SUBROUTINE INFORMATION:
@@ -9322,7 +9339,6 @@ namespace HVACVariableRefrigerantFlow {
         using DXCoils::DXCoilHeatInletAirDBTemp;
         using DXCoils::DXCoilHeatInletAirWBTemp;
         using DXCoils::DXCoilTotalHeating;
-        using FluidProperties::FindRefrigerant;
         using FluidProperties::GetSatEnthalpyRefrig;
         using FluidProperties::GetSatPressureRefrig;
         using FluidProperties::GetSatTemperatureRefrig;
@@ -9528,7 +9544,7 @@ namespace HVACVariableRefrigerantFlow {
         // Refrigerant data
         RefMinTe = -15;
         RefMaxPc = 4000000.0;
-        RefrigerantIndex = FindRefrigerant(this->RefrigerantName);
+        RefrigerantIndex = this->GetRefrigerantIndex();
         RefMinPe = GetSatPressureRefrig(this->RefrigerantName, RefMinTe, RefrigerantIndex, RoutineName);
         RefMinPe = GetSatPressureRefrig(this->RefrigerantName, RefMinTe, RefrigerantIndex, RoutineName);
         RefTLow = RefrigData(RefrigerantIndex).PsLowTempValue;   // High Temperature Value for Ps (max in tables)
@@ -11829,7 +11845,6 @@ namespace HVACVariableRefrigerantFlow {
         // na
 
         // Using/Aliasing
-        using FluidProperties::FindRefrigerant;
         using FluidProperties::GetSatEnthalpyRefrig;
         using FluidProperties::GetSatTemperatureRefrig;
         using FluidProperties::GetSupHeatDensityRefrig;
@@ -11860,7 +11875,7 @@ namespace HVACVariableRefrigerantFlow {
         static std::string const RoutineName("VRFOU_CapModFactor");
 
         // variable initializations
-        RefrigerantIndex = FindRefrigerant(this->RefrigerantName);
+        RefrigerantIndex = this->GetRefrigerantIndex();
 
         // Saturated temperature at real evaporating pressure
         RefTSat = GetSatTemperatureRefrig(this->RefrigerantName, P_evap_real, RefrigerantIndex, RoutineName);
@@ -11921,7 +11936,6 @@ namespace HVACVariableRefrigerantFlow {
 
         // Using/Aliasing
         using DXCoils::DXCoil;
-        using FluidProperties::FindRefrigerant;
         using FluidProperties::GetSatPressureRefrig;
         using FluidProperties::GetSatTemperatureRefrig;
         using FluidProperties::GetSupHeatEnthalpyRefrig;
@@ -11962,7 +11976,7 @@ namespace HVACVariableRefrigerantFlow {
 
         // variable initializations
         TUListNum = this->ZoneTUListPtr;
-        RefrigerantIndex = FindRefrigerant(this->RefrigerantName);
+        RefrigerantIndex = this->GetRefrigerantIndex();
         RefPLow = RefrigData(RefrigerantIndex).PsLowPresValue;
         RefPHigh = RefrigData(RefrigerantIndex).PsHighPresValue;
         NumTUInList = TerminalUnitList(TUListNum).NumTUInList;
@@ -12071,7 +12085,6 @@ namespace HVACVariableRefrigerantFlow {
 
         // Using/Aliasing
         using CurveManager::CurveValue;
-        using FluidProperties::FindRefrigerant;
         using FluidProperties::GetSatPressureRefrig;
         using FluidProperties::GetSupHeatTempRefrig;
         using FluidProperties::RefrigData;
@@ -12110,7 +12123,7 @@ namespace HVACVariableRefrigerantFlow {
         // variable initializations: component index
         TUListNum = this->ZoneTUListPtr;
         NumTUInList = TerminalUnitList(TUListNum).NumTUInList;
-        RefrigerantIndex = FindRefrigerant(this->RefrigerantName);
+        RefrigerantIndex = this->GetRefrigerantIndex();
         RefPLow = RefrigData(RefrigerantIndex).PsLowPresValue;
         RefPHigh = RefrigData(RefrigerantIndex).PsHighPresValue;
 
@@ -12235,7 +12248,6 @@ namespace HVACVariableRefrigerantFlow {
 
         // Using/Aliasing
         using CurveManager::CurveValue;
-        using FluidProperties::FindRefrigerant;
         using FluidProperties::GetSatPressureRefrig;
         using FluidProperties::GetSupHeatTempRefrig;
         using FluidProperties::RefrigData;
@@ -12273,7 +12285,7 @@ namespace HVACVariableRefrigerantFlow {
         // variable initializations: component index
         TUListNum = this->ZoneTUListPtr;
         NumTUInList = TerminalUnitList(TUListNum).NumTUInList;
-        RefrigerantIndex = FindRefrigerant(this->RefrigerantName);
+        RefrigerantIndex = this->GetRefrigerantIndex();
         RefPLow = RefrigData(RefrigerantIndex).PsLowPresValue;
         RefPHigh = RefrigData(RefrigerantIndex).PsHighPresValue;
 
@@ -12370,7 +12382,6 @@ namespace HVACVariableRefrigerantFlow {
         using DataEnvironment::OutDryBulbTemp;
         using DataEnvironment::OutHumRat;
         using DXCoils::DXCoil;
-        using FluidProperties::FindRefrigerant;
         using FluidProperties::GetSatEnthalpyRefrig;
         using FluidProperties::GetSatPressureRefrig;
         using FluidProperties::GetSatTemperatureRefrig;
@@ -12445,7 +12456,7 @@ namespace HVACVariableRefrigerantFlow {
         Q_evap_req = TU_load + Pipe_Q;
 
         TUListNum = this->ZoneTUListPtr;
-        RefrigerantIndex = FindRefrigerant(this->RefrigerantName);
+        RefrigerantIndex = this->GetRefrigerantIndex();
         RefPLow = RefrigData(RefrigerantIndex).PsLowPresValue;
         RefPHigh = RefrigData(RefrigerantIndex).PsHighPresValue;
         NumTUInList = TerminalUnitList(TUListNum).NumTUInList;
@@ -12731,7 +12742,6 @@ namespace HVACVariableRefrigerantFlow {
         using DataEnvironment::OutDryBulbTemp;
         using DataEnvironment::OutHumRat;
         using DXCoils::DXCoil;
-        using FluidProperties::FindRefrigerant;
         using FluidProperties::GetSatEnthalpyRefrig;
         using FluidProperties::GetSatPressureRefrig;
         using FluidProperties::GetSatTemperatureRefrig;
@@ -12788,7 +12798,7 @@ namespace HVACVariableRefrigerantFlow {
         Q_evap_req = TU_load + Pipe_Q - Ncomp;
 
         TUListNum = this->ZoneTUListPtr;
-        RefrigerantIndex = FindRefrigerant(this->RefrigerantName);
+        RefrigerantIndex = this->GetRefrigerantIndex();
         RefPLow = RefrigData(RefrigerantIndex).PsLowPresValue;
         RefPHigh = RefrigData(RefrigerantIndex).PsHighPresValue;
         NumTUInList = TerminalUnitList(TUListNum).NumTUInList;
@@ -12949,7 +12959,6 @@ namespace HVACVariableRefrigerantFlow {
         using DataEnvironment::OutBaroPress;
         using DataEnvironment::OutDryBulbTemp;
         using DataEnvironment::OutHumRat;
-        using FluidProperties::FindRefrigerant;
         using FluidProperties::GetSatEnthalpyRefrig;
         using FluidProperties::GetSatPressureRefrig;
         using FluidProperties::GetSupHeatEnthalpyRefrig;
@@ -12994,7 +13003,7 @@ namespace HVACVariableRefrigerantFlow {
         C_OU_HexRatio = this->HROUHexRatio;
 
         // Initializations: component index
-        RefrigerantIndex = FindRefrigerant(this->RefrigerantName);
+        RefrigerantIndex = this->GetRefrigerantIndex();
         RefPLow = RefrigData(RefrigerantIndex).PsLowPresValue;
         RefPHigh = RefrigData(RefrigerantIndex).PsHighPresValue;
 
@@ -13347,7 +13356,6 @@ namespace HVACVariableRefrigerantFlow {
         // Using/Aliasing
         using DataGlobals::Pi;
         using DXCoils::DXCoil;
-        using FluidProperties::FindRefrigerant;
         using FluidProperties::GetSupHeatDensityRefrig;
         using FluidProperties::RefrigData;
         using General::SolveRoot;
@@ -13401,7 +13409,7 @@ namespace HVACVariableRefrigerantFlow {
         Pipe_cp_ref = 1.6;
 
         // Refrigerant data
-        RefrigerantIndex = FindRefrigerant(this->RefrigerantName);
+        RefrigerantIndex = this->GetRefrigerantIndex();
         Real64 RefPLow = RefrigData(RefrigerantIndex).PsLowPresValue;   // Low Pressure Value for Ps (>0.0)
         Real64 RefPHigh = RefrigData(RefrigerantIndex).PsHighPresValue; // High Pressure Value for Ps (max in tables)
 
@@ -13510,7 +13518,6 @@ namespace HVACVariableRefrigerantFlow {
         // Using/Aliasing
         using DataGlobals::Pi;
         using DXCoils::DXCoil;
-        using FluidProperties::FindRefrigerant;
         using FluidProperties::GetSatTemperatureRefrig;
         using FluidProperties::GetSupHeatDensityRefrig;
         using FluidProperties::GetSupHeatEnthalpyRefrig;
@@ -13568,7 +13575,7 @@ namespace HVACVariableRefrigerantFlow {
         Pipe_cp_ref = 1.6;
 
         // Refrigerant data
-        RefrigerantIndex = FindRefrigerant(this->RefrigerantName);
+        RefrigerantIndex = this->GetRefrigerantIndex();
         Real64 RefTHigh = RefrigData(RefrigerantIndex).PsHighTempValue; // High Temperature Value for Ps (max in tables)
         Real64 RefPLow = RefrigData(RefrigerantIndex).PsLowPresValue;   // Low Pressure Value for Ps (>0.0)
         Real64 RefPHigh = RefrigData(RefrigerantIndex).PsHighPresValue; // High Pressure Value for Ps (max in tables)
@@ -49,6 +49,8 @@
 #include <cassert>
 #include <cmath>
 #include <string>
+#include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -66,6 +68,7 @@
 #include <DataMoistureBalance.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <General.hh>
 #include <HeatBalFiniteDiffManager.hh>
 #include <HeatBalanceMovableInsulation.hh>
@@ -236,6 +239,39 @@ namespace HeatBalFiniteDiffManager {
         CalcHeatBalFiniteDiff(SurfNum, TempSurfInTmp, TempSurfOutTmp);
     }
 
+    void ManageHeatBalFiniteDiffSurfaces(std::vector<int> const &SurfNums, // Surfaces to solve
+                                         Array1D<Real64> &TempSurfInTmp,   // Inside surface temperature of each surface
+                                         Array1D<Real64> &TempSurfOutTmp   // Outside surface temperature of each surface
+    )
+    {
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Solve a batch of CondFD surfaces for the current inside heat balance iteration in parallel.
+
+        // METHODOLOGY EMPLOYED:
+        // The first surface goes through ManageHeatBalFiniteDiff so the input is read before threading.
+        // The caller only passes surfaces whose solution depends on their own SurfaceFD data and on
+        // boundary conditions fixed within the iteration (no interzone partner, no shared phase change
+        // model state), so each surface writes only its own entries.
+
+        if (SurfNums.empty()) return;
+        ManageHeatBalFiniteDiff(SurfNums[0], TempSurfInTmp(SurfNums[0]), TempSurfOutTmp(SurfNums[0]));
+
+        int const nSurfs(static_cast<int>(SurfNums.size()));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(DataSystemVariables::NumberIntRadThreads) if (nSurfs > 2)
+#endif
+        for (int iSurf = 1; iSurf < nSurfs; ++iSurf) {
+            int const SurfNum(SurfNums[iSurf]);
+            CalcHeatBalFiniteDiff(SurfNum, TempSurfInTmp(SurfNum), TempSurfOutTmp(SurfNum));
+        }
+    }
+
     void GetCondFDInput()
     {
         // SUBROUTINE INFORMATION:
@@ -499,6 +535,8 @@ namespace HeatBalFiniteDiffManager {
                 MaterialFD(MaterNum).numTempCond = 3;
                 MaterialFD(MaterNum).TempCond.dimension(2, 3, -100.0);
             }
+            setupInterpolationGrid(MaterialFD(MaterNum).TempEnth, MaterialFD(MaterNum).TempEnthGrid);
+            setupInterpolationGrid(MaterialFD(MaterNum).TempCond, MaterialFD(MaterNum).TempCondGrid);
         }
 
         if (ErrorsFound) {
@@ -1031,6 +1069,42 @@ namespace HeatBalFiniteDiffManager {
         return s;
     }
 
+    bool hasLinearNodeEquations(int const Surf)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Determine whether the node equations of a surface are linear in the new node temperatures
+        // within a time step, so that they form a tridiagonal system that can be solved directly.
+
+        // METHODOLOGY EMPLOYED:
+        // The node equations are linear unless a layer has phase change or temperature dependent
+        // properties.  Interzone and adiabatic partitions couple the outside node to the inside
+        // node of another surface, which is not tridiagonal, so they are left to Gauss-Seidel.
+
+        auto const &surface(Surface(Surf));
+        if (surface.ExtBoundCond > 0) return false;
+
+        auto const &construct(Construct(surface.Construction));
+        for (int Lay = 1; Lay <= construct.TotLayers; ++Lay) {
+            int const MatLay(construct.LayerPoint(Lay));
+            auto const &mat(Material(MatLay));
+            auto const &matFD(MaterialFD(MatLay));
+            if (mat.phaseChange) return false;
+            if (matFD.tk1 != 0.0) return false;
+            auto const lTC(matFD.TempCond.index(2, 1));
+            if (matFD.TempCond[lTC] + matFD.TempCond[lTC + 1] + matFD.TempCond[lTC + 2] >= 0.0) return false;
+            auto const lTE(matFD.TempEnth.index(2, 1));
+            if (matFD.TempEnth[lTE] + matFD.TempEnth[lTE + 1] + matFD.TempEnth[lTE + 2] >= 0.0) return false;
+        }
+        return true;
+    }
+
     void CalcHeatBalFiniteDiff(int const Surf,        // Surface number
                                Real64 &TempSurfInTmp, // INSIDE SURFACE TEMPERATURE OF EACH HEAT TRANSFER SURF.
                                Real64 &TempSurfOutTmp // Outside Surface Temperature of each Heat Transfer Surface
@@ -1058,8 +1132,6 @@ namespace HeatBalFiniteDiffManager {
         // Using/Aliasing
         using DataHeatBalance::CondFDRelaxFactor;
 
-        static Real64 MaxDelTemp(0.0);
-
         int const ConstrNum(Surface(Surf).Construction);
 
         int const TotNodes(ConstructFD(ConstrNum).TotNodes);
@@ -1091,11 +1163,104 @@ namespace HeatBalFiniteDiffManager {
         int RoughIndexMovInsul; // roughness  Movable insulation
         Real64 AbsExt;          // exterior absorptivity  movable insulation
         EvalOutsideMovableInsulation(Surf, HMovInsul, RoughIndexMovInsul, AbsExt);
+
+        // Node equation of each node in the order of the Gauss-Seidel sweep, for the direct solution
+        bool const directSolve(DataSystemVariables::CondFDDirectSolve && hasLinearNodeEquations(Surf));
+        std::vector<std::pair<int, int>> nodeEqns; // (equation type, layer) of each node
+        if (directSolve) {
+            nodeEqns.reserve(TotNodes + 1);
+            for (int Lay = 1; Lay <= TotLayers; ++Lay) {
+                if (Lay == 1) nodeEqns.emplace_back(1, Lay);
+                if (TotNodes != 1) {
+                    for (int ctr = 2, ctr_end = ConstructFD(ConstrNum).NodeNumPoint(Lay); ctr <= ctr_end; ++ctr) {
+                        nodeEqns.emplace_back(2, Lay);
+                    }
+                }
+                if ((Lay < TotLayers) && (TotNodes != 1)) {
+                    nodeEqns.emplace_back(3, Lay);
+                } else if (Lay == TotLayers) {
+                    nodeEqns.emplace_back(4, Lay);
+                }
+            }
+        }
+        bool const useDirectSolve(directSolve && int(nodeEqns.size()) == TotNodes + 1);
+        auto nodeEqn = [&](int const i, int const GSiter) {
+            int const Lay(nodeEqns[i - 1].second);
+            switch (nodeEqns[i - 1].first) {
+            case 1:
+                ExteriorBCEqns(Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, TotNodes, HMovInsul);
+                break;
+            case 2:
+                InteriorNodeEqns(Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew);
+                break;
+            case 3:
+                IntInterfaceNodeEqns(Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, GSiter);
+                break;
+            default:
+                InteriorBCEqns(Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, TDreport);
+                break;
+            }
+        };
+
         // Start stepping through the slab with time.
         for (int J = 1, J_end = nint(TimeStepZoneSec / Delt); J <= J_end; ++J) { // PT testing higher time steps
 
-            int GSiter;                                       // iteration counter for implicit repeat calculation
-            for (GSiter = 1; GSiter <= MaxGSiter; ++GSiter) { //  Iterate implicit equations
+            int GSiter; // iteration counter for implicit repeat calculation
+            bool directSolved(false);
+            if (useDirectSolve) {
+                // Each node equation is affine in the new temperatures of the node and its two neighbors, so its
+                // coefficients are found by evaluating every node from the current temperatures, then again with
+                // every third node raised by one degree.  The resulting tridiagonal system is solved directly.
+                int const NumNodes(TotNodes + 1);
+                TDTLast = TDT;
+                Array1D<Real64> base(NumNodes);
+                Array2D<Real64> coef(3, NumNodes, 0.0); // (1) previous node, (2) the node itself, (3) next node
+                for (int color = -1; color <= 2; ++color) {
+                    for (int i = 1; i <= NumNodes; ++i) {
+                        TDT(i) = TDTLast(i) + (((color >= 0) && (i % 3 == color)) ? 1.0 : 0.0);
+                    }
+                    for (int i = 1; i <= NumNodes; ++i) {
+                        Real64 const TDT_i(TDT(i));
+                        nodeEqn(i, 1);
+                        if (color < 0) {
+                            base(i) = TDT(i);
+                        } else {
+                            for (int n = max(1, i - 1), n_end = min(NumNodes, i + 1); n <= n_end; ++n) {
+                                if (n % 3 == color) coef(n - i + 2, i) = TDT(i) - base(i);
+                            }
+                        }
+                        TDT(i) = TDT_i;
+                    }
+                }
+
+                // Thomas algorithm for (1 - self) T(i) - previous T(i-1) - next T(i+1) = constant
+                Array1D<Real64> upper(NumNodes);
+                Array1D<Real64> rhs(NumNodes);
+                for (int i = 1; i <= NumNodes; ++i) {
+                    Real64 constant(base(i));
+                    for (int n = max(1, i - 1), n_end = min(NumNodes, i + 1); n <= n_end; ++n) {
+                        constant -= coef(n - i + 2, i) * TDTLast(n);
+                    }
+                    Real64 const lower(i > 1 ? -coef(1, i) : 0.0);
+                    Real64 const diag((1.0 - coef(2, i)) - (i > 1 ? lower * upper(i - 1) : 0.0));
+                    upper(i) = (i < NumNodes ? -coef(3, i) : 0.0) / diag;
+                    rhs(i) = (constant - (i > 1 ? lower * rhs(i - 1) : 0.0)) / diag;
+                }
+                TDT(NumNodes) = rhs(NumNodes);
+                for (int i = NumNodes - 1; i >= 1; --i) {
+                    TDT(i) = rhs(i) - upper(i) * TDT(i + 1);
+                }
+
+                // One sweep from the solution sets the node outputs and confirms it; otherwise Gauss-Seidel continues from it
+                TDTLast = TDT;
+                EnthLast = EnthNew;
+                for (int i = 1; i <= NumNodes; ++i) {
+                    nodeEqn(i, 1);
+                }
+                directSolved = std::abs(sum_array_diff(TDT, TDTLast) / sum(TDT)) < 0.00001;
+            }
+
+            for (GSiter = 1; !directSolved && GSiter <= MaxGSiter; ++GSiter) { //  Iterate implicit equations
                 TDTLast = TDT;                                // Save last iteration's TDT (New temperature) values
                 EnthLast = EnthNew;                           // Last iterations new enthalpy value
 
@@ -1189,7 +1354,7 @@ namespace HeatBalFiniteDiffManager {
         CalcNodeHeatFlux(Surf, TotNodes);
 
         // Determine largest change in node temps
-        MaxDelTemp = 0.0;
+        Real64 MaxDelTemp(0.0);
         for (int NodeNum = 1; NodeNum <= TotNodes + 1; ++NodeNum) { // need to consider all nodes
             MaxDelTemp = max(std::abs(TDT(NodeNum) - TDreport(NodeNum)), MaxDelTemp);
         }
@@ -1369,6 +1534,83 @@ namespace HeatBalFiniteDiffManager {
         }
     }
 
+    void setupInterpolationGrid(Array2<Real64> const &a, InterpolationGrid &grid)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Build a uniform grid over the independent variable (row 1) of a temperature function table so
+        // the table segment containing a temperature can be found without searching the table.
+
+        // METHODOLOGY EMPLOYED:
+        // The grid spacing is the narrowest table segment, so each grid cell spans at most two segments.
+        // Each cell stores the last table point at or below its lower edge.  Tables whose temperatures
+        // are not strictly increasing (such as the unused -100 defaults) get no grid.
+
+        int const MaxGridCells(4096); // Limit on the grid size for tables with very narrow segments
+
+        grid.firstPoint.clear();
+        int const first(a.l2());
+        int const last(a.u2());
+        if (last <= first) return;
+        Real64 minWidth(a(1, last) - a(1, first));
+        for (int i = first + 1; i <= last; ++i) {
+            if (a(1, i) <= a(1, i - 1)) return;
+            minWidth = min(minWidth, a(1, i) - a(1, i - 1));
+        }
+        int const nCells(min(MaxGridCells, static_cast<int>(std::ceil((a(1, last) - a(1, first)) / minWidth))));
+        grid.xFirst = a(1, first);
+        grid.cellsPerUnit = nCells / (a(1, last) - a(1, first));
+        grid.firstPoint.resize(nCells);
+        int point(first);
+        for (int cell = 0; cell < nCells; ++cell) {
+            Real64 const edge(grid.xFirst + cell / grid.cellsPerUnit);
+            while ((point < last - 1) && (a(1, point + 1) <= edge)) {
+                ++point;
+            }
+            grid.firstPoint[cell] = point;
+        }
+    }
+
+    Real64 terpld(Array2<Real64> const &a, InterpolationGrid const &grid, Real64 const x1)
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Linear interpolation of the dependent variable (row 2) of a temperature function table at x1,
+        // giving the same result as terpld(a, x1, 1, 2) with the segment located from the grid.
+
+        if (grid.firstPoint.empty()) return terpld(a, x1, 1, 2);
+
+        int const first(a.l2());
+        int const last(a.u2());
+        if (x1 <= a(1, first)) return a(2, first);
+        if (x1 >= a(1, last)) return a(2, last);
+
+        int const nCells(static_cast<int>(grid.firstPoint.size()));
+        int const cell(min(nCells - 1, static_cast<int>((x1 - grid.xFirst) * grid.cellsPerUnit)));
+        int i(grid.firstPoint[cell]);
+        // The cell edge is rounded, so step to the last point at or below x1 either way
+        while ((i > first) && (x1 < a(1, i))) {
+            --i;
+        }
+        while (x1 >= a(1, i + 1)) {
+            ++i;
+        }
+        Real64 const fract((x1 - a(1, i)) / (a(1, i + 1) - a(1, i)));
+        return a(2, i) + fract * (a(2, i + 1) - a(2, i));
+    }
+
     void ExteriorBCEqns(int const Delt,                        // Time Increment
                         int const i,                           // Node Index
                         int const Lay,                         // Layer Number for Construction
@@ -1530,7 +1772,7 @@ namespace HeatBalFiniteDiffManager {
                     Real64 kt;
                     if (matFD_TempCond[lTC] + matFD_TempCond[lTC + 1] + matFD_TempCond[lTC + 2] >= 0.0) { // Multiple Linear Segment Function
                         // Use average temp of surface and first node for k
-                        kt = terpld(matFD_TempCond, (TDT_i + TDT_p) / 2.0, 1, 2); // 1: Temperature, 2: Thermal conductivity
+                        kt = terpld(matFD_TempCond, matFD.TempCondGrid, (TDT_i + TDT_p) / 2.0); // 1: Temperature, 2: Thermal conductivity
                     } else {
                         kt = mat.Conductivity;       // 20C base conductivity
                         Real64 const kt1(matFD.tk1); // linear coefficient (normally zero)
@@ -1552,8 +1794,8 @@ namespace HeatBalFiniteDiffManager {
                     } else if (matFD_TempEnth[lTE] + matFD_TempEnth[lTE + 1] + matFD_TempEnth[lTE + 2] >=
                                0.0) { // Phase change material: Use TempEnth data to generate Cp
                         // Enthalpy function used to get average specific heat. Updated by GS so enthalpy function is followed.
-                        EnthOld(i) = terpld(matFD_TempEnth, TD_i, 1, 2);  // 1: Temperature, 2: Enthalpy
-                        EnthNew(i) = terpld(matFD_TempEnth, TDT_i, 1, 2); // 1: Temperature, 2: Enthalpy
+                        EnthOld(i) = terpld(matFD_TempEnth, matFD.TempEnthGrid, TD_i);  // 1: Temperature, 2: Enthalpy
+                        EnthNew(i) = terpld(matFD_TempEnth, matFD.TempEnthGrid, TDT_i); // 1: Temperature, 2: Enthalpy
                         if (EnthNew(i) != EnthOld(i)) {
                             Cp = max(Cpo, (EnthNew(i) - EnthOld(i)) / (TDT_i - TD_i));
                         }
@@ -1682,8 +1924,8 @@ namespace HeatBalFiniteDiffManager {
         Real64 ktA1; // Variable Outer Thermal conductivity in temperature equation
         Real64 ktA2; // Thermal Inner conductivity in temperature equation
         if (matFD_TempCond[lTC] + matFD_TempCond[lTC + 1] + matFD_TempCond[lTC + 2] >= 0.0) { // Multiple Linear Segment Function
-            ktA1 = terpld(matFD.TempCond, TDT_ip, 1, 2);                                      // 1: Temperature, 2: Thermal conductivity
-            ktA2 = terpld(matFD.TempCond, TDT_mi, 1, 2);                                      // 1: Temperature, 2: Thermal conductivity
+            ktA1 = terpld(matFD.TempCond, matFD.TempCondGrid, TDT_ip); // 1: Temperature, 2: Thermal conductivity
+            ktA2 = terpld(matFD.TempCond, matFD.TempCondGrid, TDT_mi); // 1: Temperature, 2: Thermal conductivity
         } else {
             ktA1 = ktA2 = mat.Conductivity; // 20C base conductivity
             Real64 const kt1(matFD.tk1);    // temperature coefficient for simple temp dep k. // linear coefficient (normally zero)
@@ -1705,8 +1947,8 @@ namespace HeatBalFiniteDiffManager {
             ktA1 = mat.phaseChange->getConductivity(TDT_ip);
             ktA2 = mat.phaseChange->getConductivity(TDT_mi);
         } else if (matFD_TempEnth[lTE] + matFD_TempEnth[lTE + 1] + matFD_TempEnth[lTE + 2] >= 0.0) { // Phase change material: Use TempEnth data
-            EnthOld(i) = terpld(matFD_TempEnth, TD_i, 1, 2);                                         // 1: Temperature, 2: Enthalpy
-            EnthNew(i) = terpld(matFD_TempEnth, TDT_i, 1, 2);                                        // 1: Temperature, 2: Enthalpy
+            EnthOld(i) = terpld(matFD_TempEnth, matFD.TempEnthGrid, TD_i);  // 1: Temperature, 2: Enthalpy
+            EnthNew(i) = terpld(matFD_TempEnth, matFD.TempEnthGrid, TDT_i); // 1: Temperature, 2: Enthalpy
             if (EnthNew(i) != EnthOld(i)) {
                 Cp = max(Cpo, (EnthNew(i) - EnthOld(i)) / (TDT_i - TD_i));
             }
@@ -1803,7 +2045,7 @@ namespace HeatBalFiniteDiffManager {
                     assert(matFD_TempCond.u2() >= 3);
                     auto const lTC(matFD_TempCond.index(2, 1));
                     if (matFD_TempCond[lTC] + matFD_TempCond[lTC + 1] + matFD_TempCond[lTC + 2] >= 0.0) { // Multiple Linear Segment Function
-                        kt1 = terpld(matFD.TempCond, (TDT_i + TDT_m) / 2.0, 1, 2);                        // 1: Temperature, 2: Thermal conductivity
+                        kt1 = terpld(matFD.TempCond, matFD.TempCondGrid, (TDT_i + TDT_m) / 2.0); // 1: Temperature, 2: Thermal conductivity
                     } else {
                         kt1 = mat.Conductivity;       // 20C base conductivity
                         Real64 const kt11(matFD.tk1); // temperature coefficient for simple temp dep k. // linear coefficient (normally zero)
@@ -1817,7 +2059,7 @@ namespace HeatBalFiniteDiffManager {
                     assert(matFD2_TempCond.u2() >= 3);
                     auto const lTC2(matFD2_TempCond.index(2, 1));
                     if (matFD2_TempCond[lTC2] + matFD2_TempCond[lTC2 + 1] + matFD2_TempCond[lTC2 + 2] >= 0.0) { // Multiple Linear Segment Function
-                        kt2 = terpld(matFD2_TempCond, (TDT_i + TDT_p) / 2.0, 1, 2); // 1: Temperature, 2: Thermal conductivity
+                        kt2 = terpld(matFD2_TempCond, matFD2.TempCondGrid, (TDT_i + TDT_p) / 2.0); // 1: Temperature, 2: Thermal conductivity
                     } else {
                         kt2 = mat2.Conductivity;       // 20C base conductivity
                         Real64 const kt21(matFD2.tk1); // temperature coefficient for simple temp dep k. // linear coefficient (normally zero)
@@ -1863,8 +2105,8 @@ namespace HeatBalFiniteDiffManager {
                     if (mat2.phaseChange) {
                         adjustPropertiesForPhaseChange(i, Surf, mat2, TD_i, TDT_i, Cp2, RhoS2, kt2);
                     } else if ((matFD_sum < 0.0) && (matFD2_sum > 0.0)) {            // Phase change material Layer2, Use TempEnth Data
-                        Real64 const Enth2Old(terpld(matFD2_TempEnth, TD_i, 1, 2));  // 1: Temperature, 2: Thermal conductivity
-                        Real64 const Enth2New(terpld(matFD2_TempEnth, TDT_i, 1, 2)); // 1: Temperature, 2: Thermal conductivity
+                        Real64 const Enth2Old(terpld(matFD2_TempEnth, matFD2.TempEnthGrid, TD_i));  // 1: Temperature, 2: Thermal conductivity
+                        Real64 const Enth2New(terpld(matFD2_TempEnth, matFD2.TempEnthGrid, TDT_i)); // 1: Temperature, 2: Thermal conductivity
                         EnthNew(i) = Enth2New; // This node really doesn't have an enthalpy, this gives it a value
                         if ((std::abs(Enth2New - Enth2Old) > smalldiff) && (std::abs(TDT_i - TD_i) > smalldiff)) {
                             Cp2 = max(Cpo2, (Enth2New - Enth2Old) / (TDT_i - TD_i));
@@ -1901,8 +2143,8 @@ namespace HeatBalFiniteDiffManager {
                     if (mat.phaseChange) {
                         adjustPropertiesForPhaseChange(i, Surf, mat, TD_i, TDT_i, Cp1, RhoS1, kt1);
                     } else if ((matFD_sum > 0.0) && (matFD2_sum < 0.0)) {           // Phase change material Layer1, Use TempEnth Data
-                        Real64 const Enth1Old(terpld(matFD_TempEnth, TD_i, 1, 2));  // 1: Temperature, 2: Thermal conductivity
-                        Real64 const Enth1New(terpld(matFD_TempEnth, TDT_i, 1, 2)); // 1: Temperature, 2: Thermal conductivity
+                        Real64 const Enth1Old(terpld(matFD_TempEnth, matFD.TempEnthGrid, TD_i));  // 1: Temperature, 2: Thermal conductivity
+                        Real64 const Enth1New(terpld(matFD_TempEnth, matFD.TempEnthGrid, TDT_i)); // 1: Temperature, 2: Thermal conductivity
                         EnthNew(i) = Enth1New; // This node really doesn't have an enthalpy, this gives it a value
                         if ((std::abs(Enth1New - Enth1Old) > smalldiff) && (std::abs(TDT_i - TD_i) > smalldiff)) {
                             Cp1 = max(Cpo1, (Enth1New - Enth1Old) / (TDT_i - TD_i));
@@ -1937,10 +2179,10 @@ namespace HeatBalFiniteDiffManager {
                     // Consider the various PCM material location cases
                     if ((matFD_sum > 0.0) && (matFD2_sum > 0.0)) { // Phase change material both layers, Use TempEnth Data
 
-                        Real64 const Enth1Old(terpld(matFD_TempEnth, TD_i, 1, 2));   // 1: Temperature, 2: Thermal conductivity
-                        Real64 const Enth2Old(terpld(matFD2_TempEnth, TD_i, 1, 2));  // 1: Temperature, 2: Thermal conductivity
-                        Real64 const Enth1New(terpld(matFD_TempEnth, TDT_i, 1, 2));  // 1: Temperature, 2: Thermal conductivity
-                        Real64 const Enth2New(terpld(matFD2_TempEnth, TDT_i, 1, 2)); // 1: Temperature, 2: Thermal conductivity
+                        Real64 const Enth1Old(terpld(matFD_TempEnth, matFD.TempEnthGrid, TD_i));    // 1: Temperature, 2: Thermal conductivity
+                        Real64 const Enth2Old(terpld(matFD2_TempEnth, matFD2.TempEnthGrid, TD_i));  // 1: Temperature, 2: Thermal conductivity
+                        Real64 const Enth1New(terpld(matFD_TempEnth, matFD.TempEnthGrid, TDT_i));   // 1: Temperature, 2: Thermal conductivity
+                        Real64 const Enth2New(terpld(matFD2_TempEnth, matFD2.TempEnthGrid, TDT_i)); // 1: Temperature, 2: Thermal conductivity
 
                         EnthNew(i) = Enth1New; // This node really doesn't have an enthalpy, this gives it a value
 
@@ -1956,8 +2198,8 @@ namespace HeatBalFiniteDiffManager {
 
                     } else if ((matFD_sum > 0.0) && (matFD2_sum < 0.0)) { // Phase change material Layer1, Use TempEnth Data
 
-                        Real64 const Enth1Old(terpld(matFD_TempEnth, TD_i, 1, 2));  // 1: Temperature, 2: Thermal conductivity
-                        Real64 const Enth1New(terpld(matFD_TempEnth, TDT_i, 1, 2)); // 1: Temperature, 2: Thermal conductivity
+                        Real64 const Enth1Old(terpld(matFD_TempEnth, matFD.TempEnthGrid, TD_i));  // 1: Temperature, 2: Thermal conductivity
+                        Real64 const Enth1New(terpld(matFD_TempEnth, matFD.TempEnthGrid, TDT_i)); // 1: Temperature, 2: Thermal conductivity
                         EnthNew(i) = Enth1New; // This node really doesn't have an enthalpy, this gives it a value
 
                         if ((std::abs(Enth1New - Enth1Old) > smalldiff) && (std::abs(TDT_i - TD_i) > smalldiff)) {
@@ -1966,8 +2208,8 @@ namespace HeatBalFiniteDiffManager {
 
                     } else if ((matFD_sum < 0.0) && (matFD2_sum > 0.0)) { // Phase change material Layer2, Use TempEnth Data
 
-                        Real64 const Enth2Old(terpld(matFD2_TempEnth, TD_i, 1, 2));  // 1: Temperature, 2: Thermal conductivity
-                        Real64 const Enth2New(terpld(matFD2_TempEnth, TDT_i, 1, 2)); // 1: Temperature, 2: Thermal conductivity
+                        Real64 const Enth2Old(terpld(matFD2_TempEnth, matFD2.TempEnthGrid, TD_i));  // 1: Temperature, 2: Thermal conductivity
+                        Real64 const Enth2New(terpld(matFD2_TempEnth, matFD2.TempEnthGrid, TDT_i)); // 1: Temperature, 2: Thermal conductivity
                         EnthNew(i) = Enth2New; // This node really doesn't have an enthalpy, this gives it a value
 
                         if ((std::abs(Enth2New - Enth2Old) > smalldiff) && (std::abs(TDT_i - TD_i) > smalldiff)) {
@@ -2125,7 +2367,7 @@ namespace HeatBalFiniteDiffManager {
                 Real64 kt;
                 if (matFD_TempCond[lTC] + matFD_TempCond[lTC + 1] + matFD_TempCond[lTC + 2] >= 0.0) { // Multiple Linear Segment Function
                     // Use average of surface and first node temp for determining k
-                    kt = terpld(matFD_TempCond, (TDT_i + TDT_m) / 2.0, 1, 2); // 1: Temperature, 2: Thermal conductivity
+                    kt = terpld(matFD_TempCond, matFD.TempCondGrid, (TDT_i + TDT_m) / 2.0); // 1: Temperature, 2: Thermal conductivity
                 } else {
                     kt = mat.Conductivity;       // 20C base conductivity
                     Real64 const kt1(matFD.tk1); // linear coefficient (normally zero)
@@ -2143,8 +2385,8 @@ namespace HeatBalFiniteDiffManager {
                     adjustPropertiesForPhaseChange(i, Surf, mat, TD_i, TDT_i, Cp, RhoS, kt);
                 } else if (matFD_TempEnth[lTE] + matFD_TempEnth[lTE + 1] + matFD_TempEnth[lTE + 2] >=
                            0.0) {                                     // Phase change material: Use TempEnth data
-                    EnthOld(i) = terpld(matFD_TempEnth, TD_i, 1, 2);  // 1: Temperature, 2: Enthalpy
-                    EnthNew(i) = terpld(matFD_TempEnth, TDT_i, 1, 2); // 1: Temperature, 2: Enthalpy
+                    EnthOld(i) = terpld(matFD_TempEnth, matFD.TempEnthGrid, TD_i);  // 1: Temperature, 2: Enthalpy
+                    EnthNew(i) = terpld(matFD_TempEnth, matFD.TempEnthGrid, TDT_i); // 1: Temperature, 2: Enthalpy
                     if ((std::abs(EnthNew(i) - EnthOld(i)) > smalldiff) && (std::abs(TDT_i - TD_i) > smalldiff)) {
                         Cp = max(Cpo, (EnthNew(i) - EnthOld(i)) / (TDT_i - TD_i));
                     }
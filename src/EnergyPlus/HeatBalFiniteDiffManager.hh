@@ -48,6 +48,9 @@
 #ifndef HeatBalFiniteDiffManager_hh_INCLUDED
 #define HeatBalFiniteDiffManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array2D.hh>
@@ -158,6 +161,19 @@ namespace HeatBalFiniteDiffManager {
         }
     };
 
+    struct InterpolationGrid
+    {
+        // Members
+        Real64 xFirst;               // Independent variable of the first table point
+        Real64 cellsPerUnit;         // Grid cells per unit of the independent variable
+        std::vector<int> firstPoint; // Last table point at or below the lower edge of each grid cell (empty if no grid)
+
+        // Default Constructor
+        InterpolationGrid() : xFirst(0.0), cellsPerUnit(0.0)
+        {
+        }
+    };
+
     struct MaterialDataFD
     {
         // Members
@@ -170,6 +186,8 @@ namespace HeatBalFiniteDiffManager {
         Array2D<Real64> TempCond; // Temperature thermal conductivity Function Pairs,
         //  TempCond(1,1)= first Temp, Tempcond(1,2) = First conductivity,
         //  TempEnth(2,1) = secomd Temp, etc.
+        InterpolationGrid TempEnthGrid; // Uniform temperature grid for locating the TempEnth segment
+        InterpolationGrid TempCondGrid; // Uniform temperature grid for locating the TempCond segment
 
         // Default Constructor
         MaterialDataFD() : tk1(0.0), numTempEnth(0), numTempCond(0)
@@ -192,12 +210,19 @@ namespace HeatBalFiniteDiffManager {
                                  Real64 &TempSurfOutTmp // Outside Surface Temperature of each Heat Transfer Surface
     );
 
+    void ManageHeatBalFiniteDiffSurfaces(std::vector<int> const &SurfNums, // Surfaces to solve
+                                         Array1D<Real64> &TempSurfInTmp,   // Inside surface temperature of each surface
+                                         Array1D<Real64> &TempSurfOutTmp   // Outside surface temperature of each surface
+    );
+
     void GetCondFDInput();
 
     void InitHeatBalFiniteDiff();
 
     void InitialInitHeatBalFiniteDiff();
 
+    bool hasLinearNodeEquations(int const Surf);
+
     void CalcHeatBalFiniteDiff(int const Surf,
                                Real64 &TempSurfInTmp, // INSIDE SURFACE TEMPERATURE OF EACH HEAT TRANSFER SURF.
                                Real64 &TempSurfOutTmp // Outside Surface Temperature of each Heat Transfer Surface
@@ -211,6 +236,10 @@ namespace HeatBalFiniteDiffManager {
 
     Real64 terpld(Array2<Real64> const &a, Real64 const x1, int const nind, int const ndep);
 
+    void setupInterpolationGrid(Array2<Real64> const &a, InterpolationGrid &grid);
+
+    Real64 terpld(Array2<Real64> const &a, InterpolationGrid const &grid, Real64 const x1);
+
     void ExteriorBCEqns(int const Delt,             // Time Increment
                         int const i,                // Node Index
                         int const Lay,              // Layer Number for Construction
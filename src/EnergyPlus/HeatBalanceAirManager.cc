@@ -398,7 +398,6 @@ namespace HeatBalanceAirManager {
 
         int i;
         int Loop;
-        int Loop1;
         Array1D_bool RepVarSet;
         bool IsNotOK;
 
@@ -414,7 +413,8 @@ namespace HeatBalanceAirManager {
         int ZLItem;
         Array1D<Real64> TotInfilVentFlow;
         Array1D<Real64> TotMixingFlow;
-        Array1D<Real64> ZoneMixingNum;
+        Array1D_int ZoneMixingNum;    // number of source zone mixing objects filled so far for each zone
+        Array1D_int ZoneReceivingNum; // number of receiving zone mixing objects filled so far for each zone
         int ConnectTest;
         int ConnectionNumber;
         int NumbNum;
@@ -425,7 +425,6 @@ namespace HeatBalanceAirManager {
         int ZoneNumB;
         int SourceCount;
         int ReceivingCount;
-        int IsSourceZone;
 
         // Formats
         static ObjexxFCL::gio::Fmt Format_720("(' ',A,' Airflow Stats Nominal, ',A,',',A,',',A,',',A,',',A,',')");
@@ -2662,61 +2661,39 @@ namespace HeatBalanceAirManager {
 
         // added by BAN, 02/14
         if (TotMixing > 0) {
-            ZoneMixingNum.allocate(TotMixing);
-            // get source zones mixing objects index
+            // count the mixing objects each zone serves as a source or receiving zone, then fill the per zone index
+            // lists in a single pass over the mixing objects so the zone to mixing map is built once in input order
             for (ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum) {
-                SourceCount = 0;
-                for (Loop = 1; Loop <= TotMixing; ++Loop) {
-                    if (ZoneNum == Mixing(Loop).FromZone) {
-                        SourceCount += 1;
-                        ZoneMixingNum(SourceCount) = Loop;
-                    }
-                }
-                // save mixing objects index for zones which serve as a source zone
-                MassConservation(ZoneNum).NumSourceZonesMixingObject = SourceCount;
-                if (SourceCount > 0) {
-                    MassConservation(ZoneNum).ZoneMixingSourcesPtr.allocate(SourceCount);
-                    for (Loop = 1; Loop <= SourceCount; ++Loop) {
-                        MassConservation(ZoneNum).ZoneMixingSourcesPtr(Loop) = ZoneMixingNum(Loop);
-                    }
-                }
+                MassConservation(ZoneNum).NumSourceZonesMixingObject = 0;
+                MassConservation(ZoneNum).NumReceivingZonesMixingObject = 0;
             }
-
-            // check zones which are used only as a source zones
-            for (ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum) {
-                IsSourceZone = false;
-                for (Loop = 1; Loop <= TotMixing; ++Loop) {
-                    if (ZoneNum != Mixing(Loop).FromZone) continue;
-                    MassConservation(ZoneNum).IsOnlySourceZone = true;
-                    for (Loop1 = 1; Loop1 <= TotMixing; ++Loop1) {
-                        if (ZoneNum == Mixing(Loop1).ZonePtr) {
-                            MassConservation(ZoneNum).IsOnlySourceZone = false;
-                            break;
-                        }
-                    }
-                }
+            for (Loop = 1; Loop <= TotMixing; ++Loop) {
+                if (Mixing(Loop).FromZone > 0) ++MassConservation(Mixing(Loop).FromZone).NumSourceZonesMixingObject;
+                if (Mixing(Loop).ZonePtr > 0) ++MassConservation(Mixing(Loop).ZonePtr).NumReceivingZonesMixingObject;
             }
-            // get receiving zones mixing objects index
-            ZoneMixingNum = 0;
             for (ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum) {
-                ReceivingCount = 0;
-                for (Loop = 1; Loop <= TotMixing; ++Loop) {
-                    if (ZoneNum == Mixing(Loop).ZonePtr) {
-                        ReceivingCount += 1;
-                        ZoneMixingNum(ReceivingCount) = Loop;
-                    }
-                }
+                SourceCount = MassConservation(ZoneNum).NumSourceZonesMixingObject;
+                ReceivingCount = MassConservation(ZoneNum).NumReceivingZonesMixingObject;
+                // save mixing objects index for zones which serve as a source zone
+                if (SourceCount > 0) MassConservation(ZoneNum).ZoneMixingSourcesPtr.allocate(SourceCount);
                 // save mixing objects index for zones which serve as a receiving zone
-                MassConservation(ZoneNum).NumReceivingZonesMixingObject = ReceivingCount;
                 if (ReceivingCount > 0) {
                     MassConservation(ZoneNum).ZoneMixingReceivingPtr.allocate(ReceivingCount);
                     MassConservation(ZoneNum).ZoneMixingReceivingFr.allocate(ReceivingCount);
-                    for (Loop = 1; Loop <= ReceivingCount; ++Loop) {
-                        MassConservation(ZoneNum).ZoneMixingReceivingPtr(Loop) = ZoneMixingNum(Loop);
-                    }
                 }
+                // check zones which are used only as a source zones
+                MassConservation(ZoneNum).IsOnlySourceZone = (SourceCount > 0 && ReceivingCount == 0);
+            }
+            ZoneMixingNum.dimension(NumOfZones, 0);
+            ZoneReceivingNum.dimension(NumOfZones, 0);
+            for (Loop = 1; Loop <= TotMixing; ++Loop) {
+                ZoneNum = Mixing(Loop).FromZone;
+                if (ZoneNum > 0) MassConservation(ZoneNum).ZoneMixingSourcesPtr(++ZoneMixingNum(ZoneNum)) = Loop;
+                ZoneNum = Mixing(Loop).ZonePtr;
+                if (ZoneNum > 0) MassConservation(ZoneNum).ZoneMixingReceivingPtr(++ZoneReceivingNum(ZoneNum)) = Loop;
             }
-            if (allocated(ZoneMixingNum)) ZoneMixingNum.deallocate();
+            ZoneMixingNum.deallocate();
+            ZoneReceivingNum.deallocate();
         }
 
         // zone mass conservation calculation order starts with receiving zones
@@ -62,6 +62,7 @@
 #include <DataHeatBalance.hh>
 #include <DataMoistureBalance.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <HeatBalanceHAMTManager.hh>
@@ -235,6 +236,35 @@ namespace HeatBalanceHAMTManager {
         CalcHeatBalHAMT(SurfNum, TempSurfInTmp, TempSurfOutTmp);
     }
 
+    void ManageHeatBalHAMTSurfaces(std::vector<int> const &SurfNums, Array1D<Real64> &TempSurfInTmp, Array1D<Real64> &TempSurfOutTmp)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Solves a batch of HAMT surfaces for the current inside heat balance iteration in parallel.
+
+        // METHODOLOGY EMPLOYED:
+        // The first surface goes through ManageHeatBalHAMT so the model is initialised before threading.
+        // Each surface only updates its own cells, and the error messages are serialised.
+
+        if (SurfNums.empty()) return;
+        ManageHeatBalHAMT(SurfNums[0], TempSurfInTmp(SurfNums[0]), TempSurfOutTmp(SurfNums[0]));
+
+        int const nSurfs(static_cast<int>(SurfNums.size()));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(DataSystemVariables::NumberIntRadThreads) if (nSurfs > 2)
+#endif
+        for (int iSurf = 1; iSurf < nSurfs; ++iSurf) {
+            int const SurfNum(SurfNums[iSurf]);
+            CalcHeatBalHAMT(SurfNum, TempSurfInTmp(SurfNum), TempSurfOutTmp(SurfNum));
+        }
+    }
+
     void GetHeatBalHAMTInput()
     {
 
@@ -1355,11 +1385,16 @@ namespace HeatBalanceHAMTManager {
                 }
                 if (std::abs(qvp) > qvplim) {
                     if (!WarmupFlag) {
-                        ++qvpErrCount;
-                        if (qvpErrCount < 16) {
-                            ShowWarningError("HeatAndMoistureTransfer: Large Latent Heat for Surface " + Surface(sid).Name);
-                        } else {
-                            ShowRecurringWarningErrorAtEnd("HeatAndMoistureTransfer: Large Latent Heat Errors ", qvpErrReport);
+#ifdef _OPENMP
+#pragma omp critical(HAMTMessages)
+#endif
+                        {
+                            ++qvpErrCount;
+                            if (qvpErrCount < 16) {
+                                ShowWarningError("HeatAndMoistureTransfer: Large Latent Heat for Surface " + Surface(sid).Name);
+                            } else {
+                                ShowRecurringWarningErrorAtEnd("HeatAndMoistureTransfer: Large Latent Heat Errors ", qvpErrReport);
+                            }
                         }
                     }
                     qvp = 0.0;
@@ -1369,55 +1404,59 @@ namespace HeatBalanceHAMTManager {
                 cells(cid).tempp1 = (torsum + qvp + cells(cid).Qadds + (tcap * cells(cid).temp / deltat)) / (oorsum + (tcap / deltat));
             }
 
-            // Check for silly temperatures
-            tempmax = maxval(cells, &subcell::tempp1);
-            tempmin = minval(cells, &subcell::tempp1);
-            if (tempmax > MaxSurfaceTempLimit) {
-                if (!WarmupFlag) {
-                    if (Surface(sid).HighTempErrCount == 0) {
-                        ShowSevereMessage("HAMT: Temperature (high) out of bounds (" + RoundSigDigits(tempmax, 2) +
-                                          ") for surface=" + Surface(sid).Name);
+            // Check for silly temperatures of this surface's cells
+            tempmax = cells(Extcell(sid)).tempp1;
+            tempmin = cells(Extcell(sid)).tempp1;
+            for (cid = Extcell(sid) + 1; cid <= Intcell(sid); ++cid) {
+                tempmax = max(tempmax, cells(cid).tempp1);
+                tempmin = min(tempmin, cells(cid).tempp1);
+            }
+            // Surfaces may be solved in parallel (see ManageHeatBalHAMTSurfaces), so the lock is only taken to report
+            if ((tempmax > MaxSurfaceTempLimit || tempmin < MinSurfaceTempLimit) && !WarmupFlag) {
+#ifdef _OPENMP
+#pragma omp critical(HAMTMessages)
+#endif
+                {
+                    if (tempmax > MaxSurfaceTempLimit) {
+                        if (Surface(sid).HighTempErrCount == 0) {
+                            ShowSevereMessage("HAMT: Temperature (high) out of bounds (" + RoundSigDigits(tempmax, 2) +
+                                              ") for surface=" + Surface(sid).Name);
+                            ShowContinueErrorTimeStamp("");
+                        }
+                        ShowRecurringWarningErrorAtEnd("HAMT: Temperature Temperature (high) out of bounds; Surface=" + Surface(sid).Name,
+                                                       Surface(sid).HighTempErrCount,
+                                                       tempmax,
+                                                       tempmax,
+                                                       _,
+                                                       "C",
+                                                       "C");
+                    }
+                    if (tempmax > MaxSurfaceTempLimitBeforeFatal) {
+                        ShowSevereError("HAMT: HAMT: Temperature (high) out of bounds ( " + RoundSigDigits(tempmax, 2) +
+                                        ") for surface=" + Surface(sid).Name);
                         ShowContinueErrorTimeStamp("");
+                        ShowFatalError("Program terminates due to preceding condition.");
                     }
-                    ShowRecurringWarningErrorAtEnd("HAMT: Temperature Temperature (high) out of bounds; Surface=" + Surface(sid).Name,
-                                                   Surface(sid).HighTempErrCount,
-                                                   tempmax,
-                                                   tempmax,
-                                                   _,
-                                                   "C",
-                                                   "C");
-                }
-            }
-            if (tempmax > MaxSurfaceTempLimitBeforeFatal) {
-                if (!WarmupFlag) {
-                    ShowSevereError("HAMT: HAMT: Temperature (high) out of bounds ( " + RoundSigDigits(tempmax, 2) +
-                                    ") for surface=" + Surface(sid).Name);
-                    ShowContinueErrorTimeStamp("");
-                    ShowFatalError("Program terminates due to preceding condition.");
-                }
-            }
-            if (tempmin < MinSurfaceTempLimit) {
-                if (!WarmupFlag) {
-                    if (Surface(sid).HighTempErrCount == 0) {
-                        ShowSevereMessage("HAMT: Temperature (low) out of bounds (" + RoundSigDigits(tempmin, 2) +
-                                          ") for surface=" + Surface(sid).Name);
+                    if (tempmin < MinSurfaceTempLimit) {
+                        if (Surface(sid).HighTempErrCount == 0) {
+                            ShowSevereMessage("HAMT: Temperature (low) out of bounds (" + RoundSigDigits(tempmin, 2) +
+                                              ") for surface=" + Surface(sid).Name);
+                            ShowContinueErrorTimeStamp("");
+                        }
+                        ShowRecurringWarningErrorAtEnd("HAMT: Temperature Temperature (high) out of bounds; Surface=" + Surface(sid).Name,
+                                                       Surface(sid).HighTempErrCount,
+                                                       tempmin,
+                                                       tempmin,
+                                                       _,
+                                                       "C",
+                                                       "C");
+                    }
+                    if (tempmin < MinSurfaceTempLimitBeforeFatal) {
+                        ShowSevereError("HAMT: HAMT: Temperature (low) out of bounds ( " + RoundSigDigits(tempmin, 2) +
+                                        ") for surface=" + Surface(sid).Name);
                         ShowContinueErrorTimeStamp("");
+                        ShowFatalError("Program terminates due to preceding condition.");
                     }
-                    ShowRecurringWarningErrorAtEnd("HAMT: Temperature Temperature (high) out of bounds; Surface=" + Surface(sid).Name,
-                                                   Surface(sid).HighTempErrCount,
-                                                   tempmin,
-                                                   tempmin,
-                                                   _,
-                                                   "C",
-                                                   "C");
-                }
-            }
-            if (tempmin < MinSurfaceTempLimitBeforeFatal) {
-                if (!WarmupFlag) {
-                    ShowSevereError("HAMT: HAMT: Temperature (low) out of bounds ( " + RoundSigDigits(tempmin, 2) +
-                                    ") for surface=" + Surface(sid).Name);
-                    ShowContinueErrorTimeStamp("");
-                    ShowFatalError("Program terminates due to preceding condition.");
                 }
             }
 
@@ -48,6 +48,9 @@
 #ifndef HeatBalanceHAMTManager_hh_INCLUDED
 #define HeatBalanceHAMTManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -158,6 +161,8 @@ namespace HeatBalanceHAMTManager {
 
     void ManageHeatBalHAMT(int const SurfNum, Real64 &TempSurfInTmp, Real64 &TempSurfOutTmp);
 
+    void ManageHeatBalHAMTSurfaces(std::vector<int> const &SurfNums, Array1D<Real64> &TempSurfInTmp, Array1D<Real64> &TempSurfOutTmp);
+
     void GetHeatBalHAMTInput();
 
     void InitHeatBalHAMT();
@@ -56,6 +56,7 @@
 #include <ObjexxFCL/gio.hh>
 
 // EnergyPlus Headers
+#include <ArrayView.hh>
 #include <DataEnvironment.hh>
 #include <DataGlobals.hh>
 #include <DataHeatBalance.hh>
@@ -131,6 +132,7 @@ namespace HeatBalanceIntRadExchange {
     // MODULE VARIABLE DECLARATIONS:
     int MaxNumOfZoneSurfaces(0); // Max saved to get large enough space for user input view factors
     namespace {
+        int const MinSurfacesForSurfaceThreads(100); // Zones with fewer surfaces are not split over threads
         bool CalcInteriorRadExchangefirstTime(true); // Logical flag for one-time initializations
     }
     // SUBROUTINE SPECIFICATIONS FOR MODULE HeatBalanceIntRadExchange
@@ -181,14 +183,6 @@ namespace HeatBalanceIntRadExchange {
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-        int RecSurfNum;  // Counter within DO loop (refers to main surface derived type index) RECEIVING SURFACE
-        int SendSurfNum; // Counter within DO loop (refers to main surface derived type index) SENDING SURFACE
-
-        int ConstrNumRec;                  // Receiving surface construction number
-        int ConstrNumSend;                 // Sending surface construction number
-        Real64 RecSurfTemp;                // Receiving surface temperature (C)
-        Real64 SendSurfTemp;               // Sending surface temperature (C)
-        Real64 RecSurfEmiss;               // Inside surface emissivity
         int SurfNum;                       // Surface number
         int ConstrNum;                     // Construction number
         bool IntShadeOrBlindStatusChanged; // True if status of interior shade or blind on at least
@@ -196,9 +190,10 @@ namespace HeatBalanceIntRadExchange {
         int ShadeFlag;     // Window shading status current time step
         int ShadeFlagPrev; // Window shading status previous time step
 
+#ifndef EP_HBIRE_SEQ
         // variables added as part of strategy to reduce calculation time - Glazer 2011-04-22
-        Real64 RecSurfTempInKTo4th; // Receiving surface temperature in K to 4th power
         static Array1D<Real64> SendSurfaceTempInKto4thPrecalc;
+#endif
 
         // FLOW:
 
@@ -207,15 +202,17 @@ namespace HeatBalanceIntRadExchange {
 #endif
         if (CalcInteriorRadExchangefirstTime) {
             InitInteriorRadExchange();
-#ifdef EP_HBIRE_SEQ
-            SendSurfaceTempInKto4thPrecalc.allocate(MaxNumOfZoneSurfaces);
-#else
+#ifndef EP_HBIRE_SEQ
             SendSurfaceTempInKto4thPrecalc.allocate(TotSurfaces);
 #endif
             CalcInteriorRadExchangefirstTime = false;
             if (DeveloperFlag) {
                 std::string tdstring;
-                ObjexxFCL::gio::write(tdstring, fmtLD) << " OMP turned off, HBIRE loop executed in serial";
+                if (NumberIntRadThreads > 1) {
+                    ObjexxFCL::gio::write(tdstring, fmtLD) << " HBIRE loop executed with threads=" << NumberIntRadThreads;
+                } else {
+                    ObjexxFCL::gio::write(tdstring, fmtLD) << " HBIRE loop executed in serial";
+                }
                 DisplayString(tdstring);
             }
         }
@@ -241,7 +238,6 @@ namespace HeatBalanceIntRadExchange {
         }
 #endif
 
-        ConstrNumRec = 0;
         if (PartialResimulate) {
             auto const &zone(Zone(ZoneToResimulate));
             NetLWRadToSurf({zone.SurfaceFirst, zone.SurfaceLast}) = 0.0;
@@ -253,16 +249,20 @@ namespace HeatBalanceIntRadExchange {
                 e.IRfromParentZone = 0.0;
         }
 
-        for (int ZoneNum = (PartialResimulate ? ZoneToResimulate() : 1), ZoneNum_end = (PartialResimulate ? ZoneToResimulate() : NumOfZones);
-             ZoneNum <= ZoneNum_end;
-             ++ZoneNum) {
+        int const FirstZone(PartialResimulate ? ZoneToResimulate() : 1);
+        int const LastZone(PartialResimulate ? ZoneToResimulate() : NumOfZones);
+
+        // Inside emissivities and ScriptF are updated serially: this may evaluate movable insulation and issue warnings
+        for (int ZoneNum = FirstZone; ZoneNum <= LastZone; ++ZoneNum) {
 
             auto const &zone(Zone(ZoneNum));
             auto &zone_info(ZoneInfo(ZoneNum));
             auto &zone_ScriptF(zone_info.ScriptF); // Tuned Transposed
             auto &zone_SurfacePtr(zone_info.SurfacePtr);
             int const n_zone_Surfaces(zone_info.NumOfSurfaces);
-            size_type const s_zone_Surfaces(n_zone_Surfaces);
+#ifdef EP_HBIRE_SEQ
+            if (zone_info.SurfaceTempInKTo4th.size() != size_type(n_zone_Surfaces)) zone_info.SurfaceTempInKTo4th.dimension(n_zone_Surfaces, 0.0);
+#endif
 
             // Calculate ScriptF if first time step in environment and surface heat-balance iterations not yet started;
             // recalculate ScriptF if status of window interior shades or blinds has changed from
@@ -331,13 +331,27 @@ namespace HeatBalanceIntRadExchange {
                 }
 
             } // End of check if SurfIterations = 0
+        }
+
+        auto CalcZoneNetLWRad = [&](int const ZoneNum, bool const ThreadOverSurfaces) {
+            auto &zone_info(ZoneInfo(ZoneNum));
+            ArrayView<Real64 const> const zone_ScriptF(view(zone_info.ScriptF)); // Tuned Transposed
+            ArrayView<int const> const zone_SurfacePtr(view(zone_info.SurfacePtr));
+            int const n_zone_Surfaces(zone_info.NumOfSurfaces);
+            size_type const s_zone_Surfaces(n_zone_Surfaces);
+#ifdef EP_HBIRE_SEQ
+            // Contiguous with the zone ScriptF, one entry per zone surface
+            ArrayView<Real64> const SendSurfaceTempInKto4th(view(zone_info.SurfaceTempInKTo4th));
+#else
+            ArrayView<Real64> const SendSurfaceTempInKto4th(view(SendSurfaceTempInKto4thPrecalc));
+#endif
 
             // precalculate the fourth power of surface temperature as part of strategy to reduce calculation time - Glazer 2011-04-22
             for (size_type SendZoneSurfNum = 0; SendZoneSurfNum < s_zone_Surfaces; ++SendZoneSurfNum) {
-                SendSurfNum = zone_SurfacePtr[SendZoneSurfNum];
+                int const SendSurfNum(zone_SurfacePtr[SendZoneSurfNum]);
                 auto const &surface_window(SurfaceWindow(SendSurfNum));
-                ConstrNumSend = Surface(SendSurfNum).Construction;
-                auto const &construct(Construct(ConstrNumSend));
+                auto const &construct(Construct(Surface(SendSurfNum).Construction));
+                Real64 SendSurfTemp; // Sending surface temperature (C)
                 if (construct.WindowTypeEQL || construct.WindowTypeBSDF) {
                     SendSurfTemp = surface_window.EffInsSurfTemp;
                 } else if (construct.TypeIsWindow && surface_window.OriginalClass != SurfaceClass_TDD_Diffuser) {
@@ -352,20 +366,26 @@ namespace HeatBalanceIntRadExchange {
                     SendSurfTemp = SurfaceTemp(SendSurfNum);
                 }
 #ifdef EP_HBIRE_SEQ
-                SendSurfaceTempInKto4thPrecalc[SendZoneSurfNum] = pow_4(SendSurfTemp + KelvinConv);
+                SendSurfaceTempInKto4th[SendZoneSurfNum] = pow_4(SendSurfTemp + KelvinConv);
 #else
-                SendSurfaceTempInKto4thPrecalc(SendSurfNum) = pow_4(SendSurfTemp + KelvinConv);
+                SendSurfaceTempInKto4th[SendSurfNum - 1] = pow_4(SendSurfTemp + KelvinConv);
 #endif
             }
 
             // These are the money loops
-            size_type lSR(0u);
-            for (size_type RecZoneSurfNum = 0; RecZoneSurfNum < s_zone_Surfaces; ++RecZoneSurfNum) {
-                RecSurfNum = zone_SurfacePtr[RecZoneSurfNum];
-                ConstrNumRec = Surface(RecSurfNum).Construction;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(NumberIntRadThreads) if (ThreadOverSurfaces && n_zone_Surfaces >= MinSurfacesForSurfaceThreads)
+#endif
+            for (int RecZoneSurfNum = 0; RecZoneSurfNum < n_zone_Surfaces; ++RecZoneSurfNum) {
+                // ScriptF from every sending surface to this receiving surface
+                ArrayView<Real64 const> const rec_ScriptF(zone_ScriptF.sub(RecZoneSurfNum * s_zone_Surfaces, s_zone_Surfaces));
+                int const RecSurfNum(zone_SurfacePtr[RecZoneSurfNum]);
+                int const ConstrNumRec(Surface(RecSurfNum).Construction);
                 auto const &construct(Construct(ConstrNumRec));
                 auto &surface_window(SurfaceWindow(RecSurfNum));
                 auto &netLWRadToRecSurf(NetLWRadToSurf(RecSurfNum));
+                Real64 RecSurfTemp;  // Receiving surface temperature (C)
+                Real64 RecSurfEmiss; // Inside surface emissivity
                 if (construct.WindowTypeEQL) {
                     RecSurfEmiss = EQLWindowInsideEffectiveEmiss(ConstrNumRec);
                     RecSurfTemp = surface_window.EffInsSurfTemp;
@@ -394,10 +414,7 @@ namespace HeatBalanceIntRadExchange {
                     RecSurfEmiss = construct.InsideAbsorpThermal;
                 }
                 // precalculate the fourth power of surface temperature as part of strategy to reduce calculation time - Glazer 2011-04-22
-                RecSurfTempInKTo4th = pow_4(RecSurfTemp + KelvinConv);
-                //      IF (ABS(RecSurfTempInKTo4th) > 1.d100) THEN
-                //        SendZoneSurfNum=0
-                //      ENDIF
+                Real64 const RecSurfTempInKTo4th(pow_4(RecSurfTemp + KelvinConv)); // Receiving surface temperature in K to 4th power
 
                 // Calculate net long-wave radiation for opaque surfaces and incident
                 // long-wave radiation for windows.
@@ -405,52 +422,53 @@ namespace HeatBalanceIntRadExchange {
                     Real64 scriptF_acc(0.0);           // Local accumulator
                     Real64 netLWRadToRecSurf_cor(0.0); // Correction
                     Real64 IRfromParentZone_acc(0.0);  // Local accumulator
-                    for (size_type SendZoneSurfNum = 0; SendZoneSurfNum < s_zone_Surfaces; ++SendZoneSurfNum, ++lSR) {
-                        Real64 const scriptF(zone_ScriptF[lSR]); // [ lSR ] == ( SendZoneSurfNum+1, RecZoneSurfNum+1 )
+                    for (size_type SendZoneSurfNum = 0; SendZoneSurfNum < s_zone_Surfaces; ++SendZoneSurfNum) {
+                        Real64 const scriptF(rec_ScriptF[SendZoneSurfNum]);
 #ifdef EP_HBIRE_SEQ
-                        Real64 const scriptF_temp_ink_4th(scriptF * SendSurfaceTempInKto4thPrecalc[SendZoneSurfNum]);
+                        Real64 const scriptF_temp_ink_4th(scriptF * SendSurfaceTempInKto4th[SendZoneSurfNum]);
 #else
-                        SendSurfNum = zone_SurfacePtr[SendZoneSurfNum] - 1;
-                        Real64 const scriptF_temp_ink_4th(scriptF * SendSurfaceTempInKto4thPrecalc[SendSurfNum]);
+                        int const SendSurfNum(zone_SurfacePtr[SendZoneSurfNum] - 1);
+                        Real64 const scriptF_temp_ink_4th(scriptF * SendSurfaceTempInKto4th[SendSurfNum]);
 #endif
                         // Calculate interior LW incident on window rather than net LW for use in window layer heat balance calculation.
                         IRfromParentZone_acc += scriptF_temp_ink_4th;
 
-                        if (RecZoneSurfNum != SendZoneSurfNum) {
+                        if (size_type(RecZoneSurfNum) != SendZoneSurfNum) {
                             scriptF_acc += scriptF;
                         } else {
                             netLWRadToRecSurf_cor = scriptF_temp_ink_4th;
                         }
-
-                        // Per BG -- this should never happened.  (CR6346,CR6550 caused this to be put in.  Now removed. LKL 1/2013)
-                        //          IF (SurfaceWindow(RecSurfNum)%IRfromParentZone < 0.0) THEN
-                        //            CALL ShowRecurringWarningErrorAtEnd('CalcInteriorRadExchange: Window_IRFromParentZone negative, Window="'// &
-                        //                TRIM(Surface(RecSurfNum)%Name)//'"',  &
-                        //                SurfaceWindow(RecSurfNum)%IRErrCount)
-                        //            CALL ShowRecurringContinueErrorAtEnd('..occurs in Zone="'//TRIM(Surface(RecSurfNum)%ZoneName)//  &
-                        //                '", reset to 0.0 for remaining calculations.',SurfaceWindow(RecSurfNum)%IRErrCountC)
-                        //            SurfaceWindow(RecSurfNum)%IRfromParentZone=0.0
-                        //          ENDIF
                     }
                     netLWRadToRecSurf += IRfromParentZone_acc - netLWRadToRecSurf_cor - (scriptF_acc * RecSurfTempInKTo4th);
                     surface_window.IRfromParentZone += IRfromParentZone_acc / RecSurfEmiss;
                 } else {
                     Real64 netLWRadToRecSurf_acc(0.0); // Local accumulator
-                    for (size_type SendZoneSurfNum = 0; SendZoneSurfNum < s_zone_Surfaces; ++SendZoneSurfNum, ++lSR) {
-                        if (RecZoneSurfNum != SendZoneSurfNum) {
+                    for (size_type SendZoneSurfNum = 0; SendZoneSurfNum < s_zone_Surfaces; ++SendZoneSurfNum) {
+                        if (size_type(RecZoneSurfNum) != SendZoneSurfNum) {
 #ifdef EP_HBIRE_SEQ
-                            netLWRadToRecSurf_acc += zone_ScriptF[lSR] * (SendSurfaceTempInKto4thPrecalc[SendZoneSurfNum] -
-                                                                          RecSurfTempInKTo4th); // [ lSR ] == ( SendZoneSurfNum+1, RecZoneSurfNum+1 )
+                            netLWRadToRecSurf_acc += rec_ScriptF[SendZoneSurfNum] * (SendSurfaceTempInKto4th[SendZoneSurfNum] - RecSurfTempInKTo4th);
 #else
-                            SendSurfNum = zone_SurfacePtr[SendZoneSurfNum] - 1;
-                            netLWRadToRecSurf_acc += zone_ScriptF[lSR] * (SendSurfaceTempInKto4thPrecalc[SendSurfNum] -
-                                                                          RecSurfTempInKTo4th); // [ lSR ] == ( SendZoneSurfNum+1, RecZoneSurfNum+1 )
+                            int const SendSurfNum(zone_SurfacePtr[SendZoneSurfNum] - 1);
+                            netLWRadToRecSurf_acc += rec_ScriptF[SendZoneSurfNum] * (SendSurfaceTempInKto4th[SendSurfNum] - RecSurfTempInKTo4th);
 #endif
                         }
                     }
                     netLWRadToRecSurf += netLWRadToRecSurf_acc;
                 }
             }
+        };
+
+        // Each receiving surface only depends on the ScriptF and surface temperatures of its own zone and sums over the
+        // sending surfaces in a fixed order, so zones can be spread over threads without changing the results.  A single
+        // zone being resimulated is split over its receiving surfaces instead.
+        int const NumZonesToCalc(LastZone - FirstZone + 1);
+        bool const ThreadOverSurfaces(NumberIntRadThreads > 1 && NumZonesToCalc == 1);
+#ifdef _OPENMP
+        bool const ThreadOverZones(NumberIntRadThreads > 1 && NumZonesToCalc > 1);
+#pragma omp parallel for schedule(dynamic) num_threads(NumberIntRadThreads) if (ThreadOverZones)
+#endif
+        for (int ZoneNum = FirstZone; ZoneNum <= LastZone; ++ZoneNum) {
+            CalcZoneNetLWRad(ZoneNum, ThreadOverSurfaces);
         }
 
 #ifdef EP_Detailed_Timings
@@ -574,6 +592,7 @@ namespace HeatBalanceIntRadExchange {
             ZoneInfo(ZoneNum).Azimuth.dimension(NumOfZoneSurfaces, 0.0);
             ZoneInfo(ZoneNum).Tilt.dimension(NumOfZoneSurfaces, 0.0);
             ZoneInfo(ZoneNum).SurfacePtr.dimension(NumOfZoneSurfaces, 0);
+            ZoneInfo(ZoneNum).SurfaceTempInKTo4th.dimension(NumOfZoneSurfaces, 0.0);
 
             // Initialize the surface pointer array
             ZoneSurfNum = 0;
@@ -46,6 +46,12 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 // C++ Headers
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/gio.hh>
@@ -66,9 +72,11 @@
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataVectorTypes.hh>
 #include <DataZoneControls.hh>
 #include <DisplayRoutines.hh>
+#include <FileSystem.hh>
 #include <General.hh>
 #include <HeatBalanceKivaManager.hh>
 #include <ScheduleManager.hh>
@@ -84,26 +92,32 @@ namespace HeatBalanceKivaManager {
 
     void kivaErrorCallback(const int messageType, const std::string message, void *contextPtr)
     {
-        std::string fullMessage;
-        if (contextPtr) {
-            fullMessage = *(std::string*)contextPtr + ": " + message;
-        } else {
-            fullMessage = "Kiva: " + message;
-        }
-        if (messageType == Kiva::MSG_INFO) {
-            ShowMessage(fullMessage);
-        } else if (messageType == Kiva::MSG_WARN) {
-            ShowWarningError(fullMessage);
-        } else /* if (messageType == Kiva::MSG_ERR) */ {
-            ShowSevereError(fullMessage);
-            ShowFatalError("Kiva: Errors discovered, program terminates.");
+        // Instances are calculated in parallel (see calcKivaInstances)
+#ifdef _OPENMP
+#pragma omp critical(KivaMessages)
+#endif
+        {
+            std::string fullMessage;
+            if (contextPtr) {
+                fullMessage = *(std::string*)contextPtr + ": " + message;
+            } else {
+                fullMessage = "Kiva: " + message;
+            }
+            if (messageType == Kiva::MSG_INFO) {
+                ShowMessage(fullMessage);
+            } else if (messageType == Kiva::MSG_WARN) {
+                ShowWarningError(fullMessage);
+            } else /* if (messageType == Kiva::MSG_ERR) */ {
+                ShowSevereError(fullMessage);
+                ShowFatalError("Kiva: Errors discovered, program terminates.");
+            }
         }
     }
 
     KivaInstanceMap::KivaInstanceMap(
         Kiva::Foundation &foundation, int floorSurface, std::vector<int> wallSurfaces, int zoneNum, Real64 floorWeight, int constructionNum, KivaManager* kmPtr)
         : instance(foundation), floorSurface(floorSurface), wallSurfaces(wallSurfaces), zoneNum(zoneNum), zoneControlType(KIVAZONE_UNCONTROLLED),
-          zoneControlNum(0), floorWeight(floorWeight), constructionNum(constructionNum), kmPtr(kmPtr)
+          zoneControlNum(0), floorWeight(floorWeight), constructionNum(constructionNum), kmPtr(kmPtr), calcTime(0.0)
     {
 
         for (int i = 1; i <= DataZoneControls::NumTempControlledZones; ++i) {
@@ -157,38 +171,255 @@ namespace HeatBalanceKivaManager {
 #endif
 
         // Determine accelerated intervals
-        int numAccelaratedTimesteps = 3;
         int acceleratedTimestep = 30; // days
-        int accDate =
-            DataEnvironment::DayOfYear - 1 - acceleratedTimestep * (numAccelaratedTimesteps + 1); // date time = last timestep from the day before
-        while (accDate < 0) {
-            accDate = accDate + 365 + WeatherManager::LeapYearAdd;
-        }
+        std::vector<int> const accDates = initializationDates();
 
         // Initialize with steady state before accelerated timestepping
         instance.ground->foundation.numericalScheme = Kiva::Foundation::NS_STEADY_STATE;
-        setInitialBoundaryConditions(kivaWeather, accDate, 24, DataGlobals::NumOfTimeStepInHour);
+        setInitialBoundaryConditions(kivaWeather, accDates[0], 24, DataGlobals::NumOfTimeStepInHour);
         instance.calculate();
-        accDate += acceleratedTimestep;
-        while (accDate > 365 + WeatherManager::LeapYearAdd) {
-            accDate = accDate - (365 + WeatherManager::LeapYearAdd);
-        }
 
         // Accelerated timestepping
         instance.ground->foundation.numericalScheme = Kiva::Foundation::NS_IMPLICIT;
-        for (int i = 0; i < numAccelaratedTimesteps; ++i) {
-            setInitialBoundaryConditions(kivaWeather, accDate, 24, DataGlobals::NumOfTimeStepInHour);
+        for (std::size_t i = 1; i < accDates.size(); ++i) {
+            setInitialBoundaryConditions(kivaWeather, accDates[i], 24, DataGlobals::NumOfTimeStepInHour);
             instance.calculate(acceleratedTimestep * 24 * 60 * 60);
+        }
+
+        instance.calculate_surface_averages();
+        instance.foundation->numericalScheme = Kiva::Foundation::NS_ADI;
+    }
+
+    std::vector<int> initializationDates()
+    {
+        int numAccelaratedTimesteps = 3;
+        int acceleratedTimestep = 30; // days
+        int accDate =
+            DataEnvironment::DayOfYear - 1 - acceleratedTimestep * (numAccelaratedTimesteps + 1); // date time = last timestep from the day before
+        while (accDate < 0) {
+            accDate = accDate + 365 + WeatherManager::LeapYearAdd;
+        }
+
+        // Steady state date followed by the accelerated timestep dates
+        std::vector<int> accDates;
+        for (int i = 0; i <= numAccelaratedTimesteps; ++i) {
+            accDates.push_back(accDate);
             accDate += acceleratedTimestep;
             while (accDate > 365 + WeatherManager::LeapYearAdd) {
                 accDate = accDate - (365 + WeatherManager::LeapYearAdd);
             }
         }
+        return accDates;
+    }
 
-        instance.calculate_surface_averages();
+    // Sample convection closures at fixed conditions so they can be compared (empty when no algorithm is set)
+    static std::vector<Real64> probeConvection(Kiva::ConvectionAlgorithm const &algorithm)
+    {
+        if (!algorithm) return {};
+        return {algorithm(290.0, 295.0, 1.0, 0.9, 1.0), algorithm(300.0, 285.0, 3.0, 0.5, 0.0), algorithm(285.0, 300.0, 0.5, 0.2, -1.0)};
+    }
+
+    static std::vector<Real64> probeForcedTerm(Kiva::ForcedConvectionTerm const &term)
+    {
+        if (!term) return {};
+        return {term(0.0, 1.0, 290.0, 2.0), term(1.0, 0.0, 300.0, 6.0)};
+    }
+
+    bool KivaInstanceMap::hasSameInitialGround(KivaInstanceMap &other, const KivaWeatherData &kivaWeather)
+    {
+        // True when this instance would reach the same initial ground temperatures as other: both domains are built
+        // from the same foundation inputs, and the initial boundary conditions seen by both are the same.
+
+        auto const &surface(DataSurfaces::Surface(floorSurface));
+        auto const &otherSurface(DataSurfaces::Surface(other.floorSurface));
+        if (surface.OSCPtr != otherSurface.OSCPtr || surface.Construction != otherSurface.Construction ||
+            constructionNum != other.constructionNum || wallSurfaces.empty() != other.wallSurfaces.empty()) {
+            return false;
+        }
+
+        // Domain inputs that depend on the floor surface and its walls (the rest come from the Foundation:Kiva object)
+        auto const &fnd(*instance.foundation);
+        auto const &otherFnd(*other.instance.foundation);
+        if (fnd.foundationDepth != otherFnd.foundationDepth || fnd.deepGroundDepth != otherFnd.deepGroundDepth ||
+            fnd.useDetailedExposedPerimeter != otherFnd.useDetailedExposedPerimeter || fnd.exposedFraction != otherFnd.exposedFraction ||
+            fnd.isExposedPerimeter != otherFnd.isExposedPerimeter || fnd.reductionStrategy != otherFnd.reductionStrategy ||
+            fnd.polygon.outer().size() != otherFnd.polygon.outer().size()) {
+            return false;
+        }
+        // Floor shapes must match up to a translation
+        auto const &points(fnd.polygon.outer());
+        auto const &otherPoints(otherFnd.polygon.outer());
+        for (std::size_t i = 1; i < points.size(); ++i) {
+            if (points[i].get<0>() - points[0].get<0>() != otherPoints[i].get<0>() - otherPoints[0].get<0>() ||
+                points[i].get<1>() - points[0].get<1>() != otherPoints[i].get<1>() - otherPoints[0].get<1>()) {
+                return false;
+            }
+        }
+
+        // Initial boundary conditions: indoor temperatures come from each zone's controls, convection from each surface's
+        // algorithms (compared by probing them, as they are closures over surface data)
+        auto const sameConvection = [](Kiva::ConvectionAlgorithm const &a, Kiva::ConvectionAlgorithm const &b) {
+            return probeConvection(a) == probeConvection(b);
+        };
+        auto const sameForcedTerm = [](Kiva::ForcedConvectionTerm const &a, Kiva::ForcedConvectionTerm const &b) {
+            return probeForcedTerm(a) == probeForcedTerm(b);
+        };
+
+        std::shared_ptr<Kiva::BoundaryConditions> const savedBcs = instance.bcs;
+        std::shared_ptr<Kiva::BoundaryConditions> const otherSavedBcs = other.instance.bcs;
+        bool same = true;
+        for (int const accDate : initializationDates()) {
+            setInitialBoundaryConditions(kivaWeather, accDate, 24, DataGlobals::NumOfTimeStepInHour);
+            other.setInitialBoundaryConditions(kivaWeather, accDate, 24, DataGlobals::NumOfTimeStepInHour);
+            auto const &b(*instance.bcs);
+            auto const &o(*other.instance.bcs);
+            if (b.outdoorTemp != o.outdoorTemp || b.localWindSpeed != o.localWindSpeed || b.skyEmissivity != o.skyEmissivity ||
+                b.deepGroundTemperature != o.deepGroundTemperature || b.slabConvectiveTemp != o.slabConvectiveTemp ||
+                !sameConvection(b.slabConvectionAlgorithm, o.slabConvectionAlgorithm) ||
+                !sameConvection(b.intWallConvectionAlgorithm, o.intWallConvectionAlgorithm) ||
+                !sameConvection(b.extWallConvectionAlgorithm, o.extWallConvectionAlgorithm) ||
+                !sameConvection(b.gradeConvectionAlgorithm, o.gradeConvectionAlgorithm) ||
+                !sameForcedTerm(b.extWallForcedTerm, o.extWallForcedTerm) || !sameForcedTerm(b.gradeForcedTerm, o.gradeForcedTerm)) {
+                same = false;
+                break;
+            }
+        }
+        instance.bcs = savedBcs;
+        other.instance.bcs = otherSavedBcs;
+        return same;
+    }
+
+    void KivaInstanceMap::copyInitialGround(const KivaInstanceMap &other)
+    {
+        // Take the initial ground state from an equivalent instance (see hasSameInitialGround) instead of calculating it.
+        // Cells point into TOld, so the temperatures are copied in place.
+        std::copy(other.instance.ground->TNew.begin(), other.instance.ground->TNew.end(), instance.ground->TNew.begin());
+        std::copy(other.instance.ground->TOld.begin(), other.instance.ground->TOld.end(), instance.ground->TOld.begin());
+        instance.ground->groundOutput = other.instance.ground->groundOutput;
+        instance.bcs = std::make_shared<Kiva::BoundaryConditions>(*other.instance.bcs);
         instance.foundation->numericalScheme = Kiva::Foundation::NS_ADI;
     }
 
+    std::string KivaInstanceMap::initialGroundKey(const KivaWeatherData &kivaWeather)
+    {
+        // Key for the ground temperature cache: a hash of everything the initialized temperatures depend on. The discretized
+        // domain (cell geometry, properties and boundary surfaces) is hashed rather than the inputs, so any input that changes
+        // the domain also changes the key; the boundary conditions at each initialization date cover weather and start date.
+        std::uint64_t hash = FileSystem::hashBasis;
+        auto const add = [&hash](Real64 const value) { hash = FileSystem::hashBytes(&value, sizeof(value), hash); };
+
+        auto const &fnd(*instance.foundation);
+        add(fnd.numberOfDimensions);
+        add(fnd.coordinateSystem);
+        add(fnd.deepGroundBoundary);
+        add(fnd.wallTopBoundary);
+        add(fnd.wallTopInteriorTemperature);
+        add(fnd.wallTopExteriorTemperature);
+        add(fnd.linearAreaMultiplier);
+        add(fnd.netArea);
+        add(fnd.netPerimeter);
+        add(fnd.fADI);
+        add(fnd.tolerance);
+        add(fnd.maxIterations);
+
+        auto const &domain(instance.ground->domain);
+        for (std::size_t dim = 0; dim < 3; ++dim) {
+            add(domain.dim_lengths[dim]);
+        }
+        for (auto const &cell : domain.cell) {
+            add(cell->cellType);
+            add(cell->density);
+            add(cell->specificHeat);
+            add(cell->conductivity);
+            add(cell->volume);
+            add(cell->area);
+            add(cell->r);
+            add(cell->heatGain);
+            for (std::size_t dim = 0; dim < 3; ++dim) {
+                for (std::size_t dir = 0; dir < 2; ++dir) {
+                    add(cell->dist[dim][dir]);
+                    add(cell->kcoeff[dim][dir]);
+                }
+            }
+            if (cell->surfacePtr) {
+                auto const &surface(*cell->surfacePtr);
+                add(surface.type);
+                add(surface.boundaryConditionType);
+                add(surface.orientation);
+                add(surface.area);
+                add(surface.tilt);
+                add(surface.azimuth);
+                if (surface.propPtr) {
+                    add(surface.propPtr->emissivity);
+                    add(surface.propPtr->absorptivity);
+                    add(surface.propPtr->roughness);
+                }
+            } else {
+                add(-1.0);
+            }
+        }
+
+        std::shared_ptr<Kiva::BoundaryConditions> const savedBcs = instance.bcs;
+        for (int const accDate : initializationDates()) {
+            setInitialBoundaryConditions(kivaWeather, accDate, 24, DataGlobals::NumOfTimeStepInHour);
+            auto const &b(*instance.bcs);
+            for (Real64 const value : {b.outdoorTemp, b.localWindSpeed, b.skyEmissivity, b.deepGroundTemperature, b.slabConvectiveTemp,
+                                       b.wallConvectiveTemp, b.slabRadiantTemp, b.wallRadiantTemp}) {
+                add(value);
+            }
+            for (auto const *algorithm :
+                 {&b.slabConvectionAlgorithm, &b.intWallConvectionAlgorithm, &b.extWallConvectionAlgorithm, &b.gradeConvectionAlgorithm}) {
+                for (Real64 const value : probeConvection(*algorithm)) {
+                    add(value);
+                }
+            }
+            for (auto const *term : {&b.extWallForcedTerm, &b.gradeForcedTerm}) {
+                for (Real64 const value : probeForcedTerm(*term)) {
+                    add(value);
+                }
+            }
+        }
+        instance.bcs = savedBcs;
+
+        std::ostringstream key;
+        key << domain.cell.size() << '-' << std::hex << std::setw(16) << std::setfill('0') << hash;
+        return key.str();
+    }
+
+    nlohmann::json KivaInstanceMap::initialGroundState() const
+    {
+        nlohmann::json state;
+        state["TNew"] = instance.ground->TNew;
+        state["TOld"] = instance.ground->TOld;
+        auto &outputs = state["Outputs"] = nlohmann::json::array();
+        for (auto const &output : instance.ground->groundOutput.outputValues) {
+            outputs.push_back({static_cast<int>(output.first.first), static_cast<int>(output.first.second), output.second});
+        }
+        return state;
+    }
+
+    bool KivaInstanceMap::restoreInitialGround(nlohmann::json const &state, const KivaWeatherData &kivaWeather)
+    {
+        // Counterpart of initialGroundState: leaves the instance as initGround would, or returns false if the state does not fit
+        std::vector<Real64> const TNew = state.at("TNew").get<std::vector<Real64>>();
+        std::vector<Real64> const TOld = state.at("TOld").get<std::vector<Real64>>();
+        if (TNew.size() != instance.ground->TNew.size() || TOld.size() != instance.ground->TOld.size()) {
+            return false;
+        }
+        // Cells point into TOld, so the temperatures are copied in place
+        std::copy(TNew.begin(), TNew.end(), instance.ground->TNew.begin());
+        std::copy(TOld.begin(), TOld.end(), instance.ground->TOld.begin());
+        auto &outputValues = instance.ground->groundOutput.outputValues;
+        outputValues.clear();
+        for (auto const &output : state.at("Outputs")) {
+            outputValues[{static_cast<Kiva::Surface::SurfaceType>(output.at(0).get<int>()),
+                          static_cast<Kiva::GroundOutput::OutputType>(output.at(1).get<int>())}] = output.at(2).get<Real64>();
+        }
+        setInitialBoundaryConditions(kivaWeather, initializationDates().back(), 24, DataGlobals::NumOfTimeStepInHour);
+        instance.foundation->numericalScheme = Kiva::Foundation::NS_ADI;
+        return true;
+    }
+
     void KivaInstanceMap::setInitialBoundaryConditions(const KivaWeatherData &kivaWeather, const int date, const int hour, const int timestep)
     {
 
@@ -1089,20 +1320,108 @@ namespace HeatBalanceKivaManager {
     void KivaManager::initKivaInstances()
     {
         // initialize temperatures at the beginning of run environment
-        for (auto &kv : kivaInstances) {
-            // Start with steady-state solution
-            kv.initGround(kivaWeather);
+        // Perimeter foundations repeated across a model often build identical domains under identical initial conditions, so
+        // only the first of each equivalent group runs the steady-state and accelerated initialization; the others copy it.
+        // With KivaGroundCaching, initialized temperatures are also kept in the .kiva file and reused by later runs.
+        nlohmann::json groundCache;
+        bool cacheChanged = false;
+        if (DataSystemVariables::KivaGroundCaching) {
+            groundCache = readGroundCache();
+        }
+
+        std::vector<std::size_t> initializedInstances;
+        for (std::size_t instanceNum = 0; instanceNum < kivaInstances.size(); ++instanceNum) {
+            auto &kv = kivaInstances[instanceNum];
+            bool copied = false;
+#ifndef GROUND_PLOT
+            for (auto const sourceNum : initializedInstances) {
+                if (kv.hasSameInitialGround(kivaInstances[sourceNum], kivaWeather)) {
+                    kv.copyInitialGround(kivaInstances[sourceNum]);
+                    copied = true;
+                    break;
+                }
+            }
+            if (!copied && DataSystemVariables::KivaGroundCaching) {
+                std::string const key = kv.initialGroundKey(kivaWeather);
+                auto const cached = groundCache.find(key);
+                if (cached == groundCache.end() || !kv.restoreInitialGround(*cached, kivaWeather)) {
+                    kv.initGround(kivaWeather);
+                    groundCache[key] = kv.initialGroundState();
+                    cacheChanged = true;
+                }
+                initializedInstances.push_back(instanceNum);
+                continue;
+            }
+#endif
+            if (!copied) {
+                // Start with steady-state solution
+                kv.initGround(kivaWeather);
+                initializedInstances.push_back(instanceNum);
+            }
+        }
+
+        if (cacheChanged) {
+            writeGroundCache(groundCache);
         }
         calcKivaSurfaceResults();
     }
 
+    nlohmann::json KivaManager::readGroundCache()
+    {
+        // Initialized ground temperatures from earlier runs, by initialGroundKey. Stored as CBOR so temperatures read back
+        // exactly; a file from another version, or one that cannot be read, is treated as empty.
+        if (!ObjexxFCL::gio::file_exists(DataStringGlobals::outputKivaFileName)) {
+            return nlohmann::json::object();
+        }
+        std::ifstream ifs(DataStringGlobals::outputKivaFileName, std::ios::binary);
+        nlohmann::json json_in;
+        try {
+            json_in = nlohmann::json::from_cbor(ifs);
+        } catch (...) {
+            ShowWarningError(DataStringGlobals::outputKivaFileName + " contains invalid file format");
+            return nlohmann::json::object();
+        }
+        if (!json_in.is_object() || json_in.value("Version", "") != DataStringGlobals::VerString || !json_in["Instances"].is_object()) {
+            return nlohmann::json::object();
+        }
+        return json_in["Instances"];
+    }
+
+    void KivaManager::writeGroundCache(nlohmann::json const &groundCache)
+    {
+        nlohmann::json json_out;
+        json_out["Version"] = DataStringGlobals::VerString;
+        json_out["Instances"] = groundCache;
+        std::ofstream ofs(DataStringGlobals::outputKivaFileName, std::ios::binary);
+        nlohmann::json::to_cbor(json_out, ofs);
+    }
+
     void KivaManager::calcKivaInstances()
     {
-        // calculate heat transfer through ground
+        EP_TIMER_SCOPE("calcKivaInstances");
+
+        // Boundary conditions read shared heat balance state (and the MRT weighting keeps work arrays), so set them first
         for (auto &kv : kivaInstances) {
             kv.setBoundaryConditions();
+        }
+
+        // calculate heat transfer through ground, each foundation owns its own domain within a time step
+        int const numInstances = kivaInstances.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(DataSystemVariables::NumberIntRadThreads) if (numInstances > 1)
+#endif
+        for (int instanceNum = 0; instanceNum < numInstances; ++instanceNum) {
+            auto &kv(kivaInstances[instanceNum]);
+            auto const calcStart(std::chrono::steady_clock::now());
             kv.instance.calculate(timestep);
             kv.instance.calculate_surface_averages();
+            kv.calcTime = std::chrono::duration<Real64>(std::chrono::steady_clock::now() - calcStart).count();
+        }
+
+        for (auto &kv : kivaInstances) {
+#ifdef EP_Detailed_Timings
+            DataTimings::epAddTimerScopeTime(DataSurfaces::Surface(kv.floorSurface).Name.c_str(), kv.calcTime);
+#endif
             if (DataEnvironment::Month == 1 && DataEnvironment::DayOfMonth == 1 && DataGlobals::HourOfDay == 1 && DataGlobals::TimeStep == 1) {
                 kv.plotDomain();
             }
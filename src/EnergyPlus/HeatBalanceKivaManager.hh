@@ -53,6 +53,9 @@
 #include <libkiva/Ground.hpp>
 #include <libkiva/Instance.hpp>
 
+// JSON Headers
+#include <nlohmann/json.hpp>
+
 // EnergyPlus Headers
 #include <DataHeatBalance.hh>
 #include <DataSurfaces.hh>
@@ -90,6 +93,9 @@ namespace HeatBalanceKivaManager {
         int wallConstructionIndex;
     };
 
+    // Dates of the steady state and accelerated time steps used to initialize the ground before a run environment
+    std::vector<int> initializationDates();
+
     class KivaInstanceMap
     {
     public:
@@ -102,12 +108,18 @@ namespace HeatBalanceKivaManager {
         int zoneControlType; // Uncontrolled=0, Temperature=1, Operative=2, Comfort=3, HumidityAndTemperature=4
         int zoneControlNum;
         void initGround(const KivaWeatherData &kivaWeather);
+        bool hasSameInitialGround(KivaInstanceMap &other, const KivaWeatherData &kivaWeather);
+        void copyInitialGround(const KivaInstanceMap &other);
+        std::string initialGroundKey(const KivaWeatherData &kivaWeather);
+        nlohmann::json initialGroundState() const;
+        bool restoreInitialGround(nlohmann::json const &state, const KivaWeatherData &kivaWeather);
         void setInitialBoundaryConditions(const KivaWeatherData &kivaWeather, const int date, const int hour, const int timestep);
         void setBoundaryConditions();
         void plotDomain();
         Real64 floorWeight;
         int constructionNum;
         class KivaManager* kmPtr;
+        Real64 calcTime; // wall time spent in the ground calculation this time step [s]
 
 #ifdef GROUND_PLOT
         Kiva::SnapshotSettings ss;
@@ -130,6 +142,8 @@ namespace HeatBalanceKivaManager {
         void addDefaultFoundation();
         int findFoundation(std::string const &name);
         void calcKivaSurfaceResults();
+        nlohmann::json readGroundCache();
+        void writeGroundCache(nlohmann::json const &groundCache);
 
         KivaWeatherData kivaWeather;
         FoundationKiva defaultFoundation;
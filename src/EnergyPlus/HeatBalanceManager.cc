@@ -48,7 +48,10 @@
 // C++ Headers
 #include <algorithm>
 #include <cmath>
+#include <fstream>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -77,6 +80,7 @@
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataWindowEquivalentLayer.hh>
 #include <DaylightingDevices.hh>
 #include <DaylightingManager.hh>
@@ -98,10 +102,12 @@
 #include <OutputReportTabular.hh>
 #include <PhaseChangeModeling/HysteresisModel.hh>
 #include <ScheduleManager.hh>
+#include <SimulationTelemetry.hh>
 #include <SolarShading.hh>
 #include <SurfaceGeometry.hh>
 #include <SurfaceOctree.hh>
 #include <UtilityRoutines.hh>
+#include <WeatherManager.hh>
 #include <WindowComplexManager.hh>
 #include <WindowEquivalentLayer.hh>
 #include <WindowManager.hh>
@@ -222,6 +228,15 @@ namespace HeatBalanceManager {
     Array2D<Real64> MaxLoadZoneRpt;    // Maximum zone load for reporting calcs
     int CountWarmupDayPoints;          // Count of warmup timesteps (to achieve warmup)
 
+    // Surface histories at the end of warmup days, used by AcceleratedWarmup and WarmupStateReuse
+    std::vector<std::vector<Real64>> WarmupDayStates;                     // end of day states since the last extrapolation
+    std::unordered_map<int, std::vector<Real64>> ConvergedWarmupStates; // converged end of warmup state by design day
+    bool WarmupStateSeeded(false);                                        // true if this environment started from a converged state
+    int const ThermalStateCheckpointVersion(1);                           // layout of the files written by --checkpoint-at
+    bool RestartStateUsed(false);                                         // --restart-from has been claimed by a run period
+    bool RestartStatePending(false);                                      // the current run period starts from the restart file
+    bool ThermalStateCheckpointWritten(false);                            // --checkpoint-at has written its file
+
     std::string CurrentModuleObject; // to assist in getting input
 
     // Subroutine Specifications for the Heat Balance Module
@@ -272,6 +287,12 @@ namespace HeatBalanceManager {
         LoadZoneRptStdDev.deallocate();
         MaxLoadZoneRpt.deallocate();
         CountWarmupDayPoints = int();
+        WarmupDayStates.clear();
+        ConvergedWarmupStates.clear();
+        WarmupStateSeeded = false;
+        RestartStateUsed = false;
+        RestartStatePending = false;
+        ThermalStateCheckpointWritten = false;
         CurrentModuleObject = std::string();
         WarmupConvergenceValues.deallocate();
         UniqueMaterialNames.clear();
@@ -327,6 +348,8 @@ namespace HeatBalanceManager {
         ////////////////////////////////////////////////
 
         // FLOW:
+        SimulationTelemetry::ScopedTimer telemetryTimer(SimulationTelemetry::Subsystem::HeatBalance);
+        EP_TIMER_SCOPE("ManageHeatBalance");
 
         // Get the heat balance input at the beginning of the simulation only
         if (ManageHeatBalanceGetInputFlag) {
@@ -335,9 +358,10 @@ namespace HeatBalanceManager {
             // Surface octree setup
             //  The surface octree holds live references to surfaces so it must be updated
             //   if in the future surfaces are altered after this point
-            if (TotSurfaces >= DaylightingManager::octreeCrossover) {                 // Octree can be active
-                if (inputProcessor->getNumObjectsFound("Daylighting:Controls") > 0) { // Daylighting is active
-                    surfaceOctree.init(DataSurfaces::Surface);                        // Set up surface octree
+            if (TotSurfaces >= DaylightingManager::octreeCrossover) { // Octree can be active
+                if ((inputProcessor->getNumObjectsFound("Daylighting:Controls") > 0) || // Daylighting is active
+                    DataSurfaces::CalcSolRefl) {                                        // Solar reflection calculation is active
+                    surfaceOctree.init(DataSurfaces::Surface);                          // Set up surface octree
                 }
             }
 
@@ -378,7 +402,10 @@ namespace HeatBalanceManager {
         if (WarmupFlag && EndDayFlag) {
 
             CheckWarmupConvergence();
-            if (!WarmupFlag) {
+            if (WarmupFlag) {
+                if (DataSystemVariables::AcceleratedWarmup) AccelerateWarmup();
+            } else {
+                if (DataSystemVariables::WarmupStateReuse) SaveConvergedWarmupState();
                 DayOfSim = 0; // Reset DayOfSim if Warmup converged
                 DayOfSimChr = "0";
 
@@ -386,7 +413,14 @@ namespace HeatBalanceManager {
             }
         }
 
-        if (!WarmupFlag && EndDayFlag && DayOfSim == 1 && !DoingSizing) {
+        if (!WarmupFlag && EndDayFlag && DayOfSim == DataGlobals::CheckpointAtDay && KindOfSim == ksRunPeriodWeather &&
+            !ThermalStateCheckpointWritten) {
+            WriteThermalStateCheckpoint(DataStringGlobals::outputCkptFileName);
+            ThermalStateCheckpointWritten = true;
+        }
+
+        // A run period restarted from a checkpoint has no warmup days to report
+        if (!WarmupFlag && EndDayFlag && DayOfSim == 1 && !DoingSizing && DataReportingFlags::NumOfWarmupDays > 0) {
             ReportWarmupConvergence();
         }
     }
@@ -5630,6 +5664,10 @@ namespace HeatBalanceManager {
         static bool WarmupConvergenceWarning(false);
         static bool SizingWarmupConvergenceWarning(false);
         bool ConvergenceChecksFailed;
+        int MinWarmupDays; // Minimum number of warmup days for this environment
+
+        // An environment that started from its own converged state only needs the one day to compare against
+        MinWarmupDays = WarmupStateSeeded ? min(MinNumberOfWarmupDays, 2) : MinNumberOfWarmupDays;
 
         // Convergence criteria for warmup days:
         // Perform another warmup day unless both the % change in loads and
@@ -5750,9 +5788,9 @@ namespace HeatBalanceManager {
 
             // Set warmup flag to true depending on value of ConvergenceChecksFailed (true=fail)
             // and minimum number of warmup days
-            if (!ConvergenceChecksFailed && DayOfSim >= MinNumberOfWarmupDays) {
+            if (!ConvergenceChecksFailed && DayOfSim >= MinWarmupDays) {
                 WarmupFlag = false;
-            } else if (!ConvergenceChecksFailed && DayOfSim < MinNumberOfWarmupDays) {
+            } else if (!ConvergenceChecksFailed && DayOfSim < MinWarmupDays) {
                 WarmupFlag = true;
             }
 
@@ -5764,6 +5802,307 @@ namespace HeatBalanceManager {
         }
     }
 
+    bool WarmupStateCanBeReused()
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // Surface histories can only be extrapolated or carried over to another environment when they hold
+        // the whole of the surface state, which is the case when every surface uses conduction transfer functions.
+
+        if (!DataHeatBalSurface::TH.allocated()) return false;
+        for (int Algo = 1; Algo <= NumberOfHeatTransferAlgosUsed; ++Algo) {
+            if (HeatTransferAlgosUsed(Algo) != DataSurfaces::HeatTransferModel_CTF) return false;
+        }
+        return true;
+    }
+
+    void PackWarmupSurfaceState(std::vector<Real64> &State)
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Copy the surface temperature and flux histories into one flat vector.
+
+        State.clear();
+        auto pack = [&State](ObjexxFCL::Array<Real64> const &a) {
+            for (std::size_t l = 0; l < a.size(); ++l) {
+                State.push_back(a[l]);
+            }
+        };
+        pack(TH);
+        pack(QH);
+        pack(THM);
+        pack(QHM);
+        pack(TempSurfIn);
+        pack(TempSurfInTmp);
+        pack(TempSurfOut);
+        if (AnyConstructInternalSourceInInput) {
+            pack(TsrcHist);
+            pack(TsrcHistM);
+            pack(TuserHist);
+            pack(TuserHistM);
+            pack(QsrcHist);
+            pack(QsrcHistM);
+        }
+    }
+
+    std::size_t UnpackWarmupSurfaceState(std::vector<Real64> const &State)
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // Restore the surface temperature and flux histories from a vector filled by PackWarmupSurfaceState.
+        // Returns the number of values used, which is where any state packed after the surfaces starts.
+
+        std::size_t Pos(0);
+        auto unpack = [&State, &Pos](ObjexxFCL::Array<Real64> &a) {
+            for (std::size_t l = 0; l < a.size(); ++l) {
+                a[l] = State[Pos++];
+            }
+        };
+        unpack(TH);
+        unpack(QH);
+        unpack(THM);
+        unpack(QHM);
+        unpack(TempSurfIn);
+        unpack(TempSurfInTmp);
+        unpack(TempSurfOut);
+        if (AnyConstructInternalSourceInInput) {
+            unpack(TsrcHist);
+            unpack(TsrcHistM);
+            unpack(TuserHist);
+            unpack(TuserHistM);
+            unpack(QsrcHist);
+            unpack(QsrcHistM);
+        }
+        return Pos;
+    }
+
+    void PackWarmupZoneAirState(std::vector<Real64> &State)
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Append the zone air temperature histories to a vector, after the surface histories of a converged day.
+
+        auto pack = [&State](Array1D<Real64> const &a) {
+            for (std::size_t l = 0; l < a.size(); ++l) {
+                State.push_back(a[l]);
+            }
+        };
+        pack(MAT);
+        pack(ZT);
+        pack(ZTAV);
+        pack(XMAT);
+        pack(XM2T);
+        pack(XM3T);
+        pack(XM4T);
+        pack(XMPT);
+        pack(DSXMAT);
+        pack(DSXM2T);
+        pack(DSXM3T);
+        pack(DSXM4T);
+        pack(ZoneTMX);
+        pack(ZoneTM2);
+    }
+
+    void UnpackWarmupZoneAirState(std::vector<Real64> const &State, std::size_t Pos)
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Restore the zone air temperature histories packed by PackWarmupZoneAirState, starting at Pos.
+
+        auto unpack = [&State, &Pos](Array1D<Real64> &a) {
+            for (std::size_t l = 0; l < a.size() && Pos < State.size(); ++l) {
+                a[l] = State[Pos++];
+            }
+        };
+        unpack(MAT);
+        unpack(ZT);
+        unpack(ZTAV);
+        unpack(XMAT);
+        unpack(XM2T);
+        unpack(XM3T);
+        unpack(XM4T);
+        unpack(XMPT);
+        unpack(DSXMAT);
+        unpack(DSXM2T);
+        unpack(DSXM3T);
+        unpack(DSXM4T);
+        unpack(ZoneTMX);
+        unpack(ZoneTM2);
+    }
+
+    Real64 AitkenExtrapolate(Real64 const Value0, // value at the end of the oldest of three warmup days
+                             Real64 const Value1, // value at the end of the middle day
+                             Real64 const Value2  // value at the end of the latest day
+    )
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // Estimate the limit of a value that is approaching its periodic steady state from one day to the next.
+
+        // METHODOLOGY EMPLOYED:
+        // Aitken's delta-squared process.  Heavy constructions approach the periodic state geometrically, so the
+        // ratio of successive day to day changes r stays nearly constant and the remaining change is d2*r/(1-r).
+        // The value is left alone unless it is moving steadily in one direction (0 < r <= MaxRatio), which also
+        // bounds the step to MaxRatio/(1-MaxRatio) times the last day's change.
+
+        Real64 const MaxRatio(0.9);     // Largest ratio of successive changes that is extrapolated
+        Real64 const MinChange(1.0e-6); // Changes below this are left to the ordinary warmup days
+
+        Real64 const Change1(Value1 - Value0);
+        Real64 const Change2(Value2 - Value1);
+        if (std::abs(Change2) < MinChange || Change1 == 0.0) return Value2;
+        Real64 const Ratio(Change2 / Change1);
+        if (Ratio <= 0.0 || Ratio > MaxRatio) return Value2;
+        return Value2 + Change2 * Ratio / (1.0 - Ratio);
+    }
+
+    void AccelerateWarmup()
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Called at the end of each warmup day that did not converge.  Every third day the surface histories
+        // are moved to the periodic state extrapolated from the last three end of day states, so that heavy
+        // buildings do not need a warmup day for every step of their slow approach to that state.
+
+        if (!WarmupStateCanBeReused()) return;
+
+        WarmupDayStates.emplace_back();
+        PackWarmupSurfaceState(WarmupDayStates.back());
+        if (WarmupDayStates.size() < 3) return;
+
+        std::vector<Real64> const &State0(WarmupDayStates[0]);
+        std::vector<Real64> const &State1(WarmupDayStates[1]);
+        std::vector<Real64> Extrapolated(WarmupDayStates[2]);
+        for (std::size_t l = 0; l < Extrapolated.size(); ++l) {
+            Extrapolated[l] = AitkenExtrapolate(State0[l], State1[l], Extrapolated[l]);
+        }
+        UnpackWarmupSurfaceState(Extrapolated);
+
+        // The days after a jump are not on the same geometric path as the days before it
+        WarmupDayStates.clear();
+    }
+
+    void SaveConvergedWarmupState()
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Keep the converged surface and zone air histories of a design day, which is simulated again for system
+        // sizing, for the sizing period itself and for each HVAC sizing simulation pass.
+
+        if (!WarmupStateCanBeReused()) return;
+        if (KindOfSim != ksDesignDay && KindOfSim != ksHVACSizeDesignDay) return;
+
+        std::vector<Real64> &State(ConvergedWarmupStates[WeatherManager::Environment(WeatherManager::Envrn).DesignDayNum]);
+        PackWarmupSurfaceState(State);
+        PackWarmupZoneAirState(State);
+    }
+
+    void SeedWarmupState()
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Called at the beginning of each environment after the histories have been initialized.  Starts the
+        // warmup of a design day from the state it converged to the last time it was simulated, if there was one.
+
+        WarmupDayStates.clear();
+        WarmupStateSeeded = false;
+
+        if (RestartStatePending) {
+            RestartStatePending = false;
+            if (!ReadThermalStateCheckpoint(DataGlobals::RestartFromFileName)) {
+                ShowFatalError("Program terminates because the run period cannot be restarted from " + DataGlobals::RestartFromFileName);
+            }
+            return;
+        }
+
+        if (!DataSystemVariables::WarmupStateReuse || !WarmupStateCanBeReused()) return;
+        if (KindOfSim != ksDesignDay && KindOfSim != ksHVACSizeDesignDay) return;
+
+        auto const State(ConvergedWarmupStates.find(WeatherManager::Environment(WeatherManager::Envrn).DesignDayNum));
+        if (State == ConvergedWarmupStates.end()) return;
+        UnpackWarmupZoneAirState(State->second, UnpackWarmupSurfaceState(State->second));
+        WarmupStateSeeded = true;
+    }
+
+    bool StartFromRestartState()
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // Called by ManageSimulation at the beginning of each weather run period.  Returns true if the run period
+        // is to continue from the state in the --restart-from file, in which case it skips the warmup days and
+        // SeedWarmupState loads the file once the histories have been initialized.  Only the first weather run
+        // period is restarted.
+
+        if (DataGlobals::RestartFromFileName.empty() || RestartStateUsed) return false;
+        RestartStateUsed = true;
+
+        for (int Algo = 1; Algo <= NumberOfHeatTransferAlgosUsed; ++Algo) {
+            if (HeatTransferAlgosUsed(Algo) != DataSurfaces::HeatTransferModel_CTF) {
+                ShowWarningError("StartFromRestartState: --restart-from needs every surface to use ConductionTransferFunction.");
+                ShowContinueError("The run period will be warmed up instead of starting from " + DataGlobals::RestartFromFileName);
+                return false;
+            }
+        }
+        RestartStatePending = true;
+        return true;
+    }
+
+    void WriteThermalStateCheckpoint(std::string const &FileName)
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Write the surface and zone air temperature histories for --checkpoint-at.  The values are written in
+        // their own memory layout, so a checkpoint is only meant to be read back by the same build of the same model.
+
+        if (!WarmupStateCanBeReused()) {
+            ShowWarningError("WriteThermalStateCheckpoint: --checkpoint-at needs every surface to use ConductionTransferFunction, " +
+                             FileName + " is not written.");
+            return;
+        }
+
+        std::vector<Real64> State;
+        PackWarmupSurfaceState(State);
+        PackWarmupZoneAirState(State);
+
+        std::ofstream ofs(FileName, std::ios::binary | std::ios::trunc);
+        if (!ofs) {
+            ShowWarningError("WriteThermalStateCheckpoint: could not open " + FileName + ", no checkpoint is written.");
+            return;
+        }
+        int const Header[4] = {ThermalStateCheckpointVersion, TotSurfaces, NumOfZones, static_cast<int>(State.size())};
+        ofs.write(reinterpret_cast<char const *>(Header), sizeof(Header));
+        ofs.write(reinterpret_cast<char const *>(State.data()), sizeof(Real64) * State.size());
+        DisplayString("Thermal state at the end of " + CurMnDyYr + " written to " + FileName);
+    }
+
+    bool ReadThermalStateCheckpoint(std::string const &FileName)
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // Load the surface and zone air temperature histories written by WriteThermalStateCheckpoint.  Returns
+        // false, with a severe error, when the file cannot be read or was written for a different model.
+
+        std::vector<Real64> State;
+        PackWarmupSurfaceState(State);
+        PackWarmupZoneAirState(State);
+
+        std::ifstream ifs(FileName, std::ios::binary);
+        int Header[4] = {0, 0, 0, 0};
+        ifs.read(reinterpret_cast<char *>(Header), sizeof(Header));
+        if (!ifs || Header[0] != ThermalStateCheckpointVersion || Header[1] != TotSurfaces || Header[2] != NumOfZones ||
+            Header[3] != static_cast<int>(State.size())) {
+            ShowSevereError("ReadThermalStateCheckpoint: " + FileName + " is not a checkpoint of this model.");
+            return false;
+        }
+        ifs.read(reinterpret_cast<char *>(State.data()), sizeof(Real64) * State.size());
+        if (!ifs) {
+            ShowSevereError("ReadThermalStateCheckpoint: " + FileName + " is truncated.");
+            return false;
+        }
+        UnpackWarmupZoneAirState(State, UnpackWarmupSurfaceState(State));
+        return true;
+    }
+
     void ReportWarmupConvergence()
     {
 
@@ -48,6 +48,9 @@
 #ifndef HeatBalanceManager_hh_INCLUDED
 #define HeatBalanceManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array2D.hh>
@@ -209,6 +212,33 @@ namespace HeatBalanceManager {
 
     void ReportWarmupConvergence();
 
+    bool WarmupStateCanBeReused();
+
+    void PackWarmupSurfaceState(std::vector<Real64> &State);
+
+    std::size_t UnpackWarmupSurfaceState(std::vector<Real64> const &State);
+
+    void PackWarmupZoneAirState(std::vector<Real64> &State);
+
+    void UnpackWarmupZoneAirState(std::vector<Real64> const &State, std::size_t Pos);
+
+    Real64 AitkenExtrapolate(Real64 const Value0, // value at the end of the oldest of three warmup days
+                             Real64 const Value1, // value at the end of the middle day
+                             Real64 const Value2  // value at the end of the latest day
+    );
+
+    void AccelerateWarmup();
+
+    void SaveConvergedWarmupState();
+
+    void SeedWarmupState();
+
+    bool StartFromRestartState();
+
+    void WriteThermalStateCheckpoint(std::string const &FileName);
+
+    bool ReadThermalStateCheckpoint(std::string const &FileName);
+
     //        End of Record Keeping subroutines for the HB Module
     // *****************************************************************************
 
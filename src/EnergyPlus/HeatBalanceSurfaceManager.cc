@@ -49,6 +49,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -98,6 +99,7 @@
 #include <HeatBalanceHAMTManager.hh>
 #include <HeatBalanceIntRadExchange.hh>
 #include <HeatBalanceKivaManager.hh>
+#include <HeatBalanceManager.hh>
 #include <HeatBalanceMovableInsulation.hh>
 #include <HeatBalanceSurfaceManager.hh>
 #include <HighTempRadiantSystem.hh>
@@ -193,6 +195,13 @@ namespace HeatBalanceSurfaceManager {
         bool UpdateThermalHistoriesFirstTimeFlag(true);
         bool CalculateZoneMRTfirstTime(true);          // Flag for first time calculations
         bool calcHeatBalanceInsideSurfFirstTime(true); // Used for trapping errors or other problems
+        std::vector<int> InterZoneWindowSurfs;         // Heat transfer surfaces facing another zone from a zone with interzone windows
+        std::vector<Real64> DifSolExcInputs;           // Window transmittances and zone VMULTs behind the current FractDifShortZtoZ
+        std::vector<Real64> DifSolExcNewInputs;        // Same for this time step
+        bool DifSolExcCurrent(false);                  // True when FractDifShortZtoZ was computed from DifSolExcInputs
+        std::vector<int> OutsideHBSurfs;               // Surfaces that get an outside face heat balance, in surface order
+        // Same, for each zone, including the surfaces adjacent to the zone
+        std::vector<std::vector<int>> OutsideHBSurfsByZone;
     }                                                  // namespace
                                                        // DERIVED TYPE DEFINITIONS:
                                                        // na
@@ -226,6 +235,12 @@ namespace HeatBalanceSurfaceManager {
         UpdateThermalHistoriesFirstTimeFlag = true;
         CalculateZoneMRTfirstTime = true;
         calcHeatBalanceInsideSurfFirstTime = true;
+        InterZoneWindowSurfs.clear();
+        DifSolExcInputs.clear();
+        DifSolExcNewInputs.clear();
+        DifSolExcCurrent = false;
+        OutsideHBSurfs.clear();
+        OutsideHBSurfsByZone.clear();
         SurfaceEnthalpyRead.deallocate();
     }
 
@@ -334,6 +349,7 @@ namespace HeatBalanceSurfaceManager {
         //                      RJH, Jul 2004: add error handling for DElight calls
         //       MODIFIED       Aug. 2017
         //                      Add initializations of surface data to linked air node value if defined
+        //       MODIFIED       October 2026, skip daylighting in zones whose lights are off when requested
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -380,19 +396,12 @@ namespace HeatBalanceSurfaceManager {
         // na
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        int ConstrNum;   // Construction index
         int NZ;          // DO loop counter for zones
-        Real64 QIC;      // Intermediate calculation variable
-        Real64 QOC;      // Intermediate calculation variable
         int SurfNum;     // DO loop counter for surfaces
         int SrdSurfsNum; // DO loop counter for srd surfaces
         int SrdSurfNum;
         Real64 SrdSurfsViewFactor;
 
-        int Term;   // DO loop counter for conduction equation terms
-        Real64 TSC; // Intermediate calculation variable (temperature at source location)
-        Real64 TUC; // Intermediate calculation variable (temperature at user specified location)
-
         // RJH DElight Modification Begin
         Real64 dPowerReducFac;  // Return value Electric Lighting Power Reduction Factor for current Zone and Timestep
         Real64 dHISKFFC;        // double value for argument passing
@@ -523,6 +532,7 @@ namespace HeatBalanceSurfaceManager {
         if (BeginEnvrnFlag) {
             if (InitSurfaceHeatBalancefirstTime) DisplayString("Initializing Temperature and Flux Histories");
             InitThermalAndFluxHistories(); // Set initial temperature and flux histories
+            HeatBalanceManager::SeedWarmupState(); // Start a repeated design day from its converged histories
         }
 
         // There are no daily initializations done in this portion of the surface heat balance
@@ -583,7 +593,7 @@ namespace HeatBalanceSurfaceManager {
                 ZoneDaylight(NZ).TimeExceedingDaylightIlluminanceSPAtRefPt = 0.0;
             }
 
-            if (SunIsUp && ZoneDaylight(NZ).TotalDaylRefPoints != 0) {
+            if (SunIsUp && ZoneDaylight(NZ).TotalDaylRefPoints != 0 && !DayltgZoneLightsAreOff(NZ)) {
                 if (InitSurfaceHeatBalancefirstTime) DisplayString("Computing Interior Daylighting Illumination");
                 DayltgInteriorIllum(NZ);
                 if (!DoingSizing) DayltgInteriorMapIllum(NZ);
@@ -790,6 +800,54 @@ namespace HeatBalanceSurfaceManager {
             InitHeatBalFiniteDiff();
         }
 
+        InitCTFConstantParts();
+
+        // Zero out all of the radiant system heat balance coefficient arrays
+        RadSysTiHBConstCoef = 0.0;
+        RadSysTiHBToutCoef = 0.0;
+        RadSysTiHBQsrcCoef = 0.0;
+        RadSysToHBConstCoef = 0.0;
+        RadSysToHBTinCoef = 0.0;
+        RadSysToHBQsrcCoef = 0.0;
+
+        QRadSysSource = 0.0;
+        QPVSysSource = 0.0;
+        QHTRadSysSurf = 0.0;
+        QHWBaseboardSurf = 0.0;
+        QSteamBaseboardSurf = 0.0;
+        QElecBaseboardSurf = 0.0;
+        QCoolingPanelSurf = 0.0;
+        QPoolSurfNumerator = 0.0;
+        PoolHeatTransCoefs = 0.0;
+
+        if (ZoneSizingCalc) GatherComponentLoadsSurfAbsFact();
+
+        if (InitSurfaceHeatBalancefirstTime) DisplayString("Completed Initializing Surface Heat Balance");
+        InitSurfaceHeatBalancefirstTime = false;
+    }
+
+    void InitCTFConstantParts()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Computes the constant portion of the conductive fluxes (the CTF history terms) of the CTF and EMPD
+        // surfaces at the start of a time step.  Split out of InitSurfaceHeatBalance.
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+        int ConstrNum; // Construction index
+        Real64 QIC;    // Intermediate calculation variable
+        Real64 QOC;    // Intermediate calculation variable
+        int SurfNum;   // DO loop counter for surfaces
+        int Term;      // DO loop counter for conduction equation terms
+        Real64 TSC;    // Intermediate calculation variable (temperature at source location)
+        Real64 TUC;    // Intermediate calculation variable (temperature at user specified location)
+
         CTFConstOutPart = 0.0;
         CTFConstInPart = 0.0;
         if (AnyConstructInternalSourceInInput) {
@@ -811,10 +869,42 @@ namespace HeatBalanceSurfaceManager {
 
                 QIC = 0.0;
                 QOC = 0.0;
-                if (construct.SourceSinkPresent) {
-                    TSC = 0.0;
-                    TUC = 0.0;
+                if (!construct.SourceSinkPresent) {
+                    // Refresh the surface copy of the coefficients whenever the surface construction has been switched
+                    if (SurfCTFConstr(SurfNum) != ConstrNum) {
+                        for (Term = 0; Term <= construct.NumCTFTerms; ++Term) {
+                            SurfCTFCross(SurfNum, Term) = construct.CTFCross(Term);
+                            SurfCTFFlux(SurfNum, Term) = (Term > 0) ? construct.CTFFlux(Term) : 0.0;
+                            SurfCTFInside(SurfNum, Term) = construct.CTFInside(Term);
+                            SurfCTFOutside(SurfNum, Term) = construct.CTFOutside(Term);
+                        }
+                        SurfCTFConstr(SurfNum) = ConstrNum;
+                    }
+
+                    // Same sums as below, but the coefficients are streamed from the contiguous surface copies
+                    auto l11(TH.index(1, 2, SurfNum));
+                    auto l12(TH.index(2, 2, SurfNum));
+                    auto const s3(TH.size3());
+                    auto lCTF(SurfCTFCross.index(SurfNum, 1));
+                    for (Term = 1; Term <= construct.NumCTFTerms;
+                         ++Term, l11 += s3, l12 += s3, ++lCTF) { // [ lCTF ] == ( SurfNum, Term ) for all four coefficient arrays
+                        Real64 const ctf_cross(SurfCTFCross[lCTF]);
+                        Real64 const ctf_flux(SurfCTFFlux[lCTF]);
+                        Real64 const TH11(TH[l11]);
+                        Real64 const TH12(TH[l12]);
+
+                        QIC += ctf_cross * TH11 - SurfCTFInside[lCTF] * TH12 + ctf_flux * QH[l12];
+
+                        QOC += SurfCTFOutside[lCTF] * TH11 - ctf_cross * TH12 + ctf_flux * QH[l11];
+                    }
+
+                    CTFConstOutPart(SurfNum) = QOC;
+                    CTFConstInPart(SurfNum) = QIC;
+                    continue;
                 }
+
+                TSC = 0.0;
+                TUC = 0.0;
                 auto l11(TH.index(1, 2, SurfNum));
                 auto l12(TH.index(2, 2, SurfNum));
                 auto const s3(TH.size3());
@@ -869,29 +959,6 @@ namespace HeatBalanceSurfaceManager {
             }
 
         } // ...end of surfaces DO loop for initializing temperature history terms for the surface heat balances
-
-        // Zero out all of the radiant system heat balance coefficient arrays
-        RadSysTiHBConstCoef = 0.0;
-        RadSysTiHBToutCoef = 0.0;
-        RadSysTiHBQsrcCoef = 0.0;
-        RadSysToHBConstCoef = 0.0;
-        RadSysToHBTinCoef = 0.0;
-        RadSysToHBQsrcCoef = 0.0;
-
-        QRadSysSource = 0.0;
-        QPVSysSource = 0.0;
-        QHTRadSysSurf = 0.0;
-        QHWBaseboardSurf = 0.0;
-        QSteamBaseboardSurf = 0.0;
-        QElecBaseboardSurf = 0.0;
-        QCoolingPanelSurf = 0.0;
-        QPoolSurfNumerator = 0.0;
-        PoolHeatTransCoefs = 0.0;
-
-        if (ZoneSizingCalc) GatherComponentLoadsSurfAbsFact();
-
-        if (InitSurfaceHeatBalancefirstTime) DisplayString("Completed Initializing Surface Heat Balance");
-        InitSurfaceHeatBalancefirstTime = false;
     }
 
     void GatherForPredefinedReport()
@@ -1486,6 +1553,11 @@ namespace HeatBalanceSurfaceManager {
         QH.dimension(2, MaxCTFTerms, TotSurfaces, 0.0);
         THM.dimension(2, MaxCTFTerms, TotSurfaces, 0.0);
         QHM.dimension(2, MaxCTFTerms, TotSurfaces, 0.0);
+        SurfCTFConstr.dimension(TotSurfaces, 0);
+        SurfCTFCross.dimension({1, TotSurfaces}, {0, MaxCTFTerms - 1}, 0.0);
+        SurfCTFFlux.dimension({1, TotSurfaces}, {0, MaxCTFTerms - 1}, 0.0);
+        SurfCTFInside.dimension({1, TotSurfaces}, {0, MaxCTFTerms - 1}, 0.0);
+        SurfCTFOutside.dimension({1, TotSurfaces}, {0, MaxCTFTerms - 1}, 0.0);
         if (AnyConstructInternalSourceInInput) {
             TempSource.dimension(TotSurfaces, 0.0);
             TempUserLoc.dimension(TotSurfaces, 0.0);
@@ -3041,10 +3113,11 @@ namespace HeatBalanceSurfaceManager {
                                         // Beam solar on outside of frame
                                         FrIncSolarOut += (BeamFrHorFaceInc + BeamFrVertFaceInc) * FrProjOut;
                                         if (FrProjIn > 0.0) {
-                                            TransGl = POLYF(CosInc, Construct(ConstrNum).TransSolBeamCoef);
+                                            TransGl = POLYF(CosInc, Construct(ConstrNum).TransSolBeamCoef, Construct(ConstrNum).TransSolBeamTable);
                                             TransDiffGl = Construct(ConstrNum).TransDiff;
                                             if (ShadeFlag == SwitchableGlazing) { // Switchable glazing
-                                                TransGlSh = POLYF(CosInc, Construct(ConstrNumSh).TransSolBeamCoef);
+                                                TransGlSh = POLYF(CosInc, Construct(ConstrNumSh).TransSolBeamCoef,
+                                                                  Construct(ConstrNumSh).TransSolBeamTable);
                                                 TransGl = InterpSw(SwitchFac, TransGl, TransGlSh);
                                                 TransDiffGlSh = Construct(ConstrNumSh).TransDiff;
                                                 TransDiffGl = InterpSw(SwitchFac, TransDiffGl, TransDiffGlSh);
@@ -3116,10 +3189,11 @@ namespace HeatBalanceSurfaceManager {
                                         DivIncSolarOutBm = BeamFaceInc + BeamDivHorFaceInc + BeamDivVertFaceInc;
                                         DivIncSolarOutDif = DifSolarFaceInc * (1.0 + SurfaceWindow(SurfNum).ProjCorrDivOut);
                                         if (DivProjIn > 0.0) {
-                                            TransGl = POLYF(CosInc, Construct(ConstrNum).TransSolBeamCoef);
+                                            TransGl = POLYF(CosInc, Construct(ConstrNum).TransSolBeamCoef, Construct(ConstrNum).TransSolBeamTable);
                                             TransDiffGl = Construct(ConstrNum).TransDiff;
                                             if (ShadeFlag == SwitchableGlazing) { // Switchable glazing
-                                                TransGlSh = POLYF(CosInc, Construct(ConstrNumSh).TransSolBeamCoef);
+                                                TransGlSh = POLYF(CosInc, Construct(ConstrNumSh).TransSolBeamCoef,
+                                                                  Construct(ConstrNumSh).TransSolBeamTable);
                                                 TransGl = InterpSw(SwitchFac, TransGl, TransGlSh);
                                                 TransDiffGlSh = Construct(ConstrNumSh).TransDiff;
                                                 TransDiffGl = InterpSw(SwitchFac, TransDiffGl, TransDiffGlSh);
@@ -4071,6 +4145,7 @@ namespace HeatBalanceSurfaceManager {
         //       AUTHOR         Legacy Code
         //       DATE WRITTEN
         //       MODIFIED       Jun 2007 - Lawrie - Speed enhancements.
+        //                      October 2026, reuse the factors while their inputs are unchanged
         //       RE-ENGINEERED  Winkelmann, Lawrie
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -4078,7 +4153,10 @@ namespace HeatBalanceSurfaceManager {
         // interzone windows.
 
         // METHODOLOGY EMPLOYED:
-        // na
+        // The factors depend only on the diffuse transmittance of the interzone windows and on VMULT of
+        // the zones they are in. Those change with shading and EMS construction overrides, so they are
+        // collected every time step and the factors are recomputed only when any of them differ from the
+        // values behind the current factors.
 
         // REFERENCES:
         // na
@@ -4101,10 +4179,6 @@ namespace HeatBalanceSurfaceManager {
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
         static Array2D<Real64> D;
         int SurfNum;
-        int IZ;
-        int JZ;
-        int KZ;
-        int LZ;
         int MZ;
         int NZ;
 
@@ -4112,26 +4186,46 @@ namespace HeatBalanceSurfaceManager {
             FractDifShortZtoZ.allocate(NumberOfZones, NumberOfZones);
             RecDifShortFromZ.allocate(NumberOfZones);
             D.allocate(NumberOfZones, NumberOfZones);
+            InterZoneWindowSurfs.clear();
+            for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+                if (!Surface(SurfNum).HeatTransSurf) continue;
+                if (Surface(SurfNum).ExtBoundCond <= 0) continue;
+                if (Surface(SurfNum).ExtBoundCond == SurfNum) continue;
+                if (!Zone(Surface(SurfNum).Zone).HasInterZoneWindow) continue;
+                InterZoneWindowSurfs.push_back(SurfNum);
+            }
+            DifSolExcCurrent = false;
+        }
+
+        //      IF (.not. ANY(Zone%HasInterZoneWindow)) RETURN  ! this caused massive diffs
+        if (KickOffSimulation || KickOffSizing) {
+            RecDifShortFromZ = false;
+            FractDifShortZtoZ = 0.0;
+            DifSolExcCurrent = false;
+            return;
+        }
+
+        DifSolExcNewInputs.clear();
+        for (int const WinSurfNum : InterZoneWindowSurfs) {
+            DifSolExcNewInputs.push_back(Construct(Surface(WinSurfNum).Construction).TransDiff);
+            DifSolExcNewInputs.push_back(VMULT(Surface(WinSurfNum).Zone));
         }
+        if (DifSolExcCurrent && DifSolExcNewInputs == DifSolExcInputs) return;
+        DifSolExcInputs.swap(DifSolExcNewInputs);
+        DifSolExcCurrent = true;
 
         RecDifShortFromZ = false;
         FractDifShortZtoZ = 0.0;
         D.to_identity();
 
-        //      IF (.not. ANY(Zone%HasInterZoneWindow)) RETURN  ! this caused massive diffs
-        if (KickOffSimulation || KickOffSizing) return;
         //            Compute fraction transmitted in one pass.
 
-        for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
-            if (!Surface(SurfNum).HeatTransSurf) continue;
-            if (Surface(SurfNum).ExtBoundCond <= 0) continue;
-            if (Surface(SurfNum).ExtBoundCond == SurfNum) continue;
-            if (Construct(Surface(SurfNum).Construction).TransDiff <= 0.0) continue;
-
-            NZ = Surface(SurfNum).Zone;
-            if (!Zone(NZ).HasInterZoneWindow) continue;
-            MZ = Surface(Surface(SurfNum).ExtBoundCond).Zone;
-            FractDifShortZtoZ(NZ, MZ) += Construct(Surface(SurfNum).Construction).TransDiff * VMULT(NZ) * Surface(SurfNum).Area;
+        for (int const WinSurfNum : InterZoneWindowSurfs) {
+            if (Construct(Surface(WinSurfNum).Construction).TransDiff <= 0.0) continue;
+
+            NZ = Surface(WinSurfNum).Zone;
+            MZ = Surface(Surface(WinSurfNum).ExtBoundCond).Zone;
+            FractDifShortZtoZ(NZ, MZ) += Construct(Surface(WinSurfNum).Construction).TransDiff * VMULT(NZ) * Surface(WinSurfNum).Area;
             if (VMULT(NZ) != 0.0) RecDifShortFromZ(NZ) = true;
         }
         //          Compute fractions for multiple passes.
@@ -4165,31 +4259,31 @@ namespace HeatBalanceSurfaceManager {
 
         //           Compute fractions for multiple zones.
 
-        for (IZ = 1; IZ <= NumberOfZones; ++IZ) {
-            if (!RecDifShortFromZ(IZ)) continue;
+        std::vector<int> RecZones; // Zones that receive diffuse short-wave radiation from another zone
+        for (NZ = 1; NZ <= NumberOfZones; ++NZ) {
+            if (RecDifShortFromZ(NZ)) RecZones.push_back(NZ);
+        }
 
-            for (JZ = 1; JZ <= NumberOfZones; ++JZ) {
-                if (!RecDifShortFromZ(JZ)) continue;
+        for (int const IZ : RecZones) {
+
+            for (int const JZ : RecZones) {
                 if (IZ == JZ) continue;
                 if (D(IZ, JZ) == 0.0) continue;
 
-                for (KZ = 1; KZ <= NumberOfZones; ++KZ) {
-                    if (!RecDifShortFromZ(KZ)) continue;
+                for (int const KZ : RecZones) {
                     if (IZ == KZ) continue;
                     if (JZ == KZ) continue;
                     if (D(JZ, KZ) == 0.0) continue;
                     FractDifShortZtoZ(IZ, KZ) += D(JZ, KZ) * D(IZ, JZ);
 
-                    for (LZ = 1; LZ <= NumberOfZones; ++LZ) {
-                        if (!RecDifShortFromZ(LZ)) continue;
+                    for (int const LZ : RecZones) {
                         if (IZ == LZ) continue;
                         if (JZ == LZ) continue;
                         if (KZ == LZ) continue;
                         if (D(KZ, LZ) == 0.0) continue;
                         FractDifShortZtoZ(IZ, LZ) += D(KZ, LZ) * D(JZ, KZ) * D(IZ, JZ);
 
-                        for (MZ = 1; MZ <= NumberOfZones; ++MZ) {
-                            if (!RecDifShortFromZ(MZ)) continue;
+                        for (int const MZ : RecZones) {
                             if (IZ == MZ) continue;
                             if (JZ == MZ) continue;
                             if (KZ == MZ) continue;
@@ -4617,6 +4711,12 @@ namespace HeatBalanceSurfaceManager {
         static Array1D<Real64> Tuser1;   // Temperature at the user specified location (during first time step/series)
         static Array1D<Real64> SumTime;  // Amount of time that has elapsed from start of master history to
         // the current time step
+        static Array1D<Real64> SumSteps;      // Fraction of the construction time step elapsed, for interpolated histories
+        static Array1D_int HistTermNumLast;  // Last history term updated for each surface
+        static Array1D_int HistUpdateMode;   // How the histories of each surface are updated this time step
+        int const HistUpdate_None(0);        // Surface histories are not updated
+        int const HistUpdate_Shift(1);       // Master histories are shifted and copied
+        int const HistUpdate_Interpolate(2); // Histories are interpolated from the master histories
 
         // FLOW:
 
@@ -4639,6 +4739,9 @@ namespace HeatBalanceSurfaceManager {
             TempInt1.dimension(TotSurfaces, 0.0);
             TempExt1.dimension(TotSurfaces, 0.0);
             SumTime.dimension(TotSurfaces, 0.0);
+            SumSteps.dimension(TotSurfaces, 0.0);
+            HistTermNumLast.dimension(TotSurfaces, 0);
+            HistUpdateMode.dimension(TotSurfaces, 0);
             if (AnyConstructInternalSourceInInput) {
                 Qsrc1.dimension(TotSurfaces, 0.0);
                 Tsrc1.dimension(TotSurfaces, 0.0);
@@ -4747,9 +4850,15 @@ namespace HeatBalanceSurfaceManager {
 
         // SHIFT TEMPERATURE AND FLUX HISTORIES:
         // SHIFT AIR TEMP AND FLUX SHIFT VALUES WHEN AT BOTTOM OF ARRAY SPACE.
+        // The TH/QH histories are stored with the surface index varying fastest, so the older history terms are shifted
+        // or interpolated one history term plane at a time below (unit stride over the surfaces) instead of surface by
+        // surface (a TotSurfaces stride between consecutive terms).  The source/sink histories are (SurfNum,Term) and
+        // are still shifted per surface.
+        int MaxHistTermNum(0); // Highest history term updated this time step over all surfaces
         for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) { // Loop through all (heat transfer) surfaces...
             auto const &surface(Surface(SurfNum));
 
+            HistUpdateMode(SurfNum) = HistUpdate_None;
             if (surface.Class == SurfaceClass_Window || surface.Class == SurfaceClass_TDD_Dome || !surface.HeatTransSurf) continue;
             if ((surface.HeatTransferAlgorithm != HeatTransferModel_CTF) && (surface.HeatTransferAlgorithm != HeatTransferModel_EMPD) &&
                 (surface.HeatTransferAlgorithm != HeatTransferModel_TDD))
@@ -4761,63 +4870,27 @@ namespace HeatBalanceSurfaceManager {
             ++SUMH(SurfNum);
             SumTime(SurfNum) = double(SUMH(SurfNum)) * TimeStepZone;
 
+            HistTermNumLast(SurfNum) = (construct.NumCTFTerms > 1) ? construct.NumCTFTerms + 1 : 2;
+            MaxHistTermNum = max(MaxHistTermNum, HistTermNumLast(SurfNum));
+
             if (SUMH(SurfNum) == construct.NumHistories) {
 
                 SUMH(SurfNum) = 0;
+                HistUpdateMode(SurfNum) = HistUpdate_Shift;
 
-                if (construct.NumCTFTerms > 1) {
+                if (construct.NumCTFTerms > 1 && construct.SourceSinkPresent) {
                     int const numCTFTerms(construct.NumCTFTerms);
-                    for (SideNum = 1; SideNum <= 2; ++SideNum) { // Tuned Index order switched for cache friendliness
-                        auto l(THM.index(SideNum, numCTFTerms, SurfNum));
-                        auto const li(THM.size3());
-                        auto l1(l + li);
-                        for (HistTermNum = numCTFTerms + 1; HistTermNum >= 3; --HistTermNum, l1 = l, l -= li) { // Tuned Linear indexing
-                            // TH( SideNum, HistTermNum, SurfNum ) = THM( SideNum, HistTermNum, SurfNum ) = THM( SideNum, HistTermNum - 1, SurfNum );
-                            // QH( SideNum, HistTermNum, SurfNum ) = QHM( SideNum, HistTermNum, SurfNum ) = QHM( SideNum, HistTermNum - 1, SurfNum );
-                            TH[l1] = THM[l1] = THM[l];
-                            QH[l1] = QHM[l1] = QHM[l];
-                        }
-                    }
-                    if (construct.SourceSinkPresent) {
-                        auto m(TsrcHistM.index(SurfNum, numCTFTerms));
-                        auto m1(m + 1);
-                        for (HistTermNum = numCTFTerms + 1; HistTermNum >= 3; --HistTermNum, --m, --m1) { // Tuned Linear indexing
-                            // TsrcHist( SurfNum, HistTerm ) = TsrcHistM( SurfNum, HHistTerm ) = TsrcHistM( SurfNum, HistTermNum - 1 );
-                            // QsrcHist( SurfNum, HistTerm ) = QsrcHistM( SurfNum, HHistTerm ) = QsrcHistM( SurfNum, HistTermNum - 1 );
-                            TsrcHist[m1] = TsrcHistM[m1] = TsrcHistM[m];
-                            QsrcHist[m1] = QsrcHistM[m1] = QsrcHistM[m];
-                            TuserHist[m1] = TuserHistM[m1] = TuserHistM[m];
-                        }
+                    auto m(TsrcHistM.index(SurfNum, numCTFTerms));
+                    auto m1(m + 1);
+                    for (HistTermNum = numCTFTerms + 1; HistTermNum >= 3; --HistTermNum, --m, --m1) { // Tuned Linear indexing
+                        // TsrcHist( SurfNum, HistTerm ) = TsrcHistM( SurfNum, HHistTerm ) = TsrcHistM( SurfNum, HistTermNum - 1 );
+                        // QsrcHist( SurfNum, HistTerm ) = QsrcHistM( SurfNum, HHistTerm ) = QsrcHistM( SurfNum, HistTermNum - 1 );
+                        TsrcHist[m1] = TsrcHistM[m1] = TsrcHistM[m];
+                        QsrcHist[m1] = QsrcHistM[m1] = QsrcHistM[m];
+                        TuserHist[m1] = TuserHistM[m1] = TuserHistM[m];
                     }
                 }
 
-                // Tuned Linear indexing
-                // THM( 1, 2, SurfNum ) = TempExt1( SurfNum );
-                // THM( 2, 2, SurfNum ) = TempInt1( SurfNum );
-                // TsrcHistM( SurfNum, 2 ) = Tsrc1( SurfNum );
-                // QHM( 1, 2, SurfNum ) = QExt1( SurfNum );
-                // QHM( 2, 2, SurfNum ) = QInt1( SurfNum );
-                // QsrcHistM( SurfNum, 2 ) = Qsrc1( SurfNum );
-                //
-                // TH( 1, 2, SurfNum ) = THM( 1, 2, SurfNum );
-                // TH( 2, 2, SurfNum ) = THM( 2, 2, SurfNum );
-                // TsrcHist( SurfNum, 2 ) = TsrcHistM( SurfNum, 2 );
-                // QH( 1, 2, SurfNum ) = QHM( 1, 2, SurfNum );
-                // QH( 2, 2, SurfNum ) = QHM( 2, 2, SurfNum );
-                // QsrcHist( SurfNum, 2 ) = QsrcHistM( SurfNum, 2 );
-
-                auto const l21(TH.index(1, 2, SurfNum)); // Linear index
-                auto const l22(TH.index(2, 2, SurfNum)); // Linear index
-                THM[l21] = TempExt1(SurfNum);
-                THM[l22] = TempInt1(SurfNum);
-                QHM[l21] = QExt1(SurfNum);
-                QHM[l22] = QInt1(SurfNum);
-
-                TH[l21] = THM[l21];
-                TH[l22] = THM(2, 2, SurfNum);
-                QH[l21] = QHM[l21];
-                QH[l22] = QHM(2, 2, SurfNum);
-
                 if (construct.SourceSinkPresent) {
                     TsrcHistM(SurfNum, 2) = Tsrc1(SurfNum);
                     TuserHistM(SurfNum, 2) = Tuser1(SurfNum);
@@ -4830,54 +4903,27 @@ namespace HeatBalanceSurfaceManager {
             } else {
 
                 Real64 const sum_steps(SumTime(SurfNum) / construct.CTFTimeStep);
-                if (construct.NumCTFTerms > 1) {
+                SumSteps(SurfNum) = sum_steps;
+                HistUpdateMode(SurfNum) = HistUpdate_Interpolate;
+
+                if (construct.NumCTFTerms > 1 && construct.SourceSinkPresent) {
                     int const numCTFTerms(construct.NumCTFTerms);
-                    for (SideNum = 1; SideNum <= 2; ++SideNum) { // Tuned Index order switched for cache friendliness
-                        auto l(THM.index(SideNum, numCTFTerms, SurfNum));
-                        auto const s3(THM.size3());
-                        auto l1(l + s3);
-                        for (HistTermNum = numCTFTerms + 1; HistTermNum >= 3; --HistTermNum, l1 = l, l -= s3) { // Tuned Linear indexing
-                            // Real64 const THM_l1( THM( SideNum, HistTermNum, SurfNum ) );
-                            // TH( SideNum, HistTermNum, SurfNum ) = THM_l1 - ( THM_l1 - THM( SideNum, HistTermNum - 1, SurfNum ) ) * sum_steps;
-                            // Real64 const QHM_l1( QHM( SideNum, HistTermNum, SurfNum ) );
-                            // QH( SideNum, HistTermNum, SurfNum ) = QHM_l1 - ( QHM_l1 - QHM( SideNum, HistTermNum - 1, SurfNum ) ) * sum_steps;
-                            Real64 const THM_l1(THM[l1]);
-                            TH[l1] = THM_l1 - (THM_l1 - THM[l]) * sum_steps;
-                            Real64 const QHM_l1(QHM[l1]);
-                            QH[l1] = QHM_l1 - (QHM_l1 - QHM[l]) * sum_steps;
-                        }
-                    }
-                    if (construct.SourceSinkPresent) {
-                        auto m(TsrcHistM.index(SurfNum, numCTFTerms));
-                        auto m1(m + 1);
-                        for (HistTermNum = numCTFTerms + 1; HistTermNum >= 3; --HistTermNum, --m, --m1) { // Tuned Linear indexing [ l ] == ()
-                            // Real64 const TsrcHistM_elem( TsrcHistM( SurfNum, HistTermNum ) );
-                            // TsrcHist( SurfNum, HistTermNum ) = TsrcHistM_elem - ( TsrcHistM_elem - TsrcHistM( SurfNum, HistTermNum - 1 ) ) *
-                            // sum_steps;  Real64 const QsrcHistM_elem( QsrcHistM( SurfNum, HistTermNum ) );  QsrcHist( SurfNum, HistTermNum ) =
-                            // QsrcHistM_elem - ( QsrcHistM_elem - QsrcHistM( SurfNum, HistTermNum - 1 ) ) * sum_steps;
-                            Real64 const TsrcHistM_m1(TsrcHistM[m1]);
-                            TsrcHist[m1] = TsrcHistM_m1 - (TsrcHistM_m1 - TsrcHistM[m]) * sum_steps;
-                            Real64 const QsrcHistM_m1(QsrcHistM[m1]);
-                            QsrcHist[m1] = QsrcHistM_m1 - (QsrcHistM_m1 - QsrcHistM[m]) * sum_steps;
-                            Real64 const TuserHistM_m1(TuserHistM[m1]);
-                            TuserHist[m1] = TuserHistM_m1 - (TuserHistM_m1 - TuserHistM[m]) * sum_steps;
-                        }
+                    auto m(TsrcHistM.index(SurfNum, numCTFTerms));
+                    auto m1(m + 1);
+                    for (HistTermNum = numCTFTerms + 1; HistTermNum >= 3; --HistTermNum, --m, --m1) { // Tuned Linear indexing [ l ] == ()
+                        // Real64 const TsrcHistM_elem( TsrcHistM( SurfNum, HistTermNum ) );
+                        // TsrcHist( SurfNum, HistTermNum ) = TsrcHistM_elem - ( TsrcHistM_elem - TsrcHistM( SurfNum, HistTermNum - 1 ) ) *
+                        // sum_steps;  Real64 const QsrcHistM_elem( QsrcHistM( SurfNum, HistTermNum ) );  QsrcHist( SurfNum, HistTermNum ) =
+                        // QsrcHistM_elem - ( QsrcHistM_elem - QsrcHistM( SurfNum, HistTermNum - 1 ) ) * sum_steps;
+                        Real64 const TsrcHistM_m1(TsrcHistM[m1]);
+                        TsrcHist[m1] = TsrcHistM_m1 - (TsrcHistM_m1 - TsrcHistM[m]) * sum_steps;
+                        Real64 const QsrcHistM_m1(QsrcHistM[m1]);
+                        QsrcHist[m1] = QsrcHistM_m1 - (QsrcHistM_m1 - QsrcHistM[m]) * sum_steps;
+                        Real64 const TuserHistM_m1(TuserHistM[m1]);
+                        TuserHist[m1] = TuserHistM_m1 - (TuserHistM_m1 - TuserHistM[m]) * sum_steps;
                     }
                 }
 
-                // Tuned Linear indexing
-                // TH( 1, 2, SurfNum ) = THM( 1, 2, SurfNum ) - ( THM( 1, 2, SurfNum ) - TempExt1( SurfNum ) ) * sum_steps;
-                // TH( 2, 2, SurfNum ) = THM( 2, 2, SurfNum ) - ( THM( 2, 2, SurfNum ) - TempInt1( SurfNum ) ) * sum_steps;
-                // QH( 1, 2, SurfNum ) = QHM( 1, 2, SurfNum ) - ( QHM( 1, 2, SurfNum ) - QExt1( SurfNum ) ) * sum_steps;
-                // QH( 2, 2, SurfNum ) = QHM( 2, 2, SurfNum ) - ( QHM( 2, 2, SurfNum ) - QInt1( SurfNum ) ) * sum_steps;
-
-                auto const l21(TH.index(1, 2, SurfNum)); // Linear index
-                auto const l22(TH.index(2, 2, SurfNum)); // Linear index
-                TH[l21] = THM[l21] - (THM[l21] - TempExt1(SurfNum)) * sum_steps;
-                TH[l22] = THM[l22] - (THM[l22] - TempInt1(SurfNum)) * sum_steps;
-                QH[l21] = QHM[l21] - (QHM[l21] - QExt1(SurfNum)) * sum_steps;
-                QH[l22] = QHM[l22] - (QHM[l22] - QInt1(SurfNum)) * sum_steps;
-
                 // Tuned Linear indexing
                 // TsrcHist( SurfNum, 2 ) = TsrcHistM( SurfNum, 2 ) - ( TsrcHistM( SurfNum, 2 ) - Tsrc1( SurfNum ) ) * sum_steps;
                 // QsrcHist( SurfNum, 2 ) = QsrcHistM( SurfNum, 2 ) - ( QsrcHistM( SurfNum, 2 ) - Qsrc1( SurfNum ) ) * sum_steps;
@@ -4891,6 +4937,68 @@ namespace HeatBalanceSurfaceManager {
             }
 
         } // ...end of loop over all (heat transfer) surfaces
+
+        // Shift or interpolate history terms 3 and up, oldest term first so each term still reads the previous master value
+        auto const s3(THM.size3());
+        for (HistTermNum = MaxHistTermNum; HistTermNum >= 3; --HistTermNum) {
+            for (SideNum = 1; SideNum <= 2; ++SideNum) {
+                auto l(THM.index(SideNum, HistTermNum - 1, 1)); // [ l ] == ( SideNum, HistTermNum - 1, SurfNum )
+                auto l1(l + s3);                                 // [ l1 ] == ( SideNum, HistTermNum, SurfNum )
+                for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum, ++l, ++l1) {
+                    if (HistTermNum > HistTermNumLast(SurfNum)) continue;
+                    if (HistUpdateMode(SurfNum) == HistUpdate_Shift) {
+                        // TH( SideNum, HistTermNum, SurfNum ) = THM( SideNum, HistTermNum, SurfNum ) = THM( SideNum, HistTermNum - 1, SurfNum );
+                        // QH( SideNum, HistTermNum, SurfNum ) = QHM( SideNum, HistTermNum, SurfNum ) = QHM( SideNum, HistTermNum - 1, SurfNum );
+                        TH[l1] = THM[l1] = THM[l];
+                        QH[l1] = QHM[l1] = QHM[l];
+                    } else if (HistUpdateMode(SurfNum) == HistUpdate_Interpolate) {
+                        Real64 const sum_steps(SumSteps(SurfNum));
+                        Real64 const THM_l1(THM[l1]);
+                        TH[l1] = THM_l1 - (THM_l1 - THM[l]) * sum_steps;
+                        Real64 const QHM_l1(QHM[l1]);
+                        QH[l1] = QHM_l1 - (QHM_l1 - QHM[l]) * sum_steps;
+                    }
+                }
+            }
+        }
+
+        // Update the most recent history term from the first time step/series values
+        for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+            auto const l21(TH.index(1, 2, SurfNum)); // Linear index
+            auto const l22(TH.index(2, 2, SurfNum)); // Linear index
+            if (HistUpdateMode(SurfNum) == HistUpdate_Shift) {
+                // Tuned Linear indexing
+                // THM( 1, 2, SurfNum ) = TempExt1( SurfNum );
+                // THM( 2, 2, SurfNum ) = TempInt1( SurfNum );
+                // QHM( 1, 2, SurfNum ) = QExt1( SurfNum );
+                // QHM( 2, 2, SurfNum ) = QInt1( SurfNum );
+                //
+                // TH( 1, 2, SurfNum ) = THM( 1, 2, SurfNum );
+                // TH( 2, 2, SurfNum ) = THM( 2, 2, SurfNum );
+                // QH( 1, 2, SurfNum ) = QHM( 1, 2, SurfNum );
+                // QH( 2, 2, SurfNum ) = QHM( 2, 2, SurfNum );
+                THM[l21] = TempExt1(SurfNum);
+                THM[l22] = TempInt1(SurfNum);
+                QHM[l21] = QExt1(SurfNum);
+                QHM[l22] = QInt1(SurfNum);
+
+                TH[l21] = THM[l21];
+                TH[l22] = THM[l22];
+                QH[l21] = QHM[l21];
+                QH[l22] = QHM[l22];
+            } else if (HistUpdateMode(SurfNum) == HistUpdate_Interpolate) {
+                // Tuned Linear indexing
+                // TH( 1, 2, SurfNum ) = THM( 1, 2, SurfNum ) - ( THM( 1, 2, SurfNum ) - TempExt1( SurfNum ) ) * sum_steps;
+                // TH( 2, 2, SurfNum ) = THM( 2, 2, SurfNum ) - ( THM( 2, 2, SurfNum ) - TempInt1( SurfNum ) ) * sum_steps;
+                // QH( 1, 2, SurfNum ) = QHM( 1, 2, SurfNum ) - ( QHM( 1, 2, SurfNum ) - QExt1( SurfNum ) ) * sum_steps;
+                // QH( 2, 2, SurfNum ) = QHM( 2, 2, SurfNum ) - ( QHM( 2, 2, SurfNum ) - QInt1( SurfNum ) ) * sum_steps;
+                Real64 const sum_steps(SumSteps(SurfNum));
+                TH[l21] = THM[l21] - (THM[l21] - TempExt1(SurfNum)) * sum_steps;
+                TH[l22] = THM[l22] - (THM[l22] - TempInt1(SurfNum)) * sum_steps;
+                QH[l21] = QHM[l21] - (QHM[l21] - QExt1(SurfNum)) * sum_steps;
+                QH[l22] = QHM[l22] - (QHM[l22] - QInt1(SurfNum)) * sum_steps;
+            }
+        }
     }
 
     void CalculateZoneMRT(Optional_int_const ZoneToResimulate) // if passed in, then only calculate surfaces that have this zone
@@ -5160,6 +5268,32 @@ namespace HeatBalanceSurfaceManager {
 
     // Formerly EXTERNAL SUBROUTINES (heavily related to HeatBalanceSurfaceManager) now moved into namespace
 
+    std::vector<int> const &OutsideHeatBalanceSurfaces(int const ZoneToResimulate) // 0 for all zones
+    {
+        // The surfaces that get an outside face heat balance, in surface order. They do not change during the simulation,
+        // so they are listed once. Radiant systems resimulate one zone many times per time step, and for them the list
+        // holds only the surfaces of that zone or adjacent to it.
+
+        if (OutsideHBSurfsByZone.empty()) {
+            OutsideHBSurfsByZone.resize(NumOfZones);
+            for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+                int const ZoneNum = Surface(SurfNum).Zone;
+                if (!Surface(SurfNum).HeatTransSurf || ZoneNum == 0) continue; // Skip non-heat transfer surfaces
+
+                if (Surface(SurfNum).Class == SurfaceClass_Window) continue;
+                // Interior windows in partitions use "normal" heat balance calculations
+                // For rest, Outside surface temp of windows not needed in Window5 calculation approach.
+                // Window layer temperatures are calculated in CalcHeatBalanceInsideSurf
+
+                OutsideHBSurfs.push_back(SurfNum);
+                OutsideHBSurfsByZone[ZoneNum - 1].push_back(SurfNum);
+                int const AdjZoneNum(allocated(AdjacentZoneToSurface) ? AdjacentZoneToSurface(SurfNum) : 0);
+                if (AdjZoneNum > 0 && AdjZoneNum != ZoneNum) OutsideHBSurfsByZone[AdjZoneNum - 1].push_back(SurfNum);
+            }
+        }
+        return (ZoneToResimulate > 0) ? OutsideHBSurfsByZone[ZoneToResimulate - 1] : OutsideHBSurfs;
+    }
+
     void CalcHeatBalanceOutsideSurf(Optional_int_const ZoneToResimulate) // if passed in, then only calculate surfaces that have this zone
     {
 
@@ -5174,6 +5308,7 @@ namespace HeatBalanceSurfaceManager {
         //                      Jul 2008 (P.Biddulph include calls to HAMT)
         //                      Jul 2011, M.J. Witte and C.O. Pedersen, add new fields to OSC for last T, max and min
         //                      Sep 2011 LKL/BG - resimulate only zones needing it for Radiant systems
+        //                      October 2026, loop over surface lists built once instead of filtering all surfaces
         //       RE-ENGINEERED  Mar 1998 (RKS)
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -5293,23 +5428,10 @@ namespace HeatBalanceSurfaceManager {
             CalcInteriorRadExchange(TH(2, 1, _), 0, NetLWRadToSurf, _, Outside);
         }
 
-        for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) { // Loop through all surfaces...
-
+        for (int const HBSurfNum : OutsideHeatBalanceSurfaces(present(ZoneToResimulate) ? int(ZoneToResimulate) : 0)) {
+            SurfNum = HBSurfNum;
             ZoneNum = Surface(SurfNum).Zone;
 
-            if (present(ZoneToResimulate)) {
-                if ((ZoneNum != ZoneToResimulate) && (AdjacentZoneToSurface(SurfNum) != ZoneToResimulate)) {
-                    continue; // skip surfaces that are not associated with this zone
-                }
-            }
-
-            if (!Surface(SurfNum).HeatTransSurf || ZoneNum == 0) continue; // Skip non-heat transfer surfaces
-
-            if (Surface(SurfNum).Class == SurfaceClass_Window) continue;
-            // Interior windows in partitions use "normal" heat balance calculations
-            // For rest, Outside surface temp of windows not needed in Window5 calculation approach.
-            // Window layer temperatures are calculated in CalcHeatBalanceInsideSurf
-
             // Initializations for this surface
             ConstrNum = Surface(SurfNum).Construction;
             HMovInsul = 0.0;
@@ -5889,13 +6011,16 @@ namespace HeatBalanceSurfaceManager {
         using DaylightingDevices::FindTDDPipe;
         using General::RoundSigDigits;
         using HeatBalanceHAMTManager::ManageHeatBalHAMT;
+        using HeatBalanceHAMTManager::ManageHeatBalHAMTSurfaces;
         using HeatBalanceHAMTManager::UpdateHeatBalHAMT;
         using HeatBalanceIntRadExchange::CalcInteriorRadExchange;
         using HeatBalanceMovableInsulation::EvalInsideMovableInsulation;
         using HeatBalanceSurfaceManager::CalculateZoneMRT;
         using HeatBalFiniteDiffManager::ManageHeatBalFiniteDiff;
+        using HeatBalFiniteDiffManager::ManageHeatBalFiniteDiffSurfaces;
         using HeatBalFiniteDiffManager::SurfaceFD;
         using MoistureBalanceEMPDManager::CalcMoistureBalanceEMPD;
+        using MoistureBalanceEMPDManager::ManageMoistureBalanceEMPDSurfaces;
         using MoistureBalanceEMPDManager::UpdateMoistureBalanceEMPD;
         using ScheduleManager::GetCurrentScheduleValue;
         using WindowManager::CalcWindowHeatBalance;
@@ -5968,6 +6093,11 @@ namespace HeatBalanceSurfaceManager {
         int OtherSideZoneNum; // Zone Number index for other side of an interzone partition HAMT
         static int WarmupSurfTemp;
         static int TimeStepInDay(0); // time step number
+        static Array1D_bool ThreadedInsideSurf; // Surfaces solved in the threaded pass of the inside heat balance
+        static Array1D_bool BatchedFDSurf;      // CondFD and HAMT surfaces solved in the batched pass of the inside heat balance
+        static Array1D<Real64> BatchedTempSurfOut; // Outside face temperature of the batched CondFD and HAMT surfaces
+        static Array1D_bool BatchedEMPDSurf;        // EMPD surfaces whose moisture balance is solved in the batched pass
+        static Array1D<Real64> BatchedTempSurfInSat; // Saturation temperature of the batched EMPD surfaces
 
         // FLOW:
         if (calcHeatBalanceInsideSurfFirstTime) {
@@ -6160,6 +6290,133 @@ namespace HeatBalanceSurfaceManager {
         }
 
         bool const useCondFDHTalg(any_eq(HeatTransferAlgosUsed, UseCondFD));
+
+        // Opaque CTF surfaces without a partition, movable insulation or embedded source only depend on values that are fixed
+        // within one iteration, so when more than one thread is requested they are solved zone by zone in a threaded pass.
+        // Each surface writes only its own entries and the convergence check stays serial, so results do not depend on the
+        // number of threads.
+        bool const useThreadedInsideSurf(DataSystemVariables::NumberIntRadThreads > 1);
+        std::vector<int> ThreadedSurfs;     // Surfaces solved in the threaded pass, grouped by zone
+        std::vector<int> ThreadedZoneFirst; // Index into ThreadedSurfs of the first surface of each zone group
+        if (useThreadedInsideSurf) {
+            if (ThreadedInsideSurf.size() != static_cast<std::size_t>(TotSurfaces)) ThreadedInsideSurf.dimension(TotSurfaces, false);
+            ThreadedInsideSurf = false;
+            ThreadedSurfs.reserve(nHTSurfToResimulate);
+            int LastZone(0);
+            for (std::vector<int>::size_type iHTSurfToResimulate = 0u; iHTSurfToResimulate < nHTSurfToResimulate; ++iHTSurfToResimulate) {
+                int const surfNum(HTSurfToResimulate[iHTSurfToResimulate]);
+                auto const &surface(Surface(surfNum));
+                if (surface.Class == SurfaceClass_TDD_Dome || surface.Class == SurfaceClass_Window || surface.Zone == 0) continue;
+                if (surface.ExtBoundCond == surfNum || surface.MaterialMovInsulInt > 0) continue;
+                if (surface.HeatTransferAlgorithm != HeatTransferModel_CTF || Construct(surface.Construction).SourceSinkPresent) continue;
+                if (surface.Zone != LastZone) {
+                    ThreadedZoneFirst.push_back(static_cast<int>(ThreadedSurfs.size()));
+                    LastZone = surface.Zone;
+                }
+                ThreadedSurfs.push_back(surfNum);
+                ThreadedInsideSurf(surfNum) = true;
+            }
+            ThreadedZoneFirst.push_back(static_cast<int>(ThreadedSurfs.size()));
+        }
+        int const nThreadedZones(static_cast<int>(ThreadedZoneFirst.size()) - 1);
+
+        // CondFD and HAMT surfaces are independent 1D solves given the boundary conditions of the iteration, so they are
+        // solved in a batched pass ahead of the serial loop.  CondFD interzone partitions update the other side's nodes and
+        // phase change materials keep their hysteresis state on the shared material, so those stay in the serial loop.
+        std::vector<int> BatchedCondFDSurfs; // CondFD surfaces solved in the batched pass
+        std::vector<int> BatchedHAMTSurfs;   // HAMT surfaces solved in the batched pass
+        if (useThreadedInsideSurf && (useCondFDHTalg || any_eq(HeatTransferAlgosUsed, UseHAMT))) {
+            if (BatchedFDSurf.size() != static_cast<std::size_t>(TotSurfaces)) {
+                BatchedFDSurf.dimension(TotSurfaces, false);
+                BatchedTempSurfOut.dimension(TotSurfaces, 0.0);
+            }
+            BatchedFDSurf = false;
+            for (std::vector<int>::size_type iHTSurfToResimulate = 0u; iHTSurfToResimulate < nHTSurfToResimulate; ++iHTSurfToResimulate) {
+                int const surfNum(HTSurfToResimulate[iHTSurfToResimulate]);
+                auto const &surface(Surface(surfNum));
+                if (surface.Class == SurfaceClass_TDD_Dome || surface.Class == SurfaceClass_Window || surface.Zone == 0) continue;
+                if (surface.MaterialMovInsulInt > 0) continue;
+                if (surface.HeatTransferAlgorithm == HeatTransferModel_HAMT) {
+                    BatchedHAMTSurfs.push_back(surfNum);
+                } else if (surface.HeatTransferAlgorithm == HeatTransferModel_CondFD) {
+                    if (surface.ExtBoundCond > 0 && surface.ExtBoundCond != surfNum) continue;
+                    auto const &construct(Construct(surface.Construction));
+                    bool hasPhaseChange(false);
+                    for (int Lay = 1; Lay <= construct.TotLayers; ++Lay) {
+                        if (Material(construct.LayerPoint(Lay)).phaseChange) hasPhaseChange = true;
+                    }
+                    if (hasPhaseChange) continue;
+                    BatchedCondFDSurfs.push_back(surfNum);
+                } else {
+                    continue;
+                }
+                BatchedFDSurf(surfNum) = true;
+            }
+        }
+
+        // The EMPD moisture balance of a surface only depends on its own moisture state and the start-of-iteration surface
+        // temperature, so it is solved in the same batched pass and the serial loop reuses the saturation temperature.
+        std::vector<int> BatchedEMPDSurfs; // EMPD surfaces whose moisture balance is solved in the batched pass
+        if (useThreadedInsideSurf && any_eq(HeatTransferAlgosUsed, UseEMPD)) {
+            if (BatchedEMPDSurf.size() != static_cast<std::size_t>(TotSurfaces)) {
+                BatchedEMPDSurf.dimension(TotSurfaces, false);
+                BatchedTempSurfInSat.dimension(TotSurfaces, 0.0);
+            }
+            BatchedEMPDSurf = false;
+            for (std::vector<int>::size_type iHTSurfToResimulate = 0u; iHTSurfToResimulate < nHTSurfToResimulate; ++iHTSurfToResimulate) {
+                int const surfNum(HTSurfToResimulate[iHTSurfToResimulate]);
+                auto const &surface(Surface(surfNum));
+                if (surface.Class == SurfaceClass_TDD_Dome || surface.Class == SurfaceClass_Window || surface.Zone == 0) continue;
+                if (surface.HeatTransferAlgorithm != HeatTransferModel_EMPD || surface.MaterialMovInsulInt > 0) continue;
+                BatchedEMPDSurfs.push_back(surfNum);
+                BatchedEMPDSurf(surfNum) = true;
+            }
+        }
+
+        // Same equations as the opaque CTF branch of the serial surface loop below
+        auto CalcThreadedInsideSurfTemp = [&](int const surfNum) {
+            auto const &surface(Surface(surfNum));
+            auto const &construct(Construct(surface.Construction));
+            Real64 &TH11(TH(1, 1, surfNum));
+            Real64 &TH12(TH(2, 1, surfNum));
+            Real64 const HConvIn_surf(HConvIn(surfNum));
+
+            Real64 const TempTerm(CTFConstInPart(surfNum) + QRadThermInAbs(surfNum) + QRadSWInAbs(surfNum) + QAdditionalHeatSourceInside(surfNum) +
+                                  HConvIn_surf * RefAirTemp(surfNum) + QHTRadSysSurf(surfNum) + QCoolingPanelSurf(surfNum) +
+                                  QHWBaseboardSurf(surfNum) + QSteamBaseboardSurf(surfNum) + QElecBaseboardSurf(surfNum) + NetLWRadToSurf(surfNum) +
+                                  (QRadSurfAFNDuct(surfNum) / TimeStepZoneSec));
+            Real64 const TempDiv(1.0 / (construct.CTFInside(0) + HConvIn_surf + IterDampConst));
+            if ((!surface.IsPool) ||
+                ((surface.IsPool) && (std::abs(QPoolSurfNumerator(surfNum)) < SmallNumber) && (std::abs(PoolHeatTransCoefs(surfNum)) < SmallNumber))) {
+                TempSurfInTmp(surfNum) = (TempTerm + IterDampConst * TempInsOld(surfNum) + construct.CTFCross(0) * TH11) * TempDiv;
+            } else { // surface is a pool and the pool has been simulated this time step
+                TempSurfInTmp(surfNum) = (CTFConstInPart(surfNum) + QPoolSurfNumerator(surfNum) + IterDampConst * TempInsOld(surfNum) +
+                                          construct.CTFCross(0) * TH11) /
+                                         (construct.CTFInside(0) + PoolHeatTransCoefs(surfNum) + IterDampConst);
+            }
+            if (zone_has_mixed_HT_models(surface.Zone))
+                TempSurfInTmp(surfNum) = max(MinSurfaceTempLimit, min(MaxSurfaceTempLimit, TempSurfInTmp(surfNum)));
+            TempSurfIn(surfNum) = TempSurfInTmp(surfNum);
+
+            TH12 = TempSurfInRep(surfNum) = TempSurfIn(surfNum);
+            TempSurfOut(surfNum) = TH11; // For reporting
+
+            auto const HConvInTemp_fac(-HConvIn_surf * (TempSurfIn(surfNum) - RefAirTemp(surfNum)));
+            QdotConvInRep(surfNum) = surface.Area * HConvInTemp_fac;
+            QdotConvInRepPerArea(surfNum) = HConvInTemp_fac;
+            QConvInReport(surfNum) = QdotConvInRep(surfNum) * TimeStepZoneSec;
+
+            if (ZoneSizingCalc && CompLoadReportIsReq && !WarmupFlag) {
+                int const timeStepInDay((HourOfDay - 1) * NumOfTimeStepInHour + TimeStep);
+                if (isPulseZoneSizing) {
+                    loadConvectedWithPulse(CurOverallSimDay, timeStepInDay, surfNum) = QdotConvInRep(surfNum);
+                } else {
+                    loadConvectedNormal(CurOverallSimDay, timeStepInDay, surfNum) = QdotConvInRep(surfNum);
+                    netSurfRadSeq(CurOverallSimDay, timeStepInDay, surfNum) = QdotRadNetSurfInRep(surfNum);
+                }
+            }
+        };
+
         Converged = false;
         while (!Converged) { // Start of main inside heat balance DO loop...
 
@@ -6189,6 +6446,30 @@ namespace HeatBalanceSurfaceManager {
                 InitInteriorConvectionCoeffs(TempSurfIn, ZoneToResimulate);
             }
 
+            if (!BatchedCondFDSurfs.empty() || !BatchedHAMTSurfs.empty() || !BatchedEMPDSurfs.empty()) {
+                // Same moisture boundary conditions as the serial loop below, which repeats them for these surfaces
+                std::size_t const nFDSurfs(BatchedCondFDSurfs.size() + BatchedHAMTSurfs.size());
+                for (std::size_t iSurf = 0u, nSurfs = nFDSurfs + BatchedEMPDSurfs.size(); iSurf < nSurfs; ++iSurf) {
+                    int const surfNum(iSurf < BatchedCondFDSurfs.size()
+                                          ? BatchedCondFDSurfs[iSurf]
+                                          : (iSurf < nFDSurfs ? BatchedHAMTSurfs[iSurf - BatchedCondFDSurfs.size()] : BatchedEMPDSurfs[iSurf - nFDSurfs]));
+                    auto const &surface(Surface(surfNum));
+                    Real64 const MAT_zone(MAT(surface.Zone));
+                    Real64 const ZoneAirHumRat_zone(max(ZoneAirHumRat(surface.Zone), 1.0e-5));
+                    Real64 const HConvIn_surf(HConvInFD(surfNum) = HConvIn(surfNum));
+                    RhoVaporAirIn(surfNum) =
+                        min(PsyRhovFnTdbWPb_fast(MAT_zone, ZoneAirHumRat_zone, OutBaroPress), PsyRhovFnTdbRh(MAT_zone, 1.0, HBSurfManInsideSurf));
+                    HMassConvInFD(surfNum) = HConvIn_surf / (PsyRhoAirFnPbTdbW_fast(OutBaroPress, MAT_zone, ZoneAirHumRat_zone) *
+                                                             PsyCpAirFnWTdb_fast(ZoneAirHumRat_zone, MAT_zone));
+                    if (surface.HeatTransferAlgorithm == HeatTransferModel_HAMT && surface.ExtBoundCond > 0 && surface.ExtBoundCond != surfNum) {
+                        TempOutsideAirFD(surfNum) = MAT(Surface(surface.ExtBoundCond).Zone); // HAMT other side zone air temperature
+                    }
+                }
+                ManageHeatBalFiniteDiffSurfaces(BatchedCondFDSurfs, TempSurfInTmp, BatchedTempSurfOut);
+                ManageHeatBalHAMTSurfaces(BatchedHAMTSurfs, TempSurfInTmp, BatchedTempSurfOut);
+                ManageMoistureBalanceEMPDSurfaces(BatchedEMPDSurfs, TempSurfInTmp, BatchedTempSurfInSat);
+            }
+
             for (std::vector<int>::size_type iHTSurfToResimulate = 0u; iHTSurfToResimulate < nHTSurfToResimulate;
                  ++iHTSurfToResimulate) {                          // Perform a heat balance on all of the relevant inside surfaces...
                 SurfNum = HTSurfToResimulate[iHTSurfToResimulate]; // Heat transfer surfaces only
@@ -6213,6 +6494,8 @@ namespace HeatBalanceSurfaceManager {
                 HMassConvInFD(SurfNum) = HConvIn_surf / (PsyRhoAirFnPbTdbW_fast(OutBaroPress, MAT_zone, ZoneAirHumRat_zone) *
                                                          PsyCpAirFnWTdb_fast(ZoneAirHumRat_zone, MAT_zone));
 
+                if (useThreadedInsideSurf && ThreadedInsideSurf(SurfNum)) continue; // Solved in the threaded pass below
+
                 // Perform heat balance on the inside face of the surface ...
                 // The following are possibilities here:
                 //   (a) the surface is a pool (no movable insulation, no source/sink, only CTF solution algorithm)
@@ -6235,7 +6518,11 @@ namespace HeatBalanceSurfaceManager {
                         surface.HeatTransferAlgorithm == HeatTransferModel_EMPD) { // Regular CTF Surface and/or EMPD surface
 
                         if (surface.HeatTransferAlgorithm == HeatTransferModel_EMPD) {
-                            CalcMoistureBalanceEMPD(SurfNum, TempSurfInTmp(SurfNum), MAT_zone, TempSurfInSat);
+                            if (useThreadedInsideSurf && BatchedEMPDSurf(SurfNum)) {
+                                TempSurfInSat = BatchedTempSurfInSat(SurfNum); // Solved in the batched pass above
+                            } else {
+                                CalcMoistureBalanceEMPD(SurfNum, TempSurfInTmp(SurfNum), MAT_zone, TempSurfInSat);
+                            }
                         }
                         // Pre-calculate a few terms
                         //
@@ -6309,11 +6596,14 @@ namespace HeatBalanceSurfaceManager {
 
                     } else if (surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT) {
 
-                        if (surface.HeatTransferAlgorithm == HeatTransferModel_HAMT)
+                        bool const batchedFD(useThreadedInsideSurf && BatchedFDSurf(SurfNum));
+                        if (batchedFD) TempSurfOutTmp = BatchedTempSurfOut(SurfNum); // Solved in the batched pass above
+
+                        if (surface.HeatTransferAlgorithm == HeatTransferModel_HAMT && !batchedFD)
                             ManageHeatBalHAMT(SurfNum, TempSurfInTmp(SurfNum), TempSurfOutTmp); // HAMT
 
                         if (surface.HeatTransferAlgorithm == HeatTransferModel_CondFD) {
-                            ManageHeatBalFiniteDiff(SurfNum, TempSurfInTmp(SurfNum), TempSurfOutTmp);
+                            if (!batchedFD) ManageHeatBalFiniteDiff(SurfNum, TempSurfInTmp(SurfNum), TempSurfOutTmp);
                             if (!SurfaceEnthalpyRead(SurfNum)) {
                                 if (ZnAirRpt.allocated()) {
                                     ZnAirRpt(ZoneNum).SumEnthalpyM = 0.0;
@@ -6345,7 +6635,11 @@ namespace HeatBalanceSurfaceManager {
                                 surface.HeatTransferAlgorithm == HeatTransferModel_EMPD) { // Regular CTF Surface and/or EMPD surface
 
                                 if (surface.HeatTransferAlgorithm == HeatTransferModel_EMPD) {
-                                    CalcMoistureBalanceEMPD(SurfNum, TempSurfInTmp(SurfNum), MAT_zone, TempSurfInSat);
+                                    if (useThreadedInsideSurf && BatchedEMPDSurf(SurfNum)) {
+                                        TempSurfInSat = BatchedTempSurfInSat(SurfNum); // Solved in the batched pass above
+                                    } else {
+                                        CalcMoistureBalanceEMPD(SurfNum, TempSurfInTmp(SurfNum), MAT_zone, TempSurfInSat);
+                                    }
                                 }
                                 // Pre-calculate a few terms
                                 Real64 const TempTerm(CTFConstInPart(SurfNum) + QRadThermInAbs(SurfNum) + QRadSWInAbs(SurfNum) +
@@ -6442,7 +6736,10 @@ namespace HeatBalanceSurfaceManager {
                             } else if (surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ||
                                        surface.HeatTransferAlgorithm == HeatTransferModel_HAMT) {
 
-                                if (surface.HeatTransferAlgorithm == HeatTransferModel_HAMT) {
+                                bool const batchedFD(useThreadedInsideSurf && BatchedFDSurf(SurfNum));
+                                if (batchedFD) {
+                                    TempSurfOutTmp = BatchedTempSurfOut(SurfNum); // Solved in the batched pass above
+                                } else if (surface.HeatTransferAlgorithm == HeatTransferModel_HAMT) {
                                     if (surface.ExtBoundCond > 0) {
                                         // HAMT get the correct other side zone zone air temperature --
                                         OtherSideSurfNum = surface.ExtBoundCond;
@@ -6453,7 +6750,7 @@ namespace HeatBalanceSurfaceManager {
                                     ManageHeatBalHAMT(SurfNum, TempSurfInTmp(SurfNum), TempSurfOutTmp);
                                 }
 
-                                if (surface.HeatTransferAlgorithm == HeatTransferModel_CondFD)
+                                if (surface.HeatTransferAlgorithm == HeatTransferModel_CondFD && !batchedFD)
                                     ManageHeatBalFiniteDiff(SurfNum, TempSurfInTmp(SurfNum), TempSurfOutTmp);
 
                                 TH11 = TempSurfOutTmp;
@@ -6695,6 +6992,24 @@ namespace HeatBalanceSurfaceManager {
 
             } // ...end of loop over all surfaces for inside heat balances
 
+            if (useThreadedInsideSurf) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(DataSystemVariables::NumberIntRadThreads)
+#endif
+                for (int iZone = 0; iZone < nThreadedZones; ++iZone) {
+                    for (int iSurf = ThreadedZoneFirst[iZone], eSurf = ThreadedZoneFirst[iZone + 1]; iSurf < eSurf; ++iSurf) {
+                        CalcThreadedInsideSurfTemp(ThreadedSurfs[iSurf]);
+                    }
+                }
+                // Temperature limit warnings are reported serially, in surface order
+                for (int const surfNum : ThreadedSurfs) {
+                    Real64 const TH12(TH(2, 1, surfNum));
+                    if ((TH12 > MaxSurfaceTempLimit) || (TH12 < MinSurfaceTempLimit)) {
+                        TestSurfTempCalcHeatBalanceInsideSurf(TH12, Surface(surfNum), Zone(Surface(surfNum).Zone), WarmupSurfTemp);
+                    }
+                }
+            }
+
             // Interzone surface updating: interzone surfaces have other side temperatures
             // which can vary as the simulation iterates through the inside heat
             // balance.  This block is intended to "lock" the opposite side (outside)
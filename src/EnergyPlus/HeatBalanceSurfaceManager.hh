@@ -48,6 +48,9 @@
 #ifndef HeatBalanceSurfaceManager_hh_INCLUDED
 #define HeatBalanceSurfaceManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Optional.hh>
 
@@ -98,6 +101,8 @@ namespace HeatBalanceSurfaceManager {
 
     void InitSurfaceHeatBalance();
 
+    void InitCTFConstantParts();
+
     void GatherForPredefinedReport();
 
     void AllocateSurfaceHeatBalArrays();
@@ -151,6 +156,8 @@ namespace HeatBalanceSurfaceManager {
 
     // Formerly EXTERNAL SUBROUTINES (heavily related to HeatBalanceSurfaceManager) but now moved into namespace HeatBalanceSurfaceManager
 
+    std::vector<int> const &OutsideHeatBalanceSurfaces(int const ZoneToResimulate); // 0 for all zones
+
     void CalcHeatBalanceOutsideSurf(Optional_int_const ZoneToResimulate = _); // if passed in, then only calculate surfaces that have this zone
 
     void CalcHeatBalanceInsideSurf(Optional_int_const ZoneToResimulate = _); // if passed in, then only calculate surfaces that have this zone
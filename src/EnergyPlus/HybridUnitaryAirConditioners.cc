@@ -48,6 +48,7 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <unordered_set>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -75,6 +76,7 @@
 #include <Fans.hh>
 #include <General.hh>
 #include <GeneralRoutines.hh>
+#include <GlobalNames.hh>
 #include <HybridEvapCoolingModel.hh>
 #include <InputProcessing/InputProcessor.hh>
 #include <NodeInputManager.hh>
@@ -451,6 +453,7 @@ namespace HybridUnitaryAirConditioners {
             CheckZoneHybridEvapName.dimension(NumZoneHybridEvap, true);
             ZoneHybridUnitaryAirConditioner.allocate(NumZoneHybridEvap);
 
+            std::unordered_set<std::string> UniqueHybridUnitaryNames;
             for (UnitLoop = 1; UnitLoop <= NumZoneHybridEvap; ++UnitLoop) {
                 inputProcessor->getObjectItem(CurrentModuleObject,
                                               UnitLoop,
@@ -466,8 +469,7 @@ namespace HybridUnitaryAirConditioners {
 
                 IsNotOK = false;
                 IsBlank = false;
-                UtilityRoutines::VerifyName(
-                    Alphas(1), ZoneHybridUnitaryAirConditioner, UnitLoop - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name");
+                GlobalNames::VerifyUniqueName(UniqueHybridUnitaryNames, Alphas(1), IsNotOK, IsBlank, CurrentModuleObject + " Name");
 
                 // A1, \field Name
                 ZoneHybridUnitaryAirConditioner(UnitLoop).Name = Alphas(1);
@@ -209,6 +209,76 @@ namespace IceThermalStorage {
     Array1D<DetailedIceStorageData> DetIceStor; // Derived type for detailed ice storage model
     Array1D<IceStorageMapping> IceStorageTypeMap;
 
+    // Functions
+    void clear_state()
+    {
+        ResetXForITSFlag = false;
+        ITSNomCap = 0.0;
+        InletNodeNum = 0;
+        OutletNodeNum = 0;
+        IceNum = 0;
+        NumIceStorages = 0;
+        IceStorageNotFound = false;
+        NumDetIceStorages = 0;
+        TotalIceStorages = 0;
+        UAIceCh = 0.0;
+        UAIceDisCh = 0.0;
+        HLoss = 0.0;
+        XCurIceFrac = 0.0;
+        U = 0.0;
+        Urate = 0.0;
+        ITSMassFlowRate = 0.0;
+        ITSInletTemp = 0.0;
+        ITSOutletTemp = 0.0;
+        ITSOutletSetPointTemp = 0.0;
+        ITSCoolingRate = 0.0;
+        ITSCoolingEnergy = 0.0;
+        ChillerOutletTemp = 0.0;
+        CheckEquipName.deallocate();
+        IceStorage.deallocate();
+        IceStorageReport.deallocate();
+        DetIceStor.deallocate();
+        IceStorageTypeMap.deallocate();
+    }
+
+    namespace {
+        // The tank solution of the detailed model depends only on the inlet and loop setpoint temperatures, the flow,
+        // the ice fractions and the system time step, which are usually the same for every plant iteration of a
+        // system time step.  A repeated call restores the saved solution instead of iterating on the curves again.
+        // The key holds the loop setpoint before it is clipped at the freezing temperature, since the load it
+        // implies still decides whether the tank has spare capacity.  An EMS override of the curve is never reused.
+        bool ReuseTankSolution(DetailedIceStorageData &ThisStorage, int const CurveNum, Real64 const TempIn, Real64 const LoopSetPt)
+        {
+            if (CurveManager::PerfCurve(CurveNum).EMSOverrideOn) return false;
+            if (!ThisStorage.TankSolutionSaved || ThisStorage.SavedInletTemp != TempIn || ThisStorage.SavedSetPointTemp != LoopSetPt ||
+                ThisStorage.SavedMassFlowRate != ThisStorage.MassFlowRate || ThisStorage.SavedIceFracRemaining != ThisStorage.IceFracRemaining ||
+                ThisStorage.SavedIceFracOnCoil != ThisStorage.IceFracOnCoil || ThisStorage.SavedTimeStepSys != DataHVACGlobals::TimeStepSys) {
+                return false;
+            }
+            ThisStorage.CompLoad = ThisStorage.SavedCompLoad;
+            ThisStorage.OutletTemp = ThisStorage.SavedOutletTemp;
+            ThisStorage.TankOutletTemp = ThisStorage.SavedTankOutletTemp;
+            ThisStorage.TankMassFlowRate = ThisStorage.SavedTankMassFlowRate;
+            ThisStorage.BypassMassFlowRate = ThisStorage.MassFlowRate - ThisStorage.TankMassFlowRate;
+            return true;
+        }
+
+        void SaveTankSolution(DetailedIceStorageData &ThisStorage, Real64 const TempIn, Real64 const LoopSetPt)
+        {
+            ThisStorage.TankSolutionSaved = true;
+            ThisStorage.SavedInletTemp = TempIn;
+            ThisStorage.SavedSetPointTemp = LoopSetPt;
+            ThisStorage.SavedMassFlowRate = ThisStorage.MassFlowRate;
+            ThisStorage.SavedIceFracRemaining = ThisStorage.IceFracRemaining;
+            ThisStorage.SavedIceFracOnCoil = ThisStorage.IceFracOnCoil;
+            ThisStorage.SavedTimeStepSys = DataHVACGlobals::TimeStepSys;
+            ThisStorage.SavedCompLoad = ThisStorage.CompLoad;
+            ThisStorage.SavedOutletTemp = ThisStorage.OutletTemp;
+            ThisStorage.SavedTankOutletTemp = ThisStorage.TankOutletTemp;
+            ThisStorage.SavedTankMassFlowRate = ThisStorage.TankMassFlowRate;
+        }
+    } // namespace
+
     //*************************************************************************
 
     // Functions
@@ -425,7 +495,7 @@ namespace IceThermalStorage {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Rick Strand
         //       DATE WRITTEN   February 2006
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, reuse the tank solution of repeated calls with unchanged inputs
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -489,6 +559,7 @@ namespace IceThermalStorage {
         Real64 Qstar;          // Current load on the ice storage unit [non-dimensional]
         Real64 TempIn;         // Inlet temperature to component (from plant loop) [C]
         Real64 TempSetPt(0.0); // Setpoint temperature defined by loop controls [C]
+        Real64 LoopSetPt;      // Setpoint temperature before it is limited by the freezing temperature [C]
         Real64 ToutNew;        // Updated outlet temperature from the tank [C]
         Real64 ToutOld;        // Tank outlet temperature from the last iteration [C]
         Real64 Cp;             // local plant fluid specific heat
@@ -510,6 +581,7 @@ namespace IceThermalStorage {
                 assert(false);
             }
         }
+        LoopSetPt = TempSetPt;
 
         IterNum = 0;
 
@@ -594,6 +666,7 @@ namespace IceThermalStorage {
                     // LMTDstar based on that assumption.
                     TempSetPt = DetIceStor(IceNum).FreezingTemp - DeltaTofMin;
                 }
+                if (ReuseTankSolution(DetIceStor(IceNum), DetIceStor(IceNum).ChargeCurveNum, TempIn, LoopSetPt)) return;
 
                 ToutOld = TempSetPt;
                 LMTDstar = CalcDetIceStorLMTDstar(TempIn, ToutOld, DetIceStor(IceNum).FreezingTemp);
@@ -697,6 +770,7 @@ namespace IceThermalStorage {
                     DetIceStor(IceNum).TankMassFlowRate = DetIceStor(IceNum).MassFlowRate;
                     DetIceStor(IceNum).CompLoad = DetIceStor(IceNum).MassFlowRate * Cp * std::abs(TempIn - ToutNew);
                 }
+                SaveTankSolution(DetIceStor(IceNum), TempIn, LoopSetPt);
             }
 
         } else if (LocalLoad > 0.0) {
@@ -745,6 +819,7 @@ namespace IceThermalStorage {
                     // LMTDstar based on that assumption.
                     TempSetPt = DetIceStor(IceNum).FreezingTemp + DeltaTofMin;
                 }
+                if (ReuseTankSolution(DetIceStor(IceNum), DetIceStor(IceNum).DischargeCurveNum, TempIn, LoopSetPt)) return;
 
                 ToutOld = TempSetPt;
                 LMTDstar = CalcDetIceStorLMTDstar(TempIn, ToutOld, DetIceStor(IceNum).FreezingTemp);
@@ -846,6 +921,7 @@ namespace IceThermalStorage {
                         DetIceStor(IceNum).BypassMassFlowRate = DetIceStor(IceNum).MassFlowRate - DetIceStor(IceNum).TankMassFlowRate;
                     }
                 }
+                SaveTankSolution(DetIceStor(IceNum), TempIn, LoopSetPt);
             }
 
         } else { // Shouldn't get here ever (print error if we do)
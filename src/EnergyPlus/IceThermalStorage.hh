@@ -245,6 +245,18 @@ namespace IceThermalStorage {
         int DischargeErrorCount;          // Index for error counting routine
         int ChargeIterErrors;             // Number of max iterations exceeded errors during charging
         int ChargeErrorCount;             // Index for error counting routine
+        // Tank solution of the last charging or discharging call, reused while its inputs are unchanged
+        bool TankSolutionSaved;
+        Real64 SavedInletTemp;
+        Real64 SavedSetPointTemp;
+        Real64 SavedMassFlowRate;
+        Real64 SavedIceFracRemaining;
+        Real64 SavedIceFracOnCoil;
+        Real64 SavedTimeStepSys;
+        Real64 SavedCompLoad;
+        Real64 SavedOutletTemp;
+        Real64 SavedTankOutletTemp;
+        Real64 SavedTankMassFlowRate;
 
         // Default Constructor
         DetailedIceStorageData()
@@ -254,7 +266,9 @@ namespace IceThermalStorage {
               IceFracRemaining(1.0), ThawProcessIndex(0), IceFracOnCoil(1.0), DischargingRate(0.0), DischargingEnergy(0.0), ChargingRate(0.0),
               ChargingEnergy(0.0), MassFlowRate(0.0), BypassMassFlowRate(0.0), TankMassFlowRate(0.0), InletTemp(0.0), OutletTemp(0.0),
               TankOutletTemp(0.0), ParasiticElecRate(0.0), ParasiticElecEnergy(0.0), DischargeIterErrors(0), DischargeErrorCount(0),
-              ChargeIterErrors(0), ChargeErrorCount(0)
+              ChargeIterErrors(0), ChargeErrorCount(0), TankSolutionSaved(false), SavedInletTemp(0.0), SavedSetPointTemp(0.0),
+              SavedMassFlowRate(0.0), SavedIceFracRemaining(0.0), SavedIceFracOnCoil(0.0), SavedTimeStepSys(0.0), SavedCompLoad(0.0),
+              SavedOutletTemp(0.0), SavedTankOutletTemp(0.0), SavedTankMassFlowRate(0.0)
         {
         }
     };
@@ -290,6 +304,8 @@ namespace IceThermalStorage {
 
     // Functions
 
+    void clear_state();
+
     void SimIceStorage(std::string const &IceStorageType,
                        std::string const &IceStorageName,
                        int &CompIndex,
@@ -45,6 +45,10 @@
 // OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+
 #include <InputProcessing/IdfParser.hh>
 #include <milo/dtoa.h>
 #include <milo/itoa.h>
@@ -88,6 +92,19 @@ json IdfParser::decode(std::string const &idf, json const &schema, bool &success
     return parse_idf(idf, index, success, schema);
 }
 
+json IdfParser::decode(std::string const &idf, json const &schema, bool &success, int numThreads)
+{
+    // Below this size the chunks are not worth the threads
+    static size_t const min_parallel_size = 1 << 20;
+
+    if (numThreads > 1 && idf.size() >= min_parallel_size) {
+        success = true;
+        json root = parse_idf_chunks(idf, success, schema, numThreads);
+        if (success) return root;
+    }
+    return decode(idf, schema, success);
+}
+
 std::string IdfParser::encode(json const &root, json const &schema)
 {
     std::string end_of_field("," + NL + "  ");
@@ -192,6 +209,7 @@ json IdfParser::parse_idf(std::string const &idf, size_t &index, bool &success,
     Token token;
     auto const &schema_properties = schema["properties"];
 
+    objectSchemas.clear();
     objectTypeMap.reserve(schema_properties.size());
     for (auto it = schema_properties.begin(); it != schema_properties.end(); ++it) {
         std::string key = convertToUpper(it.key());
@@ -288,22 +306,124 @@ json IdfParser::parse_idf(std::string const &idf, size_t &index, bool &success,
         }
     }
 
+    idf_object_count = idfObjectCount;
     return root;
 }
 
-json IdfParser::parse_object(
-    std::string const &idf, size_t &index, bool &success, json const &legacy_idd, json const &schema_obj_loc, int idfObjectCount)
+json IdfParser::parse_idf_chunks(std::string const &idf, bool &success, json const &schema, int numThreads)
 {
-    json root = json::object();
-    json extensible = json::object();
-    json array_of_extensions = json::array();
-    Token token;
-    std::string extension_key;
-    size_t legacy_idd_index = 0;
-    size_t extensible_index = 0;
-    success = true;
-    bool was_value_parsed = false;
-    auto const &legacy_idd_fields_array = legacy_idd["fields"];
+    // Objects are independent and end at the first ';' outside a comment, so the input is cut after such
+    // semicolons into chunks that are parsed concurrently, each by its own parser.  The partial trees are merged
+    // in input order, offsetting idf_order and the numbers of generated names by the objects of the earlier chunks,
+    // which gives the tree parse_idf would have built.  Any error or warning, or a name defined in two chunks, makes
+    // this return with success false so the caller parses the whole input again and reports them in input order
+    // with positions in the whole input.
+
+    size_t const num_chunks = static_cast<size_t>(numThreads) * 4;
+    size_t const target_size = idf.size() / num_chunks + 1;
+
+    std::vector<size_t> chunk_starts(1, 0);
+    bool in_comment = false;
+    size_t next_cut = target_size;
+    for (size_t i = 0; i < idf.size(); ++i) {
+        char const c = idf[i];
+        if (in_comment) {
+            if (c == '\n') in_comment = false;
+        } else if (c == '!') {
+            in_comment = true;
+        } else if (c == ';' && i + 1 >= next_cut && i + 1 < idf.size()) {
+            chunk_starts.push_back(i + 1);
+            next_cut = i + 1 + target_size;
+        }
+    }
+    chunk_starts.push_back(idf.size());
+    int const num_parsed_chunks = static_cast<int>(chunk_starts.size()) - 1;
+
+    std::vector<IdfParser> parsers(num_parsed_chunks);
+    std::vector<json> chunk_roots(num_parsed_chunks);
+    std::vector<char> chunk_success(num_parsed_chunks, 1);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(numThreads)
+#endif
+    for (int chunk = 0; chunk < num_parsed_chunks; ++chunk) {
+        try {
+            std::string const chunk_idf(idf, chunk_starts[chunk], chunk_starts[chunk + 1] - chunk_starts[chunk]);
+            bool chunk_ok = true;
+            size_t index = 0;
+            chunk_roots[chunk] = parsers[chunk].parse_idf(chunk_idf, index, chunk_ok, schema);
+            chunk_success[chunk] = chunk_ok && !parsers[chunk].hasErrors() && parsers[chunk].warnings().empty();
+        } catch (...) {
+            // the sequential parse raises it again where the caller can see it
+            chunk_success[chunk] = 0;
+        }
+    }
+
+    json root;
+    for (int chunk = 0; chunk < num_parsed_chunks; ++chunk) {
+        if (!chunk_success[chunk]) {
+            success = false;
+            return root;
+        }
+    }
+
+    auto const &schema_properties = schema["properties"];
+    int object_count_offset = 0;
+    for (int chunk = 0; chunk < num_parsed_chunks; ++chunk) {
+        for (auto type = chunk_roots[chunk].begin(); type != chunk_roots[chunk].end(); ++type) {
+            auto const &obj_name = type.key();
+            auto &objects = root[obj_name];
+            bool const generated_names = (schema_properties[obj_name].find("name") == schema_properties[obj_name].end());
+            size_t const name_offset = objects.size();
+            for (auto obj = type.value().begin(); obj != type.value().end(); ++obj) {
+                std::string name = obj.key();
+                if (generated_names && name_offset != 0) {
+                    // "<type> <n>", numbered from 1 within the chunk
+                    auto const number_start = obj_name.size() + 1;
+                    if (name.size() <= number_start || name.compare(0, obj_name.size(), obj_name) != 0) {
+                        success = false;
+                        return root;
+                    }
+                    u64toa(name_offset + std::stoull(name.substr(number_start)), s);
+                    name = obj_name + " " + s;
+                }
+                if (objects.find(name) != objects.end()) {
+                    success = false;
+                    return root;
+                }
+                auto &merged = objects[name];
+                merged = std::move(obj.value());
+                merged["idf_order"] = merged["idf_order"].get<int>() + object_count_offset;
+            }
+        }
+        object_count_offset += parsers[chunk].idf_object_count;
+    }
+
+    idf_object_count = object_count_offset;
+    return root;
+}
+
+IdfParser::FieldSchema IdfParser::field_schema(json const &field_loc)
+{
+    FieldSchema field;
+    field.loc = &field_loc;
+    auto const &field_type = field_loc.find("type");
+    if (field_type != field_loc.end()) {
+        field.has_type = true;
+        field.is_number = (field_type.value() == "number" || field_type.value() == "integer");
+    }
+    auto const &enum_it = field_loc.find("enum");
+    if (enum_it != field_loc.end()) field.enums = &enum_it.value();
+    return field;
+}
+
+IdfParser::ObjectSchema const &IdfParser::object_schema(json const &legacy_idd, json const &schema_obj_loc)
+{
+    auto const found = objectSchemas.find(&schema_obj_loc);
+    if (found != objectSchemas.end()) return found->second;
+
+    ObjectSchema object;
+    object.legacy_idd_fields = &legacy_idd["fields"];
     auto const &legacy_idd_extensibles_iter = legacy_idd.find("extensibles");
 
     auto const &schema_patternProperties = schema_obj_loc["patternProperties"];
@@ -318,46 +438,91 @@ json IdfParser::parse_object(
         throw std::runtime_error(R"(The patternProperties value is not a valid choice (".*", "^.*\S.*$"))");
     }
     auto const &schema_obj_props = schema_patternProperties[patternProperty]["properties"];
-    auto key = legacy_idd.find("extension");
 
-    json const *schema_obj_extensions = nullptr;
+    object.fields.reserve(object.legacy_idd_fields->size());
+    for (auto const &field_name : *object.legacy_idd_fields) {
+        auto const &name = field_name.get_ref<std::string const &>();
+        auto const &find_field_iter = schema_obj_props.find(name);
+        FieldSchema field;
+        if (find_field_iter != schema_obj_props.end()) field = field_schema(find_field_iter.value());
+        field.name = &name;
+        object.fields.push_back(field);
+    }
+
     if (legacy_idd_extensibles_iter != legacy_idd.end()) {
+        object.legacy_idd_extensibles = &legacy_idd_extensibles_iter.value();
+        auto key = legacy_idd.find("extension");
         if (key == legacy_idd.end()) {
-            errors_.emplace_back("\"extension\" key not found in schema. Need to add to list in modify_schema.py.");
-            success = false;
-            return root;
+            object.extension_key_missing = true;
+        } else {
+            object.extension_key = key.value();
+            object.extension_props = &schema_obj_props[object.extension_key]["items"]["properties"];
+            object.extensible_fields.reserve(object.legacy_idd_extensibles->size());
+            for (auto const &field_name : *object.legacy_idd_extensibles) {
+                auto const &name = field_name.get_ref<std::string const &>();
+                auto const &find_field_iter = object.extension_props->find(name);
+                FieldSchema field;
+                if (find_field_iter != object.extension_props->end()) field = field_schema(find_field_iter.value());
+                field.name = &name;
+                object.extensible_fields.push_back(field);
+            }
         }
-        extension_key = key.value();
-        schema_obj_extensions = &schema_obj_props[extension_key]["items"]["properties"];
     }
 
-    root["idf_order"] = idfObjectCount;
-
     auto const &found_min_fields = schema_obj_loc.find("min_fields");
+    if (found_min_fields != schema_obj_loc.end()) {
+        object.min_fields = found_min_fields.value();
+    }
+
+    return objectSchemas.emplace(&schema_obj_loc, std::move(object)).first->second;
+}
+
+json IdfParser::parse_object(
+    std::string const &idf, size_t &index, bool &success, json const &legacy_idd, json const &schema_obj_loc, int idfObjectCount)
+{
+    json root = json::object();
+    json extensible = json::object();
+    json array_of_extensions = json::array();
+    Token token;
+    size_t legacy_idd_index = 0;
+    size_t extensible_index = 0;
+    success = true;
+    bool was_value_parsed = false;
+
+    ObjectSchema const &object = object_schema(legacy_idd, schema_obj_loc);
+    auto const num_fields = object.fields.size();
+    auto const num_extensible_fields = object.extensible_fields.size();
+
+    auto const set_max_fields = [&]() {
+        root["idf_max_fields"] = legacy_idd_index;
+        root["idf_max_extensible_fields"] = extensible_index;
+    };
+
+    if (object.extension_key_missing) {
+        errors_.emplace_back("\"extension\" key not found in schema. Need to add to list in modify_schema.py.");
+        success = false;
+        return root;
+    }
+
+    root["idf_order"] = idfObjectCount;
 
     index += 1;
 
     while (true) {
         token = look_ahead(idf, index);
-        root["idf_max_fields"] = legacy_idd_index;
-        root["idf_max_extensible_fields"] = extensible_index;
         if (token == Token::NONE) {
+            set_max_fields();
             success = false;
             return root;
         } else if (token == Token::END) {
+            set_max_fields();
             return root;
         } else if (token == Token::COMMA || token == Token::SEMICOLON) {
             if (!was_value_parsed) {
-                int ext_size = 0;
-                if (legacy_idd_index < legacy_idd_fields_array.size()) {
-                    //					std::string const & field_name = legacy_idd_fields_array[ legacy_idd_index ];
-                    //					root[ field_name ] = "";
-                } else {
-                    auto const &legacy_idd_extensibles_array = legacy_idd_extensibles_iter.value();
-                    ext_size = static_cast<int>(legacy_idd_extensibles_array.size());
-                    //					std::string const & field_name = legacy_idd_extensibles_array[ extensible_index % ext_size ];
+                size_t ext_size = 0;
+                if (legacy_idd_index >= num_fields) {
+                    if (object.legacy_idd_extensibles) ext_size = object.legacy_idd_extensibles->size();
                     extensible_index++;
-                    //					extensible[ field_name ] = "";
                 }
                 if (ext_size && extensible_index % ext_size == 0) {
                     array_of_extensions.push_back(extensible);
@@ -368,60 +533,54 @@ json IdfParser::parse_object(
             was_value_parsed = false;
             next_token(idf, index);
             if (token == Token::SEMICOLON) {
-                size_t min_fields = 0;
-                if (found_min_fields != schema_obj_loc.end()) {
-                    min_fields = found_min_fields.value();
-                }
-                for (; legacy_idd_index < min_fields; legacy_idd_index++) {
-                    //					std::string const & field_name = legacy_idd_fields_array[ legacy_idd_index ];
-                    //					root[ field_name ] = "";
-                }
+                if (legacy_idd_index < object.min_fields) legacy_idd_index = object.min_fields;
                 if (extensible.size()) {
                     array_of_extensions.push_back(extensible);
                     extensible.clear();
                 }
-                root["idf_max_fields"] = legacy_idd_index;
-                root["idf_max_extensible_fields"] = extensible_index;
+                set_max_fields();
                 break;
             }
         } else if (token == Token::EXCLAMATION) {
             eat_comment(idf, index);
-        } else if (legacy_idd_index >= legacy_idd_fields_array.size()) {
-            if (legacy_idd_extensibles_iter == legacy_idd.end()) {
+        } else if (legacy_idd_index >= num_fields) {
+            if (!object.legacy_idd_extensibles) {
+                set_max_fields();
                 success = false;
                 return root;
             }
-            auto const &legacy_idd_extensibles_array = legacy_idd_extensibles_iter.value();
-            auto const size = legacy_idd_extensibles_array.size();
-            std::string const &field_name = legacy_idd_extensibles_array[extensible_index % size];
-            auto const val = parse_value(idf, index, success, schema_obj_extensions->at(field_name));
-            extensible[field_name] = std::move(val);
+            auto const &field = object.extensible_fields[extensible_index % num_extensible_fields];
+            if (!field.loc) static_cast<void>(object.extension_props->at(*field.name)); // throws for a field missing from the schema
+            auto const val = parse_value(idf, index, success, field);
+            extensible[*field.name] = std::move(val);
             was_value_parsed = true;
             extensible_index++;
-            if (extensible_index && extensible_index % size == 0) {
+            if (extensible_index && extensible_index % num_extensible_fields == 0) {
                 array_of_extensions.push_back(extensible);
                 extensible.clear();
             }
         } else {
             was_value_parsed = true;
-            std::string const &field = legacy_idd_fields_array[legacy_idd_index];
-            auto const &find_field_iter = schema_obj_props.find(field);
-            if (find_field_iter == schema_obj_props.end()) {
-                if (field == "name") {
-                    root[field] = parse_string(idf, index, success);
+            auto const &field = object.fields[legacy_idd_index];
+            if (!field.loc) {
+                if (*field.name == "name") {
+                    root[*field.name] = parse_string(idf, index, success);
                 } else {
                     u64toa(cur_line_num, s);
-                    errors_.emplace_back(std::string("Line: ") + s + " - Field \"" + field + "\" was not found.");
+                    errors_.emplace_back(std::string("Line: ") + s + " - Field \"" + *field.name + "\" was not found.");
                 }
             } else {
-                auto const val = parse_value(idf, index, success, find_field_iter.value());
-                root[field] = std::move(val);
+                auto const val = parse_value(idf, index, success, field);
+                root[*field.name] = std::move(val);
+            }
+            if (!success) {
+                set_max_fields();
+                return root;
             }
-            if (!success) return root;
         }
     }
     if (array_of_extensions.size()) {
-        root[extension_key] = std::move(array_of_extensions);
+        root[object.extension_key] = std::move(array_of_extensions);
         array_of_extensions = nullptr;
     }
     return root;
@@ -431,39 +590,59 @@ json IdfParser::parse_number(std::string const &idf, size_t &index, bool &succes
 {
     size_t save_i = index;
     eat_whitespace(idf, save_i);
+    size_t const num_start = save_i;
     bool is_double = false, is_sign = false, is_scientific = false;
-    std::string num_str, numeric = "-+.eE0123456789";
 
-    while (numeric.find_first_of(idf[save_i]) != std::string::npos) {
-        num_str += idf[save_i];
-        if (idf[save_i] == '.') {
+    bool is_numeric = true;
+    while (is_numeric && save_i < idf.size()) {
+        switch (idf[save_i]) {
+        case '.':
             if (is_double) {
                 success = false;
                 return nullptr;
             }
             is_double = true;
-        } else if (idf[save_i] == '-' || idf[save_i] == '+') {
+            break;
+        case '-':
+        case '+':
             if (is_sign && !is_scientific) {
                 success = false;
                 return nullptr;
             }
             is_sign = true;
-        } else if (idf[save_i] == 'e' || idf[save_i] == 'E') {
+            break;
+        case 'e':
+        case 'E':
             if (is_scientific) {
                 success = false;
                 return nullptr;
             }
             is_scientific = true;
             is_double = true;
+            break;
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+            break;
+        default:
+            is_numeric = false;
+            continue;
         }
         save_i++;
     }
 
-    if (num_str.empty()) {
+    if (save_i == num_start) {
         return parse_string(idf, index, success);
     }
 
-    if (num_str[num_str.size() - 1] == 'e' || num_str[num_str.size() - 1] == 'E') {
+    if (idf[save_i - 1] == 'e' || idf[save_i - 1] == 'E') {
         success = false;
         return nullptr;
     }
@@ -473,21 +652,29 @@ json IdfParser::parse_number(std::string const &idf, size_t &index, bool &succes
         success = false;
         return nullptr;
     }
+
+    // The number is followed by optional whitespace and a comma or semicolon, so the conversions can read the text
+    // in place and stop where the number ends.  Text they cannot convert, or values out of range, go through the
+    // standard string conversions, which are what decide the value (or the exception) in those cases.
+    char const *num_begin = idf.c_str() + num_start;
+    char *num_end = nullptr;
     json val;
+    errno = 0;
     if (is_double) {
-        try {
-            auto const double_val = stod(num_str, nullptr);
-            val = double_val;
-        } catch (std::exception & e) {
-            auto const double_val = stold(num_str, nullptr);
+        double const double_val = std::strtod(num_begin, &num_end);
+        if (num_end != num_begin && errno != ERANGE) {
             val = double_val;
+        } else {
+            auto const long_double_val = stold(idf.substr(num_start, save_i - num_start), nullptr);
+            val = long_double_val;
         }
     } else {
-        try {
-            auto const int_val = stoi(num_str, nullptr);
-            val = int_val;
-        } catch (std::exception & e) {
-            auto const int_val = stoll(num_str, nullptr);
+        long const long_val = std::strtol(num_begin, &num_end, 10);
+        if (num_end != num_begin && errno != ERANGE && long_val >= std::numeric_limits<int>::min() &&
+            long_val <= std::numeric_limits<int>::max()) {
+            val = static_cast<int>(long_val);
+        } else {
+            auto const int_val = stoll(idf.substr(num_start, save_i - num_start), nullptr);
             val = int_val;
         }
     }
@@ -497,16 +684,20 @@ json IdfParser::parse_number(std::string const &idf, size_t &index, bool &succes
 
 json IdfParser::parse_value(std::string const &idf, size_t &index, bool &success, json const &field_loc)
 {
-    auto const &field_type = field_loc.find("type");
-    if (field_type != field_loc.end()) {
-        if (field_type.value() == "number" || field_type.value() == "integer") {
+    return parse_value(idf, index, success, field_schema(field_loc));
+}
+
+json IdfParser::parse_value(std::string const &idf, size_t &index, bool &success, FieldSchema const &field)
+{
+    json const &field_loc = *field.loc;
+    if (field.has_type) {
+        if (field.is_number) {
             return parse_number(idf, index, success);
         } else {
             auto const parsed_string = parse_string(idf, index, success);
-            auto const &enum_it = field_loc.find("enum");
-            if (enum_it == field_loc.end()) return parsed_string;
-            for (auto const &s : enum_it.value()) {
-                auto const &str = s.get<std::string>();
+            if (!field.enums) return parsed_string;
+            for (auto const &s : *field.enums) {
+                auto const &str = s.get_ref<std::string const &>();
                 if (icompare(str, parsed_string)) {
                     return str;
                 }
@@ -517,10 +708,9 @@ json IdfParser::parse_value(std::string const &idf, size_t &index, bool &success
         switch (look_ahead(idf, index)) {
         case Token::STRING: {
             auto const parsed_string = parse_string(idf, index, success);
-            auto const &enum_it = field_loc.find("enum");
-            if (enum_it != field_loc.end()) {
-                for (auto const &s : enum_it.value()) {
-                    auto const &str = s.get<std::string>();
+            if (field.enums) {
+                for (auto const &s : *field.enums) {
+                    auto const &str = s.get_ref<std::string const &>();
                     if (icompare(str, parsed_string)) {
                         return str;
                     }
@@ -565,39 +755,13 @@ std::string IdfParser::parse_string(std::string const &idf, size_t &index, bool
 {
     eat_whitespace(idf, index);
 
-    std::string s;
-    char c;
-
-    bool complete = false;
-    while (!complete) {
-        if (index == idf.size()) {
-            complete = true;
-            break;
-        }
+    // A string runs to the next delimiter or the end of the input, and may span lines
+    size_t end = idf.find_first_of(",;!", index);
+    if (end == std::string::npos) end = idf.size();
 
-        c = idf[index];
-        increment_both_index(index, index_into_cur_line);
-        if (c == ',') {
-            complete = true;
-            decrement_both_index(index, index_into_cur_line);
-            break;
-        } else if (c == ';') {
-            complete = true;
-            decrement_both_index(index, index_into_cur_line);
-            break;
-        } else if (c == '!') {
-            complete = true;
-            decrement_both_index(index, index_into_cur_line);
-            break;
-        } else {
-            s += c;
-        }
-    }
-
-    if (!complete) {
-        success = false;
-        return std::string();
-    }
+    std::string s(idf, index, end - index);
+    index_into_cur_line += end - index;
+    index = end;
     return rtrim(s);
 }
 
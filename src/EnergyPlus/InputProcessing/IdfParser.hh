@@ -68,6 +68,9 @@ public:
 
     json decode(std::string const &idf, json const &schema, bool &success);
 
+    // Parses large inputs in chunks of whole objects on up to numThreads threads, see parse_idf_chunks
+    json decode(std::string const &idf, json const &schema, bool &success, int numThreads);
+
     std::string encode(json const &root, json const &schema);
 
     std::string normalizeObjectType(std::string const &objectType);
@@ -93,8 +96,33 @@ private:
     size_t cur_line_num = 1;
     size_t index_into_cur_line = 0;
     size_t beginning_of_line_index = 0;
+    int idf_object_count = 0; // objects read by the last parse_idf
     char s[129];
     std::unordered_map<std::string, std::string> objectTypeMap;
+
+    // Schema lookups done once per object type instead of once per field of every object
+    struct FieldSchema
+    {
+        std::string const *name = nullptr; // field name in the legacy IDD order
+        json const *loc = nullptr;         // field schema, null when the field is not in the schema properties
+        json const *enums = nullptr;       // "enum" of the field schema, if any
+        bool has_type = false;
+        bool is_number = false; // "number" or "integer" type
+    };
+
+    struct ObjectSchema
+    {
+        json const *legacy_idd_fields = nullptr;
+        json const *legacy_idd_extensibles = nullptr; // null when the object is not extensible
+        json const *extension_props = nullptr;
+        std::string extension_key;
+        bool extension_key_missing = false;
+        size_t min_fields = 0;
+        std::vector<FieldSchema> fields;
+        std::vector<FieldSchema> extensible_fields;
+    };
+
+    std::unordered_map<json const *, ObjectSchema> objectSchemas; // keyed by the object's schema, cleared by parse_idf
     std::vector<std::string> errors_;
     std::vector<std::string> warnings_;
 
@@ -104,10 +132,18 @@ private:
 
     json parse_idf(std::string const &idf, size_t &index, bool &success, json const &schema);
 
+    json parse_idf_chunks(std::string const &idf, bool &success, json const &schema, int numThreads);
+
     json parse_object(std::string const &idf, size_t &index, bool &success, json const &schema_loc, json const &obj_loc, int idfObjectCount);
 
     json parse_value(std::string const &idf, size_t &index, bool &success, json const &field_loc);
 
+    json parse_value(std::string const &idf, size_t &index, bool &success, FieldSchema const &field);
+
+    FieldSchema field_schema(json const &field_loc);
+
+    ObjectSchema const &object_schema(json const &legacy_idd, json const &schema_obj_loc);
+
     json parse_number(std::string const &idf, size_t &index, bool &success);
 
     std::string parse_string(std::string const &idf, size_t &index, bool &success);
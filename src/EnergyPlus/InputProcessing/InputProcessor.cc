@@ -50,10 +50,12 @@
 #include <fstream>
 #include <iostream>
 #include <istream>
+#include <iterator>
 #include <unordered_set>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1S.hh>
+#include <ObjexxFCL/environment.hh>
 
 // EnergyPlus Headers
 #include <DataIPShortCuts.hh>
@@ -104,18 +106,27 @@ using json = nlohmann::json;
 
 std::unique_ptr<InputProcessor> inputProcessor = nullptr;
 
-InputProcessor::InputProcessor() : idf_parser(std::unique_ptr<IdfParser>(new IdfParser())), data(std::unique_ptr<DataStorage>(new DataStorage()))
+InputProcessor::InputProcessor()
+    : idf_parser(std::unique_ptr<IdfParser>(new IdfParser())), data(std::unique_ptr<DataStorage>(new DataStorage())), schema(embeddedSchema())
 {
-    auto const embeddedEpJSONSchema = EmbeddedEpJSONSchema::embeddedEpJSONSchema();
-    schema = json::from_cbor(embeddedEpJSONSchema.first, embeddedEpJSONSchema.second);
-
-    const json &loc = schema["properties"];
+    const json &loc = schema->at("properties");
     caseInsensitiveObjectMap.reserve(loc.size());
     for (auto it = loc.begin(); it != loc.end(); ++it) {
         caseInsensitiveObjectMap.emplace(convertToUpper(it.key()), it.key());
     }
 
-    validation = std::unique_ptr<Validation>(new Validation(&schema));
+    validation = std::unique_ptr<Validation>(new Validation(schema));
+}
+
+std::shared_ptr<json const> InputProcessor::embeddedSchema()
+{
+    // The schema never changes once decoded, so it is decoded from the embedded CBOR once per process and
+    // shared by every InputProcessor instance (and their Validation objects) for the lifetime of the process.
+    static std::shared_ptr<json const> const embedded_schema = [] {
+        auto const embeddedEpJSONSchema = EmbeddedEpJSONSchema::embeddedEpJSONSchema();
+        return std::make_shared<json const>(json::from_cbor(embeddedEpJSONSchema.first, embeddedEpJSONSchema.second));
+    }();
+    return embedded_schema;
 }
 
 std::unique_ptr<InputProcessor> InputProcessor::factory()
@@ -186,7 +197,7 @@ void InputProcessor::clear_state()
     objectCacheMap.clear();
     unusedInputs.clear();
 
-    validation = std::unique_ptr<Validation>(new Validation(&schema));
+    validation = std::unique_ptr<Validation>(new Validation(schema));
 }
 
 std::vector<std::string> const &InputProcessor::validationErrors()
@@ -213,16 +224,40 @@ void InputProcessor::initializeMaps()
     unusedInputs.clear();
     objectCacheMap.clear();
     objectCacheMap.reserve(epJSON.size());
-    auto const &schema_properties = schema.at("properties");
+    auto const &schema_properties = schema->at("properties");
 
     for (auto epJSON_iter = epJSON.begin(); epJSON_iter != epJSON.end(); ++epJSON_iter) {
         auto const &objects = epJSON_iter.value();
         auto const &objectType = epJSON_iter.key();
         ObjectCache objectCache;
         objectCache.inputObjectIterators.reserve(objects.size());
+        objectCache.upperNameToJSONIndex.reserve(objects.size());
+        std::vector<std::pair<int, int>> idfOrders;
+        idfOrders.reserve(objects.size());
+        bool hasIDFOrder = true;
+        int jsonIndex = 0;
         for (auto epJSON_obj_iter = objects.begin(); epJSON_obj_iter != objects.end(); ++epJSON_obj_iter) {
             objectCache.inputObjectIterators.emplace_back(epJSON_obj_iter);
             unusedInputs.emplace(objectType, epJSON_obj_iter.key());
+            ++jsonIndex;
+            objectCache.upperNameToJSONIndex.emplace(UtilityRoutines::MakeUPPERCase(epJSON_obj_iter.key()), jsonIndex);
+            auto const idf_order = epJSON_obj_iter.value().find("idf_order");
+            if (idf_order != epJSON_obj_iter.value().end() && idf_order.value().is_number()) {
+                idfOrders.emplace_back(idf_order.value().get<int>(), jsonIndex);
+            } else {
+                hasIDFOrder = false;
+            }
+        }
+        if (hasIDFOrder) {
+            std::stable_sort(idfOrders.begin(), idfOrders.end(), [](std::pair<int, int> const &a, std::pair<int, int> const &b) {
+                return a.first < b.first;
+            });
+            objectCache.jsonToIDFOrder.resize(idfOrders.size());
+            objectCache.idfToJSONOrder.resize(idfOrders.size());
+            for (size_t i = 0; i < idfOrders.size(); ++i) {
+                objectCache.idfToJSONOrder[i] = idfOrders[i].second;
+                objectCache.jsonToIDFOrder[idfOrders[i].second - 1] = static_cast<int>(i) + 1;
+            }
         }
         auto const schema_iter = schema_properties.find(objectType);
         objectCache.schemaIterator = schema_iter;
@@ -230,6 +265,22 @@ void InputProcessor::initializeMaps()
     }
 }
 
+InputProcessor::ObjectCache const *InputProcessor::findObjectCache(std::string const &objectType)
+{
+    auto find_iterators = objectCacheMap.find(objectType);
+    if (find_iterators == objectCacheMap.end()) {
+        auto const tmp_umit = caseInsensitiveObjectMap.find(convertToUpper(objectType));
+        if (tmp_umit == caseInsensitiveObjectMap.end()) {
+            return nullptr;
+        }
+        find_iterators = objectCacheMap.find(tmp_umit->second);
+        if (find_iterators == objectCacheMap.end()) {
+            return nullptr;
+        }
+    }
+    return &find_iterators->second;
+}
+
 void InputProcessor::markObjectAsUsed(const std::string &objectType, const std::string &objectName)
 {
     auto const find_unused = unusedInputs.find({objectType, objectName});
@@ -238,18 +289,46 @@ void InputProcessor::markObjectAsUsed(const std::string &objectType, const std::
     }
 }
 
-void InputProcessor::processInput()
+InputProcessor::BatchCache &InputProcessor::batchCache()
 {
-    std::ifstream input_stream(DataStringGlobals::inputFileName, std::ifstream::in);
+    // Shared by every InputProcessor instance for the lifetime of the process, so it survives clearAllStates between batch runs
+    static BatchCache cache;
+    return cache;
+}
+
+void InputProcessor::setBatchRun(json const &objectDeltas)
+{
+    auto &batch = batchCache();
+    batch.active = true;
+    batch.objectDeltas = objectDeltas;
+}
+
+void InputProcessor::clearBatchRuns()
+{
+    auto &batch = batchCache();
+    batch.active = false;
+    batch.objectDeltas = json();
+    batch.decodedInputs.clear();
+}
+
+bool InputProcessor::decodeInputFile()
+{
+    bool const isBinaryInput = DataGlobals::isCBOR || DataGlobals::isMsgPack || DataGlobals::isUBJSON;
+    std::ifstream input_stream(DataStringGlobals::inputFileName, isBinaryInput ? std::ifstream::in | std::ifstream::binary : std::ifstream::in);
     if (!input_stream.is_open()) {
         ShowFatalError("Input file path " + DataStringGlobals::inputFileName + " not found");
-        return;
+        return false;
     }
 
     std::string input_file;
-    std::string line;
-    while (std::getline(input_stream, line)) {
-        input_file.append(line + DataStringGlobals::NL);
+    if (isBinaryInput) {
+        // Binary encodings are read in one block and decoded directly, reassembling them line by line would alter their bytes
+        input_file.assign(std::istreambuf_iterator<char>(input_stream), std::istreambuf_iterator<char>());
+    } else {
+        std::string line;
+        while (std::getline(input_stream, line)) {
+            input_file.append(line + DataStringGlobals::NL);
+        }
     }
     // For some reason this does not work properly on Windows. This will be faster so should investigate in future.
     // std::ifstream::pos_type size = input_stream.tellg();
@@ -273,13 +352,13 @@ void InputProcessor::processInput()
 
     if (input_file.empty()) {
         ShowFatalError("Failed to read input file: " + DataStringGlobals::inputFileName);
-        return;
+        return false;
     }
 
+    bool success = true;
     try {
         if (!DataGlobals::isEpJSON) {
-            bool success = true;
-            epJSON = idf_parser->decode(input_file, schema, success);
+            epJSON = idf_parser->decode(input_file, *schema, success, DataSystemVariables::NumberIntRadThreads);
             //			bool hasErrors = processErrors();
             //			if ( !success || hasErrors ) {
             //				ShowFatalError( "Errors occurred on processing input file. Preceding condition(s) cause termination." );
@@ -295,6 +374,8 @@ void InputProcessor::processInput()
             epJSON = json::from_cbor(input_file);
         } else if (DataGlobals::isMsgPack) {
             epJSON = json::from_msgpack(input_file);
+        } else if (DataGlobals::isUBJSON) {
+            epJSON = json::from_ubjson(input_file);
         } else {
             epJSON = json::parse(input_file);
         }
@@ -302,8 +383,27 @@ void InputProcessor::processInput()
         ShowSevereError(e.what());
         ShowFatalError("Errors occurred on processing input file. Preceding condition(s) cause termination.");
     }
+    return success;
+}
 
-    bool is_valid = validation->validate(epJSON);
+void InputProcessor::processInput()
+{
+    // In batch mode each base input file is read and decoded once; every run starts from a copy and applies its object deltas
+    auto &batch = batchCache();
+    bool const useBatchCache = batch.active && !DataGlobals::outputEpJSONConversion;
+    auto const cached = batch.decodedInputs.find(DataStringGlobals::inputFileName);
+    if (useBatchCache && cached != batch.decodedInputs.end()) {
+        epJSON = cached->second;
+    } else if (decodeInputFile() && useBatchCache) {
+        batch.decodedInputs.emplace(DataStringGlobals::inputFileName, epJSON);
+    }
+    if (batch.active && batch.objectDeltas.is_object()) {
+        epJSON.merge_patch(batch.objectDeltas);
+    }
+
+    std::string validationCacheFile;
+    get_environment_variable(DataSystemVariables::ValidationCacheEnvVar, validationCacheFile);
+    bool is_valid = validationCacheFile.empty() ? validation->validate(epJSON) : validation->validate(epJSON, validationCacheFile);
     bool hasErrors = processErrors();
     bool versionMatch = checkVersionMatch();
 
@@ -313,7 +413,7 @@ void InputProcessor::processInput()
 
     if (DataGlobals::isEpJSON && DataGlobals::outputEpJSONConversion) {
         if (versionMatch) {
-            std::string const encoded = idf_parser->encode(epJSON, schema);
+            std::string const encoded = idf_parser->encode(epJSON, *schema);
             std::string convertedEpJSON(DataStringGlobals::outputDirPathName + DataStringGlobals::inputFileNameOnly + ".idf");
             FileSystem::makeNativePath(convertedEpJSON);
             std::ofstream convertedFS(convertedEpJSON, std::ofstream::out);
@@ -323,6 +423,10 @@ void InputProcessor::processInput()
         }
     }
 
+    if (!DataGlobals::outputEpJSONBinaryFormat.empty()) {
+        writeBinaryEpJSON(DataGlobals::outputEpJSONBinaryFormat);
+    }
+
     initializeMaps();
 
     int MaxArgs = 0;
@@ -391,6 +495,38 @@ bool InputProcessor::processErrors()
     return has_errors;
 }
 
+void InputProcessor::writeBinaryEpJSON(std::string const &format)
+{
+    // Writes the validated input as binary epJSON next to the other outputs, so later runs can skip text parsing
+    std::vector<std::uint8_t> encoded;
+    std::string extension;
+    bool sameAsInput = false;
+    if (format == "CBOR") {
+        encoded = json::to_cbor(epJSON);
+        extension = ".cbor";
+        sameAsInput = DataGlobals::isCBOR;
+    } else if (format == "MSGPACK") {
+        encoded = json::to_msgpack(epJSON);
+        extension = ".msgpack";
+        sameAsInput = DataGlobals::isMsgPack;
+    } else if (format == "UBJSON") {
+        encoded = json::to_ubjson(epJSON);
+        extension = ".ubjson";
+        sameAsInput = DataGlobals::isUBJSON;
+    } else {
+        ShowWarningError("Skipping binary conversion of input, unknown format \"" + format + "\".");
+        return;
+    }
+    if (sameAsInput) {
+        ShowWarningError("Skipping binary conversion of input, the input file is already " + format + ".");
+        return;
+    }
+    std::string convertedBinary(DataStringGlobals::outputDirPathName + DataStringGlobals::inputFileNameOnly + extension);
+    FileSystem::makeNativePath(convertedBinary);
+    std::ofstream convertedFS(convertedBinary, std::ofstream::out | std::ofstream::binary);
+    convertedFS.write(reinterpret_cast<char const *>(encoded.data()), encoded.size());
+}
+
 int InputProcessor::getNumSectionsFound(std::string const &SectionWord)
 {
     // PURPOSE OF THIS SUBROUTINE:
@@ -437,7 +573,7 @@ int InputProcessor::getNumObjectsFound(std::string const &ObjectWord)
         return static_cast<int>(find_obj.value().size());
     }
 
-    if (schema["properties"].find(ObjectWord) == schema["properties"].end()) {
+    if ((*schema)["properties"].find(ObjectWord) == (*schema)["properties"].end()) {
         auto tmp_umit = caseInsensitiveObjectMap.find(convertToUpper(ObjectWord));
         if (tmp_umit == caseInsensitiveObjectMap.end()) {
             ShowWarningError("Requested Object not found in Definitions: " + ObjectWord);
@@ -846,6 +982,12 @@ int InputProcessor::getIDFObjNum(std::string const &Object, int const Number)
     int idfOrderNumber = Number;
     if (DataGlobals::isEpJSON || !DataGlobals::preserveIDFOrder) return idfOrderNumber;
 
+    auto const objectCache = findObjectCache(Object);
+    if (objectCache && !objectCache->jsonToIDFOrder.empty()) {
+        if (Number < 1 || Number > static_cast<int>(objectCache->jsonToIDFOrder.size())) return idfOrderNumber;
+        return objectCache->jsonToIDFOrder[Number - 1];
+    }
+
     json *obj;
     auto obj_iter = epJSON.find(Object);
     if (obj_iter == epJSON.end()) {
@@ -889,6 +1031,12 @@ int InputProcessor::getJSONObjNum(std::string const &Object, int const Number)
     int jSONOrderNumber = Number;
     if (DataGlobals::isEpJSON || !DataGlobals::preserveIDFOrder) return jSONOrderNumber;
 
+    auto const objectCache = findObjectCache(Object);
+    if (objectCache && !objectCache->idfToJSONOrder.empty()) {
+        if (Number < 1 || Number > static_cast<int>(objectCache->idfToJSONOrder.size())) return jSONOrderNumber;
+        return objectCache->idfToJSONOrder[Number - 1];
+    }
+
     json *obj;
     auto obj_iter = epJSON.find(Object);
     if (obj_iter == epJSON.end()) {
@@ -931,6 +1079,15 @@ int InputProcessor::getObjectItemNum(std::string const &ObjType, // Object Type
     // PURPOSE OF THIS SUBROUTINE:
     // Get the occurrence number of an object of type ObjType and name ObjName
 
+    auto const objectCache = findObjectCache(ObjType);
+    if (objectCache) {
+        auto const found_name = objectCache->upperNameToJSONIndex.find(UtilityRoutines::MakeUPPERCase(ObjName));
+        if (found_name == objectCache->upperNameToJSONIndex.end()) {
+            return 0; // indicates object name not found, see function GeneralRoutines::ValidateComponent
+        }
+        return getIDFObjNum(ObjType, found_name->second); // if incoming input is idf, then return idf object order
+    }
+
     json *obj;
     auto obj_iter = epJSON.find(ObjType);
     if (obj_iter == epJSON.end() || obj_iter.value().find(ObjName) == obj_iter.value().end()) {
@@ -1083,7 +1240,7 @@ void InputProcessor::getMaxSchemaArgs(int &NumArgs, int &NumAlpha, int &NumNumer
     NumAlpha = 0;
     NumNumeric = 0;
     std::string extension_key;
-    auto const &schema_properties = schema.at("properties");
+    auto const &schema_properties = schema->at("properties");
 
     for (json::iterator object = epJSON.begin(); object != epJSON.end(); ++object) {
         int num_alpha = 0;
@@ -1145,16 +1302,16 @@ void InputProcessor::getObjectDefMaxArgs(std::string const &ObjectWord, // Objec
     NumArgs = 0;
     NumAlpha = 0;
     NumNumeric = 0;
-    json *object;
-    if (schema["properties"].find(ObjectWord) == schema["properties"].end()) {
+    json const *object;
+    if ((*schema)["properties"].find(ObjectWord) == (*schema)["properties"].end()) {
         auto tmp_umit = caseInsensitiveObjectMap.find(convertToUpper(ObjectWord));
         if (tmp_umit == caseInsensitiveObjectMap.end()) {
             ShowSevereError("getObjectDefMaxArgs: Did not find object=\"" + ObjectWord + "\" in list of objects.");
             return;
         }
-        object = &schema["properties"][tmp_umit->second];
+        object = &(*schema)["properties"][tmp_umit->second];
     } else {
-        object = &schema["properties"][ObjectWord];
+        object = &(*schema)["properties"][ObjectWord];
     }
     const json &legacy_idd = object->at("legacy_idd");
 
@@ -1451,7 +1608,7 @@ void InputProcessor::preScanReportingVariables()
     epJSON_objects = epJSON.find(MeterCustom);
     if (epJSON_objects != epJSON.end()) {
         auto const &epJSON_object = epJSON_objects.value();
-        auto const &legacy_idd = schema["properties"][MeterCustom]["legacy_idd"];
+        auto const &legacy_idd = (*schema)["properties"][MeterCustom]["legacy_idd"];
         auto key = legacy_idd.find("extension");
         if (key != legacy_idd.end()) {
             extension_key = key.value();
@@ -1472,7 +1629,7 @@ void InputProcessor::preScanReportingVariables()
     epJSON_objects = epJSON.find(MeterCustomDecrement);
     if (epJSON_objects != epJSON.end()) {
         auto const &epJSON_object = epJSON_objects.value();
-        auto const &legacy_idd = schema["properties"][MeterCustomDecrement]["legacy_idd"];
+        auto const &legacy_idd = (*schema)["properties"][MeterCustomDecrement]["legacy_idd"];
         auto key = legacy_idd.find("extension");
         if (key != legacy_idd.end()) {
             extension_key = key.value();
@@ -1528,7 +1685,7 @@ void InputProcessor::preScanReportingVariables()
     epJSON_objects = epJSON.find(OutputTableMonthly);
     if (epJSON_objects != epJSON.end()) {
         auto const &epJSON_object = epJSON_objects.value();
-        auto const &legacy_idd = schema["properties"][OutputTableMonthly]["legacy_idd"];
+        auto const &legacy_idd = (*schema)["properties"][OutputTableMonthly]["legacy_idd"];
         auto key = legacy_idd.find("extension");
         if (key != legacy_idd.end()) {
             extension_key = key.value();
@@ -1548,7 +1705,7 @@ void InputProcessor::preScanReportingVariables()
     epJSON_objects = epJSON.find(OutputTableAnnual);
     if (epJSON_objects != epJSON.end()) {
         auto const &epJSON_object = epJSON_objects.value();
-        auto const &legacy_idd = schema["properties"][OutputTableAnnual]["legacy_idd"];
+        auto const &legacy_idd = (*schema)["properties"][OutputTableAnnual]["legacy_idd"];
         auto key = legacy_idd.find("extension");
         if (key != legacy_idd.end()) {
             extension_key = key.value();
@@ -1568,7 +1725,7 @@ void InputProcessor::preScanReportingVariables()
     epJSON_objects = epJSON.find(OutputTableSummaries);
     if (epJSON_objects != epJSON.end()) {
         auto const &epJSON_object = epJSON_objects.value();
-        auto const &legacy_idd = schema["properties"][OutputTableSummaries]["legacy_idd"];
+        auto const &legacy_idd = (*schema)["properties"][OutputTableSummaries]["legacy_idd"];
         auto key = legacy_idd.find("extension");
         if (key != legacy_idd.end()) {
             extension_key = key.value();
@@ -50,6 +50,7 @@
 
 // C++ Headers
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <set>
@@ -77,8 +78,10 @@ class InputProcessor
 public:
     using json = nlohmann::json;
 
+    friend class EnergyPlusBenchmarkFixture;
     friend class EnergyPlusFixture;
     friend class InputProcessorFixture;
+    friend void clearAllStates();
 
     json::parser_callback_t callback;
 
@@ -86,6 +89,8 @@ public:
 
     static std::unique_ptr<InputProcessor> factory();
 
+    static std::shared_ptr<json const> embeddedSchema();
+
     template <typename T> T *objectFactory(std::string const &objectName)
     {
         T *p = data->objectFactory<T>(objectName);
@@ -112,6 +117,14 @@ public:
 
     void processInput();
 
+    // Batch runs: decode each base input file once per process and apply the given object deltas (a JSON merge patch
+    // keyed by object type and name) to a copy of it in every subsequent processInput
+    static void setBatchRun(json const &objectDeltas);
+
+    static void clearBatchRuns();
+
+    void writeBinaryEpJSON(std::string const &format);
+
     int getNumSectionsFound(std::string const &SectionWord);
 
     int getNumObjectsFound(std::string const &ObjectWord);
@@ -219,8 +232,26 @@ private:
 
         json::const_iterator schemaIterator;
         std::vector<json::const_iterator> inputObjectIterators;
+        // 1-based idf order number of each object in JSON order, and the reverse; empty when idf_order is not available
+        std::vector<int> jsonToIDFOrder;
+        std::vector<int> idfToJSONOrder;
+        // uppercase object name to 1-based JSON order number
+        std::unordered_map<std::string, int> upperNameToJSONIndex;
+    };
+
+    struct BatchCache
+    {
+        bool active = false;
+        json objectDeltas;
+        std::unordered_map<std::string, json> decodedInputs; // input file name to decoded epJSON
     };
 
+    static BatchCache &batchCache();
+
+    bool decodeInputFile();
+
+    ObjectCache const *findObjectCache(std::string const &objectType);
+
     void addVariablesForMonthlyReport(std::string const &reportName);
 
     void addRecordToOutputVariableStructure(std::string const &KeyValue, std::string const &VariableName);
@@ -258,7 +289,7 @@ private:
     std::unique_ptr<IdfParser> idf_parser;
     std::unique_ptr<Validation> validation;
     std::unique_ptr<DataStorage> data;
-    json schema;
+    std::shared_ptr<json const> schema;
     public:
     json epJSON;
     private:
@@ -46,10 +46,15 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 // C++ Headers
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <unordered_set>
 
 // ObjexxFCL Headers
 
 // EnergyPlus Headers
+#include <FileSystem.hh>
 #include <InputProcessing/InputValidation.hh>
 #include <valijson/adapters/nlohmann_json_adapter.hpp>
 #include <valijson/schema.hpp>
@@ -59,9 +64,33 @@
 
 using json = nlohmann::json;
 
-Validation::Validation(json const *parsed_schema)
+namespace {
+std::shared_ptr<valijson::Schema const> sharedValidationSchema(std::shared_ptr<json const> const &schema)
+{
+    // Building the valijson schema tree is expensive, so keep the one built for the most recently used epJSON schema.
+    // Holding the epJSON schema pointer keeps it alive, so an address match always means the same schema.
+    static std::shared_ptr<json const> cached_schema;
+    static std::shared_ptr<valijson::Schema const> cached_validation_schema;
+    if (cached_schema != schema) {
+        auto validation_schema = std::make_shared<valijson::Schema>();
+        valijson::SchemaParser parser;
+        valijson::adapters::NlohmannJsonAdapter schema_doc(*schema);
+        parser.populateSchema(schema_doc, *validation_schema);
+        cached_validation_schema = validation_schema;
+        cached_schema = schema;
+    }
+    return cached_validation_schema;
+}
+
+std::uint64_t hashObject(std::string const &objectType, std::string const &objectName, json const &object)
+{
+    using EnergyPlus::FileSystem::hashString;
+    return hashString(object.dump(), hashString(objectName + '\n', hashString(objectType + '\n')));
+}
+} // namespace
+
+Validation::Validation(std::shared_ptr<json const> parsed_schema) : schema(std::move(parsed_schema))
 {
-    schema = parsed_schema;
 }
 
 bool Validation::hasErrors()
@@ -81,15 +110,12 @@ std::vector<std::string> const &Validation::warnings()
 
 bool Validation::validate(json const &parsed_input)
 {
-    valijson::Schema validation_schema;
-    valijson::SchemaParser parser;
-    valijson::adapters::NlohmannJsonAdapter schema_doc(*schema);
-    parser.populateSchema(schema_doc, validation_schema);
+    if (!validation_schema) validation_schema = sharedValidationSchema(schema);
 
     valijson::Validator validator;
     valijson::adapters::NlohmannJsonAdapter doc(parsed_input);
     valijson::ValidationResults results;
-    if (!validator.validate(validation_schema, doc, &results)) {
+    if (!validator.validate(*validation_schema, doc, &results)) {
         valijson::ValidationResults::Error error;
         size_t max_context = 0;
         while (results.popError(error)) {
@@ -109,3 +135,70 @@ bool Validation::validate(json const &parsed_input)
     }
     return true;
 }
+
+std::string Validation::schemaCacheKey()
+{
+    // The schema version and build identify which schema the cached objects were validated against
+    std::string key;
+    auto const version = schema->find("epJSON_schema_version");
+    if (version != schema->end()) key += version->dump();
+    auto const build = schema->find("epJSON_schema_build");
+    if (build != schema->end()) key += version != schema->end() ? " " + build->dump() : build->dump();
+    if (key.empty()) key = std::to_string(EnergyPlus::FileSystem::hashString(schema->dump()));
+    return key;
+}
+
+bool Validation::validate(json const &parsed_input, std::string const &cache_file_path)
+{
+    std::string const cacheKey = schemaCacheKey();
+
+    std::unordered_set<std::uint64_t> validatedHashes;
+    {
+        std::ifstream cacheFile(cache_file_path);
+        std::string line;
+        if (cacheFile.is_open() && std::getline(cacheFile, line) && line == cacheKey) {
+            std::uint64_t hash;
+            while (cacheFile >> hash) {
+                validatedHashes.insert(hash);
+            }
+        }
+    }
+
+    if (!parsed_input.is_object()) return validate(parsed_input);
+
+    // Only objects that have not been validated before are checked. Object types that restrict their count keep all
+    // of their objects, and every other type keeps at least one object so required object checks still see it.
+    auto const &schema_properties = schema->at("properties");
+    std::vector<std::uint64_t> inputHashes;
+    json changed_input = json::object();
+    for (auto type_iter = parsed_input.begin(); type_iter != parsed_input.end(); ++type_iter) {
+        auto const &objects = type_iter.value();
+        auto const schema_iter = schema_properties.find(type_iter.key());
+        if (!objects.is_object() || schema_iter == schema_properties.end() || schema_iter->find("maxProperties") != schema_iter->end()) {
+            changed_input[type_iter.key()] = objects;
+            continue;
+        }
+        json &changed_objects = changed_input[type_iter.key()];
+        changed_objects = json::object();
+        for (auto obj_iter = objects.begin(); obj_iter != objects.end(); ++obj_iter) {
+            auto const hash = hashObject(type_iter.key(), obj_iter.key(), obj_iter.value());
+            inputHashes.push_back(hash);
+            if (validatedHashes.find(hash) == validatedHashes.end()) {
+                changed_objects[obj_iter.key()] = obj_iter.value();
+            }
+        }
+        if (changed_objects.empty() && !objects.empty()) {
+            changed_objects[objects.begin().key()] = objects.begin().value();
+        }
+    }
+
+    bool const is_valid = validate(changed_input);
+    if (is_valid) {
+        std::ofstream cacheFile(cache_file_path, std::ofstream::out | std::ofstream::trunc);
+        cacheFile << cacheKey << '\n';
+        for (auto const hash : inputHashes) {
+            cacheFile << hash << '\n';
+        }
+    }
+    return is_valid;
+}
@@ -48,20 +48,29 @@
 #ifndef InputValidation_hh_INCLUDED
 #define InputValidation_hh_INCLUDED
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include <nlohmann/json.hpp>
 
+namespace valijson {
+class Schema;
+}
+
 class Validation
 {
 public:
     using json = nlohmann::json;
 
-    explicit Validation(json const *parsed_schema);
+    explicit Validation(std::shared_ptr<json const> parsed_schema);
 
     bool validate(json const &parsed_input);
 
+    // Same as validate(parsed_input), but objects whose content is listed in the cache file as having already passed
+    // validation against this schema are not validated again. The cache file is rewritten after a successful validation.
+    bool validate(json const &parsed_input, std::string const &cache_file_path);
+
     bool hasErrors();
 
     std::vector<std::string> const &errors();
@@ -69,7 +78,10 @@ public:
     std::vector<std::string> const &warnings();
 
 private:
-    json const *schema;
+    std::string schemaCacheKey();
+
+    std::shared_ptr<json const> schema;
+    std::shared_ptr<valijson::Schema const> validation_schema;
     std::vector<std::string> errors_;
     std::vector<std::string> warnings_;
 };
@@ -5607,6 +5607,51 @@ namespace InternalHeatGains {
         }
     }
 
+    void CalcZoneEquipGainRates(Array1D<ZoneEquipData> &ZoneEquip, // Electric, gas, other, hot water or steam equipment objects
+                                int const NumZoneEquip,             // Number of objects of this type
+                                bool const CalcCO2                  // Also set the CO2 gain rate (gas equipment)
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Set the power and heat gain rates of one type of scheduled zone equipment for the current time step.
+
+        // METHODOLOGY EMPLOYED:
+        // The power is the design level times the schedule value, limited by demand management and
+        // replaced by the EMS override when active.  The split into radiant, convected, latent and lost
+        // parts only depends on that power and on the (constant) fractions, so it is only redone for
+        // objects whose power changed since the last time step.
+
+        using ScheduleManager::GetCurrentScheduleValue;
+
+        for (int Loop = 1; Loop <= NumZoneEquip; ++Loop) {
+            auto &equip(ZoneEquip(Loop));
+            Real64 Q = equip.DesignLevel * GetCurrentScheduleValue(equip.SchedPtr);
+
+            // Reduce equipment power due to demand limiting
+            if (equip.ManageDemand && (Q > equip.DemandLimit)) Q = equip.DemandLimit;
+
+            // Set Q to EMS override if being called for by EMs
+            if (equip.EMSZoneEquipOverrideOn) Q = equip.EMSEquipPower;
+
+            if (Q == equip.Power) continue; // gain rates from the last time step still apply
+
+            equip.Power = Q;
+            equip.RadGainRate = Q * equip.FractionRadiant;
+            equip.ConGainRate = Q * equip.FractionConvected;
+            equip.LatGainRate = Q * equip.FractionLatent;
+            equip.LostRate = Q * equip.FractionLost;
+            equip.TotGainRate = Q - equip.LostRate;
+            if (CalcCO2) equip.CO2GainRate = Q * equip.CO2RateFactor;
+        }
+    }
+
     void InitInternalHeatGains()
     {
 
@@ -5868,22 +5913,8 @@ namespace InternalHeatGains {
             ZoneIntGain(NZ).QLTTOT += Lights(Loop).TotGainRate;
         }
 
+        CalcZoneEquipGainRates(ZoneElectric, TotElecEquip, false);
         for (Loop = 1; Loop <= TotElecEquip; ++Loop) {
-            Q = ZoneElectric(Loop).DesignLevel * GetCurrentScheduleValue(ZoneElectric(Loop).SchedPtr);
-
-            // Reduce equipment power due to demand limiting
-            if (ZoneElectric(Loop).ManageDemand && (Q > ZoneElectric(Loop).DemandLimit)) Q = ZoneElectric(Loop).DemandLimit;
-
-            // Set Q to EMS override if being called for by EMs
-            if (ZoneElectric(Loop).EMSZoneEquipOverrideOn) Q = ZoneElectric(Loop).EMSEquipPower;
-
-            ZoneElectric(Loop).Power = Q;
-            ZoneElectric(Loop).RadGainRate = Q * ZoneElectric(Loop).FractionRadiant;
-            ZoneElectric(Loop).ConGainRate = Q * ZoneElectric(Loop).FractionConvected;
-            ZoneElectric(Loop).LatGainRate = Q * ZoneElectric(Loop).FractionLatent;
-            ZoneElectric(Loop).LostRate = Q * ZoneElectric(Loop).FractionLost;
-            ZoneElectric(Loop).TotGainRate = Q - ZoneElectric(Loop).LostRate;
-
             NZ = ZoneElectric(Loop).ZonePtr;
             ZnRpt(NZ).ElecPower += ZoneElectric(Loop).Power;
             ZoneIntGain(NZ).QEERAD += ZoneElectric(Loop).RadGainRate;
@@ -5892,20 +5923,8 @@ namespace InternalHeatGains {
             ZoneIntGain(NZ).QEELost += ZoneElectric(Loop).LostRate;
         }
 
+        CalcZoneEquipGainRates(ZoneGas, TotGasEquip, true);
         for (Loop = 1; Loop <= TotGasEquip; ++Loop) {
-            Q = ZoneGas(Loop).DesignLevel * GetCurrentScheduleValue(ZoneGas(Loop).SchedPtr);
-
-            // Set Q to EMS override if being called for by EMs
-            if (ZoneGas(Loop).EMSZoneEquipOverrideOn) Q = ZoneGas(Loop).EMSEquipPower;
-
-            ZoneGas(Loop).Power = Q;
-            ZoneGas(Loop).RadGainRate = Q * ZoneGas(Loop).FractionRadiant;
-            ZoneGas(Loop).ConGainRate = Q * ZoneGas(Loop).FractionConvected;
-            ZoneGas(Loop).LatGainRate = Q * ZoneGas(Loop).FractionLatent;
-            ZoneGas(Loop).LostRate = Q * ZoneGas(Loop).FractionLost;
-            ZoneGas(Loop).TotGainRate = Q - ZoneGas(Loop).LostRate;
-            ZoneGas(Loop).CO2GainRate = Q * ZoneGas(Loop).CO2RateFactor;
-
             NZ = ZoneGas(Loop).ZonePtr;
             ZnRpt(NZ).GasPower += ZoneGas(Loop).Power;
             ZoneIntGain(NZ).QGERAD += ZoneGas(Loop).RadGainRate;
@@ -5914,19 +5933,8 @@ namespace InternalHeatGains {
             ZoneIntGain(NZ).QGELost += ZoneGas(Loop).LostRate;
         }
 
+        CalcZoneEquipGainRates(ZoneOtherEq, TotOthEquip, false);
         for (Loop = 1; Loop <= TotOthEquip; ++Loop) {
-            Q = ZoneOtherEq(Loop).DesignLevel * GetCurrentScheduleValue(ZoneOtherEq(Loop).SchedPtr);
-
-            // Set Q to EMS override if being called for by EMs
-            if (ZoneOtherEq(Loop).EMSZoneEquipOverrideOn) Q = ZoneOtherEq(Loop).EMSEquipPower;
-
-            ZoneOtherEq(Loop).Power = Q;
-            ZoneOtherEq(Loop).RadGainRate = Q * ZoneOtherEq(Loop).FractionRadiant;
-            ZoneOtherEq(Loop).ConGainRate = Q * ZoneOtherEq(Loop).FractionConvected;
-            ZoneOtherEq(Loop).LatGainRate = Q * ZoneOtherEq(Loop).FractionLatent;
-            ZoneOtherEq(Loop).LostRate = Q * ZoneOtherEq(Loop).FractionLost;
-            ZoneOtherEq(Loop).TotGainRate = Q - ZoneOtherEq(Loop).LostRate;
-
             NZ = ZoneOtherEq(Loop).ZonePtr;
             ZoneIntGain(NZ).QOERAD += ZoneOtherEq(Loop).RadGainRate;
             ZoneIntGain(NZ).QOECON += ZoneOtherEq(Loop).ConGainRate;
@@ -5934,19 +5942,8 @@ namespace InternalHeatGains {
             ZoneIntGain(NZ).QOELost += ZoneOtherEq(Loop).LostRate;
         }
 
+        CalcZoneEquipGainRates(ZoneHWEq, TotHWEquip, false);
         for (Loop = 1; Loop <= TotHWEquip; ++Loop) {
-            Q = ZoneHWEq(Loop).DesignLevel * GetCurrentScheduleValue(ZoneHWEq(Loop).SchedPtr);
-
-            // Set Q to EMS override if being called for by EMs
-            if (ZoneHWEq(Loop).EMSZoneEquipOverrideOn) Q = ZoneHWEq(Loop).EMSEquipPower;
-
-            ZoneHWEq(Loop).Power = Q;
-            ZoneHWEq(Loop).RadGainRate = Q * ZoneHWEq(Loop).FractionRadiant;
-            ZoneHWEq(Loop).ConGainRate = Q * ZoneHWEq(Loop).FractionConvected;
-            ZoneHWEq(Loop).LatGainRate = Q * ZoneHWEq(Loop).FractionLatent;
-            ZoneHWEq(Loop).LostRate = Q * ZoneHWEq(Loop).FractionLost;
-            ZoneHWEq(Loop).TotGainRate = Q - ZoneHWEq(Loop).LostRate;
-
             NZ = ZoneHWEq(Loop).ZonePtr;
             ZnRpt(NZ).HWPower += ZoneHWEq(Loop).Power;
             ZoneIntGain(NZ).QHWRAD += ZoneHWEq(Loop).RadGainRate;
@@ -5955,19 +5952,8 @@ namespace InternalHeatGains {
             ZoneIntGain(NZ).QHWLost += ZoneHWEq(Loop).LostRate;
         }
 
+        CalcZoneEquipGainRates(ZoneSteamEq, TotStmEquip, false);
         for (Loop = 1; Loop <= TotStmEquip; ++Loop) {
-            Q = ZoneSteamEq(Loop).DesignLevel * GetCurrentScheduleValue(ZoneSteamEq(Loop).SchedPtr);
-
-            // Set Q to EMS override if being called for by EMs
-            if (ZoneSteamEq(Loop).EMSZoneEquipOverrideOn) Q = ZoneSteamEq(Loop).EMSEquipPower;
-
-            ZoneSteamEq(Loop).Power = Q;
-            ZoneSteamEq(Loop).RadGainRate = Q * ZoneSteamEq(Loop).FractionRadiant;
-            ZoneSteamEq(Loop).ConGainRate = Q * ZoneSteamEq(Loop).FractionConvected;
-            ZoneSteamEq(Loop).LatGainRate = Q * ZoneSteamEq(Loop).FractionLatent;
-            ZoneSteamEq(Loop).LostRate = Q * ZoneSteamEq(Loop).FractionLost;
-            ZoneSteamEq(Loop).TotGainRate = Q - ZoneSteamEq(Loop).LostRate;
-
             NZ = ZoneSteamEq(Loop).ZonePtr;
             ZnRpt(NZ).SteamPower += ZoneSteamEq(Loop).Power;
             ZoneIntGain(NZ).QSERAD += ZoneSteamEq(Loop).RadGainRate;
@@ -6175,6 +6161,24 @@ namespace InternalHeatGains {
         int EnvClass;                                     // Index for environmental class (None=0, A1=1, A2=2, A3=3, A4=4, B=5, C=6)
         Array1D<Real64> ZoneSumTinMinusTSup(NumOfZones);  // Numerator for zone-level sensible heat index (SHI)
         Array1D<Real64> ZoneSumToutMinusTSup(NumOfZones); // Denominator for zone-level sensible heat index (SHI)
+        // Curve and psychrometric results of the previous object, reused by the next object when it has the same
+        // performance curves, CPU loading and inlet air conditions (e.g. many identical racks in one zone)
+        bool PrevITEqValid(false);        // True once a previous object's results are available
+        int PrevCPUPowerFLTCurve(0);      // CPU power curve of the previous object
+        int PrevAirFlowFLTCurve(0);       // Air flow curve of the previous object
+        int PrevFanPowerFFCurve(0);       // Fan power curve of the previous object
+        Real64 PrevCPULoadSchedFrac(0);   // CPU loading schedule fraction of the previous object
+        Real64 PrevTAirIn(0);             // Entering air dry-bulb temperature of the previous object [C]
+        Real64 PrevWAirIn(0);             // Entering air humidity ratio of the previous object [kgH2O/kgdryair]
+        Real64 PrevTAirInDesign(0);       // Design entering air dry-bulb temperature of the previous object [C]
+        Real64 CPUPowerFrac(0);           // CPU power curve value at the entering air temperature
+        Real64 CPUPowerFracDesignT(0);    // CPU power curve value at the design entering air temperature
+        Real64 AirFlowCurveVal(0);        // Air flow curve value at the entering air temperature
+        Real64 AirFlowCurveValDesignT(0); // Air flow curve value at the design entering air temperature
+        Real64 FanPowerFrac(0);           // Fan power curve value at the air flow fraction
+        Real64 FanPowerFracDesignT(0);    // Fan power curve value at the design air flow fraction
+        Real64 RhoAirIn(0);               // Entering air density [kg/m3]
+        Real64 CpAirIn(0);                // Entering air specific heat [J/kg-K]
 
         std::map<int, std::vector<int>> ZoneITEMap;
 
@@ -6307,27 +6311,45 @@ namespace InternalHeatGains {
                     WAirIn = ZoneAirHumRat(NZ);
                 }
             }
-            TDPAirIn = PsyTdpFnWPb(WAirIn, StdBaroPress, RoutineName);
-            RHAirIn = PsyRhFnTdbWPb(TAirIn, WAirIn, StdBaroPress, RoutineName);
-
             // Calculate power input and airflow
             TAirInDesign = ZoneITEq(Loop).DesignTAirIn;
 
-            CPUPower =
-                max(ZoneITEq(Loop).DesignCPUPower * OperSchedFrac * CurveValue(ZoneITEq(Loop).CPUPowerFLTCurve, CPULoadSchedFrac, TAirIn), 0.0);
-            ZoneITEq(Loop).CPUPowerAtDesign =
-                max(ZoneITEq(Loop).DesignCPUPower * OperSchedFrac * CurveValue(ZoneITEq(Loop).CPUPowerFLTCurve, CPULoadSchedFrac, TAirInDesign), 0.0);
-
-            AirVolFlowFrac = max(CurveValue(ZoneITEq(Loop).AirFlowFLTCurve, CPULoadSchedFrac, TAirIn), 0.0);
+            if (!PrevITEqValid || ZoneITEq(Loop).CPUPowerFLTCurve != PrevCPUPowerFLTCurve || ZoneITEq(Loop).AirFlowFLTCurve != PrevAirFlowFLTCurve ||
+                ZoneITEq(Loop).FanPowerFFCurve != PrevFanPowerFFCurve || CPULoadSchedFrac != PrevCPULoadSchedFrac || TAirIn != PrevTAirIn ||
+                WAirIn != PrevWAirIn || TAirInDesign != PrevTAirInDesign) {
+                TDPAirIn = PsyTdpFnWPb(WAirIn, StdBaroPress, RoutineName);
+                RHAirIn = PsyRhFnTdbWPb(TAirIn, WAirIn, StdBaroPress, RoutineName);
+                CPUPowerFrac = CurveValue(ZoneITEq(Loop).CPUPowerFLTCurve, CPULoadSchedFrac, TAirIn);
+                CPUPowerFracDesignT = CurveValue(ZoneITEq(Loop).CPUPowerFLTCurve, CPULoadSchedFrac, TAirInDesign);
+                AirFlowCurveVal = CurveValue(ZoneITEq(Loop).AirFlowFLTCurve, CPULoadSchedFrac, TAirIn);
+                AirFlowCurveValDesignT = CurveValue(ZoneITEq(Loop).AirFlowFLTCurve, CPULoadSchedFrac, TAirInDesign);
+                FanPowerFrac = CurveValue(ZoneITEq(Loop).FanPowerFFCurve, max(AirFlowCurveVal, 0.0));
+                FanPowerFracDesignT = CurveValue(ZoneITEq(Loop).FanPowerFFCurve, max(AirFlowCurveValDesignT, 0.0));
+                RhoAirIn = PsyRhoAirFnPbTdbW(StdBaroPress, TAirIn, WAirIn, RoutineName);
+                CpAirIn = PsyCpAirFnWTdb(WAirIn, TAirIn);
+
+                PrevITEqValid = true;
+                PrevCPUPowerFLTCurve = ZoneITEq(Loop).CPUPowerFLTCurve;
+                PrevAirFlowFLTCurve = ZoneITEq(Loop).AirFlowFLTCurve;
+                PrevFanPowerFFCurve = ZoneITEq(Loop).FanPowerFFCurve;
+                PrevCPULoadSchedFrac = CPULoadSchedFrac;
+                PrevTAirIn = TAirIn;
+                PrevWAirIn = WAirIn;
+                PrevTAirInDesign = TAirInDesign;
+            }
+
+            CPUPower = max(ZoneITEq(Loop).DesignCPUPower * OperSchedFrac * CPUPowerFrac, 0.0);
+            ZoneITEq(Loop).CPUPowerAtDesign = max(ZoneITEq(Loop).DesignCPUPower * OperSchedFrac * CPUPowerFracDesignT, 0.0);
+
+            AirVolFlowFrac = max(AirFlowCurveVal, 0.0);
             AirVolFlowRate = ZoneITEq(Loop).DesignAirVolFlowRate * OperSchedFrac * AirVolFlowFrac;
             if (AirVolFlowRate < SmallAirVolFlow) {
                 AirVolFlowRate = 0.0;
             }
-            AirVolFlowFracDesignT = max(CurveValue(ZoneITEq(Loop).AirFlowFLTCurve, CPULoadSchedFrac, TAirInDesign), 0.0);
+            AirVolFlowFracDesignT = max(AirFlowCurveValDesignT, 0.0);
 
-            FanPower = max(ZoneITEq(Loop).DesignFanPower * OperSchedFrac * CurveValue(ZoneITEq(Loop).FanPowerFFCurve, AirVolFlowFrac), 0.0);
-            ZoneITEq(Loop).FanPowerAtDesign =
-                max(ZoneITEq(Loop).DesignFanPower * OperSchedFrac * CurveValue(ZoneITEq(Loop).FanPowerFFCurve, AirVolFlowFracDesignT), 0.0);
+            FanPower = max(ZoneITEq(Loop).DesignFanPower * OperSchedFrac * FanPowerFrac, 0.0);
+            ZoneITEq(Loop).FanPowerAtDesign = max(ZoneITEq(Loop).DesignFanPower * OperSchedFrac * FanPowerFracDesignT, 0.0);
 
             // Calcaulate UPS net power input (power in less power to ITEquip) and UPS heat gain to zone
             if (ZoneITEq(Loop).DesignTotalPower > 0.0) {
@@ -6345,9 +6367,9 @@ namespace InternalHeatGains {
 
             // Calculate air outlet conditions and convective heat gain to zone
 
-            AirMassFlowRate = AirVolFlowRate * PsyRhoAirFnPbTdbW(StdBaroPress, TAirIn, WAirIn, RoutineName);
+            AirMassFlowRate = AirVolFlowRate * RhoAirIn;
             if (AirMassFlowRate > 0.0) {
-                TAirOut = TAirIn + (CPUPower + FanPower) / AirMassFlowRate / PsyCpAirFnWTdb(WAirIn, TAirIn);
+                TAirOut = TAirIn + (CPUPower + FanPower) / AirMassFlowRate / CpAirIn;
             } else {
                 TAirOut = TAirIn;
             }
@@ -6975,15 +6997,43 @@ namespace InternalHeatGains {
         }
 
         // store pointer values to hold generic internal gain values constant for entire timestep
+        // and sum them, in total and by device type, for the SumAllInternal*Gains and SumInternal*GainsByTypes queries
         for (NZ = 1; NZ <= NumOfZones; ++NZ) {
-            for (Loop = 1; Loop <= ZoneIntGain(NZ).NumberOfDevices; ++Loop) {
-                ZoneIntGain(NZ).Device(Loop).ConvectGainRate = ZoneIntGain(NZ).Device(Loop).PtrConvectGainRate;
-                ZoneIntGain(NZ).Device(Loop).ReturnAirConvGainRate = ZoneIntGain(NZ).Device(Loop).PtrReturnAirConvGainRate;
-                if (DoRadiationUpdate) ZoneIntGain(NZ).Device(Loop).RadiantGainRate = ZoneIntGain(NZ).Device(Loop).PtrRadiantGainRate;
-                ZoneIntGain(NZ).Device(Loop).LatentGainRate = ZoneIntGain(NZ).Device(Loop).PtrLatentGainRate;
-                ZoneIntGain(NZ).Device(Loop).ReturnAirLatentGainRate = ZoneIntGain(NZ).Device(Loop).PtrReturnAirLatentGainRate;
-                ZoneIntGain(NZ).Device(Loop).CarbonDioxideGainRate = ZoneIntGain(NZ).Device(Loop).PtrCarbonDioxideGainRate;
-                ZoneIntGain(NZ).Device(Loop).GenericContamGainRate = ZoneIntGain(NZ).Device(Loop).PtrGenericContamGainRate;
+            auto &zoneIntGain(ZoneIntGain(NZ));
+            if (!allocated(zoneIntGain.ConvectGainRateByType)) {
+                zoneIntGain.ConvectGainRateByType.allocate(NumZoneIntGainDeviceTypes);
+                zoneIntGain.RadiantGainRateByType.allocate(NumZoneIntGainDeviceTypes);
+                zoneIntGain.LatentGainRateByType.allocate(NumZoneIntGainDeviceTypes);
+                zoneIntGain.CarbonDioxideGainRateByType.allocate(NumZoneIntGainDeviceTypes);
+            }
+            zoneIntGain.TotConvectGainRate = 0.0;
+            zoneIntGain.TotRadiantGainRate = 0.0;
+            zoneIntGain.TotLatentGainRate = 0.0;
+            zoneIntGain.TotCarbonDioxideGainRate = 0.0;
+            zoneIntGain.ConvectGainRateByType = 0.0;
+            zoneIntGain.RadiantGainRateByType = 0.0;
+            zoneIntGain.LatentGainRateByType = 0.0;
+            zoneIntGain.CarbonDioxideGainRateByType = 0.0;
+            for (Loop = 1; Loop <= zoneIntGain.NumberOfDevices; ++Loop) {
+                auto &device(zoneIntGain.Device(Loop));
+                device.ConvectGainRate = device.PtrConvectGainRate;
+                device.ReturnAirConvGainRate = device.PtrReturnAirConvGainRate;
+                if (DoRadiationUpdate) device.RadiantGainRate = device.PtrRadiantGainRate;
+                device.LatentGainRate = device.PtrLatentGainRate;
+                device.ReturnAirLatentGainRate = device.PtrReturnAirLatentGainRate;
+                device.CarbonDioxideGainRate = device.PtrCarbonDioxideGainRate;
+                device.GenericContamGainRate = device.PtrGenericContamGainRate;
+
+                zoneIntGain.TotConvectGainRate += device.ConvectGainRate;
+                zoneIntGain.TotRadiantGainRate += device.RadiantGainRate;
+                zoneIntGain.TotLatentGainRate += device.LatentGainRate;
+                zoneIntGain.TotCarbonDioxideGainRate += device.CarbonDioxideGainRate;
+                if (device.CompTypeOfNum >= 1 && device.CompTypeOfNum <= NumZoneIntGainDeviceTypes) {
+                    zoneIntGain.ConvectGainRateByType(device.CompTypeOfNum) += device.ConvectGainRate;
+                    zoneIntGain.RadiantGainRateByType(device.CompTypeOfNum) += device.RadiantGainRate;
+                    zoneIntGain.LatentGainRateByType(device.CompTypeOfNum) += device.LatentGainRate;
+                    zoneIntGain.CarbonDioxideGainRateByType(device.CompTypeOfNum) += device.CarbonDioxideGainRate;
+                }
             }
             if (ReSumLatentGains) {
                 SumAllInternalLatentGains(NZ, ZoneLatentGain(NZ));
@@ -7046,6 +7096,11 @@ namespace InternalHeatGains {
             return;
         }
 
+        if (allocated(ZoneIntGain(ZoneNum).ConvectGainRateByType)) { // summed in UpdateInternalGainValues
+            SumConvGainRate = ZoneIntGain(ZoneNum).TotConvectGainRate;
+            return;
+        }
+
         for (DeviceNum = 1; DeviceNum <= ZoneIntGain(ZoneNum).NumberOfDevices; ++DeviceNum) {
             tmpSumConvGainRate += ZoneIntGain(ZoneNum).Device(DeviceNum).ConvectGainRate;
         }
@@ -7126,6 +7181,17 @@ namespace InternalHeatGains {
             return;
         }
 
+        // A single type's sum was accumulated in device order in UpdateInternalGainValues, so it matches the device loop
+        // exactly; several types go through the device loop to keep its summation order
+        if (NumberOfTypes == 1 && allocated(ZoneIntGain(ZoneNum).ConvectGainRateByType)) {
+            if (GainTypeARR(1) >= 1 && GainTypeARR(1) <= NumZoneIntGainDeviceTypes) {
+                SumConvGainRate = ZoneIntGain(ZoneNum).ConvectGainRateByType(GainTypeARR(1));
+            } else {
+                SumConvGainRate = 0.0;
+            }
+            return;
+        }
+
         for (DeviceNum = 1; DeviceNum <= ZoneIntGain(ZoneNum).NumberOfDevices; ++DeviceNum) {
             for (TypeNum = 1; TypeNum <= NumberOfTypes; ++TypeNum) {
 
@@ -7279,6 +7345,11 @@ namespace InternalHeatGains {
             return;
         }
 
+        if (allocated(ZoneIntGain(ZoneNum).RadiantGainRateByType)) { // summed in UpdateInternalGainValues
+            SumRadGainRate = ZoneIntGain(ZoneNum).TotRadiantGainRate;
+            return;
+        }
+
         for (DeviceNum = 1; DeviceNum <= ZoneIntGain(ZoneNum).NumberOfDevices; ++DeviceNum) {
             tmpSumRadGainRate += ZoneIntGain(ZoneNum).Device(DeviceNum).RadiantGainRate;
         }
@@ -7337,6 +7408,16 @@ namespace InternalHeatGains {
             return;
         }
 
+        // single type only, see SumInternalConvectionGainsByTypes
+        if (NumberOfTypes == 1 && allocated(ZoneIntGain(ZoneNum).RadiantGainRateByType)) {
+            if (GainTypeARR(1) >= 1 && GainTypeARR(1) <= NumZoneIntGainDeviceTypes) {
+                SumRadiationGainRate = ZoneIntGain(ZoneNum).RadiantGainRateByType(GainTypeARR(1));
+            } else {
+                SumRadiationGainRate = 0.0;
+            }
+            return;
+        }
+
         for (DeviceNum = 1; DeviceNum <= ZoneIntGain(ZoneNum).NumberOfDevices; ++DeviceNum) {
             for (TypeNum = 1; TypeNum <= NumberOfTypes; ++TypeNum) {
 
@@ -7394,6 +7475,11 @@ namespace InternalHeatGains {
             return;
         }
 
+        if (allocated(ZoneIntGain(ZoneNum).LatentGainRateByType)) { // summed in UpdateInternalGainValues
+            SumLatentGainRate = ZoneIntGain(ZoneNum).TotLatentGainRate;
+            return;
+        }
+
         for (DeviceNum = 1; DeviceNum <= ZoneIntGain(ZoneNum).NumberOfDevices; ++DeviceNum) {
             tmpSumLatentGainRate += ZoneIntGain(ZoneNum).Device(DeviceNum).LatentGainRate;
         }
@@ -7467,6 +7553,16 @@ namespace InternalHeatGains {
             return;
         }
 
+        // single type only, see SumInternalConvectionGainsByTypes
+        if (NumberOfTypes == 1 && allocated(ZoneIntGain(ZoneNum).LatentGainRateByType)) {
+            if (GainTypeARR(1) >= 1 && GainTypeARR(1) <= NumZoneIntGainDeviceTypes) {
+                SumLatentGainRate = ZoneIntGain(ZoneNum).LatentGainRateByType(GainTypeARR(1));
+            } else {
+                SumLatentGainRate = 0.0;
+            }
+            return;
+        }
+
         for (DeviceNum = 1; DeviceNum <= ZoneIntGain(ZoneNum).NumberOfDevices; ++DeviceNum) {
             for (TypeNum = 1; TypeNum <= NumberOfTypes; ++TypeNum) {
 
@@ -7581,6 +7677,11 @@ namespace InternalHeatGains {
             return;
         }
 
+        if (allocated(ZoneIntGain(ZoneNum).CarbonDioxideGainRateByType)) { // summed in UpdateInternalGainValues
+            SumCO2GainRate = ZoneIntGain(ZoneNum).TotCarbonDioxideGainRate;
+            return;
+        }
+
         for (DeviceNum = 1; DeviceNum <= ZoneIntGain(ZoneNum).NumberOfDevices; ++DeviceNum) {
             tmpSumCO2GainRate += ZoneIntGain(ZoneNum).Device(DeviceNum).CarbonDioxideGainRate;
         }
@@ -7655,6 +7756,16 @@ namespace InternalHeatGains {
             return;
         }
 
+        // single type only, see SumInternalConvectionGainsByTypes
+        if (NumberOfTypes == 1 && allocated(ZoneIntGain(ZoneNum).CarbonDioxideGainRateByType)) {
+            if (GainTypeARR(1) >= 1 && GainTypeARR(1) <= NumZoneIntGainDeviceTypes) {
+                SumCO2GainRate = ZoneIntGain(ZoneNum).CarbonDioxideGainRateByType(GainTypeARR(1));
+            } else {
+                SumCO2GainRate = 0.0;
+            }
+            return;
+        }
+
         for (DeviceNum = 1; DeviceNum <= ZoneIntGain(ZoneNum).NumberOfDevices; ++DeviceNum) {
             for (TypeNum = 1; TypeNum <= NumberOfTypes; ++TypeNum) {
 
@@ -54,6 +54,7 @@
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
+#include <DataHeatBalance.hh>
 #include <EnergyPlus.hh>
 
 namespace EnergyPlus {
@@ -82,6 +83,11 @@ namespace InternalHeatGains {
 
     void GetInternalHeatGainsInput();
 
+    void CalcZoneEquipGainRates(Array1D<DataHeatBalance::ZoneEquipData> &ZoneEquip, // Electric, gas, other, hot water or steam equipment objects
+                                int const NumZoneEquip,                              // Number of objects of this type
+                                bool const CalcCO2                                   // Also set the CO2 gain rate (gas equipment)
+    );
+
     void InitInternalHeatGains();
 
     void CheckReturnAirHeatGain();
@@ -0,0 +1,190 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// C++ Headers
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// EnergyPlus Headers
+#include <LiveOutputChannel.hh>
+
+namespace EnergyPlus {
+
+namespace {
+
+    void copyString(char *destination, std::size_t const length, std::string const &source)
+    {
+        std::size_t const count(std::min(source.size(), length - 1));
+        std::memcpy(destination, source.data(), count);
+        destination[count] = '\0';
+    }
+
+} // namespace
+
+LiveOutputChannel::LiveOutputChannel(std::string const &name, std::vector<Variable> const &variables, std::uint32_t const capacity)
+    : name(name), size(0), mapping(nullptr), mappingHandle(nullptr), header(nullptr), published(0)
+{
+    std::uint32_t const slots(std::max(capacity, std::uint32_t(1)));
+    std::size_t const variablesOffset((sizeof(EPLiveOutputHeader) + 63) / 64 * 64);
+    std::size_t const recordsOffset((variablesOffset + variables.size() * sizeof(EPLiveOutputVariable) + 63) / 64 * 64);
+    std::size_t const recordSize(sizeof(EPLiveOutputRecord) + variables.size() * sizeof(double));
+    size = recordsOffset + slots * recordSize;
+
+#ifdef _WIN32
+    HANDLE handle(CreateFileMappingA(
+        INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, DWORD(std::uint64_t(size) >> 32), DWORD(size & 0xFFFFFFFFu), name.c_str()));
+    if (handle == nullptr) return;
+    mapping = MapViewOfFile(handle, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (mapping == nullptr) {
+        CloseHandle(handle);
+        return;
+    }
+    mappingHandle = handle;
+#else
+    // POSIX shared memory names start with a slash
+    if (this->name.empty() || this->name[0] != '/') this->name.insert(0, 1, '/');
+    int const fd(shm_open(this->name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644));
+    if (fd == -1) return;
+    if (ftruncate(fd, off_t(size)) != 0) {
+        ::close(fd);
+        shm_unlink(this->name.c_str());
+        return;
+    }
+    mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        shm_unlink(this->name.c_str());
+        return;
+    }
+#endif
+
+    char *base(static_cast<char *>(mapping));
+    std::memset(base, 0, recordsOffset);
+    auto *entries(reinterpret_cast<EPLiveOutputVariable *>(base + variablesOffset));
+    for (std::size_t i = 0; i < variables.size(); ++i) {
+        entries[i].reportID = variables[i].reportID;
+        entries[i].indexType = variables[i].indexType;
+        copyString(entries[i].name, EP_LIVE_OUTPUT_NAME_LENGTH, variables[i].name);
+        copyString(entries[i].units, EP_LIVE_OUTPUT_UNITS_LENGTH, variables[i].units);
+    }
+    for (std::uint32_t slot = 0; slot < slots; ++slot) {
+        reinterpret_cast<EPLiveOutputRecord *>(base + recordsOffset + slot * recordSize)->sequence = 0;
+    }
+
+    header = reinterpret_cast<EPLiveOutputHeader *>(base);
+    header->version = EP_LIVE_OUTPUT_VERSION;
+    header->numVariables = std::uint32_t(variables.size());
+    header->capacity = slots;
+    header->recordSize = recordSize;
+    header->variablesOffset = variablesOffset;
+    header->recordsOffset = recordsOffset;
+    header->published = 0;
+    header->finished = 0;
+    // readers check the magic number last
+    epLiveOutputFence();
+    header->magic = EP_LIVE_OUTPUT_MAGIC;
+}
+
+LiveOutputChannel::~LiveOutputChannel()
+{
+    close();
+}
+
+void LiveOutputChannel::publish(
+    int const dayOfSim, int const month, int const dayOfMonth, int const hourOfDay, Real64 const endMinute, Real64 const *values)
+{
+    if (!isOpen()) return;
+
+    char *slot(reinterpret_cast<char *>(header) + header->recordsOffset + (published % header->capacity) * header->recordSize);
+    auto *record(reinterpret_cast<EPLiveOutputRecord *>(slot));
+
+    epLiveOutputStoreRelease(&record->sequence, 2 * published + 1);
+    epLiveOutputFence();
+    record->dayOfSim = dayOfSim;
+    record->month = month;
+    record->dayOfMonth = dayOfMonth;
+    record->hourOfDay = hourOfDay;
+    record->endMinute = endMinute;
+    std::memcpy(slot + sizeof(EPLiveOutputRecord), values, header->numVariables * sizeof(double));
+    epLiveOutputStoreRelease(&record->sequence, 2 * published + 2);
+
+    ++published;
+    epLiveOutputStoreRelease(&header->published, published);
+}
+
+void LiveOutputChannel::close()
+{
+    if (!isOpen()) return;
+
+    epLiveOutputFence();
+    header->finished = 1;
+    epLiveOutputFence();
+    header = nullptr;
+
+#ifdef _WIN32
+    // the mapping disappears once the last reader closes it
+    UnmapViewOfFile(mapping);
+    CloseHandle(static_cast<HANDLE>(mappingHandle));
+    mappingHandle = nullptr;
+#else
+    // readers that already have the channel mapped keep their mapping
+    munmap(mapping, size);
+    shm_unlink(name.c_str());
+#endif
+    mapping = nullptr;
+}
+
+} // namespace EnergyPlus
@@ -0,0 +1,209 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "LiveOutputReader.h"
+
+struct EPLiveOutputReader
+{
+    const char *base;
+    size_t size;
+#ifdef _WIN32
+    HANDLE handle;
+#endif
+};
+
+static const EPLiveOutputHeader *header(const EPLiveOutputReader *reader)
+{
+    return (const EPLiveOutputHeader *)reader->base;
+}
+
+EPLiveOutputReader *epLiveOutputOpen(const char *name)
+{
+    EPLiveOutputReader *reader;
+    const EPLiveOutputHeader *h;
+    void *mapping;
+    size_t size;
+
+#ifdef _WIN32
+    MEMORY_BASIC_INFORMATION info;
+    HANDLE handle = OpenFileMappingA(FILE_MAP_READ, FALSE, name);
+    if (handle == NULL) return NULL;
+    mapping = MapViewOfFile(handle, FILE_MAP_READ, 0, 0, 0);
+    if (mapping == NULL) {
+        CloseHandle(handle);
+        return NULL;
+    }
+    VirtualQuery(mapping, &info, sizeof(info));
+    size = info.RegionSize;
+#else
+    struct stat status;
+    int fd;
+    if (name[0] == '/') {
+        fd = shm_open(name, O_RDONLY, 0);
+    } else {
+        /* POSIX shared memory names start with a slash; the simulation adds one if it is missing */
+        char *slashName = (char *)malloc(strlen(name) + 2);
+        if (slashName == NULL) return NULL;
+        slashName[0] = '/';
+        strcpy(slashName + 1, name);
+        fd = shm_open(slashName, O_RDONLY, 0);
+        free(slashName);
+    }
+    if (fd == -1) return NULL;
+    if (fstat(fd, &status) != 0 || (size_t)status.st_size < sizeof(EPLiveOutputHeader)) {
+        close(fd);
+        return NULL;
+    }
+    size = (size_t)status.st_size;
+    mapping = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) return NULL;
+#endif
+
+    h = (const EPLiveOutputHeader *)mapping;
+    epLiveOutputFence();
+    if (h->magic != EP_LIVE_OUTPUT_MAGIC || h->version != EP_LIVE_OUTPUT_VERSION ||
+        h->recordsOffset + (uint64_t)h->capacity * h->recordSize > size) {
+#ifdef _WIN32
+        UnmapViewOfFile(mapping);
+        CloseHandle(handle);
+#else
+        munmap(mapping, size);
+#endif
+        return NULL;
+    }
+    epLiveOutputFence();
+
+    reader = (EPLiveOutputReader *)malloc(sizeof(EPLiveOutputReader));
+    if (reader == NULL) {
+#ifdef _WIN32
+        UnmapViewOfFile(mapping);
+        CloseHandle(handle);
+#else
+        munmap(mapping, size);
+#endif
+        return NULL;
+    }
+    reader->base = (const char *)mapping;
+    reader->size = size;
+#ifdef _WIN32
+    reader->handle = handle;
+#endif
+    return reader;
+}
+
+void epLiveOutputClose(EPLiveOutputReader *reader)
+{
+    if (reader == NULL) return;
+#ifdef _WIN32
+    UnmapViewOfFile((void *)reader->base);
+    CloseHandle(reader->handle);
+#else
+    munmap((void *)reader->base, reader->size);
+#endif
+    free(reader);
+}
+
+unsigned epLiveOutputNumVariables(const EPLiveOutputReader *reader)
+{
+    return header(reader)->numVariables;
+}
+
+const EPLiveOutputVariable *epLiveOutputVariable(const EPLiveOutputReader *reader, unsigned index)
+{
+    if (index >= header(reader)->numVariables) return NULL;
+    return (const EPLiveOutputVariable *)(reader->base + header(reader)->variablesOffset) + index;
+}
+
+uint64_t epLiveOutputPublished(const EPLiveOutputReader *reader)
+{
+    return epLiveOutputLoadAcquire(&header(reader)->published);
+}
+
+int epLiveOutputFinished(const EPLiveOutputReader *reader)
+{
+    int finished;
+    epLiveOutputFence();
+    finished = ((const volatile EPLiveOutputHeader *)header(reader))->finished != 0;
+    epLiveOutputFence();
+    return finished;
+}
+
+int epLiveOutputRead(const EPLiveOutputReader *reader, uint64_t n, EPLiveOutputRecord *time, double *values)
+{
+    const EPLiveOutputHeader *h = header(reader);
+    const char *slot;
+    const EPLiveOutputRecord *record;
+    uint64_t const complete = 2 * n + 2;
+    uint64_t before;
+
+    if (n >= epLiveOutputLoadAcquire(&h->published)) return EP_LIVE_OUTPUT_NOT_YET;
+
+    slot = reader->base + h->recordsOffset + (n % h->capacity) * h->recordSize;
+    record = (const EPLiveOutputRecord *)slot;
+
+    before = epLiveOutputLoadAcquire(&record->sequence);
+    if (before != complete) return EP_LIVE_OUTPUT_OVERWRITTEN;
+    memcpy(time, record, sizeof(EPLiveOutputRecord));
+    memcpy(values, slot + sizeof(EPLiveOutputRecord), h->numVariables * sizeof(double));
+    epLiveOutputFence();
+    if (epLiveOutputLoadAcquire(&record->sequence) != complete) return EP_LIVE_OUTPUT_OVERWRITTEN;
+    time->sequence = complete;
+    return EP_LIVE_OUTPUT_OK;
+}
@@ -63,6 +63,7 @@
 #include <DataMoistureBalanceEMPD.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <General.hh>
 #include <InputProcessing/InputProcessor.hh>
 #include <MoistureBalanceEMPDManager.hh>
@@ -449,7 +450,7 @@ namespace MoistureBalanceEMPDManager {
         // SUBROUTINE INFORMATION:
         //   Authors:        Muthusamy Swami and Lixing Gu
         //   Date written:   August, 1999
-        //   Modified:       na
+        //   Modified:       October 2026, surface calculation moved to CalcMoistureBalanceEMPDSurface
         //   Re-engineered:  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -458,6 +459,71 @@ namespace MoistureBalanceEMPDManager {
         // METHODOLOGY EMPLOYED:
         // na
 
+        static bool OneTimeFlag(true);
+
+        if (BeginEnvrnFlag && OneTimeFlag) {
+            InitMoistureBalanceEMPD();
+            OneTimeFlag = false;
+        }
+
+        if (!BeginEnvrnFlag) {
+            OneTimeFlag = true;
+        }
+
+        CalcMoistureBalanceEMPDSurface(SurfNum, TempSurfIn, TempZone, TempSat);
+    }
+
+    void ManageMoistureBalanceEMPDSurfaces(std::vector<int> const &SurfNums,
+                                           Array1D<Real64> const &TempSurfIn, // INSIDE SURFACE TEMPERATURE at current time step
+                                           Array1D<Real64> &TempSat           // Saturated surface temperature.
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Solves the EMPD moisture balance of a batch of surfaces for the current inside heat balance iteration in parallel.
+
+        // METHODOLOGY EMPLOYED:
+        // The first surface goes through CalcMoistureBalanceEMPD so the model is initialised before threading.
+        // Each surface only updates its own moisture state and report variables.
+
+        // Using/Aliasing
+        using DataHeatBalFanSys::MAT;
+
+        if (SurfNums.empty()) return;
+        CalcMoistureBalanceEMPD(SurfNums[0], TempSurfIn(SurfNums[0]), MAT(Surface(SurfNums[0]).Zone), TempSat(SurfNums[0]));
+
+        int const nSurfs(static_cast<int>(SurfNums.size()));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(DataSystemVariables::NumberIntRadThreads) if (nSurfs > 2)
+#endif
+        for (int iSurf = 1; iSurf < nSurfs; ++iSurf) {
+            int const SurfNum(SurfNums[iSurf]);
+            CalcMoistureBalanceEMPDSurface(SurfNum, TempSurfIn(SurfNum), MAT(Surface(SurfNum).Zone), TempSat(SurfNum));
+        }
+    }
+
+    void CalcMoistureBalanceEMPDSurface(int const SurfNum,
+                                        Real64 const TempSurfIn, // INSIDE SURFACE TEMPERATURE at current time step
+                                        Real64 const TempZone,   // Zone temperature at current time step.
+                                        Real64 &TempSat          // Saturated surface temperature.
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //   Authors:        Muthusamy Swami and Lixing Gu
+        //   Date written:   August, 1999
+        //   Modified:       October 2026, split from CalcMoistureBalanceEMPD so surfaces can be solved in parallel
+        //   Re-engineered:  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Calculate surface moisture level using EMPD model for one surface once the model is initialised
+
         // Using/Aliasing
         using DataMoistureBalanceEMPD::Lam;
         using Psychrometrics::PsyCpAirFnWTdb;
@@ -496,7 +562,6 @@ namespace MoistureBalanceEMPDManager {
         Real64 RVaver; // Average zone vapor density
         Real64 dU_dRH;
         int Flag; // Convergence flag (0 - converged)
-        static bool OneTimeFlag(true);
         Real64 PVsurf;        // Surface vapor pressure
         Real64 PV_surf_layer; // Vapor pressure of surface layer
         Real64 PV_deep_layer;
@@ -509,15 +574,6 @@ namespace MoistureBalanceEMPDManager {
         Real64 RH_surf_layer_tmp;
         Real64 RH_deep_layer;
 
-        if (BeginEnvrnFlag && OneTimeFlag) {
-            InitMoistureBalanceEMPD();
-            OneTimeFlag = false;
-        }
-
-        if (!BeginEnvrnFlag) {
-            OneTimeFlag = true;
-        }
-
         auto const &surface(Surface(SurfNum));                 // input
         auto &rv_surface(RVSurface(SurfNum));                  // output
         auto const &rv_surface_old(RVSurfaceOld(SurfNum));     // input
@@ -48,6 +48,9 @@
 #ifndef MoistureBalanceEMPDManager_hh_INCLUDED
 #define MoistureBalanceEMPDManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -102,6 +105,17 @@ namespace MoistureBalanceEMPDManager {
                                  Real64 &TempSat          // Satutare surface temperature.
     );
 
+    void ManageMoistureBalanceEMPDSurfaces(std::vector<int> const &SurfNums,
+                                           Array1D<Real64> const &TempSurfIn, // INSIDE SURFACE TEMPERATURE at current time step
+                                           Array1D<Real64> &TempSat           // Saturated surface temperature.
+    );
+
+    void CalcMoistureBalanceEMPDSurface(int const SurfNum,
+                                        Real64 const TempSurfIn, // INSIDE SURFACE TEMPERATURE at current time step
+                                        Real64 const TempZone,   // Zone temperature at current time step.
+                                        Real64 &TempSat          // Saturated surface temperature.
+    );
+
     void clear_state();
 
     void UpdateMoistureBalanceEMPD(int const SurfNum); // Surface number
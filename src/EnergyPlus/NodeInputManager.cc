@@ -47,6 +47,8 @@
 
 // C++ Headers
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -122,6 +124,9 @@ namespace NodeInputManager {
     int MaxCheckNodes(0);            // Current "max" unique nodes in check
     bool NodeVarsSetup(false);       // Setup indicator of node vars for reporting (also that all nodes have been entered)
     Array1D_bool NodeWetBulbRepReq;
+    UtilityRoutines::NameIndex NodeIDIndex;          // Hashed lookup of NodeID(1:NumOfUniqueNodeNames)
+    UtilityRoutines::NameIndex NodeListsIndex;       // Hashed lookup of NodeLists(1:NumOfNodeLists)%Name
+    UtilityRoutines::NameIndex UniqueNodeNamesIndex; // Hashed lookup of UniqueNodeNames(1:NumCheckNodes)
 
     // Object Data
     Array1D<NodeListDef> NodeLists; // Node Lists
@@ -154,6 +159,9 @@ namespace NodeInputManager {
         GetOnlySingleNodeNodeNums.deallocate();
         GetOnlySingleNodeFirstTime = true;
         NodeWetBulbRepReq.deallocate();
+        NodeIDIndex.clear();
+        NodeListsIndex.clear();
+        UniqueNodeNamesIndex.clear();
     }
 
     void GetNodeNums(std::string const &Name,                  // Name for which to obtain information
@@ -175,6 +183,7 @@ namespace NodeInputManager {
         //       AUTHOR         Linda K. Lawrie
         //       DATE WRITTEN   September 1999
         //       MODIFIED       February 2004, Fluid Type checking/setting
+        //                      October 2026, hashed node list lookup
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -232,7 +241,7 @@ namespace NodeInputManager {
         }
 
         if (not_blank(Name)) {
-            ThisOne = UtilityRoutines::FindItemInList(Name, NodeLists);
+            ThisOne = UtilityRoutines::FindItemInList(Name, NodeListsIndex);
             if (ThisOne != 0) {
                 NumNodes = NodeLists(ThisOne).NumOfNodesInList;
                 NodeNumbers({1, NumNodes}) = NodeLists(ThisOne).NodeNumbers({1, NumNodes});
@@ -570,7 +579,7 @@ namespace NodeInputManager {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Linda K. Lawrie
         //       DATE WRITTEN   September 1999
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, hashed node list names
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -578,7 +587,8 @@ namespace NodeInputManager {
         // Node List Data Structure.
 
         // METHODOLOGY EMPLOYED:
-        // na
+        // Node list names are indexed once, both for GetNodeNums and for the check that no
+        // node in a list is named like another list.
 
         // REFERENCES:
         // na
@@ -680,15 +690,24 @@ namespace NodeInputManager {
             }
         }
 
+        NodeListsIndex.build(NodeLists, NumOfNodeLists);
+
+        // Lists by case-insensitive name, in list order
+        std::unordered_map<std::string, std::vector<int>> NodeListsByName;
+        for (Loop1 = 1; Loop1 <= NumOfNodeLists; ++Loop1) {
+            NodeListsByName[UtilityRoutines::MakeUPPERCase(NodeLists(Loop1).Name)].push_back(Loop1);
+        }
+
         for (Loop = 1; Loop <= NumOfNodeLists; ++Loop) {
             for (Loop2 = 1; Loop2 <= NodeLists(Loop).NumOfNodesInList; ++Loop2) {
-                for (Loop1 = 1; Loop1 <= NumOfNodeLists; ++Loop1) {
-                    if (Loop == Loop1) continue; // within a nodelist have already checked to see if node name duplicates nodelist name
-                    if (!UtilityRoutines::SameString(NodeLists(Loop).NodeNames(Loop2), NodeLists(Loop1).Name)) continue;
-                    ShowSevereError(RoutineName + CurrentModuleObject + "=\"" + NodeLists(Loop1).Name + "\", invalid node name in list.");
+                auto const sameNameLists = NodeListsByName.find(UtilityRoutines::MakeUPPERCase(NodeLists(Loop).NodeNames(Loop2)));
+                if (sameNameLists == NodeListsByName.end()) continue;
+                for (int const OtherList : sameNameLists->second) {
+                    if (Loop == OtherList) continue; // within a nodelist have already checked to see if node name duplicates nodelist name
+                    ShowSevereError(RoutineName + CurrentModuleObject + "=\"" + NodeLists(OtherList).Name + "\", invalid node name in list.");
                     ShowContinueError("... Node " + TrimSigDigits(Loop2) + " Name=\"" + NodeLists(Loop).NodeNames(Loop2) +
                                       "\", duplicates NodeList Name.");
-                    ShowContinueError("... NodeList=\"" + NodeLists(Loop1).Name + "\", is duplicated.");
+                    ShowContinueError("... NodeList=\"" + NodeLists(OtherList).Name + "\", is duplicated.");
                     ShowContinueError("... Items in NodeLists must not be the name of another NodeList.");
                     localErrorsFound = true;
                 }
@@ -758,7 +777,8 @@ namespace NodeInputManager {
 
         NumNode = 0;
         if (NumOfUniqueNodeNames > 0) {
-            NumNode = UtilityRoutines::FindItemInList(Name, NodeID({1, NumOfUniqueNodeNames}), NumOfUniqueNodeNames);
+            if (NodeIDIndex.size() != NumOfUniqueNodeNames) NodeIDIndex.build(NodeID, NumOfUniqueNodeNames);
+            NumNode = UtilityRoutines::FindItemInList(Name, NodeIDIndex);
             if (NumNode > 0) {
                 AssignNodeNumber = NumNode;
                 ++NodeRef(NumNode);
@@ -785,6 +805,7 @@ namespace NodeInputManager {
                 Node(NumOfNodes).FluidType = NodeFluidType;
                 NodeRef(NumOfNodes) = 0;
                 NodeID(NumOfUniqueNodeNames) = Name;
+                NodeIDIndex.add(Name, NumOfUniqueNodeNames);
 
                 AssignNodeNumber = NumOfUniqueNodeNames;
             }
@@ -800,6 +821,8 @@ namespace NodeInputManager {
             NumOfUniqueNodeNames = 1;
             NodeID(0) = "Undefined";
             NodeID(NumOfUniqueNodeNames) = Name;
+            NodeIDIndex.clear();
+            NodeIDIndex.add(Name, NumOfUniqueNodeNames);
             AssignNodeNumber = 1;
             NodeRef(1) = 0;
         }
@@ -807,6 +830,22 @@ namespace NodeInputManager {
         return AssignNodeNumber;
     }
 
+    int FindNodeNumber(std::string const &Name) // Node name to look up
+    {
+
+        // FUNCTION INFORMATION:
+        //       DATE WRITTEN   October 2026
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns the number of the node with this exact name, or 0 when no node has it.
+        // Same result as searching NodeID(1:NumOfNodes) with FindItemInList, from the hashed
+        // index kept by AssignNodeNumber.
+
+        if (NumOfNodes <= 0) return 0;
+        if (NodeIDIndex.size() != NumOfNodes) NodeIDIndex.build(NodeID, NumOfNodes);
+        return UtilityRoutines::FindItemInList(Name, NodeIDIndex);
+    }
+
     int GetOnlySingleNode(std::string const &NodeName,
                           bool &errFlag,
                           std::string const &NodeObjectType,   // Node Object Type (i.e. "Chiller:Electric")
@@ -966,6 +1005,7 @@ namespace NodeInputManager {
         NumCheckNodes = 0;
         MaxCheckNodes = 100;
         UniqueNodeNames.allocate(MaxCheckNodes);
+        UniqueNodeNamesIndex.clear();
         CurCheckContextName = ContextName;
     }
 
@@ -980,7 +1020,7 @@ namespace NodeInputManager {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Linda Lawrie
         //       DATE WRITTEN   November 2002
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, hashed lookup of the names already checked
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -1026,7 +1066,7 @@ namespace NodeInputManager {
                     ShowFatalError("Routine CheckUniqueNodes called with Nodetypes=NodeName, but did not include CheckName argument.");
                 }
                 if (!CheckName().empty()) {
-                    Found = UtilityRoutines::FindItemInList(CheckName, UniqueNodeNames, NumCheckNodes);
+                    Found = UtilityRoutines::FindItemInList(CheckName, UniqueNodeNamesIndex);
                     if (Found != 0) {
                         ShowSevereError(CurCheckContextName + "=\"" + ObjectName + "\", duplicate node names found.");
                         ShowContinueError("...for Node Type(s)=" + NodeTypes + ", duplicate node name=\"" + CheckName + "\".");
@@ -1040,6 +1080,7 @@ namespace NodeInputManager {
                             UniqueNodeNames.redimension(MaxCheckNodes += 100);
                         }
                         UniqueNodeNames(NumCheckNodes) = CheckName;
+                        UniqueNodeNamesIndex.add(CheckName, NumCheckNodes);
                     }
                 }
 
@@ -1048,7 +1089,7 @@ namespace NodeInputManager {
                     ShowFatalError("Routine CheckUniqueNodes called with Nodetypes=NodeNumber, but did not include CheckNumber argument.");
                 }
                 if (CheckNumber != 0) {
-                    Found = UtilityRoutines::FindItemInList(NodeID(CheckNumber), UniqueNodeNames, NumCheckNodes);
+                    Found = UtilityRoutines::FindItemInList(NodeID(CheckNumber), UniqueNodeNamesIndex);
                     if (Found != 0) {
                         ShowSevereError(CurCheckContextName + "=\"" + ObjectName + "\", duplicate node names found.");
                         ShowContinueError("...for Node Type(s)=" + NodeTypes + ", duplicate node name=\"" + NodeID(CheckNumber) + "\".");
@@ -1062,6 +1103,7 @@ namespace NodeInputManager {
                             UniqueNodeNames.redimension(MaxCheckNodes += 100);
                         }
                         UniqueNodeNames(NumCheckNodes) = NodeID(CheckNumber);
+                        UniqueNodeNamesIndex.add(NodeID(CheckNumber), NumCheckNodes);
                     }
                 }
 
@@ -1118,6 +1160,7 @@ namespace NodeInputManager {
         if (allocated(UniqueNodeNames)) {
             UniqueNodeNames.deallocate();
         }
+        UniqueNodeNamesIndex.clear();
     }
 
     void CalcMoreNodeInfo()
@@ -136,6 +136,8 @@ namespace NodeInputManager {
                          int const NodeFluidType, // must be valid
                          bool &ErrorsFound);
 
+    int FindNodeNumber(std::string const &Name); // Node name to look up
+
     int GetOnlySingleNode(std::string const &NodeName,
                           bool &errFlag,
                           std::string const &NodeObjectType,       // Node Object Type (i.e. "Chiller:Electric")
@@ -50,11 +50,16 @@
 #include <cassert>
 #include <cmath>
 #include <cstdio>
+#include <cstdint>
 #include <cstring>
 #include <fstream>
+#include <memory>
 #include <ostream>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -64,6 +69,7 @@
 
 // EnergyPlus Headers
 #include "re2/re2.h"
+#include <AsyncOutputBuffer.hh>
 #include <CommandLineInterface.hh>
 #include <DataEnvironment.hh>
 #include <DataGlobalConstants.hh>
@@ -73,14 +79,18 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
+#include <EsoDictionary.hh>
 #include <General.hh>
 #include <GlobalNames.hh>
 #include <InputProcessing/InputProcessor.hh>
+#include <LiveOutputChannel.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
 #include <ResultsSchema.hh>
 #include <SQLiteProcedures.hh>
 #include <ScheduleManager.hh>
+#include <SimulationTelemetry.hh>
 #include <SortAndStringUtilities.hh>
 #include <UtilityRoutines.hh>
 #include <milo/dtoa.h>
@@ -236,6 +246,10 @@ namespace OutputProcessor {
 
     int NumEnergyMeters(0);     // Current number of Energy Meters
     Array1D<Real64> MeterValue; // This holds the current timestep value for each meter.
+    std::vector<RealVariables *> MeteredRVariables; // Active metered RVariables (the columns of the meter matrix)
+    std::vector<Real64> MeteredRVariableValues;     // Multiplied time step value of each metered RVariable
+    std::vector<int> MeterMatrixRowStart;           // Start of each meter's row in MeterMatrixColumns (CSR, 0-based)
+    std::vector<int> MeterMatrixColumns;            // MeteredRVariables index of each variable-on-meter entry
 
     int TimeStepStampReportNbr;             // TimeStep and Hourly Report number
     std::string TimeStepStampReportChr;     // TimeStep and Hourly Report number (character -- for printing)
@@ -259,6 +273,8 @@ namespace OutputProcessor {
     int MaxNumSubcategories(1);
     bool isFinalYear(false);
 
+    std::ofstream bin_stream; // Binary time series output stream (eplusout.bin)
+
     bool GetOutputInputFlag(true);
 
     ReportingFrequency minimumReportFrequency(ReportingFrequency::EachCall);
@@ -275,6 +291,42 @@ namespace OutputProcessor {
         Real64 LEndMin(-1.0);              // Helps set minutes for timestamp output
         bool GetMeterIndexFirstCall(true); // trigger setup in GetMeterIndex
         bool InitFlag(true);
+
+        // Output:Variable requests indexed by upper case variable name, in input order, so each registration
+        // only looks at the requests for its own variable
+        std::unordered_map<std::string, std::vector<int>> ReqRepVarsByName;
+        // Key of each request compiled once as a case insensitive pattern; null for blank keys and for plain
+        // ASCII names without regular expression characters, which match exactly when SameString does
+        std::vector<std::unique_ptr<RE2>> ReqRepKeyPatterns;
+
+        // Indices of the requests for VariableName, or nullptr when there are none
+        std::vector<int> const *RequestsForVariable(std::string const &VariableName)
+        {
+            auto const found = ReqRepVarsByName.find(UtilityRoutines::MakeUPPERCase(VariableName));
+            return found != ReqRepVarsByName.end() ? &found->second : nullptr;
+        }
+
+        bool KeyMatchesRequest(int const ReqNum, std::string const &KeyedValue)
+        {
+            if (UtilityRoutines::SameString(ReqRepVars(ReqNum).Key, KeyedValue)) return true;
+            RE2 const *pattern = ReqRepKeyPatterns[ReqNum - 1].get();
+            return (pattern != nullptr) && RE2::FullMatch(KeyedValue, *pattern);
+        }
+
+        void IndexReqRepVars()
+        {
+            ReqRepVarsByName.clear();
+            ReqRepKeyPatterns.clear();
+            ReqRepKeyPatterns.resize(NumOfReqVariables);
+            for (int Loop = 1; Loop <= NumOfReqVariables; ++Loop) {
+                ReqRepVarsByName[UtilityRoutines::MakeUPPERCase(ReqRepVars(Loop).VarName)].push_back(Loop);
+                std::string const &Key = ReqRepVars(Loop).Key;
+                bool const plainName = std::all_of(Key.begin(), Key.end(), [](char const c) {
+                    return (static_cast<unsigned char>(c) < 128) && (std::strchr("\\^$.|?*+()[]{}", c) == nullptr);
+                });
+                if (!plainName) ReqRepKeyPatterns[Loop - 1] = std::unique_ptr<RE2>(new RE2("(?i)" + Key));
+            }
+        }
     } // namespace
 
     // All routines should be listed here whether private or not
@@ -288,6 +340,11 @@ namespace OutputProcessor {
     Array1D<VariableTypeForDDOutput> DDVariableTypes; // Variable Types structure (use NumVariablesForOutput to traverse)
     Reference<RealVariables> RVariable;
     Reference<IntegerVariables> IVariable;
+    Array1D<std::vector<RealVariables *>> RVariablesByIndexType(2);    // RVariables in setup order for each index type (Zone, HVAC)
+    Array1D<std::vector<IntegerVariables *>> IVariablesByIndexType(2); // IVariables in setup order for each index type (Zone, HVAC)
+    Array1D<std::vector<RealVariables *>> ActiveRVariablesByIndexType(2);    // Reported, metered or externally used RVariables
+    Array1D<std::vector<IntegerVariables *>> ActiveIVariablesByIndexType(2); // Reported or externally used IVariables
+    bool ActiveVariableListsStale(true);                                     // Active lists must be rebuilt before the next update
     Array1D<ReqReportVariables> ReqRepVars;
     Array1D<MeterArrayType> VarMeterArrays;
     Array1D<MeterType> EnergyMeters;
@@ -354,6 +411,10 @@ namespace OutputProcessor {
         NumVarMeterArrays = 0;
         NumEnergyMeters = 0;
         MeterValue.deallocate();
+        MeteredRVariables.clear();
+        MeteredRVariableValues.clear();
+        MeterMatrixRowStart.clear();
+        MeterMatrixColumns.clear();
         TimeStepStampReportNbr = 0;
         TimeStepStampReportChr = "";
         TrackingHourlyVariables = false;
@@ -379,17 +440,36 @@ namespace OutputProcessor {
         LEndMin = -1.0;
         GetMeterIndexFirstCall = true;
         InitFlag = true;
+        ReqRepVarsByName.clear();
+        ReqRepKeyPatterns.clear();
         TimeValue.deallocate();
         RVariableTypes.deallocate();
         IVariableTypes.deallocate();
         DDVariableTypes.deallocate();
         RVariable.deallocate();
         IVariable.deallocate();
+        for (auto &rVars : RVariablesByIndexType) {
+            rVars.clear();
+        }
+        for (auto &iVars : IVariablesByIndexType) {
+            iVars.clear();
+        }
+        for (auto &rVars : ActiveRVariablesByIndexType) {
+            rVars.clear();
+        }
+        for (auto &iVars : ActiveIVariablesByIndexType) {
+            iVars.clear();
+        }
+        ActiveVariableListsStale = true;
         ReqRepVars.deallocate();
         VarMeterArrays.deallocate();
         EnergyMeters.deallocate();
         EndUseCategory.deallocate();
         UniqueMeterNames.clear();
+        StopAsyncOutput();
+        StopLiveOutput();
+        if (bin_stream.is_open()) bin_stream.close();
+        CloseCsvOutputFiles();
     }
 
     void InitializeOutput()
@@ -541,7 +621,7 @@ namespace OutputProcessor {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Linda K. Lawrie
         //       DATE WRITTEN   December 1998
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, look the requests up by variable name
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -564,48 +644,23 @@ namespace OutputProcessor {
         // frequency per variable is allowed.  ReportList will be populated with ReqRepVars indices
         // of those extra things from input that satisfy this condition.
 
-        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        int Item;
-        int Loop;
-        int Pos;
-        int MinLook;
-        int MaxLook;
-
         // Make sure that input has been read
         GetReportVariableInput();
 
         if (NumOfReqVariables > 0) {
-            // Do a quick check
-            Item = UtilityRoutines::FindItem(VarName, ReqRepVars, &ReqReportVariables::VarName);
-
             NumExtraVars = 0;
             ReportList = 0;
-            MinLook = 999999999;
-            MaxLook = -999999999;
-
-            if (Item != 0) {
-                Loop = Item;
-                Pos = Item;
-                MinLook = min(MinLook, Pos);
-                MaxLook = max(MaxLook, Pos);
-                while (Loop <= NumOfReqVariables && Pos != 0) {
-                    //  Mark all with blank keys as used
+
+            std::vector<int> const *Requests = RequestsForVariable(VarName);
+            if (Requests != nullptr) {
+                //  Mark all with blank keys as used
+                for (int const Loop : *Requests) {
                     if (ReqRepVars(Loop).Key.empty()) {
                         ReqRepVars(Loop).Used = true;
                     }
-                    if (Loop < NumOfReqVariables) {
-                        Pos = UtilityRoutines::FindItem(VarName, ReqRepVars({Loop + 1, NumOfReqVariables}), &ReqReportVariables::VarName);
-                        if (Pos != 0) {
-                            MinLook = min(MinLook, Loop + Pos);
-                            MaxLook = max(MaxLook, Loop + Pos);
-                        }
-                    } else {
-                        Pos = 1;
-                    }
-                    Loop += Pos;
                 }
-                BuildKeyVarList(KeyedValue, VarName, MinLook, MaxLook);
-                AddBlankKeys(VarName, MinLook, MaxLook);
+                BuildKeyVarList(KeyedValue, VarName, Requests->front(), Requests->back());
+                AddBlankKeys(VarName, Requests->front(), Requests->back());
             }
         }
     }
@@ -620,7 +675,7 @@ namespace OutputProcessor {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Linda K. Lawrie
         //       DATE WRITTEN   March 1999
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, only visit the requests for this variable and use the precompiled key patterns
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -632,15 +687,16 @@ namespace OutputProcessor {
         // that match (and dont duplicate ones already in the list).
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        int Loop;
         int Loop1;
         bool Dup;
 
-        for (Loop = MinIndx; Loop <= MaxIndx; ++Loop) {
+        std::vector<int> const *Requests = RequestsForVariable(VariableName);
+        if (Requests == nullptr) return;
+
+        for (int const Loop : *Requests) {
+            if (Loop < MinIndx || Loop > MaxIndx) continue;
             if (ReqRepVars(Loop).Key.empty()) continue;
-            if (!UtilityRoutines::SameString(ReqRepVars(Loop).VarName, VariableName)) continue;
-            if (!(UtilityRoutines::SameString(ReqRepVars(Loop).Key, KeyedValue) || RE2::FullMatch(KeyedValue, "(?i)" + ReqRepVars(Loop).Key)))
-                continue;
+            if (!KeyMatchesRequest(Loop, KeyedValue)) continue;
 
             //   A match.  Make sure doesn't duplicate
 
@@ -675,7 +731,7 @@ namespace OutputProcessor {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Linda K. Lawrie
         //       DATE WRITTEN   March 1999
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, only visit the requests for this variable
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -688,13 +744,15 @@ namespace OutputProcessor {
         // that match (and dont duplicate ones already in the list).
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        int Loop;
         int Loop1;
         bool Dup;
 
-        for (Loop = MinIndx; Loop <= MaxIndx; ++Loop) {
+        std::vector<int> const *Requests = RequestsForVariable(VariableName);
+        if (Requests == nullptr) return;
+
+        for (int const Loop : *Requests) {
+            if (Loop < MinIndx || Loop > MaxIndx) continue;
             if (!ReqRepVars(Loop).Key.empty()) continue;
-            if (!UtilityRoutines::SameString(ReqRepVars(Loop).VarName, VariableName)) continue;
 
             //   A match.  Make sure doesnt duplicate
 
@@ -947,8 +1005,24 @@ namespace OutputProcessor {
         if (ErrorsFound) {
             ShowFatalError("GetReportVariableInput:" + cCurrentModuleObject + ": errors in input.");
         }
+
+        IndexReqRepVars();
     }
 
+    namespace {
+        // Appends ',' or ':' and Value as written by the Fortran I2 (or I2.2 when ZeroFill) edit descriptor
+        inline void AppendI2(std::string &String, char const Separator, int const Value, bool const ZeroFill = false)
+        {
+            String += Separator;
+            if ((Value >= 0) && (Value <= 9)) {
+                String += ZeroFill ? '0' : ' ';
+                String += static_cast<char>('0' + Value);
+            } else {
+                String += std::to_string(Value); // wider values are not truncated
+            }
+        }
+    } // namespace
+
     void ProduceMinMaxString(std::string &String,                // Current value
                              int const DateValue,                // Date of min/max
                              ReportingFrequency const ReportFreq // Reporting Frequency
@@ -979,9 +1053,8 @@ namespace OutputProcessor {
         // SUBROUTINE ARGUMENT DEFINITIONS:
 
         // SUBROUTINE PARAMETER DEFINITIONS:
-        static ObjexxFCL::gio::Fmt DayFormat("(A,',',I2,',',I2)");
-        static ObjexxFCL::gio::Fmt MonthFormat("(A,',',I2,',',I2,',',I2)");
-        static ObjexxFCL::gio::Fmt EnvrnFormat("(A,',',I2,',',I2,',',I2,',',I2)");
+        // The fields are appended directly in the layout of the former gio formats:
+        // Daily (A,',',I2,',',I2), Monthly (A,',',I2,',',I2,',',I2), Yearly and Simulation (A,',',I2,',',I2,',',I2,',',I2)
 
         // INTERFACE BLOCK SPECIFICATIONS:
         // na
@@ -994,29 +1067,33 @@ namespace OutputProcessor {
         int Day;
         int Hour;
         int Minute;
-        std::string StrOut;
 
         DecodeMonDayHrMin(DateValue, Mon, Day, Hour, Minute);
 
         switch (ReportFreq) {
         case ReportingFrequency::Daily:
-            ObjexxFCL::gio::write(StrOut, DayFormat) << strip(String) << Hour << Minute;
+            strip(String);
+            AppendI2(String, ',', Hour);
+            AppendI2(String, ',', Minute);
             break;
         case ReportingFrequency::Monthly:
-            ObjexxFCL::gio::write(StrOut, MonthFormat) << strip(String) << Day << Hour << Minute;
+            strip(String);
+            AppendI2(String, ',', Day);
+            AppendI2(String, ',', Hour);
+            AppendI2(String, ',', Minute);
             break;
         case ReportingFrequency::Yearly:
-            ObjexxFCL::gio::write(StrOut, EnvrnFormat) << strip(String) << Mon << Day << Hour << Minute;
-            break;
         case ReportingFrequency::Simulation:
-            ObjexxFCL::gio::write(StrOut, EnvrnFormat) << strip(String) << Mon << Day << Hour << Minute;
+            strip(String);
+            AppendI2(String, ',', Mon);
+            AppendI2(String, ',', Day);
+            AppendI2(String, ',', Hour);
+            AppendI2(String, ',', Minute);
             break;
         default: // Each, TimeStep, Hourly dont have this
-            StrOut = BlankString;
+            String = BlankString;
             break;
         }
-
-        String = StrOut;
     }
 
     void ProduceMinMaxStringWStartMinute(std::string &String,                // Current value
@@ -1050,10 +1127,9 @@ namespace OutputProcessor {
         // SUBROUTINE ARGUMENT DEFINITIONS:
 
         // SUBROUTINE PARAMETER DEFINITIONS:
-        static ObjexxFCL::gio::Fmt HrFormat("(A,',',I2.2,':',I2.2)");
-        static ObjexxFCL::gio::Fmt DayFormat("(A,',',I2,',',I2.2,':',I2.2)");
-        static ObjexxFCL::gio::Fmt MonthFormat("(A,',',I2,',',I2,',',I2.2,':',I2.2)");
-        static ObjexxFCL::gio::Fmt EnvrnFormat("(A,',',I2,',',I2,',',I2,',',I2.2,':',I2.2)");
+        // The fields are appended directly in the layout of the former gio formats:
+        // Hourly (A,',',I2.2,':',I2.2), Daily (A,',',I2,',',I2.2,':',I2.2), Monthly (A,',',I2,',',I2,',',I2.2,':',I2.2),
+        // Yearly and Simulation (A,',',I2,',',I2,',',I2,',',I2.2,':',I2.2)
 
         // INTERFACE BLOCK SPECIFICATIONS:
         // na
@@ -1067,42 +1143,40 @@ namespace OutputProcessor {
         int Hour;
         int Minute;
         int StartMinute;
-        std::string StrOut;
 
         DecodeMonDayHrMin(DateValue, Mon, Day, Hour, Minute);
+        StartMinute = Minute - MinutesPerTimeStep + 1;
 
         switch (ReportFreq) {
         case ReportingFrequency::Hourly: // Hourly -- used in meters
-            StartMinute = Minute - MinutesPerTimeStep + 1;
-            ObjexxFCL::gio::write(StrOut, HrFormat) << strip(String) << StartMinute << Minute;
+            strip(String);
             break;
 
         case ReportingFrequency::Daily: // Daily
-            StartMinute = Minute - MinutesPerTimeStep + 1;
-            ObjexxFCL::gio::write(StrOut, DayFormat) << strip(String) << Hour << StartMinute << Minute;
+            strip(String);
+            AppendI2(String, ',', Hour);
             break;
 
         case ReportingFrequency::Monthly: // Monthly
-            StartMinute = Minute - MinutesPerTimeStep + 1;
-            ObjexxFCL::gio::write(StrOut, MonthFormat) << strip(String) << Day << Hour << StartMinute << Minute;
-            break;
-
-        case ReportingFrequency::Yearly: // Yearly
-            StartMinute = Minute - MinutesPerTimeStep + 1;
-            ObjexxFCL::gio::write(StrOut, EnvrnFormat) << strip(String) << Mon << Day << Hour << StartMinute << Minute;
+            strip(String);
+            AppendI2(String, ',', Day);
+            AppendI2(String, ',', Hour);
             break;
 
+        case ReportingFrequency::Yearly:     // Yearly
         case ReportingFrequency::Simulation: // Environment
-            StartMinute = Minute - MinutesPerTimeStep + 1;
-            ObjexxFCL::gio::write(StrOut, EnvrnFormat) << strip(String) << Mon << Day << Hour << StartMinute << Minute;
+            strip(String);
+            AppendI2(String, ',', Mon);
+            AppendI2(String, ',', Day);
+            AppendI2(String, ',', Hour);
             break;
 
         default: // Each, TimeStep, Hourly dont have this
-            StrOut = BlankString;
-            break;
+            String = BlankString;
+            return;
         }
-
-        String = StrOut;
+        AppendI2(String, ',', StartMinute, true);
+        AppendI2(String, ':', Minute, true);
     }
 
     int ValidateIndexType(std::string const &IndexTypeKey, // Index type (Zone, HVAC) for variables
@@ -2114,6 +2188,7 @@ namespace OutputProcessor {
 
         if (Found == 0) {
             EnergyMeters.redimension(++NumEnergyMeters);
+            ActiveVariableListsStale = true; // meter matrix needs a row for this meter
             EnergyMeters(NumEnergyMeters).Name = Name;
             EnergyMeters(NumEnergyMeters).ResourceType = ResourceType;
             EnergyMeters(NumEnergyMeters).EndUse = EndUse;
@@ -2319,6 +2394,7 @@ namespace OutputProcessor {
             VarMeterArrays(NumVarMeterArrays).OnMeters = 0;
             VarMeterArrays(NumVarMeterArrays).OnCustomMeters.allocate(1);
             VarMeterArrays(NumVarMeterArrays).NumOnCustomMeters = 1;
+            ActiveVariableListsStale = true; // variable is now metered
         } else { // MeterArrayPtr set
             VarMeterArrays(MeterArrayPtr).OnCustomMeters.redimension(++VarMeterArrays(MeterArrayPtr).NumOnCustomMeters);
         }
@@ -2721,6 +2797,92 @@ namespace OutputProcessor {
         }
     }
 
+    void BuildMeterMatrix()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Compiles the variable-to-meter mapping held in VarMeterArrays into a compressed
+        // sparse row matrix with one row per meter and one column per metered variable, so
+        // that UpdateAllMeterValues can update every meter with a single pass.
+
+        // METHODOLOGY EMPLOYED:
+        // Entries are collected in the order UpdateMeterValues used to visit them (variables
+        // in active list order, then each variable's meters followed by its custom meters) and
+        // then bucketed by meter with a stable counting sort.  Each meter therefore sums its
+        // variables in the original order and the results are bit-for-bit unchanged.
+
+        MeteredRVariables.clear();
+        for (int IndexType = 1; IndexType <= 2; ++IndexType) {
+            for (auto *rVarPtr : ActiveRVariablesByIndexType(IndexType)) {
+                if (rVarPtr->MeterArrayPtr != 0) MeteredRVariables.push_back(rVarPtr);
+            }
+        }
+        MeteredRVariableValues.assign(MeteredRVariables.size(), 0.0);
+
+        std::vector<std::pair<int, int>> entries; // (meter, column) in update order
+        for (std::size_t column = 0; column < MeteredRVariables.size(); ++column) {
+            auto const &meterArray(VarMeterArrays(MeteredRVariables[column]->MeterArrayPtr));
+            for (int Meter = 1; Meter <= meterArray.NumOnMeters; ++Meter) {
+                entries.emplace_back(meterArray.OnMeters(Meter), int(column));
+            }
+            for (int Meter = 1; Meter <= meterArray.NumOnCustomMeters; ++Meter) {
+                entries.emplace_back(meterArray.OnCustomMeters(Meter), int(column));
+            }
+        }
+
+        MeterMatrixRowStart.assign(NumEnergyMeters + 1, 0);
+        for (auto const &entry : entries) {
+            ++MeterMatrixRowStart[entry.first];
+        }
+        for (int Meter = 1; Meter <= NumEnergyMeters; ++Meter) {
+            MeterMatrixRowStart[Meter] += MeterMatrixRowStart[Meter - 1];
+        }
+        MeterMatrixColumns.resize(entries.size());
+        std::vector<int> rowFill(MeterMatrixRowStart.begin(), MeterMatrixRowStart.end() - 1);
+        for (auto const &entry : entries) {
+            MeterMatrixColumns[rowFill[entry.first - 1]++] = entry.second;
+        }
+    }
+
+    void UpdateAllMeterValues()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Adds the current zone time step value of every metered variable (with its zone
+        // and zone list multipliers applied) to the meters it is on.
+
+        // METHODOLOGY EMPLOYED:
+        // Gathers the metered values into a dense vector and multiplies it by the meter
+        // matrix built in BuildMeterMatrix (all coefficients are one).
+
+        for (std::size_t column = 0; column < MeteredRVariables.size(); ++column) {
+            auto const &rVar(*MeteredRVariables[column]);
+            MeteredRVariableValues[column] = rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult;
+        }
+
+        Real64 const *values(MeteredRVariableValues.data());
+        int const *columns(MeterMatrixColumns.data());
+        for (int Meter = 1; Meter <= NumEnergyMeters; ++Meter) {
+            Real64 meterValue(MeterValue(Meter));
+            for (int entry = MeterMatrixRowStart[Meter - 1], end = MeterMatrixRowStart[Meter]; entry < end; ++entry) {
+                meterValue += values[columns[entry]];
+            }
+            MeterValue(Meter) = meterValue;
+        }
+    }
+
     void UpdateMeters(int const TimeStamp) // Current TimeStamp (for max/min)
     {
 
@@ -3993,6 +4155,484 @@ namespace OutputProcessor {
         }
     }
 
+    namespace {
+        // Record tags of the binary time series output
+        std::uint8_t const BinaryRecordVariable(1);  // dictionary entry of a report variable
+        std::uint8_t const BinaryRecordMeter(2);     // dictionary entry of a meter
+        std::uint8_t const BinaryRecordTimeStamp(3); // time stamp
+        std::uint8_t const BinaryRecordValue(4);     // value of a timestep or hourly item
+        std::uint8_t const BinaryRecordMinMax(5);    // value of a daily or longer item, with its minimum and maximum
+        std::uint8_t const BinaryRecordEnd(255);     // end of the file
+
+        template <typename T> inline void WriteBinaryField(T const Value)
+        {
+            bin_stream.write(reinterpret_cast<char const *>(&Value), sizeof(T));
+        }
+
+        inline void WriteBinaryField(std::string const &Value)
+        {
+            WriteBinaryField(static_cast<std::uint32_t>(Value.size()));
+            bin_stream.write(Value.data(), Value.size());
+        }
+    } // namespace
+
+    void OpenBinaryOutputFile()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Opens the binary time series output file, written in addition to the eso and mtr files when the
+        // BinaryOutput environment variable is set.
+
+        // METHODOLOGY EMPLOYED:
+        // The file is a sequence of tagged records in native byte order. The header holds a magic string, the format
+        // version and a byte order marker, followed by the program version. Each report variable and meter is described
+        // once by a dictionary record; values are raw doubles keyed by their report ID, so no number formatting is done
+        // and readers can split the records into one column per report ID.
+
+        StopAsyncOutput();
+        if (bin_stream.is_open()) bin_stream.close();
+        bin_stream.open(DataStringGlobals::outputBinFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!bin_stream) {
+            ShowFatalError("OpenBinaryOutputFile: Could not open file " + DataStringGlobals::outputBinFileName + " for output (write).");
+        }
+        bin_stream.write("EPBINTS", 8); // magic string, including the terminating null
+        WriteBinaryField(static_cast<std::uint32_t>(1));          // format version
+        WriteBinaryField(static_cast<std::uint32_t>(0x01020304)); // byte order marker
+        WriteBinaryField(DataStringGlobals::VerString);
+    }
+
+    void CloseBinaryOutputFile()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Writes the end record and closes the binary time series output file.
+
+        if (!bin_stream.is_open()) return;
+        WriteBinaryField(BinaryRecordEnd);
+        bin_stream.close();
+    }
+
+    namespace {
+        // Time series csv file written next to the eso or mtr file, in the layout ReadVarsESO produces from it
+        struct CsvOutputFile
+        {
+            // Members
+            std::ofstream stream;
+            std::string fileName;
+            std::vector<std::string> headings; // Column headings in dictionary order
+            std::vector<int> columns;          // Column of each report ID, -1 if the report ID is not in this file
+            std::vector<std::string> row;      // Values of the row being collected
+            std::string rowDateTime;           // Date/Time of the row being collected
+            bool rowStarted;                   // True once a time stamp has been written
+            bool headerWritten;                // True once the heading line has been written
+            bool lateColumnWarned;             // True once a column added after the heading line has been reported
+
+            // Default Constructor
+            CsvOutputFile() : rowStarted(false), headerWritten(false), lateColumnWarned(false)
+            {
+            }
+        };
+
+        std::string const CsvMonthNames[] = {
+            "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December"};
+
+        CsvOutputFile EsoCsv; // Twin of the eso file (eplusout.csv)
+        CsvOutputFile MtrCsv; // Twin of the mtr file (eplusmtr.csv)
+
+        // The csv file twinned with an eso or mtr output stream, or nullptr
+        CsvOutputFile *CsvOutputFor(std::ostream const *out_stream_p)
+        {
+            if (out_stream_p == nullptr) return nullptr;
+            if (out_stream_p == DataGlobals::eso_stream && EsoCsv.stream.is_open()) return &EsoCsv;
+            if (out_stream_p == DataGlobals::mtr_stream && MtrCsv.stream.is_open()) return &MtrCsv;
+            return nullptr;
+        }
+
+        std::string CsvFrequencyName(ReportingFrequency const reportingInterval)
+        {
+            switch (reportingInterval) {
+            case ReportingFrequency::EachCall:
+                return "Each Call";
+            case ReportingFrequency::TimeStep:
+                return "TimeStep";
+            case ReportingFrequency::Daily:
+                return "Daily";
+            case ReportingFrequency::Monthly:
+                return "Monthly";
+            case ReportingFrequency::Yearly:
+                return "Annual";
+            case ReportingFrequency::Simulation:
+                return "RunPeriod";
+            default:
+                return "Hourly";
+            }
+        }
+
+        void WriteCsvRow(CsvOutputFile &csv)
+        {
+            if (!csv.headerWritten) {
+                csv.stream << "Date/Time";
+                for (auto const &heading : csv.headings) {
+                    csv.stream << ',' << heading;
+                }
+                csv.stream << DataStringGlobals::NL;
+                csv.headerWritten = true;
+                csv.row.resize(csv.headings.size());
+            }
+            if (!csv.rowStarted) return;
+            csv.stream << csv.rowDateTime;
+            for (auto &value : csv.row) {
+                csv.stream << ',' << value;
+                value.clear();
+            }
+            csv.stream << DataStringGlobals::NL;
+            csv.rowStarted = false;
+        }
+
+        void AddCsvColumn(std::ostream const *out_stream_p, int const reportID, std::string const &heading)
+        {
+            CsvOutputFile *csv(CsvOutputFor(out_stream_p));
+            if (csv == nullptr) return;
+            if (csv->headerWritten) { // Set up after the first row, so there is no column for it
+                if (!csv->lateColumnWarned) {
+                    ShowWarningError("Output variable \"" + heading + "\" was set up after the first row of " + csv->fileName +
+                                     " was written; it is only in the eso and mtr files.");
+                    csv->lateColumnWarned = true;
+                }
+                return;
+            }
+            if (reportID >= static_cast<int>(csv->columns.size())) csv->columns.resize(reportID + 1, -1);
+            csv->columns[reportID] = static_cast<int>(csv->headings.size());
+            csv->headings.push_back(heading);
+        }
+
+        void StartCsvRow(std::ostream const *out_stream_p, std::string const &dateTime)
+        {
+            CsvOutputFile *csv(CsvOutputFor(out_stream_p));
+            if (csv == nullptr) return;
+            if (csv->rowStarted && dateTime == csv->rowDateTime) return; // Same row, e.g. hourly values after the last time step of the hour
+            WriteCsvRow(*csv);
+            csv->rowDateTime = dateTime;
+            csv->rowStarted = true;
+        }
+
+        void SetCsvValue(std::ostream const *out_stream_p, int const reportID, std::string const &value)
+        {
+            CsvOutputFile *csv(CsvOutputFor(out_stream_p));
+            if (csv == nullptr || !csv->rowStarted) return;
+            if (reportID >= static_cast<int>(csv->columns.size()) || csv->columns[reportID] < 0) return;
+            csv->row[csv->columns[reportID]] = value;
+        }
+    } // namespace
+
+    void OpenCsvOutputFiles()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Opens the time series csv files, written while the simulation runs when the DirectCsvOutput environment
+        // variable is set, so ReadVarsESO does not have to read the eso and mtr files back after the run.
+
+        // METHODOLOGY EMPLOYED:
+        // Each csv file is the twin of the eso or mtr file: its columns are the dictionary items of that file, in
+        // the same order, headed "Key:Variable [Units](Frequency)", and a row is written for each distinct time stamp,
+        // with the values formatted as in the eso file. Values of different frequencies that share a time stamp,
+        // like the last time step of an hour and the hour, go in the same row. Only one row is held in memory.
+
+        CloseCsvOutputFiles();
+        CsvOutputFile *const csvs[] = {&EsoCsv, &MtrCsv};
+        std::string const *const fileNames[] = {&DataStringGlobals::outputCsvFileName, &DataStringGlobals::outputMtrCsvFileName};
+        for (int i = 0; i < 2; ++i) {
+            CsvOutputFile &csv(*csvs[i]);
+            csv.fileName = *fileNames[i];
+            csv.stream.open(csv.fileName, std::ios::out | std::ios::trunc);
+            if (!csv.stream) {
+                ShowFatalError("OpenCsvOutputFiles: Could not open file " + csv.fileName + " for output (write).");
+            }
+        }
+    }
+
+    void CloseCsvOutputFiles()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Writes the last row of the time series csv files and closes them.
+
+        for (CsvOutputFile *csv : {&EsoCsv, &MtrCsv}) {
+            if (csv->stream.is_open()) {
+                WriteCsvRow(*csv);
+                csv->stream.close();
+            }
+            *csv = CsvOutputFile();
+        }
+    }
+
+    namespace {
+        // Output streams whose buffers have been handed to a background writer, with the writers
+        struct AsyncOutputStream
+        {
+            // Members
+            std::ostream *stream;
+            std::unique_ptr<AsyncOutputBuffer> buffer;
+
+            // Default Constructor
+            AsyncOutputStream() : stream(nullptr)
+            {
+            }
+        };
+
+        std::vector<AsyncOutputStream> AsyncOutputStreams;
+    } // namespace
+
+    void StartAsyncOutput()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Moves the writing of the eso, mtr and binary output files to background threads when the AsyncOutput
+        // environment variable is set, so the time step loop does not wait on slow storage.
+
+        // METHODOLOGY EMPLOYED:
+        // The records are still formatted on the simulation thread. The stream buffer of each file is replaced by
+        // an AsyncOutputBuffer, which collects the formatted text into blocks and queues them for a writer thread
+        // that passes them to the original file buffer. The queue is bounded; when it is full the simulation waits
+        // for the writer. The SQLite output is not affected; its inserts are already batched into one transaction per day.
+
+        StopAsyncOutput();
+        std::ostream *const streams[] = {DataGlobals::eso_stream,
+                                         DataGlobals::mtr_stream,
+                                         bin_stream.is_open() ? &bin_stream : nullptr,
+                                         EsoCsv.stream.is_open() ? &EsoCsv.stream : nullptr,
+                                         MtrCsv.stream.is_open() ? &MtrCsv.stream : nullptr};
+        for (std::ostream *stream : streams) {
+            if (stream == nullptr) continue;
+            AsyncOutputStream async;
+            async.stream = stream;
+            stream->flush();
+            async.buffer.reset(new AsyncOutputBuffer(stream->rdbuf()));
+            stream->rdbuf(async.buffer.get());
+            AsyncOutputStreams.push_back(std::move(async));
+        }
+    }
+
+    void StopAsyncOutput()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Waits for the background writers to finish and gives the output files back their own stream buffers, so
+        // everything written before this call is in the files and later writes are direct.
+
+        for (auto &async : AsyncOutputStreams) {
+            async.stream->rdbuf(async.buffer->finish());
+        }
+        AsyncOutputStreams.clear();
+    }
+
+    namespace {
+        // Shared memory channel named by the LiveOutputChannel environment variable, with the variables it carries
+        std::unique_ptr<LiveOutputChannel> LiveOutput;
+        std::vector<RealVariables *> LiveOutputRVariables;
+        std::vector<IntegerVariables *> LiveOutputIVariables;
+        std::vector<Real64> LiveOutputValues;
+        bool LiveOutputStarted(false);
+    } // namespace
+
+    void PublishLiveOutput()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Publishes the zone time step values of the reported time step variables to the shared memory channel
+        // named by the LiveOutputChannel environment variable, so co-simulation partners and dashboards can follow
+        // the run without parsing the eso file.
+
+        // METHODOLOGY EMPLOYED:
+        // The channel is created on the first call, once all variables are set up; real variables come first, then
+        // integer variables, each in setup order. Each call writes one record into the ring buffer of the channel
+        // (see LiveOutputLayout.h). Readers copy records without any locking, so a slow reader loses old records
+        // instead of holding up the simulation. Values are taken before the time step loop of UpdateDataandReport
+        // and are zero where the variable's schedule is off, as in the eso file.
+
+        using DataEnvironment::DayOfMonth;
+        using DataEnvironment::Month;
+        using DataGlobals::DayOfSim;
+        using DataGlobals::HourOfDay;
+        using ScheduleManager::GetCurrentScheduleValue;
+
+        if (!LiveOutputStarted) {
+            LiveOutputStarted = true;
+            std::vector<LiveOutputChannel::Variable> variables;
+            for (int Loop = 1; Loop <= NumOfRVariable; ++Loop) {
+                auto &varType(RVariableTypes(Loop));
+                RealVariables &rVar(varType.VarPtr());
+                if (!rVar.Report || rVar.frequency != ReportingFrequency::TimeStep) continue;
+                LiveOutputRVariables.push_back(&rVar);
+                variables.push_back({rVar.ReportID,
+                                     varType.IndexType,
+                                     varType.VarName,
+                                     varType.units == OutputProcessor::Unit::customEMS ? varType.unitNameCustomEMS
+                                                                                       : unitEnumToString(varType.units)});
+            }
+            for (int Loop = 1; Loop <= NumOfIVariable; ++Loop) {
+                auto &varType(IVariableTypes(Loop));
+                IntegerVariables &iVar(varType.VarPtr());
+                if (!iVar.Report || iVar.frequency != ReportingFrequency::TimeStep) continue;
+                LiveOutputIVariables.push_back(&iVar);
+                variables.push_back({iVar.ReportID, varType.IndexType, varType.VarName, unitEnumToString(varType.units)});
+            }
+            LiveOutputValues.resize(variables.size());
+            LiveOutput.reset(new LiveOutputChannel(DataSystemVariables::LiveOutputChannel, variables));
+            if (!LiveOutput->isOpen()) {
+                ShowWarningError("Could not create the live output channel \"" + DataSystemVariables::LiveOutputChannel +
+                                 "\"; no live output will be published.");
+                LiveOutput.reset();
+            }
+        }
+        if (!LiveOutput) return;
+
+        std::size_t value(0);
+        for (auto const *rVar : LiveOutputRVariables) {
+            bool const ReportNow(rVar->SchedPtr <= 0 || GetCurrentScheduleValue(rVar->SchedPtr) != 0.0);
+            LiveOutputValues[value++] = ReportNow ? rVar->TSValue : 0.0;
+        }
+        for (auto const *iVar : LiveOutputIVariables) {
+            bool const ReportNow(iVar->SchedPtr <= 0 || GetCurrentScheduleValue(iVar->SchedPtr) != 0.0);
+            LiveOutputValues[value++] = ReportNow ? iVar->TSValue : 0.0;
+        }
+        LiveOutput->publish(DayOfSim, Month, DayOfMonth, HourOfDay, TimeValue(ZoneVar).CurMinute, LiveOutputValues.data());
+    }
+
+    void StopLiveOutput()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Marks the live output channel finished for its readers and removes it.
+
+        LiveOutput.reset();
+        LiveOutputRVariables.clear();
+        LiveOutputIVariables.clear();
+        LiveOutputValues.clear();
+        LiveOutputStarted = false;
+    }
+
+    void WriteBinaryDictionaryItem(int const reportID,                         // The reporting ID for the data
+                                   ReportingFrequency const reportingInterval, // The reporting interval (e.g., hourly, daily)
+                                   StoreType const storeType,                  // Averaged or summed
+                                   bool const meterFlag,                       // True for meters
+                                   std::string const &keyedValue,              // The key name for the data (blank for meters)
+                                   std::string const &variableName,            // The variable or meter name
+                                   std::string const &unitsString              // The units of the data
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Writes the dictionary record of a report variable or meter to the binary time series output file.
+
+        if (!bin_stream.is_open()) return;
+        WriteBinaryField(meterFlag ? BinaryRecordMeter : BinaryRecordVariable);
+        WriteBinaryField(static_cast<std::int32_t>(reportID));
+        WriteBinaryField(static_cast<std::int8_t>(reportingInterval));
+        WriteBinaryField(static_cast<std::int8_t>(storeType));
+        WriteBinaryField(keyedValue);
+        WriteBinaryField(variableName);
+        WriteBinaryField(unitsString);
+    }
+
+    void WriteBinaryData(int const reportID,  // The variable's report ID
+                         Real64 const repValue // The variable's value
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Writes one value to the binary time series output file.
+
+        if (!bin_stream.is_open()) return;
+        WriteBinaryField(BinaryRecordValue);
+        WriteBinaryField(static_cast<std::int32_t>(reportID));
+        WriteBinaryField(repValue);
+    }
+
+    void WriteBinaryData(int const reportID,                         // The variable's report ID
+                         ReportingFrequency const reportingInterval, // The variable's reporting interval (e.g., daily)
+                         Real64 const repValue,                      // The variable's value
+                         Real64 const minValue,                      // The variable's minimum value during the reporting interval
+                         int const minValueDate,                     // The date the minimum value occurred
+                         Real64 const maxValue,                      // The variable's maximum value during the reporting interval
+                         int const maxValueDate                      // The date the maximum value occurred
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Writes one value to the binary time series output file, with the minimum and maximum for daily and longer
+        // reporting intervals as in the eso file.
+
+        if (!bin_stream.is_open()) return;
+        if ((reportingInterval == ReportingFrequency::EachCall) || (reportingInterval == ReportingFrequency::TimeStep) ||
+            (reportingInterval == ReportingFrequency::Hourly)) {
+            WriteBinaryData(reportID, repValue);
+            return;
+        }
+        WriteBinaryField(BinaryRecordMinMax);
+        WriteBinaryField(static_cast<std::int32_t>(reportID));
+        WriteBinaryField(repValue);
+        WriteBinaryField(minValue);
+        WriteBinaryField(static_cast<std::int32_t>(minValueDate));
+        WriteBinaryField(maxValue);
+        WriteBinaryField(static_cast<std::int32_t>(maxValueDate));
+    }
+
     void WriteTimeStampFormatData(
         std::ostream *out_stream_p,                 // Output stream pointer
         ReportingFrequency const reportingInterval, // See Module Parameter Definitons for ReportEach, ReportTimeStep, ReportHourly, etc.
@@ -4051,6 +4691,45 @@ namespace OutputProcessor {
         assert(reportIDString.length() + DayOfSimChr.length() + (DayType.present() ? DayType().length() : 0u) + 26 <
                N); // Check will fit in stamp size
 
+        if (writeToSQL && bin_stream.is_open()) { // once per time stamp, like the SQLite time index
+            WriteBinaryField(BinaryRecordTimeStamp);
+            WriteBinaryField(static_cast<std::int32_t>(reportID));
+            WriteBinaryField(static_cast<std::int8_t>(reportingInterval));
+            WriteBinaryField(static_cast<std::int32_t>(DataEnvironment::CurEnvirNum));
+            WriteBinaryField(static_cast<std::int32_t>(DayOfSim));
+            WriteBinaryField(static_cast<std::int8_t>(Month.present() ? Month() : 0));
+            WriteBinaryField(static_cast<std::int8_t>(DayOfMonth.present() ? DayOfMonth() : 0));
+            WriteBinaryField(static_cast<std::int8_t>(Hour.present() ? Hour() : 0));
+            WriteBinaryField(static_cast<std::int8_t>(DST.present() ? DST() : 0));
+            WriteBinaryField(StartMinute.present() ? StartMinute() : 0.0);
+            WriteBinaryField(EndMinute.present() ? EndMinute() : 0.0);
+            WriteBinaryField(static_cast<std::int8_t>(DataGlobals::WarmupFlag));
+        }
+
+        if (CsvOutputFor(out_stream_p) != nullptr) {
+            switch (reportingInterval) {
+            case ReportingFrequency::EachCall:
+            case ReportingFrequency::TimeStep:
+            case ReportingFrequency::Hourly: {
+                int const EndSecond((Hour() - 1) * 3600 + nint((reportingInterval == ReportingFrequency::Hourly ? 60.0 : EndMinute()) * 60.0));
+                std::sprintf(stamp, " %02d/%02d  %02d:%02d:%02d", Month(), DayOfMonth(), EndSecond / 3600, (EndSecond % 3600) / 60, EndSecond % 60);
+                StartCsvRow(out_stream_p, stamp);
+            } break;
+            case ReportingFrequency::Daily:
+                std::sprintf(stamp, " %02d/%02d", Month(), DayOfMonth());
+                StartCsvRow(out_stream_p, stamp);
+                break;
+            case ReportingFrequency::Monthly:
+                StartCsvRow(out_stream_p, CsvMonthNames[Month() - 1]);
+                break;
+            case ReportingFrequency::Simulation:
+                StartCsvRow(out_stream_p, "simdays=" + DayOfSimChr);
+                break;
+            default:
+                break;
+            }
+        }
+
         if ((!out_stream_p) || (!*out_stream_p)) return; // Stream
 
         std::ostream &out_stream(*out_stream_p);
@@ -4204,6 +4883,8 @@ namespace OutputProcessor {
         static char stamp[N];
         assert(reportIDString.length() + yearOfSimChr.length() + 26 < N); // Check will fit in stamp size
 
+        StartCsvRow(out_stream_p, yearOfSimChr);
+
         if ((!out_stream_p) || (!*out_stream_p)) return; // Stream
         std::ostream &out_stream(*out_stream_p);
 
@@ -4231,7 +4912,7 @@ namespace OutputProcessor {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Greg Stark
         //       DATE WRITTEN   August 2008
-        //       MODIFIED       April 2011; Linda Lawrie
+        //       MODIFIED       April 2011; Linda Lawrie, October 2026 (EsoDictionary::formatItem)
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -4274,45 +4955,41 @@ namespace OutputProcessor {
         } else {
             UnitsString = unitEnumToString(unitsForVar);
         }
+        int numFields(0);
         switch (reportingInterval) {
         case ReportingFrequency::EachCall:
         case ReportingFrequency::TimeStep:
-            if (eso_stream) {
-                *eso_stream << reportIDChr << ",1," << keyedValue << ',' << variableName << " [" << UnitsString << ']' << FreqString << NL;
-            }
+            numFields = 1;
             break;
         case ReportingFrequency::Hourly:
             TrackingHourlyVariables = true;
-            if (eso_stream) {
-                *eso_stream << reportIDChr << ",1," << keyedValue << ',' << variableName << " [" << UnitsString << ']' << FreqString << NL;
-            }
+            numFields = 1;
             break;
         case ReportingFrequency::Daily:
             TrackingDailyVariables = true;
-            if (eso_stream) {
-                *eso_stream << reportIDChr << ",7," << keyedValue << ',' << variableName << " [" << UnitsString << ']' << FreqString << NL;
-            }
+            numFields = 7;
             break;
         case ReportingFrequency::Monthly:
             TrackingMonthlyVariables = true;
-            if (eso_stream) {
-                *eso_stream << reportIDChr << ",9," << keyedValue << ',' << variableName << " [" << UnitsString << ']' << FreqString << NL;
-            }
+            numFields = 9;
             break;
         case ReportingFrequency::Simulation:
             TrackingRunPeriodVariables = true;
-            if (eso_stream) {
-                *eso_stream << reportIDChr << ",11," << keyedValue << ',' << variableName << " [" << UnitsString << ']' << FreqString << NL;
-            }
+            numFields = 11;
             break;
         case ReportingFrequency::Yearly:
             TrackingYearlyVariables = true;
-            if (eso_stream) {
-                *eso_stream << reportIDChr << ",11," << keyedValue << ',' << variableName << " [" << UnitsString << ']' << FreqString << NL;
-            }
+            numFields = 11;
             break;
             // No default available?
         }
+        if (eso_stream && numFields > 0) {
+            *eso_stream << EsoDictionary::formatItem(reportIDChr, numFields, true, keyedValue, variableName, UnitsString, FreqString) << NL;
+        }
+
+        WriteBinaryDictionaryItem(reportID, reportingInterval, storeType, false, keyedValue, variableName, UnitsString);
+        AddCsvColumn(
+            eso_stream, reportID, keyedValue + ':' + variableName + " [" + UnitsString + "](" + CsvFrequencyName(reportingInterval) + ')');
 
         if (sqlite) {
             sqlite->createSQLiteReportDictionaryRecord(reportID,
@@ -4344,7 +5021,7 @@ namespace OutputProcessor {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Greg Stark
         //       DATE WRITTEN   August 2008
-        //       MODIFIED       April 2011; Linda Lawrie
+        //       MODIFIED       April 2011; Linda Lawrie, October 2026 (EsoDictionary::formatItem)
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -4377,127 +5054,53 @@ namespace OutputProcessor {
         // na
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        std::string::size_type lenString;
-
         std::string UnitsString = unitEnumToString(unit);
 
         std::string const FreqString(frequencyNotice(storeType, reportingInterval));
+        int numFields(0);
         switch (reportingInterval) {
         case ReportingFrequency::EachCall:
         case ReportingFrequency::TimeStep:
         case ReportingFrequency::Hourly: // -1, 0, 1
-            if (!cumulativeMeterFlag) {
-                if (mtr_stream) {
-                    *mtr_stream << reportIDChr << ",1," << meterName << " [" << UnitsString << ']' << FreqString << NL;
-                }
-            } else if (mtr_stream) {
-                *mtr_stream << reportIDChr << ",1,Cumulative " << meterName << " [" << UnitsString << ']' << FreqString << NL;
-            }
-
-            if (!meterFileOnlyFlag) {
-                if (!cumulativeMeterFlag) {
-                    if (eso_stream) {
-                        *eso_stream << reportIDChr << ",1," << meterName << " [" << UnitsString << ']' << FreqString << NL;
-                    }
-                } else if (eso_stream) {
-                    *eso_stream << reportIDChr << ",1,Cumulative " << meterName << " [" << UnitsString << ']' << FreqString << NL;
-                }
-            }
+            numFields = 1;
             break;
         case ReportingFrequency::Daily: //  2
-            if (!cumulativeMeterFlag) {
-                if (mtr_stream) {
-                    *mtr_stream << reportIDChr << ",7," << meterName << " [" << UnitsString << ']' << FreqString << NL;
-                }
-            } else if (mtr_stream) {
-                lenString = index(FreqString, '[');
-                *mtr_stream << reportIDChr << ",1,Cumulative " << meterName << " [" << UnitsString << ']' << FreqString.substr(0, lenString) << NL;
-            }
-            if (!meterFileOnlyFlag) {
-                if (!cumulativeMeterFlag) {
-                    if (eso_stream) {
-                        *eso_stream << reportIDChr << ",7," << meterName << " [" << UnitsString << ']' << FreqString << NL;
-                    }
-                } else if (eso_stream) {
-                    lenString = index(FreqString, '[');
-                    *eso_stream << reportIDChr << ",1,Cumulative " << meterName << " [" << UnitsString << ']' << FreqString.substr(0, lenString)
-                                << NL;
-                }
-            }
+            numFields = 7;
             break;
         case ReportingFrequency::Monthly: //  3
-            if (!cumulativeMeterFlag) {
-                if (mtr_stream) {
-                    *mtr_stream << reportIDChr << ",9," << meterName << " [" << UnitsString << ']' << FreqString << NL;
-                }
-            } else if (mtr_stream) {
-                lenString = index(FreqString, '[');
-                *mtr_stream << reportIDChr << ",1,Cumulative " << meterName << " [" << UnitsString << ']' << FreqString.substr(0, lenString) << NL;
-            }
-            if (!meterFileOnlyFlag) {
-                if (!cumulativeMeterFlag) {
-                    if (eso_stream) {
-                        *eso_stream << reportIDChr << ",9," << meterName << " [" << UnitsString << ']' << FreqString << NL;
-                    }
-                } else if (eso_stream) {
-                    lenString = index(FreqString, '[');
-                    *eso_stream << reportIDChr << ",1,Cumulative " << meterName << " [" << UnitsString << ']' << FreqString.substr(0, lenString)
-                                << NL;
-                }
-            }
+            numFields = 9;
             break;
         case ReportingFrequency::Yearly: //  5
-            if (!cumulativeMeterFlag) {
-                if (mtr_stream) {
-                    *mtr_stream << reportIDChr << ",11," << meterName << " [" << UnitsString << ']' << FreqString << NL;
-                }
-            } else if (mtr_stream) {
-                lenString = index(FreqString, '[');
-                *mtr_stream << reportIDChr << ",1,Cumulative " << meterName << " [" << UnitsString << ']' << FreqString.substr(0, lenString) << NL;
-            }
-            if (!meterFileOnlyFlag) {
-                if (!cumulativeMeterFlag) {
-                    if (eso_stream) {
-                        *eso_stream << reportIDChr << ",11," << meterName << " [" << UnitsString << ']' << FreqString << NL;
-                    }
-                } else {
-                    lenString = index(FreqString, '[');
-                    if (eso_stream) {
-                        *eso_stream << reportIDChr << ",1,Cumulative " << meterName << " [" << UnitsString << ']' << FreqString.substr(0, lenString)
-                                    << NL;
-                    }
-                }
-            }
-            break;
         case ReportingFrequency::Simulation: //  4
-            if (!cumulativeMeterFlag) {
-                if (mtr_stream) {
-                    *mtr_stream << reportIDChr << ",11," << meterName << " [" << UnitsString << ']' << FreqString << NL;
-                }
-            } else if (mtr_stream) {
-                lenString = index(FreqString, '[');
-                *mtr_stream << reportIDChr << ",1,Cumulative " << meterName << " [" << UnitsString << ']' << FreqString.substr(0, lenString) << NL;
-            }
-            if (!meterFileOnlyFlag) {
-                if (!cumulativeMeterFlag) {
-                    if (eso_stream) {
-                        *eso_stream << reportIDChr << ",11," << meterName << " [" << UnitsString << ']' << FreqString << NL;
-                    }
-                } else {
-                    lenString = index(FreqString, '[');
-                    if (eso_stream) {
-                        *eso_stream << reportIDChr << ",1,Cumulative " << meterName << " [" << UnitsString << ']' << FreqString.substr(0, lenString)
-                                    << NL;
-                    }
-                }
-            }
+            numFields = 11;
             break;
         }
+        if (numFields > 0) {
+            // Cumulative meters only carry the value, so the field list is dropped from the notice
+            std::string dictionaryLine;
+            if (cumulativeMeterFlag) {
+                dictionaryLine = EsoDictionary::formatItem(
+                    reportIDChr, 1, false, std::string(), "Cumulative " + meterName, UnitsString, FreqString.substr(0, FreqString.find('[')));
+            } else {
+                dictionaryLine = EsoDictionary::formatItem(reportIDChr, numFields, false, std::string(), meterName, UnitsString, FreqString);
+            }
+            if (mtr_stream) {
+                *mtr_stream << dictionaryLine << NL;
+            }
+            if (!meterFileOnlyFlag && eso_stream) {
+                *eso_stream << dictionaryLine << NL;
+            }
+        }
 
         static std::string const keyedValueStringCum("Cumulative ");
         static std::string const keyedValueStringNon;
         std::string const &keyedValueString(cumulativeMeterFlag ? keyedValueStringCum : keyedValueStringNon);
 
+        WriteBinaryDictionaryItem(reportID, reportingInterval, storeType, true, keyedValueString, meterName, UnitsString);
+        std::string const csvHeading(keyedValueString + meterName + " [" + UnitsString + "](" + CsvFrequencyName(reportingInterval) + ')');
+        AddCsvColumn(mtr_stream, reportID, csvHeading);
+        if (!meterFileOnlyFlag) AddCsvColumn(eso_stream, reportID, csvHeading);
+
         if (sqlite) {
             sqlite->createSQLiteReportDictionaryRecord(reportID,
                                                        static_cast<int>(storeType),
@@ -4511,6 +5114,50 @@ namespace OutputProcessor {
         }
     }
 
+    void BuildActiveVariableLists()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Collects, for each index type, the variables whose time step values are actually
+        // used: those reported to the output files, those on a meter and those read by the
+        // external interface.  Everything else (for example variables that are only used as
+        // EMS sensors or by tabular reports, both of which read the current value directly)
+        // does not need to be accumulated by UpdateDataandReport.
+
+        // METHODOLOGY EMPLOYED:
+        // The lists keep setup order so that output order is unchanged.  They are rebuilt
+        // (together with the meter matrix) whenever a variable is set up, a meter is added,
+        // a variable is attached to a custom meter or requested by the external interface.
+
+        for (int IndexType = 1; IndexType <= 2; ++IndexType) {
+            auto &activeRVars(ActiveRVariablesByIndexType(IndexType));
+            activeRVars.clear();
+            for (auto *rVarPtr : RVariablesByIndexType(IndexType)) {
+                if (rVarPtr->Report || rVarPtr->MeterArrayPtr != 0 || rVarPtr->UsedByExternalInterface) {
+                    activeRVars.push_back(rVarPtr);
+                }
+            }
+
+            auto &activeIVars(ActiveIVariablesByIndexType(IndexType));
+            activeIVars.clear();
+            for (auto *iVarPtr : IVariablesByIndexType(IndexType)) {
+                if (iVarPtr->Report || iVarPtr->UsedByExternalInterface) {
+                    activeIVars.push_back(iVarPtr);
+                }
+            }
+        }
+
+        BuildMeterMatrix();
+
+        ActiveVariableListsStale = false;
+    }
+
     void WriteRealVariableOutput(RealVariables &realVar,             // Real variable to write out
                                  ReportingFrequency const reportType // The report type or interval (e.g., hourly)
     )
@@ -4630,11 +5277,15 @@ namespace OutputProcessor {
             }
         }
 
+        WriteBinaryData(reportID, reportingInterval, repVal, minValue, minValueDate, MaxValue, maxValueDate);
+
         if (sqlite) {
             sqlite->createSQLiteReportDataRecord(
                 reportID, repVal, static_cast<int>(reportingInterval), minValue, minValueDate, MaxValue, maxValueDate);
         }
 
+        SetCsvValue(DataGlobals::eso_stream, reportID, NumberOut);
+
         if ((reportingInterval == ReportingFrequency::EachCall) || (reportingInterval == ReportingFrequency::TimeStep) ||
             (reportingInterval == ReportingFrequency::Hourly)) { // -1, 0, 1
             if (DataGlobals::eso_stream) *DataGlobals::eso_stream << creportID << ',' << NumberOut << DataStringGlobals::NL;
@@ -4695,10 +5346,15 @@ namespace OutputProcessor {
             NumberOut = std::string(s);
         }
 
+        WriteBinaryData(reportID, repValue);
+
         if (sqlite) {
             sqlite->createSQLiteReportDataRecord(reportID, repValue);
         }
 
+        SetCsvValue(DataGlobals::mtr_stream, reportID, NumberOut);
+        if (!meterOnlyFlag) SetCsvValue(DataGlobals::eso_stream, reportID, NumberOut);
+
         if (DataGlobals::mtr_stream) *DataGlobals::mtr_stream << creportID << ',' << NumberOut << DataStringGlobals::NL;
         ++DataGlobals::StdMeterRecordCount;
 
@@ -4752,11 +5408,16 @@ namespace OutputProcessor {
             NumberOut = std::string(s);
         }
 
+        WriteBinaryData(reportID, reportingInterval, repValue, minValue, minValueDate, MaxValue, maxValueDate);
+
         if (sqlite) {
             sqlite->createSQLiteReportDataRecord(
                 reportID, repValue, static_cast<int>(reportingInterval), minValue, minValueDate, MaxValue, maxValueDate, MinutesPerTimeStep);
         }
 
+        SetCsvValue(mtr_stream, reportID, NumberOut);
+        if (!meterOnlyFlag) SetCsvValue(eso_stream, reportID, NumberOut);
+
         if ((reportingInterval == ReportingFrequency::EachCall) || (reportingInterval == ReportingFrequency::TimeStep) ||
             (reportingInterval == ReportingFrequency::Hourly)) { // -1, 0, 1
             if (mtr_stream) {
@@ -4865,10 +5526,14 @@ namespace OutputProcessor {
 
         dtoa(repValue, s);
 
+        WriteBinaryData(reportID, repValue);
+
         if (sqlite) {
             sqlite->createSQLiteReportDataRecord(reportID, repValue);
         }
 
+        SetCsvValue(DataGlobals::eso_stream, reportID, s);
+
         if (DataGlobals::eso_stream) *DataGlobals::eso_stream << creportID << ',' << s << DataStringGlobals::NL;
     }
 
@@ -4896,10 +5561,14 @@ namespace OutputProcessor {
 
         i32toa(repValue, s);
 
+        WriteBinaryData(reportID, repValue);
+
         if (sqlite) {
             sqlite->createSQLiteReportDataRecord(reportID, repValue);
         }
 
+        SetCsvValue(DataGlobals::eso_stream, reportID, s);
+
         if (DataGlobals::eso_stream) *DataGlobals::eso_stream << creportID << ',' << s << DataStringGlobals::NL;
     }
 
@@ -4927,10 +5596,14 @@ namespace OutputProcessor {
 
         i64toa(repValue, s);
 
+        WriteBinaryData(reportID, repValue);
+
         if (sqlite) {
             sqlite->createSQLiteReportDataRecord(reportID, repValue);
         }
 
+        SetCsvValue(DataGlobals::eso_stream, reportID, s);
+
         if (DataGlobals::eso_stream) *DataGlobals::eso_stream << creportID << ',' << s << DataStringGlobals::NL;
     }
 
@@ -5093,11 +5766,15 @@ namespace OutputProcessor {
 
         rminValue = minValue;
         rmaxValue = MaxValue;
+        WriteBinaryData(reportID, reportingInterval, repVal, rminValue, minValueDate, rmaxValue, maxValueDate);
+
         if (sqlite) {
             sqlite->createSQLiteReportDataRecord(
                 reportID, repVal, static_cast<int>(reportingInterval), rminValue, minValueDate, rmaxValue, maxValueDate);
         }
 
+        SetCsvValue(eso_stream, reportID, NumberOut);
+
         if ((reportingInterval == ReportingFrequency::EachCall) || (reportingInterval == ReportingFrequency::TimeStep) ||
             (reportingInterval == ReportingFrequency::Hourly)) { // -1, 0, 1
             if (eso_stream) *eso_stream << reportIDString << ',' << NumberOut << NL;
@@ -5729,6 +6406,8 @@ void SetupOutputVariable(std::string const &VariableName,           // String Na
         RVariable().minValueDate = 0;
 
         RVariableTypes(CV).VarPtr >>= RVariable;
+        RVariablesByIndexType(IndexType).push_back(&RVariable());
+        ActiveVariableListsStale = true;
         RVariable().Which >>= ActualVariable;
         RVariable().ReportID = CurrentReportNumber;
         RVariableTypes(CV).ReportID = CurrentReportNumber;
@@ -5919,6 +6598,8 @@ void SetupOutputVariable(std::string const &VariableName,           // String Na
         IVariable().minValueDate = 0;
 
         IVariableTypes(CV).VarPtr >>= IVariable;
+        IVariablesByIndexType(IndexType).push_back(&IVariable());
+        ActiveVariableListsStale = true;
         IVariable().Which >>= ActualVariable;
         IVariable().ReportID = CurrentReportNumber;
         IVariableTypes(CV).ReportID = CurrentReportNumber;
@@ -6097,7 +6778,6 @@ void UpdateDataandReport(int const IndexTypeKey) // What kind of data to update
     // na
 
     // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-    int Loop;             // Loop Variable
     int IndexType;        // Translate Zone=>1, HVAC=>2
     Real64 CurVal;        // Current value for real variables
     Real64 ICurVal;       // Current value for integer variables
@@ -6115,7 +6795,12 @@ void UpdateDataandReport(int const IndexTypeKey) // What kind of data to update
     static bool EndTimeStepFlag(false); // True when it's the end of the Zone Time Step
     Real64 rxTime;                      // (MinuteNow-StartMinute)/REAL(MinutesPerTimeStep,r64) - for execution time
 
+    SimulationTelemetry::ScopedTimer telemetryTimer(SimulationTelemetry::Subsystem::Output);
+    EP_TIMER_SCOPE("UpdateDataandReport");
+
     IndexType = IndexTypeKey;
+
+    if (ActiveVariableListsStale) BuildActiveVariableLists();
     if (IndexType != ZoneTSReporting && IndexType != HVACTSReporting) {
         ShowFatalError("Invalid reporting requested -- UpdateDataAndReport");
     }
@@ -6168,11 +6853,9 @@ void UpdateDataandReport(int const IndexTypeKey) // What kind of data to update
         }
 
         // Main "Record Keeping" Loops for R and I variables
-        for (Loop = 1; Loop <= NumOfRVariable; ++Loop) {
-            if (RVariableTypes(Loop).IndexType != IndexType) continue;
-
+        for (auto *rVarPtr : ActiveRVariablesByIndexType(IndexType)) {
             // Act on the RVariables variable
-            auto &rVar(RVariableTypes(Loop).VarPtr());
+            auto &rVar(*rVarPtr);
             rVar.Stored = true;
             if (rVar.storeType == StoreType::Averaged) {
                 CurVal = rVar.Which * rxTime;
@@ -6254,11 +6937,9 @@ void UpdateDataandReport(int const IndexTypeKey) // What kind of data to update
             }
         }
 
-        for (Loop = 1; Loop <= NumOfIVariable; ++Loop) {
-            if (IVariableTypes(Loop).IndexType != IndexType) continue;
-
+        for (auto *iVarPtr : ActiveIVariablesByIndexType(IndexType)) {
             // Act on the IVariables variable
-            auto &iVar(IVariableTypes(Loop).VarPtr());
+            auto &iVar(*iVarPtr);
             iVar.Stored = true;
             //      ICurVal=IVar%Which
             if (iVar.storeType == StoreType::Averaged) {
@@ -6358,24 +7039,14 @@ void UpdateDataandReport(int const IndexTypeKey) // What kind of data to update
             ResultsFramework::OutputSchema->RITimestepTSData.newRow(Month, DayOfMonth, HourOfDay, TimeValue(1).CurMinute);
         }
 
+        // Update meters on the TimeStep  (Zone)
+        UpdateAllMeterValues();
+
+        if (!DataSystemVariables::LiveOutputChannel.empty()) PublishLiveOutput();
+
         for (IndexType = 1; IndexType <= 2; ++IndexType) {
-            for (Loop = 1; Loop <= NumOfRVariable; ++Loop) {
-                if (RVariableTypes(Loop).IndexType != IndexType) continue;
-                auto &rVar(RVariableTypes(Loop).VarPtr());
-                // Update meters on the TimeStep  (Zone)
-                if (rVar.MeterArrayPtr != 0) {
-                    if (VarMeterArrays(rVar.MeterArrayPtr).NumOnCustomMeters <= 0) {
-                        UpdateMeterValues(rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult,
-                                          VarMeterArrays(rVar.MeterArrayPtr).NumOnMeters,
-                                          VarMeterArrays(rVar.MeterArrayPtr).OnMeters);
-                    } else {
-                        UpdateMeterValues(rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult,
-                                          VarMeterArrays(rVar.MeterArrayPtr).NumOnMeters,
-                                          VarMeterArrays(rVar.MeterArrayPtr).OnMeters,
-                                          VarMeterArrays(rVar.MeterArrayPtr).NumOnCustomMeters,
-                                          VarMeterArrays(rVar.MeterArrayPtr).OnCustomMeters);
-                    }
-                }
+            for (auto *rVarPtr : ActiveRVariablesByIndexType(IndexType)) {
+                auto &rVar(*rVarPtr);
                 ReportNow = true;
                 if (rVar.SchedPtr > 0) ReportNow = (GetCurrentScheduleValue(rVar.SchedPtr) != 0.0); // SetReportNow(RVar%SchedPtr)
                 if (!ReportNow || !rVar.Report) {
@@ -6429,9 +7100,8 @@ void UpdateDataandReport(int const IndexTypeKey) // What kind of data to update
                 rVar.thisTSStored = false;
             } // Number of R Variables
 
-            for (Loop = 1; Loop <= NumOfIVariable; ++Loop) {
-                if (IVariableTypes(Loop).IndexType != IndexType) continue;
-                auto &iVar(IVariableTypes(Loop).VarPtr());
+            for (auto *iVarPtr : ActiveIVariablesByIndexType(IndexType)) {
+                auto &iVar(*iVarPtr);
                 ReportNow = true;
                 if (iVar.SchedPtr > 0) ReportNow = (GetCurrentScheduleValue(iVar.SchedPtr) != 0.0); // SetReportNow(IVar%SchedPtr)
                 if (!ReportNow) {
@@ -6528,9 +7198,8 @@ void UpdateDataandReport(int const IndexTypeKey) // What kind of data to update
 
         for (IndexType = 1; IndexType <= 2; ++IndexType) { // Zone, HVAC
             TimeValue(IndexType).CurMinute = 0.0;
-            for (Loop = 1; Loop <= NumOfRVariable; ++Loop) {
-                if (RVariableTypes(Loop).IndexType != IndexType) continue;
-                auto &rVar(RVariableTypes(Loop).VarPtr());
+            for (auto *rVarPtr : ActiveRVariablesByIndexType(IndexType)) {
+                auto &rVar(*rVarPtr);
                 //        ReportNow=.TRUE.
                 //        IF (RVar%SchedPtr > 0) &
                 //          ReportNow=(GetCurrentScheduleValue(RVar%SchedPtr) /= 0.0)  !SetReportNow(RVar%SchedPtr)
@@ -6558,9 +7227,8 @@ void UpdateDataandReport(int const IndexTypeKey) // What kind of data to update
                 rVar.Value = 0.0;
             } // Number of R Variables
 
-            for (Loop = 1; Loop <= NumOfIVariable; ++Loop) {
-                if (IVariableTypes(Loop).IndexType != IndexType) continue;
-                auto &iVar(IVariableTypes(Loop).VarPtr());
+            for (auto *iVarPtr : ActiveIVariablesByIndexType(IndexType)) {
+                auto &iVar(*iVarPtr);
                 //        ReportNow=.TRUE.
                 //        IF (IVar%SchedPtr > 0) &
                 //          ReportNow=(GetCurrentScheduleValue(IVar%SchedPtr) /= 0.0)  !SetReportNow(IVar%SchedPtr)
@@ -6628,16 +7296,12 @@ void UpdateDataandReport(int const IndexTypeKey) // What kind of data to update
 
         NumHoursInMonth += 24;
         for (IndexType = 1; IndexType <= 2; ++IndexType) {
-            for (Loop = 1; Loop <= NumOfRVariable; ++Loop) {
-                if (RVariableTypes(Loop).IndexType == IndexType) {
-                    WriteRealVariableOutput(RVariableTypes(Loop).VarPtr, ReportingFrequency::Daily);
-                }
+            for (auto *rVarPtr : ActiveRVariablesByIndexType(IndexType)) {
+                WriteRealVariableOutput(*rVarPtr, ReportingFrequency::Daily);
             } // Number of R Variables
 
-            for (Loop = 1; Loop <= NumOfIVariable; ++Loop) {
-                if (IVariableTypes(Loop).IndexType == IndexType) {
-                    WriteIntegerVariableOutput(IVariableTypes(Loop).VarPtr, ReportingFrequency::Daily);
-                }
+            for (auto *iVarPtr : ActiveIVariablesByIndexType(IndexType)) {
+                WriteIntegerVariableOutput(*iVarPtr, ReportingFrequency::Daily);
             } // Number of I Variables
         }     // Index type (Zone or HVAC)
 
@@ -6669,16 +7333,12 @@ void UpdateDataandReport(int const IndexTypeKey) // What kind of data to update
         NumHoursInSim += NumHoursInMonth;
         EndMonthFlag = false;
         for (IndexType = 1; IndexType <= 2; ++IndexType) { // Zone, HVAC
-            for (Loop = 1; Loop <= NumOfRVariable; ++Loop) {
-                if (RVariableTypes(Loop).IndexType == IndexType) {
-                    WriteRealVariableOutput(RVariableTypes(Loop).VarPtr, ReportingFrequency::Monthly);
-                }
+            for (auto *rVarPtr : ActiveRVariablesByIndexType(IndexType)) {
+                WriteRealVariableOutput(*rVarPtr, ReportingFrequency::Monthly);
             } // Number of R Variables
 
-            for (Loop = 1; Loop <= NumOfIVariable; ++Loop) {
-                if (IVariableTypes(Loop).IndexType == IndexType) {
-                    WriteIntegerVariableOutput(IVariableTypes(Loop).VarPtr, ReportingFrequency::Monthly);
-                }
+            for (auto *iVarPtr : ActiveIVariablesByIndexType(IndexType)) {
+                WriteIntegerVariableOutput(*iVarPtr, ReportingFrequency::Monthly);
             } // Number of I Variables
         }     // IndexType (Zone, HVAC)
 
@@ -6705,16 +7365,12 @@ void UpdateDataandReport(int const IndexTypeKey) // What kind of data to update
             ResultsFramework::OutputSchema->RIRunPeriodTSData.newRow(Month, DayOfMonth, HourOfDay, 0);
         }
         for (IndexType = 1; IndexType <= 2; ++IndexType) { // Zone, HVAC
-            for (Loop = 1; Loop <= NumOfRVariable; ++Loop) {
-                if (RVariableTypes(Loop).IndexType == IndexType) {
-                    WriteRealVariableOutput(RVariableTypes(Loop).VarPtr, ReportingFrequency::Simulation);
-                }
+            for (auto *rVarPtr : ActiveRVariablesByIndexType(IndexType)) {
+                WriteRealVariableOutput(*rVarPtr, ReportingFrequency::Simulation);
             } // Number of R Variables
 
-            for (Loop = 1; Loop <= NumOfIVariable; ++Loop) {
-                if (IVariableTypes(Loop).IndexType == IndexType) {
-                    WriteIntegerVariableOutput(IVariableTypes(Loop).VarPtr, ReportingFrequency::Simulation);
-                }
+            for (auto *iVarPtr : ActiveIVariablesByIndexType(IndexType)) {
+                WriteIntegerVariableOutput(*iVarPtr, ReportingFrequency::Simulation);
             } // Number of I Variables
         }     // Index Type (Zone, HVAC)
 
@@ -6730,16 +7386,12 @@ void UpdateDataandReport(int const IndexTypeKey) // What kind of data to update
             TimePrint = false;
         }
         for (IndexType = 1; IndexType <= 2; ++IndexType) { // Zone, HVAC
-            for (Loop = 1; Loop <= NumOfRVariable; ++Loop) {
-                if (RVariableTypes(Loop).IndexType == IndexType) {
-                    WriteRealVariableOutput(RVariableTypes(Loop).VarPtr, ReportingFrequency::Yearly);
-                }
+            for (auto *rVarPtr : ActiveRVariablesByIndexType(IndexType)) {
+                WriteRealVariableOutput(*rVarPtr, ReportingFrequency::Yearly);
             } // Number of R Variables
 
-            for (Loop = 1; Loop <= NumOfIVariable; ++Loop) {
-                if (IVariableTypes(Loop).IndexType == IndexType) {
-                    WriteIntegerVariableOutput(IVariableTypes(Loop).VarPtr, ReportingFrequency::Yearly);
-                }
+            for (auto *iVarPtr : ActiveIVariablesByIndexType(IndexType)) {
+                WriteIntegerVariableOutput(*iVarPtr, ReportingFrequency::Yearly);
             } // Number of I Variables
         }     // Index Type (Zone, HVAC)
 
@@ -8006,6 +8658,35 @@ Real64 GetInternalVariableValueExternalInterface(int const varType,    // 1=inte
     return resultVal;
 }
 
+void SetInternalVariableUsedByExternalInterface(int const varType,    // 1=integer, 2=REAL(r64), 3=meter
+                                                int const keyVarIndex // Array index
+)
+{
+    // SUBROUTINE INFORMATION:
+    //       AUTHOR         na
+    //       DATE WRITTEN   October 2026
+    //       MODIFIED       na
+    //       RE-ENGINEERED  na
+
+    // PURPOSE OF THIS SUBROUTINE:
+    // Marks the Internal Variable assigned to the varType and keyVarIndex as read by the
+    // external interface, so that UpdateDataandReport keeps its EITSValue current even when
+    // the variable is neither reported nor metered.
+
+    // Using/Aliasing
+    using namespace OutputProcessor;
+
+    if (varType == 1) { // Integer
+        if (keyVarIndex < 1 || keyVarIndex > NumOfIVariable) return;
+        IVariableTypes(keyVarIndex).VarPtr().UsedByExternalInterface = true;
+        ActiveVariableListsStale = true;
+    } else if (varType == 2) { // REAL(r64)
+        if (keyVarIndex < 1 || keyVarIndex > NumOfRVariable) return;
+        RVariableTypes(keyVarIndex).VarPtr().UsedByExternalInterface = true;
+        ActiveVariableListsStale = true;
+    }
+}
+
 int GetNumMeteredVariables(std::string const &EP_UNUSED(ComponentType), // Given Component Type
                            std::string const &ComponentName             // Given Component Name (user defined)
 )
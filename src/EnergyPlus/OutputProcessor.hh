@@ -50,6 +50,7 @@
 
 // C++ Headers
 #include <iosfwd>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -178,6 +179,8 @@ namespace OutputProcessor {
     extern int MaxNumSubcategories;
     extern bool isFinalYear;
 
+    extern std::ofstream bin_stream; // Binary time series output stream (eplusout.bin)
+
     extern bool GetOutputInputFlag; // First time, input is "gotten"
 
     // All routines should be listed here whether private or not
@@ -295,12 +298,14 @@ namespace OutputProcessor {
         int MeterArrayPtr;            // If metered, this points to an array of applicable meters
         int ZoneMult;                 // If metered, Zone Multiplier is applied
         int ZoneListMult;             // If metered, Zone List Multiplier is applied
+        bool UsedByExternalInterface; // The external interface reads this variable (needs EITSValue)
 
         // Default Constructor
         RealVariables()
             : Value(0.0), TSValue(0.0), EITSValue(0.0), StoreValue(0.0), NumStored(0.0), storeType(StoreType::Averaged), Stored(false), Report(false),
               tsStored(false), thisTSStored(false), thisTSCount(0), frequency(ReportingFrequency::Hourly), MaxValue(-9999.0), maxValueDate(0),
-              MinValue(9999.0), minValueDate(0), ReportID(0), SchedPtr(0), MeterArrayPtr(0), ZoneMult(1), ZoneListMult(1)
+              MinValue(9999.0), minValueDate(0), ReportID(0), SchedPtr(0), MeterArrayPtr(0), ZoneMult(1), ZoneListMult(1),
+              UsedByExternalInterface(false)
         {
         }
     };
@@ -328,12 +333,13 @@ namespace OutputProcessor {
         int ReportID;                 // Report variable ID number
         std::string ReportIDChr;      // Report variable ID number (character -- for printing)
         int SchedPtr;                 // If scheduled, this points to the schedule
+        bool UsedByExternalInterface; // The external interface reads this variable (needs EITSValue)
 
         // Default Constructor
         IntegerVariables()
             : Value(0.0), TSValue(0.0), EITSValue(0.0), StoreValue(0.0), NumStored(0.0), storeType(StoreType::Averaged), Stored(false), Report(false),
               tsStored(false), thisTSStored(false), thisTSCount(0), frequency(ReportingFrequency::Hourly), MaxValue(-9999), maxValueDate(0),
-              MinValue(9999), minValueDate(0), ReportID(0), SchedPtr(0)
+              MinValue(9999), minValueDate(0), ReportID(0), SchedPtr(0), UsedByExternalInterface(false)
         {
         }
     };
@@ -567,6 +573,15 @@ namespace OutputProcessor {
     extern Array1D<VariableTypeForDDOutput> DDVariableTypes; // Variable Types structure (use NumVariablesForOutput to traverse)
     extern Reference<RealVariables> RVariable;
     extern Reference<IntegerVariables> IVariable;
+    extern Array1D<std::vector<RealVariables *>> RVariablesByIndexType;    // RVariables in setup order for each index type (Zone, HVAC)
+    extern Array1D<std::vector<IntegerVariables *>> IVariablesByIndexType; // IVariables in setup order for each index type (Zone, HVAC)
+    extern Array1D<std::vector<RealVariables *>> ActiveRVariablesByIndexType;    // Reported, metered or externally used RVariables
+    extern Array1D<std::vector<IntegerVariables *>> ActiveIVariablesByIndexType; // Reported or externally used IVariables
+    extern bool ActiveVariableListsStale;                                        // Active lists must be rebuilt before the next update
+    extern std::vector<RealVariables *> MeteredRVariables; // Active metered RVariables (the columns of the meter matrix)
+    extern std::vector<Real64> MeteredRVariableValues;     // Multiplied time step value of each metered RVariable
+    extern std::vector<int> MeterMatrixRowStart;           // Start of each meter's row in MeterMatrixColumns (CSR, 0-based)
+    extern std::vector<int> MeterMatrixColumns;            // MeteredRVariables index of each variable-on-meter entry
     extern Array1D<ReqReportVariables> ReqRepVars;
     extern Array1D<MeterArrayType> VarMeterArrays;
     extern Array1D<MeterType> EnergyMeters;
@@ -697,6 +712,10 @@ namespace OutputProcessor {
                            Optional<Array1S_int const> OnCustomMeters = _ // Which custom meters this variable is on (index values)
     );
 
+    void BuildMeterMatrix();
+
+    void UpdateAllMeterValues();
+
     void UpdateMeters(int const TimeStamp); // Current TimeStamp (for max/min)
 
     void ResetAccumulationWhenWarmupComplete();
@@ -788,10 +807,50 @@ namespace OutputProcessor {
                                   bool const meterFileOnlyFlag       // A flag indicating whether the data is to be written to standard output
     );
 
+    void BuildActiveVariableLists();
+
     void WriteRealVariableOutput(RealVariables &realVar,             // Real variable to write out
                                  ReportingFrequency const reportType // The report type or interval (e.g., hourly)
     );
 
+    void OpenBinaryOutputFile();
+
+    void CloseBinaryOutputFile();
+
+    void OpenCsvOutputFiles();
+
+    void CloseCsvOutputFiles();
+
+    void StartAsyncOutput();
+
+    void StopAsyncOutput();
+
+    void PublishLiveOutput();
+
+    void StopLiveOutput();
+
+    void WriteBinaryDictionaryItem(int const reportID,                         // The reporting ID for the data
+                                   ReportingFrequency const reportingInterval, // The reporting interval (e.g., hourly, daily)
+                                   StoreType const storeType,                  // Averaged or summed
+                                   bool const meterFlag,                       // True for meters
+                                   std::string const &keyedValue,              // The key name for the data (blank for meters)
+                                   std::string const &variableName,            // The variable or meter name
+                                   std::string const &unitsString              // The units of the data
+    );
+
+    void WriteBinaryData(int const reportID,  // The variable's report ID
+                         Real64 const repValue // The variable's value
+    );
+
+    void WriteBinaryData(int const reportID,                         // The variable's report ID
+                         ReportingFrequency const reportingInterval, // The variable's reporting interval (e.g., daily)
+                         Real64 const repValue,                      // The variable's value
+                         Real64 const minValue,                      // The variable's minimum value during the reporting interval
+                         int const minValueDate,                     // The date the minimum value occurred
+                         Real64 const maxValue,                      // The variable's maximum value during the reporting interval
+                         int const maxValueDate                      // The date the maximum value occurred
+    );
+
     void WriteReportRealData(int const reportID,                         // The variable's report ID
                              std::string const &creportID,               // variable ID in characters
                              Real64 const repValue,                      // The variable's value
@@ -960,6 +1019,10 @@ Real64 GetInternalVariableValueExternalInterface(int const varType,    // 1=inte
                                                  int const keyVarIndex // Array index
 );
 
+void SetInternalVariableUsedByExternalInterface(int const varType,    // 1=integer, 2=REAL(r64), 3=meter
+                                                int const keyVarIndex // Array index
+);
+
 int GetNumMeteredVariables(std::string const &ComponentType, // Given Component Type
                            std::string const &ComponentName  // Given Component Name (user defined)
 );
@@ -50,6 +50,8 @@
 #include <cmath>
 #include <iomanip>
 #include <map>
+#include <sstream>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -88,6 +90,7 @@
 #include <DataSizing.hh>
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataWater.hh>
 #include <DataZoneEquipment.hh>
 #include <DirectAirManager.hh>
@@ -544,21 +547,142 @@ namespace OutputReportTabular {
     static ObjexxFCL::gio::Fmt fmtA("(A)");
 
     namespace {
+        // A monthly table column gathered at one kind of time step; the columns are kept in table and column order
+        struct MonthlyGatherItem
+        {
+            // Members
+            int column;     // index into MonthlyColumns
+            int table;      // index into MonthlyTables
+            int lastColumn; // last column of the table, for the ValueWhenMaxMin and HoursShown scans
+            int typeOfVar;
+            int varNum;
+            int aggType;
+            bool summed; // the variable is summed rather than averaged
+
+            // Default Constructor
+            MonthlyGatherItem() : column(0), table(0), lastColumn(0), typeOfVar(0), varNum(0), aggType(0), summed(false)
+            {
+            }
+        };
+
+        // A binned variable gathered at one kind of time step
+        struct BinGatherItem
+        {
+            // Members
+            int object;   // index into OutputTableBinned
+            int repIndex; // index into BinResults, BinResultsBelow, BinResultsAbove and BinStatistics
+            int typeOfVar;
+            int varMeterNum;
+            int scheduleIndex;
+            Real64 intervalStart;
+            Real64 intervalSize;
+            Real64 topValue;
+            bool summed; // the variable is summed rather than averaged
+
+            // Default Constructor
+            BinGatherItem()
+                : object(0), repIndex(0), typeOfVar(0), varMeterNum(0), scheduleIndex(0), intervalStart(0.0), intervalSize(0.0), topValue(0.0),
+                  summed(false)
+            {
+            }
+        };
+
+        // A BEPS meter and the gathered total it is added to
+        struct MeterGatherItem
+        {
+            // Members
+            int meterNumber;
+            Real64 *gathered;
+
+            // Default Constructor
+            MeterGatherItem() : meterNumber(0), gathered(nullptr)
+            {
+            }
+        };
+
+        Array1D<std::vector<MonthlyGatherItem>> MonthlyGatherItems(2); // by step type (Zone, HVAC)
+        std::vector<Real64> MonthlyGatherValues;                        // current value of each gathered column
+        Array1D<std::vector<BinGatherItem>> BinGatherItems(2);          // by step type (Zone, HVAC)
+        std::vector<MeterGatherItem> BEPSGatherItems;
+
         bool GatherMonthlyResultsForTimestepRunOnce(true);
+        bool GatherBinResultsForTimestepRunOnce(true);
+        bool GatherBEPSResultsForTimestepRunOnce(true);
         bool UpdateTabularReportsGetInput(true);
         bool GatherHeatGainReportfirstTime(true);
         bool AllocateLoadComponentArraysDoAllocate(true);
         bool initAdjFenDone(false);
+
+        // A report header, subtitle, line of text, table or piece of the HTML table of contents. The reports are built once
+        // into this list and CloseOutputTabularFile renders the list to each requested style.
+        struct TabularItem
+        {
+            enum class Kind
+            {
+                ReportHeaders,
+                Subtitle,
+                TextLine,
+                Table,
+                HtmlText
+            };
+
+            // Members
+            Kind kind;
+            std::string text;       // report name, subtitle, line of text or HTML; footnote of a table
+            std::string objectName; // report "for" name
+            std::string modifiedReportName;
+            bool option;         // bold line of text, transposed XML table
+            Array2D_string body; // column, row
+            Array1D_string rowLabels;
+            Array1D_string columnLabels;
+            Array1D_int widthColumn;
+
+            // Default Constructor
+            TabularItem() : kind(Kind::TextLine), option(false)
+            {
+            }
+        };
+
+        // Names that the rendering of one style carries from item to item
+        struct TabularRenderState
+        {
+            // Members
+            std::string activeSubTableName;
+            std::string activeReportName;
+            std::string activeForName;
+            std::string prevReportName;
+        };
+
+        std::vector<TabularItem> TabularItems;
+
+        void RenderReportHeaders(int const iStyle, TabularItem const &item, TabularRenderState &state);
+
+        void RenderSubtitle(int const iStyle, TabularItem const &item, TabularRenderState &state);
+
+        void RenderTextLine(int const iStyle, TabularItem const &item);
+
+        void RenderTable(int const iStyle, TabularItem const &item, TabularRenderState &state);
     } // namespace
 
     // Functions
     void clear_state()
     {
         GatherMonthlyResultsForTimestepRunOnce = true;
+        GatherBinResultsForTimestepRunOnce = true;
+        GatherBEPSResultsForTimestepRunOnce = true;
+        for (auto &items : MonthlyGatherItems) {
+            items.clear();
+        }
+        MonthlyGatherValues.clear();
+        for (auto &items : BinGatherItems) {
+            items.clear();
+        }
+        BEPSGatherItems.clear();
         UpdateTabularReportsGetInput = true;
         GatherHeatGainReportfirstTime = true;
         AllocateLoadComponentArraysDoAllocate = true;
         initAdjFenDone = false;
+        TabularItems.clear();
         OutputTableBinnedCount = 0;
         BinResultsTableCount = 0;
         BinResultsIntervalCount = 0;
@@ -3684,7 +3808,7 @@ namespace OutputReportTabular {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Jason Glazer
         //       DATE WRITTEN   July 2003
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, renders the reports recorded by WriteReportHeaders, WriteTable, etc.
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -3714,22 +3838,47 @@ namespace OutputReportTabular {
         // na
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        int iStyle;
 
         if (WriteTabularFiles) {
-            for (iStyle = 1; iStyle <= numStyles; ++iStyle) {
+            // the styles are rendered from the same recorded reports and go to different files, so they are independent
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(DataSystemVariables::NumberIntRadThreads) if (numStyles > 1)
+#endif
+            for (int iStyle = 1; iStyle <= numStyles; ++iStyle) {
                 std::ofstream &tbl_stream(*TabularOutputFile(iStyle));
+                TabularRenderState state;
+                for (TabularItem const &item : TabularItems) {
+                    switch (item.kind) {
+                    case TabularItem::Kind::ReportHeaders:
+                        RenderReportHeaders(iStyle, item, state);
+                        break;
+                    case TabularItem::Kind::Subtitle:
+                        RenderSubtitle(iStyle, item, state);
+                        break;
+                    case TabularItem::Kind::TextLine:
+                        RenderTextLine(iStyle, item);
+                        break;
+                    case TabularItem::Kind::Table:
+                        RenderTable(iStyle, item, state);
+                        break;
+                    case TabularItem::Kind::HtmlText:
+                        if (TableStyle(iStyle) == tableStyleHTML) tbl_stream << item.text;
+                        break;
+                    }
+                }
                 if (TableStyle(iStyle) == tableStyleHTML) { // if HTML file put ending info
                     tbl_stream << "</body>\n";
                     tbl_stream << "</html>\n";
                 } else if (TableStyle(iStyle) == tableStyleXML) {
-                    if (!prevReportName.empty()) {
-                        tbl_stream << "</" << prevReportName << ">\n"; // close the last element if it was used.
+                    if (!state.prevReportName.empty()) {
+                        tbl_stream << "</" << state.prevReportName << ">\n"; // close the last element if it was used.
                     }
                     tbl_stream << "</EnergyPlusTabularReports>\n";
+                    prevReportName = state.prevReportName;
                 }
                 tbl_stream.close();
             }
+            TabularItems.clear();
         }
     }
 
@@ -3738,7 +3887,7 @@ namespace OutputReportTabular {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Jason Glazer
         //       DATE WRITTEN   June 2005
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, recorded for rendering at CloseOutputTabularFile
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -3799,7 +3948,7 @@ namespace OutputReportTabular {
 
         for (iStyle = 1; iStyle <= numStyles; ++iStyle) {
             if (TableStyle(iStyle) == tableStyleHTML) {
-                std::ostream &tbl_stream(*TabularOutputFile(iStyle));
+                std::ostringstream tbl_stream;
                 tbl_stream << "<hr>\n";
                 tbl_stream << "<a name=toc></a>\n";
                 tbl_stream << "<p><b>Table of Contents</b></p>\n";
@@ -3836,7 +3985,7 @@ namespace OutputReportTabular {
                     tbl_stream << "<br><a href=\"#" << MakeAnchorName(Adaptive_Comfort_Summary, Entire_Facility)
                                << "\">Adaptive Comfort Summary</a>\n";
                 }
-                if (displayEioSummary) {
+                if (displayEioSummary && !DataSystemVariables::SuppressEioOutput) {
                     tbl_stream << "<br><a href=\"#" << MakeAnchorName(Initialization_Summary, Entire_Facility) << "\">Initialization Summary</a>\n";
                 }
                 if (displayHeatEmissionsSummary) {
@@ -3905,6 +4054,9 @@ namespace OutputReportTabular {
                         }
                     }
                 }
+                TabularItems.emplace_back();
+                TabularItems.back().kind = TabularItem::Kind::HtmlText;
+                TabularItems.back().text = tbl_stream.str();
             }
         }
     }
@@ -3922,13 +4074,17 @@ namespace OutputReportTabular {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Jason Glazer
         //       DATE WRITTEN   August 2003
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, gather from flat per step type lists
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
         //   Gathers the data each timesetp and adds the length of the
         //   timestep to the appropriate bin.
 
+        // METHODOLOGY EMPLOYED:
+        //   The first call lists, for each step type, every binned variable gathered at that step type together
+        //   with the interval settings of its object, so each call only visits its own variables.
+
         // Using/Aliasing
         using DataEnvironment::Month;
         using DataHVACGlobals::TimeStepSys;
@@ -3947,100 +4103,99 @@ namespace OutputReportTabular {
         // na
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        int iInObj;
-        int jTable;
         Real64 curValue;
-        // values of OutputTableBinned array for current index
-        Real64 curIntervalStart;
-        Real64 curIntervalSize;
-        int curIntervalCount;
-        int curResIndex;
-        int curNumTables;
-        int curTypeOfVar;
-        int curScheduleIndex;
         Real64 elapsedTime;
         bool gatherThisTime;
-        Real64 topValue;
         int binNum;
         int repIndex;
-        int curStepType;
+        int curObject;
 
         // REAL(r64), external :: GetInternalVariableValue
 
         if (!DoWeathSim) return;
         elapsedTime = TimeStepSys;
         timeInYear += elapsedTime;
-        for (iInObj = 1; iInObj <= OutputTableBinnedCount; ++iInObj) {
-            // get values of array for current object being referenced
-            curIntervalStart = OutputTableBinned(iInObj).intervalStart;
-            curIntervalSize = OutputTableBinned(iInObj).intervalSize;
-            curIntervalCount = OutputTableBinned(iInObj).intervalCount;
-            curResIndex = OutputTableBinned(iInObj).resIndex;
-            curNumTables = OutputTableBinned(iInObj).numTables;
-            topValue = curIntervalStart + curIntervalSize * curIntervalCount;
-            curTypeOfVar = OutputTableBinned(iInObj).typeOfVar;
-            curStepType = OutputTableBinned(iInObj).stepType;
-            curScheduleIndex = OutputTableBinned(iInObj).scheduleIndex;
+
+        // list the binned variables gathered at each step type
+        if (GatherBinResultsForTimestepRunOnce) {
+            for (auto &items : BinGatherItems) {
+                items.clear();
+            }
+            for (int iInObj = 1; iInObj <= OutputTableBinnedCount; ++iInObj) {
+                auto const &binned(OutputTableBinned(iInObj));
+                if ((binned.stepType != stepTypeZone) && (binned.stepType != stepTypeHVAC)) continue;
+                for (int jTable = 1; jTable <= binned.numTables; ++jTable) {
+                    BinGatherItem item;
+                    item.object = iInObj;
+                    item.repIndex = binned.resIndex + (jTable - 1);
+                    item.typeOfVar = binned.typeOfVar;
+                    item.varMeterNum = BinObjVarID(item.repIndex).varMeterNum;
+                    item.scheduleIndex = binned.scheduleIndex;
+                    item.intervalStart = binned.intervalStart;
+                    item.intervalSize = binned.intervalSize;
+                    item.topValue = binned.intervalStart + binned.intervalSize * binned.intervalCount;
+                    item.summed = (binned.avgSum == OutputProcessor::StoreType::Summed);
+                    BinGatherItems(binned.stepType).push_back(item);
+                }
+            }
+            GatherBinResultsForTimestepRunOnce = false;
+        }
+        if ((IndexTypeKey != ZoneTSReporting) && (IndexTypeKey != HVACTSReporting)) return;
+
+        // per MJW when a summed variable is used divide it by the length of the time step
+        if (IndexTypeKey == HVACTSReporting) {
+            elapsedTime = TimeStepSys;
+        } else {
+            elapsedTime = TimeStepZone;
+        }
+
+        curObject = 0;
+        gatherThisTime = true;
+        for (auto const &item : BinGatherItems(IndexTypeKey)) {
             // if a schedule was used, check if it was non-zero value
-            if (curScheduleIndex != 0) {
-                if (GetCurrentScheduleValue(curScheduleIndex) != 0.0) {
-                    gatherThisTime = true;
-                } else {
-                    gatherThisTime = false;
-                }
+            if (item.object != curObject) {
+                curObject = item.object;
+                gatherThisTime = (item.scheduleIndex == 0) || (GetCurrentScheduleValue(item.scheduleIndex) != 0.0);
+            }
+            if (!gatherThisTime) continue;
+            repIndex = item.repIndex;
+            // put actual value from OutputProcesser arrays
+            curValue = GetInternalVariableValue(item.typeOfVar, item.varMeterNum);
+            if (item.summed) { // if it is a summed variable
+                curValue /= (elapsedTime * SecInHour);
+            }
+            // round the value to the number of signficant digits used in the final output report
+            if (item.intervalSize < 1) {
+                curValue = round(curValue * 10000.0) / 10000.0; // four significant digits
+            } else if (item.intervalSize >= 10) {
+                curValue = round(curValue); // zero significant digits
             } else {
-                gatherThisTime = true;
-            }
-            if (gatherThisTime) {
-                for (jTable = 1; jTable <= curNumTables; ++jTable) {
-                    repIndex = curResIndex + (jTable - 1);
-                    if (((curStepType == stepTypeZone) && (IndexTypeKey == ZoneTSReporting)) ||
-                        ((curStepType == stepTypeHVAC) && (IndexTypeKey == HVACTSReporting))) {
-                        // put actual value from OutputProcesser arrays
-                        curValue = GetInternalVariableValue(curTypeOfVar, BinObjVarID(repIndex).varMeterNum);
-                        // per MJW when a summed variable is used divide it by the length of the time step
-                        if (IndexTypeKey == HVACTSReporting) {
-                            elapsedTime = TimeStepSys;
-                        } else {
-                            elapsedTime = TimeStepZone;
-                        }
-                        if (OutputTableBinned(iInObj).avgSum == OutputProcessor::StoreType::Summed) { // if it is a summed variable
-                            curValue /= (elapsedTime * SecInHour);
-                        }
-                        // round the value to the number of signficant digits used in the final output report
-                        if (curIntervalSize < 1) {
-                            curValue = round(curValue * 10000.0) / 10000.0; // four significant digits
-                        } else if (curIntervalSize >= 10) {
-                            curValue = round(curValue); // zero significant digits
-                        } else {
-                            curValue = round(curValue * 100.0) / 100.0; // two significant digits
-                        }
-                        // check if the value is above the maximum or below the minimum value
-                        // first before binning the value within the range.
-                        if (curValue < curIntervalStart) {
-                            BinResultsBelow(repIndex).mnth(Month) += elapsedTime;
-                            BinResultsBelow(repIndex).hrly(HourOfDay) += elapsedTime;
-                        } else if (curValue >= topValue) {
-                            BinResultsAbove(repIndex).mnth(Month) += elapsedTime;
-                            BinResultsAbove(repIndex).hrly(HourOfDay) += elapsedTime;
-                        } else {
-                            // determine which bin the results are in
-                            binNum = int((curValue - curIntervalStart) / curIntervalSize) + 1;
-                            BinResults(binNum, repIndex).mnth(Month) += elapsedTime;
-                            BinResults(binNum, repIndex).hrly(HourOfDay) += elapsedTime;
-                        }
-                        // add to statistics array
-                        ++BinStatistics(repIndex).n;
-                        BinStatistics(repIndex).sum += curValue;
-                        BinStatistics(repIndex).sum2 += curValue * curValue;
-                        if (curValue < BinStatistics(repIndex).minimum) {
-                            BinStatistics(repIndex).minimum = curValue;
-                        }
-                        if (curValue > BinStatistics(repIndex).maximum) {
-                            BinStatistics(repIndex).maximum = curValue;
-                        }
-                    }
-                }
+                curValue = round(curValue * 100.0) / 100.0; // two significant digits
+            }
+            // check if the value is above the maximum or below the minimum value
+            // first before binning the value within the range.
+            if (curValue < item.intervalStart) {
+                BinResultsBelow(repIndex).mnth(Month) += elapsedTime;
+                BinResultsBelow(repIndex).hrly(HourOfDay) += elapsedTime;
+            } else if (curValue >= item.topValue) {
+                BinResultsAbove(repIndex).mnth(Month) += elapsedTime;
+                BinResultsAbove(repIndex).hrly(HourOfDay) += elapsedTime;
+            } else {
+                // determine which bin the results are in
+                binNum = int((curValue - item.intervalStart) / item.intervalSize) + 1;
+                BinResults(binNum, repIndex).mnth(Month) += elapsedTime;
+                BinResults(binNum, repIndex).hrly(HourOfDay) += elapsedTime;
+            }
+            // add to statistics array
+            auto &statistics(BinStatistics(repIndex));
+            ++statistics.n;
+            statistics.sum += curValue;
+            statistics.sum2 += curValue * curValue;
+            if (curValue < statistics.minimum) {
+                statistics.minimum = curValue;
+            }
+            if (curValue > statistics.maximum) {
+                statistics.maximum = curValue;
             }
         }
     }
@@ -4050,13 +4205,20 @@ namespace OutputReportTabular {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Jason Glazer
         //       DATE WRITTEN   September 2003
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, gather from flat per step type column lists
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
         //   Gathers the data each timestep and updates the arrays
         //   holding the data that will be reported later.
 
+        // METHODOLOGY EMPLOYED:
+        //   The first call lists, for each step type, the columns of all monthly tables that are gathered at that
+        //   step type, in table and column order. Each call then reads the current values of its columns in
+        //   one pass and aggregates them in a second pass, so the time step does not walk the columns of the
+        //   other step type. The time stamp and the summed variable divisor are the same for every column and
+        //   are found once per call.
+
         // Using/Aliasing
         using DataEnvironment::DayOfMonth;
         using DataEnvironment::Month;
@@ -4077,15 +4239,11 @@ namespace OutputReportTabular {
         // na
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        int iTable;  // loop variable for monthlyTables
-        int jColumn; // loop variable for monthlyColumns
         int curCol;
         Real64 curValue;
-        int curTypeOfVar;
-        int curVarNum;
         Real64 elapsedTime;
+        Real64 summedDivisor; // length of the time step in seconds, for summed variables used as rates
         Real64 oldResultValue;
-        int oldTimeStamp;
         Real64 oldDuration;
         Real64 newResultValue;
         int newTimeStamp;
@@ -4095,289 +4253,259 @@ namespace OutputReportTabular {
         // LOGICAL,SAVE  :: activeHoursShown=.FALSE.  !fix by LKL addressing CR6482
         bool activeHoursShown;
         bool activeNewValue;
-        int curStepType;
-        int minuteCalculated;
-        int kOtherColumn; // variable used in loop to scan through additional columns
+        int curTable;
         int scanColumn;
         Real64 scanValue;
-        int scanTypeOfVar;
-        int scanVarNum;
         Real64 oldScanValue;
-        // local copies of some of the MonthlyColumns array references since
-        // profiling showed that they were slow.
-
-        static Array1D_int MonthlyColumnsTypeOfVar;
-        static Array1D_int MonthlyColumnsStepType;
-        static Array1D_int MonthlyColumnsAggType;
-        static Array1D_int MonthlyColumnsVarNum;
-        static Array1D_int MonthlyTablesNumColumns;
-        static int curFirstColumn(0);
 
         if (!DoWeathSim) return;
 
-        // create temporary arrays to speed processing of these arrays
+        // list the columns gathered at each step type
         if (GatherMonthlyResultsForTimestepRunOnce) {
-            // MonthlyColumns
-            MonthlyColumnsTypeOfVar.allocate(MonthlyColumns.I());
-            MonthlyColumnsStepType.allocate(MonthlyColumns.I());
-            MonthlyColumnsAggType.allocate(MonthlyColumns.I());
-            MonthlyColumnsVarNum.allocate(MonthlyColumns.I());
-            for (int i = MonthlyColumns.l(), e = MonthlyColumns.u(); i <= e; ++i) {
-                auto const &col(MonthlyColumns(i));
-                MonthlyColumnsTypeOfVar(i) = col.typeOfVar;
-                MonthlyColumnsStepType(i) = col.stepType;
-                MonthlyColumnsAggType(i) = col.aggType;
-                MonthlyColumnsVarNum(i) = col.varNum;
-            }
-
-            // MonthlyTables
-            MonthlyTablesNumColumns.allocate(MonthlyTables.I());
-            for (int i = MonthlyTables.l(), e = MonthlyTables.u(); i <= e; ++i) {
-                MonthlyTablesNumColumns(i) = MonthlyTables(i).numColumns;
+            for (auto &items : MonthlyGatherItems) {
+                items.clear();
+            }
+            for (int iTable = 1; iTable <= MonthlyTablesCount; ++iTable) {
+                int const firstColumn(MonthlyTables(iTable).firstColumn);
+                int const lastColumn(firstColumn + MonthlyTables(iTable).numColumns - 1);
+                for (int iCol = firstColumn; iCol <= lastColumn; ++iCol) {
+                    auto const &col(MonthlyColumns(iCol));
+                    if ((col.stepType != stepTypeZone) && (col.stepType != stepTypeHVAC)) continue;
+                    MonthlyGatherItem item;
+                    item.column = iCol;
+                    item.table = iTable;
+                    item.lastColumn = lastColumn;
+                    item.typeOfVar = col.typeOfVar;
+                    item.varNum = col.varNum;
+                    item.aggType = col.aggType;
+                    item.summed = (col.avgSum == OutputProcessor::StoreType::Summed);
+                    MonthlyGatherItems(col.stepType).push_back(item);
+                }
             }
 
             // set flag so this block is only executed once
             GatherMonthlyResultsForTimestepRunOnce = false;
         }
+        IsMonthGathered(Month) = true;
+        if ((IndexTypeKey != ZoneTSReporting) && (IndexTypeKey != HVACTSReporting)) return;
 
-        elapsedTime = TimeStepSys;
         if (IndexTypeKey == HVACTSReporting) {
             elapsedTime = TimeStepSys;
+            summedDivisor = TimeStepSys * SecInHour;
         } else {
             elapsedTime = TimeStepZone;
-        }
-        IsMonthGathered(Month) = true;
-        for (iTable = 1; iTable <= MonthlyTablesCount; ++iTable) {
-            activeMinMax = false;     // at the beginning of the new timestep
-            activeHoursShown = false; // fix by JG addressing CR6482
-            curFirstColumn = MonthlyTables(iTable).firstColumn;
-            for (jColumn = 1; jColumn <= MonthlyTablesNumColumns(iTable); ++jColumn) {
-                curCol = jColumn + curFirstColumn - 1;
-                curTypeOfVar = MonthlyColumnsTypeOfVar(curCol);
-                curStepType = MonthlyColumnsStepType(curCol);
-                if (((curStepType == stepTypeZone) && (IndexTypeKey == ZoneTSReporting)) ||
-                    ((curStepType == stepTypeHVAC) && (IndexTypeKey == HVACTSReporting))) {
-                    //  the above condition used to include the following prior to new scan method
-                    //  (MonthlyColumns(curCol)%aggType .EQ. aggTypeValueWhenMaxMin)
-                    curVarNum = MonthlyColumnsVarNum(curCol);
-                    curValue = GetInternalVariableValue(curTypeOfVar, curVarNum);
-                    // Get the value from the result array
-                    oldResultValue = MonthlyColumns(curCol).reslt(Month);
-                    oldTimeStamp = MonthlyColumns(curCol).timeStamp(Month);
-                    oldDuration = MonthlyColumns(curCol).duration(Month);
-                    // Zero the revised values (as default if not set later in SELECT)
-                    newResultValue = 0.0;
-                    newTimeStamp = 0;
-                    newDuration = 0.0;
-                    activeNewValue = false;
-                    // the current timestamp
-                    minuteCalculated = DetermineMinuteForReporting(IndexTypeKey);
-                    //      minuteCalculated = (CurrentTime - INT(CurrentTime))*60
-                    //      IF (IndexTypeKey .EQ. stepTypeHVAC) minuteCalculated = minuteCalculated + SysTimeElapsed * 60
-                    //      minuteCalculated = INT((TimeStep-1) * TimeStepZone * 60) + INT((SysTimeElapsed + TimeStepSys) * 60)
-                    EncodeMonDayHrMin(timestepTimeStamp, Month, DayOfMonth, HourOfDay, minuteCalculated);
-                    // perform the selected aggregation type
-                    // use next lines since it is faster was: SELECT CASE (MonthlyColumns(curCol)%aggType)
+            summedDivisor = TimeStepZoneSec;
+        }
+
+        auto const &items(MonthlyGatherItems(IndexTypeKey));
+        if (items.empty()) return;
+
+        // the current timestamp
+        EncodeMonDayHrMin(timestepTimeStamp, Month, DayOfMonth, HourOfDay, DetermineMinuteForReporting(IndexTypeKey));
+
+        // read the current values of all gathered columns
+        MonthlyGatherValues.resize(items.size());
+        for (std::size_t iItem = 0; iItem < items.size(); ++iItem) {
+            MonthlyGatherValues[iItem] = GetInternalVariableValue(items[iItem].typeOfVar, items[iItem].varNum);
+        }
+
+        curTable = 0;
+        activeMinMax = false;
+        activeHoursShown = false;
+        for (std::size_t iItem = 0; iItem < items.size(); ++iItem) {
+            auto const &item(items[iItem]);
+            if (item.table != curTable) {
+                curTable = item.table;
+                activeMinMax = false;     // at the beginning of the new timestep
+                activeHoursShown = false; // fix by JG addressing CR6482
+            }
+            curCol = item.column;
+            auto &col(MonthlyColumns(curCol));
+            curValue = MonthlyGatherValues[iItem];
+            // Get the value from the result array
+            oldResultValue = col.reslt(Month);
+            oldDuration = col.duration(Month);
+            // Zero the revised values (as default if not set later in SELECT)
+            newResultValue = 0.0;
+            newTimeStamp = 0;
+            newDuration = 0.0;
+            activeNewValue = false;
+            // perform the selected aggregation type
+            // use next lines since it is faster was: SELECT CASE (MonthlyColumns(curCol)%aggType)
+            {
+                auto const SELECT_CASE_var(item.aggType);
+                if (SELECT_CASE_var == aggTypeSumOrAvg) {
+                    if (item.summed) { // if it is a summed variable
+                        newResultValue = oldResultValue + curValue;
+                    } else {
+                        newResultValue = oldResultValue + curValue * elapsedTime; // for averaging - weight by elapsed time
+                    }
+                    newDuration = oldDuration + elapsedTime;
+                    activeNewValue = true;
+                } else if (SELECT_CASE_var == aggTypeMaximum) {
+                    // per MJW when a summed variable is used divide it by the length of the time step
+                    if (item.summed) { // if it is a summed variable
+                        curValue /= summedDivisor;
+                    }
+                    if (curValue > oldResultValue) {
+                        newResultValue = curValue;
+                        newTimeStamp = timestepTimeStamp;
+                        activeMinMax = true;
+                        activeNewValue = true;
+                    } else {
+                        activeMinMax = false; // reset this
+                    }
+                } else if (SELECT_CASE_var == aggTypeMinimum) {
+                    // per MJW when a summed variable is used divide it by the length of the time step
+                    if (item.summed) { // if it is a summed variable
+                        curValue /= summedDivisor;
+                    }
+                    if (curValue < oldResultValue) {
+                        newResultValue = curValue;
+                        newTimeStamp = timestepTimeStamp;
+                        activeMinMax = true;
+                        activeNewValue = true;
+                    } else {
+                        activeMinMax = false; // reset this
+                    }
+                } else if (SELECT_CASE_var == aggTypeHoursZero) {
+                    if (curValue == 0) {
+                        newResultValue = oldResultValue + elapsedTime;
+                        activeHoursShown = true;
+                        activeNewValue = true;
+                    } else {
+                        activeHoursShown = false;
+                    }
+                } else if (SELECT_CASE_var == aggTypeHoursNonZero) {
+                    if (curValue != 0) {
+                        newResultValue = oldResultValue + elapsedTime;
+                        activeHoursShown = true;
+                        activeNewValue = true;
+                    } else {
+                        activeHoursShown = false;
+                    }
+                } else if (SELECT_CASE_var == aggTypeHoursPositive) {
+                    if (curValue > 0) {
+                        newResultValue = oldResultValue + elapsedTime;
+                        activeHoursShown = true;
+                        activeNewValue = true;
+                    } else {
+                        activeHoursShown = false;
+                    }
+                } else if (SELECT_CASE_var == aggTypeHoursNonPositive) {
+                    if (curValue <= 0) {
+                        newResultValue = oldResultValue + elapsedTime;
+                        activeHoursShown = true;
+                        activeNewValue = true;
+                    } else {
+                        activeHoursShown = false;
+                    }
+                } else if (SELECT_CASE_var == aggTypeHoursNegative) {
+                    if (curValue < 0) {
+                        newResultValue = oldResultValue + elapsedTime;
+                        activeHoursShown = true;
+                        activeNewValue = true;
+                    } else {
+                        activeHoursShown = false;
+                    }
+                } else if (SELECT_CASE_var == aggTypeHoursNonNegative) {
+                    if (curValue >= 0) {
+                        newResultValue = oldResultValue + elapsedTime;
+                        activeHoursShown = true;
+                        activeNewValue = true;
+                    } else {
+                        activeHoursShown = false;
+                    }
+                    // The valueWhenMaxMin is picked up now during the activeMinMax if block below.
+                    // CASE (aggTypeValueWhenMaxMin)
+                    // CASE (aggTypeSumOrAverageHoursShown)
+                    // CASE (aggTypeMaximumDuringHoursShown)
+                    // CASE (aggTypeMinimumDuringHoursShown)
+                }
+            }
+            // if the new value has been set then set the monthly values to the
+            // new columns. This skips the aggregation types that don't even get
+            // triggered now such as valueWhenMinMax and all the agg*HoursShown
+            if (activeNewValue) {
+                col.reslt(Month) = newResultValue;
+                col.timeStamp(Month) = newTimeStamp;
+                col.duration(Month) = newDuration;
+            }
+            // if a minimum or maximum value was set this timeStep then
+            // scan the remaining columns of the table looking for values
+            // that are aggregation type "ValueWhenMaxMin" and set their values
+            // if another minimum or maximum column is found then end
+            // the scan (it will be taken care of when that column is done)
+            if (activeMinMax) {
+                for (scanColumn = curCol + 1; scanColumn <= item.lastColumn; ++scanColumn) {
+                    auto &scanCol(MonthlyColumns(scanColumn));
                     {
-                        auto const SELECT_CASE_var(MonthlyColumnsAggType(curCol));
-                        if (SELECT_CASE_var == aggTypeSumOrAvg) {
-                            if (MonthlyColumns(curCol).avgSum == OutputProcessor::StoreType::Summed) { // if it is a summed variable
-                                newResultValue = oldResultValue + curValue;
-                            } else {
-                                newResultValue = oldResultValue + curValue * elapsedTime; // for averaging - weight by elapsed time
-                            }
-                            newDuration = oldDuration + elapsedTime;
-                            activeNewValue = true;
-                        } else if (SELECT_CASE_var == aggTypeMaximum) {
-                            // per MJW when a summed variable is used divide it by the length of the time step
-                            if (MonthlyColumns(curCol).avgSum == OutputProcessor::StoreType::Summed) { // if it is a summed variable
-                                if (IndexTypeKey == HVACTSReporting) {
-                                    curValue /= (TimeStepSys * SecInHour);
-                                } else {
-                                    curValue /= TimeStepZoneSec;
-                                }
-                            }
-                            if (curValue > oldResultValue) {
-                                newResultValue = curValue;
-                                newTimeStamp = timestepTimeStamp;
-                                activeMinMax = true;
-                                activeNewValue = true;
-                            } else {
-                                activeMinMax = false; // reset this
-                            }
-                        } else if (SELECT_CASE_var == aggTypeMinimum) {
-                            // per MJW when a summed variable is used divide it by the length of the time step
-                            if (MonthlyColumns(curCol).avgSum == OutputProcessor::StoreType::Summed) { // if it is a summed variable
-                                if (IndexTypeKey == HVACTSReporting) {
-                                    curValue /= (TimeStepSys * SecInHour);
-                                } else {
-                                    curValue /= TimeStepZoneSec;
-                                }
-                            }
-                            if (curValue < oldResultValue) {
-                                newResultValue = curValue;
-                                newTimeStamp = timestepTimeStamp;
-                                activeMinMax = true;
-                                activeNewValue = true;
-                            } else {
-                                activeMinMax = false; // reset this
-                            }
-                        } else if (SELECT_CASE_var == aggTypeHoursZero) {
-                            if (curValue == 0) {
-                                newResultValue = oldResultValue + elapsedTime;
-                                activeHoursShown = true;
-                                activeNewValue = true;
-                            } else {
-                                activeHoursShown = false;
-                            }
-                        } else if (SELECT_CASE_var == aggTypeHoursNonZero) {
-                            if (curValue != 0) {
-                                newResultValue = oldResultValue + elapsedTime;
-                                activeHoursShown = true;
-                                activeNewValue = true;
-                            } else {
-                                activeHoursShown = false;
-                            }
-                        } else if (SELECT_CASE_var == aggTypeHoursPositive) {
-                            if (curValue > 0) {
-                                newResultValue = oldResultValue + elapsedTime;
-                                activeHoursShown = true;
-                                activeNewValue = true;
-                            } else {
-                                activeHoursShown = false;
+                        auto const SELECT_CASE_var(scanCol.aggType);
+                        if ((SELECT_CASE_var == aggTypeMaximum) || (SELECT_CASE_var == aggTypeMinimum)) {
+                            // end scanning since these might reset
+                            break; // do
+                        } else if (SELECT_CASE_var == aggTypeValueWhenMaxMin) {
+                            // this case is when the value should be set
+                            scanValue = GetInternalVariableValue(scanCol.typeOfVar, scanCol.varNum);
+                            // When a summed variable is used divide it by the length of the time step
+                            if (scanCol.avgSum == OutputProcessor::StoreType::Summed) { // if it is a summed variable
+                                scanValue /= summedDivisor;
                             }
-                        } else if (SELECT_CASE_var == aggTypeHoursNonPositive) {
-                            if (curValue <= 0) {
-                                newResultValue = oldResultValue + elapsedTime;
-                                activeHoursShown = true;
-                                activeNewValue = true;
+                            scanCol.reslt(Month) = scanValue;
+                        } else {
+                            // do nothing
+                        }
+                    }
+                }
+            }
+            // If the hours variable is active then scan through the rest of the variables
+            // and accumulate
+            if (activeHoursShown) {
+                for (scanColumn = curCol + 1; scanColumn <= item.lastColumn; ++scanColumn) {
+                    auto &scanCol(MonthlyColumns(scanColumn));
+                    scanValue = GetInternalVariableValue(scanCol.typeOfVar, scanCol.varNum);
+                    oldScanValue = scanCol.reslt(Month);
+                    {
+                        auto const SELECT_CASE_var(scanCol.aggType);
+                        if ((SELECT_CASE_var == aggTypeHoursZero) || (SELECT_CASE_var == aggTypeHoursNonZero)) {
+                            // end scanning since these might reset
+                            break; // do
+                        } else if ((SELECT_CASE_var == aggTypeHoursPositive) || (SELECT_CASE_var == aggTypeHoursNonPositive)) {
+                            // end scanning since these might reset
+                            break; // do
+                        } else if ((SELECT_CASE_var == aggTypeHoursNegative) || (SELECT_CASE_var == aggTypeHoursNonNegative)) {
+                            // end scanning since these might reset
+                            break; // do
+                        } else if (SELECT_CASE_var == aggTypeSumOrAverageHoursShown) {
+                            // this case is when the value should be set
+                            if (scanCol.avgSum == OutputProcessor::StoreType::Summed) { // if it is a summed variable
+                                scanCol.reslt(Month) = oldScanValue + scanValue;
                             } else {
-                                activeHoursShown = false;
+                                // for averaging - weight by elapsed time
+                                scanCol.reslt(Month) = oldScanValue + scanValue * elapsedTime;
                             }
-                        } else if (SELECT_CASE_var == aggTypeHoursNegative) {
-                            if (curValue < 0) {
-                                newResultValue = oldResultValue + elapsedTime;
-                                activeHoursShown = true;
-                                activeNewValue = true;
-                            } else {
-                                activeHoursShown = false;
+                            scanCol.duration(Month) += elapsedTime;
+                        } else if (SELECT_CASE_var == aggTypeMaximumDuringHoursShown) {
+                            if (scanCol.avgSum == OutputProcessor::StoreType::Summed) { // if it is a summed variable
+                                scanValue /= summedDivisor;
                             }
-                        } else if (SELECT_CASE_var == aggTypeHoursNonNegative) {
-                            if (curValue >= 0) {
-                                newResultValue = oldResultValue + elapsedTime;
-                                activeHoursShown = true;
-                                activeNewValue = true;
-                            } else {
-                                activeHoursShown = false;
+                            if (scanValue > oldScanValue) {
+                                scanCol.reslt(Month) = scanValue;
+                                scanCol.timeStamp(Month) = timestepTimeStamp;
                             }
-                            // The valueWhenMaxMin is picked up now during the activeMinMax if block below.
-                            // CASE (aggTypeValueWhenMaxMin)
-                            // CASE (aggTypeSumOrAverageHoursShown)
-                            // CASE (aggTypeMaximumDuringHoursShown)
-                            // CASE (aggTypeMinimumDuringHoursShown)
-                        }
-                    }
-                    // if the new value has been set then set the monthly values to the
-                    // new columns. This skips the aggregation types that don't even get
-                    // triggered now such as valueWhenMinMax and all the agg*HoursShown
-                    if (activeNewValue) {
-                        MonthlyColumns(curCol).reslt(Month) = newResultValue;
-                        MonthlyColumns(curCol).timeStamp(Month) = newTimeStamp;
-                        MonthlyColumns(curCol).duration(Month) = newDuration;
-                    }
-                    // if a minimum or maximum value was set this timeStep then
-                    // scan the remaining columns of the table looking for values
-                    // that are aggregation type "ValueWhenMaxMin" and set their values
-                    // if another minimum or maximum column is found then end
-                    // the scan (it will be taken care of when that column is done)
-                    if (activeMinMax) {
-                        for (kOtherColumn = jColumn + 1; kOtherColumn <= MonthlyTables(iTable).numColumns; ++kOtherColumn) {
-                            scanColumn = kOtherColumn + MonthlyTables(iTable).firstColumn - 1;
-                            {
-                                auto const SELECT_CASE_var(MonthlyColumns(scanColumn).aggType);
-                                if ((SELECT_CASE_var == aggTypeMaximum) || (SELECT_CASE_var == aggTypeMinimum)) {
-                                    // end scanning since these might reset
-                                    break; // do
-                                } else if (SELECT_CASE_var == aggTypeValueWhenMaxMin) {
-                                    // this case is when the value should be set
-                                    scanTypeOfVar = MonthlyColumns(scanColumn).typeOfVar;
-                                    scanVarNum = MonthlyColumns(scanColumn).varNum;
-                                    scanValue = GetInternalVariableValue(scanTypeOfVar, scanVarNum);
-                                    // When a summed variable is used divide it by the length of the time step
-                                    if (MonthlyColumns(scanColumn).avgSum == OutputProcessor::StoreType::Summed) { // if it is a summed variable
-                                        if (IndexTypeKey == HVACTSReporting) {
-                                            scanValue /= (TimeStepSys * SecInHour);
-                                        } else {
-                                            scanValue /= TimeStepZoneSec;
-                                        }
-                                    }
-                                    MonthlyColumns(scanColumn).reslt(Month) = scanValue;
-                                } else {
-                                    // do nothing
-                                }
+                        } else if (SELECT_CASE_var == aggTypeMinimumDuringHoursShown) {
+                            if (scanCol.avgSum == OutputProcessor::StoreType::Summed) { // if it is a summed variable
+                                scanValue /= summedDivisor;
                             }
-                        }
-                    }
-                    // If the hours variable is active then scan through the rest of the variables
-                    // and accumulate
-                    if (activeHoursShown) {
-                        for (kOtherColumn = jColumn + 1; kOtherColumn <= MonthlyTables(iTable).numColumns; ++kOtherColumn) {
-                            scanColumn = kOtherColumn + MonthlyTables(iTable).firstColumn - 1;
-                            scanTypeOfVar = MonthlyColumns(scanColumn).typeOfVar;
-                            scanVarNum = MonthlyColumns(scanColumn).varNum;
-                            scanValue = GetInternalVariableValue(scanTypeOfVar, scanVarNum);
-                            oldScanValue = MonthlyColumns(scanColumn).reslt(Month);
-                            {
-                                auto const SELECT_CASE_var(MonthlyColumns(scanColumn).aggType);
-                                if ((SELECT_CASE_var == aggTypeHoursZero) || (SELECT_CASE_var == aggTypeHoursNonZero)) {
-                                    // end scanning since these might reset
-                                    break; // do
-                                } else if ((SELECT_CASE_var == aggTypeHoursPositive) || (SELECT_CASE_var == aggTypeHoursNonPositive)) {
-                                    // end scanning since these might reset
-                                    break; // do
-                                } else if ((SELECT_CASE_var == aggTypeHoursNegative) || (SELECT_CASE_var == aggTypeHoursNonNegative)) {
-                                    // end scanning since these might reset
-                                    break; // do
-                                } else if (SELECT_CASE_var == aggTypeSumOrAverageHoursShown) {
-                                    // this case is when the value should be set
-                                    if (MonthlyColumns(scanColumn).avgSum == OutputProcessor::StoreType::Summed) { // if it is a summed variable
-                                        MonthlyColumns(scanColumn).reslt(Month) = oldScanValue + scanValue;
-                                    } else {
-                                        // for averaging - weight by elapsed time
-                                        MonthlyColumns(scanColumn).reslt(Month) = oldScanValue + scanValue * elapsedTime;
-                                    }
-                                    MonthlyColumns(scanColumn).duration(Month) += elapsedTime;
-                                } else if (SELECT_CASE_var == aggTypeMaximumDuringHoursShown) {
-                                    if (MonthlyColumns(scanColumn).avgSum == OutputProcessor::StoreType::Summed) { // if it is a summed variable
-                                        if (IndexTypeKey == HVACTSReporting) {
-                                            scanValue /= (TimeStepSys * SecInHour);
-                                        } else {
-                                            scanValue /= TimeStepZoneSec;
-                                        }
-                                    }
-                                    if (scanValue > oldScanValue) {
-                                        MonthlyColumns(scanColumn).reslt(Month) = scanValue;
-                                        MonthlyColumns(scanColumn).timeStamp(Month) = timestepTimeStamp;
-                                    }
-                                } else if (SELECT_CASE_var == aggTypeMinimumDuringHoursShown) {
-                                    if (MonthlyColumns(scanColumn).avgSum == OutputProcessor::StoreType::Summed) { // if it is a summed variable
-                                        if (IndexTypeKey == HVACTSReporting) {
-                                            scanValue /= (TimeStepSys * SecInHour);
-                                        } else {
-                                            scanValue /= TimeStepZoneSec;
-                                        }
-                                    }
-                                    if (scanValue < oldScanValue) {
-                                        MonthlyColumns(scanColumn).reslt(Month) = scanValue;
-                                        MonthlyColumns(scanColumn).timeStamp(Month) = timestepTimeStamp;
-                                    }
-                                } else {
-                                    // do nothing
-                                }
+                            if (scanValue < oldScanValue) {
+                                scanCol.reslt(Month) = scanValue;
+                                scanCol.timeStamp(Month) = timestepTimeStamp;
                             }
-                            activeHoursShown = false; // fixed CR8317
+                        } else {
+                            // do nothing
                         }
                     }
+                    activeHoursShown = false; // fixed CR8317
                 }
             }
         }
@@ -4476,37 +4604,52 @@ namespace OutputReportTabular {
             //    END IF
             //  END DO
 
-            // loop through all of the resources and end uses for the entire facility
-            for (iResource = 1; iResource <= numResourceTypes; ++iResource) {
-                curMeterNumber = meterNumTotalsBEPS(iResource);
-                if (curMeterNumber > 0) {
-                    curMeterValue = GetCurrentMeterValue(curMeterNumber);
-                    gatherTotalsBEPS(iResource) += curMeterValue;
-                }
-
-                for (jEndUse = 1; jEndUse <= NumEndUses; ++jEndUse) {
-                    curMeterNumber = meterNumEndUseBEPS(iResource, jEndUse);
+            // list the facility resource, end use, end use subcategory and source meters once; the BEPS
+            // meter numbers do not change after GetInputOutputTableSummaryReports
+            if (GatherBEPSResultsForTimestepRunOnce) {
+                BEPSGatherItems.clear();
+                MeterGatherItem item;
+                for (iResource = 1; iResource <= numResourceTypes; ++iResource) {
+                    curMeterNumber = meterNumTotalsBEPS(iResource);
                     if (curMeterNumber > 0) {
-                        curMeterValue = GetCurrentMeterValue(curMeterNumber);
-                        gatherEndUseBEPS(iResource, jEndUse) += curMeterValue;
+                        item.meterNumber = curMeterNumber;
+                        item.gathered = &gatherTotalsBEPS(iResource);
+                        BEPSGatherItems.push_back(item);
+                    }
 
-                        for (kEndUseSub = 1; kEndUseSub <= EndUseCategory(jEndUse).NumSubcategories; ++kEndUseSub) {
-                            curMeterNumber = meterNumEndUseSubBEPS(kEndUseSub, jEndUse, iResource);
-                            if (curMeterNumber > 0) {
-                                curMeterValue = GetCurrentMeterValue(curMeterNumber);
-                                gatherEndUseSubBEPS(kEndUseSub, jEndUse, iResource) += curMeterValue;
+                    for (jEndUse = 1; jEndUse <= NumEndUses; ++jEndUse) {
+                        curMeterNumber = meterNumEndUseBEPS(iResource, jEndUse);
+                        if (curMeterNumber > 0) {
+                            item.meterNumber = curMeterNumber;
+                            item.gathered = &gatherEndUseBEPS(iResource, jEndUse);
+                            BEPSGatherItems.push_back(item);
+
+                            for (kEndUseSub = 1; kEndUseSub <= EndUseCategory(jEndUse).NumSubcategories; ++kEndUseSub) {
+                                curMeterNumber = meterNumEndUseSubBEPS(kEndUseSub, jEndUse, iResource);
+                                if (curMeterNumber > 0) {
+                                    item.meterNumber = curMeterNumber;
+                                    item.gathered = &gatherEndUseSubBEPS(kEndUseSub, jEndUse, iResource);
+                                    BEPSGatherItems.push_back(item);
+                                }
                             }
                         }
                     }
                 }
-            }
 
-            for (iResource = 1; iResource <= numSourceTypes; ++iResource) {
-                curMeterNumber = meterNumTotalsSource(iResource);
-                if (curMeterNumber > 0) {
-                    curMeterValue = GetCurrentMeterValue(curMeterNumber);
-                    gatherTotalsSource(iResource) += curMeterValue;
+                for (iResource = 1; iResource <= numSourceTypes; ++iResource) {
+                    curMeterNumber = meterNumTotalsSource(iResource);
+                    if (curMeterNumber > 0) {
+                        item.meterNumber = curMeterNumber;
+                        item.gathered = &gatherTotalsSource(iResource);
+                        BEPSGatherItems.push_back(item);
+                    }
                 }
+                GatherBEPSResultsForTimestepRunOnce = false;
+            }
+
+            // loop through all of the resources and end uses for the entire facility
+            for (auto const &item : BEPSGatherItems) {
+                *item.gathered += GetCurrentMeterValue(item.meterNumber);
             }
 
             // gather the electric load components
@@ -11212,6 +11355,7 @@ namespace OutputReportTabular {
         //       DATE WRITTEN   August 2006
         //       MODIFIED       January 2010, Kyle Benne; Added SQLite output
         //                      March 2010, Linda Lawrie; Modify SizingPeriod:DesignDay to convert column/humidity types
+        //                      October 2026, index the entries by subtable, object name, column and row
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -11253,8 +11397,10 @@ namespace OutputReportTabular {
         int kColumnTag;
         int lTableEntry;
         int mUnqObjNames;
-        int nColHead;
-        int oRowHead;
+        std::unordered_map<std::string, int> uniqueObjectIndex;  // unique object name index of each object name
+        std::vector<std::vector<int>> subTableEntries;            // table entries of each subtable, in entry order
+        std::vector<int> colTagToColHead;                         // column of the current table of each column tag
+        std::vector<int> unqObjNameToRow;                         // row of the current table of each unique object name
         std::string colTagWithSI;
         std::string curColTag;
         Array1D_int colUnitConv;
@@ -11267,9 +11413,12 @@ namespace OutputReportTabular {
         // list of unique object names
         // Much of this code is to allow for integer compares instead of string
         // compares that are nested three levels in a loop.
+        // The entries of each subtable are collected here as well so that writing a subtable only visits its own entries.
         uniqueObjectName.allocate(numTableEntry);
         useUniqueObjectName.allocate(numTableEntry);
         numUnqObjName = 0;
+        uniqueObjectIndex.reserve(numTableEntry);
+        subTableEntries.resize(numSubTable + 1);
         for (lTableEntry = 1; lTableEntry <= numTableEntry; ++lTableEntry) {
             // associate the subtable with each column
             curColumn = tableEntry(lTableEntry).indexColumn;
@@ -11278,22 +11427,21 @@ namespace OutputReportTabular {
             }
             // make a list of unique object names
             curObjectName = tableEntry(lTableEntry).objectName;
-            found = 0;
-            for (mUnqObjNames = 1; mUnqObjNames <= numUnqObjName; ++mUnqObjNames) {
-                if (curObjectName == uniqueObjectName(mUnqObjNames)) {
-                    found = mUnqObjNames;
-                }
-            }
-            // if found then point to the unique object
-            if (found > 0) {
-                tableEntry(lTableEntry).uniqueObjName = found;
-                // if not found add to the unique object list
-            } else {
+            auto const foundObject(uniqueObjectIndex.emplace(curObjectName, numUnqObjName + 1));
+            // if not found add to the unique object list
+            if (foundObject.second) {
                 ++numUnqObjName;
                 uniqueObjectName(numUnqObjName) = curObjectName;
-                tableEntry(lTableEntry).uniqueObjName = numUnqObjName;
+            }
+            // point to the unique object
+            tableEntry(lTableEntry).uniqueObjName = foundObject.first->second;
+            found = tableEntry(lTableEntry).subTableIndex;
+            if ((found >= 1) && (found <= numSubTable)) {
+                subTableEntries[found].push_back(lTableEntry);
             }
         }
+        colTagToColHead.assign(numColumnTag + 1, 0);
+        unqObjNameToRow.assign(numUnqObjName + 1, 0);
         // loop through all reports and include those that have been flagged as 'show'
         for (iReportName = 1; iReportName <= numReportName; ++iReportName) {
             if (reportName(iReportName).show) {
@@ -11311,10 +11459,8 @@ namespace OutputReportTabular {
                         // determine how many rows by going through table entries and setting
                         // flag in useUniqueObjectName to true, then count number of true's.
                         useUniqueObjectName = false; // array assignment
-                        for (lTableEntry = 1; lTableEntry <= numTableEntry; ++lTableEntry) {
-                            if (tableEntry(lTableEntry).subTableIndex == jSubTable) {
-                                useUniqueObjectName(tableEntry(lTableEntry).uniqueObjName) = true;
-                            }
+                        for (int const iEntry : subTableEntries[jSubTable]) {
+                            useUniqueObjectName(tableEntry(iEntry).uniqueObjName) = true;
                         }
                         curNumRows = 0;
                         for (mUnqObjNames = 1; mUnqObjNames <= numUnqObjName; ++mUnqObjNames) {
@@ -11344,6 +11490,7 @@ namespace OutputReportTabular {
                                 ++countRow;
                                 rowHead(countRow) = uniqueObjectName(mUnqObjNames);
                                 rowToUnqObjName(countRow) = mUnqObjNames;
+                                unqObjNameToRow[mUnqObjNames] = countRow;
                             }
                         }
                         // set column headings
@@ -11365,47 +11512,36 @@ namespace OutputReportTabular {
                                 }
                                 columnHead(countColumn) = curColTag;
                                 colHeadToColTag(countColumn) = kColumnTag;
+                                colTagToColHead[kColumnTag] = countColumn;
                             }
                         }
                         // fill the body of the table from the entries
                         // find the entries associated with the current subtable
-                        for (lTableEntry = 1; lTableEntry <= numTableEntry; ++lTableEntry) {
-                            if (tableEntry(lTableEntry).subTableIndex == jSubTable) {
-                                // determine what column the current entry is in
-                                curColTagIndex = tableEntry(lTableEntry).indexColumn;
-                                for (nColHead = 1; nColHead <= curNumColumns; ++nColHead) {
-                                    if (curColTagIndex == colHeadToColTag(nColHead)) {
-                                        colCurrent = nColHead;
-                                        break;
+                        for (int const iEntry : subTableEntries[jSubTable]) {
+                            // determine what column the current entry is in
+                            curColTagIndex = tableEntry(iEntry).indexColumn;
+                            colCurrent = colTagToColHead[curColTagIndex];
+                            // determine what row the current entry is in
+                            curRowUnqObjIndex = tableEntry(iEntry).uniqueObjName;
+                            rowCurrent = unqObjNameToRow[curRowUnqObjIndex];
+                            // finally assign the entry to the place in the table body
+                            if (unitsStyle == unitsStyleInchPound || unitsStyle == unitsStyleJtoKWH) {
+                                columnUnitConv = colUnitConv(colCurrent);
+                                if (UtilityRoutines::SameString(subTable(jSubTable).name, "SizingPeriod:DesignDay") &&
+                                    unitsStyle == unitsStyleInchPound) {
+                                    if (UtilityRoutines::SameString(columnHead(colCurrent), "Humidity Value")) {
+                                        LookupSItoIP(tableEntry(iEntry + 1).charEntry, columnUnitConv, repTableTag);
+                                        tableEntry(iEntry + 1).charEntry = repTableTag;
                                     }
                                 }
-                                // determine what row the current entry is in
-                                curRowUnqObjIndex = tableEntry(lTableEntry).uniqueObjName;
-                                for (oRowHead = 1; oRowHead <= curNumRows; ++oRowHead) {
-                                    if (curRowUnqObjIndex == rowToUnqObjName(oRowHead)) {
-                                        rowCurrent = oRowHead;
-                                        break;
-                                    }
-                                }
-                                // finally assign the entry to the place in the table body
-                                if (unitsStyle == unitsStyleInchPound || unitsStyle == unitsStyleJtoKWH) {
-                                    columnUnitConv = colUnitConv(colCurrent);
-                                    if (UtilityRoutines::SameString(subTable(jSubTable).name, "SizingPeriod:DesignDay") &&
-                                        unitsStyle == unitsStyleInchPound) {
-                                        if (UtilityRoutines::SameString(columnHead(colCurrent), "Humidity Value")) {
-                                            LookupSItoIP(tableEntry(lTableEntry + 1).charEntry, columnUnitConv, repTableTag);
-                                            tableEntry(lTableEntry + 1).charEntry = repTableTag;
-                                        }
-                                    }
-                                    if (tableEntry(lTableEntry).origEntryIsReal && (columnUnitConv != 0)) {
-                                        IPvalue = ConvertIP(columnUnitConv, tableEntry(lTableEntry).origRealEntry);
-                                        tableBody(colCurrent, rowCurrent) = RealToStr(IPvalue, tableEntry(lTableEntry).significantDigits);
-                                    } else {
-                                        tableBody(colCurrent, rowCurrent) = tableEntry(lTableEntry).charEntry;
-                                    }
+                                if (tableEntry(iEntry).origEntryIsReal && (columnUnitConv != 0)) {
+                                    IPvalue = ConvertIP(columnUnitConv, tableEntry(iEntry).origRealEntry);
+                                    tableBody(colCurrent, rowCurrent) = RealToStr(IPvalue, tableEntry(iEntry).significantDigits);
                                 } else {
-                                    tableBody(colCurrent, rowCurrent) = tableEntry(lTableEntry).charEntry;
+                                    tableBody(colCurrent, rowCurrent) = tableEntry(iEntry).charEntry;
                                 }
+                            } else {
+                                tableBody(colCurrent, rowCurrent) = tableEntry(iEntry).charEntry;
                             }
                         }
                         // create the actual output table
@@ -11432,6 +11568,7 @@ namespace OutputReportTabular {
         //       DATE WRITTEN   July 2007
         //       MODIFIED       January 2010, Kyle Benne
         //                      Added SQLite output
+        //                      October 2026, index the unique descriptions and objects instead of searching them
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -11463,6 +11600,8 @@ namespace OutputReportTabular {
         int foundEntry;
         int foundDesc;
         int foundObj;
+        std::unordered_map<std::string, int> uniqueDescIndex; // column of each description, by upper case description
+        std::unordered_map<std::string, int> uniqueObjIndex;  // row of each object, by upper case name
         int loopLimit;
         int iTableEntry;
         int jUnique;
@@ -11514,34 +11653,20 @@ namespace OutputReportTabular {
                 // reset the counters for the arrays looking for unique rows and columns
                 numUniqueDesc = 0;
                 numUniqueObj = 0;
+                // descriptions and names are compared without regard to case so they are indexed in upper case
+                uniqueDescIndex.clear();
+                uniqueObjIndex.clear();
                 for (iTableEntry = 1; iTableEntry <= numCompSizeTableEntry; ++iTableEntry) {
-                    // search for descriptions
-                    foundDesc = 0;
                     if (CompSizeTableEntry(iTableEntry).active) {
+                        // search for descriptions and add to the list if not found
                         curDesc = CompSizeTableEntry(iTableEntry).description;
-                        // look through the list of unique items to see if it matches
-                        for (jUnique = 1; jUnique <= numUniqueDesc; ++jUnique) {
-                            if (UtilityRoutines::SameString(curDesc, uniqueDesc(jUnique))) {
-                                foundDesc = jUnique;
-                                break;
-                            }
-                        }
-                        // if not found add to the list
-                        if (foundDesc == 0) {
+                        if (uniqueDescIndex.emplace(UtilityRoutines::MakeUPPERCase(curDesc), numUniqueDesc + 1).second) {
                             ++numUniqueDesc;
                             uniqueDesc(numUniqueDesc) = curDesc;
                         }
-                        // search for objects
-                        foundObj = 0;
+                        // search for objects and add to the list if not found
                         curObj = CompSizeTableEntry(iTableEntry).nameField;
-                        for (jUnique = 1; jUnique <= numUniqueObj; ++jUnique) {
-                            if (UtilityRoutines::SameString(curObj, uniqueObj(jUnique))) {
-                                foundObj = jUnique;
-                                break;
-                            }
-                        }
-                        // if not found add to the list
-                        if (foundObj == 0) {
+                        if (uniqueObjIndex.emplace(UtilityRoutines::MakeUPPERCase(curObj), numUniqueObj + 1).second) {
                             ++numUniqueObj;
                             uniqueObj(numUniqueObj) = curObj;
                         }
@@ -11579,22 +11704,10 @@ namespace OutputReportTabular {
                 for (iTableEntry = 1; iTableEntry <= numCompSizeTableEntry; ++iTableEntry) {
                     // find the row and column for the specific entry
                     if (CompSizeTableEntry(iTableEntry).active) {
-                        curDesc = CompSizeTableEntry(iTableEntry).description;
-                        foundDesc = 0;
-                        for (jUnique = 1; jUnique <= numUniqueDesc; ++jUnique) {
-                            if (UtilityRoutines::SameString(uniqueDesc(jUnique), curDesc)) {
-                                foundDesc = jUnique;
-                                break;
-                            }
-                        }
-                        curObj = CompSizeTableEntry(iTableEntry).nameField;
-                        foundObj = 0;
-                        for (jUnique = 1; jUnique <= numUniqueObj; ++jUnique) {
-                            if (UtilityRoutines::SameString(rowHead(jUnique), curObj)) {
-                                foundObj = jUnique;
-                                break;
-                            }
-                        }
+                        auto const descFound(uniqueDescIndex.find(UtilityRoutines::MakeUPPERCase(CompSizeTableEntry(iTableEntry).description)));
+                        foundDesc = (descFound != uniqueDescIndex.end()) ? descFound->second : 0;
+                        auto const objFound(uniqueObjIndex.find(UtilityRoutines::MakeUPPERCase(CompSizeTableEntry(iTableEntry).nameField)));
+                        foundObj = (objFound != uniqueObjIndex.end()) ? objFound->second : 0;
                         if ((foundDesc >= 1) && (foundObj >= 1)) {
                             curValueSI = CompSizeTableEntry(iTableEntry).valField;
                             if (unitsStyle == unitsStyleInchPound) {
@@ -11824,7 +11937,8 @@ namespace OutputReportTabular {
     void WriteEioTables()
     {
 
-        if (displayEioSummary) {
+        // the summary is read back from the eio file, so there is nothing to show when it was not written
+        if (displayEioSummary && !DataSystemVariables::SuppressEioOutput) {
             Array1D_string columnHead;
             Array1D_int columnWidth;
             Array1D_string rowHead;
@@ -14242,37 +14356,14 @@ namespace OutputReportTabular {
         }
     }
 
-    void WriteReportHeaders(std::string const &reportName, std::string const &objectName, OutputProcessor::StoreType const averageOrSum)
-    {
-        // SUBROUTINE INFORMATION:
-        //       AUTHOR         Jason Glazer
-        //       DATE WRITTEN   August 2003
-        //       MODIFIED       na
-        //       RE-ENGINEERED  na
-
-        // PURPOSE OF THIS SUBROUTINE:
-        //   Write the first few lines of each report with headers to the output
-        //   file for tabular reports.
-        // Using/Aliasing
-        using DataHeatBalance::BuildingName;
-        using DataStringGlobals::VerString;
-
-        // Locals
-        // SUBROUTINE ARGUMENT DEFINITIONS:
-
-        // SUBROUTINE PARAMETER DEFINITIONS:
-
-        // INTERFACE BLOCK SPECIFICATIONS:
-        // na
-
-        // DERIVED TYPE DEFINITIONS:
-        // na
-
-        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+    namespace {
 
-        std::string const modifiedReportName(reportName + (averageOrSum == OutputProcessor::StoreType::Summed ? " per second" : ""));
+        void RenderReportHeaders(int const iStyle, TabularItem const &item, TabularRenderState &state)
+        {
+            std::string const &reportName(item.text);
+            std::string const &objectName(item.objectName);
+            std::string const &modifiedReportName(item.modifiedReportName);
 
-        for (int iStyle = 1; iStyle <= numStyles; ++iStyle) {
             std::ostream &tbl_stream(*TabularOutputFile(iStyle));
             std::string const &curDel(del(iStyle));
             auto const style(TableStyle(iStyle));
@@ -14295,48 +14386,25 @@ namespace OutputReportTabular {
                 tbl_stream << "    " << std::setw(2) << td(5) << ':' << std::setw(2) << td(6) << ':' << std::setw(2) << td(7) << std::setfill(' ')
                            << "</b></p>\n";
             } else if (style == tableStyleXML) {
-                if (len(prevReportName) != 0) {
-                    tbl_stream << "</" << prevReportName << ">\n"; // close the last element if it was used.
+                if (len(state.prevReportName) != 0) {
+                    tbl_stream << "</" << state.prevReportName << ">\n"; // close the last element if it was used.
                 }
                 tbl_stream << "<" << ConvertToElementTag(modifiedReportName) << ">\n";
                 tbl_stream << "  <for>" << objectName << "</for>\n";
-                prevReportName = ConvertToElementTag(modifiedReportName); // save the name for next time
+                state.prevReportName = ConvertToElementTag(modifiedReportName); // save the name for next time
             }
+            // clear the active subtable name for the XML reporting
+            state.activeSubTableName = "";
+            // save the report name if the subtable name is not available during XML processing
+            state.activeReportName = modifiedReportName;
+            // save the "for" which is the object name in the report for HTML comment that contains the report, for, and subtable
+            state.activeForName = objectName;
         }
-        // clear the active subtable name for the XML reporting
-        activeSubTableName = "";
-        // save the report name if the subtable name is not available during XML processing
-        activeReportName = modifiedReportName;
-        // save the "for" which is the object name in the report for HTML comment that contains the report, for, and subtable
-        activeForName = objectName;
-    }
 
-    void WriteSubtitle(std::string const &subtitle)
-    {
-        // SUBROUTINE INFORMATION:
-        //       AUTHOR         Jason Glazer
-        //       DATE WRITTEN   November 2003
-        //       MODIFIED       na
-        //       RE-ENGINEERED  na
-
-        // PURPOSE OF THIS SUBROUTINE:
-        //   Insert a subtitle into the current report
-
-        // Locals
-        // SUBROUTINE ARGUMENT DEFINITIONS:
-
-        // SUBROUTINE PARAMETER DEFINITIONS:
-
-        // INTERFACE BLOCK SPECIFICATIONS:
-        // na
-
-        // DERIVED TYPE DEFINITIONS:
-        // na
-
-        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        int iStyle;
+        void RenderSubtitle(int const iStyle, TabularItem const &item, TabularRenderState &state)
+        {
+            std::string const &subtitle(item.text);
 
-        for (iStyle = 1; iStyle <= numStyles; ++iStyle) {
             auto const style(TableStyle(iStyle));
             if ((style == tableStyleComma) || (style == tableStyleTab) || (style == tableStyleFixed)) {
                 std::ostream &tbl_stream(*TabularOutputFile(iStyle));
@@ -14344,48 +14412,19 @@ namespace OutputReportTabular {
             } else if (style == tableStyleHTML) {
                 std::ostream &tbl_stream(*TabularOutputFile(iStyle));
                 tbl_stream << "<b>" << subtitle << "</b><br><br>\n";
-                tbl_stream << "<!-- FullName:" << activeReportName << '_' << activeForName << '_' << subtitle << "-->\n";
+                tbl_stream << "<!-- FullName:" << state.activeReportName << '_' << state.activeForName << '_' << subtitle << "-->\n";
             } else if (style == tableStyleXML) {
                 // save the active subtable name for the XML reporting
-                activeSubTableName = subtitle;
+                state.activeSubTableName = subtitle;
                 // no other output is needed since WriteTable uses the subtable name for each record.
             }
         }
-    }
-
-    void WriteTextLine(std::string const &lineOfText, Optional_bool_const isBold)
-    {
-        // SUBROUTINE INFORMATION:
-        //       AUTHOR         Jason Glazer
-        //       DATE WRITTEN   April 2007
-        //       MODIFIED       na
-        //       RE-ENGINEERED  na
-
-        // PURPOSE OF THIS SUBROUTINE:
-        //   Insert a subtitle into the current report
-
-        // Locals
-        // SUBROUTINE ARGUMENT DEFINITIONS:
-
-        // SUBROUTINE PARAMETER DEFINITIONS:
-
-        // INTERFACE BLOCK SPECIFICATIONS:
-        // na
 
-        // DERIVED TYPE DEFINITIONS:
-        // na
-
-        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        int iStyle;
-        bool useBold;
-
-        if (present(isBold)) {
-            useBold = isBold;
-        } else {
-            useBold = false;
-        }
+        void RenderTextLine(int const iStyle, TabularItem const &item)
+        {
+            std::string const &lineOfText(item.text);
+            bool const useBold(item.option);
 
-        for (iStyle = 1; iStyle <= numStyles; ++iStyle) {
             auto const style(TableStyle(iStyle));
             if ((style == tableStyleComma) || (style == tableStyleTab) || (style == tableStyleFixed)) {
                 std::ostream &tbl_stream(*TabularOutputFile(iStyle));
@@ -14404,122 +14443,59 @@ namespace OutputReportTabular {
                 }
             }
         }
-    }
 
-    void WriteTable(Array2S_string const body, // row,column
-                    Array1S_string const rowLabels,
-                    Array1S_string const columnLabels,
-                    Array1S_int widthColumn,
-                    Optional_bool_const transposeXML,
-                    Optional_string_const footnoteText)
-    {
-        // SUBROUTINE INFORMATION:
-        //       AUTHOR         Jason Glazer
-        //       DATE WRITTEN   August 2003
-        //       MODIFIED       na
-        //       RE-ENGINEERED  na
-
-        // PURPOSE OF THIS SUBROUTINE:
-        //   Output a table to the tabular output file in the selected
-        //   style (comma, tab, space, html, xml).
-        //   The widthColumn array is only used for fixed space formatted reports
-        //   if columnLables contain a vertical bar '|', they are broken into multiple
-        //   rows.  If they exceed the column width even after that and the format is
-        //   fixed, they are further shortened.
-        //   To include the currency symbol ($ by default but other symbols if the user
-        //   has input it with Economics:CurrencyType) use the string ~~$~~ in the row
-        //   headers, column headers, and body. For HTML files, the ASCII or UNICODE
-        //   symbol for the currency will be included. For TXT files, the ASCII symbol
-        //   will be used.
-
-        // Argument array dimensioning
-
-        // Locals
-        // SUBROUTINE ARGUMENT DEFINITIONS:
-
-        // SUBROUTINE PARAMETER DEFINITIONS:
-        static std::string const blank;
-
-        // INTERFACE BLOCK SPECIFICATIONS:
-        // na
-
-        // DERIVED TYPE DEFINITIONS:
-        // na
-
-        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        Array2D_string colLabelMulti;
-        std::string workColumn;
-        Array1D_string rowLabelTags;
-        Array1D_string columnLabelTags;
-        Array1D_string rowUnitStrings;
-        Array1D_string columnUnitStrings;
-        Array2D_string bodyEsc;
-
-        int numColLabelRows;
-        int maxNumColLabelRows;
-        std::string::size_type widthRowLabel;
-        std::string::size_type maxWidthRowLabel;
-
-        int rowsBody;
-        int colsBody;
-        int colsColumnLabels;
-        int colsWidthColumn;
-        int rowsRowLabels;
-
-        int iCol;
-        int jRow;
-        int colWidthLimit;
-        std::string::size_type barLoc;
-
-        std::string outputLine;
-        std::string spaces;
-        int iStyle;
-        std::string curDel;
-        std::string tagWithAttrib;
-        std::string::size_type col1start;
-        bool doTransposeXML;
-        bool isTableBlank;
-        bool isRecordBlank;
-
-        if (present(transposeXML)) {
-            doTransposeXML = transposeXML;
-        } else {
-            doTransposeXML = false; // if not present assume that the XML table should not be transposed
-        }
-        // create blank string
-        spaces = blank; // REPEAT(' ',1000)
-        // get sizes of arrays
-        rowsBody = isize(body, 2);
-        colsBody = isize(body, 1);
-        rowsRowLabels = isize(rowLabels);
-        colsColumnLabels = isize(columnLabels);
-        colsWidthColumn = isize(widthColumn);
-        // check size of arrays for consistancy and if inconsistent use smaller value
-        // and display warning
-        if (rowsBody != rowsRowLabels) {
-            ShowWarningError("REPORT:TABLE Inconsistant number of rows.");
-            rowsBody = min(rowsBody, rowsRowLabels);
-            rowsRowLabels = rowsBody;
-        }
-        if ((colsBody != colsColumnLabels) || (colsBody != colsWidthColumn)) {
-            ShowWarningError("REPORT:TABLE Inconsistant number of columns.");
-            colsBody = min(colsBody, min(colsColumnLabels, colsWidthColumn));
-            colsWidthColumn = colsBody;
-            colsColumnLabels = colsBody;
-        }
-        // create arrays to hold the XML tags
-        rowLabelTags.allocate(rowsBody);
-        columnLabelTags.allocate(colsBody);
-        rowUnitStrings.allocate(rowsBody);
-        columnUnitStrings.allocate(colsBody);
-        bodyEsc.allocate(colsBody, rowsBody);
-        // create new array to hold multiple line column lables
-        colLabelMulti.allocate(colsColumnLabels, 50);
-        colLabelMulti = blank; // set array to blank
-        numColLabelRows = 0;   // default value
-        maxNumColLabelRows = 0;
+        void RenderTable(int const iStyle, TabularItem const &item, TabularRenderState &state)
+        {
+            static std::string const blank;
+
+            Array2D_string const &body(item.body); // column,row
+            Array1D_string const &rowLabels(item.rowLabels);
+            Array1D_string const &columnLabels(item.columnLabels);
+            Array1D_int const &widthColumn(item.widthColumn);
+            std::string const &footnoteText(item.text);
+            int const rowsBody(isize(rowLabels));
+            int const colsBody(isize(columnLabels));
+            int const rowsRowLabels(rowsBody);
+            int const colsColumnLabels(colsBody);
+
+            Array2D_string colLabelMulti;
+            std::string workColumn;
+            Array1D_string rowLabelTags;
+            Array1D_string columnLabelTags;
+            Array1D_string rowUnitStrings;
+            Array1D_string columnUnitStrings;
+            Array2D_string bodyEsc;
+
+            int numColLabelRows;
+            int maxNumColLabelRows;
+            std::string::size_type widthRowLabel;
+            std::string::size_type maxWidthRowLabel;
+
+            int iCol;
+            int jRow;
+            int colWidthLimit;
+            std::string::size_type barLoc;
+
+            std::string outputLine;
+            std::string curDel;
+            std::string tagWithAttrib;
+            std::string::size_type col1start;
+            bool doTransposeXML(item.option);
+            bool isTableBlank;
+            bool isRecordBlank;
+
+            // create arrays to hold the XML tags
+            rowLabelTags.allocate(rowsBody);
+            columnLabelTags.allocate(colsBody);
+            rowUnitStrings.allocate(rowsBody);
+            columnUnitStrings.allocate(colsBody);
+            bodyEsc.allocate(colsBody, rowsBody);
+            // create new array to hold multiple line column lables
+            colLabelMulti.allocate(colsColumnLabels, 50);
+            colLabelMulti = blank; // set array to blank
+            numColLabelRows = 0;   // default value
+            maxNumColLabelRows = 0;
 
-        for (iStyle = 1; iStyle <= numStyles; ++iStyle) {
             std::ostream &tbl_stream(*TabularOutputFile(iStyle));
             curDel = del(iStyle);
             // go through the columns and break them into multiple lines
@@ -14528,7 +14504,6 @@ namespace OutputReportTabular {
             for (iCol = 1; iCol <= colsColumnLabels; ++iCol) {
                 numColLabelRows = 0;
                 workColumn = columnLabels(iCol);
-                widthColumn(iCol) = max(widthColumn(iCol), static_cast<int>(len(columnLabels(iCol))));
                 while (true) {
                     barLoc = index(workColumn, '|');
                     if (barLoc != std::string::npos) {
@@ -14582,10 +14557,8 @@ namespace OutputReportTabular {
                     }
                     tbl_stream << InsertCurrencySymbol(outputLine, false) << '\n';
                 }
-                if (present(footnoteText)) {
-                    if (!footnoteText().empty()) {
-                        tbl_stream << footnoteText() << '\n';
-                    }
+                if (!footnoteText.empty()) {
+                    tbl_stream << footnoteText << '\n';
                 }
                 tbl_stream << "\n\n";
 
@@ -14616,10 +14589,8 @@ namespace OutputReportTabular {
                     }
                     tbl_stream << InsertCurrencySymbol(outputLine, false) << '\n';
                 }
-                if (present(footnoteText)) {
-                    if (!footnoteText().empty()) {
-                        tbl_stream << footnoteText() << '\n';
-                    }
+                if (!footnoteText.empty()) {
+                    tbl_stream << footnoteText << '\n';
                 }
                 tbl_stream << "\n\n";
 
@@ -14658,13 +14629,12 @@ namespace OutputReportTabular {
                 }
                 // end the table
                 tbl_stream << "</table>\n";
-                if (present(footnoteText)) {
-                    if (!footnoteText().empty()) {
-                        tbl_stream << "<i>" << footnoteText() << "</i>\n";
-                    }
+                if (!footnoteText.empty()) {
+                    tbl_stream << "<i>" << footnoteText << "</i>\n";
                 }
                 tbl_stream << "<br><br>\n";
             } else if (style == tableStyleXML) {
+                std::string reportNameNoSpace;
                 // check if entire table is blank and it if is skip generating anything
                 isTableBlank = true;
                 for (jRow = 1; jRow <= rowsBody; ++jRow) {
@@ -14679,14 +14649,14 @@ namespace OutputReportTabular {
                 // if non-blank cells in the table body were found create the table.
                 if (!isTableBlank) {
                     // if report name and subtable name the same add "record" to the end
-                    activeSubTableName = ConvertToElementTag(activeSubTableName);
-                    activeReportNameNoSpace = ConvertToElementTag(activeReportName);
-                    if (UtilityRoutines::SameString(activeSubTableName, activeReportNameNoSpace)) {
-                        activeSubTableName += "Record";
+                    state.activeSubTableName = ConvertToElementTag(state.activeSubTableName);
+                    reportNameNoSpace = ConvertToElementTag(state.activeReportName);
+                    if (UtilityRoutines::SameString(state.activeSubTableName, reportNameNoSpace)) {
+                        state.activeSubTableName += "Record";
                     }
                     // if no subtable name use the report name and add "record" to the end
-                    if (len(activeSubTableName) == 0) {
-                        activeSubTableName = activeReportNameNoSpace + "Record";
+                    if (len(state.activeSubTableName) == 0) {
+                        state.activeSubTableName = reportNameNoSpace + "Record";
                     }
                     // if a single column table, transpose it automatically
                     if ((colsBody == 1) && (rowsBody > 1)) {
@@ -14731,7 +14701,7 @@ namespace OutputReportTabular {
                                 }
                             }
                             if (!isRecordBlank) {
-                                tbl_stream << "  <" << activeSubTableName << ">\n";
+                                tbl_stream << "  <" << state.activeSubTableName << ">\n";
                                 if (len(rowLabelTags(jRow)) > 0) {
                                     tbl_stream << "    <name>" << rowLabelTags(jRow) << "</name>\n";
                                 }
@@ -14748,7 +14718,7 @@ namespace OutputReportTabular {
                                                    << ">\n";
                                     }
                                 }
-                                tbl_stream << "  </" << activeSubTableName << ">\n";
+                                tbl_stream << "  </" << state.activeSubTableName << ">\n";
                             }
                         }
                     } else { // transpose XML table
@@ -14763,7 +14733,7 @@ namespace OutputReportTabular {
                                 }
                             }
                             if (!isRecordBlank) {
-                                tbl_stream << "  <" << activeSubTableName << ">\n";
+                                tbl_stream << "  <" << state.activeSubTableName << ">\n";
                                 // if the column has units put them into the name tag
                                 if (len(columnLabelTags(iCol)) > 0) {
                                     if (len(columnUnitStrings(iCol)) > 0) {
@@ -14785,19 +14755,229 @@ namespace OutputReportTabular {
                                         tbl_stream << "    " << tagWithAttrib << stripped(bodyEsc(iCol, jRow)) << "</" << rowLabelTags(jRow) << ">\n";
                                     }
                                 }
-                                tbl_stream << "  </" << activeSubTableName << ">\n";
+                                tbl_stream << "  </" << state.activeSubTableName << ">\n";
                             }
                         }
                     }
-                    if (present(footnoteText)) {
-                        if (!footnoteText().empty()) {
-                            tbl_stream << "  <footnote>" << footnoteText() << "</footnote>\n";
-                        }
+                    if (!footnoteText.empty()) {
+                        tbl_stream << "  <footnote>" << footnoteText << "</footnote>\n";
                     }
                 }
-            } else {
             }
         }
+
+    } // namespace
+
+    void WriteReportHeaders(std::string const &reportName, std::string const &objectName, OutputProcessor::StoreType const averageOrSum)
+    {
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         Jason Glazer
+        //       DATE WRITTEN   August 2003
+        //       MODIFIED       October 2026, recorded for rendering at CloseOutputTabularFile
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        //   Write the first few lines of each report with headers to the output
+        //   file for tabular reports.
+        // Using/Aliasing
+        using DataHeatBalance::BuildingName;
+        using DataStringGlobals::VerString;
+
+        // Locals
+        // SUBROUTINE ARGUMENT DEFINITIONS:
+
+        // SUBROUTINE PARAMETER DEFINITIONS:
+
+        // INTERFACE BLOCK SPECIFICATIONS:
+        // na
+
+        // DERIVED TYPE DEFINITIONS:
+        // na
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+
+        std::string const modifiedReportName(reportName + (averageOrSum == OutputProcessor::StoreType::Summed ? " per second" : ""));
+
+        if (numStyles > 0) {
+            TabularItems.emplace_back();
+            TabularItem &item(TabularItems.back());
+            item.kind = TabularItem::Kind::ReportHeaders;
+            item.text = reportName;
+            item.objectName = objectName;
+            item.modifiedReportName = modifiedReportName;
+        }
+        // clear the active subtable name for the XML reporting
+        activeSubTableName = "";
+        // save the report name if the subtable name is not available during XML processing
+        activeReportName = modifiedReportName;
+        // save the "for" which is the object name in the report for HTML comment that contains the report, for, and subtable
+        activeForName = objectName;
+    }
+
+    void WriteSubtitle(std::string const &subtitle)
+    {
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         Jason Glazer
+        //       DATE WRITTEN   November 2003
+        //       MODIFIED       October 2026, recorded for rendering at CloseOutputTabularFile
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        //   Insert a subtitle into the current report
+
+        // Locals
+        // SUBROUTINE ARGUMENT DEFINITIONS:
+
+        // SUBROUTINE PARAMETER DEFINITIONS:
+
+        // INTERFACE BLOCK SPECIFICATIONS:
+        // na
+
+        // DERIVED TYPE DEFINITIONS:
+        // na
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+
+        if (numStyles > 0) {
+            TabularItems.emplace_back();
+            TabularItem &item(TabularItems.back());
+            item.kind = TabularItem::Kind::Subtitle;
+            item.text = subtitle;
+        }
+        // save the active subtable name for the XML reporting
+        activeSubTableName = subtitle;
+    }
+
+    void WriteTextLine(std::string const &lineOfText, Optional_bool_const isBold)
+    {
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         Jason Glazer
+        //       DATE WRITTEN   April 2007
+        //       MODIFIED       October 2026, recorded for rendering at CloseOutputTabularFile
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        //   Insert a subtitle into the current report
+
+        // Locals
+        // SUBROUTINE ARGUMENT DEFINITIONS:
+
+        // SUBROUTINE PARAMETER DEFINITIONS:
+
+        // INTERFACE BLOCK SPECIFICATIONS:
+        // na
+
+        // DERIVED TYPE DEFINITIONS:
+        // na
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+        bool useBold;
+
+        if (present(isBold)) {
+            useBold = isBold;
+        } else {
+            useBold = false;
+        }
+
+        if (numStyles > 0) {
+            TabularItems.emplace_back();
+            TabularItem &item(TabularItems.back());
+            item.kind = TabularItem::Kind::TextLine;
+            item.text = lineOfText;
+            item.option = useBold;
+        }
+    }
+
+    void WriteTable(Array2S_string const body, // row,column
+                    Array1S_string const rowLabels,
+                    Array1S_string const columnLabels,
+                    Array1S_int widthColumn,
+                    Optional_bool_const transposeXML,
+                    Optional_string_const footnoteText)
+    {
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         Jason Glazer
+        //       DATE WRITTEN   August 2003
+        //       MODIFIED       October 2026, recorded for rendering at CloseOutputTabularFile
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        //   Output a table to the tabular output file in the selected
+        //   style (comma, tab, space, html, xml).
+        //   The widthColumn array is only used for fixed space formatted reports
+        //   if columnLables contain a vertical bar '|', they are broken into multiple
+        //   rows.  If they exceed the column width even after that and the format is
+        //   fixed, they are further shortened.
+        //   To include the currency symbol ($ by default but other symbols if the user
+        //   has input it with Economics:CurrencyType) use the string ~~$~~ in the row
+        //   headers, column headers, and body. For HTML files, the ASCII or UNICODE
+        //   symbol for the currency will be included. For TXT files, the ASCII symbol
+        //   will be used.
+
+        // Argument array dimensioning
+
+        // Locals
+        // SUBROUTINE ARGUMENT DEFINITIONS:
+
+        // SUBROUTINE PARAMETER DEFINITIONS:
+
+        // INTERFACE BLOCK SPECIFICATIONS:
+        // na
+
+        // DERIVED TYPE DEFINITIONS:
+        // na
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+        int rowsBody;
+        int colsBody;
+        int colsColumnLabels;
+        int colsWidthColumn;
+        int rowsRowLabels;
+
+        // get sizes of arrays
+        rowsBody = isize(body, 2);
+        colsBody = isize(body, 1);
+        rowsRowLabels = isize(rowLabels);
+        colsColumnLabels = isize(columnLabels);
+        colsWidthColumn = isize(widthColumn);
+        // check size of arrays for consistancy and if inconsistent use smaller value
+        // and display warning
+        if (rowsBody != rowsRowLabels) {
+            ShowWarningError("REPORT:TABLE Inconsistant number of rows.");
+            rowsBody = min(rowsBody, rowsRowLabels);
+            rowsRowLabels = rowsBody;
+        }
+        if ((colsBody != colsColumnLabels) || (colsBody != colsWidthColumn)) {
+            ShowWarningError("REPORT:TABLE Inconsistant number of columns.");
+            colsBody = min(colsBody, min(colsColumnLabels, colsWidthColumn));
+            colsWidthColumn = colsBody;
+            colsColumnLabels = colsBody;
+        }
+        // the column widths are only used by the fixed style but callers see the widths widened to the column labels
+        for (int iCol = 1; iCol <= colsColumnLabels; ++iCol) {
+            widthColumn(iCol) = max(widthColumn(iCol), static_cast<int>(len(columnLabels(iCol))));
+        }
+        if (numStyles == 0) return;
+
+        TabularItems.emplace_back();
+        TabularItem &item(TabularItems.back());
+        item.kind = TabularItem::Kind::Table;
+        item.option = present(transposeXML) && transposeXML(); // if not present assume that the XML table should not be transposed
+        if (present(footnoteText)) item.text = footnoteText();
+        item.body.allocate(colsBody, rowsBody);
+        item.rowLabels.allocate(rowsBody);
+        item.columnLabels.allocate(colsBody);
+        item.widthColumn.allocate(colsBody);
+        for (int jRow = 1; jRow <= rowsBody; ++jRow) {
+            item.rowLabels(jRow) = rowLabels(jRow);
+            for (int iCol = 1; iCol <= colsBody; ++iCol) {
+                item.body(iCol, jRow) = body(iCol, jRow);
+            }
+        }
+        for (int iCol = 1; iCol <= colsBody; ++iCol) {
+            item.columnLabels(iCol) = columnLabels(iCol);
+            item.widthColumn(iCol) = widthColumn(iCol);
+        }
     }
 
     std::string MakeAnchorName(std::string const &reportString, std::string const &objectString)
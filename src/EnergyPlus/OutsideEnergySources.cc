@@ -63,6 +63,7 @@
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <EMSManager.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
 #include <GlobalNames.hh>
@@ -355,6 +356,16 @@ namespace OutsideEnergySources {
                                 "System",
                                 "Average",
                                 this->Name);
+            if (DataGlobals::AnyEnergyManagementSystemInModel) {
+                SetupEMSActuator(
+                    "District" + heatingOrCooling, this->Name, "Capacity", "[W]", this->EMSOverrideOnCapacity, this->EMSOverrideValueCapacity);
+                SetupEMSActuator("District" + heatingOrCooling,
+                                 this->Name,
+                                 "Outlet Temperature",
+                                 "[C]",
+                                 this->EMSOverrideOnOutletTemp,
+                                 this->EMSOverrideValueOutletTemp);
+            }
         }
 
         //}
@@ -477,6 +488,7 @@ namespace OutsideEnergySources {
         //       AUTHOR         Dan Fisher
         //       DATE WRITTEN   July 1998
         //       MODIFIED       May 2010; Edwin Lee; Linda Lawrie (consolidation)
+        //                      October 2026, EMS capacity and outlet temperature actuators
         //       RE-ENGINEERED  Sept 2010, Brent Griffith, plant rewrite
 
          // SUBROUTINE PARAMETER DEFINITIONS:
@@ -489,10 +501,16 @@ namespace OutsideEnergySources {
 
         Real64 const Cp = FluidProperties::GetSpecificHeatGlycol(DataPlant::PlantLoop(LoopNum).FluidName, this->InletTemp, DataPlant::PlantLoop(LoopNum).FluidIndex, RoutineName);
 
+        // an actuated outlet temperature replaces the load requested by the loop with the load that delivers it
+        if (this->EMSOverrideOnOutletTemp && (this->MassFlowRate > 0.0)) {
+            MyLoad = this->MassFlowRate * Cp * (this->EMSOverrideValueOutletTemp - this->InletTemp);
+        }
+
         //  apply power limit from input
         Real64 CapFraction = ScheduleManager::GetCurrentScheduleValue(this->CapFractionSchedNum);
         CapFraction = max(0.0, CapFraction); // ensure non negative
-        Real64 const CurrentCap = this->NomCap * CapFraction;
+        Real64 CurrentCap = this->NomCap * CapFraction;
+        if (this->EMSOverrideOnCapacity) CurrentCap = max(0.0, this->EMSOverrideValueCapacity);
         if (std::abs(MyLoad) > CurrentCap) {
             MyLoad = sign(CurrentCap, MyLoad);
         }
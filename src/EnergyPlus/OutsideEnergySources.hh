@@ -87,6 +87,11 @@ namespace OutsideEnergySources {
         Real64 MassFlowRate = 0.0;
         Real64 InletTemp = 0.0;
         Real64 OutletTemp = 0.0;
+        // EMS actuators, so the state of a central plant simulated elsewhere can be imposed on this building
+        bool EMSOverrideOnCapacity = false;      // true if the EMS is overriding the available capacity
+        Real64 EMSOverrideValueCapacity = 0.0;   // available capacity from the EMS [W]
+        bool EMSOverrideOnOutletTemp = false;    // true if the EMS is overriding the supply temperature
+        Real64 EMSOverrideValueOutletTemp = 0.0; // supply temperature from the EMS [C]
 
         OutsideEnergySourceSpecs() = default;
 
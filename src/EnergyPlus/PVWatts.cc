@@ -48,6 +48,7 @@
 // C++ Headers
 #include <math.h>
 #include <stdexcept>
+#include <vector>
 
 // ObjexxFCL Headers
 
@@ -71,6 +72,42 @@ namespace PVWatts {
 
     std::map<int, PVWattsGenerator> PVWattsGenerators;
 
+    namespace {
+        // Plane of array irradiance already calculated this time step. Arrays with the same
+        // orientation and tracking see the same irradiance, so it is calculated once for them.
+        struct IrradianceCacheEntry
+        {
+            // Members
+            int year;
+            int month;
+            int day;
+            int hour;
+            Real64 minute;
+            Real64 ts_hour;
+            Real64 lat;
+            Real64 lon;
+            Real64 tz;
+            Real64 dn;
+            Real64 df;
+            Real64 alb;
+            int trackMode;
+            Real64 tilt;
+            Real64 azimuth;
+            int shadeMode1x;
+            Real64 groundCoverageRatio;
+            IrradianceOutput out;
+
+            // Default Constructor
+            IrradianceCacheEntry()
+                : year(0), month(0), day(0), hour(0), minute(0.0), ts_hour(0.0), lat(0.0), lon(0.0), tz(0.0), dn(0.0), df(0.0), alb(0.0), trackMode(0), tilt(0.0), azimuth(0.0),
+                  shadeMode1x(0), groundCoverageRatio(0.0), out()
+            {
+            }
+        };
+
+        std::vector<IrradianceCacheEntry> irradianceCache;
+    } // namespace
+
     PVWattsGenerator::PVWattsGenerator(const std::string &name,
                                        const Real64 dcSystemCapacity,
                                        ModuleType moduleType,
@@ -439,6 +476,22 @@ namespace PVWatts {
         using DataGlobals::HourOfDay;
         using DataGlobals::TimeStep;
 
+        // the cached irradiance is only reused for the same time, location and sky
+        if (!irradianceCache.empty()) {
+            IrradianceCacheEntry const &first = irradianceCache.front();
+            if (first.year != year || first.month != month || first.day != day || first.hour != hour || first.minute != minute ||
+                first.ts_hour != ts_hour || first.lat != lat || first.lon != lon || first.tz != tz || first.dn != dn || first.df != df ||
+                first.alb != alb) {
+                irradianceCache.clear();
+            }
+        }
+        for (IrradianceCacheEntry const &cached : irradianceCache) {
+            if (cached.trackMode == m_trackMode && cached.tilt == m_tilt && cached.azimuth == m_azimuth && cached.shadeMode1x == m_shadeMode1x &&
+                cached.groundCoverageRatio == m_groundCoverageRatio) {
+                return cached.out;
+            }
+        }
+
         irrad irr;
         irr.set_time(year, month, day, hour, minute, ts_hour);
         irr.set_location(lat, lon, tz);
@@ -456,6 +509,27 @@ namespace PVWatts {
         irr.get_angles(&out.aoi, &out.stilt, &out.sazi, &out.rot, &out.btd);
         irr.get_poa(&out.ibeam, &out.iskydiff, &out.ignddiff, 0, 0, 0);
 
+        IrradianceCacheEntry entry;
+        entry.year = year;
+        entry.month = month;
+        entry.day = day;
+        entry.hour = hour;
+        entry.minute = minute;
+        entry.ts_hour = ts_hour;
+        entry.lat = lat;
+        entry.lon = lon;
+        entry.tz = tz;
+        entry.dn = dn;
+        entry.df = df;
+        entry.alb = alb;
+        entry.trackMode = m_trackMode;
+        entry.tilt = m_tilt;
+        entry.azimuth = m_azimuth;
+        entry.shadeMode1x = m_shadeMode1x;
+        entry.groundCoverageRatio = m_groundCoverageRatio;
+        entry.out = out;
+        irradianceCache.push_back(entry);
+
         return out;
     }
 
@@ -580,6 +654,7 @@ namespace PVWatts {
     void clear_state()
     {
         PVWattsGenerators.clear();
+        irradianceCache.clear();
     }
 
 } // namespace PVWatts
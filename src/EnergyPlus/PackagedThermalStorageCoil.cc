@@ -46,6 +46,7 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
@@ -167,6 +168,53 @@ namespace PackagedThermalStorageCoil {
     // Object Data
     Array1D<PackagedTESCoolingCoilStruct> TESCoil;
 
+    namespace {
+        // The curves that depend on the storage state are evaluated with the state at the end of the last time step,
+        // so every part load iteration of a system time step repeats their arguments.  Each coil keeps the last
+        // evaluation of each of these curves and returns it while the arguments are unchanged, leaving the curve
+        // report variables as a new evaluation would.  Curves under EMS override are always evaluated.
+        Real64 StorageCurveValue(
+            int const TESCoilNum, int const CurveIndex, int const NumVars, Real64 const Var1, Real64 const Var2, Real64 const Var3)
+        {
+            auto &Coil(TESCoil(TESCoilNum));
+            auto &curve(CurveManager::PerfCurve(CurveIndex));
+            if (curve.EMSOverrideOn) {
+                return (NumVars == 2) ? CurveManager::CurveValue(CurveIndex, Var1, Var2) : CurveManager::CurveValue(CurveIndex, Var1, Var2, Var3);
+            }
+
+            auto memo = std::find_if(Coil.StorageCurveMemos.begin(), Coil.StorageCurveMemos.end(), [CurveIndex](StorageCurveMemoData const &m) {
+                return m.CurveIndex == CurveIndex;
+            });
+            if (memo == Coil.StorageCurveMemos.end()) {
+                Coil.StorageCurveMemos.emplace_back();
+                memo = Coil.StorageCurveMemos.end() - 1;
+            } else if (memo->Var1 == Var1 && memo->Var2 == Var2 && memo->Var3 == Var3) {
+                curve.CurveOutput = memo->Value;
+                curve.CurveInput1 = Var1;
+                curve.CurveInput2 = Var2;
+                if (NumVars == 3) curve.CurveInput3 = Var3;
+                return memo->Value;
+            }
+
+            memo->CurveIndex = CurveIndex;
+            memo->Var1 = Var1;
+            memo->Var2 = Var2;
+            memo->Var3 = Var3;
+            memo->Value = (NumVars == 2) ? CurveManager::CurveValue(CurveIndex, Var1, Var2) : CurveManager::CurveValue(CurveIndex, Var1, Var2, Var3);
+            return memo->Value;
+        }
+
+        Real64 StorageCurveValue(int const TESCoilNum, int const CurveIndex, Real64 const Var1, Real64 const Var2, Real64 const Var3)
+        {
+            return StorageCurveValue(TESCoilNum, CurveIndex, 3, Var1, Var2, Var3);
+        }
+
+        Real64 StorageCurveValue(int const TESCoilNum, int const CurveIndex, Real64 const Var1, Real64 const Var2)
+        {
+            return StorageCurveValue(TESCoilNum, CurveIndex, 2, Var1, Var2, 0.0);
+        }
+    } // namespace
+
     // Functions
 
     void SimTESCoil(std::string const &CompName, // name of the fan coil unit
@@ -2934,7 +2982,8 @@ namespace PackagedThermalStorageCoil {
         if ((EvapAirMassFlow > SmallMassFlow) && (PartLoadRatio > 0.0)) { // coil is running
 
             AirMassFlowRatio = EvapAirMassFlow / TESCoil(TESCoilNum).RatedEvapAirMassFlowRate;
-            EvapTotCapTempModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeCoolingCapFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
+            EvapTotCapTempModFac = StorageCurveValue(
+                TESCoilNum, TESCoil(TESCoilNum).CoolingAndChargeCoolingCapFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
             EvapTotCapTempModFac = max(0.0, EvapTotCapTempModFac); // could warn if negative, DXcoil does
             EvapTotCapFlowModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeCoolingCapFFlowCurve, AirMassFlowRatio);
             EvapTotCapFlowModFac = max(0.0, EvapTotCapFlowModFac); // could warn if negative, DXcoil does
@@ -2950,8 +2999,8 @@ namespace PackagedThermalStorageCoil {
                 Counter = 0;
                 Converged = false;
                 while (!Converged) {
-                    EvapTotCapTempModFac =
-                        CurveValue(TESCoil(TESCoilNum).CoolingAndChargeCoolingCapFTempCurve, DryCoilTestEvapInletWetBulb, CondInletTemp, sTES);
+                    EvapTotCapTempModFac = StorageCurveValue(
+                        TESCoilNum, TESCoil(TESCoilNum).CoolingAndChargeCoolingCapFTempCurve, DryCoilTestEvapInletWetBulb, CondInletTemp, sTES);
                     EvapTotCapTempModFac = max(0.0, EvapTotCapTempModFac); // could warn if negative, DXcoil does
                     EvapTotCapFlowModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeCoolingCapFFlowCurve, AirMassFlowRatio);
                     EvapTotCapFlowModFac = max(0.0, EvapTotCapFlowModFac); // could warn if negative, DXcoil does
@@ -2989,7 +3038,8 @@ namespace PackagedThermalStorageCoil {
                 if (CurveManager::PerfCurve(TESCoil(TESCoilNum).CoolingAndChargeSHRFTempCurve).NumDims == 2) {
                     SHRTempFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeSHRFTempCurve, EvapInletWetBulb, EvapInletDryBulb);
                 } else {
-                    SHRTempFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeSHRFTempCurve, EvapInletWetBulb, EvapInletDryBulb, sTES);
+                    SHRTempFac = StorageCurveValue(
+                        TESCoilNum, TESCoil(TESCoilNum).CoolingAndChargeSHRFTempCurve, EvapInletWetBulb, EvapInletDryBulb, sTES);
                 }
             }
             SHRFlowFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeSHRFFlowCurve, AirMassFlowRatio);
@@ -3011,7 +3061,8 @@ namespace PackagedThermalStorageCoil {
             }
 
             // Calculate electricity consumed. First, get EIR modifying factors for off-rated conditions
-            EIRTempModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeCoolingEIRFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
+            EIRTempModFac = StorageCurveValue(
+                TESCoilNum, TESCoil(TESCoilNum).CoolingAndChargeCoolingEIRFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
             EIRTempModFac = max(EIRTempModFac, 0.0);
             EIRFlowModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeCoolingEIRFFlowCurve, AirMassFlowRatio);
             EIRFlowModFac = max(EIRFlowModFac, 0.0);
@@ -3020,7 +3071,8 @@ namespace PackagedThermalStorageCoil {
             EvapElecCoolingPower = EvapTotCap * EIR * EvapRuntimeFraction;
 
             if (TESCanBeCharged) {
-                ChargeCapModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeChargingCapFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
+                ChargeCapModFac = StorageCurveValue(
+                    TESCoilNum, TESCoil(TESCoilNum).CoolingAndChargeChargingCapFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
                 ChargeCapModFac = max(0.0, ChargeCapModFac);
 
                 ChargeCapPLRModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeChargingCapFEvapPLRCurve, PartLoadRatio);
@@ -3033,7 +3085,8 @@ namespace PackagedThermalStorageCoil {
                 } else {
                     ChargeRuntimeFraction = 1.0;
                 }
-                ChargeEIRTempModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeChargingEIRFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
+                ChargeEIRTempModFac = StorageCurveValue(
+                    TESCoilNum, TESCoil(TESCoilNum).CoolingAndChargeChargingEIRFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
                 ChargeEIRTempModFac = max(0.0, ChargeEIRTempModFac);
                 ChargeEIRFlowModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeChargingEIRFFLowCurve, AirMassFlowRatio);
                 ChargeEIRFlowModFac = max(0.0, ChargeEIRFlowModFac);
@@ -3111,7 +3164,8 @@ namespace PackagedThermalStorageCoil {
         } else {                   // Evap off, but may still charge
             if (TESCanBeCharged) { // coil is running to charge but not to cool at evaporator
                 AirMassFlowRatio = EvapAirMassFlow / TESCoil(TESCoilNum).RatedEvapAirMassFlowRate;
-                ChargeCapModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeChargingCapFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
+                ChargeCapModFac = StorageCurveValue(
+                    TESCoilNum, TESCoil(TESCoilNum).CoolingAndChargeChargingCapFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
                 ChargeCapModFac = max(0.0, ChargeCapModFac);
 
                 ChargeCapPLRModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeChargingCapFEvapPLRCurve, PartLoadRatio);
@@ -3124,7 +3178,8 @@ namespace PackagedThermalStorageCoil {
                 } else {
                     ChargeRuntimeFraction = 1.0;
                 }
-                ChargeEIRTempModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeChargingEIRFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
+                ChargeEIRTempModFac = StorageCurveValue(
+                    TESCoilNum, TESCoil(TESCoilNum).CoolingAndChargeChargingEIRFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
                 ChargeEIRTempModFac = max(0.0, ChargeEIRTempModFac);
                 ChargeEIRFlowModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndChargeChargingEIRFFLowCurve, AirMassFlowRatio);
                 ChargeEIRFlowModFac = max(0.0, ChargeEIRFlowModFac);
@@ -3366,7 +3421,8 @@ namespace PackagedThermalStorageCoil {
         if ((EvapAirMassFlow > SmallMassFlow) && (PartLoadRatio > 0.0)) { // coil is running
 
             AirMassFlowRatio = EvapAirMassFlow / TESCoil(TESCoilNum).RatedEvapAirMassFlowRate;
-            EvapTotCapTempModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndDischargeCoolingCapFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
+            EvapTotCapTempModFac = StorageCurveValue(
+                TESCoilNum, TESCoil(TESCoilNum).CoolingAndDischargeCoolingCapFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
             EvapTotCapTempModFac = max(0.0, EvapTotCapTempModFac); // could warn if negative, DXcoil does
             EvapTotCapFlowModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndDischargeCoolingCapFFlowCurve, AirMassFlowRatio);
             EvapTotCapFlowModFac = max(0.0, EvapTotCapFlowModFac); // could warn if negative, DXcoil does
@@ -3382,8 +3438,8 @@ namespace PackagedThermalStorageCoil {
                 Counter = 0;
                 Converged = false;
                 while (!Converged) {
-                    EvapTotCapTempModFac =
-                        CurveValue(TESCoil(TESCoilNum).CoolingAndDischargeCoolingCapFTempCurve, DryCoilTestEvapInletWetBulb, CondInletTemp, sTES);
+                    EvapTotCapTempModFac = StorageCurveValue(
+                        TESCoilNum, TESCoil(TESCoilNum).CoolingAndDischargeCoolingCapFTempCurve, DryCoilTestEvapInletWetBulb, CondInletTemp, sTES);
                     EvapTotCapTempModFac = max(0.0, EvapTotCapTempModFac); // could warn if negative, DXcoil does
                     EvapTotCapFlowModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndDischargeCoolingCapFFlowCurve, AirMassFlowRatio);
                     EvapTotCapFlowModFac = max(0.0, EvapTotCapFlowModFac); // could warn if negative, DXcoil does
@@ -3421,7 +3477,8 @@ namespace PackagedThermalStorageCoil {
                 if (CurveManager::PerfCurve(TESCoil(TESCoilNum).CoolingAndDischargeSHRFTempCurve).NumDims == 2) {
                     SHRTempFac = CurveValue(TESCoil(TESCoilNum).CoolingAndDischargeSHRFTempCurve, EvapInletWetBulb, EvapInletDryBulb);
                 } else {
-                    SHRTempFac = CurveValue(TESCoil(TESCoilNum).CoolingAndDischargeSHRFTempCurve, EvapInletWetBulb, EvapInletDryBulb, sTES);
+                    SHRTempFac = StorageCurveValue(
+                        TESCoilNum, TESCoil(TESCoilNum).CoolingAndDischargeSHRFTempCurve, EvapInletWetBulb, EvapInletDryBulb, sTES);
                 }
             }
             SHRFlowFac = CurveValue(TESCoil(TESCoilNum).CoolingAndDischargeSHRFFlowCurve, AirMassFlowRatio);
@@ -3442,7 +3499,8 @@ namespace PackagedThermalStorageCoil {
                 EvapRuntimeFraction = 1.0; // warn maybe
             }
             // Calculate electricity consumed. First, get EIR modifying factors for off-rated conditions
-            EIRTempModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndDischargeCoolingEIRFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
+            EIRTempModFac = StorageCurveValue(
+                TESCoilNum, TESCoil(TESCoilNum).CoolingAndDischargeCoolingEIRFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
             EIRTempModFac = max(EIRTempModFac, 0.0);
             EIRFlowModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndDischargeCoolingEIRFFlowCurve, AirMassFlowRatio);
             EIRFlowModFac = max(EIRFlowModFac, 0.0);
@@ -3451,8 +3509,8 @@ namespace PackagedThermalStorageCoil {
             EvapElecCoolingPower = EvapTotCap * EIR * EvapRuntimeFraction;
 
             if (TESHasSomeCharge) {
-                DischargeCapTempModFac =
-                    CurveValue(TESCoil(TESCoilNum).CoolingAndDischargeDischargingCapFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
+                DischargeCapTempModFac = StorageCurveValue(
+                    TESCoilNum, TESCoil(TESCoilNum).CoolingAndDischargeDischargingCapFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
                 DischargeCapTempModFac = max(0.0, DischargeCapTempModFac);
                 DischargeCapFlowModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndDischargeDischargingCapFFlowCurve, AirMassFlowRatio);
                 DischargeCapFlowModFac = max(0.0, DischargeCapFlowModFac);
@@ -3469,8 +3527,8 @@ namespace PackagedThermalStorageCoil {
                 if (TotDischargeCap > QdotDischargeLimit) {
                     TotDischargeCap = min(TotDischargeCap, QdotDischargeLimit);
                 }
-                DischargeEIRTempModFac =
-                    CurveValue(TESCoil(TESCoilNum).CoolingAndDischargeDischargingEIRFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
+                DischargeEIRTempModFac = StorageCurveValue(
+                    TESCoilNum, TESCoil(TESCoilNum).CoolingAndDischargeDischargingEIRFTempCurve, EvapInletWetBulb, CondInletTemp, sTES);
                 DischargeEIRTempModFac = max(0.0, DischargeEIRTempModFac);
                 DischargeEIRFlowModFac = CurveValue(TESCoil(TESCoilNum).CoolingAndDischargeDischargingEIRFFLowCurve, AirMassFlowRatio);
                 DischargeEIRFlowModFac = max(0.0, DischargeEIRFlowModFac);
@@ -3710,7 +3768,7 @@ namespace PackagedThermalStorageCoil {
         }
 
         if (TESCanBeCharged) { // coil is running
-            CapModFac = CurveValue(TESCoil(TESCoilNum).ChargeOnlyChargingCapFTempCurve, CondInletTemp, sTES);
+            CapModFac = StorageCurveValue(TESCoilNum, TESCoil(TESCoilNum).ChargeOnlyChargingCapFTempCurve, CondInletTemp, sTES);
             CapModFac = max(0.0, CapModFac);
             TotCap = TESCoil(TESCoilNum).ChargeOnlyRatedCapacity * CapModFac;
             if (TotCap > QdotChargeLimit) {
@@ -3719,7 +3777,7 @@ namespace PackagedThermalStorageCoil {
             } else {
                 TESCoil(TESCoilNum).RuntimeFraction = 1.0;
             }
-            EIRModFac = CurveValue(TESCoil(TESCoilNum).ChargeOnlyChargingEIRFTempCurve, CondInletTemp, sTES);
+            EIRModFac = StorageCurveValue(TESCoilNum, TESCoil(TESCoilNum).ChargeOnlyChargingEIRFTempCurve, CondInletTemp, sTES);
             EIRModFac = max(0.0, EIRModFac);
             EIR = EIRModFac / TESCoil(TESCoilNum).ChargeOnlyRatedCOP;
             ElecCoolingPower = TotCap * EIR;
@@ -3893,7 +3951,7 @@ namespace PackagedThermalStorageCoil {
         if ((EvapAirMassFlow > SmallMassFlow) && (PLR > 0.0) && TESHasSomeCharge) { // coil is running
             AirMassFlowRatio = EvapAirMassFlow / TESCoil(TESCoilNum).RatedEvapAirMassFlowRate;
 
-            TotCapTempModFac = CurveValue(TESCoil(TESCoilNum).DischargeOnlyCapFTempCurve, EvapInletWetBulb, sTES);
+            TotCapTempModFac = StorageCurveValue(TESCoilNum, TESCoil(TESCoilNum).DischargeOnlyCapFTempCurve, EvapInletWetBulb, sTES);
             TotCapTempModFac = max(0.0, TotCapTempModFac);
             TotCapFlowModFac = CurveValue(TESCoil(TESCoilNum).DischargeOnlyCapFFlowCurve, AirMassFlowRatio);
             TotCapFlowModFac = max(0.0, TotCapFlowModFac);
@@ -3906,7 +3964,7 @@ namespace PackagedThermalStorageCoil {
                 RuntimeFraction = 1.0; // warn maybe
             }
             // Calculate electricity consumed. First, get EIR modifying factors for off-rated conditions
-            EIRTempModFac = CurveValue(TESCoil(TESCoilNum).DischargeOnlyEIRFTempCurve, EvapInletWetBulb, sTES);
+            EIRTempModFac = StorageCurveValue(TESCoilNum, TESCoil(TESCoilNum).DischargeOnlyEIRFTempCurve, EvapInletWetBulb, sTES);
             EIRTempModFac = max(EIRTempModFac, 0.0);
             EIRFlowModFac = CurveValue(TESCoil(TESCoilNum).DischargeOnlyEIRFFlowCurve, AirMassFlowRatio);
             EIRFlowModFac = max(EIRFlowModFac, 0.0);
@@ -3932,7 +3990,8 @@ namespace PackagedThermalStorageCoil {
                 Counter = 0;
                 Converged = false;
                 while (!Converged) {
-                    TotCapTempModFac = CurveValue(TESCoil(TESCoilNum).DischargeOnlyCapFTempCurve, DryCoilTestEvapInletWetBulb, sTES);
+                    TotCapTempModFac = StorageCurveValue(
+                        TESCoilNum, TESCoil(TESCoilNum).DischargeOnlyCapFTempCurve, DryCoilTestEvapInletWetBulb, sTES);
                     TotCapTempModFac = max(0.0, TotCapTempModFac);
                     TotCapFlowModFac = CurveValue(TESCoil(TESCoilNum).DischargeOnlyCapFFlowCurve, AirMassFlowRatio);
                     TotCapFlowModFac = max(0.0, TotCapFlowModFac);
@@ -3970,7 +4029,8 @@ namespace PackagedThermalStorageCoil {
                 if (CurveManager::PerfCurve(TESCoil(TESCoilNum).DischargeOnlySHRFTempCurve).NumDims == 2) {
                     SHRTempFac = CurveValue(TESCoil(TESCoilNum).DischargeOnlySHRFTempCurve, EvapInletWetBulb, EvapInletDryBulb);
                 } else {
-                    SHRTempFac = CurveValue(TESCoil(TESCoilNum).DischargeOnlySHRFTempCurve, EvapInletWetBulb, EvapInletDryBulb, sTES);
+                    SHRTempFac = StorageCurveValue(
+                        TESCoilNum, TESCoil(TESCoilNum).DischargeOnlySHRFTempCurve, EvapInletWetBulb, EvapInletDryBulb, sTES);
                 }
             }
 
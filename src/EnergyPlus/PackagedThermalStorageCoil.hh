@@ -48,6 +48,9 @@
 #ifndef PackagedThermalStorageCoil_hh_INCLUDED
 #define PackagedThermalStorageCoil_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -104,6 +107,21 @@ namespace PackagedThermalStorageCoil {
 
     // Types
 
+    struct StorageCurveMemoData
+    {
+        // Members
+        int CurveIndex; // curve evaluated
+        Real64 Var1;    // independent variables of the last evaluation
+        Real64 Var2;
+        Real64 Var3;
+        Real64 Value; // curve value of the last evaluation
+
+        // Default Constructor
+        StorageCurveMemoData() : CurveIndex(0), Var1(0.0), Var2(0.0), Var3(0.0), Value(0.0)
+        {
+        }
+    };
+
     struct PackagedTESCoolingCoilStruct
     {
         // Members
@@ -351,6 +369,7 @@ namespace PackagedThermalStorageCoil {
         Real64 EvapWaterStarvMakup;     // Evap water consumed but not really available from tank m3
         Real64 EvapCondPumpElecPower;
         Real64 EvapCondPumpElecConsumption;
+        std::vector<StorageCurveMemoData> StorageCurveMemos; // last evaluation of each storage state dependent curve
 
         // Default Constructor
         PackagedTESCoolingCoilStruct()
@@ -0,0 +1,114 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef Parallel_hh_INCLUDED
+#define Parallel_hh_INCLUDED
+
+// C++ Headers
+#include <algorithm>
+#include <vector>
+
+// EnergyPlus Headers
+#include <DataSystemVariables.hh>
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+// Threaded loops share the one OpenMP thread team that ConfigureThreads sets up from the thread settings in
+// DataSystemVariables, so a loop never asks for more threads than the simulation was given
+namespace Parallel {
+
+    // Functions
+    void SetThreadLimit(int const Limit);
+
+    int ThreadLimit();
+
+    void ConfigureThreads();
+
+    // Threads for a loop over NumItems independent items, one when there are fewer than MinItems
+    inline int LoopThreads(int const NumItems, int const MinItems = 2)
+    {
+        if (NumItems < MinItems) return 1;
+        return std::max(1, std::min(NumItems, DataSystemVariables::NumberIntRadThreads));
+    }
+
+    // Calls body(Index) for every Index in [0, NumItems), dynamically scheduled over the simulation's threads
+    template <typename Body> void For(int const NumItems, Body const &body, int const MinItems = 2)
+    {
+#ifdef _OPENMP
+        int const numThreads = LoopThreads(NumItems, MinItems);
+#pragma omp parallel for schedule(dynamic) num_threads(numThreads) if (numThreads > 1)
+#endif
+        for (int Index = 0; Index < NumItems; ++Index) {
+            body(Index);
+        }
+    }
+
+    // Sum of term(Index) over [0, NumItems). The terms are evaluated in parallel but added in index order,
+    // so unlike an OpenMP reduction the result does not depend on the number of threads.
+    template <typename Term> Real64 Sum(int const NumItems, Term const &term, int const MinItems = 2)
+    {
+        Real64 Total = 0.0;
+        if (LoopThreads(NumItems, MinItems) == 1) {
+            for (int Index = 0; Index < NumItems; ++Index) {
+                Total += term(Index);
+            }
+            return Total;
+        }
+        std::vector<Real64> Terms(NumItems);
+        For(NumItems, [&](int const Index) { Terms[Index] = term(Index); }, MinItems);
+        for (Real64 const Value : Terms) {
+            Total += Value;
+        }
+        return Total;
+    }
+
+} // namespace Parallel
+
+} // namespace EnergyPlus
+
+#endif
@@ -81,7 +81,9 @@
 // C++ Headers
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <limits>
+#include <vector>
 
 namespace EnergyPlus {
 
@@ -430,6 +432,98 @@ void PierceSurface(int const iSurf,               // Surface index
     PierceSurface(DataSurfaces::Surface(iSurf), rayOri, rayDir, dMax, hitPt, hit);
 }
 
+// Packet of rays from a common origin for batched surface piercing
+//  The direction components are stored as separate arrays so the ray-plane stage over a packet vectorizes
+struct RayPacket
+{
+    using size_type = std::vector<Real64>::size_type;
+
+    Vector3<Real64> ori;           // Common ray origin point
+    std::vector<Real64> x;         // Ray direction vector x components
+    std::vector<Real64> y;         // Ray direction vector y components
+    std::vector<Real64> z;         // Ray direction vector z components
+    std::vector<std::uint8_t> hit; // Ray has hit a surface?
+    std::vector<Real64> den;       // Work: ray direction dotted with the plane normal of the surface being tested
+    size_type nHit = 0u;           // Number of rays that have hit a surface
+
+    size_type size() const
+    {
+        return x.size();
+    }
+
+    // Add a ray direction
+    void add(Vector3<Real64> const &rayDir)
+    {
+        x.push_back(rayDir.x);
+        y.push_back(rayDir.y);
+        z.push_back(rayDir.z);
+        hit.push_back(0u);
+        den.push_back(0.0);
+    }
+
+    // Remove all rays
+    void clear()
+    {
+        x.clear();
+        y.clear();
+        z.clear();
+        hit.clear();
+        den.clear();
+        nHit = 0u;
+    }
+
+    // Mark all rays as not hitting anything
+    void reset()
+    {
+        std::fill(hit.begin(), hit.end(), std::uint8_t(0u));
+        nHit = 0u;
+    }
+
+    // All rays have hit a surface?
+    bool allHit() const
+    {
+        return nHit == x.size();
+    }
+};
+
+ALWAYS_INLINE
+void PierceSurface(DataSurfaces::SurfaceData const &surface, // Surface
+                   RayPacket &rays                           // Rays from a common origin: hit flags are set for rays that hit the surface
+)
+{
+    // Purpose: Check which rays of a packet that have not hit a surface yet hit this surface.
+    //  Each ray gets the same answer as the single ray PierceSurface: the ray-plane stage is the same
+    //  arithmetic done over the whole packet, then the polygon check is done for the rays reaching the plane.
+
+    DataSurfaces::SurfaceData::Plane const &plane(surface.plane);
+    Real64 const num(-((plane.x * rays.ori.x) + (plane.y * rays.ori.y) + (plane.z * rays.ori.z) + plane.w));
+    if (num == 0.0) return; // Ray origin is on surface plane: Not treated as piercing
+
+    RayPacket::size_type const n(rays.size());
+    Real64 const *const x(rays.x.data());
+    Real64 const *const y(rays.y.data());
+    Real64 const *const z(rays.z.data());
+    Real64 *const den(rays.den.data());
+    for (RayPacket::size_type i = 0; i < n; ++i) {
+        den[i] = (plane.x * x[i]) + (plane.y * y[i]) + (plane.z * z[i]);
+    }
+
+    Vector3<Real64> hitPt;
+    for (RayPacket::size_type i = 0; i < n; ++i) {
+        if (rays.hit[i] || (num * den[i] <= 0.0)) continue; // Already hit, parallel to plane, or pointing away from surface
+        Real64 const t(num / den[i]);                       // Ray parameter at plane intersection: hitPt = rayOri + t * rayDir
+        hitPt.x = rays.ori.x + (t * x[i]);
+        hitPt.y = rays.ori.y + (t * y[i]);
+        hitPt.z = rays.ori.z + (t * z[i]);
+        bool hit(false);
+        PierceSurface_polygon(surface, hitPt, hit);
+        if (hit) {
+            rays.hit[i] = 1u;
+            ++rays.nHit;
+        }
+    }
+}
+
 } // namespace EnergyPlus
 
 #endif
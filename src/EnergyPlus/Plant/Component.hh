@@ -96,6 +96,8 @@ namespace DataPlant {
         Real64 TempDesCondIn;
         Real64 TempDesEvapOut;
         PlantComponent *compPtr;
+        Real64 SimulationTime;             // [s] wall time spent simulating this component, when timings are requested
+        Int64 SimulationCalls;             // number of timed calls to simulate this component
 
         // Default Constructor
         CompData()
@@ -104,7 +106,7 @@ namespace DataPlant {
               CurOpSchemeType(UnknownStatusOpSchemeType), NumOpSchemes(0), CurCompLevelOpNum(0), EquipDemand(0.0), EMSLoadOverrideOn(false),
               EMSLoadOverrideValue(0.0), HowLoadServed(HowMet_Unknown), MinOutletTemp(0.0), MaxOutletTemp(0.0), FreeCoolCntrlShutDown(false),
               FreeCoolCntrlMinCntrlTemp(0.0), FreeCoolCntrlMode(0), FreeCoolCntrlNodeNum(0), IndexInLoopSidePumps(0), TempDesCondIn(0.0),
-              TempDesEvapOut(0.0), compPtr(nullptr)
+              TempDesEvapOut(0.0), compPtr(nullptr), SimulationTime(0.0), SimulationCalls(0)
         {
         }
     };
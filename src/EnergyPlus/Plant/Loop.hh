@@ -93,6 +93,8 @@ namespace DataPlant {
         int LoopDemandCalcScheme;        // Load distribution scheme 1 SingleSetPoint,
         // 2 DualSetPointwithDeadBand
         int CommonPipeType;
+        int LoopGroup;                 // index of the set of loops coupled to this one through connection components
+        bool CommonPipeInLoopGroup;    // true if any loop in this loop's group has a common pipe
         std::string EconomizerHtExchanger;       // DSU review, should move these out of here
         std::string EconPlantSideSensedNodeName; // DSU review, should move these out of here
         std::string EconCondSideSensedNodeName;  // DSU review, should move these out of here
@@ -118,7 +120,7 @@ namespace DataPlant {
               MaxTempErrIndex(0), MinVolFlowRate(0.0), MaxVolFlowRate(0.0), MaxVolFlowRateWasAutoSized(false), MinMassFlowRate(0.0),
               MaxMassFlowRate(0.0), Volume(0.0), VolumeWasAutoSized(false), // true if Volume was set to autocalculate
               CirculationTime(2.0), Mass(0.0), EMSCtrl(false), EMSValue(0.0), NumOpSchemes(0), LoadDistribution(0), PlantSizNum(0),
-              LoopDemandCalcScheme(0), CommonPipeType(0), EconPlantSideSensedNodeNum(0), EconCondSideSensedNodeNum(0), EconPlacement(0),
+              LoopDemandCalcScheme(0), CommonPipeType(0), LoopGroup(0), CommonPipeInLoopGroup(false), EconPlantSideSensedNodeNum(0), EconCondSideSensedNodeNum(0), EconPlacement(0),
               EconBranch(0), EconComp(0), EconControlTempDiff(0.0), LoopHasConnectionComp(false), TypeOfLoop(0), PressureSimType(1),
               HasPressureComponents(false), PressureDrop(0.0), UsePressureForPumpCalcs(false), PressureEffectiveK(0.0)
         {
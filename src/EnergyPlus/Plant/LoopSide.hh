@@ -48,6 +48,8 @@
 #ifndef PlantTopologyLoopSide_hh_INCLUDED
 #define PlantTopologyLoopSide_hh_INCLUDED
 
+#include <vector>
+
 #include <DataLoopNode.hh>
 #include <Plant/Branch.hh>
 #include <Plant/ConnectedLoopData.hh>
@@ -126,6 +128,9 @@ namespace DataPlant {
         Real64 flowRequestFinal;
         bool hasConstSpeedBranchPumps;
         Array1D<Real64> noLoadConstantSpeedBranchFlowRateSteps;
+        int LastSolveCount;                   // value of the half loop solve counter when this side was last solved
+        std::vector<Real64> SolvedInputTemps; // node and setpoint temperatures seen by the last solution
+        std::vector<Real64> SolvedInputFlows; // node flow rates and flow requests seen by the last solution
 
         // Default Constructor
         HalfLoopData()
@@ -140,7 +145,7 @@ namespace DataPlant {
               errIndex_LoadRemains(0), LoopSideInlet_TankTemp(0.0), LoopSideInlet_MdotCpDeltaT(0.0), LoopSideInlet_McpDTdt(0.0),
               LoopSideInlet_CapExcessStorageTime(0.0), LoopSideInlet_CapExcessStorageTimeReport(0.0), LoopSideInlet_TotalTime(0.0),
               InletNode(0.0, 0.0), OutletNode(0.0, 0.0), flowRequestNeedIfOn(0.0), flowRequestNeedAndTurnOn(0.0), flowRequestFinal(0.0),
-              hasConstSpeedBranchPumps(false)
+              hasConstSpeedBranchPumps(false), LastSolveCount(0)
         {
         }
     };
@@ -1702,6 +1702,8 @@ namespace EnergyPlus {
             // branches is then locked down, via MassFlowRateMaxAvail and MinAvail
             // SimPlant Equipment is then run again in order to get correct
             // properties.  Finally, Max/MinAvail are reset for the next time step.
+            // The branch flow requests are gathered once and reused when the flow has to be
+            // apportioned, and the loop side rigidity is checked once for all branch pushes.
 
             // Using/Aliasing
             using DataBranchAirLoopPlant::ControlType_Active;
@@ -1714,6 +1716,7 @@ namespace EnergyPlus {
             using DataPlant::TypeOf_PumpBankVariableSpeed;
             using DataPlant::TypeOf_PumpVariableSpeed;
             using General::RoundSigDigits;
+            using PlantUtilities::CheckPlantConvergence;
 
             // SUBROUTINE PARAMETER DEFINITIONS:
             static Array1D_string const LoopSideName(2, {"Demand", "Supply"});
@@ -1754,6 +1757,7 @@ namespace EnergyPlus {
             int CompCounter;
             int CompInletNode;
             int CompOutletNode;
+            bool PlantIsRigid;
 
             auto &this_loopside(PlantLoop(LoopNum).LoopSide(LoopSideNum));
 
@@ -1798,6 +1802,10 @@ namespace EnergyPlus {
                     ShowFatalError("Invalid plant topology causes program termination.");
                 }
 
+                // the convergence history does not change while flows are pushed down the branches
+                PlantIsRigid = CheckPlantConvergence(LoopNum, LoopSideNum, FirstHVACIteration);
+                ParallelBranchFlowRequest.resize(NumSplitOutlets);
+
                 NumActiveBranches = 0;
                 ParallelBranchMaxAvail = 0.0;
                 ParallelBranchMinAvail = 0.0;
@@ -1832,6 +1840,7 @@ namespace EnergyPlus {
                         CompInletNode = this_comp.NodeNumIn;
                         BranchFlowReq = max(BranchFlowReq, Node(CompInletNode).MassFlowRateRequest);
                     }
+                    ParallelBranchFlowRequest[iBranch - 1] = BranchFlowReq;
 
                     BranchMinAvail = Node(LastNodeOnBranch).MassFlowRateMinAvail;
                     BranchMaxAvail = Node(LastNodeOnBranch).MassFlowRateMaxAvail;
@@ -1893,8 +1902,7 @@ namespace EnergyPlus {
                         this_loopside.Branch(SplitterBranchOut).ControlType != ControlType_SeriesActive) {
                         Node(FirstNodeOnBranch).MassFlowRate = 0.0;
                         DataPlant::PlantLoop(LoopNum).loopSolver.PushBranchFlowCharacteristics(
-                                LoopNum, LoopSideNum, SplitterBranchOut, Node(FirstNodeOnBranch).MassFlowRate,
-                                FirstHVACIteration);
+                                LoopNum, LoopSideNum, SplitterBranchOut, Node(FirstNodeOnBranch).MassFlowRate, PlantIsRigid);
                     }
                 }
 
@@ -1929,8 +1937,7 @@ namespace EnergyPlus {
                             if (Node(FirstNodeOnBranch).MassFlowRate < MassFlowTolerance)
                                 Node(FirstNodeOnBranch).MassFlowRate = 0.0;
                             DataPlant::PlantLoop(LoopNum).loopSolver.PushBranchFlowCharacteristics(
-                                    LoopNum, LoopSideNum, SplitterBranchOut, Node(FirstNodeOnBranch).MassFlowRate,
-                                    FirstHVACIteration);
+                                    LoopNum, LoopSideNum, SplitterBranchOut, Node(FirstNodeOnBranch).MassFlowRate, PlantIsRigid);
                             FlowRemaining -= Node(FirstNodeOnBranch).MassFlowRate;
                             if (FlowRemaining < MassFlowTolerance) FlowRemaining = 0.0;
                         }
@@ -1970,8 +1977,7 @@ namespace EnergyPlus {
                                     FlowRemaining -= Node(FirstNodeOnBranch).MassFlowRate;
                                 }
                                 DataPlant::PlantLoop(LoopNum).loopSolver.PushBranchFlowCharacteristics(
-                                        LoopNum, LoopSideNum, SplitterBranchOut, Node(FirstNodeOnBranch).MassFlowRate,
-                                        FirstHVACIteration);
+                                        LoopNum, LoopSideNum, SplitterBranchOut, Node(FirstNodeOnBranch).MassFlowRate, PlantIsRigid);
                             }
                         }
                     } // totalMax <=0 and flow should be assigned to active branches
@@ -1986,8 +1992,7 @@ namespace EnergyPlus {
                             Node(FirstNodeOnBranch).MassFlowRate = min(FlowRemaining,
                                                                        Node(FirstNodeOnBranch).MassFlowRateMaxAvail);
                             DataPlant::PlantLoop(LoopNum).loopSolver.PushBranchFlowCharacteristics(
-                                    LoopNum, LoopSideNum, SplitterBranchOut, Node(FirstNodeOnBranch).MassFlowRate,
-                                    FirstHVACIteration);
+                                    LoopNum, LoopSideNum, SplitterBranchOut, Node(FirstNodeOnBranch).MassFlowRate, PlantIsRigid);
                             FlowRemaining -= Node(FirstNodeOnBranch).MassFlowRate;
                         }
                     }
@@ -2010,8 +2015,7 @@ namespace EnergyPlus {
                                         min((Node(FirstNodeOnBranch).MassFlowRate + ActiveFlowRate),
                                             Node(FirstNodeOnBranch).MassFlowRateMaxAvail);
                                 DataPlant::PlantLoop(LoopNum).loopSolver.PushBranchFlowCharacteristics(
-                                        LoopNum, LoopSideNum, SplitterBranchOut, Node(FirstNodeOnBranch).MassFlowRate,
-                                        FirstHVACIteration);
+                                        LoopNum, LoopSideNum, SplitterBranchOut, Node(FirstNodeOnBranch).MassFlowRate, PlantIsRigid);
                                 // adjust the remaining flow
                                 FlowRemaining -= (Node(FirstNodeOnBranch).MassFlowRate - StartingFlowRate);
                             }
@@ -2032,8 +2036,7 @@ namespace EnergyPlus {
                                 FlowRemaining -= ActiveFlowRate;
                                 Node(FirstNodeOnBranch).MassFlowRate = StartingFlowRate + ActiveFlowRate;
                                 DataPlant::PlantLoop(LoopNum).loopSolver.PushBranchFlowCharacteristics(
-                                        LoopNum, LoopSideNum, SplitterBranchOut, Node(FirstNodeOnBranch).MassFlowRate,
-                                        FirstHVACIteration);
+                                        LoopNum, LoopSideNum, SplitterBranchOut, Node(FirstNodeOnBranch).MassFlowRate, PlantIsRigid);
                             }
                         }
                     }
@@ -2054,13 +2057,13 @@ namespace EnergyPlus {
                     FirstNodeOnBranchIn = this_loopside.Branch(SplitterBranchIn).NodeNumIn;
                     Node(FirstNodeOnBranchIn).MassFlowRate = TotParallelBranchFlowReq;
                     PushBranchFlowCharacteristics(LoopNum, LoopSideNum, SplitterBranchIn,
-                                                  Node(FirstNodeOnBranchIn).MassFlowRate, FirstHVACIteration);
+                                                  Node(FirstNodeOnBranchIn).MassFlowRate, PlantIsRigid);
                     // Reset the flow on the Mixer outlet branch
                     MixerBranchOut = this_loopside.Mixer.BranchNumOut;
                     FirstNodeOnBranchOut = this_loopside.Branch(MixerBranchOut).NodeNumIn;
                     Node(FirstNodeOnBranchOut).MassFlowRate = TotParallelBranchFlowReq;
                     PushBranchFlowCharacteristics(LoopNum, LoopSideNum, MixerBranchOut,
-                                                  Node(FirstNodeOnBranchOut).MassFlowRate, FirstHVACIteration);
+                                                  Node(FirstNodeOnBranchOut).MassFlowRate, PlantIsRigid);
                     return;
 
                     // IF INSUFFICIENT FLOW TO MEET ALL PARALLEL BRANCH FLOW REQUESTS
@@ -2071,37 +2074,21 @@ namespace EnergyPlus {
                     for (OutletNum = 1; OutletNum <= NumSplitOutlets; ++OutletNum) {
 
                         SplitterBranchOut = this_loopside.Splitter.BranchNumOut(OutletNum);
-                        ThisBranchRequest = DetermineBranchFlowRequest(LoopNum, LoopSideNum, SplitterBranchOut);
                         FirstNodeOnBranch = this_loopside.Branch(SplitterBranchOut).NodeNumIn;
                         auto &this_splitter_outlet_branch(this_loopside.Branch(SplitterBranchOut));
 
                         if ((this_splitter_outlet_branch.ControlType == ControlType_Active) ||
                             (this_splitter_outlet_branch.ControlType == ControlType_SeriesActive)) {
 
-                            // since we are calculating this fraction based on the total parallel request calculated above, we must mimic the logic to
-                            // make sure the math works every time that means we must make the variable speed pump correction here as well.
-                            for (CompCounter = 1;
-                                 CompCounter <= this_splitter_outlet_branch.TotalComponents; ++CompCounter) {
-
-                                auto &this_comp(this_splitter_outlet_branch.Comp(CompCounter));
-
-                                // if this isn't a variable speed pump then just keep cycling
-                                if ((this_comp.TypeOf_Num != TypeOf_PumpVariableSpeed) &&
-                                    (this_comp.TypeOf_Num != TypeOf_PumpBankVariableSpeed)) {
-                                    continue;
-                                }
-
-                                CompInletNode = this_comp.NodeNumIn;
-                                ThisBranchRequest = max(ThisBranchRequest, Node(CompInletNode).MassFlowRateRequest);
-                            }
-
+                            // the request was found above, including the variable speed pump correction, so the
+                            // fractions sum to one against the total parallel request
+                            ThisBranchRequest = ParallelBranchFlowRequest[OutletNum - 1];
                             ThisBranchRequestFrac = ThisBranchRequest / TotParallelBranchFlowReq;
                             //    FracFlow = Node(FirstNodeOnBranch)%MassFlowRate/TotParallelBranchFlowReq
                             //    Node(FirstNodeOnBranch)%MassFlowRate = MIN((FracFlow * Node(FirstNodeOnBranch)%MassFlowRate),FlowRemaining)
                             Node(FirstNodeOnBranch).MassFlowRate = ThisBranchRequestFrac * ThisLoopSideFlow;
                             DataPlant::PlantLoop(LoopNum).loopSolver.PushBranchFlowCharacteristics(
-                                    LoopNum, LoopSideNum, SplitterBranchOut, Node(FirstNodeOnBranch).MassFlowRate,
-                                    FirstHVACIteration);
+                                    LoopNum, LoopSideNum, SplitterBranchOut, Node(FirstNodeOnBranch).MassFlowRate, PlantIsRigid);
                             FlowRemaining -= Node(FirstNodeOnBranch).MassFlowRate;
                         }
                     }
@@ -2122,8 +2109,7 @@ namespace EnergyPlus {
                     FirstNodeOnBranchOut = this_loopside.Branch(MixerBranchOut).NodeNumIn;
                     Node(FirstNodeOnBranchOut).MassFlowRate = TotParallelBranchFlowReq;
                     DataPlant::PlantLoop(LoopNum).loopSolver.PushBranchFlowCharacteristics(
-                            LoopNum, LoopSideNum, MixerBranchOut, Node(FirstNodeOnBranchOut).MassFlowRate,
-                            FirstHVACIteration);
+                            LoopNum, LoopSideNum, MixerBranchOut, Node(FirstNodeOnBranchOut).MassFlowRate, PlantIsRigid);
 
                 } // Total flow requested >= or < Total parallel request
 
@@ -2231,7 +2217,7 @@ namespace EnergyPlus {
                                                                  int const LoopSideNum,
                                                                  int const BranchNum,
                                                                  Real64 const ValueToPush,
-                                                                 bool const FirstHVACIteration // TRUE if First HVAC iteration of Time step
+                                                                 bool const PlantIsRigid // TRUE if the loop side flows have converged
         ) {
 
             // SUBROUTINE INFORMATION:
@@ -2265,7 +2251,6 @@ namespace EnergyPlus {
             using namespace DataPlant; // Use the entire module to allow all TypeOf's, would be a huge ONLY list
             using DataBranchAirLoopPlant::MassFlowTolerance;
             using DataLoopNode::Node;
-            using PlantUtilities::CheckPlantConvergence;
 
             // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
             int CompCounter;
@@ -2276,7 +2261,6 @@ namespace EnergyPlus {
             int ComponentTypeOfNum;
             Real64 MassFlowRateFound;
             Real64 MassFlow;
-            bool PlantIsRigid;
 
             auto &this_loopside(PlantLoop(LoopNum).LoopSide(LoopSideNum));
             auto &this_branch(this_loopside.Branch(BranchNum));
@@ -2294,8 +2278,6 @@ namespace EnergyPlus {
             // MinAvail = ValueToPush
             // MaxAvail = ValueToPush
 
-            PlantIsRigid = CheckPlantConvergence(LoopNum, LoopSideNum, FirstHVACIteration);
-
             //~ Loop across all component outlet nodes and update their mass flow and max avail
             for (CompCounter = 1; CompCounter <= this_branch.TotalComponents; ++CompCounter) {
 
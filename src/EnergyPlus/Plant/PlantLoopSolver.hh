@@ -48,6 +48,9 @@
 #ifndef PlantLoopSolver_hh_INCLUDED
 #define PlantLoopSolver_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1S.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -84,6 +87,7 @@ namespace PlantLoopSolver {
 
     struct PlantLoopSolverClass
     {
+        std::vector<Real64> ParallelBranchFlowRequest; // flow request of each splitter outlet branch, by splitter outlet
 
         void ValidateFlowControlPaths(int const LoopNum, int const LoopSideNum);
 
@@ -144,7 +148,7 @@ namespace PlantLoopSolver {
                                            int const LoopSideNum,
                                            int const BranchNum,
                                            Real64 const ValueToPush,
-                                           bool const FirstHVACIteration // TRUE if First HVAC iteration of Time step
+                                           bool const PlantIsRigid // TRUE if the loop side flows have converged
         );
 
         void CalcUnmetPlantDemand(int const LoopNum, int const LoopSideNum);
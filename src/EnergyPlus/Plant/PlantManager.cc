@@ -48,6 +48,8 @@
 // C++ Headers
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <fstream>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -65,6 +67,9 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <EMSManager.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
@@ -137,6 +142,7 @@ namespace EnergyPlus {
         Array1D_int SupplySideOutletNode; // Node number for the supply side outlet
         Array1D_int DemandSideInletNode;  // Inlet node on the demand side
         TempLoopData TempLoop;            // =(' ',' ',' ',0, , , ,.FALSE.,.FALSE.,.FALSE.,.FALSE.,.FALSE.)
+        int HalfLoopSolveCount(0);        // number of half loop solves, used to order solutions of connected loop sides
 
         void clear_state() {
             InitLoopEquip = true;
@@ -145,6 +151,7 @@ namespace EnergyPlus {
             SupplySideOutletNode.deallocate();
             DemandSideInletNode.deallocate();
             TempLoop = TempLoopData();
+            HalfLoopSolveCount = 0;
         }
 
         void ManagePlantLoops(bool const FirstHVACIteration,
@@ -169,6 +176,9 @@ namespace EnergyPlus {
             // Set up the while iteration block for the plant loop simulation.
             // Calls half loop sides to be simulated in predetermined order.
             // Reset the flags as necessary
+            // The extra minimum sub iterations needed by common pipes are only imposed on the group of
+            // loops coupled to a common pipe loop, independent loop groups stop once they have converged.
+            // Loop groups are still simulated serially, component models share module level state.
 
             // REFERENCES:
             // na
@@ -194,11 +204,14 @@ namespace EnergyPlus {
             bool SimHalfLoopFlag;
             int HalfLoopNum;
             int CurntMinPlantSubIterations;
+            int LoopMinPlantSubIterations;
 
-            if (std::any_of(PlantLoop.begin(), PlantLoop.end(), [](DataPlant::PlantLoopData const &e) {
+            auto const loopNeedsCommonPipeIterations = [](DataPlant::PlantLoopData const &e) {
                 return (e.CommonPipeType == DataPlant::CommonPipe_Single) ||
-                       (e.CommonPipeType == DataPlant::CommonPipe_TwoWay);
-            })) {
+                       (e.CommonPipeType == DataPlant::CommonPipe_TwoWay) || e.CommonPipeInLoopGroup;
+            };
+
+            if (std::any_of(PlantLoop.begin(), PlantLoop.end(), loopNeedsCommonPipeIterations)) {
                 CurntMinPlantSubIterations = max(7, MinPlantSubIterations);
             } else {
                 CurntMinPlantSubIterations = MinPlantSubIterations;
@@ -209,6 +222,7 @@ namespace EnergyPlus {
                 return;
             }
 
+            EP_TIMER_SCOPE("ManagePlantLoops");
             IterPlant = 0;
             InitializeLoops(FirstHVACIteration);
 
@@ -226,10 +240,27 @@ namespace EnergyPlus {
 
                     SimHalfLoopFlag = this_loop_side.SimLoopSideNeeded; // set half loop sim flag
 
-                    if (SimHalfLoopFlag || IterPlant <= CurntMinPlantSubIterations) {
+                    if (loopNeedsCommonPipeIterations(this_loop)) {
+                        LoopMinPlantSubIterations = CurntMinPlantSubIterations;
+                    } else {
+                        LoopMinPlantSubIterations = MinPlantSubIterations;
+                    }
+
+                    // a half loop only forced by the minimum sub iterations is skipped when its inputs have not changed
+                    if (!SimHalfLoopFlag && IterPlant <= LoopMinPlantSubIterations && !FirstHVACIteration &&
+                        DataSystemVariables::PlantHalfLoopChangeDetection && HalfLoopInputsUnchanged(LoopNum, LoopSide)) {
+                        continue;
+                    }
+
+                    if (SimHalfLoopFlag || IterPlant <= LoopMinPlantSubIterations) {
 
                         PlantHalfLoopSolver(FirstHVACIteration, LoopSide, LoopNum, other_loop_side.SimLoopSideNeeded);
 
+                        if (DataSystemVariables::PlantHalfLoopChangeDetection) {
+                            this_loop_side.LastSolveCount = ++HalfLoopSolveCount;
+                            GatherHalfLoopInputs(LoopNum, LoopSide, this_loop_side.SolvedInputTemps, this_loop_side.SolvedInputFlows);
+                        }
+
                         // Always set this side to false,  so that it won't keep being turned on just because of first hvac
                         this_loop_side.SimLoopSideNeeded = false;
 
@@ -281,6 +312,105 @@ namespace EnergyPlus {
             LogPlantConvergencePoints(FirstHVACIteration);
         }
 
+        void GatherHalfLoopInputs(int const LoopNum,
+                                  int const LoopSideNum,
+                                  std::vector<Real64> &Temps, // node and setpoint temperatures the half loop solution depends on
+                                  std::vector<Real64> &Flows  // node flow rates and requests the half loop solution depends on
+        ) {
+
+            // SUBROUTINE INFORMATION:
+            //       AUTHOR         na
+            //       DATE WRITTEN   October 2026
+            //       MODIFIED       na
+            //       RE-ENGINEERED  na
+
+            // PURPOSE OF THIS SUBROUTINE:
+            // Collect the node conditions and setpoints that determine the solution of a half loop
+
+            // METHODOLOGY EMPLOYED:
+            // The loop side inlet node carries the state of the other half loop. Component inlet and outlet
+            // nodes carry the flow requests and any temperatures written by models simulated outside the
+            // plant (e.g. water coils on the air side). The loop and loop side setpoints carry the demand.
+
+            auto const &loop(PlantLoop(LoopNum));
+            auto const &loop_side(loop.LoopSide(LoopSideNum));
+
+            Temps.clear();
+            Flows.clear();
+
+            auto const addNode = [&](int const NodeNum) {
+                if (NodeNum <= 0) return;
+                auto const &node(Node(NodeNum));
+                Temps.push_back(node.Temp);
+                Flows.push_back(node.MassFlowRate);
+                Flows.push_back(node.MassFlowRateRequest);
+            };
+
+            addNode(loop_side.NodeNumIn);
+            for (int BranchNum = 1; BranchNum <= loop_side.TotalBranches; ++BranchNum) {
+                auto const &branch(loop_side.Branch(BranchNum));
+                for (int CompNum = 1; CompNum <= branch.TotalComponents; ++CompNum) {
+                    addNode(branch.Comp(CompNum).NodeNumIn);
+                    addNode(branch.Comp(CompNum).NodeNumOut);
+                }
+            }
+
+            Temps.push_back(loop_side.TempSetPoint);
+            Temps.push_back(loop_side.TempSetPointHi);
+            Temps.push_back(loop_side.TempSetPointLo);
+            if (loop.TempSetPointNodeNum > 0) {
+                auto const &setpoint_node(Node(loop.TempSetPointNodeNum));
+                Temps.push_back(setpoint_node.TempSetPoint);
+                Temps.push_back(setpoint_node.TempSetPointHi);
+                Temps.push_back(setpoint_node.TempSetPointLo);
+            }
+        }
+
+        bool HalfLoopInputsUnchanged(int const LoopNum, int const LoopSideNum) {
+
+            // FUNCTION INFORMATION:
+            //       AUTHOR         na
+            //       DATE WRITTEN   October 2026
+            //       MODIFIED       na
+            //       RE-ENGINEERED  na
+
+            // PURPOSE OF THIS FUNCTION:
+            // Determine whether a half loop can keep its last solution instead of being resimulated
+
+            // METHODOLOGY EMPLOYED:
+            // The half loop is clean when none of its connected loop sides has been solved since it was,
+            // and its current inputs are within the plant convergence tolerances of the inputs seen by
+            // its last solution.
+
+            using DataConvergParams::PlantFlowRateToler;
+            using DataConvergParams::PlantTemperatureToler;
+
+            static std::vector<Real64> Temps;
+            static std::vector<Real64> Flows;
+
+            auto const &loop_side(PlantLoop(LoopNum).LoopSide(LoopSideNum));
+
+            if (loop_side.LastSolveCount == 0) return false;
+
+            if (allocated(loop_side.Connected)) {
+                for (auto const &connected : loop_side.Connected) {
+                    if (connected.LoopNum < 1 || connected.LoopSideNum < 1) return false;
+                    if (PlantLoop(connected.LoopNum).LoopSide(connected.LoopSideNum).LastSolveCount > loop_side.LastSolveCount) return false;
+                }
+            }
+
+            GatherHalfLoopInputs(LoopNum, LoopSideNum, Temps, Flows);
+            if (Temps.size() != loop_side.SolvedInputTemps.size() || Flows.size() != loop_side.SolvedInputFlows.size()) return false;
+
+            for (std::size_t i = 0; i < Temps.size(); ++i) {
+                if (std::abs(Temps[i] - loop_side.SolvedInputTemps[i]) > PlantTemperatureToler) return false;
+            }
+            for (std::size_t i = 0; i < Flows.size(); ++i) {
+                if (std::abs(Flows[i] - loop_side.SolvedInputFlows[i]) > PlantFlowRateToler) return false;
+            }
+            return true;
+        }
+
         void GetPlantLoopData() {
 
             // SUBROUTINE INFORMATION:
@@ -2456,6 +2586,7 @@ namespace EnergyPlus {
                     // have now called each plant component model at least once with InitLoopEquip = .TRUE.
                     //  this means the calls to InterConnectTwoPlantLoopSides have now been made, so rework calling order
                     RevisePlantCallingOrder();
+                    SetupPlantLoopGroups();
 
                     // Step 4: Simulate plant loop components so their design flows are included
 
@@ -3812,6 +3943,134 @@ namespace EnergyPlus {
             }
         }
 
+        void SetupPlantLoopGroups() {
+
+            // SUBROUTINE INFORMATION:
+            //       AUTHOR         na
+            //       DATE WRITTEN   October 2026
+            //       MODIFIED       na
+            //       RE-ENGINEERED  na
+
+            // PURPOSE OF THIS SUBROUTINE:
+            // Partition the plant loops into groups that interact through connection components
+
+            // METHODOLOGY EMPLOYED:
+            // Loops joined by an entry in a loop side Connected array belong to the same group.
+            // Groups are labeled by repeatedly propagating the smallest loop index across connections.
+            // A group that contains a common pipe loop is flagged so that every loop in it gets the
+            // common pipe minimum sub iterations in ManagePlantLoops.
+
+            int LoopNum;
+            int LoopSideNum;
+            int ConnctNum;
+            int OtherLoopNum;
+            bool Changed;
+
+            for (LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum) {
+                PlantLoop(LoopNum).LoopGroup = LoopNum;
+            }
+
+            Changed = true;
+            while (Changed) {
+                Changed = false;
+                for (LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum) {
+                    for (LoopSideNum = DemandSide; LoopSideNum <= SupplySide; ++LoopSideNum) {
+                        auto const &this_loop_side(PlantLoop(LoopNum).LoopSide(LoopSideNum));
+                        if (!allocated(this_loop_side.Connected)) continue;
+                        for (ConnctNum = 1; ConnctNum <= isize(this_loop_side.Connected); ++ConnctNum) {
+                            OtherLoopNum = this_loop_side.Connected(ConnctNum).LoopNum;
+                            if (OtherLoopNum < 1 || OtherLoopNum > TotNumLoops) continue;
+                            int const Group = min(PlantLoop(LoopNum).LoopGroup, PlantLoop(OtherLoopNum).LoopGroup);
+                            if (PlantLoop(LoopNum).LoopGroup != Group || PlantLoop(OtherLoopNum).LoopGroup != Group) {
+                                PlantLoop(LoopNum).LoopGroup = Group;
+                                PlantLoop(OtherLoopNum).LoopGroup = Group;
+                                Changed = true;
+                            }
+                        }
+                    }
+                }
+            }
+
+            for (LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum) {
+                auto &this_loop(PlantLoop(LoopNum));
+                this_loop.CommonPipeInLoopGroup = false;
+                for (OtherLoopNum = 1; OtherLoopNum <= TotNumLoops; ++OtherLoopNum) {
+                    if (PlantLoop(OtherLoopNum).LoopGroup != this_loop.LoopGroup) continue;
+                    if (PlantLoop(OtherLoopNum).CommonPipeType != CommonPipe_No) {
+                        this_loop.CommonPipeInLoopGroup = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        void ReportPlantComponentTimings() {
+
+            // SUBROUTINE INFORMATION:
+            //       AUTHOR         na
+            //       DATE WRITTEN   October 2026
+            //       MODIFIED       na
+            //       RE-ENGINEERED  na
+
+            // PURPOSE OF THIS SUBROUTINE:
+            // Write the plant component timings to <prefix>_planttiming.csv at the end of the run
+            // when the PlantComponentTimings environment variable is set
+
+            if (!DataSystemVariables::PlantComponentTimings || TotNumLoops <= 0) return;
+
+            std::ofstream Timings(DataStringGlobals::outputPlantTimingCsvFileName);
+            if (Timings) WritePlantComponentTimings(Timings);
+        }
+
+        void WritePlantComponentTimings(std::ostream &Timings) {
+
+            // SUBROUTINE INFORMATION:
+            //       AUTHOR         na
+            //       DATE WRITTEN   October 2026
+            //       MODIFIED       na
+            //       RE-ENGINEERED  na
+
+            // PURPOSE OF THIS SUBROUTINE:
+            // Write the accumulated simulation time and call count of each plant component as CSV
+
+            // METHODOLOGY EMPLOYED:
+            // SimPlantEquip accumulates wall time on each component for every call made during the loop
+            // simulation. Components are listed with the most expensive first. Times include any models
+            // a component calls itself, e.g. the tank of a water heater.
+
+            struct ComponentTiming
+            {
+                int LoopNum;
+                int LoopSideNum;
+                DataPlant::CompData const *Comp;
+            };
+            static Array1D_string const LoopSideName(2, {"Demand", "Supply"});
+
+            std::vector<ComponentTiming> Components;
+            for (int LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum) {
+                for (int LoopSideNum = DemandSide; LoopSideNum <= SupplySide; ++LoopSideNum) {
+                    auto const &loop_side(PlantLoop(LoopNum).LoopSide(LoopSideNum));
+                    for (int BranchNum = 1; BranchNum <= loop_side.TotalBranches; ++BranchNum) {
+                        auto const &branch(loop_side.Branch(BranchNum));
+                        for (int CompNum = 1; CompNum <= branch.TotalComponents; ++CompNum) {
+                            Components.push_back({LoopNum, LoopSideNum, &branch.Comp(CompNum)});
+                        }
+                    }
+                }
+            }
+            std::stable_sort(Components.begin(), Components.end(), [](ComponentTiming const &a, ComponentTiming const &b) {
+                return a.Comp->SimulationTime > b.Comp->SimulationTime;
+            });
+
+            Timings << "Plant Loop,Loop Side,Component Type,Component Name,Calls,Total Time {s},Average Time {us}\n";
+            for (auto const &component : Components) {
+                auto const &comp(*component.Comp);
+                Timings << PlantLoop(component.LoopNum).Name << ',' << LoopSideName(component.LoopSideNum) << ',' << comp.TypeOf << ','
+                        << comp.Name << ',' << comp.SimulationCalls << ',' << comp.SimulationTime << ','
+                        << (comp.SimulationCalls > 0 ? 1.0e6 * comp.SimulationTime / comp.SimulationCalls : 0.0) << '\n';
+            }
+        }
+
         int FindLoopSideInCallingOrder(int const LoopNum, int const LoopSide) {
 
             // FUNCTION INFORMATION:
@@ -48,6 +48,10 @@
 #ifndef PlantManager_hh_INCLUDED
 #define PlantManager_hh_INCLUDED
 
+// C++ Headers
+#include <iosfwd>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -112,6 +116,10 @@ namespace PlantManager {
                           bool &SimElecCircuits      // True when electic circuits need to be (re)simulated
     );
 
+    void GatherHalfLoopInputs(int const LoopNum, int const LoopSideNum, std::vector<Real64> &Temps, std::vector<Real64> &Flows);
+
+    bool HalfLoopInputsUnchanged(int const LoopNum, int const LoopSideNum);
+
     void GetPlantLoopData();
 
     void GetPlantInput();
@@ -137,6 +145,12 @@ namespace PlantManager {
 
     void RevisePlantCallingOrder();
 
+    void SetupPlantLoopGroups();
+
+    void ReportPlantComponentTimings();
+
+    void WritePlantComponentTimings(std::ostream &Timings);
+
     int FindLoopSideInCallingOrder(int const LoopNum, int const LoopSide);
 
     void StoreAPumpOnCurrentTempLoop(int const LoopNum,
@@ -47,6 +47,7 @@
 
 // C++ Headers
 #include <algorithm>
+#include <chrono>
 
 // ObjexxFCL Headers
 
@@ -66,6 +67,7 @@
 #include <DataLoopNode.hh>
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <EvaporativeFluidCoolers.hh>
 #include <FluidCoolers.hh>
 #include <FuelCellElectricGenerator.hh>
@@ -136,6 +138,27 @@ namespace PlantLoopEquip {
 
     // MODULE SUBROUTINES
 
+    namespace {
+        // Adds the wall time of one component simulation to the component when plant timings are requested
+        struct ComponentSimulationTimer
+        {
+            CompData *comp;
+            std::chrono::steady_clock::time_point start;
+
+            explicit ComponentSimulationTimer(CompData *comp) : comp(comp)
+            {
+                if (comp != nullptr) start = std::chrono::steady_clock::now();
+            }
+
+            ~ComponentSimulationTimer()
+            {
+                if (comp == nullptr) return;
+                comp->SimulationTime += std::chrono::duration<Real64>(std::chrono::steady_clock::now() - start).count();
+                ++comp->SimulationCalls;
+            }
+        };
+    } // namespace
+
     // Functions
 
     void SimPlantEquip(int const LoopNum,     // loop counter
@@ -251,6 +274,10 @@ namespace PlantLoopEquip {
         // set up a reference for this component
         auto &sim_component(PlantLoop(LoopNum).LoopSide(LoopSideNum).Branch(BranchNum).Comp(Num));
 
+        // only the loop simulation calls are timed, not the one time initialization and sizing calls
+        ComponentSimulationTimer const simulationTimer(
+            (DataSystemVariables::PlantComponentTimings && !InitLoopEquip && !GetCompSizFac) ? &sim_component : nullptr);
+
         static std::vector<int> compsToSimAfterInitLoopEquip = {TypeOf_Pipe, TypeOf_PipeSteam};
 
         // set local variables
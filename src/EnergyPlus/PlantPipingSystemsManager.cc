@@ -52,6 +52,7 @@
 #include <memory>
 #include <set>
 #include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -60,6 +61,9 @@
 #include <ObjexxFCL/gio.hh>
 #include <ObjexxFCL/string.functions.hh>
 
+// Eigen Headers
+#include <Eigen/SparseLU>
+
 // EnergyPlus Headers
 #include <BranchNodeConnections.hh>
 #include <DataEnvironment.hh>
@@ -73,6 +77,7 @@
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
 #include <GlobalNames.hh>
@@ -128,6 +133,27 @@ namespace EnergyPlus {
         bool WriteEIOFlag(true); // False after EIO is written
 #pragma clang diagnostic pop
 
+        struct DomainFieldArrays {
+            // Members
+            // Flat form of the temperature field update: for updated cell i, T = Constant(i) + sum over k of
+            // Coefficient(i, k) * Temperature(Neighbor(i, k)), where Temperature holds every cell of the domain (X-major)
+            static int const NumNeighbors = 6;
+            std::vector<int> FieldCells;          // index in Temperature of each updated cell, in sweep order
+            std::vector<int> CellFieldNum;        // updated cell number of each cell, -1 for cells held fixed (pipe, cutaway)
+            std::vector<int> FixedCells;          // index in Temperature of each cell held fixed
+            std::vector<Point3DInteger> CellIndexes; // X, Y, Z of each cell
+            std::vector<Real64> Temperature;      // all cells
+            std::vector<Real64> Constant;         // per updated cell: capacitance and boundary terms over the update denominator
+            std::vector<int> Neighbor;            // NumNeighbors per updated cell, padded with the cell itself
+            std::vector<Real64> Coefficient;      // per neighbor: conductance times Beta over the update denominator
+            // Sparse implicit form, used with PipingSystemsSparseSolver
+            Eigen::SparseMatrix<Real64> Matrix;   // I - A over the updated cells; A holds the coefficients between them
+            Eigen::SparseLU<Eigen::SparseMatrix<Real64>> LU; // factors of Matrix
+            std::vector<Real64> FactoredValues;   // nonzeros of Matrix when it was last factored
+            bool PatternAnalyzed = false;
+            bool Factored = false;
+        };
+
         void clear_state() {
             GetInputFlag = true;
             GetSegmentInputFlag = true;
@@ -4087,11 +4113,23 @@ namespace EnergyPlus {
 
             // Always do start of time step inits
             this->DoStartOfTimeStepInitializations();
+            if ((DataSystemVariables::PipingSystemsSparseSolver || DataSystemVariables::PipingSystemsFlatCellArrays) &&
+                this->DomainNeedsSimulation) {
+                this->AssembleFieldArrays();
+            }
 
             // Begin iterating for this time step
             for (int IterationIndex = 1; IterationIndex <= this->SimControls.MaxIterationsPerTS; ++IterationIndex) {
                 this->ShiftTemperaturesForNewIteration();
-                if (this->DomainNeedsSimulation) this->PerformTemperatureFieldUpdate();
+                if (this->DomainNeedsSimulation) {
+                    if (DataSystemVariables::PipingSystemsSparseSolver) {
+                        this->PerformSparseTemperatureFieldUpdate();
+                    } else if (DataSystemVariables::PipingSystemsFlatCellArrays) {
+                        this->PerformFlatTemperatureFieldUpdate();
+                    } else {
+                        this->PerformTemperatureFieldUpdate();
+                    }
+                }
                 bool FinishedIterationLoop = false;
                 this->DoEndOfIterationOperations(FinishedIterationLoop);
                 if (FinishedIterationLoop) break;
@@ -4123,6 +4161,10 @@ namespace EnergyPlus {
             if (this->HasAPipeCircuit) {
                 this->PreparePipeCircuitSimulation(thisCircuit);
             }
+            if ((DataSystemVariables::PipingSystemsSparseSolver || DataSystemVariables::PipingSystemsFlatCellArrays) &&
+                this->DomainNeedsSimulation) {
+                this->AssembleFieldArrays();
+            }
 
             // Begin iterating for this time step
             for (int IterationIndex = 1; IterationIndex <= this->SimControls.MaxIterationsPerTS; ++IterationIndex) {
@@ -4133,7 +4175,15 @@ namespace EnergyPlus {
                     this->PerformPipeCircuitSimulation(thisCircuit);
                 }
 
-                if (this->DomainNeedsSimulation) this->PerformTemperatureFieldUpdate();
+                if (this->DomainNeedsSimulation) {
+                    if (DataSystemVariables::PipingSystemsSparseSolver) {
+                        this->PerformSparseTemperatureFieldUpdate();
+                    } else if (DataSystemVariables::PipingSystemsFlatCellArrays) {
+                        this->PerformFlatTemperatureFieldUpdate();
+                    } else {
+                        this->PerformTemperatureFieldUpdate();
+                    }
+                }
                 bool FinishedIterationLoop = false;
                 this->DoEndOfIterationOperations(FinishedIterationLoop);
 
@@ -4163,44 +4213,285 @@ namespace EnergyPlus {
                 for (int Y = 0, Y_end = this->y_max_index; Y <= Y_end; ++Y) {
                     for (int Z = 0, Z_end = this->z_max_index; Z <= Z_end; ++Z) {
                         auto &cell(this->Cells(X, Y, Z));
+                        cell.Temperature = this->EvaluateCellTemperature(cell);
+                    }
+                }
+            }
+        }
 
-                        switch (cell.cellType) {
-                            case CellType::Pipe:
-                                //'pipes are simulated separately
-                                break;
-                            case CellType::GeneralField:
-                            case CellType::Slab:
-                            case CellType::HorizInsulation:
-                            case CellType::VertInsulation:
-                                cell.Temperature = this->EvaluateFieldCellTemperature(cell);
-                                break;
-                            case CellType::GroundSurface:
-                                cell.Temperature = this->EvaluateGroundSurfaceTemperature(cell);
-                                break;
-                            case CellType::FarfieldBoundary:
-                                cell.Temperature = this->EvaluateFarfieldBoundaryTemperature(cell);
-                                break;
-                            case CellType::BasementWall:
-                            case CellType::BasementCorner:
-                            case CellType::BasementFloor:
-                                // basement model, zone-coupled. Call EvaluateZoneInterfaceTemperature routine to handle timestep/hourly simulation.
-                                if (this->HasZoneCoupledBasement) {
-                                    cell.Temperature = this->EvaluateZoneInterfaceTemperature(cell);
-                                } else { // FHX model
-                                    cell.Temperature = this->EvaluateBasementCellTemperature(cell);
-                                }
-                                break;
-                            case CellType::ZoneGroundInterface:
-                                cell.Temperature = this->EvaluateZoneInterfaceTemperature(cell);
-                                break;
-                            case CellType::BasementCutaway:
-                                // it's ok to not simulate this one
-                                break;
-                            case CellType::Unknown:
-                                assert(false);
+        Real64 Domain::EvaluateCellTemperature(CartesianCell &cell) {
+
+            // FUNCTION INFORMATION:
+            //       AUTHOR         Edwin Lee
+            //       DATE WRITTEN   Summer 2011
+            //       MODIFIED       October 2026, split out of PerformTemperatureFieldUpdate
+            //       RE-ENGINEERED  na
+
+            // PURPOSE OF THIS FUNCTION:
+            // Returns the updated temperature of a cell given the current temperatures of its neighbors.
+            // Cells that are not part of the field update return their current temperature.
+
+            switch (cell.cellType) {
+                case CellType::Pipe:
+                    //'pipes are simulated separately
+                    break;
+                case CellType::GeneralField:
+                case CellType::Slab:
+                case CellType::HorizInsulation:
+                case CellType::VertInsulation:
+                    return this->EvaluateFieldCellTemperature(cell);
+                case CellType::GroundSurface:
+                    return this->EvaluateGroundSurfaceTemperature(cell);
+                case CellType::FarfieldBoundary:
+                    return this->EvaluateFarfieldBoundaryTemperature(cell);
+                case CellType::BasementWall:
+                case CellType::BasementCorner:
+                case CellType::BasementFloor:
+                    // basement model, zone-coupled. Call EvaluateZoneInterfaceTemperature routine to handle timestep/hourly simulation.
+                    if (this->HasZoneCoupledBasement) {
+                        return this->EvaluateZoneInterfaceTemperature(cell);
+                    } else { // FHX model
+                        return this->EvaluateBasementCellTemperature(cell);
+                    }
+                case CellType::ZoneGroundInterface:
+                    return this->EvaluateZoneInterfaceTemperature(cell);
+                case CellType::BasementCutaway:
+                    // it's ok to not simulate this one
+                    break;
+                case CellType::Unknown:
+                    assert(false);
+            }
+            return cell.Temperature;
+        }
+
+        void Domain::AssembleFieldArrays() {
+
+            // SUBROUTINE INFORMATION:
+            //       AUTHOR         na
+            //       DATE WRITTEN   October 2026
+            //       MODIFIED       na
+            //       RE-ENGINEERED  na
+
+            // PURPOSE OF THIS SUBROUTINE:
+            // Sets up the flat arrays of the temperature field update for this time step and, with the sparse solver,
+            // factors the linear system whose solution is the converged result of the sweeps.
+
+            // METHODOLOGY EMPLOYED:
+            // Within a time step each cell update T_i = f_i(T) is affine in the temperatures of its six neighbors (cell
+            // properties, boundary temperatures and heat fluxes are fixed at the start of the time step), so it can be
+            // stored as a constant plus six neighbor coefficients. Rather than restating each cell type's heat balance, these
+            // are read off the existing cell updates: with every cell at zero the updates give the constants, and with the
+            // cells of one color set to one they give the constant plus the coefficient of the single neighbor of that color.
+            // Coloring cells by (X + 2Y + 3Z) mod 7 gives each of a cell's six neighbors and the cell itself a different
+            // color, so seven probes recover all coefficients, including those to pipe and cutaway cells, which are not
+            // updated here but whose temperatures enter the updates.
+            // For the sparse solver the pattern is fixed by the mesh, so it is analyzed once; the factors are reused for as
+            // long as the coefficients are unchanged, which holds across the plant iterations of a time step and across time
+            // steps with the same step size, wind speed and unfrozen soil.
+
+            int const NumNeighbors = DomainFieldArrays::NumNeighbors;
+            int const NY = this->y_max_index + 1;
+            int const NZ = this->z_max_index + 1;
+            if (!this->FieldArrays) {
+                this->FieldArrays = std::make_shared<DomainFieldArrays>();
+                auto &fields(*this->FieldArrays);
+                fields.CellFieldNum.assign(this->Cells.size(), -1);
+                fields.Temperature.resize(this->Cells.size());
+                for (int X = 0, X_end = this->x_max_index; X <= X_end; ++X) {
+                    for (int Y = 0, Y_end = this->y_max_index; Y <= Y_end; ++Y) {
+                        for (int Z = 0, Z_end = this->z_max_index; Z <= Z_end; ++Z) {
+                            int const cellNum = static_cast<int>(fields.CellIndexes.size());
+                            fields.CellIndexes.emplace_back(X, Y, Z);
+                            auto const &cell(this->Cells(X, Y, Z));
+                            if (cell.cellType == CellType::Pipe || cell.cellType == CellType::BasementCutaway) {
+                                fields.FixedCells.push_back(cellNum);
+                                continue;
+                            }
+                            fields.CellFieldNum[cellNum] = static_cast<int>(fields.FieldCells.size());
+                            fields.FieldCells.push_back(cellNum);
                         }
                     }
                 }
+                fields.Constant.resize(fields.FieldCells.size());
+                fields.Neighbor.resize(fields.FieldCells.size() * NumNeighbors);
+                fields.Coefficient.resize(fields.FieldCells.size() * NumNeighbors);
+            }
+            auto &fields(*this->FieldArrays);
+            int const NumCells = static_cast<int>(fields.CellIndexes.size());
+            int const NumFieldCells = static_cast<int>(fields.FieldCells.size());
+            auto const cellOf = [this, &fields](int const cellNum) -> CartesianCell & {
+                auto const &index(fields.CellIndexes[cellNum]);
+                return this->Cells(index.X, index.Y, index.Z);
+            };
+            auto const color = [](CartesianCell const &cell) {
+                return (cell.X_index + 2 * cell.Y_index + 3 * cell.Z_index) % 7;
+            };
+            // Cell number of the neighbor of cell in the direction with the given color offset, -1 if outside the domain
+            auto const neighborOf = [this, NY, NZ](CartesianCell const &cell, int const offset) {
+                static int const dX[] = {0, 1, 0, 0, 0, 0, -1};
+                static int const dY[] = {0, 0, 1, 0, 0, -1, 0};
+                static int const dZ[] = {0, 0, 0, 1, -1, 0, 0};
+                int const X = cell.X_index + dX[offset];
+                int const Y = cell.Y_index + dY[offset];
+                int const Z = cell.Z_index + dZ[offset];
+                if (X < 0 || X > this->x_max_index || Y < 0 || Y > this->y_max_index || Z < 0 || Z > this->z_max_index) return -1;
+                return (X * NY + Y) * NZ + Z;
+            };
+
+            for (int cellNum = 0; cellNum < NumCells; ++cellNum) {
+                fields.Temperature[cellNum] = cellOf(cellNum).Temperature;
+                cellOf(cellNum).Temperature = 0.0;
+            }
+            std::vector<Real64> selfCoefficient(NumFieldCells, 0.0);
+            std::vector<int> numNeighbors(NumFieldCells, 0);
+            for (int i = 0; i < NumFieldCells; ++i) {
+                fields.Constant[i] = this->EvaluateCellTemperature(cellOf(fields.FieldCells[i]));
+            }
+            for (int probeColor = 0; probeColor < 7; ++probeColor) {
+                for (int cellNum = 0; cellNum < NumCells; ++cellNum) {
+                    auto &cell(cellOf(cellNum));
+                    cell.Temperature = (color(cell) == probeColor) ? 1.0 : 0.0;
+                }
+                for (int i = 0; i < NumFieldCells; ++i) {
+                    auto &cell(cellOf(fields.FieldCells[i]));
+                    int const offset = (probeColor - color(cell) + 7) % 7;
+                    Real64 const coefficient = this->EvaluateCellTemperature(cell) - fields.Constant[i];
+                    if (offset == 0) {
+                        selfCoefficient[i] = coefficient;
+                        continue;
+                    }
+                    int const j = neighborOf(cell, offset);
+                    if (j < 0) continue;
+                    fields.Neighbor[i * NumNeighbors + numNeighbors[i]] = j;
+                    fields.Coefficient[i * NumNeighbors + numNeighbors[i]] = coefficient;
+                    ++numNeighbors[i];
+                }
+            }
+            for (int cellNum = 0; cellNum < NumCells; ++cellNum) {
+                cellOf(cellNum).Temperature = fields.Temperature[cellNum];
+            }
+
+            // Solve each update for its own cell (a cell update does not normally depend on the cell itself), and pad the
+            // neighbor lists so the sweeps have a fixed trip count
+            for (int i = 0; i < NumFieldCells; ++i) {
+                Real64 const scale = 1.0 / (1.0 - selfCoefficient[i]);
+                fields.Constant[i] *= scale;
+                for (int k = 0; k < NumNeighbors; ++k) {
+                    if (k < numNeighbors[i]) {
+                        fields.Coefficient[i * NumNeighbors + k] *= scale;
+                    } else {
+                        fields.Neighbor[i * NumNeighbors + k] = fields.FieldCells[i];
+                        fields.Coefficient[i * NumNeighbors + k] = 0.0;
+                    }
+                }
+            }
+
+            if (!DataSystemVariables::PipingSystemsSparseSolver) return;
+
+            std::vector<Eigen::Triplet<Real64>> entries;
+            entries.reserve(NumFieldCells * (NumNeighbors + 1));
+            for (int i = 0; i < NumFieldCells; ++i) {
+                entries.emplace_back(i, i, 1.0);
+                for (int k = 0; k < NumNeighbors; ++k) {
+                    int const j = fields.CellFieldNum[fields.Neighbor[i * NumNeighbors + k]];
+                    if (j < 0 || j == i) continue;
+                    entries.emplace_back(i, j, -fields.Coefficient[i * NumNeighbors + k]);
+                }
+            }
+            fields.Matrix.resize(NumFieldCells, NumFieldCells);
+            fields.Matrix.setFromTriplets(entries.begin(), entries.end());
+            fields.Matrix.makeCompressed();
+
+            std::vector<Real64> const values(fields.Matrix.valuePtr(), fields.Matrix.valuePtr() + fields.Matrix.nonZeros());
+            if (fields.Factored && values == fields.FactoredValues) return;
+            if (!fields.PatternAnalyzed) {
+                fields.LU.analyzePattern(fields.Matrix);
+                fields.PatternAnalyzed = true;
+            }
+            fields.LU.factorize(fields.Matrix);
+            fields.Factored = (fields.LU.info() == Eigen::Success);
+            fields.FactoredValues = values;
+        }
+
+        void Domain::PerformFlatTemperatureFieldUpdate() {
+
+            // SUBROUTINE INFORMATION:
+            //       AUTHOR         na
+            //       DATE WRITTEN   October 2026
+            //       MODIFIED       na
+            //       RE-ENGINEERED  na
+
+            // PURPOSE OF THIS SUBROUTINE:
+            // Same sweep as PerformTemperatureFieldUpdate (same cells, same order, updated in place), done over the flat
+            // arrays from AssembleFieldArrays instead of the cell objects.
+
+            auto &fields(*this->FieldArrays);
+            int const NumNeighbors = DomainFieldArrays::NumNeighbors;
+            int const NumFieldCells = static_cast<int>(fields.FieldCells.size());
+
+            // pipe cells are updated by the pipe circuit between sweeps
+            for (int const cellNum : fields.FixedCells) {
+                auto const &index(fields.CellIndexes[cellNum]);
+                fields.Temperature[cellNum] = this->Cells(index.X, index.Y, index.Z).Temperature;
+            }
+
+            Real64 *const temperature = fields.Temperature.data();
+            int const *const neighbor = fields.Neighbor.data();
+            Real64 const *const coefficient = fields.Coefficient.data();
+            for (int i = 0; i < NumFieldCells; ++i) {
+                Real64 newTemp = fields.Constant[i];
+                for (int k = 0; k < NumNeighbors; ++k) {
+                    newTemp += coefficient[i * NumNeighbors + k] * temperature[neighbor[i * NumNeighbors + k]];
+                }
+                temperature[fields.FieldCells[i]] = newTemp;
+            }
+
+            for (int i = 0; i < NumFieldCells; ++i) {
+                auto const &index(fields.CellIndexes[fields.FieldCells[i]]);
+                this->Cells(index.X, index.Y, index.Z).Temperature = temperature[fields.FieldCells[i]];
+            }
+        }
+
+        void Domain::PerformSparseTemperatureFieldUpdate() {
+
+            // SUBROUTINE INFORMATION:
+            //       AUTHOR         na
+            //       DATE WRITTEN   October 2026
+            //       MODIFIED       na
+            //       RE-ENGINEERED  na
+
+            // PURPOSE OF THIS SUBROUTINE:
+            // Replaces one sweep of PerformTemperatureFieldUpdate by the converged field for the current pipe cell
+            // temperatures, using the factors from AssembleFieldArrays.
+
+            if (!this->FieldArrays || !this->FieldArrays->Factored) {
+                // singular or not assembled, keep sweeping
+                this->PerformTemperatureFieldUpdate();
+                return;
+            }
+            auto &fields(*this->FieldArrays);
+            int const NumNeighbors = DomainFieldArrays::NumNeighbors;
+            int const NumFieldCells = static_cast<int>(fields.FieldCells.size());
+            auto const cellOf = [this, &fields](int const cellNum) -> CartesianCell & {
+                auto const &index(fields.CellIndexes[cellNum]);
+                return this->Cells(index.X, index.Y, index.Z);
+            };
+
+            // The pipe cell temperatures change between iterations, so they go with the constants on the right-hand side
+            Eigen::VectorXd rhs(NumFieldCells);
+            for (int i = 0; i < NumFieldCells; ++i) {
+                rhs(i) = fields.Constant[i];
+                for (int k = 0; k < NumNeighbors; ++k) {
+                    int const cellNum = fields.Neighbor[i * NumNeighbors + k];
+                    if (fields.CellFieldNum[cellNum] < 0) {
+                        rhs(i) += fields.Coefficient[i * NumNeighbors + k] * cellOf(cellNum).Temperature;
+                    }
+                }
+            }
+
+            Eigen::VectorXd const solution(fields.LU.solve(rhs));
+            for (int i = 0; i < NumFieldCells; ++i) {
+                cellOf(fields.FieldCells[i]).Temperature = solution(i);
             }
         }
 
@@ -672,6 +672,9 @@ namespace EnergyPlus {
             }
         };
 
+        // Flat and sparse implicit forms of the temperature field update, defined in the implementation file
+        struct DomainFieldArrays;
+
         struct Domain {
             // Members
             // ID
@@ -771,6 +774,9 @@ namespace EnergyPlus {
             std::vector<Direction> NeighborFieldCells;
             std::vector<Direction> NeighborBoundaryCells;
 
+            // Flat and factored field updates used with PipingSystemsFlatCellArrays or PipingSystemsSparseSolver, created on first use
+            std::shared_ptr<DomainFieldArrays> FieldArrays;
+
             // Default Constructor
             Domain()
                     : MaxIterationsPerTS(10), OneTimeInit(true), BeginSimInit(true), BeginSimEnvironment(true),
@@ -894,6 +900,14 @@ namespace EnergyPlus {
 
             void PerformTemperatureFieldUpdate();
 
+            Real64 EvaluateCellTemperature(CartesianCell &cell);
+
+            void AssembleFieldArrays();
+
+            void PerformFlatTemperatureFieldUpdate();
+
+            void PerformSparseTemperatureFieldUpdate();
+
             Real64 EvaluateFieldCellTemperature(CartesianCell &ThisCell);
 
             Real64 EvaluateGroundSurfaceTemperature(CartesianCell &cell);
@@ -47,6 +47,7 @@
 
 // C++ Headers
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 
 // ObjexxFCL Headers
@@ -58,6 +59,8 @@
 #include <CommandLineInterface.hh>
 #include <DataEnvironment.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <General.hh>
 #include <Psychrometrics.hh>
 #include <UtilityRoutines.hh>
@@ -133,7 +136,6 @@ namespace Psychrometrics {
     int const iPsyPsatFnTemp_cache(19);
     int const NumPsychMonitors(19); // Parameterization of Number of psychrometric routines that
     std::string const blank_string;
-#ifdef EP_psych_stats
     Array1D_string const PsyRoutineNames(NumPsychMonitors,
                                          {"PsyTdpFnTdbTwbPb",
                                           "PsyRhFnTdbWPb",
@@ -183,40 +185,55 @@ namespace Psychrometrics {
                                             // PsyRhFnTdbRhovLBnd0C 13 | PsyTwbFnTdbWPb       14 - HR | PsyTwbFnTdbWPb       15 - max iter |
                                             // PsyWFnTdbTwbPb       16 - HR | PsyTsatFnPb          17 - max iter | PsyTwbFnTdbWPb_cache 18 -
                                             // PsyTwbFnTdbWPb_raw (raw calc) | PsyPsatFnTemp_cache  19 - PsyPsatFnTemp_raw (raw calc)
-#endif
 
 #ifndef EP_psych_errors
     Real64 const KelvinConv(273.15);
 #endif
 
 #ifdef EP_cache_PsyTwbFnTdbWPb
-    int const twbcache_size(1024 * 1024);
     int const twbprecision_bits(20);
 #endif
 #ifdef EP_cache_PsyPsatFnTemp
-    int const psatcache_size(1024 * 1024);
     int const psatprecision_bits(24); // 28  // 24  // 32
-    Int64 const psatcache_mask(psatcache_size - 1);
 #endif
 
+    int const tsattable_size(4096);            // Intervals of the PsyTsatFnPb table, evenly spaced in ln(pressure)
+    Real64 const tsattable_pmin(1.0);          // Lowest pressure covered by the PsyTsatFnPb table {Pascals}
+    Real64 const tsattable_pmax(500000.0);     // Highest pressure covered by the PsyTsatFnPb table {Pascals} (about 152C)
+    Real64 const tsattable_freeze_pmin(600.0); // Pressure band around the discontinuity of saturation pressure at 0C
+    Real64 const tsattable_freeze_pmax(625.0); //  that is always left to the iteration {Pascals}
+    Real64 const tsattable_tolerance(0.0001);  // Largest accepted interpolation error {C} (PsyTsatFnPb iteration tolerance)
+
     // MODULE VARIABLE DECLARATIONS:
     // na
 
     // MODULE VARIABLE DEFINITIONS:
+#ifdef EP_cache_PsyTwbFnTdbWPb
+    int twbcache_size(1024 * 1024); // Power of two set from DataSystemVariables::PsychrometricCacheBits
+#endif
+#ifdef EP_cache_PsyPsatFnTemp
+    int psatcache_size(1024 * 1024); // Power of two set from DataSystemVariables::PsychrometricCacheBits
+    Int64 psatcache_mask(psatcache_size - 1);
+#endif
     std::string String;
     bool ReportErrors(true);
     Array1D_int iPsyErrIndex(NumPsychMonitors, 0); // Number of times error occurred
-#ifdef EP_psych_stats
     Array1D<Int64> NumTimesCalled(NumPsychMonitors, 0);
-    Array1D_int NumIterations(NumPsychMonitors, 0);
-#endif
+    Array1D<Int64> NumIterations(NumPsychMonitors, 0);
+    Array1D_int MaxIterations(NumPsychMonitors, 0);
+
+    bool TsatTableActive(false);     // True when PsyTsatFnPb interpolates in TsatTable
+    Real64 TsatTableMaxError(0.0);   // Largest difference between the table and the iteration found by the table check {C}
+    Real64 TsatTableLnPMin(0.0);     // ln(tsattable_pmin)
+    Real64 TsatTableDeltaLnP(0.0);   // ln(pressure) step of the table
+    Array1D<Real64> TsatTable;       // DIMENSION(0:tsattable_size) saturation temperature at the table pressures {C}
 
     // Object Data
 #ifdef EP_cache_PsyTwbFnTdbWPb
-    Array1D<cached_twb_t> cached_Twb; // DIMENSION(0:twbcache_size)
+    EP_PSYCH_THREAD_LOCAL Array1D<cached_twb_t> cached_Twb; // DIMENSION(0:twbcache_size)
 #endif
 #ifdef EP_cache_PsyPsatFnTemp
-    Array1D<cached_psat_t> cached_Psat; // DIMENSION(0:psatcache_size)
+    EP_PSYCH_THREAD_LOCAL Array1D<cached_psat_t> cached_Psat; // DIMENSION(0:psatcache_size)
 #endif
 
     // Subroutine Specifications for the Module
@@ -228,16 +245,21 @@ namespace Psychrometrics {
         String = "";
         ReportErrors = true;
         iPsyErrIndex = Array1D_int(NumPsychMonitors, 0);
-#ifdef EP_psych_stats
         NumTimesCalled = Array1D<Int64>(NumPsychMonitors, 0);
-        NumIterations = Array1D_int(NumPsychMonitors, 0);
-#endif
+        NumIterations = Array1D<Int64>(NumPsychMonitors, 0);
+        MaxIterations = Array1D_int(NumPsychMonitors, 0);
 #ifdef EP_cache_PsyTwbFnTdbWPb
+        twbcache_size = 1024 * 1024;
         cached_Twb.deallocate();
 #endif
 #ifdef EP_cache_PsyPsatFnTemp
+        psatcache_size = 1024 * 1024;
+        psatcache_mask = psatcache_size - 1;
         cached_Psat.deallocate();
 #endif
+        TsatTableActive = false;
+        TsatTableMaxError = 0.0;
+        TsatTable.deallocate();
     }
 
     void InitializePsychRoutines()
@@ -276,12 +298,55 @@ namespace Psychrometrics {
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
         // na
 
+        // Caches of other threads are (re)allocated by their next cached call, which compares their size to this one
 #ifdef EP_cache_PsyTwbFnTdbWPb
+        twbcache_size = 1 << DataSystemVariables::PsychrometricCacheBits;
+        cached_Twb.deallocate();
         cached_Twb.allocate({0, twbcache_size});
 #endif
 #ifdef EP_cache_PsyPsatFnTemp
+        psatcache_size = 1 << DataSystemVariables::PsychrometricCacheBits;
+        psatcache_mask = psatcache_size - 1;
+        cached_Psat.deallocate();
         cached_Psat.allocate({0, psatcache_size});
 #endif
+        if (DataSystemVariables::PsychrometricTables) InitializeTsatTable();
+    }
+
+    void InitializeTsatTable()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Tabulates the saturation temperature as a function of pressure so PsyTsatFnPb can
+        // interpolate instead of iterating on the saturation pressure correlation.
+
+        // METHODOLOGY EMPLOYED:
+        // The table holds the iterated saturation temperature at pressures evenly spaced in ln(pressure),
+        // where the saturation temperature is nearly linear. Linear interpolation is checked against the
+        // iteration at the middle of every interval, and the table is only used if the largest difference
+        // is within the iteration tolerance.
+
+        TsatTableActive = false;
+        TsatTable.allocate({0, tsattable_size});
+        TsatTableLnPMin = std::log(tsattable_pmin);
+        TsatTableDeltaLnP = (std::log(tsattable_pmax) - TsatTableLnPMin) / tsattable_size;
+        for (int i = 0; i <= tsattable_size; ++i) {
+            TsatTable(i) = PsyTsatFnPb(std::exp(TsatTableLnPMin + i * TsatTableDeltaLnP));
+        }
+
+        TsatTableMaxError = 0.0;
+        for (int i = 0; i < tsattable_size; ++i) {
+            Real64 const Press(std::exp(TsatTableLnPMin + (i + 0.5) * TsatTableDeltaLnP));
+            if ((Press >= tsattable_freeze_pmin) && (Press <= tsattable_freeze_pmax)) continue;
+            Real64 const Error(std::abs(0.5 * (TsatTable(i) + TsatTable(i + 1)) - PsyTsatFnPb(Press)));
+            if (!(Error <= TsatTableMaxError)) TsatTableMaxError = Error; // A NaN from the iteration also rejects the table
+        }
+        TsatTableActive = (TsatTableMaxError <= tsattable_tolerance);
     }
 
     void ShowPsychrometricSummary()
@@ -290,7 +355,7 @@ namespace Psychrometrics {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Linda Lawrie
         //       DATE WRITTEN   August 2011
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, CSV statistics file
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -327,7 +392,13 @@ namespace Psychrometrics {
         Real64 AverageIterations;
         std::string istring;
 
-        EchoInputFile = FindUnitNumber(outputAuditFile);
+        // Machine readable statistics
+        {
+            std::ofstream Stats(DataStringGlobals::outputPsyCsvFileName);
+            if (Stats) WritePsychrometricStatistics(Stats);
+        }
+
+        EchoInputFile = FindUnitNumber(DataStringGlobals::outputAuditFileName);
         if (EchoInputFile == 0) return;
         if (any_gt(NumTimesCalled, 0)) {
             ObjexxFCL::gio::write(EchoInputFile, fmtA) << "RoutineName,#times Called,Avg Iterations";
@@ -346,6 +417,37 @@ namespace Psychrometrics {
 #endif
     }
 
+    void WritePsychrometricStatistics(std::ostream &Stats)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Writes the psychrometric call statistics as CSV: one row per monitored routine with
+        // its call count, average and maximum iterations, and the hit ratio of the cached routines.
+
+        // METHODOLOGY EMPLOYED:
+        // A cached routine calls its raw calculation on every miss, so the hit ratio is
+        // 1 - (raw calculations / cached calls). The counters are only incremented in EP_psych_stats builds
+        // and are not synchronized, so such builds should be run single threaded.
+
+        Stats << "Routine,Calls,Average Iterations,Maximum Iterations,Cache Hit Ratio\n";
+        for (int Loop = 1; Loop <= NumPsychMonitors; ++Loop) {
+            if (!PsyReportIt(Loop)) continue;
+            Int64 const Calls(NumTimesCalled(Loop));
+            Stats << PsyRoutineNames(Loop) << ',' << Calls << ',';
+            Stats << (Calls > 0 ? double(NumIterations(Loop)) / double(Calls) : 0.0) << ',' << MaxIterations(Loop) << ',';
+            int const RawLoop(Loop == iPsyTwbFnTdbWPb_cache ? iPsyTwbFnTdbWPb : (Loop == iPsyPsatFnTemp_cache ? iPsyPsatFnTemp : 0));
+            if (RawLoop > 0) {
+                Stats << (Calls > 0 ? max(0.0, 1.0 - double(NumTimesCalled(RawLoop)) / double(Calls)) : 0.0);
+            }
+            Stats << '\n';
+        }
+    }
+
 #ifdef EP_psych_errors
     void PsyRhoAirFnPbTdbW_error(Real64 const pb,              // barometric pressure (Pascals)
                                  Real64 const tdb,             // dry bulb temperature (Celsius)
@@ -489,6 +591,10 @@ namespace Psychrometrics {
         W_tag = bit_shift(W_tag, -Grid_Shift);
         Pb_tag = bit_shift(Pb_tag, -Grid_Shift);
         hash = bit_and(bit_xor(Tdb_tag, bit_xor(W_tag, Pb_tag)), Int64(twbcache_size - 1));
+        if (cached_Twb.u() != twbcache_size) { // First call on this thread, or the cache was resized since
+            cached_Twb.deallocate();
+            cached_Twb.allocate({0, twbcache_size});
+        }
 
         if (cached_Twb(hash).iTdb != Tdb_tag || cached_Twb(hash).iW != W_tag || cached_Twb(hash).iPb != Pb_tag) {
             cached_Twb(hash).iTdb = Tdb_tag;
@@ -565,8 +671,8 @@ namespace Psychrometrics {
 
         // FUNCTION LOCAL VARIABLE DECLARATIONS:
         Real64 tBoil;                       // Boiling temperature of water at given pressure
-        static Real64 last_Patm(-99999.0);  // barometric pressure {Pascals}  (last)
-        static Real64 last_tBoil(-99999.0); // Boiling temperature of water at given pressure (last)
+        static EP_PSYCH_THREAD_LOCAL Real64 last_Patm(-99999.0);  // barometric pressure {Pascals}  (last)
+        static EP_PSYCH_THREAD_LOCAL Real64 last_tBoil(-99999.0); // Boiling temperature of water at given pressure (last)
         Real64 newW;                        // Humidity ratio calculated with wet bulb guess
         Real64 W;                           // Humidity ratio entered and corrected as necessary
         Real64 ResultX;                     // ResultX is the final Iteration result passed back to the calling routine
@@ -679,6 +785,7 @@ namespace Psychrometrics {
 
 #ifdef EP_psych_stats
         NumIterations(iPsyTwbFnTdbWPb) += iter;
+        MaxIterations(iPsyTwbFnTdbWPb) = max(MaxIterations(iPsyTwbFnTdbWPb), iter);
 #endif
 
         // Wet bulb temperature has not converged after maximum specified
@@ -1359,6 +1466,7 @@ namespace Psychrometrics {
         // FUNCTION INFORMATION:
         //       AUTHOR         George Shih
         //       DATE WRITTEN   May 1976
+        //       MODIFIED       October 2026, optional interpolation in a checked table (see InitializeTsatTable)
         //       RE-ENGINEERED  Dec 2003; Rahul Chillar
 
         // PURPOSE OF THIS FUNCTION:
@@ -1393,8 +1501,8 @@ namespace Psychrometrics {
 
         // FUNCTION LOCAL VARIABLE DECLARATIONS:
         bool FlagError; // set when errors should be flagged
-        static Real64 Press_Save(-99999.0);
-        static Real64 tSat_Save(-99999.0);
+        static EP_PSYCH_THREAD_LOCAL Real64 Press_Save(-99999.0);
+        static EP_PSYCH_THREAD_LOCAL Real64 tSat_Save(-99999.0);
         Real64 tSat; // Water temperature guess
         int iter;    // Iteration counter
 
@@ -1444,6 +1552,13 @@ namespace Psychrometrics {
         } else if ((Press > 611.000) && (Press < 611.25)) {
             tSat = 0.0;
 
+            // Interpolate in the checked table when it is in use
+        } else if (TsatTableActive && (Press >= tsattable_pmin) && (Press < tsattable_pmax) &&
+                   ((Press < tsattable_freeze_pmin) || (Press > tsattable_freeze_pmax))) {
+            Real64 const x((std::log(Press) - TsatTableLnPMin) / TsatTableDeltaLnP);
+            int const i(min(static_cast<int>(x), tsattable_size - 1));
+            tSat = TsatTable(i) + (x - i) * (TsatTable(i + 1) - TsatTable(i));
+
         } else {
             // Iterate to find the saturation temperature
             // of water given the total pressure
@@ -1480,6 +1595,7 @@ namespace Psychrometrics {
 
 #ifdef EP_psych_stats
         NumIterations(iPsyTsatFnPb) += iter;
+        MaxIterations(iPsyTsatFnPb) = max(MaxIterations(iPsyTsatFnPb), iter);
 #endif
 
 #ifdef EP_psych_errors
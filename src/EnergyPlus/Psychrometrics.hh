@@ -51,6 +51,7 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <iosfwd>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -73,6 +74,13 @@ namespace EnergyPlus {
 #endif
 #define EP_psych_errors
 
+// The psychrometric caches are thread local in OpenMP builds so that threaded zone and surface loops can use the cached functions
+#ifdef _OPENMP
+#define EP_PSYCH_THREAD_LOCAL thread_local
+#else
+#define EP_PSYCH_THREAD_LOCAL
+#endif
+
 namespace Psychrometrics {
 
 #ifdef EP_psych_errors
@@ -103,7 +111,6 @@ namespace Psychrometrics {
     extern int const iPsyPsatFnTemp_cache;
     extern int const NumPsychMonitors; // Parameterization of Number of psychrometric routines that
     extern std::string const blank_string;
-#ifdef EP_psych_stats
     extern Array1D_string const PsyRoutineNames; // 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | 10 | 11 | 12 | 13 | 14 - HR | 15 - max iter | 16 - HR | 17 -
                                                  // max iter | 18 - PsyTwbFnTdbWPb_raw (raw calc) | 19 - PsyPsatFnTemp_raw (raw calc)
 
@@ -113,33 +120,37 @@ namespace Psychrometrics {
                                            // PsyRhFnTdbRhovLBnd0C 13 | PsyTwbFnTdbWPb       14 - HR | PsyTwbFnTdbWPb       15 - max iter |
                                            // PsyWFnTdbTwbPb       16 - HR | PsyTsatFnPb          17 - max iter | PsyTwbFnTdbWPb_cache 18 -
                                            // PsyTwbFnTdbWPb_raw (raw calc) | PsyPsatFnTemp_cache  19 - PsyPsatFnTemp_raw (raw calc)
-#endif
 
 #ifndef EP_psych_errors
     extern Real64 const KelvinConv;
 #endif
 
 #ifdef EP_cache_PsyTwbFnTdbWPb
-    extern int const twbcache_size;
     extern int const twbprecision_bits;
 #endif
 #ifdef EP_cache_PsyPsatFnTemp
-    extern int const psatcache_size;
     extern int const psatprecision_bits; // 28  //24  //32
-    extern Int64 const psatcache_mask;
 #endif
 
     // MODULE VARIABLE DECLARATIONS:
     // na
 
     // MODULE VARIABLE DEFINITIONS:
+#ifdef EP_cache_PsyTwbFnTdbWPb
+    extern int twbcache_size; // Power of two set from DataSystemVariables::PsychrometricCacheBits
+#endif
+#ifdef EP_cache_PsyPsatFnTemp
+    extern int psatcache_size; // Power of two set from DataSystemVariables::PsychrometricCacheBits
+    extern Int64 psatcache_mask;
+#endif
     extern std::string String;
     extern bool ReportErrors;
     extern Array1D_int iPsyErrIndex; // Number of times error occurred
-#ifdef EP_psych_stats
     extern Array1D<Int64> NumTimesCalled;
-    extern Array1D_int NumIterations;
-#endif
+    extern Array1D<Int64> NumIterations;
+    extern Array1D_int MaxIterations;
+    extern bool TsatTableActive;     // True when PsyTsatFnPb interpolates in TsatTable
+    extern Real64 TsatTableMaxError; // Largest difference between the table and the iteration found by the table check {C}
 
     // DERIVED TYPE DEFINITIONS
 
@@ -177,10 +188,10 @@ namespace Psychrometrics {
 
     // Object Data
 #ifdef EP_cache_PsyTwbFnTdbWPb
-    extern Array1D<cached_twb_t> cached_Twb; // DIMENSION(0:twbcache_size)
+    extern EP_PSYCH_THREAD_LOCAL Array1D<cached_twb_t> cached_Twb; // DIMENSION(0:twbcache_size)
 #endif
 #ifdef EP_cache_PsyPsatFnTemp
-    extern Array1D<cached_psat_t> cached_Psat; // DIMENSION(0:psatcache_size)
+    extern EP_PSYCH_THREAD_LOCAL Array1D<cached_psat_t> cached_Psat; // DIMENSION(0:psatcache_size)
 #endif
 
     // Subroutine Specifications for the Module
@@ -191,8 +202,12 @@ namespace Psychrometrics {
 
     void InitializePsychRoutines();
 
+    void InitializeTsatTable();
+
     void ShowPsychrometricSummary();
 
+    void WritePsychrometricStatistics(std::ostream &Stats);
+
 #ifdef EP_psych_errors
     void PsyRhoAirFnPbTdbW_error(Real64 const pb,                             // barometric pressure (Pascals)
                                  Real64 const tdb,                            // dry bulb temperature (Celsius)
@@ -355,9 +370,9 @@ namespace Psychrometrics {
         // USAGE:  cpa = PsyCpAirFnWTdb(w,T)
 
         // Static locals
-        static Real64 dwSave(-100.0);
-        static Real64 Tsave(-100.0);
-        static Real64 cpaSave(-100.0);
+        static EP_PSYCH_THREAD_LOCAL Real64 dwSave(-100.0);
+        static EP_PSYCH_THREAD_LOCAL Real64 Tsave(-100.0);
+        static EP_PSYCH_THREAD_LOCAL Real64 cpaSave(-100.0);
 
         // check if last call had the same input and if it did just use the saved output
         if ((Tsave == T) && (dwSave == dw)) return cpaSave;
@@ -382,9 +397,9 @@ namespace Psychrometrics {
         assert(dw >= 1.0e-5);
 
         // Static locals
-        static Real64 dwSave(-100.0);
-        static Real64 Tsave(-100.0);
-        static Real64 cpaSave(-100.0);
+        static EP_PSYCH_THREAD_LOCAL Real64 dwSave(-100.0);
+        static EP_PSYCH_THREAD_LOCAL Real64 Tsave(-100.0);
+        static EP_PSYCH_THREAD_LOCAL Real64 cpaSave(-100.0);
 
         // check if last call had the same input and if it did just use the saved output
         if ((Tsave == T) && (dwSave == dw)) return cpaSave;
@@ -684,6 +699,10 @@ namespace Psychrometrics {
             bit_shift(bit_transfer(T, Grid_Shift), -Grid_Shift)); // Note that 2nd arg to TRANSFER is not used: Only type matters
         //		Int64 const hash( bit::bit_and( Tdb_tag, psatcache_mask ) ); //Tuned Replaced by below
         Int64 const hash(Tdb_tag & psatcache_mask);
+        if (cached_Psat.u() != psatcache_size) { // First call on this thread, or the cache was resized since
+            cached_Psat.deallocate();
+            cached_Psat.allocate({0, psatcache_size});
+        }
         auto &cPsat(cached_Psat(hash));
 
         if (cPsat.iTdb != Tdb_tag) {
@@ -486,12 +486,14 @@ namespace RefrigeratedCase {
     Array1D<AirChillerSetData> AirChillerSet;
     Array1D<CoilCreditData> CoilSysCredit;
     Array1D<CaseWIZoneReportData> CaseWIZoneReport;
+    Array1D<RefrigZoneAirData> RefrigZoneAir; // Psychrometric states of zone air nodes serving cases and walk-ins
 
     // Functions
 
     void clear_state()
     {
         UniqueCondenserNames.clear();
+        RefrigZoneAir.deallocate();
     }
     void ManageRefrigeratedCaseRacks()
     {
@@ -9972,6 +9974,78 @@ namespace RefrigeratedCase {
 
     //***************************************************************************************************
 
+    RefrigZoneAirData &GetRefrigZoneAir(int const ZoneNodeNum)
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns the relative humidity and dew point of a zone air node serving refrigerated cases.
+
+        // METHODOLOGY EMPLOYED:
+        // Large stores place many cases and walk-ins in the same zone.  The psychrometric states of each zone air
+        // node are evaluated once and reused by every case and walk-in in that zone until the node temperature,
+        // humidity ratio or barometric pressure changes.
+
+        // Using/Aliasing
+        using namespace DataLoopNode;
+        using DataEnvironment::OutBaroPress;
+        using Psychrometrics::PsyRhFnTdbWPb;
+        using Psychrometrics::PsyTdpFnWPb;
+
+        if (RefrigZoneAir.size() < static_cast<std::size_t>(NumOfNodes)) RefrigZoneAir.redimension(NumOfNodes);
+
+        RefrigZoneAirData &ZoneAir = RefrigZoneAir(ZoneNodeNum);
+        if (ZoneAir.Defined && ZoneAir.Temp == Node(ZoneNodeNum).Temp && ZoneAir.HumRat == Node(ZoneNodeNum).HumRat &&
+            ZoneAir.BaroPress == OutBaroPress) {
+            return ZoneAir;
+        }
+
+        ZoneAir.Temp = Node(ZoneNodeNum).Temp;
+        ZoneAir.HumRat = Node(ZoneNodeNum).HumRat;
+        ZoneAir.BaroPress = OutBaroPress;
+        ZoneAir.RHFrac = PsyRhFnTdbWPb(ZoneAir.Temp, ZoneAir.HumRat, OutBaroPress);
+        ZoneAir.DewPoint = PsyTdpFnWPb(ZoneAir.HumRat, OutBaroPress);
+        ZoneAir.Defined = true;
+        ZoneAir.InfiltrationDefined = false;
+        return ZoneAir;
+    }
+
+    RefrigZoneAirData &GetRefrigZoneAirInfiltration(int const ZoneNodeNum)
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns the zone air states used for walk-in door infiltration, in addition to those of GetRefrigZoneAir.
+
+        // Using/Aliasing
+        using DataEnvironment::OutBaroPress;
+        using Psychrometrics::PsyHFnTdbRhPb;
+        using Psychrometrics::PsyRhoAirFnPbTdbW;
+        using Psychrometrics::PsyWFnTdbH;
+
+        // FUNCTION PARAMETER DEFINITIONS:
+        static std::string const RoutineName("CalculateWalkIn");
+
+        RefrigZoneAirData &ZoneAir = GetRefrigZoneAir(ZoneNodeNum);
+        if (!ZoneAir.InfiltrationDefined) {
+            ZoneAir.Enthalpy = PsyHFnTdbRhPb(ZoneAir.Temp, ZoneAir.RHFrac, OutBaroPress, RoutineName);
+            ZoneAir.DoorHumRat = PsyWFnTdbH(ZoneAir.Temp, ZoneAir.Enthalpy, RoutineName);
+            ZoneAir.Density = PsyRhoAirFnPbTdbW(OutBaroPress, ZoneAir.Temp, ZoneAir.DoorHumRat, RoutineName);
+            ZoneAir.InfiltrationDefined = true;
+        }
+        return ZoneAir;
+    }
+
     void CalculateCase(int const CaseID) // Absolute pointer to refrigerated case
     {
 
@@ -10012,9 +10086,6 @@ namespace RefrigeratedCase {
         // Using/Aliasing
         using CurveManager::CurveValue;
         using namespace DataLoopNode;
-        using DataEnvironment::OutBaroPress; // , Month
-        using Psychrometrics::PsyRhFnTdbWPb;
-        using Psychrometrics::PsyTdpFnWPb;
 
         // Locals
         static Real64 CaseRAFraction(0.0); // Fraction of case credits applied to return air
@@ -10133,8 +10204,11 @@ namespace RefrigeratedCase {
         // Set local subroutine variables for convenience
         ActualZoneNum = RefrigCase(CaseID).ActualZoneNum;
         ZoneNodeNum = RefrigCase(CaseID).ZoneNodeNum;
-        ZoneRHPercent = PsyRhFnTdbWPb(Node(ZoneNodeNum).Temp, Node(ZoneNodeNum).HumRat, OutBaroPress) * 100.0;
-        ZoneDewPoint = PsyTdpFnWPb(Node(ZoneNodeNum).HumRat, OutBaroPress);
+        {
+            RefrigZoneAirData const &ZoneAir = GetRefrigZoneAir(ZoneNodeNum);
+            ZoneRHPercent = ZoneAir.RHFrac * 100.0;
+            ZoneDewPoint = ZoneAir.DewPoint;
+        }
         Length = RefrigCase(CaseID).Length;
         TCase = RefrigCase(CaseID).Temperature;
         DesignRatedCap = RefrigCase(CaseID).DesignRatedCap;
@@ -14075,7 +14149,6 @@ namespace RefrigeratedCase {
         // na
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        static std::string const RoutineName("CalculateWalkIn");
         static int ZoneNodeNum(0);     // Zone node number
         static int ZoneNum(0);         // Index to zone
         static int ZoneID(0);          // Index to zone
@@ -14206,10 +14279,11 @@ namespace RefrigeratedCase {
 
             // Get infiltration loads if either type of door is present in this zone
             if (StockDoorArea > 0.0 || GlassDoorArea > 0.0) {
-                ZoneRHFrac = PsyRhFnTdbWPb(Node(ZoneNodeNum).Temp, Node(ZoneNodeNum).HumRat, OutBaroPress, RoutineName);
-                EnthalpyZoneAir = PsyHFnTdbRhPb(ZoneDryBulb, ZoneRHFrac, OutBaroPress, RoutineName);
-                HumRatioZoneAir = PsyWFnTdbH(ZoneDryBulb, EnthalpyZoneAir, RoutineName);
-                DensityZoneAir = PsyRhoAirFnPbTdbW(OutBaroPress, ZoneDryBulb, HumRatioZoneAir, RoutineName);
+                RefrigZoneAirData const &ZoneAir = GetRefrigZoneAirInfiltration(ZoneNodeNum);
+                ZoneRHFrac = ZoneAir.RHFrac;
+                EnthalpyZoneAir = ZoneAir.Enthalpy;
+                HumRatioZoneAir = ZoneAir.DoorHumRat;
+                DensityZoneAir = ZoneAir.Density;
                 if (DensityZoneAir < DensityAirWalkIn) { // usual case when walk in is colder than zone
                     DensitySqRtFactor = std::sqrt(1.0 - DensityZoneAir / DensityAirWalkIn);
                     DensityFactorFm = std::pow(2.0 / (1.0 + std::pow(DensityAirWalkIn / DensityZoneAir, 0.333)), 1.5);
@@ -1496,6 +1496,29 @@ namespace RefrigeratedCase {
         }
     };
 
+    struct RefrigZoneAirData
+    {
+        // Members
+        // Zone air node conditions the psychrometric states below were evaluated at
+        Real64 Temp;      // Zone air temperature (C)
+        Real64 HumRat;    // Zone air humidity ratio (kg/kg)
+        Real64 BaroPress; // Barometric pressure (Pa)
+        bool Defined;     // Flag to show the states below are valid for the conditions above
+        Real64 RHFrac;    // Zone air relative humidity (fraction)
+        Real64 DewPoint;  // Zone air dew point temperature (C)
+        bool InfiltrationDefined; // Flag to show the walk-in door infiltration states below are valid
+        Real64 Enthalpy;          // Zone air enthalpy (J/kg)
+        Real64 DoorHumRat;        // Zone air humidity ratio recovered from temperature and enthalpy (kg/kg)
+        Real64 Density;           // Zone air density (kg/m3)
+
+        // Default Constructor
+        RefrigZoneAirData()
+            : Temp(0.0), HumRat(0.0), BaroPress(0.0), Defined(false), RHFrac(0.0), DewPoint(0.0), InfiltrationDefined(false), Enthalpy(0.0),
+              DoorHumRat(0.0), Density(0.0)
+        {
+        }
+    };
+
     struct WarehouseCoilData
     {
         // Members
@@ -1719,6 +1742,7 @@ namespace RefrigeratedCase {
     extern Array1D<AirChillerSetData> AirChillerSet;
     extern Array1D<CoilCreditData> CoilSysCredit;
     extern Array1D<CaseWIZoneReportData> CaseWIZoneReport;
+    extern Array1D<RefrigZoneAirData> RefrigZoneAir;
 
     // Functions
 
@@ -1751,6 +1775,10 @@ namespace RefrigeratedCase {
 
     //***************************************************************************************************
 
+    RefrigZoneAirData &GetRefrigZoneAir(int const ZoneNodeNum);
+
+    RefrigZoneAirData &GetRefrigZoneAirInfiltration(int const ZoneNodeNum);
+
     void CalculateCase(int const CaseID); // Absolute pointer to refrigerated case
 
     //***************************************************************************************************
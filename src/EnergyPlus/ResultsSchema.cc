@@ -68,6 +68,7 @@
 #include <DataHVACGlobals.hh>
 #include <DataIPShortCuts.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <GlobalNames.hh>
@@ -262,6 +263,11 @@ namespace ResultsFramework {
         Values.push_back(val);
     }
 
+    void Variable::clearValues()
+    {
+        Values.clear();
+    }
+
     double Variable::value(size_t index) const
     {
         return Values.at(index);
@@ -341,6 +347,8 @@ namespace ResultsFramework {
 
     void DataFrame::newRow(const int month, const int dayOfMonth, const int hourOfDay, const int curMin)
     {
+        if (Streaming) writeStreamedRows(); // every buffered row is complete once the next one starts
+
         char buffer[100];
         int cx = snprintf(buffer, 100, "%02d/%02d %02d:%02d:00", month, dayOfMonth, hourOfDay, curMin );
 
@@ -356,6 +364,7 @@ namespace ResultsFramework {
 
     void DataFrame::newRow(const std::string &ts)
     {
+        if (Streaming) writeStreamedRows();
         TS.push_back(ts);
     }
 
@@ -412,15 +421,20 @@ namespace ResultsFramework {
         return arr;
     }
 
-    json DataFrame::getJSON() const
+    json DataFrame::getColumnsJSON() const
     {
-        json root;
         json cols = json::array();
-        json rows = json::array();
-
         for (auto const &varMap : variableMap) {
             cols.push_back({{"Variable", varMap.second.variableName()}, {"Units", unitEnumToString(varMap.second.units())}});
         }
+        return cols;
+    }
+
+    json DataFrame::getJSON() const
+    {
+        json root;
+        json cols = getColumnsJSON();
+        json rows = json::array();
 
         std::vector<double> vals;
         vals.reserve(10000);
@@ -441,108 +455,130 @@ namespace ResultsFramework {
         return root;
     }
 
-    void DataFrame::writeReport(bool outputJSON, bool outputCBOR, bool outputMsgPack)
+    void DataFrame::getOutputStreams(std::ostream *&jsonStream, std::ostream *&cborStream, std::ostream *&msgpackStream) const
     {
-
-        json root = getJSON();
+        auto &streams(DataGlobals::jsonOutputStreams);
+        jsonStream = cborStream = msgpackStream = nullptr;
         if (ReportFrequency == "Detailed-HVAC") {
-            if (outputJSON && DataGlobals::jsonOutputStreams.json_TSstream_HVAC) {
-                *(DataGlobals::jsonOutputStreams.json_TSstream_HVAC) << std::setw(4) << root << std::endl;
-            }
-            if (outputCBOR && DataGlobals::jsonOutputStreams.cbor_TSstream_HVAC) {
-                std::vector<uint8_t> v_cbor = json::to_cbor(root);
-                std::copy(v_cbor.begin(), v_cbor.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.cbor_TSstream_HVAC));
-            }
-            if (outputMsgPack && DataGlobals::jsonOutputStreams.msgpack_TSstream_HVAC) {
-                std::vector<uint8_t> v_msgpack = json::to_msgpack(root);
-                std::copy(v_msgpack.begin(), v_msgpack.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.msgpack_TSstream_HVAC));
-            }
+            jsonStream = streams.json_TSstream_HVAC;
+            cborStream = streams.cbor_TSstream_HVAC;
+            msgpackStream = streams.msgpack_TSstream_HVAC;
         } else if (ReportFrequency == "Detailed-Zone") {
-            if (outputJSON && DataGlobals::jsonOutputStreams.json_TSstream_Zone) {
-                *(DataGlobals::jsonOutputStreams.json_TSstream_Zone) << std::setw(4) << root << std::endl;
-            }
-            if (outputCBOR && DataGlobals::jsonOutputStreams.cbor_TSstream_Zone) {
-                std::vector<uint8_t> v_cbor = json::to_cbor(root);
-                std::copy(v_cbor.begin(), v_cbor.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.cbor_TSstream_Zone));
-            }
-            if (outputMsgPack && DataGlobals::jsonOutputStreams.msgpack_TSstream_Zone) {
-                std::vector<uint8_t> v_msgpack = json::to_msgpack(root);
-                std::copy(v_msgpack.begin(), v_msgpack.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.msgpack_TSstream_Zone));
-            }
+            jsonStream = streams.json_TSstream_Zone;
+            cborStream = streams.cbor_TSstream_Zone;
+            msgpackStream = streams.msgpack_TSstream_Zone;
         } else if (ReportFrequency == "Timestep") {
-            if (outputJSON && DataGlobals::jsonOutputStreams.json_TSstream) {
-                *(DataGlobals::jsonOutputStreams.json_TSstream) << std::setw(4) << root << std::endl;
-            }
-            if (outputCBOR && DataGlobals::jsonOutputStreams.cbor_TSstream) {
-                std::vector<uint8_t> v_cbor = json::to_cbor(root);
-                std::copy(v_cbor.begin(), v_cbor.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.cbor_TSstream));
-            }
-            if (outputMsgPack && DataGlobals::jsonOutputStreams.msgpack_TSstream) {
-                std::vector<uint8_t> v_msgpack = json::to_msgpack(root);
-                std::copy(v_msgpack.begin(), v_msgpack.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.msgpack_TSstream));
-            }
+            jsonStream = streams.json_TSstream;
+            cborStream = streams.cbor_TSstream;
+            msgpackStream = streams.msgpack_TSstream;
         } else if (ReportFrequency == "Daily") {
-            if (outputJSON && DataGlobals::jsonOutputStreams.json_DYstream) {
-                *(DataGlobals::jsonOutputStreams.json_DYstream) << std::setw(4) << root << std::endl;
-            }
-            if (outputCBOR && DataGlobals::jsonOutputStreams.cbor_DYstream) {
-                std::vector<uint8_t> v_cbor = json::to_cbor(root);
-                std::copy(v_cbor.begin(), v_cbor.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.cbor_DYstream));
-            }
-            if (outputMsgPack && DataGlobals::jsonOutputStreams.msgpack_DYstream) {
-                std::vector<uint8_t> v_msgpack = json::to_msgpack(root);
-                std::copy(v_msgpack.begin(), v_msgpack.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.msgpack_DYstream));
-            }
+            jsonStream = streams.json_DYstream;
+            cborStream = streams.cbor_DYstream;
+            msgpackStream = streams.msgpack_DYstream;
         } else if (ReportFrequency == "Hourly") {
-            if (outputJSON && DataGlobals::jsonOutputStreams.json_HRstream) {
-                *(DataGlobals::jsonOutputStreams.json_HRstream) << std::setw(4) << root << std::endl;
-            }
-            if (outputCBOR && DataGlobals::jsonOutputStreams.cbor_HRstream) {
-                std::vector<uint8_t> v_cbor = json::to_cbor(root);
-                std::copy(v_cbor.begin(), v_cbor.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.cbor_HRstream));
-            }
-            if (outputMsgPack && DataGlobals::jsonOutputStreams.msgpack_HRstream) {
-                std::vector<uint8_t> v_msgpack = json::to_msgpack(root);
-                std::copy(v_msgpack.begin(), v_msgpack.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.msgpack_HRstream));
-            }
+            jsonStream = streams.json_HRstream;
+            cborStream = streams.cbor_HRstream;
+            msgpackStream = streams.msgpack_HRstream;
         } else if (ReportFrequency == "Monthly") {
-            if (outputJSON && DataGlobals::jsonOutputStreams.json_MNstream) {
-                *(DataGlobals::jsonOutputStreams.json_MNstream) << std::setw(4) << root << std::endl;
-            }
-            if (outputCBOR && DataGlobals::jsonOutputStreams.cbor_MNstream) {
-                std::vector<uint8_t> v_cbor = json::to_cbor(root);
-                std::copy(v_cbor.begin(), v_cbor.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.cbor_MNstream));
-            }
-            if (outputMsgPack && DataGlobals::jsonOutputStreams.msgpack_MNstream) {
-                std::vector<uint8_t> v_msgpack = json::to_msgpack(root);
-                std::copy(v_msgpack.begin(), v_msgpack.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.msgpack_MNstream));
-            }
+            jsonStream = streams.json_MNstream;
+            cborStream = streams.cbor_MNstream;
+            msgpackStream = streams.msgpack_MNstream;
         } else if (ReportFrequency == "RunPeriod") {
-            if (outputJSON && DataGlobals::jsonOutputStreams.json_SMstream) {
-                *(DataGlobals::jsonOutputStreams.json_SMstream) << std::setw(4) << root << std::endl;
-            }
-            if (outputCBOR && DataGlobals::jsonOutputStreams.cbor_SMstream) {
-                std::vector<uint8_t> v_cbor = json::to_cbor(root);
-                std::copy(v_cbor.begin(), v_cbor.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.cbor_SMstream));
-            }
-            if (outputMsgPack && DataGlobals::jsonOutputStreams.msgpack_SMstream) {
-                std::vector<uint8_t> v_msgpack = json::to_msgpack(root);
-                std::copy(v_msgpack.begin(), v_msgpack.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.msgpack_SMstream));
-            }
+            jsonStream = streams.json_SMstream;
+            cborStream = streams.cbor_SMstream;
+            msgpackStream = streams.msgpack_SMstream;
         } else if (ReportFrequency == "Yearly") {
-            if (outputJSON && DataGlobals::jsonOutputStreams.json_YRstream) {
-                *(DataGlobals::jsonOutputStreams.json_YRstream) << std::setw(4) << root << std::endl;
-            }
-            if (outputCBOR && DataGlobals::jsonOutputStreams.cbor_YRstream) {
-                std::vector<uint8_t> v_cbor = json::to_cbor(root);
-                std::copy(v_cbor.begin(), v_cbor.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.cbor_YRstream));
-            }
-            if (outputMsgPack && DataGlobals::jsonOutputStreams.msgpack_YRstream) {
-                std::vector<uint8_t> v_msgpack = json::to_msgpack(root);
-                std::copy(v_msgpack.begin(), v_msgpack.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.msgpack_YRstream));
+            jsonStream = streams.json_YRstream;
+            cborStream = streams.cbor_YRstream;
+            msgpackStream = streams.msgpack_YRstream;
+        }
+    }
+
+    void DataFrame::writeReport(bool outputJSON, bool outputCBOR, bool outputMsgPack)
+    {
+        if (Streaming) {
+            writeStreamedRows();
+            return;
+        }
+
+        std::ostream *jsonStream;
+        std::ostream *cborStream;
+        std::ostream *msgpackStream;
+        getOutputStreams(jsonStream, cborStream, msgpackStream);
+
+        json root = getJSON();
+        if (outputJSON && jsonStream) {
+            *jsonStream << std::setw(4) << root << std::endl;
+        }
+        if (outputCBOR && cborStream) {
+            std::vector<uint8_t> v_cbor = json::to_cbor(root);
+            std::copy(v_cbor.begin(), v_cbor.end(), std::ostream_iterator<uint8_t>(*cborStream));
+        }
+        if (outputMsgPack && msgpackStream) {
+            std::vector<uint8_t> v_msgpack = json::to_msgpack(root);
+            std::copy(v_msgpack.begin(), v_msgpack.end(), std::ostream_iterator<uint8_t>(*msgpackStream));
+        }
+    }
+
+    void DataFrame::setStreaming(bool outputJSON, bool outputCBOR, bool outputMsgPack)
+    {
+        Streaming = true;
+        StreamJSON = outputJSON;
+        StreamCBOR = outputCBOR;
+        StreamMsgPack = outputMsgPack;
+    }
+
+    bool DataFrame::streaming() const
+    {
+        return Streaming;
+    }
+
+    void DataFrame::writeStreamedItem(json const &item) const
+    {
+        std::ostream *jsonStream;
+        std::ostream *cborStream;
+        std::ostream *msgpackStream;
+        getOutputStreams(jsonStream, cborStream, msgpackStream);
+
+        if (StreamJSON && jsonStream) {
+            *jsonStream << item.dump(-1, ' ', false, json::error_handler_t::replace) << '\n';
+        }
+        if (StreamCBOR && cborStream) {
+            json::to_cbor(item, *cborStream);
+        }
+        if (StreamMsgPack && msgpackStream) {
+            json::to_msgpack(item, *msgpackStream);
+        }
+    }
+
+    void DataFrame::writeStreamedRows()
+    {
+        // Streamed files are a sequence of items (JSON lines, or concatenated CBOR / MessagePack items):
+        // a header with the report frequency and columns, then one item per row in the same
+        // {"timestamp": [values]} form as the "Rows" array of the non-streamed report.
+        if (!RDataFrameEnabled && !IDataFrameEnabled) return;
+
+        if (!StreamHeaderWritten) {
+            writeStreamedItem({{"ReportFrequency", ReportFrequency}, {"Cols", getColumnsJSON()}});
+            StreamHeaderWritten = true;
+        }
+
+        std::vector<double> vals;
+        vals.reserve(variableMap.size());
+        for (size_t row = 0; row < TS.size(); ++row) {
+            vals.clear();
+            for (auto const &varMap : variableMap) {
+                vals.push_back(varMap.second.value(row));
             }
+            writeStreamedItem({{TS[row], vals}});
+        }
+
+        TS.clear();
+        for (auto &varMap : variableMap) {
+            varMap.second.clearValues();
         }
     }
+
     // class Table
 
     Table::Table(Array2D_string const &body,
@@ -707,6 +743,22 @@ namespace ResultsFramework {
                 outputMsgPack = UtilityRoutines::SameString(alphas(4), "Yes");
             }
         }
+
+        // Write the time series files row by row, as JSON lines or CBOR / MessagePack item sequences, to bound memory use.
+        // The meter data stays in the main results file.
+        if (tsEnabled && DataSystemVariables::StreamTimeSeriesOutput) {
+            tsStreamingEnabled = true;
+            for (auto *dataFrame : {&RIDetailedZoneTSData,
+                                    &RIDetailedHVACTSData,
+                                    &RITimestepTSData,
+                                    &RIHourlyTSData,
+                                    &RIDailyTSData,
+                                    &RIMonthlyTSData,
+                                    &RIRunPeriodTSData,
+                                    &RIYearlyTSData}) {
+                dataFrame->setStreaming(outputJSON, outputCBOR, outputMsgPack);
+            }
+        }
     }
 
     bool ResultsSchema::timeSeriesEnabled() const
@@ -734,6 +786,11 @@ namespace ResultsFramework {
         return outputMsgPack;
     }
 
+    bool ResultsSchema::timeSeriesStreamingEnabled() const
+    {
+        return tsStreamingEnabled;
+    }
+
     void ResultsSchema::initializeRTSDataFrame(const OutputProcessor::ReportingFrequency reportFrequency,
                                                const Array1D<RealVariableType> &RVariableTypes,
                                                const int NumOfRVariable,
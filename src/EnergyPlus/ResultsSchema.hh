@@ -129,6 +129,7 @@ namespace ResultsFramework {
         void setUnits(const OutputProcessor::Unit &units);
 
         void pushValue(const double val);
+        void clearValues();
         double value(size_t index) const;
         size_t numValues() const;
 
@@ -205,7 +206,16 @@ namespace ResultsFramework {
 
         void writeReport(bool outputJSON, bool outputCBOR, bool outputMsgPack);
 
+        // Write completed rows as they are added instead of holding them until writeReport
+        void setStreaming(bool outputJSON, bool outputCBOR, bool outputMsgPack);
+        bool streaming() const;
+        void writeStreamedRows();
+
     protected:
+        void getOutputStreams(std::ostream *&jsonStream, std::ostream *&cborStream, std::ostream *&msgpackStream) const;
+        json getColumnsJSON() const;
+        void writeStreamedItem(json const &item) const;
+
         bool IDataFrameEnabled = false;
         bool RDataFrameEnabled = false;
         bool RVariablesScanned = false;
@@ -214,6 +224,11 @@ namespace ResultsFramework {
         std::vector<std::string> TS;
         std::unordered_map<int, Variable> variableMap; // for O(1) lookup when adding to data structure
         int lastVarID;
+        bool Streaming = false;
+        bool StreamJSON = false;
+        bool StreamCBOR = false;
+        bool StreamMsgPack = false;
+        bool StreamHeaderWritten = false;
     };
 
     class Table : public BaseResultObject
@@ -286,6 +301,7 @@ namespace ResultsFramework {
         bool JSONEnabled() const;
         bool CBOREnabled() const;
         bool MsgPackEnabled() const;
+        bool timeSeriesStreamingEnabled() const;
 
         void initializeRTSDataFrame(const OutputProcessor::ReportingFrequency reportFrequency,
                                     const Array1D<OutputProcessor::RealVariableType> &RVariableTypes,
@@ -327,6 +343,7 @@ namespace ResultsFramework {
         bool outputJSON = false;
         bool outputCBOR = false;
         bool outputMsgPack = false;
+        bool tsStreamingEnabled = false;
     };
 
     extern std::unique_ptr<ResultsSchema> OutputSchema;
@@ -894,7 +894,6 @@ namespace RoomAirModelAirflowNetwork {
         bool ZoneRetPlenumAirFlag;
         bool ZoneSupPlenumAirFlag;
         Real64 CpAir;      // Specific heat of air
-        int SurfNum;       // Surface number
         Real64 HA;         //                     !Hc*Area
         Real64 Area;       //                   !Effective surface area
         Real64 RefAirTemp; //             !Reference air temperature for surface convection calculations
@@ -914,8 +913,6 @@ namespace RoomAirModelAirflowNetwork {
         Real64 SumSysM;    //                !Zone sum of air system MassFlowRate
         Real64 SumSysMW;   //               !Zone sum of air system MassFlowRate*W
         int EquipLoop;     //              !Index of equipment loop
-        int Loop;          //                   !Index of RAFN node
-        bool Found;        //
         Real64 SumLinkM;   //               !Zone sum of MassFlowRate from the AirflowNetwork model
         Real64 SumLinkMW;  //             !Zone sum of MassFlowRate*W from the AirflowNetwork model
 
@@ -953,29 +950,17 @@ namespace RoomAirModelAirflowNetwork {
             RoomAirflowNetworkZoneInfo(ZoneNum).Node(RoomAirNodeNum).SumIntSensibleGain += SumIntGain;
         }
 
-        // Check to see if this is a controlled zone
+        if (!NodeSumsSetUp) SetupNodeSums();
 
-        ControlledZoneAirFlag = false;
-        for (ZoneEquipConfigNum = 1; ZoneEquipConfigNum <= NumOfZones; ++ZoneEquipConfigNum) {
-            if (!Zone(ZoneEquipConfigNum).IsControlled) continue;
-            if (ZoneEquipConfig(ZoneEquipConfigNum).ActualZoneNum != ZoneNum) continue;
-            ControlledZoneAirFlag = true;
-            break; // sloppy way of finding ZoneEquipConfigNum for later use.
-        }          // ZoneEquipConfigNum
+        // Check to see if this is a controlled zone
+        ZoneEquipConfigNum = ZoneEquipConfigIndex;
+        ControlledZoneAirFlag = (ZoneEquipConfigNum > 0);
 
         // Check to see if this is a plenum zone
-        ZoneRetPlenumAirFlag = false;
-        for (ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum) {
-            if (ZoneRetPlenCond(ZoneRetPlenumNum).ActualZoneNum != ZoneNum) continue;
-            ZoneRetPlenumAirFlag = true;
-            break;
-        } // ZoneRetPlenumNum
-        ZoneSupPlenumAirFlag = false;
-        for (ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum) {
-            if (ZoneSupPlenCond(ZoneSupPlenumNum).ActualZoneNum != ZoneNum) continue;
-            ZoneSupPlenumAirFlag = true;
-            break;
-        } // ZoneSupPlenumNum
+        ZoneRetPlenumNum = ZoneRetPlenumIndex;
+        ZoneRetPlenumAirFlag = (ZoneRetPlenumNum > 0);
+        ZoneSupPlenumNum = ZoneSupPlenumIndex;
+        ZoneSupPlenumAirFlag = (ZoneSupPlenumNum > 0);
 
         // Plenum and controlled zones have a different set of inlet nodes which must be calculated.
         if (ControlledZoneAirFlag) {
@@ -1047,23 +1032,7 @@ namespace RoomAirModelAirflowNetwork {
         // Modified by Gu to include assigned surfaces only shown in the surface lsit
         if (!RoomAirflowNetworkZoneInfo(ZoneNum).Node(RoomAirNodeNum).HasSurfacesAssigned) return;
 
-        for (SurfNum = Zone(ZoneNum).SurfaceFirst; SurfNum <= Zone(ZoneNum).SurfaceLast; ++SurfNum) {
-
-            if (!Surface(SurfNum).HeatTransSurf) continue; // Skip non - heat transfer surfaces
-            if (RoomAirflowNetworkZoneInfo(ZoneNum).ControlAirNodeID == RoomAirNodeNum) {
-                Found = false;
-                for (Loop = 1; Loop <= RoomAirflowNetworkZoneInfo(ZoneNum).NumOfAirNodes; ++Loop) {
-                    if (Loop != RoomAirNodeNum) {
-                        if (RoomAirflowNetworkZoneInfo(ZoneNum).Node(Loop).SurfMask(SurfNum - Zone(ZoneNum).SurfaceFirst + 1)) {
-                            Found = true;
-                            break;
-                        }
-                    }
-                }
-                if (Found) continue;
-            } else {
-                if (!RoomAirflowNetworkZoneInfo(ZoneNum).Node(RoomAirNodeNum).SurfMask(SurfNum - Zone(ZoneNum).SurfaceFirst + 1)) continue;
-            }
+        for (int const SurfNum : NodeSurfaces(RoomAirNodeNum)) {
 
             HA = 0.0;
             Area = Surface(SurfNum).Area; // For windows, this is the glazing area
@@ -1155,6 +1124,82 @@ namespace RoomAirModelAirflowNetwork {
 
     } // CalcNodeSums
 
+    void RAFNData::SetupNodeSums()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Fills the zone equipment and plenum lookups and the per node surface lists used by CalcNodeSums.
+        // These depend only on input, so they are found once instead of on every node sum.
+
+        // METHODOLOGY EMPLOYED:
+        // The control node takes every heat transfer surface not assigned to another node; the other nodes
+        // take the surfaces in their own surface mask. Surfaces are kept in zone surface order.
+
+        // USE STATEMENTS:
+        using DataGlobals::NumOfZones;
+        using DataHeatBalance::Zone;
+        using DataSurfaces::Surface;
+        using DataZoneEquipment::ZoneEquipConfig;
+        using ZonePlenum::NumZoneReturnPlenums;
+        using ZonePlenum::NumZoneSupplyPlenums;
+        using ZonePlenum::ZoneRetPlenCond;
+        using ZonePlenum::ZoneSupPlenCond;
+
+        auto const &thisZoneInfo(RoomAirflowNetworkZoneInfo(ZoneNum));
+
+        ZoneEquipConfigIndex = 0;
+        for (int ZoneEquipConfigNum = 1; ZoneEquipConfigNum <= NumOfZones; ++ZoneEquipConfigNum) {
+            if (!Zone(ZoneEquipConfigNum).IsControlled) continue;
+            if (ZoneEquipConfig(ZoneEquipConfigNum).ActualZoneNum != ZoneNum) continue;
+            ZoneEquipConfigIndex = ZoneEquipConfigNum;
+            break;
+        }
+        ZoneRetPlenumIndex = 0;
+        for (int ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum) {
+            if (ZoneRetPlenCond(ZoneRetPlenumNum).ActualZoneNum != ZoneNum) continue;
+            ZoneRetPlenumIndex = ZoneRetPlenumNum;
+            break;
+        }
+        ZoneSupPlenumIndex = 0;
+        for (int ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum) {
+            if (ZoneSupPlenCond(ZoneSupPlenumNum).ActualZoneNum != ZoneNum) continue;
+            ZoneSupPlenumIndex = ZoneSupPlenumNum;
+            break;
+        }
+
+        NodeSurfaces.allocate(thisZoneInfo.NumOfAirNodes);
+        for (int RoomAirNodeNum = 1; RoomAirNodeNum <= thisZoneInfo.NumOfAirNodes; ++RoomAirNodeNum) {
+            auto &surfList(NodeSurfaces(RoomAirNodeNum));
+            surfList.clear();
+            if (!thisZoneInfo.Node(RoomAirNodeNum).HasSurfacesAssigned) continue;
+            for (int SurfNum = Zone(ZoneNum).SurfaceFirst; SurfNum <= Zone(ZoneNum).SurfaceLast; ++SurfNum) {
+                if (!Surface(SurfNum).HeatTransSurf) continue; // Skip non - heat transfer surfaces
+                int const SurfIndex(SurfNum - Zone(ZoneNum).SurfaceFirst + 1);
+                if (thisZoneInfo.ControlAirNodeID == RoomAirNodeNum) {
+                    bool Found = false;
+                    for (int Loop = 1; Loop <= thisZoneInfo.NumOfAirNodes; ++Loop) {
+                        if (Loop != RoomAirNodeNum && thisZoneInfo.Node(Loop).SurfMask(SurfIndex)) {
+                            Found = true;
+                            break;
+                        }
+                    }
+                    if (Found) continue;
+                } else {
+                    if (!thisZoneInfo.Node(RoomAirNodeNum).SurfMask(SurfIndex)) continue;
+                }
+                surfList.push_back(SurfNum);
+            }
+        }
+
+        NodeSumsSetUp = true;
+    } // SetupNodeSums
+
     void RAFNData::CalcSurfaceMoistureSums(
         int const RoomAirNode, Real64 &SumHmAW, Real64 &SumHmARa, Real64 &SumHmARaW, Array1<bool> const &EP_UNUSED(SurfMask))
     {
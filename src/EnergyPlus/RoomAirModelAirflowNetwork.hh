@@ -51,6 +51,9 @@
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 
+// C++ Headers
+#include <vector>
+
 namespace EnergyPlus {
 
 namespace RoomAirModelAirflowNetwork {
@@ -63,9 +66,14 @@ namespace RoomAirModelAirflowNetwork {
     public:
         int ZoneNum;
         int RoomAirNode;
+        bool NodeSumsSetUp;                     // true once the zone configuration and node surface lists below are filled
+        int ZoneEquipConfigIndex;               // zone equipment configuration serving the zone, 0 if not a controlled zone
+        int ZoneRetPlenumIndex;                 // return plenum for the zone, 0 if not a return plenum
+        int ZoneSupPlenumIndex;                 // supply plenum for the zone, 0 if not a supply plenum
+        Array1D<std::vector<int>> NodeSurfaces; // heat transfer surfaces whose convection is summed into each room air node
 
         // constructor
-        RAFNData() : ZoneNum(0), RoomAirNode(0)
+        RAFNData() : ZoneNum(0), RoomAirNode(0), NodeSumsSetUp(false), ZoneEquipConfigIndex(0), ZoneRetPlenumIndex(0), ZoneSupPlenumIndex(0)
         {
         }
 
@@ -83,6 +91,9 @@ namespace RoomAirModelAirflowNetwork {
         //*****************************************************************************************
         void CalcNodeSums(int const RoomAirNode); // index number for the specified zone and room air node
 
+        //*****************************************************************************************
+        void SetupNodeSums(); // fill the zone configuration and node surface lists used by CalcNodeSums
+
         //*****************************************************************************************
         void SumNonAirSystemResponseForNode(int const RoomAirNode); // index number for the specified zone and room air node
         //*****************************************************************************************
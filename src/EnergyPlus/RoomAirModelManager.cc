@@ -1965,6 +1965,8 @@ namespace RoomAirModelManager {
             HInternal.allocate(TotSurfaces);
             HWindow.allocate(TotSurfaces);
             HDoor.allocate(TotSurfaces);
+            SurfMinZ.dimension(TotSurfaces, 0.0);
+            SurfMaxZ.dimension(TotSurfaces, 0.0);
 
             AuxSurf.allocate(NumOfZones);
 
@@ -2013,6 +2015,8 @@ namespace RoomAirModelManager {
                             Z1Zone = std::min(Z1Zone, z_i);
                             Z2Zone = std::max(Z2Zone, z_i);
                         }
+                        SurfMinZ(SurfNum) = Z1Zone;
+                        SurfMaxZ(SurfNum) = Z2Zone;
                     }
 
                     if (SetZoneAux) {
@@ -0,0 +1,349 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// C++ Headers
+#include <cmath>
+#include <iostream>
+#include <unordered_map>
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/gio.hh>
+
+// EnergyPlus Headers
+#include <DataGlobals.hh>
+#include <DataRuntimeLanguage.hh>
+#include <DataStringGlobals.hh>
+#include <EMSManager.hh>
+#include <FileSystem.hh>
+#include <OutputProcessor.hh>
+#include <RuntimeExchange.hh>
+#include <SQLiteProcedures.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace RuntimeExchange {
+
+    // Module containing the state behind the runtime data exchange API
+
+    // MODULE INFORMATION:
+    //       AUTHOR         na
+    //       DATE WRITTEN   October 2026
+    //       MODIFIED       na
+    //       RE-ENGINEERED  na
+
+    // PURPOSE OF THIS MODULE:
+    // Let a host program run code at EMS calling points and exchange values with the simulation through integer
+    // handles, without the sockets and by-name copies of ExternalInterface.
+
+    // METHODOLOGY EMPLOYED:
+    // Callbacks run from ManageEMS after the Erl programs of their calling point.  Handles are resolved once by
+    // name: output variables to their output processor type and index, internal variables and actuators to their
+    // index in the EMS available lists, whose pointers are then used directly.
+
+    using namespace DataRuntimeLanguage;
+
+    // MODULE PARAMETER DEFINITIONS:
+    int const MaxOutputUnit(1000); // largest gio unit scanned for open output files
+
+    // MODULE VARIABLE DECLARATIONS:
+    std::vector<CallbackType> Callback;             // registered host callbacks, in registration order
+    std::vector<VariableHandleType> VariableHandle; // output variables looked up by the host, handle - 1
+    std::vector<int> ForkProcessId;                 // process ids of the copies made by ForkSimulation, copy - 1
+
+    // Functions
+    void clear_state()
+    {
+        // Callbacks are registered by the host before RunEnergyPlus clears the state, so they are kept
+        VariableHandle.clear();
+    }
+
+    void ClearCallbacks()
+    {
+        Callback.clear();
+    }
+
+    bool AnyCallbacks()
+    {
+        return !Callback.empty();
+    }
+
+    bool RunCallbacks(int const CallingPoint)
+    {
+        // Returns true if any host callback ran for this calling point
+        bool anyCallbackRan = false;
+        for (auto const &thisCallback : Callback) {
+            if (thisCallback.CallingPoint != CallingPoint) continue;
+            thisCallback.Function(thisCallback.UserData);
+            anyCallbackRan = true;
+        }
+        return anyCallbackRan;
+    }
+
+    int RegisterCallback(int const CallingPoint, void (*Function)(void *), void *UserData)
+    {
+        // Setup simulation and user defined component calling points are not available to the host
+        if (CallingPoint < DataGlobals::emsCallFromZoneSizing || CallingPoint > DataGlobals::emsCallFromBeginZoneTimestepAfterInitHeatBalance ||
+            CallingPoint == DataGlobals::emsCallFromSetupSimulation || CallingPoint == DataGlobals::emsCallFromUserDefinedComponentModel ||
+            Function == nullptr) {
+            return 0;
+        }
+
+        CallbackType thisCallback;
+        thisCallback.CallingPoint = CallingPoint;
+        thisCallback.Function = Function;
+        thisCallback.UserData = UserData;
+        Callback.push_back(thisCallback);
+        return Callback.size();
+    }
+
+    int GetVariableHandle(std::string const &VarName, std::string const &KeyName)
+    {
+        int VarType;
+        int VarIndex;
+        EMSManager::GetVariableTypeAndIndex(VarName, UtilityRoutines::MakeUPPERCase(KeyName), VarType, VarIndex);
+        if (VarIndex <= 0) return 0;
+
+        for (std::size_t HandleNum = 0; HandleNum < VariableHandle.size(); ++HandleNum) {
+            if (VariableHandle[HandleNum].Type == VarType && VariableHandle[HandleNum].Index == VarIndex) return HandleNum + 1;
+        }
+        VariableHandleType thisHandle;
+        thisHandle.Type = VarType;
+        thisHandle.Index = VarIndex;
+        VariableHandle.push_back(thisHandle);
+        return VariableHandle.size();
+    }
+
+    Real64 GetVariableValue(int const Handle)
+    {
+        if (Handle <= 0 || Handle > int(VariableHandle.size())) return 0.0;
+        return EnergyPlus::GetInternalVariableValue(VariableHandle[Handle - 1].Type, VariableHandle[Handle - 1].Index);
+    }
+
+    int GetInternalVariableHandle(std::string const &DataTypeName, std::string const &UniqueIDName)
+    {
+        for (int InternVarNum = 1; InternVarNum <= numEMSInternalVarsAvailable; ++InternVarNum) {
+            if (UtilityRoutines::SameString(EMSInternalVarsAvailable(InternVarNum).DataTypeName, DataTypeName) &&
+                UtilityRoutines::SameString(EMSInternalVarsAvailable(InternVarNum).UniqueIDName, UniqueIDName)) {
+                return InternVarNum;
+            }
+        }
+        return 0;
+    }
+
+    Real64 GetInternalVariableValue(int const Handle)
+    {
+        if (Handle <= 0 || Handle > numEMSInternalVarsAvailable) return 0.0;
+        auto const &thisInternalVar = EMSInternalVarsAvailable(Handle);
+        if (thisInternalVar.PntrVarTypeUsed == PntrReal) {
+            return thisInternalVar.RealValue();
+        } else if (thisInternalVar.PntrVarTypeUsed == PntrInteger) {
+            return double(thisInternalVar.IntValue());
+        }
+        return 0.0;
+    }
+
+    int GetActuatorHandle(std::string const &ComponentTypeName, std::string const &ControlTypeName, std::string const &UniqueIDName)
+    {
+        for (int ActuatorVariableNum = 1; ActuatorVariableNum <= numEMSActuatorsAvailable; ++ActuatorVariableNum) {
+            if (UtilityRoutines::SameString(EMSActuatorAvailable(ActuatorVariableNum).ComponentTypeName, ComponentTypeName) &&
+                UtilityRoutines::SameString(EMSActuatorAvailable(ActuatorVariableNum).ControlTypeName, ControlTypeName) &&
+                UtilityRoutines::SameString(EMSActuatorAvailable(ActuatorVariableNum).UniqueIDName, UniqueIDName)) {
+                return ActuatorVariableNum;
+            }
+        }
+        return 0;
+    }
+
+    void SetActuatorValue(int const Handle, Real64 const Value)
+    {
+        // Same conversions as the actuators set by Erl programs in ManageEMS
+        if (Handle <= 0 || Handle > numEMSActuatorsAvailable) return;
+        auto &thisActuator = EMSActuatorAvailable(Handle);
+        if (thisActuator.PntrVarTypeUsed == PntrReal) {
+            thisActuator.Actuated = true;
+            thisActuator.RealValue = Value;
+        } else if (thisActuator.PntrVarTypeUsed == PntrInteger) {
+            thisActuator.Actuated = true;
+            thisActuator.IntValue = int(std::floor(Value));
+        } else if (thisActuator.PntrVarTypeUsed == PntrLogical) {
+            thisActuator.Actuated = true;
+            thisActuator.LogValue = (Value == 1.0);
+        }
+    }
+
+    void ResetActuator(int const Handle)
+    {
+        if (Handle <= 0 || Handle > numEMSActuatorsAvailable) return;
+        EMSActuatorAvailable(Handle).Actuated = false;
+    }
+
+    int ForkSimulation(int const NumCopies)
+    {
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Clones the running simulation, with everything it has set up so far, into NumCopies new processes.
+        // Returns 0 in the calling process, the copy number (1 to NumCopies) in each copy, and -1 if no copy was made.
+
+        // METHODOLOGY EMPLOYED:
+        // The simulation state is process wide, so the copies are made with fork and share nothing afterwards.
+        // Output files are flushed first so that each copy starts from what was written before the fork, then
+        // every copy moves its output files to the subdirectory forkN of the output directory.  The SQLite
+        // output cannot be shared by two processes, so a simulation that writes it is not forked.
+
+#ifdef _WIN32
+        ShowWarningError("ForkSimulation: Forking a simulation is not supported on Windows.");
+        return -1;
+#else
+        if (NumCopies <= 0) return -1;
+        if (sqlite) {
+            ShowWarningError("ForkSimulation: A simulation that writes SQLite output cannot be forked.");
+            return -1;
+        }
+
+        for (int Unit = 1; Unit <= MaxOutputUnit; ++Unit) {
+            ObjexxFCL::gio::flush(Unit);
+        }
+        std::cout.flush();
+        std::cerr.flush();
+
+        for (int CopyNum = 1; CopyNum <= NumCopies; ++CopyNum) {
+            pid_t const ProcessId = fork();
+            if (ProcessId == 0) {
+                ForkProcessId.clear();
+                RelocateOutputFiles(DataStringGlobals::outputDirPathName + "fork" + std::to_string(CopyNum) + DataStringGlobals::pathChar);
+                return CopyNum;
+            } else if (ProcessId < 0) {
+                ShowWarningError("ForkSimulation: Could only make " + std::to_string(CopyNum - 1) + " of " + std::to_string(NumCopies) +
+                                 " copies of the simulation.");
+                return (CopyNum == 1) ? -1 : 0;
+            }
+            ForkProcessId.push_back(ProcessId);
+        }
+        return 0;
+#endif
+    }
+
+    void RelocateOutputFiles(std::string const &OutputDirectory)
+    {
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Moves the output files of this process to OutputDirectory, keeping what they hold so far.
+
+        // METHODOLOGY EMPLOYED:
+        // Every output file name in the output directory is renamed into OutputDirectory, so files opened from now
+        // on are written there.  Output files that are already open are copied and reopened for appending on the
+        // same unit, and the cached streams that pointed at them are redirected.  Their buffers must be empty.
+
+        FileSystem::makeDirectory(OutputDirectory);
+
+        std::string const &OldDirectory(DataStringGlobals::outputDirPathName);
+        std::unordered_map<std::string, std::string> NewFileName;
+        for (auto *FileName : DataStringGlobals::outputFileNames()) {
+            if (FileName->empty() || FileName->compare(0, OldDirectory.size(), OldDirectory) != 0) continue;
+            std::string const Relocated(OutputDirectory + FileName->substr(OldDirectory.size()));
+            NewFileName.emplace(*FileName, Relocated);
+            *FileName = Relocated;
+        }
+
+        std::ostream **const CachedStreams[] = {
+            &DataGlobals::eso_stream, &DataGlobals::err_stream, &DataGlobals::eio_stream, &DataGlobals::mtr_stream, &DataGlobals::delightin_stream};
+
+        for (int Unit = 1; Unit <= MaxOutputUnit; ++Unit) {
+            IOFlags flags;
+            ObjexxFCL::gio::inquire(Unit, flags);
+            if (!flags.open() || !flags.write()) continue;
+            auto const Found = NewFileName.find(flags.name());
+            if (Found == NewFileName.end()) continue;
+
+            std::ostream *const OldStream = ObjexxFCL::gio::out_stream(Unit);
+            ObjexxFCL::gio::close(Unit);
+            FileSystem::copyFile(Found->first, Found->second);
+            {
+                IOFlags appendFlags;
+                appendFlags.ACTION("write");
+                appendFlags.POSITION("APPEND");
+                ObjexxFCL::gio::open(Unit, Found->second, appendFlags);
+            }
+            std::ostream *const NewStream = ObjexxFCL::gio::out_stream(Unit);
+            for (auto CachedStream : CachedStreams) {
+                if (*CachedStream == OldStream) *CachedStream = NewStream;
+            }
+        }
+    }
+
+    int WaitForForks()
+    {
+        // Waits for the copies made by ForkSimulation; returns how many of them did not complete successfully
+        int NumFailed = 0;
+#ifndef _WIN32
+        for (int const ProcessId : ForkProcessId) {
+            int Status = 0;
+            if (waitpid(ProcessId, &Status, 0) < 0 || !WIFEXITED(Status) || WEXITSTATUS(Status) != EXIT_SUCCESS) ++NumFailed;
+        }
+#endif
+        ForkProcessId.clear();
+        return NumFailed;
+    }
+
+} // namespace RuntimeExchange
+
+} // namespace EnergyPlus
@@ -931,14 +931,14 @@ namespace RuntimeLanguageProcessor {
                         ErlVariable(VariableNum).Value = ReturnValue;
                     } else if (ErlVariable(VariableNum).Value.TrendVariable) {
                         ErlVariable(VariableNum).Value.Number = ReturnValue.Number;
-                        ErlVariable(VariableNum).Value.Error = ReturnValue.Error;
+                        ErlVariable(VariableNum).Value.ErrorNum = ReturnValue.ErrorNum;
                     }
 
                     WriteTrace(StackNum, InstructionNum, ReturnValue, seriousErrorFound);
 
                 } else if (SELECT_CASE_var == KeywordRun) {
                     ReturnValue.Type = ValueString;
-                    ReturnValue.String = "";
+                    ReturnValue.StringNum = 0;
                     WriteTrace(StackNum, InstructionNum, ReturnValue, seriousErrorFound);
                     ReturnValue = EvaluateStack(ErlStack(StackNum).Instruction(InstructionNum).Argument1);
 
@@ -966,14 +966,14 @@ namespace RuntimeLanguageProcessor {
 
                     // For debug purposes only...
                     ReturnValue.Type = ValueString;
-                    ReturnValue.String = ""; // IntegerToString(InstructionNum)
+                    ReturnValue.StringNum = 0; // IntegerToString(InstructionNum)
 
                     continue;
                     // PE if this ever went out of bounds, would the DO loop save it?  or need check here?
 
                 } else if (SELECT_CASE_var == KeywordEndIf) {
                     ReturnValue.Type = ValueString;
-                    ReturnValue.String = "";
+                    ReturnValue.StringNum = 0;
                     WriteTrace(StackNum, InstructionNum, ReturnValue, seriousErrorFound);
 
                 } else if (SELECT_CASE_var == KeywordWhile) {
@@ -1004,7 +1004,7 @@ namespace RuntimeLanguageProcessor {
                         if (WhileLoopExitCounter > MaxWhileLoopIterations) {
                             WhileLoopExitCounter = 0;
                             ReturnValue.Type = ValueError;
-                            ReturnValue.Error = "Maximum WHILE loop iteration limit reached";
+                            ReturnValue.ErrorNum = ErlValueErrorNum("Maximum WHILE loop iteration limit reached");
                             WriteTrace(StackNum, InstructionNum, ReturnValue, seriousErrorFound);
                         } else {
                             ReturnValue.Type = ValueNumber;
@@ -2041,6 +2041,191 @@ namespace RuntimeLanguageProcessor {
         return NumExpressions;
     }
 
+    bool CompileExpression(int const ExpressionNum, bool const TopLevel, std::vector<ErlByteCodeType> &ByteCode)
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Appends the postfix byte code of an expression and its nested expressions.  Returns false if the
+        // expression uses anything other than numbers, variables and the side effect free arithmetic, logical
+        // and math operators, in which case it is left to the general interpreter.
+
+        // METHODOLOGY EMPLOYED:
+        // A literal at the top level returns a copy of its operand, including everything but the number when
+        // the operand is a variable, so only numeric literals and nested expressions are accepted there.
+
+        ErlExpressionType const &thisExpression = ErlExpression(ExpressionNum);
+        int const Operator = thisExpression.Operator;
+
+        int NumOperandsExpected;
+        if (Operator == OperatorLiteral || Operator == OperatorNegative || Operator == FuncRound || Operator == FuncABS ||
+            (Operator >= FuncSin && Operator <= FuncLn)) {
+            NumOperandsExpected = 1;
+        } else if ((Operator >= OperatorDivide && Operator <= OperatiorLogicalOR) || Operator == FuncMod || Operator == FuncMax ||
+                   Operator == FuncMin) {
+            NumOperandsExpected = 2;
+        } else {
+            return false;
+        }
+        if (thisExpression.NumOperands != NumOperandsExpected) return false;
+
+        bool const OperandTopLevel = TopLevel && (Operator == OperatorLiteral);
+        for (int OperandNum = 1; OperandNum <= NumOperandsExpected; ++OperandNum) {
+            ErlValueType const &thisOperand = thisExpression.Operand(OperandNum);
+            ErlByteCodeType Code;
+            if (thisOperand.Type == ValueNumber) {
+                Code.Operator = ByteCodePushNumber;
+                Code.Number = thisOperand.Number;
+                ByteCode.push_back(Code);
+            } else if (thisOperand.Type == ValueVariable && !OperandTopLevel) {
+                Code.Operator = ByteCodePushVariable;
+                Code.Variable = thisOperand.Variable;
+                ByteCode.push_back(Code);
+            } else if (thisOperand.Type == ValueExpression) {
+                if (!CompileExpression(thisOperand.Expression, OperandTopLevel, ByteCode)) return false;
+            } else {
+                return false;
+            }
+        }
+
+        if (Operator != OperatorLiteral) {
+            ErlByteCodeType Code;
+            Code.Operator = Operator;
+            Code.NumOperands = NumOperandsExpected;
+            ByteCode.push_back(Code);
+        }
+        return true;
+    }
+
+    bool EvaluateCompiledExpression(int const ExpressionNum, Real64 &Result)
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Evaluates a numeric expression from its byte code, compiling it on first use.
+
+        // METHODOLOGY EMPLOYED:
+        // The byte code runs on a stack of plain numbers, so no Erl values or operand arrays are built.
+        // Returns false without side effects whenever the general interpreter is needed instead: the expression
+        // is not compilable, a variable holds no initialized number, or an operation would report an error.
+        // The general interpreter then evaluates the expression again and produces its usual error and trace.
+
+        using DataGlobals::DegToRadians;
+
+        static std::vector<Real64> Stack;
+
+        ErlExpressionType &thisExpression = ErlExpression(ExpressionNum);
+        if (thisExpression.CompileState == ByteCodeNotCompiled) {
+            thisExpression.ByteCode.clear();
+            if (CompileExpression(ExpressionNum, true, thisExpression.ByteCode)) {
+                thisExpression.CompileState = ByteCodeCompiled;
+            } else {
+                thisExpression.CompileState = ByteCodeNotCompilable;
+                thisExpression.ByteCode.clear();
+            }
+        }
+        if (thisExpression.CompileState != ByteCodeCompiled) return false;
+
+        Stack.clear();
+        for (auto const &Code : thisExpression.ByteCode) {
+            int const Operator = Code.Operator;
+            if (Operator == ByteCodePushNumber) {
+                Stack.push_back(Code.Number);
+                continue;
+            } else if (Operator == ByteCodePushVariable) {
+                ErlValueType const &thisValue = ErlVariable(Code.Variable).Value;
+                if (!thisValue.initialized || thisValue.Type != ValueNumber) return false;
+                Stack.push_back(thisValue.Number);
+                continue;
+            }
+
+            Real64 const Arg1 = Stack[Stack.size() - Code.NumOperands];
+            Real64 const Arg2 = (Code.NumOperands == 2) ? Stack.back() : 0.0;
+            Stack.resize(Stack.size() - Code.NumOperands);
+            Real64 Value;
+            if (Operator == OperatorNegative) {
+                Value = -1.0 * Arg1;
+            } else if (Operator == OperatorDivide) {
+                if (Arg2 == 0.0) return false;
+                Value = Arg1 / Arg2;
+            } else if (Operator == OperatorMultiply) {
+                Value = Arg1 * Arg2;
+            } else if (Operator == OperatorSubtract) {
+                Value = Arg1 - Arg2;
+            } else if (Operator == OperatorAdd) {
+                Value = Arg1 + Arg2;
+            } else if (Operator == OperatorEqual) {
+                Value = (Arg1 == Arg2) ? True.Number : False.Number;
+            } else if (Operator == OperatorNotEqual) {
+                Value = (Arg1 != Arg2) ? True.Number : False.Number;
+            } else if (Operator == OperatorLessOrEqual) {
+                Value = (Arg1 <= Arg2) ? True.Number : False.Number;
+            } else if (Operator == OperatorGreaterOrEqual) {
+                Value = (Arg1 >= Arg2) ? True.Number : False.Number;
+            } else if (Operator == OperatorLessThan) {
+                Value = (Arg1 < Arg2) ? True.Number : False.Number;
+            } else if (Operator == OperatorGreaterThan) {
+                Value = (Arg1 > Arg2) ? True.Number : False.Number;
+            } else if (Operator == OperatorRaiseToPower) {
+                Value = std::pow(Arg1, Arg2);
+                if (std::isnan(Value)) return false;
+            } else if (Operator == OperatorLogicalAND) {
+                Value = ((Arg1 == True.Number) && (Arg2 == True.Number)) ? True.Number : False.Number;
+            } else if (Operator == OperatiorLogicalOR) {
+                Value = ((Arg1 == True.Number) || (Arg2 == True.Number)) ? True.Number : False.Number;
+            } else if (Operator == FuncRound) {
+                Value = nint(Arg1);
+            } else if (Operator == FuncMod) {
+                Value = mod(Arg1, Arg2);
+            } else if (Operator == FuncSin) {
+                Value = std::sin(Arg1);
+            } else if (Operator == FuncCos) {
+                Value = std::cos(Arg1);
+            } else if (Operator == FuncArcSin) {
+                Value = std::asin(Arg1);
+            } else if (Operator == FuncArcCos) {
+                Value = std::acos(Arg1);
+            } else if (Operator == FuncDegToRad) {
+                Value = Arg1 * DegToRadians;
+            } else if (Operator == FuncRadToDeg) {
+                Value = Arg1 / DegToRadians;
+            } else if (Operator == FuncExp) {
+                if ((Arg1 < 700.0) && (Arg1 > -20.0)) {
+                    Value = std::exp(Arg1);
+                } else if (Arg1 <= -20.0) {
+                    Value = 0.0;
+                } else {
+                    return false;
+                }
+            } else if (Operator == FuncLn) {
+                if (Arg1 <= 0.0) return false;
+                Value = std::log(Arg1);
+            } else if (Operator == FuncMax) {
+                Value = max(Arg1, Arg2);
+            } else if (Operator == FuncMin) {
+                Value = min(Arg1, Arg2);
+            } else if (Operator == FuncABS) {
+                Value = std::abs(Arg1);
+            } else {
+                return false;
+            }
+            Stack.push_back(Value);
+        }
+
+        Result = Stack.back();
+        return true;
+    }
+
     ErlValueType EvaluateExpression(int const ExpressionNum, bool &seriousErrorFound)
     {
 
@@ -2097,6 +2282,10 @@ namespace RuntimeLanguageProcessor {
         ReturnValue.Number = 0.0;
 
         if (ExpressionNum > 0) {
+            // Purely numeric expressions run from their compiled byte code
+            Real64 CompiledResult;
+            if (EvaluateCompiledExpression(ExpressionNum, CompiledResult)) return SetErlValueNumber(CompiledResult);
+
             // is there a way to keep these and not allocate and deallocate all the time?
             Operand.allocate(ErlExpression(ExpressionNum).NumOperands);
             // Reduce operands down to literals
@@ -2107,7 +2296,7 @@ namespace RuntimeLanguageProcessor {
                     // check if recursive call found an error in nested expression, want to preserve error message from that
                     if (seriousErrorFound) {
                         ReturnValue.Type = ValueError;
-                        ReturnValue.Error = Operand(OperandNum).Error;
+                        ReturnValue.ErrorNum = Operand(OperandNum).ErrorNum;
                     }
 
                 } else if (Operand(OperandNum).Type == ValueVariable) {
@@ -2115,8 +2304,8 @@ namespace RuntimeLanguageProcessor {
                         Operand(OperandNum) = ErlVariable(Operand(OperandNum).Variable).Value;
                     } else { // value has never been set
                         ReturnValue.Type = ValueError;
-                        ReturnValue.Error = "EvaluateExpression: Variable = '" + ErlVariable(Operand(OperandNum).Variable).Name +
-                                            "' used in expression has not been initialized!";
+                        ReturnValue.ErrorNum = ErlValueErrorNum("EvaluateExpression: Variable = '" + ErlVariable(Operand(OperandNum).Variable).Name +
+                                                                "' used in expression has not been initialized!");
                         if (!DoingSizing && !KickOffSimulation && !EMSManager::FinishProcessingUserInput) {
 
                             // check if this is an arg in CurveValue,
@@ -2144,7 +2333,7 @@ namespace RuntimeLanguageProcessor {
                         if ((Operand(1).Type == ValueNumber) && (Operand(2).Type == ValueNumber)) {
                             if (Operand(2).Number == 0.0) {
                                 ReturnValue.Type = ValueError;
-                                ReturnValue.Error = "EvaluateExpression: Divide By Zero in EMS Program!";
+                                ReturnValue.ErrorNum = ErlValueErrorNum("EvaluateExpression: Divide By Zero in EMS Program!");
                                 if (!DoingSizing && !KickOffSimulation && !EMSManager::FinishProcessingUserInput) {
                                     seriousErrorFound = true;
                                 }
@@ -2230,8 +2419,9 @@ namespace RuntimeLanguageProcessor {
                             if (std::isnan(TestValue)) {
                                 // throw Error
                                 ReturnValue.Type = ValueError;
-                                ReturnValue.Error = "EvaluateExpression: Attempted to raise to power with incompatible numbers: " +
-                                                    TrimSigDigits(Operand(1).Number, 6) + " raised to " + TrimSigDigits(Operand(2).Number, 6);
+                                ReturnValue.ErrorNum =
+                                    ErlValueErrorNum("EvaluateExpression: Attempted to raise to power with incompatible numbers: " +
+                                                     TrimSigDigits(Operand(1).Number, 6) + " raised to " + TrimSigDigits(Operand(2).Number, 6));
                                 if (!DoingSizing && !KickOffSimulation && !EMSManager::FinishProcessingUserInput) {
                                     seriousErrorFound = true;
                                 }
@@ -2278,8 +2468,8 @@ namespace RuntimeLanguageProcessor {
                             ReturnValue = SetErlValueNumber(0.0);
                         } else {
                             // throw Error
-                            ReturnValue.Error = "EvaluateExpression: Attempted to calculate exponential value of too large a number: " +
-                                                TrimSigDigits(Operand(1).Number, 4);
+                            ReturnValue.ErrorNum = ErlValueErrorNum(
+                                "EvaluateExpression: Attempted to calculate exponential value of too large a number: " + TrimSigDigits(Operand(1).Number, 4));
                             ReturnValue.Type = ValueError;
                             if (!DoingSizing && !KickOffSimulation && !EMSManager::FinishProcessingUserInput) {
                                 seriousErrorFound = true;
@@ -2291,8 +2481,8 @@ namespace RuntimeLanguageProcessor {
                         } else {
                             // throw error,
                             ReturnValue.Type = ValueError;
-                            ReturnValue.Error =
-                                "EvaluateExpression: Natural Log of zero or less! ln of value = " + TrimSigDigits(Operand(1).Number, 4);
+                            ReturnValue.ErrorNum =
+                                ErlValueErrorNum("EvaluateExpression: Natural Log of zero or less! ln of value = " + TrimSigDigits(Operand(1).Number, 4));
                             if (!DoingSizing && !KickOffSimulation && !EMSManager::FinishProcessingUserInput) {
                                 seriousErrorFound = true;
                             }
@@ -2500,15 +2690,16 @@ namespace RuntimeLanguageProcessor {
                                     ReturnValue = SetErlValueNumber(TrendVariable(thisTrend).TrendValARR(thisIndex), Operand(1));
                                 } else {
                                     ReturnValue.Type = ValueError;
-                                    ReturnValue.Error = "Built-in trend function called with index larger than what is being logged";
+                                    ReturnValue.ErrorNum = ErlValueErrorNum("Built-in trend function called with index larger than what is being logged");
                                 }
                             } else {
                                 ReturnValue.Type = ValueError;
-                                ReturnValue.Error = "Built-in trend function called with index less than 1";
+                                ReturnValue.ErrorNum = ErlValueErrorNum("Built-in trend function called with index less than 1");
                             }
                         } else { // not registered as a trend variable
                             ReturnValue.Type = ValueError;
-                            ReturnValue.Error = "Variable used with built-in trend function is not associated with a registered trend variable";
+                            ReturnValue.ErrorNum =
+                                ErlValueErrorNum("Variable used with built-in trend function is not associated with a registered trend variable");
                         }
 
                     } else if (SELECT_CASE_var == FuncTrendAverage) {
@@ -2523,15 +2714,16 @@ namespace RuntimeLanguageProcessor {
                                     ReturnValue = SetErlValueNumber(thisAverage, Operand(1));
                                 } else {
                                     ReturnValue.Type = ValueError;
-                                    ReturnValue.Error = "Built-in trend function called with index larger than what is being logged";
+                                    ReturnValue.ErrorNum = ErlValueErrorNum("Built-in trend function called with index larger than what is being logged");
                                 }
                             } else {
                                 ReturnValue.Type = ValueError;
-                                ReturnValue.Error = "Built-in trend function called with index less than 1";
+                                ReturnValue.ErrorNum = ErlValueErrorNum("Built-in trend function called with index less than 1");
                             }
                         } else { // not registered as a trend variable
                             ReturnValue.Type = ValueError;
-                            ReturnValue.Error = "Variable used with built-in trend function is not associated with a registered trend variable";
+                            ReturnValue.ErrorNum =
+                                ErlValueErrorNum("Variable used with built-in trend function is not associated with a registered trend variable");
                         }
                     } else if (SELECT_CASE_var == FuncTrendMax) {
                         if (Operand(1).TrendVariable) {
@@ -2554,15 +2746,16 @@ namespace RuntimeLanguageProcessor {
                                     ReturnValue = SetErlValueNumber(thisMax, Operand(1));
                                 } else {
                                     ReturnValue.Type = ValueError;
-                                    ReturnValue.Error = "Built-in trend function called with index larger than what is being logged";
+                                    ReturnValue.ErrorNum = ErlValueErrorNum("Built-in trend function called with index larger than what is being logged");
                                 }
                             } else {
                                 ReturnValue.Type = ValueError;
-                                ReturnValue.Error = "Built-in trend function called with index less than 1";
+                                ReturnValue.ErrorNum = ErlValueErrorNum("Built-in trend function called with index less than 1");
                             }
                         } else { // not registered as a trend variable
                             ReturnValue.Type = ValueError;
-                            ReturnValue.Error = "Variable used with built-in trend function is not associated with a registered trend variable";
+                            ReturnValue.ErrorNum =
+                                ErlValueErrorNum("Variable used with built-in trend function is not associated with a registered trend variable");
                         }
                     } else if (SELECT_CASE_var == FuncTrendMin) {
                         if (Operand(1).TrendVariable) {
@@ -2586,16 +2779,17 @@ namespace RuntimeLanguageProcessor {
 
                                 } else {
                                     ReturnValue.Type = ValueError;
-                                    ReturnValue.Error = "Built-in trend function called with index larger than what is being logged";
+                                    ReturnValue.ErrorNum = ErlValueErrorNum("Built-in trend function called with index larger than what is being logged");
                                 }
 
                             } else {
                                 ReturnValue.Type = ValueError;
-                                ReturnValue.Error = "Built-in trend function called with index less than 1";
+                                ReturnValue.ErrorNum = ErlValueErrorNum("Built-in trend function called with index less than 1");
                             }
                         } else { // not registered as a trend variable
                             ReturnValue.Type = ValueError;
-                            ReturnValue.Error = "Variable used with built-in trend function is not associated with a registered trend variable";
+                            ReturnValue.ErrorNum =
+                                ErlValueErrorNum("Variable used with built-in trend function is not associated with a registered trend variable");
                         }
                     } else if (SELECT_CASE_var == FuncTrendDirection) {
                         if (Operand(1).TrendVariable) {
@@ -2615,16 +2809,17 @@ namespace RuntimeLanguageProcessor {
                                     ReturnValue = SetErlValueNumber(thisSlope, Operand(1)); // rate of change per hour
                                 } else {
                                     ReturnValue.Type = ValueError;
-                                    ReturnValue.Error = "Built-in trend function called with index larger than what is being logged";
+                                    ReturnValue.ErrorNum = ErlValueErrorNum("Built-in trend function called with index larger than what is being logged");
                                 }
 
                             } else {
                                 ReturnValue.Type = ValueError;
-                                ReturnValue.Error = "Built-in trend function called with index less than 1";
+                                ReturnValue.ErrorNum = ErlValueErrorNum("Built-in trend function called with index less than 1");
                             }
                         } else { // not registered as a trend variable
                             ReturnValue.Type = ValueError;
-                            ReturnValue.Error = "Variable used with built-in trend function is not associated with a registered trend variable";
+                            ReturnValue.ErrorNum =
+                                ErlValueErrorNum("Variable used with built-in trend function is not associated with a registered trend variable");
                         }
                     } else if (SELECT_CASE_var == FuncTrendSum) {
                         if (Operand(1).TrendVariable) {
@@ -2636,15 +2831,16 @@ namespace RuntimeLanguageProcessor {
                                     ReturnValue = SetErlValueNumber(sum(TrendVariable(thisTrend).TrendValARR({1, thisIndex})), Operand(1));
                                 } else {
                                     ReturnValue.Type = ValueError;
-                                    ReturnValue.Error = "Built-in trend function called with index larger than what is being logged";
+                                    ReturnValue.ErrorNum = ErlValueErrorNum("Built-in trend function called with index larger than what is being logged");
                                 }
                             } else {
                                 ReturnValue.Type = ValueError;
-                                ReturnValue.Error = "Built-in trend function called with index less than 1";
+                                ReturnValue.ErrorNum = ErlValueErrorNum("Built-in trend function called with index less than 1");
                             }
                         } else { // not registered as a trend variable
                             ReturnValue.Type = ValueError;
-                            ReturnValue.Error = "Variable used with built-in trend function is not associated with a registered trend variable";
+                            ReturnValue.ErrorNum =
+                                ErlValueErrorNum("Variable used with built-in trend function is not associated with a registered trend variable");
                         }
                     } else if (SELECT_CASE_var == FuncCurveValue) {
                         if (Operand(3).Type == 0 && Operand(4).Type == 0 && Operand(5).Type == 0 && Operand(6).Type == 0) {
@@ -2697,6 +2893,63 @@ namespace RuntimeLanguageProcessor {
         return ReturnValue;
     }
 
+    void MarkExpressionVariables(int const ExpressionNum, Array1D_bool &VariableUsed)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Flags the Erl variables read by an expression and its nested expressions.
+
+        if (ExpressionNum <= 0) return;
+
+        for (int OperandNum = 1; OperandNum <= ErlExpression(ExpressionNum).NumOperands; ++OperandNum) {
+            ErlValueType const &thisOperand = ErlExpression(ExpressionNum).Operand(OperandNum);
+            if (thisOperand.Type == ValueVariable) {
+                if (thisOperand.Variable > 0 && thisOperand.Variable <= isize(VariableUsed)) VariableUsed(thisOperand.Variable) = true;
+            } else if (thisOperand.Type == ValueExpression) {
+                MarkExpressionVariables(thisOperand.Expression, VariableUsed);
+            }
+        }
+    }
+
+    void MarkStackVariables(int const StackNum, Array1D_bool &VariableUsed, Array1D_bool &StackVisited)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Flags the Erl variables used by a program or subroutine, including the subroutines it runs.
+
+        // METHODOLOGY EMPLOYED:
+        // Follows the same instruction arguments EvaluateStack does.  StackVisited stops recursive RUN chains.
+
+        if (StackNum <= 0 || StackVisited(StackNum)) return;
+        StackVisited(StackNum) = true;
+
+        for (int InstructionNum = 1; InstructionNum <= ErlStack(StackNum).NumInstructions; ++InstructionNum) {
+            InstructionType const &thisInstruction = ErlStack(StackNum).Instruction(InstructionNum);
+            int const Keyword = thisInstruction.Keyword;
+            if (Keyword == KeywordSet) {
+                if (thisInstruction.Argument1 > 0 && thisInstruction.Argument1 <= isize(VariableUsed)) VariableUsed(thisInstruction.Argument1) = true;
+                MarkExpressionVariables(thisInstruction.Argument2, VariableUsed);
+            } else if (Keyword == KeywordRun) {
+                MarkStackVariables(thisInstruction.Argument1, VariableUsed, StackVisited);
+            } else if (Keyword == KeywordReturn || Keyword == KeywordIf || Keyword == KeywordElseIf || Keyword == KeywordElse ||
+                       Keyword == KeywordWhile || Keyword == KeywordEndWhile) {
+                MarkExpressionVariables(thisInstruction.Argument1, VariableUsed);
+            }
+        }
+    }
+
     void GetRuntimeLanguageUserInput()
     {
 
@@ -3888,11 +4141,37 @@ namespace RuntimeLanguageProcessor {
         // FLOW:
 
         Value.Type = ValueString;
-        Value.String = String;
+        if (!String.empty()) {
+            ErlValueString.push_back(String);
+            Value.StringNum = ErlValueString.size();
+        }
 
         return Value;
     }
 
+    int ErlValueErrorNum(std::string const &Error)
+    {
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns the ErrorNum of an error message for an Erl value, storing the message on first use.
+
+        // METHODOLOGY EMPLOYED:
+        // Messages are kept once each in ErlValueError, so repeated errors do not grow the table.
+
+        auto const found = ErlValueErrorLookup.find(Error);
+        if (found != ErlValueErrorLookup.end()) return found->second;
+
+        ErlValueError.push_back(Error);
+        int const ErrorNum = ErlValueError.size();
+        ErlValueErrorLookup.emplace(Error, ErrorNum);
+        return ErrorNum;
+    }
+
     std::string ValueToString(ErlValueType const &Value)
     {
         // FUNCTION INFORMATION:
@@ -3932,13 +4211,13 @@ namespace RuntimeLanguageProcessor {
                 }
 
             } else if (SELECT_CASE_var == ValueString) {
-                String = Value.String;
+                if (Value.StringNum > 0) String = ErlValueString[Value.StringNum - 1];
 
             } else if (SELECT_CASE_var == ValueArray) {
                 // TBD
 
             } else if (SELECT_CASE_var == ValueError) {
-                String = " *** Error: " + Value.Error + " *** ";
+                String = " *** Error: " + ((Value.ErrorNum > 0) ? ErlValueError[Value.ErrorNum - 1] : std::string()) + " *** ";
             }
         }
 
@@ -48,6 +48,9 @@
 #ifndef RuntimeLanguageProcessor_hh_INCLUDED
 #define RuntimeLanguageProcessor_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array1S.hh>
@@ -63,6 +66,7 @@ namespace EnergyPlus {
 namespace RuntimeLanguageProcessor {
 
     // Using/Aliasing
+    using DataRuntimeLanguage::ErlByteCodeType;
     using DataRuntimeLanguage::ErlValueType;
 
     // Data
@@ -216,8 +220,16 @@ namespace RuntimeLanguageProcessor {
 
     int NewExpression();
 
+    bool CompileExpression(int const ExpressionNum, bool const TopLevel, std::vector<ErlByteCodeType> &ByteCode);
+
+    bool EvaluateCompiledExpression(int const ExpressionNum, Real64 &Result);
+
     ErlValueType EvaluateExpression(int const ExpressionNum, bool &seriousErrorFound);
 
+    void MarkExpressionVariables(int const ExpressionNum, Array1D_bool &VariableUsed);
+
+    void MarkStackVariables(int const StackNum, Array1D_bool &VariableUsed, Array1D_bool &StackVisited);
+
     void GetRuntimeLanguageUserInput();
 
     void ReportRuntimeLanguage();
@@ -228,6 +240,8 @@ namespace RuntimeLanguageProcessor {
 
     ErlValueType StringValue(std::string const &String);
 
+    int ErlValueErrorNum(std::string const &Error);
+
     std::string ValueToString(ErlValueType const &Value);
 
     int FindEMSVariable(std::string const &VariableName, // variable name in Erl
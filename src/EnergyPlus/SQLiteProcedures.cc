@@ -200,16 +200,17 @@ SQLite::SQLite(std::shared_ptr<std::ostream> errorStream,
                bool writeOutputToSQLite,
                bool writeTabularDataToSQLite)
     : SQLiteProcedures(errorStream, writeOutputToSQLite, dbName, errorFileName), m_writeTabularDataToSQLite(writeTabularDataToSQLite),
-      m_sqlDBTimeIndex(0), m_reportDataInsertStmt(nullptr), m_reportExtendedDataInsertStmt(nullptr), m_reportDictionaryInsertStmt(nullptr),
-      m_timeIndexInsertStmt(nullptr), m_zoneInfoInsertStmt(nullptr), m_zoneInfoZoneListInsertStmt(nullptr), m_nominalLightingInsertStmt(nullptr),
-      m_nominalElectricEquipmentInsertStmt(nullptr), m_nominalGasEquipmentInsertStmt(nullptr), m_nominalSteamEquipmentInsertStmt(nullptr),
-      m_nominalHotWaterEquipmentInsertStmt(nullptr), m_nominalOtherEquipmentInsertStmt(nullptr), m_nominalBaseboardHeatInsertStmt(nullptr),
-      m_surfaceInsertStmt(nullptr), m_constructionInsertStmt(nullptr), m_constructionLayerInsertStmt(nullptr), m_materialInsertStmt(nullptr),
-      m_zoneListInsertStmt(nullptr), m_zoneGroupInsertStmt(nullptr), m_infiltrationInsertStmt(nullptr), m_ventilationInsertStmt(nullptr),
-      m_nominalPeopleInsertStmt(nullptr), m_zoneSizingInsertStmt(nullptr), m_systemSizingInsertStmt(nullptr), m_componentSizingInsertStmt(nullptr),
-      m_roomAirModelInsertStmt(nullptr), m_groundTemperatureInsertStmt(nullptr), m_weatherFileInsertStmt(nullptr), m_scheduleInsertStmt(nullptr),
-      m_daylightMapTitleInsertStmt(nullptr), m_daylightMapHourlyTitleInsertStmt(nullptr), m_daylightMapHourlyDataInsertStmt(nullptr),
-      m_environmentPeriodInsertStmt(nullptr), m_simulationsInsertStmt(nullptr), m_tabularDataInsertStmt(nullptr), m_stringsInsertStmt(nullptr),
+      m_sqlDBTimeIndex(0), m_reportDataInsertStmt(nullptr), m_reportDataBatchInsertStmt(nullptr), m_reportExtendedDataInsertStmt(nullptr),
+      m_reportDictionaryInsertStmt(nullptr), m_timeIndexInsertStmt(nullptr), m_zoneInfoInsertStmt(nullptr), m_zoneInfoZoneListInsertStmt(nullptr),
+      m_nominalLightingInsertStmt(nullptr), m_nominalElectricEquipmentInsertStmt(nullptr), m_nominalGasEquipmentInsertStmt(nullptr),
+      m_nominalSteamEquipmentInsertStmt(nullptr), m_nominalHotWaterEquipmentInsertStmt(nullptr), m_nominalOtherEquipmentInsertStmt(nullptr),
+      m_nominalBaseboardHeatInsertStmt(nullptr), m_surfaceInsertStmt(nullptr), m_constructionInsertStmt(nullptr),
+      m_constructionLayerInsertStmt(nullptr), m_materialInsertStmt(nullptr), m_zoneListInsertStmt(nullptr), m_zoneGroupInsertStmt(nullptr),
+      m_infiltrationInsertStmt(nullptr), m_ventilationInsertStmt(nullptr), m_nominalPeopleInsertStmt(nullptr), m_zoneSizingInsertStmt(nullptr),
+      m_systemSizingInsertStmt(nullptr), m_componentSizingInsertStmt(nullptr), m_roomAirModelInsertStmt(nullptr),
+      m_groundTemperatureInsertStmt(nullptr), m_weatherFileInsertStmt(nullptr), m_scheduleInsertStmt(nullptr), m_daylightMapTitleInsertStmt(nullptr),
+      m_daylightMapHourlyTitleInsertStmt(nullptr), m_daylightMapHourlyDataInsertStmt(nullptr), m_environmentPeriodInsertStmt(nullptr),
+      m_simulationsInsertStmt(nullptr), m_tabularDataInsertStmt(nullptr), m_tabularDataBatchInsertStmt(nullptr), m_stringsInsertStmt(nullptr),
       m_stringsLookUpStmt(nullptr), m_errorInsertStmt(nullptr), m_errorUpdateStmt(nullptr), m_simulationUpdateStmt(nullptr),
       m_simulationDataUpdateStmt(nullptr)
 {
@@ -266,6 +267,7 @@ SQLite::SQLite(std::shared_ptr<std::ostream> errorStream,
 SQLite::~SQLite()
 {
     sqlite3_finalize(m_reportDataInsertStmt);
+    sqlite3_finalize(m_reportDataBatchInsertStmt);
     sqlite3_finalize(m_reportExtendedDataInsertStmt);
     sqlite3_finalize(m_reportDictionaryInsertStmt);
     sqlite3_finalize(m_timeIndexInsertStmt);
@@ -300,6 +302,7 @@ SQLite::~SQLite()
     sqlite3_finalize(m_environmentPeriodInsertStmt);
     sqlite3_finalize(m_simulationsInsertStmt);
     sqlite3_finalize(m_tabularDataInsertStmt);
+    sqlite3_finalize(m_tabularDataBatchInsertStmt);
     sqlite3_finalize(m_stringsInsertStmt);
     sqlite3_finalize(m_stringsLookUpStmt);
     sqlite3_finalize(m_errorInsertStmt);
@@ -328,6 +331,8 @@ void SQLite::sqliteBegin()
 void SQLite::sqliteCommit()
 {
     if (m_writeOutputToSQLite) {
+        flushReportDataRecords();
+        flushTabularDataRecords();
         sqliteExecuteCommand("COMMIT;");
     }
 }
@@ -403,6 +408,20 @@ void SQLite::initializeReportDataTables()
 
     sqlitePrepareStatement(m_reportDataInsertStmt, reportDataInsertSQL);
 
+    std::string reportDataBatchInsertSQL = "INSERT INTO ReportData ("
+                                           "ReportDataIndex, "
+                                           "TimeIndex, "
+                                           "ReportDataDictionaryIndex, "
+                                           "Value) "
+                                           "VALUES(?,?,?,?)";
+    for (int row = 2; row <= ReportDataBatchSize; ++row) {
+        reportDataBatchInsertSQL += ",(?,?,?,?)";
+    }
+    reportDataBatchInsertSQL += ";";
+
+    sqlitePrepareStatement(m_reportDataBatchInsertStmt, reportDataBatchInsertSQL);
+    m_reportDataRows.reserve(ReportDataBatchSize);
+
     const std::string reportExtendedDataTableSQL = "CREATE TABLE ReportExtendedData ("
                                                    "ReportExtendedDataIndex INTEGER PRIMARY KEY, "
                                                    "ReportDataIndex INTEGER, "
@@ -1212,6 +1231,15 @@ void SQLite::initializeTabularDataTable()
     const std::string sql6 = "INSERT INTO TabularData VALUES(?,?,?,?,?,?,?,?,?,?,?);";
 
     sqlitePrepareStatement(m_tabularDataInsertStmt, sql6);
+
+    std::string sql7 = "INSERT INTO TabularData VALUES(?,?,?,?,?,?,?,?,?,?,?)";
+    for (int row = 2; row <= TabularDataBatchSize; ++row) {
+        sql7 += ",(?,?,?,?,?,?,?,?,?,?,?)";
+    }
+    sql7 += ";";
+
+    sqlitePrepareStatement(m_tabularDataBatchInsertStmt, sql7);
+    m_tabularDataRows.reserve(TabularDataBatchSize);
 }
 
 void SQLite::initializeTabularDataView()
@@ -1387,6 +1415,34 @@ void SQLite::createSQLiteReportDictionaryRecord(int const reportVariableReportID
     }
 }
 
+void SQLite::flushReportDataRecords()
+{
+    if (m_reportDataRows.empty()) return;
+
+    if (static_cast<int>(m_reportDataRows.size()) == ReportDataBatchSize) {
+        int column = 0;
+        for (auto const &row : m_reportDataRows) {
+            sqliteBindInteger(m_reportDataBatchInsertStmt, ++column, row.dataIndex);
+            sqliteBindForeignKey(m_reportDataBatchInsertStmt, ++column, row.timeIndex);
+            sqliteBindForeignKey(m_reportDataBatchInsertStmt, ++column, row.recordIndex);
+            sqliteBindDouble(m_reportDataBatchInsertStmt, ++column, row.value);
+        }
+        sqliteStepCommand(m_reportDataBatchInsertStmt);
+        sqliteResetCommand(m_reportDataBatchInsertStmt);
+    } else { // partial batch at the end of a transaction
+        for (auto const &row : m_reportDataRows) {
+            sqliteBindInteger(m_reportDataInsertStmt, 1, row.dataIndex);
+            sqliteBindForeignKey(m_reportDataInsertStmt, 2, row.timeIndex);
+            sqliteBindForeignKey(m_reportDataInsertStmt, 3, row.recordIndex);
+            sqliteBindDouble(m_reportDataInsertStmt, 4, row.value);
+
+            sqliteStepCommand(m_reportDataInsertStmt);
+            sqliteResetCommand(m_reportDataInsertStmt);
+        }
+    }
+    m_reportDataRows.clear();
+}
+
 void SQLite::createSQLiteReportDataRecord(int const recordIndex,
                                           Real64 const value,
                                           Optional_int_const reportingInterval,
@@ -1399,13 +1455,20 @@ void SQLite::createSQLiteReportDataRecord(int const recordIndex,
     if (m_writeOutputToSQLite) {
         ++m_dataIndex;
 
-        sqliteBindInteger(m_reportDataInsertStmt, 1, m_dataIndex);
-        sqliteBindForeignKey(m_reportDataInsertStmt, 2, m_sqlDBTimeIndex);
-        sqliteBindForeignKey(m_reportDataInsertStmt, 3, recordIndex);
-        sqliteBindDouble(m_reportDataInsertStmt, 4, value);
+        if (sqliteWithinTransaction()) {
+            // other connections do not see the rows before the commit, so they can wait for a full batch
+            ReportDataRow const row = {m_dataIndex, m_sqlDBTimeIndex, recordIndex, value};
+            m_reportDataRows.push_back(row);
+            if (static_cast<int>(m_reportDataRows.size()) == ReportDataBatchSize) flushReportDataRecords();
+        } else {
+            sqliteBindInteger(m_reportDataInsertStmt, 1, m_dataIndex);
+            sqliteBindForeignKey(m_reportDataInsertStmt, 2, m_sqlDBTimeIndex);
+            sqliteBindForeignKey(m_reportDataInsertStmt, 3, recordIndex);
+            sqliteBindDouble(m_reportDataInsertStmt, 4, value);
 
-        sqliteStepCommand(m_reportDataInsertStmt);
-        sqliteResetCommand(m_reportDataInsertStmt);
+            sqliteStepCommand(m_reportDataInsertStmt);
+            sqliteResetCommand(m_reportDataInsertStmt);
+        }
 
         if (reportingInterval.present() && minValueDate != 0 && maxValueDate != 0) {
             int minMonth;
@@ -1856,6 +1919,15 @@ void SQLite::createSQLiteTabularDataRecords(Array2D_string const &body, // html
         int const reportForStringIndex = createSQLiteStringTableRecord(reportForString, ReportForStringId);
         int const tableNameIndex = createSQLiteStringTableRecord(tableName, TableNameId);
         int unitsIndex;
+        bool const batched = sqliteWithinTransaction();
+
+        // The row labels are the same for every column, so they are parsed and their strings looked up once. The units of a
+        // row are only needed for columns without units and are looked up the first time such a column comes along, which
+        // keeps the Strings table numbered in the order the cells are written.
+        int const NotLookedUp = -2;
+        std::vector<int> rowLabelIndexes(sizeRowLabels, NotLookedUp);
+        std::vector<int> rowUnitsIndexes(sizeRowLabels, NotLookedUp);
+        std::vector<std::string> rowUnitsStrings(sizeRowLabels);
 
         for (size_t iCol = 0, k = body.index(1, 1); iCol < sizeColumnLabels; ++iCol) {
             std::string colUnits;
@@ -1870,30 +1942,48 @@ void SQLite::createSQLiteTabularDataRecords(Array2D_string const &body, // html
 
             for (size_t iRow = 0; iRow < sizeRowLabels; ++iRow) {
                 ++m_tabularDataIndex;
-                std::string rowUnits;
-                std::string rowDescription;
-                parseUnitsAndDescription(rowLabels[iRow], rowUnits, rowDescription);
-
-                int const rowLabelIndex = createSQLiteStringTableRecord(rowDescription, RowNameId);
+                if (rowLabelIndexes[iRow] == NotLookedUp) {
+                    std::string rowDescription;
+                    parseUnitsAndDescription(rowLabels[iRow], rowUnitsStrings[iRow], rowDescription);
+                    rowLabelIndexes[iRow] = createSQLiteStringTableRecord(rowDescription, RowNameId);
+                }
+                int const rowLabelIndex = rowLabelIndexes[iRow];
 
                 if (colUnits.empty()) {
-                    unitsIndex = createSQLiteStringTableRecord(rowUnits, UnitsId);
+                    if (rowUnitsIndexes[iRow] == NotLookedUp) rowUnitsIndexes[iRow] = createSQLiteStringTableRecord(rowUnitsStrings[iRow], UnitsId);
+                    unitsIndex = rowUnitsIndexes[iRow];
                 }
 
-                sqliteBindInteger(m_tabularDataInsertStmt, 1, m_tabularDataIndex);
-                sqliteBindForeignKey(m_tabularDataInsertStmt, 2, reportNameIndex);
-                sqliteBindForeignKey(m_tabularDataInsertStmt, 3, reportForStringIndex);
-                sqliteBindForeignKey(m_tabularDataInsertStmt, 4, tableNameIndex);
-                sqliteBindForeignKey(m_tabularDataInsertStmt, 5, rowLabelIndex);
-                sqliteBindForeignKey(m_tabularDataInsertStmt, 6, columnLabelIndex);
-                sqliteBindForeignKey(m_tabularDataInsertStmt, 7, unitsIndex);
-                sqliteBindForeignKey(m_tabularDataInsertStmt, 8, 1);
-                sqliteBindInteger(m_tabularDataInsertStmt, 9, iRow);
-                sqliteBindInteger(m_tabularDataInsertStmt, 10, iCol);
-                sqliteBindText(m_tabularDataInsertStmt, 11, body[k]);
-
-                sqliteStepCommand(m_tabularDataInsertStmt);
-                sqliteResetCommand(m_tabularDataInsertStmt);
+                if (batched) {
+                    // other connections do not see the rows before the commit, so they can wait for a full batch
+                    TabularDataRow const row = {m_tabularDataIndex,
+                                                reportNameIndex,
+                                                reportForStringIndex,
+                                                tableNameIndex,
+                                                rowLabelIndex,
+                                                columnLabelIndex,
+                                                unitsIndex,
+                                                static_cast<int>(iRow),
+                                                static_cast<int>(iCol),
+                                                body[k]};
+                    m_tabularDataRows.push_back(row);
+                    if (static_cast<int>(m_tabularDataRows.size()) == TabularDataBatchSize) flushTabularDataRecords();
+                } else {
+                    sqliteBindInteger(m_tabularDataInsertStmt, 1, m_tabularDataIndex);
+                    sqliteBindForeignKey(m_tabularDataInsertStmt, 2, reportNameIndex);
+                    sqliteBindForeignKey(m_tabularDataInsertStmt, 3, reportForStringIndex);
+                    sqliteBindForeignKey(m_tabularDataInsertStmt, 4, tableNameIndex);
+                    sqliteBindForeignKey(m_tabularDataInsertStmt, 5, rowLabelIndex);
+                    sqliteBindForeignKey(m_tabularDataInsertStmt, 6, columnLabelIndex);
+                    sqliteBindForeignKey(m_tabularDataInsertStmt, 7, unitsIndex);
+                    sqliteBindForeignKey(m_tabularDataInsertStmt, 8, 1);
+                    sqliteBindInteger(m_tabularDataInsertStmt, 9, iRow);
+                    sqliteBindInteger(m_tabularDataInsertStmt, 10, iCol);
+                    sqliteBindText(m_tabularDataInsertStmt, 11, body[k]);
+
+                    sqliteStepCommand(m_tabularDataInsertStmt);
+                    sqliteResetCommand(m_tabularDataInsertStmt);
+                }
 
                 ++k;
             }
@@ -1901,6 +1991,38 @@ void SQLite::createSQLiteTabularDataRecords(Array2D_string const &body, // html
     }
 }
 
+void SQLite::flushTabularDataRecords()
+{
+    if (m_tabularDataRows.empty()) return;
+
+    bool const fullBatch = static_cast<int>(m_tabularDataRows.size()) == TabularDataBatchSize;
+    sqlite3_stmt *stmt = fullBatch ? m_tabularDataBatchInsertStmt : m_tabularDataInsertStmt;
+    int column = 0;
+    for (auto const &row : m_tabularDataRows) {
+        sqliteBindInteger(stmt, ++column, row.tabularDataIndex);
+        sqliteBindForeignKey(stmt, ++column, row.reportNameIndex);
+        sqliteBindForeignKey(stmt, ++column, row.reportForStringIndex);
+        sqliteBindForeignKey(stmt, ++column, row.tableNameIndex);
+        sqliteBindForeignKey(stmt, ++column, row.rowLabelIndex);
+        sqliteBindForeignKey(stmt, ++column, row.columnLabelIndex);
+        sqliteBindForeignKey(stmt, ++column, row.unitsIndex);
+        sqliteBindForeignKey(stmt, ++column, 1);
+        sqliteBindInteger(stmt, ++column, row.rowId);
+        sqliteBindInteger(stmt, ++column, row.columnId);
+        sqliteBindText(stmt, ++column, row.value);
+        if (!fullBatch) { // partial batch at the end of a transaction
+            sqliteStepCommand(stmt);
+            sqliteResetCommand(stmt);
+            column = 0;
+        }
+    }
+    if (fullBatch) {
+        sqliteStepCommand(stmt);
+        sqliteResetCommand(stmt);
+    }
+    m_tabularDataRows.clear();
+}
+
 int SQLite::createSQLiteStringTableRecord(std::string const &stringValue, int const stringType)
 {
     int rowId = -1;
@@ -64,6 +64,7 @@
 #include <iosfwd>
 #include <map>
 #include <memory>
+#include <vector>
 
 namespace EnergyPlus {
 
@@ -325,7 +326,38 @@ private:
     int m_systemSizingIndex = 0;
     int m_componentSizingIndex = 0;
 
+    // ReportData rows written within a transaction are held back and inserted ReportDataBatchSize rows per statement
+    static int const ReportDataBatchSize = 100; // 4 parameters per row, within the default limit of 999
+    struct ReportDataRow
+    {
+        int dataIndex;
+        int timeIndex;
+        int recordIndex;
+        double value;
+    };
+    std::vector<ReportDataRow> m_reportDataRows;
+    void flushReportDataRecords();
+
+    // TabularData rows are held back the same way, TabularDataBatchSize rows per statement
+    static int const TabularDataBatchSize = 90; // 11 parameters per row, within the default limit of 999
+    struct TabularDataRow
+    {
+        int tabularDataIndex;
+        int reportNameIndex;
+        int reportForStringIndex;
+        int tableNameIndex;
+        int rowLabelIndex;
+        int columnLabelIndex;
+        int unitsIndex;
+        int rowId;
+        int columnId;
+        std::string value;
+    };
+    std::vector<TabularDataRow> m_tabularDataRows;
+    void flushTabularDataRecords();
+
     sqlite3_stmt *m_reportDataInsertStmt;
+    sqlite3_stmt *m_reportDataBatchInsertStmt;
     sqlite3_stmt *m_reportExtendedDataInsertStmt;
     sqlite3_stmt *m_reportDictionaryInsertStmt;
     sqlite3_stmt *m_timeIndexInsertStmt;
@@ -360,6 +392,7 @@ private:
     sqlite3_stmt *m_environmentPeriodInsertStmt;
     sqlite3_stmt *m_simulationsInsertStmt;
     sqlite3_stmt *m_tabularDataInsertStmt;
+    sqlite3_stmt *m_tabularDataBatchInsertStmt;
     sqlite3_stmt *m_stringsInsertStmt;
     sqlite3_stmt *m_stringsLookUpStmt;
     sqlite3_stmt *m_errorInsertStmt;
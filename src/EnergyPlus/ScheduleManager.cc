@@ -47,6 +47,7 @@
 
 // C++ Headers
 #include <map>
+#include <unordered_map>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -191,6 +192,17 @@ namespace ScheduleManager {
     Array1D<ScheduleData> Schedule; // Schedule Storage
     std::unordered_map<std::string, std::string> UniqueScheduleNames;
 
+    // Schedule timelines, used when DataSystemVariables::CompiledSchedules is set
+    bool ScheduleTimelinesCompiled(false);                // true once the change steps of the day schedules are known
+    bool ScheduleTimelineStale(true);                     // true if every schedule value must be set again at the next update
+    std::vector<int> ScheduleDayPointer;                  // Day schedule of each schedule for the current day
+    std::vector<std::vector<int>> SchedulesChangingAtStep; // Schedules whose value changes at each step of the current day
+    int TimelineDayOfYear(0);                             // Day the day schedule pointers and change lists were set up for
+    int TimelineDayOfWeek(0);
+    int TimelineHolidayIndex(0);
+    int TimelineDSTIndicator(0);
+    int TimelineDayStep(-1); // Step of the day the schedule values were last updated for
+
     static ObjexxFCL::gio::Fmt fmtLD("*");
     static ObjexxFCL::gio::Fmt fmtA("(A)");
 
@@ -217,6 +229,15 @@ namespace ScheduleManager {
         UniqueWeekScheduleNames.clear();
         Schedule.deallocate();
         UniqueScheduleNames.clear();
+        ScheduleTimelinesCompiled = false;
+        ScheduleTimelineStale = true;
+        ScheduleDayPointer.clear();
+        SchedulesChangingAtStep.clear();
+        TimelineDayOfYear = 0;
+        TimelineDayOfWeek = 0;
+        TimelineHolidayIndex = 0;
+        TimelineDSTIndicator = 0;
+        TimelineDayStep = -1;
     }
 
     void ProcessScheduleInput()
@@ -2343,6 +2364,8 @@ namespace ScheduleManager {
             }
         }
 
+        if (DataSystemVariables::DeduplicateSchedules) DeduplicateSchedules();
+
         Alphas.deallocate();
         cAlphaFields.deallocate();
         cNumericFields.deallocate();
@@ -2353,6 +2376,84 @@ namespace ScheduleManager {
         ObjexxFCL::gio::write(UnitNumber, fmtLD) << " Processing Schedule Input -- Complete";
     }
 
+    void DeduplicateSchedules()
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Share the values of identical schedules.  Day schedules with the same value at every time step keep
+        // one TSValue array, and schedules whose week schedules select the same values on every day of the
+        // year have their current value set once per time step and copied to the others.
+
+        // METHODOLOGY EMPLOYED:
+        // Day schedules are keyed by the bytes of their TSValue arrays.  Week schedule pointers to a duplicate
+        // day schedule are moved to the first one with those values (the pointers as input are kept for the
+        // "used" bookkeeping), and the TSValue of the duplicate is released.  Week schedules are then keyed
+        // by their day schedule pointers and schedules by the week schedule keys of their 366 days.  Every
+        // schedule keeps its own index, EMS actuator and name, so nothing outside this module changes.  The
+        // day and week schedules of ExternalInterface schedules are written during the run and are not shared.
+
+        // Min and max of each day schedule are needed later on and cannot be found once the values are released
+        if (CheckScheduleValueMinMaxRunOnceOnly) {
+            for (int Loop = 0; Loop <= NumDaySchedules; ++Loop) {
+                DaySchedule(Loop).TSValMin = minval(DaySchedule(Loop).TSValue);
+                DaySchedule(Loop).TSValMax = maxval(DaySchedule(Loop).TSValue);
+            }
+            CheckScheduleValueMinMaxRunOnceOnly = false;
+        }
+
+        std::vector<bool> Shareable(NumDaySchedules + 1, true);
+        for (int SchNum = 1; SchNum <= NumSchedules; ++SchNum) {
+            if (Schedule(SchNum).SchType != ScheduleInput_external) continue;
+            for (int DayOfYear = 1; DayOfYear <= 366; ++DayOfYear) {
+                int const WeekPtr(Schedule(SchNum).WeekSchedulePointer(DayOfYear));
+                if (WeekPtr <= 0) continue;
+                for (int DayType = 1; DayType <= MaxDayTypes; ++DayType) {
+                    Shareable[WeekSchedule(WeekPtr).DaySchedulePointer(DayType)] = false;
+                }
+            }
+        }
+
+        std::unordered_map<std::string, int> UniqueDayValues;
+        for (int DayIndex = 1; DayIndex <= NumDaySchedules; ++DayIndex) {
+            auto &thisDay(DaySchedule(DayIndex));
+            if (!Shareable[DayIndex] || !thisDay.TSValue.allocated()) continue;
+            std::string const Key(reinterpret_cast<char const *>(thisDay.TSValue.data()), thisDay.TSValue.size() * sizeof(Real64));
+            auto const Found(UniqueDayValues.emplace(Key, DayIndex));
+            if (Found.second) continue;
+            thisDay.SameAs = Found.first->second;
+            thisDay.TSValue.deallocate();
+            thisDay.ChangeSteps.clear();
+        }
+
+        std::unordered_map<std::string, int> UniqueWeeks;
+        std::vector<int> WeekKey(NumWeekSchedules + 1, 0);
+        for (int WeekIndex = 1; WeekIndex <= NumWeekSchedules; ++WeekIndex) {
+            auto &thisWeek(WeekSchedule(WeekIndex));
+            for (int DayType = 1; DayType <= MaxDayTypes; ++DayType) {
+                int const SameAs(DaySchedule(thisWeek.DaySchedulePointer(DayType)).SameAs);
+                if (SameAs == 0) continue;
+                if (!thisWeek.InputDaySchedulePointer.allocated()) thisWeek.InputDaySchedulePointer = thisWeek.DaySchedulePointer;
+                thisWeek.DaySchedulePointer(DayType) = SameAs;
+            }
+            std::string const Key(reinterpret_cast<char const *>(thisWeek.DaySchedulePointer.data()), MaxDayTypes * sizeof(int));
+            WeekKey[WeekIndex] = UniqueWeeks.emplace(Key, WeekIndex).first->second;
+        }
+
+        std::unordered_map<std::string, int> UniqueSchedules;
+        std::vector<int> YearKey(366);
+        for (int SchNum = 1; SchNum <= NumSchedules; ++SchNum) {
+            if (Schedule(SchNum).SchType == ScheduleInput_external) continue;
+            for (int DayOfYear = 1; DayOfYear <= 366; ++DayOfYear) {
+                YearKey[DayOfYear - 1] = WeekKey[Schedule(SchNum).WeekSchedulePointer(DayOfYear)];
+            }
+            std::string const Key(reinterpret_cast<char const *>(YearKey.data()), YearKey.size() * sizeof(int));
+            auto const Found(UniqueSchedules.emplace(Key, SchNum));
+            if (Found.second) continue;
+            Schedule(SchNum).SameAs = Found.first->second;
+            Schedule(Found.first->second).Duplicates.push_back(SchNum);
+        }
+    }
+
     void ReportScheduleDetails(int const LevelOfDetail) // =1: hourly; =2: timestep; = 3: make IDF excerpt
     {
 
@@ -2831,7 +2932,19 @@ namespace ScheduleManager {
 
         WhichHour = HourOfDay + DSTIndicator;
 
+        if (DataSystemVariables::CompiledSchedules) {
+            if (WhichHour <= 24) {
+                UpdateChangedScheduleValues(WhichHour, TimeStep);
+            } else if (TimeStep <= NumOfTimeStepInHour) {
+                UpdateChangedScheduleValues(WhichHour - 24, TimeStep);
+            } else {
+                UpdateChangedScheduleValues(WhichHour - 24, NumOfTimeStepInHour);
+            }
+            return;
+        }
+
         for (ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex) {
+            if (Schedule(ScheduleIndex).SameAs > 0) continue; // copied from the schedule with the same values
 
             // Determine which Week Schedule is used
             //  Cant use stored day of year because of leap year inconsistency
@@ -2852,9 +2965,99 @@ namespace ScheduleManager {
             } else {
                 Schedule(ScheduleIndex).CurrentValue = DaySchedule(DaySchedulePointer).TSValue(NumOfTimeStepInHour, WhichHour - 24);
             }
+            for (int const Duplicate : Schedule(ScheduleIndex).Duplicates) {
+                Schedule(Duplicate).CurrentValue = Schedule(ScheduleIndex).CurrentValue;
+            }
         }
     }
 
+    void CompileScheduleTimelines()
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Find, for each day schedule, the steps of the day at which its value changes.  Most day schedules
+        // change a handful of times a day or not at all, so the current values of the schedules only need
+        // to be set at those steps.
+
+        int const NumDaySteps(24 * NumOfTimeStepInHour);
+        for (int DayIndex = 1; DayIndex <= NumDaySchedules; ++DayIndex) {
+            auto &thisDay(DaySchedule(DayIndex));
+            thisDay.ChangeSteps.clear();
+            if (thisDay.SameAs > 0) continue; // week schedules point to the day schedule holding the values
+            for (int DayStep = 1; DayStep < NumDaySteps; ++DayStep) {
+                if (thisDay.TSValue[DayStep] != thisDay.TSValue[DayStep - 1]) thisDay.ChangeSteps.push_back(DayStep);
+            }
+        }
+        SchedulesChangingAtStep.resize(NumDaySteps);
+        ScheduleDayPointer.assign(NumSchedules + 1, 0);
+        ScheduleTimelinesCompiled = true;
+    }
+
+    void UpdateChangedScheduleValues(int const WhichHour,    // Hour of the day schedule, 1 to 24
+                                     int const WhichTimeStep // Time step of the hour
+    )
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Same result as the loop in UpdateScheduleValues, but only the schedules whose value changes at this
+        // step are set when the previous update was for the step before on the same day.
+
+        // METHODOLOGY EMPLOYED:
+        // At the first update of a day the day schedule of every schedule is found and each schedule is added
+        // to the change lists of the steps where its day schedule changes value.  Any other update (a new day,
+        // the hour 25 wrap of daylight saving time, a repeated time step) sets every value again.
+
+        using DataEnvironment::DayOfYear_Schedule;
+
+        if (!ScheduleTimelinesCompiled) CompileScheduleTimelines();
+
+        int const DayStep((WhichHour - 1) * NumOfTimeStepInHour + WhichTimeStep - 1); // linear index into TSValue
+        bool const SameDay(!ScheduleTimelineStale && DayOfYear_Schedule == TimelineDayOfYear && DayOfWeek == TimelineDayOfWeek &&
+                           HolidayIndex == TimelineHolidayIndex && DSTIndicator == TimelineDSTIndicator);
+
+        if (SameDay && DayStep == TimelineDayStep + 1) {
+            for (int const ScheduleIndex : SchedulesChangingAtStep[DayStep]) {
+                Schedule(ScheduleIndex).CurrentValue = DaySchedule(ScheduleDayPointer[ScheduleIndex]).TSValue[DayStep];
+                for (int const Duplicate : Schedule(ScheduleIndex).Duplicates) {
+                    Schedule(Duplicate).CurrentValue = Schedule(ScheduleIndex).CurrentValue;
+                }
+            }
+        } else {
+            if (!SameDay) {
+                for (auto &changing : SchedulesChangingAtStep) {
+                    changing.clear();
+                }
+                for (int ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex) {
+                    if (Schedule(ScheduleIndex).SameAs > 0) continue;
+                    int const WeekSchedulePointer(Schedule(ScheduleIndex).WeekSchedulePointer(DayOfYear_Schedule));
+                    int DaySchedulePointer;
+                    if (DayOfWeek <= 7 && HolidayIndex > 0) {
+                        DaySchedulePointer = WeekSchedule(WeekSchedulePointer).DaySchedulePointer(7 + HolidayIndex);
+                    } else {
+                        DaySchedulePointer = WeekSchedule(WeekSchedulePointer).DaySchedulePointer(DayOfWeek);
+                    }
+                    ScheduleDayPointer[ScheduleIndex] = DaySchedulePointer;
+                    for (int const ChangeStep : DaySchedule(DaySchedulePointer).ChangeSteps) {
+                        SchedulesChangingAtStep[ChangeStep].push_back(ScheduleIndex);
+                    }
+                }
+                TimelineDayOfYear = DayOfYear_Schedule;
+                TimelineDayOfWeek = DayOfWeek;
+                TimelineHolidayIndex = HolidayIndex;
+                TimelineDSTIndicator = DSTIndicator;
+                ScheduleTimelineStale = false;
+            }
+            for (int ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex) {
+                if (Schedule(ScheduleIndex).SameAs > 0) continue;
+                Schedule(ScheduleIndex).CurrentValue = DaySchedule(ScheduleDayPointer[ScheduleIndex]).TSValue[DayStep];
+                for (int const Duplicate : Schedule(ScheduleIndex).Duplicates) {
+                    Schedule(Duplicate).CurrentValue = Schedule(ScheduleIndex).CurrentValue;
+                }
+            }
+        }
+        TimelineDayStep = DayStep;
+    }
+
     Real64 LookUpScheduleValue(int const ScheduleIndex,
                                int const ThisHour,    // Negative => unspecified
                                int const ThisTimeStep // Negative => unspecified
@@ -3024,10 +3227,14 @@ namespace ScheduleManager {
                     Schedule(GetScheduleIndex).Used = true;
                     for (WeekCtr = 1; WeekCtr <= 366; ++WeekCtr) {
                         if (Schedule(GetScheduleIndex).WeekSchedulePointer(WeekCtr) > 0) {
-                            WeekSchedule(Schedule(GetScheduleIndex).WeekSchedulePointer(WeekCtr)).Used = true;
+                            auto &thisWeek(WeekSchedule(Schedule(GetScheduleIndex).WeekSchedulePointer(WeekCtr)));
+                            thisWeek.Used = true;
                             for (DayCtr = 1; DayCtr <= MaxDayTypes; ++DayCtr) {
-                                DaySchedule(WeekSchedule(Schedule(GetScheduleIndex).WeekSchedulePointer(WeekCtr)).DaySchedulePointer(DayCtr)).Used =
-                                    true;
+                                if (thisWeek.InputDaySchedulePointer.allocated()) { // mark the day schedules named in the input
+                                    DaySchedule(thisWeek.InputDaySchedulePointer(DayCtr)).Used = true;
+                                } else {
+                                    DaySchedule(thisWeek.DaySchedulePointer(DayCtr)).Used = true;
+                                }
                             }
                         }
                     }
@@ -3120,6 +3327,7 @@ namespace ScheduleManager {
             GetDayScheduleIndex = UtilityRoutines::FindItemInList(ScheduleName, DaySchedule({1, NumDaySchedules}));
             if (GetDayScheduleIndex > 0) {
                 DaySchedule(GetDayScheduleIndex).Used = true;
+                if (DaySchedule(GetDayScheduleIndex).SameAs > 0) GetDayScheduleIndex = DaySchedule(GetDayScheduleIndex).SameAs;
             }
         } else {
             GetDayScheduleIndex = 0;
@@ -3302,6 +3510,8 @@ namespace ScheduleManager {
                 DaySchedule(ScheduleIndex).TSValue(TS, Hr) = Value;
             }
         }
+        DaySchedule(ScheduleIndex).ChangeSteps.clear();
+        ScheduleTimelineStale = true;
     }
 
     void ProcessIntervalFields(Array1S_string const Untils,
@@ -48,6 +48,9 @@
 #ifndef ScheduleManager_hh_INCLUDED
 #define ScheduleManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
 #include <ObjexxFCL/Array1D.hh>
@@ -136,9 +139,12 @@ namespace ScheduleManager {
         Array2D<Real64> TSValue;                    // Value array by simulation timestep
         Real64 TSValMax;                            // maximum of all TSValue's
         Real64 TSValMin;                            // minimum of all TSValue's
+        std::vector<int> ChangeSteps;               // Steps of the day (0 based, as TSValue is stored) where the value differs from the step before
+        int SameAs;                                 // Day schedule holding the values of this one, 0 if it holds its own
 
         // Default Constructor
-        DayScheduleData() : ScheduleTypePtr(0), IntervalInterpolated(ScheduleInterpolation::No), Used(false), TSValMax(0.0), TSValMin(0.0)
+        DayScheduleData()
+            : ScheduleTypePtr(0), IntervalInterpolated(ScheduleInterpolation::No), Used(false), TSValMax(0.0), TSValMin(0.0), SameAs(0)
         {
         }
     };
@@ -146,9 +152,10 @@ namespace ScheduleManager {
     struct WeekScheduleData
     {
         // Members
-        std::string Name;               // Week Schedule Name
-        bool Used;                      // Indicator for this schedule being "used".
-        Array1D_int DaySchedulePointer; // Index of Day Schedule
+        std::string Name;                    // Week Schedule Name
+        bool Used;                           // Indicator for this schedule being "used".
+        Array1D_int DaySchedulePointer;      // Index of Day Schedule
+        Array1D_int InputDaySchedulePointer; // Day schedules as input, allocated when DaySchedulePointer refers to shared copies
 
         // Default Constructor
         WeekScheduleData() : Used(false), DaySchedulePointer(MaxDayTypes, 0)
@@ -170,11 +177,13 @@ namespace ScheduleManager {
         Real64 CurrentValue;             // For Reporting
         bool EMSActuatedOn;              // indicates if EMS computed
         Real64 EMSValue;
+        int SameAs;                      // Schedule with the same value on every day, 0 if none comes before this one
+        std::vector<int> Duplicates;     // Schedules whose value is copied from this one
 
         // Default Constructor
         ScheduleData()
             : ScheduleTypePtr(0), WeekSchedulePointer(366, 0), SchType(0), Used(false), MaxMinSet(false), MaxValue(0.0), MinValue(0.0),
-              CurrentValue(0.0), EMSActuatedOn(false), EMSValue(0.0)
+              CurrentValue(0.0), EMSActuatedOn(false), EMSValue(0.0), SameAs(0)
         {
         }
     };
@@ -193,12 +202,20 @@ namespace ScheduleManager {
 
     void ProcessScheduleInput();
 
+    void DeduplicateSchedules();
+
     void ReportScheduleDetails(int const LevelOfDetail); // =1: hourly; =2: timestep; = 3: make IDF excerpt
 
     Real64 GetCurrentScheduleValue(int const ScheduleIndex);
 
     void UpdateScheduleValues();
 
+    void CompileScheduleTimelines();
+
+    void UpdateChangedScheduleValues(int const WhichHour,    // Hour of the day schedule, 1 to 24
+                                     int const WhichTimeStep // Time step of the hour
+    );
+
     Real64 LookUpScheduleValue(int const ScheduleIndex,
                                int const ThisHour = -1,    // Negative => unspecified
                                int const ThisTimeStep = -1 // Negative => unspecified
@@ -4995,6 +4995,41 @@ namespace SetPointManager {
         }
     }
 
+    Real64 DataLoopNode::NodeData::*GetSetPointNodeField(int const CtrlTypeMode)
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns the node field a setpoint manager with the given control variable type writes, or nullptr
+        // for an invalid type, so the control type is not examined again for every node on every iteration.
+
+        if (CtrlTypeMode == iCtrlVarType_Temp) {
+            return &NodeData::TempSetPoint;
+        } else if (CtrlTypeMode == iCtrlVarType_MaxTemp) {
+            return &NodeData::TempSetPointHi;
+        } else if (CtrlTypeMode == iCtrlVarType_MinTemp) {
+            return &NodeData::TempSetPointLo;
+        } else if (CtrlTypeMode == iCtrlVarType_HumRat) {
+            return &NodeData::HumRatSetPoint;
+        } else if (CtrlTypeMode == iCtrlVarType_MaxHumRat) {
+            return &NodeData::HumRatMax;
+        } else if (CtrlTypeMode == iCtrlVarType_MinHumRat) {
+            return &NodeData::HumRatMin;
+        } else if (CtrlTypeMode == iCtrlVarType_MassFlow) {
+            return &NodeData::MassFlowRateSetPoint;
+        } else if (CtrlTypeMode == iCtrlVarType_MaxMassFlow) {
+            return &NodeData::MassFlowRateMax;
+        } else if (CtrlTypeMode == iCtrlVarType_MinMassFlow) {
+            return &NodeData::MassFlowRateMin;
+        }
+        return nullptr;
+    }
+
     void SimSetPointManagers()
     {
 
@@ -7921,34 +7956,17 @@ namespace SetPointManager {
 
         for (SetPtMgrNum = 1; SetPtMgrNum <= NumSchSetPtMgrs; ++SetPtMgrNum) {
 
-            for (CtrlNodeIndex = 1; CtrlNodeIndex <= SchSetPtMgr(SetPtMgrNum).NumCtrlNodes; ++CtrlNodeIndex) { // Loop over the list of nodes wanting
-                // setpoints from this setpoint manager
-                NodeNum = SchSetPtMgr(SetPtMgrNum).CtrlNodes(CtrlNodeIndex); // Get the node number
-
-                {
-                    auto const SELECT_CASE_var(SchSetPtMgr(SetPtMgrNum).CtrlTypeMode);
-                    // set the setpoint depending on the type of variable being controlled
-                    if (SELECT_CASE_var == iCtrlVarType_Temp) {
-                        Node(NodeNum).TempSetPoint = SchSetPtMgr(SetPtMgrNum).SetPt;
-                    } else if (SELECT_CASE_var == iCtrlVarType_MaxTemp) {
-                        Node(NodeNum).TempSetPointHi = SchSetPtMgr(SetPtMgrNum).SetPt;
-                    } else if (SELECT_CASE_var == iCtrlVarType_MinTemp) {
-                        Node(NodeNum).TempSetPointLo = SchSetPtMgr(SetPtMgrNum).SetPt;
-                    } else if (SELECT_CASE_var == iCtrlVarType_HumRat) {
-                        Node(NodeNum).HumRatSetPoint = SchSetPtMgr(SetPtMgrNum).SetPt;
-                    } else if (SELECT_CASE_var == iCtrlVarType_MaxHumRat) {
-                        Node(NodeNum).HumRatMax = SchSetPtMgr(SetPtMgrNum).SetPt;
-                    } else if (SELECT_CASE_var == iCtrlVarType_MinHumRat) {
-                        Node(NodeNum).HumRatMin = SchSetPtMgr(SetPtMgrNum).SetPt;
-                    } else if (SELECT_CASE_var == iCtrlVarType_MassFlow) {
-                        Node(NodeNum).MassFlowRateSetPoint = SchSetPtMgr(SetPtMgrNum).SetPt;
-                    } else if (SELECT_CASE_var == iCtrlVarType_MaxMassFlow) {
-                        Node(NodeNum).MassFlowRateMax = SchSetPtMgr(SetPtMgrNum).SetPt;
-                    } else if (SELECT_CASE_var == iCtrlVarType_MinMassFlow) {
-                        Node(NodeNum).MassFlowRateMin = SchSetPtMgr(SetPtMgrNum).SetPt;
-                    }
-                }
+            auto &schSPM(SchSetPtMgr(SetPtMgrNum));
+            // set the setpoint field for the type of variable being controlled, resolved once per manager
+            if (schSPM.CtrlNodeField == nullptr) schSPM.CtrlNodeField = GetSetPointNodeField(schSPM.CtrlTypeMode);
+            if (schSPM.CtrlNodeField == nullptr) continue;
+            Real64 NodeData::*const CtrlNodeField = schSPM.CtrlNodeField;
+            Real64 const SetPt = schSPM.SetPt;
 
+            for (CtrlNodeIndex = 1; CtrlNodeIndex <= schSPM.NumCtrlNodes; ++CtrlNodeIndex) { // Loop over the list of nodes wanting
+                // setpoints from this setpoint manager
+                NodeNum = schSPM.CtrlNodes(CtrlNodeIndex); // Get the node number
+                Node(NodeNum).*CtrlNodeField = SetPt;
             } // nodes in list
 
         } // setpoint manger:scheduled
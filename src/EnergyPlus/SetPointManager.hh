@@ -207,9 +207,10 @@ namespace SetPointManager {
         std::string CtrlNodeListName;
         Array1D_int CtrlNodes;
         Real64 SetPt;
+        Real64 DataLoopNode::NodeData::*CtrlNodeField; // Node field written for CtrlTypeMode, resolved once
 
         // Default Constructor
-        DefineScheduledSetPointManager() : CtrlTypeMode(0), SchedPtr(0), NumCtrlNodes(0), SetPt(0.0)
+        DefineScheduledSetPointManager() : CtrlTypeMode(0), SchedPtr(0), NumCtrlNodes(0), SetPt(0.0), CtrlNodeField(nullptr)
         {
         }
 
@@ -1043,6 +1044,8 @@ namespace SetPointManager {
 
     void SimSetPointManagers();
 
+    Real64 DataLoopNode::NodeData::*GetSetPointNodeField(int const CtrlTypeMode);
+
     void UpdateSetPointManagers();
 
     void UpdateMixedAirSetPoints();
@@ -75,6 +75,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataZoneEquipment.hh>
 #include <DesiccantDehumidifiers.hh>
 #include <EMSManager.hh>
@@ -281,6 +282,7 @@ namespace SimAirServingZones {
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS: none
 
         // FLOW:
+        EP_TIMER_SCOPE("ManageAirLoops");
 
         if (GetAirLoopInputFlag) { // First time subroutine has been entered
             GetAirPathData();      // Get air loop descriptions from input file
@@ -2783,6 +2785,7 @@ namespace SimAirServingZones {
         //     is passed in the same direction.
         // (2) The controllers and their actions are simulated.
         // (3) Steps 2 and 3 are repeated until the control criteria are satisfied.
+        // (4) Optionally, controllers that fail the final check are re-solved in sequence.
 
         // REFERENCES: None
 
@@ -2804,6 +2807,7 @@ namespace SimAirServingZones {
         // SUBROUTINE PARAMETER DEFINITIONS:
         // Maximum iterations of an air system/controllers simulation sequence
         int const MaxIter(50);
+        int const MaxControllerSweeps(3); // extra passes over the unconverged controllers when AirLoopControllerSweeps is set
         static ObjexxFCL::gio::Fmt fmtLD("*");
 
         // INTERFACE BLOCK DEFINITIONS: None
@@ -2885,8 +2889,8 @@ namespace SimAirServingZones {
         SimAirLoopComponents(AirLoopNum, FirstHVACIteration);
         IsUpToDateFlag = true;
 
-        // Loop over the air sys controllers until convergence or MaxIter iterations
-        for (int AirLoopControlNum = 1; AirLoopControlNum <= PrimaryAirSystem(AirLoopNum).NumControllers; ++AirLoopControlNum) {
+        // Iterate one controller in sequence until convergence or MaxIter iterations
+        auto const iterateController = [&](int const AirLoopControlNum) {
 
             Iter = 0;
             ControllerConvergedFlag = false;
@@ -2895,7 +2899,7 @@ namespace SimAirServingZones {
                 // nesting this next if to try and speed this up. If economizer is not active, it doesn't matter if CanBeLockedOutByEcono = true
                 if (PrimaryAirSystem(AirLoopNum).CanBeLockedOutByEcono(AirLoopControlNum)) {
                     ControllerConvergedFlag = true;
-                    continue;
+                    return;
                 }
             }
 
@@ -2969,7 +2973,11 @@ namespace SimAirServingZones {
             // Update tracker for aggregated counter of air loop inner iterations across controllers
             // on this air loop
             IterTot += Iter;
+        };
 
+        // Loop over the air sys controllers until convergence or MaxIter iterations
+        for (int AirLoopControlNum = 1; AirLoopControlNum <= PrimaryAirSystem(AirLoopNum).NumControllers; ++AirLoopControlNum) {
+            iterateController(AirLoopControlNum);
         } // End of controller loop
 
         // Once the controllers are converged then need to simulate the components once
@@ -2998,6 +3006,51 @@ namespace SimAirServingZones {
 
             AirLoopConvergedFlag = AirLoopConvergedFlag && ControllerConvergedFlag;
         }
+
+        // Controllers on the same air loop are coupled: a controller solved early in the sequence may no
+        // longer be converged once the controllers after it have moved their actuators. Optionally sweep
+        // the controller sequence again, re-solving only the controllers that failed the final check with
+        // the others held at their current solution (block Gauss-Seidel), so that the air loop converges
+        // within this call and the next HVAC iteration can use the speculative warm restart.
+        for (int Sweep = 1; Sweep <= MaxControllerSweeps; ++Sweep) {
+            if (AirLoopConvergedFlag || !DataSystemVariables::AirLoopControllerSweeps) break;
+            if (IterMax > MaxIter) break; // a controller hit its iteration limit, it will not converge this time
+
+            AirLoopConvergedFlag = true;
+            for (int AirLoopControlNum = 1; AirLoopControlNum <= PrimaryAirSystem(AirLoopNum).NumControllers; ++AirLoopControlNum) {
+                if (PrimaryAirSystem(AirLoopNum).ControlConverged(AirLoopControlNum)) continue;
+                ManageControllers(PrimaryAirSystem(AirLoopNum).ControllerName(AirLoopControlNum),
+                                  PrimaryAirSystem(AirLoopNum).ControllerIndex(AirLoopControlNum),
+                                  FirstHVACIteration,
+                                  AirLoopNum,
+                                  iControllerOpColdStart,
+                                  ControllerConvergedFlag,
+                                  IsUpToDateFlag,
+                                  BypassOAController);
+                IsUpToDateFlag = false;
+                iterateController(AirLoopControlNum);
+            }
+
+            if (!IsUpToDateFlag || !AirLoopConvergedFlag) {
+                ++NumCalls;
+                SimAirLoopComponents(AirLoopNum, FirstHVACIteration);
+                IsUpToDateFlag = true;
+            }
+
+            for (int AirLoopControlNum = 1; AirLoopControlNum <= PrimaryAirSystem(AirLoopNum).NumControllers; ++AirLoopControlNum) {
+                ControllerConvergedFlag = false;
+                ManageControllers(PrimaryAirSystem(AirLoopNum).ControllerName(AirLoopControlNum),
+                                  PrimaryAirSystem(AirLoopNum).ControllerIndex(AirLoopControlNum),
+                                  FirstHVACIteration,
+                                  AirLoopNum,
+                                  iControllerOpEnd,
+                                  ControllerConvergedFlag,
+                                  IsUpToDateFlag,
+                                  BypassOAController);
+                PrimaryAirSystem(AirLoopNum).ControlConverged(AirLoopControlNum) = ControllerConvergedFlag;
+                AirLoopConvergedFlag = AirLoopConvergedFlag && ControllerConvergedFlag;
+            }
+        }
     }
 
     void SolveWaterCoilController(bool const FirstHVACIteration,
@@ -3331,6 +3384,9 @@ namespace SimAirServingZones {
         // Sets current branch number to CurBranchNum defined in MODULE DataSizing
         // Sets duct type of current branch to CurDuctType defined in MODULE DataSizing
         // Upon exiting, resets both counters to 0.
+        // With AirLoopComponentBypass, passive components (ducts and constant or variable volume fans)
+        // are not simulated again when their inlet and outlet nodes still hold the state left by their
+        // last simulation in the same HVAC step.
 
         // REFERENCES: None
 
@@ -3351,6 +3407,7 @@ namespace SimAirServingZones {
         // std::string CompType; // Component type
         // std::string CompName; // Component name
         int CompType_Num; // Numeric equivalent for CompType
+        static std::vector<Real64> CurrentState; // HVAC step stamp and node state of the current component
 
         for (BranchNum = 1; BranchNum <= PrimaryAirSystem(AirLoopNum).NumBranches; ++BranchNum) { // loop over all branches in air system
 
@@ -3365,6 +3422,15 @@ namespace SimAirServingZones {
                 // CompName = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).Name;
                 CompType_Num = PrimaryAirSystem(AirLoopNum).Branch(BranchNum).Comp(CompNum).CompType_Num;
 
+                // Skip passive components left exactly as their last simulation in this HVAC step left them
+                auto &Comp(PrimaryAirSystem(AirLoopNum).Branch(BranchNum).Comp(CompNum));
+                bool const BypassAllowed = DataSystemVariables::AirLoopComponentBypass && !AnyEnergyManagementSystemInModel &&
+                                           AirLoopComponentBypassAllowed(CompType_Num) && Comp.NodeNumIn > 0 && Comp.NodeNumOut > 0;
+                if (BypassAllowed) {
+                    GetAirLoopComponentState(Comp.NodeNumIn, Comp.NodeNumOut, FirstHVACIteration, CurrentState);
+                    if (CurrentState == Comp.SimulatedState) continue;
+                }
+
                 // Simulate each component on PrimaryAirSystem(AirLoopNum)%Branch(BranchNum)%Name
                 SimAirLoopComponent(PrimaryAirSystem(AirLoopNum).Branch(BranchNum).Comp(CompNum).Name,
                                     CompType_Num,
@@ -3372,6 +3438,10 @@ namespace SimAirServingZones {
                                     AirLoopNum,
                                     PrimaryAirSystem(AirLoopNum).Branch(BranchNum).Comp(CompNum).CompIndex,
                                     PrimaryAirSystem(AirLoopNum).Branch(BranchNum).Comp(CompNum).compPointer);
+
+                if (BypassAllowed) {
+                    GetAirLoopComponentState(Comp.NodeNumIn, Comp.NodeNumOut, FirstHVACIteration, Comp.SimulatedState);
+                }
             } // End of component loop
 
             // Enforce continuity through the splitter
@@ -3383,6 +3453,68 @@ namespace SimAirServingZones {
         CurDuctType = 0;
     }
 
+    bool AirLoopComponentBypassAllowed(int const CompType_Num)
+    {
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns true for the air loop components whose outlet state depends only on their inlet node
+        // state within an HVAC step, so that a repeated simulation with unchanged nodes can be skipped.
+
+        return (CompType_Num == Duct || CompType_Num == Fan_Simple_CV || CompType_Num == Fan_Simple_VAV);
+    }
+
+    void GetAirLoopComponentState(int const InletNodeNum,        // component inlet node
+                                  int const OutletNodeNum,       // component outlet node
+                                  bool const FirstHVACIteration, // TRUE if first full HVAC iteration in an HVAC timestep
+                                  std::vector<Real64> &State     // HVAC step stamp and node state
+    )
+    {
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Collects the HVAC step stamp, the fan availability overrides and the inlet and outlet node
+        // state of an air loop component into State.
+
+        // METHODOLOGY EMPLOYED:
+        // States are compared for exact equality, so a component is only skipped when neither its inlet
+        // nor its outlet node has been written since its last simulation in the same HVAC step.
+
+        State.clear();
+        State.push_back(CurEnvirNum);
+        State.push_back(DayOfSim);
+        State.push_back(HourOfDay);
+        State.push_back(TimeStep);
+        State.push_back(SysTimeElapsed);
+        State.push_back(TimeStepSys);
+        State.push_back(FirstHVACIteration ? 1.0 : 0.0);
+        State.push_back(TurnFansOn ? 1.0 : 0.0);
+        State.push_back(TurnFansOff ? 1.0 : 0.0);
+        State.push_back(NightVentOn ? 1.0 : 0.0);
+        for (int const NodeNum : {InletNodeNum, OutletNodeNum}) {
+            auto const &ThisNode(Node(NodeNum));
+            State.push_back(ThisNode.Temp);
+            State.push_back(ThisNode.HumRat);
+            State.push_back(ThisNode.Enthalpy);
+            State.push_back(ThisNode.Press);
+            State.push_back(ThisNode.Quality);
+            State.push_back(ThisNode.MassFlowRate);
+            State.push_back(ThisNode.MassFlowRateMaxAvail);
+            State.push_back(ThisNode.MassFlowRateMinAvail);
+            State.push_back(ThisNode.TempSetPoint);
+            State.push_back(ThisNode.CO2);
+            State.push_back(ThisNode.GenContam);
+        }
+    }
+
     void SimAirLoopComponent(std::string const &CompName,            // the component Name
                              int const CompType_Num,                 // numeric equivalent for component type
                              bool const FirstHVACIteration,          // TRUE if first full HVAC iteration in an HVAC timestep
@@ -50,6 +50,7 @@
 
 // C++ Headers
 #include <string>
+#include <vector>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
@@ -165,6 +166,14 @@ namespace SimAirServingZones {
                               bool const FirstHVACIteration // TRUE if first full HVAC iteration in an HVAC timestep
     );
 
+    bool AirLoopComponentBypassAllowed(int const CompType_Num);
+
+    void GetAirLoopComponentState(int const InletNodeNum,        // component inlet node
+                                  int const OutletNodeNum,       // component outlet node
+                                  bool const FirstHVACIteration, // TRUE if first full HVAC iteration in an HVAC timestep
+                                  std::vector<Real64> &State     // HVAC step stamp and node state
+    );
+
     void SimAirLoopComponent(std::string const &CompName,   // the component Name
                              int const CompType_Num,        // numeric equivalent for component type
                              bool const FirstHVACIteration, // TRUE if first full HVAC iteration in an HVAC timestep
@@ -129,6 +129,7 @@ extern "C" {
 #include <ScheduleManager.hh>
 #include <SetPointManager.hh>
 #include <SimulationManager.hh>
+#include <SimulationTelemetry.hh>
 #include <SizingManager.hh>
 #include <SolarShading.hh>
 #include <SurfaceGeometry.hh>
@@ -324,6 +325,7 @@ namespace SimulationManager {
         }
 
         // FLOW:
+        EP_TIMER_SCOPE("ManageSimulation");
         PostIPProcessing();
 
         InitializePsychRoutines();
@@ -465,6 +467,7 @@ namespace SimulationManager {
 
         ShowMessage("Beginning Simulation");
         DisplayString("Beginning Primary Simulation");
+        SimulationTelemetry::BeginSimulation();
 
         ResetEnvironmentCounter();
 
@@ -499,6 +502,8 @@ namespace SimulationManager {
             EndEnvrnFlag = false;
             EndMonthFlag = false;
             WarmupFlag = true;
+            // A run period continuing from a --restart-from checkpoint has no warmup days
+            if (KindOfSim == ksRunPeriodWeather && StartFromRestartState()) WarmupFlag = false;
             DayOfSim = 0;
             DayOfSimChr = "0";
             NumOfWarmupDays = 0;
@@ -513,7 +518,8 @@ namespace SimulationManager {
 
             while ((DayOfSim < NumOfDayInEnvrn) || (WarmupFlag)) { // Begin day loop ...
 
-                if (sqlite) sqlite->sqliteBegin(); // setup for one transaction per day
+                // setup for one transaction per day, or per month of a weather run period with LongRunMode
+                if (sqlite && !sqlite->sqliteWithinTransaction()) sqlite->sqliteBegin();
 
                 ++DayOfSim;
                 ObjexxFCL::gio::write(DayOfSimChr, fmtLD) << DayOfSim;
@@ -598,6 +604,8 @@ namespace SimulationManager {
 
                         ManageHeatBalance();
 
+                        SimulationTelemetry::ReportZoneTimeStep();
+
                         if (oneTimeUnderwaterBoundaryCheck) {
                             AnyUnderwaterBoundaries = WeatherManager::CheckIfAnyUnderwaterBoundaries();
                             oneTimeUnderwaterBoundaryCheck = false;
@@ -615,15 +623,19 @@ namespace SimulationManager {
 
                 } // ... End hour loop.
 
-                if (sqlite) sqlite->sqliteCommit(); // one transaction per day
+                if (sqlite && EndOfDayCommitsTransaction()) sqlite->sqliteCommit(); // one transaction per day
 
             } // ... End day loop.
 
+            if (sqlite && sqlite->sqliteWithinTransaction()) sqlite->sqliteCommit();
+
             // Need one last call to send latest states to middleware
             ExternalInterfaceExchangeVariables();
 
         } // ... End environment loop.
 
+        SimulationTelemetry::ReportEndOfSimulation();
+
         WarmupFlag = false;
         if (!SimsDone && DoDesDaySim) {
             if ((TotDesDays + TotRunDesPersDays) == 0) { // if sum is 0, then there was no sizing done.
@@ -683,6 +695,23 @@ namespace SimulationManager {
         }
     }
 
+    bool EndOfDayCommitsTransaction()
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns true when the SQLite transaction of the day just simulated should be committed.  Every day is its own
+        // transaction except the days of a weather run period with LongRunMode, which share one transaction per month.
+
+        return (!LongRunMode || (KindOfSim != ksRunPeriodWeather) || WarmupFlag || EndEnvrnFlag ||
+                (DataEnvironment::MonthTomorrow != DataEnvironment::Month));
+    }
+
     void GetProjectData()
     {
 
@@ -1533,13 +1562,24 @@ namespace SimulationManager {
         }
     }
 
+    std::string InitializationOutputFileName()
+    {
+        // the eio unit is attached to the null device when the initialization output is not wanted
+        if (!DataSystemVariables::SuppressEioOutput) return DataStringGlobals::outputEioFileName;
+#ifdef _WIN32
+        return "NUL";
+#else
+        return "/dev/null";
+#endif
+    }
+
     void OpenOutputFiles()
     {
 
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Rick Strand
         //       DATE WRITTEN   June 1997
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, optionally discard the eio output
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -1587,17 +1627,18 @@ namespace SimulationManager {
         eso_stream = ObjexxFCL::gio::out_stream(OutputFileStandard);
         ObjexxFCL::gio::write(OutputFileStandard, fmtA) << "Program Version," + VerString;
 
-        // Open the Initialization Output File
+        // Open the Initialization Output File, or the null device when it is not wanted
+        std::string const eioFileName(InitializationOutputFileName());
         OutputFileInits = GetNewUnitNumber();
         {
             IOFlags flags;
             flags.ACTION("write");
             flags.STATUS("UNKNOWN");
-            ObjexxFCL::gio::open(OutputFileInits, DataStringGlobals::outputEioFileName, flags);
+            ObjexxFCL::gio::open(OutputFileInits, eioFileName, flags);
             write_stat = flags.ios();
         }
         if (write_stat != 0) {
-            ShowFatalError("OpenOutputFiles: Could not open file " + DataStringGlobals::outputEioFileName + " for output (write).");
+            ShowFatalError("OpenOutputFiles: Could not open file " + eioFileName + " for output (write).");
         }
         eio_stream = ObjexxFCL::gio::out_stream(OutputFileInits);
         ObjexxFCL::gio::write(OutputFileInits, fmtA) << "Program Version," + VerString;
@@ -1631,6 +1672,15 @@ namespace SimulationManager {
             ShowFatalError("OpenOutputFiles: Could not open file " + DataStringGlobals::outputBndFileName + " for output (write).");
         }
         ObjexxFCL::gio::write(OutputFileBNDetails, fmtA) << "Program Version," + VerString;
+
+        // Open the binary time series output file
+        if (DataSystemVariables::BinaryOutput) OutputProcessor::OpenBinaryOutputFile();
+
+        // Open the time series csv files
+        if (DataSystemVariables::DirectCsvOutput) OutputProcessor::OpenCsvOutputFiles();
+
+        // Hand the time series output files to the background writer
+        if (DataSystemVariables::AsyncOutput) OutputProcessor::StartAsyncOutput();
     }
 
     void CloseOutputFiles()
@@ -1767,6 +1817,8 @@ namespace SimulationManager {
         ObjexxFCL::gio::write(EchoInputFile, fmtLD) << "NumCalcScriptF_Calls=" << NumCalcScriptF_Calls;
 #endif
 
+        OutputProcessor::StopAsyncOutput();
+        OutputProcessor::StopLiveOutput();
         ObjexxFCL::gio::write(OutputFileStandard, EndOfDataFormat);
         ObjexxFCL::gio::write(OutputFileStandard, fmtLD) << "Number of Records Written=" << StdOutputRecordCount;
         if (StdOutputRecordCount > 0) {
@@ -1779,6 +1831,8 @@ namespace SimulationManager {
             }
         }
         eso_stream = nullptr;
+        OutputProcessor::CloseBinaryOutputFile();
+        OutputProcessor::CloseCsvOutputFiles();
 
         if (any_eq(HeatTransferAlgosUsed, UseCondFD)) { // echo out relaxation factor, it may have been changed by the program
             ObjexxFCL::gio::write(OutputFileInits, fmtA)
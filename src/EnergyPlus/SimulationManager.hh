@@ -75,6 +75,8 @@ namespace SimulationManager {
 
     void ManageSimulation();
 
+    bool EndOfDayCommitsTransaction();
+
     void GetProjectData();
 
     void CheckForMisMatchedEnvironmentSpecifications();
@@ -83,6 +85,8 @@ namespace SimulationManager {
 
     void OpenStreamFile(const std::string &fileName, int &unitNumber, std::ostream *&out_stream);
 
+    std::string InitializationOutputFileName();
+
     void OpenOutputFiles();
 
     void OpenOutputJsonFiles();
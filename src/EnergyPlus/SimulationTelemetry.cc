@@ -0,0 +1,353 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// C++ Headers
+#include <algorithm>
+#include <fstream>
+
+// EnergyPlus Headers
+#include <DataBSDFWindow.hh>
+#include <DataDaylighting.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalance.hh>
+#include <DataShadowingCombinations.hh>
+#include <DataStringGlobals.hh>
+#include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
+#include <OutputProcessor.hh>
+#include <SimulationTelemetry.hh>
+#include <SolarShading.hh>
+#include <SurfaceGeometry.hh>
+
+// Third Party Headers
+#include <nlohmann/json.hpp>
+
+namespace EnergyPlus {
+
+namespace SimulationTelemetry {
+
+    // Module containing the structured progress reports sent to a host program
+
+    // MODULE INFORMATION:
+    //       AUTHOR         na
+    //       DATE WRITTEN   October 2026
+    //       MODIFIED       na
+    //       RE-ENGINEERED  na
+
+    // PURPOSE OF THIS MODULE:
+    // Tell a job scheduler how fast a run progresses and where its time goes, so slow models are found early.
+
+    // METHODOLOGY EMPLOYED:
+    // Each zone time step adds to the simulated hours; once ReportingIntervalHours have been simulated since the
+    // last report, the callback receives the current environment and date, the throughput since the last report
+    // and the cumulative wall time spent in the instrumented subsystems.  The timers cost nothing unless a
+    // callback is registered or the PerformanceReport environment variable is set; the latter writes the totals,
+    // the run time and the peak memory use to <prefix>_performance.json for the performance regression tests.
+
+    // MODULE VARIABLE DECLARATIONS:
+    void (*fTelemetryPtr)(EnergyPlusTelemetry const &)(nullptr);
+    Real64 ReportingIntervalHours(24.0);
+    bool Enabled(false);
+    Real64 SubsystemTime[int(Subsystem::Num)] = {0.0};
+
+    namespace {
+        // These are purposefully not in the header file as an extern variable. No one outside of this module should
+        // use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+        std::chrono::steady_clock::time_point SimulationStart;
+        std::chrono::steady_clock::time_point LastReport;
+        Real64 SimulatedHours(0.0);
+        Real64 SimulatedHoursAtLastReport(0.0);
+        Real64 SimulationSeconds(0.0); // wall time of the primary simulation, set at its end
+
+        // Peak resident set size of the process in kB, or 0 where it cannot be queried
+        Real64 PeakResidentMemory()
+        {
+#ifdef _WIN32
+            PROCESS_MEMORY_COUNTERS counters;
+            if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return counters.PeakWorkingSetSize / 1024.0;
+            return 0.0;
+#else
+            struct rusage usage;
+            if (getrusage(RUSAGE_SELF, &usage) != 0) return 0.0;
+#ifdef __APPLE__
+            return usage.ru_maxrss / 1024.0; // reported in bytes
+#else
+            return Real64(usage.ru_maxrss); // reported in kB
+#endif
+#endif
+        }
+
+        template <typename A> std::size_t ArrayBytes(A const &a)
+        {
+            return a.size() * sizeof(typename A::value_type);
+        }
+
+        std::size_t ShadingBytes()
+        {
+            std::size_t bytes = ArrayBytes(DataHeatBalance::SunlitFrac) + ArrayBytes(DataHeatBalance::SunlitFracHR) +
+                                ArrayBytes(DataHeatBalance::SunlitFracWithoutReveal) + ArrayBytes(DataHeatBalance::CosIncAng) +
+                                ArrayBytes(DataHeatBalance::CosIncAngHR) + ArrayBytes(SolarShading::HCA) + ArrayBytes(SolarShading::HCB) +
+                                ArrayBytes(SolarShading::HCC) + ArrayBytes(SolarShading::HCX) + ArrayBytes(SolarShading::HCY) +
+                                ArrayBytes(SolarShading::HCAREA) + ArrayBytes(SolarShading::HCT) + ArrayBytes(SolarShading::WindowRevealStatus) +
+                                ArrayBytes(DataShadowingCombinations::ShadowComb);
+            for (auto const &comb : DataShadowingCombinations::ShadowComb) {
+                bytes += ArrayBytes(comb.GenSurf) + ArrayBytes(comb.BackSurf) + ArrayBytes(comb.SubSurf);
+            }
+            return bytes;
+        }
+
+        template <typename D> std::size_t DaylightFactorBytes(D const &d)
+        {
+            return ArrayBytes(d.DaylIllFacSky) + ArrayBytes(d.DaylSourceFacSky) + ArrayBytes(d.DaylBackFacSky) + ArrayBytes(d.DaylIllFacSun) +
+                   ArrayBytes(d.DaylIllFacSunDisk) + ArrayBytes(d.DaylSourceFacSun) + ArrayBytes(d.DaylSourceFacSunDisk) +
+                   ArrayBytes(d.DaylBackFacSun) + ArrayBytes(d.DaylBackFacSunDisk);
+        }
+
+        std::size_t DaylightingBytes()
+        {
+            std::size_t bytes = 0u;
+            for (auto const &zone : DataDaylighting::ZoneDaylight) {
+                bytes += DaylightFactorBytes(zone);
+            }
+            for (auto const &map : DataDaylighting::IllumMapCalc) {
+                bytes += DaylightFactorBytes(map) + ArrayBytes(map.MapRefPtAbsCoord) + ArrayBytes(map.SolidAngAtMapPt) +
+                         ArrayBytes(map.SolidAngAtMapPtWtd) + ArrayBytes(map.IllumFromWinAtMapPt) + ArrayBytes(map.BackLumFromWinAtMapPt) +
+                         ArrayBytes(map.SourceLumFromWinAtMapPt);
+            }
+            return bytes;
+        }
+
+        std::size_t OutputVariableBytes()
+        {
+            using namespace OutputProcessor;
+            return NumOfRVariable * (sizeof(RealVariableType) + sizeof(RealVariables)) +
+                   NumOfIVariable * (sizeof(IntegerVariableType) + sizeof(IntegerVariables)) + ArrayBytes(EnergyMeters) +
+                   ArrayBytes(MeterValue) + ArrayBytes(ReportList);
+        }
+
+        std::size_t BSDFBytes()
+        {
+            std::size_t bytes = 0u;
+            for (auto const &construct : DataHeatBalance::Construct) {
+                if (!construct.WindowTypeBSDF) continue;
+                auto const &input = construct.BSDFInput;
+                bytes += ArrayBytes(input.BasisMat) + ArrayBytes(input.SolFrtTrans) + ArrayBytes(input.SolBkRefl) +
+                         ArrayBytes(input.VisFrtTrans) + ArrayBytes(input.VisBkRefl);
+                for (auto const &layer : input.Layer) {
+                    bytes += ArrayBytes(layer.FrtAbs) + ArrayBytes(layer.BkAbs);
+                }
+            }
+            for (auto const &window : DataSurfaces::SurfaceWindow) {
+                for (auto const &state : window.ComplexFen.State) {
+                    bytes += ArrayBytes(state.WinDirHemiTrans) + ArrayBytes(state.WinDirSpecTrans) + ArrayBytes(state.WinBmGndTrans) +
+                             ArrayBytes(state.WinBmFtAbs) + ArrayBytes(state.WinBmGndAbs) + ArrayBytes(state.WinToSurfBmTrans);
+                    for (auto const &bkSurf : state.BkSurf) {
+                        bytes += ArrayBytes(bkSurf.WinDHBkRefl) + ArrayBytes(bkSurf.WinDirBkAbs);
+                    }
+                }
+            }
+            return bytes;
+        }
+
+        std::size_t KivaBytes()
+        {
+            std::size_t bytes = 0u;
+            for (auto const &kv : SurfaceGeometry::kivaManager.kivaInstances) {
+                if (kv.instance.ground) bytes += kv.instance.ground->domain.cell.size() * sizeof(Kiva::Cell);
+            }
+            return bytes;
+        }
+    } // namespace
+
+    // Functions
+    void clear_state()
+    {
+        // The callback and its interval are set by the host before RunEnergyPlus clears the state, so they are kept
+        Enabled = (fTelemetryPtr != nullptr);
+        std::fill(SubsystemTime, SubsystemTime + int(Subsystem::Num), 0.0);
+        SimulatedHours = 0.0;
+        SimulatedHoursAtLastReport = 0.0;
+        SimulationSeconds = 0.0;
+    }
+
+    void BeginSimulation()
+    {
+        // Only the primary simulation is reported, so time spent in sizing runs before it is not counted
+        Enabled = (fTelemetryPtr != nullptr) || DataSystemVariables::PerformanceReport;
+        std::fill(SubsystemTime, SubsystemTime + int(Subsystem::Num), 0.0);
+        SimulatedHours = 0.0;
+        SimulatedHoursAtLastReport = 0.0;
+        SimulationSeconds = 0.0;
+        SimulationStart = LastReport = std::chrono::steady_clock::now();
+    }
+
+    void Report()
+    {
+        auto const now = std::chrono::steady_clock::now();
+        Real64 const SinceLastReport = std::chrono::duration<Real64>(now - LastReport).count();
+
+        EnergyPlusTelemetry telemetry;
+        telemetry.environmentName = DataEnvironment::EnvironmentName;
+        telemetry.kindOfSimulation = DataGlobals::KindOfSim;
+        telemetry.warmup = DataGlobals::WarmupFlag;
+        telemetry.dayOfSimulation = DataGlobals::DayOfSim;
+        telemetry.month = DataEnvironment::Month;
+        telemetry.dayOfMonth = DataEnvironment::DayOfMonth;
+        telemetry.hourOfDay = DataGlobals::HourOfDay;
+        telemetry.simulatedHours = SimulatedHours;
+        telemetry.elapsedSeconds = std::chrono::duration<Real64>(now - SimulationStart).count();
+        telemetry.simulatedHoursPerSecond = (SinceLastReport > 0.0) ? (SimulatedHours - SimulatedHoursAtLastReport) / SinceLastReport : 0.0;
+        telemetry.heatBalanceSeconds = SubsystemTime[int(Subsystem::HeatBalance)];
+        telemetry.hvacSeconds = SubsystemTime[int(Subsystem::HVAC)];
+        telemetry.shadingSeconds = SubsystemTime[int(Subsystem::Shading)];
+        telemetry.outputSeconds = SubsystemTime[int(Subsystem::Output)];
+
+        LastReport = now;
+        SimulatedHoursAtLastReport = SimulatedHours;
+        fTelemetryPtr(telemetry);
+    }
+
+    void ReportZoneTimeStep()
+    {
+        if (!Enabled) return;
+        SimulatedHours += DataGlobals::TimeStepZone;
+        if (fTelemetryPtr && SimulatedHours - SimulatedHoursAtLastReport >= ReportingIntervalHours - 1.0e-6) Report();
+    }
+
+    void ReportEndOfSimulation()
+    {
+        if (!Enabled) return;
+        SimulationSeconds = std::chrono::duration<Real64>(std::chrono::steady_clock::now() - SimulationStart).count();
+        if (fTelemetryPtr && SimulatedHours > SimulatedHoursAtLastReport) Report();
+    }
+
+    void ReportPerformance(Real64 const RunSeconds)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Write the performance summary to <prefix>_performance.json at the end of a successful run
+        // when the PerformanceReport environment variable is set
+
+        if (!DataSystemVariables::PerformanceReport) return;
+
+        std::ofstream Summary(DataStringGlobals::outputPerformanceJsonFileName);
+        if (Summary) WritePerformanceReport(Summary, RunSeconds);
+    }
+
+    void WritePerformanceReport(std::ostream &Summary, Real64 const RunSeconds)
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Write the run time, peak memory use, subsystem times and module memory of the run as a JSON object,
+        // in the form read by performance_tests/compare_performance.py
+
+        nlohmann::json subsystems = {{"heat_balance", SubsystemTime[int(Subsystem::HeatBalance)]},
+                                     {"hvac", SubsystemTime[int(Subsystem::HVAC)]},
+                                     {"shading", SubsystemTime[int(Subsystem::Shading)]},
+                                     {"output", SubsystemTime[int(Subsystem::Output)]}};
+        nlohmann::json root = {{"input_file", DataStringGlobals::inputFileName},
+                               {"wall_seconds", RunSeconds},
+                               {"simulation_seconds", SimulationSeconds},
+                               {"simulated_hours", SimulatedHours},
+                               {"simulated_hours_per_second", (SimulationSeconds > 0.0) ? SimulatedHours / SimulationSeconds : 0.0},
+                               {"peak_rss_kb", PeakResidentMemory()},
+                               {"subsystem_seconds", subsystems},
+                               {"module_memory_kb", nlohmann::json::object()}};
+        for (auto const &module : ModuleMemory()) {
+            root["module_memory_kb"][module.first] = module.second;
+        }
+        Summary << root.dump(4) << '\n';
+    }
+
+    std::vector<std::pair<std::string, Real64>> ModuleMemory()
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Estimate the memory held by the data that grows fastest with model size, in kB by module
+
+        // METHODOLOGY EMPLOYED:
+        // Sums the element storage of the large arrays each module keeps for the whole run: the shading and
+        // incidence angle arrays and shadowing combinations, the daylight factors, the output variable and meter
+        // records, the BSDF matrices and the Kiva domain cells.  Strings and other heap data owned by the elements
+        // are not counted, so the totals are lower bounds to compare against the peak resident set size.
+
+        return {{"shading", ShadingBytes() / 1024.0},
+                {"daylighting", DaylightingBytes() / 1024.0},
+                {"output_variables", OutputVariableBytes() / 1024.0},
+                {"bsdf", BSDFBytes() / 1024.0},
+                {"kiva", KivaBytes() / 1024.0}};
+    }
+
+} // namespace SimulationTelemetry
+
+} // namespace EnergyPlus
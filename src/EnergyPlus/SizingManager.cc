@@ -47,6 +47,9 @@
 
 // C++ Headers
 #include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
 #include <string>
 
 // ObjexxFCL Headers
@@ -73,6 +76,7 @@
 #include <DisplayRoutines.hh>
 #include <DualDuct.hh>
 #include <EMSManager.hh>
+#include <FileSystem.hh>
 #include <General.hh>
 #include <HVACCooledBeam.hh>
 #include <HVACFourPipeBeam.hh>
@@ -191,6 +195,7 @@ namespace SizingManager {
         // SUBROUTINE PARAMETER DEFINITIONS:
         static std::string const RoutineName("ManageSizing: ");
         static ObjexxFCL::gio::Fmt fmtLD("*");
+        static ObjexxFCL::gio::Fmt fmtA("(A)");
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
         static bool Available(false); // an environment is available to process
@@ -237,6 +242,11 @@ namespace SizingManager {
         GetSystemSizingInput();   // get the System Sizing input
         GetPlantSizingInput();    // get the Plant Sizing input
 
+        if (DoZoneSizing || DoSystemSizing || DoPlantSizing) {
+            ObjexxFCL::gio::write(OutputFileInits, fmtA) << "! <Sizing Input Fingerprint>, Value";
+            ObjexxFCL::gio::write(OutputFileInits, fmtA) << "Sizing Input Fingerprint, " + SizingInputFingerprint();
+        }
+
         // okay, check sizing inputs vs desires vs requirements
         if (DoZoneSizing || DoSystemSizing) {
             if ((NumSysSizInput > 0 && NumZoneSizingInput == 0) || (!DoZoneSizing && DoSystemSizing && NumSysSizInput > 0)) {
@@ -341,6 +351,11 @@ namespace SizingManager {
                 ResetEnvironmentCounter();
                 CurOverallSimDay = 0;
                 NumSizingPeriodsPerformed = 0;
+                // The sizing periods are simulated one after the other.  Their results are kept per design day
+                // (CalcZoneSizing(CurOverallSimDay, ZoneNum)) and only combined by UpdateZoneSizing(EndZoneSizingCalc),
+                // but each period runs on the module level state of every simulation module (weather, heat balance,
+                // zone equipment, output), so two periods cannot be simulated at the same time in one process.
+                // Repeated periods can start from their converged warmup state instead (WarmupStateReuse).
                 while (Available) { // loop over environments
 
                     GetNextEnvironment(Available, ErrorsFound); // get an environment
@@ -3913,6 +3928,51 @@ namespace SizingManager {
         }
     }
 
+    std::string SizingInputFingerprint()
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns a hash of the input objects that can change the sizing results.  It is written to the eio
+        // file so that tools running parametric series can tell which runs share their sizing, e.g. to hard
+        // size the later runs from the Component Sizing Information of the first one.
+
+        // METHODOLOGY EMPLOYED:
+        // 64 bit FNV-1a over the type and contents of every input object, leaving out only the objects that
+        // request output or set up the run periods.  Schedules, EMS programs and internal gains are kept
+        // since the design days are simulated with them.  The weather file is included when it supplies
+        // sizing periods.
+
+        std::uint64_t Hash(FileSystem::hashBasis);
+        auto const addToHash = [&Hash](std::string const &Text) {
+            unsigned char const Separator(0xff); // no byte of the UTF-8 text, so it separates the strings
+            Hash = FileSystem::hashBytes(&Separator, 1, FileSystem::hashString(Text, Hash));
+        };
+
+        bool UsesWeatherFileDays(false);
+        auto const &epJSON = inputProcessor->epJSON;
+        for (auto ObjectType = epJSON.begin(); ObjectType != epJSON.end(); ++ObjectType) {
+            std::string const &TypeName = ObjectType.key();
+            if (has_prefix(TypeName, "Output") || has_prefix(TypeName, "Meter:") || has_prefix(TypeName, "RunPeriod") ||
+                TypeName == "Version") {
+                continue;
+            }
+            if (has_prefix(TypeName, "SizingPeriod:WeatherFile")) UsesWeatherFileDays = true;
+            addToHash(TypeName);
+            addToHash(ObjectType.value().dump());
+        }
+        if (UsesWeatherFileDays) addToHash(DataStringGlobals::inputWeatherFileName);
+
+        std::ostringstream Fingerprint;
+        Fingerprint << std::hex << std::setw(16) << std::setfill('0') << Hash;
+        return Fingerprint.str();
+    }
+
     void SetupZoneSizing(bool &ErrorsFound)
     {
 
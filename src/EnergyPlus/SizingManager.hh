@@ -131,6 +131,8 @@ namespace SizingManager {
 
     void GetPlantSizingInput();
 
+    std::string SizingInputFingerprint();
+
     void SetupZoneSizing(bool &ErrorsFound);
 
     void ReportZoneSizing(std::string const &ZoneName,   // the name of the zone
@@ -1109,7 +1109,7 @@ namespace SolarCollectors {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Peter Graham Ellis
         //       DATE WRITTEN   January 2004
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, reuse the incident angle modifier while the incident solar is unchanged
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -1190,18 +1190,25 @@ namespace SolarCollectors {
         ParamNum = Collector(CollectorNum).Parameters;
 
         // Calculate incident angle modifier
-        if (QRadSWOutIncident(SurfNum) > 0.0) {
+        if (!SolarInputsChanged(CollectorNum)) {
+            IncidentAngleModifier = Collector(CollectorNum).IncidentAngleModifier;
+        } else if (QRadSWOutIncident(SurfNum) > 0.0) {
             ThetaBeam = std::acos(CosIncidenceAngle(SurfNum));
 
-            // Calculate equivalent incident angles for sky and ground radiation according to Brandemuehl and Beckman (1980)
-            Tilt = Surface(SurfNum).Tilt;
-            ThetaSky = (59.68 - 0.1388 * Tilt + 0.001497 * pow_2(Tilt)) * DegToRadians;
-            ThetaGnd = (90.0 - 0.5788 * Tilt + 0.002693 * pow_2(Tilt)) * DegToRadians;
+            if (!Collector(CollectorNum).DiffuseIAMSet) {
+                // Calculate equivalent incident angles for sky and ground radiation according to Brandemuehl and Beckman (1980)
+                Tilt = Surface(SurfNum).Tilt;
+                ThetaSky = (59.68 - 0.1388 * Tilt + 0.001497 * pow_2(Tilt)) * DegToRadians;
+                ThetaGnd = (90.0 - 0.5788 * Tilt + 0.002693 * pow_2(Tilt)) * DegToRadians;
+                Collector(CollectorNum).IAMSkyDiffuse = IAM(ParamNum, ThetaSky);
+                Collector(CollectorNum).IAMGndDiffuse = IAM(ParamNum, ThetaGnd);
+                Collector(CollectorNum).DiffuseIAMSet = true;
+            }
 
-            IncidentAngleModifier =
-                (QRadSWOutIncidentBeam(SurfNum) * IAM(ParamNum, ThetaBeam) + QRadSWOutIncidentSkyDiffuse(SurfNum) * IAM(ParamNum, ThetaSky) +
-                 QRadSWOutIncidentGndDiffuse(SurfNum) * IAM(ParamNum, ThetaGnd)) /
-                QRadSWOutIncident(SurfNum);
+            IncidentAngleModifier = (QRadSWOutIncidentBeam(SurfNum) * IAM(ParamNum, ThetaBeam) +
+                                     QRadSWOutIncidentSkyDiffuse(SurfNum) * Collector(CollectorNum).IAMSkyDiffuse +
+                                     QRadSWOutIncidentGndDiffuse(SurfNum) * Collector(CollectorNum).IAMGndDiffuse) /
+                                    QRadSWOutIncident(SurfNum);
         } else {
             IncidentAngleModifier = 0.0;
         }
@@ -1421,13 +1428,54 @@ namespace SolarCollectors {
         return IAM;
     }
 
+    bool SolarInputsChanged(int const CollectorNum)
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns true when the solar incident on the collector surface differs from the values its solar
+        // terms were last calculated from, and records the current values.
+
+        // METHODOLOGY EMPLOYED:
+        // The incident angle modifier and the transmittance-absorptance products depend only on the incidence
+        // angle and the incident solar, which the heat balance sets once per zone time step, while the plant
+        // simulates the collector several times per time step.
+
+        // Using/Aliasing
+        using DataHeatBalance::CosIncidenceAngle;
+        using DataHeatBalance::QRadSWOutIncident;
+        using DataHeatBalance::QRadSWOutIncidentBeam;
+        using DataHeatBalance::QRadSWOutIncidentGndDiffuse;
+        using DataHeatBalance::QRadSWOutIncidentSkyDiffuse;
+
+        auto &collector(Collector(CollectorNum));
+        int const SurfNum(collector.Surface);
+        if (collector.SolarTermsSet && collector.SolarCosIncAngle == CosIncidenceAngle(SurfNum) &&
+            collector.SolarTotal == QRadSWOutIncident(SurfNum) && collector.SolarBeam == QRadSWOutIncidentBeam(SurfNum) &&
+            collector.SolarSkyDiffuse == QRadSWOutIncidentSkyDiffuse(SurfNum) && collector.SolarGndDiffuse == QRadSWOutIncidentGndDiffuse(SurfNum)) {
+            return false;
+        }
+        collector.SolarTermsSet = true;
+        collector.SolarCosIncAngle = CosIncidenceAngle(SurfNum);
+        collector.SolarTotal = QRadSWOutIncident(SurfNum);
+        collector.SolarBeam = QRadSWOutIncidentBeam(SurfNum);
+        collector.SolarSkyDiffuse = QRadSWOutIncidentSkyDiffuse(SurfNum);
+        collector.SolarGndDiffuse = QRadSWOutIncidentGndDiffuse(SurfNum);
+        return true;
+    }
+
     void CalcICSSolarCollector(int const ColleNum)
     {
 
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Bereket Nigusse, FSEC/UCF
         //       DATE WRITTEN   February 2012
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, reuse the transmittance-absorptance product while the incident solar is unchanged
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -1523,8 +1571,10 @@ namespace SolarCollectors {
         }
 
         // Calculate transmittance-absorptance product of the system
-        ThetaBeam = std::acos(CosIncidenceAngle(SurfNum));
-        CalcTransAbsorProduct(ColleNum, ThetaBeam);
+        if (SolarInputsChanged(ColleNum)) {
+            ThetaBeam = std::acos(CosIncidenceAngle(SurfNum));
+            CalcTransAbsorProduct(ColleNum, ThetaBeam);
+        }
 
         InletTemp = Collector(ColleNum).InletTemp;
 
@@ -215,6 +215,17 @@ namespace SolarCollectors {
         Real64 Volume;                 // collector net volume (m3)
         bool OSCM_ON;                  // Boundary condition is OSCM
         bool InitICS;                  // used to initialize ICS variables only
+        // Incident solar on the collector surface behind the current incident angle modifier (flat-plate) or
+        // transmittance-absorptance products (ICS); the plant calls the collector several times per time step
+        bool SolarTermsSet;            // True once the solar terms have been calculated
+        Real64 SolarCosIncAngle;       // Cosine of the beam incidence angle
+        Real64 SolarTotal;             // Total incident solar (W/m2)
+        Real64 SolarBeam;              // Incident beam solar (W/m2)
+        Real64 SolarSkyDiffuse;        // Incident sky diffuse solar (W/m2)
+        Real64 SolarGndDiffuse;        // Incident ground diffuse solar (W/m2)
+        bool DiffuseIAMSet;            // True once IAMSkyDiffuse and IAMGndDiffuse have been calculated
+        Real64 IAMSkyDiffuse;          // Flat-plate incident angle modifier for sky diffuse radiation
+        Real64 IAMGndDiffuse;          // Flat-plate incident angle modifier for ground diffuse radiation
 
         // Default Constructor
         CollectorData()
@@ -228,7 +239,8 @@ namespace SolarCollectors {
               CoverAbs(2, 0.0), TimeElapsed(0.0), UbLoss(0.0), UsLoss(0.0), AreaRatio(0.0), RefSkyDiffInnerCover(0.0), RefGrnDiffInnerCover(0.0),
               RefDiffInnerCover(0.0), SavedTempOfWater(0.0), SavedTempOfAbsPlate(0.0), SavedTempOfInnerCover(0.0), SavedTempOfOuterCover(0.0),
               SavedTempCollectorOSCM(0.0), Length(1.0), TiltR2V(0.0), Tilt(0.0), CosTilt(0.0), SinTilt(0.0), SideArea(0.0), Area(0.0), Volume(0.0),
-              OSCM_ON(false), InitICS(false)
+              OSCM_ON(false), InitICS(false), SolarTermsSet(false), SolarCosIncAngle(0.0), SolarTotal(0.0), SolarBeam(0.0), SolarSkyDiffuse(0.0),
+              SolarGndDiffuse(0.0), DiffuseIAMSet(false), IAMSkyDiffuse(0.0), IAMGndDiffuse(0.0)
         {
         }
     };
@@ -254,6 +266,8 @@ namespace SolarCollectors {
                Real64 const IncidentAngle // Angle of incidence (radians)
     );
 
+    bool SolarInputsChanged(int const CollectorNum);
+
     void CalcICSSolarCollector(int const ColleNum);
 
     void ICSCollectorAnalyticalSoluton(int const ColleNum,             // solar collector index
@@ -59,11 +59,13 @@
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
 #include <DataVectorTypes.hh>
+#include <DaylightingManager.hh>
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <PierceSurface.hh>
 #include <ScheduleManager.hh>
 #include <SolarReflectionManager.hh>
+#include <SurfaceOctree.hh>
 #include <Vectors.hh>
 
 namespace EnergyPlus {
@@ -774,33 +776,49 @@ namespace SolarReflectionManager {
                     // To speed up, ideally should store all possible shading surfaces for the HitPtSurfNum
                     //  obstruction surface in the SolReflSurf(HitPtSurfNum)%PossibleObsSurfNums(loop) array as well
                     hit = false;
-                    for (ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum) {
-                        //        DO loop = 1,SolReflRecSurf(RecSurfNum)%NumPossibleObs
-                        //          ObsSurfNum = SolReflRecSurf(RecSurfNum)%PossibleObsSurfNums(loop)
-
-                        // CR 8959 -- The other side of a mirrored surface cannot obstruct the mirrored surface
-                        if (HitPtSurfNum > 0) {
-                            if (Surface(HitPtSurfNum).MirroredSurf) {
-                                if (ObsSurfNum == HitPtSurfNum - 1) continue;
+                    if (TotSurfaces < DaylightingManager::octreeCrossover) { // Linear search through surfaces
+                        for (ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum) {
+                            //        DO loop = 1,SolReflRecSurf(RecSurfNum)%NumPossibleObs
+                            //          ObsSurfNum = SolReflRecSurf(RecSurfNum)%PossibleObsSurfNums(loop)
+
+                            // CR 8959 -- The other side of a mirrored surface cannot obstruct the mirrored surface
+                            if (HitPtSurfNum > 0) {
+                                if (Surface(HitPtSurfNum).MirroredSurf) {
+                                    if (ObsSurfNum == HitPtSurfNum - 1) continue;
+                                }
                             }
-                        }
 
-                        // skip the hit surface
-                        if (ObsSurfNum == HitPtSurfNum) continue;
+                            // skip the hit surface
+                            if (ObsSurfNum == HitPtSurfNum) continue;
 
-                        // skip mirrored surfaces
-                        if (Surface(ObsSurfNum).MirroredSurf) continue;
-                        // IF(Surface(ObsSurfNum)%ShadowingSurf .AND. Surface(ObsSurfNum)%Name(1:3) == 'Mir') THEN
-                        //  CYCLE
-                        // ENDIF
+                            // skip mirrored surfaces
+                            if (Surface(ObsSurfNum).MirroredSurf) continue;
+                            // IF(Surface(ObsSurfNum)%ShadowingSurf .AND. Surface(ObsSurfNum)%Name(1:3) == 'Mir') THEN
+                            //  CYCLE
+                            // ENDIF
 
-                        // skip interior surfaces
-                        if (Surface(ObsSurfNum).ExtBoundCond >= 1) continue;
+                            // skip interior surfaces
+                            if (Surface(ObsSurfNum).ExtBoundCond >= 1) continue;
 
-                        // For now it is assumed that obstructions that are shading surfaces are opaque.
-                        // An improvement here would be to allow these to have transmittance.
-                        PierceSurface(ObsSurfNum, OriginThisRay, SunVec, ObsHitPt, hit);
-                        if (hit) break; // An obstruction was hit
+                            // For now it is assumed that obstructions that are shading surfaces are opaque.
+                            // An improvement here would be to allow these to have transmittance.
+                            PierceSurface(ObsSurfNum, OriginThisRay, SunVec, ObsHitPt, hit);
+                            if (hit) break; // An obstruction was hit
+                        }
+                    } else { // Surface octree search
+                        // Same filters as the linear search, applied by surface address
+                        SurfaceData const *hitSurf_p(HitPtSurfNum > 0 ? &Surface(HitPtSurfNum) : nullptr);
+                        SurfaceData const *unmirroredSurf_p(
+                            (HitPtSurfNum > 1) && Surface(HitPtSurfNum).MirroredSurf ? &Surface(HitPtSurfNum - 1) : nullptr);
+                        auto obstructionHit = [=, &hit](SurfaceData const &surface) -> bool {
+                            if ((&surface == hitSurf_p) || (&surface == unmirroredSurf_p)) return false;
+                            if (surface.MirroredSurf) return false;
+                            if (surface.ExtBoundCond >= 1) return false;
+                            PierceSurface(surface, OriginThisRay, SunVec, ObsHitPt, hit);
+                            return hit;
+                        };
+                        Vector3<Real64> const SunVec_inv(SurfaceOctreeCube::safe_inverse(SunVec));
+                        surfaceOctree.processSomeSurfaceRayIntersectsCube(OriginThisRay, SunVec, SunVec_inv, obstructionHit);
                     }
                     if (hit) continue; // Sun does not reach this ray's hit point
 
@@ -1037,7 +1055,7 @@ namespace SolarReflectionManager {
                                             if (hitObs) break;
                                         }
                                     }
-                                } else { // Reflecting surface is a building shade
+                                } else if (TotSurfaces < DaylightingManager::octreeCrossover) { // Reflecting surface is a building shade
                                     for (int ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum) {
                                         if (!Surface(ObsSurfNum).ShadowSurfPossibleObstruction) continue;
                                         if (ObsSurfNum == ReflSurfNum) continue;
@@ -1052,6 +1070,19 @@ namespace SolarReflectionManager {
                                         PierceSurface(ObsSurfNum, HitPtRefl, SunVec, HitPtObs, hitObs);
                                         if (hitObs) break;
                                     }
+                                } else { // Reflecting surface is a building shade: surface octree search
+                                    SurfaceData const *reflSurf_p(&Surface(ReflSurfNum));
+                                    SurfaceData const *unmirroredSurf_p(
+                                        (ReflSurfNum > 1) && Surface(ReflSurfNum).MirroredSurf ? &Surface(ReflSurfNum - 1) : nullptr);
+                                    auto obstructionHit = [=, &hitObs](SurfaceData const &surface) -> bool {
+                                        if (!surface.ShadowSurfPossibleObstruction) return false;
+                                        if ((&surface == reflSurf_p) || (&surface == unmirroredSurf_p)) return false;
+                                        if (surface.MirroredSurf) return false;
+                                        PierceSurface(surface, HitPtRefl, SunVec, HitPtObs, hitObs);
+                                        return hitObs;
+                                    };
+                                    Vector3<Real64> const SunVec_inv(SurfaceOctreeCube::safe_inverse(SunVec));
+                                    surfaceOctree.processSomeSurfaceRayIntersectsCube(HitPtRefl, SunVec, SunVec_inv, obstructionHit);
                                 }
 
                                 if (hitObs) continue; // Obstruction hit between reflection hit point and sun; go to next receiving pt.
@@ -1244,22 +1275,40 @@ namespace SolarReflectionManager {
                                 URay.y = cos_Phi[IPhi] * sin_Theta[ITheta];
                                 // Does this ray hit an obstruction?
                                 hitObs = false;
-                                for (ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum) {
-                                    if (!Surface(ObsSurfNum).ShadowSurfPossibleObstruction) continue;
-                                    // Horizontal roof surfaces cannot be obstructions for rays from ground
-                                    if (Surface(ObsSurfNum).Tilt < 5.0) continue;
-                                    if (!Surface(ObsSurfNum).ShadowingSurf) {
-                                        if (dot(URay, Surface(ObsSurfNum).OutNormVec) >= 0.0) continue;
-                                        // Special test for vertical surfaces with URay dot OutNormVec < 0; excludes
-                                        // case where ground hit point is in back of ObsSurfNum
-                                        if (Surface(ObsSurfNum).Tilt > 89.0 && Surface(ObsSurfNum).Tilt < 91.0) {
-                                            SurfVert = Surface(ObsSurfNum).Vertex(2);
-                                            SurfVertToGndPt = HitPtRefl - SurfVert;
-                                            if (dot(SurfVertToGndPt, Surface(ObsSurfNum).OutNormVec) < 0.0) continue;
+                                if (TotSurfaces < DaylightingManager::octreeCrossover) { // Linear search through surfaces
+                                    for (ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum) {
+                                        if (!Surface(ObsSurfNum).ShadowSurfPossibleObstruction) continue;
+                                        // Horizontal roof surfaces cannot be obstructions for rays from ground
+                                        if (Surface(ObsSurfNum).Tilt < 5.0) continue;
+                                        if (!Surface(ObsSurfNum).ShadowingSurf) {
+                                            if (dot(URay, Surface(ObsSurfNum).OutNormVec) >= 0.0) continue;
+                                            // Special test for vertical surfaces with URay dot OutNormVec < 0; excludes
+                                            // case where ground hit point is in back of ObsSurfNum
+                                            if (Surface(ObsSurfNum).Tilt > 89.0 && Surface(ObsSurfNum).Tilt < 91.0) {
+                                                SurfVert = Surface(ObsSurfNum).Vertex(2);
+                                                SurfVertToGndPt = HitPtRefl - SurfVert;
+                                                if (dot(SurfVertToGndPt, Surface(ObsSurfNum).OutNormVec) < 0.0) continue;
+                                            }
                                         }
+                                        PierceSurface(ObsSurfNum, HitPtRefl, URay, HitPtObs, hitObs);
+                                        if (hitObs) break;
                                     }
-                                    PierceSurface(ObsSurfNum, HitPtRefl, URay, HitPtObs, hitObs);
-                                    if (hitObs) break;
+                                } else { // Surface octree search
+                                    auto obstructionHit = [&hitObs](SurfaceData const &surface) -> bool {
+                                        if (!surface.ShadowSurfPossibleObstruction) return false;
+                                        // Horizontal roof surfaces cannot be obstructions for rays from ground
+                                        if (surface.Tilt < 5.0) return false;
+                                        if (!surface.ShadowingSurf) {
+                                            if (dot(URay, surface.OutNormVec) >= 0.0) return false;
+                                            if (surface.Tilt > 89.0 && surface.Tilt < 91.0) {
+                                                if (dot(HitPtRefl - surface.Vertex(2), surface.OutNormVec) < 0.0) return false;
+                                            }
+                                        }
+                                        PierceSurface(surface, HitPtRefl, URay, HitPtObs, hitObs);
+                                        return hitObs;
+                                    };
+                                    Vector3<Real64> const URay_inv(SurfaceOctreeCube::safe_inverse(URay));
+                                    surfaceOctree.processSomeSurfaceRayIntersectsCube(HitPtRefl, URay, URay_inv, obstructionHit);
                                 }
                                 if (hitObs) continue; // Obstruction hit
                                 // Sky is hit
@@ -46,9 +46,14 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
 #include <memory>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -81,11 +86,13 @@
 #include <DaylightingDevices.hh>
 #include <DaylightingManager.hh>
 #include <DisplayRoutines.hh>
+#include <FileSystem.hh>
 #include <General.hh>
 #include <InputProcessing/InputProcessor.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
 #include <ScheduleManager.hh>
+#include <SimulationTelemetry.hh>
 #include <SolarReflectionManager.hh>
 #include <SolarShading.hh>
 #include <UtilityRoutines.hh>
@@ -163,6 +170,8 @@ namespace SolarShading {
     Real64 const sqHCMULT(HCMULT *HCMULT);         // Square of HCMult used in Homogeneous coordinates
     Real64 const sqHCMULT_fac(0.5 / sqHCMULT);     // ( 0.5 / sqHCMULT ) factor
     Real64 const kHCMULT(1.0 / (HCMULT * HCMULT)); // half of inverse square of HCMult used in Homogeneous coordinates
+    int const PixelCountingGridSize(100);          // Cells along each side of a receiving surface for the pixel counting shadow engine
+    int const ShadingCacheVersion(1);              // Layout version of the shading cache files
 
     // Parameters for use with the variable OverlapStatus...
     int const NoOverlap(1);
@@ -186,26 +195,26 @@ namespace SolarShading {
     int MAXHCArrayBounds(0);    // Bounds based on Max Number of Vertices in surfaces
     int MAXHCArrayIncrement(0); // Increment based on Max Number of Vertices in surfaces
     // The following variable should be re-engineered to lower in module hierarchy but need more analysis
-    int NVS; // Number of vertices of the shadow/clipped surface
-    int NumVertInShadowOrClippedSurface;
-    int CurrentSurfaceBeingShadowed;
-    int CurrentShadowingSurface;
-    int OverlapStatus; // Results of overlap calculation:
+    EP_SHADOW_THREAD_LOCAL int NVS; // Number of vertices of the shadow/clipped surface
+    EP_SHADOW_THREAD_LOCAL int NumVertInShadowOrClippedSurface;
+    EP_SHADOW_THREAD_LOCAL int CurrentSurfaceBeingShadowed;
+    EP_SHADOW_THREAD_LOCAL int CurrentShadowingSurface;
+    EP_SHADOW_THREAD_LOCAL int OverlapStatus; // Results of overlap calculation:
     // 1=No overlap; 2=NS1 completely within NS2
     // 3=NS2 completely within NS1; 4=Partial overlap
 
-    Array1D<Real64> CTHETA;        // Cosine of angle of incidence of sun's rays on surface NS
-    int FBKSHC;                    // HC location of first back surface
-    int FGSSHC;                    // HC location of first general shadowing surface
-    int FINSHC;                    // HC location of first back surface overlap
-    int FRVLHC;                    // HC location of first reveal surface
-    int FSBSHC;                    // HC location of first subsurface
-    int LOCHCA(0);                 // Location of highest data in the HC arrays
-    int NBKSHC;                    // Number of back surfaces in the HC arrays
-    int NGSSHC;                    // Number of general shadowing surfaces in the HC arrays
-    int NINSHC;                    // Number of back surface overlaps in the HC arrays
-    int NRVLHC;                    // Number of reveal surfaces in HC array
-    int NSBSHC;                    // Number of subsurfaces in the HC arrays
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> CTHETA;        // Cosine of angle of incidence of sun's rays on surface NS
+    EP_SHADOW_THREAD_LOCAL int FBKSHC;                    // HC location of first back surface
+    EP_SHADOW_THREAD_LOCAL int FGSSHC;                    // HC location of first general shadowing surface
+    EP_SHADOW_THREAD_LOCAL int FINSHC;                    // HC location of first back surface overlap
+    EP_SHADOW_THREAD_LOCAL int FRVLHC;                    // HC location of first reveal surface
+    EP_SHADOW_THREAD_LOCAL int FSBSHC;                    // HC location of first subsurface
+    EP_SHADOW_THREAD_LOCAL int LOCHCA(0);                 // Location of highest data in the HC arrays
+    EP_SHADOW_THREAD_LOCAL int NBKSHC;                    // Number of back surfaces in the HC arrays
+    EP_SHADOW_THREAD_LOCAL int NGSSHC;                    // Number of general shadowing surfaces in the HC arrays
+    EP_SHADOW_THREAD_LOCAL int NINSHC;                    // Number of back surface overlaps in the HC arrays
+    EP_SHADOW_THREAD_LOCAL int NRVLHC;                    // Number of reveal surfaces in HC array
+    EP_SHADOW_THREAD_LOCAL int NSBSHC;                    // Number of subsurfaces in the HC arrays
     bool CalcSkyDifShading;        // True when sky diffuse solar shading is
     int ShadowingCalcFrequency(0); // Frequency for Shadowing Calculations
     int ShadowingDaysLeft(0);      // Days left in current shadowing period
@@ -219,47 +228,60 @@ namespace SolarShading {
         bool MustAllocSolarShading(true);
         bool GetInputFlag(true);
         bool firstTime(true);
+
+        // Exterior-solar surfaces packed contiguously for AnisoSkyViewFactors, rebuilt at each new environment
+        // because the world coordinate rotation of the surfaces can differ between environments
+        int AnisoSkyEnvirNum(0);
+        std::vector<int> AnisoSkySurfNum;
+        std::vector<Real64> AnisoSkyNormX;         // Outward normal, x component
+        std::vector<Real64> AnisoSkyNormY;         // Outward normal, y component
+        std::vector<Real64> AnisoSkyNormZ;         // Outward normal, z component
+        std::vector<Real64> AnisoSkyViewFactorSky; // Geometrical sky view factor
+        std::vector<Real64> AnisoSkySinTilt;       // Sine of the surface tilt
+        std::vector<char> AnisoSkyNearHorizontal;  // True for tilts below 2 deg
     } // namespace
 
     std::ofstream shd_stream; // Shading file stream
-    Array1D_int HCNS;         // Surface number of back surface HC figures
-    Array1D_int HCNV;         // Number of vertices of each HC figure
-    Array2D<Int64> HCA;       // 'A' homogeneous coordinates of sides
-    Array2D<Int64> HCB;       // 'B' homogeneous coordinates of sides
-    Array2D<Int64> HCC;       // 'C' homogeneous coordinates of sides
-    Array2D<Int64> HCX;       // 'X' homogeneous coordinates of vertices of figure.
-    Array2D<Int64> HCY;       // 'Y' homogeneous coordinates of vertices of figure.
+    EP_SHADOW_THREAD_LOCAL Array1D_int HCNS;         // Surface number of back surface HC figures
+    EP_SHADOW_THREAD_LOCAL Array1D_int HCNV;         // Number of vertices of each HC figure
+    EP_SHADOW_THREAD_LOCAL Array2D<Int64> HCA;       // 'A' homogeneous coordinates of sides
+    EP_SHADOW_THREAD_LOCAL Array2D<Int64> HCB;       // 'B' homogeneous coordinates of sides
+    EP_SHADOW_THREAD_LOCAL Array2D<Int64> HCC;       // 'C' homogeneous coordinates of sides
+    EP_SHADOW_THREAD_LOCAL Array2D<Int64> HCX;       // 'X' homogeneous coordinates of vertices of figure.
+    EP_SHADOW_THREAD_LOCAL Array2D<Int64> HCY;       // 'Y' homogeneous coordinates of vertices of figure.
     Array3D_int WindowRevealStatus;
-    Array1D<Real64> HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
     // - Positive, Shadow - Negative, Overlap between two shadows
     // - positive, etc., so that sum of HC areas=base sunlit area
-    Array1D<Real64> HCT;    // Transmittance of each HC figure
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> HCT;    // Transmittance of each HC figure
     Array1D<Real64> ISABSF; // For simple interior solar distribution (in which all beam
     // radiation entering zone is assumed to strike the floor),
     // fraction of beam radiation absorbed by each floor surface
-    Array1D<Real64> SAREA; // Sunlit area of heat transfer surface HTS
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> SAREA; // Sunlit area of heat transfer surface HTS
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> SurfSunDotMax; // Largest projection of a surface vertex on the direction to the sun
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> SurfSunDotMin; // Smallest projection of a surface vertex on the direction to the sun
     // Excludes multiplier for windows
     // Shadowing combinations data structure...See ShadowingCombinations type
     int NumTooManyFigures(0);
     int NumTooManyVertices(0);
     int NumBaseSubSurround(0);
-    Array1D<Real64> SUNCOS(3); // Direction cosines of solar position
-    Real64 XShadowProjection;  // X projection of a shadow (formerly called C)
-    Real64 YShadowProjection;  // Y projection of a shadow (formerly called S)
-    Array1D<Real64> XTEMP;     // Temporary 'X' values for HC vertices of the overlap
-    Array1D<Real64> XVC;       // X-vertices of the clipped figure
-    Array1D<Real64> XVS;       // X-vertices of the shadow
-    Array1D<Real64> YTEMP;     // Temporary 'Y' values for HC vertices of the overlap
-    Array1D<Real64> YVC;       // Y-vertices of the clipped figure
-    Array1D<Real64> YVS;       // Y-vertices of the shadow
-    Array1D<Real64> ZVC;       // Z-vertices of the clipped figure
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> SUNCOS(3); // Direction cosines of solar position
+    EP_SHADOW_THREAD_LOCAL Real64 XShadowProjection;  // X projection of a shadow (formerly called C)
+    EP_SHADOW_THREAD_LOCAL Real64 YShadowProjection;  // Y projection of a shadow (formerly called S)
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> XTEMP;     // Temporary 'X' values for HC vertices of the overlap
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> XVC;       // X-vertices of the clipped figure
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> XVS;       // X-vertices of the shadow
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> YTEMP;     // Temporary 'Y' values for HC vertices of the overlap
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> YVC;       // Y-vertices of the clipped figure
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> YVS;       // Y-vertices of the shadow
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> ZVC;       // Z-vertices of the clipped figure
     // Used in Sutherland Hodman poly clipping
-    Array1D<Real64> ATEMP;  // Temporary 'A' values for HC vertices of the overlap
-    Array1D<Real64> BTEMP;  // Temporary 'B' values for HC vertices of the overlap
-    Array1D<Real64> CTEMP;  // Temporary 'C' values for HC vertices of the overlap
-    Array1D<Real64> XTEMP1; // Temporary 'X' values for HC vertices of the overlap
-    Array1D<Real64> YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
-    int maxNumberOfFigures(0);
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> ATEMP;  // Temporary 'A' values for HC vertices of the overlap
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> BTEMP;  // Temporary 'B' values for HC vertices of the overlap
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> CTEMP;  // Temporary 'C' values for HC vertices of the overlap
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> XTEMP1; // Temporary 'X' values for HC vertices of the overlap
+    EP_SHADOW_THREAD_LOCAL Array1D<Real64> YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
+    EP_SHADOW_THREAD_LOCAL int maxNumberOfFigures(0);
 
     int const NPhi = 6;                      // Number of altitude angle steps for sky integration
     int const NTheta = 24;                   // Number of azimuth angle steps for sky integration
@@ -316,6 +338,14 @@ namespace SolarShading {
         MustAllocSolarShading = true;
         GetInputFlag = true;
         firstTime = true;
+        AnisoSkyEnvirNum = 0;
+        AnisoSkySurfNum.clear();
+        AnisoSkyNormX.clear();
+        AnisoSkyNormY.clear();
+        AnisoSkyNormZ.clear();
+        AnisoSkyViewFactorSky.clear();
+        AnisoSkySinTilt.clear();
+        AnisoSkyNearHorizontal.clear();
         HCNS.deallocate();
         HCNV.deallocate();
         HCA.deallocate();
@@ -328,6 +358,8 @@ namespace SolarShading {
         HCT.deallocate();
         ISABSF.deallocate();
         SAREA.deallocate();
+        SurfSunDotMax.deallocate();
+        SurfSunDotMin.deallocate();
         NumTooManyFigures = 0;
         NumTooManyVertices = 0;
         NumBaseSubSurround = 0;
@@ -577,6 +609,7 @@ namespace SolarShading {
         using DataSystemVariables::DisableAllSelfShading;
         using DataSystemVariables::DisableGroupSelfShading;
         using DataSystemVariables::ReportExtShadingSunlitFrac;
+        using DataSystemVariables::PixelCountingShading;
         using DataSystemVariables::SutherlandHodgman;
         using DataSystemVariables::UseImportedSunlitFrac;
         using DataSystemVariables::UseScheduledSunlitFrac;
@@ -658,8 +691,15 @@ namespace SolarShading {
             } else if (UtilityRoutines::SameString(cAlphaArgs(2), "ConvexWeilerAtherton")) {
                 SutherlandHodgman = false;
                 cAlphaArgs(2) = "ConvexWeilerAtherton";
+            } else if (UtilityRoutines::SameString(cAlphaArgs(2), "PixelCounting")) {
+                // Grid counting for surfaces without subsurfaces, SutherlandHodgman clipping for the rest
+                PixelCountingShading = true;
+                SutherlandHodgman = true;
+                cAlphaArgs(2) = "PixelCounting";
             } else if (lAlphaFieldBlanks(2)) {
-                if (!SutherlandHodgman) { // if already set.
+                if (PixelCountingShading) { // if already set.
+                    cAlphaArgs(2) = "PixelCounting";
+                } else if (!SutherlandHodgman) { // if already set.
                     cAlphaArgs(2) = "ConvexWeilerAtherton";
                 } else {
                     cAlphaArgs(2) = "SutherlandHodgman";
@@ -673,7 +713,9 @@ namespace SolarShading {
                 }
             }
         } else {
-            if (!SutherlandHodgman) {
+            if (PixelCountingShading) {
+                cAlphaArgs(2) = "PixelCounting";
+            } else if (!SutherlandHodgman) {
                 cAlphaArgs(2) = "ConvexWeilerAtherton";
             } else {
                 cAlphaArgs(2) = "SutherlandHodgman";
@@ -918,6 +960,8 @@ namespace SolarShading {
 
         CTHETA.dimension(TotSurfaces, 0.0);
         SAREA.dimension(TotSurfaces, 0.0);
+        SurfSunDotMax.dimension(TotSurfaces, 0.0);
+        SurfSunDotMin.dimension(TotSurfaces, 0.0);
         SurfSunlitArea.dimension(TotSurfaces, 0.0);
         SurfSunlitFrac.dimension(TotSurfaces, 0.0);
         SunlitFracHR.dimension(24, TotSurfaces, 0.0);
@@ -2353,6 +2397,7 @@ namespace SolarShading {
         //       AUTHOR         Fred Winkelmann
         //       DATE WRITTEN   April 1999
         //       MODIFIED       LKL; Dec 2002 -- Anisotropic is only sky radiance option
+        //                      October 2026, loop over packed exterior-solar surface geometry
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -2416,14 +2461,12 @@ namespace SolarShading {
         Real64 Epsilon;                // Sky clearness parameter
         Real64 Delta;                  // Sky brightness parameter
         Real64 CosIncAngBeamOnSurface; // Cosine of incidence angle of beam solar on surface
-        Real64 IncAng;                 // Incidence angle of beam solar on surface (radians)
         int SurfNum;                   // Surface number
         int EpsilonBin;                // Sky clearness (Epsilon) bin index
         Real64 AirMass;                // Relative air mass
         Real64 AirMassH;               // Intermediate variable for relative air mass calculation
         Real64 CircumSolarFac;         // Ratio of cosine of incidence angle to cosine of zenith angle
         Real64 KappaZ3;                // Intermediate variable
-        Real64 ViewFactorSkyGeom;      // Geometrical sky view factor
         Real64 const cosine_tolerance(0.0001);
 
         // FLOW:
@@ -2455,11 +2498,38 @@ namespace SolarShading {
         F1 = max(0.0, F11R(EpsilonBin) + F12R(EpsilonBin) * Delta + F13R(EpsilonBin) * ZenithAng);
         F2 = F21R(EpsilonBin) + F22R(EpsilonBin) * Delta + F23R(EpsilonBin) * ZenithAng;
 
-        for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
-            if (!Surface(SurfNum).ExtSolar) continue;
+        if (AnisoSkyEnvirNum != CurEnvirNum || AnisoSkySurfNum.empty()) {
+            AnisoSkyEnvirNum = CurEnvirNum;
+            AnisoSkySurfNum.clear();
+            AnisoSkyNormX.clear();
+            AnisoSkyNormY.clear();
+            AnisoSkyNormZ.clear();
+            AnisoSkyViewFactorSky.clear();
+            AnisoSkySinTilt.clear();
+            AnisoSkyNearHorizontal.clear();
+            for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+                if (!Surface(SurfNum).ExtSolar) continue;
+                AnisoSkySurfNum.push_back(SurfNum);
+                AnisoSkyNormX.push_back(Surface(SurfNum).OutNormVec(1));
+                AnisoSkyNormY.push_back(Surface(SurfNum).OutNormVec(2));
+                AnisoSkyNormZ.push_back(Surface(SurfNum).OutNormVec(3));
+                AnisoSkyViewFactorSky.push_back(Surface(SurfNum).ViewFactorSky);
+                AnisoSkySinTilt.push_back(Surface(SurfNum).SinTilt);
+                AnisoSkyNearHorizontal.push_back(Surface(SurfNum).Tilt < 2.0);
+            }
+        }
+
+        // Terms that do not depend on the surface
+        Real64 const IsoSkyFac(1.0 - F1);
+        //           0.0871557 below corresponds to a zenith angle of 85 deg
+        Real64 const CircumSolarDenom(max(0.0871557, CosZenithAng));
+        bool const SunNearHorizon(CosZenithAng < 0.0871557);
+        bool const UseHRTSRatios(DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing);
 
-            CosIncAngBeamOnSurface =
-                SOLCOS(1) * Surface(SurfNum).OutNormVec(1) + SOLCOS(2) * Surface(SurfNum).OutNormVec(2) + SOLCOS(3) * Surface(SurfNum).OutNormVec(3);
+        for (std::size_t Loop = 0, NumSurfs = AnisoSkySurfNum.size(); Loop < NumSurfs; ++Loop) {
+            SurfNum = AnisoSkySurfNum[Loop];
+
+            CosIncAngBeamOnSurface = SOLCOS(1) * AnisoSkyNormX[Loop] + SOLCOS(2) * AnisoSkyNormY[Loop] + SOLCOS(3) * AnisoSkyNormZ[Loop];
 
             // So I believe this should only be a diagnostic error...the calcs should always be within -1,+1; it's just round-off that we need to trap
             // for
@@ -2483,21 +2553,17 @@ namespace SolarShading {
                 CosIncAngBeamOnSurface = -1.0;
             }
 
-            IncAng = std::acos(CosIncAngBeamOnSurface);
-
-            ViewFactorSkyGeom = Surface(SurfNum).ViewFactorSky;
-            MultIsoSky(SurfNum) = ViewFactorSkyGeom * (1.0 - F1);
-            //           0.0871557 below corresponds to a zenith angle of 85 deg
-            CircumSolarFac = max(0.0, CosIncAngBeamOnSurface) / max(0.0871557, CosZenithAng);
+            MultIsoSky(SurfNum) = AnisoSkyViewFactorSky[Loop] * IsoSkyFac;
+            CircumSolarFac = max(0.0, CosIncAngBeamOnSurface) / CircumSolarDenom;
             //           For near-horizontal roofs, model has an inconsistency that gives sky diffuse
             //           irradiance significantly different from DifSolarRad when zenith angle is
             //           above 85 deg. The following forces irradiance to be very close to DifSolarRad
             //           in this case.
-            if (CircumSolarFac > 0.0 && CosZenithAng < 0.0871557 && Surface(SurfNum).Tilt < 2.0) CircumSolarFac = 1.0;
+            if (CircumSolarFac > 0.0 && SunNearHorizon && AnisoSkyNearHorizontal[Loop]) CircumSolarFac = 1.0;
             MultCircumSolar(SurfNum) = F1 * CircumSolarFac;
-            MultHorizonZenith(SurfNum) = F2 * Surface(SurfNum).SinTilt;
+            MultHorizonZenith(SurfNum) = F2 * AnisoSkySinTilt[Loop];
 
-            if (!DetailedSkyDiffuseAlgorithm || !ShadingTransmittanceVaries || SolarDistribution == MinimalShadowing) {
+            if (!UseHRTSRatios) {
                 AnisoSkyMult(SurfNum) = MultIsoSky(SurfNum) * DifShdgRatioIsoSky(SurfNum) +
                                         MultCircumSolar(SurfNum) * SunlitFrac(TimeStep, HourOfDay, SurfNum) +
                                         MultHorizonZenith(SurfNum) * DifShdgRatioHoriz(SurfNum);
@@ -4169,7 +4235,7 @@ namespace SolarShading {
         // na
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        static Array1D<Real64> SLOPE; // Slopes from left-most vertex to others
+        static EP_SHADOW_THREAD_LOCAL Array1D<Real64> SLOPE; // Slopes from left-most vertex to others
         Real64 DELTAX;                // Difference between X coordinates of two vertices
         Real64 DELTAY;                // Difference between Y coordinates of two vertices
         Real64 SAVES;                 // Temporary location for exchange of variables
@@ -4183,7 +4249,7 @@ namespace SolarShading {
         int M;   // Number of slopes to be sorted
         int N;   // Vertex number
         int P;   // Location of first slope to be sorted
-        static bool FirstTimeFlag(true);
+        static EP_SHADOW_THREAD_LOCAL bool FirstTimeFlag(true);
 
         if (FirstTimeFlag) {
             SLOPE.allocate(max(10, MaxVerticesPerSurface + 1));
@@ -4263,6 +4329,41 @@ namespace SolarShading {
         }
     }
 
+    bool FigureExtentsOverlap(int const NS1, // Number of the first figure
+                              int const NS2  // Number of the second figure
+    )
+    {
+
+        // FUNCTION INFORMATION:
+        //       DATE WRITTEN   October 2026
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns false when the bounding boxes of the vertices of two HC figures are apart, in which case the
+        // figures cannot overlap.  Boxes that only touch are reported as overlapping so that the clipping
+        // routines still decide those cases.
+
+        assert(equal_dimensions(HCX, HCY));
+        auto l1(HCX.index(NS1, 1));
+        Int64 XMin1(HCX[l1]), XMax1(XMin1), YMin1(HCY[l1]), YMax1(YMin1);
+        for (int N = 2, NV1 = HCNV(NS1); N <= NV1; ++N) {
+            ++l1;
+            XMin1 = min(XMin1, HCX[l1]);
+            XMax1 = max(XMax1, HCX[l1]);
+            YMin1 = min(YMin1, HCY[l1]);
+            YMax1 = max(YMax1, HCY[l1]);
+        }
+        auto l2(HCX.index(NS2, 1));
+        Int64 XMin2(HCX[l2]), XMax2(XMin2), YMin2(HCY[l2]), YMax2(YMin2);
+        for (int N = 2, NV2 = HCNV(NS2); N <= NV2; ++N) {
+            ++l2;
+            XMin2 = min(XMin2, HCX[l2]);
+            XMax2 = max(XMax2, HCX[l2]);
+            YMin2 = min(YMin2, HCY[l2]);
+            YMax2 = max(YMax2, HCY[l2]);
+        }
+        return XMax1 >= XMin2 && XMax2 >= XMin1 && YMax1 >= YMin2 && YMax2 >= YMin1;
+    }
+
     void DeterminePolygonOverlap(int const NS1, // Number of the figure being overlapped
                                  int const NS2, // Number of the figure doing overlapping
                                  int const NS3  // Location to place results of overlap
@@ -4272,7 +4373,7 @@ namespace SolarShading {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Legacy Code
         //       DATE WRITTEN
-        //       MODIFIED       na
+        //       MODIFIED       October 2026: reject figures with separate bounding boxes before clipping
         //       RE-ENGINEERED  Lawrie, Oct 2000
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -4336,21 +4437,33 @@ namespace SolarShading {
 
             OverlapStatus = TooManyFigures;
 
-            if (!TooManyFiguresMessage && !DisplayExtraWarnings) {
-                ShowWarningError("DeterminePolygonOverlap: Too many figures [>" + RoundSigDigits(MaxHCS) +
-                                 "]  detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details.");
-                TooManyFiguresMessage = true;
-            }
+            // Error bookkeeping is shared by all shadowing threads
+#ifdef _OPENMP
+#pragma omp critical(SolarShadingOverlapErrors)
+#endif
+            {
+                if (!TooManyFiguresMessage && !DisplayExtraWarnings) {
+                    ShowWarningError("DeterminePolygonOverlap: Too many figures [>" + RoundSigDigits(MaxHCS) +
+                                     "]  detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details.");
+                    TooManyFiguresMessage = true;
+                }
 
-            if (DisplayExtraWarnings) {
-                TrackTooManyFigures.redimension(++NumTooManyFigures);
-                TrackTooManyFigures(NumTooManyFigures).SurfIndex1 = CurrentShadowingSurface;
-                TrackTooManyFigures(NumTooManyFigures).SurfIndex2 = CurrentSurfaceBeingShadowed;
+                if (DisplayExtraWarnings) {
+                    TrackTooManyFigures.redimension(++NumTooManyFigures);
+                    TrackTooManyFigures(NumTooManyFigures).SurfIndex1 = CurrentShadowingSurface;
+                    TrackTooManyFigures(NumTooManyFigures).SurfIndex2 = CurrentSurfaceBeingShadowed;
+                }
             }
 
             return;
         }
 
+        // Most figure pairs are far apart, and their bounding boxes settle that without any clipping
+        if (!FigureExtentsOverlap(NS1, NS2)) {
+            OverlapStatus = NoOverlap;
+            return;
+        }
+
         OverlapStatus = PartialOverlap;
         NV1 = HCNV(NS1);
         NV2 = HCNV(NS2);
@@ -4422,32 +4535,44 @@ namespace SolarShading {
 
             OverlapStatus = TooManyVertices;
 
-            if (!TooManyVerticesMessage && !DisplayExtraWarnings) {
-                ShowWarningError("DeterminePolygonOverlap: Too many vertices [>" + RoundSigDigits(MaxHCV) +
-                                 "] detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details.");
-                TooManyVerticesMessage = true;
-            }
+            // Error bookkeeping is shared by all shadowing threads
+#ifdef _OPENMP
+#pragma omp critical(SolarShadingOverlapErrors)
+#endif
+            {
+                if (!TooManyVerticesMessage && !DisplayExtraWarnings) {
+                    ShowWarningError("DeterminePolygonOverlap: Too many vertices [>" + RoundSigDigits(MaxHCV) +
+                                     "] detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details.");
+                    TooManyVerticesMessage = true;
+                }
 
-            if (DisplayExtraWarnings) {
-                TrackTooManyVertices.redimension(++NumTooManyVertices);
-                TrackTooManyVertices(NumTooManyVertices).SurfIndex1 = CurrentShadowingSurface;
-                TrackTooManyVertices(NumTooManyVertices).SurfIndex2 = CurrentSurfaceBeingShadowed;
+                if (DisplayExtraWarnings) {
+                    TrackTooManyVertices.redimension(++NumTooManyVertices);
+                    TrackTooManyVertices(NumTooManyVertices).SurfIndex1 = CurrentShadowingSurface;
+                    TrackTooManyVertices(NumTooManyVertices).SurfIndex2 = CurrentSurfaceBeingShadowed;
+                }
             }
 
         } else if (NS3 > MaxHCS) {
 
             OverlapStatus = TooManyFigures;
 
-            if (!TooManyFiguresMessage && !DisplayExtraWarnings) {
-                ShowWarningError("DeterminePolygonOverlap: Too many figures [>" + RoundSigDigits(MaxHCS) +
-                                 "]  detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details.");
-                TooManyFiguresMessage = true;
-            }
+            // Error bookkeeping is shared by all shadowing threads
+#ifdef _OPENMP
+#pragma omp critical(SolarShadingOverlapErrors)
+#endif
+            {
+                if (!TooManyFiguresMessage && !DisplayExtraWarnings) {
+                    ShowWarningError("DeterminePolygonOverlap: Too many figures [>" + RoundSigDigits(MaxHCS) +
+                                     "]  detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details.");
+                    TooManyFiguresMessage = true;
+                }
 
-            if (DisplayExtraWarnings) {
-                TrackTooManyFigures.redimension(++NumTooManyFigures);
-                TrackTooManyFigures(NumTooManyFigures).SurfIndex1 = CurrentShadowingSurface;
-                TrackTooManyFigures(NumTooManyFigures).SurfIndex2 = CurrentSurfaceBeingShadowed;
+                if (DisplayExtraWarnings) {
+                    TrackTooManyFigures.redimension(++NumTooManyFigures);
+                    TrackTooManyFigures(NumTooManyFigures).SurfIndex1 = CurrentShadowingSurface;
+                    TrackTooManyFigures(NumTooManyFigures).SurfIndex2 = CurrentSurfaceBeingShadowed;
+                }
             }
         }
     }
@@ -4479,6 +4604,8 @@ namespace SolarShading {
         using DataGlobals::TimeStep;
         using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
         using DataSystemVariables::DetailedSolarTimestepIntegration;
+        using DataSystemVariables::NumberIntRadThreads;
+        using DataSystemVariables::ShadingCacheDirectory;
 
         using ScheduleManager::LookUpScheduleValue;
         using WindowComplexManager::InitComplexWindows;
@@ -4552,16 +4679,229 @@ namespace SolarShading {
         // Initialize/update the Complex Fenestration geometry and optical properties
         UpdateComplexWindows();
         if (!DetailedSolarTimestepIntegration) {
-            for (iHour = 1; iHour <= 24; ++iHour) { // Do for all hours.
-                for (TS = 1; TS <= NumOfTimeStepInHour; ++TS) {
-                    FigureSolarBeamAtTimestep(iHour, TS);
-                } // TimeStep Loop
-            }     // Hour Loop
+            // Runs that only differ in HVAC or schedules shadow the same geometry for the same sun positions again,
+            // so the results of the period can be loaded from an earlier run
+            std::string CacheFileName;
+            if (!ShadingCacheDirectory.empty()) {
+                CacheFileName = ShadingCacheFileName(AvgEqOfTime, AvgSinSolarDeclin, AvgCosSolarDeclin);
+                if (!CacheFileName.empty() && ReadShadingCache(CacheFileName)) return;
+            }
+#ifdef _OPENMP
+            // The hours are shadowed independently and only write their own hour slices of the results, so they can be
+            // spread over threads that each shadow in their own thread local HC buffers.  The time steps of an hour stay
+            // together since the frame and divider multipliers are hourly.  The detailed sky diffuse integration
+            // accumulates into shared DataHeatBalance arrays, so it stays serial.
+            bool const ThreadedShadowing(NumberIntRadThreads > 1 &&
+                                         !(DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing));
+            if (ThreadedShadowing) {
+                int *const MasterMaxNumberOfFigures(&maxNumberOfFigures);
+#pragma omp parallel num_threads(NumberIntRadThreads)
+                {
+                    bool const WorkerThread(&maxNumberOfFigures != MasterMaxNumberOfFigures);
+                    if (WorkerThread) AllocateShadowingThreadBuffers();
+#pragma omp for schedule(dynamic)
+                    for (int iHourThread = 1; iHourThread <= 24; ++iHourThread) {
+                        for (int TSThread = 1; TSThread <= NumOfTimeStepInHour; ++TSThread) {
+                            FigureSolarBeamAtTimestep(iHourThread, TSThread);
+                        }
+                    }
+                    if (WorkerThread) {
+#pragma omp critical(SolarShadingOverlapErrors)
+                        *MasterMaxNumberOfFigures = max(*MasterMaxNumberOfFigures, maxNumberOfFigures);
+                    }
+                }
+            }
+#else
+            bool const ThreadedShadowing(false);
+#endif
+            if (!ThreadedShadowing) {
+                for (iHour = 1; iHour <= 24; ++iHour) { // Do for all hours.
+                    for (TS = 1; TS <= NumOfTimeStepInHour; ++TS) {
+                        FigureSolarBeamAtTimestep(iHour, TS);
+                    } // TimeStep Loop
+                }     // Hour Loop
+            }
+            if (!CacheFileName.empty()) WriteShadingCache(CacheFileName);
         } else {
             FigureSolarBeamAtTimestep(HourOfDay, TimeStep);
         }
     }
 
+    namespace {
+        // The shading cache files are the raw memory of these arrays, in this order
+        FileSystem::CacheBlocks shadingCacheBlocks()
+        {
+            FileSystem::CacheBlocks Blocks;
+            FileSystem::addCacheArray(Blocks, SunlitFrac);
+            FileSystem::addCacheArray(Blocks, SunlitFracHR);
+            FileSystem::addCacheArray(Blocks, SunlitFracWithoutReveal);
+            FileSystem::addCacheArray(Blocks, CosIncAng);
+            FileSystem::addCacheArray(Blocks, CosIncAngHR);
+            FileSystem::addCacheArray(Blocks, WindowRevealStatus);
+            for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+                FileSystem::addCacheArray(Blocks, SurfaceWindow(SurfNum).OutProjSLFracMult);
+                FileSystem::addCacheArray(Blocks, SurfaceWindow(SurfNum).InOutProjSLFracMult);
+            }
+            return Blocks;
+        }
+    } // namespace
+
+    std::string ShadingCacheFileName(Real64 const AvgEqOfTime,       // Average value of Equation of Time for period
+                                     Real64 const AvgSinSolarDeclin, // Average value of Sine of Solar Declination for period
+                                     Real64 const AvgCosSolarDeclin  // Average value of Cosine of Solar Declination for period
+    )
+    {
+        // PURPOSE OF THIS FUNCTION:
+        // Returns the shading cache file of a shadowing period, named by a hash of everything CalcPerSolarBeam
+        // results depend on: surface geometry, frames and reveals, shading transmittance schedules for the day,
+        // site location, sun position inputs and the ShadowCalculation settings.  Returns an empty string when
+        // the period results include data the cache does not hold (interior overlaps, detailed sky diffuse
+        // ratios or sunlit fractions taken from schedules).
+
+        using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
+        using DataSystemVariables::DisableAllSelfShading;
+        using DataSystemVariables::DisableGroupSelfShading;
+        using DataSystemVariables::PixelCountingShading;
+        using DataSystemVariables::ShadingCacheDirectory;
+        using DataSystemVariables::SutherlandHodgman;
+        using DataSystemVariables::UseImportedSunlitFrac;
+        using DataSystemVariables::UseScheduledSunlitFrac;
+        using ScheduleManager::LookUpScheduleValue;
+
+        if (SolarDistribution == FullInteriorExterior) return std::string();
+        if (DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing) return std::string();
+        if (UseScheduledSunlitFrac || UseImportedSunlitFrac) return std::string();
+
+        // Hash of the bytes of the inputs
+        std::uint64_t Hash(FileSystem::hashBasis);
+        auto hashReal = [&Hash](Real64 const Value) { Hash = FileSystem::hashBytes(&Value, sizeof(Value), Hash); };
+        auto hashInt = [&Hash](int const Value) { Hash = FileSystem::hashBytes(&Value, sizeof(Value), Hash); };
+
+        hashInt(ShadingCacheVersion);
+        hashReal(AvgEqOfTime);
+        hashReal(AvgSinSolarDeclin);
+        hashReal(AvgCosSolarDeclin);
+        hashReal(Latitude);
+        hashReal(Longitude);
+        hashReal(TimeZoneNumber);
+        hashInt(NumOfTimeStepInHour);
+        hashInt(SolarDistribution);
+        hashInt(SutherlandHodgman);
+        hashInt(PixelCountingShading);
+        hashInt(DisableAllSelfShading);
+        hashInt(DisableGroupSelfShading);
+        hashInt(MaxHCS);
+        hashInt(TotSurfaces);
+        for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+            auto const &surface(Surface(SurfNum));
+            hashInt(surface.Sides);
+            for (int N = 1; N <= surface.Sides; ++N) {
+                hashReal(surface.Vertex(N).x);
+                hashReal(surface.Vertex(N).y);
+                hashReal(surface.Vertex(N).z);
+            }
+            hashInt(surface.Class);
+            hashInt(surface.Zone);
+            hashInt(surface.BaseSurf);
+            hashInt(surface.ExtBoundCond);
+            hashInt(surface.HeatTransSurf);
+            hashInt(surface.ShadowingSurf);
+            hashInt(surface.ExtSolar);
+            hashInt(surface.MirroredSurf);
+            hashInt(surface.IsTransparent);
+            hashReal(surface.Area);
+            hashReal(surface.NetAreaShadowCalc);
+            hashReal(surface.Reveal);
+            for (int const ZoneNum : surface.DisabledShadowingZoneList) {
+                hashInt(ZoneNum);
+            }
+            if (surface.SchedShadowSurfIndex > 0) {
+                hashReal(surface.SchedMinValue);
+                for (int iHour = 1; iHour <= 24; ++iHour) {
+                    for (int TS = 1; TS <= NumOfTimeStepInHour; ++TS) {
+                        hashReal(LookUpScheduleValue(surface.SchedShadowSurfIndex, iHour, TS));
+                    }
+                }
+            }
+            if (surface.FrameDivider > 0) {
+                auto const &frameDivider(FrameDivider(surface.FrameDivider));
+                hashReal(frameDivider.FrameWidth);
+                hashReal(frameDivider.FrameProjectionOut);
+                hashReal(frameDivider.FrameProjectionIn);
+                hashReal(frameDivider.DividerWidth);
+                hashReal(frameDivider.DividerProjectionOut);
+                hashReal(frameDivider.DividerProjectionIn);
+                hashInt(frameDivider.HorDividers);
+                hashInt(frameDivider.VertDividers);
+            }
+        }
+
+        return ShadingCacheDirectory + DataStringGlobals::pathChar + FileSystem::hashToHex(Hash) + ".shdcache";
+    }
+
+    bool ReadShadingCache(std::string const &FileName)
+    {
+        // PURPOSE OF THIS FUNCTION:
+        // Loads the results of a shadowing period written by WriteShadingCache.  Returns false, leaving the
+        // arrays to be calculated, when the file is missing or does not match the current model dimensions.
+
+        bool SizeMismatch(false);
+        if (FileSystem::readCacheFile(FileName, {ShadingCacheVersion, TotSurfaces, NumOfTimeStepInHour}, shadingCacheBlocks(), SizeMismatch)) {
+            return true;
+        }
+        if (SizeMismatch) ShowWarningError("ReadShadingCache: " + FileName + " does not match this model, shading will be calculated.");
+        return false;
+    }
+
+    void WriteShadingCache(std::string const &FileName)
+    {
+        // PURPOSE OF THIS SUBROUTINE:
+        // Stores the results of a shadowing period for ReadShadingCache.  The arrays are written in their own
+        // memory layout, so a cache file is only meant to be read back by the same build on the same platform.
+
+        if (!FileSystem::writeCacheFile(FileName, {ShadingCacheVersion, TotSurfaces, NumOfTimeStepInHour}, shadingCacheBlocks())) {
+            ShowWarningError("WriteShadingCache: could not write " + FileName + ", shading results will not be cached.");
+        }
+    }
+
+    void AllocateShadowingThreadBuffers()
+    {
+        // PURPOSE OF THIS SUBROUTINE:
+        // Sizes the thread local shadowing work buffers of a worker thread the same way AllocateModuleArrays
+        // and DetermineShadowingCombinations size them for the main thread.
+
+        CTHETA.dimension(TotSurfaces, 0.0);
+        SAREA.dimension(TotSurfaces, 0.0);
+        SurfSunDotMax.dimension(TotSurfaces, 0.0);
+        SurfSunDotMin.dimension(TotSurfaces, 0.0);
+
+        XTEMP.dimension(2 * (MaxVerticesPerSurface + 1), 0.0);
+        YTEMP.dimension(2 * (MaxVerticesPerSurface + 1), 0.0);
+        XVC.dimension(MaxVerticesPerSurface + 1, 0.0);
+        XVS.dimension(MaxVerticesPerSurface + 1, 0.0);
+        YVC.dimension(MaxVerticesPerSurface + 1, 0.0);
+        YVS.dimension(MaxVerticesPerSurface + 1, 0.0);
+        ZVC.dimension(MaxVerticesPerSurface + 1, 0.0);
+
+        ATEMP.dimension(2 * (MaxVerticesPerSurface + 1), 0.0);
+        BTEMP.dimension(2 * (MaxVerticesPerSurface + 1), 0.0);
+        CTEMP.dimension(2 * (MaxVerticesPerSurface + 1), 0.0);
+        XTEMP1.dimension(2 * (MaxVerticesPerSurface + 1), 0.0);
+        YTEMP1.dimension(2 * (MaxVerticesPerSurface + 1), 0.0);
+
+        HCA.dimension(2 * MaxHCS, MaxHCV + 1, 0);
+        HCB.dimension(2 * MaxHCS, MaxHCV + 1, 0);
+        HCC.dimension(2 * MaxHCS, MaxHCV + 1, 0);
+        HCX.dimension(2 * MaxHCS, MaxHCV + 1, 0);
+        HCY.dimension(2 * MaxHCS, MaxHCV + 1, 0);
+        HCAREA.dimension(2 * MaxHCS, 0.0);
+        HCNS.dimension(2 * MaxHCS, 0);
+        HCNV.dimension(2 * MaxHCS, 0);
+        HCT.dimension(2 * MaxHCS, 0.0);
+
+        maxNumberOfFigures = 0;
+    }
+
     void FigureSunCosines(int const iHour,
                           int const iTimeStep,
                           Real64 const EqOfTime,       // value of Equation of Time for period
@@ -4868,6 +5208,9 @@ namespace SolarShading {
         int NSBS;                    // Number of subsurfaces for a receiving surface
         bool ShadowingSurf;          // True if a receiving surface is a shadowing surface
         Array1D_bool CastingSurface; // tracking during setup of ShadowComb
+        std::vector<std::pair<Real64, int>> GenCasters;          // (highest point, surface) of the detached and exposed base surfaces
+        std::vector<std::vector<int>> AttachedShaders;           // Non heat transfer subsurfaces of each surface
+        std::vector<int> RSCasters;                              // Shadowing surfaces found for the current receiving surface
 
         static int MaxDim(0);
 
@@ -4900,6 +5243,29 @@ namespace SolarShading {
             return;
         }
 
+        // Index the possible shadow casting surfaces once.  CHKGSS rejects a detached or exposed base surface
+        // whose highest point is not above the lowest point of the receiving surface, or which faces straight up,
+        // so keeping those sorted by highest point lets each receiving surface visit only the casters that reach
+        // above it.  Shading subsurfaces are only candidates for their own base surface.
+        AttachedShaders.resize(TotSurfaces + 1);
+        for (GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR) {
+            auto const &surface_C(Surface(GSSNR));
+            if (surface_C.BaseSurf > 0 && surface_C.BaseSurf != GSSNR) {
+                if (!surface_C.HeatTransSurf) AttachedShaders[surface_C.BaseSurf].push_back(GSSNR);
+            } else if ((surface_C.BaseSurf == 0) || ((surface_C.ExtBoundCond == ExternalEnvironment) ||
+                                                     (surface_C.ExtBoundCond == OtherSideCondModeledExt))) {
+                if (surface_C.OutNormVec(3) > 0.9999) continue; // Horizontal and facing upward, cannot shade
+                Real64 ZMAX(surface_C.Vertex(1).z);
+                for (int i = 2, e = surface_C.Sides; i <= e; ++i) {
+                    ZMAX = std::max(ZMAX, surface_C.Vertex(i).z);
+                }
+                GenCasters.emplace_back(ZMAX, GSSNR);
+            }
+        }
+        std::sort(GenCasters.begin(), GenCasters.end(), [](std::pair<Real64, int> const &a, std::pair<Real64, int> const &b) {
+            return a.first > b.first;
+        });
+
         for (GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR) { // Loop through all surfaces (looking for potential receiving surfaces)...
 
             ShadowingSurf = Surface(GRSNR).ShadowingSurf;
@@ -4918,63 +5284,42 @@ namespace SolarShading {
 
             // Check every surface as a possible shadow casting surface ("SS" = shadow sending)
             NGSS = 0;
+            RSCasters.clear();
+            // Shading subsurfaces of the receiving surface
+            for (int const GSSNR : AttachedShaders[GRSNR]) {
+                if (ShadowingSurf && SolarDistribution != MinimalShadowing) {
+                    // If receiving surf is a shadowing surface exclude matching shadow surface as sending surface
+                    if (((GSSNR == GRSNR + 1) && Surface(GSSNR).MirroredSurf) || ((GSSNR == GRSNR - 1) && Surface(GRSNR).MirroredSurf)) continue;
+                }
+                RSCasters.push_back(GSSNR);
+            }
             if (SolarDistribution != MinimalShadowing) { // Except when doing simplified exterior shadowing.
 
-                for (GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR) { // Loop through all surfaces, looking for ones that could shade GRSNR
+                // Detached shadowing surfaces and any other base surface exposed to outside environment,
+                // stopping at the first caster that does not reach above the receiving surface
+                for (auto const &caster : GenCasters) {
 
+                    if (caster.first <= ZMIN) break;
+                    GSSNR = caster.second;
                     if (GSSNR == GRSNR) continue; // Receiving surface cannot shade itself
-                    if ((Surface(GSSNR).HeatTransSurf) && (Surface(GSSNR).BaseSurf == GRSNR))
-                        continue; // A heat transfer subsurface of a receiving surface
-                    // cannot shade the receiving surface
                     if (ShadowingSurf) {
                         // If receiving surf is a shadowing surface exclude matching shadow surface as sending surface
-                        // IF((GSSNR == GRSNR+1 .AND. Surface(GSSNR)%Name(1:3) == 'Mir').OR. &
-                        //   (GSSNR == GRSNR-1 .AND. Surface(GRSNR)%Name(1:3) == 'Mir')) CYCLE
                         if (((GSSNR == GRSNR + 1) && Surface(GSSNR).MirroredSurf) || ((GSSNR == GRSNR - 1) && Surface(GRSNR).MirroredSurf)) continue;
                     }
 
-                    if (Surface(GSSNR).BaseSurf == GRSNR) { // Shadowing subsurface of receiving surface
-
-                        ++NGSS;
-                        if (NGSS > MaxGSS) {
-                            GSS.redimension(MaxGSS *= 2, 0);
-                        }
-                        GSS(NGSS) = GSSNR;
-
-                    } else if ((Surface(GSSNR).BaseSurf == 0) ||
-                               ((Surface(GSSNR).BaseSurf == GSSNR) &&
-                                ((Surface(GSSNR).ExtBoundCond == ExternalEnvironment) ||
-                                 Surface(GSSNR).ExtBoundCond == OtherSideCondModeledExt))) { // Detached shadowing surface or | any other base surface
-                                                                                             // exposed to outside environment
-
-                        CHKGSS(GRSNR, GSSNR, ZMIN, CannotShade); // Check to see if this can shade the receiving surface
-                        if (!CannotShade) {                      // Update the shadowing surface data if shading is possible
-                            ++NGSS;
-                            if (NGSS > MaxGSS) {
-                                GSS.redimension(MaxGSS *= 2, 0);
-                            }
-                            GSS(NGSS) = GSSNR;
-                        }
-                    }
-
-                }    // ...end of surfaces DO loop (GSSNR)
-            } else { // Simplified Distribution -- still check for Shading Subsurfaces
-
-                for (GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR) { // Loop through all surfaces (looking for surfaces which could shade GRSNR) ...
-
-                    if (GSSNR == GRSNR) continue; // Receiving surface cannot shade itself
-                    if ((Surface(GSSNR).HeatTransSurf) && (Surface(GSSNR).BaseSurf == GRSNR))
-                        continue;                           // Skip heat transfer subsurfaces of receiving surface
-                    if (Surface(GSSNR).BaseSurf == GRSNR) { // Shadowing subsurface of receiving surface
-                        ++NGSS;
-                        if (NGSS > MaxGSS) {
-                            GSS.redimension(MaxGSS *= 2, 0);
-                        }
-                        GSS(NGSS) = GSSNR;
-                    }
+                    CHKGSS(GRSNR, GSSNR, ZMIN, CannotShade); // Check to see if this can shade the receiving surface
+                    if (!CannotShade) RSCasters.push_back(GSSNR);
                 }
-
-            } // ...end of check for simplified solar distribution
+            }
+            // Keep the shadowing surfaces in surface order, as the overlap calculations have always seen them
+            std::sort(RSCasters.begin(), RSCasters.end());
+            for (int const GSSNR : RSCasters) {
+                ++NGSS;
+                if (NGSS > MaxGSS) {
+                    GSS.redimension(MaxGSS *= 2, 0);
+                }
+                GSS(NGSS) = GSSNR;
+            }
 
             // Check every surface as a receiving subsurface of the receiving surface
             NSBS = 0;
@@ -5189,10 +5534,10 @@ namespace SolarShading {
         int NGRS;  // Coordinate transformation index
         int NZ;    // Zone Number of surface
         int NVT;
-        static Array1D<Real64> XVT; // X Vertices of Shadows
-        static Array1D<Real64> YVT; // Y vertices of Shadows
-        static Array1D<Real64> ZVT; // Z vertices of Shadows
-        static bool OneTimeFlag(true);
+        static EP_SHADOW_THREAD_LOCAL Array1D<Real64> XVT; // X Vertices of Shadows
+        static EP_SHADOW_THREAD_LOCAL Array1D<Real64> YVT; // Y vertices of Shadows
+        static EP_SHADOW_THREAD_LOCAL Array1D<Real64> ZVT; // Z vertices of Shadows
+        static EP_SHADOW_THREAD_LOCAL bool OneTimeFlag(true);
         int HTS;         // Heat transfer surface number of the general receiving surface
         int GRSNR;       // Surface number of general receiving surface
         int NBKS;        // Number of back surfaces
@@ -5200,6 +5545,7 @@ namespace SolarShading {
         int NSBS;        // Number of subsurfaces (windows and doors)
         Real64 SurfArea; // Surface area. For walls, includes all window frame areas.
         // For windows, includes divider area
+        using DataSystemVariables::PixelCountingShading;
 
         if (OneTimeFlag) {
             XVT.allocate(MaxVerticesPerSurface + 1);
@@ -5221,6 +5567,20 @@ namespace SolarShading {
 
         SAREA = 0.0;
 
+        // Extent of every surface along the direction to the sun, so SHDGSS can drop casters lying entirely behind a receiving surface
+        for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+            auto const &vertex(Surface(SurfNum).Vertex);
+            Real64 SunDotMax(SUNCOS(1) * vertex(1).x + SUNCOS(2) * vertex(1).y + SUNCOS(3) * vertex(1).z);
+            Real64 SunDotMin(SunDotMax);
+            for (int i = 2, e = Surface(SurfNum).Sides; i <= e; ++i) {
+                Real64 const SunDot(SUNCOS(1) * vertex(i).x + SUNCOS(2) * vertex(i).y + SUNCOS(3) * vertex(i).z);
+                SunDotMax = max(SunDotMax, SunDot);
+                SunDotMin = min(SunDotMin, SunDot);
+            }
+            SurfSunDotMax(SurfNum) = SunDotMax;
+            SurfSunDotMin(SurfNum) = SunDotMin;
+        }
+
         for (GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR) {
 
             if (!ShadowComb(GRSNR).UseThisSurf) continue;
@@ -5280,9 +5640,14 @@ namespace SolarShading {
                 HCAREA(1) = -HCAREA(1); // Compute (+) gross surface area.
                 HCT(1) = 1.0;
 
-                SHDGSS(NGRS, iHour, TS, GRSNR, NGSS, HTS); // Determine shadowing on surface.
-                if (!CalcSkyDifShading) {
-                    SHDBKS(NGRS, GRSNR, NBKS, HTS); // Determine possible back surfaces.
+                if (PixelCountingShading && NSBS <= 0) {
+                    // Without subsurfaces no back surface overlaps are needed, so the grid count gives the whole answer
+                    SHDGSSPixelCounting(NGRS, iHour, TS, GRSNR, NGSS, HTS, NVT, XVT, YVT);
+                } else {
+                    SHDGSS(NGRS, iHour, TS, GRSNR, NGSS, HTS); // Determine shadowing on surface.
+                    if (!CalcSkyDifShading) {
+                        SHDBKS(NGRS, GRSNR, NBKS, HTS); // Determine possible back surfaces.
+                    }
                 }
 
                 SHDSBS(iHour, GRSNR, NBKS, NSBS, HTS, TS); // Subtract subsurf areas from total
@@ -5346,10 +5711,10 @@ namespace SolarShading {
         int N;
         int NVR;
         int NVT;                    // Number of vertices of back surface
-        static Array1D<Real64> XVT; // X,Y,Z coordinates of vertices of
-        static Array1D<Real64> YVT; // back surfaces projected into system
-        static Array1D<Real64> ZVT; // relative to receiving surface
-        static bool OneTimeFlag(true);
+        static EP_SHADOW_THREAD_LOCAL Array1D<Real64> XVT; // X,Y,Z coordinates of vertices of
+        static EP_SHADOW_THREAD_LOCAL Array1D<Real64> YVT; // back surfaces projected into system
+        static EP_SHADOW_THREAD_LOCAL Array1D<Real64> ZVT; // relative to receiving surface
+        static EP_SHADOW_THREAD_LOCAL bool OneTimeFlag(true);
         int BackSurfaceNumber;
         int NS1; // Number of the figure being overlapped
         int NS2; // Number of the figure doing overlapping
@@ -5487,10 +5852,10 @@ namespace SolarShading {
         int GSSNR;             // General shadowing surface number
         int MainOverlapStatus; // Overlap status of the main overlap calculation not the check for
         // multiple overlaps (unless there was an error)
-        static Array1D<Real64> XVT;
-        static Array1D<Real64> YVT;
-        static Array1D<Real64> ZVT;
-        static bool OneTimeFlag(true);
+        static EP_SHADOW_THREAD_LOCAL Array1D<Real64> XVT;
+        static EP_SHADOW_THREAD_LOCAL Array1D<Real64> YVT;
+        static EP_SHADOW_THREAD_LOCAL Array1D<Real64> ZVT;
+        static EP_SHADOW_THREAD_LOCAL bool OneTimeFlag(true);
         int NS1;         // Number of the figure being overlapped
         int NS2;         // Number of the figure doing overlapping
         int NS3;         // Location to place results of overlap
@@ -5578,6 +5943,10 @@ namespace SolarShading {
                     }
 
                 } else {
+                    // A shadow falls farther from the sun than the caster point that casts it, so a caster lying
+                    // entirely behind the receiving surface as seen from the sun cannot shade it
+                    if (SurfSunDotMax(GSSNR) < SurfSunDotMin(CurSurf)) continue;
+
                     // Transform coordinates of shadow casting surface from general system to the system relative to the receiving surface
                     int NVT;
                     CTRANS(GSSNR, NGRS, NVT, XVT, YVT, ZVT);
@@ -5695,6 +6064,198 @@ namespace SolarShading {
         NGSSHC = LOCHCA - FGSSHC + 1;
     }
 
+    void SHDGSSPixelCounting(int const NGRS,
+                             int const iHour,   // Hour Counter
+                             int const TS,      // TimeStep
+                             int const CurSurf, // Current Surface
+                             int const NGSS,    // Number of general shadowing surfaces
+                             int const HTS,     // Heat transfer surface number of the general receiving surf
+                             int const NVR,     // Number of vertices of the receiving surface
+                             Array1<Real64> const &XVR, // X vertices of the receiving surface in its own plane
+                             Array1<Real64> const &YVR  // Y vertices of the receiving surface in its own plane
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   Oct 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // This subroutine determines the sunlit area of a receiving surface that has no
+        // subsurfaces by counting sunlit cells of a grid laid over the surface, instead of
+        // overlapping the shadow polygons with HTRANS/DeterminePolygonOverlap.
+
+        // METHODOLOGY EMPLOYED:
+        // The shadows are projected onto the plane of the receiving surface exactly as in SHDGSS
+        // (CTRANS, CLIP and the shadow projection), so no depth buffer is needed.  The bounding
+        // box of the receiving surface is divided into PixelCountingGridSize x PixelCountingGridSize
+        // cells; a cell belongs to the surface when its center lies inside the surface polygon and
+        // each shadow whose polygon covers the cell center multiplies the cell transmittance by the
+        // shading surface transmittance.  The sunlit area is the gross area times the mean cell
+        // transmittance.  Shadows whose bounding box misses the receiving surface are rejected
+        // before any cell is visited, so the cost grows with the shadows that actually fall on
+        // the surface rather than with the number of overlapping figures.
+
+        // REFERENCES:
+        // na
+
+        // USE STATEMENTS:
+        using DataSystemVariables::DisableAllSelfShading;
+        using DataSystemVariables::DisableGroupSelfShading;
+        using ScheduleManager::LookUpScheduleValue;
+
+        static EP_SHADOW_THREAD_LOCAL Array1D<Real64> XVT;
+        static EP_SHADOW_THREAD_LOCAL Array1D<Real64> YVT;
+        static EP_SHADOW_THREAD_LOCAL Array1D<Real64> ZVT;
+        static EP_SHADOW_THREAD_LOCAL Array1D<Real64> CellTrans; // Transmittance of each grid cell, -1 outside the surface
+        static EP_SHADOW_THREAD_LOCAL bool OneTimeFlag(true);
+
+        if (OneTimeFlag) {
+            XVT.dimension(MaxVerticesPerSurface + 1, 0.0);
+            YVT.dimension(MaxVerticesPerSurface + 1, 0.0);
+            ZVT.dimension(MaxVerticesPerSurface + 1, 0.0);
+            CellTrans.dimension(PixelCountingGridSize * PixelCountingGridSize, 0.0);
+            OneTimeFlag = false;
+        }
+
+        // Even-odd test of a point against the first NV vertices of a polygon
+        auto insidePolygon = [](Real64 const X, Real64 const Y, int const NV, Array1<Real64> const &XV, Array1<Real64> const &YV) {
+            bool inside(false);
+            for (int N = 1, M = NV; N <= NV; M = N++) {
+                if (((YV(N) > Y) != (YV(M) > Y)) && (X < (XV(M) - XV(N)) * (Y - YV(N)) / (YV(M) - YV(N)) + XV(N))) inside = !inside;
+            }
+            return inside;
+        };
+
+        NGSSHC = 0;
+        LOCHCA = 1;
+        OverlapStatus = NoOverlap;
+
+        Real64 XMin(XVR(1));
+        Real64 XMax(XVR(1));
+        Real64 YMin(YVR(1));
+        Real64 YMax(YVR(1));
+        for (int N = 2; N <= NVR; ++N) {
+            XMin = min(XMin, XVR(N));
+            XMax = max(XMax, XVR(N));
+            YMin = min(YMin, YVR(N));
+            YMax = max(YMax, YVR(N));
+        }
+        Real64 const DX((XMax - XMin) / PixelCountingGridSize);
+        Real64 const DY((YMax - YMin) / PixelCountingGridSize);
+        if (NGSS <= 0 || DX <= 0.0 || DY <= 0.0) {
+            SAREA(HTS) = HCAREA(1); // Surface fully sunlit
+            return;
+        }
+
+        int NumCells(0); // Number of grid cells on the receiving surface
+        for (int J = 0; J < PixelCountingGridSize; ++J) {
+            Real64 const Y(YMin + (J + 0.5) * DY);
+            for (int I = 0; I < PixelCountingGridSize; ++I) {
+                if (insidePolygon(XMin + (I + 0.5) * DX, Y, NVR, XVR, YVR)) {
+                    CellTrans[J * PixelCountingGridSize + I] = 1.0;
+                    ++NumCells;
+                } else {
+                    CellTrans[J * PixelCountingGridSize + I] = -1.0;
+                }
+            }
+        }
+        if (NumCells == 0) {
+            SAREA(HTS) = HCAREA(1); // Surface thinner than a cell, treat as fully sunlit
+            return;
+        }
+
+        auto const &GenSurf(ShadowComb(CurSurf).GenSurf);
+        for (int GS = 1; GS <= NGSS; ++GS) { // Loop through all shadowing surfaces, selected as in SHDGSS
+
+            int const GSSNR(GenSurf(GS));
+
+            if (CTHETA(GSSNR) > SunIsUpValue) continue; // NO SHADOW IF GSS IN SUNLIGHT.
+
+            auto const &surface(Surface(GSSNR));
+            bool const notHeatTransSurf(!surface.HeatTransSurf);
+
+            if (notHeatTransSurf) {
+                if (surface.IsTransparent) continue;
+                if (surface.SchedShadowSurfIndex > 0) {
+                    if (LookUpScheduleValue(surface.SchedShadowSurfIndex, iHour) == 1.0) continue;
+                    if (!CalcSkyDifShading) {
+                        if (LookUpScheduleValue(surface.SchedShadowSurfIndex, iHour, TS) == 1.0) continue;
+                    }
+                }
+            }
+            if (DisableAllSelfShading) {
+                if (surface.Zone != 0) continue;
+            } else if (DisableGroupSelfShading) {
+                auto const &DisabledZones(Surface(CurSurf).DisabledShadowingZoneList);
+                if (std::find(DisabledZones.begin(), DisabledZones.end(), surface.Zone) != DisabledZones.end()) continue;
+            }
+
+            int NVShadow;
+            if ((notHeatTransSurf) && (surface.BaseSurf != 0)) {
+                NVShadow = surface.Sides;
+                auto const &XV(ShadeV(GSSNR).XV);
+                auto const &YV(ShadeV(GSSNR).YV);
+                auto const &ZV(ShadeV(GSSNR).ZV);
+                for (int N = 1; N <= NVShadow; ++N) {
+                    XVS(N) = XV(N) - XShadowProjection * ZV(N);
+                    YVS(N) = YV(N) - YShadowProjection * ZV(N);
+                }
+            } else {
+                if (SurfSunDotMax(GSSNR) < SurfSunDotMin(CurSurf)) continue; // Caster entirely behind the receiving surface
+                int NVT;
+                CTRANS(GSSNR, NGRS, NVT, XVT, YVT, ZVT);
+                CLIP(NVT, XVT, YVT, ZVT);
+                NVShadow = NumVertInShadowOrClippedSurface;
+                if (NVShadow <= 2) continue;
+                for (int N = 1; N <= NVShadow; ++N) {
+                    XVS(N) = XVC(N) - XShadowProjection * ZVC(N);
+                    YVS(N) = YVC(N) - YShadowProjection * ZVC(N);
+                }
+            }
+
+            Real64 SXMin(XVS(1));
+            Real64 SXMax(XVS(1));
+            Real64 SYMin(YVS(1));
+            Real64 SYMax(YVS(1));
+            for (int N = 2; N <= NVShadow; ++N) {
+                SXMin = min(SXMin, XVS(N));
+                SXMax = max(SXMax, XVS(N));
+                SYMin = min(SYMin, YVS(N));
+                SYMax = max(SYMax, YVS(N));
+            }
+            if (SXMax <= XMin || SXMin >= XMax || SYMax <= YMin || SYMin >= YMax) continue; // Shadow misses the surface
+
+            Real64 SchValue; // Value for Schedule of shading transmittence
+            if (!CalcSkyDifShading && iHour != 0) {
+                SchValue = LookUpScheduleValue(surface.SchedShadowSurfIndex, iHour, TS);
+            } else {
+                SchValue = surface.SchedMinValue;
+            }
+
+            int const IMin(max(0, int((SXMin - XMin) / DX)));
+            int const IMax(min(PixelCountingGridSize - 1, int((SXMax - XMin) / DX)));
+            int const JMin(max(0, int((SYMin - YMin) / DY)));
+            int const JMax(min(PixelCountingGridSize - 1, int((SYMax - YMin) / DY)));
+            for (int J = JMin; J <= JMax; ++J) {
+                Real64 const Y(YMin + (J + 0.5) * DY);
+                for (int I = IMin; I <= IMax; ++I) {
+                    Real64 &Trans(CellTrans[J * PixelCountingGridSize + I]);
+                    if (Trans <= 0.0) continue; // Off the surface or already fully shaded
+                    if (insidePolygon(XMin + (I + 0.5) * DX, Y, NVShadow, XVS, YVS)) Trans *= SchValue;
+                }
+            }
+        }
+
+        Real64 SumTrans(0.0);
+        for (int Cell = 0, e = PixelCountingGridSize * PixelCountingGridSize; Cell < e; ++Cell) {
+            if (CellTrans[Cell] > 0.0) SumTrans += CellTrans[Cell];
+        }
+        SAREA(HTS) = HCAREA(1) * SumTrans / NumCells;
+    }
+
     void CalcInteriorSolarOverlaps(int const iHour, // Hour Index
                                    int const NBKS,  // Number of back surfaces associated with this GRSNR (in general, only
                                    int const HTSS,  // Surface number of the subsurface (exterior window)
@@ -6370,7 +6931,8 @@ namespace SolarShading {
                         NGlass = Construct(ConstrNum).TotGlassLayers;
 
                         for (Lay = 1; Lay <= NGlass; ++Lay) {
-                            AbWin = POLYF(CosInc, Construct(ConstrNum).AbsBeamCoef({1, 6}, Lay)) * CosInc * SunLitFract *
+                            AbWin = POLYF(CosInc, Construct(ConstrNum).AbsBeamCoef({1, 6}, Lay),
+                                          Construct(ConstrNum).AbsBeamTable[Lay - 1]) * CosInc * SunLitFract *
                                     SurfaceWindow(SurfNum).OutProjSLFracMult(HourOfDay);
                             ADiffWin = Construct(ConstrNum).AbsDiff(Lay);
                             if (ShadeFlag <= 0 || ShadeFlag >= 10) {
@@ -6392,7 +6954,8 @@ namespace SolarShading {
 
                                     // Shade or switchable glazing on
 
-                                    AbWinSh = POLYF(CosInc, Construct(ConstrNumSh).AbsBeamCoef({1, 6}, Lay)) * CosInc * FracSunLit;
+                                    AbWinSh = POLYF(CosInc, Construct(ConstrNumSh).AbsBeamCoef({1, 6}, Lay),
+                                                    Construct(ConstrNumSh).AbsBeamTable[Lay - 1]) * CosInc * FracSunLit;
 
                                     ADiffWinSh = Construct(ConstrNumSh).AbsDiff(Lay);
 
@@ -6405,7 +6968,7 @@ namespace SolarShading {
 
                                         // Interior blind on
                                         if (Lay == 1) {
-                                            TGlBm = POLYF(CosInc, Construct(ConstrNum).TransSolBeamCoef);
+                                            TGlBm = POLYF(CosInc, Construct(ConstrNum).TransSolBeamCoef, Construct(ConstrNum).TransSolBeamTable);
                                             RGlDiffBack = Construct(ConstrNum).ReflectSolDiffBack;
                                             RhoBlFront = InterpProfSlatAng(ProfAng, SlatAng, VarSlats, Blind(BlNum).SolFrontBeamDiffRefl);
                                             RhoBlDiffFront = InterpSlatAng(SlatAng, VarSlats, Blind(BlNum).SolFrontDiffDiffRefl);
@@ -6423,7 +6986,8 @@ namespace SolarShading {
                                             TBlBmDiff = InterpProfSlatAng(ProfAng, SlatAng, VarSlats, Blind(BlNum).SolFrontBeamDiffTrans);
                                             RhoBlBack = InterpProfSlatAng(ProfAng, SlatAng, VarSlats, Blind(BlNum).SolBackBeamDiffRefl);
                                             RhoBlDiffBack = InterpSlatAng(SlatAng, VarSlats, Blind(BlNum).SolBackDiffDiffRefl);
-                                            RGlFront = POLYF(CosInc, Construct(ConstrNum).ReflSolBeamFrontCoef);
+                                            RGlFront = POLYF(CosInc, Construct(ConstrNum).ReflSolBeamFrontCoef,
+                                                             Construct(ConstrNum).ReflSolBeamFrontTable);
                                             RGlDiffFront = Construct(ConstrNum).ReflectSolDiffFront;
                                             TBlDifDif = InterpSlatAng(SlatAng, VarSlats, Blind(BlNum).SolFrontDiffDiffTrans);
                                             RGlDifFr = Construct(ConstrNum).ReflectSolDiffFront;
@@ -6445,7 +7009,8 @@ namespace SolarShading {
                                             TScBmDiff = SurfaceScreens(ScNum).BmDifTrans;
                                             RScBack = SurfaceScreens(ScNum).ReflectSolBeamFront;
                                             RScDifBack = SurfaceScreens(ScNum).DifReflect;
-                                            RGlFront = POLYF(CosInc, Construct(ConstrNum).ReflSolBeamFrontCoef);
+                                            RGlFront = POLYF(CosInc, Construct(ConstrNum).ReflSolBeamFrontCoef,
+                                                             Construct(ConstrNum).ReflSolBeamFrontTable);
                                             RGlDiffFront = Construct(ConstrNum).ReflectSolDiffFront;
                                             TScDifDif = SurfaceScreens(ScNum).DifDifTrans;
                                             RGlDifFr = Construct(ConstrNum).ReflectSolDiffFront;
@@ -6622,7 +7187,7 @@ namespace SolarShading {
                         // Exterior beam absorbed by INTERIOR BLIND
 
                         if (ShadeFlag == IntBlindOn) {
-                            TBmBm = POLYF(CosInc, Construct(ConstrNum).TransSolBeamCoef);
+                            TBmBm = POLYF(CosInc, Construct(ConstrNum).TransSolBeamCoef, Construct(ConstrNum).TransSolBeamTable);
                             RGlDiffBack = Construct(ConstrNum).ReflectSolDiffBack;
                             RhoBlFront = InterpProfSlatAng(ProfAng, SlatAng, VarSlats, Blind(BlNum).SolFrontBeamDiffRefl);
                             AbsBlFront = InterpProfSlatAng(ProfAng, SlatAng, VarSlats, Blind(BlNum).SolFrontBeamAbs);
@@ -6643,7 +7208,7 @@ namespace SolarShading {
                         if (ShadeFlag == ExtBlindOn) {
                             TBlBmBm =
                                 BlindBeamBeamTrans(ProfAng, SlatAng, Blind(BlNum).SlatWidth, Blind(BlNum).SlatSeparation, Blind(BlNum).SlatThickness);
-                            RGlFront = POLYF(CosInc, Construct(ConstrNum).ReflSolBeamFrontCoef);
+                            RGlFront = POLYF(CosInc, Construct(ConstrNum).ReflSolBeamFrontCoef, Construct(ConstrNum).ReflSolBeamFrontTable);
                             AbsBlFront = InterpProfSlatAng(ProfAng, SlatAng, VarSlats, Blind(BlNum).SolFrontBeamAbs);
                             AbsBlBack = InterpProfSlatAng(ProfAng, SlatAng, VarSlats, Blind(BlNum).SolBackBeamAbs);
                             AbsBlDiffBack = InterpSlatAng(SlatAng, VarSlats, Blind(BlNum).SolBackDiffAbs);
@@ -6661,7 +7226,7 @@ namespace SolarShading {
                         if (ShadeFlag == ExtScreenOn) {
                             TScBmBm = SurfaceScreens(SurfaceWindow(SurfNum).ScreenNumber).BmBmTrans;
                             //        TScBmDiff     = SurfaceScreens(SurfaceWindow(SurfNum)%ScreenNumber)%BmDifTrans
-                            RGlFront = POLYF(CosInc, Construct(ConstrNum).ReflSolBeamFrontCoef);
+                            RGlFront = POLYF(CosInc, Construct(ConstrNum).ReflSolBeamFrontCoef, Construct(ConstrNum).ReflSolBeamFrontTable);
                             RGlDiffFront = Construct(ConstrNum).ReflectSolDiffFront;
 
                             AbsScBeam = SurfaceScreens(ScNum).AbsorpSolarBeamFront;
@@ -6984,9 +7549,9 @@ namespace SolarShading {
                     } else if (SurfaceWindow(SurfNum).WindowModelType != WindowBSDFModel &&
                                SurfaceWindow(SurfNum).WindowModelType != WindowEQLModel) { // Regular window
                         if (!SurfaceWindow(SurfNum).SolarDiffusing) {                      // Clear glazing
-                            TBmBm = POLYF(CosInc, Construct(ConstrNum).TransSolBeamCoef);  //[-]
+                            TBmBm = POLYF(CosInc, Construct(ConstrNum).TransSolBeamCoef, Construct(ConstrNum).TransSolBeamTable);  //[-]
                         } else {                                                           // Diffusing glazing
-                            TBmDif = POLYF(CosInc, Construct(ConstrNum).TransSolBeamCoef); //[-]
+                            TBmDif = POLYF(CosInc, Construct(ConstrNum).TransSolBeamCoef, Construct(ConstrNum).TransSolBeamTable); //[-]
                         }
                     } else if (SurfaceWindow(SurfNum).WindowModelType == WindowBSDFModel) {
                         // Need to check what effect, if any, defining these here has
@@ -7036,7 +7601,8 @@ namespace SolarShading {
 
                                 // Shade on or switchable glazing
 
-                                if (SunLitFract > 0.0) TBmAllShBlSc = POLYF(CosInc, Construct(ConstrNumSh).TransSolBeamCoef);
+                                if (SunLitFract > 0.0) TBmAllShBlSc = POLYF(CosInc, Construct(ConstrNumSh).TransSolBeamCoef,
+                                                                            Construct(ConstrNumSh).TransSolBeamTable);
 
                             } else {
 
@@ -7117,7 +7683,8 @@ namespace SolarShading {
                                         // Exterior blind on: beam-beam and diffuse transmittance of exterior beam
 
                                         RhoBlBmDifBk = InterpProfSlatAng(ProfAng, SlatAng, VarSlats, Blind(BlNum).SolBackBeamDiffRefl);
-                                        RGlBmFr = POLYF(CosInc, Construct(ConstrNum).ReflSolBeamFrontCoef);
+                                        RGlBmFr = POLYF(CosInc, Construct(ConstrNum).ReflSolBeamFrontCoef,
+                                                        Construct(ConstrNum).ReflSolBeamFrontTable);
                                         TBmAllShBlSc = TBlBmBm * (TBmBm + TDifBare * RGlBmFr * RhoBlBmDifBk / (1 - RGlDifFr * RhoBlDifDifBk)) +
                                                        TBlBmDif * TDifBare / (1 - RGlDifFr * RhoBlDifDifBk);
 
@@ -7131,7 +7698,8 @@ namespace SolarShading {
 
                                         RScBack = SurfaceScreens(ScNum).ReflectSolBeamFront;
                                         RScDifDifBk = SurfaceScreens(ScNum).DifReflect;
-                                        RGlBmFr = POLYF(CosInc, Construct(ConstrNum).ReflSolBeamFrontCoef);
+                                        RGlBmFr = POLYF(CosInc, Construct(ConstrNum).ReflSolBeamFrontCoef,
+                                                        Construct(ConstrNum).ReflSolBeamFrontTable);
                                         TBmAllShBlSc = TScBmBm * (TBmBm + RGlBmFr * RScBack * TDifBare / (1 - RGlDifFr * RScDifDifBk)) +
                                                        TScBmDif * TDifBare / (1 - RGlDifFr * RScDifDifBk);
 
@@ -8727,6 +9295,9 @@ namespace SolarShading {
         Real64 EqTime;
         // not used INTEGER SurfNum
 
+        SimulationTelemetry::ScopedTimer telemetryTimer(SimulationTelemetry::Subsystem::Shading);
+        EP_TIMER_SCOPE("PerformSolarCalculations");
+
         // Calculate sky diffuse shading
 
         if (BeginSimFlag) {
@@ -10683,7 +11254,8 @@ namespace SolarShading {
                 ConstrNum = Surface(SurfNum).StormWinConstruction;
                 ConstrNumSh = Surface(SurfNum).StormWinShadedConstruction;
             }
-            SolTransGlass = POLYF(CosIncAng(TimeStep, HourOfDay, SurfNum), Construct(ConstrNum).TransSolBeamCoef);
+            SolTransGlass = POLYF(CosIncAng(TimeStep, HourOfDay, SurfNum), Construct(ConstrNum).TransSolBeamCoef,
+                                  Construct(ConstrNum).TransSolBeamTable);
             TanProfileAngVert = SurfaceWindow(SurfNum).TanProfileAngVert;
             TanProfileAngHor = SurfaceWindow(SurfNum).TanProfileAngHor;
             FrameDivNum = Surface(SurfNum).FrameDivider;
@@ -10908,7 +11480,8 @@ namespace SolarShading {
 
                         DiffReflGlass = Construct(ConstrNum).ReflectSolDiffBack;
                         if (ShadeFlag == SwitchableGlazing) {
-                            SolTransGlassSh = POLYF(CosIncAng(TimeStep, HourOfDay, SurfNum), Construct(ConstrNumSh).TransSolBeamCoef);
+                            SolTransGlassSh = POLYF(CosIncAng(TimeStep, HourOfDay, SurfNum), Construct(ConstrNumSh).TransSolBeamCoef,
+                                                    Construct(ConstrNumSh).TransSolBeamTable);
                             SolTransGlass = InterpSw(SurfaceWindow(SurfNum).SwitchingFactor, SolTransGlass, SolTransGlassSh);
                             DiffReflGlassSh = Construct(ConstrNumSh).ReflectSolDiffBack;
                             DiffReflGlass = InterpSw(SurfaceWindow(SurfNum).SwitchingFactor, DiffReflGlass, DiffReflGlassSh);
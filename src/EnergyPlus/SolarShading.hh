@@ -61,6 +61,13 @@
 #include <DataVectorTypes.hh>
 #include <EnergyPlus.hh>
 
+// The shadowing work buffers are thread local in OpenMP builds so that CalcPerSolarBeam can shadow several sun positions at once
+#ifdef _OPENMP
+#define EP_SHADOW_THREAD_LOCAL thread_local
+#else
+#define EP_SHADOW_THREAD_LOCAL
+#endif
+
 namespace EnergyPlus {
 
 namespace SolarShading {
@@ -80,6 +87,7 @@ namespace SolarShading {
     extern Real64 const sqHCMULT;     // Square of HCMult used in Homogeneous coordinates
     extern Real64 const sqHCMULT_fac; // ( 0.5 / sqHCMULT ) factor
     extern Real64 const kHCMULT;      // half of inverse square of HCMult used in Homogeneous coordinates
+    extern int const ShadingCacheVersion; // Layout version of the shading cache files
 
     // Parameters for use with the variable OverlapStatus...
     extern int const NoOverlap;
@@ -102,69 +110,71 @@ namespace SolarShading {
     extern int MAXHCArrayBounds;    // Bounds based on Max Number of Vertices in surfaces
     extern int MAXHCArrayIncrement; // Increment based on Max Number of Vertices in surfaces
     // The following variable should be re-engineered to lower in module hierarchy but need more analysis
-    extern int NVS; // Number of vertices of the shadow/clipped surface
-    extern int NumVertInShadowOrClippedSurface;
-    extern int CurrentSurfaceBeingShadowed;
-    extern int CurrentShadowingSurface;
-    extern int OverlapStatus; // Results of overlap calculation:
+    extern EP_SHADOW_THREAD_LOCAL int NVS; // Number of vertices of the shadow/clipped surface
+    extern EP_SHADOW_THREAD_LOCAL int NumVertInShadowOrClippedSurface;
+    extern EP_SHADOW_THREAD_LOCAL int CurrentSurfaceBeingShadowed;
+    extern EP_SHADOW_THREAD_LOCAL int CurrentShadowingSurface;
+    extern EP_SHADOW_THREAD_LOCAL int OverlapStatus; // Results of overlap calculation:
     // 1=No overlap; 2=NS1 completely within NS2
     // 3=NS2 completely within NS1; 4=Partial overlap
 
-    extern Array1D<Real64> CTHETA;     // Cosine of angle of incidence of sun's rays on surface NS
-    extern int FBKSHC;                 // HC location of first back surface
-    extern int FGSSHC;                 // HC location of first general shadowing surface
-    extern int FINSHC;                 // HC location of first back surface overlap
-    extern int FRVLHC;                 // HC location of first reveal surface
-    extern int FSBSHC;                 // HC location of first subsurface
-    extern int LOCHCA;                 // Location of highest data in the HC arrays
-    extern int NBKSHC;                 // Number of back surfaces in the HC arrays
-    extern int NGSSHC;                 // Number of general shadowing surfaces in the HC arrays
-    extern int NINSHC;                 // Number of back surface overlaps in the HC arrays
-    extern int NRVLHC;                 // Number of reveal surfaces in HC array
-    extern int NSBSHC;                 // Number of subsurfaces in the HC arrays
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> CTHETA;     // Cosine of angle of incidence of sun's rays on surface NS
+    extern EP_SHADOW_THREAD_LOCAL int FBKSHC;                 // HC location of first back surface
+    extern EP_SHADOW_THREAD_LOCAL int FGSSHC;                 // HC location of first general shadowing surface
+    extern EP_SHADOW_THREAD_LOCAL int FINSHC;                 // HC location of first back surface overlap
+    extern EP_SHADOW_THREAD_LOCAL int FRVLHC;                 // HC location of first reveal surface
+    extern EP_SHADOW_THREAD_LOCAL int FSBSHC;                 // HC location of first subsurface
+    extern EP_SHADOW_THREAD_LOCAL int LOCHCA;                 // Location of highest data in the HC arrays
+    extern EP_SHADOW_THREAD_LOCAL int NBKSHC;                 // Number of back surfaces in the HC arrays
+    extern EP_SHADOW_THREAD_LOCAL int NGSSHC;                 // Number of general shadowing surfaces in the HC arrays
+    extern EP_SHADOW_THREAD_LOCAL int NINSHC;                 // Number of back surface overlaps in the HC arrays
+    extern EP_SHADOW_THREAD_LOCAL int NRVLHC;                 // Number of reveal surfaces in HC array
+    extern EP_SHADOW_THREAD_LOCAL int NSBSHC;                 // Number of subsurfaces in the HC arrays
     extern bool CalcSkyDifShading;     // True when sky diffuse solar shading is
     extern int ShadowingCalcFrequency; // Frequency for Shadowing Calculations
     extern int ShadowingDaysLeft;      // Days left in current shadowing period
     extern bool debugging;
     extern std::ofstream shd_stream; // Shading file stream
-    extern Array1D_int HCNS;         // Surface number of back surface HC figures
-    extern Array1D_int HCNV;         // Number of vertices of each HC figure
-    extern Array2D<Int64> HCA;       // 'A' homogeneous coordinates of sides
-    extern Array2D<Int64> HCB;       // 'B' homogeneous coordinates of sides
-    extern Array2D<Int64> HCC;       // 'C' homogeneous coordinates of sides
-    extern Array2D<Int64> HCX;       // 'X' homogeneous coordinates of vertices of figure.
-    extern Array2D<Int64> HCY;       // 'Y' homogeneous coordinates of vertices of figure.
+    extern EP_SHADOW_THREAD_LOCAL Array1D_int HCNS;         // Surface number of back surface HC figures
+    extern EP_SHADOW_THREAD_LOCAL Array1D_int HCNV;         // Number of vertices of each HC figure
+    extern EP_SHADOW_THREAD_LOCAL Array2D<Int64> HCA;       // 'A' homogeneous coordinates of sides
+    extern EP_SHADOW_THREAD_LOCAL Array2D<Int64> HCB;       // 'B' homogeneous coordinates of sides
+    extern EP_SHADOW_THREAD_LOCAL Array2D<Int64> HCC;       // 'C' homogeneous coordinates of sides
+    extern EP_SHADOW_THREAD_LOCAL Array2D<Int64> HCX;       // 'X' homogeneous coordinates of vertices of figure.
+    extern EP_SHADOW_THREAD_LOCAL Array2D<Int64> HCY;       // 'Y' homogeneous coordinates of vertices of figure.
     extern Array3D_int WindowRevealStatus;
-    extern Array1D<Real64> HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
     // - Positive, Shadow - Negative, Overlap between two shadows
     // - positive, etc., so that sum of HC areas=base sunlit area
-    extern Array1D<Real64> HCT;    // Transmittance of each HC figure
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> HCT;    // Transmittance of each HC figure
     extern Array1D<Real64> ISABSF; // For simple interior solar distribution (in which all beam
     // radiation entering zone is assumed to strike the floor),
     // fraction of beam radiation absorbed by each floor surface
-    extern Array1D<Real64> SAREA; // Sunlit area of heat transfer surface HTS
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> SAREA; // Sunlit area of heat transfer surface HTS
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> SurfSunDotMax; // Largest projection of a surface vertex on the direction to the sun
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> SurfSunDotMin; // Smallest projection of a surface vertex on the direction to the sun
     // Excludes multiplier for windows
     // Shadowing combinations data structure...See ShadowingCombinations type
     extern int NumTooManyFigures;
     extern int NumTooManyVertices;
     extern int NumBaseSubSurround;
-    extern Array1D<Real64> SUNCOS;   // Direction cosines of solar position
-    extern Real64 XShadowProjection; // X projection of a shadow (formerly called C)
-    extern Real64 YShadowProjection; // Y projection of a shadow (formerly called S)
-    extern Array1D<Real64> XTEMP;    // Temporary 'X' values for HC vertices of the overlap
-    extern Array1D<Real64> XVC;      // X-vertices of the clipped figure
-    extern Array1D<Real64> XVS;      // X-vertices of the shadow
-    extern Array1D<Real64> YTEMP;    // Temporary 'Y' values for HC vertices of the overlap
-    extern Array1D<Real64> YVC;      // Y-vertices of the clipped figure
-    extern Array1D<Real64> YVS;      // Y-vertices of the shadow
-    extern Array1D<Real64> ZVC;      // Z-vertices of the clipped figure
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> SUNCOS;   // Direction cosines of solar position
+    extern EP_SHADOW_THREAD_LOCAL Real64 XShadowProjection; // X projection of a shadow (formerly called C)
+    extern EP_SHADOW_THREAD_LOCAL Real64 YShadowProjection; // Y projection of a shadow (formerly called S)
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> XTEMP;    // Temporary 'X' values for HC vertices of the overlap
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> XVC;      // X-vertices of the clipped figure
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> XVS;      // X-vertices of the shadow
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> YTEMP;    // Temporary 'Y' values for HC vertices of the overlap
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> YVC;      // Y-vertices of the clipped figure
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> YVS;      // Y-vertices of the shadow
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> ZVC;      // Z-vertices of the clipped figure
     // Used in Sutherland Hodman poly clipping
-    extern Array1D<Real64> ATEMP;  // Temporary 'A' values for HC vertices of the overlap
-    extern Array1D<Real64> BTEMP;  // Temporary 'B' values for HC vertices of the overlap
-    extern Array1D<Real64> CTEMP;  // Temporary 'C' values for HC vertices of the overlap
-    extern Array1D<Real64> XTEMP1; // Temporary 'X' values for HC vertices of the overlap
-    extern Array1D<Real64> YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
-    extern int maxNumberOfFigures;
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> ATEMP;  // Temporary 'A' values for HC vertices of the overlap
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> BTEMP;  // Temporary 'B' values for HC vertices of the overlap
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> CTEMP;  // Temporary 'C' values for HC vertices of the overlap
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> XTEMP1; // Temporary 'X' values for HC vertices of the overlap
+    extern EP_SHADOW_THREAD_LOCAL Array1D<Real64> YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
+    extern EP_SHADOW_THREAD_LOCAL int maxNumberOfFigures;
 
     // SUBROUTINE SPECIFICATIONS FOR MODULE SolarShading
 
@@ -276,6 +286,10 @@ namespace SolarShading {
                int const NS3  // Location to place results of overlap
     );
 
+    bool FigureExtentsOverlap(int const NS1, // Number of the first figure
+                              int const NS2  // Number of the second figure
+    );
+
     void DeterminePolygonOverlap(int const NS1, // Number of the figure being overlapped
                                  int const NS2, // Number of the figure doing overlapping
                                  int const NS3  // Location to place results of overlap
@@ -286,6 +300,17 @@ namespace SolarShading {
                           Real64 const AvgCosSolarDeclin  // Average value of Cosine of Solar Declination for period
     );
 
+    std::string ShadingCacheFileName(Real64 const AvgEqOfTime,       // Average value of Equation of Time for period
+                                     Real64 const AvgSinSolarDeclin, // Average value of Sine of Solar Declination for period
+                                     Real64 const AvgCosSolarDeclin  // Average value of Cosine of Solar Declination for period
+    );
+
+    bool ReadShadingCache(std::string const &FileName);
+
+    void WriteShadingCache(std::string const &FileName);
+
+    void AllocateShadowingThreadBuffers();
+
     void FigureSunCosines(int const iHour,
                           int const iTimeStep,
                           Real64 const EqOfTime,       // value of Equation of Time for period
@@ -315,6 +340,17 @@ namespace SolarShading {
                 int const HTS      // Heat transfer surface number of the general receiving surf
     );
 
+    void SHDGSSPixelCounting(int const NGRS,
+                             int const iHour,           // Hour Counter
+                             int const TS,              // TimeStep
+                             int const CurSurf,         // Current Surface
+                             int const NGSS,            // Number of general shadowing surfaces
+                             int const HTS,             // Heat transfer surface number of the general receiving surf
+                             int const NVR,             // Number of vertices of the receiving surface
+                             Array1<Real64> const &XVR, // X vertices of the receiving surface in its own plane
+                             Array1<Real64> const &YVR  // Y vertices of the receiving surface in its own plane
+    );
+
     void CalcInteriorSolarOverlaps(int const iHour, // Hour Index
                                    int const NBKS,  // Number of back surfaces associated with this GRSNR (in general, only
                                    int const HTSS,  // Surface number of the subsurface (exterior window)
@@ -0,0 +1,415 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus Headers
+#include <AirflowNetwork/Elements.hpp>
+#include <AirflowNetworkBalanceManager.hh>
+#include <BaseboardElectric.hh>
+#include <BaseboardRadiator.hh>
+#include <Boilers.hh>
+#include <BoilerSteam.hh>
+#include <BranchInputManager.hh>
+#include <BranchNodeConnections.hh>
+#include <ChilledCeilingPanelSimple.hh>
+#include <ChillerElectricEIR.hh>
+#include <ChillerExhaustAbsorption.hh>
+#include <ChillerGasAbsorption.hh>
+#include <ChillerIndirectAbsorption.hh>
+#include <CondenserLoopTowers.hh>
+#include <ConvectionCoefficients.hh>
+#include <CoolTower.hh>
+#include <CrossVentMgr.hh>
+#include <CurveManager.hh>
+#include <DataAirLoop.hh>
+#include <DataAirSystems.hh>
+#include <DataBranchAirLoopPlant.hh>
+#include <DataBranchNodeConnections.hh>
+#include <DataContaminantBalance.hh>
+#include <DataConvergParams.hh>
+#include <DataDefineEquip.hh>
+#include <DataEnvironment.hh>
+#include <DataErrorTracking.hh>
+#include <DataGenerators.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalance.hh>
+#include <DataHeatBalFanSys.hh>
+#include <DataHeatBalSurface.hh>
+#include <DataHVACGlobals.hh>
+#include <DataIPShortCuts.hh>
+#include <DataLoopNode.hh>
+#include <DataMoistureBalance.hh>
+#include <DataMoistureBalanceEMPD.hh>
+#include <DataOutputs.hh>
+#include <DataPlant.hh>
+#include <DataRoomAirModel.hh>
+#include <DataRuntimeLanguage.hh>
+#include <DataSizing.hh>
+#include <DataStringGlobals.hh>
+#include <DataSurfaceLists.hh>
+#include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
+#include <DataTimings.hh>
+#include <DataUCSDSharedData.hh>
+#include <DataZoneControls.hh>
+#include <DataZoneEnergyDemands.hh>
+#include <DataZoneEquipment.hh>
+#include <DaylightingManager.hh>
+#include <DElightManagerF.hh>
+#include <DemandManager.hh>
+#include <DesiccantDehumidifiers.hh>
+#include <DirectAirManager.hh>
+#include <DisplayRoutines.hh>
+#include <DualDuct.hh>
+#include <DXCoils.hh>
+#include <EarthTube.hh>
+#include <EconomicLifeCycleCost.hh>
+#include <EconomicTariff.hh>
+#include <ElectricPowerServiceManager.hh>
+#include <EMSManager.hh>
+#include <EvaporativeCoolers.hh>
+#include <EvaporativeFluidCoolers.hh>
+#include <ExteriorEnergyUse.hh>
+#include <FanCoilUnits.hh>
+#include <Fans.hh>
+#include <FaultsManager.hh>
+#include <FileSystem.hh>
+#include <FluidCoolers.hh>
+#include <FluidProperties.hh>
+#include <Furnaces.hh>
+#include <GlobalNames.hh>
+#include <GroundHeatExchangers.hh>
+#include <GroundTemperatureModeling/GroundTemperatureModelManager.hh>
+#include <HeatBalanceAirManager.hh>
+#include <HeatBalanceIntRadExchange.hh>
+#include <HeatBalanceManager.hh>
+#include <HeatBalanceSurfaceManager.hh>
+#include <HeatBalFiniteDiffManager.hh>
+#include <HeatingCoils.hh>
+#include <HeatPumpWaterToWaterCOOLING.hh>
+#include <HeatPumpWaterToWaterHEATING.hh>
+#include <HeatPumpWaterToWaterSimple.hh>
+#include <HeatRecovery.hh>
+#include <HighTempRadiantSystem.hh>
+#include <Humidifiers.hh>
+#include <HVACControllers.hh>
+#include <HVACDXHeatPumpSystem.hh>
+#include <HVACDXSystem.hh>
+#include <HVACFan.hh>
+#include <HVACHXAssistedCoolingCoil.hh>
+#include <HVACManager.hh>
+#include <HVACSingleDuctInduc.hh>
+#include <HVACStandAloneERV.hh>
+#include <HVACUnitaryBypassVAV.hh>
+#include <HVACVariableRefrigerantFlow.hh>
+#include <HybridModel.hh>
+#include <IceThermalStorage.hh>
+#include <InputProcessing/IdfParser.hh>
+#include <InputProcessing/InputProcessor.hh>
+#include <InputProcessing/InputValidation.hh>
+#include <IntegratedHeatPump.hh>
+#include <InternalHeatGains.hh>
+#include <LowTempRadiantSystem.hh>
+#include <MixedAir.hh>
+#include <MixerComponent.hh>
+#include <MoistureBalanceEMPDManager.hh>
+#include <NodeInputManager.hh>
+#include <OutAirNodeManager.hh>
+#include <OutdoorAirUnit.hh>
+#include <OutputProcessor.hh>
+#include <OutputReportPredefined.hh>
+#include <OutputReportTabular.hh>
+#include <OutputReportTabularAnnual.hh>
+#include <OutsideEnergySources.hh>
+#include <PackagedTerminalHeatPump.hh>
+#include <PhaseChangeModeling/HysteresisModel.hh>
+#include <PipeHeatTransfer.hh>
+#include <Pipes.hh>
+#include <Plant/PlantLoopSolver.hh>
+#include <Plant/PlantManager.hh>
+#include <PlantCentralGSHP.hh>
+#include <PlantChillers.hh>
+#include <PlantCondLoopOperation.hh>
+#include <PlantLoadProfile.hh>
+#include <PlantPipingSystemsManager.hh>
+#include <PlantPressureSystem.hh>
+#include <PlantUtilities.hh>
+#include <PlantValves.hh>
+#include <PollutionModule.hh>
+#include <PoweredInductionUnits.hh>
+#include <Psychrometrics.hh>
+#include <Pumps.hh>
+#include <PurchasedAirManager.hh>
+#include <PVWatts.hh>
+#include <ReportCoilSelection.hh>
+#include <ResultsSchema.hh>
+#include <ReturnAirPathManager.hh>
+#include <RoomAirModelAirflowNetwork.hh>
+#include <RoomAirModelManager.hh>
+#include <RuntimeExchange.hh>
+#include <RuntimeLanguageProcessor.hh>
+#include <ScheduleManager.hh>
+#include <SetPointManager.hh>
+#include <SimAirServingZones.hh>
+#include <SimulationManager.hh>
+#include <SimulationTelemetry.hh>
+#include <SingleDuct.hh>
+#include <SizingManager.hh>
+#include <SolarCollectors.hh>
+#include <SolarShading.hh>
+#include <SortAndStringUtilities.hh>
+#include <SplitterComponent.hh>
+#include <StateManagement.hh>
+#include <SteamCoils.hh>
+#include <SurfaceGeometry.hh>
+#include <SwimmingPool.hh>
+#include <SystemAvailabilityManager.hh>
+#include <ThermalComfort.hh>
+#include <UnitarySystem.hh>
+#include <UnitHeater.hh>
+#include <UnitVentilator.hh>
+#include <VariableSpeedCoils.hh>
+#include <VentilatedSlab.hh>
+#include <WaterCoils.hh>
+#include <WaterThermalTanks.hh>
+#include <WaterToAirHeatPumpSimple.hh>
+#include <WaterToWaterHeatPumpEIR.hh>
+#include <WaterUse.hh>
+#include <WeatherManager.hh>
+#include <WindowAC.hh>
+#include <WindowComplexManager.hh>
+#include <WindowEquivalentLayer.hh>
+#include <WindowManager.hh>
+#include <ZoneAirLoopEquipmentManager.hh>
+#include <ZoneContaminantPredictorCorrector.hh>
+#include <ZoneDehumidifier.hh>
+#include <ZoneEquipmentManager.hh>
+#include <ZonePlenum.hh>
+#include <ZoneTempPredictorCorrector.hh>
+
+namespace EnergyPlus {
+
+void clearAllStates()
+{
+    // A to Z order
+    AirflowNetworkBalanceManager::clear_state();
+    BaseboardElectric::clear_state();
+    BaseboardRadiator::clear_state();
+    Boilers::clear_state();
+    BoilerSteam::clear_state();
+    BranchInputManager::clear_state();
+    CoolingPanelSimple::clear_state();
+    ChillerElectricEIR::clear_state();
+    ChillerExhaustAbsorption::clear_state();
+    ChillerGasAbsorption::clear_state();
+    ChillerIndirectAbsorption::clear_state();
+    CondenserLoopTowers::clear_state();
+    ConvectionCoefficients::clear_state();
+    CoolTower::clear_state();
+    CrossVentMgr::clear_state();
+    CurveManager::clear_state();
+    AirflowNetwork::clear_state();
+    DataAirLoop::clear_state();
+    DataBranchAirLoopPlant::clear_state();
+    DataAirSystems::clear_state();
+    DataBranchNodeConnections::clear_state();
+    DataContaminantBalance::clear_state();
+    DataConvergParams::clear_state();
+    DataDefineEquip::clear_state();
+    DataEnvironment::clear_state();
+    DataErrorTracking::clear_state();
+    DataGenerators::clear_state();
+    DataGlobals::clear_state();
+    DataHeatBalance::clear_state();
+    DataHeatBalFanSys::clear_state();
+    DataHeatBalSurface::clear_state();
+    DataHVACGlobals::clear_state();
+    DataIPShortCuts::clear_state();
+    DataLoopNode::clear_state();
+    DataMoistureBalance::clear_state();
+    DataMoistureBalanceEMPD::clear_state();
+    DataOutputs::clear_state();
+    DataPlant::clear_state();
+    DataRoomAirModel::clear_state();
+    DataRuntimeLanguage::clear_state();
+    DataSizing::clear_state();
+    DataStringGlobals::clear_state();
+    DataSurfaceLists::clear_state();
+    DataSurfaces::clear_state();
+    DataSystemVariables::clear_state();
+    DataTimings::clear_state();
+    DataUCSDSharedData::clear_state();
+    DataZoneControls::clear_state();
+    DataZoneEnergyDemands::clear_state();
+    DataZoneEquipment::clear_state();
+    DaylightingManager::clear_state();
+    DemandManager::clear_state();
+    DesiccantDehumidifiers::clear_state();
+    DirectAirManager::clear_state();
+    DualDuct::clear_state();
+    DXCoils::clear_state();
+    clearFacilityElectricPowerServiceObject();
+    EarthTube::clear_state();
+    EconomicLifeCycleCost::clear_state();
+    EconomicTariff::clear_state();
+    EMSManager::clear_state();
+    EvaporativeCoolers::clear_state();
+    EvaporativeFluidCoolers::clear_state();
+    ExteriorEnergyUse::clear_state();
+    FanCoilUnits::clear_state();
+    Fans::clear_state();
+    FaultsManager::clear_state();
+    FluidCoolers::clear_state();
+    FluidProperties::clear_state();
+    Furnaces::clear_state();
+    GlobalNames::clear_state();
+    GroundHeatExchangers::clear_state();
+    GroundTemperatureManager::clear_state();
+    HeatBalanceAirManager::clear_state();
+    HeatBalanceIntRadExchange::clear_state();
+    HeatBalanceManager::clear_state();
+    HeatBalanceSurfaceManager::clear_state();
+    HeatBalFiniteDiffManager::clear_state();
+    HeatPumpWaterToWaterSimple::GshpSpecs::clear_state();
+    HeatPumpWaterToWaterCOOLING::clear_state();
+    HeatPumpWaterToWaterHEATING::clear_state();
+    HeatRecovery::clear_state();
+    HeatingCoils::clear_state();
+    HighTempRadiantSystem::clear_state();
+    Humidifiers::clear_state();
+    HVACControllers::clear_state();
+    HVACDXHeatPumpSystem::clear_state();
+    HVACDXSystem::clear_state();
+    HVACHXAssistedCoolingCoil::clear_state();
+    HVACFan::clearHVACFanObjects();
+    HVACManager::clear_state();
+    HVACSingleDuctInduc::clear_state();
+    HVACStandAloneERV::clear_state();
+    HVACUnitaryBypassVAV::clear_state();
+    HVACVariableRefrigerantFlow::clear_state();
+    HybridModel::clear_state();
+    HysteresisPhaseChange::clear_state();
+    IceThermalStorage::clear_state();
+    if (inputProcessor) inputProcessor->clear_state();
+    IntegratedHeatPump::clear_state();
+    InternalHeatGains::clear_state();
+    LowTempRadiantSystem::clear_state();
+    MixedAir::clear_state();
+    MixerComponent::clear_state();
+    MoistureBalanceEMPDManager::clear_state();
+    NodeInputManager::clear_state();
+    OutAirNodeManager::clear_state();
+    OutdoorAirUnit::clear_state();
+    OutputProcessor::clear_state();
+    OutputReportPredefined::clear_state();
+    OutputReportTabular::clear_state();
+    OutputReportTabularAnnual::clear_state();
+    OutsideEnergySources::clear_state();
+    PackagedTerminalHeatPump::clear_state();
+    Pipes::clear_state();
+    PipeHeatTransfer::clear_state();
+    PlantCentralGSHP::clear_state();
+    PlantChillers::clear_state();
+    PlantCondLoopOperation::clear_state();
+    PlantLoadProfile::clear_state();
+    PlantLoopSolver::clear_state();
+    PlantManager::clear_state();
+    PlantPipingSystemsManager::clear_state();
+    PlantPressureSystem::clear_state();
+    PlantUtilities::clear_state();
+    PlantValves::clear_state();
+    PollutionModule::clear_state();
+    PoweredInductionUnits::clear_state();
+    Psychrometrics::clear_state();
+    Pumps::clear_state();
+    PurchasedAirManager::clear_state();
+    PVWatts::clear_state();
+    clearCoilSelectionReportObj(); // ReportCoilSelection
+    ReturnAirPathManager::clear_state();
+    RoomAirModelAirflowNetwork::clear_state();
+    RoomAirModelManager::clear_state();
+    RuntimeExchange::clear_state();
+    RuntimeLanguageProcessor::clear_state();
+    ScheduleManager::clear_state();
+    SetPointManager::clear_state();
+    SimAirServingZones::clear_state();
+    SimulationManager::clear_state();
+    SimulationTelemetry::clear_state();
+    SingleDuct::clear_state();
+    SizingManager::clear_state();
+    SolarCollectors::clear_state();
+    SolarShading::clear_state();
+    SplitterComponent::clear_state();
+    SteamCoils::clear_state();
+    SurfaceGeometry::clear_state();
+    SystemAvailabilityManager::clear_state();
+    SwimmingPool::clear_state();
+    ThermalComfort::clear_state();
+    UnitarySystems::clear_state();
+    UnitHeater::clear_state();
+    UnitVentilator::clear_state();
+    VariableSpeedCoils::clear_state();
+    VentilatedSlab::clear_state();
+    WaterCoils::clear_state();
+    WaterThermalTanks::clear_state();
+    WaterToAirHeatPumpSimple::clear_state();
+    EIRWaterToWaterHeatPumps::EIRWaterToWaterHeatPump::clear_state();
+    WaterUse::clear_state();
+    WeatherManager::clear_state();
+    WindowAC::clear_state();
+    WindowComplexManager::clear_state();
+    WindowEquivalentLayer::clear_state();
+    WindowManager::clear_state();
+    ZoneAirLoopEquipmentManager::clear_state();
+    ZoneContaminantPredictorCorrector::clear_state();
+    ZoneDehumidifier::clear_state();
+    ZoneEquipmentManager::clear_state();
+    ZonePlenum::clear_state();
+    ZoneTempPredictorCorrector::clear_state();
+    ResultsFramework::clear_state();
+}
+
+} // namespace EnergyPlus
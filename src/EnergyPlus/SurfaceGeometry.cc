@@ -52,6 +52,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Fmath.hh>
@@ -1251,7 +1252,13 @@ namespace SurfaceGeometry {
         //**********************************************************************************
         // After all of the surfaces have been defined then the base surfaces for the
         // sub-surfaces can be defined.  Loop through surfaces and match with the sub-surface
-        // names.
+        // names.  The name index keeps the lookup linear in the number of surfaces
+        // (first occurrence wins, as with FindItemInList).
+        std::unordered_map<std::string, int> SurfaceTmpIndex;
+        SurfaceTmpIndex.reserve(TotSurfaces);
+        for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+            SurfaceTmpIndex.emplace(SurfaceTmp(SurfNum).Name, SurfNum);
+        }
         for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
             if (!SurfaceTmp(SurfNum).HeatTransSurf) continue;
 
@@ -1259,7 +1266,8 @@ namespace SurfaceGeometry {
             if (UtilityRoutines::SameString(SurfaceTmp(SurfNum).BaseSurfName, SurfaceTmp(SurfNum).Name)) {
                 Found = SurfNum;
             } else {
-                Found = UtilityRoutines::FindItemInList(SurfaceTmp(SurfNum).BaseSurfName, SurfaceTmp, TotSurfaces);
+                auto const foundIt = SurfaceTmpIndex.find(SurfaceTmp(SurfNum).BaseSurfName);
+                Found = (foundIt != SurfaceTmpIndex.end()) ? foundIt->second : 0;
             }
             if (Found > 0) {
                 SurfaceTmp(SurfNum).BaseSurf = Found;
@@ -1311,15 +1319,32 @@ namespace SurfaceGeometry {
             SurfaceTmp(SurfNum).Class = SurfaceClass_Moved; //'Moved'
         }
 
+        //  Group the surfaces by (upper case) zone name and the sub-surfaces by base surface once, in input order,
+        //  so the reordering below does not scan all surfaces for every zone and every base surface.
+
+        std::unordered_map<std::string, std::vector<int>> SurfacesInZoneName;
+        std::vector<std::vector<int>> SubSurfacesOfBase(TotSurfaces + 1);
+        for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+            SurfacesInZoneName[UtilityRoutines::MakeUPPERCase(SurfaceTmp(SurfNum).ZoneName)].push_back(SurfNum);
+            if (SurfaceTmp(SurfNum).Zone == 0) continue;
+            if (SurfaceTmp(SurfNum).BaseSurf >= 1 && SurfaceTmp(SurfNum).BaseSurf <= TotSurfaces) {
+                SubSurfacesOfBase[SurfaceTmp(SurfNum).BaseSurf].push_back(SurfNum);
+            }
+        }
+        std::vector<int> const NoSurfaces;
+
         //  For each zone
 
         for (ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum) {
 
+            auto const zoneSurfacesIt = SurfacesInZoneName.find(UtilityRoutines::MakeUPPERCase(Zone(ZoneNum).Name));
+            std::vector<int> const &ZoneSurfaces = (zoneSurfacesIt != SurfacesInZoneName.end()) ? zoneSurfacesIt->second : NoSurfaces;
+
             //  For each Base Surface Type (Wall, Floor, Roof)
 
             for (Loop = 1; Loop <= 3; ++Loop) {
 
-                for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+                for (int const SurfNum : ZoneSurfaces) {
 
                     if (SurfaceTmp(SurfNum).Zone == 0) continue;
 
@@ -1334,7 +1359,7 @@ namespace SurfaceGeometry {
                     Surface(MovedSurfs).BaseSurf = BaseSurfNum;
 
                     //  Find all subsurfaces to this surface
-                    for (SubSurfNum = 1; SubSurfNum <= TotSurfaces; ++SubSurfNum) {
+                    for (int const SubSurfNum : SubSurfacesOfBase[SurfNum]) {
 
                         if (SurfaceTmp(SubSurfNum).Zone == 0) continue;
                         if (SurfaceTmp(SubSurfNum).BaseSurf != SurfNum) continue;
@@ -1348,7 +1373,7 @@ namespace SurfaceGeometry {
                 }
             }
 
-            for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+            for (int const SurfNum : ZoneSurfaces) {
 
                 if (SurfaceTmp(SurfNum).ZoneName != Zone(ZoneNum).Name) continue;
                 if (SurfaceTmp(SurfNum).Class != SurfaceClass_IntMass) continue;
@@ -1382,6 +1407,16 @@ namespace SurfaceGeometry {
 
         //  For each Base Surface Type (Wall, Floor, Roof)
 
+        for (auto &subSurfaces : SubSurfacesOfBase) {
+            subSurfaces.clear();
+        }
+        for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+            if (Surface(SurfNum).Zone == 0) continue;
+            if (Surface(SurfNum).BaseSurf >= 1 && Surface(SurfNum).BaseSurf <= TotSurfaces) {
+                SubSurfacesOfBase[Surface(SurfNum).BaseSurf].push_back(SurfNum);
+            }
+        }
+
         for (Loop = 1; Loop <= 3; ++Loop) {
 
             for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
@@ -1391,7 +1426,7 @@ namespace SurfaceGeometry {
                 if (Surface(SurfNum).Class != BaseSurfIDs(Loop)) continue;
 
                 //  Find all subsurfaces to this surface
-                for (SubSurfNum = 1; SubSurfNum <= TotSurfaces; ++SubSurfNum) {
+                for (int const SubSurfNum : SubSurfacesOfBase[SurfNum]) {
 
                     if (SurfNum == SubSurfNum) continue;
                     if (Surface(SubSurfNum).Zone == 0) continue;
@@ -1408,6 +1443,11 @@ namespace SurfaceGeometry {
         // Now, match up interzone surfaces
         NonMatch = false;
         izConstDiffMsg = false;
+        std::unordered_map<std::string, int> SurfaceIndex;
+        SurfaceIndex.reserve(MovedSurfs);
+        for (SurfNum = 1; SurfNum <= MovedSurfs; ++SurfNum) {
+            SurfaceIndex.emplace(Surface(SurfNum).Name, SurfNum);
+        }
         for (SurfNum = 1; SurfNum <= MovedSurfs; ++SurfNum) { // TotSurfaces
             //  Clean up Shading Surfaces, make sure they don't go through here.
             //  Shading surfaces have "Zone=0", should also have "BaseSurf=0"
@@ -1426,7 +1466,8 @@ namespace SurfaceGeometry {
                     if (Surface(SurfNum).ExtBoundCondName == Surface(SurfNum).Name) {
                         Found = SurfNum;
                     } else {
-                        Found = UtilityRoutines::FindItemInList(Surface(SurfNum).ExtBoundCondName, Surface, MovedSurfs);
+                        auto const foundIt = SurfaceIndex.find(Surface(SurfNum).ExtBoundCondName);
+                        Found = (foundIt != SurfaceIndex.end()) ? foundIt->second : 0;
                     }
                     if (Found != 0) {
                         Surface(SurfNum).ExtBoundCond = Found;
@@ -5988,6 +6029,7 @@ namespace SurfaceGeometry {
 
         ExtVentedCavity.allocate(TotExtVentCav);
 
+        std::unordered_set<std::string> ExtVentedCavityNames;
         for (Item = 1; Item <= TotExtVentCav; ++Item) {
             inputProcessor->getObjectItem(cCurrentModuleObject,
                                           Item,
@@ -6004,7 +6046,7 @@ namespace SurfaceGeometry {
             ErrorInName = false;
             IsBlank = false;
 
-            UtilityRoutines::VerifyName(cAlphaArgs(1), ExtVentedCavity, Item - 1, ErrorInName, IsBlank, cCurrentModuleObject + " Name");
+            GlobalNames::VerifyUniqueName(ExtVentedCavityNames, cAlphaArgs(1), ErrorInName, IsBlank, cCurrentModuleObject + " Name");
             if (ErrorInName) {
                 ShowContinueError("...cannot not duplicate other names");
                 ErrorsFound = true;
@@ -7915,6 +7957,7 @@ namespace SurfaceGeometry {
         WindowShadingControl.allocate(TotWinShadingControl);
 
         ControlNum = 0;
+        std::unordered_set<std::string> WindowShadingControlNames;
         for (Loop = 1; Loop <= TotWinShadingControl; ++Loop) {
 
             inputProcessor->getObjectItem(cCurrentModuleObject,
@@ -7931,7 +7974,7 @@ namespace SurfaceGeometry {
 
             ErrorInName = false;
             IsBlank = false;
-            UtilityRoutines::VerifyName(cAlphaArgs(1), WindowShadingControl, ControlNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name");
+            GlobalNames::VerifyUniqueName(WindowShadingControlNames, cAlphaArgs(1), ErrorInName, IsBlank, cCurrentModuleObject + " Name");
             if (ErrorInName) {
                 ErrorsFound = true;
                 continue;
@@ -9367,6 +9410,7 @@ namespace SurfaceGeometry {
         OSC.allocate(TotOSC);
 
         OSCNum = 0;
+        std::unordered_set<std::string> OSCNames;
         for (Loop = 1; Loop <= TotOSC; ++Loop) {
             inputProcessor->getObjectItem(cCurrentModuleObject,
                                           Loop,
@@ -9381,7 +9425,7 @@ namespace SurfaceGeometry {
                                           cNumericFieldNames);
             ErrorInName = false;
             IsBlank = false;
-            UtilityRoutines::VerifyName(cAlphaArgs(1), OSC, OSCNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name");
+            GlobalNames::VerifyUniqueName(OSCNames, cAlphaArgs(1), ErrorInName, IsBlank, cCurrentModuleObject + " Name");
             if (ErrorInName) {
                 ErrorsFound = true;
                 continue;
@@ -9535,11 +9579,12 @@ namespace SurfaceGeometry {
         // OSCM is already initialized in derived type defn.
 
         OSCMNum = 0;
+        std::unordered_set<std::string> OSCMNames;
         for (Loop = 1; Loop <= TotOSCM; ++Loop) {
             inputProcessor->getObjectItem(cCurrentModuleObject, Loop, cAlphaArgs, NumAlphas, rNumericArgs, NumProps, IOStat);
             ErrorInName = false;
             IsBlank = false;
-            UtilityRoutines::VerifyName(cAlphaArgs(1), OSCM, OSCMNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name");
+            GlobalNames::VerifyUniqueName(OSCMNames, cAlphaArgs(1), ErrorInName, IsBlank, cCurrentModuleObject + " Name");
             if (ErrorInName) {
                 ErrorsFound = true;
                 continue;
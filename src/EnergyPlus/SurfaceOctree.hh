@@ -579,6 +579,35 @@ public: // Methods
         return processSomeSurfaceRayIntersectsCube(a, dir, safe_inverse(dir), predicate); // Inefficient if called in loop with same dir
     }
 
+    // Process Surfaces in Cube that Any Unfinished Ray of a Packet from a Common Origin Intersects Stopping if Predicate Satisfied
+    template <typename Predicate>
+    bool processSomeSurfaceRayPacketIntersectsCube(Vertex const &a,
+                                                   std::vector<Vertex> const &dirs,
+                                                   std::vector<Vertex> const &dirs_inv,
+                                                   std::vector<std::uint8_t> const &done,
+                                                   Predicate const &predicate) const
+    {
+        assert(dirs.size() == dirs_inv.size());
+        assert(dirs.size() == done.size());
+        bool intersects(false);
+        for (std::vector<Vertex>::size_type i = 0, e = dirs.size(); i < e; ++i) {
+            if ((!done[i]) && rayIntersectsCube(a, dirs[i], dirs_inv[i])) {
+                intersects = true;
+                break;
+            }
+        }
+        if (intersects) {
+            for (auto const *surface_p : surfaces_) {   // Process this cube's surfaces
+                if (predicate(*surface_p)) return true; // Don't need to process more surfaces
+            }
+            for (std::uint8_t i = 0; i < n_; ++i) { // Recurse
+                if (cubes_[i]->processSomeSurfaceRayPacketIntersectsCube(a, dirs, dirs_inv, done, predicate))
+                    return true; // Don't need to process more surfaces
+            }
+        }
+        return false;
+    }
+
 public: // Static Methods
     // Octree-Safe Vector Inverse
     static Vertex safe_inverse(Vertex const &v)
@@ -2534,9 +2534,9 @@ namespace SystemAvailabilityManager {
         NCycSysAvailMgrData(SysAvailNum).PriorAvailStatus = AvailStatus;
     }
 
-    bool CoolingZoneOutOfTolerance(Array1D_int const ZonePtrList, // list of controlled zone pointers
-                                   int const NumZones,            // number of zones in list
-                                   Real64 const TempTolerance     // temperature tolerance
+    bool CoolingZoneOutOfTolerance(Array1D_int const &ZonePtrList, // list of controlled zone pointers
+                                   int const NumZones,             // number of zones in list
+                                   Real64 const TempTolerance      // temperature tolerance
     )
     {
         // Check if any zone temperature is above the cooling setpoint plus tolerance
@@ -2559,9 +2559,9 @@ namespace SystemAvailabilityManager {
         return false;
     }
 
-    bool HeatingZoneOutOfTolerance(Array1D_int const ZonePtrList, // list of controlled zone pointers
-                                   int const NumZones,            // number of zones in list
-                                   Real64 const TempTolerance     // temperature tolerance
+    bool HeatingZoneOutOfTolerance(Array1D_int const &ZonePtrList, // list of controlled zone pointers
+                                   int const NumZones,             // number of zones in list
+                                   Real64 const TempTolerance      // temperature tolerance
     )
     {
         // Check if any zone temperature is below the heating setpoint less tolerance
@@ -507,14 +507,14 @@ namespace SystemAvailabilityManager {
                              Optional_int_const CompNum = _        // Index of ZoneHVAC equipment component
     );
 
-    bool CoolingZoneOutOfTolerance(Array1D_int const ZonePtrList, // list of controlled zone pointers
-                                   int const NumZones,            // number of zones in list
-                                   Real64 const TempTolerance     // temperature tolerance
+    bool CoolingZoneOutOfTolerance(Array1D_int const &ZonePtrList, // list of controlled zone pointers
+                                   int const NumZones,             // number of zones in list
+                                   Real64 const TempTolerance      // temperature tolerance
     );
 
-    bool HeatingZoneOutOfTolerance(Array1D_int const ZonePtrList, // list of controlled zone pointers
-                                   int const NumZones,            // number of zones in list
-                                   Real64 const TempTolerance     // temperature tolerance
+    bool HeatingZoneOutOfTolerance(Array1D_int const &ZonePtrList, // list of controlled zone pointers
+                                   int const NumZones,             // number of zones in list
+                                   Real64 const TempTolerance      // temperature tolerance
     );
 
     void CalcOptStartSysAvailMgr(int const SysAvailNum,                // number of the current scheduled system availability manager
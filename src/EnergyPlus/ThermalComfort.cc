@@ -669,6 +669,7 @@ namespace ThermalComfort {
         //                    Brent Griffith modifications for CR 5641 (October 2005)
         //                    L. Gu, Added optional arguments for thermal comfort control (May 2006)
         //                    T. Hong, added Fanger PPD (April 2009)
+        //                    October 2026, only visit the requested people object for thermal comfort control
 
         // PURPOSE OF THIS SUBROUTINE:
         // This subroutine calculates PMV(Predicted Mean Vote) using the Fanger thermal
@@ -703,12 +704,12 @@ namespace ThermalComfort {
         Real64 PMV; // temporary variable to store calculated Fanger PMV value
         Real64 PPD; // temporary variable to store calculated Fanger PPD value
 
-        for (PeopleNum = 1; PeopleNum <= TotPeople; ++PeopleNum) {
+        // Optional argument is used to access people object when thermal comfort control is used,
+        // only that object is visited (this is called repeatedly while solving for the setpoint)
+        int const FirstPeopleNum(present(PNum) ? int(PNum) : 1);
+        int const LastPeopleNum(present(PNum) ? int(PNum) : TotPeople);
 
-            // Optional argument is used to access people object when thermal comfort control is used
-            if (present(PNum)) {
-                if (PeopleNum != PNum) continue;
-            }
+        for (PeopleNum = FirstPeopleNum; PeopleNum <= LastPeopleNum; ++PeopleNum) {
 
             // If optional argument is used do not cycle regardless of thermal comfort reporting type
             if ((!People(PeopleNum).Fanger) && (!present(PNum))) continue;
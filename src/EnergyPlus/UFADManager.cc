@@ -51,7 +51,6 @@
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Fmath.hh>
-#include <ObjexxFCL/member.functions.hh>
 
 // EnergyPlus Headers
 #include <ConvectionCoefficients.hh>
@@ -687,7 +686,7 @@ namespace UFADManager {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         G. Carrilho da Graca
         //       DATE WRITTEN   February 2004
-        //       MODIFIED       -
+        //       MODIFIED       October 2026, use the surface heights stored at initialization
         //       RE-ENGINEERED  -
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -736,8 +735,8 @@ namespace UFADManager {
                 SurfNum = APos_Wall(Ctd);
                 Surface(SurfNum).TAirRef = AdjacentAirTemp;
                 if (SurfNum == 0) continue;
-                Z1 = minval(Surface(SurfNum).Vertex({1, Surface(SurfNum).Sides}), &Vector::z);
-                Z2 = maxval(Surface(SurfNum).Vertex({1, Surface(SurfNum).Sides}), &Vector::z);
+                Z1 = SurfMinZ(SurfNum);
+                Z2 = SurfMaxZ(SurfNum);
                 ZSupSurf = Z2 - ZoneCeilingHeight((ZoneNum - 1) * 2 + 1);
                 ZInfSurf = Z1 - ZoneCeilingHeight((ZoneNum - 1) * 2 + 1);
 
@@ -794,8 +793,8 @@ namespace UFADManager {
                 Surface(SurfNum).TAirRef = AdjacentAirTemp;
                 if (SurfNum == 0) continue;
                 if (Surface(SurfNum).Tilt > 10.0 && Surface(SurfNum).Tilt < 170.0) { // Window Wall
-                    Z1 = minval(Surface(SurfNum).Vertex({1, Surface(SurfNum).Sides}), &Vector::z);
-                    Z2 = maxval(Surface(SurfNum).Vertex({1, Surface(SurfNum).Sides}), &Vector::z);
+                    Z1 = SurfMinZ(SurfNum);
+                    Z2 = SurfMaxZ(SurfNum);
                     ZSupSurf = Z2 - ZoneCeilingHeight((ZoneNum - 1) * 2 + 1);
                     ZInfSurf = Z1 - ZoneCeilingHeight((ZoneNum - 1) * 2 + 1);
 
@@ -865,8 +864,8 @@ namespace UFADManager {
                 SurfNum = APos_Door(Ctd);
                 Surface(SurfNum).TAirRef = AdjacentAirTemp;
                 if (SurfNum == 0) continue;
-                Z1 = minval(Surface(SurfNum).Vertex({1, Surface(SurfNum).Sides}), &Vector::z);
-                Z2 = maxval(Surface(SurfNum).Vertex({1, Surface(SurfNum).Sides}), &Vector::z);
+                Z1 = SurfMinZ(SurfNum);
+                Z2 = SurfMaxZ(SurfNum);
                 ZSupSurf = Z2 - ZoneCeilingHeight((ZoneNum - 1) * 2 + 1);
                 ZInfSurf = Z1 - ZoneCeilingHeight((ZoneNum - 1) * 2 + 1);
 
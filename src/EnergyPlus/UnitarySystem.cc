@@ -58,6 +58,7 @@
 #include <DataHeatBalance.hh>
 #include <DataPlant.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneControls.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
@@ -10607,7 +10608,9 @@ namespace UnitarySystems {
                             Par[1] = double(this->m_CoolingCoilIndex);
                             Par[2] = DesOutTemp;
                             Par[5] = double(FanOpMode);
-                            General::SolveRoot(Acc, MaxIte, SolFla, PartLoadFrac, this->DOE2DXCoilResidual, 0.0, 1.0, Par);
+                            if (!DataSystemVariables::UnitaryDirectPLR || !this->DOE2DXCoilDirectPLR(Acc, Par, false, PartLoadFrac)) {
+                                General::SolveRoot(Acc, MaxIte, SolFla, PartLoadFrac, this->DOE2DXCoilResidual, 0.0, 1.0, Par);
+                            }
                             this->m_CompPartLoadRatio = PartLoadFrac;
 
                         } else if ((CoilType_Num == DataHVACGlobals::CoilDX_CoolingHXAssisted) ||
@@ -11001,7 +11004,10 @@ namespace UnitarySystems {
                             Par[1] = double(this->m_CoolingCoilIndex);
                             Par[2] = DesOutHumRat;
                             Par[5] = double(FanOpMode);
-                            General::SolveRoot(HumRatAcc, MaxIte, SolFlaLat, PartLoadFrac, this->DOE2DXCoilHumRatResidual, 0.0, 1.0, Par);
+                            if (!DataSystemVariables::UnitaryDirectPLR || !this->DOE2DXCoilDirectPLR(HumRatAcc, Par, true, PartLoadFrac)) {
+                                General::SolveRoot(
+                                    HumRatAcc, MaxIte, SolFlaLat, PartLoadFrac, this->DOE2DXCoilHumRatResidual, 0.0, 1.0, Par);
+                            }
                             this->m_CompPartLoadRatio = PartLoadFrac;
 
                         } else if (CoilType_Num == DataHVACGlobals::CoilDX_CoolingHXAssisted) {
@@ -13182,6 +13188,60 @@ namespace UnitarySystems {
         return Residuum;
     }
 
+    bool UnitarySys::DOE2DXCoilDirectPLR(Real64 const Acc,               // accuracy of the part load ratio result
+                                         std::vector<Real64> const &Par, // same parameters as DOE2DXCoilResidual
+                                         bool const HumRatControl,       // true to meet the outlet humidity ratio in par(2)
+                                         Real64 &PartLoadRatio           // part load ratio found
+    )
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+
+        // PURPOSE OF THIS FUNCTION:
+        // Finds the part load ratio of a single speed DX cooling coil without iterating, for the cases where
+        // the outlet state is a linear blend of the inlet and full load outlet states. Returns false when the
+        // iterative solution is still needed.
+
+        // METHODOLOGY EMPLOYED:
+        // With a continuous fan and a cycling compressor, the outlet enthalpy and humidity ratio vary linearly with
+        // the part load ratio between the inlet state and the full load outlet state. The humidity ratio target then
+        // gives the part load ratio directly, and the temperature target does as well since enthalpy is linear in the
+        // humidity ratio at fixed dry-bulb temperature. The coil is simulated at the result, and the result is
+        // rejected when the residual exceeds Acc (outlet saturation, latent degradation).
+
+        int CoilIndex = int(Par[1]);
+        int FanOpMode = int(Par[5]);
+        if (FanOpMode != DataHVACGlobals::ContFanCycCoil) return false;
+
+        DXCoils::CalcDoe2DXCoil(CoilIndex, On, true, 1.0, FanOpMode);
+        Real64 const InletAirHumRat = DXCoils::DXCoil(CoilIndex).InletAirHumRat;
+        Real64 const InletAirEnthalpy = DXCoils::DXCoil(CoilIndex).InletAirEnthalpy;
+        Real64 const FullLoadHumRat = DXCoils::DXCoilOutletHumRat(CoilIndex);
+        Real64 const FullLoadEnthalpy = Psychrometrics::PsyHFnTdbW(DXCoils::DXCoilOutletTemp(CoilIndex), FullLoadHumRat);
+
+        Real64 Numerator;
+        Real64 Denominator;
+        if (HumRatControl) {
+            Numerator = Par[2] - InletAirHumRat;
+            Denominator = FullLoadHumRat - InletAirHumRat;
+        } else {
+            Numerator = Psychrometrics::PsyHFnTdbW(Par[2], InletAirHumRat) - InletAirEnthalpy;
+            Denominator = (FullLoadEnthalpy - InletAirEnthalpy) -
+                          (Psychrometrics::PsyHFnTdbW(Par[2], FullLoadHumRat) - Psychrometrics::PsyHFnTdbW(Par[2], InletAirHumRat));
+        }
+        if (Denominator >= 0.0) return false;
+        Real64 const DirectPLR = Numerator / Denominator;
+        if (DirectPLR <= 0.0 || DirectPLR >= 1.0) return false;
+
+        Real64 const Residuum = HumRatControl ? DOE2DXCoilHumRatResidual(DirectPLR, Par) : DOE2DXCoilResidual(DirectPLR, Par);
+        if (std::abs(Residuum) > Acc) return false;
+
+        PartLoadRatio = DirectPLR;
+        return true;
+    }
+
     Real64 UnitarySys::calcUnitarySystemLoadResidual(Real64 const PartLoadRatio,    // DX cooling coil part load ratio
                                                      std::vector<Real64> const &Par // Function parameters
     )
@@ -479,6 +479,12 @@ namespace UnitarySystems {
                                                std::vector<Real64> const &Par // par(1) = DX coil number
         );
 
+        static bool DOE2DXCoilDirectPLR(Real64 const Acc,               // accuracy of the part load ratio result
+                                        std::vector<Real64> const &Par, // same parameters as DOE2DXCoilResidual
+                                        bool const HumRatControl,       // true to meet the outlet humidity ratio in par(2)
+                                        Real64 &PartLoadRatio           // part load ratio found
+        );
+
         static Real64 calcUnitarySystemLoadResidual(Real64 const PartLoadRatio,    // DX cooling coil part load ratio
                                                     std::vector<Real64> const &Par // Function parameters
         );
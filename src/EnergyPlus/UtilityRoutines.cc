@@ -82,10 +82,12 @@ extern "C" {
 #include <General.hh>
 #include <GeneralRoutines.hh>
 #include <NodeInputManager.hh>
+#include <OutputProcessor.hh>
 #include <OutputReports.hh>
 #include <Plant/PlantManager.hh>
 #include <ResultsSchema.hh>
 #include <SimulationManager.hh>
+#include <SimulationTelemetry.hh>
 #include <SolarShading.hh>
 #include <SystemReports.hh>
 #include <SQLiteProcedures.hh>
@@ -201,6 +203,15 @@ namespace UtilityRoutines {
         return 0; // Not found
     }
 
+    void NameIndex::build(Array1_string const &ListOfItems, int const NumItems)
+    {
+        clear();
+        index.reserve(NumItems);
+        for (int Count = 1; Count <= NumItems; ++Count) {
+            add(ListOfItems(Count), Count);
+        }
+    }
+
     int FindItemInSortedList(std::string const &String, Array1S_string const ListOfItems, int const NumItems)
     {
 
@@ -616,7 +627,8 @@ int AbortEnergyPlus()
     }
 
 #ifdef EP_Detailed_Timings
-    epSummaryTimes(Time_Finish - Time_Start);
+    epSummaryTimes(Elapsed_Time);
+    epWriteTimerScopes();
 #endif
     std::cerr << "Program terminated: "
               << "EnergyPlus Terminated--Error(s) Detected." << std::endl;
@@ -671,6 +683,8 @@ void CloseMiscOpenFiles()
     //      INTEGER :: UnitNumber
     //      INTEGER :: ios
 
+    OutputProcessor::StopAsyncOutput();
+    OutputProcessor::StopLiveOutput();
     CloseReportIllumMaps();
     CloseDFSFile();
 
@@ -768,7 +782,7 @@ int EndEnergyPlus()
     // SUBROUTINE INFORMATION:
     //       AUTHOR         Linda K. Lawrie
     //       DATE WRITTEN   December 1997
-    //       MODIFIED       na
+    //       MODIFIED       October 2026, write the performance summary when requested
     //       RE-ENGINEERED  na
 
     // PURPOSE OF THIS SUBROUTINE:
@@ -847,6 +861,7 @@ int EndEnergyPlus()
 #ifdef EP_Detailed_Timings
     epStopTime("EntireRun=");
 #endif
+    SimulationTelemetry::ReportPerformance(Elapsed_Time);
     Hours = Elapsed_Time / 3600.0;
     Elapsed_Time -= Hours * 3600.0;
     Minutes = Elapsed_Time / 60.0;
@@ -892,7 +907,8 @@ int EndEnergyPlus()
     }
 
 #ifdef EP_Detailed_Timings
-    epSummaryTimes(Time_Finish - Time_Start);
+    epSummaryTimes(Elapsed_Time);
+    epWriteTimerScopes();
 #endif
     std::cerr << "EnergyPlus Completed Successfully." << std::endl;
     CloseOutOpenFiles();
@@ -1634,6 +1650,31 @@ void ShowWarningMessage(std::string const &ErrorMessage, Optional_int OutUnit1,
     }
 }
 
+namespace {
+    // Counts a recurring message against the first MessageSearch entry it contains; returns that entry (0 if none)
+    int CountMessageSearchMatch(std::string const &Message)
+    {
+        using namespace DataErrorTracking;
+
+        for (int Loop = 1; Loop <= SearchCounts; ++Loop) {
+            if (has(Message, MessageSearch(Loop))) {
+                ++MatchCounts(Loop);
+                return Loop;
+            }
+        }
+        return 0;
+    }
+
+    // Index of the first stored recurring message equal (ignoring case) to StoredMessage, 0 if there is none
+    int FindRecurringErrorMessage(std::string const &StoredMessage)
+    {
+        using DataErrorTracking::RecurringErrorIndex;
+
+        auto const found = RecurringErrorIndex.find(UtilityRoutines::MakeUPPERCase(StoredMessage));
+        return (found == RecurringErrorIndex.end()) ? 0 : found->second;
+    }
+} // namespace
+
 void ShowRecurringSevereErrorAtEnd(std::string const &Message,         // Message automatically written to "error file" at end of simulation
                                    int &MsgIndex,                      // Recurring message index, if zero, next available index is assigned
                                    Optional<Real64 const> ReportMaxOf, // Track and report the max of the values passed to this argument
@@ -1648,6 +1689,7 @@ void ShowRecurringSevereErrorAtEnd(std::string const &Message,         // Messag
     // SUBROUTINE INFORMATION:
     //       AUTHOR         Michael J. Witte
     //       DATE WRITTEN   August 2004
+    //       MODIFIED       October 2026, hashed lookup of stored messages
 
     // PURPOSE OF THIS SUBROUTINE:
     // This subroutine stores a recurring ErrorMessage with a Severe designation
@@ -1655,7 +1697,7 @@ void ShowRecurringSevereErrorAtEnd(std::string const &Message,         // Messag
     // of occurences and optional tracking of associated min, max, and sum values
 
     // METHODOLOGY EMPLOYED:
-    // Calls StoreRecurringErrorMessage utility routine.
+    // Looks up the message among the stored recurring messages and calls StoreRecurringErrorMessage utility routine.
 
     // Using/Aliasing
     using namespace DataPrecisionGlobals;
@@ -1666,27 +1708,14 @@ void ShowRecurringSevereErrorAtEnd(std::string const &Message,         // Messag
     //  Use for recurring "severe" error messages shown once at end of simulation
     //  with count of occurences and optional max, min, sum
 
-    for (int Loop = 1; Loop <= SearchCounts; ++Loop) {
-        if (has(Message, MessageSearch(Loop))) {
-            ++MatchCounts(Loop);
-            break;
-        }
-    }
-    bool bNewMessageFound = true;
-    for (int Loop = 1; Loop <= NumRecurringErrors; ++Loop) {
-        if (UtilityRoutines::SameString(RecurringErrors(Loop).Message, " ** Severe  ** " + Message)) {
-            bNewMessageFound = false;
-            MsgIndex = Loop;
-            break;
-        }
-    }
-    if (bNewMessageFound) {
-        MsgIndex = 0;
-    }
+    int const SearchMatch = CountMessageSearchMatch(Message);
+    std::string const StoredMessage(" ** Severe  ** " + Message);
+    MsgIndex = FindRecurringErrorMessage(StoredMessage);
+    bool const bNewMessageFound = (MsgIndex == 0);
 
     ++TotalSevereErrors;
-    StoreRecurringErrorMessage(
-        " ** Severe  ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits);
+    StoreRecurringErrorMessage(StoredMessage, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits);
+    if (bNewMessageFound) RecurringErrors(MsgIndex).SearchMatch = SearchMatch;
 }
 
 void ShowRecurringWarningErrorAtEnd(std::string const &Message,         // Message automatically written to "error file" at end of simulation
@@ -1703,6 +1732,7 @@ void ShowRecurringWarningErrorAtEnd(std::string const &Message,         // Messa
     // SUBROUTINE INFORMATION:
     //       AUTHOR         Michael J. Witte
     //       DATE WRITTEN   August 2004
+    //       MODIFIED       October 2026, hashed lookup of stored messages
 
     // PURPOSE OF THIS SUBROUTINE:
     // This subroutine stores a recurring ErrorMessage with a Warning designation
@@ -1710,7 +1740,7 @@ void ShowRecurringWarningErrorAtEnd(std::string const &Message,         // Messa
     // of occurences and optional tracking of associated min, max, and sum values
 
     // METHODOLOGY EMPLOYED:
-    // Calls StoreRecurringErrorMessage utility routine.
+    // Looks up the message among the stored recurring messages and calls StoreRecurringErrorMessage utility routine.
 
     // Using/Aliasing
     using namespace DataPrecisionGlobals;
@@ -1721,27 +1751,14 @@ void ShowRecurringWarningErrorAtEnd(std::string const &Message,         // Messa
     //  Use for recurring "warning" error messages shown once at end of simulation
     //  with count of occurences and optional max, min, sum
 
-    for (int Loop = 1; Loop <= SearchCounts; ++Loop) {
-        if (has(Message, MessageSearch(Loop))) {
-            ++MatchCounts(Loop);
-            break;
-        }
-    }
-    bool bNewMessageFound = true;
-    for (int Loop = 1; Loop <= NumRecurringErrors; ++Loop) {
-        if (UtilityRoutines::SameString(RecurringErrors(Loop).Message, " ** Warning ** " + Message)) {
-            bNewMessageFound = false;
-            MsgIndex = Loop;
-            break;
-        }
-    }
-    if (bNewMessageFound) {
-        MsgIndex = 0;
-    }
+    int const SearchMatch = CountMessageSearchMatch(Message);
+    std::string const StoredMessage(" ** Warning ** " + Message);
+    MsgIndex = FindRecurringErrorMessage(StoredMessage);
+    bool const bNewMessageFound = (MsgIndex == 0);
 
     ++TotalWarningErrors;
-    StoreRecurringErrorMessage(
-        " ** Warning ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits);
+    StoreRecurringErrorMessage(StoredMessage, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits);
+    if (bNewMessageFound) RecurringErrors(MsgIndex).SearchMatch = SearchMatch;
 }
 
 void ShowRecurringContinueErrorAtEnd(std::string const &Message,         // Message automatically written to "error file" at end of simulation
@@ -1758,6 +1775,7 @@ void ShowRecurringContinueErrorAtEnd(std::string const &Message,         // Mess
     // SUBROUTINE INFORMATION:
     //       AUTHOR         Michael J. Witte
     //       DATE WRITTEN   August 2004
+    //       MODIFIED       October 2026, hashed lookup of stored messages
 
     // PURPOSE OF THIS SUBROUTINE:
     // This subroutine stores a recurring ErrorMessage with a continue designation
@@ -1765,7 +1783,7 @@ void ShowRecurringContinueErrorAtEnd(std::string const &Message,         // Mess
     // of occurences and optional tracking of associated min, max, and sum values
 
     // METHODOLOGY EMPLOYED:
-    // Calls StoreRecurringErrorMessage utility routine.
+    // Looks up the message among the stored recurring messages and calls StoreRecurringErrorMessage utility routine.
 
     // Using/Aliasing
     using namespace DataPrecisionGlobals;
@@ -1776,26 +1794,13 @@ void ShowRecurringContinueErrorAtEnd(std::string const &Message,         // Mess
     //  Use for recurring "continue" error messages shown once at end of simulation
     //  with count of occurences and optional max, min, sum
 
-    for (int Loop = 1; Loop <= SearchCounts; ++Loop) {
-        if (has(Message, MessageSearch(Loop))) {
-            ++MatchCounts(Loop);
-            break;
-        }
-    }
-    bool bNewMessageFound = true;
-    for (int Loop = 1; Loop <= NumRecurringErrors; ++Loop) {
-        if (UtilityRoutines::SameString(RecurringErrors(Loop).Message, " **   ~~~   ** " + Message)) {
-            bNewMessageFound = false;
-            MsgIndex = Loop;
-            break;
-        }
-    }
-    if (bNewMessageFound) {
-        MsgIndex = 0;
-    }
+    int const SearchMatch = CountMessageSearchMatch(Message);
+    std::string const StoredMessage(" **   ~~~   ** " + Message);
+    MsgIndex = FindRecurringErrorMessage(StoredMessage);
+    bool const bNewMessageFound = (MsgIndex == 0);
 
-    StoreRecurringErrorMessage(
-        " **   ~~~   ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits);
+    StoreRecurringErrorMessage(StoredMessage, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits);
+    if (bNewMessageFound) RecurringErrors(MsgIndex).SearchMatch = SearchMatch;
 }
 
 void StoreRecurringErrorMessage(std::string const &ErrorMessage,         // Message automatically written to "error file" at end of simulation
@@ -1813,6 +1818,7 @@ void StoreRecurringErrorMessage(std::string const &ErrorMessage,         // Mess
     //       AUTHOR         Michael J. Witte
     //       DATE WRITTEN   August 2004
     //       MODIFIED       September 2005;LKL;Added Units
+    //       MODIFIED       October 2026, index new messages for lookup
 
     // PURPOSE OF THIS SUBROUTINE:
     // This subroutine stores a recurring ErrorMessage with
@@ -1832,6 +1838,7 @@ void StoreRecurringErrorMessage(std::string const &ErrorMessage,         // Mess
         ErrorMsgIndex = NumRecurringErrors;
         // The message string only needs to be stored once when a new recurring message is created
         RecurringErrors(ErrorMsgIndex).Message = ErrorMessage;
+        RecurringErrorIndex.emplace(UtilityRoutines::MakeUPPERCase(ErrorMessage), ErrorMsgIndex);
         RecurringErrors(ErrorMsgIndex).Count = 1;
         if (WarmupFlag) RecurringErrors(ErrorMsgIndex).WarmupCount = 1;
         if (DoingSizing) RecurringErrors(ErrorMsgIndex).SizingCount = 1;
@@ -1882,6 +1889,41 @@ void StoreRecurringErrorMessage(std::string const &ErrorMessage,         // Mess
     }
 }
 
+bool UpdateRecurringErrorAtEnd(int const MsgIndex,                  // Recurring message index returned by ShowRecurring*ErrorAtEnd
+                               Optional<Real64 const> ReportMaxOf, // Track and report the max of the values passed to this argument
+                               Optional<Real64 const> ReportMinOf, // Track and report the min of the values passed to this argument
+                               Optional<Real64 const> ReportSumOf  // Track and report the sum of the values passed to this argument
+)
+{
+
+    // SUBROUTINE INFORMATION:
+    //       DATE WRITTEN   October 2026
+
+    // PURPOSE OF THIS SUBROUTINE:
+    // This subroutine records another occurrence of a recurring error message that was
+    // already registered by ShowRecurringSevereErrorAtEnd, ShowRecurringWarningErrorAtEnd
+    // or ShowRecurringContinueErrorAtEnd, so callers inside iteration loops do not have to
+    // rebuild the message text every time.  Returns false, recording nothing, when MsgIndex
+    // does not refer to a stored message; the caller then registers the message by text.
+
+    // Using/Aliasing
+    using namespace DataErrorTracking;
+
+    if (MsgIndex < 1 || MsgIndex > NumRecurringErrors) return false;
+
+    auto &thisError(RecurringErrors(MsgIndex));
+    if (thisError.SearchMatch > 0) ++MatchCounts(thisError.SearchMatch);
+    if (has_prefix(thisError.Message, " ** Warning ** ")) {
+        ++TotalWarningErrors;
+    } else if (has_prefix(thisError.Message, " ** Severe  ** ")) {
+        ++TotalSevereErrors;
+    }
+
+    int ErrorMsgIndex(MsgIndex);
+    StoreRecurringErrorMessage(thisError.Message, ErrorMsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf);
+    return true;
+}
+
 void ShowErrorMessage(std::string const &ErrorMessage, Optional_int OutUnit1, Optional_int OutUnit2)
 {
 
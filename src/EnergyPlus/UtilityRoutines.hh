@@ -55,6 +55,9 @@
 #include <ObjexxFCL/Optional.hh>
 #include <ObjexxFCL/string.functions.hh>
 
+// C++ Headers
+#include <unordered_map>
+
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 
@@ -186,6 +189,12 @@ void StoreRecurringErrorMessage(std::string const &ErrorMessage,             //
                                 std::string const &ErrorReportSumUnits = ""  // Units for "sum" reporting
 );
 
+bool UpdateRecurringErrorAtEnd(int const MsgIndex,                      // Recurring message index returned by ShowRecurring*ErrorAtEnd
+                               Optional<Real64 const> ReportMaxOf = _, // Track and report the max of the values passed to this argument
+                               Optional<Real64 const> ReportMinOf = _, // Track and report the min of the values passed to this argument
+                               Optional<Real64 const> ReportSumOf = _  // Track and report the sum of the values passed to this argument
+);
+
 void ShowErrorMessage(std::string const &ErrorMessage, Optional_int OutUnit1 = _, Optional_int OutUnit2 = _);
 
 void SummarizeErrors();
@@ -265,6 +274,80 @@ namespace UtilityRoutines {
         return UtilityRoutines::FindItemInList(String, ListOfItems, name_p, ListOfItems.isize());
     }
 
+    // Hashed lookup over a list of names, built once and reused for repeated exact-match searches.
+    // find() returns the same 1-based index as FindItemInList (first occurrence wins) or 0 when not found.
+    // The owner must keep the index in step with the list, e.g. with add() as items are appended.
+    class NameIndex
+    {
+    public:
+        NameIndex() = default;
+
+        void build(Array1_string const &ListOfItems, int const NumItems);
+
+        void build(Array1_string const &ListOfItems)
+        {
+            build(ListOfItems, ListOfItems.isize());
+        }
+
+        template <typename Container, class = typename std::enable_if<!std::is_same<typename Container::value_type, std::string>::value>::type>
+        // Container needs operator[i] and elements need Name
+        void build(Container const &ListOfItems, int const NumItems)
+        {
+            clear();
+            index.reserve(NumItems);
+            for (typename Container::size_type i = 0, e = NumItems; i < e; ++i) {
+                add(ListOfItems[i].Name, int(i + 1));
+            }
+        }
+
+        template <typename Container, class = typename std::enable_if<!std::is_same<typename Container::value_type, std::string>::value>::type>
+        // Container needs operator[i] and value_type
+        void build(Container const &ListOfItems, std::string Container::value_type::*name_p, int const NumItems)
+        {
+            clear();
+            index.reserve(NumItems);
+            for (typename Container::size_type i = 0, e = NumItems; i < e; ++i) {
+                add(ListOfItems[i].*name_p, int(i + 1));
+            }
+        }
+
+        // Adds Name at the 1-based position Item, an existing entry for Name is kept
+        void add(std::string const &Name, int const Item)
+        {
+            index.emplace(Name, Item);
+        }
+
+        int find(std::string const &String) const
+        {
+            auto const found = index.find(String);
+            if (found != index.end()) return found->second;
+            return 0; // Not found
+        }
+
+        int size() const
+        {
+            return static_cast<int>(index.size());
+        }
+
+        bool empty() const
+        {
+            return index.empty();
+        }
+
+        void clear()
+        {
+            index.clear();
+        }
+
+    private:
+        std::unordered_map<std::string, int> index;
+    };
+
+    inline int FindItemInList(std::string const &String, NameIndex const &ListIndex)
+    {
+        return ListIndex.find(String);
+    }
+
     int FindItemInSortedList(std::string const &String, Array1S_string const ListOfItems, int const NumItems);
 
     inline int FindItemInSortedList(std::string const &String, Array1S_string const ListOfItems)
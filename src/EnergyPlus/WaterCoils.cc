@@ -47,6 +47,7 @@
 
 // C++ Headers
 #include <cmath>
+#include <map>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -203,6 +204,7 @@ namespace WaterCoils {
         // use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
         // This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
         bool InitWaterCoilOneTimeFlag(true);
+        std::map<Real64, Array1D<Real64>> DryFinEffCoefs; // CalcDryFinEffCoef results by tube to effective fin diameter ratio
     } // namespace
     // Subroutine Specifications for the Module
     // Driver/Manager Routines
@@ -231,6 +233,7 @@ namespace WaterCoils {
     {
         NumWaterCoils = 0;
         InitWaterCoilOneTimeFlag = true;
+        DryFinEffCoefs.clear();
         MySizeFlag.deallocate();
         MyUAAndFlowCalcFlag.deallocate();
         MyCoilDesignFlag.deallocate();
@@ -1281,7 +1284,7 @@ namespace WaterCoils {
                     ShowContinueError("  Resetting coil depth to " + RoundSigDigits(WaterCoil(CoilNum).CoilDepth, 4) + " meters");
                 }
 
-                CalcDryFinEffCoef(TubeToFinDiamRatio, CoefSeries);
+                SharedDryFinEffCoef(TubeToFinDiamRatio, CoefSeries);
 
                 WaterCoil(CoilNum).DryFinEfficncyCoef = CoefSeries;
 
@@ -3222,10 +3225,14 @@ namespace WaterCoils {
             //      the dew point coil is apparently all wet but a solution
             //      cannot be obtained
             if (!WaterTempConvg && !WarmupFlag && (OutCoilSurfTemp < EnterAirDewPoint)) {
-                ShowRecurringWarningErrorAtEnd(WaterCoil(CoilNum).Name + " not converged (8 iterations) due to \"Wet Convergence\" conditions.",
-                                               WaterTempCoolCoilErrs(CoilNum),
+                if (!UpdateRecurringErrorAtEnd(WaterTempCoolCoilErrs(CoilNum),
                                                std::abs(MeanWaterTemp - WetSideEffctvWaterTemp),
-                                               std::abs(MeanWaterTemp - WetSideEffctvWaterTemp));
+                                               std::abs(MeanWaterTemp - WetSideEffctvWaterTemp))) {
+                    ShowRecurringWarningErrorAtEnd(WaterCoil(CoilNum).Name + " not converged (8 iterations) due to \"Wet Convergence\" conditions.",
+                                                   WaterTempCoolCoilErrs(CoilNum),
+                                                   std::abs(MeanWaterTemp - WetSideEffctvWaterTemp),
+                                                   std::abs(MeanWaterTemp - WetSideEffctvWaterTemp));
+                }
                 //       CoolCoilErrs = CoolCoilErrs + 1
                 //       IF (CoolCoilErrs .LE. MaxCoolCoilErrs) THEN
                 //          CALL ShowWarningError('tp12c0:  not converged in 8 CoolCoilErrs')
@@ -3409,9 +3416,11 @@ namespace WaterCoils {
             }
             //      error checking to see if convergence has been achieved
             if (!CoilPartWetConvg && !WarmupFlag) {
-                ShowRecurringWarningErrorAtEnd(WaterCoil(CoilNum).Name +
-                                                   " not converged (40 iterations) due to \"Partial Wet Convergence\" conditions.",
-                                               PartWetCoolCoilErrs(CoilNum));
+                if (!UpdateRecurringErrorAtEnd(PartWetCoolCoilErrs(CoilNum))) {
+                    ShowRecurringWarningErrorAtEnd(WaterCoil(CoilNum).Name +
+                                                       " not converged (40 iterations) due to \"Partial Wet Convergence\" conditions.",
+                                                   PartWetCoolCoilErrs(CoilNum));
+                }
                 //      CoolCoilErrs = CoolCoilErrs + 1
                 //      IF (CoolCoilErrs .LE. MaxCoolCoilErrs) THEN
                 //        CALL ShowWarningError('tp12c0:  not converged in 20 CoolCoilErrs')
@@ -3978,7 +3987,7 @@ namespace WaterCoils {
         // FUNCTION INFORMATION:
         // AUTHOR         Rahul Chillar
         // DATE WRITTEN   March 2004
-        // MODIFIED       na
+        // MODIFIED       October 2026, boundary liquid temperature warm-started from the previous solution
         // RE-ENGINEERED  na
 
         // PURPOSE OF THIS FUNCTION:
@@ -4069,6 +4078,11 @@ namespace WaterCoils {
 
         } else {
             SurfAreaWetFraction = WaterCoil(CoilNum).SurfAreaWetFractionSaved;
+            // Start the wet/dry boundary liquid temperature from the previous solution as well, unless the inlet conditions moved past it
+            if (WaterCoil(CoilNum).PartWetSolutionSaved && WaterCoil(CoilNum).OutletWaterTempSaved > InletWaterTemp &&
+                WaterCoil(CoilNum).OutletWaterTempSaved < InletAirTemp) {
+                OutletWaterTemp = WaterCoil(CoilNum).OutletWaterTempSaved;
+            }
         }
         // BEGIN LOOP to converge on SurfAreaWetFraction
         // The method employed in this loop is as follows: The coil is partially wet and partially dry,
@@ -4203,6 +4217,8 @@ namespace WaterCoils {
 
         // Save last iterations values for this current time step
         WaterCoil(CoilNum).SurfAreaWetFractionSaved = SurfAreaWetFraction;
+        WaterCoil(CoilNum).OutletWaterTempSaved = OutletWaterTemp;
+        WaterCoil(CoilNum).PartWetSolutionSaved = true;
     }
 
     // Calculating coil UA for Cooling Coil
@@ -4749,6 +4765,21 @@ namespace WaterCoils {
     // Beginning of Coil Utility subroutines for the Detailed Model
     // *****************************************************************************
 
+    void SharedDryFinEffCoef(Real64 const OutTubeEffFinDiamRatio, Array1<Real64> &PolynomCoef)
+    {
+        // PURPOSE OF THIS SUBROUTINE:
+        // Returns the CalcDryFinEffCoef fit for a tube to effective fin diameter ratio.  The Bessel function fit depends
+        // only on the geometry, so coils of the same geometry and later environments share it.
+
+        auto const found = DryFinEffCoefs.find(OutTubeEffFinDiamRatio);
+        if (found != DryFinEffCoefs.end()) {
+            PolynomCoef = found->second;
+        } else {
+            CalcDryFinEffCoef(OutTubeEffFinDiamRatio, PolynomCoef);
+            DryFinEffCoefs.emplace(OutTubeEffFinDiamRatio, PolynomCoef);
+        }
+    }
+
     void CalcDryFinEffCoef(Real64 const OutTubeEffFinDiamRatio, Array1<Real64> &PolynomCoef)
     {
         // SUBROUTINE INFORMATION:
@@ -6121,7 +6152,7 @@ namespace WaterCoils {
         // FUNCTION INFORMATION:
         //       AUTHOR         Fred Buhl
         //       DATE WRITTEN   April 1, 2009
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, residual passed as an inlined lambda instead of a Par array
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS FUNCTION:
@@ -6159,16 +6190,13 @@ namespace WaterCoils {
         Real64 T0;                // lower bound for Tprov [C]
         Real64 T1;                // upper bound for Tprov [C]
         static Real64 Tprov(0.0); // provisional value of drybulb temperature [C]
-        Array1D<Real64> Par(3);   // Par(1) = desired enthaply H [J/kg]
-        // Par(2) = desired relative humidity (0.0 - 1.0)
-        // Par(3) = barometric pressure [N/m2 (Pascals)]
+
+        // Residual Hdesired - H(Tdb,Rh,Pb) for a test value of Tdb [C]
+        auto EnthalpyResidual = [H, RH, PB](Real64 const Tdb) { return H - PsyHFnTdbRhPb(Tdb, RH, PB); };
 
         T0 = 1.0;
         T1 = 50.0;
-        Par(1) = H;
-        Par(2) = RH;
-        Par(3) = PB;
-        SolveRoot(Acc, MaxIte, SolFla, Tprov, EnthalpyResidual, T0, T1, Par);
+        SolveRoot(Acc, MaxIte, SolFla, Tprov, EnthalpyResidual, T0, T1);
         // if the numerical inversion failed, issue error messages.
         if (SolFla == -1) {
             ShowSevereError("Calculation of drybulb temperature failed in TdbFnHRhPb(H,RH,PB)");
@@ -6188,54 +6216,6 @@ namespace WaterCoils {
         return T;
     }
 
-    Real64 EnthalpyResidual(Real64 const Tprov,       // test value of Tdb [C]
-                            Array1<Real64> const &Par // Par(1) = desired enthaply H [J/kg]
-    )
-    {
-
-        // FUNCTION INFORMATION:
-        //       AUTHOR         Fred Buhl
-        //       DATE WRITTEN   April 2009
-        //       MODIFIED
-        //       RE-ENGINEERED
-
-        // PURPOSE OF THIS FUNCTION:
-        // Calculates residual function Hdesired - H(Tdb,Rh,Pb)
-
-        // METHODOLOGY EMPLOYED:
-        // Calls PsyHFnTdbRhPb
-
-        // REFERENCES:
-
-        // Using/Aliasing
-        using Psychrometrics::PsyHFnTdbRhPb;
-
-        // Return value
-        Real64 Residuum; // residual to be minimized to zero
-
-        // Argument array dimensioning
-
-        // Locals
-        // SUBROUTINE ARGUMENT DEFINITIONS:
-        // Par(2) = desired relative humidity (0.0 - 1.0)
-        // Par(3) = barometric pressure [N/m2 (Pascals)]
-
-        // FUNCTION PARAMETER DEFINITIONS:
-        // na
-
-        // INTERFACE BLOCK SPECIFICATIONS
-        // na
-
-        // DERIVED TYPE DEFINITIONS
-        // na
-
-        // FUNCTION LOCAL VARIABLE DECLARATIONS:
-
-        Residuum = Par(1) - PsyHFnTdbRhPb(Tprov, Par(2), Par(3));
-
-        return Residuum;
-    }
-
     Real64 EstimateHEXSurfaceArea(int const CoilNum) // coil number, [-]
     {
 
@@ -234,6 +234,8 @@ namespace WaterCoils {
         Real64 UAWetExtPerUnitArea;       // External overall heat transfer coefficient(W/m2 C)
         Real64 UADryExtPerUnitArea;       // External overall heat transfer coefficient(W/m2 C)
         Real64 SurfAreaWetFractionSaved;  // Previous saved value, for numerical efficiency.
+        Real64 OutletWaterTempSaved;      // Previous part wet outlet water temperature, for numerical efficiency.
+        bool PartWetSolutionSaved;        // True once SurfAreaWetFractionSaved and OutletWaterTempSaved hold a solution
         // END calculated parameters for Design Inputs Detailed coil
         // variables for simple heating coil with variable UA
         Real64 UACoilVariable;                 // WaterCoil UA value when variable (simple heating coil only)
@@ -286,7 +288,7 @@ namespace WaterCoils {
               DesTotWaterCoilLoad(0.0), DesSenWaterCoilLoad(0.0), DesAirMassFlowRate(0.0), UACoilTotal(0.0), UACoilInternal(0.0), UACoilExternal(0.0),
               UACoilInternalDes(0.0), UACoilExternalDes(0.0), DesOutletAirTemp(0.0), DesOutletAirHumRat(0.0), DesOutletWaterTemp(0.0),
               HeatExchType(0), CoolingCoilAnalysisMode(0), UACoilInternalPerUnitArea(0.0), UAWetExtPerUnitArea(0.0), UADryExtPerUnitArea(0.0),
-              SurfAreaWetFractionSaved(0.0), UACoilVariable(0.0), RatioAirSideToWaterSideConvect(1.0), AirSideNominalConvect(0.0),
+              SurfAreaWetFractionSaved(0.0), OutletWaterTempSaved(0.0), PartWetSolutionSaved(false), UACoilVariable(0.0), RatioAirSideToWaterSideConvect(1.0), AirSideNominalConvect(0.0),
               LiquidSideNominalConvect(0.0), Control(0), AirInletNodeNum(0), AirOutletNodeNum(0), WaterInletNodeNum(0), WaterOutletNodeNum(0),
               WaterLoopNum(0), WaterLoopSide(0), WaterLoopBranchNum(0), WaterLoopCompNum(0), CondensateCollectMode(CondensateDiscarded),
               CondensateTankID(0), CondensateTankSupplyARRID(0), CondensateVdot(0.0), CondensateVol(0.0), CoilPerfInpMeth(0), FoulingFactor(0.0),
@@ -471,6 +473,8 @@ namespace WaterCoils {
     // Beginning of Coil Utility subroutines for the Detailed Model
     // *****************************************************************************
 
+    void SharedDryFinEffCoef(Real64 const OutTubeEffFinDiamRatio, Array1<Real64> &PolynomCoef);
+
     void CalcDryFinEffCoef(Real64 const OutTubeEffFinDiamRatio, Array1<Real64> &PolynomCoef);
 
     void CalcIBesselFunc(Real64 const BessFuncArg, int const BessFuncOrd, Real64 &IBessFunc, int &ErrorCode);
@@ -556,10 +560,6 @@ namespace WaterCoils {
                       Real64 const PB  // barometric pressure {Pascals}
     );
 
-    Real64 EnthalpyResidual(Real64 const Tprov,       // test value of Tdb [C]
-                            Array1<Real64> const &Par // Par(1) = desired enthaply H [J/kg]
-    );
-
     Real64 EstimateHEXSurfaceArea(int const CoilNum); // coil number, [-]
 
     int GetWaterCoilIndex(std::string const &CoilType, // must match coil types in this module
@@ -66,6 +66,7 @@
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEquipment.hh>
 #include <Fans.hh>
 #include <FluidProperties.hh>
@@ -7935,6 +7936,9 @@ namespace WaterThermalTanks {
         // Temperatures and energies change dynamically over the system time step.
         // Final node temperatures are reported as final instantaneous values as well as averages over the
         // time step.  Heat transfer rates are averages over the time step.
+        // When StratifiedTankImplicit is set, the node heat balances are instead solved together as one backward Euler
+        // tridiagonal system over the whole remaining system time step.  The step is shortened to maxDt only when a
+        // heater thermostat would switch within it.
 
         static std::string const RoutineName("CalcWaterThermalTankStratified");
         const Real64 TemperatureConvergenceCriteria = 0.0001;
@@ -8050,6 +8054,99 @@ namespace WaterThermalTanks {
         std::vector<Real64> Tavg;
         Tavg.resize(nTankNodes);
 
+        // Implicit solver work arrays: sub-diagonal, diagonal, super-diagonal and right hand side of the node heat balances
+        std::vector<Real64> SubDiag;
+        std::vector<Real64> Diag;
+        std::vector<Real64> SuperDiag;
+        std::vector<Real64> Rhs;
+        if (DataSystemVariables::StratifiedTankImplicit) {
+            SubDiag.resize(nTankNodes);
+            Diag.resize(nTankNodes);
+            SuperDiag.resize(nTankNodes);
+            Rhs.resize(nTankNodes);
+        }
+
+        // Backward Euler step of all node temperatures over dt, solved with the Thomas algorithm.
+        // Each node balance is m*cp*(Tfinal - Tstart)/dt = q_net(Tfinal); the average temperature is the final temperature.
+        auto SolveNodesImplicit = [&](Real64 const dt) {
+            for (int i = 0; i < nTankNodes; ++i) {
+                const int NodeNum = i + 1;
+                const auto &tank_node(Tank.Node(NodeNum));
+                const Real64 NodeCapacitance = tank_node.Mass * Cp / dt;
+
+                Real64 a = NodeCapacitance;
+                Real64 b = NodeCapacitance * tank_node.Temp;
+
+                if (NodeNum == Tank.HeaterNode1) b += Qheater1;
+                if (NodeNum == Tank.HeaterNode2) b += Qheater2;
+
+                // Parasitic Loads and Losses to Ambient
+                if (Tank.HeaterOn1 || Tank.HeaterOn2) {
+                    b += tank_node.OnCycParaLoad + tank_node.OnCycLossCoeff * Tank.AmbientTemp;
+                    a += tank_node.OnCycLossCoeff;
+                } else {
+                    b += tank_node.OffCycParaLoad + tank_node.OffCycLossCoeff * Tank.AmbientTemp;
+                    a += tank_node.OffCycLossCoeff;
+                }
+
+                // Conduction and internodal flow to adjacent nodes
+                a += tank_node.CondCoeffDn + tank_node.CondCoeffUp + (tank_node.MassFlowFromUpper + tank_node.MassFlowFromLower) * Cp;
+                SubDiag[i] = (NodeNum > 1) ? -(tank_node.CondCoeffUp + tank_node.MassFlowFromUpper * Cp) : 0.0;
+                SuperDiag[i] = (NodeNum < nTankNodes) ? -(tank_node.CondCoeffDn + tank_node.MassFlowFromLower * Cp) : 0.0;
+
+                // Use side plant connection
+                const Real64 use_e_mdot_cp = tank_node.UseMassFlowRate * Cp;
+                a += use_e_mdot_cp;
+                b += use_e_mdot_cp * Tank.UseInletTemp;
+
+                // Source side heat transfer rate
+                if ((Tank.HeatPumpNum > 0) && (HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterPumped)) {
+                    if (tank_node.SourceMassFlowRate > 0.0) b += Qheatpump;
+                } else {
+                    const Real64 src_e_mdot_cp = tank_node.SourceMassFlowRate * Cp;
+                    a += src_e_mdot_cp;
+                    b += src_e_mdot_cp * Tank.SourceInletTemp;
+                }
+
+                // Wrapped condenser heat pump water heater
+                if ((Tank.HeatPumpNum > 0) && (HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterWrapped)) {
+                    b += Qheatpump * tank_node.HPWHWrappedCondenserHeatingFrac;
+                }
+
+                Diag[i] = a;
+                Rhs[i] = b;
+            }
+
+            // Forward elimination
+            for (int i = 1; i < nTankNodes; ++i) {
+                const Real64 w = SubDiag[i] / Diag[i - 1];
+                Diag[i] -= w * SuperDiag[i - 1];
+                Rhs[i] -= w * Rhs[i - 1];
+            }
+            // Back substitution
+            Tfinal[nTankNodes - 1] = Rhs[nTankNodes - 1] / Diag[nTankNodes - 1];
+            for (int i = nTankNodes - 2; i >= 0; --i) {
+                Tfinal[i] = (Rhs[i] - SuperDiag[i] * Tfinal[i + 1]) / Diag[i];
+            }
+            for (int i = 0; i < nTankNodes; ++i) {
+                Tavg[i] = Tfinal[i];
+            }
+        };
+
+        // True if the heater thermostats would change state at the end of an implicit step
+        auto HeaterWouldSwitch = [&]() {
+            if (Tank.IsChilledWaterTank) return false;
+            if (Tank.MaxCapacity > 0.0) {
+                const Real64 NodeTemp = Tfinal[Tank.HeaterNode1 - 1];
+                if (Tank.HeaterOn1 ? (NodeTemp >= Tank.SetPointTemp) : (NodeTemp < MinTemp1)) return true;
+            }
+            if (Tank.MaxCapacity2 > 0.0) {
+                const Real64 NodeTemp = Tfinal[Tank.HeaterNode2 - 1];
+                if (Tank.HeaterOn2 ? (NodeTemp >= Tank.SetPointTemp2) : (NodeTemp < MinTemp2)) return true;
+            }
+            return false;
+        };
+
         while(TimeRemaining > 0.0) {
 
             if (Tank.InletMode == InletModeSeeking) CalcNodeMassFlows(WaterThermalTankNum, InletModeSeeking);
@@ -8115,94 +8212,105 @@ namespace WaterThermalTanks {
             // Determine the internal time step
             Real64 dt = min(TimeRemaining, maxDt);
 
-            // Make initial guess that average and final temperatures over the timestep are equal to the starting temperatures
-            for (int i = 0; i < nTankNodes; i++) {
-                const auto &NodeTemp = Tank.Node[i].Temp;
-                Tfinal[i] = NodeTemp;
-                Tavg[i] = NodeTemp;
-            }
+            if (DataSystemVariables::StratifiedTankImplicit) {
+                // Take the whole remaining time step unless a thermostat would switch within it
+                dt = TimeRemaining;
+                SolveNodesImplicit(dt);
+                if ((dt > maxDt) && HeaterWouldSwitch()) {
+                    dt = maxDt;
+                    SolveNodesImplicit(dt);
+                }
+            } else {
+                // Make initial guess that average and final temperatures over the timestep are equal to the starting temperatures
+                for (int i = 0; i < nTankNodes; i++) {
+                    const auto &NodeTemp = Tank.Node[i].Temp;
+                    Tfinal[i] = NodeTemp;
+                    Tavg[i] = NodeTemp;
+                }
 
-            for (int ConvergenceCounter = 1; ConvergenceCounter <= 10; ConvergenceCounter++) {
+                for (int ConvergenceCounter = 1; ConvergenceCounter <= 10; ConvergenceCounter++) {
 
-                std::fill(A.begin(), A.end(), 0.0);
-                std::fill(B.begin(), B.end(), 0.0);
+                    std::fill(A.begin(), A.end(), 0.0);
+                    std::fill(B.begin(), B.end(), 0.0);
 
-                // Heater Coefficients
-                B[Tank.HeaterNode1 - 1] += Qheater1;
-                B[Tank.HeaterNode2 - 1] += Qheater2;
+                    // Heater Coefficients
+                    B[Tank.HeaterNode1 - 1] += Qheater1;
+                    B[Tank.HeaterNode2 - 1] += Qheater2;
 
-                for (int i = 0; i < nTankNodes; i++) {
-                    const int NodeNum = i + 1;
-                    const auto &tank_node(Tank.Node(NodeNum));
-
-                    // Parasitic Loads and Losses to Ambient
-                    if (Tank.HeaterOn1 || Tank.HeaterOn2) {
-                        // Parasitic Loads
-                        B[i] += tank_node.OnCycParaLoad;
-                        // Losses to Ambient
-                        A[i] += -tank_node.OnCycLossCoeff;
-                        B[i] += tank_node.OnCycLossCoeff * Tank.AmbientTemp;
-                    } else {
-                        // Parasitic Loads
-                        B[i] += tank_node.OffCycParaLoad;
-                        // Losses to Ambient
-                        A[i] += -tank_node.OffCycLossCoeff;
-                        B[i] += tank_node.OffCycLossCoeff * Tank.AmbientTemp;
-                    }
-
-                    // Conduction to adjacent nodes
-                    A[i] += -(tank_node.CondCoeffDn + tank_node.CondCoeffUp);
-                    if (NodeNum > 1) B[i] += tank_node.CondCoeffUp * Tavg[i-1];
-                    if (NodeNum < nTankNodes) B[i] += tank_node.CondCoeffDn * Tavg[i+1];
-
-                    // Use side plant connection
-                    const Real64 use_e_mdot_cp = tank_node.UseMassFlowRate * Cp;
-                    A[i] += -use_e_mdot_cp;
-                    B[i] += use_e_mdot_cp * Tank.UseInletTemp;
-
-                    // Source side heat transfer rate
-                    if ((Tank.HeatPumpNum > 0) && (HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterPumped)) {
-                        // Pumped Condenser Heat Pump Water Heater
-                        if (tank_node.SourceMassFlowRate > 0.0) B[i] += Qheatpump;
-                    } else {
-                        // Source side plant connection (constant temperature)
-                        const Real64 src_e_mdot_cp = tank_node.SourceMassFlowRate * Cp;
-                        A[i] += -src_e_mdot_cp;
-                        B[i] += src_e_mdot_cp * Tank.SourceInletTemp;
-                    }
+                    for (int i = 0; i < nTankNodes; i++) {
+                        const int NodeNum = i + 1;
+                        const auto &tank_node(Tank.Node(NodeNum));
 
-                    // Wrapped condenser heat pump water heater
-                    if ((Tank.HeatPumpNum > 0) && (HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterWrapped)) {
-                        B[i] += Qheatpump * tank_node.HPWHWrappedCondenserHeatingFrac;
-                    }
+                        // Parasitic Loads and Losses to Ambient
+                        if (Tank.HeaterOn1 || Tank.HeaterOn2) {
+                            // Parasitic Loads
+                            B[i] += tank_node.OnCycParaLoad;
+                            // Losses to Ambient
+                            A[i] += -tank_node.OnCycLossCoeff;
+                            B[i] += tank_node.OnCycLossCoeff * Tank.AmbientTemp;
+                        } else {
+                            // Parasitic Loads
+                            B[i] += tank_node.OffCycParaLoad;
+                            // Losses to Ambient
+                            A[i] += -tank_node.OffCycLossCoeff;
+                            B[i] += tank_node.OffCycLossCoeff * Tank.AmbientTemp;
+                        }
+
+                        // Conduction to adjacent nodes
+                        A[i] += -(tank_node.CondCoeffDn + tank_node.CondCoeffUp);
+                        if (NodeNum > 1) B[i] += tank_node.CondCoeffUp * Tavg[i-1];
+                        if (NodeNum < nTankNodes) B[i] += tank_node.CondCoeffDn * Tavg[i+1];
+
+                        // Use side plant connection
+                        const Real64 use_e_mdot_cp = tank_node.UseMassFlowRate * Cp;
+                        A[i] += -use_e_mdot_cp;
+                        B[i] += use_e_mdot_cp * Tank.UseInletTemp;
+
+                        // Source side heat transfer rate
+                        if ((Tank.HeatPumpNum > 0) && (HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterPumped)) {
+                            // Pumped Condenser Heat Pump Water Heater
+                            if (tank_node.SourceMassFlowRate > 0.0) B[i] += Qheatpump;
+                        } else {
+                            // Source side plant connection (constant temperature)
+                            const Real64 src_e_mdot_cp = tank_node.SourceMassFlowRate * Cp;
+                            A[i] += -src_e_mdot_cp;
+                            B[i] += src_e_mdot_cp * Tank.SourceInletTemp;
+                        }
 
-                    // Internodal flow
-                    A[i] += - (tank_node.MassFlowFromUpper + tank_node.MassFlowFromLower) * Cp;
-                    if (NodeNum > 1) B[i] += tank_node.MassFlowFromUpper * Cp * Tavg[i-1];
-                    if (NodeNum < nTankNodes) B[i] += tank_node.MassFlowFromLower * Cp * Tavg[i+1];
+                        // Wrapped condenser heat pump water heater
+                        if ((Tank.HeatPumpNum > 0) && (HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterWrapped)) {
+                            B[i] += Qheatpump * tank_node.HPWHWrappedCondenserHeatingFrac;
+                        }
 
-                    // Divide by mass and specific heat
-                    // m * cp * dT/dt = q_net  =>  dT/dt = a * T + b
-                    A[i] /= tank_node.Mass * Cp;
-                    B[i] /= tank_node.Mass * Cp;
+                        // Internodal flow
+                        A[i] += - (tank_node.MassFlowFromUpper + tank_node.MassFlowFromLower) * Cp;
+                        if (NodeNum > 1) B[i] += tank_node.MassFlowFromUpper * Cp * Tavg[i-1];
+                        if (NodeNum < nTankNodes) B[i] += tank_node.MassFlowFromLower * Cp * Tavg[i+1];
 
+                        // Divide by mass and specific heat
+                        // m * cp * dT/dt = q_net  =>  dT/dt = a * T + b
+                        A[i] /= tank_node.Mass * Cp;
+                        B[i] /= tank_node.Mass * Cp;
 
-                } // end for each node
 
-                // Calculate the average and final temperatures over the interval
-                Real64 TfinalDiff = 0.0;
-                for (int i=0; i < nTankNodes; ++i) {
-                    const Real64 Tstart = Tank.Node[i].Temp;
-                    const Real64 b_a = B[i] / A[i];
-                    const Real64 e_a_dt = exp(A[i] * dt);
-                    Tavg[i] = (Tstart + b_a) * (e_a_dt - 1.0) / (A[i] * dt) - b_a;
-                    const Real64 Tfinal_old = Tfinal[i];
-                    Tfinal[i] = (Tstart + b_a) * e_a_dt - b_a;
-                    TfinalDiff = max(fabs(Tfinal[i] - Tfinal_old), TfinalDiff);
-                }
+                    } // end for each node
+
+                    // Calculate the average and final temperatures over the interval
+                    Real64 TfinalDiff = 0.0;
+                    for (int i=0; i < nTankNodes; ++i) {
+                        const Real64 Tstart = Tank.Node[i].Temp;
+                        const Real64 b_a = B[i] / A[i];
+                        const Real64 e_a_dt = exp(A[i] * dt);
+                        Tavg[i] = (Tstart + b_a) * (e_a_dt - 1.0) / (A[i] * dt) - b_a;
+                        const Real64 Tfinal_old = Tfinal[i];
+                        Tfinal[i] = (Tstart + b_a) * e_a_dt - b_a;
+                        TfinalDiff = max(fabs(Tfinal[i] - Tfinal_old), TfinalDiff);
+                    }
+
+                    if (TfinalDiff < TemperatureConvergenceCriteria) break;
+                } // end temperature convergence loop
 
-                if (TfinalDiff < TemperatureConvergenceCriteria) break;
-            } // end temperature convergence loop
+            } // end explicit node solution
 
             // Inversion mixing
             bool HasInversion;
@@ -8236,7 +8344,11 @@ namespace WaterThermalTanks {
                             Real64 FinalFactorMixing;
                             Real64 AvgFactorMixing;
                             const Real64 NodeCapacitance = Tank.Node[k].Mass * Cp;
-                            if (A[k] == 0.0) {
+                            if (DataSystemVariables::StratifiedTankImplicit) {
+                                // Backward Euler: the mixing heat acts on the final temperature, which is also the average
+                                FinalFactorMixing = dt / NodeCapacitance;
+                                AvgFactorMixing = FinalFactorMixing;
+                            } else if (A[k] == 0.0) {
                                 FinalFactorMixing = dt / NodeCapacitance;
                                 AvgFactorMixing = FinalFactorMixing / 2.0;
                             } else {
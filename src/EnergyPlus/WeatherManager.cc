@@ -47,9 +47,14 @@
 
 // C++ Headers
 #include <array>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
+#include <fstream>
+#include <iterator>
 #include <memory>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -73,6 +78,7 @@
 #include <DataSystemVariables.hh>
 #include <DisplayRoutines.hh>
 #include <EMSManager.hh>
+#include <FileSystem.hh>
 #include <General.hh>
 #include <GlobalNames.hh>
 #include <GroundTemperatureModeling/GroundTemperatureModelManager.hh>
@@ -381,6 +387,113 @@ namespace WeatherManager {
     std::vector<UnderwaterBoundary> underwaterBoundaries;
     AnnualMonthlyDryBulbWeatherData OADryBulbAverage; // processes outside air drybulb temperature
 
+    namespace {
+        // Weather record cache (EP_WEATHER_CACHE).  While it is active the data lines of the weather file are handed
+        // out from memory, and the fields InterpretWeatherDataLine produces for a line are kept so the line is only
+        // parsed the first time it is used.  The parsed records are written to the cache directory when the weather
+        // file is closed, so later runs on the same weather file start with them.
+        struct WeatherCacheRecord
+        {
+            // Members
+            std::int32_t Parsed;            // 1 once the fields below have been filled in by InterpretWeatherDataLine
+            std::int32_t MissedWeathCodes;  // 1 when interpreting the line counted a missing weather code
+            std::int32_t Date[5];           // year, month, day, hour, minute
+            std::int32_t PresWeathObs;      // present weather observation indicator
+            std::int32_t PresWeathConds[9]; // present weather codes
+            std::int32_t Spare;             // keeps Fields aligned
+            Real64 Fields[26];              // numeric fields, in the order of the InterpretWeatherDataLine arguments
+        };
+
+        std::uint64_t const WeatherCacheVersion(1);
+        std::string WeatherCacheSource;   // weather file whose data lines are held below
+        std::string WeatherCacheText;     // contents of WeatherCacheSource
+        std::string WeatherCacheFileName; // cache file for the parsed records of WeatherCacheSource
+        std::uint64_t WeatherCacheHash(0); // hash of WeatherCacheText
+        std::vector<std::pair<std::size_t, std::size_t>> WeatherCacheLines; // start and length of each data line in WeatherCacheText
+        std::vector<WeatherCacheRecord> WeatherCacheRecords;                // parsed fields of each data line
+        std::size_t WeatherCacheCursor(0);  // next data line handed out by ReadWeatherDataLine
+        std::size_t WeatherCachePending(0); // data line (1-based) last handed out by ReadWeatherDataLine, 0 if none
+        bool WeatherCacheActive(false);     // data lines are being read from the cache instead of the weather file
+        bool WeatherCacheChanged(false);    // records were parsed that are not in the cache file yet
+
+        WeatherCacheRecord *PendingWeatherCacheRecord(std::string const &Line)
+        {
+            // Returns the record of the data line last handed out by ReadWeatherDataLine when Line is that data line
+            if (!WeatherCacheActive || WeatherCachePending == 0) return nullptr;
+            std::size_t const RecNum = WeatherCachePending - 1;
+            WeatherCachePending = 0;
+            auto const &DataLine = WeatherCacheLines[RecNum];
+            if (Line.compare(0, std::string::npos, WeatherCacheText, DataLine.first, DataLine.second) != 0) return nullptr;
+            return &WeatherCacheRecords[RecNum];
+        }
+
+        // Time step weather tables.  The sun position, the derived outdoor psychrometrics and the exterior daylight
+        // illuminances of a time step only depend on the weather arrays and sun coefficients of the day, so
+        // SetCurrentWeather keeps them per time step of the day and restores them when the same weather day is
+        // simulated again: on every warmup day, and on each repeat of a design day during sizing.
+        struct TimeStepWeatherValues
+        {
+            // Members
+            bool Computed; // true once SetCurrentWeather has filled in this time step
+            bool SunIsUp;
+            Real64 SOLCOS[3];
+            Real64 HrAngle;
+            Real64 SolarAltitudeAngle;
+            Real64 SolarAzimuthAngle;
+            Real64 OutHumRat;
+            Real64 OutWetBulbTemp;
+            Real64 OutDewPointTemp;
+            Real64 OutEnthalpy;
+            Real64 OutAirDensity;
+            Real64 CloudFraction;
+            Real64 PDIFLW;
+            Real64 PDIRLW;
+            Real64 HISKF;
+            Real64 HISUNF;
+            Real64 HISUNFnorm;
+            Real64 SkyClearness;
+            Real64 SkyBrightness;
+
+            // Default Constructor
+            TimeStepWeatherValues()
+                : Computed(false), SunIsUp(false), SOLCOS{0.0, 0.0, 0.0}, HrAngle(0.0), SolarAltitudeAngle(0.0), SolarAzimuthAngle(0.0),
+                  OutHumRat(0.0), OutWetBulbTemp(0.0), OutDewPointTemp(0.0), OutEnthalpy(0.0), OutAirDensity(0.0), CloudFraction(0.0),
+                  PDIFLW(0.0), PDIRLW(0.0), HISKF(0.0), HISUNF(0.0), HISUNFnorm(0.0), SkyClearness(0.0), SkyBrightness(0.0)
+            {
+            }
+        };
+
+        struct TimeStepWeatherTable
+        {
+            // Members
+            std::vector<Real64> WeatherDay;        // day inputs the values were calculated from, see TimeStepWeatherDay
+            Array2D<TimeStepWeatherValues> Values; // (TimeStep, HourOfDay)
+        };
+
+        // Table 0 is used by weather file days, table n by the environments of design day n
+        std::vector<TimeStepWeatherTable> TimeStepWeatherTables;
+        int CurTimeStepWeatherTable(-1); // table of the current day, -1 when SetCurrentWeather calculates every time step
+
+        std::vector<Real64> TimeStepWeatherDay()
+        {
+            // Gathers everything the values of a TimeStepWeatherValues depend on that can change from day to day
+            std::vector<Real64> WeatherDay;
+            WeatherDay.reserve(6 * TodayOutDryBulbTemp.size() + 7);
+            for (Array2D<Real64> const *DayArray :
+                 {&TodayOutDryBulbTemp, &TodayOutDewPointTemp, &TodayOutBaroPress, &TodayOutRelHum, &TodayBeamSolarRad, &TodayDifSolarRad}) {
+                WeatherDay.insert(WeatherDay.end(), DayArray->begin(), DayArray->end());
+            }
+            WeatherDay.push_back(TodayVariables.Month);
+            WeatherDay.push_back(TodayVariables.EquationOfTime);
+            WeatherDay.push_back(TodayVariables.SinSolarDeclinAngle);
+            WeatherDay.push_back(TodayVariables.CosSolarDeclinAngle);
+            WeatherDay.push_back(Latitude);
+            WeatherDay.push_back(Longitude);
+            WeatherDay.push_back(Elevation);
+            return WeatherDay;
+        }
+    } // namespace
+
     // MODULE SUBROUTINES:
 
     // Functions
@@ -557,6 +670,19 @@ namespace WeatherManager {
 
         underwaterBoundaries.clear();
 
+        WeatherCacheSource.clear();
+        WeatherCacheText.clear();
+        WeatherCacheFileName.clear();
+        WeatherCacheHash = 0;
+        WeatherCacheLines.clear();
+        WeatherCacheRecords.clear();
+        WeatherCacheCursor = 0;
+        WeatherCachePending = 0;
+        WeatherCacheActive = false;
+        WeatherCacheChanged = false;
+        TimeStepWeatherTables.clear();
+        CurTimeStepWeatherTable = -1;
+
     } // clear_state, for unit tests
 
     void ManageWeather()
@@ -2307,8 +2433,7 @@ namespace WeatherManager {
         }
 
         if (EndEnvrnFlag && (Environment(Envrn).KindOfEnvrn != ksDesignDay) && (Environment(Envrn).KindOfEnvrn != ksHVACSizeDesignDay)) {
-            ObjexxFCL::gio::rewind(WeatherFileUnitNumber);
-            SkipEPlusWFHeader();
+            RewindWeatherDataRecords();
             ReportMissing_RangeData();
         }
 
@@ -2346,7 +2471,7 @@ namespace WeatherManager {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Rick Strand
         //       DATE WRITTEN   June 1997
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, select the time step weather table of the day
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -2422,6 +2547,41 @@ namespace WeatherManager {
         EquationOfTime = TodayVariables.EquationOfTime;
         CosSolarDeclinAngle = TodayVariables.CosSolarDeclinAngle;
         SinSolarDeclinAngle = TodayVariables.SinSolarDeclinAngle;
+
+        SelectTimeStepWeatherTable();
+    }
+
+    void SelectTimeStepWeatherTable()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       DATE WRITTEN   October 2026
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Picks the time step weather table SetCurrentWeather uses for the day that UpdateWeatherData just moved
+        // into the Today arrays.  A table is kept while the day it was filled for comes around again unchanged,
+        // and started over otherwise.
+
+        // METHODOLOGY EMPLOYED:
+        // Design day environments each have their own table, so the sizing passes over several design days all
+        // find theirs again.  Weather file days share one table, which in practice is reused over the warmup days.
+
+        CurTimeStepWeatherTable = -1;
+        if (varyingLocationSchedIndexLat > 0 || varyingLocationSchedIndexLong > 0) return; // the sun moves within the day
+
+        int TableNum(0);
+        if (Environment(Envrn).KindOfEnvrn == ksDesignDay || Environment(Envrn).KindOfEnvrn == ksHVACSizeDesignDay) {
+            TableNum = Environment(Envrn).DesignDayNum;
+        }
+        if (TableNum >= int(TimeStepWeatherTables.size())) TimeStepWeatherTables.resize(TableNum + 1);
+
+        TimeStepWeatherTable &Table = TimeStepWeatherTables[TableNum];
+        std::vector<Real64> WeatherDay(TimeStepWeatherDay());
+        if (WeatherDay != Table.WeatherDay || Table.Values.size1() != std::size_t(NumOfTimeStepInHour)) {
+            Table.WeatherDay.swap(WeatherDay);
+            Table.Values.dimension(NumOfTimeStepInHour, 24, TimeStepWeatherValues());
+        }
+        CurTimeStepWeatherTable = TableNum;
     }
 
     void SetCurrentWeather()
@@ -2434,6 +2594,7 @@ namespace WeatherManager {
         //                      Nov98 (FCW) Added call to get exterior illuminances
         //                      Jan02 (FCW) Changed how ground reflectance for daylighting is set
         //                      Mar12 (LKL) Changed settings for leap years/ current years.
+        //                      October 2026, restore values derived from the day's weather from the time step weather table
         //       RE-ENGINEERED  Apr97,May97 (RKS)
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -2510,10 +2671,29 @@ namespace WeatherManager {
 
         CalcWaterMainsTemp();
 
+        // Values derived from the weather of the day are restored when this time step was calculated before for
+        // the same weather day, unless EMS overrides the weather they are derived from
+        TimeStepWeatherValues *TimeStepValues(nullptr);
+        if (CurTimeStepWeatherTable >= 0 && !EMSOutDryBulbOverrideOn && !EMSOutDewPointTempOverrideOn && !EMSOutRelHumOverrideOn &&
+            !EMSDifSolarRadOverrideOn && !EMSBeamSolarRadOverrideOn) {
+            TimeStepValues = &TimeStepWeatherTables[CurTimeStepWeatherTable].Values(TimeStep, HourOfDay);
+        }
+        bool const RestoreTimeStepValues(TimeStepValues != nullptr && TimeStepValues->Computed);
+
         // Determine if Sun is up or down, set Solar Cosine values for time step.
-        DetermineSunUpDown(SOLCOS);
-        if (SunIsUp && SolarAltitudeAngle < 0.0) {
-            ShowFatalError("SetCurrentWeather: At " + CurMnDyHr + " Sun is Up but Solar Altitude Angle is < 0.0");
+        if (RestoreTimeStepValues) {
+            SunIsUp = TimeStepValues->SunIsUp;
+            SOLCOS(1) = TimeStepValues->SOLCOS[0];
+            SOLCOS(2) = TimeStepValues->SOLCOS[1];
+            SOLCOS(3) = TimeStepValues->SOLCOS[2];
+            HrAngle = TimeStepValues->HrAngle;
+            SolarAltitudeAngle = TimeStepValues->SolarAltitudeAngle;
+            SolarAzimuthAngle = TimeStepValues->SolarAzimuthAngle;
+        } else {
+            DetermineSunUpDown(SOLCOS);
+            if (SunIsUp && SolarAltitudeAngle < 0.0) {
+                ShowFatalError("SetCurrentWeather: At " + CurMnDyHr + " Sun is Up but Solar Altitude Angle is < 0.0");
+            }
         }
 
         OutDryBulbTemp = TodayOutDryBulbTemp(TimeStep, HourOfDay);
@@ -2529,17 +2709,23 @@ namespace WeatherManager {
         }
 
         // Humidity Ratio and Wet Bulb are derived
-        OutHumRat = PsyWFnTdbRhPb(OutDryBulbTemp, OutRelHumValue, OutBaroPress, RoutineName);
-        OutWetBulbTemp = PsyTwbFnTdbWPb(OutDryBulbTemp, OutHumRat, OutBaroPress);
-        if (OutDryBulbTemp < OutWetBulbTemp) {
-            OutWetBulbTemp = OutDryBulbTemp;
-            TempVal = PsyWFnTdbTwbPb(OutDryBulbTemp, OutWetBulbTemp, OutBaroPress);
-            TempDPVal = PsyTdpFnWPb(TempVal, OutBaroPress);
-            OutDewPointTemp = TempDPVal;
-        }
+        if (RestoreTimeStepValues) {
+            OutHumRat = TimeStepValues->OutHumRat;
+            OutWetBulbTemp = TimeStepValues->OutWetBulbTemp;
+            OutDewPointTemp = TimeStepValues->OutDewPointTemp;
+        } else {
+            OutHumRat = PsyWFnTdbRhPb(OutDryBulbTemp, OutRelHumValue, OutBaroPress, RoutineName);
+            OutWetBulbTemp = PsyTwbFnTdbWPb(OutDryBulbTemp, OutHumRat, OutBaroPress);
+            if (OutDryBulbTemp < OutWetBulbTemp) {
+                OutWetBulbTemp = OutDryBulbTemp;
+                TempVal = PsyWFnTdbTwbPb(OutDryBulbTemp, OutWetBulbTemp, OutBaroPress);
+                TempDPVal = PsyTdpFnWPb(TempVal, OutBaroPress);
+                OutDewPointTemp = TempDPVal;
+            }
 
-        if (OutDewPointTemp > OutWetBulbTemp) {
-            OutDewPointTemp = OutWetBulbTemp;
+            if (OutDewPointTemp > OutWetBulbTemp) {
+                OutDewPointTemp = OutWetBulbTemp;
+            }
         }
 
         if ((KindOfSim == ksDesignDay) || (KindOfSim == ksHVACSizeDesignDay)) {
@@ -2612,8 +2798,13 @@ namespace WeatherManager {
         }
 
         // Calc some values
-        OutEnthalpy = PsyHFnTdbW(OutDryBulbTemp, OutHumRat);
-        OutAirDensity = PsyRhoAirFnPbTdbW(OutBaroPress, OutDryBulbTemp, OutHumRat);
+        if (RestoreTimeStepValues) {
+            OutEnthalpy = TimeStepValues->OutEnthalpy;
+            OutAirDensity = TimeStepValues->OutAirDensity;
+        } else {
+            OutEnthalpy = PsyHFnTdbW(OutDryBulbTemp, OutHumRat);
+            OutAirDensity = PsyRhoAirFnPbTdbW(OutBaroPress, OutDryBulbTemp, OutHumRat);
+        }
 
         // Make sure outwetbulbtemp is valid.  And that no error occurs here.
         if (OutDryBulbTemp < OutWetBulbTemp) OutWetBulbTemp = OutDryBulbTemp;
@@ -2624,7 +2815,42 @@ namespace WeatherManager {
         }
         // Get exterior daylight illuminance for daylighting calculation
 
-        DayltgCurrentExtHorizIllum();
+        if (RestoreTimeStepValues) {
+            CloudFraction = TimeStepValues->CloudFraction;
+            PDIFLW = TimeStepValues->PDIFLW;
+            PDIRLW = TimeStepValues->PDIRLW;
+            HISKF = TimeStepValues->HISKF;
+            HISUNF = TimeStepValues->HISUNF;
+            HISUNFnorm = TimeStepValues->HISUNFnorm;
+            SkyClearness = TimeStepValues->SkyClearness;
+            SkyBrightness = TimeStepValues->SkyBrightness;
+        } else {
+            DayltgCurrentExtHorizIllum();
+        }
+
+        if (TimeStepValues != nullptr && !TimeStepValues->Computed) {
+            TimeStepValues->Computed = true;
+            TimeStepValues->SunIsUp = SunIsUp;
+            TimeStepValues->SOLCOS[0] = SOLCOS(1);
+            TimeStepValues->SOLCOS[1] = SOLCOS(2);
+            TimeStepValues->SOLCOS[2] = SOLCOS(3);
+            TimeStepValues->HrAngle = HrAngle;
+            TimeStepValues->SolarAltitudeAngle = SolarAltitudeAngle;
+            TimeStepValues->SolarAzimuthAngle = SolarAzimuthAngle;
+            TimeStepValues->OutHumRat = OutHumRat;
+            TimeStepValues->OutWetBulbTemp = OutWetBulbTemp;
+            TimeStepValues->OutDewPointTemp = OutDewPointTemp;
+            TimeStepValues->OutEnthalpy = OutEnthalpy;
+            TimeStepValues->OutAirDensity = OutAirDensity;
+            TimeStepValues->CloudFraction = CloudFraction;
+            TimeStepValues->PDIFLW = PDIFLW;
+            TimeStepValues->PDIRLW = PDIRLW;
+            TimeStepValues->HISKF = HISKF;
+            TimeStepValues->HISUNF = HISUNF;
+            TimeStepValues->HISUNFnorm = HISUNFnorm;
+            TimeStepValues->SkyClearness = SkyClearness;
+            TimeStepValues->SkyBrightness = SkyBrightness;
+        }
 
         if (!IsRain) {
             RptIsRain = 0;
@@ -2821,7 +3047,7 @@ namespace WeatherManager {
         };
 
         // Object Data
-        HourlyWeatherData Wthr;
+        static HourlyWeatherData Wthr; // every hour is set before it is used, kept so its arrays are not allocated each day
 
         if (DayToRead == 1) {
 
@@ -2842,11 +3068,7 @@ namespace WeatherManager {
             WMinute = 0;
             LastHourSet = false;
             while (!Ready) {
-                {
-                    IOFlags flags;
-                    ObjexxFCL::gio::read(WeatherFileUnitNumber, fmtA, flags) >> WeatherDataLine;
-                    ReadStatus = flags.ios();
-                }
+                ReadWeatherDataLine(WeatherDataLine, ReadStatus);
                 if (ReadStatus == 0) {
                     // Reduce ugly code
                     InterpretWeatherDataLine(WeatherDataLine,
@@ -2892,14 +3114,9 @@ namespace WeatherManager {
                         }
                         ShowSevereError("Multiple rewinds on EPW while searching for first day " + date);
                     } else {
-                        ObjexxFCL::gio::rewind(WeatherFileUnitNumber);
+                        RewindWeatherDataRecords();
                         ++NumRewinds;
-                        SkipEPlusWFHeader();
-                        {
-                            IOFlags flags;
-                            ObjexxFCL::gio::read(WeatherFileUnitNumber, fmtA, flags) >> WeatherDataLine;
-                            ReadStatus = flags.ios();
-                        }
+                        ReadWeatherDataLine(WeatherDataLine, ReadStatus);
                         InterpretWeatherDataLine(WeatherDataLine,
                                                  ErrorFound,
                                                  WYear,
@@ -2958,7 +3175,7 @@ namespace WeatherManager {
                     RecordDateMatch = false;
                 }
                 if (RecordDateMatch) {
-                    ObjexxFCL::gio::backspace(WeatherFileUnitNumber);
+                    BackspaceWeatherDataRecord();
                     Ready = true;
                     if (CurDayOfWeek <= 7) {
                         --CurDayOfWeek;
@@ -3051,11 +3268,7 @@ namespace WeatherManager {
                 } else {
                     //  Must skip this day
                     for (Item = 2; Item <= NumIntervalsPerHour; ++Item) {
-                        {
-                            IOFlags flags;
-                            ObjexxFCL::gio::read(WeatherFileUnitNumber, fmtA, flags) >> WeatherDataLine;
-                            ReadStatus = flags.ios();
-                        }
+                        ReadWeatherDataLine(WeatherDataLine, ReadStatus);
                         if (ReadStatus != 0) {
                             ObjexxFCL::gio::read(WeatherDataLine, fmtLD) >> WYear >> WMonth >> WDay >> WHour >> WMinute;
                             BadRecord = RoundSigDigits(WYear) + '/' + RoundSigDigits(WMonth) + '/' + RoundSigDigits(WDay) + BlankString +
@@ -3066,11 +3279,7 @@ namespace WeatherManager {
                         }
                     }
                     for (Item = 1; Item <= 23 * NumIntervalsPerHour; ++Item) {
-                        {
-                            IOFlags flags;
-                            ObjexxFCL::gio::read(WeatherFileUnitNumber, fmtA, flags) >> WeatherDataLine;
-                            ReadStatus = flags.ios();
-                        }
+                        ReadWeatherDataLine(WeatherDataLine, ReadStatus);
                         if (ReadStatus != 0) {
                             ObjexxFCL::gio::read(WeatherDataLine, fmtLD) >> WYear >> WMonth >> WDay >> WHour >> WMinute;
                             BadRecord = RoundSigDigits(WYear) + '/' + RoundSigDigits(WMonth) + '/' + RoundSigDigits(WDay) + BlankString +
@@ -3132,11 +3341,7 @@ namespace WeatherManager {
             for (Hour = 1; Hour <= 24; ++Hour) {
                 for (CurTimeStep = 1; CurTimeStep <= NumIntervalsPerHour; ++CurTimeStep) {
                     HourRep = double(Hour - 1) + (CurTime * double(CurTimeStep));
-                    {
-                        IOFlags flags;
-                        ObjexxFCL::gio::read(WeatherFileUnitNumber, fmtA, flags) >> WeatherDataLine;
-                        ReadStatus = flags.ios();
-                    }
+                    ReadWeatherDataLine(WeatherDataLine, ReadStatus);
                     if (ReadStatus != 0) WeatherDataLine = BlankString;
                     if (WeatherDataLine == BlankString) {
                         if (Hour == 1) {
@@ -3184,13 +3389,8 @@ namespace WeatherManager {
                     } else {                                         // ReadStatus /=0
                         if (ReadStatus < 0 && NumDataPeriods == 1) { // Standard End-of-file, rewind and position to first day...
                             if (DataPeriods(1).NumDays >= NumDaysInYear) {
-                                ObjexxFCL::gio::rewind(WeatherFileUnitNumber);
-                                SkipEPlusWFHeader();
-                                {
-                                    IOFlags flags;
-                                    ObjexxFCL::gio::read(WeatherFileUnitNumber, fmtA, flags) >> WeatherDataLine;
-                                    ReadStatus = flags.ios();
-                                }
+                                RewindWeatherDataRecords();
+                                ReadWeatherDataLine(WeatherDataLine, ReadStatus);
 
                                 InterpretWeatherDataLine(WeatherDataLine,
                                                          ErrorFound,
@@ -3525,7 +3725,7 @@ namespace WeatherManager {
         } // Try Again While Loop
 
         if (BackSpaceAfterRead) {
-            ObjexxFCL::gio::backspace(WeatherFileUnitNumber);
+            BackspaceWeatherDataRecord();
         }
 
         if (NumIntervalsPerHour == 1 && NumOfTimeStepInHour > 1) {
@@ -3788,7 +3988,7 @@ namespace WeatherManager {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Linda Lawrie
         //       DATE WRITTEN   April 2001
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, reuse the fields of data lines kept by the weather record cache
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -3815,6 +4015,30 @@ namespace WeatherManager {
         // Argument array dimensioning
         WCodesArr.dim(9);
 
+        // A data line handed out by the weather record cache is only interpreted the first time it is used
+        Real64 *const RFields[26] = {&RField1,  &RField2,  &RField3,  &RField4,  &RField5,  &RField6,  &RField7,  &RField8,  &RField9,
+                                     &RField10, &RField11, &RField12, &RField13, &RField14, &RField15, &RField16, &RField17, &RField18,
+                                     &RField19, &RField20, &RField22, &RField23, &RField24, &RField25, &RField26, &RField27};
+        WeatherCacheRecord *const CachedRecord = PendingWeatherCacheRecord(Line);
+        if (CachedRecord != nullptr && CachedRecord->Parsed != 0) {
+            WYear = CachedRecord->Date[0];
+            WMonth = CachedRecord->Date[1];
+            WDay = CachedRecord->Date[2];
+            WHour = CachedRecord->Date[3];
+            WMinute = CachedRecord->Date[4];
+            for (int Field = 0; Field < 26; ++Field) {
+                *RFields[Field] = CachedRecord->Fields[Field];
+            }
+            WObs = CachedRecord->PresWeathObs;
+            for (int Code = 1; Code <= 9; ++Code) {
+                WCodesArr(Code) = CachedRecord->PresWeathConds[Code - 1];
+            }
+            if (CachedRecord->MissedWeathCodes != 0) ++Missed.WeathCodes;
+            ErrorFound = false;
+            return;
+        }
+        int const SaveMissedWeathCodes = Missed.WeathCodes;
+
         // Locals
         // SUBROUTINE ARGUMENT DEFINITIONS:
 
@@ -4065,6 +4289,24 @@ namespace WeatherManager {
             WCodesArr = 9;
         }
 
+        if (CachedRecord != nullptr) {
+            CachedRecord->Parsed = 1;
+            CachedRecord->MissedWeathCodes = (Missed.WeathCodes != SaveMissedWeathCodes) ? 1 : 0;
+            CachedRecord->Date[0] = WYear;
+            CachedRecord->Date[1] = WMonth;
+            CachedRecord->Date[2] = WDay;
+            CachedRecord->Date[3] = WHour;
+            CachedRecord->Date[4] = WMinute;
+            for (int Field = 0; Field < 26; ++Field) {
+                CachedRecord->Fields[Field] = *RFields[Field];
+            }
+            CachedRecord->PresWeathObs = WObs;
+            for (int Code = 1; Code <= 9; ++Code) {
+                CachedRecord->PresWeathConds[Code - 1] = WCodesArr(Code);
+            }
+            WeatherCacheChanged = true;
+        }
+
         return;
 
     Label900:;
@@ -5284,7 +5526,7 @@ namespace WeatherManager {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Linda K. Lawrie
         //       DATE WRITTEN   June 1999
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, start the weather record cache once the data records are reached
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -5359,6 +5601,8 @@ namespace WeatherManager {
             SkipEPlusWFHeader();
         }
 
+        if (!DataSystemVariables::WeatherCacheDirectory.empty()) StartWeatherRecordCache();
+
         return;
 
     Label9997:;
@@ -5381,7 +5625,7 @@ namespace WeatherManager {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Linda Lawrie
         //       DATE WRITTEN   February 2001
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, write the weather record cache
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -5422,6 +5666,197 @@ namespace WeatherManager {
             EPWOpen = flags.open();
         }
         if (EPWOpen) ObjexxFCL::gio::close(unitnumber);
+
+        if (WeatherCacheActive) WriteWeatherRecordCache();
+        WeatherCacheActive = false;
+        WeatherCachePending = 0;
+    }
+
+    void StartWeatherRecordCache()
+    {
+        // PURPOSE OF THIS SUBROUTINE:
+        // Switches the data record reads of the weather file that OpenEPlusWeatherFile just positioned at its first
+        // data record over to the weather record cache.  The weather file is kept in memory between environments, and
+        // records parsed in an earlier run on the same weather file are loaded from the cache directory.
+
+        // METHODOLOGY EMPLOYED:
+        // The cache file is named after a hash of the weather file contents, so an edited weather file never picks
+        // up stale records.  Data lines are split the way the formatted reads split them: a line ends at a line feed
+        // and loses a trailing carriage return, and a last line that is not terminated reads as end of file.
+
+        WeatherCacheActive = false;
+        WeatherCachePending = 0;
+        WeatherCacheCursor = 0;
+
+        if (WeatherCacheSource != DataStringGlobals::inputWeatherFileName) {
+            WeatherCacheSource.clear();
+            WeatherCacheText.clear();
+            WeatherCacheFileName.clear();
+            WeatherCacheLines.clear();
+            WeatherCacheRecords.clear();
+            WeatherCacheChanged = false;
+
+            // The data records start where reading the header left the weather file
+            std::istream *WeatherStream = ObjexxFCL::gio::inp_stream(WeatherFileUnitNumber);
+            if (WeatherStream == nullptr) return;
+            std::streamoff const DataStart = WeatherStream->tellg();
+            if (DataStart < 0) return;
+
+            std::ifstream ifs(DataStringGlobals::inputWeatherFileName, std::ios::binary);
+            if (!ifs) return;
+            WeatherCacheText.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+            if (DataStart > std::streamoff(WeatherCacheText.size())) {
+                WeatherCacheText.clear();
+                return;
+            }
+
+            std::size_t Start = std::size_t(DataStart);
+            while (Start < WeatherCacheText.size()) {
+                std::size_t const End = WeatherCacheText.find('\n', Start);
+                if (End == std::string::npos) break;
+                std::size_t Length = End - Start;
+                if (Length > 0 && WeatherCacheText[End - 1] == '\r') --Length;
+                WeatherCacheLines.emplace_back(Start, Length);
+                Start = End + 1;
+            }
+            WeatherCacheRecords.assign(WeatherCacheLines.size(), WeatherCacheRecord());
+            WeatherCacheSource = DataStringGlobals::inputWeatherFileName;
+
+            WeatherCacheHash = WeatherFileHash(WeatherCacheText);
+            WeatherCacheFileName = WeatherRecordCacheFileName(WeatherCacheHash);
+            ReadWeatherRecordCache();
+        }
+
+        WeatherCacheActive = true;
+    }
+
+    std::uint64_t WeatherFileHash(std::string const &WeatherFileText)
+    {
+        // PURPOSE OF THIS FUNCTION:
+        // FNV-1a hash of the weather file contents, which identifies the weather record cache file.
+
+        return FileSystem::hashString(WeatherFileText);
+    }
+
+    std::string WeatherRecordCacheFileName(std::uint64_t const Hash)
+    {
+        // PURPOSE OF THIS FUNCTION:
+        // Name of the weather record cache file for the weather file with the given hash.
+
+        return DataSystemVariables::WeatherCacheDirectory + DataStringGlobals::pathChar + FileSystem::hashToHex(Hash) + ".wthcache";
+    }
+
+    void ReadWeatherRecordCache()
+    {
+        // PURPOSE OF THIS SUBROUTINE:
+        // Loads the parsed records written by WriteWeatherRecordCache.  A file that does not match the weather file,
+        // this build or the number of data lines is ignored and the records are parsed again.
+
+        std::ifstream ifs(WeatherCacheFileName, std::ios::binary);
+        if (!ifs) return;
+
+        std::uint64_t Header[4] = {0, 0, 0, 0};
+        ifs.read(reinterpret_cast<char *>(Header), sizeof(Header));
+        if (!ifs || Header[0] != WeatherCacheVersion || Header[1] != WeatherCacheHash || Header[2] != WeatherCacheRecords.size() ||
+            Header[3] != sizeof(WeatherCacheRecord)) {
+            return;
+        }
+
+        // Check the length first so a truncated file cannot leave partly loaded records behind
+        std::streamoff const ExpectedSize(sizeof(Header) + sizeof(WeatherCacheRecord) * WeatherCacheRecords.size());
+        ifs.seekg(0, std::ios::end);
+        if (ifs.tellg() != ExpectedSize) return;
+        ifs.seekg(sizeof(Header), std::ios::beg);
+
+        std::vector<WeatherCacheRecord> Records(WeatherCacheRecords.size());
+        ifs.read(reinterpret_cast<char *>(Records.data()), sizeof(WeatherCacheRecord) * Records.size());
+        if (ifs) WeatherCacheRecords.swap(Records);
+    }
+
+    void WriteWeatherRecordCache()
+    {
+        // PURPOSE OF THIS SUBROUTINE:
+        // Stores the parsed records for ReadWeatherRecordCache when records were parsed since the cache file was read.
+        // The records are written in their own memory layout, so a cache file is only meant to be read back by the
+        // same build on the same platform.
+
+        // METHODOLOGY EMPLOYED:
+        // The file is written under a temporary name and renamed into place, so runs sharing the cache directory
+        // never read a partly written file.  Failing to store the cache only costs the next run the parsing.
+
+        if (!WeatherCacheChanged || WeatherCacheFileName.empty()) return;
+        WeatherCacheChanged = false;
+
+        std::string const TempFileName =
+            WeatherCacheFileName + '.' + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".tmp";
+        {
+            std::ofstream ofs(TempFileName, std::ios::binary | std::ios::trunc);
+            if (!ofs) {
+                ShowWarningError("WriteWeatherRecordCache: could not open " + TempFileName + ", weather records will not be cached.");
+                return;
+            }
+            std::uint64_t const Header[4] = {WeatherCacheVersion, WeatherCacheHash, WeatherCacheRecords.size(), sizeof(WeatherCacheRecord)};
+            ofs.write(reinterpret_cast<char const *>(Header), sizeof(Header));
+            ofs.write(reinterpret_cast<char const *>(WeatherCacheRecords.data()), sizeof(WeatherCacheRecord) * WeatherCacheRecords.size());
+        }
+        if (std::rename(TempFileName.c_str(), WeatherCacheFileName.c_str()) != 0) {
+            // rename does not replace an existing file everywhere
+            std::remove(WeatherCacheFileName.c_str());
+            if (std::rename(TempFileName.c_str(), WeatherCacheFileName.c_str()) != 0) std::remove(TempFileName.c_str());
+        }
+    }
+
+    void ReadWeatherDataLine(std::string &Line, // next data record of the weather file
+                             int &ReadStatus    // 0 when a record was read, negative at the end of the weather file
+    )
+    {
+        // PURPOSE OF THIS SUBROUTINE:
+        // Reads the next data record of the weather file, from the weather record cache when it is active.
+
+        if (WeatherCacheActive) {
+            if (WeatherCacheCursor < WeatherCacheLines.size()) {
+                auto const &DataLine = WeatherCacheLines[WeatherCacheCursor];
+                Line.assign(WeatherCacheText, DataLine.first, DataLine.second);
+                WeatherCachePending = ++WeatherCacheCursor;
+                ReadStatus = 0;
+            } else {
+                Line.clear();
+                WeatherCachePending = 0;
+                ReadStatus = -1;
+            }
+            return;
+        }
+
+        IOFlags flags;
+        ObjexxFCL::gio::read(WeatherFileUnitNumber, fmtA, flags) >> Line;
+        ReadStatus = flags.ios();
+    }
+
+    void RewindWeatherDataRecords()
+    {
+        // PURPOSE OF THIS SUBROUTINE:
+        // Positions the weather file back at its first data record.
+
+        WeatherCachePending = 0;
+        if (WeatherCacheActive) {
+            WeatherCacheCursor = 0;
+            return;
+        }
+        ObjexxFCL::gio::rewind(WeatherFileUnitNumber);
+        SkipEPlusWFHeader();
+    }
+
+    void BackspaceWeatherDataRecord()
+    {
+        // PURPOSE OF THIS SUBROUTINE:
+        // Positions the weather file back by one data record, so the record last read is read again.
+
+        WeatherCachePending = 0;
+        if (WeatherCacheActive) {
+            if (WeatherCacheCursor > 0) --WeatherCacheCursor;
+            return;
+        }
+        ObjexxFCL::gio::backspace(WeatherFileUnitNumber);
     }
 
     void ResolveLocationInformation(bool &ErrorsFound) // Set to true if no location evident
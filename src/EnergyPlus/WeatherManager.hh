@@ -49,6 +49,7 @@
 #define WeatherManager_hh_INCLUDED
 
 // C++ Headers
+#include <cstdint>
 #include <vector>
 
 // ObjexxFCL Headers
@@ -721,6 +722,8 @@ namespace WeatherManager {
 
     void UpdateWeatherData();
 
+    void SelectTimeStepWeatherTable();
+
     void SetCurrentWeather();
 
     void ReadWeatherForDay(int const DayToRead,          // =1 when starting out, otherwise signifies next day
@@ -823,6 +826,24 @@ namespace WeatherManager {
 
     void CloseWeatherFile();
 
+    void StartWeatherRecordCache();
+
+    std::uint64_t WeatherFileHash(std::string const &WeatherFileText);
+
+    std::string WeatherRecordCacheFileName(std::uint64_t const Hash);
+
+    void ReadWeatherRecordCache();
+
+    void WriteWeatherRecordCache();
+
+    void ReadWeatherDataLine(std::string &Line, // next data record of the weather file
+                             int &ReadStatus    // 0 when a record was read, negative at the end of the weather file
+    );
+
+    void RewindWeatherDataRecords();
+
+    void BackspaceWeatherDataRecord();
+
     void ResolveLocationInformation(bool &ErrorsFound); // Set to true if no location evident
 
     void CheckLocationValidity();
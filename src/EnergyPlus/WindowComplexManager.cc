@@ -56,6 +56,9 @@
 #include <ObjexxFCL/ArrayS.functions.hh>
 #include <ObjexxFCL/Fmath.hh>
 
+// Eigen Headers
+#include <Eigen/Core>
+
 // EnergyPlus Headers
 #include <DataComplexFenestration.hh>
 #include <DataEnvironment.hh>
@@ -159,6 +162,9 @@ namespace WindowComplexManager {
     Array1D<BasisStruct> BasisList;
     Array1D<WindowIndex> WindowList;
     Array2D<WindowStateIndex> WindowStateList;
+    Array1D_int StaticPropertiesSurf;     // Window whose state first calculated the construction static properties, by construction
+    Array1D_int StaticPropertiesState;    // State of that window, by construction
+    Array1D<TARCOGMemoStruct> TARCOGMemo; // Last TARCOG solution, by surface
 
     // Functions
 
@@ -168,6 +174,9 @@ namespace WindowComplexManager {
         BasisList.deallocate();
         WindowList.deallocate();
         WindowStateList.deallocate();
+        StaticPropertiesSurf.deallocate();
+        StaticPropertiesState.deallocate();
+        TARCOGMemo.deallocate();
     }
 
     void InitBSDFWindows()
@@ -470,6 +479,7 @@ namespace WindowComplexManager {
         int NLayers; // Number of complex fenestration layers
         int NBkSurf; // Number of back surfaces
         int KBkSurf; // Back surfaces counter
+        int JSurf;   // Back surface number
 
         NLayers = SurfaceWindow(iSurf).ComplexFen.State(iState).NLayers;
         NBkSurf = ComplexWind(iSurf).NBkSurf;
@@ -486,6 +496,11 @@ namespace WindowComplexManager {
         SurfaceWindow(iSurf).ComplexFen.State(iState).WinToSurfBmTrans.allocate(24, NumOfTimeStepInHour, NBkSurf);
         SurfaceWindow(iSurf).ComplexFen.State(iState).BkSurf.allocate(NBkSurf);
         for (KBkSurf = 1; KBkSurf <= NBkSurf; ++KBkSurf) {
+            // Back surface properties are only calculated for back surfaces that are windows
+            JSurf = ShadowComb(Surface(iSurf).BaseSurf).BackSurf(KBkSurf);
+            if (!(Surface(JSurf).Class == SurfaceClass_Window || Surface(JSurf).Class == SurfaceClass_GlassDoor ||
+                  SurfaceWindow(JSurf).WindowModelType == WindowBSDFModel))
+                continue;
             SurfaceWindow(iSurf).ComplexFen.State(iState).BkSurf(KBkSurf).WinDHBkRefl.allocate(24, NumOfTimeStepInHour);
             SurfaceWindow(iSurf).ComplexFen.State(iState).BkSurf(KBkSurf).WinDirBkAbs.allocate(24, NumOfTimeStepInHour, NLayers);
         }
@@ -999,11 +1014,7 @@ namespace WindowComplexManager {
                 State.WinToSurfBmTrans(Hour, TS, I) = Sum1;
             } // Back surface loop
             // Calculate the directional-hemispherical transmittance
-            Sum1 = 0.0;
-            for (J = 1; J <= Geom.Trn.NBasis; ++J) {
-                Sum1 += Geom.Trn.Lamda(J) * Construct(IConst).BSDFInput.SolFrtTrans(IBm, J);
-            }
-            State.WinDirHemiTrans(Hour, TS) = Sum1;
+            State.WinDirHemiTrans(Hour, TS) = Construct(IConst).BSDFInput.SolFrtTransHemi(IBm);
             // Calculate the directional specular transmittance
             // Note:  again using assumption that Inc and Trn basis have same structure
             State.WinDirSpecTrans(Hour, TS) = Geom.Trn.Lamda(IBm) * Construct(IConst).BSDFInput.SolFrtTrans(IBm, IBm);
@@ -1021,10 +1032,7 @@ namespace WindowComplexManager {
             JRay = Geom.GndIndex(J);
             if (Geom.SolBmGndWt(Hour, TS, J) > 0.0) {
                 Sum2 += Geom.SolBmGndWt(Hour, TS, J) * Geom.Inc.Lamda(JRay);
-                for (M = 1; M <= Geom.Trn.NBasis; ++M) { // Outgoing ray loop
-                    Sum1 +=
-                        Geom.SolBmGndWt(Hour, TS, J) * Geom.Inc.Lamda(JRay) * Geom.Trn.Lamda(M) * Construct(IConst).BSDFInput.SolFrtTrans(JRay, M);
-                } // Outgoing ray loop
+                Sum1 += Geom.SolBmGndWt(Hour, TS, J) * Geom.Inc.Lamda(JRay) * Construct(IConst).BSDFInput.SolFrtTransHemi(JRay);
             }
         } // Indcident ray loop
         if (Sum2 > 0.0) {
@@ -1076,11 +1084,7 @@ namespace WindowComplexManager {
                 // Here calculate the back incidence properties for the solar ray
                 // this does not say whether or not the ray can pass through the
                 // back surface window and hit this one!
-                Sum1 = 0.0;
-                for (J = 1; J <= Geom.Trn.NBasis; ++J) {
-                    Sum1 += Geom.Trn.Lamda(J) * Construct(IConst).BSDFInput.SolBkRefl(BkIncRay, J);
-                }
-                Refl = Sum1;
+                Refl = Construct(IConst).BSDFInput.SolBkReflHemi(BkIncRay);
                 for (L = 1; L <= State.NLayers; ++L) {
                     Absorb(L) = Construct(IConst).BSDFInput.Layer(L).BkAbs(BkIncRay, 1);
                 }
@@ -1965,6 +1969,229 @@ namespace WindowComplexManager {
         TmpSjdotN.deallocate();
     }
 
+    void CalcConstructionStaticProperties(int const IConst,           // Construction of the complex fenestration state
+                                          BSDFGeomDescr const &Geom,  // State Geometry
+                                          BSDFStateDescr &State       // State Description
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Calculates the hemispherical and integrated optical properties of a complex fenestration state
+        // that depend only on the construction's BSDF matrices and basis, not on the window geometry
+
+        // METHODOLOGY EMPLOYED:
+        // Split out of CalcWindowStaticProperties so that windows sharing a construction calculate these once
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+        int J;       // general purpose index
+        int L;       // general purpose index--layer
+        int M;       // general purpose index--ray
+        Real64 Sum1; // general purpose temporary sum
+        Real64 Sum2; // general purpose temporary sum
+        Real64 Sum3; // general purpose temporary sum
+
+        using RowMajorMatrix = Eigen::Matrix<Real64, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+        // Directional-hemispherical front transmittance and back reflectance for each incident direction, used for
+        // each beam direction in CalculateWindowBeamProperties
+        auto &Input(Construct(IConst).BSDFInput);
+        Eigen::Map<Eigen::VectorXd const> TrnLamda(Geom.Trn.Lamda.data(), Geom.Trn.NBasis);
+        Input.SolFrtTransHemi.allocate(Input.SolFrtTrans.isize1());
+        Eigen::Map<Eigen::VectorXd>(Input.SolFrtTransHemi.data(), Input.SolFrtTrans.isize1()) =
+            Eigen::Map<RowMajorMatrix const>(Input.SolFrtTrans.data(), Input.SolFrtTrans.isize1(), Input.SolFrtTrans.isize2())
+                .leftCols(Geom.Trn.NBasis) *
+            TrnLamda;
+        Input.SolBkReflHemi.allocate(Input.SolBkRefl.isize1());
+        Eigen::Map<Eigen::VectorXd>(Input.SolBkReflHemi.data(), Input.SolBkRefl.isize1()) =
+            Eigen::Map<RowMajorMatrix const>(Input.SolBkRefl.data(), Input.SolBkRefl.isize1(), Input.SolBkRefl.isize2())
+                .leftCols(Geom.Trn.NBasis) *
+            TrnLamda;
+
+        // Calculate the hemispherical-hemispherical transmittance
+
+        Sum1 = 0.0;
+        Sum2 = 0.0;
+        for (J = 1; J <= Geom.Inc.NBasis; ++J) { // Incident ray loop
+            Sum2 += Geom.Inc.Lamda(J);
+            for (M = 1; M <= Geom.Trn.NBasis; ++M) { // Outgoing ray loop
+                Sum1 += Geom.Inc.Lamda(J) * Geom.Trn.Lamda(M) * Construct(IConst).BSDFInput.SolFrtTrans(M, J);
+            } // Outgoing ray loop
+        }     // Incident ray loop
+        if (Sum2 > 0) {
+            State.WinDiffTrans = Sum1 / Sum2;
+        } else {
+            State.WinDiffTrans = 0.0;
+            ShowWarningError("BSDF--Inc basis has zero projected solid angle");
+        }
+
+        // Calculate the hemispherical-hemispherical transmittance for visible spetrum
+
+        Sum1 = 0.0;
+        Sum2 = 0.0;
+        for (J = 1; J <= Geom.Inc.NBasis; ++J) { // Incident ray loop
+            Sum2 += Geom.Inc.Lamda(J);
+            for (M = 1; M <= Geom.Trn.NBasis; ++M) { // Outgoing ray loop
+                Sum1 += Geom.Inc.Lamda(J) * Geom.Trn.Lamda(M) * Construct(IConst).BSDFInput.VisFrtTrans(M, J);
+            } // Outgoing ray loop
+        }     // Incident ray loop
+        if (Sum2 > 0.0) {
+            State.WinDiffVisTrans = Sum1 / Sum2;
+        } else {
+            State.WinDiffVisTrans = 0.0;
+            ShowWarningError("BSDF--Inc basis has zero projected solid angle");
+        }
+
+        // Calculate Window Back Hemispherical Reflectance and Layer Back Hemispherical Absorptance
+        Sum1 = 0.0;
+        Sum2 = 0.0;
+        Sum3 = 0.0;
+        // Note this again assumes the equivalence Inc basis = transmission basis for back incidence and
+        // Trn basis = incident basis for back incidence
+        for (J = 1; J <= Geom.Trn.NBasis; ++J) {
+            for (M = 1; M <= Geom.Inc.NBasis; ++M) {
+                Sum1 += Construct(IConst).BSDFInput.SolBkRefl(M, J) * Geom.Trn.Lamda(J) * Geom.Inc.Lamda(M);
+            }
+        }
+        for (J = 1; J <= Geom.Trn.NBasis; ++J) {
+            Sum2 += Geom.Trn.Lamda(J);
+        }
+
+        if (Sum2 != 0.0) {
+            State.WinBkHemRefl = Sum1 / Sum2;
+        } else {
+            State.WinBkHemRefl = 0.0;
+        }
+
+        Construct(IConst).ReflectSolDiffBack = State.WinBkHemRefl;
+
+        State.WinBkHemAbs.allocate(State.NLayers);
+        for (L = 1; L <= State.NLayers; ++L) {
+            for (J = 1; J <= Geom.Trn.NBasis; ++J) {
+                Sum3 += Geom.Trn.Lamda(J) * Construct(IConst).BSDFInput.Layer(L).BkAbs(J, 1);
+            }
+
+            if (Sum2 != 0.0) {
+                State.WinBkHemAbs(L) = Sum3 / Sum2;
+            } else {
+                State.WinBkHemAbs(L) = 0.0;
+            }
+
+            // Put this into the construction for use in non-detailed optical calculations
+            Construct(IConst).AbsDiffBack(L) = State.WinBkHemAbs(L);
+        }
+
+        // Calculate Window Layer Front Hemispherical Absorptance
+        Sum1 = 0.0;
+        Sum2 = 0.0;
+        for (J = 1; J <= Geom.Inc.NBasis; ++J) {
+            Sum2 += Geom.Inc.Lamda(J);
+        }
+        State.WinFtHemAbs.allocate(State.NLayers);
+        for (L = 1; L <= State.NLayers; ++L) {
+            Sum1 = 0.0;
+            for (J = 1; J <= Geom.Inc.NBasis; ++J) {
+                Sum1 += Geom.Inc.Lamda(J) * Construct(IConst).BSDFInput.Layer(L).FrtAbs(J, 1);
+            }
+
+            if (Sum2 != 0.0) {
+                State.WinFtHemAbs(L) = Sum1 / Sum2;
+            } else {
+                State.WinFtHemAbs(L) = 0.0;
+            }
+
+            // Put this into the construction for use in non-detailed optical calculations
+            Construct(IConst).AbsDiff(L) = State.WinFtHemAbs(L);
+        }
+
+        // Calculate Window Back Hemispherical Visible Reflectance
+        Sum1 = 0.0;
+        Sum2 = 0.0;
+        // Note this again assumes the equivalence Inc basis = transmission basis for back incidence and
+        // Trn basis = incident basis for back incidence
+        for (J = 1; J <= Geom.Trn.NBasis; ++J) {
+            for (M = 1; M <= Geom.Inc.NBasis; ++M) {
+                Sum1 += Construct(IConst).BSDFInput.VisBkRefl(M, J) * Geom.Trn.Lamda(J) * Geom.Inc.Lamda(M);
+            }
+        }
+        for (J = 1; J <= Geom.Trn.NBasis; ++J) {
+            Sum2 += Geom.Trn.Lamda(J);
+        }
+
+        if (Sum2 != 0.0) {
+            State.WinBkHemVisRefl = Sum1 / Sum2;
+        } else {
+            State.WinBkHemVisRefl = 0.0;
+        }
+
+        Construct(IConst).ReflectVisDiffBack = State.WinBkHemVisRefl;
+
+        // ********************************************************************************
+        // Allocation and calculation of integrated values for front of window surface
+        // ********************************************************************************
+
+        // Sum of front absorptances for each incident direction (integration of absorptances)
+        if (!allocated(State.IntegratedFtAbs)) State.IntegratedFtAbs.allocate(Geom.Inc.NBasis);
+        for (J = 1; J <= Geom.Inc.NBasis; ++J) {
+            Sum1 = 0.0;
+            for (L = 1; L <= State.NLayers; ++L) { // layer loop
+                Sum1 += Construct(IConst).BSDFInput.Layer(L).FrtAbs(J, 1);
+            }
+            State.IntegratedFtAbs(J) = Sum1;
+        }
+
+        // Integrating front transmittance
+        if (!allocated(State.IntegratedFtTrans)) State.IntegratedFtTrans.allocate(Geom.Inc.NBasis);
+        for (J = 1; J <= Geom.Inc.NBasis; ++J) { // Incident ray loop
+            Sum1 = 0.0;
+            for (M = 1; M <= Geom.Trn.NBasis; ++M) { // Outgoing ray loop
+                Sum1 += Geom.Trn.Lamda(J) * Construct(IConst).BSDFInput.SolFrtTrans(J, M);
+            } // Outgoing ray loop
+            State.IntegratedFtTrans(J) = Sum1;
+        } // Incident ray loop
+
+        if (!allocated(State.IntegratedFtRefl)) State.IntegratedFtRefl.allocate(Geom.Inc.NBasis);
+        // Integrating front reflectance
+        for (J = 1; J <= Geom.Inc.NBasis; ++J) { // Incoming ray loop
+            State.IntegratedFtRefl(J) = 1 - State.IntegratedFtTrans(J) - State.IntegratedFtAbs(J);
+        } // Incoming ray loop
+
+        // ********************************************************************************
+        // Allocation and calculation of integrated values for back of window surface
+        // ********************************************************************************
+
+        // Sum of back absorptances for each incident direction (integration of absorptances)
+        if (!allocated(State.IntegratedBkAbs)) State.IntegratedBkAbs.allocate(Geom.Trn.NBasis);
+        for (J = 1; J <= Geom.Trn.NBasis; ++J) {
+            Sum1 = 0.0;
+            for (L = 1; L <= State.NLayers; ++L) { // layer loop
+                Sum1 += Construct(IConst).BSDFInput.Layer(L).BkAbs(J, 1);
+            }
+            State.IntegratedBkAbs(J) = Sum1;
+        }
+
+        // Integrating back reflectance
+        if (!allocated(State.IntegratedBkRefl)) State.IntegratedBkRefl.allocate(Geom.Trn.NBasis);
+        for (J = 1; J <= Geom.Trn.NBasis; ++J) { // Outgoing ray loop
+            Sum1 = 0.0;
+            for (M = 1; M <= Geom.Inc.NBasis; ++M) { // Incident ray loop
+                Sum1 += Geom.Inc.Lamda(J) * Construct(IConst).BSDFInput.SolBkRefl(J, M);
+            } // Incident ray loop
+            State.IntegratedBkRefl(J) = Sum1;
+        } // Outgoing ray loop
+
+        if (!allocated(State.IntegratedBkTrans)) State.IntegratedBkTrans.allocate(Geom.Trn.NBasis);
+        // Integrating back transmittance
+        for (J = 1; J <= Geom.Trn.NBasis; ++J) { // Outgoing ray loop
+            State.IntegratedBkTrans(J) = 1 - State.IntegratedBkRefl(J) - State.IntegratedBkAbs(J);
+        } // Outgoing ray loop
+    }
+
     void CalcWindowStaticProperties(int const ISurf,             // Surface number of the complex fenestration
                                     int const IState,            // State number of the complex fenestration state
                                     BSDFWindowGeomDescr &Window, // Window Geometry
@@ -2021,38 +2248,30 @@ namespace WindowComplexManager {
 
         IConst = SurfaceWindow(ISurf).ComplexFen.State(IState).Konst;
 
-        // Calculate the hemispherical-hemispherical transmittance
-
-        Sum1 = 0.0;
-        Sum2 = 0.0;
-        for (J = 1; J <= Geom.Inc.NBasis; ++J) { // Incident ray loop
-            Sum2 += Geom.Inc.Lamda(J);
-            for (M = 1; M <= Geom.Trn.NBasis; ++M) { // Outgoing ray loop
-                Sum1 += Geom.Inc.Lamda(J) * Geom.Trn.Lamda(M) * Construct(IConst).BSDFInput.SolFrtTrans(M, J);
-            } // Outgoing ray loop
-        }     // Incident ray loop
-        if (Sum2 > 0) {
-            State.WinDiffTrans = Sum1 / Sum2;
-        } else {
-            State.WinDiffTrans = 0.0;
-            ShowWarningError("BSDF--Inc basis has zero projected solid angle");
+        // The hemispherical and integrated properties depend only on the construction's BSDF matrices and basis, so they
+        // are calculated for the first window state that uses the construction and copied for the others
+        if (!allocated(StaticPropertiesSurf)) {
+            StaticPropertiesSurf.dimension(TotConstructs, 0);
+            StaticPropertiesState.dimension(TotConstructs, 0);
         }
-
-        // Calculate the hemispherical-hemispherical transmittance for visible spetrum
-
-        Sum1 = 0.0;
-        Sum2 = 0.0;
-        for (J = 1; J <= Geom.Inc.NBasis; ++J) { // Incident ray loop
-            Sum2 += Geom.Inc.Lamda(J);
-            for (M = 1; M <= Geom.Trn.NBasis; ++M) { // Outgoing ray loop
-                Sum1 += Geom.Inc.Lamda(J) * Geom.Trn.Lamda(M) * Construct(IConst).BSDFInput.VisFrtTrans(M, J);
-            } // Outgoing ray loop
-        }     // Incident ray loop
-        if (Sum2 > 0.0) {
-            State.WinDiffVisTrans = Sum1 / Sum2;
+        if (StaticPropertiesSurf(IConst) == 0) {
+            CalcConstructionStaticProperties(IConst, Geom, State);
+            StaticPropertiesSurf(IConst) = ISurf;
+            StaticPropertiesState(IConst) = IState;
         } else {
-            State.WinDiffVisTrans = 0.0;
-            ShowWarningError("BSDF--Inc basis has zero projected solid angle");
+            auto const &Source(SurfaceWindow(StaticPropertiesSurf(IConst)).ComplexFen.State(StaticPropertiesState(IConst)));
+            State.WinDiffTrans = Source.WinDiffTrans;
+            State.WinDiffVisTrans = Source.WinDiffVisTrans;
+            State.WinBkHemRefl = Source.WinBkHemRefl;
+            State.WinBkHemVisRefl = Source.WinBkHemVisRefl;
+            State.WinBkHemAbs = Source.WinBkHemAbs;
+            State.WinFtHemAbs = Source.WinFtHemAbs;
+            State.IntegratedFtAbs = Source.IntegratedFtAbs;
+            State.IntegratedFtTrans = Source.IntegratedFtTrans;
+            State.IntegratedFtRefl = Source.IntegratedFtRefl;
+            State.IntegratedBkAbs = Source.IntegratedBkAbs;
+            State.IntegratedBkRefl = Source.IntegratedBkRefl;
+            State.IntegratedBkTrans = Source.IntegratedBkTrans;
         }
 
         // Set the nominal diffuse transmittance so the surface isn't mistaken as opaque
@@ -2138,90 +2357,6 @@ namespace WindowComplexManager {
             }
         }
 
-        // Calculate Window Back Hemispherical Reflectance and Layer Back Hemispherical Absorptance
-        Sum1 = 0.0;
-        Sum2 = 0.0;
-        Sum3 = 0.0;
-        // Note this again assumes the equivalence Inc basis = transmission basis for back incidence and
-        // Trn basis = incident basis for back incidence
-        for (J = 1; J <= Geom.Trn.NBasis; ++J) {
-            for (M = 1; M <= Geom.Inc.NBasis; ++M) {
-                Sum1 += Construct(IConst).BSDFInput.SolBkRefl(M, J) * Geom.Trn.Lamda(J) * Geom.Inc.Lamda(M);
-            }
-        }
-        for (J = 1; J <= Geom.Trn.NBasis; ++J) {
-            Sum2 += Geom.Trn.Lamda(J);
-        }
-
-        if (Sum2 != 0.0) {
-            State.WinBkHemRefl = Sum1 / Sum2;
-        } else {
-            State.WinBkHemRefl = 0.0;
-        }
-
-        Construct(IConst).ReflectSolDiffBack = State.WinBkHemRefl;
-
-        State.WinBkHemAbs.allocate(State.NLayers);
-        for (L = 1; L <= State.NLayers; ++L) {
-            for (J = 1; J <= Geom.Trn.NBasis; ++J) {
-                Sum3 += Geom.Trn.Lamda(J) * Construct(IConst).BSDFInput.Layer(L).BkAbs(J, 1);
-            }
-
-            if (Sum2 != 0.0) {
-                State.WinBkHemAbs(L) = Sum3 / Sum2;
-            } else {
-                State.WinBkHemAbs(L) = 0.0;
-            }
-
-            // Put this into the construction for use in non-detailed optical calculations
-            Construct(IConst).AbsDiffBack(L) = State.WinBkHemAbs(L);
-        }
-
-        // Calculate Window Layer Front Hemispherical Absorptance
-        Sum1 = 0.0;
-        Sum2 = 0.0;
-        for (J = 1; J <= Geom.Inc.NBasis; ++J) {
-            Sum2 += Geom.Inc.Lamda(J);
-        }
-        State.WinFtHemAbs.allocate(State.NLayers);
-        for (L = 1; L <= State.NLayers; ++L) {
-            Sum1 = 0.0;
-            for (J = 1; J <= Geom.Inc.NBasis; ++J) {
-                Sum1 += Geom.Inc.Lamda(J) * Construct(IConst).BSDFInput.Layer(L).FrtAbs(J, 1);
-            }
-
-            if (Sum2 != 0.0) {
-                State.WinFtHemAbs(L) = Sum1 / Sum2;
-            } else {
-                State.WinFtHemAbs(L) = 0.0;
-            }
-
-            // Put this into the construction for use in non-detailed optical calculations
-            Construct(IConst).AbsDiff(L) = State.WinFtHemAbs(L);
-        }
-
-        // Calculate Window Back Hemispherical Visible Reflectance
-        Sum1 = 0.0;
-        Sum2 = 0.0;
-        // Note this again assumes the equivalence Inc basis = transmission basis for back incidence and
-        // Trn basis = incident basis for back incidence
-        for (J = 1; J <= Geom.Trn.NBasis; ++J) {
-            for (M = 1; M <= Geom.Inc.NBasis; ++M) {
-                Sum1 += Construct(IConst).BSDFInput.VisBkRefl(M, J) * Geom.Trn.Lamda(J) * Geom.Inc.Lamda(M);
-            }
-        }
-        for (J = 1; J <= Geom.Trn.NBasis; ++J) {
-            Sum2 += Geom.Trn.Lamda(J);
-        }
-
-        if (Sum2 != 0.0) {
-            State.WinBkHemVisRefl = Sum1 / Sum2;
-        } else {
-            State.WinBkHemVisRefl = 0.0;
-        }
-
-        Construct(IConst).ReflectVisDiffBack = State.WinBkHemVisRefl;
-
         //     *     *     *     *
         // Note potential problem if one relaxes the assumption that Inc and Trn basis have same structure:
         //  The following calculations are made for the set of ray numbers defined in the Trn basis that
@@ -2300,66 +2435,6 @@ namespace WindowComplexManager {
 
             } // layer loop
         }     // back surface loop
-
-        // ********************************************************************************
-        // Allocation and calculation of integrated values for front of window surface
-        // ********************************************************************************
-
-        // Sum of front absorptances for each incident direction (integration of absorptances)
-        if (!allocated(State.IntegratedFtAbs)) State.IntegratedFtAbs.allocate(Geom.Inc.NBasis);
-        for (J = 1; J <= Geom.Inc.NBasis; ++J) {
-            Sum1 = 0.0;
-            for (L = 1; L <= State.NLayers; ++L) { // layer loop
-                Sum1 += Construct(IConst).BSDFInput.Layer(L).FrtAbs(J, 1);
-            }
-            State.IntegratedFtAbs(J) = Sum1;
-        }
-
-        // Integrating front transmittance
-        if (!allocated(State.IntegratedFtTrans)) State.IntegratedFtTrans.allocate(Geom.Inc.NBasis);
-        for (J = 1; J <= Geom.Inc.NBasis; ++J) { // Incident ray loop
-            Sum1 = 0.0;
-            for (M = 1; M <= Geom.Trn.NBasis; ++M) { // Outgoing ray loop
-                Sum1 += Geom.Trn.Lamda(J) * Construct(IConst).BSDFInput.SolFrtTrans(J, M);
-            } // Outgoing ray loop
-            State.IntegratedFtTrans(J) = Sum1;
-        } // Incident ray loop
-
-        if (!allocated(State.IntegratedFtRefl)) State.IntegratedFtRefl.allocate(Geom.Inc.NBasis);
-        // Integrating front reflectance
-        for (J = 1; J <= Geom.Inc.NBasis; ++J) { // Incoming ray loop
-            State.IntegratedFtRefl(J) = 1 - State.IntegratedFtTrans(J) - State.IntegratedFtAbs(J);
-        } // Incoming ray loop
-
-        // ********************************************************************************
-        // Allocation and calculation of integrated values for back of window surface
-        // ********************************************************************************
-
-        // Sum of back absorptances for each incident direction (integration of absorptances)
-        if (!allocated(State.IntegratedBkAbs)) State.IntegratedBkAbs.allocate(Geom.Trn.NBasis);
-        for (J = 1; J <= Geom.Trn.NBasis; ++J) {
-            Sum1 = 0.0;
-            for (L = 1; L <= State.NLayers; ++L) { // layer loop
-                Sum1 += Construct(IConst).BSDFInput.Layer(L).BkAbs(J, 1);
-            }
-            State.IntegratedBkAbs(J) = Sum1;
-        }
-
-        // Integrating back reflectance
-        if (!allocated(State.IntegratedBkRefl)) State.IntegratedBkRefl.allocate(Geom.Trn.NBasis);
-        for (J = 1; J <= Geom.Trn.NBasis; ++J) { // Outgoing ray loop
-            Sum1 = 0.0;
-            for (M = 1; M <= Geom.Inc.NBasis; ++M) { // Incident ray loop
-                Sum1 += Geom.Inc.Lamda(J) * Construct(IConst).BSDFInput.SolBkRefl(J, M);
-            } // Incident ray loop
-            State.IntegratedBkRefl(J) = Sum1;
-        } // Outgoing ray loop
-
-        if (!allocated(State.IntegratedBkTrans)) State.IntegratedBkTrans.allocate(Geom.Trn.NBasis);
-        // Integrating back transmittance
-        for (J = 1; J <= Geom.Trn.NBasis; ++J) { // Outgoing ray loop
-            State.IntegratedBkTrans(J) = 1 - State.IntegratedBkRefl(J) - State.IntegratedBkAbs(J);
-        } // Outgoing ray loop
     }
 
     Real64 SkyWeight(Vector const &EP_UNUSED(DirVec)) // Direction of the element to be weighted
@@ -2918,6 +2993,77 @@ namespace WindowComplexManager {
         if (Cost < 0.0) Theta = Pi - Theta; // This signals ray out of hemisphere
     }
 
+    bool RecallTARCOGSolution(TARCOGMemoStruct const &Memo,  // Stored solution
+                              Array1D<Real64> const &Inputs, // Boundary conditions and absorbed solar of the current call
+                              int const nlayer,              // Number of layers
+                              Array1D<Real64> &theta,        // Surface temperatures [K]
+                              Array1D<Real64> &qv,           // Gap ventilation heat fluxes [W/m^2]
+                              Real64 &hcin,                  // Indoor convective film coefficient [W/m^2.K]
+                              Real64 &ufactor                // Center of glass U-value [W/m^2.K]
+    )
+    {
+
+        // FUNCTION INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS FUNCTION:
+        // Return the stored TARCOG solution when the inputs of the current call match those it was obtained for,
+        // and whether they did
+
+        // FUNCTION PARAMETER DEFINITIONS:
+        Real64 const MemoTolerance(1.0e-6); // Relative difference below which inputs are treated as repeated
+
+        if (!Memo.Valid || Memo.Inputs.size() != Inputs.size()) return false;
+        for (int k = 1; k <= Inputs.isize(); ++k) {
+            if (std::abs(Inputs(k) - Memo.Inputs(k)) > MemoTolerance * (1.0 + std::abs(Memo.Inputs(k)))) return false;
+        }
+        for (int k = 1; k <= 2 * nlayer; ++k) {
+            theta(k) = Memo.theta(k);
+        }
+        for (int k = 1; k <= nlayer + 1; ++k) {
+            qv(k) = Memo.qv(k);
+        }
+        hcin = Memo.hcin;
+        ufactor = Memo.ufactor;
+        return true;
+    }
+
+    void StoreTARCOGSolution(TARCOGMemoStruct &Memo,        // Stored solution
+                             Array1D<Real64> const &Inputs, // Boundary conditions and absorbed solar the solution was obtained for
+                             int const nlayer,              // Number of layers
+                             Array1D<Real64> const &theta,  // Surface temperatures [K]
+                             Array1D<Real64> const &qv,     // Gap ventilation heat fluxes [W/m^2]
+                             Real64 const hcin,             // Indoor convective film coefficient [W/m^2.K]
+                             Real64 const ufactor           // Center of glass U-value [W/m^2.K]
+    )
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Keep a converged TARCOG solution with the inputs it was obtained for (see RecallTARCOGSolution)
+
+        Memo.Inputs = Inputs;
+        Memo.theta.dimension(2 * nlayer);
+        for (int k = 1; k <= 2 * nlayer; ++k) {
+            Memo.theta(k) = theta(k);
+        }
+        Memo.qv.dimension(nlayer + 1);
+        for (int k = 1; k <= nlayer + 1; ++k) {
+            Memo.qv(k) = qv(k);
+        }
+        Memo.hcin = hcin;
+        Memo.ufactor = ufactor;
+        Memo.Valid = true;
+    }
+
     void CalcComplexWindowThermal(int const SurfNum,          // Surface number
                                   int &ConstrNum,             // Construction number
                                   Real64 const HextConvCoeff, // Outside air film conductance coefficient
@@ -2954,6 +3100,7 @@ namespace WindowComplexManager {
         using DataHeatBalance::SupportPillar;
         using DataHeatBalSurface::HcExtSurf;
         using DataLoopNode::Node;
+        using DataSystemVariables::TARCOGResultMemo;
         using DataZoneEquipment::ZoneEquipConfig;
         using General::InterpSlatAng; // Function for slat angle interpolation
         using General::InterpSw;
@@ -3227,6 +3374,7 @@ namespace WindowComplexManager {
                                       //		int ConstrNumSh; // Construction number with shading device
         static int CalcSHGC(0);       // SHGC calculations are not necessary for E+ run
         static int NumOfIterations(0);
+        static Array1D<Real64> memoKey; // Inputs of the current call, compared against the stored solution
 
         int GasType; // locally used coefficent to point at correct gas type
         int ICoeff;
@@ -3686,118 +3834,156 @@ namespace WindowComplexManager {
         else
             edgeGlCorrFac = 1;
 
+        // Boundary conditions often repeat exactly between calls (night time, zone/HVAC iterations with unchanged window
+        // conditions). When they match the last solution for this window, reuse that solution.
+        bool memoHit = false;
+        if (TARCOGResultMemo && CalcCondition == noCondition) {
+            if (!allocated(TARCOGMemo)) TARCOGMemo.allocate(TotSurfaces);
+            auto &memo(TARCOGMemo(SurfNum));
+            int const nInputs = 14 + nlayer;
+            memoKey.dimension(nInputs);
+            memoKey(1) = ConstrNum;
+            memoKey(2) = ShadeFlag;
+            memoKey(3) = tout;
+            memoKey(4) = tind;
+            memoKey(5) = trmin;
+            memoKey(6) = wso;
+            memoKey(7) = dir;
+            memoKey(8) = outir;
+            memoKey(9) = tsky;
+            memoKey(10) = fclr;
+            memoKey(11) = hin;
+            memoKey(12) = hout;
+            memoKey(13) = presure(1);
+            memoKey(14) = edgeGlCorrFac;
+            for (k = 1; k <= nlayer; ++k) {
+                memoKey(14 + k) = asol(k);
+            }
+            memoHit = RecallTARCOGSolution(memo, memoKey, nlayer, theta, qv, hcin, ufactor);
+            if (memoHit) {
+                nperr = 0;
+                NumOfIterations = 0;
+            }
+        }
+
         //  call TARCOG
-        TARCOG90(nlayer,
-                 iwd,
-                 tout,
-                 tind,
-                 trmin,
-                 wso,
-                 wsi,
-                 dir,
-                 outir,
-                 isky,
-                 tsky,
-                 esky,
-                 fclr,
-                 VacuumPressure,
-                 VacuumMaxGapThickness,
-                 CalcDeflection,
-                 Pa,
-                 Pini,
-                 Tini,
-                 gap,
-                 GapDefMax,
-                 thick,
-                 scon,
-                 YoungsMod,
-                 PoissonsRat,
-                 tir,
-                 emis,
-                 totsol,
-                 tilt,
-                 asol,
-                 height,
-                 heightt,
-                 width,
-                 presure,
-                 iprop,
-                 frct,
-                 gcon,
-                 gvis,
-                 gcp,
-                 wght,
-                 gama,
-                 nmix,
-                 SupportPlr,
-                 PillarSpacing,
-                 PillarRadius,
-                 theta,
-                 LayerDef,
-                 q,
-                 qv,
-                 ufactor,
-                 sc,
-                 hflux,
-                 hcin,
-                 hcout,
-                 hrin,
-                 hrout,
-                 hin,
-                 hout,
-                 hcgap,
-                 hrgap,
-                 shgc,
-                 nperr,
-                 tarcogErrorMessage,
-                 shgct,
-                 tamb,
-                 troom,
-                 ibc,
-                 Atop,
-                 Abot,
-                 Al,
-                 Ar,
-                 Ah,
-                 SlatThick,
-                 SlatWidth,
-                 SlatAngle,
-                 SlatCond,
-                 SlatSpacing,
-                 SlatCurve,
-                 vvent,
-                 tvent,
-                 LayerType,
-                 nslice,
-                 LaminateA,
-                 LaminateB,
-                 sumsol,
-                 hg,
-                 hr,
-                 hs,
-                 he,
-                 hi,
-                 Ra,
-                 Nu,
-                 standard,
-                 ThermalMod,
-                 Debug_mode,
-                 Debug_dir,
-                 Debug_file,
-                 Window_ID,
-                 IGU_ID,
-                 ShadeEmisRatioOut,
-                 ShadeEmisRatioIn,
-                 ShadeHcRatioOut,
-                 ShadeHcRatioIn,
-                 HcUnshadedOut,
-                 HcUnshadedIn,
-                 Keff,
-                 ShadeGapKeffConv,
-                 SDScalar,
-                 CalcSHGC,
-                 NumOfIterations,
-                 edgeGlCorrFac);
+        if (!memoHit) {
+            TARCOG90(nlayer,
+                     iwd,
+                     tout,
+                     tind,
+                     trmin,
+                     wso,
+                     wsi,
+                     dir,
+                     outir,
+                     isky,
+                     tsky,
+                     esky,
+                     fclr,
+                     VacuumPressure,
+                     VacuumMaxGapThickness,
+                     CalcDeflection,
+                     Pa,
+                     Pini,
+                     Tini,
+                     gap,
+                     GapDefMax,
+                     thick,
+                     scon,
+                     YoungsMod,
+                     PoissonsRat,
+                     tir,
+                     emis,
+                     totsol,
+                     tilt,
+                     asol,
+                     height,
+                     heightt,
+                     width,
+                     presure,
+                     iprop,
+                     frct,
+                     gcon,
+                     gvis,
+                     gcp,
+                     wght,
+                     gama,
+                     nmix,
+                     SupportPlr,
+                     PillarSpacing,
+                     PillarRadius,
+                     theta,
+                     LayerDef,
+                     q,
+                     qv,
+                     ufactor,
+                     sc,
+                     hflux,
+                     hcin,
+                     hcout,
+                     hrin,
+                     hrout,
+                     hin,
+                     hout,
+                     hcgap,
+                     hrgap,
+                     shgc,
+                     nperr,
+                     tarcogErrorMessage,
+                     shgct,
+                     tamb,
+                     troom,
+                     ibc,
+                     Atop,
+                     Abot,
+                     Al,
+                     Ar,
+                     Ah,
+                     SlatThick,
+                     SlatWidth,
+                     SlatAngle,
+                     SlatCond,
+                     SlatSpacing,
+                     SlatCurve,
+                     vvent,
+                     tvent,
+                     LayerType,
+                     nslice,
+                     LaminateA,
+                     LaminateB,
+                     sumsol,
+                     hg,
+                     hr,
+                     hs,
+                     he,
+                     hi,
+                     Ra,
+                     Nu,
+                     standard,
+                     ThermalMod,
+                     Debug_mode,
+                     Debug_dir,
+                     Debug_file,
+                     Window_ID,
+                     IGU_ID,
+                     ShadeEmisRatioOut,
+                     ShadeEmisRatioIn,
+                     ShadeHcRatioOut,
+                     ShadeHcRatioIn,
+                     HcUnshadedOut,
+                     HcUnshadedIn,
+                     Keff,
+                     ShadeGapKeffConv,
+                     SDScalar,
+                     CalcSHGC,
+                     NumOfIterations,
+                     edgeGlCorrFac);
+
+            if (TARCOGResultMemo && CalcCondition == noCondition && nperr == 0) {
+                StoreTARCOGSolution(TARCOGMemo(SurfNum), memoKey, nlayer, theta, qv, hcin, ufactor);
+            }
+        }
 
         // process results from TARCOG
         if ((nperr > 0) && (nperr < 1000)) { // process error signal from tarcog
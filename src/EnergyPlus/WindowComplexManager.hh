@@ -132,10 +132,29 @@ namespace WindowComplexManager {
         }
     };
 
+    struct TARCOGMemoStruct
+    {
+        // Members
+        bool Valid;             // True once a converged solution has been stored
+        Array1D<Real64> Inputs; // Boundary conditions and absorbed solar the solution was obtained for
+        Array1D<Real64> theta;  // Surface temperatures of the stored solution [K]
+        Array1D<Real64> qv;     // Gap ventilation heat fluxes of the stored solution [W/m^2]
+        Real64 hcin;            // Indoor convective film coefficient of the stored solution [W/m^2.K]
+        Real64 ufactor;         // Center of glass U-value of the stored solution [W/m^2.K]
+
+        // Default Constructor
+        TARCOGMemoStruct() : Valid(false), hcin(0.0), ufactor(0.0)
+        {
+        }
+    };
+
     // Object Data
     extern Array1D<BasisStruct> BasisList;
     extern Array1D<WindowIndex> WindowList;
     extern Array2D<WindowStateIndex> WindowStateList;
+    extern Array1D_int StaticPropertiesSurf;     // Window whose state first calculated the construction static properties, by construction
+    extern Array1D_int StaticPropertiesState;    // State of that window, by construction
+    extern Array1D<TARCOGMemoStruct> TARCOGMemo; // Last TARCOG solution, by surface
 
     // Functions
 
@@ -200,6 +219,11 @@ namespace WindowComplexManager {
                                          BSDFStateDescr &State        // State Description
     );
 
+    void CalcConstructionStaticProperties(int const IConst,           // Construction of the complex fenestration state
+                                          BSDFGeomDescr const &Geom,  // State Geometry
+                                          BSDFStateDescr &State       // State Description
+    );
+
     void CalcWindowStaticProperties(int const ISurf,             // Surface number of the complex fenestration
                                     int const IState,            // State number of the complex fenestration state
                                     BSDFWindowGeomDescr &Window, // Window Geometry
@@ -237,6 +261,24 @@ namespace WindowComplexManager {
                                Real64 &Phi            // Azimuthal angle in W6 Coords
     );
 
+    bool RecallTARCOGSolution(TARCOGMemoStruct const &Memo,  // Stored solution
+                              Array1D<Real64> const &Inputs, // Boundary conditions and absorbed solar of the current call
+                              int const nlayer,              // Number of layers
+                              Array1D<Real64> &theta,        // Surface temperatures [K]
+                              Array1D<Real64> &qv,           // Gap ventilation heat fluxes [W/m^2]
+                              Real64 &hcin,                  // Indoor convective film coefficient [W/m^2.K]
+                              Real64 &ufactor                // Center of glass U-value [W/m^2.K]
+    );
+
+    void StoreTARCOGSolution(TARCOGMemoStruct &Memo,        // Stored solution
+                             Array1D<Real64> const &Inputs, // Boundary conditions and absorbed solar the solution was obtained for
+                             int const nlayer,              // Number of layers
+                             Array1D<Real64> const &theta,  // Surface temperatures [K]
+                             Array1D<Real64> const &qv,     // Gap ventilation heat fluxes [W/m^2]
+                             Real64 const hcin,             // Indoor convective film coefficient [W/m^2.K]
+                             Real64 const ufactor           // Center of glass U-value [W/m^2.K]
+    );
+
     void CalcComplexWindowThermal(int const SurfNum,          // Surface number
                                   int &ConstrNum,             // Construction number
                                   Real64 const HextConvCoeff, // Outside air film conductance coefficient
@@ -62,6 +62,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataWindowEquivalentLayer.hh>
 #include <DataZoneEquipment.hh>
 #include <DaylightingManager.hh>
@@ -159,6 +160,7 @@ namespace WindowEquivalentLayer {
 
     Array3D<Real64> CFSDiffAbsTrans;
     Array1D_bool EQLDiffPropFlag;
+    Array2D<Real64> EQLLayerTemp; // Layer temperatures of the last solution (layer, surface), K; 0 until solved
 
     // MODULE SUBROUTINES:
     // Initialization routines for module
@@ -175,6 +177,7 @@ namespace WindowEquivalentLayer {
     {
         CFSDiffAbsTrans.deallocate();
         EQLDiffPropFlag.deallocate();
+        EQLLayerTemp.deallocate();
     }
 
     void InitEquivalentLayerWindowCalculations()
@@ -796,6 +799,7 @@ namespace WindowEquivalentLayer {
         using DataGlobals::StefanBoltzmann;
         using DataHeatBalSurface::HcExtSurf;
         using DataLoopNode::Node;
+        using DataSystemVariables::EQLWindowWarmStart;
         using DataZoneEquipment::ZoneEquipConfig;
         using General::InterpSlatAng;
         using General::InterpSw;
@@ -1025,8 +1029,41 @@ namespace WindowEquivalentLayer {
         QAllSWwinAbs({1, NL + 1}) = QRadSWwinAbs({1, NL + 1}, SurfNum);
         //  Solve energy balance(s) for temperature at each node/layer and
         //  heat flux, including components, between each pair of nodes/layers
-        ASHWAT_ThermalR = ASHWAT_Thermal(
-            CFS(EQLNum), TIN, Tout, HcIn, HcOut, TRMOUT, TRMIN, 0.0, QAllSWwinAbs({1, NL + 1}), TOL, QOCF, QOCFRoom, T, Q, JF, JB, H, UCG, SHGC);
+        if (EQLWindowWarmStart && CalcCondition == noCondition) {
+            // Start from this window's previous layer temperatures; with slowly varying conditions the solver then
+            // meets its convergence tolerance within a couple of iterations
+            if (!allocated(EQLLayerTemp)) {
+                EQLLayerTemp.allocate(CFSMAXNL, TotSurfaces);
+                EQLLayerTemp = 0.0;
+            }
+            ASHWAT_ThermalR = ASHWAT_Thermal(CFS(EQLNum),
+                                             TIN,
+                                             Tout,
+                                             HcIn,
+                                             HcOut,
+                                             TRMOUT,
+                                             TRMIN,
+                                             0.0,
+                                             QAllSWwinAbs({1, NL + 1}),
+                                             TOL,
+                                             QOCF,
+                                             QOCFRoom,
+                                             T,
+                                             Q,
+                                             JF,
+                                             JB,
+                                             H,
+                                             UCG,
+                                             SHGC,
+                                             _,
+                                             EQLLayerTemp(_, SurfNum));
+            for (int Lay = 1; Lay <= NL; ++Lay) {
+                EQLLayerTemp(Lay, SurfNum) = T(Lay);
+            }
+        } else {
+            ASHWAT_ThermalR = ASHWAT_Thermal(
+                CFS(EQLNum), TIN, Tout, HcIn, HcOut, TRMOUT, TRMIN, 0.0, QAllSWwinAbs({1, NL + 1}), TOL, QOCF, QOCFRoom, T, Q, JF, JB, H, UCG, SHGC);
+        }
         // long wave radiant power to room not including reflected
         QRLWX = JB(NL) - (1.0 - LWAbsIn) * JF(NL + 1);
         // nominal surface temp = effective radiant temperature
@@ -5006,26 +5043,27 @@ namespace WindowEquivalentLayer {
         }
     }
 
-    bool ASHWAT_Thermal(CFSTY const &FS,  // fenestration system
-                        Real64 const TIN, // indoor / outdoor air temperature, K
+    bool ASHWAT_Thermal(CFSTY const &FS,                      // fenestration system
+                        Real64 const TIN,                     // indoor / outdoor air temperature, K
                         Real64 const TOUT,
-                        Real64 const HCIN, // indoor / outdoor convective heat transfer
+                        Real64 const HCIN,                    // indoor / outdoor convective heat transfer
                         Real64 const HCOUT,
                         Real64 const TRMOUT,
-                        Real64 const TRMIN,           // indoor / outdoor mean radiant temp, K
-                        Real64 const ISOL,            // total incident solar, W/m2 (values used for SOURCE derivation)
-                        Array1S<Real64> const SOURCE, // absorbed solar by layer, W/m2
-                        Real64 const TOL,             // convergence tolerance, usually
-                        Array1A<Real64> QOCF,         // returned: heat flux to layer i from gaps i-1 and i
-                        Real64 &QOCFRoom,             // returned: open channel heat gain to room, W/m2
-                        Array1A<Real64> T,            // returned: layer temperatures, 1=outside-most layer, K
-                        Array1<Real64> &Q,            // returned: heat flux at ith gap (betw layers i and i+1), W/m2
-                        Array1A<Real64> JF,           // returned: front (outside facing) radiosity of surfaces, W/m2
-                        Array1A<Real64> JB,           // returned: back (inside facing) radiosity, W/m2
-                        Array1A<Real64> HC,           // returned: gap convective heat transfer coefficient, W/m2K
-                        Real64 &UCG,                  // returned: center-glass U-factor, W/m2-K
-                        Real64 &SHGC,                 // returned: center-glass SHGC (Solar Heat Gain Coefficient)
-                        Optional_bool_const HCInFlag  // If true uses ISO Std 150099 routine for HCIn calc
+                        Real64 const TRMIN,                   // indoor / outdoor mean radiant temp, K
+                        Real64 const ISOL,                    // total incident solar, W/m2 (values used for SOURCE derivation)
+                        Array1S<Real64> const SOURCE,         // absorbed solar by layer, W/m2
+                        Real64 const TOL,                     // convergence tolerance, usually
+                        Array1A<Real64> QOCF,                 // returned: heat flux to layer i from gaps i-1 and i
+                        Real64 &QOCFRoom,                     // returned: open channel heat gain to room, W/m2
+                        Array1A<Real64> T,                    // returned: layer temperatures, 1=outside-most layer, K
+                        Array1<Real64> &Q,                    // returned: heat flux at ith gap (betw layers i and i+1), W/m2
+                        Array1A<Real64> JF,                   // returned: front (outside facing) radiosity of surfaces, W/m2
+                        Array1A<Real64> JB,                   // returned: back (inside facing) radiosity, W/m2
+                        Array1A<Real64> HC,                   // returned: gap convective heat transfer coefficient, W/m2K
+                        Real64 &UCG,                          // returned: center-glass U-factor, W/m2-K
+                        Real64 &SHGC,                         // returned: center-glass SHGC (Solar Heat Gain Coefficient)
+                        Optional_bool_const HCInFlag,         // If true uses ISO Std 150099 routine for HCIn calc
+                        Optional<Array1S<Real64> const> TINIT // initial estimate of layer temperatures, K (0 = none)
     )
     {
         // SUBROUTINE INFORMATION:
@@ -5244,8 +5282,13 @@ namespace WindowEquivalentLayer {
         }
 
         //   FIRST ESTIMATE OF GLAZING TEMPERATURES AND BLACK EMISSIVE POWERS
+        //   (the caller's previous solution if supplied, otherwise linear between outdoor and indoor)
         for (I = 1; I <= NL; ++I) {
-            T(I) = TOUT + double(I) / double(NL + 1) * (TIN - TOUT);
+            if (present(TINIT) && TINIT()(I) > 0.0) {
+                T(I) = TINIT()(I);
+            } else {
+                T(I) = TOUT + double(I) / double(NL + 1) * (TIN - TOUT);
+            }
             EB(I) = StefanBoltzmann * pow_4(T(I));
         }
 
@@ -55,6 +55,7 @@
 #include <ObjexxFCL/Array1A.hh>
 #include <ObjexxFCL/Array1S.hh>
 #include <ObjexxFCL/Array2A.hh>
+#include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Array2S.hh>
 #include <ObjexxFCL/Array3D.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -92,6 +93,7 @@ namespace WindowEquivalentLayer {
 
     extern Array3D<Real64> CFSDiffAbsTrans;
     extern Array1D_bool EQLDiffPropFlag;
+    extern Array2D<Real64> EQLLayerTemp; // Layer temperatures of the last solution (layer, surface), K; 0 until solved
 
     // MODULE SUBROUTINES:
     // Initialization routines for module
@@ -462,26 +464,27 @@ namespace WindowEquivalentLayer {
                  Array1S<Real64> XSOL // returned: solution vector, min req dimension: XSOL( N)
     );
 
-    bool ASHWAT_Thermal(CFSTY const &FS,  // fenestration system
-                        Real64 const TIN, // indoor / outdoor air temperature, K
+    bool ASHWAT_Thermal(CFSTY const &FS,                          // fenestration system
+                        Real64 const TIN,                         // indoor / outdoor air temperature, K
                         Real64 const TOUT,
-                        Real64 const HCIN, // indoor / outdoor convective heat transfer
+                        Real64 const HCIN,                        // indoor / outdoor convective heat transfer
                         Real64 const HCOUT,
                         Real64 const TRMOUT,
-                        Real64 const TRMIN,              // indoor / outdoor mean radiant temp, K
-                        Real64 const ISOL,               // total incident solar, W/m2 (values used for SOURCE derivation)
-                        Array1S<Real64> const SOURCE,    // absorbed solar by layer,  W/m2
-                        Real64 const TOL,                // convergence tolerance, usually
-                        Array1A<Real64> QOCF,            // returned: heat flux to layer i from gaps i-1 and i
-                        Real64 &QOCFRoom,                // returned: open channel heat gain to room, W/m2
-                        Array1A<Real64> T,               // returned: layer temperatures, 1=outside-most layer, K
-                        Array1<Real64> &Q,               // returned: heat flux at ith gap (betw layers i and i+1), W/m2
-                        Array1A<Real64> JF,              // returned: front (outside facing) radiosity of surfaces, W/m2
-                        Array1A<Real64> JB,              // returned: back (inside facing) radiosity, W/m2
-                        Array1A<Real64> HC,              // returned: gap convective heat transfer coefficient, W/m2K
-                        Real64 &UCG,                     // returned: center-glass U-factor, W/m2-K
-                        Real64 &SHGC,                    // returned: center-glass SHGC (Solar Heat Gain Coefficient)
-                        Optional_bool_const HCInFlag = _ // If true uses ISO Std 150099 routine for HCIn calc
+                        Real64 const TRMIN,                       // indoor / outdoor mean radiant temp, K
+                        Real64 const ISOL,                        // total incident solar, W/m2 (values used for SOURCE derivation)
+                        Array1S<Real64> const SOURCE,             // absorbed solar by layer,  W/m2
+                        Real64 const TOL,                         // convergence tolerance, usually
+                        Array1A<Real64> QOCF,                     // returned: heat flux to layer i from gaps i-1 and i
+                        Real64 &QOCFRoom,                         // returned: open channel heat gain to room, W/m2
+                        Array1A<Real64> T,                        // returned: layer temperatures, 1=outside-most layer, K
+                        Array1<Real64> &Q,                        // returned: heat flux at ith gap (betw layers i and i+1), W/m2
+                        Array1A<Real64> JF,                       // returned: front (outside facing) radiosity of surfaces, W/m2
+                        Array1A<Real64> JB,                       // returned: back (inside facing) radiosity, W/m2
+                        Array1A<Real64> HC,                       // returned: gap convective heat transfer coefficient, W/m2K
+                        Real64 &UCG,                              // returned: center-glass U-factor, W/m2-K
+                        Real64 &SHGC,                             // returned: center-glass SHGC (Solar Heat Gain Coefficient)
+                        Optional_bool_const HCInFlag = _,         // If true uses ISO Std 150099 routine for HCIn calc
+                        Optional<Array1S<Real64> const> TINIT = _ // initial estimate of layer temperatures, K (0 = none)
     );
 
     void DL_RES_r2(Real64 const Tg,    // mean glass layer temperature, {K}
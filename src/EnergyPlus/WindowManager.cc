@@ -71,6 +71,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEquipment.hh>
 #include <General.hh>
 #include <InputProcessing/InputProcessor.hh>
@@ -474,6 +475,7 @@ namespace WindowManager {
         using CurveManager::SetCommonIncidentAngles;
         using CurveManager::TableData;
         using CurveManager::TableLookup;
+        using General::TabulatePOLYF;
         using General::TrimSigDigits;
         using WindowEquivalentLayer::InitEquivalentLayerWindowCalculations;
 
@@ -1751,6 +1753,15 @@ namespace WindowManager {
                     Construct(ConstrNum).AbsBeamBackCoef({1, 6}, IGlass) = CoeffsCurveFit;
                 }
 
+                // Tabulate the beam properties used per time step so they are evaluated by interpolation
+                if (DataSystemVariables::WindowAngularTables) {
+                    TabulatePOLYF(Construct(ConstrNum).TransSolBeamCoef({1, 6}), Construct(ConstrNum).TransSolBeamTable);
+                    TabulatePOLYF(Construct(ConstrNum).ReflSolBeamFrontCoef({1, 6}), Construct(ConstrNum).ReflSolBeamFrontTable);
+                    for (IGlass = 1; IGlass <= NGlass; ++IGlass) {
+                        TabulatePOLYF(Construct(ConstrNum).AbsBeamCoef({1, 6}, IGlass), Construct(ConstrNum).AbsBeamTable[IGlass - 1]);
+                    }
+                }
+
                 // To check goodness of fit //Tuned
                 auto const &solBeamCoef(Construct(ConstrNum).TransSolBeamCoef);
                 auto const &visBeamCoef(Construct(ConstrNum).TransVisBeamCoef);
@@ -3363,9 +3374,10 @@ namespace WindowManager {
         static Array1D<Real64> hr(10);  // Radiative conductance (W/m2-K) //Tuned Made static
         Real64 d;                       // +1 if number of row interchanges is even,
         // -1 if odd (in LU decomposition)
-        static Array1D_int indx(10);          // Vector of row permutations in LU decomposition //Tuned Made static
-        static Array2D<Real64> Aface(10, 10); // Coefficient in equation Aface*thetas = Bface //Tuned Made static
-        static Array1D<Real64> Bface(10);     // Coefficient in equation Aface*thetas = Bface //Tuned Made static
+        static Array1D_int indx(10);                // Vector of row permutations in LU decomposition //Tuned Made static
+        static Array2D<Real64> Aface(10, 10);       // Coefficient in equation Aface*thetas = Bface //Tuned Made static
+        static Array2D<Real64> AfaceLagged(10, 10); // Aface with the emission terms lagged, for the Newton update
+        static Array1D<Real64> Bface(10);           // Coefficient in equation Aface*thetas = Bface //Tuned Made static
 
         int iter;                          // Iteration number
         static Array1D<Real64> hrprev(10); // Value of hr from previous iteration //Tuned Made static
@@ -3480,6 +3492,13 @@ namespace WindowManager {
         hcvPrev = 0.0;
         VGapPrev = 0.0;
 
+        // Bare glazing can take full Newton steps from the warm start; shades, blinds, screens and gap airflow add lagged
+        // gap flow terms and keep the relaxed update. Newton steps stop after MaxIterations/4, leaving the relaxed update
+        // as the fallback.
+        bool const newtonSolve(DataSystemVariables::WindowNewtonSolve && ShadeFlag != IntShadeOn && ShadeFlag != ExtShadeOn &&
+                               ShadeFlag != IntBlindOn && ShadeFlag != ExtBlindOn && ShadeFlag != ExtScreenOn && ShadeFlag != BGShadeOn &&
+                               ShadeFlag != BGBlindOn && SurfaceWindow(SurfNum).AirflowThisTS == 0.0);
+
         // Calculate radiative conductances
 
         errtemp = errtemptol * 2.0;
@@ -3552,8 +3571,20 @@ namespace WindowManager {
             ++iter;
             SurfaceWindow(SurfNum).WindowCalcIterationsRep = iter;
 
+            // Gap gas conductances depend only on the face temperatures of the current iterate
+            for (i = 1; i < min(ngllayer, 4); ++i) {
+                WindowGasConductance(thetas(2 * i), thetas(2 * i + 1), i, con, pr, gr);
+                NusseltNumber(SurfNum, thetas(2 * i), thetas(2 * i + 1), i, gr, pr, nu);
+                hgap(i) = con / gap(i) * nu;
+                if (SurfaceWindow(SurfNum).EdgeGlCorrFac > 1.0) { // Edge of glass correction
+                    Real64 const AGap(i == 1 ? A23 : (i == 2 ? A45 : A67));
+                    hrgap(i) = 0.5 * std::abs(AGap) * pow_3(thetas(2 * i) + thetas(2 * i + 1));
+                    hgap(i) = hgap(i) * SurfaceWindow(SurfNum).EdgeGlCorrFac + hrgap(i) * (SurfaceWindow(SurfNum).EdgeGlCorrFac - 1.0);
+                }
+            }
+
             // Calculations based on number of glass layers
-            {
+            auto formFaceEquations = [&]() {
                 auto const SELECT_CASE_var(ngllayer);
 
                 if (SELECT_CASE_var == 1) {
@@ -3594,14 +3625,6 @@ namespace WindowManager {
                     }
 
                 } else if (SELECT_CASE_var == 2) {
-                    WindowGasConductance(thetas(2), thetas(3), 1, con, pr, gr);
-                    NusseltNumber(SurfNum, thetas(2), thetas(3), 1, gr, pr, nu);
-                    hgap(1) = con / gap(1) * nu;
-                    if (SurfaceWindow(SurfNum).EdgeGlCorrFac > 1.0) { // Edge of glass correction
-                        hrgap(1) = 0.5 * std::abs(A23) * pow_3(thetas(2) + thetas(3));
-                        hgap(1) = hgap(1) * SurfaceWindow(SurfNum).EdgeGlCorrFac + hrgap(1) * (SurfaceWindow(SurfNum).EdgeGlCorrFac - 1.0);
-                    }
-
                     Bface(1) = Outir * emis(1) + hcout * tout + AbsRadGlassFace(1);
                     Bface(2) = AbsRadGlassFace(2);
                     Bface(3) = AbsRadGlassFace(3);
@@ -3694,22 +3717,6 @@ namespace WindowManager {
                     }
 
                 } else if (SELECT_CASE_var == 3) {
-                    WindowGasConductance(thetas(2), thetas(3), 1, con, pr, gr);
-                    NusseltNumber(SurfNum, thetas(2), thetas(3), 1, gr, pr, nu);
-                    hgap(1) = con / gap(1) * nu;
-                    if (SurfaceWindow(SurfNum).EdgeGlCorrFac > 1.0) { // Edge of glass correction
-                        hrgap(1) = 0.5 * std::abs(A23) * pow_3(thetas(2) + thetas(3));
-                        hgap(1) = hgap(1) * SurfaceWindow(SurfNum).EdgeGlCorrFac + hrgap(1) * (SurfaceWindow(SurfNum).EdgeGlCorrFac - 1.0);
-                    }
-
-                    WindowGasConductance(thetas(4), thetas(5), 2, con, pr, gr);
-                    NusseltNumber(SurfNum, thetas(4), thetas(5), 2, gr, pr, nu);
-                    hgap(2) = con / gap(2) * nu;
-                    if (SurfaceWindow(SurfNum).EdgeGlCorrFac > 1.0) { // Edge of glass correction
-                        hrgap(2) = 0.5 * std::abs(A45) * pow_3(thetas(4) + thetas(5));
-                        hgap(2) = hgap(2) * SurfaceWindow(SurfNum).EdgeGlCorrFac + hrgap(2) * (SurfaceWindow(SurfNum).EdgeGlCorrFac - 1.0);
-                    }
-
                     Bface(1) = Outir * emis(1) + hcout * tout + AbsRadGlassFace(1);
                     Bface(2) = AbsRadGlassFace(2);
                     Bface(3) = AbsRadGlassFace(3);
@@ -3812,29 +3819,6 @@ namespace WindowManager {
                     }
 
                 } else if (SELECT_CASE_var == 4) {
-                    WindowGasConductance(thetas(2), thetas(3), 1, con, pr, gr);
-                    NusseltNumber(SurfNum, thetas(2), thetas(3), 1, gr, pr, nu);
-                    hgap(1) = con / gap(1) * nu;
-                    if (SurfaceWindow(SurfNum).EdgeGlCorrFac > 1.0) { // Edge of glass correction
-                        hrgap(1) = 0.5 * std::abs(A23) * pow_3(thetas(2) + thetas(3));
-                        hgap(1) = hgap(1) * SurfaceWindow(SurfNum).EdgeGlCorrFac + hrgap(1) * (SurfaceWindow(SurfNum).EdgeGlCorrFac - 1.0);
-                    }
-
-                    WindowGasConductance(thetas(4), thetas(5), 2, con, pr, gr);
-                    NusseltNumber(SurfNum, thetas(4), thetas(5), 2, gr, pr, nu);
-                    hgap(2) = con / gap(2) * nu;
-                    if (SurfaceWindow(SurfNum).EdgeGlCorrFac > 1.0) { // Edge of glass correction
-                        hrgap(2) = 0.5 * std::abs(A45) * pow_3(thetas(4) + thetas(5));
-                        hgap(2) = hgap(2) * SurfaceWindow(SurfNum).EdgeGlCorrFac + hrgap(2) * (SurfaceWindow(SurfNum).EdgeGlCorrFac - 1.0);
-                    }
-
-                    WindowGasConductance(thetas(6), thetas(7), 3, con, pr, gr);
-                    NusseltNumber(SurfNum, thetas(6), thetas(7), 3, gr, pr, nu);
-                    hgap(3) = con / gap(3) * nu;
-                    if (SurfaceWindow(SurfNum).EdgeGlCorrFac > 1.0) { // Edge of glass correction
-                        hrgap(3) = 0.5 * std::abs(A67) * pow_3(thetas(6) + thetas(7));
-                        hgap(3) = hgap(3) * SurfaceWindow(SurfNum).EdgeGlCorrFac + hrgap(3) * (SurfaceWindow(SurfNum).EdgeGlCorrFac - 1.0);
-                    }
                     Bface(1) = Outir * emis(1) + hcout * tout + AbsRadGlassFace(1);
                     Bface(2) = AbsRadGlassFace(2);
                     Bface(3) = AbsRadGlassFace(3);
@@ -3905,6 +3889,25 @@ namespace WindowManager {
                 } else {
                     ShowFatalError("SolveForWindowTemperatures: Invalid number of Glass Layers=" + TrimSigDigits(ngllayer) + ", up to 4 allowed.");
                 }
+            };
+            formFaceEquations();
+
+            // Newton update: each hr(k) multiplies thetas(k) only, so forming the equations again with 4*hr gives the
+            // Jacobian of the emis*sigma*thetas^4 terms, and the change in the matrix times the current temperatures
+            // moves the lagged part of the emission onto the right-hand side.
+            bool const newtonStep(newtonSolve && iter < MaxIterations / 4);
+            if (newtonStep) {
+                AfaceLagged = Aface;
+                for (i = 1; i <= nglfacep; ++i) {
+                    hr(i) *= 4.0;
+                }
+                formFaceEquations();
+                for (i = 1; i <= nglfacep; ++i) {
+                    hr(i) = hrprev(i);
+                    for (int j = 1; j <= nglfacep; ++j) {
+                        Bface(i) += (Aface(j, i) - AfaceLagged(j, i)) * thetas(j);
+                    }
+                }
             }
 
             LUdecomposition(Aface, nglfacep, indx, d); // Note that these routines change Aface;
@@ -3912,7 +3915,9 @@ namespace WindowManager {
 
             for (i = 1; i <= nglfacep; ++i) {
                 thetasPrev(i) = thetas(i);
-                if (iter < MaxIterations / 4) {
+                if (newtonStep) {
+                    thetas(i) = Bface(i);
+                } else if (iter < MaxIterations / 4) {
                     thetas(i) = 0.5 * thetas(i) + 0.5 * Bface(i);
                 } else {
                     thetas(i) = 0.75 * thetas(i) + 0.25 * Bface(i);
@@ -4035,6 +4035,9 @@ namespace ZoneEquipmentManager {
 
         if (ResetSimOrder) {
             const int ControlledZoneNum = [&]{
+                // Equipment configurations are stored at the index of their zone, so check that first to avoid
+                // a search over all zones for every zone simulated
+                if (ZoneNum >= 1 && ZoneNum <= NumOfZones && ZoneEquipConfig(ZoneNum).ActualZoneNum == ZoneNum) return ZoneNum;
                 for (int i = 1; i <= NumOfZones; ++i) {
                     if (ZoneEquipConfig(i).ActualZoneNum == ZoneNum) return i;
                 }
@@ -6527,7 +6530,7 @@ namespace ZoneEquipmentManager {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Bereket Nigusse
         //       DATE WRITTEN   February 2014
-        //       MODIFIED       na
+        //       MODIFIED       October 2026, index the source zone mixing objects directly
         //       RE-ENGINEERED  na
 
         // PURPOSE OF THIS SUBROUTINE:
@@ -6544,7 +6547,6 @@ namespace ZoneEquipmentManager {
         // Using/Aliasing
         using DataHeatBalance::MassConservation;
         using DataHeatBalance::Mixing;
-        using DataHeatBalance::TotMixing;
         using DataHeatBalance::Zone;
         using DataHeatBalFanSys::MixingMassFlowZone;
         using DataZoneEquipment::ZoneEquipConfig;
@@ -6564,7 +6566,6 @@ namespace ZoneEquipmentManager {
         // na
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        int Loop;
         int MixingNum;
         int ZoneMixingNum;
         int NumOfSourceZoneMixingObjects;
@@ -6575,11 +6576,7 @@ namespace ZoneEquipmentManager {
         if (NumOfSourceZoneMixingObjects > 0) {
             for (ZoneMixingNum = 1; ZoneMixingNum <= NumOfSourceZoneMixingObjects; ++ZoneMixingNum) {
                 MixingNum = MassConservation(ZoneNum).ZoneMixingSourcesPtr(ZoneMixingNum);
-                for (Loop = 1; Loop <= TotMixing; ++Loop) {
-                    if (Loop == MixingNum) {
-                        ZoneSourceMassFlowRate += Mixing(Loop).MixingMassFlowRate;
-                    }
-                }
+                ZoneSourceMassFlowRate += Mixing(MixingNum).MixingMassFlowRate;
             }
         }
         MassConservation(ZoneNum).MixingSourceMassFlowRate = ZoneSourceMassFlowRate;
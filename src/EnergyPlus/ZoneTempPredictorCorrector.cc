@@ -48,6 +48,7 @@
 // C++ Headers
 #include <cmath>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -258,6 +259,8 @@ namespace ZoneTempPredictorCorrector {
         // This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
         bool InitZoneAirSetPointsOneTimeFlag(true);
         bool SetupOscillationOutputFlag(true);
+        // Heat transfer surfaces of each zone, built once so the zone sums do not rescan the full surface range
+        Array1D<std::vector<int>> ZoneHTSurfaceList;
     } // namespace
     Array1D<Real64> ZoneSetPointLast;
     Array1D<Real64> TempIndZnLd;
@@ -299,6 +302,7 @@ namespace ZoneTempPredictorCorrector {
         NumStageCtrZone = 0;
         InitZoneAirSetPointsOneTimeFlag = true;
         SetupOscillationOutputFlag = true;
+        ZoneHTSurfaceList.deallocate();
         ZoneSetPointLast.deallocate();
         TempIndZnLd.deallocate();
         TempDepZnLd.deallocate();
@@ -6191,6 +6195,31 @@ namespace ZoneTempPredictorCorrector {
         PreviousMeasuredHumRat1(ZoneNum) = Zone(ZoneNum).ZoneMeasuredHumidityRatio;
     }
 
+    void SetupZoneHTSurfaceLists()
+    {
+
+        // SUBROUTINE INFORMATION:
+        //       AUTHOR         na
+        //       DATE WRITTEN   October 2026
+        //       MODIFIED       na
+        //       RE-ENGINEERED  na
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Collects the heat transfer surfaces of each zone into a compact index list, in surface order, so that
+        // CalcZoneSums and CalcZoneComponentLoadSums do not have to test every surface in the zone range each call.
+
+        using DataSurfaces::Surface;
+
+        ZoneHTSurfaceList.allocate(Zone.isize());
+        for (int ZoneNum = 1, ZoneNum_end = Zone.isize(); ZoneNum <= ZoneNum_end; ++ZoneNum) {
+            auto &surfList(ZoneHTSurfaceList(ZoneNum));
+            surfList.clear();
+            for (int SurfNum = Zone(ZoneNum).SurfaceFirst; SurfNum <= Zone(ZoneNum).SurfaceLast; ++SurfNum) {
+                if (Surface(SurfNum).HeatTransSurf) surfList.push_back(SurfNum);
+            }
+        }
+    }
+
     void CalcZoneSums(int const ZoneNum,  // Zone number
                       Real64 &SumIntGain, // Zone sum of convective internal gains
                       Real64 &SumHA,      // Zone sum of Hc*Area
@@ -6249,7 +6278,6 @@ namespace ZoneTempPredictorCorrector {
         bool ZoneRetPlenumAirFlag;
         bool ZoneSupPlenumAirFlag;
         Real64 CpAir;      // Specific heat of air
-        int SurfNum;       // Surface number
         Real64 HA;         // Hc*Area
         Real64 Area;       // Effective surface area
         Real64 RefAirTemp; // Reference air temperature for surface convection calculations
@@ -6377,9 +6405,8 @@ namespace ZoneTempPredictorCorrector {
         SumSysMCpT /= ZoneMult;
 
         // Sum all surface convection: SumHA, SumHATsurf, SumHATref (and additional contributions to SumIntGain)
-        for (SurfNum = Zone(ZoneNum).SurfaceFirst; SurfNum <= Zone(ZoneNum).SurfaceLast; ++SurfNum) {
-
-            if (!Surface(SurfNum).HeatTransSurf) continue; // Skip non-heat transfer surfaces
+        if (!allocated(ZoneHTSurfaceList)) SetupZoneHTSurfaceLists();
+        for (int const SurfNum : ZoneHTSurfaceList(ZoneNum)) {
 
             HA = 0.0;
             Area = Surface(SurfNum).Area; // For windows, this is the glazing area
@@ -6542,7 +6569,6 @@ namespace ZoneTempPredictorCorrector {
         bool ZoneSupPlenumAirFlag;
         Real64 RhoAir;
         Real64 CpAir; // Specific heat of air
-        int SurfNum;  // Surface number
         // unused  REAL(r64)           :: HA                    ! Hc*Area
         Real64 Area;       // Effective surface area
         Real64 RefAirTemp; // Reference air temperature for surface convection calculations
@@ -6698,9 +6724,8 @@ namespace ZoneTempPredictorCorrector {
         SumNonAirSystem = NonAirSystemResponse(ZoneNum) + SumConvHTRadSys(ZoneNum) + SumConvPool(ZoneNum);
 
         // Sum all surface convection: SumHA, SumHATsurf, SumHATref (and additional contributions to SumIntGain)
-        for (SurfNum = Zone(ZoneNum).SurfaceFirst; SurfNum <= Zone(ZoneNum).SurfaceLast; ++SurfNum) {
-
-            if (!Surface(SurfNum).HeatTransSurf) continue; // Skip non-heat transfer surfaces
+        if (!allocated(ZoneHTSurfaceList)) SetupZoneHTSurfaceLists();
+        for (int const SurfNum : ZoneHTSurfaceList(ZoneNum)) {
 
             Area = Surface(SurfNum).Area; // For windows, this is the glazing area
             // determine reference air temperature for this surface's convective heat transfer model
@@ -53,6 +53,25 @@
 // C++ Headers
 #include <string>
 
+// Progress of a run, passed to the callback stored by StoreTelemetryCallback
+struct EnergyPlusTelemetry
+{
+    std::string environmentName;    // current environment (design day or run period)
+    int kindOfSimulation = 0;       // 1 design day, 2 run design day, 3 run period weather, 4 HVAC sizing, 6 read all weather data
+    bool warmup = false;            // true during warmup days
+    int dayOfSimulation = 0;        // day number within the environment
+    int month = 0;                  // current month
+    int dayOfMonth = 0;             // current day of the month
+    int hourOfDay = 0;              // current hour (1-24)
+    double simulatedHours = 0.0;    // hours simulated since the start of the primary simulation, warmup included
+    double elapsedSeconds = 0.0;    // wall seconds since the start of the primary simulation
+    double simulatedHoursPerSecond = 0.0; // throughput since the previous report
+    double heatBalanceSeconds = 0.0; // cumulative wall seconds in ManageHeatBalance; includes the three below
+    double hvacSeconds = 0.0;        // cumulative wall seconds in ManageHVAC
+    double shadingSeconds = 0.0;     // cumulative wall seconds in the shading calculations
+    double outputSeconds = 0.0;      // cumulative wall seconds in output reporting
+};
+
 // Functions
 
 void CreateCurrentDateTimeString(std::string &CurrentDateTimeString);
@@ -61,8 +80,13 @@ void ENERGYPLUSLIB_API EnergyPlusPgm(std::string const &filepath = std::string()
 
 int ENERGYPLUSLIB_API RunEnergyPlus(std::string const & filepath = std::string());
 
+int ENERGYPLUSLIB_API RunEnergyPlusBatch(std::string const &manifestPath);
+
 void ENERGYPLUSLIB_API StoreProgressCallback(void (*f)(int const));
 
 void ENERGYPLUSLIB_API StoreMessageCallback(void (*f)(std::string const &));
 
+// Calls f every reportingIntervalHours simulated hours and once at the end of the run; pass nullptr to stop
+void ENERGYPLUSLIB_API StoreTelemetryCallback(void (*f)(EnergyPlusTelemetry const &), double reportingIntervalHours = 24.0);
+
 #endif
@@ -0,0 +1,98 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+
+#ifndef EsoDictionary_hh_INCLUDED
+#define EsoDictionary_hh_INCLUDED
+
+// C++ Headers
+#include <string>
+
+namespace EnergyPlus {
+
+// Format of the report variable and meter lines of the eso and mtr data dictionaries, shared by
+// OutputProcessor, which writes them, and EsoReader, which reads them back.
+namespace EsoDictionary {
+
+    // One dictionary line, for example
+    //   7,1,Environment,Site Outdoor Air Drybulb Temperature [C] !Hourly
+    //   56,9,Electricity:Facility [J] !Monthly [Value,Min,Day,Hour,Minute,Max,Day,Hour,Minute]
+    struct Item
+    {
+        // Members
+        int reportID;
+        int numFields;            // Values on each data line: 1, or 7, 9 or 11 when the minimum and maximum follow the value
+        bool hasKey;              // Meters have no key
+        std::string keyedValue;
+        std::string name;         // Includes the "Cumulative " prefix of cumulative meters
+        std::string units;
+        std::string frequency;    // Each Call, TimeStep, Hourly, Daily, Monthly, RunPeriod or Annual
+        std::string scheduleName; // Schedule named on the Output:Variable, if any
+
+        // Default Constructor
+        Item() : reportID(0), numFields(0), hasKey(false)
+        {
+        }
+    };
+
+    // Formats a dictionary line (without the line end); frequencyNotice is everything after the units,
+    // e.g. " !Hourly" or " !Hourly,ScheduleName"
+    std::string formatItem(std::string const &reportIDChr,
+                           int const numFields,
+                           bool const hasKey,
+                           std::string const &keyedValue,
+                           std::string const &name,
+                           std::string const &units,
+                           std::string const &frequencyNotice);
+
+    // Parses the line [begin, end); returns false for anything that is not a report variable or meter line,
+    // such as the environment and time stamp definitions at the top of the dictionary
+    bool parseItem(char const *begin, char const *end, Item &item);
+
+} // namespace EsoDictionary
+
+} // namespace EnergyPlus
+
+#endif
@@ -0,0 +1,145 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+
+#ifndef EsoReader_hh_INCLUDED
+#define EsoReader_hh_INCLUDED
+
+// C++ Headers
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include "EsoDictionary.hh"
+
+#if _WIN32 || _MSC_VER
+#if defined(energyplusesoreader_EXPORTS)
+#define ENERGYPLUSESOREADER_API __declspec(dllexport)
+#else
+#define ENERGYPLUSESOREADER_API __declspec(dllimport)
+#endif
+#else
+#define ENERGYPLUSESOREADER_API
+#endif
+
+namespace EnergyPlus {
+
+// Read-only view of an eso or mtr file for post-processing tools. The file is memory mapped and scanned once
+// when it is opened to index the data lines of every report variable and meter by environment; values()
+// then only parses the lines it returns instead of the whole file.
+class ENERGYPLUSESOREADER_API EsoReader
+{
+public:
+    // Time stamp line that precedes a group of data lines; fields the stamp does not carry are zero
+    struct TimeStamp
+    {
+        // Members
+        int dayOfSimulation; // Cumulative for daily, monthly and run period stamps
+        int month;
+        int dayOfMonth;
+        int dst;
+        int hour;
+        double startMinute;
+        double endMinute;
+        int year; // Annual stamps only
+        std::string dayType;
+
+        // Default Constructor
+        TimeStamp() : dayOfSimulation(0), month(0), dayOfMonth(0), dst(0), hour(0), startMinute(0.0), endMinute(0.0), year(0)
+        {
+        }
+    };
+
+    struct Value
+    {
+        // Members
+        TimeStamp stamp;
+        double value;
+        double minimum; // Equal to value when the line has no minimum and maximum
+        double maximum;
+
+        // Default Constructor
+        Value() : value(0.0), minimum(0.0), maximum(0.0)
+        {
+        }
+    };
+
+    explicit EsoReader(std::string const &fileName);
+
+    ~EsoReader();
+
+    EsoReader(EsoReader const &) = delete;
+
+    EsoReader &operator=(EsoReader const &) = delete;
+
+    // False if the file could not be mapped or has no complete data dictionary
+    bool isOpen() const;
+
+    std::string const &programVersion() const;
+
+    std::vector<EsoDictionary::Item> const &dictionary() const;
+
+    // Dictionary item of reportID, or nullptr if there is none
+    EsoDictionary::Item const *item(int reportID) const;
+
+    // Report ID of the variable (or meter, with an empty key) at the given frequency; 0 if there is none
+    int findReportID(std::string const &keyedValue, std::string const &name, std::string const &frequency) const;
+
+    // Titles of the environments in the order they were simulated
+    std::vector<std::string> const &environments() const;
+
+    std::size_t numValues(int reportID, std::size_t environment) const;
+
+    std::vector<Value> values(int reportID, std::size_t environment) const;
+
+private:
+    struct Impl;
+    Impl *impl;
+};
+
+} // namespace EnergyPlus
+
+#endif
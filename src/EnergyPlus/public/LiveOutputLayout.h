@@ -0,0 +1,138 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LiveOutputLayout_h_INCLUDED
+#define LiveOutputLayout_h_INCLUDED
+
+/* Layout of the shared memory live output channel. This header is plain C so that it can be shared by the
+   simulation (LiveOutputChannel.hh) and the reader library (LiveOutputReader.h).
+
+   The mapping holds, in order, an EPLiveOutputHeader, numVariables EPLiveOutputVariable entries at
+   variablesOffset and capacity record slots of recordSize bytes at recordsOffset. A record slot is an
+   EPLiveOutputRecord followed by numVariables doubles, in the order of the variable entries.
+
+   Record n (counting from 0) goes into slot n % capacity. The writer sets the slot sequence to 2n+1, fills in
+   the slot, sets the sequence to 2n+2 and then sets the header's published count to n+1. A reader copies a
+   slot and accepts the copy only if the sequence was 2n+2 both before and after copying, so the writer never
+   waits on a reader; a reader that falls more than capacity records behind simply loses the oldest records. */
+
+#include <stdint.h>
+
+#if defined(_MSC_VER)
+#include <windows.h>
+#endif
+
+#define EP_LIVE_OUTPUT_MAGIC 0x4F4C5045u /* "EPLO" */
+#define EP_LIVE_OUTPUT_VERSION 1u
+#define EP_LIVE_OUTPUT_NAME_LENGTH 200
+#define EP_LIVE_OUTPUT_UNITS_LENGTH 48
+
+typedef struct EPLiveOutputHeader
+{
+    uint32_t magic;           /* EP_LIVE_OUTPUT_MAGIC */
+    uint32_t version;         /* EP_LIVE_OUTPUT_VERSION */
+    uint32_t numVariables;    /* number of published variables */
+    uint32_t capacity;        /* number of record slots */
+    uint64_t recordSize;      /* bytes per record slot */
+    uint64_t variablesOffset; /* offset of the first EPLiveOutputVariable */
+    uint64_t recordsOffset;   /* offset of the first record slot */
+    uint64_t published;       /* number of complete records written so far */
+    uint32_t finished;        /* nonzero once the simulation has closed the channel */
+    uint32_t reserved;
+} EPLiveOutputHeader;
+
+typedef struct EPLiveOutputVariable
+{
+    int32_t reportID;                         /* report variable ID, as used in the eso file */
+    int32_t indexType;                        /* 1 = zone time step, 2 = system time step */
+    char name[EP_LIVE_OUTPUT_NAME_LENGTH];    /* "key:variable name", NUL terminated (truncated if needed) */
+    char units[EP_LIVE_OUTPUT_UNITS_LENGTH];  /* units, NUL terminated */
+} EPLiveOutputVariable;
+
+typedef struct EPLiveOutputRecord
+{
+    uint64_t sequence; /* 2n+1 while record n is written, 2n+2 when it is complete */
+    int32_t dayOfSim;
+    int32_t month;
+    int32_t dayOfMonth;
+    int32_t hourOfDay;
+    double endMinute; /* minute within the hour at the end of the zone time step */
+} EPLiveOutputRecord;
+
+/* Ordering helpers for the sequence and published fields */
+#if defined(_MSC_VER)
+static __inline uint64_t epLiveOutputLoadAcquire(const volatile uint64_t *p)
+{
+    uint64_t value = *p;
+    MemoryBarrier();
+    return value;
+}
+static __inline void epLiveOutputStoreRelease(volatile uint64_t *p, uint64_t value)
+{
+    MemoryBarrier();
+    *p = value;
+}
+static __inline void epLiveOutputFence(void)
+{
+    MemoryBarrier();
+}
+#else
+static inline uint64_t epLiveOutputLoadAcquire(const volatile uint64_t *p)
+{
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+static inline void epLiveOutputStoreRelease(volatile uint64_t *p, uint64_t value)
+{
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+static inline void epLiveOutputFence(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+#endif
+
+#endif
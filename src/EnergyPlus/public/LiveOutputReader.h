@@ -0,0 +1,102 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LiveOutputReader_h_INCLUDED
+#define LiveOutputReader_h_INCLUDED
+
+/* Reader for the shared memory live output channel that EnergyPlus publishes when the LiveOutputChannel
+   environment variable names a channel. Readers poll; the simulation never waits for them. */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "LiveOutputLayout.h"
+
+#if _WIN32 || _MSC_VER
+#if defined(energyplusliveoutput_EXPORTS)
+#define ENERGYPLUSLIVEOUTPUT_API __declspec(dllexport)
+#else
+#define ENERGYPLUSLIVEOUTPUT_API __declspec(dllimport)
+#endif
+#else
+#define ENERGYPLUSLIVEOUTPUT_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct EPLiveOutputReader EPLiveOutputReader;
+
+/* Return codes of epLiveOutputRead */
+#define EP_LIVE_OUTPUT_OK 0          /* record copied */
+#define EP_LIVE_OUTPUT_NOT_YET 1     /* record has not been published yet */
+#define EP_LIVE_OUTPUT_OVERWRITTEN 2 /* record was overwritten before it could be copied */
+
+/* Opens an existing channel; returns NULL if it does not exist or is not initialized yet */
+ENERGYPLUSLIVEOUTPUT_API EPLiveOutputReader *epLiveOutputOpen(const char *name);
+
+ENERGYPLUSLIVEOUTPUT_API void epLiveOutputClose(EPLiveOutputReader *reader);
+
+ENERGYPLUSLIVEOUTPUT_API unsigned epLiveOutputNumVariables(const EPLiveOutputReader *reader);
+
+ENERGYPLUSLIVEOUTPUT_API const EPLiveOutputVariable *epLiveOutputVariable(const EPLiveOutputReader *reader, unsigned index);
+
+/* Number of records published so far */
+ENERGYPLUSLIVEOUTPUT_API uint64_t epLiveOutputPublished(const EPLiveOutputReader *reader);
+
+/* Nonzero once the simulation has closed the channel; no records follow */
+ENERGYPLUSLIVEOUTPUT_API int epLiveOutputFinished(const EPLiveOutputReader *reader);
+
+/* Copies record n (counting from 0) into time and values (numVariables doubles) */
+ENERGYPLUSLIVEOUTPUT_API int epLiveOutputRead(const EPLiveOutputReader *reader, uint64_t n, EPLiveOutputRecord *time, double *values);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
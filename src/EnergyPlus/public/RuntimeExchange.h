@@ -0,0 +1,123 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RuntimeExchange_h_INCLUDED
+#define RuntimeExchange_h_INCLUDED
+
+/* Runtime data exchange for programs that drive EnergyPlus as a library (co-simulation, model predictive
+   control). This header is plain C.
+
+   Before calling RunEnergyPlus the host registers callbacks for EMS calling points. A registered callback makes
+   EnergyPlus set up its EMS actuators and internal variables even if the input has no EMS objects. During the
+   run each callback is called on the simulation thread at its calling point, right after any Erl programs
+   there. Inside a callback the host looks up integer handles once, then reads output variables and internal
+   variables and sets actuators through them without any string handling or copies. Handles are positive; 0
+   means the name was not found, usually because the object has not been set up yet at that calling point. */
+
+#include <EnergyPlusAPI.hh>
+
+/* Calling points, with the values of the emsCallFrom* constants in DataGlobals */
+#define EP_CALLING_POINT_ZONE_SIZING 1
+#define EP_CALLING_POINT_SYSTEM_SIZING 2
+#define EP_CALLING_POINT_BEGIN_NEW_ENVIRONMENT 3
+#define EP_CALLING_POINT_BEGIN_NEW_ENVIRONMENT_AFTER_WARMUP 4
+#define EP_CALLING_POINT_BEGIN_TIMESTEP_BEFORE_PREDICTOR 5
+#define EP_CALLING_POINT_BEFORE_HVAC_MANAGERS 6
+#define EP_CALLING_POINT_AFTER_HVAC_MANAGERS 7
+#define EP_CALLING_POINT_HVAC_ITERATION_LOOP 8
+#define EP_CALLING_POINT_END_SYSTEM_TIMESTEP_BEFORE_HVAC_REPORTING 9
+#define EP_CALLING_POINT_END_SYSTEM_TIMESTEP_AFTER_HVAC_REPORTING 10
+#define EP_CALLING_POINT_END_ZONE_TIMESTEP_BEFORE_ZONE_REPORTING 11
+#define EP_CALLING_POINT_END_ZONE_TIMESTEP_AFTER_ZONE_REPORTING 12
+#define EP_CALLING_POINT_EXTERNAL_INTERFACE 14
+#define EP_CALLING_POINT_COMPONENT_GET_INPUT 15
+#define EP_CALLING_POINT_UNITARY_SYSTEM_SIZING 17
+#define EP_CALLING_POINT_BEGIN_ZONE_TIMESTEP_BEFORE_INIT_HEAT_BALANCE 18
+#define EP_CALLING_POINT_BEGIN_ZONE_TIMESTEP_AFTER_INIT_HEAT_BALANCE 19
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void (*EPRuntimeCallback)(void *userData);
+
+/* Registers a callback for a calling point; returns 0 if the calling point is not supported */
+int ENERGYPLUSLIB_API epRuntimeRegisterCallback(int callingPoint, EPRuntimeCallback callback, void *userData);
+
+/* Removes all registered callbacks; they are otherwise kept across runs */
+void ENERGYPLUSLIB_API epRuntimeClearCallbacks(void);
+
+/* Output variables, e.g. ("Zone Mean Air Temperature", "ZONE ONE") */
+int ENERGYPLUSLIB_API epRuntimeGetVariableHandle(const char *variableName, const char *keyName);
+double ENERGYPLUSLIB_API epRuntimeGetVariableValue(int handle);
+
+/* EMS internal variables, e.g. ("Zone Floor Area", "ZONE ONE") */
+int ENERGYPLUSLIB_API epRuntimeGetInternalVariableHandle(const char *dataType, const char *uniqueKey);
+double ENERGYPLUSLIB_API epRuntimeGetInternalVariableValue(int handle);
+
+/* EMS actuators, e.g. ("Schedule:Compact", "Schedule Value", "HEATING SETPOINTS"). A value set by the host stays in
+   force until the host sets another value or resets the actuator. */
+int ENERGYPLUSLIB_API epRuntimeGetActuatorHandle(const char *componentType, const char *controlType, const char *uniqueKey);
+void ENERGYPLUSLIB_API epRuntimeSetActuatorValue(int handle, double value);
+void ENERGYPLUSLIB_API epRuntimeResetActuator(int handle);
+
+/* Clones the simulation, with all its geometry, CTFs, shading and sizing already set up, into numCopies new
+   processes (not available on Windows, or when SQLite output is requested). Returns 0 in the calling process, the
+   copy number 1..numCopies in each copy and -1 if no copy was made. Each copy continues the run on its own from
+   this point and writes its outputs to the subdirectory forkN of the output directory, so a callback at
+   EP_CALLING_POINT_BEGIN_NEW_ENVIRONMENT_AFTER_WARMUP can fork a warmed up model and give every copy its own
+   actuator values. The host code that follows RunEnergyPlus also runs in every copy, which should then exit. */
+int ENERGYPLUSLIB_API epRuntimeForkSimulation(int numCopies);
+
+/* Waits for the copies made by epRuntimeForkSimulation; returns the number of copies that did not succeed */
+int ENERGYPLUSLIB_API epRuntimeWaitForForks(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
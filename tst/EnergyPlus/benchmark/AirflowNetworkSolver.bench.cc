@@ -0,0 +1,96 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// EnergyPlus Headers
+#include <AirflowNetwork/Solver.hpp>
+
+#include "Fixtures/EnergyPlusBenchmarkFixture.hh"
+
+// C++ Headers
+#include <algorithm>
+
+using namespace EnergyPlus;
+using namespace AirflowNetwork;
+
+BENCHMARK_DEFINE_F(EnergyPlusBenchmarkFixture, AirflowNetworkSolver_SkylineFactorSolve)(benchmark::State &state)
+{
+    // Diagonally dominant symmetric network matrix of state.range(0) nodes, each linked to up to Bandwidth preceding nodes,
+    // factored and solved the way AIRMOV does on every Newton iteration
+    int const NumNodes(state.range(0));
+    int const Bandwidth(10);
+    NetworkNumOfNodes = NumNodes;
+
+    Array1D_int SkylineIK(NumNodes + 1);
+    SkylineIK(1) = 1;
+    for (int k = 1; k <= NumNodes; ++k) {
+        SkylineIK(k + 1) = SkylineIK(k) + std::min(k - 1, Bandwidth);
+    }
+    Array1D<Real64> const MatrixAU(SkylineIK(NumNodes + 1), -1.0);
+    Array1D<Real64> const MatrixAD(NumNodes, 2.0 * Bandwidth + 1.0);
+    Array1D<Real64> RHS(NumNodes);
+    for (int n = 1; n <= NumNodes; ++n) {
+        RHS(n) = 0.01 * (n % 17) - 0.08;
+    }
+
+    Array1D<Real64> FactoredAU(MatrixAU.size());
+    Array1D<Real64> FactoredAD(NumNodes);
+    Array1D<Real64> B(NumNodes);
+    for (auto _ : state) {
+        FactoredAU = MatrixAU;
+        FactoredAD = MatrixAD;
+        B = RHS;
+        FACSKY(FactoredAU, FactoredAD, FactoredAU, SkylineIK, NumNodes, 0);
+        SLVSKY(FactoredAU, FactoredAD, FactoredAU, B, SkylineIK, NumNodes, 0);
+        benchmark::DoNotOptimize(B(1));
+    }
+    state.SetItemsProcessed(state.iterations() * NumNodes);
+}
+BENCHMARK_REGISTER_F(EnergyPlusBenchmarkFixture, AirflowNetworkSolver_SkylineFactorSolve)->Arg(50)->Arg(200)->Arg(800);
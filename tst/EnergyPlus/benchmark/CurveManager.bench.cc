@@ -0,0 +1,139 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/CurveManager.hh>
+
+#include "Fixtures/EnergyPlusBenchmarkFixture.hh"
+
+#include <cstdint>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::CurveManager;
+
+namespace {
+
+// Performance curves in the form a DX coil model evaluates them every iteration
+class CurveManagerBenchmark : public EnergyPlusBenchmarkFixture
+{
+public:
+    void SetUp(benchmark::State const &state) override
+    {
+        EnergyPlusBenchmarkFixture::SetUp(state);
+        process_idf(delimited_string({
+            "Curve:Biquadratic,",
+            "  BenchBiquadratic,        !- Name",
+            "  0.942587793,             !- Coefficient1 Constant",
+            "  0.009543347,             !- Coefficient2 x",
+            "  0.000683770,             !- Coefficient3 x**2",
+            "  -0.011042676,            !- Coefficient4 y",
+            "  0.000005249,             !- Coefficient5 y**2",
+            "  -0.000009720,            !- Coefficient6 x*y",
+            "  12.77778,                !- Minimum Value of x",
+            "  23.88889,                !- Maximum Value of x",
+            "  18.0,                    !- Minimum Value of y",
+            "  46.11111;                !- Maximum Value of y",
+            "Table:OneIndependentVariable,",
+            "  BenchTable,              !- Name",
+            "  Linear,                  !- Curve Type",
+            "  LinearInterpolationOfTable,  !- Interpolation Method",
+            "  0.0,                     !- Minimum Value of X",
+            "  1.0,                     !- Maximum Value of X",
+            "  ,                        !- Minimum Table Output",
+            "  ,                        !- Maximum Table Output",
+            "  Dimensionless,           !- Input Unit Type for X",
+            "  Dimensionless,           !- Output Unit Type",
+            "  ,                        !- Normalization Reference",
+            "  0.0, 0.00,",
+            "  0.2, 0.35,",
+            "  0.4, 0.62,",
+            "  0.6, 0.81,",
+            "  0.8, 0.93,",
+            "  1.0, 1.00;",
+        }));
+        GetCurveInput();
+        GetCurvesInputFlag = false;
+        BiquadraticIndex = GetCurveIndex("BENCHBIQUADRATIC");
+        TableIndex = GetCurveIndex("BENCHTABLE");
+    }
+
+protected:
+    int BiquadraticIndex = 0;
+    int TableIndex = 0;
+};
+
+} // namespace
+
+BENCHMARK_F(CurveManagerBenchmark, CurveManager_BiquadraticCurveValue)(benchmark::State &state)
+{
+    int64_t evaluations(0);
+    for (auto _ : state) {
+        for (Real64 wetBulb = 13.0; wetBulb < 24.0; wetBulb += 0.5) {
+            for (Real64 dryBulb = 18.0; dryBulb < 46.0; dryBulb += 2.0) {
+                benchmark::DoNotOptimize(CurveValue(BiquadraticIndex, wetBulb, dryBulb));
+                ++evaluations;
+            }
+        }
+    }
+    state.SetItemsProcessed(evaluations);
+}
+
+BENCHMARK_F(CurveManagerBenchmark, CurveManager_TableLookupCurveValue)(benchmark::State &state)
+{
+    int64_t evaluations(0);
+    for (auto _ : state) {
+        for (Real64 partLoad = 0.0; partLoad <= 1.0; partLoad += 0.01) {
+            benchmark::DoNotOptimize(CurveValue(TableIndex, partLoad));
+            ++evaluations;
+        }
+    }
+    state.SetItemsProcessed(evaluations);
+}
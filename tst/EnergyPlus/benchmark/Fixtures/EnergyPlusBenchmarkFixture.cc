@@ -0,0 +1,151 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataIPShortCuts.hh>
+#include <EnergyPlus/InputProcessing/IdfParser.hh>
+#include <EnergyPlus/InputProcessing/InputProcessor.hh>
+#include <EnergyPlus/InputProcessing/InputValidation.hh>
+#include <EnergyPlus/Psychrometrics.hh>
+#include <EnergyPlus/ReportCoilSelection.hh>
+#include <EnergyPlus/SimulationManager.hh>
+#include <EnergyPlus/StateManagement.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+#include "EnergyPlusBenchmarkFixture.hh"
+
+namespace EnergyPlus {
+
+void EnergyPlusBenchmarkFixture::SetUp(benchmark::State const &)
+{
+    // The schema only needs to be loaded once for all benchmarks
+    if (!inputProcessor) inputProcessor = InputProcessor::factory();
+
+    clearAllStates();
+
+    eso_stream = std::unique_ptr<std::ostringstream>(new std::ostringstream);
+    eio_stream = std::unique_ptr<std::ostringstream>(new std::ostringstream);
+    mtr_stream = std::unique_ptr<std::ostringstream>(new std::ostringstream);
+    err_stream = std::unique_ptr<std::ostringstream>(new std::ostringstream);
+    json_stream = std::unique_ptr<std::ostringstream>(new std::ostringstream);
+
+    DataGlobals::eso_stream = eso_stream.get();
+    DataGlobals::eio_stream = eio_stream.get();
+    DataGlobals::mtr_stream = mtr_stream.get();
+    DataGlobals::err_stream = err_stream.get();
+    DataGlobals::jsonOutputStreams.json_stream = json_stream.get();
+
+    UtilityRoutines::outputErrorHeader = false;
+
+    Psychrometrics::InitializePsychRoutines();
+    createCoilSelectionReportObj();
+}
+
+void EnergyPlusBenchmarkFixture::TearDown(benchmark::State const &)
+{
+    clearAllStates();
+}
+
+bool EnergyPlusBenchmarkFixture::process_idf(std::string const &idf_snippet)
+{
+    bool success = true;
+    inputProcessor->epJSON = inputProcessor->idf_parser->decode(idf_snippet, *inputProcessor->schema, success);
+
+    if (inputProcessor->epJSON.find("Building") == inputProcessor->epJSON.end()) {
+        inputProcessor->epJSON["Building"] = {{"Bldg",
+                                               {{"idf_order", 0},
+                                                {"north_axis", 0.0},
+                                                {"terrain", "Suburbs"},
+                                                {"loads_convergence_tolerance_value", 0.04},
+                                                {"temperature_convergence_tolerance_value", 0.4000},
+                                                {"solar_distribution", "FullExterior"},
+                                                {"maximum_number_of_warmup_days", 25},
+                                                {"minimum_number_of_warmup_days", 6}}}};
+    }
+    if (inputProcessor->epJSON.find("GlobalGeometryRules") == inputProcessor->epJSON.end()) {
+        inputProcessor->epJSON["GlobalGeometryRules"] = {{"",
+                                                          {{"idf_order", 0},
+                                                           {"starting_vertex_position", "UpperLeftCorner"},
+                                                           {"vertex_entry_direction", "Counterclockwise"},
+                                                           {"coordinate_system", "Relative"},
+                                                           {"daylighting_reference_point_coordinate_system", "Relative"},
+                                                           {"rectangular_surface_coordinate_system", "Relative"}}}};
+    }
+
+    int MaxArgs = 0;
+    int MaxAlpha = 0;
+    int MaxNumeric = 0;
+    inputProcessor->getMaxSchemaArgs(MaxArgs, MaxAlpha, MaxNumeric);
+
+    DataIPShortCuts::cAlphaFieldNames.allocate(MaxAlpha);
+    DataIPShortCuts::cAlphaArgs.allocate(MaxAlpha);
+    DataIPShortCuts::lAlphaFieldBlanks.dimension(MaxAlpha, false);
+    DataIPShortCuts::cNumericFieldNames.allocate(MaxNumeric);
+    DataIPShortCuts::rNumericArgs.dimension(MaxNumeric, 0.0);
+    DataIPShortCuts::lNumericFieldBlanks.dimension(MaxNumeric, false);
+
+    bool is_valid = inputProcessor->validation->validate(inputProcessor->epJSON);
+    bool hasErrors = inputProcessor->processErrors();
+
+    inputProcessor->initializeMaps();
+    SimulationManager::PostIPProcessing();
+
+    return success && is_valid && !hasErrors;
+}
+
+std::string EnergyPlusBenchmarkFixture::delimited_string(std::vector<std::string> const &strings, std::string const &delimiter)
+{
+    std::ostringstream compare_text;
+    for (auto const &str : strings) {
+        compare_text << str << delimiter;
+    }
+    return compare_text.str();
+}
+
+} // namespace EnergyPlus
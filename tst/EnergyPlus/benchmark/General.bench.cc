@@ -0,0 +1,149 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/General.hh>
+
+#include "Fixtures/EnergyPlusBenchmarkFixture.hh"
+
+#include <cstdint>
+#include <functional>
+
+using namespace EnergyPlus;
+
+namespace {
+
+Real64 const SolveRootAcc(1.0e-6); // SolveRoot accuracy used by most component models
+int const SolveRootMaxIte(500);    // maximum number of SolveRoot iterations
+int const NumLoads(50);            // number of part load conditions solved per benchmark iteration
+
+// Part load residual shaped like a cycling component: delivered output is a cubic in the part load ratio
+Real64 partLoadResidual(Real64 const PartLoadRatio, Real64 const LoadFraction)
+{
+    Real64 const Delivered(PartLoadRatio * (0.85 + 0.25 * PartLoadRatio - 0.1 * PartLoadRatio * PartLoadRatio));
+    return (Delivered - LoadFraction) / LoadFraction;
+}
+
+Real64 loadFraction(int const LoadNum)
+{
+    return 0.02 + 0.96 * LoadNum / NumLoads;
+}
+
+} // namespace
+
+BENCHMARK_F(EnergyPlusBenchmarkFixture, General_SolveRootStdFunction)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        for (int LoadNum = 0; LoadNum < NumLoads; ++LoadNum) {
+            Real64 const LoadFraction(loadFraction(LoadNum));
+            std::function<Real64(Real64 const)> const f = [LoadFraction](Real64 const PLR) { return partLoadResidual(PLR, LoadFraction); };
+            int SolFla(0);
+            Real64 PartLoadRatio(0.0);
+            General::SolveRoot(SolveRootAcc, SolveRootMaxIte, SolFla, PartLoadRatio, f, 0.0, 1.0);
+            benchmark::DoNotOptimize(PartLoadRatio);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * NumLoads);
+}
+
+BENCHMARK_F(EnergyPlusBenchmarkFixture, General_SolveRootParArray)(benchmark::State &state)
+{
+    Array1D<Real64> Par(1);
+    for (auto _ : state) {
+        for (int LoadNum = 0; LoadNum < NumLoads; ++LoadNum) {
+            Par(1) = loadFraction(LoadNum);
+            int SolFla(0);
+            Real64 PartLoadRatio(0.0);
+            General::SolveRoot(SolveRootAcc,
+                               SolveRootMaxIte,
+                               SolFla,
+                               PartLoadRatio,
+                               [](Real64 const PLR, Array1<Real64> const &Par) { return partLoadResidual(PLR, Par(1)); },
+                               0.0,
+                               1.0,
+                               Par);
+            benchmark::DoNotOptimize(PartLoadRatio);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * NumLoads);
+}
+
+BENCHMARK_F(EnergyPlusBenchmarkFixture, General_SolveRootInlined)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        for (int LoadNum = 0; LoadNum < NumLoads; ++LoadNum) {
+            Real64 const LoadFraction(loadFraction(LoadNum));
+            auto const f = [LoadFraction](Real64 const PLR) { return partLoadResidual(PLR, LoadFraction); };
+            int SolFla(0);
+            Real64 PartLoadRatio(0.0);
+            General::SolveRoot(SolveRootAcc, SolveRootMaxIte, SolFla, PartLoadRatio, f, 0.0, 1.0);
+            benchmark::DoNotOptimize(PartLoadRatio);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * NumLoads);
+}
+
+BENCHMARK_F(EnergyPlusBenchmarkFixture, General_SolveRootWarmStart)(benchmark::State &state)
+{
+    // One component seeing a slowly drifting load, as between HVAC iterations
+    General::SolveRootContext Context;
+    for (auto _ : state) {
+        for (int LoadNum = 0; LoadNum < NumLoads; ++LoadNum) {
+            Real64 const LoadFraction(0.5 + 0.001 * LoadNum);
+            std::function<Real64(Real64 const)> const f = [LoadFraction](Real64 const PLR) { return partLoadResidual(PLR, LoadFraction); };
+            int SolFla(0);
+            Real64 PartLoadRatio(0.0);
+            General::SolveRoot(SolveRootAcc, SolveRootMaxIte, SolFla, PartLoadRatio, f, 0.0, 1.0, Context);
+            benchmark::DoNotOptimize(PartLoadRatio);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * NumLoads);
+}
@@ -0,0 +1,101 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/HeatBalanceIntRadExchange.hh>
+
+#include "Fixtures/EnergyPlusBenchmarkFixture.hh"
+
+using namespace EnergyPlus;
+
+BENCHMARK_DEFINE_F(EnergyPlusBenchmarkFixture, HeatBalanceIntRadExchange_CalcInteriorRadExchange)(benchmark::State &state)
+{
+    // One zone of state.range(0) walls facing in all directions; the exchange matrices are built by the first call
+    int const NumSurfaces(state.range(0));
+    DataGlobals::NumOfZones = 1;
+    DataSurfaces::TotSurfaces = NumSurfaces;
+    DataHeatBalance::Zone.allocate(1);
+    DataHeatBalance::Construct.allocate(1);
+    DataSurfaces::Surface.allocate(NumSurfaces);
+    DataSurfaces::SurfaceWindow.allocate(NumSurfaces);
+    DataHeatBalance::Construct(1).InsideAbsorpThermal = 0.9;
+    DataHeatBalance::Zone(1).Name = "BENCHMARK ZONE";
+    DataHeatBalance::Zone(1).SurfaceFirst = 1;
+    DataHeatBalance::Zone(1).SurfaceLast = NumSurfaces;
+    Array1D<Real64> SurfaceTemp(NumSurfaces);
+    for (int SurfNum = 1; SurfNum <= NumSurfaces; ++SurfNum) {
+        auto &surface(DataSurfaces::Surface(SurfNum));
+        surface.Name = "WALL " + std::to_string(SurfNum);
+        surface.Class = DataSurfaces::SurfaceClass_Wall;
+        surface.HeatTransSurf = true;
+        surface.Construction = 1;
+        surface.Area = 5.0 + (SurfNum % 7);
+        surface.Azimuth = 360.0 * (SurfNum - 1) / NumSurfaces;
+        surface.Tilt = 90.0;
+        SurfaceTemp(SurfNum) = 18.0 + 0.1 * (SurfNum % 50);
+    }
+
+    Array1D<Real64> NetLWRadToSurf(NumSurfaces, 0.0);
+    DataGlobals::BeginEnvrnFlag = true;
+    HeatBalanceIntRadExchange::CalcInteriorRadExchange(SurfaceTemp, 0, NetLWRadToSurf);
+    DataGlobals::BeginEnvrnFlag = false;
+
+    // Time the calls made inside the surface heat balance iterations
+    for (auto _ : state) {
+        HeatBalanceIntRadExchange::CalcInteriorRadExchange(SurfaceTemp, 1, NetLWRadToSurf);
+        benchmark::DoNotOptimize(NetLWRadToSurf(1));
+    }
+    state.SetItemsProcessed(state.iterations() * NumSurfaces);
+}
+BENCHMARK_REGISTER_F(EnergyPlusBenchmarkFixture, HeatBalanceIntRadExchange_CalcInteriorRadExchange)->Arg(6)->Arg(24)->Arg(96);
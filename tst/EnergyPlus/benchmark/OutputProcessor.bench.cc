@@ -0,0 +1,123 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/OutputProcessor.hh>
+
+#include "Fixtures/EnergyPlusBenchmarkFixture.hh"
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::OutputProcessor;
+
+BENCHMARK_DEFINE_F(EnergyPlusBenchmarkFixture, OutputProcessor_ZoneTimestepAccumulation)(benchmark::State &state)
+{
+    // state.range(0) hourly zone variables, half of them also on the electricity meters, updated at a zone time step
+    // that does not end the hour: the cost measured is the per time step accumulation, not the writing of output
+    int const NumVariables(state.range(0));
+    process_idf(delimited_string({
+        "Output:Variable,*,Benchmark Zone Temperature,hourly;",
+        "Output:Variable,*,Benchmark Equipment Electric Energy,hourly;",
+    }));
+
+    DataGlobals::DayOfSim = 1;
+    DataGlobals::DayOfSimChr = "1";
+    DataGlobals::HourOfDay = 1;
+    DataGlobals::NumOfDayInEnvrn = 1;
+    DataGlobals::MinutesPerTimeStep = 10;
+    DataEnvironment::Month = 1;
+    DataEnvironment::DayOfMonth = 1;
+    DataEnvironment::DayOfWeek = 1;
+
+    TimeValue.allocate(2);
+    Real64 timeStep(1.0 / 6); // the time pointers keep referring to this for the rest of the benchmark
+    SetupTimePointers("Zone", timeStep);
+    SetupTimePointers("HVAC", timeStep);
+    TimeValue(1).CurMinute = 10;
+    TimeValue(2).CurMinute = 10;
+
+    GetReportVariableInput();
+    std::vector<Real64> values(NumVariables, 0.0);
+    for (int VarNum = 0; VarNum < NumVariables; ++VarNum) {
+        std::string const Key("BENCHMARK ZONE " + std::to_string(VarNum + 1));
+        if (VarNum % 2 == 0) {
+            SetupOutputVariable("Benchmark Zone Temperature", OutputProcessor::Unit::C, values[VarNum], "Zone", "Average", Key);
+        } else {
+            SetupOutputVariable("Benchmark Equipment Electric Energy",
+                                OutputProcessor::Unit::J,
+                                values[VarNum],
+                                "Zone",
+                                "Sum",
+                                Key,
+                                _,
+                                "Electricity",
+                                "InteriorEquipment",
+                                "General",
+                                "Building");
+        }
+    }
+
+    int step(0);
+    for (auto _ : state) {
+        for (int VarNum = 0; VarNum < NumVariables; ++VarNum) {
+            values[VarNum] = 20.0 + 0.01 * ((VarNum + step) % 100);
+        }
+        UpdateDataandReport(DataGlobals::ZoneTSReporting);
+        ++step;
+    }
+    state.SetItemsProcessed(state.iterations() * NumVariables);
+}
+BENCHMARK_REGISTER_F(EnergyPlusBenchmarkFixture, OutputProcessor_ZoneTimestepAccumulation)->Arg(100)->Arg(1000);
@@ -0,0 +1,167 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/PierceSurface.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Vector3.hh>
+
+// C++ Headers
+#include <cmath>
+#include <vector>
+
+using namespace EnergyPlus;
+using DataVectorTypes::Vector;
+
+namespace {
+
+// Fan of unit ray directions from a point above the surfaces, half of them pointing down at the surfaces
+std::vector<Vector> rayFan()
+{
+    std::vector<Vector> dirs;
+    for (int i = -8; i <= 8; ++i) {
+        for (int j = -8; j <= 8; ++j) {
+            Vector dir(0.2 * i, 0.2 * j, (i + j) % 2 == 0 ? -1.0 : 1.0);
+            dir.normalize();
+            dirs.push_back(dir);
+        }
+    }
+    return dirs;
+}
+
+Vector const RayOrigin(1.5, 1.0, 1.0);
+
+DataSurfaces::SurfaceData rectangle()
+{
+    DataSurfaces::SurfaceData floor;
+    floor.Vertex.dimension(4);
+    floor.Vertex = {Vector(0, 0, 0), Vector(3, 0, 0), Vector(3, 2, 0), Vector(0, 2, 0)};
+    floor.Shape = DataSurfaces::SurfaceShape::Rectangle;
+    floor.set_computed_geometry();
+    return floor;
+}
+
+DataSurfaces::SurfaceData convexOctagon()
+{
+    DataSurfaces::SurfaceData floor;
+    floor.Vertex.reserve(8);
+    for (int i = 0; i < 8; ++i) {
+        Real64 const angle(i * DataGlobals::TwoPi / 8);
+        floor.Vertex.push_back(Vector(1.5 + std::cos(angle), 1.0 + std::sin(angle), 0.0));
+    }
+    floor.IsConvex = true;
+    floor.set_computed_geometry();
+    return floor;
+}
+
+DataSurfaces::SurfaceData nonconvexUShape()
+{
+    DataSurfaces::SurfaceData ushape;
+    ushape.Vertex.dimension(8);
+    ushape.Vertex = {Vector(0, 0, 0), Vector(3, 0, 0), Vector(3, 2, 0), Vector(2, 2, 0),
+                     Vector(2, 1, 0), Vector(1, 1, 0), Vector(1, 2, 0), Vector(0, 2, 0)};
+    ushape.IsConvex = false;
+    ushape.set_computed_geometry();
+    return ushape;
+}
+
+void pierceSurfaceRays(benchmark::State &state, DataSurfaces::SurfaceData const &surface)
+{
+    auto const dirs(rayFan());
+    for (auto _ : state) {
+        for (auto const &dir : dirs) {
+            bool hit(false);
+            Vector hitPt(0.0);
+            PierceSurface(surface, RayOrigin, dir, hitPt, hit);
+            benchmark::DoNotOptimize(hit);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * dirs.size());
+}
+
+} // namespace
+
+static void PierceSurface_Rectangular(benchmark::State &state)
+{
+    pierceSurfaceRays(state, rectangle());
+}
+BENCHMARK(PierceSurface_Rectangular);
+
+static void PierceSurface_Convex(benchmark::State &state)
+{
+    pierceSurfaceRays(state, convexOctagon());
+}
+BENCHMARK(PierceSurface_Convex);
+
+static void PierceSurface_Nonconvex(benchmark::State &state)
+{
+    pierceSurfaceRays(state, nonconvexUShape());
+}
+BENCHMARK(PierceSurface_Nonconvex);
+
+static void PierceSurface_NonconvexRayPacket(benchmark::State &state)
+{
+    DataSurfaces::SurfaceData const ushape(nonconvexUShape());
+    RayPacket rays;
+    rays.ori = RayOrigin;
+    for (auto const &dir : rayFan()) {
+        rays.add(dir);
+    }
+    for (auto _ : state) {
+        rays.reset();
+        PierceSurface(ushape, rays);
+        benchmark::DoNotOptimize(rays.nHit);
+    }
+    state.SetItemsProcessed(state.iterations() * rays.size());
+}
+BENCHMARK(PierceSurface_NonconvexRayPacket);
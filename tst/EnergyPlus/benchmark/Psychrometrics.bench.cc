@@ -0,0 +1,151 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/Psychrometrics.hh>
+
+#include "Fixtures/EnergyPlusBenchmarkFixture.hh"
+
+#include <vector>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Psychrometrics;
+
+namespace {
+
+struct MoistAirState
+{
+    Real64 Tdb; // dry-bulb temperature {C}
+    Real64 W;   // humidity ratio {kgWater/kgDryAir}
+};
+
+// Fixed grid of unsaturated air states covering the range seen by coils and zones
+std::vector<MoistAirState> moistAirStates()
+{
+    std::vector<MoistAirState> states;
+    for (int i = 0; i < 16; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            states.push_back({10.0 + 2.0 * i, 0.001 + 0.001 * j});
+        }
+    }
+    return states;
+}
+
+Real64 const BenchmarkPb(101325.0); // barometric pressure {Pa}
+
+} // namespace
+
+BENCHMARK_F(EnergyPlusBenchmarkFixture, Psychrometrics_PsyTwbFnTdbWPb)(benchmark::State &state)
+{
+    auto const states(moistAirStates());
+    for (auto _ : state) {
+        for (auto const &air : states) {
+            benchmark::DoNotOptimize(PsyTwbFnTdbWPb(air.Tdb, air.W, BenchmarkPb));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * states.size());
+}
+
+BENCHMARK_F(EnergyPlusBenchmarkFixture, Psychrometrics_PsyTsatFnHPb)(benchmark::State &state)
+{
+    auto const states(moistAirStates());
+    std::vector<Real64> enthalpies;
+    for (auto const &air : states) {
+        enthalpies.push_back(PsyHFnTdbW(air.Tdb, air.W));
+    }
+    for (auto _ : state) {
+        for (Real64 const H : enthalpies) {
+            benchmark::DoNotOptimize(PsyTsatFnHPb(H, BenchmarkPb));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * enthalpies.size());
+}
+
+BENCHMARK_F(EnergyPlusBenchmarkFixture, Psychrometrics_PsyTsatFnPb)(benchmark::State &state)
+{
+    std::vector<Real64> pressures;
+    for (int i = 0; i < 128; ++i) {
+        pressures.push_back(500.0 + 1000.0 * i);
+    }
+    for (auto _ : state) {
+        for (Real64 const Press : pressures) {
+            benchmark::DoNotOptimize(PsyTsatFnPb(Press));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * pressures.size());
+}
+
+BENCHMARK_F(EnergyPlusBenchmarkFixture, Psychrometrics_PsyPsatFnTemp)(benchmark::State &state)
+{
+    auto const states(moistAirStates());
+    for (auto _ : state) {
+        for (auto const &air : states) {
+            benchmark::DoNotOptimize(PsyPsatFnTemp(air.Tdb));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * states.size());
+}
+
+BENCHMARK_F(EnergyPlusBenchmarkFixture, Psychrometrics_PropertySet)(benchmark::State &state)
+{
+    // The handful of inline property functions a typical coil model evaluates for each air state
+    auto const states(moistAirStates());
+    for (auto _ : state) {
+        for (auto const &air : states) {
+            benchmark::DoNotOptimize(PsyRhoAirFnPbTdbW(BenchmarkPb, air.Tdb, air.W));
+            benchmark::DoNotOptimize(PsyCpAirFnWTdb(air.W, air.Tdb));
+            benchmark::DoNotOptimize(PsyHFnTdbW(air.Tdb, air.W));
+            benchmark::DoNotOptimize(PsyRhFnTdbWPb(air.Tdb, air.W, BenchmarkPb));
+            benchmark::DoNotOptimize(PsyTdpFnWPb(air.W, BenchmarkPb));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * states.size());
+}
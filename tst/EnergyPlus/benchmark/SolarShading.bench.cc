@@ -0,0 +1,126 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/SolarShading.hh>
+
+#include "Fixtures/EnergyPlusBenchmarkFixture.hh"
+
+#include <cmath>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::SolarShading;
+
+namespace {
+
+int const NumClipFigures(8); // clipping squares swept across the subject figure
+int const ResultFigure(NumClipFigures + 2);
+
+// Load figure 1, an octagon of radius 2 m, and figures 2..NumClipFigures+1, 1 m squares placed across its edge,
+// into the homogeneous coordinate arrays the shadow overlap calculation works on
+void setupClippingFigures()
+{
+    DataSurfaces::MaxVerticesPerSurface = 8;
+    DataSurfaces::TotSurfaces = 1;
+    AllocateShadowingThreadBuffers();
+
+    for (int N = 1; N <= 8; ++N) {
+        Real64 const Angle(DataGlobals::TwoPi * (N - 1) / 8);
+        XVS(N) = 2.0 * std::cos(Angle);
+        YVS(N) = 2.0 * std::sin(Angle);
+    }
+    HTRANS1(1, 8);
+
+    for (int Fig = 1; Fig <= NumClipFigures; ++Fig) {
+        Real64 const X0(-2.5 + 0.5 * Fig);
+        Real64 const Y0(1.0 - 0.25 * Fig);
+        XVS(1) = X0;
+        YVS(1) = Y0 + 1.0;
+        XVS(2) = X0;
+        YVS(2) = Y0;
+        XVS(3) = X0 + 1.0;
+        YVS(3) = Y0;
+        XVS(4) = X0 + 1.0;
+        YVS(4) = Y0 + 1.0;
+        HTRANS1(Fig + 1, 4);
+    }
+}
+
+} // namespace
+
+BENCHMARK_F(EnergyPlusBenchmarkFixture, SolarShading_DeterminePolygonOverlapSutherlandHodgman)(benchmark::State &state)
+{
+    DataSystemVariables::SutherlandHodgman = true;
+    setupClippingFigures();
+    for (auto _ : state) {
+        for (int Fig = 2; Fig <= NumClipFigures + 1; ++Fig) {
+            DeterminePolygonOverlap(1, Fig, ResultFigure);
+            benchmark::DoNotOptimize(OverlapStatus);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * NumClipFigures);
+}
+
+BENCHMARK_F(EnergyPlusBenchmarkFixture, SolarShading_DeterminePolygonOverlapWeilerAtherton)(benchmark::State &state)
+{
+    DataSystemVariables::SutherlandHodgman = false;
+    setupClippingFigures();
+    for (auto _ : state) {
+        for (int Fig = 2; Fig <= NumClipFigures + 1; ++Fig) {
+            DeterminePolygonOverlap(1, Fig, ResultFigure);
+            benchmark::DoNotOptimize(OverlapStatus);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * NumClipFigures);
+}
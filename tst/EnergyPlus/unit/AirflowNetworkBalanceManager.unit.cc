@@ -68,6 +68,7 @@
 #include <EnergyPlus/DataHeatBalance.hh>
 #include <EnergyPlus/DataIPShortCuts.hh>
 #include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/HeatBalanceManager.hh>
 #include <EnergyPlus/OutAirNodeManager.hh>
 #include <EnergyPlus/Psychrometrics.hh>
@@ -4606,6 +4607,18 @@ TEST_F(EnergyPlusFixture, TestWindPressureTable)
     azimuth = 105.0;
     p = AirflowNetworkBalanceManager::CalcWindPressure(1, false, true, azimuth, windSpeed, windDir, dryBulb, humRat);
     EXPECT_DOUBLE_EQ(-0.56 * 0.5 * 1.1841123742118911, p);
+
+    // The whole degree tables reproduce the piecewise linear curve
+    DataSystemVariables::AirflowNetworkCpTables = true;
+    azimuth = 0.0;
+    p = AirflowNetworkBalanceManager::CalcWindPressure(1, false, false, azimuth, windSpeed, windDir, dryBulb, humRat);
+    EXPECT_NEAR(0.54 * 0.5 * 1.1841123742118911, p, 1.0e-12);
+    azimuth = 90.0;
+    p = AirflowNetworkBalanceManager::CalcWindPressure(1, false, true, azimuth, windSpeed, windDir, dryBulb, humRat);
+    EXPECT_NEAR(-0.26 * 0.5 * 1.1841123742118911, p, 1.0e-12);
+    p = AirflowNetworkBalanceManager::CalcWindPressure(1, false, false, azimuth, windSpeed, 97.5, dryBulb, humRat);
+    EXPECT_NEAR(CurveManager::CurveValue(1, 97.5) * 0.5 * 1.1841123742118911, p, 1.0e-12);
+    EXPECT_EQ(361u, AirflowNetworkBalanceManager::WindPressureCoeffTables[1].size());
 }
 
 TEST_F(EnergyPlusFixture, TestWPCValue)
@@ -13303,4 +13316,39 @@ TEST_F(EnergyPlusFixture, BasicAdvancedSingleSidedAvoidCrashTest)
     EXPECT_FALSE(resimu);
 }
 
+TEST_F(EnergyPlusFixture, AirflowNetworkBalanceManager_SparseContaminantSolve)
+{
+    // Node 1 is prescribed; flow runs 1 -> 2 -> 3 and 3 -> 2
+    int const NumNodes = 3;
+    Array1D<Real64> const Matrix({1.0e10, 0.0, 0.0, -0.5, 0.8, -0.3, 0.0, -0.5, 0.5});
+    Array1D<Real64> const Source({400.0e10, 0.0, 0.0});
+    IVEC.allocate(NumNodes + 20);
+
+    // Reference solution from the explicit inverse
+    MA = Matrix;
+    MRXINV(NumNodes);
+    Array1D<Real64> Expected(NumNodes, 0.0);
+    for (int i = 1; i <= NumNodes; ++i) {
+        for (int j = 1; j <= NumNodes; ++j) {
+            Expected(i) += MA((i - 1) * NumNodes + j) * Source(j);
+        }
+    }
+
+    MA = Matrix;
+    MV = Source;
+    MRXSLV(NumNodes, true);
+    for (int i = 1; i <= NumNodes; ++i) {
+        EXPECT_NEAR(Expected(i), MV(i), 1.0e-6);
+    }
+    EXPECT_NEAR(400.0, MV(3), 1.0e-6);
+
+    // A second species reuses the factors
+    MA = 0.0;
+    MV = Source * 0.5;
+    MRXSLV(NumNodes, false);
+    for (int i = 1; i <= NumNodes; ++i) {
+        EXPECT_NEAR(0.5 * Expected(i), MV(i), 1.0e-6);
+    }
+}
+
 } // namespace EnergyPlus
@@ -155,3 +155,150 @@ TEST_F(EnergyPlusFixture, AirflowNetworkSolverTest_Coil)
     DisSysCompCoilData.deallocate();
     AirflowNetworkCompData.deallocate();
 }
+
+TEST_F(EnergyPlusFixture, AirflowNetworkSolverTest_SparseSolvers)
+{
+    // Node 1 is external; nodes 2, 3 and 4 are linked 2-3, 2-4 and 3-4
+    NetworkNumOfNodes = 4;
+    Array1D_int SkylineIK({1, 1, 1, 2, 4});
+    Array1D<Real64> const Diagonal({1.0, 3.0, 4.0, 5.0});
+    Array1D<Real64> const Upper({-1.0, -1.0, -2.0});
+    Array1D<Real64> const RHS({10.0, 1.0, 2.0, 3.0});
+
+    Array1D<Real64> SkylineAD(Diagonal);
+    Array1D<Real64> SkylineAU(Upper);
+    Array1D<Real64> Expected(RHS);
+    FACSKY(SkylineAU, SkylineAD, SkylineAU, SkylineIK, NetworkNumOfNodes, 0);
+    SLVSKY(SkylineAU, SkylineAD, SkylineAU, Expected, SkylineIK, NetworkNumOfNodes, 0);
+    EXPECT_DOUBLE_EQ(10.0, Expected(1));
+
+    AirflowNetworkSimu.solver = AirflowNetworkSimuProp::Solver::SparseLDLT;
+    Array1D<Real64> Direct(RHS);
+    SLVSPR(Upper, Diagonal, Direct, SkylineIK, NetworkNumOfNodes, true);
+
+    AirflowNetworkSimu.solver = AirflowNetworkSimuProp::Solver::SparseConjugateGradient;
+    Array1D<Real64> Iterative(RHS);
+    SLVSPR(Upper, Diagonal, Iterative, SkylineIK, NetworkNumOfNodes, true);
+
+    // Without refactoring, the factors of the previous matrix are used
+    AirflowNetworkSimu.solver = AirflowNetworkSimuProp::Solver::SparseLDLT;
+    Array1D<Real64> const Changed({1.0, 6.0, 8.0, 10.0});
+    Array1D<Real64> Reused(RHS);
+    SLVSPR(Upper, Diagonal, Reused, SkylineIK, NetworkNumOfNodes, true);
+    Reused = RHS;
+    SLVSPR(Upper, Changed, Reused, SkylineIK, NetworkNumOfNodes, false);
+
+    for (int n = 1; n <= NetworkNumOfNodes; ++n) {
+        EXPECT_NEAR(Expected(n), Direct(n), 1.0e-10);
+        EXPECT_NEAR(Expected(n), Iterative(n), 1.0e-8);
+        EXPECT_NEAR(Expected(n), Reused(n), 1.0e-10);
+    }
+
+    AirflowNetworkSimu.solver = AirflowNetworkSimuProp::Solver::SkylineLU;
+    NetworkNumOfNodes = 0;
+}
+
+TEST_F(EnergyPlusFixture, AirflowNetworkSolverTest_ReorderNodes)
+{
+    // Internal nodes 1 to 5 form the chain 1-5-2-4-3; node 6 is external and linked to node 1
+    NetworkNumOfNodes = 6;
+    NetworkNumOfLinks = 5;
+    AirflowNetworkNodeData.allocate(NetworkNumOfNodes);
+    for (int n = 1; n <= 5; ++n) {
+        AirflowNetworkNodeData(n).NodeTypeNum = 0;
+    }
+    AirflowNetworkNodeData(6).NodeTypeNum = 1;
+    AirflowNetworkLinkageData.allocate(NetworkNumOfLinks);
+    AirflowNetworkLinkageData(1).NodeNums = {{1, 5}};
+    AirflowNetworkLinkageData(2).NodeNums = {{5, 2}};
+    AirflowNetworkLinkageData(3).NodeNums = {{2, 4}};
+    AirflowNetworkLinkageData(4).NodeNums = {{4, 3}};
+    AirflowNetworkLinkageData(5).NodeNums = {{6, 1}};
+    ID.allocate(NetworkNumOfNodes);
+    IK.allocate(NetworkNumOfNodes + 1);
+
+    ReorderNodes();
+
+    // Linked internal nodes become neighboring equations and the external node is numbered last
+    for (int i = 1; i <= 4; ++i) {
+        EXPECT_EQ(1, std::abs(ID(AirflowNetworkLinkageData(i).NodeNums[0]) - ID(AirflowNetworkLinkageData(i).NodeNums[1])));
+    }
+    EXPECT_EQ(6, ID(6));
+
+    // Each column holds at most one off-diagonal term
+    SETSKY();
+    EXPECT_EQ(5, IK(NetworkNumOfNodes + 1));
+
+    NetworkNumOfNodes = 0;
+    NetworkNumOfLinks = 0;
+}
+
+TEST_F(EnergyPlusFixture, AirflowNetworkSolverTest_CrackGroup)
+{
+    // One crack between internal node 1 and external node 2
+    NetworkNumOfNodes = 2;
+    NetworkNumOfLinks = 1;
+    NumOfLinksMultiZone = 1;
+    AirflowNetworkNodeData.allocate(2);
+    AirflowNetworkNodeData(1).NodeTypeNum = 0;
+    AirflowNetworkNodeData(2).NodeTypeNum = 1;
+    AirflowNetworkCompData.allocate(1);
+    AirflowNetworkCompData(1).CompTypeNum = CompTypeNum_SCR;
+    AirflowNetworkCompData(1).TypeNum = 1;
+    AirflowNetworkLinkageData.allocate(1);
+    AirflowNetworkLinkageData(1).NodeNums = {{1, 2}};
+    AirflowNetworkLinkageData(1).CompNum = 1;
+    AirflowNetworkLinkSimu.allocate(1);
+    MultizoneSurfaceData.allocate(1);
+    MultizoneSurfaceData(1).Factor = 0.8;
+    MultizoneSurfaceCrackData.allocate(1);
+    MultizoneSurfaceCrackData(1).FlowCoef = 0.01;
+    MultizoneSurfaceCrackData(1).FlowExpo = 0.65;
+    MultizoneSurfaceCrackData(1).StandardT = 20.0;
+    MultizoneSurfaceCrackData(1).StandardP = 101325.0;
+    MultizoneSurfaceCrackData(1).StandardW = 0.0;
+
+    properties.resize(3);
+    properties[1].temperature = 22.0;
+    properties[1].density = 1.19;
+    properties[1].sqrtDensity = std::sqrt(1.19);
+    properties[1].viscosity = 1.71432e-5 + 4.828e-8 * 22.0;
+    properties[2].temperature = 5.0;
+    properties[2].density = 1.26;
+    properties[2].sqrtDensity = std::sqrt(1.26);
+    properties[2].viscosity = 1.71432e-5 + 4.828e-8 * 5.0;
+
+    ID.allocate(2);
+    ID = {1, 2};
+    IK.allocate(3);
+    IK = 1;
+    newIK.allocate(3);
+    newAU.allocate(1);
+    AU.allocate(1);
+    AD.allocate(2);
+    SUMF.allocate(2);
+    SUMAF.allocate(2);
+    AFLOW.allocate(1);
+    AFLOW2.allocate(1);
+    PS.dimension(1, 0.0);
+    PW.dimension(1, 0.0);
+    DpL.dimension(1, 2, 0.0);
+    AirflowNetwork::PZ.allocate(2);
+
+    InitCrackCoefficients();
+    std::array<Real64, 2> F{{0.0, 0.0}};
+    std::array<Real64, 2> DF{{0.0, 0.0}};
+    for (Real64 const DP : {12.0, -7.5}) {
+        AirflowNetwork::PZ(1) = DP;
+        AirflowNetwork::PZ(2) = 0.0;
+        for (bool const LFLAG : {true, false}) {
+            FILJAC(0, LFLAG);
+            MultizoneSurfaceCrackData(1).calculate(LFLAG, DP, 1, properties[1], properties[2], F, DF);
+            EXPECT_DOUBLE_EQ(F[0], AFLOW(1));
+            EXPECT_DOUBLE_EQ(DF[0], AD(1));
+        }
+    }
+
+    NetworkNumOfNodes = 0;
+    NetworkNumOfLinks = 0;
+}
@@ -421,6 +421,106 @@ TEST_F(EnergyPlusFixture, BranchInputManager_FindAirLoopBranchConnection)
     EXPECT_FALSE(MatchedLoop);
 }
 
+TEST_F(EnergyPlusFixture, BranchInputManager_FindPlantLoopBranchConnection)
+{
+
+    std::string const idf_objects = delimited_string({
+
+        "PlantLoop,",
+        "  CndW Loop,                          !- Name",
+        "  Water,                              !- Fluid Type",
+        "  ,                                   !- User Defined Fluid Type",
+        "  CndW Loop Operation Schemes,        !- Plant Equipment Operation Scheme Name",
+        "  CndW Loop Supply Outlet Node,       !- Loop Temperature Setpoint Node Name",
+        "  100,                                !- Maximum Loop Temperature {C}",
+        "  0,                                  !- Minimum Loop Temperature {C}",
+        "  0.005,                              !- Maximum Loop Flow Rate {m3/s}",
+        "  0,                                  !- Minimum Loop Flow Rate {m3/s}",
+        "  Autocalculate,                      !- Plant Loop Volume {m3}",
+        "  CndW Loop Supply Inlet Node,        !- Plant Side Inlet Node Name",
+        "  CndW Loop Supply Outlet Node,       !- Plant Side Outlet Node Name",
+        "  CndW Loop Supply Branches,          !- Plant Side Branch List Name",
+        "  CndW Loop Supply Connector List,    !- Plant Side Connector List Name",
+        "  CndW Loop Demand Inlet Node,        !- Demand Side Inlet Node Name",
+        "  CndW Loop Demand Outlet Node,       !- Demand Side Outlet Node Name",
+        "  CndW Loop Demand Branches,          !- Demand Side Branch List Name",
+        "  CndW Loop Demand Connector List;    !- Demand Side Connector List Name",
+
+        "PlantLoop,",
+        "  HW Loop,                            !- Name",
+        "  Water,                              !- Fluid Type",
+        "  ,                                   !- User Defined Fluid Type",
+        "  HW Loop Operation Schemes,          !- Plant Equipment Operation Scheme Name",
+        "  HW Loop Supply Outlet Node,         !- Loop Temperature Setpoint Node Name",
+        "  100,                                !- Maximum Loop Temperature {C}",
+        "  0,                                  !- Minimum Loop Temperature {C}",
+        "  0.002,                              !- Maximum Loop Flow Rate {m3/s}",
+        "  0,                                  !- Minimum Loop Flow Rate {m3/s}",
+        "  Autocalculate,                      !- Plant Loop Volume {m3}",
+        "  HW Loop Supply Inlet Node,          !- Plant Side Inlet Node Name",
+        "  HW Loop Supply Outlet Node,         !- Plant Side Outlet Node Name",
+        "  HW Loop Supply Branches,            !- Plant Side Branch List Name",
+        "  HW Loop Supply Connector List,      !- Plant Side Connector List Name",
+        "  HW Loop Demand Inlet Node,          !- Demand Side Inlet Node Name",
+        "  HW Loop Demand Outlet Node,         !- Demand Side Outlet Node Name",
+        "  HW Loop Demand Branches,            !- Demand Side Branch List Name",
+        "  HW Loop Demand Connector List;      !- Demand Side Connector List Name",
+
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+    std::string FoundLoopName;
+    int FoundLoopNum;
+    std::string SupplyDemand;
+    Real64 FoundLoopVolFlowRate;
+    bool MatchedLoop;
+
+    // Case 1 Demand side of the second loop, after the first loop has been searched
+    FoundLoopName = "None";
+    FoundLoopNum = 0;
+    SupplyDemand = "None";
+    FoundLoopVolFlowRate = 0.0;
+    MatchedLoop = false;
+
+    FindPlantLoopBranchConnection("HW LOOP DEMAND BRANCHES", FoundLoopName, FoundLoopNum, SupplyDemand, FoundLoopVolFlowRate, MatchedLoop);
+
+    EXPECT_EQ("HW LOOP", FoundLoopName);
+    EXPECT_EQ(2, FoundLoopNum);
+    EXPECT_EQ("Demand", SupplyDemand);
+    EXPECT_EQ(0.002, FoundLoopVolFlowRate);
+    EXPECT_TRUE(MatchedLoop);
+
+    // Case 2 Supply side of the first loop, answered from the loops already read
+    FoundLoopName = "None";
+    FoundLoopNum = 0;
+    SupplyDemand = "None";
+    FoundLoopVolFlowRate = 0.0;
+    MatchedLoop = false;
+
+    FindPlantLoopBranchConnection("CNDW LOOP SUPPLY BRANCHES", FoundLoopName, FoundLoopNum, SupplyDemand, FoundLoopVolFlowRate, MatchedLoop);
+
+    EXPECT_EQ("CNDW LOOP", FoundLoopName);
+    EXPECT_EQ(1, FoundLoopNum);
+    EXPECT_EQ("Supply", SupplyDemand);
+    EXPECT_EQ(0.005, FoundLoopVolFlowRate);
+    EXPECT_TRUE(MatchedLoop);
+
+    // Case 3 Not found
+    FoundLoopName = "None";
+    FoundLoopNum = 0;
+    SupplyDemand = "None";
+    FoundLoopVolFlowRate = 0.0;
+    MatchedLoop = false;
+
+    FindPlantLoopBranchConnection("Not There", FoundLoopName, FoundLoopNum, SupplyDemand, FoundLoopVolFlowRate, MatchedLoop);
+
+    EXPECT_EQ("None", FoundLoopName);
+    EXPECT_EQ(0, FoundLoopNum);
+    EXPECT_EQ("None", SupplyDemand);
+    EXPECT_EQ(0.0, FoundLoopVolFlowRate);
+    EXPECT_FALSE(MatchedLoop);
+}
+
 TEST_F(EnergyPlusFixture, BranchInputManager_GetAirBranchIndex)
 {
 
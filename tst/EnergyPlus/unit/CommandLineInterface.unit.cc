@@ -0,0 +1,155 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::CommandLineInterface Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/CommandLineInterface.hh>
+#include <EnergyPlus/FileSystem.hh>
+
+#include "Fixtures/EnergyPlusFixture.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::CommandLineInterface;
+
+TEST_F(EnergyPlusFixture, CommandLineInterface_InputNeedsExpandObjects)
+{
+    std::string const inputFileName("eplus_expandobjects_test.idf");
+    auto writeInput = [&](std::string const &contents) {
+        std::ofstream inputFile(inputFileName);
+        inputFile << contents;
+    };
+
+    // a model without template or ground heat transfer objects skips the external pass
+    writeInput("Version,9.3;\n"
+               "  Zone,\n"
+               "    Zone 1;                  !- Name  (was HVACTemplate:Zone:IdealLoadsAirSystem)\n"
+               "! HVACTemplate:Thermostat,\n"
+               "!   All Zones;\n");
+    EXPECT_FALSE(InputNeedsExpandObjects(inputFileName));
+
+    // object names are matched without regard to case
+    writeInput("Version,9.3;\n"
+               "  hvactemplate:thermostat,\n"
+               "    All Zones;               !- Name\n");
+    EXPECT_TRUE(InputNeedsExpandObjects(inputFileName));
+
+    writeInput("Version,9.3;\n"
+               "  GroundHeatTransfer:Control,\n"
+               "    gtchoices,               !- Name\n"
+               "    Yes,                     !- Run Basement Preprocessor\n"
+               "    No;                      !- Run Slab Preprocessor\n");
+    EXPECT_TRUE(InputNeedsExpandObjects(inputFileName));
+
+    std::remove(inputFileName.c_str());
+
+    // an input that cannot be read is left for ExpandObjects to report
+    EXPECT_TRUE(InputNeedsExpandObjects(inputFileName));
+}
+
+TEST_F(EnergyPlusFixture, CommandLineInterface_FileFingerprint)
+{
+    std::string const fileName("eplus_fingerprint_test.txt");
+    auto writeFile = [&](std::string const &contents) {
+        std::ofstream file(fileName, std::ios::binary);
+        file << contents;
+    };
+
+    // published 64 bit FNV-1a values
+    writeFile("");
+    EXPECT_EQ("cbf29ce484222325", FileFingerprint(fileName));
+    writeFile("a");
+    EXPECT_EQ("af63dc4c8601ec8c", FileFingerprint(fileName));
+
+    // a file longer than the read buffer hashes the same as its contents in one piece
+    std::string contents;
+    for (int i = 0; i < 20000; ++i) {
+        contents += std::to_string(i) + "\n";
+    }
+    ASSERT_GT(contents.size(), 65536u);
+    writeFile(contents);
+    EXPECT_EQ(FileSystem::hashToHex(FileSystem::hashBytes(contents.data(), contents.size(), FileSystem::hashBasis)), FileFingerprint(fileName));
+
+    std::remove(fileName.c_str());
+    EXPECT_EQ("none", FileFingerprint(fileName));
+}
+
+TEST_F(EnergyPlusFixture, CommandLineInterface_ExpansionIsCurrent)
+{
+    std::string const keyFileName("eplus_expansion_test.expkey");
+    std::string const expandedFileName("eplus_expansion_test.expidf");
+    std::string const expandKey("input 0123456789abcdef\nidd none\n");
+
+    // nothing has been expanded yet
+    EXPECT_FALSE(ExpansionIsCurrent(keyFileName, expandedFileName, expandKey));
+
+    {
+        std::ofstream keyFile(keyFileName);
+        keyFile << expandKey;
+    }
+    // the key alone is not enough without the expanded input
+    EXPECT_FALSE(ExpansionIsCurrent(keyFileName, expandedFileName, expandKey));
+
+    {
+        std::ofstream expandedFile(expandedFileName);
+        expandedFile << "Version,9.3;\n";
+    }
+    EXPECT_TRUE(ExpansionIsCurrent(keyFileName, expandedFileName, expandKey));
+    EXPECT_FALSE(ExpansionIsCurrent(keyFileName, expandedFileName, "input fedcba9876543210\nidd none\n"));
+
+    std::remove(keyFileName.c_str());
+    EXPECT_FALSE(ExpansionIsCurrent(keyFileName, expandedFileName, expandKey));
+    std::remove(expandedFileName.c_str());
+}
@@ -3490,5 +3490,77 @@ TEST_F(EnergyPlusFixture, CondenserLoopTowers_SingleSpeedUser_SizingError_UserSp
 
 }
 
+TEST_F(EnergyPlusFixture, CondenserLoopTowers_ReducedApproachMatchesCorrelation)
+{
+    // Built-in CoolTools cross flow and YorkCalc coefficients, approach in C (see GetTowerInput)
+    CondenserLoopTowers::SimpleTower.allocate(2);
+    CondenserLoopTowers::VSTower.allocate(2);
+    CondenserLoopTowers::SimpleTower(1).TowerModelType = CondenserLoopTowers::CoolToolsXFModel;
+    CondenserLoopTowers::SimpleTower(1).VSTower = 1;
+    CondenserLoopTowers::VSTower(1).Coeff = Array1D<Real64>(
+        {0.52049709836241,     -10.617046395344,   10.7292974722538,     -2.74988377158227,     4.73629943913743,
+         -8.25759700874711,    1.57640938114136,   6.51119643791324,     1.50433525206692,      -3.2888529287801,
+         0.0257786145353773,   0.182464289315254,  -0.0818947291400898,  -0.215010003996285,    0.0186741309635284,
+         0.0536824177590012,   -0.00270968955115031, 0.00112277498589279, -0.00127758497497718, 0.0000760420796601607,
+         1.43600088336017,     -0.5198695909109,   0.117339576910507,    1.50492810819924,      -0.135898905926974,
+         -0.152577581866506,   -0.0533843828114562, 0.00493294869565511, -0.00796260394174197,  0.000222619828621544,
+         -0.0543952001568055,  0.00474266879161693, -0.0185854671815598, 0.00115667701293848,   0.000807370664460284});
+    CondenserLoopTowers::VSTower(1).MinInletAirWBTemp = -1.0;
+    CondenserLoopTowers::VSTower(1).MaxInletAirWBTemp = 26.6667;
+    CondenserLoopTowers::VSTower(1).MinRangeTemp = 1.1111;
+    CondenserLoopTowers::VSTower(1).MaxRangeTemp = 11.1111;
+    CondenserLoopTowers::VSTower(1).MinWaterFlowRatio = 0.75;
+    CondenserLoopTowers::VSTower(1).MaxWaterFlowRatio = 1.25;
+
+    CondenserLoopTowers::SimpleTower(2).TowerModelType = CondenserLoopTowers::YorkCalcModel;
+    CondenserLoopTowers::SimpleTower(2).VSTower = 2;
+    CondenserLoopTowers::VSTower(2).Coeff = Array1D<Real64>(
+        {-0.359741205,        -0.055053608,      0.0023850432,        0.173926877,        -0.0248473764,    0.00048430224,
+         -0.005589849456,     0.0005770079712,   -0.00001342427256,   2.84765801111111,   -0.121765149,     0.0014599242,
+         1.680428651,         -0.0166920786,     -0.0007190532,       -0.025485194448,    0.0000487491696,  0.00002719234152,
+         -0.0653766255555556, -0.002278167,      0.0002500254,        -0.0910565458,      0.00318176316,    0.000038621772,
+         -0.0034285382352,    0.00000856589904,  -0.000001516821552});
+    CondenserLoopTowers::VSTower(2).MinInletAirWBTemp = -34.4;
+    CondenserLoopTowers::VSTower(2).MaxInletAirWBTemp = 29.4444;
+    CondenserLoopTowers::VSTower(2).MinRangeTemp = 1.1111;
+    CondenserLoopTowers::VSTower(2).MaxRangeTemp = 22.2222;
+    CondenserLoopTowers::VSTower(2).MinWaterFlowRatio = 0.75;
+    CondenserLoopTowers::VSTower(2).MaxWaterFlowRatio = 1.25;
+
+    // Reduced polynomials in the range (as in SimVariableTower) and in the flow input (as in CalcVariableSpeedTower) against the full
+    // correlation over each model's valid inputs, down to a quarter air flow
+    int const numSteps(6);
+    for (int TowerNum = 1; TowerNum <= 2; ++TowerNum) {
+        auto const &vsTower(CondenserLoopTowers::VSTower(TowerNum));
+        bool const isYorkCalc(TowerNum == 2);
+        for (int i = 0; i <= numSteps; ++i) {
+            Real64 const Twb(vsTower.MinInletAirWBTemp + i * (vsTower.MaxInletAirWBTemp - vsTower.MinInletAirWBTemp) / numSteps);
+            for (int j = 0; j <= numSteps; ++j) {
+                Real64 const Tr(vsTower.MinRangeTemp + j * (vsTower.MaxRangeTemp - vsTower.MinRangeTemp) / numSteps);
+                for (int k = 0; k <= numSteps; ++k) {
+                    Real64 const WaterFlowRatio(vsTower.MinWaterFlowRatio + k * (vsTower.MaxWaterFlowRatio - vsTower.MinWaterFlowRatio) / numSteps);
+                    for (int l = 0; l <= numSteps; ++l) {
+                        Real64 const AirFlowRatio(0.25 + l * 0.75 / numSteps);
+                        Real64 Approach(0.0);
+                        CondenserLoopTowers::CalcVSTowerApproach(TowerNum, WaterFlowRatio, AirFlowRatio, Twb, Tr, Approach);
+                        Real64 const tolerance(1.0e-9 * std::max(1.0, std::abs(Approach)));
+
+                        std::array<Real64, 4> RangeCoef;
+                        CondenserLoopTowers::ReduceVSTowerApproach(
+                            TowerNum, 3, CondenserLoopTowers::VSTowerModelInputs(TowerNum, WaterFlowRatio, AirFlowRatio, Twb, 0.0), RangeCoef);
+                        EXPECT_NEAR(Approach, CondenserLoopTowers::ReducedVSTowerApproach(RangeCoef, Tr), tolerance);
+
+                        std::array<Real64, 4> FlowCoef;
+                        CondenserLoopTowers::ReduceVSTowerApproach(
+                            TowerNum, 0, CondenserLoopTowers::VSTowerModelInputs(TowerNum, WaterFlowRatio, 1.0, Twb, Tr), FlowCoef);
+                        Real64 const FlowInput(isYorkCalc ? WaterFlowRatio / AirFlowRatio : pow_3(AirFlowRatio));
+                        EXPECT_NEAR(Approach, CondenserLoopTowers::ReducedVSTowerApproach(FlowCoef, FlowInput), tolerance);
+                    }
+                }
+            }
+        }
+    }
+}
+
 
 } // namespace EnergyPlus
@@ -0,0 +1,149 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::ConductionTransferFunctionCalc Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/ConductionTransferFunctionCalc.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/HeatBalanceManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataHeatBalance;
+
+TEST_F(EnergyPlusFixture, ConductionTransferFunctionCalc_SameLayersReuseCTFs)
+{
+    std::string const idf_objects = delimited_string({
+        "Material,",
+        "  Concrete,                !- Name",
+        "  MediumRough,             !- Roughness",
+        "  0.1016,                  !- Thickness {m}",
+        "  1.311,                   !- Conductivity {W/m-K}",
+        "  2240,                    !- Density {kg/m3}",
+        "  836.8;                   !- Specific Heat {J/kg-K}",
+        "Material,",
+        "  Insulation,              !- Name",
+        "  Rough,                   !- Roughness",
+        "  0.0508,                  !- Thickness {m}",
+        "  0.0432,                  !- Conductivity {W/m-K}",
+        "  91,                      !- Density {kg/m3}",
+        "  837;                     !- Specific Heat {J/kg-K}",
+        "Material,",
+        "  Concrete Copy,           !- Name",
+        "  MediumRough,             !- Roughness",
+        "  0.1016,                  !- Thickness {m}",
+        "  1.311,                   !- Conductivity {W/m-K}",
+        "  2240,                    !- Density {kg/m3}",
+        "  836.8;                   !- Specific Heat {J/kg-K}",
+        "Material,",
+        "  Insulation Copy,         !- Name",
+        "  Rough,                   !- Roughness",
+        "  0.0508,                  !- Thickness {m}",
+        "  0.0432,                  !- Conductivity {W/m-K}",
+        "  91,                      !- Density {kg/m3}",
+        "  837;                     !- Specific Heat {J/kg-K}",
+        "Construction,",
+        "  Wall A,                  !- Name",
+        "  Concrete,                !- Outside Layer",
+        "  Insulation;              !- Layer 2",
+        "Construction,",
+        "  Wall A Duplicate,        !- Name",
+        "  Concrete,                !- Outside Layer",
+        "  Insulation;              !- Layer 2",
+        "Construction,",
+        "  Wall A Copied Materials, !- Name",
+        "  Concrete Copy,           !- Outside Layer",
+        "  Insulation Copy;         !- Layer 2",
+        "Construction,",
+        "  Wall A Reversed,         !- Name",
+        "  Insulation,              !- Outside Layer",
+        "  Concrete;                !- Layer 2",
+    });
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    bool ErrorsFound(false);
+    HeatBalanceManager::GetMaterialData(ErrorsFound);
+    HeatBalanceManager::GetConstructData(ErrorsFound);
+    ASSERT_FALSE(ErrorsFound);
+    ASSERT_EQ(4, TotConstructs);
+    for (int ConstrNum = 1; ConstrNum <= TotConstructs; ++ConstrNum) {
+        Construct(ConstrNum).IsUsedCTF = true;
+    }
+    DataGlobals::TimeStepZone = 0.25;
+    DataGlobals::TimeStepZoneSec = 900.0;
+
+    ConductionTransferFunctionCalc::InitConductionTransferFunctions();
+
+    // The duplicate copies the CTFs of Wall A; the same stack built from other (identical) materials is calculated
+    auto const &Wall(Construct(1));
+    for (int const ConstrNum : {2, 3}) {
+        auto const &Other(Construct(ConstrNum));
+        EXPECT_EQ(Wall.CTFTimeStep, Other.CTFTimeStep);
+        EXPECT_EQ(Wall.NumHistories, Other.NumHistories);
+        ASSERT_EQ(Wall.NumCTFTerms, Other.NumCTFTerms);
+        for (int HistTerm = 0; HistTerm <= Wall.NumCTFTerms; ++HistTerm) {
+            EXPECT_EQ(Wall.CTFInside(HistTerm), Other.CTFInside(HistTerm));
+            EXPECT_EQ(Wall.CTFCross(HistTerm), Other.CTFCross(HistTerm));
+            EXPECT_EQ(Wall.CTFOutside(HistTerm), Other.CTFOutside(HistTerm));
+            if (HistTerm != 0) EXPECT_EQ(Wall.CTFFlux(HistTerm), Other.CTFFlux(HistTerm));
+        }
+    }
+
+    // The reversed stack still swaps inside and outside
+    auto const &Reversed(Construct(4));
+    ASSERT_EQ(Wall.NumCTFTerms, Reversed.NumCTFTerms);
+    for (int HistTerm = 0; HistTerm <= Wall.NumCTFTerms; ++HistTerm) {
+        EXPECT_EQ(Wall.CTFInside(HistTerm), Reversed.CTFOutside(HistTerm));
+        EXPECT_EQ(Wall.CTFOutside(HistTerm), Reversed.CTFInside(HistTerm));
+        EXPECT_EQ(Wall.CTFCross(HistTerm), Reversed.CTFCross(HistTerm));
+    }
+}
@@ -556,6 +556,19 @@ TEST_F(EnergyPlusFixture, ConvectionCoefficientsTest_DynamicIntConvSurfaceClassi
 
     DynamicIntConvSurfaceClassification(15);
     EXPECT_EQ(DataSurfaces::Surface(15).IntConvClassification, DataSurfaces::InConvClass_A3_StableHoriz);
+
+    // Zone flow regime evaluated once and passed in gives the same classifications
+    int FlowRegime(0);
+    int ForcedFlowRegime(0);
+    DynamicIntConvZoneFlowRegime(1, FlowRegime, ForcedFlowRegime);
+    EXPECT_EQ(FlowRegime, InConvFlowRegime_A3);
+    for (int surf = 1; surf <= 15; ++surf) {
+        DynamicIntConvSurfaceClassification(surf);
+        int const Classification = DataSurfaces::Surface(surf).IntConvClassification;
+        DataSurfaces::Surface(surf).IntConvClassification = 0;
+        DynamicIntConvSurfaceClassification(surf, FlowRegime, ForcedFlowRegime);
+        EXPECT_EQ(DataSurfaces::Surface(surf).IntConvClassification, Classification);
+    }
 }
 
 TEST_F(EnergyPlusFixture, ConvectionCoefficientsTest_EvaluateIntHcModelsFisherPedersen)
@@ -760,3 +773,56 @@ TEST_F(EnergyPlusFixture, ConvectionCoefficientsTest_TestCalcZoneSystemACH)
     EXPECT_NEAR(ACHExpected, ACHAnswer, 0.0001);
     
 }
+
+TEST_F(EnergyPlusFixture, ConvectionCoefficients_ExteriorWindDrivenHf)
+{
+    // A window on a south facing wall
+    DataSurfaces::TotSurfaces = 2;
+    DataSurfaces::Surface.allocate(2);
+    DataSurfaces::Surface(1).BaseSurf = 1;
+    DataSurfaces::Surface(1).GrossArea = 20.0;
+    DataSurfaces::Surface(1).Height = 2.5;
+    DataSurfaces::Surface(2).BaseSurf = 1;
+    for (int SurfNum = 1; SurfNum <= 2; ++SurfNum) {
+        DataSurfaces::Surface(SurfNum).CosTilt = 0.0;
+        DataSurfaces::Surface(SurfNum).Azimuth = 180.0;
+    }
+    Real64 const Perimeter = 2.0 * (20.0 / 2.5 + 2.5);
+    Real64 const TSurf = 5.0;
+    Real64 const TAir = -2.0;
+
+    // Against the windward and leeward correlations InitExteriorConvectionCoeff called on every iteration before
+    for (int const AlgoNum : {DataHeatBalance::TarpHcOutside, DataHeatBalance::DOE2HcOutside, DataHeatBalance::MoWiTTHcOutside}) {
+        for (Real64 const WindDir : {170.0, 10.0}) { // windward, leeward
+            bool const IsWindward = (WindDir == 170.0);
+            for (Real64 const WindSpeed : {0.5, 4.0}) {
+                for (int const Roughness : {DataHeatBalance::VeryRough, DataHeatBalance::MediumSmooth, DataHeatBalance::VerySmooth}) {
+                    for (int SurfNum = 1; SurfNum <= 2; ++SurfNum) {
+                        for (int Iteration = 1; Iteration <= 2; ++Iteration) {
+                            Real64 const Hf = ExteriorWindDrivenHf(SurfNum, AlgoNum, WindSpeed, WindDir, Roughness);
+                            if (AlgoNum == DataHeatBalance::TarpHcOutside) {
+                                EXPECT_EQ(CalcHfExteriorSparrow(WindSpeed, 20.0, Perimeter, 0.0, 180.0, Roughness, WindDir), Hf);
+                            } else if (AlgoNum == DataHeatBalance::DOE2HcOutside) {
+                                EXPECT_EQ(IsWindward ? CalcDOE2Windward(TSurf, TAir, 0.0, WindSpeed, Roughness)
+                                                     : CalcDOE2Leeward(TSurf, TAir, 0.0, WindSpeed, Roughness),
+                                          CalcDOE2Forced(TSurf, TAir, 0.0, Hf, Roughness));
+                            } else {
+                                Real64 const Hn = CalcMoWITTNatural(TAir - TSurf);
+                                EXPECT_EQ(IsWindward ? CalcMoWITTWindward(TAir - TSurf, WindSpeed) : CalcMoWITTLeeward(TAir - TSurf, WindSpeed),
+                                          std::sqrt(pow_2(Hn) + pow_2(Hf)));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // The term is kept per surface until the wind, roughness or algorithm changes
+    Real64 const Hf = ExteriorWindDrivenHf(1, DataHeatBalance::TarpHcOutside, 4.0, 170.0, DataHeatBalance::VeryRough);
+    DataSurfaces::Surface(1).GrossArea = 40.0;
+    EXPECT_EQ(Hf, ExteriorWindDrivenHf(1, DataHeatBalance::TarpHcOutside, 4.0, 170.0, DataHeatBalance::VeryRough));
+    EXPECT_LT(ExteriorWindDrivenHf(1, DataHeatBalance::TarpHcOutside, 4.01, 170.0, DataHeatBalance::VeryRough), Hf);
+    ConvectionCoefficients::clear_state();
+    EXPECT_LT(ExteriorWindDrivenHf(1, DataHeatBalance::TarpHcOutside, 4.0, 170.0, DataHeatBalance::VeryRough), Hf);
+}
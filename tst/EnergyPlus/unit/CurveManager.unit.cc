@@ -1185,3 +1185,175 @@ TEST_F(EnergyPlusFixture, CurveExponentialSkewNormal_MaximumCurveOutputTest)
     EXPECT_TRUE(PerfCurve(1).CurveMaxPresent);
 
 }
+
+TEST_F(EnergyPlusFixture, CurveValue_PolynomialEvaluatorsAndBatchedCurves)
+{
+    std::string const idf_objects = delimited_string({
+        "Curve:Biquadratic,",
+        "  CapFTemp,                !- Name",
+        "  0.942587793,             !- Coefficient1 Constant",
+        "  0.009543347,             !- Coefficient2 x",
+        "  0.000683770,             !- Coefficient3 x**2",
+        "  -0.011042676,            !- Coefficient4 y",
+        "  0.000005249,             !- Coefficient5 y**2",
+        "  -0.000009720,            !- Coefficient6 x*y",
+        "  12.77778,                !- Minimum Value of x",
+        "  23.88889,                !- Maximum Value of x",
+        "  18.0,                    !- Minimum Value of y",
+        "  46.11111;                !- Maximum Value of y",
+        "Curve:Biquadratic,",
+        "  EIRFTemp,                !- Name",
+        "  0.342414409,             !- Coefficient1 Constant",
+        "  0.034885008,             !- Coefficient2 x",
+        "  -0.000623700,            !- Coefficient3 x**2",
+        "  0.004977216,             !- Coefficient4 y",
+        "  0.000437951,             !- Coefficient5 y**2",
+        "  -0.000728028,            !- Coefficient6 x*y",
+        "  12.77778,                !- Minimum Value of x",
+        "  23.88889,                !- Maximum Value of x",
+        "  18.0,                    !- Minimum Value of y",
+        "  46.11111,                !- Maximum Value of y",
+        "  0.5,                     !- Minimum Curve Output",
+        "  1.1;                     !- Maximum Curve Output",
+        "Curve:Quadratic,",
+        "  PLFFPLR,                 !- Name",
+        "  0.85,                    !- Coefficient1 Constant",
+        "  0.15,                    !- Coefficient2 x",
+        "  0.0,                     !- Coefficient3 x**2",
+        "  0.0,                     !- Minimum Value of x",
+        "  1.0;                     !- Maximum Value of x",
+        "Curve:ExponentialDecay,",
+        "  Decay,                   !- Name",
+        "  0.0,                     !- Coefficient1 C1",
+        "  1.0,                     !- Coefficient2 C2",
+        "  -1.0,                    !- Coefficient3 C3",
+        "  0.0,                     !- Minimum Value of x",
+        "  5.0;                     !- Maximum Value of x",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+    CurveManager::GetCurveInput();
+    ASSERT_EQ(4, CurveManager::NumCurves);
+
+    int const CapFTemp = GetCurveIndex("CAPFTEMP");
+    int const EIRFTemp = GetCurveIndex("EIRFTEMP");
+    int const PLFFPLR = GetCurveIndex("PLFFPLR");
+    int const Decay = GetCurveIndex("DECAY");
+
+    // polynomial curves are resolved at input, other curve types keep the general path
+    EXPECT_TRUE(PerfCurve(CapFTemp).Evaluator != nullptr);
+    EXPECT_TRUE(PerfCurve(EIRFTemp).Evaluator != nullptr);
+    EXPECT_TRUE(PerfCurve(PLFFPLR).Evaluator != nullptr);
+    EXPECT_TRUE(PerfCurve(Decay).Evaluator == nullptr);
+
+    // same results as the curve type switch, inside and outside of the variable and output limits
+    for (Real64 WetBulb = 10.0; WetBulb <= 26.0; WetBulb += 4.0) {
+        for (Real64 DryBulb = 10.0; DryBulb <= 50.0; DryBulb += 10.0) {
+            EXPECT_DOUBLE_EQ(PerformanceCurveObject(CapFTemp, WetBulb, DryBulb), CurveValue(CapFTemp, WetBulb, DryBulb));
+            EXPECT_DOUBLE_EQ(PerformanceCurveObject(EIRFTemp, WetBulb, DryBulb), CurveValue(EIRFTemp, WetBulb, DryBulb));
+        }
+    }
+    EXPECT_DOUBLE_EQ(1.0, CurveValue(PLFFPLR, 1.5));
+    EXPECT_DOUBLE_EQ(0.925, CurveValue(PLFFPLR, 0.5));
+    EXPECT_DOUBLE_EQ(std::exp(-2.0), CurveValue(Decay, 2.0));
+
+    // batched evaluation of curves sharing the same inputs
+    Array1D_int CurveIndexes(2);
+    CurveIndexes(1) = CapFTemp;
+    CurveIndexes(2) = EIRFTemp;
+    Array1D<Real64> Values;
+    CurveValues(CurveIndexes, Values, 19.4, 35.0);
+    ASSERT_EQ(2u, Values.size());
+    EXPECT_DOUBLE_EQ(PerformanceCurveObject(CapFTemp, 19.4, 35.0), Values(1));
+    EXPECT_DOUBLE_EQ(PerformanceCurveObject(EIRFTemp, 19.4, 35.0), Values(2));
+    EXPECT_DOUBLE_EQ(35.0, PerfCurve(EIRFTemp).CurveInput2);
+
+    // EMS overrides still apply on the fast path
+    PerfCurve(EIRFTemp).EMSOverrideOn = true;
+    PerfCurve(EIRFTemp).EMSOverrideCurveValue = 0.75;
+    CurveValues(CurveIndexes, Values, 19.4, 35.0);
+    EXPECT_DOUBLE_EQ(0.75, Values(2));
+    EXPECT_DOUBLE_EQ(PerformanceCurveObject(CapFTemp, 19.4, 35.0), Values(1));
+}
+
+TEST_F(EnergyPlusFixture, TableLookupObject_RegularGridMatchesLagrange)
+{
+    PerfCurve.allocate(1);
+    TableLookup.allocate(1);
+
+    // three independent variables, 4 x 3 x 5 points
+    PerfCurve(1).TableIndex = 1;
+    PerfCurve(1).NumDims = 3;
+    PerfCurve(1).InterpolationType = LagrangeInterpolationLinearExtrapolation;
+    PerfCurve(1).ObjectType = "Table:MultiVariableLookup";
+    PerfCurve(1).Name = "Grid Table";
+    PerfCurve(1).Var1Min = -10.0;
+    PerfCurve(1).Var1Max = 10.0;
+    PerfCurve(1).Var2Min = -10.0;
+    PerfCurve(1).Var2Max = 10.0;
+    PerfCurve(1).Var3Min = -10.0;
+    PerfCurve(1).Var3Max = 10.0;
+
+    auto &Table(TableLookup(1));
+    Table.NumX1Vars = 4;
+    Table.NumX2Vars = 3;
+    Table.NumX3Vars = 5;
+    Table.X1Var.allocate(4);
+    Table.X2Var.allocate(3);
+    Table.X3Var.allocate(5);
+    Table.X1Var = {0.0, 1.0, 2.5, 4.0};
+    Table.X2Var = {10.0, 20.0, 35.0};
+    Table.X3Var = {-1.0, 0.0, 0.5, 2.0, 3.0};
+    Table.TableLookupZData.allocate(1, 1, 1, 5, 3, 4);
+    for (int I3 = 1; I3 <= 5; ++I3) {
+        for (int I2 = 1; I2 <= 3; ++I2) {
+            for (int I1 = 1; I1 <= 4; ++I1) {
+                Real64 const X1(Table.X1Var(I1));
+                Real64 const X2(Table.X2Var(I2) / 10.0);
+                Real64 const X3(Table.X3Var(I3));
+                Table.TableLookupZData(1, 1, 1, I3, I2, I1) = 1.0 + X1 * X1 - 0.5 * X2 * X3 + 0.1 * X1 * X2 * X3 * X3;
+            }
+        }
+    }
+
+    Array1D<Real64> const V1({-0.5, 0.0, 0.7, 2.5, 3.9, 4.6});
+    Array1D<Real64> const V2({5.0, 10.0, 18.0, 27.5, 35.0, 40.0});
+    Array1D<Real64> const V3({-2.0, -1.0, 0.2, 1.1, 3.0, 3.5});
+
+    for (int Order = 2; Order <= 4; ++Order) {
+        Table.InterpolationOrder = Order;
+        SetupTableLookupGrid(3, Table);
+        ASSERT_EQ(3, Table.Grid.NumDims);
+        for (int I = 1; I <= isize(V1); ++I) {
+            for (int J = 1; J <= isize(V2); ++J) {
+                for (int K = 1; K <= isize(V3); ++K) {
+                    Real64 const GridValue(TableLookupObject(1, V1(I), V2(J), V3(K)));
+                    // same lookup through the slice by slice Lagrange interpolation
+                    Table.Grid.NumDims = 0;
+                    Real64 const LagrangeValue(TableLookupObject(1, V1(I), V2(J), V3(K)));
+                    Table.Grid.NumDims = 3;
+                    EXPECT_EQ(LagrangeValue, GridValue);
+                }
+            }
+        }
+    }
+
+    // multilinear interpolation reproduces a table of a multilinear function, inside and outside of the table
+    for (int I3 = 1; I3 <= 5; ++I3) {
+        for (int I2 = 1; I2 <= 3; ++I2) {
+            for (int I1 = 1; I1 <= 4; ++I1) {
+                Table.TableLookupZData(1, 1, 1, I3, I2, I1) = 2.0 * Table.X1Var(I1) + 0.1 * Table.X2Var(I2) * Table.X3Var(I3);
+            }
+        }
+    }
+    Table.InterpolationOrder = 2;
+    SetupTableLookupGrid(3, Table);
+    EXPECT_NEAR(2.0 * 0.7 + 0.1 * 18.0 * 1.1, TableLookupObject(1, 0.7, 18.0, 1.1), 1.0e-12);
+    EXPECT_NEAR(2.0 * 4.6 + 0.1 * 40.0 * 0.2, TableLookupObject(1, 4.6, 40.0, 0.2), 1.0e-12);
+    EXPECT_NEAR(2.0 * 1.0 + 0.1 * 20.0 * 0.5, TableLookupObject(1, 1.0, 20.0, 0.5), 1.0e-12);
+
+    // tables that are not on an ascending grid keep the slice by slice interpolation
+    Table.X2Var(3) = 15.0;
+    SetupTableLookupGrid(3, Table);
+    EXPECT_EQ(0, Table.Grid.NumDims);
+}
@@ -1529,6 +1529,178 @@ TEST_F(EnergyPlusFixture, DXCoil_ValidateADPFunction)
     EXPECT_NEAR(0.0028271, CBF_calculated, 0.0000001);
 }
 
+TEST_F(EnergyPlusFixture, DXCoil_FullLoadCacheMatchesRecalculation)
+{
+    // the full load cache in CalcDoe2DXCoil must give the same results as evaluating the coil from scratch
+
+    std::string const idf_objects = delimited_string({
+        "Curve:Biquadratic,",
+        "	WindACCoolCapFT, !- Name",
+        "	0.942587793,     !- Coefficient1 Constant",
+        "	0.009543347,     !- Coefficient2 x",
+        "	0.000683770,     !- Coefficient3 x**2",
+        "	-0.011042676,    !- Coefficient4 y",
+        "	0.000005249,     !- Coefficient5 y**2",
+        "	-0.000009720,    !- Coefficient6 x*y",
+        "	12.77778,        !- Minimum Value of x",
+        "	23.88889,        !- Maximum Value of x",
+        "	18.0,            !- Minimum Value of y",
+        "	46.11111,        !- Maximum Value of y",
+        "	,                !- Minimum Curve Output",
+        "	,                !- Maximum Curve Output",
+        "	Temperature,     !- Input Unit Type for X",
+        "	Temperature,     !- Input Unit Type for Y",
+        "	Dimensionless;   !- Output Unit Type",
+        "Curve:Biquadratic,",
+        "	WindACEIRFT,   !- Name",
+        "	0.342414409,   !- Coefficient1 Constant",
+        "	0.034885008,   !- Coefficient2 x",
+        "	-0.000623700,  !- Coefficient3 x**2",
+        "	0.004977216,   !- Coefficient4 y",
+        "	0.000437951,   !- Coefficient5 y**2",
+        "	-0.000728028,  !- Coefficient6 x*y",
+        "	12.77778,      !- Minimum Value of x",
+        "	23.88889,      !- Maximum Value of x",
+        "	18.0,          !- Minimum Value of y",
+        "	46.11111,      !- Maximum Value of y",
+        "	,              !- Minimum Curve Output",
+        "	,              !- Maximum Curve Output",
+        "	Temperature,   !- Input Unit Type for X",
+        "	Temperature,   !- Input Unit Type for Y",
+        "	Dimensionless; !- Output Unit Type",
+        "Curve:Quadratic,",
+        "	WindACCoolCapFFF, !- Name",
+        "	0.8,              !- Coefficient1 Constant",
+        "	0.2,              !- Coefficient2 x",
+        "	0.0,              !- Coefficient3 x**2",
+        "	0.5,              !- Minimum Value of x",
+        "	1.5;              !- Maximum Value of x",
+        "Curve:Quadratic,",
+        "	WindACEIRFFF, !- Name",
+        "	1.1552,       !- Coefficient1 Constant",
+        "  -0.1808,       !- Coefficient2 x",
+        "	0.0256,       !- Coefficient3 x**2",
+        "	0.5,          !- Minimum Value of x",
+        "	1.5;          !- Maximum Value of x",
+        "Curve:Quadratic,",
+        "	WindACPLFFPLR, !- Name",
+        "	0.85,          !- Coefficient1 Constant",
+        "	0.15,          !- Coefficient2 x",
+        "	0.0,           !- Coefficient3 x**2",
+        "	0.0,           !- Minimum Value of x",
+        "	1.0;           !- Maximum Value of x",
+        "Coil:Cooling:DX:SingleSpeed,",
+        "	Furnace ACDXCoil 1,   !- Name",
+        " 	,                     !- Availability Schedule Name",
+        "	25000.0,              !- Gross Rated Total Cooling Capacity { W }",
+        "	0.75,                 !- Gross Rated Sensible Heat Ratio",
+        "	4.40,                 !- Gross Rated Cooling COP { W / W }",
+        "	1.30,                 !- Rated Air Flow Rate { m3 / s }",
+        "	,                     !- Rated Evaporator Fan Power Per Volume Flow Rate { W / ( m3 / s ) }",
+        "	DX Cooling Coil Air Inlet Node, !- Air Inlet Node Name",
+        "	Heating Coil Air Inlet Node,    !- Air Outlet Node Name",
+        "	WindACCoolCapFT,      !- Total Cooling Capacity Function of Temperature Curve Name",
+        "	WindACCoolCapFFF,     !- Total Cooling Capacity Function of Flow Fraction Curve Name",
+        "	WindACEIRFT,          !- Energy Input Ratio Function of Temperature Curve Name",
+        "	WindACEIRFFF,         !- Energy Input Ratio Function of Flow Fraction Curve Name",
+        "	WindACPLFFPLR,        !- Part Load Fraction Correlation Curve Name",
+        "	,                     !- Minimum Outdoor Dry-Bulb Temperature for Compressor Operation {C}",
+        "	0.0,                  !- Nominal Time for Condensate Removal to Begin",
+        "	0.0,                  !- Ratio of Initial Moisture Evaporation Rate and Steady State Latent Capacity",
+        "	0.0,                  !- Maximum Cycling Rate",
+        "	0.0,                  !- Latent Capacity Time Constant",
+        "	,                     !- Condenser Air Inlet Node Name",
+        "	AirCooled,            !- Condenser Type",
+        "	0.0,                  !- Evaporative Condenser Effectiveness",
+        "	,                     !- Evaporative Condenser Air Flow Rate",
+        "	0.0,                  !- Evaporative Condenser Pump Rated Power Consumption",
+        "	0.0,                  !- Crankcase Heater Capacity",
+        "	10.0;                 !- Maximum Outdoor DryBulb Temperature for Crankcase Heater Operation",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    ProcessScheduleInput();
+    GetCurveInput();
+    GetDXCoils();
+
+    DXCoil(1).RatedAirMassFlowRate(1) = 1.30 * 1.2;
+    DXCoil(1).RatedCBF(1) = 0.05;
+
+    OutDryBulbTemp = 35.0;
+    OutHumRat = 0.0100;
+    OutBaroPress = 101325.0;
+    OutWetBulbTemp = Psychrometrics::PsyTwbFnTdbWPb(OutDryBulbTemp, OutHumRat, OutBaroPress);
+
+    int const CapFTCurve = DXCoil(1).CCapFTemp(1);
+    int const CapFFCurve = DXCoil(1).CCapFFlow(1);
+
+    struct CoilResults
+    {
+        Real64 OutletAirTemp;
+        Real64 OutletAirHumRat;
+        Real64 TotalCoolingEnergyRate;
+        Real64 SensCoolingEnergyRate;
+        Real64 ElecCoolingPower;
+        Real64 CapFTOutput;
+        Real64 CapFTInput1;
+        Real64 CapFFOutput;
+    };
+
+    auto simulate = [&](Real64 const InletAirHumRat, Real64 const PartLoadRatio, bool const UseCache) {
+        DXCoil(1).InletAirMassFlowRate = 1.30 * 1.2;
+        DXCoil(1).InletAirTemp = 26.7;
+        DXCoil(1).InletAirHumRat = InletAirHumRat;
+        DXCoil(1).InletAirEnthalpy = Psychrometrics::PsyHFnTdbW(DXCoil(1).InletAirTemp, InletAirHumRat);
+        if (!UseCache) DXCoil(1).FullLoadCache.Valid = false;
+        // another coil sharing the curves evaluates them in between
+        CurveValue(CapFTCurve, 15.0, 20.0);
+        CurveValue(CapFFCurve, 0.6);
+        CalcDoe2DXCoil(1, On, true, PartLoadRatio, ContFanCycCoil);
+        return CoilResults{DXCoil(1).OutletAirTemp,
+                           DXCoil(1).OutletAirHumRat,
+                           DXCoil(1).TotalCoolingEnergyRate,
+                           DXCoil(1).SensCoolingEnergyRate,
+                           DXCoil(1).ElecCoolingPower,
+                           PerfCurve(CapFTCurve).CurveOutput,
+                           PerfCurve(CapFTCurve).CurveInput1,
+                           PerfCurve(CapFFCurve).CurveOutput};
+    };
+
+    auto expectIdentical = [](CoilResults const &cached, CoilResults const &uncached) {
+        EXPECT_EQ(uncached.OutletAirTemp, cached.OutletAirTemp);
+        EXPECT_EQ(uncached.OutletAirHumRat, cached.OutletAirHumRat);
+        EXPECT_EQ(uncached.TotalCoolingEnergyRate, cached.TotalCoolingEnergyRate);
+        EXPECT_EQ(uncached.SensCoolingEnergyRate, cached.SensCoolingEnergyRate);
+        EXPECT_EQ(uncached.ElecCoolingPower, cached.ElecCoolingPower);
+        EXPECT_EQ(uncached.CapFTOutput, cached.CapFTOutput);
+        EXPECT_EQ(uncached.CapFTInput1, cached.CapFTInput1);
+        EXPECT_EQ(uncached.CapFFOutput, cached.CapFFOutput);
+    };
+
+    // wet coil and a dry coil that needs the dry coil iteration on the inlet wet-bulb temperature
+    for (Real64 const InletAirHumRat : {0.0111, 0.0040}) {
+        simulate(InletAirHumRat, 0.5, false);
+        EXPECT_TRUE(DXCoil(1).FullLoadCache.Valid);
+        CoilResults const cached = simulate(InletAirHumRat, 0.7, true);
+        CoilResults const uncached = simulate(InletAirHumRat, 0.7, false);
+        EXPECT_GT(cached.TotalCoolingEnergyRate, 0.0);
+        expectIdentical(cached, uncached);
+    }
+
+    // a change in the rated flow or bypass factor (e.g. from sizing) must not be served from the cache
+    simulate(0.0111, 0.7, false);
+    DXCoil(1).RatedCBF(1) = 0.10;
+    CoilResults cached = simulate(0.0111, 0.7, true);
+    CoilResults uncached = simulate(0.0111, 0.7, false);
+    expectIdentical(cached, uncached);
+
+    DXCoil(1).RatedAirMassFlowRate(1) = 1.20 * 1.2;
+    cached = simulate(0.0111, 0.7, true);
+    uncached = simulate(0.0111, 0.7, false);
+    expectIdentical(cached, uncached);
+}
+
 TEST_F(EnergyPlusFixture, TestMultiSpeedCoolingCrankcaseOutput)
 {
     // Test the crankcase heat for Coil:Cooling:DX:MultiSpeed #5659
@@ -0,0 +1,140 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::DataTimings Unit Tests
+
+// C++ Headers
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/DataTimings.hh>
+
+using namespace EnergyPlus;
+
+TEST_F(EnergyPlusFixture, DataTimings_TimerScopeCallTree)
+{
+    {
+        DataTimings::TimerScope outer("ManageHVAC");
+        for (int call = 1; call <= 3; ++call) {
+            DataTimings::TimerScope inner("ManageAirLoops");
+        }
+        DataTimings::TimerScope plant("ManagePlantLoops");
+    }
+    {
+        DataTimings::TimerScope outer("ManageHVAC");
+    }
+    DataTimings::TimerScope other("ManageAirLoops");
+
+    // root, ManageHVAC, ManageHVAC;ManageAirLoops, ManageHVAC;ManagePlantLoops, ManageAirLoops
+    ASSERT_EQ(5u, DataTimings::TimerScopes.size());
+    EXPECT_EQ(2, DataTimings::TimerScopes[1].Calls);
+    EXPECT_EQ(3, DataTimings::TimerScopes[2].Calls);
+    EXPECT_EQ(1, DataTimings::TimerScopes[3].Calls);
+    EXPECT_EQ(0, DataTimings::TimerScopes[4].Calls); // still open
+    EXPECT_EQ(4, DataTimings::CurrentTimerScope);
+
+    std::ostringstream folded;
+    DataTimings::epWriteTimerScopes(folded);
+    std::istringstream lines(folded.str());
+    std::string stack;
+    long long microseconds;
+    std::vector<std::string> stacks;
+    while (lines >> stack >> microseconds) {
+        EXPECT_GE(microseconds, 0);
+        stacks.push_back(stack);
+    }
+    ASSERT_EQ(5u, stacks.size());
+    EXPECT_EQ("EnergyPlus", stacks[0]);
+    EXPECT_EQ("EnergyPlus;ManageHVAC", stacks[1]);
+    EXPECT_EQ("EnergyPlus;ManageHVAC;ManageAirLoops", stacks[2]);
+    EXPECT_EQ("EnergyPlus;ManageHVAC;ManagePlantLoops", stacks[3]);
+    EXPECT_EQ("EnergyPlus;ManageAirLoops", stacks[4]);
+}
+
+TEST_F(EnergyPlusFixture, DataTimings_AddTimerScopeTime)
+{
+    // Time measured inside a threaded loop is charged to children of the scope that is open when it is added
+    {
+        DataTimings::TimerScope outer("calcKivaInstances");
+        std::string const slab("Slab Floor");
+        DataTimings::epAddTimerScopeTime("Slab Floor", 0.25);
+        DataTimings::epAddTimerScopeTime("Basement Floor", 0.5);
+        DataTimings::epAddTimerScopeTime(slab.c_str(), 0.125); // found by name, not by pointer
+    }
+    EXPECT_EQ(DataTimings::findOrAddTimerScope("calcKivaInstances"), 1);
+
+    // root, calcKivaInstances, calcKivaInstances;Slab Floor, calcKivaInstances;Basement Floor
+    ASSERT_EQ(4u, DataTimings::TimerScopes.size());
+    EXPECT_EQ(0, DataTimings::CurrentTimerScope);
+    EXPECT_EQ(1, DataTimings::TimerScopes[1].Calls);
+    EXPECT_EQ(1, DataTimings::TimerScopes[2].Parent);
+    EXPECT_EQ(1, DataTimings::TimerScopes[3].Parent);
+    EXPECT_EQ(2, DataTimings::TimerScopes[2].Calls);
+    EXPECT_EQ(1, DataTimings::TimerScopes[3].Calls);
+    EXPECT_DOUBLE_EQ(0.375, DataTimings::TimerScopes[2].Seconds);
+    EXPECT_DOUBLE_EQ(0.5, DataTimings::TimerScopes[3].Seconds);
+
+    // Children adding up to more than their parent leave it no self time
+    std::ostringstream folded;
+    DataTimings::epWriteTimerScopes(folded);
+    std::istringstream lines(folded.str());
+    std::string line;
+    std::vector<std::string> stacks;
+    while (std::getline(lines, line)) {
+        stacks.push_back(line);
+    }
+    ASSERT_EQ(4u, stacks.size());
+    EXPECT_EQ("EnergyPlus;calcKivaInstances 0", stacks[1]);
+    EXPECT_EQ("EnergyPlus;calcKivaInstances;Slab Floor 375000", stacks[2]);
+    EXPECT_EQ("EnergyPlus;calcKivaInstances;Basement Floor 500000", stacks[3]);
+}
@@ -45,6 +45,9 @@
 // OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+// C++ Headers
+#include <cstdio>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 
@@ -58,6 +61,7 @@
 #include <DataGlobals.hh>
 #include <DataHeatBalance.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DaylightingManager.hh>
 #include <General.hh>
 #include <HeatBalanceManager.hh>
@@ -872,6 +876,30 @@ TEST_F(EnergyPlusFixture, DaylightingManager_GetDaylParamInGeoTrans_Test)
     DataGlobals::WeightNow = 1.0;
     DataGlobals::WeightPreviousHour = 0.0;
     CalcDayltgCoefficients();
+
+    // The daylight factors survive a round trip through the daylighting cache
+    DataSystemVariables::ShadingCacheDirectory = ".";
+    std::string const CacheFileName(DaylightingCacheFileName());
+    ASSERT_FALSE(CacheFileName.empty());
+    DataEnvironment::GndReflectanceForDayltg += 0.1;
+    EXPECT_NE(CacheFileName, DaylightingCacheFileName());
+    DataEnvironment::GndReflectanceForDayltg -= 0.1;
+    std::remove(CacheFileName.c_str());
+    Array5D<Real64> const CalcDaylIllFacSky(ZoneDaylight(2).DaylIllFacSky);
+    Array4D<Real64> const CalcDaylIllFacSun(ZoneDaylight(2).DaylIllFacSun);
+    WriteDaylightingCache(CacheFileName);
+    ZoneDaylight(2).DaylIllFacSky = -1.0;
+    ZoneDaylight(2).DaylIllFacSun = -1.0;
+    EXPECT_TRUE(ReadDaylightingCache(CacheFileName));
+    DataSystemVariables::ShadingCacheDirectory.clear();
+    std::remove(CacheFileName.c_str());
+    for (std::size_t i = 0; i < CalcDaylIllFacSky.size(); ++i) {
+        EXPECT_DOUBLE_EQ(CalcDaylIllFacSky[i], ZoneDaylight(2).DaylIllFacSky[i]);
+    }
+    for (std::size_t i = 0; i < CalcDaylIllFacSun.size(); ++i) {
+        EXPECT_DOUBLE_EQ(CalcDaylIllFacSun[i], ZoneDaylight(2).DaylIllFacSun[i]);
+    }
+
     int zoneNum = 1;
     // test that tmp arrays are allocated to correct dimension
     // zone 1 has only 1 daylighting reference point
@@ -1389,3 +1417,77 @@ TEST_F(EnergyPlusFixture, DaylightingManager_DayltgInteriorIllum_Test)
     EXPECT_NEAR(DaylightingManager::DaylIllum(1), 100.0, 0.001);
     EXPECT_NEAR(DaylightingManager::DaylIllum(2), 10.0, 0.001);
 }
+
+TEST_F(EnergyPlusFixture, DaylightingManager_MapPointsCanBeThreaded_Test)
+{
+    ZoneDaylight.allocate(1);
+    ZoneDaylight(1).NumOfDayltgExtWins = 2;
+    ZoneDaylight(1).DayltgExtWinSurfNums.allocate(2);
+    ZoneDaylight(1).DayltgExtWinSurfNums(1) = 1;
+    ZoneDaylight(1).DayltgExtWinSurfNums(2) = 2;
+    Surface.allocate(2);
+    SurfaceWindow.allocate(2);
+    for (int IWin = 1; IWin <= 2; ++IWin) {
+        SurfaceWindow(IWin).WindowModelType = Window5DetailedModel;
+        SurfaceWindow(IWin).OriginalClass = SurfaceClass_Window;
+    }
+
+    // Plain windows only update per point data
+    EXPECT_TRUE(MapPointsCanBeThreaded(1));
+
+    // Screens store their transmittance for the angle of each point
+    SurfaceWindow(2).ScreenNumber = 1;
+    EXPECT_FALSE(MapPointsCanBeThreaded(1));
+    SurfaceWindow(2).ScreenNumber = 0;
+
+    // Complex fenestration initializes its daylighting geometry point by point
+    SurfaceWindow(1).WindowModelType = WindowBSDFModel;
+    EXPECT_FALSE(MapPointsCanBeThreaded(1));
+    SurfaceWindow(1).WindowModelType = Window5DetailedModel;
+
+    // Tubular daylighting devices accumulate fluxes for the pipe
+    SurfaceWindow(2).OriginalClass = SurfaceClass_TDD_Diffuser;
+    EXPECT_FALSE(MapPointsCanBeThreaded(1));
+}
+
+TEST_F(EnergyPlusFixture, DaylightingManager_EvaluateIllumMapsAtTimeStep_Test)
+{
+    DataGlobals::NumOfTimeStepInHour = 4;
+    for (DataGlobals::TimeStep = 1; DataGlobals::TimeStep <= 4; ++DataGlobals::TimeStep) {
+        EXPECT_TRUE(EvaluateIllumMapsAtTimeStep());
+    }
+
+    // Hourly maps are only figured at the second of four time steps
+    DataSystemVariables::HourlyIlluminanceMaps = true;
+    for (DataGlobals::TimeStep = 1; DataGlobals::TimeStep <= 4; ++DataGlobals::TimeStep) {
+        EXPECT_EQ(DataGlobals::TimeStep == 2, EvaluateIllumMapsAtTimeStep());
+    }
+    DataGlobals::NumOfTimeStepInHour = 1;
+    DataGlobals::TimeStep = 1;
+    EXPECT_TRUE(EvaluateIllumMapsAtTimeStep());
+}
+
+TEST_F(EnergyPlusFixture, DaylightingManager_DayltgZoneLightsAreOff)
+{
+    DataGlobals::NumOfZones = 1;
+    ZoneDaylight.allocate(1);
+    ZoneDaylight(1).DaylightMethod = SplitFluxDaylighting;
+    ZoneDaylight(1).NumOfDayltgExtWins = 0;
+    DataHeatBalance::TotLights = 1;
+    DataHeatBalance::Lights.allocate(1);
+    DataHeatBalance::Lights(1).ZonePtr = 1;
+    DataHeatBalance::Lights(1).DesignLevel = 100.0;
+    DataHeatBalance::Lights(1).SchedPtr = 0; // always off
+
+    // only skipped when requested
+    EXPECT_FALSE(DayltgZoneLightsAreOff(1));
+    DataSystemVariables::DaylightingSkipUnlitZones = true;
+    EXPECT_TRUE(DayltgZoneLightsAreOff(1));
+
+    DataHeatBalance::Lights(1).SchedPtr = -1; // always on
+    EXPECT_FALSE(DayltgZoneLightsAreOff(1));
+
+    DataHeatBalance::Lights(1).EMSLightsOn = true;
+    DataHeatBalance::Lights(1).EMSLightingPower = 0.0;
+    EXPECT_TRUE(DayltgZoneLightsAreOff(1));
+}
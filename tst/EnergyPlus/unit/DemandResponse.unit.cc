@@ -52,7 +52,9 @@
 
 #include "Fixtures/EnergyPlusFixture.hh"
 #include <DataGlobals.hh>
+#include <DataHVACGlobals.hh>
 #include <DemandManager.hh>
+#include <ExteriorEnergyUse.hh>
 #include <MixedAir.hh>
 
 using namespace EnergyPlus;
@@ -87,4 +89,73 @@ TEST_F(EnergyPlusFixture, DemandManagerGetInput)
     EXPECT_EQ(1, DemandMgr(1).NumOfLoads);
 }
 
+
+TEST_F(EnergyPlusFixture, DemandManager_SurveyOnlyWhenOverLimit)
+{
+    // Loads are surveyed when the first list in a pass is over its limit, instead of before every pass
+    DataGlobals::TimeStepZoneSec = 900.0;
+    DataHVACGlobals::TimeStepSys = 0.25;
+
+    ExteriorEnergyUse::ExteriorLights.allocate(1);
+    ExteriorEnergyUse::ExteriorLights(1).DesignLevel = 1000.0;
+    ExteriorEnergyUse::ExteriorLights(1).Power = 800.0;
+
+    NumDemandMgr = 2;
+    DemandMgr.allocate(NumDemandMgr);
+    for (auto &Mgr : DemandMgr) {
+        Mgr.Type = ManagerTypeExtLights;
+        Mgr.LimitControl = ManagerLimitFixed;
+        Mgr.LowerLimit = 0.5;
+        Mgr.NumOfLoads = 1;
+        Mgr.Load.allocate(1);
+        Mgr.Load(1) = 1;
+    }
+    DemandMgr(1).Available = false;
+    DemandMgr(2).Available = true;
+
+    // no meter and a zero limit: the first list is at its limit, the second is over it
+    NumDemandManagerList = 2;
+    DemandManagerList.allocate(NumDemandManagerList);
+    for (auto &List : DemandManagerList) {
+        List.History.dimension(List.AveragingWindow, 0.0);
+        List.ManagerPriority = ManagerPriorityAll;
+        List.NumOfManager = NumDemandMgr;
+        List.Manager.allocate(NumDemandMgr);
+        List.Manager = {1, 2};
+    }
+    DemandManagerList(2).AverageDemand = 100.0;
+
+    // stale flags that a survey overwrites
+    DemandMgr(1).CanReduceDemand = true;
+    DemandMgr(2).CanReduceDemand = false;
+
+    bool ResimExt = false;
+    bool ResimHB = false;
+    bool ResimHVAC = false;
+    SimulateDemandManagerList(1, ResimExt, ResimHB, ResimHVAC);
+    EXPECT_TRUE(DemandMgr(1).CanReduceDemand);
+    EXPECT_FALSE(DemandMgr(2).CanReduceDemand);
+    EXPECT_FALSE(DemandMgr(1).Activate);
+    EXPECT_FALSE(DemandMgr(2).Activate);
+    EXPECT_FALSE(ResimExt);
+
+    SimulateDemandManagerList(2, ResimExt, ResimHB, ResimHVAC);
+    bool const DeferredCanReduce1 = DemandMgr(1).CanReduceDemand;
+    bool const DeferredCanReduce2 = DemandMgr(2).CanReduceDemand;
+    EXPECT_FALSE(DeferredCanReduce1); // unavailable
+    EXPECT_TRUE(DeferredCanReduce2);  // 800 W is above the 500 W lower limit
+    EXPECT_FALSE(DemandMgr(1).Activate);
+    EXPECT_TRUE(DemandMgr(2).Activate);
+    EXPECT_TRUE(ResimExt);
+    EXPECT_FALSE(ResimHB);
+    EXPECT_FALSE(ResimHVAC);
+
+    // the survey made up front, as before, gives the same flags
+    DemandMgr(1).CanReduceDemand = true;
+    DemandMgr(2).CanReduceDemand = false;
+    SurveyDemandManagers();
+    EXPECT_EQ(DeferredCanReduce1, DemandMgr(1).CanReduceDemand);
+    EXPECT_EQ(DeferredCanReduce2, DemandMgr(2).CanReduceDemand);
+}
+
 } // namespace EnergyPlus
@@ -1560,3 +1560,185 @@ TEST_F(EnergyPlusFixture, EMSManager_TestOANodeAsActuators)
     EXPECT_TRUE(Node(3).IsLocalNode);
 
 }
+
+TEST_F(EnergyPlusFixture, EMSManager_SensorsRefreshedByCallingPoint)
+{
+    // sensors are only refreshed at the calling points whose programs (or the subroutines they run) read them,
+    // and the programs must still see the same values as when every sensor is refreshed at every call
+    std::string const idf_objects = delimited_string({
+
+        "OutdoorAir:Node, Test node 1;",
+        "OutdoorAir:Node, Test node 2;",
+        "OutdoorAir:Node, Test node 3;",
+
+        "EnergyManagementSystem:Sensor,",
+        "Node1_Temp,",
+        "Test node 1,",
+        "System Node Temperature;",
+
+        "EnergyManagementSystem:Sensor,",
+        "Node2_Temp,",
+        "Test node 2,",
+        "System Node Temperature;",
+
+        "EnergyManagementSystem:Sensor,",
+        "Node3_Temp,",
+        "Test node 3,",
+        "System Node Temperature;",
+
+        "EnergyManagementSystem:GlobalVariable, Result1, Result2, Result3;",
+
+        "EnergyManagementSystem:ProgramCallingManager,",
+        "Iteration Loop Manager,",
+        "InsideHVACSystemIterationLoop,",
+        "IterationLoopProgram;",
+
+        "EnergyManagementSystem:Program,",
+        "IterationLoopProgram,",
+        "SET Result1 = Node1_Temp,",
+        "RUN ReadNode2;",
+
+        "EnergyManagementSystem:Subroutine,",
+        "ReadNode2,",
+        "SET Result2 = Node2_Temp;",
+
+        "EnergyManagementSystem:ProgramCallingManager,",
+        "Begin Timestep Manager,",
+        "BeginTimestepBeforePredictor,",
+        "BeginTimestepProgram;",
+
+        "EnergyManagementSystem:Program,",
+        "BeginTimestepProgram,",
+        "SET Result3 = Node3_Temp;",
+
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    OutAirNodeManager::SetOutAirNodes();
+    NodeInputManager::SetupNodeVarsForReporting();
+    EMSManager::CheckIfAnyEMS();
+    EMSManager::FinishProcessingUserInput = true;
+
+    bool anyRan;
+    EMSManager::ManageEMS(DataGlobals::emsCallFromSetupSimulation, anyRan);
+
+    int const Result1 = RuntimeLanguageProcessor::FindEMSVariable("RESULT1", 0);
+    int const Result2 = RuntimeLanguageProcessor::FindEMSVariable("RESULT2", 0);
+    int const Result3 = RuntimeLanguageProcessor::FindEMSVariable("RESULT3", 0);
+    ASSERT_GT(Result1, 0);
+    ASSERT_GT(Result2, 0);
+    ASSERT_GT(Result3, 0);
+
+    for (Real64 const offset : {0.0, 5.0}) {
+        Node(1).Temp = 21.0 + offset;
+        Node(2).Temp = 22.0 + offset;
+        Node(3).Temp = 23.0 + offset;
+
+        EMSManager::ManageEMS(DataGlobals::emsCallFromHVACIterationLoop, anyRan);
+        EXPECT_TRUE(anyRan);
+        EXPECT_EQ(21.0 + offset, ErlVariable(Result1).Value.Number);
+        EXPECT_EQ(22.0 + offset, ErlVariable(Result2).Value.Number);
+
+        EMSManager::ManageEMS(DataGlobals::emsCallFromBeginTimestepBeforePredictor, anyRan);
+        EXPECT_TRUE(anyRan);
+        EXPECT_EQ(23.0 + offset, ErlVariable(Result3).Value.Number);
+    }
+
+    // the iteration loop refreshes the sensors read by its program and subroutine, the begin timestep only its own
+    ASSERT_TRUE(EMSManager::SensorsByCallingPointHaveBeenSetup);
+    EXPECT_EQ(std::vector<int>({1, 2}), SensorsByCallingPoint[DataGlobals::emsCallFromHVACIterationLoop]);
+    EXPECT_EQ(std::vector<int>({3}), SensorsByCallingPoint[DataGlobals::emsCallFromBeginTimestepBeforePredictor]);
+    EXPECT_TRUE(SensorsAtAllCallingPoints.empty());
+}
+
+TEST_F(EnergyPlusFixture, EMSManager_ActuatorTargetTable)
+{
+    // the dense actuator table keeps the EMSActuatorUsed order so the last actuator on the same data wins,
+    // and a Null actuator value releases the actuated flag
+    std::string const idf_objects = delimited_string({
+
+        "OutdoorAir:Node, Test node;",
+
+        "EnergyManagementSystem:Actuator,",
+        "TempSetpointA,          !- Name",
+        "Test node,  !- Actuated Component Unique Name",
+        "System Node Setpoint,    !- Actuated Component Type",
+        "Temperature Setpoint;    !- Actuated Component Control Type",
+
+        "EnergyManagementSystem:Actuator,",
+        "TempSetpointB,          !- Name",
+        "Test node,  !- Actuated Component Unique Name",
+        "System Node Setpoint,    !- Actuated Component Type",
+        "Temperature Setpoint;    !- Actuated Component Control Type",
+
+        "EnergyManagementSystem:Actuator,",
+        "TempSetpointLo,          !- Name",
+        "Test node,  !- Actuated Component Unique Name",
+        "System Node Setpoint,    !- Actuated Component Type",
+        "Temperature Minimum Setpoint;    !- Actuated Component Control Type",
+
+        "EnergyManagementSystem:ProgramCallingManager,",
+        "Set Manager,  !- Name",
+        "BeginNewEnvironment,  !- EnergyPlus Model Calling Point",
+        "SetActuators;  !- Program Name 1",
+
+        "EnergyManagementSystem:Program,",
+        "SetActuators,",
+        "Set TempSetpointB = 12.0,",
+        "Set TempSetpointA = 10.0,",
+        "Set TempSetpointLo = 16.0;",
+
+        "EnergyManagementSystem:ProgramCallingManager,",
+        "Release Manager,  !- Name",
+        "BeginTimestepBeforePredictor,  !- EnergyPlus Model Calling Point",
+        "ReleaseActuators;  !- Program Name 1",
+
+        "EnergyManagementSystem:Program,",
+        "ReleaseActuators,",
+        "Set TempSetpointA = Null,",
+        "Set TempSetpointB = Null,",
+        "Set TempSetpointLo = Null;",
+
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    OutAirNodeManager::SetOutAirNodes();
+    EMSManager::CheckIfAnyEMS();
+    EMSManager::FinishProcessingUserInput = true;
+
+    bool anyRan;
+    EMSManager::ManageEMS(DataGlobals::emsCallFromSetupSimulation, anyRan);
+    EMSManager::ManageEMS(DataGlobals::emsCallFromBeginNewEvironment, anyRan);
+    EXPECT_TRUE(anyRan);
+
+    // one entry per matched actuator, in input order, pointing at the node data
+    ASSERT_TRUE(EMSManager::ActuatorTargetsAreCurrent);
+    ASSERT_EQ(3u, EMSActuatorTarget.size());
+    for (int ActuatorUsedNum = 1; ActuatorUsedNum <= 3; ++ActuatorUsedNum) {
+        EXPECT_EQ(EMSActuatorUsed(ActuatorUsedNum).ErlVariableNum, EMSActuatorTarget[ActuatorUsedNum - 1].ErlVariableNum);
+        EXPECT_EQ(PntrReal, EMSActuatorTarget[ActuatorUsedNum - 1].PntrVarTypeUsed);
+    }
+    EXPECT_EQ(&Node(1).TempSetPoint, EMSActuatorTarget[0].RealValue);
+    EXPECT_EQ(&Node(1).TempSetPoint, EMSActuatorTarget[1].RealValue);
+    EXPECT_EQ(&Node(1).TempSetPointLo, EMSActuatorTarget[2].RealValue);
+
+    // TempSetpointB is declared after TempSetpointA, so it wins although the program sets it first
+    EXPECT_DOUBLE_EQ(12.0, Node(1).TempSetPoint);
+    EXPECT_DOUBLE_EQ(16.0, Node(1).TempSetPointLo);
+    EXPECT_TRUE(*EMSActuatorTarget[2].Actuated);
+
+    // Null values release the actuators and leave the actuated data alone
+    EMSManager::ManageEMS(DataGlobals::emsCallFromBeginTimestepBeforePredictor, anyRan);
+    EXPECT_TRUE(anyRan);
+    for (auto const &thisTarget : EMSActuatorTarget) {
+        EXPECT_FALSE(*thisTarget.Actuated);
+    }
+    EXPECT_DOUBLE_EQ(12.0, Node(1).TempSetPoint);
+    EXPECT_DOUBLE_EQ(16.0, Node(1).TempSetPointLo);
+
+    // input processing marks the table stale so newly matched actuators are picked up
+    EMSManager::ProcessEMSInput(false);
+    EXPECT_FALSE(EMSManager::ActuatorTargetsAreCurrent);
+}
@@ -52,6 +52,7 @@
 #include <ObjexxFCL/Array1D.hh>
 
 // EnergyPlus Headers
+#include <DataEnvironment.hh>
 #include <DataGlobals.hh>
 #include <EconomicTariff.hh>
 #include <OutputProcessor.hh>
@@ -447,3 +448,75 @@ TEST_F(EnergyPlusFixture, EconomicTariff_LEEDtariffReporting_Test)
     EXPECT_EQ("6.391", RetrievePreDefTableEntry(pdchLeedEtsVirt, "District Cooling"));
     EXPECT_EQ("10.871", RetrievePreDefTableEntry(pdchLeedEtsVirt, "District Heating"));
 }
+
+TEST_F(EnergyPlusFixture, EconomicTariff_SharedGathering_Test)
+{
+    std::string const idf_objects = delimited_string({
+        "  UtilityCost:Tariff,                                                       ",
+        "    WaterTariffA,            !- Name                                        ",
+        "    Water:Facility,          !- Output Meter Name                           ",
+        "    ,                        !- Conversion Factor Choice                    ",
+        "    ,                        !- Energy Conversion Factor                    ",
+        "    ,                        !- Demand Conversion Factor                    ",
+        "    ,                        !- Time of Use Period Schedule Name            ",
+        "    ,                        !- Season Schedule Name                        ",
+        "    ,                        !- Month Schedule Name                         ",
+        "    ,                        !- Demand Window Length                        ",
+        "    10;                      !- Monthly Charge or Variable Name             ",
+        "                                                                            ",
+        "  UtilityCost:Tariff,                                                       ",
+        "    WaterTariffB,            !- Name                                        ",
+        "    Water:Facility,          !- Output Meter Name                           ",
+        "    ,                        !- Conversion Factor Choice                    ",
+        "    ,                        !- Energy Conversion Factor                    ",
+        "    ,                        !- Demand Conversion Factor                    ",
+        "    ,                        !- Time of Use Period Schedule Name            ",
+        "    ,                        !- Season Schedule Name                        ",
+        "    ,                        !- Month Schedule Name                         ",
+        "    ,                        !- Demand Window Length                        ",
+        "    20;                      !- Monthly Charge or Variable Name             ",
+        "                                                                            ",
+        "  UtilityCost:Tariff,                                                       ",
+        "    WaterTariffCCF,          !- Name                                        ",
+        "    Water:Facility,          !- Output Meter Name                           ",
+        "    CCF,                     !- Conversion Factor Choice                    ",
+        "    ,                        !- Energy Conversion Factor                    ",
+        "    ,                        !- Demand Conversion Factor                    ",
+        "    ,                        !- Time of Use Period Schedule Name            ",
+        "    ,                        !- Season Schedule Name                        ",
+        "    ,                        !- Month Schedule Name                         ",
+        "    ,                        !- Demand Window Length                        ",
+        "    10;                      !- Monthly Charge or Variable Name             ",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    // Create a water meter
+    NumEnergyMeters = 1;
+    EnergyMeters.allocate(NumEnergyMeters);
+    EnergyMeters(1).Name = "WATER:FACILITY";
+    EnergyMeters(1).ResourceType = "WATER";
+
+    UpdateUtilityBills();
+
+    // the two tariffs with the same conversion share the gathering, the CCF one gathers on its own
+    EXPECT_EQ(3, numTariff);
+    EXPECT_EQ(1, tariff(1).gatherTariff);
+    EXPECT_EQ(1, tariff(2).gatherTariff);
+    EXPECT_EQ(3, tariff(3).gatherTariff);
+
+    EnergyMeters(1).CurTSValue = 7.0;
+    DataGlobals::TimeStepZoneSec = 3600.0;
+    DataEnvironment::Month = 2;
+    GatherForEconomics();
+
+    EXPECT_DOUBLE_EQ(7.0, tariff(1).gatherEnergy(2, 1));
+    EXPECT_DOUBLE_EQ(0.0, tariff(2).gatherEnergy(2, 1));
+    EXPECT_DOUBLE_EQ(7.0 * tariff(3).energyConv, tariff(3).gatherEnergy(2, 1));
+
+    // the shared values are picked up when the native variables are set
+    setNativeVariables();
+    EXPECT_DOUBLE_EQ(7.0, tariff(2).gatherEnergy(2, 1));
+    EXPECT_DOUBLE_EQ(tariff(1).gatherDemand(2, 1), tariff(2).gatherDemand(2, 1));
+    EXPECT_DOUBLE_EQ(7.0, econVar(tariff(2).nativeTotalEnergy).values(2));
+}
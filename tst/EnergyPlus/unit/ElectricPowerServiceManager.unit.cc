@@ -60,6 +60,7 @@
 #include <EnergyPlus/DataEnvironment.hh>
 #include <EnergyPlus/DataGlobals.hh>
 #include <EnergyPlus/DataHVACGlobals.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/ElectricPowerServiceManager.hh>
 #include <EnergyPlus/ExteriorEnergyUse.hh>
 #include <EnergyPlus/General.hh>
@@ -216,6 +217,14 @@ TEST_F(EnergyPlusFixture, ManageElectricPowerTest_BatteryDischargeTest)
     EXPECT_TRUE(facilityElectricServiceObj->elecLoadCenterObjs[0]->storageObj->determineCurrentForBatteryDischarge(
         I0, T0, Volt, Pw, q0, CurveNum1, k, c, qmax, E0c, InternalR));
 
+    // starting from the last converged current gives the same current
+    Real64 const convergedI0 = I0;
+    DataSystemVariables::BatteryWarmStart = true;
+    EXPECT_TRUE(facilityElectricServiceObj->elecLoadCenterObjs[0]->storageObj->determineCurrentForBatteryDischarge(
+        I0, T0, Volt, Pw, q0, CurveNum1, k, c, qmax, E0c, InternalR));
+    EXPECT_NEAR(convergedI0, I0, 0.0001);
+    DataSystemVariables::BatteryWarmStart = false;
+
     I0 = -222.7;
     T0 = -0.145;
     Volt = 24.54;
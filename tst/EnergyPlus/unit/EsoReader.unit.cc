@@ -0,0 +1,203 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::EsoReader and EnergyPlus::EsoDictionary Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/public/EsoDictionary.hh>
+#include <EnergyPlus/public/EsoReader.hh>
+
+using namespace EnergyPlus;
+
+TEST(EsoDictionaryTest, FormatAndParse)
+{
+    EsoDictionary::Item item;
+
+    std::string line(EsoDictionary::formatItem("8",
+                                               7,
+                                               true,
+                                               "Zone One",
+                                               "Zone Mean Air Temperature",
+                                               "C",
+                                               " !Daily [Value,Min,Hour,Minute,Max,Hour,Minute],Always On"));
+    EXPECT_EQ("8,7,Zone One,Zone Mean Air Temperature [C] !Daily [Value,Min,Hour,Minute,Max,Hour,Minute],Always On", line);
+    ASSERT_TRUE(EsoDictionary::parseItem(line.data(), line.data() + line.size(), item));
+    EXPECT_EQ(8, item.reportID);
+    EXPECT_EQ(7, item.numFields);
+    EXPECT_TRUE(item.hasKey);
+    EXPECT_EQ("Zone One", item.keyedValue);
+    EXPECT_EQ("Zone Mean Air Temperature", item.name);
+    EXPECT_EQ("C", item.units);
+    EXPECT_EQ("Daily", item.frequency);
+    EXPECT_EQ("Always On", item.scheduleName);
+
+    line = EsoDictionary::formatItem("10", 1, false, "", "Cumulative Electricity:Facility", "J", " !Daily ") + "\r\n";
+    ASSERT_TRUE(EsoDictionary::parseItem(line.data(), line.data() + line.size(), item));
+    EXPECT_EQ(10, item.reportID);
+    EXPECT_EQ(1, item.numFields);
+    EXPECT_FALSE(item.hasKey);
+    EXPECT_EQ("", item.keyedValue);
+    EXPECT_EQ("Cumulative Electricity:Facility", item.name);
+    EXPECT_EQ("J", item.units);
+    EXPECT_EQ("Daily", item.frequency);
+    EXPECT_EQ("", item.scheduleName);
+
+    line = EsoDictionary::formatItem("12", 1, true, "SPACE1-1", "Zone Air Temperature", "", " !Each Call");
+    ASSERT_TRUE(EsoDictionary::parseItem(line.data(), line.data() + line.size(), item));
+    EXPECT_EQ("", item.units);
+    EXPECT_EQ("Each Call", item.frequency);
+
+    // The environment and time stamp definitions are not report variables
+    line = "1,5,Environment Title[],Latitude[deg],Longitude[deg],Time Zone[],Elevation[m]";
+    EXPECT_FALSE(EsoDictionary::parseItem(line.data(), line.data() + line.size(), item));
+    line = "3,5,Cumulative Day of Simulation[],Month[],Day of Month[],DST Indicator[1=yes 0=no],DayType  ! When Daily Report Variables Requested";
+    EXPECT_FALSE(EsoDictionary::parseItem(line.data(), line.data() + line.size(), item));
+    line = "5,1,Cumulative Days of Simulation[] ! When Run Period Report Variables Requested";
+    EXPECT_FALSE(EsoDictionary::parseItem(line.data(), line.data() + line.size(), item));
+}
+
+TEST(EsoReaderTest, IndexAndValues)
+{
+    std::string const fileName("EsoReaderTest.eso");
+    {
+        std::ofstream eso(fileName, std::ios_base::binary);
+        eso << "Program Version,EnergyPlus, Version 9.2.0-abcdef, YMD=2019.09.19 10:00\n"
+               "1,5,Environment Title[],Latitude[deg],Longitude[deg],Time Zone[],Elevation[m]\n"
+               "2,8,Day of Simulation[],Month[],Day of Month[],DST Indicator[1=yes 0=no],Hour[],StartMinute[],EndMinute[],DayType\n"
+               "3,5,Cumulative Day of Simulation[],Month[],Day of Month[],DST Indicator[1=yes 0=no],DayType  ! When Daily Report Variables "
+               "Requested\n"
+               "4,2,Cumulative Days of Simulation[],Month[]  ! When Monthly Report Variables Requested\n"
+               "5,1,Cumulative Days of Simulation[] ! When Run Period Report Variables Requested\n"
+               "6,1,Calendar Year of Simulation[] ! When Annual Report Variables Requested\n"
+               "7,1,Environment,Site Outdoor Air Drybulb Temperature [C] !Hourly\n"
+               "8,7,Zone One,Zone Mean Air Temperature [C] !Daily [Value,Min,Hour,Minute,Max,Hour,Minute]\n"
+               "9,1,Electricity:Facility [J] !Hourly\n"
+               "End of Data Dictionary\n"
+               "1,CHICAGO ANN HTG 99.6% CONDNS DB,  41.98, -87.92,  -6.00, 201.00\n"
+               "2,1, 1,21, 0, 1, 0.00,60.00,WinterDesignDay\n"
+               "7,-20.6\n"
+               "9,1000.5\n"
+               "2,1, 1,21, 0, 2, 0.00,60.00,WinterDesignDay\n"
+               "7,-19.4\n"
+               "9,2000.\n"
+               "3,1, 1,21, 0,WinterDesignDay\n"
+               "8,21.0,20.5, 1,60,21.5,24,60\n"
+               "1,RUN PERIOD 1,  41.98, -87.92,  -6.00, 201.00\n"
+               "2,2, 1, 1, 0, 1, 0.00,60.00,Sunday\n"
+               "7,-5.0\n"
+               "End of Data\n"
+               "Number of Records Written=       10\n";
+    }
+
+    {
+        EsoReader reader(fileName);
+        ASSERT_TRUE(reader.isOpen());
+        EXPECT_EQ("EnergyPlus, Version 9.2.0-abcdef, YMD=2019.09.19 10:00", reader.programVersion());
+        ASSERT_EQ(3u, reader.dictionary().size());
+        ASSERT_EQ(2u, reader.environments().size());
+        EXPECT_EQ("CHICAGO ANN HTG 99.6% CONDNS DB", reader.environments()[0]);
+        EXPECT_EQ("RUN PERIOD 1", reader.environments()[1]);
+
+        EXPECT_EQ(7, reader.findReportID("Environment", "Site Outdoor Air Drybulb Temperature", "Hourly"));
+        EXPECT_EQ(9, reader.findReportID("", "Electricity:Facility", "Hourly"));
+        EXPECT_EQ(0, reader.findReportID("Environment", "Site Outdoor Air Drybulb Temperature", "Daily"));
+        ASSERT_NE(nullptr, reader.item(8));
+        EXPECT_EQ("Zone One", reader.item(8)->keyedValue);
+        EXPECT_EQ(nullptr, reader.item(2));
+
+        EXPECT_EQ(2u, reader.numValues(7, 0));
+        EXPECT_EQ(1u, reader.numValues(7, 1));
+        EXPECT_EQ(0u, reader.numValues(8, 1));
+        EXPECT_EQ(0u, reader.numValues(7, 2));
+
+        std::vector<EsoReader::Value> values(reader.values(7, 0));
+        ASSERT_EQ(2u, values.size());
+        EXPECT_DOUBLE_EQ(-20.6, values[0].value);
+        EXPECT_DOUBLE_EQ(-20.6, values[0].minimum);
+        EXPECT_EQ(1, values[0].stamp.dayOfSimulation);
+        EXPECT_EQ(1, values[0].stamp.month);
+        EXPECT_EQ(21, values[0].stamp.dayOfMonth);
+        EXPECT_EQ(1, values[0].stamp.hour);
+        EXPECT_DOUBLE_EQ(60.0, values[0].stamp.endMinute);
+        EXPECT_EQ("WinterDesignDay", values[0].stamp.dayType);
+        EXPECT_DOUBLE_EQ(-19.4, values[1].value);
+        EXPECT_EQ(2, values[1].stamp.hour);
+
+        values = reader.values(9, 0);
+        ASSERT_EQ(2u, values.size());
+        EXPECT_DOUBLE_EQ(1000.5, values[0].value);
+        EXPECT_DOUBLE_EQ(2000.0, values[1].value);
+
+        values = reader.values(8, 0);
+        ASSERT_EQ(1u, values.size());
+        EXPECT_DOUBLE_EQ(21.0, values[0].value);
+        EXPECT_DOUBLE_EQ(20.5, values[0].minimum);
+        EXPECT_DOUBLE_EQ(21.5, values[0].maximum);
+        EXPECT_EQ(21, values[0].stamp.dayOfMonth);
+        EXPECT_EQ(0, values[0].stamp.hour);
+        EXPECT_EQ("WinterDesignDay", values[0].stamp.dayType);
+
+        values = reader.values(7, 1);
+        ASSERT_EQ(1u, values.size());
+        EXPECT_DOUBLE_EQ(-5.0, values[0].value);
+        EXPECT_EQ("Sunday", values[0].stamp.dayType);
+    }
+    std::remove(fileName.c_str());
+
+    EsoReader missing("EsoReaderTestMissing.eso");
+    EXPECT_FALSE(missing.isOpen());
+    EXPECT_TRUE(missing.dictionary().empty());
+    EXPECT_TRUE(missing.values(7, 0).empty());
+}
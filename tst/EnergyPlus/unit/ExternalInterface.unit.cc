@@ -0,0 +1,112 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::ExternalInterface Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <vector>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/ExternalInterface.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::ExternalInterface;
+
+TEST_F(EnergyPlusFixture, ExternalInterface_SetupFMUValueReferences)
+{
+    NumFMUObjects = 1;
+    ExternalInterface::FMU.allocate(1);
+    ExternalInterface::FMU(1).NumInstances = 1;
+    ExternalInterface::FMU(1).Instance.allocate(1);
+    auto &thisInstance(ExternalInterface::FMU(1).Instance(1));
+
+    thisInstance.NumOutputVariablesSchedule = 2;
+    thisInstance.fmuOutputVariableSchedule.allocate(2);
+    thisInstance.fmuOutputVariableSchedule(1).ValueReference = 11;
+    thisInstance.fmuOutputVariableSchedule(2).ValueReference = 12;
+    thisInstance.NumOutputVariablesVariable = 1;
+    thisInstance.fmuOutputVariableVariable.allocate(1);
+    thisInstance.fmuOutputVariableVariable(1).ValueReference = 21;
+    thisInstance.NumOutputVariablesActuator = 1;
+    thisInstance.fmuOutputVariableActuator.allocate(1);
+    thisInstance.fmuOutputVariableActuator(1).ValueReference = 31;
+    thisInstance.NumInputVariablesInIDF = 2;
+    thisInstance.fmuInputVariable.allocate(2);
+    thisInstance.fmuInputVariable(1).ValueReference = 1;
+    thisInstance.fmuInputVariable(2).ValueReference = 2;
+
+    // outputs are packed schedules first, then variables, then actuators, the order the step scatters them back in
+    SetupFMUValueReferences();
+    std::vector<fmiValueReference> const OutputValueReference{11, 12, 21, 31};
+    std::vector<fmiValueReference> const InputValueReference{1, 2};
+    EXPECT_EQ(OutputValueReference, thisInstance.outputValueReference);
+    EXPECT_EQ(4, thisInstance.NumOutputValueReferences);
+    EXPECT_EQ(4u, thisInstance.outputValue.size());
+    EXPECT_EQ(InputValueReference, thisInstance.inputValueReference);
+    EXPECT_EQ(2u, thisInstance.inputValue.size());
+
+    // packing again after a new instantiation replaces the references instead of appending to them
+    SetupFMUValueReferences();
+    EXPECT_EQ(OutputValueReference, thisInstance.outputValueReference);
+    EXPECT_EQ(4, thisInstance.NumOutputValueReferences);
+    EXPECT_EQ(InputValueReference, thisInstance.inputValueReference);
+
+    // an instance without outputs makes no get call
+    thisInstance.NumOutputVariablesSchedule = 0;
+    thisInstance.NumOutputVariablesVariable = 0;
+    thisInstance.NumOutputVariablesActuator = 0;
+    SetupFMUValueReferences();
+    EXPECT_EQ(0, thisInstance.NumOutputValueReferences);
+    EXPECT_TRUE(thisInstance.outputValue.empty());
+
+    ExternalInterface::FMU.deallocate();
+    NumFMUObjects = 0;
+}
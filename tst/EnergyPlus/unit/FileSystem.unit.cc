@@ -0,0 +1,110 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::FileSystem Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus/FileSystem.hh>
+
+#include "Fixtures/EnergyPlusFixture.hh"
+
+using namespace EnergyPlus;
+
+TEST_F(EnergyPlusFixture, FileSystem_Hash)
+{
+    // Published 64 bit FNV-1a test vectors
+    EXPECT_EQ(0xcbf29ce484222325ULL, FileSystem::hashBasis);
+    EXPECT_EQ(0xaf63dc4c8601ec8cULL, FileSystem::hashString("a"));
+    EXPECT_EQ(0x85944171f73967e8ULL, FileSystem::hashString("foobar"));
+    EXPECT_EQ("85944171f73967e8", FileSystem::hashToHex(FileSystem::hashString("foobar")));
+    EXPECT_EQ("00000000000000ff", FileSystem::hashToHex(0xffULL));
+
+    // Hashing in pieces gives the hash of the whole
+    std::string const foo("foo");
+    EXPECT_EQ(FileSystem::hashString("foobar"), FileSystem::hashString("bar", FileSystem::hashBytes(foo.data(), foo.size())));
+}
+
+TEST_F(EnergyPlusFixture, FileSystem_CacheFile)
+{
+    std::string const fileName("FileSystem_CacheFile.cache");
+    std::vector<double> values({1.5, -2.25, 3.0});
+    int count(7);
+    FileSystem::CacheBlocks blocks;
+    FileSystem::addCacheArray(blocks, values);
+    FileSystem::addCacheValue(blocks, count);
+    ASSERT_TRUE(FileSystem::writeCacheFile(fileName, {1, 3}, blocks));
+
+    values.assign(3, 0.0);
+    count = 0;
+    bool sizeMismatch(true);
+    EXPECT_TRUE(FileSystem::readCacheFile(fileName, {1, 3}, blocks, sizeMismatch));
+    EXPECT_FALSE(sizeMismatch);
+    EXPECT_EQ(std::vector<double>({1.5, -2.25, 3.0}), values);
+    EXPECT_EQ(7, count);
+
+    // A different header is not read, and neither is a file of a different length
+    values.assign(3, 0.0);
+    EXPECT_FALSE(FileSystem::readCacheFile(fileName, {2, 3}, blocks, sizeMismatch));
+    EXPECT_FALSE(sizeMismatch);
+    FileSystem::CacheBlocks shorterBlocks;
+    FileSystem::addCacheArray(shorterBlocks, values);
+    EXPECT_FALSE(FileSystem::readCacheFile(fileName, {1, 3}, shorterBlocks, sizeMismatch));
+    EXPECT_TRUE(sizeMismatch);
+    EXPECT_EQ(std::vector<double>(3, 0.0), values);
+
+    EXPECT_FALSE(FileSystem::readCacheFile("FileSystem_CacheFile.missing", {1, 3}, blocks, sizeMismatch));
+    EXPECT_FALSE(sizeMismatch);
+
+    FileSystem::removeFile(fileName);
+}
@@ -326,3 +326,62 @@ TEST_F(EnergyPlusFixture, FiniteDiffGroundTempModel_GetWeather_Weather) {
     EXPECT_NEAR(firstDay.horizontalRadiation, 140, 2);
 
 }
+
+TEST_F(EnergyPlusFixture, FiniteDiffGroundTempModel_ReuseResults)
+{
+    using DataGlobals::Pi;
+    using WeatherManager::NumDaysInYear;
+
+    auto makeModel = [](std::string const &name) {
+        std::shared_ptr<FiniteDiffGroundTempsModel> thisModel(new FiniteDiffGroundTempsModel());
+        thisModel->objectType = GroundTemperatureManager::objectType_FiniteDiffGroundTemp;
+        thisModel->objectName = name;
+        thisModel->baseConductivity = 1.08;
+        thisModel->baseDensity = 962.0;
+        thisModel->baseSpecificHeat = 2576.0;
+        thisModel->waterContent = 30.0 / 100.0;
+        thisModel->saturatedWaterContent = 50.0 / 100.0;
+        thisModel->evapotransCoeff = 0.408;
+        return thisModel;
+    };
+
+    auto firstModel = makeModel("First");
+    firstModel->developMesh();
+    firstModel->weatherDataArray.dimension(NumDaysInYear);
+    for (int day = 1; day <= NumDaysInYear; ++day) {
+        auto &tdwd = firstModel->weatherDataArray(day);
+        Real64 theta = 2 * Pi * day / NumDaysInYear;
+        Real64 omega = 2 * Pi * 130 / NumDaysInYear;
+        tdwd.dryBulbTemp = 10.0 * std::sin(theta - omega) + 15.0;
+        tdwd.relativeHumidity = 0.5;
+        tdwd.windSpeed = 3.0;
+        tdwd.horizontalRadiation = 100.0 * std::sin(theta - omega) + 200.0;
+        tdwd.airDensity = 1.2;
+    }
+    firstModel->annualAveAirTemp = 15.0;
+    firstModel->maxDailyAirTemp = 25.0;
+    firstModel->minDailyAirTemp = 5.0;
+    firstModel->dayOfMinDailyAirTemp = 30;
+    firstModel->performSimulation();
+    GroundTemperatureManager::groundTempModels.push_back(firstModel);
+
+    // Same soil: the results are copied without reading the weather file, which would fail here
+    auto secondModel = makeModel("Second");
+    GroundTemperatureManager::groundTempModels.push_back(secondModel);
+    secondModel->initAndSim();
+    EXPECT_EQ(firstModel->totalNumCells, secondModel->totalNumCells);
+    EXPECT_TRUE(equal_dimensions(firstModel->groundTemps, secondModel->groundTemps));
+    EXPECT_DOUBLE_EQ(firstModel->getGroundTempAtTimeInMonths(3.0, 6), secondModel->getGroundTempAtTimeInMonths(3.0, 6));
+
+    // Cache round trip
+    std::string const fileName("FiniteDiffGroundTempModel_ReuseResults.gtcache");
+    firstModel->writeGroundTempCache(fileName);
+    auto cachedModel = makeModel("Cached");
+    ASSERT_TRUE(cachedModel->readGroundTempCache(fileName));
+    std::remove(fileName.c_str());
+    EXPECT_EQ(firstModel->totalNumCells, cachedModel->totalNumCells);
+    EXPECT_DOUBLE_EQ(firstModel->getGroundTempAtTimeInMonths(0.0, 1), cachedModel->getGroundTempAtTimeInMonths(0.0, 1));
+    EXPECT_DOUBLE_EQ(firstModel->getGroundTempAtTimeInSeconds(25.0, 14342400), cachedModel->getGroundTempAtTimeInSeconds(25.0, 14342400));
+
+    EXPECT_FALSE(cachedModel->readGroundTempCache(fileName));
+}
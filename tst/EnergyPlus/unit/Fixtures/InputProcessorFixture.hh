@@ -102,7 +102,12 @@ protected:
 
     std::string encodeIDF()
     {
-        return inputProcessor->idf_parser->encode(inputProcessor->epJSON, inputProcessor->schema);
+        return inputProcessor->idf_parser->encode(inputProcessor->epJSON, *inputProcessor->schema);
+    }
+
+    std::shared_ptr<json const> const &getSchema(InputProcessor const &ip)
+    {
+        return ip.schema;
     }
 
     json &getEpJSON()
@@ -122,6 +127,11 @@ protected:
         idfParser.eat_comment(idf, index);
     }
 
+    json const &getSchema()
+    {
+        return *inputProcessor->schema;
+    }
+
     std::string parse_string(std::string const &idf, size_t &index, bool &success)
     {
         IdfParser idfParser;
@@ -131,7 +141,7 @@ protected:
     json parse_value(std::string const &idf, size_t &index, bool &success)
     {
         IdfParser idfParser;
-        return idfParser.parse_value(idf, index, success, inputProcessor->schema["properties"]);
+        return idfParser.parse_value(idf, index, success, inputProcessor->schema->at("properties"));
     }
 
     json parse_value(std::string const &idf, size_t &index, bool &success, json const &field_loc)
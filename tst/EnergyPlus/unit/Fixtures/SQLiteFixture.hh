@@ -175,6 +175,10 @@ protected:
         int rowCount = columnCount(tableName);
         if (rowCount < 1) return queryVector;
 
+        // report and tabular data held back for a batched insert must be in the table before it is read
+        EnergyPlus::sqlite->flushReportDataRecords();
+        EnergyPlus::sqlite->flushTabularDataRecords();
+
         sqlite3_stmt *sqlStmtPtr;
 
         sqlite3_prepare_v2(EnergyPlus::sqlite->m_db.get(), statement.c_str(), -1, &sqlStmtPtr, nullptr);
@@ -199,6 +203,9 @@ protected:
 
         Real64 result(-10000.0);
 
+        EnergyPlus::sqlite->flushReportDataRecords();
+        EnergyPlus::sqlite->flushTabularDataRecords();
+
         sqlite3_stmt* sqlStmtPtr;
 
         int code = sqlite3_prepare_v2(EnergyPlus::sqlite->m_db.get(), statement.c_str(), -1, &sqlStmtPtr, nullptr);
@@ -51,6 +51,7 @@
 #include <gtest/gtest.h>
 
 // EnergyPlus Headers
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/FluidProperties.hh>
 
 #include <cmath>
@@ -86,3 +87,86 @@ TEST_F(EnergyPlusFixture, FluidProperties_GetDensityGlycol)
     EXPECT_NEAR(972.03, GetDensityGlycol("GLHXFLUID", 105.0, FluidIndex, "UnitTest"), 0.01);
     EXPECT_NEAR(953.41, GetDensityGlycol("GLHXFLUID", 125.0, FluidIndex, "UnitTest"), 0.01);
 }
+
+TEST_F(EnergyPlusFixture, FluidProperties_RefrigIndexWithHint)
+{
+    // The grid and hint searches find the same intervals as interval halving, including at the table values
+    Array1D<Real64> const Table(7, {1.0, 2.0, 2.5, 4.0, 7.0, 7.5, 10.0});
+    FluidPropsTableGrid Grid;
+    SetupTableGrid(Grid, Table);
+    EXPECT_FALSE(Grid.CellIndex.empty());
+    int Hint(0);
+    int BoundedHint(0);
+    for (Real64 Value = 0.0; Value <= 11.0; Value += 0.125) {
+        EXPECT_EQ(FindArrayIndex(Value, Table, 1, 7), FindArrayIndex(Value, Table, 1, 7, Grid, Hint));
+        EXPECT_EQ(FindArrayIndex(Value, Table, 2, 6), FindArrayIndex(Value, Table, 2, 6, Grid, BoundedHint));
+    }
+
+    // The refrigerant index versions return the same properties as the name versions
+    int SteamIndex(0);
+    Real64 const Psat(GetSatPressureRefrig("STEAM", 120.0, SteamIndex, "UnitTest"));
+    EXPECT_GT(SteamIndex, 0);
+    RefrigPropertyHint SteamHint;
+    EXPECT_DOUBLE_EQ(Psat, GetSatPressureRefrig(SteamIndex, 120.0, SteamHint, "UnitTest"));
+    EXPECT_GT(SteamHint.PsTemp, 0);
+    EXPECT_DOUBLE_EQ(GetSatTemperatureRefrig("STEAM", Psat, SteamIndex, "UnitTest"),
+                     GetSatTemperatureRefrig(SteamIndex, Psat, SteamHint, "UnitTest"));
+    EXPECT_DOUBLE_EQ(GetSatEnthalpyRefrig("STEAM", 120.0, 0.5, SteamIndex, "UnitTest"),
+                     GetSatEnthalpyRefrig(SteamIndex, 120.0, 0.5, SteamHint, "UnitTest"));
+    EXPECT_DOUBLE_EQ(GetSupHeatEnthalpyRefrig("STEAM", 150.0, 101325.0, SteamIndex, "UnitTest"),
+                     GetSupHeatEnthalpyRefrig(SteamIndex, 150.0, 101325.0, SteamHint, "UnitTest"));
+    // A nearby state reuses the intervals
+    int const LastSHTemp(SteamHint.SHTemp);
+    GetSupHeatEnthalpyRefrig(SteamIndex, 150.01, 101325.0, SteamHint, "UnitTest");
+    EXPECT_EQ(LastSHTemp, SteamHint.SHTemp);
+}
+
+TEST_F(EnergyPlusFixture, FluidProperties_GlycolBatchedProperties)
+{
+    std::string const idf_objects = delimited_string({"FluidProperties:GlycolConcentration,", "  GLHXFluid,       !- Name",
+                                                      "  PropyleneGlycol, !- Glycol Type", "  ,                !- User Defined Glycol Name",
+                                                      "  0.3;             !- Glycol Concentration", " "});
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    int FluidIndex = 0;
+    Array1D<Real64> const Temperatures(5, {-15.0, 5.0, 15.0, 20.0, 125.0});
+    Array1D<Real64> Densities;
+    Array1D<Real64> SpecificHeats;
+    GetDensityGlycol("GLHXFLUID", Temperatures, FluidIndex, "UnitTest", Densities);
+    GetSpecificHeatGlycol("GLHXFLUID", Temperatures, FluidIndex, "UnitTest", SpecificHeats);
+    ASSERT_EQ(5u, Densities.size());
+    ASSERT_EQ(5u, SpecificHeats.size());
+    EXPECT_FALSE(GlycolData(FluidIndex).RhoTempGrid.CellIndex.empty());
+
+    // Same values as the table values found by interval halving
+    EXPECT_NEAR(1037.89, Densities(1), 0.01);
+    EXPECT_NEAR(1034.46, Densities(2), 0.01);
+    EXPECT_NEAR(1030.51, Densities(3), 0.01);
+    EXPECT_NEAR(953.41, Densities(5), 0.01);
+    for (int i = 1; i <= 5; ++i) {
+        EXPECT_DOUBLE_EQ(GetDensityGlycol("GLHXFLUID", Temperatures(i), FluidIndex, "UnitTest"), Densities(i));
+        EXPECT_DOUBLE_EQ(GetSpecificHeatGlycol("GLHXFLUID", Temperatures(i), FluidIndex, "UnitTest"), SpecificHeats(i));
+    }
+}
+
+TEST_F(EnergyPlusFixture, FluidProperties_SupHeatTempRefrigTableInversion)
+{
+    int SteamIndex(0);
+    Real64 const Pressure(101325.0);
+    Real64 const Enthalpy(GetSupHeatEnthalpyRefrig("STEAM", 150.0, Pressure, SteamIndex, "UnitTest"));
+
+    // The iterated solution stops at the SolveRoot tolerance
+    Real64 const IteratedTemp(GetSupHeatTempRefrig("STEAM", Pressure, Enthalpy, 110.0, 200.0, SteamIndex, "UnitTest"));
+    EXPECT_NEAR(150.0, IteratedTemp, 0.5);
+
+    // The table inversion is the exact root of the interpolated table
+    Real64 Temp(0.0);
+    EXPECT_TRUE(InvertSupHeatEnthalpyRefrig(SteamIndex, Pressure, Enthalpy, 110.0, 200.0, Temp));
+    EXPECT_NEAR(150.0, Temp, 1.0e-6);
+    DataSystemVariables::RefrigerantTableInversion = true;
+    EXPECT_NEAR(150.0, GetSupHeatTempRefrig("STEAM", Pressure, Enthalpy, 110.0, 200.0, SteamIndex, "UnitTest"), 1.0e-6);
+
+    // Pressures outside the superheated table are left to the iteration
+    EXPECT_FALSE(InvertSupHeatEnthalpyRefrig(SteamIndex, 1.0e9, Enthalpy, 110.0, 200.0, Temp));
+}
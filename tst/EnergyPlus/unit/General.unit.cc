@@ -58,6 +58,7 @@
 #include <EnergyPlus/DataHVACGlobals.hh>
 #include <ObjexxFCL/string.functions.hh>
 #include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/gio.hh>
 
 namespace EnergyPlus {
 
@@ -317,6 +318,72 @@ TEST_F(EnergyPlusFixture, General_SolveRootTest)
 
 }
 
+TEST_F(EnergyPlusFixture, General_SolveRootInlinedResidualTest)
+{
+    using DataHVACGlobals::HVACSystemRootFinding;
+
+    Real64 const ErrorToler = 0.00001;
+    int SolFla;
+    Real64 Frac;
+    int LambdaSolFla;
+    Real64 LambdaFrac;
+
+    // Typed captured state replaces the Par array and gives the same iterations as the std::function overload
+    Real64 const Request(1.10);
+    auto Inlined = [Request](Real64 const X) { return (1.0 + 2.0 * X + 10.0 * X * X - Request) / Request; };
+    HVACSystemRootFinding.HVACSystemRootSolver = DataHVACGlobals::HVACSystemRootSolverAlgorithm::RegulaFalsiThenBisection;
+    HVACSystemRootFinding.NumOfIter = 10;
+    General::SolveRoot(ErrorToler, 30, SolFla, Frac, std::function<Real64(Real64 const)>(Residual), 0.0, 1.0);
+    General::SolveRoot(ErrorToler, 30, LambdaSolFla, LambdaFrac, Inlined, 0.0, 1.0);
+    EXPECT_EQ(28, LambdaSolFla);
+    EXPECT_EQ(SolFla, LambdaSolFla);
+    EXPECT_DOUBLE_EQ(Frac, LambdaFrac);
+
+    // Same-sign bounds
+    General::SolveRoot(ErrorToler, 30, LambdaSolFla, LambdaFrac, Inlined, 0.5, 1.0);
+    EXPECT_EQ(-2, LambdaSolFla);
+    EXPECT_DOUBLE_EQ(0.5, LambdaFrac);
+}
+
+TEST_F(EnergyPlusFixture, General_SolveRootWarmStartTest)
+{
+    Real64 const ErrorToler = 0.00001;
+    int const MaxIte = 30;
+    int SolFla;
+    Real64 Frac;
+    General::SolveRootContext Context;
+
+    // Cold start gives the same result as the call without a context
+    General::SolveRoot(ErrorToler, MaxIte, SolFla, Frac, Residual, 0.0, 1.0);
+    int const ColdSolFla(SolFla);
+    Real64 const ColdFrac(Frac);
+    General::SolveRoot(ErrorToler, MaxIte, SolFla, Frac, Residual, 0.0, 1.0, Context);
+    EXPECT_EQ(-1, ColdSolFla);
+    EXPECT_EQ(ColdSolFla, SolFla);
+    EXPECT_DOUBLE_EQ(ColdFrac, Frac);
+    EXPECT_FALSE(Context.Valid);
+
+    // Slowly drifting requests are solved from the previous root in a few residual calls
+    Real64 Request(1.5);
+    auto Drifting = [&Request](Real64 const X) { return (1.0 + 2.0 * X + 10.0 * X * X - Request) / Request; };
+    General::SolveRoot(ErrorToler, MaxIte, SolFla, Frac, Drifting, 0.0, 1.0, Context);
+    EXPECT_GT(SolFla, 0);
+    EXPECT_TRUE(Context.Valid);
+    EXPECT_DOUBLE_EQ(Frac, Context.XLast);
+    for (int Step = 1; Step <= 5; ++Step) {
+        Request += 0.01;
+        General::SolveRoot(ErrorToler, MaxIte, SolFla, Frac, Drifting, 0.0, 1.0, Context);
+        EXPECT_GT(SolFla, 0);
+        EXPECT_LE(SolFla, 5);
+        EXPECT_NEAR(0.0, Drifting(Frac), ErrorToler);
+    }
+
+    // A root far from the previous one falls back to the full interval
+    General::SolveRoot(ErrorToler, MaxIte, SolFla, Frac, [](Real64 const X) { return std::tanh(20.0 * (X - 0.1)); }, 0.0, 1.0, Context);
+    EXPECT_GT(SolFla, 0);
+    EXPECT_NEAR(0.1, Frac, 0.001);
+}
+
 TEST(General, nthDayOfWeekOfMonth_test)
 {
     // J.Glazer - August 2017
@@ -369,4 +436,47 @@ TEST(General, nthDayOfWeekOfMonth_test)
     EXPECT_EQ(62, nthDayOfWeekOfMonth(4, 1, 3)); // first wednesday of march
 }
 
+TEST_F(EnergyPlusFixture, General_SigDigitsMatchListDirectedOutput)
+{
+    EXPECT_EQ("123.45", TrimSigDigits(123.456, 2));
+    EXPECT_EQ("123.46", RoundSigDigits(123.456, 2));
+    EXPECT_EQ("100.0", RoundSigDigits(99.999, 1));
+    EXPECT_EQ("-10.00", RoundSigDigits(-9.9999, 2));
+    EXPECT_EQ("-45", TrimSigDigits(-45.0, 0));
+    EXPECT_EQ("0.000", TrimSigDigits(0.0, 3));
+    EXPECT_EQ("-1.235E-002", RoundSigDigits(-0.0123456, 3));
+    EXPECT_EQ("2.5000E-007", RoundSigDigits(2.5e-7, 4));
+    EXPECT_EQ("1.0E+020", TrimSigDigits(1.0e20, 1));
+
+    // with all 15 digits kept, the strings are the list-directed output, in both F and E editing
+    ObjexxFCL::gio::Fmt fmtLD("*");
+    for (Real64 Value : {1.0, -0.5, 0.1, 0.09999999999999999, 99999.99999999999, 1.0e-5, -1.23456789e-12, 9.99999999999999e16, 1.0e17, -3.5e25,
+                         1.0e300, 4.9e-324, -1.5131402663111935e-222}) {
+        std::string String;
+        ObjexxFCL::gio::write(String, fmtLD) << Value;
+        EXPECT_EQ(stripped(String), TrimSigDigits(Value, 15));
+    }
+}
+
+TEST_F(EnergyPlusFixture, General_POLYFTableTest)
+{
+    Array1D<Real64> Coef({1, 6}, {0.1, 2.2, -3.1, 1.4, 0.5, -0.3});
+    std::vector<Real64> Table;
+
+    // without a table the polynomial is evaluated directly
+    EXPECT_EQ(POLYF(0.37, Coef), POLYF(0.37, Coef, Table));
+
+    TabulatePOLYF(Coef({1, 6}), Table);
+    EXPECT_EQ(401u, Table.size());
+
+    // grid points are exact, points between them are close, and out of range cosines give zero
+    EXPECT_DOUBLE_EQ(POLYF(1.0, Coef), POLYF(1.0, Coef, Table));
+    EXPECT_DOUBLE_EQ(POLYF(0.5, Coef), POLYF(0.5, Coef, Table));
+    for (Real64 X = 0.0; X <= 1.0; X += 0.0137) {
+        EXPECT_NEAR(POLYF(X, Coef), POLYF(X, Coef, Table), 1.0e-4);
+    }
+    EXPECT_EQ(0.0, POLYF(-0.1, Coef, Table));
+    EXPECT_EQ(0.0, POLYF(1.1, Coef, Table));
+}
+
 } // namespace EnergyPlus
@@ -1235,6 +1235,21 @@ TEST_F(EnergyPlusFixture, GroundHeatExchangerTest_System_calcGFunction_Check)
     EXPECT_NEAR(thisGLHE.interpGFunc(-5.2), 4.37, tolerance);
     EXPECT_NEAR(thisGLHE.interpGFunc(-4.5), 5.11, tolerance);
     EXPECT_NEAR(thisGLHE.interpGFunc(-3.963), 5.82, tolerance);
+
+    // Identical boreholes: each distinct spacing is integrated once and weighted by its number of pairs,
+    // which must match integrating every ordered pair of boreholes
+    thisGLHE.calcLongTimestepGFunctions();
+    auto const &boreholes(thisGLHE.myRespFactors->myBorholes);
+    for (size_t lntts_index = 1; lntts_index <= thisGLHE.myRespFactors->LNTTS.size(); ++lntts_index) {
+        Real64 sum_T_ji = 0;
+        for (auto &bh_i : boreholes) {
+            for (auto &bh_j : boreholes) {
+                sum_T_ji += thisGLHE.doubleIntegral(bh_i, bh_j, thisGLHE.myRespFactors->time(lntts_index));
+            }
+        }
+        Real64 const allPairsGFNC = sum_T_ji / (2 * thisGLHE.totalTubeLength);
+        EXPECT_NEAR(allPairsGFNC, thisGLHE.myRespFactors->GFNC(lntts_index), 1.0e-9 * std::abs(allPairsGFNC));
+    }
 }
 
 TEST_F(EnergyPlusFixture, GroundHeatExchangerTest_System_calc_pipe_conduction_resistance)
@@ -3773,3 +3788,64 @@ TEST_F(EnergyPlusFixture, GroundHeatExchangerTest_System_calcBHTotalInternalResi
     EXPECT_NEAR(thisGLHE.sigma, (thisGLHE.grout.k - thisGLHE.soil.k) / (thisGLHE.grout.k + thisGLHE.soil.k), tolerance);
     EXPECT_NEAR(thisGLHE.calcBHTotalInternalResistance(), 0.31582, tolerance);
 }
+
+TEST_F(EnergyPlusFixture, GroundHeatExchangerTest_MultiLevelMonthlySuperposition)
+{
+    GLHESlinky thisGLHE;
+
+    std::shared_ptr<GLHEResponseFactorsStruct> thisRF(new GLHEResponseFactorsStruct);
+    thisGLHE.myRespFactors = thisRF;
+
+    int const NPairs = 6;
+    thisGLHE.myRespFactors->LNTTS.allocate(NPairs);
+    thisGLHE.myRespFactors->GFNC.allocate(NPairs);
+    thisGLHE.myRespFactors->LNTTS = {-2.0, -1.0, 0.0, 1.0, 2.0, 3.0};
+    thisGLHE.myRespFactors->GFNC = {1.0, 2.0, 3.5, 5.0, 6.2, 7.0};
+    thisGLHE.timeSSFactor = 8760.0;
+    Real64 const kGroundFactor = 2.0 * DataGlobals::Pi * 2.0;
+
+    int const maxMonths = 20 * 12;
+    thisGLHE.QnMonthlyAgg.dimension(maxMonths, 0.0);
+    for (int month = 1; month <= maxMonths; ++month) {
+        thisGLHE.QnMonthlyAgg(month) = 10.0 + 20.0 * std::sin(2.0 * DataGlobals::Pi * month / 12.0);
+    }
+
+    // month by month superposition of calcAggregateLoad without multi-level aggregation
+    auto fullSum = [&](int const currentMonth) {
+        Real64 sumQnMonthly = 0.0;
+        for (int I = 1; I <= currentMonth; ++I) {
+            if (I == 1) {
+                sumQnMonthly += thisGLHE.QnMonthlyAgg(I) * (thisGLHE.getGFunc(currentSimTime / (thisGLHE.timeSSFactor)) / (kGroundFactor));
+                continue;
+            }
+            Real64 const RQMonth = thisGLHE.getGFunc((currentSimTime - (I - 1) * hrsPerMonth) / (thisGLHE.timeSSFactor)) / (kGroundFactor);
+            sumQnMonthly += (thisGLHE.QnMonthlyAgg(I) - thisGLHE.QnMonthlyAgg(I - 1)) * RQMonth;
+        }
+        return sumQnMonthly;
+    };
+
+    // the first year is superposed month by month, identical to the full sum
+    for (int currentMonth = 1; currentMonth <= 12; ++currentMonth) {
+        currentSimTime = currentMonth * hrsPerMonth + 100.0;
+        EXPECT_EQ(fullSum(currentMonth), thisGLHE.calcMultiLevelMonthlySuperposition(currentMonth, kGroundFactor));
+    }
+
+    // older months are lumped into blocks, which stays within 0.01 C of the full sum over a 20 year history
+    for (int currentMonth : {24, 60, 120, 239}) {
+        currentSimTime = currentMonth * hrsPerMonth + 100.0;
+        EXPECT_NEAR(fullSum(currentMonth), thisGLHE.calcMultiLevelMonthlySuperposition(currentMonth, kGroundFactor), 0.01);
+    }
+
+    // after a reset the running sum is cleared and must be rebuilt from the current monthly loads
+    thisGLHE.QnMonthlyAgg = 0.0;
+    thisGLHE.QnMonthlyAggSum.clear();
+    for (int month = 1; month <= 36; ++month) {
+        thisGLHE.QnMonthlyAgg(month) = -5.0 + 15.0 * std::cos(2.0 * DataGlobals::Pi * month / 12.0);
+    }
+    currentSimTime = 36 * hrsPerMonth + 100.0;
+    Real64 const rebuiltSum = thisGLHE.calcMultiLevelMonthlySuperposition(36, kGroundFactor);
+    ASSERT_EQ(std::size_t(maxMonths + 1), thisGLHE.QnMonthlyAggSum.size());
+    EXPECT_EQ(0.0, thisGLHE.QnMonthlyAggSum[0]);
+    EXPECT_DOUBLE_EQ(thisGLHE.QnMonthlyAgg(1) + thisGLHE.QnMonthlyAgg(2), thisGLHE.QnMonthlyAggSum[2]);
+    EXPECT_NEAR(fullSum(36), rebuiltSum, 0.01);
+}
@@ -50,13 +50,20 @@
 // Google Test Headers
 #include <gtest/gtest.h>
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
 // EnergyPlus Headers
 #include <DataAirLoop.hh>
 #include <DataConvergParams.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHVACControllers.hh>
 #include <EnergyPlus/DataHVACGlobals.hh>
+#include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/HVACControllers.hh>
 #include <EnergyPlus/MixedAir.hh>
 #include <EnergyPlus/OutputReportPredefined.hh>
@@ -776,4 +783,108 @@ TEST_F(EnergyPlusFixture, HVACControllers_CheckTempAndHumRatCtrl)
     EXPECT_EQ(thisController.NumCalcCalls, 5);
 
 }
+TEST_F(EnergyPlusFixture, HVACControllers_WarmStartMatchesColdStart)
+{
+    // A reverse acting flow controller on a coil whose leaving temperature drops with the water flow:
+    // T = TIn - 20 m / (m + 0.5), so the flow meeting a 12 C setpoint is m = 0.5 (TIn - 12) / (32 - TIn)
+    int const sensedNode = 1;
+    int const actuatedNode = 2;
+    Real64 const setPoint = 12.0;
+    auto simulateCoil = [&](Real64 const inletTemp) {
+        Real64 const waterFlow = DataLoopNode::Node(actuatedNode).MassFlowRate;
+        DataLoopNode::Node(sensedNode).Temp = inletTemp - 20.0 * waterFlow / (waterFlow + 0.5);
+    };
+
+    auto setUpController = [&]() {
+        HVACControllers::clear_state();
+        GetControllerInputFlag = false;
+        NumControllers = 1;
+        ControllerProps.allocate(1);
+        RootFinders.allocate(1);
+        HVACControllers::CheckEquipName.dimension(1, false);
+        auto &controller(ControllerProps(1));
+        controller.ControllerName = "CW COIL CONTROLLER";
+        controller.ControllerType = "Controller:WaterCoil";
+        controller.ControlVar = iTemperature;
+        controller.ActuatorVar = iFlow;
+        controller.Action = DataHVACControllers::iReverseAction;
+        controller.SensedNode = sensedNode;
+        controller.ActuatedNode = actuatedNode;
+        controller.Offset = 1.0e-4;
+        controller.MinVolFlowActuated = 0.0;
+        controller.MaxVolFlowActuated = 0.002;
+        controller.MinActuated = 0.0;
+        controller.MaxActuated = 2.0;
+
+        DataLoopNode::Node.allocate(2);
+        DataLoopNode::Node(sensedNode).MassFlowRate = 1.0;
+        DataLoopNode::Node(sensedNode).TempSetPoint = setPoint;
+        DataLoopNode::Node(actuatedNode).MassFlowRateMinAvail = 0.0;
+        DataLoopNode::Node(actuatedNode).MassFlowRateMaxAvail = 2.0;
+    };
+
+    DataGlobals::BeginEnvrnFlag = false;
+    DataHVACGlobals::DoSetPointTest = false;
+
+    std::vector<Real64> const inletTemps = {24.0, 24.5, 25.2, 25.0, 26.1, 26.5};
+    int const airLoopNum = 1;
+
+    // solves one HVAC step the way SolveAirLoopControllers does and returns the converged water flow
+    int newtonSteps = 0;
+    auto solveStep = [&](Real64 const inletTemp) {
+        int controllerIndex = 0;
+        bool isConverged = false;
+        bool isUpToDate = false;
+        bool bypassOAController = false;
+        auto const previousSolution = ControllerProps(1).SolutionTrackers(2);
+
+        ManageControllers("CW COIL CONTROLLER", controllerIndex, false, airLoopNum, DataHVACControllers::iControllerOpColdStart, isConverged,
+                          isUpToDate, bypassOAController);
+        simulateCoil(inletTemp);
+        isUpToDate = true;
+        for (int iter = 1; iter <= 50 && !isConverged; ++iter) {
+            ManageControllers("CW COIL CONTROLLER", controllerIndex, false, airLoopNum, DataHVACControllers::iControllerOpIterate, isConverged,
+                              isUpToDate, bypassOAController);
+            if (isConverged) break;
+            auto const &controller(ControllerProps(1));
+            if (previousSolution.DefinedFlag && controller.ActuatedValue == previousSolution.ActuatedValue &&
+                controller.NextActuatedValue ==
+                    controller.ActuatedValue - controller.DeltaSensed / previousSolution.Sensitivity) {
+                ++newtonSteps;
+            }
+            simulateCoil(inletTemp);
+            isUpToDate = true;
+        }
+        EXPECT_TRUE(isConverged);
+        simulateCoil(inletTemp);
+        ManageControllers("CW COIL CONTROLLER", controllerIndex, false, airLoopNum, DataHVACControllers::iControllerOpEnd, isConverged, isUpToDate,
+                          bypassOAController);
+        EXPECT_TRUE(isConverged);
+        return DataLoopNode::Node(actuatedNode).MassFlowRate;
+    };
+
+    DataSystemVariables::ControllerWarmStart = false;
+    setUpController();
+    std::vector<Real64> coldFlows;
+    for (Real64 const inletTemp : inletTemps) {
+        coldFlows.push_back(solveStep(inletTemp));
+    }
+    EXPECT_EQ(0, newtonSteps);
+
+    DataSystemVariables::ControllerWarmStart = true;
+    setUpController();
+    std::vector<Real64> warmFlows;
+    for (Real64 const inletTemp : inletTemps) {
+        warmFlows.push_back(solveStep(inletTemp));
+    }
+    // steps after the first start from the solution of the step before
+    EXPECT_GT(newtonSteps, 0);
+
+    for (std::size_t step = 0; step < inletTemps.size(); ++step) {
+        Real64 const exactFlow = 0.5 * (inletTemps[step] - setPoint) / (32.0 - inletTemps[step]);
+        EXPECT_NEAR(exactFlow, coldFlows[step], 1.0e-4);
+        EXPECT_NEAR(coldFlows[step], warmFlows[step], 1.0e-4);
+    }
+}
+
 } // namespace EnergyPlus
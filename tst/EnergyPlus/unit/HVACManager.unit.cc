@@ -48,6 +48,7 @@
 // EnergyPlus::Standalone ERV Unit Tests
 
 #include <fstream>
+#include <sstream>
 
 // Google Test Headers
 #include <gtest/gtest.h>
@@ -55,6 +56,7 @@
 // EnergyPlus Headers
 #include <DataAirLoop.hh>
 #include <DataAirSystems.hh>
+#include <DataConvergParams.hh>
 #include <DataEnvironment.hh>
 #include <DataGlobals.hh>
 #include <DataHVACGlobals.hh>
@@ -332,3 +334,46 @@ TEST_F(EnergyPlusFixture, AirloopFlowBalanceTest)
     EXPECT_TRUE(compare_err_stream(error_string, true));
 
 }
+
+TEST_F(EnergyPlusFixture, HVACManager_WriteHVACIterations)
+{
+    DataAirLoop::AirToZoneNodeInfo.allocate(1);
+    DataAirLoop::AirToZoneNodeInfo(1).AirLoopName = "VAV SYS 1";
+    DataConvergParams::AirLoopConvergence.allocate(1);
+
+    HVACManageIteration = 1;
+    RecordHVACIteration(0.001, false, false, false, false, false);
+    RecordHVACIteration(0.003, false, false, false, false, false);
+    HVACManageIteration = 3;
+    RecordHVACIteration(0.004, false, false, false, false, false);
+
+    // time steps that stopped at the iteration limit
+    HVACManageIteration = DataConvergParams::MaxIter + 1;
+    DataConvergParams::AirLoopConvergence(1).HVACTempNotConverged(2) = true;
+    RecordHVACIteration(0.01, true, true, false, false, false);
+    DataConvergParams::AirLoopConvergence(1).HVACTempNotConverged(2) = false;
+    RecordHVACIteration(0.01, false, true, false, false, false);
+
+    std::ostringstream Iterations;
+    WriteHVACIterations(Iterations);
+
+    std::istringstream Lines(Iterations.str());
+    std::string Line;
+    std::getline(Lines, Line);
+    EXPECT_EQ("HVAC Iterations,System Time Steps,Total Time {s},Average Time {us}", Line);
+    std::getline(Lines, Line);
+    EXPECT_EQ("1,2,0.004,2000", Line);
+    std::getline(Lines, Line);
+    EXPECT_EQ("3,1,0.004,4000", Line);
+    std::getline(Lines, Line);
+    EXPECT_EQ("21,2,0.02,10000", Line);
+    std::getline(Lines, Line);
+    EXPECT_EQ("", Line);
+    std::getline(Lines, Line);
+    EXPECT_EQ("Not Converged Subsystem,System Time Steps", Line);
+    // most frequent first
+    std::getline(Lines, Line);
+    EXPECT_EQ("Zone Equipment,2", Line);
+    std::getline(Lines, Line);
+    EXPECT_EQ("Air Loop VAV SYS 1,1", Line);
+}
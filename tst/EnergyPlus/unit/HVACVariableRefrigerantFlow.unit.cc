@@ -2588,6 +2588,30 @@ TEST_F(EnergyPlusFixture, VRF_FluidTCtrl_CalcVRFIUTeTc)
     TerminalUnitList.deallocate();
 }
 
+TEST_F(EnergyPlusFixture, VRF_FluidTCtrl_GetRefrigerantIndex)
+{
+    //   PURPOSE OF THIS TEST:
+    //   The outdoor unit looks its refrigerant up on first use and keeps the index for the refrigerant side loops.
+
+    VRF.allocate(1);
+    VRF(1).RefrigerantName = "steam";
+    EXPECT_EQ(0, VRF(1).RefIndex);
+
+    // first call gives the same index as the name lookup it replaces
+    int const RefrigerantIndex = FluidProperties::FindRefrigerant(VRF(1).RefrigerantName);
+    ASSERT_GT(RefrigerantIndex, 0);
+    EXPECT_EQ(RefrigerantIndex, VRF(1).GetRefrigerantIndex());
+    EXPECT_EQ(RefrigerantIndex, VRF(1).RefIndex);
+
+    // later calls return the stored index without searching the refrigerant list again
+    FluidProperties::RefrigData(RefrigerantIndex).Name = "NOT STEAM";
+    EXPECT_EQ(0, FluidProperties::FindRefrigerant(VRF(1).RefrigerantName));
+    EXPECT_EQ(RefrigerantIndex, VRF(1).GetRefrigerantIndex());
+
+    // Clean up
+    VRF.deallocate();
+}
+
 //*****************VRF-SysCurve Model
 TEST_F(EnergyPlusFixture, VRFTest_SysCurve)
 {
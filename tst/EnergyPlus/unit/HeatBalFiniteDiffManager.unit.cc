@@ -52,10 +52,19 @@
 
 // EnergyPlus Headers
 #include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/DataEnvironment.hh>
 #include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalFanSys.hh>
 #include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataMoistureBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/HeatBalFiniteDiffManager.hh>
+#include <EnergyPlus/HeatBalanceManager.hh>
+#include <EnergyPlus/HeatBalanceSurfaceManager.hh>
 #include <EnergyPlus/PhaseChangeModeling/HysteresisModel.hh>
+#include <EnergyPlus/SurfaceGeometry.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
 
 using namespace EnergyPlus::HeatBalFiniteDiffManager;
 
@@ -231,4 +240,224 @@ TEST_F(EnergyPlusFixture, HeatBalFiniteDiffManager_adjustPropertiesForPhaseChang
     SurfaceFD.deallocate();
 }
 
+TEST_F(EnergyPlusFixture, HeatBalFiniteDiffManager_terpldGridLookup)
+{
+    // temperature-enthalpy pairs with uneven segments, as entered for a PCM
+    Array2D<Real64> tempEnth(2, 6);
+    tempEnth(1, 1) = -20.0;
+    tempEnth(1, 2) = 21.0;
+    tempEnth(1, 3) = 21.7;
+    tempEnth(1, 4) = 22.3;
+    tempEnth(1, 5) = 25.0;
+    tempEnth(1, 6) = 60.0;
+    tempEnth(2, 1) = 33400.0;
+    tempEnth(2, 2) = 70000.0;
+    tempEnth(2, 3) = 137000.0;
+    tempEnth(2, 4) = 173000.0;
+    tempEnth(2, 5) = 180000.0;
+    tempEnth(2, 6) = 226000.0;
+
+    InterpolationGrid grid;
+    setupInterpolationGrid(tempEnth, grid);
+    EXPECT_FALSE(grid.firstPoint.empty());
+
+    // the grid lookup matches the searched interpolation everywhere, including at and beyond the table points
+    for (Real64 T = -30.0; T <= 70.0; T += 0.01) {
+        EXPECT_DOUBLE_EQ(terpld(tempEnth, T, 1, 2), terpld(tempEnth, grid, T));
+    }
+    for (int i = 1; i <= 6; ++i) {
+        EXPECT_DOUBLE_EQ(tempEnth(2, i), terpld(tempEnth, grid, tempEnth(1, i)));
+    }
+
+    // the unused default tables do not get a grid and fall back to the search
+    Array2D<Real64> defaultTable(2, 3, -100.0);
+    InterpolationGrid defaultGrid;
+    setupInterpolationGrid(defaultTable, defaultGrid);
+    EXPECT_TRUE(defaultGrid.firstPoint.empty());
+    EXPECT_DOUBLE_EQ(terpld(defaultTable, 20.0, 1, 2), terpld(defaultTable, defaultGrid, 20.0));
+}
+
+TEST_F(EnergyPlusFixture, HeatBalFiniteDiffManager_DirectSolveMatchesGaussSeidel)
+{
+    std::string const idf_objects = delimited_string({
+        "  Version,9.2;",
+
+        "  Building,",
+        "    CondFD Wall,             !- Name",
+        "    0,                       !- North Axis {deg}",
+        "    Suburbs,                 !- Terrain",
+        "    0.001,                   !- Loads Convergence Tolerance Value",
+        "    0.0050000,               !- Temperature Convergence Tolerance Value {deltaC}",
+        "    FullInteriorAndExterior, !- Solar Distribution",
+        "    25,                      !- Maximum Number of Warmup Days",
+        "    6;                       !- Minimum Number of Warmup Days",
+
+        "  HeatBalanceAlgorithm,ConductionFiniteDifference;",
+
+        "  Material,",
+        "    A1 - 1 IN STUCCO,        !- Name",
+        "    Smooth,                  !- Roughness",
+        "    2.5389841E-02,           !- Thickness {m}",
+        "    0.6918309,               !- Conductivity {W/m-K}",
+        "    1858.142,                !- Density {kg/m3}",
+        "    836.8000,                !- Specific Heat {J/kg-K}",
+        "    0.9000000,               !- Thermal Absorptance",
+        "    0.9200000,               !- Solar Absorptance",
+        "    0.9200000;               !- Visible Absorptance",
+
+        "  Material,",
+        "    CB11,                    !- Name",
+        "    MediumRough,             !- Roughness",
+        "    0.2032000,               !- Thickness {m}",
+        "    1.048000,                !- Conductivity {W/m-K}",
+        "    1105.000,                !- Density {kg/m3}",
+        "    837.0000,                !- Specific Heat {J/kg-K}",
+        "    0.9000000,               !- Thermal Absorptance",
+        "    0.2000000,               !- Solar Absorptance",
+        "    0.2000000;               !- Visible Absorptance",
+
+        "  Material,",
+        "    IN02,                    !- Name",
+        "    Rough,                   !- Roughness",
+        "    9.0099998E-02,           !- Thickness {m}",
+        "    4.3000001E-02,           !- Conductivity {W/m-K}",
+        "    10.00000,                !- Density {kg/m3}",
+        "    837.0000,                !- Specific Heat {J/kg-K}",
+        "    0.9000000,               !- Thermal Absorptance",
+        "    0.7500000,               !- Solar Absorptance",
+        "    0.7500000;               !- Visible Absorptance",
+
+        "  Material,",
+        "    GP01,                    !- Name",
+        "    MediumSmooth,            !- Roughness",
+        "    1.2700000E-02,           !- Thickness {m}",
+        "    0.1600000,               !- Conductivity {W/m-K}",
+        "    801.0000,                !- Density {kg/m3}",
+        "    837.0000,                !- Specific Heat {J/kg-K}",
+        "    0.9000000,               !- Thermal Absorptance",
+        "    0.7500000,               !- Solar Absorptance",
+        "    0.7500000;               !- Visible Absorptance",
+
+        "  Construction,",
+        "    EXTWALL,                 !- Name",
+        "    A1 - 1 IN STUCCO,        !- Outside Layer",
+        "    CB11,                    !- Layer 2",
+        "    IN02,                    !- Layer 3",
+        "    GP01;                    !- Layer 4",
+
+        "  Zone,",
+        "    ZONE ONE,                !- Name",
+        "    0,                       !- Direction of Relative North {deg}",
+        "    0,                       !- X Origin {m}",
+        "    0,                       !- Y Origin {m}",
+        "    0,                       !- Z Origin {m}",
+        "    1,                       !- Type",
+        "    1,                       !- Multiplier",
+        "    autocalculate,           !- Ceiling Height {m}",
+        "    autocalculate;           !- Volume {m3}",
+
+        "  GlobalGeometryRules,",
+        "    UpperLeftCorner,         !- Starting Vertex Position",
+        "    CounterClockWise,        !- Vertex Entry Direction",
+        "    World;                   !- Coordinate System",
+
+        "  BuildingSurface:Detailed,",
+        "    Wall,                    !- Name",
+        "    Wall,                    !- Surface Type",
+        "    EXTWALL,                 !- Construction Name",
+        "    ZONE ONE,                !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0.5000000,               !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    0,0,3,  !- X,Y,Z ==> Vertex 1 {m}",
+        "    0,0,0,  !- X,Y,Z ==> Vertex 2 {m}",
+        "    4,0,0,  !- X,Y,Z ==> Vertex 3 {m}",
+        "    4,0,3;  !- X,Y,Z ==> Vertex 4 {m}",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+    bool ErrorsFound = false;
+
+    HeatBalanceManager::GetProjectControlData(ErrorsFound);
+    EXPECT_FALSE(ErrorsFound);
+    HeatBalanceManager::GetZoneData(ErrorsFound);
+    EXPECT_FALSE(ErrorsFound);
+    HeatBalanceManager::GetMaterialData(ErrorsFound);
+    EXPECT_FALSE(ErrorsFound);
+    HeatBalanceManager::GetConstructData(ErrorsFound);
+    EXPECT_FALSE(ErrorsFound);
+    SurfaceGeometry::GetGeometryParameters(ErrorsFound);
+    EXPECT_FALSE(ErrorsFound);
+
+    SurfaceGeometry::CosBldgRotAppGonly = 1.0;
+    SurfaceGeometry::SinBldgRotAppGonly = 0.0;
+    SurfaceGeometry::GetSurfaceData(ErrorsFound);
+    EXPECT_FALSE(ErrorsFound);
+
+    int const SurfNum(UtilityRoutines::FindItemInList("WALL", DataSurfaces::Surface));
+    ASSERT_GT(SurfNum, 0);
+    EXPECT_EQ(DataSurfaces::HeatTransferModel_CondFD, DataSurfaces::Surface(SurfNum).HeatTransferAlgorithm);
+
+    DataGlobals::NumOfTimeStepInHour = 6;
+    DataGlobals::TimeStepZoneSec = 600.0;
+    DataHeatBalFanSys::MAT.allocate(1);
+    DataHeatBalFanSys::MAT(1) = 21.0;
+    DataHeatBalFanSys::ZoneAirHumRat.allocate(1);
+    DataHeatBalFanSys::ZoneAirHumRat(1) = 0.008;
+    DataEnvironment::SkyTemp = -20.0;
+    DataEnvironment::IsRain = false;
+    HeatBalanceSurfaceManager::AllocateSurfaceHeatBalArrays();
+
+    GetCondFDInput();
+    GetHBFiniteDiffInputFlag = false;
+    int const TotNodes(ConstructFD(DataSurfaces::Surface(SurfNum).Construction).TotNodes);
+    EXPECT_GT(TotNodes, 10);
+
+    // the wall starts at the uniform initial temperature and is cooled from outside and heated by sun and radiation
+    DataMoistureBalance::HConvExtFD(SurfNum) = 15.0;
+    DataMoistureBalance::HAirFD(SurfNum) = 2.0;
+    DataMoistureBalance::HSkyFD(SurfNum) = 2.5;
+    DataMoistureBalance::HConvInFD(SurfNum) = 2.5;
+    DataHeatBalSurface::QRadSWOutAbs(SurfNum) = 150.0;
+    DataHeatBalSurface::NetLWRadToSurf(SurfNum) = 10.0;
+    auto const surfaceFDStart(SurfaceFD(SurfNum));
+
+    // Gauss-Seidel over a few time steps, with the outdoor temperature changing between them
+    int const numSteps(4);
+    Array2D<Real64> TDTGaussSeidel(numSteps, TotNodes + 1);
+    Array1D<Real64> TempSurfInGaussSeidel(numSteps);
+    Array1D<Real64> TempSurfOutGaussSeidel(numSteps);
+    DataSystemVariables::CondFDDirectSolve = false;
+    for (int step = 1; step <= numSteps; ++step) {
+        DataMoistureBalance::TempOutsideAirFD(SurfNum) = -10.0 + 5.0 * step;
+        CalcHeatBalFiniteDiff(SurfNum, TempSurfInGaussSeidel(step), TempSurfOutGaussSeidel(step));
+        EXPECT_GT(SurfaceFD(SurfNum).GSloopCounter, 1);
+        for (int node = 1; node <= TotNodes + 1; ++node) {
+            TDTGaussSeidel(step, node) = SurfaceFD(SurfNum).TDT(node);
+        }
+    }
+    // the conditions produce a real temperature profile through the wall
+    EXPECT_GT(TempSurfInGaussSeidel(numSteps) - TempSurfOutGaussSeidel(numSteps), 1.0);
+
+    // the direct solve is confirmed by its single sweep and reproduces the iterated node temperatures
+    SurfaceFD(SurfNum) = surfaceFDStart;
+    DataSystemVariables::CondFDDirectSolve = true;
+    EXPECT_TRUE(hasLinearNodeEquations(SurfNum));
+    for (int step = 1; step <= numSteps; ++step) {
+        DataMoistureBalance::TempOutsideAirFD(SurfNum) = -10.0 + 5.0 * step;
+        Real64 TempSurfIn(0.0);
+        Real64 TempSurfOut(0.0);
+        CalcHeatBalFiniteDiff(SurfNum, TempSurfIn, TempSurfOut);
+        EXPECT_EQ(1, SurfaceFD(SurfNum).GSloopCounter);
+        EXPECT_NEAR(TempSurfInGaussSeidel(step), TempSurfIn, 0.001);
+        EXPECT_NEAR(TempSurfOutGaussSeidel(step), TempSurfOut, 0.001);
+        for (int node = 1; node <= TotNodes + 1; ++node) {
+            EXPECT_NEAR(TDTGaussSeidel(step, node), SurfaceFD(SurfNum).TDT(node), 0.001) << "step " << step << " node " << node;
+        }
+    }
+}
+
 } // namespace EnergyPlus
@@ -56,6 +56,8 @@
 #include <EnergyPlus/DataHeatBalSurface.hh>
 #include <EnergyPlus/DataHeatBalance.hh>
 #include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/DataViewFactorInformation.hh>
 #include <EnergyPlus/HeatBalanceIntRadExchange.hh>
 
 using namespace EnergyPlus::HeatBalanceIntRadExchange;
@@ -216,4 +218,59 @@ TEST_F(EnergyPlusFixture, HeatBalanceIntRadExchange_UpdateMovableInsulationFlagT
     EXPECT_TRUE(!DidMIChange);
 }
 
+TEST_F(EnergyPlusFixture, HeatBalanceIntRadExchange_CalcInteriorRadExchangeThreadedTest)
+{
+    // Two zones of three walls each; the threaded zone and surface paths must reproduce the serial results exactly
+    DataGlobals::NumOfZones = 2;
+    DataGlobals::BeginEnvrnFlag = true;
+    DataSurfaces::TotSurfaces = 6;
+    DataHeatBalance::Zone.allocate(2);
+    DataHeatBalance::Construct.allocate(1);
+    DataSurfaces::Surface.allocate(6);
+    DataSurfaces::SurfaceWindow.allocate(6);
+    DataHeatBalance::Construct(1).InsideAbsorpThermal = 0.9;
+
+    for (int ZoneNum = 1; ZoneNum <= 2; ++ZoneNum) {
+        DataHeatBalance::Zone(ZoneNum).Name = "ZONE " + std::to_string(ZoneNum);
+        DataHeatBalance::Zone(ZoneNum).SurfaceFirst = 3 * ZoneNum - 2;
+        DataHeatBalance::Zone(ZoneNum).SurfaceLast = 3 * ZoneNum;
+    }
+    for (int SurfNum = 1; SurfNum <= 6; ++SurfNum) {
+        DataSurfaces::Surface(SurfNum).Name = "WALL " + std::to_string(SurfNum);
+        DataSurfaces::Surface(SurfNum).Class = DataSurfaces::SurfaceClass_Wall;
+        DataSurfaces::Surface(SurfNum).HeatTransSurf = true;
+        DataSurfaces::Surface(SurfNum).Construction = 1;
+        DataSurfaces::Surface(SurfNum).Area = 10.0 + SurfNum;
+        DataSurfaces::Surface(SurfNum).Azimuth = 90.0 * ((SurfNum - 1) % 3);
+        DataSurfaces::Surface(SurfNum).Tilt = 90.0;
+    }
+
+    Array1D<Real64> SurfaceTemp(6);
+    for (int SurfNum = 1; SurfNum <= 6; ++SurfNum) {
+        SurfaceTemp(SurfNum) = 15.0 + 2.5 * SurfNum;
+    }
+
+    Array1D<Real64> SerialNetLWRad(6, 0.0);
+    DataSystemVariables::NumberIntRadThreads = 1;
+    HeatBalanceIntRadExchange::CalcInteriorRadExchange(SurfaceTemp, 0, SerialNetLWRad);
+    EXPECT_EQ(3, DataViewFactorInformation::ZoneInfo(1).SurfaceTempInKTo4th.isize());
+    EXPECT_GT(SerialNetLWRad(1), 0.0);
+    EXPECT_LT(SerialNetLWRad(3), 0.0);
+
+    Array1D<Real64> ThreadedNetLWRad(6, 0.0);
+    DataSystemVariables::NumberIntRadThreads = 2;
+    HeatBalanceIntRadExchange::CalcInteriorRadExchange(SurfaceTemp, 0, ThreadedNetLWRad);
+    for (int SurfNum = 1; SurfNum <= 6; ++SurfNum) {
+        EXPECT_DOUBLE_EQ(SerialNetLWRad(SurfNum), ThreadedNetLWRad(SurfNum));
+    }
+
+    // A single resimulated zone is split over its receiving surfaces instead
+    Array1D<Real64> ZoneNetLWRad(6, 0.0);
+    HeatBalanceIntRadExchange::CalcInteriorRadExchange(SurfaceTemp, 0, ZoneNetLWRad, 2);
+    for (int SurfNum = 4; SurfNum <= 6; ++SurfNum) {
+        EXPECT_DOUBLE_EQ(SerialNetLWRad(SurfNum), ZoneNetLWRad(SurfNum));
+    }
+    DataSystemVariables::NumberIntRadThreads = 1;
+}
+
 } // namespace EnergyPlus
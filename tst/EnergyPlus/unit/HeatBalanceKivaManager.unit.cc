@@ -0,0 +1,237 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::HeatBalanceKivaManager Unit Tests
+
+// C++ Headers
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataStringGlobals.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/HeatBalanceKivaManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HeatBalanceKivaManager;
+
+namespace {
+
+// A year of hourly weather with a seasonal and a daily swing
+void setKivaWeather(KivaManager &km)
+{
+    km.kivaWeather.intervalsPerHour = 1;
+    km.kivaWeather.annualAverageDrybulbTemp = 10.0;
+    for (int hour = 0; hour < 8760; ++hour) {
+        Real64 const day = hour / 24.0;
+        km.kivaWeather.dryBulb.push_back(10.0 - 12.0 * std::cos(2.0 * DataGlobals::Pi * (day - 15.0) / 365.0) +
+                                         4.0 * std::sin(2.0 * DataGlobals::Pi * (hour % 24) / 24.0));
+        km.kivaWeather.windSpeed.push_back(3.0 + (hour % 7) * 0.5);
+        km.kivaWeather.skyEmissivity.push_back(0.8);
+    }
+}
+
+// Slab on grade under floor surface floorSurface with a rectangular floor of the given size and origin
+void addSlabInstance(KivaManager &km, int const floorSurface, Real64 const x0, Real64 const y0, Real64 const length, Real64 const width)
+{
+    Kiva::Foundation fnd = km.defaultFoundation.foundation;
+
+    Kiva::Layer slab;
+    slab.thickness = 0.1;
+    slab.material = Kiva::Material(1.95, 2400.0, 900.0);
+    fnd.slab.layers.push_back(slab);
+    fnd.slab.interior.emissivity = 0.9;
+    fnd.slab.interior.absorptivity = 0.9;
+    fnd.foundationDepth = 0.0;
+
+    // Floor vertices seen from above are clockwise
+    fnd.polygon.outer().push_back(Kiva::Point(x0 + length, y0));
+    fnd.polygon.outer().push_back(Kiva::Point(x0, y0));
+    fnd.polygon.outer().push_back(Kiva::Point(x0, y0 + width));
+    fnd.polygon.outer().push_back(Kiva::Point(x0 + length, y0 + width));
+    fnd.isExposedPerimeter.assign(4, true);
+
+    km.surfaceConvMap[floorSurface].in = [](double, double, double, double, double) -> double { return 3.0; };
+    km.surfaceConvMap[floorSurface].out = [](double, double, double hfTerm, double, double) -> double { return 2.0 + hfTerm; };
+    km.surfaceConvMap[floorSurface].f = [](double, double, double, double windSpeed) -> double { return windSpeed; };
+
+    km.kivaInstances.emplace_back(fnd, floorSurface, std::vector<int>(), 1, 1.0, 0, &km);
+}
+
+void setupKivaManager(KivaManager &km, int const numFloors)
+{
+    DataGlobals::NumOfTimeStepInHour = 1;
+    DataEnvironment::DayOfYear = 45;
+
+    DataSurfaces::Surface.allocate(numFloors);
+    for (int surfNum = 1; surfNum <= numFloors; ++surfNum) {
+        DataSurfaces::Surface(surfNum).Name = "FLOOR " + std::to_string(surfNum);
+        DataSurfaces::Surface(surfNum).Construction = 1;
+        DataSurfaces::Surface(surfNum).OSCPtr = 0;
+    }
+
+    // Small, coarse domain to keep the solves quick
+    km.settings.deepGroundBoundary = KivaManager::Settings::ZERO_FLUX;
+    km.settings.deepGroundDepth = 10.0;
+    km.settings.farFieldWidth = 10.0;
+    km.settings.minCellDim = 0.1;
+    km.defineDefaultFoundation();
+    setKivaWeather(km);
+    km.kivaInstances.reserve(numFloors);
+}
+
+} // namespace
+
+TEST_F(EnergyPlusFixture, HeatBalanceKiva_CopyInitialGround)
+{
+    KivaManager km;
+    setupKivaManager(km, 4);
+    addSlabInstance(km, 1, 0.0, 0.0, 10.0, 8.0);
+    addSlabInstance(km, 2, 25.0, -5.0, 10.0, 8.0); // same floor, moved
+    addSlabInstance(km, 3, 50.0, 0.0, 10.0, 8.0);
+    addSlabInstance(km, 4, 0.0, 30.0, 12.0, 8.0); // larger floor
+
+    auto &source = km.kivaInstances[0];
+    auto &copy = km.kivaInstances[1];
+    auto &solved = km.kivaInstances[2];
+    auto &larger = km.kivaInstances[3];
+
+    source.initGround(km.kivaWeather);
+    EXPECT_TRUE(copy.hasSameInitialGround(source, km.kivaWeather));
+    EXPECT_FALSE(larger.hasSameInitialGround(source, km.kivaWeather));
+
+    // The copied initialization is exactly what the instance would have calculated itself
+    copy.copyInitialGround(source);
+    solved.initGround(km.kivaWeather);
+    EXPECT_EQ(solved.instance.ground->TNew, copy.instance.ground->TNew);
+    EXPECT_EQ(solved.instance.ground->TOld, copy.instance.ground->TOld);
+    EXPECT_EQ(solved.instance.ground->groundOutput.outputValues, copy.instance.ground->groundOutput.outputValues);
+    EXPECT_EQ(Kiva::Foundation::NS_ADI, copy.instance.foundation->numericalScheme);
+
+    // and carries on the same from there (cells read the copied temperatures, not the source's)
+    copy.instance.calculate(km.timestep);
+    copy.instance.calculate_surface_averages();
+    solved.instance.calculate(km.timestep);
+    solved.instance.calculate_surface_averages();
+    EXPECT_EQ(solved.instance.ground->TNew, copy.instance.ground->TNew);
+    EXPECT_EQ(solved.instance.ground->groundOutput.outputValues, copy.instance.ground->groundOutput.outputValues);
+    EXPECT_NE(source.instance.ground->TNew, copy.instance.ground->TNew);
+}
+
+TEST_F(EnergyPlusFixture, HeatBalanceKiva_GroundCache)
+{
+    KivaManager km;
+    setupKivaManager(km, 4);
+    addSlabInstance(km, 1, 0.0, 0.0, 10.0, 8.0);
+    addSlabInstance(km, 2, 25.0, -5.0, 10.0, 8.0); // same floor, moved
+    addSlabInstance(km, 3, 50.0, 0.0, 10.0, 8.0);
+    addSlabInstance(km, 4, 0.0, 30.0, 12.0, 8.0); // larger floor
+
+    auto &cached = km.kivaInstances[0];
+    auto &restored = km.kivaInstances[1];
+    auto &solved = km.kivaInstances[2];
+    auto &larger = km.kivaInstances[3];
+
+    // Keys follow the domain and the initial boundary conditions
+    std::string const key = cached.initialGroundKey(km.kivaWeather);
+    EXPECT_EQ(key, restored.initialGroundKey(km.kivaWeather));
+    EXPECT_NE(key, larger.initialGroundKey(km.kivaWeather));
+    KivaWeatherData warmer = km.kivaWeather;
+    warmer.annualAverageDrybulbTemp += 1.0;
+    EXPECT_NE(key, cached.initialGroundKey(warmer));
+    DataEnvironment::DayOfYear = 46;
+    EXPECT_NE(key, cached.initialGroundKey(km.kivaWeather));
+    DataEnvironment::DayOfYear = 45;
+
+    // A state stored in the cache file restores exactly what the instance would have calculated itself
+    cached.initGround(km.kivaWeather);
+    std::string const fileName("HeatBalanceKiva_GroundCache.kiva");
+    std::string const outputKivaFileName = DataStringGlobals::outputKivaFileName;
+    DataStringGlobals::outputKivaFileName = fileName;
+    nlohmann::json groundCache;
+    groundCache[key] = cached.initialGroundState();
+    km.writeGroundCache(groundCache);
+    nlohmann::json const readCache = km.readGroundCache();
+    ASSERT_EQ(1u, readCache.count(key));
+
+    EXPECT_FALSE(larger.restoreInitialGround(readCache.at(key), km.kivaWeather));
+    ASSERT_TRUE(restored.restoreInitialGround(readCache.at(key), km.kivaWeather));
+    solved.initGround(km.kivaWeather);
+    EXPECT_EQ(solved.instance.ground->TNew, restored.instance.ground->TNew);
+    EXPECT_EQ(solved.instance.ground->TOld, restored.instance.ground->TOld);
+    EXPECT_EQ(solved.instance.ground->groundOutput.outputValues, restored.instance.ground->groundOutput.outputValues);
+    EXPECT_EQ(Kiva::Foundation::NS_ADI, restored.instance.foundation->numericalScheme);
+
+    restored.instance.calculate(km.timestep);
+    restored.instance.calculate_surface_averages();
+    solved.instance.calculate(km.timestep);
+    solved.instance.calculate_surface_averages();
+    EXPECT_EQ(solved.instance.ground->TNew, restored.instance.ground->TNew);
+    EXPECT_EQ(solved.instance.ground->groundOutput.outputValues, restored.instance.ground->groundOutput.outputValues);
+
+    // Files from another version are ignored
+    nlohmann::json otherVersion;
+    otherVersion["Version"] = "EnergyPlus, Version 0.0.0";
+    otherVersion["Instances"] = groundCache;
+    {
+        std::ofstream ofs(fileName, std::ios::binary);
+        nlohmann::json::to_cbor(otherVersion, ofs);
+    }
+    EXPECT_TRUE(km.readGroundCache().empty());
+
+    std::remove(fileName.c_str());
+    EXPECT_TRUE(km.readGroundCache().empty());
+    DataStringGlobals::outputKivaFileName = outputKivaFileName;
+}
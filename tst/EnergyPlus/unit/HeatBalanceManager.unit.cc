@@ -47,6 +47,9 @@
 
 // EnergyPlus::HeatBalanceManager Unit Tests
 
+// C++ Headers
+#include <cstdio>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 
@@ -57,8 +60,10 @@
 #include <DataEnvironment.hh>
 #include <DataHVACGlobals.hh>
 #include <DataHeatBalFanSys.hh>
+#include <DataHeatBalSurface.hh>
 #include <DataLoopNode.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEquipment.hh>
 #include <ElectricPowerServiceManager.hh>
 #include <EnergyPlus/DataGlobals.hh>
@@ -471,6 +476,15 @@ TEST_F(EnergyPlusFixture, HeatBalanceManager_ZoneAirMassFlowConservationData2)
     GetSimpleAirModelInputs(ErrorsFound);
     EXPECT_FALSE(ErrorsFound);
     SetZoneMassConservationFlag();
+    // Zone 1 is only a mixing source zone and Zone 2 only a receiving zone
+    EXPECT_EQ(1, MassConservation(1).NumSourceZonesMixingObject);
+    EXPECT_EQ(0, MassConservation(1).NumReceivingZonesMixingObject);
+    EXPECT_EQ(1, MassConservation(1).ZoneMixingSourcesPtr(1));
+    EXPECT_TRUE(MassConservation(1).IsOnlySourceZone);
+    EXPECT_EQ(0, MassConservation(2).NumSourceZonesMixingObject);
+    EXPECT_EQ(1, MassConservation(2).NumReceivingZonesMixingObject);
+    EXPECT_EQ(1, MassConservation(2).ZoneMixingReceivingPtr(1));
+    EXPECT_FALSE(MassConservation(2).IsOnlySourceZone);
     // setup zone equipment configuration
     ZoneEquipConfig.allocate(NumOfZones);
 
@@ -1583,4 +1597,113 @@ TEST_F(EnergyPlusFixture, HeatBalanceManager_EMSConstructionTest)
     EXPECT_LT(refPtIllum, 1000.0);
 }
 
+TEST_F(EnergyPlusFixture, HeatBalanceManager_AitkenExtrapolate)
+{
+    // A value approaching 20 C with each day's change half the last: 10, 15, 17.5 -> 20
+    EXPECT_NEAR(20.0, AitkenExtrapolate(10.0, 15.0, 17.5), 1.0e-12);
+    EXPECT_NEAR(-4.0, AitkenExtrapolate(-1.0, -2.5, -3.25), 1.0e-12);
+
+    // Oscillating, diverging or settled values are left where they are
+    EXPECT_EQ(17.5, AitkenExtrapolate(15.0, 20.0, 17.5));
+    EXPECT_EQ(17.5, AitkenExtrapolate(16.0, 16.5, 17.5));
+    EXPECT_EQ(17.5, AitkenExtrapolate(17.5, 17.5, 17.5));
+    EXPECT_EQ(17.5, AitkenExtrapolate(10.0, 17.5 - 1.0e-8, 17.5));
+}
+
+TEST_F(EnergyPlusFixture, HeatBalanceManager_WarmupStateReuse)
+{
+    DataHeatBalSurface::TH.dimension(2, 3, 2, 23.0);
+    DataHeatBalSurface::QH.dimension(2, 3, 2, 0.0);
+    DataHeatBalSurface::THM.dimension(2, 3, 2, 23.0);
+    DataHeatBalSurface::QHM.dimension(2, 3, 2, 0.0);
+    DataHeatBalSurface::TempSurfIn.dimension(2, 23.0);
+    DataHeatBalSurface::TempSurfInTmp.dimension(2, 23.0);
+    DataHeatBalSurface::TempSurfOut.dimension(2, 0.0);
+    DataHeatBalance::HeatTransferAlgosUsed.dimension(1, DataSurfaces::HeatTransferModel_CTF);
+    WeatherManager::Environment.allocate(1);
+    WeatherManager::Environment(1).DesignDayNum = 1;
+    WeatherManager::Envrn = 1;
+    DataGlobals::KindOfSim = DataGlobals::ksDesignDay;
+    DataSystemVariables::WarmupStateReuse = true;
+
+    // Nothing to start from the first time the design day is run
+    SeedWarmupState();
+    EXPECT_EQ(23.0, DataHeatBalSurface::TH(1, 1, 2));
+
+    DataHeatBalSurface::TH(1, 1, 2) = 31.0;
+    DataHeatBalSurface::QH(2, 2, 1) = -12.5;
+    DataHeatBalSurface::TempSurfIn(2) = 26.0;
+    SaveConvergedWarmupState();
+
+    // The next run of the design day starts from the converged histories
+    DataHeatBalSurface::TH = 23.0;
+    DataHeatBalSurface::QH = 0.0;
+    DataHeatBalSurface::TempSurfIn = 23.0;
+    SeedWarmupState();
+    EXPECT_EQ(31.0, DataHeatBalSurface::TH(1, 1, 2));
+    EXPECT_EQ(-12.5, DataHeatBalSurface::QH(2, 2, 1));
+    EXPECT_EQ(26.0, DataHeatBalSurface::TempSurfIn(2));
+
+    // HVAC sizing simulation passes of the design day also start from the zone air histories
+    DataHeatBalFanSys::MAT.dimension(2, 23.0);
+    DataHeatBalFanSys::XMAT.dimension(2, 23.0);
+    DataHeatBalFanSys::XM2T.dimension(2, 23.0);
+    DataHeatBalFanSys::MAT(2) = 27.5;
+    DataHeatBalFanSys::XM2T(1) = 21.0;
+    SaveConvergedWarmupState();
+    DataHeatBalFanSys::MAT = 23.0;
+    DataHeatBalFanSys::XM2T = 23.0;
+    DataHeatBalSurface::TH = 23.0;
+    DataGlobals::KindOfSim = DataGlobals::ksHVACSizeDesignDay;
+    SeedWarmupState();
+    EXPECT_EQ(31.0, DataHeatBalSurface::TH(1, 1, 2));
+    EXPECT_EQ(27.5, DataHeatBalFanSys::MAT(2));
+    EXPECT_EQ(23.0, DataHeatBalFanSys::XMAT(1));
+    EXPECT_EQ(21.0, DataHeatBalFanSys::XM2T(1));
+
+    // Other heat transfer algorithms keep state outside these histories
+    DataHeatBalance::HeatTransferAlgosUsed(1) = DataSurfaces::HeatTransferModel_CondFD;
+    DataHeatBalSurface::TH = 23.0;
+    SeedWarmupState();
+    EXPECT_EQ(23.0, DataHeatBalSurface::TH(1, 1, 2));
+}
+
+TEST_F(EnergyPlusFixture, HeatBalanceManager_ThermalStateCheckpoint)
+{
+    DataSurfaces::TotSurfaces = 2;
+    DataGlobals::NumOfZones = 1;
+    DataHeatBalSurface::TH.dimension(2, 3, 2, 23.0);
+    DataHeatBalSurface::QH.dimension(2, 3, 2, 0.0);
+    DataHeatBalSurface::THM.dimension(2, 3, 2, 23.0);
+    DataHeatBalSurface::QHM.dimension(2, 3, 2, 0.0);
+    DataHeatBalSurface::TempSurfIn.dimension(2, 23.0);
+    DataHeatBalSurface::TempSurfInTmp.dimension(2, 23.0);
+    DataHeatBalSurface::TempSurfOut.dimension(2, 0.0);
+    DataHeatBalFanSys::MAT.dimension(1, 23.0);
+    DataHeatBalFanSys::XMAT.dimension(1, 23.0);
+    DataHeatBalance::HeatTransferAlgosUsed.dimension(1, DataSurfaces::HeatTransferModel_CTF);
+
+    std::string const FileName("HeatBalanceManager_ThermalStateCheckpoint.ckpt");
+    DataHeatBalSurface::TH(2, 3, 1) = 18.25;
+    DataHeatBalSurface::QHM(1, 2, 2) = 4.5;
+    DataHeatBalFanSys::MAT(1) = 20.5;
+    WriteThermalStateCheckpoint(FileName);
+
+    DataHeatBalSurface::TH = 23.0;
+    DataHeatBalSurface::QHM = 0.0;
+    DataHeatBalFanSys::MAT = 23.0;
+    EXPECT_TRUE(ReadThermalStateCheckpoint(FileName));
+    EXPECT_EQ(18.25, DataHeatBalSurface::TH(2, 3, 1));
+    EXPECT_EQ(4.5, DataHeatBalSurface::QHM(1, 2, 2));
+    EXPECT_EQ(20.5, DataHeatBalFanSys::MAT(1));
+
+    // A checkpoint of another model is refused
+    DataGlobals::NumOfZones = 2;
+    DataHeatBalFanSys::MAT.dimension(2, 23.0);
+    EXPECT_FALSE(ReadThermalStateCheckpoint(FileName));
+    EXPECT_EQ(23.0, DataHeatBalFanSys::MAT(1));
+
+    std::remove(FileName.c_str());
+}
+
 } // namespace EnergyPlus
@@ -47,6 +47,10 @@
 
 // EnergyPlus::HeatBalanceSurfaceManager Unit Tests
 
+// C++ Headers
+#include <array>
+#include <vector>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 
@@ -64,8 +68,11 @@
 #include <EnergyPlus/DataOutputs.hh>
 #include <EnergyPlus/DataSizing.hh>
 #include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/DataZoneEquipment.hh>
 #include <EnergyPlus/ElectricPowerServiceManager.hh>
+#include <EnergyPlus/HeatBalFiniteDiffManager.hh>
+#include <EnergyPlus/HeatBalanceHAMTManager.hh>
 #include <EnergyPlus/HeatBalanceManager.hh>
 #include <EnergyPlus/HeatBalanceSurfaceManager.hh>
 #include <EnergyPlus/OutAirNodeManager.hh>
@@ -328,6 +335,139 @@ TEST_F(EnergyPlusFixture, HeatBalanceSurfaceManager_UpdateFinalThermalHistories)
     EXPECT_EQ(12.5, DataHeatBalSurface::TuserHist(1, 3)); // Now check to see that it is shifting the temperature history properly
 }
 
+TEST_F(EnergyPlusFixture, HeatBalanceSurfaceManager_UpdateThermalHistoriesShiftAndInterpolate)
+{
+    DataSurfaces::TotSurfaces = 2;
+    DataGlobals::NumOfZones = 1;
+    DataGlobals::TimeStepZone = 0.25;
+    DataHeatBalance::TotConstructs = 2;
+    DataHeatBalance::Zone.allocate(DataGlobals::NumOfZones);
+    DataSurfaces::Surface.allocate(DataSurfaces::TotSurfaces);
+    DataSurfaces::SurfaceWindow.allocate(DataSurfaces::TotSurfaces);
+    DataHeatBalance::Construct.allocate(DataHeatBalance::TotConstructs);
+
+    AllocateSurfaceHeatBalArrays();
+
+    for (int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum) {
+        DataSurfaces::Surface(SurfNum).Class = DataSurfaces::SurfaceClass_Wall;
+        DataSurfaces::Surface(SurfNum).HeatTransSurf = true;
+        DataSurfaces::Surface(SurfNum).HeatTransferAlgorithm = DataSurfaces::HeatTransferModel_CTF;
+        DataSurfaces::Surface(SurfNum).Construction = SurfNum;
+        DataHeatBalSurface::SUMH(SurfNum) = 0;
+    }
+
+    // Surface 1 runs on the zone time step, so its histories are shifted every time step
+    DataHeatBalance::Construct(1).NumCTFTerms = 2;
+    DataHeatBalance::Construct(1).NumHistories = 1;
+    DataHeatBalance::Construct(1).CTFTimeStep = 0.25;
+    DataHeatBalSurface::TH(1, 1, 1) = 20.0;
+    DataHeatBalSurface::TempSurfIn(1) = 10.0;
+
+    // Surface 2 has a longer CTF time step, so its histories are interpolated until the master histories shift
+    DataHeatBalance::Construct(2).NumCTFTerms = 3;
+    DataHeatBalance::Construct(2).NumHistories = 2;
+    DataHeatBalance::Construct(2).CTFTimeStep = 0.5;
+    DataHeatBalSurface::TH(1, 1, 2) = 30.0;
+    DataHeatBalSurface::TempSurfIn(2) = 16.0;
+    DataHeatBalSurface::THM(1, 2, 2) = 24.0;
+    DataHeatBalSurface::THM(1, 3, 2) = 22.0;
+    DataHeatBalSurface::THM(1, 4, 2) = 21.0;
+
+    UpdateThermalHistories();
+
+    EXPECT_DOUBLE_EQ(20.0, DataHeatBalSurface::TH(1, 2, 1));
+    EXPECT_DOUBLE_EQ(10.0, DataHeatBalSurface::TH(2, 2, 1));
+    EXPECT_DOUBLE_EQ(0.0, DataHeatBalSurface::TH(1, 3, 1));
+    EXPECT_DOUBLE_EQ(27.0, DataHeatBalSurface::TH(1, 2, 2));
+    EXPECT_DOUBLE_EQ(23.0, DataHeatBalSurface::TH(1, 3, 2));
+    EXPECT_DOUBLE_EQ(21.5, DataHeatBalSurface::TH(1, 4, 2));
+    EXPECT_DOUBLE_EQ(24.0, DataHeatBalSurface::THM(1, 2, 2));
+
+    UpdateThermalHistories();
+
+    EXPECT_DOUBLE_EQ(20.0, DataHeatBalSurface::TH(1, 3, 1));
+    EXPECT_DOUBLE_EQ(10.0, DataHeatBalSurface::TH(2, 3, 1));
+    EXPECT_DOUBLE_EQ(30.0, DataHeatBalSurface::TH(1, 2, 2));
+    EXPECT_DOUBLE_EQ(24.0, DataHeatBalSurface::TH(1, 3, 2));
+    EXPECT_DOUBLE_EQ(22.0, DataHeatBalSurface::TH(1, 4, 2));
+    EXPECT_DOUBLE_EQ(22.0, DataHeatBalSurface::THM(1, 4, 2));
+}
+
+TEST_F(EnergyPlusFixture, HeatBalanceSurfaceManager_InitCTFConstantPartsMatchesConstruction)
+{
+    // the history sums use per-surface copies of the CTF coefficients and must give the same bits as summing
+    // with the construction coefficients, also after a surface switches construction
+    DataSurfaces::TotSurfaces = 2;
+    DataGlobals::NumOfZones = 1;
+    DataHeatBalance::TotConstructs = 2;
+    DataHeatBalance::Zone.allocate(DataGlobals::NumOfZones);
+    DataSurfaces::Surface.allocate(DataSurfaces::TotSurfaces);
+    DataSurfaces::SurfaceWindow.allocate(DataSurfaces::TotSurfaces);
+    DataHeatBalance::Construct.allocate(DataHeatBalance::TotConstructs);
+
+    AllocateSurfaceHeatBalArrays();
+
+    for (int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum) {
+        DataSurfaces::Surface(SurfNum).Class = DataSurfaces::SurfaceClass_Wall;
+        DataSurfaces::Surface(SurfNum).HeatTransSurf = true;
+        DataSurfaces::Surface(SurfNum).HeatTransferAlgorithm = DataSurfaces::HeatTransferModel_CTF;
+        DataSurfaces::Surface(SurfNum).Construction = SurfNum;
+    }
+    for (int ConstrNum = 1; ConstrNum <= DataHeatBalance::TotConstructs; ++ConstrNum) {
+        auto &construct(DataHeatBalance::Construct(ConstrNum));
+        construct.NumCTFTerms = 2 + 3 * ConstrNum;
+        for (int Term = 0; Term <= construct.NumCTFTerms; ++Term) {
+            construct.CTFCross(Term) = 0.1 / (Term + 1) + 0.013 * ConstrNum;
+            construct.CTFInside(Term) = 0.7 / (Term + 2) - 0.011 * ConstrNum;
+            construct.CTFOutside(Term) = 0.3 / (Term + 3) + 0.017 * ConstrNum;
+            if (Term > 0) construct.CTFFlux(Term) = 0.9 / (Term * Term + 1.3);
+        }
+    }
+
+    auto setHistories = [](Real64 const offset) {
+        for (int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum) {
+            for (int Term = 1; Term <= DataHeatBalance::MaxCTFTerms; ++Term) {
+                DataHeatBalSurface::TH(1, Term, SurfNum) = 20.0 + offset + 0.37 * Term - 0.11 * SurfNum;
+                DataHeatBalSurface::TH(2, Term, SurfNum) = 22.0 - offset + 0.29 * Term + 0.13 * SurfNum;
+                DataHeatBalSurface::QH(1, Term, SurfNum) = 15.0 * offset - 1.7 * Term + 3.1 * SurfNum;
+                DataHeatBalSurface::QH(2, Term, SurfNum) = -8.0 * offset + 2.3 * Term - 1.9 * SurfNum;
+            }
+        }
+    };
+
+    // the sums as computed from the construction coefficients before the surface copies
+    auto expectConstructionSums = []() {
+        for (int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum) {
+            auto const &construct(DataHeatBalance::Construct(DataSurfaces::Surface(SurfNum).Construction));
+            Real64 QIC = 0.0;
+            Real64 QOC = 0.0;
+            for (int Term = 1; Term <= construct.NumCTFTerms; ++Term) {
+                Real64 const ctf_cross(construct.CTFCross(Term));
+                Real64 const TH11(DataHeatBalSurface::TH(1, Term + 1, SurfNum));
+                Real64 const TH12(DataHeatBalSurface::TH(2, Term + 1, SurfNum));
+                QIC += ctf_cross * TH11 - construct.CTFInside(Term) * TH12 + construct.CTFFlux(Term) * DataHeatBalSurface::QH(2, Term + 1, SurfNum);
+                QOC += construct.CTFOutside(Term) * TH11 - ctf_cross * TH12 + construct.CTFFlux(Term) * DataHeatBalSurface::QH(1, Term + 1, SurfNum);
+            }
+            EXPECT_EQ(QIC, DataHeatBalSurface::CTFConstInPart(SurfNum));
+            EXPECT_EQ(QOC, DataHeatBalSurface::CTFConstOutPart(SurfNum));
+        }
+    };
+
+    setHistories(0.0);
+    InitCTFConstantParts();
+    EXPECT_EQ(1, DataHeatBalSurface::SurfCTFConstr(1));
+    EXPECT_EQ(2, DataHeatBalSurface::SurfCTFConstr(2));
+    expectConstructionSums();
+
+    // a construction switch, as by EMS or a shading device, refreshes the surface copy
+    DataSurfaces::Surface(1).Construction = 2;
+    setHistories(1.5);
+    InitCTFConstantParts();
+    EXPECT_EQ(2, DataHeatBalSurface::SurfCTFConstr(1));
+    EXPECT_EQ(DataHeatBalance::Construct(2).CTFCross(5), DataHeatBalSurface::SurfCTFCross(1, 5));
+    expectConstructionSums();
+}
+
 TEST_F(EnergyPlusFixture, HeatBalanceSurfaceManager_TestSurfTempCalcHeatBalanceInsideSurfAirRefT)
 {
 
@@ -797,6 +937,27 @@ TEST_F(EnergyPlusFixture, HeatBalanceSurfaceManager_TestSurfTempCalcHeatBalanceI
     EXPECT_EQ(23.0, DataHeatBalance::TempEffBulkAir(2));
     EXPECT_EQ(24.0, DataHeatBalance::TempEffBulkAir(3));
 
+    // the threaded pass over opaque CTF surfaces reproduces the serial inside heat balance
+    Array1D<Real64> const TempSurfInStart(DataHeatBalSurface::TempSurfIn);
+    Array1D<Real64> const TempSurfInTmpStart(DataHeatBalSurface::TempSurfInTmp);
+    Array3D<Real64> const THStart(DataHeatBalSurface::TH);
+    Array1D<Real64> const TempEffBulkAirStart(DataHeatBalance::TempEffBulkAir);
+    CalcHeatBalanceInsideSurf();
+    Array1D<Real64> const TempSurfInSerial(DataHeatBalSurface::TempSurfIn);
+    Array1D<Real64> const QdotConvInRepSerial(DataHeatBalSurface::QdotConvInRep);
+
+    DataHeatBalSurface::TempSurfIn = TempSurfInStart;
+    DataHeatBalSurface::TempSurfInTmp = TempSurfInTmpStart;
+    DataHeatBalSurface::TH = THStart;
+    DataHeatBalance::TempEffBulkAir = TempEffBulkAirStart;
+    DataSystemVariables::NumberIntRadThreads = 2;
+    CalcHeatBalanceInsideSurf();
+    DataSystemVariables::NumberIntRadThreads = 1;
+    for (int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum) {
+        EXPECT_EQ(TempSurfInSerial(SurfNum), DataHeatBalSurface::TempSurfIn(SurfNum)) << SurfNum;
+        EXPECT_EQ(QdotConvInRepSerial(SurfNum), DataHeatBalSurface::QdotConvInRep(SurfNum)) << SurfNum;
+    }
+
     DataZoneEquipment::ZoneEquipConfig.deallocate();
     DataSizing::ZoneEqSizing.deallocate();
     DataHeatBalFanSys::MAT.deallocate(); // Zone temperature C
@@ -2490,4 +2651,462 @@ TEST_F(EnergyPlusFixture, HeatBalanceSurfaceManager_TestSurfTempCalcHeatBalanceA
     DataHeatBalance::ZoneWinHeatGainRepEnergy.deallocate();
 }
 
+TEST_F(EnergyPlusFixture, HeatBalanceSurfaceManager_BatchedCondFDAndHAMTSurfacesThreaded)
+{
+    std::string const idf_objects = delimited_string({
+        "  Version,9.2;",
+
+        "  Building,",
+        "    CondFD and HAMT Zone,    !- Name",
+        "    0,                       !- North Axis {deg}",
+        "    Suburbs,                 !- Terrain",
+        "    0.001,                   !- Loads Convergence Tolerance Value",
+        "    0.0050000,               !- Temperature Convergence Tolerance Value {deltaC}",
+        "    FullInteriorAndExterior, !- Solar Distribution",
+        "    25,                      !- Maximum Number of Warmup Days",
+        "    6;                       !- Minimum Number of Warmup Days",
+
+        "  HeatBalanceAlgorithm,ConductionFiniteDifference;",
+
+        "  Material,",
+        "    A1 - 1 IN STUCCO,        !- Name",
+        "    Smooth,                  !- Roughness",
+        "    2.5389841E-02,           !- Thickness {m}",
+        "    0.6918309,               !- Conductivity {W/m-K}",
+        "    1858.142,                !- Density {kg/m3}",
+        "    836.8000,                !- Specific Heat {J/kg-K}",
+        "    0.9000000,               !- Thermal Absorptance",
+        "    0.9200000,               !- Solar Absorptance",
+        "    0.9200000;               !- Visible Absorptance",
+
+        "  Material,",
+        "    CB11,                    !- Name",
+        "    MediumRough,             !- Roughness",
+        "    0.2032000,               !- Thickness {m}",
+        "    1.048000,                !- Conductivity {W/m-K}",
+        "    1105.000,                !- Density {kg/m3}",
+        "    837.0000,                !- Specific Heat {J/kg-K}",
+        "    0.9000000,               !- Thermal Absorptance",
+        "    0.2000000,               !- Solar Absorptance",
+        "    0.2000000;               !- Visible Absorptance",
+
+        "  Material,",
+        "    GP01,                    !- Name",
+        "    MediumSmooth,            !- Roughness",
+        "    1.2700000E-02,           !- Thickness {m}",
+        "    0.1600000,               !- Conductivity {W/m-K}",
+        "    801.0000,                !- Density {kg/m3}",
+        "    837.0000,                !- Specific Heat {J/kg-K}",
+        "    0.9000000,               !- Thermal Absorptance",
+        "    0.7500000,               !- Solar Absorptance",
+        "    0.7500000;               !- Visible Absorptance",
+
+        "  Material,",
+        "    Concrete,                !- Name",
+        "    Rough,                   !- Roughness",
+        "    0.1000000,               !- Thickness {m}",
+        "    1.600000,                !- Conductivity {W/m-K}",
+        "    2300.000,                !- Density {kg/m3}",
+        "    880.0000,                !- Specific Heat {J/kg-K}",
+        "    0.9000000,               !- Thermal Absorptance",
+        "    0.6000000,               !- Solar Absorptance",
+        "    0.6000000;               !- Visible Absorptance",
+
+        "  MaterialProperty:HeatAndMoistureTransfer:Settings,",
+        "    Concrete,                !- Material Name",
+        "    0.76,                    !- Porosity {m3/m3}",
+        "    0.01;                    !- Initial Water Content Ratio {kg/kg}",
+
+        "  MaterialProperty:HeatAndMoistureTransfer:SorptionIsotherm,",
+        "    Concrete,                !- Material Name",
+        "    4,                       !- Number of Isotherm Coordinates",
+        "    0.2,                     !- Relative Humidity Fraction 1 {dimensionless}",
+        "    20.0,                    !- Moisture Content 1 {kg/m3}",
+        "    0.5,                     !- Relative Humidity Fraction 2 {dimensionless}",
+        "    40.0,                    !- Moisture Content 2 {kg/m3}",
+        "    0.8,                     !- Relative Humidity Fraction 3 {dimensionless}",
+        "    60.0,                    !- Moisture Content 3 {kg/m3}",
+        "    0.95,                    !- Relative Humidity Fraction 4 {dimensionless}",
+        "    90.0;                    !- Moisture Content 4 {kg/m3}",
+
+        "  MaterialProperty:HeatAndMoistureTransfer:Suction,",
+        "    Concrete,                !- Material Name",
+        "    3,                       !- Number of Suction points",
+        "    0.0,                     !- Moisture Content 1 {kg/m3}",
+        "    0.0,                     !- Liquid Transport Coefficient 1 {m2/s}",
+        "    72.0,                    !- Moisture Content 2 {kg/m3}",
+        "    7.4E-11,                 !- Liquid Transport Coefficient 2 {m2/s}",
+        "    85.0,                    !- Moisture Content 3 {kg/m3}",
+        "    2.5E-10;                 !- Liquid Transport Coefficient 3 {m2/s}",
+
+        "  MaterialProperty:HeatAndMoistureTransfer:Redistribution,",
+        "    Concrete,                !- Material Name",
+        "    3,                       !- Number of Redistribution points",
+        "    0.0,                     !- Moisture Content 1 {kg/m3}",
+        "    0.0,                     !- Liquid Transport Coefficient 1 {m2/s}",
+        "    72.0,                    !- Moisture Content 2 {kg/m3}",
+        "    7.4E-12,                 !- Liquid Transport Coefficient 2 {m2/s}",
+        "    85.0,                    !- Moisture Content 3 {kg/m3}",
+        "    2.5E-11;                 !- Liquid Transport Coefficient 3 {m2/s}",
+
+        "  MaterialProperty:HeatAndMoistureTransfer:Diffusion,",
+        "    Concrete,                !- Material Name",
+        "    1,                       !- Number of Data Pairs",
+        "    0.0,                     !- Relative Humidity Fraction 1 {dimensionless}",
+        "    180.0;                   !- Water Vapor Diffusion Resistance Factor 1 {dimensionless}",
+
+        "  MaterialProperty:HeatAndMoistureTransfer:ThermalConductivity,",
+        "    Concrete,                !- Material Name",
+        "    2,                       !- Number of Thermal Conductivity Coordinates",
+        "    0.0,                     !- Moisture Content 1 {kg/m3}",
+        "    1.6,                     !- Thermal Conductivity 1 {W/m-K}",
+        "    180.0,                   !- Moisture Content 2 {kg/m3}",
+        "    2.6;                     !- Thermal Conductivity 2 {W/m-K}",
+
+        "  Construction,",
+        "    EXTWALL,                 !- Name",
+        "    A1 - 1 IN STUCCO,        !- Outside Layer",
+        "    CB11,                    !- Layer 2",
+        "    GP01;                    !- Layer 3",
+
+        "  Construction,",
+        "    HAMTWALL,                !- Name",
+        "    Concrete;                !- Outside Layer",
+
+        "  SurfaceProperty:HeatTransferAlgorithm:Construction,",
+        "    HAMT Surfaces,           !- Name",
+        "    CombinedHeatAndMoistureFiniteElement,  !- Algorithm",
+        "    HAMTWALL;                !- Construction Name",
+
+        "  Zone,",
+        "    ZONE ONE,                !- Name",
+        "    0,                       !- Direction of Relative North {deg}",
+        "    0,                       !- X Origin {m}",
+        "    0,                       !- Y Origin {m}",
+        "    0,                       !- Z Origin {m}",
+        "    1,                       !- Type",
+        "    1,                       !- Multiplier",
+        "    autocalculate,           !- Ceiling Height {m}",
+        "    autocalculate;           !- Volume {m3}",
+
+        "  GlobalGeometryRules,",
+        "    UpperLeftCorner,         !- Starting Vertex Position",
+        "    CounterClockWise,        !- Vertex Entry Direction",
+        "    World;                   !- Coordinate System",
+
+        "  BuildingSurface:Detailed,",
+        "    Wall North,              !- Name",
+        "    Wall,                    !- Surface Type",
+        "    EXTWALL,                 !- Construction Name",
+        "    ZONE ONE,                !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0.5000000,               !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    4,4,3,  !- X,Y,Z ==> Vertex 1 {m}",
+        "    4,4,0,  !- X,Y,Z ==> Vertex 2 {m}",
+        "    0,4,0,  !- X,Y,Z ==> Vertex 3 {m}",
+        "    0,4,3;  !- X,Y,Z ==> Vertex 4 {m}",
+
+        "  BuildingSurface:Detailed,",
+        "    Wall East,               !- Name",
+        "    Wall,                    !- Surface Type",
+        "    EXTWALL,                 !- Construction Name",
+        "    ZONE ONE,                !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0.5000000,               !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    4,0,3,  !- X,Y,Z ==> Vertex 1 {m}",
+        "    4,0,0,  !- X,Y,Z ==> Vertex 2 {m}",
+        "    4,4,0,  !- X,Y,Z ==> Vertex 3 {m}",
+        "    4,4,3;  !- X,Y,Z ==> Vertex 4 {m}",
+
+        "  BuildingSurface:Detailed,",
+        "    Wall South,              !- Name",
+        "    Wall,                    !- Surface Type",
+        "    EXTWALL,                 !- Construction Name",
+        "    ZONE ONE,                !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0.5000000,               !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    0,0,3,  !- X,Y,Z ==> Vertex 1 {m}",
+        "    0,0,0,  !- X,Y,Z ==> Vertex 2 {m}",
+        "    4,0,0,  !- X,Y,Z ==> Vertex 3 {m}",
+        "    4,0,3;  !- X,Y,Z ==> Vertex 4 {m}",
+
+        "  BuildingSurface:Detailed,",
+        "    Wall West,               !- Name",
+        "    Wall,                    !- Surface Type",
+        "    HAMTWALL,                !- Construction Name",
+        "    ZONE ONE,                !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0.5000000,               !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    0,4,3,  !- X,Y,Z ==> Vertex 1 {m}",
+        "    0,4,0,  !- X,Y,Z ==> Vertex 2 {m}",
+        "    0,0,0,  !- X,Y,Z ==> Vertex 3 {m}",
+        "    0,0,3;  !- X,Y,Z ==> Vertex 4 {m}",
+
+        "  BuildingSurface:Detailed,",
+        "    Floor,                   !- Name",
+        "    Floor,                   !- Surface Type",
+        "    HAMTWALL,                !- Construction Name",
+        "    ZONE ONE,                !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0.5000000,               !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    0,0,0,  !- X,Y,Z ==> Vertex 1 {m}",
+        "    0,4,0,  !- X,Y,Z ==> Vertex 2 {m}",
+        "    4,4,0,  !- X,Y,Z ==> Vertex 3 {m}",
+        "    4,0,0;  !- X,Y,Z ==> Vertex 4 {m}",
+
+        "  BuildingSurface:Detailed,",
+        "    Roof,                    !- Name",
+        "    Roof,                    !- Surface Type",
+        "    HAMTWALL,                !- Construction Name",
+        "    ZONE ONE,                !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0.5000000,               !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    0,4,3,  !- X,Y,Z ==> Vertex 1 {m}",
+        "    0,0,3,  !- X,Y,Z ==> Vertex 2 {m}",
+        "    4,0,3,  !- X,Y,Z ==> Vertex 3 {m}",
+        "    4,4,3;  !- X,Y,Z ==> Vertex 4 {m}",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+    bool ErrorsFound = false;
+
+    HeatBalanceManager::GetProjectControlData(ErrorsFound);
+    EXPECT_FALSE(ErrorsFound);
+    HeatBalanceManager::GetZoneData(ErrorsFound);
+    EXPECT_FALSE(ErrorsFound);
+    HeatBalanceManager::GetMaterialData(ErrorsFound);
+    EXPECT_FALSE(ErrorsFound);
+    HeatBalanceManager::GetConstructData(ErrorsFound);
+    EXPECT_FALSE(ErrorsFound);
+    SurfaceGeometry::GetGeometryParameters(ErrorsFound);
+    EXPECT_FALSE(ErrorsFound);
+
+    SurfaceGeometry::CosBldgRotAppGonly = 1.0;
+    SurfaceGeometry::SinBldgRotAppGonly = 0.0;
+    SurfaceGeometry::GetSurfaceData(ErrorsFound);
+    EXPECT_FALSE(ErrorsFound);
+
+    std::vector<int> CondFDSurfs;
+    std::vector<int> HAMTSurfs;
+    for (int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum) {
+        if (DataSurfaces::Surface(SurfNum).HeatTransferAlgorithm == DataSurfaces::HeatTransferModel_CondFD) CondFDSurfs.push_back(SurfNum);
+        if (DataSurfaces::Surface(SurfNum).HeatTransferAlgorithm == DataSurfaces::HeatTransferModel_HAMT) HAMTSurfs.push_back(SurfNum);
+    }
+    ASSERT_EQ(3u, CondFDSurfs.size());
+    ASSERT_EQ(3u, HAMTSurfs.size());
+
+    DataGlobals::NumOfTimeStepInHour = 6;
+    DataGlobals::TimeStepZone = 1.0 / 6.0;
+    DataGlobals::TimeStepZoneSec = 600.0;
+    DataEnvironment::OutBaroPress = 101325.0;
+    DataEnvironment::SkyTemp = -15.0;
+    DataHeatBalFanSys::MAT.allocate(1);
+    DataHeatBalFanSys::MAT(1) = 21.0;
+    DataHeatBalFanSys::ZoneAirHumRat.allocate(1);
+    DataHeatBalFanSys::ZoneAirHumRat(1) = 0.008;
+    AllocateSurfaceHeatBalArrays();
+
+    // outdoor and indoor conditions that differ by surface so each solve is distinct
+    for (int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum) {
+        DataMoistureBalance::TempOutsideAirFD(SurfNum) = -5.0 + SurfNum;
+        DataMoistureBalance::RhoVaporAirOut(SurfNum) = 0.003;
+        DataMoistureBalance::RhoVaporAirIn(SurfNum) = 0.009;
+        DataMoistureBalance::HConvExtFD(SurfNum) = 10.0 + SurfNum;
+        DataMoistureBalance::HMassConvExtFD(SurfNum) = (10.0 + SurfNum) / 1200.0;
+        DataMoistureBalance::HAirFD(SurfNum) = 2.0;
+        DataMoistureBalance::HSkyFD(SurfNum) = 2.5;
+        DataMoistureBalance::HConvInFD(SurfNum) = 2.5;
+        DataMoistureBalance::HMassConvInFD(SurfNum) = 2.5 / 1200.0;
+        DataHeatBalSurface::QRadSWOutAbs(SurfNum) = 50.0 * SurfNum;
+        DataHeatBalSurface::NetLWRadToSurf(SurfNum) = 5.0;
+    }
+
+    Array1D<Real64> TempSurfIn(DataSurfaces::TotSurfaces, 0.0);
+    Array1D<Real64> TempSurfOut(DataSurfaces::TotSurfaces, 0.0);
+
+    // the first pass reads the input and sets up both models
+    HeatBalFiniteDiffManager::ManageHeatBalFiniteDiffSurfaces(CondFDSurfs, TempSurfIn, TempSurfOut);
+    HeatBalanceHAMTManager::ManageHeatBalHAMTSurfaces(HAMTSurfs, TempSurfIn, TempSurfOut);
+    auto const SurfaceFDStart(HeatBalFiniteDiffManager::SurfaceFD);
+    auto const cellsStart(HeatBalanceHAMTManager::cells);
+
+    // serial pass
+    DataSystemVariables::NumberIntRadThreads = 1;
+    HeatBalFiniteDiffManager::ManageHeatBalFiniteDiffSurfaces(CondFDSurfs, TempSurfIn, TempSurfOut);
+    HeatBalanceHAMTManager::ManageHeatBalHAMTSurfaces(HAMTSurfs, TempSurfIn, TempSurfOut);
+    Array1D<Real64> const TempSurfInSerial(TempSurfIn);
+    Array1D<Real64> const TempSurfOutSerial(TempSurfOut);
+
+    // threaded pass from the same state gives the same surface temperatures
+    HeatBalFiniteDiffManager::SurfaceFD = SurfaceFDStart;
+    HeatBalanceHAMTManager::cells = cellsStart;
+    TempSurfIn = 0.0;
+    TempSurfOut = 0.0;
+    DataSystemVariables::NumberIntRadThreads = 3;
+    HeatBalFiniteDiffManager::ManageHeatBalFiniteDiffSurfaces(CondFDSurfs, TempSurfIn, TempSurfOut);
+    HeatBalanceHAMTManager::ManageHeatBalHAMTSurfaces(HAMTSurfs, TempSurfIn, TempSurfOut);
+    DataSystemVariables::NumberIntRadThreads = 1;
+
+    for (int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum) {
+        EXPECT_DOUBLE_EQ(TempSurfInSerial(SurfNum), TempSurfIn(SurfNum)) << SurfNum;
+        EXPECT_DOUBLE_EQ(TempSurfOutSerial(SurfNum), TempSurfOut(SurfNum)) << SurfNum;
+    }
+    // the surfaces were actually solved, and each to its own boundary conditions
+    EXPECT_NE(TempSurfOutSerial(CondFDSurfs[0]), TempSurfOutSerial(CondFDSurfs[1]));
+    EXPECT_NE(TempSurfOutSerial(HAMTSurfs[0]), TempSurfOutSerial(HAMTSurfs[1]));
+    for (int SurfNum : HAMTSurfs) {
+        EXPECT_GT(TempSurfInSerial(SurfNum), -5.0);
+        EXPECT_LT(TempSurfInSerial(SurfNum), 21.0);
+    }
+}
+
+
+TEST_F(EnergyPlusFixture, HeatBalanceSurfaceManager_DifSolExcZonesReusedWhileInputsUnchanged)
+{
+    // four zones in a row joined by interzone windows, so the multi-zone passes are exercised
+    int const NumZones(4);
+    DataGlobals::NumOfZones = NumZones;
+    DataGlobals::KickOffSimulation = false;
+    DataGlobals::KickOffSizing = false;
+    DataHeatBalance::Zone.allocate(NumZones);
+    for (auto &z : DataHeatBalance::Zone) {
+        z.HasInterZoneWindow = true;
+    }
+    DataHeatBalance::TotConstructs = 2;
+    DataHeatBalance::Construct.allocate(DataHeatBalance::TotConstructs);
+    DataHeatBalance::Construct(1).TransDiff = 0.6; // glazing
+    DataHeatBalance::Construct(2).TransDiff = 0.0; // opaque
+    DataHeatBalSurface::VMULT.allocate(NumZones);
+    DataHeatBalSurface::VMULT = {0.05, 0.08, 0.06, 0.04};
+
+    DataSurfaces::TotSurfaces = 7;
+    DataSurfaces::Surface.allocate(DataSurfaces::TotSurfaces);
+    std::vector<std::array<int, 2>> const ZoneAndOtherSide({{1, 2}, {2, 1}, {2, 4}, {3, 3}, {3, 6}, {4, 5}, {1, 0}});
+    for (int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum) {
+        auto &surf(DataSurfaces::Surface(SurfNum));
+        surf.HeatTransSurf = true;
+        surf.Zone = ZoneAndOtherSide[SurfNum - 1][0];
+        surf.ExtBoundCond = ZoneAndOtherSide[SurfNum - 1][1];
+        surf.Construction = (surf.ExtBoundCond > 0) ? 1 : 2;
+        surf.Area = 2.0;
+    }
+
+    ComputeDifSolExcZonesWIZWindows(NumZones);
+    Array2D<Real64> const FirstFract(DataHeatBalSurface::FractDifShortZtoZ);
+    Array1D_bool const FirstRec(DataHeatBalSurface::RecDifShortFromZ);
+    EXPECT_TRUE(all(FirstRec));
+    EXPECT_GT(FirstFract(1, 4), 0.0); // reached through zones 2 and 3
+
+    // unchanged inputs: the factors are not recomputed
+    DataHeatBalSurface::FractDifShortZtoZ(1, 4) = -1.0;
+    ComputeDifSolExcZonesWIZWindows(NumZones);
+    EXPECT_EQ(-1.0, DataHeatBalSurface::FractDifShortZtoZ(1, 4));
+    DataHeatBalSurface::FractDifShortZtoZ(1, 4) = FirstFract(1, 4);
+
+    // a shaded window changes the diffuse transmittance, and the factors must match a full computation
+    DataSurfaces::Surface(3).Construction = 2;
+    ComputeDifSolExcZonesWIZWindows(NumZones);
+    Array2D<Real64> const ShadedFract(DataHeatBalSurface::FractDifShortZtoZ);
+    Array1D_bool const ShadedRec(DataHeatBalSurface::RecDifShortFromZ);
+    bool FactorsChanged(false);
+    for (int NZ = 1; NZ <= NumZones; ++NZ) {
+        for (int MZ = 1; MZ <= NumZones; ++MZ) {
+            if (FirstFract(NZ, MZ) != ShadedFract(NZ, MZ)) FactorsChanged = true;
+        }
+    }
+    EXPECT_TRUE(FactorsChanged);
+
+    DataHeatBalSurface::FractDifShortZtoZ.deallocate();
+    DataHeatBalSurface::RecDifShortFromZ.deallocate();
+    HeatBalanceSurfaceManager::clear_state();
+    ComputeDifSolExcZonesWIZWindows(NumZones);
+    for (int NZ = 1; NZ <= NumZones; ++NZ) {
+        EXPECT_EQ(ShadedRec(NZ), DataHeatBalSurface::RecDifShortFromZ(NZ)) << NZ;
+        for (int MZ = 1; MZ <= NumZones; ++MZ) {
+            EXPECT_EQ(ShadedFract(NZ, MZ), DataHeatBalSurface::FractDifShortZtoZ(NZ, MZ)) << NZ << ", " << MZ;
+        }
+    }
+
+    // back to the unshaded window, and to exactly the first factors
+    DataSurfaces::Surface(3).Construction = 1;
+    ComputeDifSolExcZonesWIZWindows(NumZones);
+    for (int NZ = 1; NZ <= NumZones; ++NZ) {
+        EXPECT_EQ(FirstRec(NZ), DataHeatBalSurface::RecDifShortFromZ(NZ)) << NZ;
+        for (int MZ = 1; MZ <= NumZones; ++MZ) {
+            EXPECT_EQ(FirstFract(NZ, MZ), DataHeatBalSurface::FractDifShortZtoZ(NZ, MZ)) << NZ << ", " << MZ;
+        }
+    }
+}
+
+
+TEST_F(EnergyPlusFixture, HeatBalanceSurfaceManager_OutsideHeatBalanceSurfacesMatchSurfaceFilter)
+{
+    DataGlobals::NumOfZones = 3;
+    DataSurfaces::TotSurfaces = 8;
+    DataSurfaces::Surface.allocate(DataSurfaces::TotSurfaces);
+    DataSurfaces::AdjacentZoneToSurface.dimension(DataSurfaces::TotSurfaces, 0);
+    for (auto &surf : DataSurfaces::Surface) {
+        surf.HeatTransSurf = true;
+        surf.Class = DataSurfaces::SurfaceClass_Wall;
+    }
+    DataSurfaces::Surface(1).Zone = 1;
+    DataSurfaces::Surface(2).Zone = 1; // partition to zone 2
+    DataSurfaces::AdjacentZoneToSurface(2) = 2;
+    DataSurfaces::Surface(3).Zone = 2; // other side of the partition
+    DataSurfaces::AdjacentZoneToSurface(3) = 1;
+    DataSurfaces::Surface(4).Zone = 2; // window
+    DataSurfaces::Surface(4).Class = DataSurfaces::SurfaceClass_Window;
+    DataSurfaces::Surface(5).Zone = 0; // detached shading
+    DataSurfaces::Surface(5).HeatTransSurf = false;
+    DataSurfaces::Surface(6).Zone = 3;
+    DataSurfaces::Surface(6).HeatTransSurf = false;
+    DataSurfaces::Surface(7).Zone = 3; // adiabatic, adjacent to its own zone
+    DataSurfaces::AdjacentZoneToSurface(7) = 3;
+    DataSurfaces::Surface(8).Zone = 2;
+
+    // the filter that CalcHeatBalanceOutsideSurf applied to every surface before the lists were built
+    auto const OriginalSurfaces = [](int const ZoneToResimulate) {
+        std::vector<int> Surfs;
+        for (int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum) {
+            int const ZoneNum = DataSurfaces::Surface(SurfNum).Zone;
+            if (ZoneToResimulate > 0) {
+                if ((ZoneNum != ZoneToResimulate) && (DataSurfaces::AdjacentZoneToSurface(SurfNum) != ZoneToResimulate)) continue;
+            }
+            if (!DataSurfaces::Surface(SurfNum).HeatTransSurf || ZoneNum == 0) continue;
+            if (DataSurfaces::Surface(SurfNum).Class == DataSurfaces::SurfaceClass_Window) continue;
+            Surfs.push_back(SurfNum);
+        }
+        return Surfs;
+    };
+
+    EXPECT_EQ(std::vector<int>({1, 2, 3, 7, 8}), OutsideHeatBalanceSurfaces(0));
+    for (int ZoneNum = 0; ZoneNum <= DataGlobals::NumOfZones; ++ZoneNum) {
+        EXPECT_EQ(OriginalSurfaces(ZoneNum), OutsideHeatBalanceSurfaces(ZoneNum)) << "Zone " << ZoneNum;
+    }
+}
+
 } // namespace EnergyPlus
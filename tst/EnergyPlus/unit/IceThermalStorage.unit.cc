@@ -0,0 +1,218 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::IceThermalStorage Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <array>
+#include <vector>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/CurveManager.hh>
+#include <EnergyPlus/DataHVACGlobals.hh>
+#include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataPlant.hh>
+#include <EnergyPlus/IceThermalStorage.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::IceThermalStorage;
+
+TEST_F(EnergyPlusFixture, IceThermalStorage_DetailedReusedSolutionMatchesRecompute)
+{
+    std::string const idf_objects = delimited_string({
+        "ThermalStorage:Ice:Detailed,",
+        "  Ice Tank,                !- Name",
+        "  ,                        !- Availability Schedule Name",
+        "  0.18,                    !- Capacity {GJ}",
+        "  Ice Tank Inlet Node,     !- Inlet Node Name",
+        "  Ice Tank Outlet Node,    !- Outlet Node Name",
+        "  QuadraticLinear,         !- Discharging Curve Object Type",
+        "  Ice Tank Discharging,    !- Discharging Curve Name",
+        "  QuadraticLinear,         !- Charging Curve Object Type",
+        "  Ice Tank Charging,       !- Charging Curve Name",
+        "  1.0,                     !- Timestep of the Curve Fit Data {hr}",
+        "  0.0,                     !- Parasitic Electric Load During Discharging {dimensionless}",
+        "  0.0,                     !- Parasitic Electric Load During Charging {dimensionless}",
+        "  0.0,                     !- Tank Loss Coefficient {dimensionless}",
+        "  0.0,                     !- Freezing Temperature of Storage Medium {C}",
+        "  InsideMelt;              !- Thaw Process Indicator",
+
+        "Curve:QuadraticLinear,",
+        "  Ice Tank Discharging,    !- Name",
+        "  0.0,                     !- Coefficient1 Constant",
+        "  0.5,                     !- Coefficient2 x",
+        "  0.0,                     !- Coefficient3 x**2",
+        "  0.4,                     !- Coefficient4 y",
+        "  0.0,                     !- Coefficient5 x*y",
+        "  0.0,                     !- Coefficient6 x**2*y",
+        "  0.0,                     !- Minimum Value of x",
+        "  1.0,                     !- Maximum Value of x",
+        "  0.0,                     !- Minimum Value of y",
+        "  2.0;                     !- Maximum Value of y",
+
+        "Curve:QuadraticLinear,",
+        "  Ice Tank Charging,       !- Name",
+        "  0.0,                     !- Coefficient1 Constant",
+        "  0.3,                     !- Coefficient2 x",
+        "  0.0,                     !- Coefficient3 x**2",
+        "  0.5,                     !- Coefficient4 y",
+        "  0.0,                     !- Coefficient5 x*y",
+        "  0.0,                     !- Coefficient6 x**2*y",
+        "  0.0,                     !- Minimum Value of x",
+        "  1.0,                     !- Maximum Value of x",
+        "  0.0,                     !- Minimum Value of y",
+        "  2.0;                     !- Maximum Value of y",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    GetIceStorageInput();
+    ASSERT_EQ(1, NumDetIceStorages);
+
+    auto &tank(DetIceStor(1));
+    int const inletNode = tank.PlantInNodeNum;
+    int const outletNode = tank.PlantOutNodeNum;
+
+    // a single locked loop so the tank takes whatever flow is on its inlet node
+    DataPlant::TotNumLoops = 1;
+    DataPlant::PlantLoop.allocate(1);
+    auto &loop(DataPlant::PlantLoop(1));
+    loop.FluidName = "WATER";
+    loop.FluidIndex = 1;
+    loop.LoopDemandCalcScheme = DataPlant::SingleSetPoint;
+    loop.LoopSide.allocate(2);
+    loop.LoopSide(1).FlowLock = DataPlant::FlowLocked;
+    loop.LoopSide(1).TotalBranches = 1;
+    loop.LoopSide(1).Branch.allocate(1);
+    loop.LoopSide(1).Branch(1).TotalComponents = 1;
+    loop.LoopSide(1).Branch(1).Comp.allocate(1);
+    loop.LoopSide(1).Branch(1).Comp(1).NodeNumIn = inletNode;
+    loop.LoopSide(1).Branch(1).Comp(1).NodeNumOut = outletNode;
+    tank.PlantLoopNum = 1;
+    tank.PlantLoopSideNum = 1;
+    tank.PlantBranchNum = 1;
+    tank.PlantCompNum = 1;
+    DataLoopNode::Node(inletNode).MassFlowRateMax = 3.0;
+    DataLoopNode::Node(inletNode).MassFlowRateMaxAvail = 3.0;
+
+    struct TankInputs
+    {
+        Real64 InletTemp;
+        Real64 SetPointTemp;
+        Real64 MassFlowRate;
+        Real64 IceFracRemaining;
+        Real64 IceFracOnCoil;
+        Real64 TimeStepSys;
+    };
+
+    auto simulate = [&](TankInputs const &inputs) {
+        DataLoopNode::Node(inletNode).Temp = inputs.InletTemp;
+        DataLoopNode::Node(inletNode).MassFlowRate = inputs.MassFlowRate;
+        DataLoopNode::Node(outletNode).TempSetPoint = inputs.SetPointTemp;
+        tank.IceFracRemaining = inputs.IceFracRemaining;
+        tank.IceFracOnCoil = inputs.IceFracOnCoil;
+        DataHVACGlobals::TimeStepSys = inputs.TimeStepSys;
+        IceNum = 1;
+        SimDetailedIceStorage();
+        return std::array<Real64, 5>{{tank.CompLoad, tank.OutletTemp, tank.TankOutletTemp, tank.TankMassFlowRate, tank.BypassMassFlowRate}};
+    };
+
+    auto recompute = [&](TankInputs const &inputs) {
+        tank.TankSolutionSaved = false;
+        return simulate(inputs);
+    };
+
+    // each call changes one input from the call before; discharging first, then charging, with both the
+    // direct and the iterated tank solutions in the mix
+    std::vector<TankInputs> const sequence = {
+        {10.0, 6.0, 1.0, 0.8, 0.8, 0.25},
+        {11.0, 6.0, 1.0, 0.8, 0.8, 0.25},
+        {11.0, 5.0, 1.0, 0.8, 0.8, 0.25},
+        {10.0, 5.0, 1.0, 0.8, 0.8, 0.25},
+        {10.0, 5.0, 1.5, 0.8, 0.8, 0.25},
+        {10.0, 5.0, 1.5, 0.6, 0.8, 0.25},
+        {10.0, 5.0, 1.5, 0.6, 0.8, 0.5},
+        {-5.0, -2.0, 1.0, 0.3, 0.3, 0.25},
+        {-4.0, -2.0, 1.0, 0.3, 0.3, 0.25},
+        {-4.0, -3.0, 1.0, 0.3, 0.3, 0.25},
+        {-4.0, -3.0, 1.5, 0.3, 0.3, 0.25},
+        {-4.0, -3.0, 1.5, 0.3, 0.5, 0.25},
+        {-4.0, -3.0, 1.5, 0.5, 0.5, 0.25},
+        {-4.0, -3.0, 1.5, 0.5, 0.5, 0.5},
+    };
+
+    simulate(sequence.front());
+    for (auto const &inputs : sequence) {
+        auto const changed = simulate(inputs);
+        EXPECT_TRUE(tank.TankSolutionSaved);
+        auto const repeated = simulate(inputs);
+        auto const fresh = recompute(inputs);
+        EXPECT_EQ(fresh, changed);
+        EXPECT_EQ(fresh, repeated);
+    }
+
+    // both setpoints are clipped to the same outlet temperature, but the loop load they imply still moves the tank solution
+    TankInputs const nearFreezing = {10.0, 0.4, 1.0, 0.8, 0.8, 0.25};
+    TankInputs const belowFreezing = {10.0, -3.0, 1.0, 0.8, 0.8, 0.25};
+    auto const nearFreezingSolution = simulate(nearFreezing);
+    auto const belowFreezingSolution = simulate(belowFreezing);
+    EXPECT_NE(nearFreezingSolution, belowFreezingSolution);
+    EXPECT_EQ(recompute(belowFreezing), belowFreezingSolution);
+
+    // an EMS override of the curve takes effect without any of the saved inputs changing
+    TankInputs const charging = sequence.back();
+    auto const curveSolution = simulate(charging);
+    CurveManager::PerfCurve(tank.ChargeCurveNum).EMSOverrideOn = true;
+    CurveManager::PerfCurve(tank.ChargeCurveNum).EMSOverrideCurveValue = 0.01;
+    auto const overriddenSolution = simulate(charging);
+    EXPECT_NE(curveSolution, overriddenSolution);
+    EXPECT_EQ(recompute(charging), overriddenSolution);
+}
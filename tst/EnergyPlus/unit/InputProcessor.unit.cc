@@ -53,13 +53,21 @@
 // EnergyPlus Headers
 #include <ConfiguredFunctions.hh>
 #include <EnergyPlus/DataOutputs.hh>
+#include <EnergyPlus/DataStringGlobals.hh>
+#include <EnergyPlus/FileSystem.hh>
 #include <EnergyPlus/GeneralRoutines.hh>
 #include <EnergyPlus/InputProcessing/InputProcessor.hh>
+#include <EnergyPlus/InputProcessing/InputValidation.hh>
 #include <EnergyPlus/SortAndStringUtilities.hh>
 
 #include "Fixtures/InputProcessorFixture.hh"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
 #include <fstream>
+#include <iterator>
+#include <limits>
 #include <map>
 #include <sstream>
 #include <string>
@@ -335,6 +343,56 @@ TEST_F(InputProcessorFixture, decode_encode_3)
     EXPECT_EQ(expected, encoded);
 }
 
+TEST_F(InputProcessorFixture, batch_run_object_deltas)
+{
+    std::string const inputFileName("batch_run_object_deltas.idf");
+    auto const writeInput = [&](std::string const &thickness) {
+        std::ofstream input(inputFileName, std::ofstream::out);
+        input << delimited_string({
+            "Building,Bldg,0.0,Suburbs,0.04,0.4,FullExterior,25,6;",
+            "GlobalGeometryRules,UpperLeftCorner,Counterclockwise,Relative;",
+            "Material,",
+            "  Insulation,              !- Name",
+            "  Rough,                   !- Roughness",
+            "  " + thickness + ",                    !- Thickness {m}",
+            "  0.04,                    !- Conductivity {W/m-K}",
+            "  30,                      !- Density {kg/m3}",
+            "  1200;                    !- Specific Heat {J/kg-K}",
+            "Material,",
+            "  Concrete,                !- Name",
+            "  MediumRough,             !- Roughness",
+            "  0.2,                     !- Thickness {m}",
+            "  1.7,                     !- Conductivity {W/m-K}",
+            "  2240,                    !- Density {kg/m3}",
+            "  840;                     !- Specific Heat {J/kg-K}",
+        });
+    };
+    writeInput("0.05");
+    DataStringGlobals::inputFileName = inputFileName;
+
+    // first run: the base file is decoded and the run's object deltas are merged into it, null removes an object
+    InputProcessor::setBatchRun(json::parse(R"({"Material": {"Insulation": {"thickness": 0.1}, "Concrete": null}})"));
+    inputProcessor->processInput();
+    EXPECT_DOUBLE_EQ(0.1, getEpJSON()["Material"]["Insulation"]["thickness"].get<double>());
+    EXPECT_TRUE(getEpJSON()["Material"].find("Concrete") == getEpJSON()["Material"].end());
+
+    // a later run starts from the decoded base file, not from the previous run's model or a reread of the file
+    writeInput("0.02");
+    inputProcessor = InputProcessor::factory();
+    InputProcessor::setBatchRun(json::object());
+    inputProcessor->processInput();
+    EXPECT_DOUBLE_EQ(0.05, getEpJSON()["Material"]["Insulation"]["thickness"].get<double>());
+    EXPECT_DOUBLE_EQ(0.2, getEpJSON()["Material"]["Concrete"]["thickness"].get<double>());
+
+    // outside a batch the file is decoded as it is on disk
+    InputProcessor::clearBatchRuns();
+    inputProcessor = InputProcessor::factory();
+    inputProcessor->processInput();
+    EXPECT_DOUBLE_EQ(0.02, getEpJSON()["Material"]["Insulation"]["thickness"].get<double>());
+
+    std::remove(inputFileName.c_str());
+}
+
 TEST_F(InputProcessorFixture, byte_order_mark)
 {
     auto const idf(delimited_string(
@@ -1626,6 +1684,55 @@ TEST_F(InputProcessorFixture, min_and_max_validation)
     }
 }
 
+TEST_F(InputProcessorFixture, validation_cache)
+{
+    json root = {
+        {"Building",
+         {{"Ref Bldg Medium Office New2004_v1.3_5.0",
+           {{"north_axis", 0.0000},
+            {"terrain", "City"},
+            {"loads_convergence_tolerance_value", 0.04},
+            {"temperature_convergence_tolerance_value", 0.2000},
+            {"solar_distribution", "FullInteriorAndExterior"},
+            {"maximum_number_of_warmup_days", 25},
+            {"minimum_number_of_warmup_days", 6}}}}},
+        {"GlobalGeometryRules",
+         {{"",
+           {{"starting_vertex_position", "UpperLeftCorner"},
+            {"vertex_entry_direction", "Counterclockwise"},
+            {"coordinate_system", "Relative"},
+            {"daylighting_reference_point_coordinate_system", "Relative"},
+            {"rectangular_surface_coordinate_system", "Relative"}}}}},
+        {"Zone", {{"Zone 1", {{"multiplier", 1}}}, {"Zone 2", {{"multiplier", 2}}}}},
+    };
+
+    std::string const cacheFileName("validation_cache.unit.txt");
+    if (FileSystem::fileExists(cacheFileName)) FileSystem::removeFile(cacheFileName);
+
+    Validation firstRun(InputProcessor::embeddedSchema());
+    EXPECT_TRUE(firstRun.validate(root, cacheFileName));
+    ASSERT_TRUE(FileSystem::fileExists(cacheFileName));
+    // schema key followed by one hash per Zone, unique objects are always validated so they are not cached
+    EXPECT_EQ(3u, read_lines_in_file(cacheFileName).size());
+
+    // an unchanged model validates from the cache
+    Validation secondRun(InputProcessor::embeddedSchema());
+    EXPECT_TRUE(secondRun.validate(root, cacheFileName));
+    EXPECT_TRUE(secondRun.errors().empty());
+
+    // a changed object is still validated
+    json changed = root;
+    changed["Zone"]["Zone 2"]["multiplier"] = -1;
+    Validation thirdRun(InputProcessor::embeddedSchema());
+    EXPECT_FALSE(thirdRun.validate(changed, cacheFileName));
+    EXPECT_FALSE(thirdRun.errors().empty());
+
+    // the failed run leaves the cache of the last valid model in place
+    EXPECT_EQ(3u, read_lines_in_file(cacheFileName).size());
+
+    FileSystem::removeFile(cacheFileName);
+}
+
 TEST_F(InputProcessorFixture, eat_whitespace)
 {
     size_t index = 0;
@@ -1857,6 +1964,70 @@ TEST_F(InputProcessorFixture, parse_number)
     EXPECT_FALSE(success);
 }
 
+TEST_F(InputProcessorFixture, parse_number_range_fallbacks)
+{
+    // numbers the in-place strtol/strtod conversion cannot hold go through stoll/stold, as before
+    size_t index = 0;
+    bool success = true;
+    json output;
+
+    // int boundaries stay int, one past them becomes a 64-bit integer
+    output = parse_number("2147483647,", index, success);
+    EXPECT_TRUE(output.is_number_integer());
+    EXPECT_EQ(std::numeric_limits<int>::max(), output.get<long long>());
+    EXPECT_EQ(10ul, index);
+    EXPECT_TRUE(success);
+
+    index = 0;
+    output = parse_number("-2147483648,", index, success);
+    EXPECT_EQ(std::numeric_limits<int>::min(), output.get<long long>());
+    EXPECT_EQ(11ul, index);
+
+    index = 0;
+    output = parse_number("2147483648,", index, success);
+    EXPECT_TRUE(output.is_number_integer());
+    EXPECT_EQ(2147483648ll, output.get<long long>());
+    EXPECT_EQ(10ul, index);
+    EXPECT_TRUE(success);
+
+    index = 0;
+    output = parse_number("-2147483649;", index, success);
+    EXPECT_EQ(-2147483649ll, output.get<long long>());
+    EXPECT_EQ(11ul, index);
+
+    index = 0;
+    output = parse_number("9223372036854775807,", index, success);
+    EXPECT_EQ(std::numeric_limits<long long>::max(), output.get<long long>());
+
+    // beyond a 64-bit integer stoll throws, as it did before
+    index = 0;
+    EXPECT_THROW(parse_number("9223372036854775808,", index, success), std::out_of_range);
+
+    // doubles that strtod reports out of range are converted by stold
+    index = 0;
+    output = parse_number("1.7976931348623157e308,", index, success);
+    EXPECT_EQ(std::numeric_limits<double>::max(), output.get<double>());
+    EXPECT_EQ(22ul, index);
+
+    index = 0;
+    output = parse_number("1e400,", index, success);
+    EXPECT_TRUE(output.is_number_float());
+    EXPECT_TRUE(std::isinf(output.get<double>()));
+    EXPECT_EQ(5ul, index);
+    EXPECT_TRUE(success);
+
+    index = 0;
+    output = parse_number("4.9e-324;", index, success);
+    EXPECT_EQ(std::numeric_limits<double>::denorm_min(), output.get<double>());
+    EXPECT_EQ(8ul, index);
+
+    index = 0;
+    output = parse_number("1e-400;", index, success);
+    EXPECT_EQ(0.0, output.get<double>());
+    EXPECT_EQ(6ul, index);
+    EXPECT_TRUE(success);
+}
+
 TEST_F(InputProcessorFixture, look_ahead)
 {
     std::string const test_input("B , ! t ; `");
@@ -1919,6 +2090,39 @@ TEST_F(InputProcessorFixture, next_token)
     EXPECT_EQ(IdfParser::Token::END, token);
 }
 
+TEST_F(InputProcessorFixture, decode_parallel_chunks)
+{
+    // Large enough to be cut into chunks; comments hold semicolons that must not end an object
+    std::string idf("Version,9.2;\n");
+    for (int i = 1; i <= 8000; ++i) {
+        idf += "Zone,\n  Zone " + std::to_string(i) + ", ! name; not the end\n  0, 0, 0, 0, 1, 1, autocalculate, autocalculate;\n";
+        idf += "Output:Variable,*,Zone Mean Air Temperature,Hourly; ! " + std::to_string(i) + ";\n";
+    }
+    ASSERT_GT(idf.size(), 1ul << 20);
+
+    bool success = true;
+    IdfParser sequential;
+    json const expected = sequential.decode(idf, getSchema(), success);
+    ASSERT_TRUE(success);
+
+    IdfParser parallel;
+    json const decoded = parallel.decode(idf, getSchema(), success, 4);
+    EXPECT_TRUE(success);
+    EXPECT_FALSE(parallel.hasErrors());
+    EXPECT_EQ(8000ul, decoded["Output:Variable"].size());
+    EXPECT_EQ(16001, decoded["Output:Variable"]["Output:Variable 8000"]["idf_order"].get<int>());
+    EXPECT_TRUE(expected == decoded);
+
+    // A name repeated in another chunk is reported as the sequential parse reports it
+    idf += "Zone, Zone 1;\n";
+    IdfParser sequentialDuplicate;
+    sequentialDuplicate.decode(idf, getSchema(), success);
+    IdfParser parallelDuplicate;
+    parallelDuplicate.decode(idf, getSchema(), success, 4);
+    EXPECT_EQ(sequentialDuplicate.errors(), parallelDuplicate.errors());
+    EXPECT_EQ(1ul, parallelDuplicate.errors().size());
+}
+
 TEST_F(InputProcessorFixture, getObjectItem_json1)
 {
     std::string const idf_objects = delimited_string({
@@ -3867,6 +4071,106 @@ TEST_F(InputProcessorFixture, FalseDuplicates_LowestLevel_AlphaNum) {
 
 }
 
+TEST_F(InputProcessorFixture, writeBinaryEpJSON_round_trip)
+{
+    std::string const idf_objects = delimited_string({
+        "Building,",
+        "  Ref Bldg Medium Office New2004_v1.3_5.0,",
+        "  0.0,",
+        "  City,",
+        "  0.04,",
+        "  0.2,",
+        "  FullInteriorAndExterior,",
+        "  25.0,",
+        "  6.0;",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    DataStringGlobals::outputDirPathName.clear();
+    DataStringGlobals::inputFileNameOnly = "writeBinaryEpJSON_round_trip";
+
+    for (std::string const format : {"CBOR", "MSGPACK", "UBJSON"}) {
+        inputProcessor->writeBinaryEpJSON(format);
+        std::string extension = format;
+        std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+        std::string const fileName = DataStringGlobals::inputFileNameOnly + "." + extension;
+        ASSERT_TRUE(FileSystem::fileExists(fileName)) << format;
+
+        std::ifstream binaryFile(fileName, std::ifstream::in | std::ifstream::binary);
+        std::vector<std::uint8_t> const encoded((std::istreambuf_iterator<char>(binaryFile)), std::istreambuf_iterator<char>());
+        binaryFile.close();
+        FileSystem::removeFile(fileName);
+
+        json decoded;
+        if (format == "CBOR") {
+            decoded = json::from_cbor(encoded);
+        } else if (format == "MSGPACK") {
+            decoded = json::from_msgpack(encoded);
+        } else {
+            decoded = json::from_ubjson(encoded);
+        }
+        EXPECT_EQ(getEpJSON(), decoded) << format;
+    }
+}
+
+TEST_F(InputProcessorFixture, embeddedSchema_shared)
+{
+    auto const schema = InputProcessor::embeddedSchema();
+    ASSERT_TRUE(schema != nullptr);
+    EXPECT_EQ(schema.get(), InputProcessor::embeddedSchema().get());
+    EXPECT_TRUE(schema->find("properties") != schema->end());
+
+    // a second input processor reuses the already decoded schema
+    auto const secondInputProcessor = InputProcessor::factory();
+    EXPECT_EQ(schema.get(), getSchema(*secondInputProcessor).get());
+    EXPECT_EQ(schema.get(), getSchema(*inputProcessor).get());
+}
+
+TEST_F(InputProcessorFixture, indexed_object_lookup_preserves_idf_order)
+{
+    std::string const idf_objects = delimited_string({
+        "ScheduleTypeLimits,",
+        "  Zeta;                   !- Name",
+        "ScheduleTypeLimits,",
+        "  Alpha;                  !- Name",
+        "ScheduleTypeLimits,",
+        "  Mid;                    !- Name",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    std::string const CurrentModuleObject = "ScheduleTypeLimits";
+    ASSERT_EQ(3, inputProcessor->getNumObjectsFound(CurrentModuleObject));
+
+    // epJSON stores objects sorted by name, so JSON order is Alpha, Mid, Zeta
+    EXPECT_EQ(2, inputProcessor->getIDFObjNum(CurrentModuleObject, 1));
+    EXPECT_EQ(3, inputProcessor->getIDFObjNum(CurrentModuleObject, 2));
+    EXPECT_EQ(1, inputProcessor->getIDFObjNum(CurrentModuleObject, 3));
+    EXPECT_EQ(3, inputProcessor->getJSONObjNum(CurrentModuleObject, 1));
+    EXPECT_EQ(1, inputProcessor->getJSONObjNum(CurrentModuleObject, 2));
+    EXPECT_EQ(2, inputProcessor->getJSONObjNum(CurrentModuleObject, 3));
+
+    // name lookups are case insensitive on both the object type and the name, and return idf order
+    EXPECT_EQ(1, inputProcessor->getObjectItemNum(CurrentModuleObject, "ZETA"));
+    EXPECT_EQ(2, inputProcessor->getObjectItemNum("scheduletypelimits", "alpha"));
+    EXPECT_EQ(3, inputProcessor->getObjectItemNum(CurrentModuleObject, "Mid"));
+    EXPECT_EQ(0, inputProcessor->getObjectItemNum(CurrentModuleObject, "Missing"));
+    EXPECT_EQ(-1, inputProcessor->getObjectItemNum(CurrentModuleObject + "x", "Alpha"));
+
+    int NumAlphas = 0;
+    int NumNumbers = 0;
+    int IOStatus = 0;
+    Array1D_string Alphas(3);
+    Array1D<Real64> Numbers(2, 0.0);
+    for (int item = 1; item <= 3; ++item) {
+        inputProcessor->getObjectItem(CurrentModuleObject, item, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus);
+        EXPECT_EQ(item, inputProcessor->getObjectItemNum(CurrentModuleObject, Alphas(1)));
+    }
+    inputProcessor->getObjectItem(CurrentModuleObject, 1, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus);
+    EXPECT_EQ("ZETA", Alphas(1));
+}
+
 /*
    TEST_F( InputProcessorFixture, processIDF_json )
    {
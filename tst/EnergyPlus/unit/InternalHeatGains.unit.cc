@@ -51,6 +51,7 @@
 #include <gtest/gtest.h>
 
 // EnergyPlus Headers
+#include <CurveManager.hh>
 #include <DataEnvironment.hh>
 #include <DataGlobals.hh>
 #include <DataHeatBalFanSys.hh>
@@ -65,6 +66,7 @@
 #include <HeatBalanceManager.hh>
 #include <InternalHeatGains.hh>
 #include <OutputReportTabular.hh>
+#include <Psychrometrics.hh>
 #include <ScheduleManager.hh>
 
 #include "Fixtures/EnergyPlusFixture.hh"
@@ -472,6 +474,12 @@ TEST_F(EnergyPlusFixture, InternalHeatGains_CheckZoneComponentLoadSubtotals)
     InternalHeatGains::SumAllInternalConvectionGains(zoneNum, totConvGains);
     EXPECT_EQ(totConvGains, expectedTotConvGains);
 
+    // Check a subset of gain types
+    Array1D_int peopleAndLightsTypes({DataHeatBalance::IntGainTypeOf_People, DataHeatBalance::IntGainTypeOf_Lights});
+    Real64 subsetConvGains = 0.0;
+    InternalHeatGains::SumInternalConvectionGainsByTypes(zoneNum, peopleAndLightsTypes, subsetConvGains);
+    EXPECT_EQ(subsetConvGains, convGains(DataHeatBalance::IntGainTypeOf_People) + convGains(DataHeatBalance::IntGainTypeOf_Lights));
+
     // Check subtotals used in zone component loads
     DataEnvironment::TotDesDays = 1;
     DataEnvironment::TotRunDesPersDays = 0;
@@ -510,6 +518,126 @@ TEST_F(EnergyPlusFixture, InternalHeatGains_CheckZoneComponentLoadSubtotals)
     convGains.deallocate();
 }
 
+TEST_F(EnergyPlusFixture, InternalHeatGains_SumGainsByTypesKeepsDeviceOrder)
+{
+
+    std::string const idf_objects = delimited_string({
+        "Zone,Zone1;",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    bool ErrorsFound(false);
+    HeatBalanceManager::GetZoneData(ErrorsFound);
+    ASSERT_FALSE(ErrorsFound);
+    InternalHeatGains::GetInternalHeatGainsInput();
+
+    // Gains whose floating point sum depends on the order they are added in
+    int zoneNum = 1;
+    Real64 bigPeopleGain = 1.0e16;
+    Real64 lightsGain = 1.0;
+    Real64 negativePeopleGain = -1.0e16;
+    SetupZoneInternalGain(zoneNum, "People", "Big People", DataHeatBalance::IntGainTypeOf_People, bigPeopleGain);
+    SetupZoneInternalGain(zoneNum, "Lights", "Lights", DataHeatBalance::IntGainTypeOf_Lights, lightsGain);
+    SetupZoneInternalGain(zoneNum, "People", "Negative People", DataHeatBalance::IntGainTypeOf_People, negativePeopleGain);
+
+    InternalHeatGains::UpdateInternalGainValues();
+
+    // Several types are summed in device order, as before the per-type sums were stored
+    Real64 deviceOrderSum = 0.0;
+    deviceOrderSum += bigPeopleGain;
+    deviceOrderSum += lightsGain;
+    deviceOrderSum += negativePeopleGain;
+    Array1D_int peopleAndLightsTypes({DataHeatBalance::IntGainTypeOf_People, DataHeatBalance::IntGainTypeOf_Lights});
+    Real64 subsetConvGains = -1.0;
+    InternalHeatGains::SumInternalConvectionGainsByTypes(zoneNum, peopleAndLightsTypes, subsetConvGains);
+    EXPECT_EQ(deviceOrderSum, subsetConvGains);
+
+    // A single type comes from the stored per-type sum
+    Real64 lightsConvGains = -1.0;
+    InternalHeatGains::SumInternalConvectionGainsByTypes(zoneNum, Array1D_int(1, DataHeatBalance::IntGainTypeOf_Lights), lightsConvGains);
+    EXPECT_EQ(lightsGain, lightsConvGains);
+    Real64 peopleConvGains = -1.0;
+    InternalHeatGains::SumInternalConvectionGainsByTypes(zoneNum, Array1D_int(1, DataHeatBalance::IntGainTypeOf_People), peopleConvGains);
+    EXPECT_EQ(bigPeopleGain + negativePeopleGain, peopleConvGains);
+}
+
+TEST_F(EnergyPlusFixture, InternalHeatGains_ZoneEquipGainRates)
+{
+    ScheduleManager::Schedule.allocate(2);
+    ScheduleManager::Schedule(1).CurrentValue = 0.8;
+    ScheduleManager::Schedule(2).CurrentValue = 0.5;
+
+    Array1D<DataHeatBalance::ZoneEquipData> equip(3);
+    equip(1).SchedPtr = 1;
+    equip(1).DesignLevel = 1234.5;
+    equip(1).FractionRadiant = 0.3;
+    equip(1).FractionLatent = 0.1;
+    equip(1).FractionLost = 0.05;
+    equip(1).FractionConvected = 0.55;
+    equip(1).CO2RateFactor = 3.45e-8;
+    equip(2).SchedPtr = 2;
+    equip(2).DesignLevel = 987.6;
+    equip(2).FractionRadiant = 0.7;
+    equip(2).FractionConvected = 0.3;
+    equip(2).CO2RateFactor = 1.2e-8;
+    equip(2).ManageDemand = true;
+    equip(2).DemandLimit = 1000.0;
+    equip(3).SchedPtr = 1;
+    equip(3).DesignLevel = 50.0;
+    equip(3).FractionRadiant = 0.2;
+    equip(3).FractionLatent = 0.4;
+    equip(3).FractionConvected = 0.4;
+
+    // the per-object update InitInternalHeatGains did for every object every time step
+    auto expectFullUpdate = [&](bool const CalcCO2) {
+        for (int Loop = 1; Loop <= 3; ++Loop) {
+            Real64 Q = equip(Loop).DesignLevel * ScheduleManager::GetCurrentScheduleValue(equip(Loop).SchedPtr);
+            if (equip(Loop).ManageDemand && (Q > equip(Loop).DemandLimit)) Q = equip(Loop).DemandLimit;
+            if (equip(Loop).EMSZoneEquipOverrideOn) Q = equip(Loop).EMSEquipPower;
+            EXPECT_EQ(Q, equip(Loop).Power);
+            EXPECT_EQ(Q * equip(Loop).FractionRadiant, equip(Loop).RadGainRate);
+            EXPECT_EQ(Q * equip(Loop).FractionConvected, equip(Loop).ConGainRate);
+            EXPECT_EQ(Q * equip(Loop).FractionLatent, equip(Loop).LatGainRate);
+            EXPECT_EQ(Q * equip(Loop).FractionLost, equip(Loop).LostRate);
+            EXPECT_EQ(Q - Q * equip(Loop).FractionLost, equip(Loop).TotGainRate);
+            EXPECT_EQ(CalcCO2 ? Q * equip(Loop).CO2RateFactor : 0.0, equip(Loop).CO2GainRate);
+        }
+    };
+
+    InternalHeatGains::CalcZoneEquipGainRates(equip, 3, false);
+    expectFullUpdate(false);
+    EXPECT_DOUBLE_EQ(1234.5 * 0.8, equip(1).Power);
+
+    // only the first schedule changes; the second object keeps its rates
+    ScheduleManager::Schedule(1).CurrentValue = 0.25;
+    InternalHeatGains::CalcZoneEquipGainRates(equip, 3, false);
+    expectFullUpdate(false);
+
+    // demand limiting and the EMS override
+    ScheduleManager::Schedule(2).CurrentValue = 1.0;
+    equip(3).EMSZoneEquipOverrideOn = true;
+    equip(3).EMSEquipPower = 75.0;
+    InternalHeatGains::CalcZoneEquipGainRates(equip, 3, false);
+    expectFullUpdate(false);
+    EXPECT_EQ(1000.0, equip(2).Power);
+    EXPECT_EQ(75.0, equip(3).Power);
+
+    // schedules off
+    equip(3).EMSZoneEquipOverrideOn = false;
+    ScheduleManager::Schedule(1).CurrentValue = 0.0;
+    ScheduleManager::Schedule(2).CurrentValue = 0.0;
+    InternalHeatGains::CalcZoneEquipGainRates(equip, 3, false);
+    expectFullUpdate(false);
+    EXPECT_EQ(0.0, equip(1).TotGainRate);
+
+    // gas equipment also sets the CO2 gain rate
+    ScheduleManager::Schedule(1).CurrentValue = 0.6;
+    ScheduleManager::Schedule(2).CurrentValue = 0.9;
+    InternalHeatGains::CalcZoneEquipGainRates(equip, 3, true);
+    expectFullUpdate(true);
+}
+
 TEST_F(EnergyPlusFixture, InternalHeatGains_ElectricEquipITE_ApproachTemperatures)
 {
 
@@ -756,6 +884,126 @@ TEST_F(EnergyPlusFixture, InternalHeatGains_ElectricEquipITE_DefaultCurves)
 
 }
 
+TEST_F(EnergyPlusFixture, InternalHeatGains_ElectricEquipITE_IdenticalRacks)
+{
+    // Racks with the same curves and inlet air reuse the curve and psychrometric results of the rack before them
+    auto iteRack = [](std::string const &name, std::string const &zoneName, std::string const &numUnits, std::string const &designTAirIn) {
+        return "ElectricEquipment:ITE:AirCooled," + name + "," + zoneName + ",,Watts/Unit,500," + numUnits +
+               ",,,,Data Center Servers Power fLoadTemp,0.4,0.0001,Data Center Servers Airflow fLoadTemp,ECM FanPower fFlow," + designTAirIn +
+               ",A3,ZoneAirNode,,,,,,0.9,,1,ITE-CPU,ITE-Fans,ITE-UPS;";
+    };
+
+    std::string const idf_objects = delimited_string({
+        "Zone,Zone1;",
+        "Zone,Zone2;",
+
+        iteRack("Rack A1", "Zone1", "100", "15"),
+        iteRack("Rack A2", "Zone1", "200", "15"), // same curves and inlet air as the rack before
+        iteRack("Rack B", "Zone1", "100", "20"),  // different design entering air temperature
+        iteRack("Rack A3", "Zone1", "100", "15"),
+        iteRack("Rack C", "Zone2", "100", "15"), // different inlet air
+
+        "Curve:Quadratic,",
+        "  ECM FanPower fFlow,      !- Name",
+        "  0.0,                     !- Coefficient1 Constant",
+        "  1.0,                     !- Coefficient2 x",
+        "  0.0,                     !- Coefficient3 x**2",
+        "  0.0,                     !- Minimum Value of x",
+        "  99.0;                    !- Maximum Value of x",
+        "",
+        "Curve:Biquadratic,",
+        "  Data Center Servers Power fLoadTemp,  !- Name",
+        "  -1.0,                    !- Coefficient1 Constant",
+        "  1.0,                     !- Coefficient2 x",
+        "  0.0,                     !- Coefficient3 x**2",
+        "  0.06667,                 !- Coefficient4 y",
+        "  0.0,                     !- Coefficient5 y**2",
+        "  0.0,                     !- Coefficient6 x*y",
+        "  0.0,                     !- Minimum Value of x",
+        "  1.5,                     !- Maximum Value of x",
+        "  -10,                     !- Minimum Value of y",
+        "  99.0,                    !- Maximum Value of y",
+        "  0.0,                     !- Minimum Curve Output",
+        "  99.0,                    !- Maximum Curve Output",
+        "  Dimensionless,           !- Input Unit Type for X",
+        "  Temperature,             !- Input Unit Type for Y",
+        "  Dimensionless;           !- Output Unit Type",
+        "",
+        "Curve:Biquadratic,",
+        "  Data Center Servers Airflow fLoadTemp,  !- Name",
+        "  -1.4,                    !- Coefficient1 Constant",
+        "  0.9,                     !- Coefficient2 x",
+        "  0.0,                     !- Coefficient3 x**2",
+        "  0.1,                     !- Coefficient4 y",
+        "  0.0,                     !- Coefficient5 y**2",
+        "  0.0,                     !- Coefficient6 x*y",
+        "  0.0,                     !- Minimum Value of x",
+        "  1.5,                     !- Maximum Value of x",
+        "  -10,                     !- Minimum Value of y",
+        "  99.0,                    !- Maximum Value of y",
+        "  0.0,                     !- Minimum Curve Output",
+        "  99.0,                    !- Maximum Curve Output",
+        "  Dimensionless,           !- Input Unit Type for X",
+        "  Temperature,             !- Input Unit Type for Y",
+        "  Dimensionless;           !- Output Unit Type",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    bool ErrorsFound(false);
+
+    HeatBalanceManager::GetZoneData(ErrorsFound);
+    ASSERT_FALSE(ErrorsFound);
+    DataHeatBalFanSys::MAT.allocate(2);
+    DataHeatBalFanSys::ZoneAirHumRat.allocate(2);
+
+    DataHeatBalFanSys::MAT(1) = 24.0;
+    DataHeatBalFanSys::ZoneAirHumRat(1) = 0.008;
+    DataHeatBalFanSys::MAT(2) = 27.5;
+    DataHeatBalFanSys::ZoneAirHumRat(2) = 0.011;
+
+    InternalHeatGains::GetInternalHeatGainsInput();
+    ASSERT_EQ(5, DataHeatBalance::NumZoneITEqStatements);
+    InternalHeatGains::CalcZoneITEq();
+
+    // every rack matches the curve and psychrometric calls each rack made before
+    for (int Loop = 1; Loop <= DataHeatBalance::NumZoneITEqStatements; ++Loop) {
+        auto const &rack = DataHeatBalance::ZoneITEq(Loop);
+        Real64 const OperSchedFrac = ScheduleManager::GetCurrentScheduleValue(rack.OperSchedPtr);
+        Real64 const CPULoadSchedFrac = ScheduleManager::GetCurrentScheduleValue(rack.CPULoadSchedPtr);
+        Real64 const TAirIn = DataHeatBalFanSys::MAT(rack.ZonePtr);
+        Real64 const WAirIn = DataHeatBalFanSys::ZoneAirHumRat(rack.ZonePtr);
+
+        Real64 const CPUPower =
+            max(rack.DesignCPUPower * OperSchedFrac * CurveManager::CurveValue(rack.CPUPowerFLTCurve, CPULoadSchedFrac, TAirIn), 0.0);
+        Real64 const CPUPowerAtDesign =
+            max(rack.DesignCPUPower * OperSchedFrac * CurveManager::CurveValue(rack.CPUPowerFLTCurve, CPULoadSchedFrac, rack.DesignTAirIn), 0.0);
+        Real64 const AirVolFlowFrac = max(CurveManager::CurveValue(rack.AirFlowFLTCurve, CPULoadSchedFrac, TAirIn), 0.0);
+        Real64 const AirVolFlowRate = rack.DesignAirVolFlowRate * OperSchedFrac * AirVolFlowFrac;
+        Real64 const AirVolFlowFracDesignT = max(CurveManager::CurveValue(rack.AirFlowFLTCurve, CPULoadSchedFrac, rack.DesignTAirIn), 0.0);
+        Real64 const FanPower = max(rack.DesignFanPower * OperSchedFrac * CurveManager::CurveValue(rack.FanPowerFFCurve, AirVolFlowFrac), 0.0);
+        Real64 const FanPowerAtDesign =
+            max(rack.DesignFanPower * OperSchedFrac * CurveManager::CurveValue(rack.FanPowerFFCurve, AirVolFlowFracDesignT), 0.0);
+        Real64 const AirMassFlowRate = AirVolFlowRate * Psychrometrics::PsyRhoAirFnPbTdbW(DataEnvironment::StdBaroPress, TAirIn, WAirIn);
+        Real64 const TAirOut = TAirIn + (CPUPower + FanPower) / AirMassFlowRate / Psychrometrics::PsyCpAirFnWTdb(WAirIn, TAirIn);
+
+        EXPECT_EQ(CPUPower, rack.CPUPower) << rack.Name;
+        EXPECT_EQ(CPUPowerAtDesign, rack.CPUPowerAtDesign) << rack.Name;
+        EXPECT_EQ(FanPower, rack.FanPower) << rack.Name;
+        EXPECT_EQ(FanPowerAtDesign, rack.FanPowerAtDesign) << rack.Name;
+        EXPECT_EQ(AirMassFlowRate, rack.AirMassFlow) << rack.Name;
+        EXPECT_EQ(TAirOut, rack.AirOutletDryBulbT) << rack.Name;
+        EXPECT_EQ(Psychrometrics::PsyTdpFnWPb(WAirIn, DataEnvironment::StdBaroPress), rack.AirInletDewpointT) << rack.Name;
+        EXPECT_EQ(Psychrometrics::PsyRhFnTdbWPb(TAirIn, WAirIn, DataEnvironment::StdBaroPress), rack.AirInletRelHum) << rack.Name;
+    }
+
+    // the racks really differ where the results must not be reused
+    EXPECT_NE(DataHeatBalance::ZoneITEq(1).CPUPowerAtDesign, DataHeatBalance::ZoneITEq(3).CPUPowerAtDesign);
+    EXPECT_EQ(DataHeatBalance::ZoneITEq(1).CPUPower, DataHeatBalance::ZoneITEq(4).CPUPower);
+    EXPECT_NE(DataHeatBalance::ZoneITEq(1).AirInletRelHum, DataHeatBalance::ZoneITEq(5).AirInletRelHum);
+    EXPECT_NE(DataHeatBalance::ZoneITEq(1).CPUPower, DataHeatBalance::ZoneITEq(5).CPUPower);
+}
+
 TEST_F(EnergyPlusFixture, InternalHeatGains_CheckThermalComfortSchedules)
 {
 
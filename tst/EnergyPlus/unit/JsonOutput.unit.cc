@@ -303,6 +303,43 @@ TEST_F(EnergyPlusFixture, JsonOutput_DataFrameInfo2)
     // EXPECT_EQ( expectedObject.dump(), OutputData.dump());
 }
 
+TEST_F(EnergyPlusFixture, JsonOutput_DataFrameStreaming)
+{
+    DataFrame dataFrame("Hourly");
+    dataFrame.setRDataFrameEnabled(true);
+    dataFrame.addVariable(Variable("SALESFLOOR INLET NODE:System Node Temperature", ReportingFrequency::Hourly, 1, 1, Unit::C));
+    dataFrame.setStreaming(true, false, false);
+    EXPECT_TRUE(dataFrame.streaming());
+
+    std::ostringstream json_stream;
+    DataGlobals::jsonOutputStreams.json_HRstream = &json_stream;
+
+    dataFrame.newRow(1, 1, 1, 0);
+    dataFrame.pushVariableValue(1, 20.5);
+    EXPECT_EQ("{\"Cols\":[{\"Units\":\"C\",\"Variable\":\"SALESFLOOR INLET NODE:System Node Temperature\"}],\"ReportFrequency\":\"Hourly\"}\n",
+              json_stream.str());
+
+    dataFrame.newRow(1, 1, 2, 0);
+    dataFrame.pushVariableValue(1, 21.0);
+    dataFrame.newRow(1, 1, 3, 0);
+    dataFrame.pushVariableValue(1, 21.5);
+
+    // only the row in progress is held in memory
+    EXPECT_EQ(1u, dataFrame.lastVariable().numValues());
+
+    dataFrame.writeReport(true, false, false);
+    DataGlobals::jsonOutputStreams.json_HRstream = nullptr;
+
+    EXPECT_EQ(delimited_string({
+                  "{\"Cols\":[{\"Units\":\"C\",\"Variable\":\"SALESFLOOR INLET NODE:System Node Temperature\"}],\"ReportFrequency\":\"Hourly\"}",
+                  "{\"01/01 01:00:00\":[20.5]}",
+                  "{\"01/01 02:00:00\":[21.0]}",
+                  "{\"01/01 03:00:00\":[21.5]}",
+              }),
+              json_stream.str());
+    EXPECT_EQ(0u, dataFrame.lastVariable().numValues());
+}
+
 TEST_F(EnergyPlusFixture, JsonOutput_TableInfo)
 {
 
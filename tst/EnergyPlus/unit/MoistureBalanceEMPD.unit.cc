@@ -156,6 +156,105 @@ TEST_F(EnergyPlusFixture, CheckEMPDCalc)
     DataMoistureBalance::RhoVaporAirIn.deallocate();
 }
 
+TEST_F(EnergyPlusFixture, CheckEMPDCalc_Batched)
+{
+    std::string const idf_objects =
+        delimited_string({"Material,",
+                          "Concrete,                !- Name",
+                          "Rough,                   !- Roughness",
+                          "0.152,                   !- Thickness {m}",
+                          "0.3,                     !- Conductivity {W/m-K}",
+                          "1000,                    !- Density {kg/m3}",
+                          "950,                     !- Specific Heat {J/kg-K}",
+                          "0.900000,                !- Thermal Absorptance",
+                          "0.600000,                !- Solar Absorptance",
+                          "0.600000;                !- Visible Absorptance",
+                          "MaterialProperty:MoisturePenetrationDepth:Settings,",
+                          "Concrete,                !- Name",
+                          "6.554,                     !- Water Vapor Diffusion Resistance Factor {dimensionless} (mu)",
+                          "0.0661,                   !- Moisture Equation Coefficient a {dimensionless} (MoistACoeff)",
+                          "1,                       !- Moisture Equation Coefficient b {dimensionless} (MoistBCoeff)",
+                          "0,                       !- Moisture Equation Coefficient c {dimensionless} (MoistCCoeff)",
+                          "1,                       !- Moisture Equation Coefficient d {dimensionless} (MoistDCoeff)",
+                          "0.006701,                    !- Surface-layer penetrtion depth {m} (dEMPD)",
+                          "0.013402,                    !- Deep-layer penetration depth {m} (dEPMDdeep)",
+                          "0,                       !- Coating layer permability {m} (CoatingThickness)",
+                          "1;                       !- Coating layer water vapor diffusion resistance factor {dimensionless} (muCoating)"});
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    bool errors_found(false);
+    HeatBalanceManager::GetMaterialData(errors_found);
+    ASSERT_FALSE(errors_found) << "Errors in GetMaterialData";
+
+    // Surfaces, all in zone 1 with the same construction and moisture state
+    using DataSurfaces::TotSurfaces;
+    TotSurfaces = 3;
+    DataSurfaces::Surface.allocate(TotSurfaces);
+    for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+        DataSurfaces::SurfaceData &surface = DataSurfaces::Surface(SurfNum);
+        surface.Name = "Surface" + std::to_string(SurfNum);
+        surface.Area = 1.0;
+        surface.HeatTransSurf = true;
+        surface.Zone = 1;
+        surface.Construction = 1;
+    }
+
+    // Zone
+    DataHeatBalFanSys::ZoneAirHumRat.allocate(1);
+    DataMoistureBalance::RhoVaporAirIn.allocate(TotSurfaces);
+    DataMoistureBalance::HMassConvInFD.allocate(TotSurfaces);
+    DataHeatBalFanSys::MAT.allocate(1);
+    DataHeatBalFanSys::MAT(1) = 20.0;
+    DataHeatBalFanSys::ZoneAirHumRat(1) = 0.0061285406810457849;
+
+    // Construction
+    DataHeatBalance::Construct.allocate(1);
+    DataHeatBalance::ConstructionData &construction = DataHeatBalance::Construct(1);
+    construction.TotLayers = 1;
+    construction.LayerPoint(construction.TotLayers) = UtilityRoutines::FindItemInList("CONCRETE", DataHeatBalance::Material);
+
+    // Initialize and get inputs
+    MoistureBalanceEMPDManager::InitMoistureBalanceEMPD();
+
+    // Set up conditions
+    DataGlobals::TimeStepZone = 0.25;
+    DataEnvironment::OutBaroPress = 101325.;
+    DataHeatBalFanSys::MAT(1) = 19.901185713164697;
+    Array1D<Real64> TempSurfIn(TotSurfaces, 19.907302679986064);
+    Array1D<Real64> TempSat(TotSurfaces, 0.0);
+    std::vector<int> SurfNums;
+    for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+        DataMoistureBalanceEMPD::RVSurface(SurfNum) = 0.007077173214149593;
+        DataMoistureBalanceEMPD::RVSurfaceOld(SurfNum) = DataMoistureBalanceEMPD::RVSurface(SurfNum);
+        DataMoistureBalance::HMassConvInFD(SurfNum) = 0.0016826898264131584;
+        DataMoistureBalance::RhoVaporAirIn(SurfNum) = 0.0073097913062508896;
+        DataMoistureBalanceEMPD::RVSurfLayer(SurfNum) = 0.007038850125652322;
+        DataMoistureBalanceEMPD::RVDeepLayer(SurfNum) = 0.0051334905162138695;
+        DataMoistureBalanceEMPD::RVdeepOld(SurfNum) = 0.0051334905162138695;
+        DataMoistureBalanceEMPD::RVSurfLayerOld(SurfNum) = 0.007038850125652322;
+        SurfNums.push_back(SurfNum);
+    }
+
+    // Do calcs, every surface should match the single surface result in CheckEMPDCalc
+    MoistureBalanceEMPDManager::ManageMoistureBalanceEMPDSurfaces(SurfNums, TempSurfIn, TempSat);
+
+    for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+        auto const &report_vars = MoistureBalanceEMPDManager::EMPDReportVars(SurfNum);
+        EXPECT_DOUBLE_EQ(6.3445188238394508, TempSat(SurfNum));
+        EXPECT_DOUBLE_EQ(0.0071762141417078054, DataMoistureBalanceEMPD::RVSurface(SurfNum));
+        EXPECT_DOUBLE_EQ(0.00000076900234067835945, report_vars.mass_flux_deep);
+        EXPECT_DOUBLE_EQ(-0.00000019077843350248091, report_vars.mass_flux_zone);
+        EXPECT_DOUBLE_EQ(0.0070186500259181136, DataMoistureBalanceEMPD::RVSurfLayer(SurfNum));
+        EXPECT_DOUBLE_EQ(0.0051469229632164605, DataMoistureBalanceEMPD::RVDeepLayer(SurfNum));
+        EXPECT_DOUBLE_EQ(-0.47694608375620229, DataMoistureBalanceEMPD::HeatFluxLatent(SurfNum));
+    }
+
+    // Clean up
+    DataHeatBalFanSys::ZoneAirHumRat.deallocate();
+    DataMoistureBalance::RhoVaporAirIn.deallocate();
+}
+
 TEST_F(EnergyPlusFixture, EMPDAutocalcDepth)
 {
     std::string const idf_objects =
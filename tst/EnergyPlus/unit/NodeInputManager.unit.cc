@@ -47,6 +47,9 @@
 
 // EnergyPlus::NodeInputManager Unit Tests
 
+// C++ Headers
+#include <cstddef>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 
@@ -140,4 +143,137 @@ TEST_F(EnergyPlusFixture, CheckUniqueNodesTest_Test1)
     EndUniqueNodeCheck("Context");
 }
 
+TEST_F(EnergyPlusFixture, AssignNodeNumber_ReusesExistingNames)
+{
+    bool ErrorsFound(false);
+
+    EXPECT_EQ(1, AssignNodeNumber("NODE 1", DataLoopNode::NodeType_Air, ErrorsFound));
+    EXPECT_EQ(2, AssignNodeNumber("NODE 2", DataLoopNode::NodeType_Air, ErrorsFound));
+    EXPECT_EQ(3, AssignNodeNumber("NODE 3", DataLoopNode::NodeType_Unknown, ErrorsFound));
+    EXPECT_EQ(2, AssignNodeNumber("NODE 2", DataLoopNode::NodeType_Unknown, ErrorsFound));
+    EXPECT_EQ(3, AssignNodeNumber("NODE 3", DataLoopNode::NodeType_Water, ErrorsFound));
+    EXPECT_EQ(1, AssignNodeNumber("NODE 1", DataLoopNode::NodeType_Air, ErrorsFound));
+    EXPECT_FALSE(ErrorsFound);
+
+    EXPECT_EQ(3, NumOfUniqueNodeNames);
+    EXPECT_EQ(1, NodeRef(2));
+    EXPECT_EQ(DataLoopNode::NodeType_Water, DataLoopNode::Node(3).FluidType);
+    EXPECT_EQ("NODE 3", DataLoopNode::NodeID(3));
+}
+
+TEST_F(EnergyPlusFixture, FindNodeNumber_UsesRegisteredNames)
+{
+    bool ErrorsFound(false);
+
+    EXPECT_EQ(0, FindNodeNumber("NODE 1"));
+    AssignNodeNumber("NODE 1", DataLoopNode::NodeType_Air, ErrorsFound);
+    AssignNodeNumber("NODE 2", DataLoopNode::NodeType_Air, ErrorsFound);
+    EXPECT_EQ(2, FindNodeNumber("NODE 2"));
+    EXPECT_EQ(0, FindNodeNumber("Node 2"));
+    EXPECT_EQ(0, FindNodeNumber("NODE 3"));
+    AssignNodeNumber("NODE 3", DataLoopNode::NodeType_Air, ErrorsFound);
+    EXPECT_EQ(3, FindNodeNumber("NODE 3"));
+
+    // A uniqueness check starts over in each context
+    bool UniqueNodeError(false);
+    InitUniqueNodeCheck("Context");
+    CheckUniqueNodes("NodeFieldName", "NodeNumber", UniqueNodeError, _, 2, "ObjectName");
+    CheckUniqueNodes("NodeFieldName", "NodeName", UniqueNodeError, "NODE 2", _, "ObjectName");
+    EXPECT_TRUE(UniqueNodeError);
+    EndUniqueNodeCheck("Context");
+
+    UniqueNodeError = false;
+    InitUniqueNodeCheck("Context");
+    CheckUniqueNodes("NodeFieldName", "NodeName", UniqueNodeError, "NODE 2", _, "ObjectName");
+    EXPECT_FALSE(UniqueNodeError);
+    EndUniqueNodeCheck("Context");
+}
+
+TEST_F(EnergyPlusFixture, NodeData_MemberOrder)
+{
+    // the state every component touches on each pass fits in the first cache line
+    EXPECT_EQ(0u, offsetof(NodeData, Temp));
+    EXPECT_LE(offsetof(NodeData, MassFlowRate) + sizeof(Real64), 64u);
+    EXPECT_LE(offsetof(NodeData, HumRat) + sizeof(Real64), 64u);
+    EXPECT_LE(offsetof(NodeData, Enthalpy) + sizeof(Real64), 64u);
+    EXPECT_LE(offsetof(NodeData, Press) + sizeof(Real64), 64u);
+    EXPECT_LE(offsetof(NodeData, MassFlowRateMinAvail) + sizeof(Real64), 64u);
+    EXPECT_LE(offsetof(NodeData, MassFlowRateMaxAvail) + sizeof(Real64), 64u);
+    EXPECT_LE(offsetof(NodeData, Quality) + sizeof(Real64), 64u);
+
+    // the defaults are unchanged by the reordering
+    NodeData const defaultNode;
+    EXPECT_EQ(0, defaultNode.FluidType);
+    EXPECT_EQ(0, defaultNode.FluidIndex);
+    EXPECT_EQ(0.0, defaultNode.Temp);
+    EXPECT_EQ(0.0, defaultNode.TempMin);
+    EXPECT_EQ(0.0, defaultNode.TempMax);
+    EXPECT_EQ(SensedNodeFlagValue, defaultNode.TempSetPoint);
+    EXPECT_EQ(0.0, defaultNode.MassFlowRate);
+    EXPECT_EQ(0.0, defaultNode.MassFlowRateMin);
+    EXPECT_EQ(SensedNodeFlagValue, defaultNode.MassFlowRateMax);
+    EXPECT_EQ(SensedNodeFlagValue, defaultNode.HumRatMin);
+    EXPECT_EQ(SensedNodeFlagValue, defaultNode.HumRatMax);
+    EXPECT_EQ(SensedNodeFlagValue, defaultNode.HumRatSetPoint);
+    EXPECT_EQ(SensedNodeFlagValue, defaultNode.TempSetPointHi);
+    EXPECT_EQ(SensedNodeFlagValue, defaultNode.TempSetPointLo);
+    EXPECT_EQ(-1.0, defaultNode.Height);
+    EXPECT_FALSE(defaultNode.IsLocalNode);
+    EXPECT_FALSE(defaultNode.EMSOverrideOutAirDryBulb);
+    EXPECT_FALSE(defaultNode.SPMNodeWetBulbRepReq);
+    EXPECT_FALSE(defaultNode.plantNodeErrorMsgIssued);
+
+    // the member constructor keeps its parameter order, each argument landing in its own member
+    NodeData const node(1, 2, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0, 13.0, 14.0, 15.0, 16.0, 17.0, 18.0, 19.0, 20.0, 21.0,
+                        22.0, 23.0, 24.0, 25.0, true, 27, 28, 29, 30, 31.0, true, 33.0, 34.0, false, 36.0, 37.0, true, 39.0, 40.0, false,
+                        42.0, 43.0, 44.0, 45.0, 46.0, true);
+    EXPECT_EQ(1, node.FluidType);
+    EXPECT_EQ(2, node.FluidIndex);
+    EXPECT_EQ(3.0, node.Temp);
+    EXPECT_EQ(4.0, node.TempMin);
+    EXPECT_EQ(5.0, node.TempMax);
+    EXPECT_EQ(6.0, node.TempSetPoint);
+    EXPECT_EQ(7.0, node.TempLastTimestep);
+    EXPECT_EQ(8.0, node.MassFlowRateRequest);
+    EXPECT_EQ(9.0, node.MassFlowRate);
+    EXPECT_EQ(10.0, node.MassFlowRateMin);
+    EXPECT_EQ(11.0, node.MassFlowRateMax);
+    EXPECT_EQ(12.0, node.MassFlowRateMinAvail);
+    EXPECT_EQ(13.0, node.MassFlowRateMaxAvail);
+    EXPECT_EQ(14.0, node.MassFlowRateSetPoint);
+    EXPECT_EQ(15.0, node.Quality);
+    EXPECT_EQ(16.0, node.Press);
+    EXPECT_EQ(17.0, node.Enthalpy);
+    EXPECT_EQ(18.0, node.EnthalpyLastTimestep);
+    EXPECT_EQ(19.0, node.HumRat);
+    EXPECT_EQ(20.0, node.HumRatMin);
+    EXPECT_EQ(21.0, node.HumRatMax);
+    EXPECT_EQ(22.0, node.HumRatSetPoint);
+    EXPECT_EQ(23.0, node.TempSetPointHi);
+    EXPECT_EQ(24.0, node.TempSetPointLo);
+    EXPECT_EQ(25.0, node.Height);
+    EXPECT_TRUE(node.IsLocalNode);
+    EXPECT_EQ(27, node.OutAirDryBulbSchedNum);
+    EXPECT_EQ(28, node.OutAirWetBulbSchedNum);
+    EXPECT_EQ(29, node.OutAirWindSpeedSchedNum);
+    EXPECT_EQ(30, node.OutAirWindDirSchedNum);
+    EXPECT_EQ(31.0, node.OutAirDryBulb);
+    EXPECT_TRUE(node.EMSOverrideOutAirDryBulb);
+    EXPECT_EQ(33.0, node.EMSValueForOutAirDryBulb);
+    EXPECT_EQ(34.0, node.OutAirWetBulb);
+    EXPECT_FALSE(node.EMSOverrideOutAirWetBulb);
+    EXPECT_EQ(36.0, node.EMSValueForOutAirWetBulb);
+    EXPECT_EQ(37.0, node.OutAirWindSpeed);
+    EXPECT_TRUE(node.EMSOverrideOutAirWindSpeed);
+    EXPECT_EQ(39.0, node.EMSValueForOutAirWindSpeed);
+    EXPECT_EQ(40.0, node.OutAirWindDir);
+    EXPECT_FALSE(node.EMSOverrideOutAirWindDir);
+    EXPECT_EQ(42.0, node.EMSValueForOutAirWindDir);
+    EXPECT_EQ(43.0, node.CO2);
+    EXPECT_EQ(44.0, node.CO2SetPoint);
+    EXPECT_EQ(45.0, node.GenContam);
+    EXPECT_EQ(46.0, node.GenContamSetPoint);
+    EXPECT_TRUE(node.SPMNodeWetBulbRepReq);
+}
+
 } // namespace EnergyPlus
@@ -54,13 +54,23 @@
 #include "Fixtures/SQLiteFixture.hh"
 #include <EnergyPlus/DataEnvironment.hh>
 #include <EnergyPlus/DataHVACGlobals.hh>
+#include <EnergyPlus/DataStringGlobals.hh>
+#include <EnergyPlus/General.hh>
 #include <EnergyPlus/InputProcessing/InputProcessor.hh>
+#include <EnergyPlus/LiveOutputChannel.hh>
 #include <EnergyPlus/OutputProcessor.hh>
 #include <EnergyPlus/OutputReportTabular.hh>
 #include <EnergyPlus/PurchasedAirManager.hh>
 #include <EnergyPlus/WeatherManager.hh>
+#include <EnergyPlus/public/LiveOutputReader.h>
 
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include <map>
+#include <memory>
 
 using namespace EnergyPlus::PurchasedAirManager;
 using namespace EnergyPlus::WeatherManager;
@@ -760,6 +770,39 @@ namespace OutputProcessor {
         EXPECT_EQ(reportExtendedData, reportExtendedDataResults);
     }
 
+    TEST_F(EnergyPlusFixture, OutputProcessor_produceMinMaxString)
+    {
+        int DateValue;
+        General::EncodeMonDayHrMin(DateValue, 12, 21, 1, 10);
+
+        std::string String(" 4283136.251683925 ");
+        ProduceMinMaxString(String, DateValue, ReportingFrequency::Daily);
+        EXPECT_EQ("4283136.251683925, 1,10", String);
+
+        String = "-0.5";
+        ProduceMinMaxString(String, DateValue, ReportingFrequency::Monthly);
+        EXPECT_EQ("-0.5,21, 1,10", String);
+
+        String = "0.0";
+        ProduceMinMaxString(String, DateValue, ReportingFrequency::Simulation);
+        EXPECT_EQ("0.0,12,21, 1,10", String);
+
+        String = "999.9";
+        ProduceMinMaxString(String, DateValue, ReportingFrequency::Hourly);
+        EXPECT_EQ("", String);
+
+        DataGlobals::MinutesPerTimeStep = 10;
+        General::EncodeMonDayHrMin(DateValue, 3, 5, 24, 60);
+        String = "1.5";
+        ProduceMinMaxStringWStartMinute(String, DateValue, ReportingFrequency::Hourly);
+        EXPECT_EQ("1.5,51:60", String);
+
+        General::EncodeMonDayHrMin(DateValue, 3, 5, 7, 10);
+        String = "1.5";
+        ProduceMinMaxStringWStartMinute(String, DateValue, ReportingFrequency::Yearly);
+        EXPECT_EQ("1.5, 3, 5, 7,01:10", String);
+    }
+
     TEST_F(SQLiteFixture, OutputProcessor_writeReportRealData)
     {
         EnergyPlus::sqlite->createSQLiteTimeIndexRecord(4, 1, 1, 0, 2017);
@@ -2886,6 +2929,48 @@ namespace OutputProcessor {
         EXPECT_EQ(true, ReqRepVars(5).Used);
     }
 
+    TEST_F(SQLiteFixture, OutputProcessor_checkReportVariableMixedKeys)
+    {
+        std::string const idf_objects = delimited_string({
+            "Output:Variable,living,Zone Mean Air Temperature,hourly;",
+            "Output:Variable,*,Site Outdoor Air Drybulb Temperature,hourly;",
+            "Output:Variable,GAR.*,Zone Mean Air Temperature,timestep;",
+            "Output:Variable,*,Zone Mean Air Temperature,daily;",
+            "Output:Variable,Attic,Site Outdoor Air Drybulb Temperature,monthly;",
+        });
+
+        ASSERT_TRUE(process_idf(idf_objects));
+
+        InitializeOutput();
+        GetReportVariableInput();
+
+        // a plain key matches regardless of case, and the blank key request applies to every zone
+        CheckReportVariable("LIVING", "zone mean air temperature");
+        ASSERT_EQ(2, NumExtraVars);
+        EXPECT_EQ(1, ReportList(1));
+        EXPECT_EQ(4, ReportList(2));
+
+        // a regular expression key is matched case insensitively
+        CheckReportVariable("Garage1", "Zone Mean Air Temperature");
+        ASSERT_EQ(2, NumExtraVars);
+        EXPECT_EQ(3, ReportList(1));
+        EXPECT_EQ(4, ReportList(2));
+
+        // requests for other variables are not considered
+        CheckReportVariable("Attic", "Zone Mean Air Temperature");
+        ASSERT_EQ(1, NumExtraVars);
+        EXPECT_EQ(4, ReportList(1));
+
+        CheckReportVariable("Zone 1", "Zone Air Relative Humidity");
+        EXPECT_EQ(0, NumExtraVars);
+
+        EXPECT_TRUE(ReqRepVars(1).Used);
+        EXPECT_TRUE(ReqRepVars(3).Used);
+        EXPECT_TRUE(ReqRepVars(4).Used);
+        EXPECT_FALSE(ReqRepVars(2).Used);
+        EXPECT_FALSE(ReqRepVars(5).Used);
+    }
+
     TEST_F(SQLiteFixture, OutputProcessor_getCustomMeterInput)
     {
         std::string const idf_objects = delimited_string({
@@ -2980,6 +3065,71 @@ namespace OutputProcessor {
         }
     }
 
+    TEST_F(SQLiteFixture, OutputProcessor_meterMatrixMatchesUpdateMeterValues)
+    {
+        std::string const idf_objects = delimited_string({
+            "  Meter:Custom,",
+            "    MyGeneralLights,         !- Name",
+            "    Electricity,             !- Fuel Type",
+            "    SPACE1-1 Lights 1,       !- Key Name 1",
+            "    Lights Electric Energy,  !- Output Variable or Meter Name 1",
+            "    SPACE3-1 Lights 1,       !- Key Name 2",
+            "    Lights Electric Energy;  !- Output Variable or Meter Name 2",
+        });
+
+        ASSERT_TRUE(process_idf(idf_objects));
+
+        Real64 light_consumption = 0;
+        Real64 fan_consumption = 0;
+        SetupOutputVariable("Lights Electric Energy", OutputProcessor::Unit::J, light_consumption, "Zone", "Sum", "SPACE1-1 LIGHTS 1", _,
+                            "Electricity", "InteriorLights", "GeneralLights", "Building", "SPACE1-1", 1, 1);
+        SetupOutputVariable("Lights Electric Energy", OutputProcessor::Unit::J, light_consumption, "Zone", "Sum", "SPACE2-1 LIGHTS 1", _,
+                            "Electricity", "InteriorLights", "GeneralLights", "Building", "SPACE2-1", 2, 1);
+        SetupOutputVariable("Fan Electric Energy", OutputProcessor::Unit::J, fan_consumption, "System", "Sum", "SUPPLY FAN 1", _, "Electricity",
+                            "Fans", "General", "System");
+        SetupOutputVariable("Lights Electric Energy", OutputProcessor::Unit::J, light_consumption, "Zone", "Sum", "SPACE3-1 LIGHTS 1", _,
+                            "Electricity", "InteriorLights", "TaskLights", "Building", "SPACE3-1", 3, 2);
+
+        bool errors_found = false;
+        GetCustomMeterInput(errors_found);
+        ASSERT_FALSE(errors_found);
+
+        BuildActiveVariableLists();
+        ASSERT_EQ(4u, MeteredRVariables.size());
+        ASSERT_EQ(std::size_t(NumEnergyMeters + 1), MeterMatrixRowStart.size());
+
+        for (int Loop = 1; Loop <= NumOfRVariable; ++Loop) {
+            RVariableTypes(Loop).VarPtr().TSValue = 0.1 * Loop + 1.0 / 3.0;
+        }
+
+        MeterValue.dimension(NumEnergyMeters, 0.0);
+        UpdateAllMeterValues();
+        Array1D<Real64> const matrixMeterValues(MeterValue);
+
+        MeterValue = 0.0;
+        for (int IndexType = 1; IndexType <= 2; ++IndexType) {
+            for (int Loop = 1; Loop <= NumOfRVariable; ++Loop) {
+                if (RVariableTypes(Loop).IndexType != IndexType) continue;
+                auto &rVar(RVariableTypes(Loop).VarPtr());
+                auto &meterArray(VarMeterArrays(rVar.MeterArrayPtr));
+                if (meterArray.NumOnCustomMeters <= 0) {
+                    UpdateMeterValues(rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult, meterArray.NumOnMeters, meterArray.OnMeters);
+                } else {
+                    UpdateMeterValues(rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult, meterArray.NumOnMeters, meterArray.OnMeters,
+                                      meterArray.NumOnCustomMeters, meterArray.OnCustomMeters);
+                }
+            }
+        }
+
+        for (int Meter = 1; Meter <= NumEnergyMeters; ++Meter) {
+            EXPECT_EQ(MeterValue(Meter), matrixMeterValues(Meter)) << EnergyMeters(Meter).Name;
+        }
+
+        int myGeneralLights = GetMeterIndex("MYGENERALLIGHTS");
+        ASSERT_GT(myGeneralLights, 0);
+        EXPECT_DOUBLE_EQ(RVariableTypes(1).VarPtr().TSValue + RVariableTypes(4).VarPtr().TSValue * 6, matrixMeterValues(myGeneralLights));
+    }
+
     TEST_F(SQLiteFixture, OutputProcessor_attachMeters)
     {
         std::string const idf_objects = delimited_string({
@@ -3912,6 +4062,336 @@ namespace OutputProcessor {
         EXPECT_EQ(" [swamps/county]", unitStringFromDDitem(9));
     }
 
+    TEST_F(SQLiteFixture, OutputProcessor_writeBinaryOutput)
+    {
+        std::string const binFileName("eplusout_binary_test.bin");
+        DataStringGlobals::outputBinFileName = binFileName;
+        OpenBinaryOutputFile();
+        ASSERT_TRUE(bin_stream.is_open());
+
+        WriteReportVariableDictionaryItem(ReportingFrequency::Hourly,
+                                          StoreType::Averaged,
+                                          1,
+                                          0,
+                                          "Zone",
+                                          "1",
+                                          "Environment",
+                                          "Site Outdoor Air Drybulb Temperature",
+                                          1,
+                                          OutputProcessor::Unit::C,
+                                          _,
+                                          _);
+        WriteReportRealData(1, "1", 999.9, StoreType::Summed, 1, ReportingFrequency::Hourly, 0.0, 0, 0.0, 0);
+        WriteReportRealData(1, "1", 616771620.98702729, StoreType::Summed, 1, ReportingFrequency::Daily, 4283136.2516839253, 12210110,
+                            4283136.2587211775, 12212460);
+        CloseBinaryOutputFile();
+        EXPECT_FALSE(bin_stream.is_open());
+
+        std::ifstream binFile(binFileName, std::ios::in | std::ios::binary);
+        ASSERT_TRUE(binFile.good());
+        std::string const contents((std::istreambuf_iterator<char>(binFile)), std::istreambuf_iterator<char>());
+        binFile.close();
+        std::remove(binFileName.c_str());
+
+        std::size_t pos(0);
+        auto readString = [&](std::size_t const length) {
+            std::string const value(contents.substr(pos, length));
+            pos += length;
+            return value;
+        };
+        auto readUInt32 = [&]() {
+            std::uint32_t value;
+            std::memcpy(&value, contents.data() + pos, sizeof(value));
+            pos += sizeof(value);
+            return value;
+        };
+        auto readInt32 = [&]() {
+            std::int32_t value;
+            std::memcpy(&value, contents.data() + pos, sizeof(value));
+            pos += sizeof(value);
+            return value;
+        };
+        auto readDouble = [&]() {
+            double value;
+            std::memcpy(&value, contents.data() + pos, sizeof(value));
+            pos += sizeof(value);
+            return value;
+        };
+        auto readByte = [&]() { return static_cast<int>(static_cast<std::uint8_t>(contents[pos++])); };
+
+        // header
+        ASSERT_GT(contents.size(), 16u);
+        EXPECT_EQ(std::string("EPBINTS", 8), readString(8));
+        EXPECT_EQ(1u, readUInt32());
+        EXPECT_EQ(0x01020304u, readUInt32());
+        EXPECT_EQ(DataStringGlobals::VerString, readString(readUInt32()));
+
+        // dictionary record
+        EXPECT_EQ(1, readByte());
+        EXPECT_EQ(1, readInt32());
+        EXPECT_EQ(static_cast<int>(ReportingFrequency::Hourly), readByte());
+        EXPECT_EQ(static_cast<int>(StoreType::Averaged), readByte());
+        EXPECT_EQ("Environment", readString(readUInt32()));
+        EXPECT_EQ("Site Outdoor Air Drybulb Temperature", readString(readUInt32()));
+        EXPECT_EQ("C", readString(readUInt32()));
+
+        // hourly value, stored as a raw double
+        EXPECT_EQ(4, readByte());
+        EXPECT_EQ(1, readInt32());
+        EXPECT_EQ(999.9, readDouble());
+
+        // daily value with its minimum and maximum
+        EXPECT_EQ(5, readByte());
+        EXPECT_EQ(1, readInt32());
+        EXPECT_EQ(616771620.98702729, readDouble());
+        EXPECT_EQ(4283136.2516839253, readDouble());
+        EXPECT_EQ(12210110, readInt32());
+        EXPECT_EQ(4283136.2587211775, readDouble());
+        EXPECT_EQ(12212460, readInt32());
+
+        // end record
+        EXPECT_EQ(255, readByte());
+        EXPECT_EQ(contents.size(), pos);
+    }
+
+    TEST_F(SQLiteFixture, OutputProcessor_writeCsvOutput)
+    {
+        std::string const csvFileName("eplusout_csv_test.csv");
+        std::string const mtrCsvFileName("eplusmtr_csv_test.csv");
+        DataStringGlobals::outputCsvFileName = csvFileName;
+        DataStringGlobals::outputMtrCsvFileName = mtrCsvFileName;
+        OpenCsvOutputFiles();
+
+        WriteReportVariableDictionaryItem(ReportingFrequency::Hourly,
+                                          StoreType::Averaged,
+                                          1,
+                                          0,
+                                          "Zone",
+                                          "1",
+                                          "Environment",
+                                          "Site Outdoor Air Drybulb Temperature",
+                                          1,
+                                          OutputProcessor::Unit::C,
+                                          _,
+                                          _);
+        WriteReportVariableDictionaryItem(ReportingFrequency::TimeStep,
+                                          StoreType::Averaged,
+                                          2,
+                                          0,
+                                          "Zone",
+                                          "2",
+                                          "Zone One",
+                                          "Zone Mean Air Temperature",
+                                          1,
+                                          OutputProcessor::Unit::C,
+                                          _,
+                                          _);
+        WriteMeterDictionaryItem(
+            ReportingFrequency::Hourly, StoreType::Summed, 3, 0, "Facility", "3", "Electricity:Facility", OutputProcessor::Unit::J, false, false);
+
+        // first time step of the hour
+        WriteTimeStampFormatData(DataGlobals::eso_stream, ReportingFrequency::EachCall, 1, "1", 1, "1", false, 1, 1, 1, 30.0, 0.0, 0, "Monday");
+        WriteReportRealData(2, "2", 21.5, StoreType::Summed, 1, ReportingFrequency::TimeStep, 0.0, 0, 0.0, 0);
+
+        // last time step of the hour, then the hourly values with the same time stamp
+        WriteTimeStampFormatData(DataGlobals::eso_stream, ReportingFrequency::EachCall, 1, "1", 1, "1", false, 1, 1, 1, 60.0, 30.0, 0, "Monday");
+        WriteReportRealData(2, "2", 22.25, StoreType::Summed, 1, ReportingFrequency::TimeStep, 0.0, 0, 0.0, 0);
+        WriteTimeStampFormatData(DataGlobals::mtr_stream, ReportingFrequency::Hourly, 1, "1", 1, "1", false, 1, 1, 1, _, _, 0, "Monday");
+        WriteTimeStampFormatData(DataGlobals::eso_stream, ReportingFrequency::Hourly, 1, "1", 1, "1", false, 1, 1, 1, _, _, 0, "Monday");
+        WriteReportRealData(1, "1", 5.5, StoreType::Summed, 1, ReportingFrequency::Hourly, 0.0, 0, 0.0, 0);
+        WriteReportMeterData(3, "3", 100.5, ReportingFrequency::Hourly, 0.0, 0, 0.0, 0, false);
+
+        CloseCsvOutputFiles();
+
+        auto readFile = [](std::string const &fileName) {
+            std::ifstream file(fileName);
+            std::string const contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+            file.close();
+            std::remove(fileName.c_str());
+            return contents;
+        };
+
+        EXPECT_EQ(delimited_string({"Date/Time,Environment:Site Outdoor Air Drybulb Temperature [C](Hourly),Zone One:Zone Mean Air Temperature "
+                                    "[C](TimeStep),Electricity:Facility [J](Hourly)",
+                                    " 01/01  00:30:00,,21.5,",
+                                    " 01/01  01:00:00,5.5,22.25,100.5"}),
+                  readFile(csvFileName));
+        EXPECT_EQ(delimited_string({"Date/Time,Electricity:Facility [J](Hourly)", " 01/01  01:00:00,100.5"}), readFile(mtrCsvFileName));
+    }
+
+    TEST_F(SQLiteFixture, OutputProcessor_variablesByIndexType)
+    {
+        std::string const idf_objects = delimited_string({
+            "Output:Variable,*,Boiler Gas Rate,hourly;",
+            "Output:Variable,*,Zone Mean Air Temperature,hourly;",
+            "Output:Variable,*,Boiler Operating Mode,hourly;",
+        });
+
+        ASSERT_TRUE(process_idf(idf_objects));
+
+        GetReportVariableInput();
+        Real64 fuel_used = 999;
+        Real64 zone_temp = 21.0;
+        int boiler_mode = 1;
+        SetupOutputVariable("Boiler Gas Rate", OutputProcessor::Unit::W, fuel_used, "System", "Average", "Boiler1");
+        SetupOutputVariable("Zone Mean Air Temperature", OutputProcessor::Unit::C, zone_temp, "Zone", "Average", "Space1");
+        SetupOutputVariable("Boiler Gas Rate", OutputProcessor::Unit::W, fuel_used, "System", "Average", "Boiler2");
+        SetupOutputVariable("Zone Mean Air Temperature", OutputProcessor::Unit::C, zone_temp, "Zone", "Average", "Space2");
+        SetupOutputVariable("Boiler Operating Mode", OutputProcessor::Unit::None, boiler_mode, "System", "Average", "Boiler1");
+
+        ASSERT_EQ(4, NumOfRVariable);
+        ASSERT_EQ(2u, RVariablesByIndexType(ZoneVar).size());
+        ASSERT_EQ(2u, RVariablesByIndexType(HVACVar).size());
+        EXPECT_EQ(&RVariableTypes(2).VarPtr(), RVariablesByIndexType(ZoneVar)[0]);
+        EXPECT_EQ(&RVariableTypes(4).VarPtr(), RVariablesByIndexType(ZoneVar)[1]);
+        EXPECT_EQ(&RVariableTypes(1).VarPtr(), RVariablesByIndexType(HVACVar)[0]);
+        EXPECT_EQ(&RVariableTypes(3).VarPtr(), RVariablesByIndexType(HVACVar)[1]);
+
+        ASSERT_EQ(1, NumOfIVariable);
+        EXPECT_TRUE(IVariablesByIndexType(ZoneVar).empty());
+        ASSERT_EQ(1u, IVariablesByIndexType(HVACVar).size());
+        EXPECT_EQ(&IVariableTypes(1).VarPtr(), IVariablesByIndexType(HVACVar)[0]);
+
+        // the lists stay valid when the variable arrays are reallocated
+        ReallocateRVar();
+        EXPECT_EQ(&RVariableTypes(4).VarPtr(), RVariablesByIndexType(ZoneVar)[1]);
+
+        OutputProcessor::clear_state();
+        EXPECT_TRUE(RVariablesByIndexType(ZoneVar).empty());
+        EXPECT_TRUE(RVariablesByIndexType(HVACVar).empty());
+        EXPECT_TRUE(IVariablesByIndexType(HVACVar).empty());
+    }
+
+    TEST_F(SQLiteFixture, OutputProcessor_activeVariableLists)
+    {
+        std::string const idf_objects = delimited_string({
+            "Output:Variable,*,Boiler Gas Rate,hourly;",
+            "EnergyManagementSystem:Sensor,Space1Temp,Space1,Zone Mean Air Temperature;",
+        });
+
+        ASSERT_TRUE(process_idf(idf_objects));
+
+        GetReportVariableInput();
+        Real64 fuel_used = 999;
+        Real64 zone_temp = 21.0;
+        Real64 light_consumption = 0;
+        SetupOutputVariable("Zone Mean Air Temperature", OutputProcessor::Unit::C, zone_temp, "Zone", "Average", "Space1");
+        SetupOutputVariable("Lights Electric Energy", OutputProcessor::Unit::J, light_consumption, "Zone", "Sum", "SPACE1-1 LIGHTS 1", _,
+                            "Electricity", "InteriorLights", "GeneralLights", "Building", "SPACE1-1", 1, 1);
+        SetupOutputVariable("Boiler Gas Rate", OutputProcessor::Unit::W, fuel_used, "System", "Average", "Boiler1");
+
+        ASSERT_EQ(3, NumOfRVariable);
+        EXPECT_TRUE(ActiveVariableListsStale);
+
+        // the EMS sensor reads the variable directly, so it is not accumulated
+        BuildActiveVariableLists();
+        EXPECT_FALSE(ActiveVariableListsStale);
+        ASSERT_EQ(1u, ActiveRVariablesByIndexType(ZoneVar).size());
+        EXPECT_EQ(&RVariableTypes(2).VarPtr(), ActiveRVariablesByIndexType(ZoneVar)[0]);
+        ASSERT_EQ(1u, ActiveRVariablesByIndexType(HVACVar).size());
+        EXPECT_EQ(&RVariableTypes(3).VarPtr(), ActiveRVariablesByIndexType(HVACVar)[0]);
+
+        // the external interface needs EITSValue, so the variable becomes active again, in setup order
+        SetInternalVariableUsedByExternalInterface(2, 1);
+        EXPECT_TRUE(ActiveVariableListsStale);
+        BuildActiveVariableLists();
+        ASSERT_EQ(2u, ActiveRVariablesByIndexType(ZoneVar).size());
+        EXPECT_EQ(&RVariableTypes(1).VarPtr(), ActiveRVariablesByIndexType(ZoneVar)[0]);
+        EXPECT_EQ(&RVariableTypes(2).VarPtr(), ActiveRVariablesByIndexType(ZoneVar)[1]);
+
+        // out of range indexes are ignored
+        SetInternalVariableUsedByExternalInterface(2, 4);
+        SetInternalVariableUsedByExternalInterface(1, 1);
+        EXPECT_FALSE(ActiveVariableListsStale);
+    }
+
+    TEST_F(SQLiteFixture, OutputProcessor_asyncOutputMatchesDirectOutput)
+    {
+        EnergyPlus::sqlite->createSQLiteTimeIndexRecord(4, 1, 1, 0, 2017);
+        EnergyPlus::sqlite->createSQLiteReportDictionaryRecord(1, 1, "Zone", "Environment", "Site Outdoor Air Drybulb Temperature", 1, "C", 1, false,
+                                                               _);
+
+        std::streambuf *esoBuffer = DataGlobals::eso_stream->rdbuf();
+        std::streambuf *mtrBuffer = DataGlobals::mtr_stream->rdbuf();
+
+        StartAsyncOutput();
+        EXPECT_NE(esoBuffer, DataGlobals::eso_stream->rdbuf());
+        EXPECT_NE(mtrBuffer, DataGlobals::mtr_stream->rdbuf());
+
+        // enough records to fill several blocks
+        std::vector<std::string> esoLines;
+        std::vector<std::string> mtrLines;
+        for (int i = 1; i <= 20000; ++i) {
+            WriteReportRealData(1, "1", i + 0.25, StoreType::Summed, 1, ReportingFrequency::TimeStep, 0.0, 0, 0.0, 0);
+            esoLines.push_back("1," + std::to_string(i) + ".25");
+            *DataGlobals::mtr_stream << "2," << i << DataStringGlobals::NL;
+            mtrLines.push_back("2," + std::to_string(i));
+            if (i % 5000 == 0) DataGlobals::eso_stream->flush();
+        }
+
+        StopAsyncOutput();
+        EXPECT_EQ(esoBuffer, DataGlobals::eso_stream->rdbuf());
+        EXPECT_EQ(mtrBuffer, DataGlobals::mtr_stream->rdbuf());
+        EXPECT_TRUE(compare_eso_stream(delimited_string(esoLines)));
+        EXPECT_TRUE(compare_mtr_stream(delimited_string(mtrLines)));
+
+        // stopping again, or writing after stopping, goes straight to the files
+        StopAsyncOutput();
+        WriteReportRealData(1, "1", 999.9, StoreType::Summed, 1, ReportingFrequency::TimeStep, 0.0, 0, 0.0, 0);
+        EXPECT_TRUE(compare_eso_stream(delimited_string({"1,999.9"})));
+    }
+
+    TEST_F(EnergyPlusFixture, OutputProcessor_liveOutputChannelRoundTrip)
+    {
+        std::vector<LiveOutputChannel::Variable> const variables = {{1, 1, "ZONE ONE:Zone Air Temperature", "C"},
+                                                                    {2, 2, "SPACE1-1 NODE:System Node Mass Flow Rate", "kg/s"}};
+        std::unique_ptr<LiveOutputChannel> channel(new LiveOutputChannel("EnergyPlusLiveOutputTest", variables, 2));
+        ASSERT_TRUE(channel->isOpen());
+
+        EPLiveOutputReader *reader(epLiveOutputOpen("EnergyPlusLiveOutputTest"));
+        ASSERT_NE(nullptr, reader);
+        ASSERT_EQ(2u, epLiveOutputNumVariables(reader));
+        EXPECT_STREQ("ZONE ONE:Zone Air Temperature", epLiveOutputVariable(reader, 0)->name);
+        EXPECT_STREQ("kg/s", epLiveOutputVariable(reader, 1)->units);
+        EXPECT_EQ(2, epLiveOutputVariable(reader, 1)->indexType);
+        EXPECT_EQ(nullptr, epLiveOutputVariable(reader, 2));
+
+        EPLiveOutputRecord record;
+        double values[2];
+        EXPECT_EQ(EP_LIVE_OUTPUT_NOT_YET, epLiveOutputRead(reader, 0, &record, values));
+
+        Real64 const step1[] = {21.5, 0.25};
+        Real64 const step2[] = {21.75, 0.5};
+        Real64 const step3[] = {22.0, 0.75};
+        channel->publish(1, 1, 21, 1, 15.0, step1);
+        EXPECT_EQ(1u, epLiveOutputPublished(reader));
+        ASSERT_EQ(EP_LIVE_OUTPUT_OK, epLiveOutputRead(reader, 0, &record, values));
+        EXPECT_EQ(21, record.dayOfMonth);
+        EXPECT_EQ(15.0, record.endMinute);
+        EXPECT_EQ(21.5, values[0]);
+        EXPECT_EQ(0.25, values[1]);
+
+        // the ring holds two records; the third overwrites the first
+        channel->publish(1, 1, 21, 1, 30.0, step2);
+        channel->publish(1, 1, 21, 1, 45.0, step3);
+        EXPECT_EQ(3u, epLiveOutputPublished(reader));
+        EXPECT_EQ(EP_LIVE_OUTPUT_OVERWRITTEN, epLiveOutputRead(reader, 0, &record, values));
+        ASSERT_EQ(EP_LIVE_OUTPUT_OK, epLiveOutputRead(reader, 2, &record, values));
+        EXPECT_EQ(45.0, record.endMinute);
+        EXPECT_EQ(0.75, values[1]);
+        EXPECT_EQ(EP_LIVE_OUTPUT_NOT_YET, epLiveOutputRead(reader, 3, &record, values));
+
+        // the reader keeps its mapping after the simulation closes the channel
+        EXPECT_FALSE(epLiveOutputFinished(reader));
+        channel.reset();
+        EXPECT_TRUE(epLiveOutputFinished(reader));
+        ASSERT_EQ(EP_LIVE_OUTPUT_OK, epLiveOutputRead(reader, 1, &record, values));
+        EXPECT_EQ(21.75, values[0]);
+        epLiveOutputClose(reader);
+
+        EXPECT_EQ(nullptr, epLiveOutputOpen("EnergyPlusLiveOutputTest"));
+    }
+
 } // namespace OutputProcessor
 
 } // namespace EnergyPlus
@@ -47,6 +47,9 @@
 
 // EnergyPlus::OutputReportTabular Unit Tests
 
+#include <cstdio>
+#include <fstream>
+#include <sstream>
 #include <tuple>
 
 // Google Test Headers
@@ -3558,6 +3561,66 @@ TEST_F(EnergyPlusFixture, OutputReportTabularMonthly_ResetMonthlyGathering)
     EXPECT_EQ(extLitUse * 1, MonthlyColumns(1).reslt(12));
 }
 
+TEST_F(EnergyPlusFixture, OutputReportTabularMonthly_GatherByStepType)
+{
+    std::string const idf_objects = delimited_string({
+        "Output:Table:Monthly,",
+        "Lights And Fan Report, !- Name",
+        "2, !-  Digits After Decimal",
+        "Exterior Lights Electric Power, !- Variable or Meter 1 Name",
+        "Maximum, !- Aggregation Type for Variable or Meter 1",
+        "Fan Electric Power, !- Variable or Meter 2 Name",
+        "ValueWhenMaximumOrMinimum, !- Aggregation Type for Variable or Meter 2",
+        "Exterior Lights Electric Power, !- Variable or Meter 3 Name",
+        "HoursPositive, !- Aggregation Type for Variable or Meter 3",
+        "Fan Electric Power, !- Variable or Meter 4 Name",
+        "SumOrAverageDuringHoursShown; !- Aggregation Type for Variable or Meter 4",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    Real64 extLitPower;
+    Real64 fanPower;
+
+    SetupOutputVariable("Exterior Lights Electric Power", OutputProcessor::Unit::W, extLitPower, "Zone", "Average", "Lite1");
+    SetupOutputVariable("Fan Electric Power", OutputProcessor::Unit::W, fanPower, "System", "Average", "Fan1");
+
+    DataGlobals::DoWeathSim = true;
+    DataGlobals::TimeStepZone = 0.25;
+    DataHVACGlobals::TimeStepSys = 0.25;
+
+    GetInputTabularMonthly();
+    InitializeTabularMonthly();
+    ASSERT_EQ(4, MonthlyTables(1).numColumns);
+    EXPECT_EQ(stepTypeZone, MonthlyColumns(1).stepType);
+    EXPECT_EQ(stepTypeHVAC, MonthlyColumns(2).stepType);
+
+    DataEnvironment::Month = 1;
+    extLitPower = 100.0;
+    fanPower = 10.0;
+
+    // the zone time step gathers the lights columns and scans the fan columns that follow them
+    GatherMonthlyResultsForTimestep(ZoneTSReporting);
+    EXPECT_EQ(100.0, MonthlyColumns(1).reslt(1));
+    EXPECT_EQ(10.0, MonthlyColumns(2).reslt(1));
+    EXPECT_EQ(0.25, MonthlyColumns(3).reslt(1));
+    EXPECT_EQ(2.5, MonthlyColumns(4).reslt(1));
+
+    // the fan columns are only ever set by those scans, so the system time step leaves them alone
+    GatherMonthlyResultsForTimestep(HVACTSReporting);
+    EXPECT_EQ(10.0, MonthlyColumns(2).reslt(1));
+    EXPECT_EQ(2.5, MonthlyColumns(4).reslt(1));
+
+    extLitPower = 50.0;
+    fanPower = 20.0;
+    GatherMonthlyResultsForTimestep(ZoneTSReporting);
+    EXPECT_EQ(100.0, MonthlyColumns(1).reslt(1));
+    EXPECT_EQ(10.0, MonthlyColumns(2).reslt(1));
+    EXPECT_EQ(0.5, MonthlyColumns(3).reslt(1));
+    EXPECT_EQ(7.5, MonthlyColumns(4).reslt(1));
+    EXPECT_EQ(0.5, MonthlyColumns(4).duration(1));
+}
+
 TEST_F(EnergyPlusFixture, OutputReportTabular_ConfirmResetBEPSGathering)
 {
 
@@ -7150,6 +7213,135 @@ TEST_F(SQLiteFixture, OutputReportTabularTest_PredefinedTableDXConversion)
 }
 
 
+// Each entry must land in the row of its object and the column of its field, with later entries overwriting earlier ones
+TEST_F(SQLiteFixture, OutputReportTabularTest_PredefinedTableEntryPlacement)
+{
+    EnergyPlus::sqlite->sqliteBegin();
+    EnergyPlus::sqlite->createSQLiteSimulationsRecord(1, "EnergyPlus Version", "Current Time");
+
+    WriteTabularFiles = true;
+    OutputReportTabular::unitsStyle = OutputReportTabular::unitsStyleNone;
+
+    SetPredefinedTables();
+
+    // the fans and heating coils are interleaved and an object name is shared between the two subtables
+    PreDefTableEntry(pdchFanType, "Fan B", "Fan:OnOff");
+    PreDefTableEntry(pdchHeatCoilType, "Coil A", "Coil:Heating:Electric");
+    PreDefTableEntry(pdchFanTotEff, "Fan A", 0.6, 2);
+    PreDefTableEntry(pdchFanType, "Fan A", "Fan:ConstantVolume");
+    PreDefTableEntry(pdchHeatCoilType, "Fan A", "Coil:Heating:Fuel");
+    PreDefTableEntry(pdchFanTotEff, "Fan B", 0.5, 2);
+    PreDefTableEntry(pdchHeatCoilNomEff, "Coil A", 1.0, 2);
+    PreDefTableEntry(pdchFanTotEff, "Fan A", 0.7, 2);
+    PreDefTableEntry(pdchFanDeltaP, "Fan B", 250., 1);
+
+    EXPECT_EQ("EquipmentSummary", OutputReportPredefined::reportName(5).name);
+    OutputReportPredefined::reportName(5).show = true;
+
+    WritePredefinedTables();
+    EnergyPlus::sqlite->sqliteCommit();
+    EnergyPlus::sqlite->initializeIndexes();
+
+    auto trimmed = [](std::string s) {
+        s.erase(std::remove_if(s.begin(), s.end(), ::isspace), s.end());
+        return s;
+    };
+    auto cell = [&](std::string const &tableName, std::string const &rowName, std::string const &columnName) {
+        auto values = queryResult("Select Value From TabularDataWithStrings "
+                                  "WHERE ReportName = \"EquipmentSummary\" "
+                                  "  AND TableName = \"" + tableName + "\" "
+                                  "  AND RowName = \"" + rowName + "\" "
+                                  "  AND ColumnName = \"" + columnName + "\"",
+                                  "TabularDataWithStrings");
+        EXPECT_EQ(1u, values.size());
+        return values.empty() ? std::string("NOT FOUND") : trimmed(values[0][0]);
+    };
+
+    // the rows follow the first appearance of each object name
+    auto fanRows = queryResult("Select RowName From TabularDataWithStrings "
+                               "WHERE ReportName = \"EquipmentSummary\" "
+                               "  AND TableName = \"Fans\" "
+                               "  AND ColumnName = \"Type\" "
+                               "ORDER BY TabularDataIndex",
+                               "TabularDataWithStrings");
+    ASSERT_EQ(2u, fanRows.size());
+    EXPECT_EQ("Fan B", fanRows[0][0]);
+    EXPECT_EQ("Fan A", fanRows[1][0]);
+    auto coilRows = queryResult("Select RowName From TabularDataWithStrings "
+                                "WHERE ReportName = \"EquipmentSummary\" "
+                                "  AND TableName = \"Heating Coils\" "
+                                "  AND ColumnName = \"Type\" "
+                                "ORDER BY TabularDataIndex",
+                                "TabularDataWithStrings");
+    ASSERT_EQ(2u, coilRows.size());
+    EXPECT_EQ("Coil A", coilRows[0][0]);
+    EXPECT_EQ("Fan A", coilRows[1][0]);
+
+    EXPECT_EQ("Fan:OnOff", cell("Fans", "Fan B", "Type"));
+    EXPECT_EQ(trimmed(RealToStr(0.5, 2)), cell("Fans", "Fan B", "Total Efficiency"));
+    EXPECT_EQ(trimmed(RealToStr(250., 1)), cell("Fans", "Fan B", "Delta Pressure"));
+    EXPECT_EQ("Fan:ConstantVolume", cell("Fans", "Fan A", "Type"));
+    EXPECT_EQ(trimmed(RealToStr(0.7, 2)), cell("Fans", "Fan A", "Total Efficiency"));
+    EXPECT_EQ("", cell("Fans", "Fan A", "Delta Pressure"));
+    EXPECT_EQ("Coil:Heating:Electric", cell("Heating Coils", "Coil A", "Type"));
+    EXPECT_EQ(trimmed(RealToStr(1.0, 2)), cell("Heating Coils", "Coil A", "Nominal Efficiency"));
+    EXPECT_EQ("Coil:Heating:Fuel", cell("Heating Coils", "Fan A", "Type"));
+    EXPECT_EQ("", cell("Heating Coils", "Fan A", "Nominal Efficiency"));
+}
+
+// Component sizing rows and columns must be matched without regard to case, keeping the first spelling as the heading
+TEST_F(SQLiteFixture, OutputReportTabularTest_ComponentSizingEntryPlacement)
+{
+    EnergyPlus::sqlite->sqliteBegin();
+    EnergyPlus::sqlite->createSQLiteSimulationsRecord(1, "EnergyPlus Version", "Current Time");
+
+    WriteTabularFiles = true;
+    displayComponentSizing = true;
+    OutputReportTabular::unitsStyle = OutputReportTabular::unitsStyleNone;
+
+    AddCompSizeTableEntry("Fan:OnOff", "Fan B", "Design Size Maximum Flow Rate [m3/s]", 1.5);
+    AddCompSizeTableEntry("Fan:OnOff", "FAN A", "Design Size Maximum Flow Rate [m3/s]", 0.5);
+    AddCompSizeTableEntry("Coil:Heating:Electric", "Coil A", "Design Size Nominal Capacity [W]", 2000.);
+    AddCompSizeTableEntry("FAN:ONOFF", "fan b", "DESIGN SIZE MAXIMUM FLOW RATE [m3/s]", 2.5);
+    AddCompSizeTableEntry("Fan:OnOff", "Fan A", "User-Specified Maximum Flow Rate [m3/s]", 0.75);
+
+    WriteComponentSizing();
+    EnergyPlus::sqlite->sqliteCommit();
+    EnergyPlus::sqlite->initializeIndexes();
+
+    auto trimmed = [](std::string s) {
+        s.erase(std::remove_if(s.begin(), s.end(), ::isspace), s.end());
+        return s;
+    };
+
+    auto fanCells = queryResult("Select RowName, ColumnName, Value From TabularDataWithStrings "
+                                "WHERE ReportName = \"ComponentSizingSummary\" "
+                                "  AND TableName = \"Fan:OnOff\" "
+                                "ORDER BY TabularDataIndex",
+                                "TabularDataWithStrings");
+    std::vector<std::vector<std::string>> const expectedFanCells{
+        {"Fan B", "Design Size Maximum Flow Rate", RealToStr(2.5, 2)},
+        {"FAN A", "Design Size Maximum Flow Rate", RealToStr(0.5, 6)},
+        {"Fan B", "User-Specified Maximum Flow Rate", ""},
+        {"FAN A", "User-Specified Maximum Flow Rate", RealToStr(0.75, 6)},
+    };
+    ASSERT_EQ(expectedFanCells.size(), fanCells.size());
+    for (size_t i = 0; i < expectedFanCells.size(); ++i) {
+        EXPECT_EQ(expectedFanCells[i][0], fanCells[i][0]);
+        EXPECT_EQ(expectedFanCells[i][1], fanCells[i][1]);
+        EXPECT_EQ(trimmed(expectedFanCells[i][2]), trimmed(fanCells[i][2]));
+    }
+
+    auto coilCells = queryResult("Select RowName, ColumnName, Value From TabularDataWithStrings "
+                                 "WHERE ReportName = \"ComponentSizingSummary\" "
+                                 "  AND TableName = \"Coil:Heating:Electric\"",
+                                 "TabularDataWithStrings");
+    ASSERT_EQ(1u, coilCells.size());
+    EXPECT_EQ("Coil A", coilCells[0][0]);
+    EXPECT_EQ("Design Size Nominal Capacity", coilCells[0][1]);
+    EXPECT_EQ(trimmed(RealToStr(2000., 2)), trimmed(coilCells[0][2]));
+}
+
 // Test for #7046
 // Ensures that we get consistency between the displayed Azimuth and its cardinal classification
 TEST_F(EnergyPlusFixture, AzimuthToCardinal)
@@ -7290,3 +7482,66 @@ TEST_F(EnergyPlusFixture, AzimuthToCardinal)
         i = i + 2;
     }
 }
+
+TEST_F(EnergyPlusFixture, OutputReportTabular_WriteTableRenderedAtClose)
+{
+    std::string const csvFileName("OutputReportTabularRenderTest.csv");
+    std::string const xmlFileName("OutputReportTabularRenderTest.xml");
+
+    OutputReportTabular::WriteTabularFiles = true;
+    OutputReportTabular::numStyles = 2;
+    OutputReportTabular::TableStyle(1) = OutputReportTabular::tableStyleComma;
+    OutputReportTabular::del(1) = ",";
+    OutputReportTabular::TableStyle(2) = OutputReportTabular::tableStyleXML;
+    OutputReportTabular::del(2) = " ";
+    OutputReportTabular::TabularOutputFile(1)->open(csvFileName);
+    OutputReportTabular::TabularOutputFile(2)->open(xmlFileName);
+
+    Array2D_string tableBody(2, 1);
+    Array1D_string rowHead(1);
+    Array1D_string columnHead(2);
+    Array1D_int columnWidth(2, 3);
+    tableBody(1, 1) = "1.00";
+    tableBody(2, 1) = "2.00";
+    rowHead(1) = "Row One";
+    columnHead(1) = "Col A [W]";
+    columnHead(2) = "Col B";
+
+    OutputReportTabular::WriteReportHeaders("Test Report", "Entire Facility", OutputProcessor::StoreType::Averaged);
+    OutputReportTabular::WriteSubtitle("Sub Table");
+    OutputReportTabular::WriteTable(tableBody, rowHead, columnHead, columnWidth);
+    // the caller still sees the column widths widened to the labels
+    EXPECT_EQ(9, columnWidth(1));
+    EXPECT_EQ(5, columnWidth(2));
+    // the table belongs to the report even if the caller changes its arrays afterwards
+    tableBody(1, 1) = "changed";
+
+    OutputReportTabular::CloseOutputTabularFile();
+
+    std::stringstream csv;
+    csv << std::ifstream(csvFileName).rdbuf();
+    EXPECT_EQ("----------------------------------------------------------------------------------------------------\n"
+              "REPORT:,Test Report\n"
+              "FOR:,Entire Facility\n"
+              "Sub Table\n\n"
+              ",,Col A [W],Col B\n"
+              ",Row One,1.00,2.00\n"
+              "\n\n",
+              csv.str());
+
+    std::stringstream xml;
+    xml << std::ifstream(xmlFileName).rdbuf();
+    EXPECT_EQ("<TestReport>\n"
+              "  <for>Entire Facility</for>\n"
+              "  <SubTable>\n"
+              "    <name>RowOne</name>\n"
+              "    <ColA units=\"W\">1.00</ColA>\n"
+              "    <ColB>2.00</ColB>\n"
+              "  </SubTable>\n"
+              "</TestReport>\n"
+              "</EnergyPlusTabularReports>\n",
+              xml.str());
+
+    std::remove(csvFileName.c_str());
+    std::remove(xmlFileName.c_str());
+}
@@ -0,0 +1,146 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::OutsideEnergySources Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataPlant.hh>
+#include <EnergyPlus/FluidProperties.hh>
+#include <EnergyPlus/OutsideEnergySources.hh>
+
+#include "Fixtures/EnergyPlusFixture.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::OutsideEnergySources;
+
+TEST_F(EnergyPlusFixture, OutsideEnergySources_EMSOverrides)
+{
+    DataPlant::PlantLoop.allocate(1);
+    DataPlant::PlantLoop(1).FluidName = "WATER";
+    DataPlant::PlantLoop(1).FluidIndex = 1;
+    DataPlant::PlantLoop(1).MinTemp = 2.0;
+    DataPlant::PlantLoop(1).MaxTemp = 30.0;
+    DataLoopNode::Node.allocate(2);
+
+    OutsideEnergySourceSpecs thisSource;
+    thisSource.Name = "DISTRICT COOLING";
+    thisSource.EnergyType = DataPlant::TypeOf_PurchChilledWater;
+    thisSource.LoopNum = 1;
+    thisSource.InletNodeNum = 1;
+    thisSource.OutletNodeNum = 2;
+    thisSource.NomCap = 300000.0;
+    thisSource.CapFractionSchedNum = DataGlobals::ScheduleAlwaysOn;
+    thisSource.MassFlowRate = 2.0;
+    thisSource.InletTemp = 12.0;
+
+    Real64 const Cp = FluidProperties::GetSpecificHeatGlycol("WATER", thisSource.InletTemp, DataPlant::PlantLoop(1).FluidIndex, "UnitTest");
+
+    // no overrides, the load requested by the loop is met
+    thisSource.calculate(true, -10000.0);
+    EXPECT_DOUBLE_EQ(10000.0, thisSource.EnergyRate);
+    EXPECT_NEAR(12.0 - 10000.0 / (2.0 * Cp), thisSource.OutletTemp, 1.0e-10);
+
+    // an actuated outlet temperature replaces the load requested by the loop
+    thisSource.EMSOverrideOnOutletTemp = true;
+    thisSource.EMSOverrideValueOutletTemp = 7.0;
+    thisSource.calculate(true, -1000.0);
+    EXPECT_NEAR(7.0, thisSource.OutletTemp, 1.0e-10);
+    EXPECT_NEAR(2.0 * Cp * 5.0, thisSource.EnergyRate, 1.0e-6);
+    EXPECT_NEAR(7.0, DataLoopNode::Node(2).Temp, 1.0e-10);
+
+    // the loop temperature limits still apply to the actuated outlet temperature
+    thisSource.EMSOverrideValueOutletTemp = 0.0;
+    thisSource.calculate(true, -1000.0);
+    EXPECT_DOUBLE_EQ(2.0, thisSource.OutletTemp);
+    EXPECT_NEAR(2.0 * Cp * 10.0, thisSource.EnergyRate, 1.0e-6);
+
+    // district cooling cannot heat, even when actuated above the inlet temperature
+    thisSource.EMSOverrideValueOutletTemp = 15.0;
+    thisSource.calculate(true, -1000.0);
+    EXPECT_DOUBLE_EQ(12.0, thisSource.OutletTemp);
+    EXPECT_DOUBLE_EQ(0.0, thisSource.EnergyRate);
+
+    // without flow the outlet temperature override is ignored
+    thisSource.EMSOverrideValueOutletTemp = 7.0;
+    thisSource.MassFlowRate = 0.0;
+    thisSource.calculate(true, -1000.0);
+    EXPECT_DOUBLE_EQ(12.0, thisSource.OutletTemp);
+    EXPECT_DOUBLE_EQ(0.0, thisSource.EnergyRate);
+    thisSource.MassFlowRate = 2.0;
+    thisSource.EMSOverrideOnOutletTemp = false;
+
+    // an actuated capacity replaces the nominal capacity and is clamped at zero
+    thisSource.EMSOverrideOnCapacity = true;
+    thisSource.EMSOverrideValueCapacity = 5000.0;
+    thisSource.calculate(true, -10000.0);
+    EXPECT_DOUBLE_EQ(5000.0, thisSource.EnergyRate);
+    EXPECT_NEAR(12.0 - 5000.0 / (2.0 * Cp), thisSource.OutletTemp, 1.0e-10);
+
+    thisSource.EMSOverrideValueCapacity = -5000.0;
+    thisSource.calculate(true, -10000.0);
+    EXPECT_DOUBLE_EQ(0.0, thisSource.EnergyRate);
+    EXPECT_DOUBLE_EQ(12.0, thisSource.OutletTemp);
+    thisSource.EMSOverrideOnCapacity = false;
+
+    // district heating cannot cool, and is held to the loop maximum temperature
+    thisSource.EnergyType = DataPlant::TypeOf_PurchHotWater;
+    thisSource.EMSOverrideOnOutletTemp = true;
+    thisSource.EMSOverrideValueOutletTemp = 7.0;
+    thisSource.calculate(true, 1000.0);
+    EXPECT_DOUBLE_EQ(12.0, thisSource.OutletTemp);
+    EXPECT_DOUBLE_EQ(0.0, thisSource.EnergyRate);
+
+    thisSource.EMSOverrideValueOutletTemp = 40.0;
+    thisSource.calculate(true, 1000.0);
+    EXPECT_DOUBLE_EQ(30.0, thisSource.OutletTemp);
+    EXPECT_NEAR(2.0 * Cp * 18.0, thisSource.EnergyRate, 1.0e-6);
+}
@@ -241,6 +241,55 @@ TEST_F(EnergyPlusFixture, PVWattsGenerator_Calc)
     EXPECT_NEAR(generatorEnergy, generatorPower * 60 * 60, 1);
 }
 
+TEST_F(EnergyPlusFixture, PVWattsGenerator_Calc_SharedOrientation)
+{
+    using namespace PVWatts;
+    // USA_AZ_Phoenix-Sky.Harbor.Intl.AP.722780_TMY3.epw
+    // 6/15 at 7am
+    DataGlobals::TimeStep = 1;
+    DataGlobals::TimeStepZone = 1.0;
+    DataHVACGlobals::TimeStepSys = 1.0;
+    DataGlobals::BeginTimeStepFlag = true;
+    DataGlobals::MinutesPerTimeStep = 60;
+    DataGlobals::NumOfTimeStepInHour = 1;
+    WeatherManager::AllocateWeatherData(); // gets us the albedo array initialized
+    DataEnvironment::Year = 1986;
+    DataEnvironment::Month = 6;
+    DataEnvironment::DayOfMonth = 15;
+    DataGlobals::HourOfDay = 8; // 8th hour of day, 7-8am
+    WeatherManager::WeatherFileLatitude = 33.45;
+    WeatherManager::WeatherFileLongitude = -111.98;
+    WeatherManager::WeatherFileTimeZone = -7;
+    DataEnvironment::BeamSolarRad = 728;
+    DataEnvironment::DifSolarRad = 70;
+    DataEnvironment::WindSpeed = 3.1;
+    DataEnvironment::OutDryBulbTemp = 31.7;
+
+    // the second array has the same orientation and reuses the irradiance of the first one
+    Real64 generatorPower, generatorEnergy, thermalPower, thermalEnergy;
+    PVWattsGenerator pvwc("PVWattsArrayC", 1000.0, ModuleType::THIN_FILM, ArrayType::FIXED_OPEN_RACK, 0.1, GeometryType::TILT_AZIMUTH, 30.0, 140.);
+    pvwc.setCellTemperature(33.764);
+    pvwc.setPlaneOfArrayIrradiance(255.213);
+    pvwc.calc();
+    pvwc.getResults(generatorPower, generatorEnergy, thermalPower, thermalEnergy);
+    EXPECT_NEAR(generatorPower, 433.109, 0.5);
+
+    PVWattsGenerator pvwc2("PVWattsArrayC2", 2000.0, ModuleType::THIN_FILM, ArrayType::FIXED_OPEN_RACK, 0.1, GeometryType::TILT_AZIMUTH, 30.0, 140.);
+    pvwc2.setCellTemperature(33.764);
+    pvwc2.setPlaneOfArrayIrradiance(255.213);
+    pvwc2.calc();
+    pvwc2.getResults(generatorPower, generatorEnergy, thermalPower, thermalEnergy);
+    EXPECT_NEAR(generatorPower, 2.0 * 433.109, 1.0);
+
+    // a different orientation is calculated on its own
+    PVWattsGenerator pvwe("PVWattsArrayE", 3800.0, ModuleType::PREMIUM, ArrayType::TWO_AXIS, 0.08, GeometryType::TILT_AZIMUTH, 34.0, 180.);
+    pvwe.setCellTemperature(42.229);
+    pvwe.setPlaneOfArrayIrradiance(647.867);
+    pvwe.calc();
+    pvwe.getResults(generatorPower, generatorEnergy, thermalPower, thermalEnergy);
+    EXPECT_NEAR(generatorPower, 2759.937, 0.5);
+}
+
 TEST_F(EnergyPlusFixture, PVWattsInverter_Constructor)
 {
     const std::string idfTxt = delimited_string({"ElectricLoadCenter:Distribution,",
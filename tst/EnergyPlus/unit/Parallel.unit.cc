@@ -0,0 +1,102 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::Parallel Unit Tests
+
+// C++ Headers
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/Parallel.hh>
+
+using namespace EnergyPlus;
+
+TEST_F(EnergyPlusFixture, Parallel_LoopThreads)
+{
+    DataSystemVariables::NumberIntRadThreads = 4;
+    EXPECT_EQ(1, Parallel::LoopThreads(1));
+    EXPECT_EQ(2, Parallel::LoopThreads(2));
+    EXPECT_EQ(4, Parallel::LoopThreads(100));
+    EXPECT_EQ(1, Parallel::LoopThreads(3, 5));
+}
+
+TEST_F(EnergyPlusFixture, Parallel_ForAndSum)
+{
+    DataSystemVariables::NumberIntRadThreads = 3;
+
+    std::vector<int> visits(50, 0);
+    Parallel::For(50, [&](int const Index) { ++visits[Index]; });
+    for (int const count : visits) {
+        EXPECT_EQ(1, count);
+    }
+
+    // terms of very different magnitude, whose sum depends on the order they are added in
+    auto const term = [](int const Index) { return (Index % 2 == 0) ? 1.0e16 : 1.0; };
+    Real64 expected = 0.0;
+    for (int Index = 0; Index < 101; ++Index) {
+        expected += term(Index);
+    }
+    EXPECT_EQ(expected, Parallel::Sum(101, term));
+    DataSystemVariables::NumberIntRadThreads = 1;
+    EXPECT_EQ(expected, Parallel::Sum(101, term));
+    EXPECT_EQ(0.0, Parallel::Sum(0, term));
+}
+
+TEST_F(EnergyPlusFixture, Parallel_ThreadLimit)
+{
+    EXPECT_EQ(0, Parallel::ThreadLimit());
+    Parallel::SetThreadLimit(1);
+    DataSystemVariables::InitializeThreading();
+    EXPECT_EQ(1, DataSystemVariables::NumberIntRadThreads);
+    Parallel::SetThreadLimit(-2);
+    EXPECT_EQ(0, Parallel::ThreadLimit());
+}
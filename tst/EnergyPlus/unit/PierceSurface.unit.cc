@@ -615,3 +615,58 @@ TEST(PierceSurfaceTest, NonconvexStar4)
         EXPECT_DOUBLE_EQ(0.0, hitPt.z);
     }
 }
+
+TEST(PierceSurfaceTest, RayPacket)
+{
+    DataSurfaces::SurfaceData ushape;
+    ushape.Vertex.dimension(8);
+    ushape.Vertex = {Vector(0, 0, 0), Vector(3, 0, 0), Vector(3, 2, 0), Vector(2, 2, 0),
+                     Vector(2, 1, 0), Vector(1, 1, 0), Vector(1, 2, 0), Vector(0, 2, 0)};
+    ushape.IsConvex = false;
+    ushape.set_computed_geometry();
+
+    DataSurfaces::SurfaceData floor;
+    floor.Vertex.dimension(4);
+    floor.Vertex = {Vector(0, 0, -1), Vector(3, 0, -1), Vector(3, 2, -1), Vector(0, 2, -1)};
+    floor.Shape = SurfaceShape::Rectangle;
+    floor.set_computed_geometry();
+
+    // Fan of rays from above the U notch: some hit the U, some pass through the notch to the floor, some go up
+    RayPacket rays;
+    rays.ori = Vector(1.5, 1.5, 1.0);
+    std::vector<Vector> dirs;
+    for (int i = -4; i <= 4; ++i) {
+        for (int j = -4; j <= 4; ++j) {
+            Vector dir(0.25 * i, 0.25 * j, (i + j) % 3 == 0 ? 1.0 : -1.0);
+            dir.normalize();
+            dirs.push_back(dir);
+            rays.add(dir);
+        }
+    }
+    rays.add(Vector(1.0, 0.0, 0.0)); // Parallel to both planes
+    dirs.push_back(Vector(1.0, 0.0, 0.0));
+    ASSERT_EQ(dirs.size(), rays.size());
+
+    PierceSurface(ushape, rays);
+    std::vector<std::uint8_t> const ushapeHits(rays.hit);
+    PierceSurface(floor, rays);
+
+    RayPacket::size_type nHit(0u);
+    for (RayPacket::size_type i = 0; i < dirs.size(); ++i) {
+        bool hitU(false);
+        bool hitFloor(false);
+        Vector hitPt(0.0);
+        PierceSurface(ushape, rays.ori, dirs[i], hitPt, hitU);
+        PierceSurface(floor, rays.ori, dirs[i], hitPt, hitFloor);
+        EXPECT_EQ(hitU, ushapeHits[i] == 1u);
+        EXPECT_EQ(hitU || hitFloor, rays.hit[i] == 1u);
+        if (hitU || hitFloor) ++nHit;
+    }
+    EXPECT_EQ(nHit, rays.nHit);
+    EXPECT_GT(rays.nHit, 0u);
+    EXPECT_FALSE(rays.allHit());
+
+    rays.reset();
+    EXPECT_EQ(0u, rays.nHit);
+    EXPECT_EQ(std::vector<std::uint8_t>(dirs.size(), 0u), rays.hit);
+}
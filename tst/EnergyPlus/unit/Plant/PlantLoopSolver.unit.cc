@@ -0,0 +1,171 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::PlantLoopSolver Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataBranchAirLoopPlant.hh>
+#include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataPlant.hh>
+#include <EnergyPlus/Plant/PlantLoopSolver.hh>
+
+#include "Fixtures/EnergyPlusFixture.hh"
+
+using namespace EnergyPlus;
+using DataLoopNode::Node;
+using DataPlant::PlantLoop;
+
+TEST_F(EnergyPlusFixture, PlantLoopSolver_ResolveParallelFlowsRestrictedFlow)
+{
+    // One loop side: inlet branch 1, splitter, active branches 2 and 3, mixer, outlet branch 4.
+    // Branch 3 carries a variable speed pump behind a pipe, so its request is only seen at the pump inlet.
+    DataPlant::TotNumLoops = 1;
+    PlantLoop.allocate(1);
+    PlantLoop(1).Name = "LOOP";
+    PlantLoop(1).LoopSide.allocate(2);
+    auto &loopside(PlantLoop(1).LoopSide(DataPlant::DemandSide));
+    loopside.TotalBranches = 4;
+    loopside.Branch.allocate(4);
+    loopside.SplitterExists = true;
+    loopside.MixerExists = true;
+    loopside.Splitter.Exists = true;
+    loopside.Splitter.BranchNumIn = 1;
+    loopside.Splitter.TotalOutletNodes = 2;
+    loopside.Splitter.BranchNumOut.allocate(2);
+    loopside.Splitter.BranchNumOut = {2, 3};
+    loopside.Mixer.Exists = true;
+    loopside.Mixer.BranchNumOut = 4;
+
+    Node.allocate(9);
+    int const branchNodes[4][2] = {{1, 2}, {3, 4}, {5, 6}, {7, 8}};
+    for (int branchNum = 1; branchNum <= 4; ++branchNum) {
+        auto &branch(loopside.Branch(branchNum));
+        branch.NodeNumIn = branchNodes[branchNum - 1][0];
+        branch.NodeNumOut = branchNodes[branchNum - 1][1];
+        branch.ControlType = ((branchNum == 2) || (branchNum == 3)) ? DataBranchAirLoopPlant::ControlType_Active
+                                                                    : DataBranchAirLoopPlant::ControlType_Passive;
+        branch.TotalComponents = 1;
+        branch.Comp.allocate(1);
+        branch.Comp(1).TypeOf_Num = DataPlant::TypeOf_Pipe;
+        branch.Comp(1).NodeNumIn = branch.NodeNumIn;
+        branch.Comp(1).NodeNumOut = branch.NodeNumOut;
+    }
+    auto &pumpBranch(loopside.Branch(3));
+    pumpBranch.TotalComponents = 2;
+    pumpBranch.Comp.allocate(2);
+    pumpBranch.Comp(1).TypeOf_Num = DataPlant::TypeOf_Pipe;
+    pumpBranch.Comp(1).NodeNumIn = 5;
+    pumpBranch.Comp(1).NodeNumOut = 9;
+    pumpBranch.Comp(2).TypeOf_Num = DataPlant::TypeOf_PumpVariableSpeed;
+    pumpBranch.Comp(2).NodeNumIn = 9;
+    pumpBranch.Comp(2).NodeNumOut = 6;
+
+    // Settled convergence histories, so the loop side is rigid once past the first HVAC iteration
+    loopside.InletNode.TemperatureHistory = 20.0;
+    loopside.InletNode.MassFlowRateHistory = 0.7;
+    loopside.OutletNode.TemperatureHistory = 25.0;
+    loopside.OutletNode.MassFlowRateHistory = 0.7;
+
+    Real64 const loopSideFlow(0.7); // Less than the 1.4 kg/s the parallel branches ask for
+
+    auto setRequests = [] {
+        for (int nodeNum = 1; nodeNum <= 9; ++nodeNum) {
+            Node(nodeNum).MassFlowRate = 0.0;
+            Node(nodeNum).MassFlowRateMinAvail = 0.0;
+            Node(nodeNum).MassFlowRateMaxAvail = 10.0;
+            Node(nodeNum).MassFlowRateRequest = 0.0;
+        }
+        Node(3).MassFlowRateRequest = 0.6;
+        Node(9).MassFlowRateRequest = 0.8;
+    };
+
+    for (bool const firstHVACIteration : {true, false}) {
+        setRequests();
+
+        // The apportioning this replaced: each active branch's request found again, with the variable speed pump correction
+        Real64 oldRequest[2];
+        for (int outletNum = 1; outletNum <= 2; ++outletNum) {
+            int const branchNum(loopside.Splitter.BranchNumOut(outletNum));
+            auto &branch(loopside.Branch(branchNum));
+            Real64 request(PlantLoop(1).loopSolver.DetermineBranchFlowRequest(1, DataPlant::DemandSide, branchNum));
+            for (int compNum = 1; compNum <= branch.TotalComponents; ++compNum) {
+                if (branch.Comp(compNum).TypeOf_Num != DataPlant::TypeOf_PumpVariableSpeed) continue;
+                request = max(request, Node(branch.Comp(compNum).NodeNumIn).MassFlowRateRequest);
+            }
+            oldRequest[outletNum - 1] = request;
+        }
+        Real64 const oldTotalRequest(oldRequest[0] + oldRequest[1]);
+        Real64 const oldFlow2((oldRequest[0] / oldTotalRequest) * loopSideFlow);
+        Real64 const oldFlow3((oldRequest[1] / oldTotalRequest) * loopSideFlow);
+
+        PlantLoop(1).loopSolver.ResolveParallelFlows(1, DataPlant::DemandSide, loopSideFlow, firstHVACIteration);
+
+        EXPECT_EQ(oldFlow2, Node(3).MassFlowRate);
+        EXPECT_EQ(oldFlow3, Node(5).MassFlowRate);
+        EXPECT_NEAR(0.3, Node(3).MassFlowRate, 1.0e-12);
+        EXPECT_NEAR(0.4, Node(5).MassFlowRate, 1.0e-12);
+
+        // Pushed down every component of the branch
+        EXPECT_EQ(oldFlow2, Node(4).MassFlowRate);
+        EXPECT_EQ(oldFlow3, Node(9).MassFlowRate);
+        EXPECT_EQ(oldFlow3, Node(6).MassFlowRate);
+        EXPECT_EQ(oldTotalRequest, Node(7).MassFlowRate);
+
+        if (firstHVACIteration) { // Not rigid: availabilities left open
+            EXPECT_EQ(10.0, Node(9).MassFlowRateMaxAvail);
+            EXPECT_EQ(0.0, Node(9).MassFlowRateMinAvail);
+        } else { // Rigid: every pushed node locked to its flow
+            EXPECT_EQ(oldFlow3, Node(9).MassFlowRateMaxAvail);
+            EXPECT_EQ(oldFlow3, Node(9).MassFlowRateMinAvail);
+            EXPECT_EQ(oldFlow2, Node(4).MassFlowRateMaxAvail);
+            EXPECT_EQ(oldTotalRequest, Node(8).MassFlowRateMaxAvail);
+        }
+    }
+}
@@ -50,6 +50,9 @@
 // Google Test Headers
 #include <gtest/gtest.h>
 
+// C++ Headers
+#include <sstream>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
 #include <ObjexxFCL/Fmath.hh>
@@ -86,6 +89,99 @@ namespace PlantManager {
         EXPECT_EQ(TestVolume, PlantLoop(1).Volume);
     }
 
+    TEST_F(EnergyPlusFixture, PlantManager_SetupPlantLoopGroups)
+    {
+        // loops 1 and 2 are coupled by a chiller, loop 3 is independent
+        TotNumLoops = 3;
+        PlantLoop.allocate(TotNumLoops);
+        for (auto &loop : PlantLoop) {
+            loop.LoopSide.allocate(2);
+        }
+        PlantLoop(1).CommonPipeType = CommonPipe_TwoWay;
+        PlantLoop(1).LoopSide(SupplySide).Connected.allocate(1);
+        PlantLoop(1).LoopSide(SupplySide).Connected(1).LoopNum = 2;
+        PlantLoop(1).LoopSide(SupplySide).Connected(1).LoopSideNum = DemandSide;
+        PlantLoop(2).LoopSide(DemandSide).Connected.allocate(1);
+        PlantLoop(2).LoopSide(DemandSide).Connected(1).LoopNum = 1;
+        PlantLoop(2).LoopSide(DemandSide).Connected(1).LoopSideNum = SupplySide;
+
+        SetupPlantLoopGroups();
+
+        EXPECT_EQ(PlantLoop(1).LoopGroup, PlantLoop(2).LoopGroup);
+        EXPECT_NE(PlantLoop(1).LoopGroup, PlantLoop(3).LoopGroup);
+        EXPECT_TRUE(PlantLoop(1).CommonPipeInLoopGroup);
+        EXPECT_TRUE(PlantLoop(2).CommonPipeInLoopGroup);
+        EXPECT_FALSE(PlantLoop(3).CommonPipeInLoopGroup);
+    }
+
+    TEST_F(EnergyPlusFixture, PlantManager_HalfLoopChangeDetection)
+    {
+        TotNumLoops = 1;
+        PlantLoop.allocate(TotNumLoops);
+        PlantLoop(1).LoopSide.allocate(2);
+        auto &loop_side(PlantLoop(1).LoopSide(SupplySide));
+        loop_side.NodeNumIn = 1;
+        loop_side.TotalBranches = 1;
+        loop_side.Branch.allocate(1);
+        loop_side.Branch(1).TotalComponents = 1;
+        loop_side.Branch(1).Comp.allocate(1);
+        loop_side.Branch(1).Comp(1).NodeNumIn = 1;
+        loop_side.Branch(1).Comp(1).NodeNumOut = 2;
+        Node.allocate(2);
+        Node(1).Temp = 12.0;
+        Node(1).MassFlowRate = 1.0;
+        Node(2).Temp = 7.0;
+        Node(2).MassFlowRate = 1.0;
+
+        // never solved
+        EXPECT_FALSE(HalfLoopInputsUnchanged(1, SupplySide));
+
+        loop_side.LastSolveCount = 1;
+        GatherHalfLoopInputs(1, SupplySide, loop_side.SolvedInputTemps, loop_side.SolvedInputFlows);
+        EXPECT_TRUE(HalfLoopInputsUnchanged(1, SupplySide));
+
+        // changes within the plant convergence tolerances keep the half loop clean
+        Node(1).Temp = 12.005;
+        EXPECT_TRUE(HalfLoopInputsUnchanged(1, SupplySide));
+
+        Node(2).MassFlowRateRequest = 0.5;
+        EXPECT_FALSE(HalfLoopInputsUnchanged(1, SupplySide));
+    }
+
+    TEST_F(EnergyPlusFixture, PlantManager_WritePlantComponentTimings)
+    {
+        TotNumLoops = 1;
+        PlantLoop.allocate(TotNumLoops);
+        PlantLoop(1).Name = "CHW LOOP";
+        PlantLoop(1).LoopSide.allocate(2);
+        auto &branch(PlantLoop(1).LoopSide(SupplySide).Branch);
+        PlantLoop(1).LoopSide(SupplySide).TotalBranches = 1;
+        branch.allocate(1);
+        branch(1).TotalComponents = 2;
+        branch(1).Comp.allocate(2);
+        branch(1).Comp(1).TypeOf = "PUMP:VARIABLESPEED";
+        branch(1).Comp(1).Name = "CHW PUMP";
+        branch(1).Comp(1).SimulationTime = 0.5;
+        branch(1).Comp(1).SimulationCalls = 1000;
+        branch(1).Comp(2).TypeOf = "CHILLER:ELECTRIC:EIR";
+        branch(1).Comp(2).Name = "CHILLER";
+        branch(1).Comp(2).SimulationTime = 2.0;
+        branch(1).Comp(2).SimulationCalls = 1000;
+
+        std::ostringstream Timings;
+        WritePlantComponentTimings(Timings);
+
+        std::istringstream Lines(Timings.str());
+        std::string Line;
+        std::getline(Lines, Line);
+        EXPECT_EQ("Plant Loop,Loop Side,Component Type,Component Name,Calls,Total Time {s},Average Time {us}", Line);
+        // most expensive component first
+        std::getline(Lines, Line);
+        EXPECT_EQ("CHW LOOP,Supply,CHILLER:ELECTRIC:EIR,CHILLER,1000,2,2000", Line);
+        std::getline(Lines, Line);
+        EXPECT_EQ("CHW LOOP,Supply,PUMP:VARIABLESPEED,CHW PUMP,1000,0.5,500", Line);
+    }
+
     TEST_F(EnergyPlusFixture, PlantManager_TwoWayCommonPipeSetPointManagerTest)
     {
         // issue 6069
@@ -52,6 +52,7 @@
 
 #include "EnergyPlus/DataPlant.hh"
 #include "EnergyPlus/DataSurfaces.hh"
+#include "EnergyPlus/DataSystemVariables.hh"
 #include "EnergyPlus/HeatBalanceManager.hh"
 #include "EnergyPlus/PlantPipingSystemsManager.hh"
 #include "EnergyPlus/SurfaceGeometry.hh"
@@ -1754,6 +1755,27 @@ TEST_F(EnergyPlusFixture, PipingSystemFullSimulation) {
     DataGlobals::BeginSimFlag = true;
     DataGlobals::BeginEnvrnFlag = true;
     PlantPipingSystemsManager::SimulateGroundDomains(false);
+
+    // the flat arrays and the sparse solver should reach the converged result of the sweeps
+    auto &basementDomain = PlantPipingSystemsManager::domains[1];
+    basementDomain.SimControls.MaxIterationsPerTS = 10000;
+    basementDomain.SimControls.Convergence_CurrentToPrevIteration = 1.0e-10;
+    PlantPipingSystemsManager::Domain sweptDomain(basementDomain);
+    PlantPipingSystemsManager::Domain flatDomain(basementDomain);
+    sweptDomain.PerformIterationLoop();
+    DataSystemVariables::PipingSystemsFlatCellArrays = true;
+    flatDomain.PerformIterationLoop();
+    DataSystemVariables::PipingSystemsFlatCellArrays = false;
+    DataSystemVariables::PipingSystemsSparseSolver = true;
+    basementDomain.PerformIterationLoop();
+    for (int X = 0; X <= basementDomain.x_max_index; ++X) {
+        for (int Y = 0; Y <= basementDomain.y_max_index; ++Y) {
+            for (int Z = 0; Z <= basementDomain.z_max_index; ++Z) {
+                EXPECT_NEAR(sweptDomain.Cells(X, Y, Z).Temperature, flatDomain.Cells(X, Y, Z).Temperature, 1.0e-6);
+                EXPECT_NEAR(sweptDomain.Cells(X, Y, Z).Temperature, basementDomain.Cells(X, Y, Z).Temperature, 1.0e-6);
+            }
+        }
+    }
 }
 
 /*
@@ -0,0 +1,137 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::Psychrometrics Unit Tests
+
+// C++ Headers
+#include <sstream>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/Psychrometrics.hh>
+
+#include "Fixtures/EnergyPlusFixture.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Psychrometrics;
+
+TEST_F(EnergyPlusFixture, Psychrometrics_PsyTsatFnPb_Table)
+{
+    Real64 const Pressures[] = {5.0, 100.0, 590.0, 611.1, 620.0, 1000.0, 3000.0, 101325.0, 400000.0};
+    Real64 Iterated[9];
+    for (int i = 0; i < 9; ++i) {
+        Iterated[i] = PsyTsatFnPb(Pressures[i]);
+    }
+
+    InitializeTsatTable();
+    EXPECT_TRUE(TsatTableActive);
+    EXPECT_LE(TsatTableMaxError, 0.0001);
+
+    for (int i = 0; i < 9; ++i) {
+        EXPECT_NEAR(Iterated[i], PsyTsatFnPb(Pressures[i]), 0.0001);
+    }
+    // The band around the freezing discontinuity is still iterated
+    EXPECT_DOUBLE_EQ(0.0, PsyTsatFnPb(611.1));
+    EXPECT_DOUBLE_EQ(Iterated[4], PsyTsatFnPb(620.0));
+
+    Psychrometrics::clear_state();
+    EXPECT_FALSE(TsatTableActive);
+}
+
+TEST_F(EnergyPlusFixture, Psychrometrics_CacheSize)
+{
+    DataSystemVariables::PsychrometricCacheBits = 12;
+    InitializePsychRoutines();
+    EXPECT_EQ(4096, twbcache_size);
+    EXPECT_EQ(4096, psatcache_size);
+    EXPECT_EQ(4095, psatcache_mask);
+    EXPECT_EQ(4097u, cached_Twb.size());
+    EXPECT_EQ(4097u, cached_Psat.size());
+
+    // Cached results match the raw functions at the smaller size
+    EXPECT_NEAR(PsyPsatFnTemp_raw(21.0), PsyPsatFnTemp(21.0), 0.01);
+    EXPECT_NEAR(PsyTwbFnTdbWPb_raw(25.0, 0.01, 101325.0), PsyTwbFnTdbWPb(25.0, 0.01, 101325.0), 0.01);
+
+    // A cache that has not been set up on this thread is allocated by the first cached call
+    cached_Twb.deallocate();
+    cached_Psat.deallocate();
+    PsyTwbFnTdbWPb(25.0, 0.01, 101325.0);
+    EXPECT_EQ(4097u, cached_Twb.size());
+    EXPECT_EQ(4097u, cached_Psat.size());
+}
+
+TEST_F(EnergyPlusFixture, Psychrometrics_Statistics)
+{
+    InitializePsychRoutines();
+    for (int i = 0; i < 10; ++i) {
+        PsyPsatFnTemp(21.0);
+    }
+#ifdef EP_psych_stats
+    EXPECT_EQ(10, NumTimesCalled(iPsyPsatFnTemp_cache));
+    EXPECT_EQ(1, NumTimesCalled(iPsyPsatFnTemp));
+#else
+    // Calls are only counted in statistics builds
+    EXPECT_EQ(0, NumTimesCalled(iPsyPsatFnTemp_cache));
+    EXPECT_EQ(0, NumTimesCalled(iPsyPsatFnTemp));
+#endif
+
+    NumTimesCalled = 0;
+    NumTimesCalled(iPsyPsatFnTemp_cache) = 10;
+    NumTimesCalled(iPsyPsatFnTemp) = 1;
+    NumTimesCalled(iPsyTsatFnPb) = 4;
+    NumIterations(iPsyTsatFnPb) = 10;
+    MaxIterations(iPsyTsatFnPb) = 3;
+
+    std::ostringstream Stats;
+    WritePsychrometricStatistics(Stats);
+    EXPECT_EQ(0u, Stats.str().find("Routine,Calls,Average Iterations,Maximum Iterations,Cache Hit Ratio\n"));
+    EXPECT_NE(std::string::npos, Stats.str().find("\nPsyPsatFnTemp_cache,10,0,0,0.9\n"));
+    EXPECT_NE(std::string::npos, Stats.str().find("\nPsyTsatFnPb,4,2.5,3,\n"));
+}
@@ -0,0 +1,111 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::RefrigeratedCase Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/Psychrometrics.hh>
+#include <EnergyPlus/RefrigeratedCase.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::RefrigeratedCase;
+
+TEST_F(EnergyPlusFixture, RefrigeratedCase_SharedZoneAirStates)
+{
+    static std::string const RoutineName("CalculateWalkIn");
+
+    DataLoopNode::NumOfNodes = 2;
+    DataLoopNode::Node.allocate(2);
+    DataLoopNode::Node(1).Temp = 22.0;
+    DataLoopNode::Node(1).HumRat = 0.008;
+    DataLoopNode::Node(2).Temp = 18.0;
+    DataLoopNode::Node(2).HumRat = 0.006;
+    DataEnvironment::OutBaroPress = 101325.0;
+
+    // the shared states match the per-case psychrometric calls they replace
+    auto const checkZoneAir = [](int const ZoneNodeNum) {
+        Real64 const ZoneTemp = DataLoopNode::Node(ZoneNodeNum).Temp;
+        Real64 const ZoneRHFrac = Psychrometrics::PsyRhFnTdbWPb(ZoneTemp, DataLoopNode::Node(ZoneNodeNum).HumRat, DataEnvironment::OutBaroPress);
+        Real64 const ZoneDewPoint = Psychrometrics::PsyTdpFnWPb(DataLoopNode::Node(ZoneNodeNum).HumRat, DataEnvironment::OutBaroPress);
+        Real64 const ZoneEnthalpy = Psychrometrics::PsyHFnTdbRhPb(ZoneTemp, ZoneRHFrac, DataEnvironment::OutBaroPress, RoutineName);
+        Real64 const ZoneHumRat = Psychrometrics::PsyWFnTdbH(ZoneTemp, ZoneEnthalpy, RoutineName);
+        Real64 const ZoneDensity = Psychrometrics::PsyRhoAirFnPbTdbW(DataEnvironment::OutBaroPress, ZoneTemp, ZoneHumRat, RoutineName);
+
+        RefrigZoneAirData const &ZoneAir = GetRefrigZoneAir(ZoneNodeNum);
+        EXPECT_EQ(ZoneRHFrac, ZoneAir.RHFrac);
+        EXPECT_EQ(ZoneDewPoint, ZoneAir.DewPoint);
+
+        RefrigZoneAirData const &DoorAir = GetRefrigZoneAirInfiltration(ZoneNodeNum);
+        EXPECT_EQ(ZoneRHFrac, DoorAir.RHFrac);
+        EXPECT_EQ(ZoneEnthalpy, DoorAir.Enthalpy);
+        EXPECT_EQ(ZoneHumRat, DoorAir.DoorHumRat);
+        EXPECT_EQ(ZoneDensity, DoorAir.Density);
+    };
+
+    checkZoneAir(1);
+    checkZoneAir(2);
+    EXPECT_EQ(2u, RefrigZoneAir.size());
+
+    // a second case in the same zone reuses the stored states
+    RefrigZoneAir(1).RHFrac = -1.0;
+    EXPECT_EQ(-1.0, GetRefrigZoneAir(1).RHFrac);
+
+    // any change to the node conditions or the barometric pressure refreshes them
+    DataLoopNode::Node(1).Temp = 24.0;
+    checkZoneAir(1);
+    DataLoopNode::Node(1).HumRat = 0.009;
+    checkZoneAir(1);
+    DataEnvironment::OutBaroPress = 99000.0;
+    checkZoneAir(1);
+    checkZoneAir(2);
+}
@@ -50,6 +50,9 @@
 // Google Test Headers
 #include <gtest/gtest.h>
 
+// ObjexxFCL Headers
+#include <ObjexxFCL/member.functions.hh>
+
 // EnergyPlus Headers
 #include <AirflowNetwork/Elements.hpp>
 #include <EnergyPlus/AirflowNetworkBalanceManager.hh>
@@ -65,6 +68,8 @@
 #include <EnergyPlus/DataRoomAirModel.hh>
 #include <EnergyPlus/DataSizing.hh>
 #include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DataUCSDSharedData.hh>
+#include <EnergyPlus/DataVectorTypes.hh>
 #include <EnergyPlus/DataZoneControls.hh>
 #include <EnergyPlus/DataZoneEquipment.hh>
 #include <EnergyPlus/RoomAirModelAirflowNetwork.hh>
@@ -358,3 +363,122 @@ TEST_F(RoomAirflowNetworkTest, RAFNTest)
     EXPECT_NEAR(24.397538, Node(2).Temp, 0.00001);
     EXPECT_NEAR(0.0024802305, Node(2).HumRat, 0.000001);
 }
+
+TEST_F(RoomAirflowNetworkTest, RAFNTest_SetupNodeSums)
+{
+    int NumOfAirNodes = 3;
+    int NumOfSurfaces = 6;
+    int ZoneNum = 1;
+
+    Surface.allocate(NumOfSurfaces);
+    for (int SurfNum = 1; SurfNum <= NumOfSurfaces; ++SurfNum) {
+        Surface(SurfNum).HeatTransSurf = true;
+    }
+    Surface(3).HeatTransSurf = false;
+    Zone(ZoneNum).IsControlled = true;
+    Zone(ZoneNum).SurfaceFirst = 1;
+    Zone(ZoneNum).SurfaceLast = NumOfSurfaces;
+    ZoneEquipConfig(ZoneNum).ActualZoneNum = ZoneNum;
+
+    auto &thisZoneInfo(RoomAirflowNetworkZoneInfo(ZoneNum));
+    thisZoneInfo.IsUsed = true;
+    thisZoneInfo.ActualZoneID = ZoneNum;
+    thisZoneInfo.NumOfAirNodes = NumOfAirNodes;
+    thisZoneInfo.Node.allocate(NumOfAirNodes);
+    thisZoneInfo.ControlAirNodeID = 1;
+    for (int RoomAirNodeNum = 1; RoomAirNodeNum <= NumOfAirNodes; ++RoomAirNodeNum) {
+        thisZoneInfo.Node(RoomAirNodeNum).SurfMask.dimension(NumOfSurfaces, false);
+    }
+    thisZoneInfo.Node(1).HasSurfacesAssigned = true;
+    thisZoneInfo.Node(1).SurfMask(1) = true;
+    thisZoneInfo.Node(2).HasSurfacesAssigned = true;
+    thisZoneInfo.Node(2).SurfMask(2) = true;
+    thisZoneInfo.Node(2).SurfMask(3) = true;
+    thisZoneInfo.Node(2).SurfMask(4) = true;
+    // a node without surfaces assigned still keeps its masked surfaces away from the control node
+    thisZoneInfo.Node(3).HasSurfacesAssigned = false;
+    thisZoneInfo.Node(3).SurfMask(5) = true;
+
+    auto &thisRAFN(RAFN(ZoneNum));
+    thisRAFN.ZoneNum = ZoneNum;
+    thisRAFN.SetupNodeSums();
+
+    EXPECT_TRUE(thisRAFN.NodeSumsSetUp);
+    EXPECT_EQ(1, thisRAFN.ZoneEquipConfigIndex);
+    EXPECT_EQ(0, thisRAFN.ZoneRetPlenumIndex);
+    EXPECT_EQ(0, thisRAFN.ZoneSupPlenumIndex);
+
+    // the surfaces the node sums used to select by scanning the zone surfaces and the other nodes' masks on every call
+    for (int RoomAirNodeNum = 1; RoomAirNodeNum <= NumOfAirNodes; ++RoomAirNodeNum) {
+        std::vector<int> scannedSurfaces;
+        if (thisZoneInfo.Node(RoomAirNodeNum).HasSurfacesAssigned) {
+            for (int SurfNum = Zone(ZoneNum).SurfaceFirst; SurfNum <= Zone(ZoneNum).SurfaceLast; ++SurfNum) {
+                if (!Surface(SurfNum).HeatTransSurf) continue;
+                if (thisZoneInfo.ControlAirNodeID == RoomAirNodeNum) {
+                    bool Found = false;
+                    for (int Loop = 1; Loop <= thisZoneInfo.NumOfAirNodes; ++Loop) {
+                        if (Loop != RoomAirNodeNum) {
+                            if (thisZoneInfo.Node(Loop).SurfMask(SurfNum - Zone(ZoneNum).SurfaceFirst + 1)) {
+                                Found = true;
+                                break;
+                            }
+                        }
+                    }
+                    if (Found) continue;
+                } else {
+                    if (!thisZoneInfo.Node(RoomAirNodeNum).SurfMask(SurfNum - Zone(ZoneNum).SurfaceFirst + 1)) continue;
+                }
+                scannedSurfaces.push_back(SurfNum);
+            }
+        }
+        EXPECT_EQ(scannedSurfaces, thisRAFN.NodeSurfaces(RoomAirNodeNum));
+    }
+    EXPECT_EQ(std::vector<int>({1, 6}), thisRAFN.NodeSurfaces(1));
+    EXPECT_EQ(std::vector<int>({2, 4}), thisRAFN.NodeSurfaces(2));
+    EXPECT_TRUE(thisRAFN.NodeSurfaces(3).empty());
+
+    // an uncontrolled zone has no zone equipment configuration
+    Zone(ZoneNum).IsControlled = false;
+    thisRAFN.SetupNodeSums();
+    EXPECT_EQ(0, thisRAFN.ZoneEquipConfigIndex);
+}
+
+TEST_F(EnergyPlusFixture, RoomAirModelManager_SharedSurfaceHeights)
+{
+    // the UFAD convection coefficients read the surface heights kept at initialization instead of taking the
+    // vertex minimum and maximum on every call
+    NumOfZones = 1;
+    TotSurfaces = 4;
+    int ZoneNum = 1;
+    Zone.allocate(NumOfZones);
+    Zone(ZoneNum).SurfaceFirst = 1;
+    Zone(ZoneNum).SurfaceLast = TotSurfaces;
+    Zone(ZoneNum).CeilingHeight = 3.0;
+    IsZoneDV.dimension(NumOfZones, false);
+    IsZoneCV.dimension(NumOfZones, false);
+    IsZoneUI.dimension(NumOfZones, false);
+    BeginEnvrnFlag = false;
+
+    Surface.allocate(TotSurfaces);
+    Surface(1).Class = SurfaceClass_Wall;
+    Surface(2).Class = SurfaceClass_Window;
+    Surface(3).Class = SurfaceClass_Door;
+    Surface(4).Class = SurfaceClass_IntMass;
+    std::vector<std::vector<Real64>> const vertexZ = {{3.0, 0.0, 0.0, 3.0}, {2.1, 0.8, 0.8, 2.2}, {2.0, 0.05, 1.1}};
+    for (int SurfNum = 1; SurfNum <= 3; ++SurfNum) {
+        Surface(SurfNum).Sides = static_cast<int>(vertexZ[SurfNum - 1].size());
+        Surface(SurfNum).Vertex.allocate(Surface(SurfNum).Sides);
+        for (int i = 1; i <= Surface(SurfNum).Sides; ++i) {
+            Surface(SurfNum).Vertex(i) = DataVectorTypes::Vector(0.5 * i, 0.0, vertexZ[SurfNum - 1][i - 1]);
+        }
+    }
+
+    SharedDVCVUFDataInit(ZoneNum);
+
+    for (int SurfNum = 1; SurfNum <= 3; ++SurfNum) {
+        EXPECT_EQ(minval(Surface(SurfNum).Vertex({1, Surface(SurfNum).Sides}), &DataVectorTypes::Vector::z), DataUCSDSharedData::SurfMinZ(SurfNum));
+        EXPECT_EQ(maxval(Surface(SurfNum).Vertex({1, Surface(SurfNum).Sides}), &DataVectorTypes::Vector::z), DataUCSDSharedData::SurfMaxZ(SurfNum));
+    }
+    EXPECT_EQ(0.05, DataUCSDSharedData::SurfMinZ(3));
+    EXPECT_EQ(2.2, DataUCSDSharedData::SurfMaxZ(2));
+}
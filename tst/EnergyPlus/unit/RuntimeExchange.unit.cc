@@ -0,0 +1,200 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::RuntimeExchange Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/gio.hh>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataRuntimeLanguage.hh>
+#include <EnergyPlus/DataStringGlobals.hh>
+#include <EnergyPlus/EMSManager.hh>
+#include <EnergyPlus/FileSystem.hh>
+#include <EnergyPlus/RuntimeExchange.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+
+namespace {
+
+void countCalls(void *userData)
+{
+    ++*static_cast<int *>(userData);
+}
+
+std::string readFile(std::string const &fileName)
+{
+    std::ifstream file(fileName);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+} // namespace
+
+TEST_F(EnergyPlusFixture, RuntimeExchange_CallbacksAtCallingPoints)
+{
+    int numCalls(0);
+    EXPECT_EQ(0, RuntimeExchange::RegisterCallback(DataGlobals::emsCallFromSetupSimulation, countCalls, &numCalls));
+    EXPECT_EQ(0, RuntimeExchange::RegisterCallback(DataGlobals::emsCallFromUserDefinedComponentModel, countCalls, &numCalls));
+    EXPECT_FALSE(RuntimeExchange::AnyCallbacks());
+
+    EXPECT_EQ(1, RuntimeExchange::RegisterCallback(DataGlobals::emsCallFromBeforeHVACManagers, countCalls, &numCalls));
+    EXPECT_TRUE(RuntimeExchange::AnyCallbacks());
+
+    EXPECT_FALSE(RuntimeExchange::RunCallbacks(DataGlobals::emsCallFromAfterHVACManagers));
+    EXPECT_EQ(0, numCalls);
+    EXPECT_TRUE(RuntimeExchange::RunCallbacks(DataGlobals::emsCallFromBeforeHVACManagers));
+    EXPECT_EQ(1, numCalls);
+
+    // callbacks survive a state reset, handles do not
+    RuntimeExchange::clear_state();
+    EXPECT_TRUE(RuntimeExchange::AnyCallbacks());
+    RuntimeExchange::ClearCallbacks();
+    EXPECT_FALSE(RuntimeExchange::AnyCallbacks());
+}
+
+TEST_F(EnergyPlusFixture, RuntimeExchange_ActuatorHandles)
+{
+    DataRuntimeLanguage::EMSActuatorAvailable.allocate(10);
+
+    bool realActuated(false);
+    Real64 realValue(0.0);
+    bool intActuated(false);
+    int intValue(0);
+    SetupEMSActuator("Schedule:Constant", "SETPOINT", "Schedule Value", "[ ]", realActuated, realValue);
+    SetupEMSActuator("Fan", "SUPPLY FAN", "Mode", "[ ]", intActuated, intValue);
+
+    int const realHandle = RuntimeExchange::GetActuatorHandle("SCHEDULE:CONSTANT", "Schedule Value", "Setpoint");
+    int const intHandle = RuntimeExchange::GetActuatorHandle("Fan", "Mode", "Supply Fan");
+    EXPECT_EQ(1, realHandle);
+    EXPECT_EQ(2, intHandle);
+    EXPECT_EQ(0, RuntimeExchange::GetActuatorHandle("Fan", "Mode", "Return Fan"));
+
+    RuntimeExchange::SetActuatorValue(realHandle, 21.5);
+    RuntimeExchange::SetActuatorValue(intHandle, 2.7);
+    EXPECT_TRUE(realActuated);
+    EXPECT_DOUBLE_EQ(21.5, realValue);
+    EXPECT_TRUE(intActuated);
+    EXPECT_EQ(2, intValue);
+
+    RuntimeExchange::ResetActuator(realHandle);
+    EXPECT_FALSE(realActuated);
+
+    // invalid handles are ignored
+    RuntimeExchange::SetActuatorValue(0, 1.0);
+    RuntimeExchange::SetActuatorValue(3, 1.0);
+}
+
+#ifndef _WIN32
+TEST_F(EnergyPlusFixture, RuntimeExchange_ForkRelocatesOutputFiles)
+{
+    std::string const outputDir("RuntimeExchange_ForkTest/");
+    FileSystem::makeDirectory(outputDir);
+    DataStringGlobals::outputDirPathName = outputDir;
+    DataStringGlobals::outputDbgFileName = outputDir + "eplusout.dbg";
+    DataStringGlobals::outputMtdFileName = outputDir + "eplusout.mtd";
+    DataStringGlobals::outputAuditFileName = "eplusout.audit"; // not in the output directory
+
+    // an open output file keeps what was written before the fork and is appended to in the copy
+    int const dbgUnit = GetNewUnitNumber();
+    {
+        IOFlags flags;
+        flags.ACTION("write");
+        ObjexxFCL::gio::open(dbgUnit, DataStringGlobals::outputDbgFileName, flags);
+    }
+    ObjexxFCL::gio::write(dbgUnit, "(A)") << "before fork";
+
+    int const copyNum = RuntimeExchange::ForkSimulation(2);
+    if (copyNum > 0) {
+        // in the copy, report back through the exit status only
+        ObjexxFCL::gio::write(dbgUnit, "(A)") << "copy " + std::to_string(copyNum);
+        ObjexxFCL::gio::close(dbgUnit);
+        std::string const forkDir(outputDir + "fork" + std::to_string(copyNum) + "/");
+        bool const relocated = (DataStringGlobals::outputDbgFileName == forkDir + "eplusout.dbg") &&
+                               (DataStringGlobals::outputMtdFileName == forkDir + "eplusout.mtd") &&
+                               (DataStringGlobals::outputAuditFileName == "eplusout.audit");
+        std::_Exit(relocated ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    ASSERT_EQ(0, copyNum);
+    EXPECT_EQ(0, RuntimeExchange::WaitForForks());
+
+    ObjexxFCL::gio::write(dbgUnit, "(A)") << "parent";
+    ObjexxFCL::gio::close(dbgUnit);
+
+    // the parent keeps its own file names and output
+    EXPECT_EQ(outputDir + "eplusout.dbg", DataStringGlobals::outputDbgFileName);
+    EXPECT_EQ("before fork\nparent\n", readFile(outputDir + "eplusout.dbg"));
+    EXPECT_EQ("before fork\ncopy 1\n", readFile(outputDir + "fork1/eplusout.dbg"));
+    EXPECT_EQ("before fork\ncopy 2\n", readFile(outputDir + "fork2/eplusout.dbg"));
+
+    // relocating directly moves the file names and the open units of this process
+    RuntimeExchange::RelocateOutputFiles(outputDir + "fork3/");
+    EXPECT_EQ(outputDir + "fork3/eplusout.dbg", DataStringGlobals::outputDbgFileName);
+    EXPECT_EQ(outputDir + "fork3/eplusout.mtd", DataStringGlobals::outputMtdFileName);
+    EXPECT_EQ("eplusout.audit", DataStringGlobals::outputAuditFileName);
+
+    for (std::string const forkDir : {"fork1/", "fork2/", "fork3/"}) {
+        std::remove((outputDir + forkDir + "eplusout.dbg").c_str());
+        std::remove((outputDir + forkDir).c_str());
+    }
+    std::remove((outputDir + "eplusout.dbg").c_str());
+    std::remove(outputDir.c_str());
+}
+#endif
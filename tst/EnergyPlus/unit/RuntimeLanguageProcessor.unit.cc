@@ -140,3 +140,81 @@ TEST_F(EnergyPlusFixture, TestOutOfRangeAlphaFields)
 
 
 }
+
+TEST_F(EnergyPlusFixture, ERLExpression_CompiledNumericExpression)
+{
+    // set the program state so that errors can be thrown
+    DataGlobals::DoingSizing = false;
+    DataGlobals::KickOffSimulation = false;
+    EMSManager::FinishProcessingUserInput = false;
+
+    bool errorsFound = false;
+
+    DataRuntimeLanguage::ErlVariable.allocate(1);
+    DataRuntimeLanguage::ErlVariable(1).Value = DataRuntimeLanguage::ErlValueType();
+    DataRuntimeLanguage::ErlVariable(1).Value.Type = DataRuntimeLanguage::ValueNumber;
+
+    // (X + 2) / 4 > 1
+    DataRuntimeLanguage::ErlExpression.allocate(3);
+    auto &sumExpression = DataRuntimeLanguage::ErlExpression(1);
+    sumExpression.Operator = DataRuntimeLanguage::OperatorAdd;
+    sumExpression.NumOperands = 2;
+    sumExpression.Operand.allocate(2);
+    sumExpression.Operand(1).Type = DataRuntimeLanguage::ValueVariable;
+    sumExpression.Operand(1).Variable = 1;
+    sumExpression.Operand(2).Type = DataRuntimeLanguage::ValueNumber;
+    sumExpression.Operand(2).Number = 2.0;
+
+    auto &divideExpression = DataRuntimeLanguage::ErlExpression(2);
+    divideExpression.Operator = DataRuntimeLanguage::OperatorDivide;
+    divideExpression.NumOperands = 2;
+    divideExpression.Operand.allocate(2);
+    divideExpression.Operand(1).Type = DataRuntimeLanguage::ValueExpression;
+    divideExpression.Operand(1).Expression = 1;
+    divideExpression.Operand(2).Type = DataRuntimeLanguage::ValueVariable;
+    divideExpression.Operand(2).Variable = 1;
+
+    auto &compareExpression = DataRuntimeLanguage::ErlExpression(3);
+    compareExpression.Operator = DataRuntimeLanguage::OperatorGreaterThan;
+    compareExpression.NumOperands = 2;
+    compareExpression.Operand.allocate(2);
+    compareExpression.Operand(1).Type = DataRuntimeLanguage::ValueExpression;
+    compareExpression.Operand(1).Expression = 2;
+    compareExpression.Operand(2).Type = DataRuntimeLanguage::ValueNumber;
+    compareExpression.Operand(2).Number = 1.0;
+
+    // an uninitialized variable is left to the interpreter, which reports it
+    auto response1 = RuntimeLanguageProcessor::EvaluateExpression(3, errorsFound);
+    EXPECT_TRUE(errorsFound);
+    EXPECT_EQ(DataRuntimeLanguage::ValueError, response1.Type);
+    EXPECT_EQ(DataRuntimeLanguage::ByteCodeCompiled, compareExpression.CompileState);
+
+    errorsFound = false;
+    DataRuntimeLanguage::ErlVariable(1).Value.Number = 4.0;
+    DataRuntimeLanguage::ErlVariable(1).Value.initialized = true;
+    auto response2 = RuntimeLanguageProcessor::EvaluateExpression(2, errorsFound);
+    EXPECT_FALSE(errorsFound);
+    EXPECT_DOUBLE_EQ(1.5, response2.Number);
+    auto response3 = RuntimeLanguageProcessor::EvaluateExpression(3, errorsFound);
+    EXPECT_FALSE(errorsFound);
+    EXPECT_DOUBLE_EQ(1.0, response3.Number);
+
+    // dividing by zero falls back to the interpreter and its error
+    DataRuntimeLanguage::ErlVariable(1).Value.Number = 0.0;
+    auto response4 = RuntimeLanguageProcessor::EvaluateExpression(2, errorsFound);
+    EXPECT_TRUE(errorsFound);
+    EXPECT_EQ(DataRuntimeLanguage::ValueError, response4.Type);
+}
+
+TEST_F(EnergyPlusFixture, ERLValue_ErrorMessageTable)
+{
+    DataRuntimeLanguage::ErlValueType value;
+    value.Type = DataRuntimeLanguage::ValueError;
+    value.ErrorNum = RuntimeLanguageProcessor::ErlValueErrorNum("Divide By Zero");
+    EXPECT_EQ(" *** Error: Divide By Zero *** ", RuntimeLanguageProcessor::ValueToString(value));
+
+    // repeated messages share one entry
+    EXPECT_EQ(value.ErrorNum, RuntimeLanguageProcessor::ErlValueErrorNum("Divide By Zero"));
+    EXPECT_NE(value.ErrorNum, RuntimeLanguageProcessor::ErlValueErrorNum("Natural Log of zero or less"));
+    EXPECT_EQ(2u, DataRuntimeLanguage::ErlValueError.size());
+}
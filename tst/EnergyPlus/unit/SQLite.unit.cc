@@ -376,6 +376,39 @@ TEST_F(SQLiteFixture, SQLiteProcedures_createSQLiteReportDataRecord)
     EXPECT_EQ(2ul, reportExtendedData.size());
 }
 
+TEST_F(SQLiteFixture, SQLiteProcedures_createSQLiteReportDataRecordBatched)
+{
+    EnergyPlus::sqlite->sqliteBegin();
+    EnergyPlus::sqlite->createSQLiteTimeIndexRecord(4, 1, 1, 0, 2017);
+    EnergyPlus::sqlite->createSQLiteReportDictionaryRecord(1, 1, "Zone", "Environment", "Site Outdoor Air Drybulb Temperature", 1, "C", 1, false, _);
+    // two full batches and a partial one
+    for (int i = 1; i <= 250; ++i) {
+        EnergyPlus::sqlite->createSQLiteReportDataRecord(1, 0.5 * i);
+    }
+    EnergyPlus::sqlite->createSQLiteReportDataRecord(1, 999.9, 2, 0, 1310459, 100, 7031530, 15);
+    EnergyPlus::sqlite->sqliteCommit();
+
+    // outside of a transaction rows are written at once
+    EnergyPlus::sqlite->createSQLiteReportDataRecord(1, 1.5);
+
+    auto reportData = queryResult("SELECT * FROM ReportData;", "ReportData");
+    auto reportExtendedData = queryResult("SELECT * FROM ReportExtendedData;", "ReportExtendedData");
+
+    ASSERT_EQ(252ul, reportData.size());
+    for (int i = 1; i <= 250; ++i) {
+        std::vector<std::string> row{std::to_string(i), "1", "1", reportData[i - 1][3]};
+        EXPECT_EQ(row, reportData[i - 1]);
+        EXPECT_DOUBLE_EQ(0.5 * i, std::stod(reportData[i - 1][3]));
+    }
+    std::vector<std::string> reportData250{"251", "1", "1", "999.9"};
+    std::vector<std::string> reportData251{"252", "1", "1", "1.5"};
+    EXPECT_EQ(reportData250, reportData[250]);
+    EXPECT_EQ(reportData251, reportData[251]);
+
+    ASSERT_EQ(1ul, reportExtendedData.size());
+    EXPECT_EQ("251", reportExtendedData[0][1]);
+}
+
 TEST_F(SQLiteFixture, SQLiteProcedures_addSQLiteZoneSizingRecord)
 {
     EnergyPlus::sqlite->sqliteBegin();
@@ -1052,4 +1085,44 @@ TEST_F(SQLiteFixture, SQLiteProcedures_createSQLiteTabularDataRecords)
     EXPECT_EQ(stringType4, stringTypes[4]);
     EXPECT_EQ(stringType5, stringTypes[5]);
 }
+
+TEST_F(SQLiteFixture, SQLiteProcedures_createSQLiteTabularDataRecordsBatched)
+{
+    // more cells than one batched insert holds, written within a transaction
+    int const numRows = 50;
+    int const numCols = 3;
+    Array1D_string rowLabels(numRows);
+    Array1D_string const columnLabels({"Electricity [GJ]", "Natural Gas [GJ]", "District Cooling"});
+    Array2D_string body(numCols, numRows);
+    for (int row = 1; row <= numRows; ++row) {
+        rowLabels(row) = "Zone " + std::to_string(row) + " [kWh]";
+        for (int col = 1; col <= numCols; ++col) {
+            body(col, row) = std::to_string(100 * row + col);
+        }
+    }
+
+    EnergyPlus::sqlite->sqliteBegin();
+    EnergyPlus::sqlite->createSQLiteSimulationsRecord(1, "EnergyPlus Version", "Current Time");
+    EnergyPlus::sqlite->createSQLiteTabularDataRecords(body, rowLabels, columnLabels, "ZoneSummary", "Entire Facility", "Zones");
+    auto tabularData = queryResult("SELECT * FROM TabularData ORDER BY TabularDataIndex;", "TabularData");
+    auto strings = queryResult("SELECT * FROM Strings;", "Strings");
+    EnergyPlus::sqlite->sqliteCommit();
+
+    ASSERT_EQ(150ul, tabularData.size());
+    for (std::size_t i = 0; i < tabularData.size(); ++i) {
+        EXPECT_EQ(std::to_string(i + 1), tabularData[i][0]);
+    }
+    // the first column has units, so the row names follow it; the last column has none and takes the units of the rows
+    std::vector<std::string> tabularData0{"1", "1", "2", "3", "6", "4", "5", "1", "0", "0", "101"};
+    std::vector<std::string> tabularData100{"101", "1", "2", "3", "6", "57", "58", "1", "0", "2", "103"};
+    std::vector<std::string> tabularData149{"150", "1", "2", "3", "55", "57", "58", "1", "49", "2", "5003"};
+    EXPECT_EQ(tabularData0, tabularData[0]);
+    EXPECT_EQ(tabularData100, tabularData[100]);
+    EXPECT_EQ(tabularData149, tabularData[149]);
+
+    // report, report for, table, three columns, GJ, kWh and 50 rows
+    ASSERT_EQ(58ul, strings.size());
+    std::vector<std::string> string57{"58", "6", "kWh"};
+    EXPECT_EQ(string57, strings[57]);
+}
 } // namespace EnergyPlus
@@ -54,6 +54,7 @@
 // EnergyPlus Headers
 #include "Fixtures/EnergyPlusFixture.hh"
 #include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/General.hh>
 #include <EnergyPlus/ScheduleManager.hh>
 
@@ -647,3 +648,155 @@ TEST_F(EnergyPlusFixture, ScheduleYearMaxItems)
     EXPECT_TRUE(compare_err_stream(delimited_string({"   ** Severe  ** <root>[Schedule:Year][SchYr_A][schedule_weeks] - Array should contain no more than 53 elements."})));
 
 }
+
+TEST_F(EnergyPlusFixture, ScheduleManager_CompiledSchedules)
+{
+    std::string const idf_objects = delimited_string({
+        "Schedule:Compact,",
+        "  Office Occupancy,        !- Name",
+        "  ,                        !- Schedule Type Limits Name",
+        "  Through: 12/31,          !- Field 1",
+        "  For: Weekdays,           !- Field 2",
+        "  Until: 08:00, 0.0,       !- Field 3",
+        "  Until: 12:10, 0.9,       !- Field 5",
+        "  Until: 13:00, 0.5,       !- Field 7",
+        "  Until: 18:00, 0.9,       !- Field 9",
+        "  Until: 24:00, 0.1,       !- Field 11",
+        "  For: AllOtherDays,       !- Field 13",
+        "  Until: 24:00, 0.0;       !- Field 14",
+        "Schedule:Compact,",
+        "  Always Half,             !- Name",
+        "  ,                        !- Schedule Type Limits Name",
+        "  Through: 12/31,          !- Field 1",
+        "  For: AllDays,            !- Field 2",
+        "  Until: 24:00, 0.5;       !- Field 3",
+    });
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    DataGlobals::NumOfTimeStepInHour = 6;
+    DataGlobals::MinutesPerTimeStep = 10;
+    DataGlobals::TimeStepZone = 1.0 / 6.0;
+    DataEnvironment::DayOfYear_Schedule = General::OrdinalDay(1, 3, 1);
+    DataEnvironment::HolidayIndex = 0;
+    DataEnvironment::DSTIndicator = 0;
+
+    int const OccSched(GetScheduleIndex("OFFICE OCCUPANCY"));
+    int const HalfSched(GetScheduleIndex("ALWAYS HALF"));
+
+    // A weekday, a Saturday, and the weekday again with daylight saving time, first with every value set at each
+    // step and then with the compiled timelines
+    std::vector<Real64> OccValues;
+    std::vector<Real64> HalfValues;
+    for (int Pass = 1; Pass <= 2; ++Pass) {
+        DataSystemVariables::CompiledSchedules = (Pass == 2);
+        std::size_t Step(0);
+        for (int Day = 1; Day <= 3; ++Day) {
+            DataEnvironment::DayOfWeek = (Day == 2) ? 7 : 2;
+            DataEnvironment::DSTIndicator = (Day == 3) ? 1 : 0;
+            for (DataGlobals::HourOfDay = 1; DataGlobals::HourOfDay <= 24; ++DataGlobals::HourOfDay) {
+                for (DataGlobals::TimeStep = 1; DataGlobals::TimeStep <= DataGlobals::NumOfTimeStepInHour; ++DataGlobals::TimeStep) {
+                    UpdateScheduleValues();
+                    if (Pass == 1) {
+                        OccValues.push_back(GetCurrentScheduleValue(OccSched));
+                        HalfValues.push_back(GetCurrentScheduleValue(HalfSched));
+                    } else {
+                        EXPECT_EQ(OccValues[Step], GetCurrentScheduleValue(OccSched));
+                        EXPECT_EQ(HalfValues[Step], GetCurrentScheduleValue(HalfSched));
+                    }
+                    ++Step;
+                }
+            }
+        }
+    }
+
+    // Unchanged values are left alone between their change steps
+    DataEnvironment::DSTIndicator = 0;
+    DataEnvironment::DayOfWeek = 2;
+    DataGlobals::HourOfDay = 10;
+    DataGlobals::TimeStep = 1;
+    UpdateScheduleValues();
+    EXPECT_EQ(0.9, GetCurrentScheduleValue(OccSched));
+    Schedule(HalfSched).CurrentValue = -1.0;
+    DataGlobals::TimeStep = 2;
+    UpdateScheduleValues();
+    EXPECT_EQ(-1.0, GetCurrentScheduleValue(HalfSched));
+    DataGlobals::HourOfDay = 13;
+    DataGlobals::TimeStep = 2;
+    UpdateScheduleValues(); // not the next step, so every value is set again
+    EXPECT_EQ(0.5, GetCurrentScheduleValue(HalfSched));
+    EXPECT_EQ(0.5, GetCurrentScheduleValue(OccSched));
+    DataGlobals::TimeStep = 3;
+    UpdateScheduleValues();
+    EXPECT_EQ(0.5, GetCurrentScheduleValue(OccSched));
+}
+
+TEST_F(EnergyPlusFixture, ScheduleManager_DeduplicateSchedules)
+{
+    std::string const idf_objects = delimited_string({
+        "Schedule:Compact,",
+        "  Lights A,                !- Name",
+        "  ,                        !- Schedule Type Limits Name",
+        "  Through: 12/31,          !- Field 1",
+        "  For: Weekdays,           !- Field 2",
+        "  Until: 08:00, 0.1,       !- Field 3",
+        "  Until: 18:00, 0.9,       !- Field 5",
+        "  Until: 24:00, 0.1,       !- Field 7",
+        "  For: AllOtherDays,       !- Field 9",
+        "  Until: 24:00, 0.1;       !- Field 10",
+        "Schedule:Compact,",
+        "  Lights B,                !- Name",
+        "  ,                        !- Schedule Type Limits Name",
+        "  Through: 12/31,          !- Field 1",
+        "  For: Weekdays,           !- Field 2",
+        "  Until: 08:00, 0.1,       !- Field 3",
+        "  Until: 18:00, 0.9,       !- Field 5",
+        "  Until: 24:00, 0.1,       !- Field 7",
+        "  For: AllOtherDays,       !- Field 9",
+        "  Until: 24:00, 0.1;       !- Field 10",
+        "Schedule:Compact,",
+        "  Lights C,                !- Name",
+        "  ,                        !- Schedule Type Limits Name",
+        "  Through: 12/31,          !- Field 1",
+        "  For: AllDays,            !- Field 2",
+        "  Until: 08:00, 0.1,       !- Field 3",
+        "  Until: 18:00, 0.9,       !- Field 5",
+        "  Until: 24:00, 0.1;       !- Field 7",
+    });
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    DataGlobals::NumOfTimeStepInHour = 4;
+    DataGlobals::MinutesPerTimeStep = 15;
+    DataGlobals::TimeStepZone = 0.25;
+    DataSystemVariables::DeduplicateSchedules = true;
+
+    int const SchedA(GetScheduleIndex("LIGHTS A"));
+    int const SchedB(GetScheduleIndex("LIGHTS B"));
+    int const SchedC(GetScheduleIndex("LIGHTS C"));
+    EXPECT_EQ(0, Schedule(SchedA).SameAs);
+    EXPECT_EQ(SchedA, Schedule(SchedB).SameAs);
+    EXPECT_EQ(0, Schedule(SchedC).SameAs); // same weekdays, but not on weekends
+
+    // The day schedules of B share the values of those of A
+    int const WeekA(Schedule(SchedA).WeekSchedulePointer(1));
+    int const WeekB(Schedule(SchedB).WeekSchedulePointer(1));
+    EXPECT_EQ(WeekSchedule(WeekA).DaySchedulePointer(2), WeekSchedule(WeekB).DaySchedulePointer(2));
+    EXPECT_FALSE(DaySchedule(WeekSchedule(WeekB).InputDaySchedulePointer(2)).TSValue.allocated());
+    EXPECT_TRUE(DaySchedule(WeekSchedule(WeekB).InputDaySchedulePointer(2)).Used);
+    EXPECT_EQ(0.9, DaySchedule(WeekSchedule(WeekB).InputDaySchedulePointer(2)).TSValMax);
+
+    DataEnvironment::DayOfYear_Schedule = General::OrdinalDay(1, 3, 1);
+    DataEnvironment::HolidayIndex = 0;
+    DataEnvironment::DSTIndicator = 0;
+    DataEnvironment::DayOfWeek = 3;
+    DataGlobals::HourOfDay = 12;
+    DataGlobals::TimeStep = 1;
+    UpdateScheduleValues();
+    EXPECT_EQ(0.9, GetCurrentScheduleValue(SchedA));
+    EXPECT_EQ(0.9, GetCurrentScheduleValue(SchedB));
+    EXPECT_EQ(0.9, GetCurrentScheduleValue(SchedC));
+    DataEnvironment::DayOfWeek = 1;
+    UpdateScheduleValues();
+    EXPECT_EQ(0.1, GetCurrentScheduleValue(SchedA));
+    EXPECT_EQ(0.1, GetCurrentScheduleValue(SchedB));
+    EXPECT_EQ(0.9, GetCurrentScheduleValue(SchedC));
+}
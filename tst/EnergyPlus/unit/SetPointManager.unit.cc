@@ -555,6 +555,29 @@ TEST_F(EnergyPlusFixture, CalcScheduledTESSetPoint)
     EXPECT_EQ(SetPointManager::SchTESSetPtMgr(schManNum).NonChargeCHWTemp, SetPointManager::SchTESSetPtMgr(schManNum).SetPt);
 }
 
+TEST_F(EnergyPlusFixture, SetPointManager_ScheduledNodeFieldUpdate)
+{
+    EXPECT_TRUE(SetPointManager::GetSetPointNodeField(0) == nullptr);
+    EXPECT_TRUE(SetPointManager::GetSetPointNodeField(SetPointManager::iCtrlVarType_MaxHumRat) == &DataLoopNode::NodeData::HumRatMax);
+
+    DataLoopNode::Node.allocate(2);
+    SetPointManager::NumSchSetPtMgrs = 1;
+    SetPointManager::SchSetPtMgr.allocate(1);
+    SetPointManager::SchSetPtMgr(1).CtrlTypeMode = SetPointManager::iCtrlVarType_MaxHumRat;
+    SetPointManager::SchSetPtMgr(1).NumCtrlNodes = 2;
+    SetPointManager::SchSetPtMgr(1).CtrlNodes.allocate(2);
+    SetPointManager::SchSetPtMgr(1).CtrlNodes(1) = 1;
+    SetPointManager::SchSetPtMgr(1).CtrlNodes(2) = 2;
+    SetPointManager::SchSetPtMgr(1).SetPt = 0.008;
+
+    SetPointManager::UpdateSetPointManagers();
+
+    EXPECT_DOUBLE_EQ(0.008, DataLoopNode::Node(1).HumRatMax);
+    EXPECT_DOUBLE_EQ(0.008, DataLoopNode::Node(2).HumRatMax);
+    EXPECT_DOUBLE_EQ(DataLoopNode::SensedNodeFlagValue, DataLoopNode::Node(1).HumRatSetPoint);
+    EXPECT_TRUE(SetPointManager::SchSetPtMgr(1).CtrlNodeField == &DataLoopNode::NodeData::HumRatMax);
+}
+
 TEST_F(EnergyPlusFixture, SZRHOAFractionImpact)
 {
     std::string const idf_objects = delimited_string({
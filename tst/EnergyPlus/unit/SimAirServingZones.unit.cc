@@ -54,6 +54,7 @@
 #include <cassert>
 #include <cmath>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -62,10 +63,17 @@
 // EnergyPlus Headers
 #include "Fixtures/EnergyPlusFixture.hh"
 #include <DataAirSystems.hh>
+#include <DataLoopNode.hh>
+#include <DataPlant.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
 #include <MixedAir.hh>
+#include <OutputProcessor.hh>
+#include <PlantUtilities.hh>
 #include <SimAirServingZones.hh>
+#include <SimulationManager.hh>
 #include <UtilityRoutines.hh>
+#include <WaterCoils.hh>
 
 using namespace EnergyPlus;
 using namespace DataAirSystems;
@@ -630,4 +638,1112 @@ TEST_F(EnergyPlusFixture, GetAirPathData_ControllerLockout2)
     EXPECT_TRUE(PrimaryAirSystem(1).CanBeLockedOutByEcono(2));
 }
 
+TEST_F(EnergyPlusFixture, SimAirServingZones_AirLoopComponentState)
+{
+    EXPECT_TRUE(SimAirServingZones::AirLoopComponentBypassAllowed(SimAirServingZones::Duct));
+    EXPECT_TRUE(SimAirServingZones::AirLoopComponentBypassAllowed(SimAirServingZones::Fan_Simple_VAV));
+    EXPECT_FALSE(SimAirServingZones::AirLoopComponentBypassAllowed(SimAirServingZones::OAMixer_Num));
+    EXPECT_FALSE(SimAirServingZones::AirLoopComponentBypassAllowed(SimAirServingZones::WaterCoil_Cooling));
+
+    DataLoopNode::Node.allocate(2);
+    DataLoopNode::Node(1).Temp = 20.0;
+    DataLoopNode::Node(1).MassFlowRate = 1.0;
+    DataLoopNode::Node(2).Temp = 21.0;
+    DataLoopNode::Node(2).MassFlowRate = 1.0;
+
+    std::vector<Real64> SimulatedState;
+    std::vector<Real64> CurrentState;
+    SimAirServingZones::GetAirLoopComponentState(1, 2, false, SimulatedState);
+    SimAirServingZones::GetAirLoopComponentState(1, 2, false, CurrentState);
+    EXPECT_EQ(SimulatedState, CurrentState);
+
+    // a different iteration type or an outlet written by another component forces a new simulation
+    SimAirServingZones::GetAirLoopComponentState(1, 2, true, CurrentState);
+    EXPECT_NE(SimulatedState, CurrentState);
+    DataLoopNode::Node(2).MassFlowRate = 0.5;
+    SimAirServingZones::GetAirLoopComponentState(1, 2, false, CurrentState);
+    EXPECT_NE(SimulatedState, CurrentState);
+}
+
+TEST_F(EnergyPlusFixture, SimAirServingZones_ControllerSweepsSolveCoupledCoils)
+{
+    // Two hot water coils in series on the main branch, with the controller of the downstream coil B listed
+    // ahead of the controller of the upstream coil A. Coil B is solved while coil A is still off and overshoots
+    // its setpoint once coil A heats the air, so the final check fails unless the controller sweeps re-solve it.
+    std::string const idf_objects = delimited_string({
+        "  Timestep, 4;",
+
+        "  SimulationControl,",
+        "    Yes,                     !- Do Zone Sizing Calculation",
+        "    Yes,                     !- Do System Sizing Calculation",
+        "    No,                      !- Do Plant Sizing Calculation",
+        "    Yes,                     !- Run Simulation for Sizing Periods",
+        "    No;                      !- Run Simulation for Weather File Run Periods",
+
+        "  RunPeriod,",
+        "    RP1,                     !- Name",
+        "    1,                       !- Begin Month",
+        "    1,                       !- Begin Day of Month",
+        "    ,                        !- Begin Year",
+        "    12,                      !- End Month",
+        "    31,                      !- End Day of Month",
+        "    ,                        !- End Year",
+        "    Tuesday,                 !- Day of Week for Start Day",
+        "    Yes,                     !- Use Weather File Holidays and Special Days",
+        "    Yes,                     !- Use Weather File Daylight Saving Period",
+        "    No,                      !- Apply Weekend Holiday Rule",
+        "    Yes,                     !- Use Weather File Rain Indicators",
+        "    Yes;                     !- Use Weather File Snow Indicators",
+
+        "  Site:Location,",
+        "    CHICAGO_IL_USA TMY2-94846,  !- Name",
+        "    41.78,                   !- Latitude {deg}",
+        "    -87.75,                  !- Longitude {deg}",
+        "    -6.00,                   !- Time Zone {hr}",
+        "    190.00;                  !- Elevation {m}",
+
+        "  SizingPeriod:DesignDay,",
+        "    CHICAGO_IL_USA Annual Heating 99% Design Conditions DB,  !- Name",
+        "    1,                       !- Month",
+        "    21,                      !- Day of Month",
+        "    WinterDesignDay,         !- Day Type",
+        "    -17.3,                   !- Maximum Dry-Bulb Temperature {C}",
+        "    0.0,                     !- Daily Dry-Bulb Temperature Range {deltaC}",
+        "    ,                        !- Dry-Bulb Temperature Range Modifier Type",
+        "    ,                        !- Dry-Bulb Temperature Range Modifier Day Schedule Name",
+        "    Wetbulb,                 !- Humidity Condition Type",
+        "    -17.3,                   !- Wetbulb or DewPoint at Maximum Dry-Bulb {C}",
+        "    ,                        !- Humidity Condition Day Schedule Name",
+        "    ,                        !- Humidity Ratio at Maximum Dry-Bulb {kgWater/kgDryAir}",
+        "    ,                        !- Enthalpy at Maximum Dry-Bulb {J/kg}",
+        "    ,                        !- Daily Wet-Bulb Temperature Range {deltaC}",
+        "    99063.,                  !- Barometric Pressure {Pa}",
+        "    4.9,                     !- Wind Speed {m/s}",
+        "    270,                     !- Wind Direction {deg}",
+        "    No,                      !- Rain Indicator",
+        "    No,                      !- Snow Indicator",
+        "    No,                      !- Daylight Saving Time Indicator",
+        "    ASHRAEClearSky,          !- Solar Model Indicator",
+        "    ,                        !- Beam Solar Day Schedule Name",
+        "    ,                        !- Diffuse Solar Day Schedule Name",
+        "    ,                        !- ASHRAE Clear Sky Optical Depth for Beam Irradiance (taub) {dimensionless}",
+        "    ,                        !- ASHRAE Clear Sky Optical Depth for Diffuse Irradiance (taud) {dimensionless}",
+        "    0.0;                     !- Sky Clearness",
+
+        "  BranchList,",
+        "    Air Loop Branches,       !- Name",
+        "    Air Loop Main Branch;    !- Branch 1 Name",
+
+        "  Branch,",
+        "    Air Loop Main Branch,    !- Name",
+        "    ,                        !- Pressure Drop Curve Name",
+        "    AirLoopHVAC:OutdoorAirSystem,  !- Component 1 Object Type",
+        "    OA Sys 1,                !- Component 1 Name",
+        "    Outdoor Air Mixer Inlet Node,  !- Component 1 Inlet Node Name",
+        "    Mixed Air Node,          !- Component 1 Outlet Node Name",
+        "    Fan:ConstantVolume,      !- Component 2 Object Type",
+        "    Supply Fan 1,            !- Component 2 Name",
+        "    Mixed Air Node,          !- Component 2 Inlet Node Name",
+        "    Supply Fan Outlet Node,  !- Component 2 Outlet Node Name",
+        "    Coil:Heating:Water,      !- Component 3 Object Type",
+        "    Heating Coil A,          !- Component 3 Name",
+        "    Supply Fan Outlet Node,  !- Component 3 Inlet Node Name",
+        "    Heating Coil A Air Outlet Node,  !- Component 3 Outlet Node Name",
+        "    Coil:Heating:Water,      !- Component 4 Object Type",
+        "    Heating Coil B,          !- Component 4 Name",
+        "    Heating Coil A Air Outlet Node,  !- Component 4 Inlet Node Name",
+        "    Air Loop Outlet Node;    !- Component 4 Outlet Node Name",
+
+        "  AirLoopHVAC,",
+        "    DOAS,                    !- Name",
+        "    DOAS Controllers,        !- Controller List Name",
+        "    Outdoor Air 1 Avail List,!- Availability Manager List Name",
+        "    0.0625,                  !- Design Supply Air Flow Rate {m3/s}",
+        "    Air Loop Branches,       !- Branch List Name",
+        "    ,                        !- Connector List Name",
+        "    Outdoor Air Mixer Inlet Node,  !- Supply Side Inlet Node Name",
+        "    Return Air Mixer Outlet, !- Demand Side Outlet Node Name",
+        "    Zone Equipment Inlet Node,  !- Demand Side Inlet Node Names",
+        "    Air Loop Outlet Node;    !- Supply Side Outlet Node Names",
+
+        "  AirLoopHVAC:SupplyPath,",
+        "    OASysSupplyPath,         !- Name",
+        "    Zone Equipment Inlet Node,  !- Supply Air Path Inlet Node Name",
+        "    AirLoopHVAC:ZoneSplitter,!- Component 1 Object Type",
+        "    Zone Supply Air Splitter;!- Component 1 Name",
+
+        "  AirLoopHVAC:ReturnPath,",
+        "    OASysReturnPath,         !- Name",
+        "    Return Air Mixer Outlet, !- Return Air Path Outlet Node Name",
+        "    AirLoopHVAC:ZoneMixer,   !- Component 1 Object Type",
+        "    Zone Return Air Mixer;   !- Component 1 Name",
+
+        "  AirLoopHVAC:ZoneSplitter,",
+        "    Zone Supply Air Splitter,!- Name",
+        "    Zone Equipment Inlet Node,  !- Inlet Node Name",
+        "    Zone 1 OA Inlet Node 2AT;    !- Outlet 1 Node Name",
+
+        "  AirLoopHVAC:ZoneMixer,",
+        "    Zone Return Air Mixer,   !- Name",
+        "    Return Air Mixer Outlet, !- Outlet Node Name",
+        "    Zone 1 Return Node;      !- Inlet 1 Node Name",
+
+        "  AirLoopHVAC:ControllerList,",
+        "    OA Sys 1 Controllers,    !- Name",
+        "    Controller:OutdoorAir,   !- Controller 1 Object Type",
+        "    OA Controller 1,         !- Controller 1 Name",
+        "    Controller:WaterCoil,    !- Controller 2 Object Type",
+        "    Preheat Coil Controller; !- Controller 2 Name",
+
+        "  Controller:WaterCoil,",
+        "    Preheat Coil Controller, !- Name",
+        "    Temperature,             !- Control Variable",
+        "    Normal,                  !- Action",
+        "    Flow,                    !- Actuator Variable",
+        "    HW Coil Air OutletNode,  !- Sensor Node Name",
+        "    HWCoil Water InletNode,  !- Actuator Node Name",
+        "    Autosize,                !- Controller Convergence Tolerance {deltaC}",
+        "    Autosize,                !- Maximum Actuated Flow {m3/s}",
+        "    0;                       !- Minimum Actuated Flow {m3/s}",
+
+        "  AirLoopHVAC:OutdoorAirSystem:EquipmentList,",
+        "    OA Sys 1 Equipment,      !- Name",
+        "    Coil:Heating:Water,      !- Component 1 Object Type",
+        "    OA Preheat HW Coil,      !- Component 1 Name",
+        "    OutdoorAir:Mixer,        !- Component 1 Object Type",
+        "    OA Mixing Box;           !- Component 1 Name",
+
+        "  AirLoopHVAC:OutdoorAirSystem,",
+        "    OA Sys 1,                !- Name",
+        "    OA Sys 1 Controllers,    !- Controller List Name",
+        "    OA Sys 1 Equipment,      !- Outdoor Air Equipment List Name",
+        "    Outdoor Air 1 Avail List;!- Availability Manager List Name",
+
+        "  OutdoorAir:NodeList,",
+        "    OUTSIDE AIR INLET NODE;    !- Node or NodeList Name 1",
+
+        "  OutdoorAir:Mixer,",
+        "    OA Mixing Box,           !- Name",
+        "    Mixed Air Node,          !- Mixed Air Node Name",
+        "    HW Coil Air OutletNode,  !- Outdoor Air Stream Node Name",
+        "    Relief Air Outlet Node,  !- Relief Air Stream Node Name",
+        "    Outdoor Air Mixer Inlet Node;  !- Return Air Stream Node Name",
+
+        "  AvailabilityManagerAssignmentList,",
+        "    Outdoor Air 1 Avail List,!- Name",
+        "    AvailabilityManager:Scheduled,  !- Availability Manager 1 Object Type",
+        "    Outdoor Air 1 Avail;     !- Availability Manager 1 Name",
+
+        "  AvailabilityManager:Scheduled,",
+        "    Outdoor Air 1 Avail,     !- Name",
+        "    FanAndCoilAvailSched;    !- Schedule Name",
+
+        "  SetpointManager:MixedAir,",
+        "    Mixed Air Temp Manager 1,!- Name",
+        "    Temperature,             !- Control Variable",
+        "    Air Loop Outlet Node,    !- Reference Setpoint Node Name",
+        "    Mixed Air Node,          !- Fan Inlet Node Name",
+        "    Supply Fan Outlet Node,  !- Fan Outlet Node Name",
+        "    Mixed Air Node;          !- Setpoint Node or NodeList Name",
+
+        "  SetpointManager:Scheduled,",
+        "    HW Coil Air Temp Manager,!- Name",
+        "    Temperature,             !- Control Variable",
+        "    Schedule_Constant_11.6,  !- Schedule Name",
+        "    HW Coil Air OutletNode;  !- Setpoint Node or NodeList Name",
+
+        "  Schedule:Constant,Schedule_Constant_11.6, Temperature, 11.6;",
+
+        "  Controller:OutdoorAir,",
+        "    OA Controller 1,         !- Name",
+        "    Relief Air Outlet Node,  !- Relief Air Outlet Node Name",
+        "    Outdoor Air Mixer Inlet Node,  !- Return Air Node Name",
+        "    Mixed Air Node,          !- Mixed Air Node Name",
+        "    Outside Air Inlet Node,  !- Actuator Node Name",
+        "    0.0625,                  !- Minimum Outdoor Air Flow Rate {m3/s}",
+        "    0.0625,                  !- Maximum Outdoor Air Flow Rate {m3/s}",
+        "    DifferentialDrybulb,     !- Economizer Control Type",
+        "    ModulateFlow,            !- Economizer Control Action Type",
+        "    23.,                     !- Economizer Maximum Limit Dry-Bulb Temperature {C}",
+        "    ,                        !- Economizer Maximum Limit Enthalpy {J/kg}",
+        "    13.5,                    !- Economizer Maximum Limit Dewpoint Temperature {C}",
+        "    ,                        !- Electronic Enthalpy Limit Curve Name",
+        "    14.,                     !- Economizer Minimum Limit Dry-Bulb Temperature {C}",
+        "    NoLockout,               !- Lockout Type",
+        "    FixedMinimum,            !- Minimum Limit Type",
+        "    OAFractionSched,         !- Minimum Outdoor Air Schedule Name",
+        "    ,                        !- Minimum Fraction of Outdoor Air Schedule Name",
+        "    ,                        !- Maximum Fraction of Outdoor Air Schedule Name",
+        "    ;                        !- Mechanical Ventilation Controller Name",
+
+        "  Fan:ConstantVolume,",
+        "    Supply Fan 1,            !- Name",
+        "    FanAndCoilAvailSched,    !- Availability Schedule Name",
+        "    0.7,                     !- Fan Total Efficiency",
+        "    600.0,                   !- Pressure Rise {Pa}",
+        "    0.0625,                  !- Maximum Flow Rate {m3/s}",
+        "    0.9,                     !- Motor Efficiency",
+        "    1.0,                     !- Motor In Airstream Fraction",
+        "    Mixed Air Node,          !- Air Inlet Node Name",
+        "    Supply Fan Outlet Node;  !- Air Outlet Node Name",
+
+        "  AirTerminal:SingleDuct:ConstantVolume:NoReheat,",
+        "    Zone1DirectAir,          !- Name",
+        "    FanAndCoilAvailSched,    !- Availability Schedule Name",
+        "    Zone 1 OA Inlet Node 2AT,   !- Air Inlet Node Name",
+        "    Zone 1 OA Inlet Node,       !- Air Outlet Node Name",
+        "    0.0625;                   !- Maximum Air Flow Rate {m3/s}",
+
+        "  Schedule:Compact,",
+        "    OAFractionSched,         !- Name",
+        "    Fraction,                !- Schedule Type Limits Name",
+        "    Through: 12/31,          !- Field 1",
+        "    For: AllDays,            !- Field 2",
+        "    Until: 24:00,0.5;        !- Field 3",
+
+        "  SetpointManager:Scheduled,",
+        "    Heating Coil A Temp Manager,  !- Name",
+        "    Temperature,             !- Control Variable",
+        "    Schedule_Constant_30,     !- Schedule Name",
+        "    Heating Coil A Air Outlet Node;  !- Setpoint Node or NodeList Name",
+
+        "  Schedule:Constant,Schedule_Constant_30, Temperature, 30;",
+
+        "  Controller:WaterCoil,",
+        "    Heating Coil A Controller,  !- Name",
+        "    Temperature,             !- Control Variable",
+        "    Normal,                  !- Action",
+        "    Flow,                    !- Actuator Variable",
+        "    Heating Coil A Air Outlet Node,  !- Sensor Node Name",
+        "    Heating Coil A Water Inlet Node,  !- Actuator Node Name",
+        "    Autosize,                !- Controller Convergence Tolerance {deltaC}",
+        "    Autosize,                !- Maximum Actuated Flow {m3/s}",
+        "    0;                       !- Minimum Actuated Flow {m3/s}",
+
+        "  Coil:Heating:Water,",
+        "    Heating Coil A,          !- Name",
+        "    FanAndCoilAvailSched,    !- Availability Schedule Name",
+        "    200.0,                   !- U-Factor Times Area Value {W/K}",
+        "    0.0005,                  !- Maximum Water Flow Rate {m3/s}",
+        "    Heating Coil A Water Inlet Node,  !- Water Inlet Node Name",
+        "    Heating Coil A Water Outlet Node,  !- Water Outlet Node Name",
+        "    Supply Fan Outlet Node,  !- Air Inlet Node Name",
+        "    Heating Coil A Air Outlet Node;  !- Air Outlet Node Name",
+
+        "  SetpointManager:Scheduled,",
+        "    Heating Coil B Temp Manager,  !- Name",
+        "    Temperature,             !- Control Variable",
+        "    Schedule_Constant_40,     !- Schedule Name",
+        "    Air Loop Outlet Node;  !- Setpoint Node or NodeList Name",
+
+        "  Schedule:Constant,Schedule_Constant_40, Temperature, 40;",
+
+        "  Controller:WaterCoil,",
+        "    Heating Coil B Controller,  !- Name",
+        "    Temperature,             !- Control Variable",
+        "    Normal,                  !- Action",
+        "    Flow,                    !- Actuator Variable",
+        "    Air Loop Outlet Node,  !- Sensor Node Name",
+        "    Heating Coil B Water Inlet Node,  !- Actuator Node Name",
+        "    Autosize,                !- Controller Convergence Tolerance {deltaC}",
+        "    Autosize,                !- Maximum Actuated Flow {m3/s}",
+        "    0;                       !- Minimum Actuated Flow {m3/s}",
+
+        "  Coil:Heating:Water,",
+        "    Heating Coil B,          !- Name",
+        "    FanAndCoilAvailSched,    !- Availability Schedule Name",
+        "    200.0,                   !- U-Factor Times Area Value {W/K}",
+        "    0.0005,                  !- Maximum Water Flow Rate {m3/s}",
+        "    Heating Coil B Water Inlet Node,  !- Water Inlet Node Name",
+        "    Heating Coil B Water Outlet Node,  !- Water Outlet Node Name",
+        "    Heating Coil A Air Outlet Node,  !- Air Inlet Node Name",
+        "    Air Loop Outlet Node;  !- Air Outlet Node Name",
+
+        "  AirLoopHVAC:ControllerList,",
+        "    DOAS Controllers,        !- Name",
+        "    Controller:WaterCoil,    !- Controller 1 Object Type",
+        "    Heating Coil B Controller,  !- Controller 1 Name",
+        "    Controller:WaterCoil,    !- Controller 2 Object Type",
+        "    Heating Coil A Controller;  !- Controller 2 Name",
+
+        "  Sizing:System,",
+        "    DOAS,                    !- AirLoop Name",
+        "    Sensible,                !- Type of Load to Size On",
+        "    autosize,                !- Design Outdoor Air Flow Rate {m3/s}",
+        "    1.0,                     !- Central Heating Maximum System Air Flow Ratio",
+        "    40.0,                    !- Preheat Design Temperature {C}",
+        "    0.008,                   !- Preheat Design Humidity Ratio {kgWater/kgDryAir}",
+        "    15.56,                   !- Precool Design Temperature {C}",
+        "    0.008,                   !- Precool Design Humidity Ratio {kgWater/kgDryAir}",
+        "    12.78,                   !- Central Cooling Design Supply Air Temperature {C}",
+        "    12.78,                   !- Central Heating Design Supply Air Temperature {C}",
+        "    NonCoincident,           !- Type of Zone Sum to Use",
+        "    No,                      !- 100% Outdoor Air in Cooling",
+        "    No,                      !- 100% Outdoor Air in Heating",
+        "    0.0085,                  !- Central Cooling Design Supply Air Humidity Ratio {kgWater/kgDryAir}",
+        "    0.008,                   !- Central Heating Design Supply Air Humidity Ratio {kgWater/kgDryAir}",
+        "    Flow/System,             !- Cooling Supply Air Flow Rate Method",
+        "    8.287,                   !- Cooling Supply Air Flow Rate {m3/s}",
+        "    0.0099676501,            !- Cooling Supply Air Flow Rate Per Floor Area {m3/s-m2}",
+        "    1,                       !- Cooling Fraction of Autosized Cooling Supply Air Flow Rate",
+        "    3.9475456e-005,          !- Cooling Supply Air Flow Rate Per Unit Cooling Capacity {m3/s-W}",
+        "    Flow/System,             !- Heating Supply Air Flow Rate Method",
+        "    0.338942175,             !- Heating Supply Air Flow Rate {m3/s}",
+        "    0.0099676501,            !- Heating Supply Air Flow Rate Per Floor Area {m3/s-m2}",
+        "    1,                       !- Heating Fraction of Autosized Heating Supply Air Flow Rate",
+        "    1,                       !- Heating Fraction of Autosized Cooling Supply Air Flow Rate",
+        "    3.1588213e-005,          !- Heating Supply Air Flow Rate Per Unit Heating Capacity {m3/s-W}",
+        "    ZoneSum,                 !- System Outdoor Air Method",
+        "    1,                       !- Zone Maximum Outdoor Air Fraction {dimensionless}",
+        "    CoolingDesignCapacity,   !- Cooling Design Capacity Method",
+        "    Autosize,                !- Cooling Design Capacity {W}",
+        "    234.7,                   !- Cooling Design Capacity Per Floor Area {W/m2}",
+        "    1,                       !- Fraction of Autosized Cooling Design Capacity",
+        "    HeatingDesignCapacity,   !- Heating Design Capacity Method",
+        "    Autosize,                !- Heating Design Capacity {W}",
+        "    157,                     !- Heating Design Capacity Per Floor Area {W/m2}",
+        "    1,                       !- Fraction of Autosized Heating Design Capacity",
+        "    VAV;                     !- Central Cooling Capacity Control Method",
+        "	",
+
+        "  Site:GroundTemperature:Deep,16.5,16.5,16.5,16.5,16.5,16.5,16.5,16.5,16.5,16.5,16.5,16.5;",
+
+        "  Sizing:Parameters,",
+        "    1.3,                     !- Heating Sizing Factor",
+        "    1.3,                     !- Cooling Sizing Factor",
+        "    ;                        !- Timesteps in Averaging Window",
+
+        "  Sizing:Zone,",
+        "    SPACE1-1,                !- Zone or ZoneList Name",
+        "    SupplyAirTemperature,    !- Zone Cooling Design Supply Air Temperature Input Method",
+        "    13.,                     !- Zone Cooling Design Supply Air Temperature {C}",
+        "    ,                        !- Zone Cooling Design Supply Air Temperature Difference {deltaC}",
+        "    SupplyAirTemperature,    !- Zone Heating Design Supply Air Temperature Input Method",
+        "    30.,                     !- Zone Heating Design Supply Air Temperature {C}",
+        "    ,                        !- Zone Heating Design Supply Air Temperature Difference {deltaC}",
+        "    0.0075,                  !- Zone Cooling Design Supply Air Humidity Ratio {kgWater/kgDryAir}",
+        "    0.004,                   !- Zone Heating Design Supply Air Humidity Ratio {kgWater/kgDryAir}",
+        "    SZ DSOA SPACE1-1,        !- Design Specification Outdoor Air Object Name",
+        "    0.0,                     !- Zone Heating Sizing Factor",
+        "    0.0,                     !- Zone Cooling Sizing Factor",
+        "    DesignDay,               !- Cooling Design Air Flow Method",
+        "    0,                       !- Cooling Design Air Flow Rate {m3/s}",
+        "    ,                        !- Cooling Minimum Air Flow per Zone Floor Area {m3/s-m2}",
+        "    ,                        !- Cooling Minimum Air Flow {m3/s}",
+        "    ,                        !- Cooling Minimum Air Flow Fraction",
+        "    DesignDay,               !- Heating Design Air Flow Method",
+        "    0,                       !- Heating Design Air Flow Rate {m3/s}",
+        "    ,                        !- Heating Maximum Air Flow per Zone Floor Area {m3/s-m2}",
+        "    ,                        !- Heating Maximum Air Flow {m3/s}",
+        "    ;                        !- Heating Maximum Air Flow Fraction",
+
+        "  DesignSpecification:OutdoorAir,",
+        "    SZ DSOA SPACE1-1,        !- Name",
+        "    flow/person,             !- Outdoor Air Method",
+        "    0.0125,                  !- Outdoor Air Flow per Person {m3/s-person}",
+        "    0.0,                     !- Outdoor Air Flow per Zone Floor Area {m3/s-m2}",
+        "    0.0;                     !- Outdoor Air Flow per Zone {m3/s}",
+
+        "  People,",
+        "    SPACE1-1 PEOPLE,         !- Name",
+        "    SPACE1-1,                !- Zone or ZoneList Name",
+        "    OFFICE OCCUPANCY,        !- Number of People Schedule Name",
+        "    people,                  !- Number of People Calculation Method",
+        "    5.000000,                !- Number of People",
+        "    ,                        !- People per Zone Floor Area {person/m2}",
+        "    ,                        !- Zone Floor Area per Person {m2/person}",
+        "    0.3000000,               !- Fraction Radiant",
+        "    ,                        !- Sensible Heat Fraction",
+        "    Activity Sch,            !- Activity Level Schedule Name",
+        "    3.82E-8,                 !- Carbon Dioxide Generation Rate {m3/s-W}",
+        "    ,                        !- Enable ASHRAE 55 Comfort Warnings",
+        "    zoneaveraged,            !- Mean Radiant Temperature Calculation Type",
+        "    ,                        !- Surface Name/Angle Factor List Name",
+        "    Work Eff Sch,            !- Work Efficiency Schedule Name",
+        "    ClothingInsulationSchedule,  !- Clothing Insulation Calculation Method",
+        "    ,                        !- Clothing Insulation Calculation Method Schedule Name",
+        "    Clothing Sch,            !- Clothing Insulation Schedule Name",
+        "    Air Velo Sch,            !- Air Velocity Schedule Name",
+        "    FANGER;                  !- Thermal Comfort Model 1 Type",
+
+        "  Schedule:Compact,",
+        "    OFFICE OCCUPANCY,        !- Name",
+        "    Fraction,                !- Schedule Type Limits Name",
+        "    Through: 12/31,          !- Field 1",
+        "    For: AllDays,            !- Field 21",
+        "    Until: 24:00,1.0;        !- Field 22",
+
+        "  Schedule:Compact,",
+        "    Activity Sch,            !- Name",
+        "    Any Number,              !- Schedule Type Limits Name",
+        "    Through: 12/31,          !- Field 1",
+        "    For: AllDays,            !- Field 2",
+        "    Until: 24:00,131.8;      !- Field 3",
+
+        "  Schedule:Compact,",
+        "    Work Eff Sch,            !- Name",
+        "    Any Number,              !- Schedule Type Limits Name",
+        "    Through: 12/31,          !- Field 1",
+        "    For: AllDays,            !- Field 2",
+        "    Until: 24:00,0.0;        !- Field 3",
+
+        "  Schedule:Compact,",
+        "    Clothing Sch,            !- Name",
+        "    Any Number,              !- Schedule Type Limits Name",
+        "    Through: 12/31,          !- Field 1",
+        "    For: AllDays,            !- Field 2",
+        "    Until: 24:00,1.0;        !- Field 3",
+
+        "  Schedule:Compact,",
+        "    Air Velo Sch,            !- Name",
+        "    Any Number,              !- Schedule Type Limits Name",
+        "    Through: 12/31,          !- Field 1",
+        "    For: AllDays,            !- Field 2",
+        "    Until: 24:00,0.137;      !- Field 3",
+
+        "  Schedule:Compact,",
+        "    BLDG_EQUIP_SCH,          !- Name",
+        "    Fraction,                !- Schedule Type Limits Name",
+        "    Through: 12/31,          !- Field 1",
+        "    For: AllDays,            !- Field 2",
+        "    Until: 24:00,1.0;        !- Field 3",
+
+        "  ScheduleTypeLimits,",
+        "    Any Number;              !- Name",
+
+        "  Lights,",
+        "    SPACE1-1 Lights,         !- Name",
+        "    SPACE1-1,                !- Zone or ZoneList Name",
+        "    LIGHTS-1,                !- Schedule Name",
+        "    LightingLevel,           !- Design Level Calculation Method",
+        "    284,                     !- Lighting Level {W}",
+        "    ,                        !- Watts per Zone Floor Area {W/m2}",
+        "    ,                        !- Watts per Person {W/person}",
+        "    0.0,                     !- Return Air Fraction",
+        "    0.59,                    !- Fraction Radiant",
+        "    0.2,                     !- Fraction Visible",
+        "    0,                       !- Fraction Replaceable",
+        "    GeneralLights;           !- End-Use Subcategory",
+
+        "  ElectricEquipment,",
+        "    SPACE1-1_MiscPlug_Equip, !- Name",
+        "    SPACE1-1,                !- Zone or ZoneList Name",
+        "    BLDG_EQUIP_SCH,          !- Schedule Name",
+        "    EquipmentLevel,          !- Design Level Calculation Method",
+        "    207.7352,                !- Design Level {W}",
+        "    ,                        !- Watts per Zone Floor Area {W/m2}",
+        "    ,                        !- Watts per Person {W/person}",
+        "    0.0000,                  !- Fraction Latent",
+        "    0.5000,                  !- Fraction Radiant",
+        "    0.0000,                  !- Fraction Lost",
+        "    MiscPlug;                !- End-Use Subcategory",
+
+        "  Schedule:Compact,",
+        "    LIGHTS-1,                !- Name",
+        "    Fraction,                !- Schedule Type Limits Name",
+        "    Through: 12/31,          !- Field 1",
+        "    For: AllDays,            !- Field 2",
+        "    Until: 24:00,1.0;        !- Field 3",
+
+        "  ZoneControl:Thermostat,",
+        "    Zone 1 Thermostat,       !- Name",
+        "    SPACE1-1,                !- Zone or ZoneList Name",
+        "    Zone Control Type Sched, !- Control Type Schedule Name",
+        "    ThermostatSetpoint:DualSetpoint,  !- Control 1 Object Type",
+        "    Temperature Setpoints;   !- Control 1 Name",
+
+        "  ThermostatSetpoint:DualSetpoint,",
+        "    Temperature Setpoints,   !- Name",
+        "    Heating Setpoints,       !- Heating Setpoint Temperature Schedule Name",
+        "    Cooling Setpoints;       !- Cooling Setpoint Temperature Schedule Name",
+
+        "  Schedule:Compact,",
+        "    Zone Control Type Sched, !- Name",
+        "    Control Type,            !- Schedule Type Limits Name",
+        "    Through: 12/31,          !- Field 1",
+        "    For: AllDays,            !- Field 2",
+        "    Until: 24:00,4;          !- Field 3",
+
+        "  ScheduleTypeLimits,",
+        "    Control Type,            !- Name",
+        "    0,                       !- Lower Limit Value",
+        "    4,                       !- Upper Limit Value",
+        "    DISCRETE;                !- Numeric Type",
+
+        "  ScheduleTypeLimits,",
+        "    Temperature,             !- Name",
+        "    -60,                     !- Lower Limit Value",
+        "    200,                     !- Upper Limit Value",
+        "    CONTINUOUS,              !- Numeric Type",
+        "    Temperature;             !- Unit Type",
+
+        "  ScheduleTypeLimits,",
+        "    Fraction,                !- Name",
+        "    0.0,                     !- Lower Limit Value",
+        "    1.0,                     !- Upper Limit Value",
+        "    CONTINUOUS;              !- Numeric Type",
+
+        "  Schedule:Compact,",
+        "    On,                      !- Name",
+        "    Fraction,                !- Schedule Type Limits Name",
+        "    Through: 12/31,          !- Field 1",
+        "    For: AllDays,            !- Field 2",
+        "    Until: 24:00,1.0;        !- Field 3",
+
+        "  Schedule:Compact,",
+        "    Heating Setpoints,       !- Name",
+        "    Temperature,             !- Schedule Type Limits Name",
+        "    Through: 12/31,          !- Field 1",
+        "    For: AllDays,            !- Field 2",
+        "    Until: 24:00,21.0;       !- Field 3",
+
+        "  Schedule:Compact,",
+        "    Cooling Setpoints,       !- Name",
+        "    Temperature,             !- Schedule Type Limits Name",
+        "    Through: 12/31,          !- Field 1",
+        "    For: AllDays,            !- Field 2",
+        "    Until: 24:00,24.0;       !- Field 3",
+
+        "  Schedule:Compact,",
+        "    FanAndCoilAvailSched,    !- Name",
+        "    Fraction,                !- Schedule Type Limits Name",
+        "    Through: 12/31,          !- Field 1",
+        "    For: AllDays,            !- Field 2",
+        "    Until: 24:00,1.0;        !- Field 3",
+
+        "  ZoneHVAC:EquipmentConnections,",
+        "    SPACE1-1,                !- Zone Name",
+        "    Zone1Equipment,          !- Zone Conditioning Equipment List Name",
+        "    Zone1Inlets,             !- Zone Air Inlet Node or NodeList Name",
+        "    ,      !- Zone Air Exhaust Node or NodeList Name",
+        "    Zone 1 Node,             !- Zone Air Node Name",
+        "    Zone 1 Return Node;      !- Zone Return Air Node Name",
+
+        "  ZoneHVAC:EquipmentList,",
+        "    Zone1Equipment,          !- Name",
+        "    SequentialLoad,          !- Load Distribution Scheme",
+        "    ZoneHVAC:AirDistributionUnit,  !- Zone Equipment 1 Object Type",
+        "    Zone1DirectAirADU,       !- Zone Equipment 1 Name",
+        "    1,                       !- Zone Equipment 1 Cooling Sequence",
+        "    1;                       !- Zone Equipment 1 Heating or No-Load Sequence",
+
+        "  ZoneHVAC:AirDistributionUnit,",
+        "    Zone1DirectAirADU,       !- Name",
+        "    Zone 1 OA Inlet Node,    !- Air Distribution Unit Outlet Node Name",
+        "    AirTerminal:SingleDuct:ConstantVolume:NoReheat,  !- Air Terminal Object Type",
+        "    Zone1DirectAir;          !- Air Terminal Name",
+
+        "  NodeList,",
+        "    Zone1Inlets,             !- Name",
+        "    Zone 1 OA Inlet Node;    !- Node 1 Name",
+
+        "  Schedule:Compact,",
+        "    CyclingFanSch,           !- Name",
+        "    Fraction,                !- Schedule Type Limits Name",
+        "    Through: 12/31,          !- Field 1",
+        "    For: AllDays,            !- Field 2",
+        "    Until: 24:00,0.0;        !- Field 3",
+
+        "  Material:NoMass,",
+        "    R19LAYER,                !- Name",
+        "    Rough,                   !- Roughness",
+        "    3.344,                   !- Thermal Resistance {m2-K/W}",
+        "    0.9000000,               !- Thermal Absorptance",
+        "    0.7500000,               !- Solar Absorptance",
+        "    0.7500000;               !- Visible Absorptance",
+
+        "  Material,",
+        "    C5 - 4 IN HW CONCRETE,   !- Name",
+        "    MediumRough,             !- Roughness",
+        "    0.1014984,               !- Thickness {m}",
+        "    1.729577,                !- Conductivity {W/m-K}",
+        "    2242.585,                !- Density {kg/m3}",
+        "    836.8000,                !- Specific Heat {J/kg-K}",
+        "    0.9000000,               !- Thermal Absorptance",
+        "    0.6500000,               !- Solar Absorptance",
+        "    0.6500000;               !- Visible Absorptance",
+
+        "  Material,",
+        "    1IN Stucco,              !- Name",
+        "    Smooth,                  !- Roughness",
+        "    0.0253,                  !- Thickness {m}",
+        "    0.6918,                  !- Conductivity {W/m-K}",
+        "    1858.0000,               !- Density {kg/m3}",
+        "    837.0000,                !- Specific Heat {J/kg-K}",
+        "    0.9000,                  !- Thermal Absorptance",
+        "    0.9200,                  !- Solar Absorptance",
+        "    0.9200;                  !- Visible Absorptance",
+
+        "  Material,",
+        "    8IN Concrete HW,         !- Name",
+        "    MediumRough,             !- Roughness",
+        "    0.2033,                  !- Thickness {m}",
+        "    1.7296,                  !- Conductivity {W/m-K}",
+        "    2243.0000,               !- Density {kg/m3}",
+        "    837.0000,                !- Specific Heat {J/kg-K}",
+        "    0.9000,                  !- Thermal Absorptance",
+        "    0.6500,                  !- Solar Absorptance",
+        "    0.6500;                  !- Visible Absorptance",
+
+        "  Material,",
+        "    Wall Insulation [5],     !- Name",
+        "    MediumRough,             !- Roughness",
+        "    0.0453,                  !- Thickness {m}",
+        "    0.0432,                  !- Conductivity {W/m-K}",
+        "    91.0000,                 !- Density {kg/m3}",
+        "    837.0000,                !- Specific Heat {J/kg-K}",
+        "    0.9000,                  !- Thermal Absorptance",
+        "    0.5000,                  !- Solar Absorptance",
+        "    0.5000;                  !- Visible Absorptance",
+
+        "  Material,",
+        "    1/2IN Gypsum,            !- Name",
+        "    Smooth,                  !- Roughness",
+        "    0.0127,                  !- Thickness {m}",
+        "    0.1600,                  !- Conductivity {W/m-K}",
+        "    784.9000,                !- Density {kg/m3}",
+        "    830.0000,                !- Specific Heat {J/kg-K}",
+        "    0.9000,                  !- Thermal Absorptance",
+        "    0.9200,                  !- Solar Absorptance",
+        "    0.9200;                  !- Visible Absorptance",
+
+        "  Construction,",
+        "    ext-walls,               !- Name",
+        "    1IN Stucco,              !- Outside Layer",
+        "    8IN Concrete HW,         !- Layer 2",
+        "    Wall Insulation [5],     !- Layer 3",
+        "    1/2IN Gypsum;            !- Layer 4",
+
+        "  Construction,",
+        "    FLOOR,                   !- Name",
+        "    C5 - 4 IN HW CONCRETE;   !- Outside Layer",
+
+        "  Construction,",
+        "    ROOF19,                  !- Name",
+        "    R19LAYER;                !- Outside Layer",
+
+        "  Site:GroundTemperature:BuildingSurface,18.89,18.92,19.02,19.12,19.21,19.23,19.07,19.32,19.09,19.21,19.13,18.96;",
+
+        "  Zone,",
+        "    SPACE1-1,                !- Name",
+        "    0.0000000E+00,           !- Direction of Relative North {deg}",
+        "    0.0000000E+00,           !- X Origin {m}",
+        "    0.0000000E+00,           !- Y Origin {m}",
+        "    0.0000000E+00,           !- Z Origin {m}",
+        "    1,                       !- Type",
+        "    1,                       !- Multiplier",
+        "    autocalculate,           !- Ceiling Height {m}",
+        "    autocalculate;           !- Volume {m3}",
+
+        "  GlobalGeometryRules,",
+        "    UpperLeftCorner,         !- Starting Vertex Position",
+        "    CounterClockWise,        !- Vertex Entry Direction",
+        "    World;                   !- Coordinate System",
+
+        "  BuildingSurface:Detailed,",
+        "    Zn001:Wall001,           !- Name",
+        "    Wall,                    !- Surface Type",
+        "    ext-walls,               !- Construction Name",
+        "    SPACE1-1,                !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0.5000000,               !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    0.0000000E+00,0.0000000E+00,4.572000,  !- X,Y,Z ==> Vertex 1 {m}",
+        "    0.0000000E+00,0.0000000E+00,0.0000000E+00,  !- X,Y,Z ==> Vertex 2 {m}",
+        "    15.24000,0.0000000E+00,0.0000000E+00,  !- X,Y,Z ==> Vertex 3 {m}",
+        "    15.24000,0.0000000E+00,4.572000;  !- X,Y,Z ==> Vertex 4 {m}",
+
+        "  BuildingSurface:Detailed,",
+        "    Zn001:Wall002,           !- Name",
+        "    Wall,                    !- Surface Type",
+        "    ext-walls,               !- Construction Name",
+        "    SPACE1-1,                !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0.5000000,               !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    15.24000,0.0000000E+00,4.572000,  !- X,Y,Z ==> Vertex 1 {m}",
+        "    15.24000,0.0000000E+00,0.0000000E+00,  !- X,Y,Z ==> Vertex 2 {m}",
+        "    15.24000,15.24000,0.0000000E+00,  !- X,Y,Z ==> Vertex 3 {m}",
+        "    15.24000,15.24000,4.572000;  !- X,Y,Z ==> Vertex 4 {m}",
+
+        "  BuildingSurface:Detailed,",
+        "    Zn001:Wall003,           !- Name",
+        "    Wall,                    !- Surface Type",
+        "    ext-walls,               !- Construction Name",
+        "    SPACE1-1,                !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0.5000000,               !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    15.24000,15.24000,4.572000,  !- X,Y,Z ==> Vertex 1 {m}",
+        "    15.24000,15.24000,0.0000000E+00,  !- X,Y,Z ==> Vertex 2 {m}",
+        "    0.0000000E+00,15.24000,0.0000000E+00,  !- X,Y,Z ==> Vertex 3 {m}",
+        "    0.0000000E+00,15.24000,4.572000;  !- X,Y,Z ==> Vertex 4 {m}",
+
+        "  BuildingSurface:Detailed,",
+        "    Zn001:Wall004,           !- Name",
+        "    Wall,                    !- Surface Type",
+        "    ext-walls,               !- Construction Name",
+        "    SPACE1-1,                !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0.5000000,               !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    0.0000000E+00,15.24000,4.572000,  !- X,Y,Z ==> Vertex 1 {m}",
+        "    0.0000000E+00,15.24000,0.0000000E+00,  !- X,Y,Z ==> Vertex 2 {m}",
+        "    0.0000000E+00,0.0000000E+00,0.0000000E+00,  !- X,Y,Z ==> Vertex 3 {m}",
+        "    0.0000000E+00,0.0000000E+00,4.572000;  !- X,Y,Z ==> Vertex 4 {m}",
+
+        "  BuildingSurface:Detailed,",
+        "    Zn001:Flr001,            !- Name",
+        "    Floor,                   !- Surface Type",
+        "    FLOOR,                   !- Construction Name",
+        "    SPACE1-1,                !- Zone Name",
+        "    Ground,                  !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    NoSun,                   !- Sun Exposure",
+        "    NoWind,                  !- Wind Exposure",
+        "    1.000000,                !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    15.24000,0.000000,0.0,  !- X,Y,Z ==> Vertex 1 {m}",
+        "    0.000000,0.000000,0.0,  !- X,Y,Z ==> Vertex 2 {m}",
+        "    0.000000,15.24000,0.0,  !- X,Y,Z ==> Vertex 3 {m}",
+        "    15.24000,15.24000,0.0;  !- X,Y,Z ==> Vertex 4 {m}",
+
+        "  BuildingSurface:Detailed,",
+        "    Zn001:Roof001,           !- Name",
+        "    Roof,                    !- Surface Type",
+        "    ROOF19,                  !- Construction Name",
+        "    SPACE1-1,                !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0.0000000E+00,           !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    0.000000,15.24000,4.572,  !- X,Y,Z ==> Vertex 1 {m}",
+        "    0.000000,0.000000,4.572,  !- X,Y,Z ==> Vertex 2 {m}",
+        "    15.24000,0.000000,4.572,  !- X,Y,Z ==> Vertex 3 {m}",
+        "    15.24000,15.24000,4.572;  !- X,Y,Z ==> Vertex 4 {m}",
+
+        "  Sizing:Plant,",
+        "    Hot Water Loop,          !- Plant or Condenser Loop Name",
+        "    heating,                 !- Loop Type",
+        "    82.,                     !- Design Loop Exit Temperature {C}",
+        "    11;                      !- Loop Design Temperature Difference {deltaC}",
+
+        "  PlantLoop,",
+        "    Hot Water Loop,          !- Name",
+        "    Water,                   !- Fluid Type",
+        "    ,                        !- User Defined Fluid Type",
+        "    Hot Loop Operation,      !- Plant Equipment Operation Scheme Name",
+        "    HW Supply Outlet Node,   !- Loop Temperature Setpoint Node Name",
+        "    100,                     !- Maximum Loop Temperature {C}",
+        "    10,                      !- Minimum Loop Temperature {C}",
+        "    Autosize,                !- Maximum Loop Flow Rate {m3/s}",
+        "    0.0,                     !- Minimum Loop Flow Rate {m3/s}",
+        "    autocalculate,           !- Plant Loop Volume {m3}",
+        "    HW Supply Inlet Node,    !- Plant Side Inlet Node Name",
+        "    HW Supply Outlet Node,   !- Plant Side Outlet Node Name",
+        "    Heating Supply Side Branches,  !- Plant Side Branch List Name",
+        "    Heating Supply Side Connectors,  !- Plant Side Connector List Name",
+        "    HW Demand Inlet Node,    !- Demand Side Inlet Node Name",
+        "    HW Demand Outlet Node,   !- Demand Side Outlet Node Name",
+        "    Heating Demand Side Branches,  !- Demand Side Branch List Name",
+        "    Heating Demand Side Connectors,  !- Demand Side Connector List Name",
+        "    Optimal,                 !- Load Distribution Scheme",
+        "    ,                        !- Availability Manager List Name",
+        "    ,                        !- Plant Loop Demand Calculation Scheme",
+        "    ,                        !- Common Pipe Simulation",
+        "    ,                        !- Pressure Simulation Type",
+        "    ;                        !- Loop Circulation Time",
+
+        "  SetpointManager:Scheduled,",
+        "    Hot Water Loop Setpoint Manager,  !- Name",
+        "    Temperature,             !- Control Variable",
+        "    HW Loop Temp Schedule,   !- Schedule Name",
+        "    Hot Water Loop Setpoint Node List;  !- Setpoint Node or NodeList Name",
+
+        "  Schedule:Compact,",
+        "    HW LOOP TEMP SCHEDULE,   !- Name",
+        "    TEMPERATURE,             !- Schedule Type Limits Name",
+        "    Through: 12/31,          !- Field 1",
+        "    For: Alldays,            !- Field 2",
+        "    Until: 24:00,82.0;       !- Field 3",
+
+        "  NodeList,",
+        "    Hot Water Loop Setpoint Node List,  !- Name",
+        "    HW Supply Outlet Node;   !- Node 1 Name",
+
+        "  BranchList,",
+        "    Heating Supply Side Branches,  !- Name",
+        "    Heating Supply Inlet Branch,  !- Branch 1 Name",
+        "    Heating Purchased Hot Water Branch,  !- Branch 2 Name",
+        "    Heating Supply Bypass Branch,  !- Branch 3 Name",
+        "    Heating Supply Outlet Branch;  !- Branch 4 Name",
+
+        "  ConnectorList,",
+        "    Heating Supply Side Connectors,  !- Name",
+        "    Connector:Splitter,      !- Connector 1 Object Type",
+        "    Heating Supply Splitter, !- Connector 1 Name",
+        "    Connector:Mixer,         !- Connector 2 Object Type",
+        "    Heating Supply Mixer;    !- Connector 2 Name",
+
+        "  Connector:Splitter,",
+        "    Heating Supply Splitter, !- Name",
+        "    Heating Supply Inlet Branch,  !- Inlet Branch Name",
+        "    Heating Purchased Hot Water Branch,  !- Outlet Branch 1 Name",
+        "    Heating Supply Bypass Branch;  !- Outlet Branch 2 Name",
+
+        "  Connector:Mixer,",
+        "    Heating Supply Mixer,    !- Name",
+        "    Heating Supply Outlet Branch,  !- Outlet Branch Name",
+        "    Heating Purchased Hot Water Branch,  !- Inlet Branch 1 Name",
+        "    Heating Supply Bypass Branch;  !- Inlet Branch 2 Name",
+
+        "  Branch,",
+        "    Heating Supply Inlet Branch,  !- Name",
+        "    ,                        !- Pressure Drop Curve Name",
+        "    Pump:VariableSpeed,      !- Component 1 Object Type",
+        "    HW Circ Pump,            !- Component 1 Name",
+        "    HW Supply Inlet Node,    !- Component 1 Inlet Node Name",
+        "    HW Pump Outlet Node;     !- Component 1 Outlet Node Name",
+
+        "  Branch,",
+        "    Heating Purchased Hot Water Branch,  !- Name",
+        "    ,                        !- Pressure Drop Curve Name",
+        "    DistrictHeating,         !- Component 1 Object Type",
+        "    Purchased Heating,       !- Component 1 Name",
+        "    Purchased Heat Inlet Node,  !- Component 1 Inlet Node Name",
+        "    Purchased Heat Outlet Node;  !- Component 1 Outlet Node Name",
+
+        "  Branch,",
+        "    Heating Supply Bypass Branch,  !- Name",
+        "    ,                        !- Pressure Drop Curve Name",
+        "    Pipe:Adiabatic,          !- Component 1 Object Type",
+        "    Heating Supply Side Bypass,  !- Component 1 Name",
+        "    Heating Supply Bypass Inlet Node,  !- Component 1 Inlet Node Name",
+        "    Heating Supply Bypass Outlet Node;  !- Component 1 Outlet Node Name",
+
+        "  Pipe:Adiabatic,",
+        "    Heating Supply Side Bypass,  !- Name",
+        "    Heating Supply Bypass Inlet Node,  !- Inlet Node Name",
+        "    Heating Supply Bypass Outlet Node;  !- Outlet Node Name",
+
+        "  Branch,",
+        "    Heating Supply Outlet Branch,  !- Name",
+        "    ,                        !- Pressure Drop Curve Name",
+        "    Pipe:Adiabatic,          !- Component 1 Object Type",
+        "    Heating Supply Outlet,   !- Component 1 Name",
+        "    Heating Supply Exit Pipe Inlet Node,  !- Component 1 Inlet Node Name",
+        "    HW Supply Outlet Node;   !- Component 1 Outlet Node Name",
+
+        "  Pipe:Adiabatic,",
+        "    Heating Supply Outlet,   !- Name",
+        "    Heating Supply Exit Pipe Inlet Node,  !- Inlet Node Name",
+        "    HW Supply Outlet Node;   !- Outlet Node Name",
+
+        "  Pump:VariableSpeed,",
+        "    HW Circ Pump,            !- Name",
+        "    HW Supply Inlet Node,    !- Inlet Node Name",
+        "    HW Pump Outlet Node,     !- Outlet Node Name",
+        "    autosize,                !- Design Maximum Flow Rate {m3/s}",
+        "    179352,                  !- Design Pump Head {Pa}",
+        "    autosize,                !- Design Power Consumption {W}",
+        "    0.9,                     !- Motor Efficiency",
+        "    0.0,                     !- Fraction of Motor Inefficiencies to Fluid Stream",
+        "    0,                       !- Coefficient 1 of the Part Load Performance Curve",
+        "    1,                       !- Coefficient 2 of the Part Load Performance Curve",
+        "    0,                       !- Coefficient 3 of the Part Load Performance Curve",
+        "    0,                       !- Coefficient 4 of the Part Load Performance Curve",
+        "    0,                       !- Design Minimum Flow Rate {m3/s}",
+        "    INTERMITTENT;            !- Pump Control Type",
+
+        "  BranchList,",
+        "    Heating Demand Side Branches,  !- Name",
+        "    ZonesHWInletBranch,      !- Branch 1 Name",
+        "    Zone1HWBranch,           !- Branch 2 Name",
+        "    Heating Coil A HW Branch,  !- Branch 3 Name",
+        "    Heating Coil B HW Branch,  !- Branch 4 Name",
+        "    ZonesHWBypassBranch,     !- Branch 5 Name",
+        "    ZonesHWOutletBranch;     !- Branch 6 Name",
+
+        "  ConnectorList,",
+        "    Heating Demand Side Connectors,  !- Name",
+        "    Connector:Splitter,      !- Connector 1 Object Type",
+        "    Zones HW Splitter,       !- Connector 1 Name",
+        "    Connector:Mixer,         !- Connector 2 Object Type",
+        "    Zones HW Mixer;          !- Connector 2 Name",
+
+        "  Connector:Splitter,",
+        "    Zones HW Splitter,       !- Name",
+        "    ZonesHWInletBranch,      !- Inlet Branch Name",
+        "    Zone1HWBranch,           !- Outlet Branch 1 Name",
+        "    Heating Coil A HW Branch,  !- Outlet Branch 2 Name",
+        "    Heating Coil B HW Branch,  !- Outlet Branch 3 Name",
+        "    ZonesHWBypassBranch;     !- Outlet Branch 4 Name",
+
+        "  Connector:Mixer,",
+        "    Zones HW Mixer,          !- Name",
+        "    ZonesHWOutletBranch,     !- Outlet Branch Name",
+        "    Zone1HWBranch,           !- Inlet Branch 1 Name",
+        "    Heating Coil A HW Branch,  !- Inlet Branch 2 Name",
+        "    Heating Coil B HW Branch,  !- Inlet Branch 3 Name",
+        "    ZonesHWBypassBranch;     !- Inlet Branch 4 Name",
+
+        "  Branch,",
+        "    ZonesHWInletBranch,      !- Name",
+        "    ,                        !- Pressure Drop Curve Name",
+        "    Pipe:Adiabatic,          !- Component 1 Object Type",
+        "    ZonesHWInletPipe,        !- Component 1 Name",
+        "    HW Demand Inlet Node,    !- Component 1 Inlet Node Name",
+        "    HW Demand Entrance Pipe Outlet Node;  !- Component 1 Outlet Node Name",
+
+        "  Pipe:Adiabatic,",
+        "    ZonesHWInletPipe,        !- Name",
+        "    HW Demand Inlet Node,    !- Inlet Node Name",
+        "    HW Demand Entrance Pipe Outlet Node;  !- Outlet Node Name",
+
+        "  Branch,",
+        "    ZonesHWOutletBranch,     !- Name",
+        "    ,                        !- Pressure Drop Curve Name",
+        "    Pipe:Adiabatic,          !- Component 1 Object Type",
+        "    ZonesHWOutletPipe,       !- Component 1 Name",
+        "    HW Demand Exit Pipe Inlet Node,  !- Component 1 Inlet Node Name",
+        "    HW Demand Outlet Node;   !- Component 1 Outlet Node Name",
+
+        "  Pipe:Adiabatic,",
+        "    ZonesHWOutletPipe,       !- Name",
+        "    HW Demand Exit Pipe Inlet Node,  !- Inlet Node Name",
+        "    HW Demand Outlet Node;   !- Outlet Node Name",
+
+        "  Branch,",
+        "    Zone1HWBranch,           !- Name",
+        "    ,                        !- Pressure Drop Curve Name",
+        "    Coil:Heating:Water,      !- Component 1 Object Type",
+        "    OA Preheat HW Coil,      !- Component 1 Name",
+        "    HWCoil Water InletNode,  !- Component 1 Inlet Node Name",
+        "    HWCoil Water OutletNode; !- Zone1UnitHeatHWOutletNode;  !- Component 1 Outlet Node Name",
+        "  Branch,",
+        "    Heating Coil A HW Branch,  !- Name",
+        "    ,                        !- Pressure Drop Curve Name",
+        "    Coil:Heating:Water,      !- Component 1 Object Type",
+        "    Heating Coil A,          !- Component 1 Name",
+        "    Heating Coil A Water Inlet Node,  !- Component 1 Inlet Node Name",
+        "    Heating Coil A Water Outlet Node;  !- Component 1 Outlet Node Name",
+
+        "  Branch,",
+        "    Heating Coil B HW Branch,  !- Name",
+        "    ,                        !- Pressure Drop Curve Name",
+        "    Coil:Heating:Water,      !- Component 1 Object Type",
+        "    Heating Coil B,          !- Component 1 Name",
+        "    Heating Coil B Water Inlet Node,  !- Component 1 Inlet Node Name",
+        "    Heating Coil B Water Outlet Node;  !- Component 1 Outlet Node Name",
+
+        "  Branch,",
+        "    ZonesHWBypassBranch,     !- Name",
+        "    ,                        !- Pressure Drop Curve Name",
+        "    Pipe:Adiabatic,          !- Component 1 Object Type",
+        "    ZonesHWBypassPipe,       !- Component 1 Name",
+        "    ZonesHWBypassInletNode,  !- Component 1 Inlet Node Name",
+        "    ZonesHWBypassOutletNode; !- Component 1 Outlet Node Name",
+
+        "  Pipe:Adiabatic,",
+        "    ZonesHWBypassPipe,       !- Name",
+        "    ZonesHWBypassInletNode,  !- Inlet Node Name",
+        "    ZonesHWBypassOutletNode; !- Outlet Node Name",
+
+        "  PlantEquipmentOperationSchemes,",
+        "    Hot Loop Operation,      !- Name",
+        "    PlantEquipmentOperation:HeatingLoad,  !- Control Scheme 1 Object Type",
+        "    Purchased Heating Only,  !- Control Scheme 1 Name",
+        "    ON;                      !- Control Scheme 1 Schedule Name",
+
+        "  PlantEquipmentOperation:HeatingLoad,",
+        "    Purchased Heating Only,  !- Name",
+        "    0,                       !- Load Range 1 Lower Limit {W}",
+        "    1000000,                 !- Load Range 1 Upper Limit {W}",
+        "    heating plant;           !- Range 1 Equipment List Name",
+
+        "  PlantEquipmentList,",
+        "    heating plant,           !- Name",
+        "    DistrictHeating,         !- Equipment 1 Object Type",
+        "    Purchased Heating;       !- Equipment 1 Name",
+
+        "  DistrictHeating,",
+        "    Purchased Heating,       !- Name",
+        "    Purchased Heat Inlet Node,  !- Hot Water Inlet Node Name",
+        "    Purchased Heat Outlet Node,  !- Hot Water Outlet Node Name",
+        "    1000000;                 !- Nominal Capacity {W}",
+
+        "  Coil:Heating:Water,",
+        "    OA Preheat HW Coil,      !- Name",
+        "    FanAndCoilAvailSched,    !- Availability Schedule Name",
+        "    autosize,                !- U-Factor Times Area Value {W/K}",
+        "    autosize,                !- Maximum Water Flow Rate {m3/s}",
+        "    HWCoil Water InletNode,  !- Zone1UnitHeatHWInletNode,!- Water Inlet Node Name",
+        "    HWCoil Water OutletNode, !- Water Outlet Node Name",
+        "    Outside Air Inlet Node,  !- Air Inlet Node Name",
+        "    HW Coil Air OutletNode,  !- Air Outlet Node Name",
+        "    UFactorTimesAreaAndDesignWaterFlowRate,  !- Performance Input Method",
+        "    autosize,                !- Rated Capacity {W}",
+        "    82.2,                    !- Rated Inlet Water Temperature {C}",
+        "    16.6,                    !- Rated Inlet Air Temperature {C}",
+        "    71.1,                    !- Rated Outlet Water Temperature {C}",
+        "    32.2,                    !- Rated Outlet Air Temperature {C}",
+        "    ;                        !- Rated Ratio for Air and Water Convection",
+    });
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    OutputProcessor::TimeValue.allocate(2);
+    SimulationManager::ManageSimulation();
+
+    int const AirLoopNum(1);
+    ASSERT_EQ(2, PrimaryAirSystem(AirLoopNum).NumControllers);
+    EXPECT_EQ("HEATING COIL B CONTROLLER", PrimaryAirSystem(AirLoopNum).ControllerName(1));
+    EXPECT_EQ("HEATING COIL A CONTROLLER", PrimaryAirSystem(AirLoopNum).ControllerName(2));
+
+    int const CoilA = UtilityRoutines::FindItemInList("HEATING COIL A", WaterCoils::WaterCoil);
+    int const CoilB = UtilityRoutines::FindItemInList("HEATING COIL B", WaterCoils::WaterCoil);
+    ASSERT_GT(CoilA, 0);
+    ASSERT_GT(CoilB, 0);
+    int const CoilAOutletNode = WaterCoils::WaterCoil(CoilA).AirOutletNodeNum;
+    int const CoilBOutletNode = WaterCoils::WaterCoil(CoilB).AirOutletNodeNum;
+
+    // re-solve the controllers with the plant flows unlocked, as at the start of an HVAC iteration
+    PlantUtilities::SetAllFlowLocks(DataPlant::FlowUnlocked);
+    bool AirLoopConvergedFlag(false);
+    int IterMax(0);
+    int IterTot(0);
+    int NumCalls(0);
+
+    // single pass: coil B keeps the water flow it found with coil A off
+    DataSystemVariables::AirLoopControllerSweeps = false;
+    SolveAirLoopControllers(false, AirLoopNum, AirLoopConvergedFlag, IterMax, IterTot, NumCalls);
+    EXPECT_FALSE(AirLoopConvergedFlag);
+    EXPECT_NEAR(30.0, DataLoopNode::Node(CoilAOutletNode).Temp, 0.1);
+    EXPECT_GT(DataLoopNode::Node(CoilBOutletNode).Temp, 41.0);
+    int const SinglePassCalls = NumCalls;
+
+    // with the sweeps coil B is re-solved against the solution of coil A
+    DataSystemVariables::AirLoopControllerSweeps = true;
+    SolveAirLoopControllers(false, AirLoopNum, AirLoopConvergedFlag, IterMax, IterTot, NumCalls);
+    EXPECT_TRUE(AirLoopConvergedFlag);
+    EXPECT_TRUE(PrimaryAirSystem(AirLoopNum).ControlConverged(1));
+    EXPECT_TRUE(PrimaryAirSystem(AirLoopNum).ControlConverged(2));
+    EXPECT_NEAR(30.0, DataLoopNode::Node(CoilAOutletNode).Temp, 0.1);
+    EXPECT_NEAR(40.0, DataLoopNode::Node(CoilBOutletNode).Temp, 0.1);
+    EXPECT_GT(NumCalls, SinglePassCalls);
+}
+
 } // namespace EnergyPlus
@@ -45,11 +45,23 @@
 // OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+// C++ Headers
+#include <cstdio>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 
+// ObjexxFCL Headers
+#include <ObjexxFCL/gio.hh>
+
 // EnergyPlus Headers
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
+#include <FileSystem.hh>
 #include <SimulationManager.hh>
+#include <UtilityRoutines.hh>
 
 #include "Fixtures/EnergyPlusFixture.hh"
 
@@ -72,3 +84,65 @@ TEST_F(EnergyPlusFixture, CheckThreading)
 
     EXPECT_TRUE(compare_err_stream(error_string, true));
 }
+
+TEST_F(EnergyPlusFixture, SimulationManager_LongRunModeCommitsMonthly)
+{
+    DataGlobals::KindOfSim = DataGlobals::ksRunPeriodWeather;
+    DataGlobals::WarmupFlag = false;
+    DataGlobals::EndEnvrnFlag = false;
+    DataEnvironment::Month = 3;
+    DataEnvironment::MonthTomorrow = 3;
+
+    // Without LongRunMode every day is committed
+    DataSystemVariables::LongRunMode = false;
+    EXPECT_TRUE(SimulationManager::EndOfDayCommitsTransaction());
+
+    // With LongRunMode the days of a month share a transaction
+    DataSystemVariables::LongRunMode = true;
+    EXPECT_FALSE(SimulationManager::EndOfDayCommitsTransaction());
+    DataEnvironment::MonthTomorrow = 4;
+    EXPECT_TRUE(SimulationManager::EndOfDayCommitsTransaction()); // last day of the month
+    DataEnvironment::MonthTomorrow = 3;
+
+    DataGlobals::EndEnvrnFlag = true;
+    EXPECT_TRUE(SimulationManager::EndOfDayCommitsTransaction());
+    DataGlobals::EndEnvrnFlag = false;
+
+    DataGlobals::WarmupFlag = true;
+    EXPECT_TRUE(SimulationManager::EndOfDayCommitsTransaction());
+    DataGlobals::WarmupFlag = false;
+
+    // Design days and sizing periods keep one transaction per day
+    DataGlobals::KindOfSim = DataGlobals::ksDesignDay;
+    EXPECT_TRUE(SimulationManager::EndOfDayCommitsTransaction());
+    DataGlobals::KindOfSim = DataGlobals::ksRunPeriodDesign;
+    EXPECT_TRUE(SimulationManager::EndOfDayCommitsTransaction());
+}
+
+TEST_F(EnergyPlusFixture, SimulationManager_InitializationOutputFileName)
+{
+    DataStringGlobals::outputEioFileName = "eplus_suppress_test.eio";
+    std::remove(DataStringGlobals::outputEioFileName.c_str());
+
+    DataSystemVariables::SuppressEioOutput = false;
+    EXPECT_EQ("eplus_suppress_test.eio", SimulationManager::InitializationOutputFileName());
+
+    // the eio unit goes to the null device and still accepts the usual writes
+    DataSystemVariables::SuppressEioOutput = true;
+#ifdef _WIN32
+    EXPECT_EQ("NUL", SimulationManager::InitializationOutputFileName());
+#else
+    EXPECT_EQ("/dev/null", SimulationManager::InitializationOutputFileName());
+#endif
+    int const unitNumber = GetNewUnitNumber();
+    {
+        IOFlags flags;
+        flags.ACTION("write");
+        flags.STATUS("UNKNOWN");
+        ObjexxFCL::gio::open(unitNumber, SimulationManager::InitializationOutputFileName(), flags);
+        EXPECT_EQ(0, flags.ios());
+    }
+    ObjexxFCL::gio::write(unitNumber, "(A)") << "Program Version,EnergyPlus";
+    ObjexxFCL::gio::close(unitNumber);
+    EXPECT_FALSE(FileSystem::fileExists(DataStringGlobals::outputEioFileName));
+}
@@ -0,0 +1,176 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::SimulationTelemetry Unit Tests
+
+// C++ Headers
+#include <sstream>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataShadowingCombinations.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/SimulationTelemetry.hh>
+
+// Third Party Headers
+#include <nlohmann/json.hpp>
+
+using namespace EnergyPlus;
+
+namespace {
+
+std::vector<EnergyPlusTelemetry> reports;
+
+void storeReport(EnergyPlusTelemetry const &telemetry)
+{
+    reports.push_back(telemetry);
+}
+
+} // namespace
+
+TEST_F(EnergyPlusFixture, SimulationTelemetry_ReportsAtInterval)
+{
+    reports.clear();
+    SimulationTelemetry::fTelemetryPtr = storeReport;
+    SimulationTelemetry::ReportingIntervalHours = 1.0;
+    SimulationTelemetry::BeginSimulation();
+
+    DataEnvironment::EnvironmentName = "RUN PERIOD 1";
+    DataGlobals::TimeStepZone = 0.25;
+    DataGlobals::HourOfDay = 3;
+    for (int TimeStep = 1; TimeStep <= 6; ++TimeStep) {
+        SimulationTelemetry::ReportZoneTimeStep();
+    }
+    ASSERT_EQ(1u, reports.size());
+    EXPECT_EQ("RUN PERIOD 1", reports[0].environmentName);
+    EXPECT_EQ(3, reports[0].hourOfDay);
+    EXPECT_DOUBLE_EQ(1.0, reports[0].simulatedHours);
+
+    // the remaining half hour is reported at the end of the simulation
+    SimulationTelemetry::ReportEndOfSimulation();
+    ASSERT_EQ(2u, reports.size());
+    EXPECT_DOUBLE_EQ(1.5, reports[1].simulatedHours);
+    SimulationTelemetry::ReportEndOfSimulation();
+    EXPECT_EQ(2u, reports.size());
+
+    SimulationTelemetry::fTelemetryPtr = nullptr;
+    SimulationTelemetry::BeginSimulation();
+    SimulationTelemetry::ReportZoneTimeStep();
+    EXPECT_FALSE(SimulationTelemetry::Enabled);
+    EXPECT_EQ(2u, reports.size());
+    SimulationTelemetry::ReportingIntervalHours = 24.0;
+}
+
+TEST_F(EnergyPlusFixture, SimulationTelemetry_TimersOnlyRunWhenEnabled)
+{
+    SimulationTelemetry::fTelemetryPtr = nullptr;
+    SimulationTelemetry::BeginSimulation();
+    {
+        SimulationTelemetry::ScopedTimer timer(SimulationTelemetry::Subsystem::HVAC);
+    }
+    EXPECT_EQ(0.0, SimulationTelemetry::SubsystemTime[int(SimulationTelemetry::Subsystem::HVAC)]);
+
+    SimulationTelemetry::fTelemetryPtr = storeReport;
+    SimulationTelemetry::BeginSimulation();
+    {
+        SimulationTelemetry::ScopedTimer timer(SimulationTelemetry::Subsystem::HVAC);
+        volatile Real64 sum = 0.0;
+        for (int i = 0; i < 100000; ++i) {
+            sum = sum + i;
+        }
+    }
+    EXPECT_GT(SimulationTelemetry::SubsystemTime[int(SimulationTelemetry::Subsystem::HVAC)], 0.0);
+    EXPECT_EQ(0.0, SimulationTelemetry::SubsystemTime[int(SimulationTelemetry::Subsystem::Shading)]);
+    SimulationTelemetry::fTelemetryPtr = nullptr;
+}
+
+TEST_F(EnergyPlusFixture, SimulationTelemetry_PerformanceReport)
+{
+    SimulationTelemetry::fTelemetryPtr = nullptr;
+    DataSystemVariables::PerformanceReport = true;
+    SimulationTelemetry::BeginSimulation();
+    EXPECT_TRUE(SimulationTelemetry::Enabled);
+
+    DataGlobals::TimeStepZone = 0.25;
+    for (int TimeStep = 1; TimeStep <= 8; ++TimeStep) {
+        SimulationTelemetry::ReportZoneTimeStep();
+    }
+    SimulationTelemetry::SubsystemTime[int(SimulationTelemetry::Subsystem::HVAC)] = 1.5;
+    SimulationTelemetry::ReportEndOfSimulation();
+
+    std::ostringstream Summary;
+    SimulationTelemetry::WritePerformanceReport(Summary, 12.0);
+    auto const root = nlohmann::json::parse(Summary.str());
+    EXPECT_DOUBLE_EQ(12.0, root["wall_seconds"].get<Real64>());
+    EXPECT_DOUBLE_EQ(2.0, root["simulated_hours"].get<Real64>());
+    EXPECT_DOUBLE_EQ(1.5, root["subsystem_seconds"]["hvac"].get<Real64>());
+    EXPECT_DOUBLE_EQ(0.0, root["subsystem_seconds"]["shading"].get<Real64>());
+    EXPECT_GE(root["peak_rss_kb"].get<Real64>(), 0.0);
+    EXPECT_GE(root["simulated_hours_per_second"].get<Real64>(), 0.0);
+    EXPECT_EQ(5u, root["module_memory_kb"].size());
+}
+
+TEST_F(EnergyPlusFixture, SimulationTelemetry_ModuleMemory)
+{
+    DataShadowingCombinations::ShadowComb.deallocate();
+    DataHeatBalance::SunlitFrac.allocate(4, 24, 16);
+    DataHeatBalance::CosIncAng.allocate(4, 24, 16);
+
+    auto const modules = SimulationTelemetry::ModuleMemory();
+    ASSERT_EQ(5u, modules.size());
+    EXPECT_EQ("shading", modules[0].first);
+    EXPECT_DOUBLE_EQ(2.0 * 4 * 24 * 16 * sizeof(Real64) / 1024.0, modules[0].second);
+    EXPECT_EQ("daylighting", modules[1].first);
+    EXPECT_DOUBLE_EQ(0.0, modules[1].second);
+}
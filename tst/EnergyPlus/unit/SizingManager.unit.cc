@@ -244,3 +244,50 @@ TEST(SizingManagerTest, TimeIndexToHrMinString_test)
     EXPECT_EQ("16:39:00", TimeIndexToHrMinString(333));
     EXPECT_EQ("24:00:00", TimeIndexToHrMinString(480));
 }
+
+TEST_F(EnergyPlusFixture, SizingManager_SizingInputFingerprint)
+{
+    std::string const designDay = delimited_string({
+        "SizingPeriod:DesignDay,",
+        "  CHICAGO_IL_USA Annual Cooling 1% Design Conditions DB/MCWB,  !- Name",
+        "  7,                       !- Month",
+        "  21,                      !- Day of Month",
+        "  SummerDesignDay,         !- Day Type",
+        "  31.5,                    !- Maximum Dry-Bulb Temperature {C}",
+        "  10.7,                    !- Daily Dry-Bulb Temperature Range {deltaC}",
+        "  ,                        !- Dry-Bulb Temperature Range Modifier Type",
+        "  ,                        !- Dry-Bulb Temperature Range Modifier Day Schedule Name",
+        "  Wetbulb,                 !- Humidity Condition Type",
+        "  23.0,                    !- Wetbulb or DewPoint at Maximum Dry-Bulb {C}",
+        "  ,                        !- Humidity Condition Day Schedule Name",
+        "  ,                        !- Humidity Ratio at Maximum Dry-Bulb {kgWater/kgDryAir}",
+        "  ,                        !- Enthalpy at Maximum Dry-Bulb {J/kg}",
+        "  ,                        !- Daily Wet-Bulb Temperature Range {deltaC}",
+        "  99063.,                  !- Barometric Pressure {Pa}",
+        "  5.3,                     !- Wind Speed {m/s}",
+        "  230,                     !- Wind Direction {deg}",
+        "  No,                      !- Rain Indicator",
+        "  No,                      !- Snow Indicator",
+        "  No,                      !- Daylight Saving Time Indicator",
+        "  ASHRAEClearSky,          !- Solar Model Indicator",
+        "  ,                        !- Beam Solar Day Schedule Name",
+        "  ,                        !- Diffuse Solar Day Schedule Name",
+        "  ,                        !- ASHRAE Clear Sky Optical Depth for Beam Irradiance (taub) {dimensionless}",
+        "  ,                        !- ASHRAE Clear Sky Optical Depth for Diffuse Irradiance (taud) {dimensionless}",
+        "  1.0;                     !- Sky Clearness",
+    });
+
+    ASSERT_TRUE(process_idf(designDay));
+    std::string const fingerprint = SizingInputFingerprint();
+    EXPECT_EQ(16u, fingerprint.size());
+
+    // output requests do not change the sizing
+    ASSERT_TRUE(process_idf(designDay + delimited_string({"Output:Variable,*,Site Outdoor Air Drybulb Temperature,hourly;"})));
+    EXPECT_EQ(fingerprint, SizingInputFingerprint());
+
+    // design conditions do
+    std::string hotterDesignDay(designDay);
+    hotterDesignDay.replace(hotterDesignDay.find("31.5,"), 5, "33.5,");
+    ASSERT_TRUE(process_idf(hotterDesignDay));
+    EXPECT_NE(fingerprint, SizingInputFingerprint());
+}
@@ -0,0 +1,153 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::SolarCollectors Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Fmath.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataPlant.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/SolarCollectors.hh>
+
+#include "Fixtures/EnergyPlusFixture.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::SolarCollectors;
+
+TEST_F(EnergyPlusFixture, SolarCollectors_FlatPlateSolarTermsReused)
+{
+    DataPlant::PlantLoop.allocate(1);
+    DataPlant::PlantLoop(1).FluidName = "WATER";
+    DataPlant::PlantLoop(1).FluidIndex = 1;
+
+    DataSurfaces::Surface.allocate(1);
+    DataSurfaces::Surface(1).Area = 2.0;
+    DataSurfaces::Surface(1).Tilt = 30.0;
+    DataSurfaces::Surface(1).OutDryBulbTemp = 20.0;
+
+    NumOfParameters = 1;
+    Parameters.allocate(NumOfParameters);
+    Parameters(1).Area = 2.0;
+    Parameters(1).TestMassFlowRate = 0.03;
+    Parameters(1).TestType = INLET;
+    Parameters(1).eff0 = 0.7;
+    Parameters(1).eff1 = -3.5;
+    Parameters(1).eff2 = -0.01;
+    Parameters(1).iam1 = -0.1;
+    Parameters(1).iam2 = -0.05;
+
+    NumOfCollectors = 1;
+    Collector.allocate(NumOfCollectors);
+    Collector(1).Parameters = 1;
+    Collector(1).Surface = 1;
+    Collector(1).WLoopNum = 1;
+    Collector(1).InletTemp = 30.0;
+    Collector(1).MassFlowRate = 0.03;
+
+    DataHeatBalance::CosIncidenceAngle.dimension(1, 0.0);
+    DataHeatBalance::QRadSWOutIncident.dimension(1, 0.0);
+    DataHeatBalance::QRadSWOutIncidentBeam.dimension(1, 0.0);
+    DataHeatBalance::QRadSWOutIncidentSkyDiffuse.dimension(1, 0.0);
+    DataHeatBalance::QRadSWOutIncidentGndDiffuse.dimension(1, 0.0);
+    auto const SetSolar = [](Real64 const CosInc, Real64 const Beam, Real64 const Sky, Real64 const Gnd) {
+        DataHeatBalance::CosIncidenceAngle(1) = CosInc;
+        DataHeatBalance::QRadSWOutIncidentBeam(1) = Beam;
+        DataHeatBalance::QRadSWOutIncidentSkyDiffuse(1) = Sky;
+        DataHeatBalance::QRadSWOutIncidentGndDiffuse(1) = Gnd;
+        DataHeatBalance::QRadSWOutIncident(1) = Beam + Sky + Gnd;
+    };
+
+    // the incident angle modifier as it was calculated on every call before the solar terms were reused
+    auto const OriginalIncidentAngleModifier = []() -> Real64 {
+        if (DataHeatBalance::QRadSWOutIncident(1) <= 0.0) return 0.0;
+        Real64 const ThetaBeam = std::acos(DataHeatBalance::CosIncidenceAngle(1));
+        Real64 const Tilt = DataSurfaces::Surface(1).Tilt;
+        Real64 const ThetaSky = (59.68 - 0.1388 * Tilt + 0.001497 * pow_2(Tilt)) * DataGlobals::DegToRadians;
+        Real64 const ThetaGnd = (90.0 - 0.5788 * Tilt + 0.002693 * pow_2(Tilt)) * DataGlobals::DegToRadians;
+        return (DataHeatBalance::QRadSWOutIncidentBeam(1) * IAM(1, ThetaBeam) + DataHeatBalance::QRadSWOutIncidentSkyDiffuse(1) * IAM(1, ThetaSky) +
+                DataHeatBalance::QRadSWOutIncidentGndDiffuse(1) * IAM(1, ThetaGnd)) /
+               DataHeatBalance::QRadSWOutIncident(1);
+    };
+
+    SetSolar(0.9, 500.0, 100.0, 20.0);
+    CalcSolarCollector(1);
+    Real64 const FirstIAM = Collector(1).IncidentAngleModifier;
+    Real64 const FirstPower = Collector(1).Power;
+    EXPECT_EQ(OriginalIncidentAngleModifier(), FirstIAM);
+    EXPECT_GT(FirstPower, 0.0);
+
+    // further plant calls in the same time step reuse the terms and give the same results
+    EXPECT_FALSE(SolarInputsChanged(1));
+    CalcSolarCollector(1);
+    EXPECT_EQ(FirstIAM, Collector(1).IncidentAngleModifier);
+    EXPECT_EQ(FirstPower, Collector(1).Power);
+
+    // a change of any solar input is picked up
+    SetSolar(0.7, 300.0, 120.0, 20.0);
+    CalcSolarCollector(1);
+    EXPECT_EQ(OriginalIncidentAngleModifier(), Collector(1).IncidentAngleModifier);
+    EXPECT_NE(FirstIAM, Collector(1).IncidentAngleModifier);
+    SetSolar(0.7, 300.0, 120.0, 25.0);
+    EXPECT_TRUE(SolarInputsChanged(1));
+    EXPECT_FALSE(SolarInputsChanged(1));
+
+    SetSolar(0.0, 0.0, 0.0, 0.0);
+    CalcSolarCollector(1);
+    EXPECT_EQ(0.0, Collector(1).IncidentAngleModifier);
+
+    SetSolar(0.9, 500.0, 100.0, 20.0);
+    CalcSolarCollector(1);
+    EXPECT_EQ(FirstIAM, Collector(1).IncidentAngleModifier);
+    EXPECT_EQ(FirstPower, Collector(1).Power);
+}
@@ -47,9 +47,16 @@
 
 // EnergyPlus::SolarShading Unit Tests
 
+// C++ Headers
+#include <cstdio>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 
+// ObjexxFCL Headers
+#include <ObjexxFCL/gio.hh>
+#include <ObjexxFCL/member.functions.hh>
+
 // EnergyPlus Headers
 #include <EnergyPlus/DataBSDFWindow.hh>
 #include <EnergyPlus/DataEnvironment.hh>
@@ -59,6 +66,7 @@
 #include <EnergyPlus/DataSurfaces.hh>
 #include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/DataVectorTypes.hh>
+#include <EnergyPlus/FileSystem.hh>
 #include <EnergyPlus/HeatBalanceManager.hh>
 #include <EnergyPlus/ScheduleManager.hh>
 #include <EnergyPlus/SimulationManager.hh>
@@ -650,6 +658,34 @@ TEST_F(EnergyPlusFixture, SolarShadingTest_FigureSolarBeamAtTimestep)
 
     SolarShading::AllocateModuleArrays();
     SolarShading::DetermineShadowingCombinations();
+
+    // The caster search skips surfaces that sit entirely below the receiving surface; it must still find exactly the casters a scan of
+    // every surface would find, in surface order
+    for (int GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR) {
+        if (!DataShadowingCombinations::ShadowComb(GRSNR).UseThisSurf) continue;
+        Real64 const ZMIN = minval(Surface(GRSNR).Vertex, &DataVectorTypes::Vector::z);
+        std::vector<int> fullScanCasters;
+        for (int GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR) {
+            if (GSSNR == GRSNR) continue;
+            if (Surface(GSSNR).HeatTransSurf && (Surface(GSSNR).BaseSurf == GRSNR)) continue;
+            if (Surface(GRSNR).ShadowingSurf && (((GSSNR == GRSNR + 1) && Surface(GSSNR).MirroredSurf) ||
+                                                 ((GSSNR == GRSNR - 1) && Surface(GRSNR).MirroredSurf)))
+                continue;
+            if (Surface(GSSNR).BaseSurf == GRSNR) {
+                fullScanCasters.push_back(GSSNR);
+            } else if ((Surface(GSSNR).BaseSurf == 0) ||
+                       ((Surface(GSSNR).BaseSurf == GSSNR) &&
+                        ((Surface(GSSNR).ExtBoundCond == ExternalEnvironment) || (Surface(GSSNR).ExtBoundCond == OtherSideCondModeledExt)))) {
+                bool CannotShade = true;
+                CHKGSS(GRSNR, GSSNR, ZMIN, CannotShade);
+                if (!CannotShade) fullScanCasters.push_back(GSSNR);
+            }
+        }
+        ASSERT_EQ(int(fullScanCasters.size()), DataShadowingCombinations::ShadowComb(GRSNR).NumGenSurf) << Surface(GRSNR).Name;
+        for (int i = 1; i <= DataShadowingCombinations::ShadowComb(GRSNR).NumGenSurf; ++i) {
+            EXPECT_EQ(fullScanCasters[i - 1], DataShadowingCombinations::ShadowComb(GRSNR).GenSurf(i)) << Surface(GRSNR).Name;
+        }
+    }
     DataEnvironment::DayOfYear_Schedule = 168;
     DataEnvironment::DayOfWeek = 6;
     DataGlobals::TimeStep = 4;
@@ -670,6 +706,65 @@ TEST_F(EnergyPlusFixture, SolarShadingTest_FigureSolarBeamAtTimestep)
 
     EXPECT_NEAR(0.6504, DifShdgRatioIsoSkyHRTS(4, 9, 6), 0.0001);
     EXPECT_NEAR(0.9152, DifShdgRatioHorizHRTS(4, 9, 6), 0.0001);
+
+    // Shadowing the hours of a day on several threads must reproduce the serial sunlit fractions
+    DataSystemVariables::DetailedSkyDiffuseAlgorithm = false;
+    DataSystemVariables::DetailedSolarTimestepIntegration = false;
+    DataSystemVariables::NumberIntRadThreads = 1;
+    CalcPerSolarBeam(0.0, 0.4, 0.9);
+    Array3D<Real64> const SerialSunlitFrac(SunlitFrac);
+    Array2D<Real64> const SerialSunlitFracHR(SunlitFracHR);
+    Array3D<Real64> const SerialCosIncAng(CosIncAng);
+
+    DataSystemVariables::NumberIntRadThreads = 2;
+    CalcPerSolarBeam(0.0, 0.4, 0.9);
+    DataSystemVariables::NumberIntRadThreads = 1;
+    for (int Hour = 1; Hour <= 24; ++Hour) {
+        for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+            EXPECT_DOUBLE_EQ(SerialSunlitFracHR(Hour, SurfNum), SunlitFracHR(Hour, SurfNum));
+            for (int TS = 1; TS <= NumOfTimeStepInHour; ++TS) {
+                EXPECT_DOUBLE_EQ(SerialSunlitFrac(TS, Hour, SurfNum), SunlitFrac(TS, Hour, SurfNum));
+                EXPECT_DOUBLE_EQ(SerialCosIncAng(TS, Hour, SurfNum), CosIncAng(TS, Hour, SurfNum));
+            }
+        }
+    }
+
+    // Grid counting the shadows must stay close to the polygon overlap areas
+    DataSystemVariables::PixelCountingShading = true;
+    CalcPerSolarBeam(0.0, 0.4, 0.9);
+    DataSystemVariables::PixelCountingShading = false;
+    for (int Hour = 1; Hour <= 24; ++Hour) {
+        for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+            EXPECT_NEAR(SerialSunlitFracHR(Hour, SurfNum), SunlitFracHR(Hour, SurfNum), 0.02);
+            for (int TS = 1; TS <= NumOfTimeStepInHour; ++TS) {
+                EXPECT_NEAR(SerialSunlitFrac(TS, Hour, SurfNum), SunlitFrac(TS, Hour, SurfNum), 0.02);
+            }
+        }
+    }
+
+    // A second run with the same geometry loads the period from the shading cache
+    DataSystemVariables::ShadingCacheDirectory = ".";
+    std::string const CacheFileName(ShadingCacheFileName(0.0, 0.4, 0.9));
+    ASSERT_FALSE(CacheFileName.empty());
+    std::remove(CacheFileName.c_str());
+    CalcPerSolarBeam(0.0, 0.4, 0.9);
+    EXPECT_TRUE(ObjexxFCL::gio::file_exists(CacheFileName));
+    EXPECT_NE(CacheFileName, ShadingCacheFileName(0.0, 0.5, 0.8));
+    SunlitFrac = -1.0;
+    SunlitFracHR = -1.0;
+    CosIncAng = -1.0;
+    CalcPerSolarBeam(0.0, 0.4, 0.9);
+    DataSystemVariables::ShadingCacheDirectory.clear();
+    std::remove(CacheFileName.c_str());
+    for (int Hour = 1; Hour <= 24; ++Hour) {
+        for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+            EXPECT_DOUBLE_EQ(SerialSunlitFracHR(Hour, SurfNum), SunlitFracHR(Hour, SurfNum));
+            for (int TS = 1; TS <= NumOfTimeStepInHour; ++TS) {
+                EXPECT_DOUBLE_EQ(SerialSunlitFrac(TS, Hour, SurfNum), SunlitFrac(TS, Hour, SurfNum));
+                EXPECT_DOUBLE_EQ(SerialCosIncAng(TS, Hour, SurfNum), CosIncAng(TS, Hour, SurfNum));
+            }
+        }
+    }
 }
 
 TEST_F(EnergyPlusFixture, SolarShadingTest_ExternalShadingIO)
@@ -1461,3 +1556,187 @@ TEST_F(EnergyPlusFixture, SolarShadingTest_DisableGroupSelfShading)
         }
     }
 }
+
+TEST_F(EnergyPlusFixture, SolarShadingTest_FigureExtentsOverlap)
+{
+    // Three unit squares in HC coordinates: figure 2 shares an edge with figure 1 and figure 3 is apart from both
+    HCNV.dimension(3, 4);
+    HCX.dimension(3, 5, 0);
+    HCY.dimension(3, 5, 0);
+    Array1D<Int64> const SquareX({0, 0, 100, 100});
+    Array1D<Int64> const SquareY({100, 0, 0, 100});
+    Array1D<Int64> const OffsetX({0, 100, 300});
+    for (int NS = 1; NS <= 3; ++NS) {
+        for (int N = 1; N <= 4; ++N) {
+            HCX(NS, N) = SquareX(N) + OffsetX(NS);
+            HCY(NS, N) = SquareY(N);
+        }
+    }
+
+    EXPECT_TRUE(FigureExtentsOverlap(1, 2));
+    EXPECT_TRUE(FigureExtentsOverlap(2, 1));
+    EXPECT_FALSE(FigureExtentsOverlap(1, 3));
+    EXPECT_FALSE(FigureExtentsOverlap(3, 2));
+
+    HCX(3, 1) = 150; // figure 3 now reaches back over figure 2
+    EXPECT_TRUE(FigureExtentsOverlap(3, 2));
+    EXPECT_FALSE(FigureExtentsOverlap(3, 1));
+}
+
+TEST_F(EnergyPlusFixture, SolarShading_ShadingCacheElementSize)
+{
+    // the sun position arrays are single precision only in an ENABLE_COMPACT_SHADING build
+#ifdef EP_COMPACT_SHADING
+    EXPECT_EQ(sizeof(float), sizeof(ShadingReal));
+    using OtherShadingReal = Real64;
+#else
+    EXPECT_EQ(sizeof(Real64), sizeof(ShadingReal));
+    using OtherShadingReal = float;
+#endif
+
+    TotSurfaces = 1;
+    NumOfTimeStepInHour = 2;
+    SurfaceWindow.allocate(TotSurfaces);
+    Real64 const Third(1.0 / 3.0);
+    SunlitFrac.dimension(NumOfTimeStepInHour, 24, TotSurfaces, Third);
+    SunlitFracWithoutReveal.dimension(NumOfTimeStepInHour, 24, TotSurfaces, Third);
+    CosIncAng.dimension(NumOfTimeStepInHour, 24, TotSurfaces, Third);
+    SunlitFracHR.dimension(24, TotSurfaces, Third);
+    CosIncAngHR.dimension(24, TotSurfaces, Third);
+    WindowRevealStatus.dimension(NumOfTimeStepInHour, 24, TotSurfaces, 0);
+
+    // the calculations stay in Real64, only the stored value is rounded to the element type
+    EXPECT_EQ(static_cast<ShadingReal>(Third), SunlitFrac(1, 12, 1));
+    EXPECT_NEAR(Third, SunlitFrac(1, 12, 1), 1.0e-7);
+    EXPECT_NEAR(Third, CosIncAngHR(12, 1), 1.0e-7);
+
+    // a cache file of this build reads back exactly
+    std::string const CacheFileName("eplus_shading_cache_test.shd");
+    WriteShadingCache(CacheFileName);
+    SunlitFrac = 0.0;
+    CosIncAngHR = 0.0;
+    EXPECT_TRUE(ReadShadingCache(CacheFileName));
+    EXPECT_EQ(static_cast<ShadingReal>(Third), SunlitFrac(2, 24, 1));
+    EXPECT_EQ(static_cast<ShadingReal>(Third), CosIncAngHR(24, 1));
+
+    // a cache file written by the other build type has the same header but not the same length
+    Array3D<OtherShadingReal> OtherSunlitFrac;
+    Array3D<OtherShadingReal> OtherSunlitFracWithoutReveal;
+    Array3D<OtherShadingReal> OtherCosIncAng;
+    Array2D<OtherShadingReal> OtherSunlitFracHR;
+    Array2D<OtherShadingReal> OtherCosIncAngHR;
+    OtherSunlitFrac.dimension(NumOfTimeStepInHour, 24, TotSurfaces, 0.5);
+    OtherSunlitFracWithoutReveal.dimension(NumOfTimeStepInHour, 24, TotSurfaces, 0.5);
+    OtherCosIncAng.dimension(NumOfTimeStepInHour, 24, TotSurfaces, 0.5);
+    OtherSunlitFracHR.dimension(24, TotSurfaces, 0.5);
+    OtherCosIncAngHR.dimension(24, TotSurfaces, 0.5);
+    FileSystem::CacheBlocks OtherBlocks;
+    FileSystem::addCacheArray(OtherBlocks, OtherSunlitFrac);
+    FileSystem::addCacheArray(OtherBlocks, OtherSunlitFracHR);
+    FileSystem::addCacheArray(OtherBlocks, OtherSunlitFracWithoutReveal);
+    FileSystem::addCacheArray(OtherBlocks, OtherCosIncAng);
+    FileSystem::addCacheArray(OtherBlocks, OtherCosIncAngHR);
+    FileSystem::addCacheArray(OtherBlocks, WindowRevealStatus);
+    FileSystem::addCacheArray(OtherBlocks, SurfaceWindow(1).OutProjSLFracMult);
+    FileSystem::addCacheArray(OtherBlocks, SurfaceWindow(1).InOutProjSLFracMult);
+    ASSERT_TRUE(FileSystem::writeCacheFile(CacheFileName, {ShadingCacheVersion, TotSurfaces, NumOfTimeStepInHour}, OtherBlocks));
+    EXPECT_FALSE(ReadShadingCache(CacheFileName));
+    EXPECT_EQ(static_cast<ShadingReal>(Third), SunlitFrac(2, 24, 1));
+    EXPECT_TRUE(has_err_output(true));
+    std::remove(CacheFileName.c_str());
+}
+
+TEST_F(EnergyPlusFixture, SolarShading_AnisoSkyViewFactorsPackedSurfaces)
+{
+    // the loop over packed exterior-solar geometry must give the multipliers of the loop over all surfaces
+    TotSurfaces = 4;
+    Surface.allocate(TotSurfaces);
+    Surface(1).ExtSolar = true; // roof
+    Surface(1).OutNormVec = {0.0, 0.0, 1.0};
+    Surface(1).Tilt = 0.0;
+    Surface(1).SinTilt = 0.0;
+    Surface(1).ViewFactorSky = 1.0;
+    Surface(2).ExtSolar = false; // interior surface, skipped
+    Surface(2).OutNormVec = {1.0, 0.0, 0.0};
+    Surface(2).Tilt = 90.0;
+    Surface(2).SinTilt = 1.0;
+    Surface(2).ViewFactorSky = 0.5;
+    Surface(3).ExtSolar = true; // south wall
+    Surface(3).OutNormVec = {0.0, -1.0, 0.0};
+    Surface(3).Tilt = 90.0;
+    Surface(3).SinTilt = 1.0;
+    Surface(3).ViewFactorSky = 0.5;
+    Surface(4).ExtSolar = true; // east facing slope
+    Surface(4).OutNormVec = {0.5, 0.0, std::sqrt(0.75)};
+    Surface(4).Tilt = 30.0;
+    Surface(4).SinTilt = 0.5;
+    Surface(4).ViewFactorSky = 0.5 * (1.0 + std::sqrt(0.75));
+
+    NumOfTimeStepInHour = 1;
+    TimeStep = 1;
+    HourOfDay = 12;
+    SunlitFrac.dimension(NumOfTimeStepInHour, 24, TotSurfaces, 0.75);
+    DifShdgRatioIsoSky.dimension(TotSurfaces, 0.9);
+    DifShdgRatioHoriz.dimension(TotSurfaces, 0.8);
+    curDifShdgRatioIsoSky.dimension(TotSurfaces, 1.0);
+    AnisoSkyMult.dimension(TotSurfaces, 0.0);
+    MultIsoSky.dimension(TotSurfaces, 0.0);
+    MultCircumSolar.dimension(TotSurfaces, 0.0);
+    MultHorizonZenith.dimension(TotSurfaces, 0.0);
+    DataEnvironment::CurEnvirNum = 1;
+    DataEnvironment::Elevation = 0.0;
+    DataEnvironment::BeamSolarRad = 0.0; // overcast, so the first sky clearness bin
+    DataEnvironment::DifSolarRad = 200.0;
+
+    // the surface loop as it was before the geometry was packed, for the first sky clearness bin
+    auto const OriginalAnisoSkyMult = [](int const SurfNum) {
+        Real64 const CosZenithAng = DataEnvironment::SOLCOS(3);
+        Real64 const ZenithAng = std::acos(CosZenithAng);
+        Real64 const ZenithAngDeg = ZenithAng / DegToRadians;
+        Real64 const AirMassH = (1.0 - 0.1 * DataEnvironment::Elevation / 1000.0);
+        Real64 AirMass;
+        if (ZenithAngDeg <= 75.0) {
+            AirMass = AirMassH / CosZenithAng;
+        } else {
+            AirMass = AirMassH / (CosZenithAng + 0.15 * std::pow(93.9 - ZenithAngDeg, -1.253));
+        }
+        Real64 const Delta = DataEnvironment::DifSolarRad * AirMass / 1353.0;
+        Real64 const F1 = max(0.0, -0.0083117 + 0.5877285 * Delta + -0.0620636 * ZenithAng);
+        Real64 const F2 = -0.0596012 + 0.0721249 * Delta + -0.0220216 * ZenithAng;
+        Real64 CosIncAngBeamOnSurface = DataEnvironment::SOLCOS(1) * Surface(SurfNum).OutNormVec(1) +
+                                        DataEnvironment::SOLCOS(2) * Surface(SurfNum).OutNormVec(2) +
+                                        DataEnvironment::SOLCOS(3) * Surface(SurfNum).OutNormVec(3);
+        CosIncAngBeamOnSurface = min(1.0, max(-1.0, CosIncAngBeamOnSurface));
+        Real64 const IsoSky = Surface(SurfNum).ViewFactorSky * (1.0 - F1);
+        Real64 CircumSolarFac = max(0.0, CosIncAngBeamOnSurface) / max(0.0871557, CosZenithAng);
+        if (CircumSolarFac > 0.0 && CosZenithAng < 0.0871557 && Surface(SurfNum).Tilt < 2.0) CircumSolarFac = 1.0;
+        Real64 const CircumSolar = F1 * CircumSolarFac;
+        Real64 const HorizonZenith = F2 * Surface(SurfNum).SinTilt;
+        return max(0.0,
+                   IsoSky * DifShdgRatioIsoSky(SurfNum) + CircumSolar * SunlitFrac(TimeStep, HourOfDay, SurfNum) +
+                       HorizonZenith * DifShdgRatioHoriz(SurfNum));
+    };
+
+    // high sun, then a sun below 85 deg zenith where near-horizontal surfaces are forced to the isotropic value
+    for (Real64 const CosZenith : {0.8, 0.05}) {
+        DataEnvironment::SOLCOS(1) = 0.3;
+        DataEnvironment::SOLCOS(2) = -std::sqrt(1.0 - 0.09 - CosZenith * CosZenith);
+        DataEnvironment::SOLCOS(3) = CosZenith;
+        AnisoSkyViewFactors();
+        for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+            if (!Surface(SurfNum).ExtSolar) {
+                EXPECT_EQ(0.0, AnisoSkyMult(SurfNum));
+                continue;
+            }
+            EXPECT_EQ(OriginalAnisoSkyMult(SurfNum), AnisoSkyMult(SurfNum)) << "Surface " << SurfNum << ", cos(zenith) " << CosZenith;
+        }
+    }
+
+    // a new environment repacks the geometry, e.g. after a change of the world coordinate rotation
+    Surface(3).OutNormVec = {0.0, 1.0, 0.0};
+    AnisoSkyViewFactors();
+    EXPECT_NE(OriginalAnisoSkyMult(3), AnisoSkyMult(3)); // still the packed normal of the first environment
+    DataEnvironment::CurEnvirNum = 2;
+    AnisoSkyViewFactors();
+    EXPECT_EQ(OriginalAnisoSkyMult(3), AnisoSkyMult(3));
+}
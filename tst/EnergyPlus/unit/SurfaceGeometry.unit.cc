@@ -4340,3 +4340,246 @@ TEST_F(EnergyPlusFixture, SurfaceGeometry_CreateInternalMassSurfaces)
     EXPECT_EQ("TFLOORZONESINTMASS", DataSurfaces::IntMassObjects(3).Name);
     EXPECT_EQ("T SW APARTMENT TFLOORZONESINTMASS", SurfaceTmp(17).Name);
 }
+
+TEST_F(EnergyPlusFixture, SurfaceGeometry_ReorderSurfacesByZone)
+{
+    // surfaces entered out of zone and class order are grouped zone by zone as walls, floors, roofs/ceilings and internal mass,
+    // each base surface followed by its subsurfaces, and interzone partners are matched by name
+    bool ErrorsFound(false);
+
+    std::string const idf_objects = delimited_string({
+        "Material,",
+        "    Concrete,                !- Name",
+        "    MediumRough,             !- Roughness",
+        "    0.2,                     !- Thickness {m}",
+        "    1.7,                     !- Conductivity {W/m-K}",
+        "    2300,                    !- Density {kg/m3}",
+        "    900,                     !- Specific Heat {J/kg-K}",
+        "    0.9,                     !- Thermal Absorptance",
+        "    0.7,                     !- Solar Absorptance",
+        "    0.7;                     !- Visible Absorptance",
+        "Construction,",
+        "    Slab,                    !- Name",
+        "    Concrete;                !- Outside Layer",
+
+        "Zone,",
+        "    Zone A;                  !- Name",
+        "Zone,",
+        "    Zone B;                  !- Name",
+
+        "BuildingSurface:Detailed,",
+        "    B Roof,                  !- Name",
+        "    Roof,                    !- Surface Type",
+        "    Slab,                    !- Construction Name",
+        "    Zone B,                  !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0,                       !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    0, 0, 6,                 !- X,Y,Z ==> Vertex 1 {m}",
+        "    10, 0, 6,                !- X,Y,Z ==> Vertex 2 {m}",
+        "    10, 10, 6,               !- X,Y,Z ==> Vertex 3 {m}",
+        "    0, 10, 6;                !- X,Y,Z ==> Vertex 4 {m}",
+
+        "BuildingSurface:Detailed,",
+        "    A Wall South,            !- Name",
+        "    Wall,                    !- Surface Type",
+        "    Slab,                    !- Construction Name",
+        "    Zone A,                  !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0.5,                     !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    0, 0, 3,                 !- X,Y,Z ==> Vertex 1 {m}",
+        "    0, 0, 0,                 !- X,Y,Z ==> Vertex 2 {m}",
+        "    10, 0, 0,                !- X,Y,Z ==> Vertex 3 {m}",
+        "    10, 0, 3;                !- X,Y,Z ==> Vertex 4 {m}",
+
+        "BuildingSurface:Detailed,",
+        "    A Floor,                 !- Name",
+        "    Floor,                   !- Surface Type",
+        "    Slab,                    !- Construction Name",
+        "    Zone A,                  !- Zone Name",
+        "    Adiabatic,               !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    NoSun,                   !- Sun Exposure",
+        "    NoWind,                  !- Wind Exposure",
+        "    0,                       !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    10, 0, 0,                !- X,Y,Z ==> Vertex 1 {m}",
+        "    0, 0, 0,                 !- X,Y,Z ==> Vertex 2 {m}",
+        "    0, 10, 0,                !- X,Y,Z ==> Vertex 3 {m}",
+        "    10, 10, 0;               !- X,Y,Z ==> Vertex 4 {m}",
+
+        "BuildingSurface:Detailed,",
+        "    B Floor,                 !- Name",
+        "    Floor,                   !- Surface Type",
+        "    Slab,                    !- Construction Name",
+        "    Zone B,                  !- Zone Name",
+        "    Surface,                 !- Outside Boundary Condition",
+        "    A Ceiling,               !- Outside Boundary Condition Object",
+        "    NoSun,                   !- Sun Exposure",
+        "    NoWind,                  !- Wind Exposure",
+        "    0,                       !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    10, 0, 3,                !- X,Y,Z ==> Vertex 1 {m}",
+        "    0, 0, 3,                 !- X,Y,Z ==> Vertex 2 {m}",
+        "    0, 10, 3,                !- X,Y,Z ==> Vertex 3 {m}",
+        "    10, 10, 3;               !- X,Y,Z ==> Vertex 4 {m}",
+
+        "BuildingSurface:Detailed,",
+        "    A Ceiling,               !- Name",
+        "    Ceiling,                 !- Surface Type",
+        "    Slab,                    !- Construction Name",
+        "    Zone A,                  !- Zone Name",
+        "    Surface,                 !- Outside Boundary Condition",
+        "    B Floor,                 !- Outside Boundary Condition Object",
+        "    NoSun,                   !- Sun Exposure",
+        "    NoWind,                  !- Wind Exposure",
+        "    0,                       !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    0, 0, 3,                 !- X,Y,Z ==> Vertex 1 {m}",
+        "    10, 0, 3,                !- X,Y,Z ==> Vertex 2 {m}",
+        "    10, 10, 3,               !- X,Y,Z ==> Vertex 3 {m}",
+        "    0, 10, 3;                !- X,Y,Z ==> Vertex 4 {m}",
+
+        "BuildingSurface:Detailed,",
+        "    A Wall North,            !- Name",
+        "    Wall,                    !- Surface Type",
+        "    Slab,                    !- Construction Name",
+        "    Zone A,                  !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0.5,                     !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    10, 10, 3,               !- X,Y,Z ==> Vertex 1 {m}",
+        "    10, 10, 0,               !- X,Y,Z ==> Vertex 2 {m}",
+        "    0, 10, 0,                !- X,Y,Z ==> Vertex 3 {m}",
+        "    0, 10, 3;                !- X,Y,Z ==> Vertex 4 {m}",
+
+        "BuildingSurface:Detailed,",
+        "    B Wall,                  !- Name",
+        "    Wall,                    !- Surface Type",
+        "    Slab,                    !- Construction Name",
+        "    Zone B,                  !- Zone Name",
+        "    Outdoors,                !- Outside Boundary Condition",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    SunExposed,              !- Sun Exposure",
+        "    WindExposed,             !- Wind Exposure",
+        "    0.5,                     !- View Factor to Ground",
+        "    4,                       !- Number of Vertices",
+        "    0, 0, 6,                 !- X,Y,Z ==> Vertex 1 {m}",
+        "    0, 0, 3,                 !- X,Y,Z ==> Vertex 2 {m}",
+        "    10, 0, 3,                !- X,Y,Z ==> Vertex 3 {m}",
+        "    10, 0, 6;                !- X,Y,Z ==> Vertex 4 {m}",
+
+        "FenestrationSurface:Detailed,",
+        "    B Door,                  !- Name",
+        "    Door,                    !- Surface Type",
+        "    Slab,                    !- Construction Name",
+        "    B Wall,                  !- Building Surface Name",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    0.5,                     !- View Factor to Ground",
+        "    ,                        !- Frame and Divider Name",
+        "    1,                       !- Multiplier",
+        "    4,                       !- Number of Vertices",
+        "    4, 0, 5,                 !- X,Y,Z ==> Vertex 1 {m}",
+        "    4, 0, 3,                 !- X,Y,Z ==> Vertex 2 {m}",
+        "    6, 0, 3,                 !- X,Y,Z ==> Vertex 3 {m}",
+        "    6, 0, 5;                 !- X,Y,Z ==> Vertex 4 {m}",
+
+        "FenestrationSurface:Detailed,",
+        "    A Door North,            !- Name",
+        "    Door,                    !- Surface Type",
+        "    Slab,                    !- Construction Name",
+        "    A Wall North,            !- Building Surface Name",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    0.5,                     !- View Factor to Ground",
+        "    ,                        !- Frame and Divider Name",
+        "    1,                       !- Multiplier",
+        "    4,                       !- Number of Vertices",
+        "    6, 10, 2,                !- X,Y,Z ==> Vertex 1 {m}",
+        "    6, 10, 0,                !- X,Y,Z ==> Vertex 2 {m}",
+        "    4, 10, 0,                !- X,Y,Z ==> Vertex 3 {m}",
+        "    4, 10, 2;                !- X,Y,Z ==> Vertex 4 {m}",
+
+        "FenestrationSurface:Detailed,",
+        "    A Door South,            !- Name",
+        "    Door,                    !- Surface Type",
+        "    Slab,                    !- Construction Name",
+        "    A Wall South,            !- Building Surface Name",
+        "    ,                        !- Outside Boundary Condition Object",
+        "    0.5,                     !- View Factor to Ground",
+        "    ,                        !- Frame and Divider Name",
+        "    1,                       !- Multiplier",
+        "    4,                       !- Number of Vertices",
+        "    4, 0, 2,                 !- X,Y,Z ==> Vertex 1 {m}",
+        "    4, 0, 0,                 !- X,Y,Z ==> Vertex 2 {m}",
+        "    6, 0, 0,                 !- X,Y,Z ==> Vertex 3 {m}",
+        "    6, 0, 2;                 !- X,Y,Z ==> Vertex 4 {m}",
+
+        "InternalMass,",
+        "    A Mass,                  !- Name",
+        "    Slab,                    !- Construction Name",
+        "    Zone A,                  !- Zone or ZoneList Name",
+        "    20;                      !- Surface Area {m2}",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    GetProjectControlData(ErrorsFound); // read project control data
+    EXPECT_FALSE(ErrorsFound);          // expect no errors
+
+    GetMaterialData(ErrorsFound); // read material data
+    EXPECT_FALSE(ErrorsFound);    // expect no errors
+
+    GetConstructData(ErrorsFound); // read construction data
+    EXPECT_FALSE(ErrorsFound);     // expect no errors
+
+    GetZoneData(ErrorsFound);  // read zone data
+    EXPECT_FALSE(ErrorsFound); // expect no errors
+
+    CosZoneRelNorth.allocate(2);
+    SinZoneRelNorth.allocate(2);
+
+    CosZoneRelNorth(1) = std::cos(-Zone(1).RelNorth * DataGlobals::DegToRadians);
+    SinZoneRelNorth(1) = std::sin(-Zone(1).RelNorth * DataGlobals::DegToRadians);
+    CosZoneRelNorth(2) = CosZoneRelNorth(1);
+    SinZoneRelNorth(2) = SinZoneRelNorth(1);
+    CosBldgRelNorth = 1.0;
+    SinBldgRelNorth = 0.0;
+
+    GetSurfaceData(ErrorsFound); // setup zone geometry and get zone data
+    EXPECT_FALSE(ErrorsFound);   // expect no errors
+
+    // the order the zone-by-zone scan of all surfaces produced before the name index and zone grouping
+    std::vector<std::string> const expectedNames = {"A WALL SOUTH", "A DOOR SOUTH", "A WALL NORTH", "A DOOR NORTH", "A FLOOR", "A CEILING",
+                                                    "A MASS",       "B WALL",       "B DOOR",       "B FLOOR",      "B ROOF"};
+    std::vector<int> const expectedBaseSurfs = {1, 1, 3, 3, 5, 6, 7, 8, 8, 10, 11};
+    ASSERT_EQ(static_cast<int>(expectedNames.size()), TotSurfaces);
+    for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+        EXPECT_EQ(expectedNames[SurfNum - 1], Surface(SurfNum).Name);
+        EXPECT_EQ(expectedBaseSurfs[SurfNum - 1], Surface(SurfNum).BaseSurf);
+        EXPECT_EQ(SurfNum <= 7 ? 1 : 2, Surface(SurfNum).Zone);
+    }
+
+    // interzone partners, adiabatic and exterior boundaries
+    EXPECT_EQ(10, Surface(6).ExtBoundCond);
+    EXPECT_EQ(6, Surface(10).ExtBoundCond);
+    EXPECT_EQ(5, Surface(5).ExtBoundCond);
+    EXPECT_EQ(ExternalEnvironment, Surface(1).ExtBoundCond);
+    EXPECT_EQ(ExternalEnvironment, Surface(2).ExtBoundCond);
+    EXPECT_EQ(ExternalEnvironment, Surface(11).ExtBoundCond);
+
+    // zone surface ranges follow the grouping
+    EXPECT_EQ(1, Zone(1).SurfaceFirst);
+    EXPECT_EQ(7, Zone(1).SurfaceLast);
+    EXPECT_EQ(8, Zone(2).SurfaceFirst);
+    EXPECT_EQ(11, Zone(2).SurfaceLast);
+}
@@ -52,6 +52,7 @@
 
 // EnergyPlus Headers
 #include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/PierceSurface.hh>
 #include <EnergyPlus/SurfaceOctree.hh>
 
 // ObjexxFCL Headers
@@ -437,3 +438,63 @@ TEST(SurfaceOctreeTest, Composite)
     Surface.deallocate();
     TotSurfaces = 0;
 }
+
+TEST(SurfaceOctreeTest, TransparentSurfacesAreNotObstructions)
+{
+    // Surfaces: Transparent [0,2]x[0,2] shade at x=1 in front of an opaque [0,1]x[0,1] wall at x=2
+    TotSurfaces = 2;
+    SurfaceData surface;
+    surface.Area = 1.0;
+    surface.Sides = 4;
+    surface.Vertex.dimension(4);
+    surface.Shape = SurfaceShape::Rectangle;
+    Surface.dimension(TotSurfaces, surface);
+    Surface(1).Vertex = {Vertex(1, 0, 0), Vertex(1, 2, 0), Vertex(1, 2, 2), Vertex(1, 0, 2)};
+    Surface(1).Area = 4.0;
+    Surface(1).IsTransparent = true;
+    Surface(2).Vertex = {Vertex(2, 0, 0), Vertex(2, 1, 0), Vertex(2, 1, 1), Vertex(2, 0, 1)};
+    for (int i = 1; i <= TotSurfaces; ++i)
+        Surface(i).set_computed_geometry();
+
+    // Surface octree
+    SurfaceOctreeCube const cube(Surface);
+
+    // The solar reflection obstruction rays stop at the first surface they pierce; the octree must never offer the transparent one
+    auto firstObstruction = [&cube](Vertex const &a, Vertex const &dir) -> SurfaceData const * {
+        SurfaceData const *obstruction(nullptr);
+        auto obstructionHit = [&](SurfaceData const &surface) -> bool {
+            Vertex hitPt;
+            bool hit(false);
+            PierceSurface(surface, a, dir, hitPt, hit);
+            if (hit) obstruction = &surface;
+            return hit;
+        };
+        cube.processSomeSurfaceRayIntersectsCube(a, dir, SurfaceOctreeCube::safe_inverse(dir), obstructionHit);
+        return obstruction;
+    };
+
+    { // Ray through the shade and the wall: only the wall obstructs
+        Vertex const a(0.0, 0.5, 0.5), dir(1.0, 0.0, 0.0);
+        bool linearHit(false);
+        Vertex hitPt;
+        PierceSurface(1, a, dir, hitPt, linearHit);
+        EXPECT_TRUE(linearHit); // A scan over all surfaces would stop at the shade
+        EXPECT_EQ(&Surface(2), firstObstruction(a, dir));
+    }
+    { // Ray through the shade alone: unobstructed
+        Vertex const a(0.0, 1.5, 1.5), dir(1.0, 0.0, 0.0);
+        bool linearHit(false);
+        Vertex hitPt;
+        PierceSurface(1, a, dir, hitPt, linearHit);
+        EXPECT_TRUE(linearHit);
+        EXPECT_EQ(nullptr, firstObstruction(a, dir));
+    }
+    { // Ray toward the wall from behind it still sees the wall
+        Vertex const a(3.0, 0.5, 0.5), dir(-1.0, 0.0, 0.0);
+        EXPECT_EQ(&Surface(2), firstObstruction(a, dir));
+    }
+
+    // Clean up
+    Surface.deallocate();
+    TotSurfaces = 0;
+}
@@ -948,3 +948,77 @@ TEST_F(EnergyPlusFixture, ThermalComfort_CalcIfSetPointMetWithCutoutTest)
     EXPECT_EQ(TimeStepZone, ThermalComfortSetPoint(1).totalNotMetCoolingOccupied);
 
 }
+
+TEST_F(EnergyPlusFixture, ThermalComfort_CalcThermalComfortFangerForOnePeopleObject)
+{
+    // thermal comfort control asks for the PMV of one people object; only that object is evaluated and the result
+    // matches the reporting calculation at the same air temperature
+    NumOfZones = 2;
+    TotPeople = 3;
+    People.allocate(TotPeople);
+    ThermalComfortData.allocate(TotPeople);
+    ScheduleManager::Schedule.allocate(5);
+    ScheduleManager::Schedule(1).CurrentValue = 120.0; // activity level [W]
+    ScheduleManager::Schedule(2).CurrentValue = 0.0;   // work efficiency
+    ScheduleManager::Schedule(3).CurrentValue = 0.5;   // clothing [clo]
+    ScheduleManager::Schedule(4).CurrentValue = 1.0;   // clothing [clo]
+    ScheduleManager::Schedule(5).CurrentValue = 0.2;   // air velocity [m/s]
+    for (int PeopleNum = 1; PeopleNum <= TotPeople; ++PeopleNum) {
+        People(PeopleNum).Name = "People " + std::to_string(PeopleNum);
+        People(PeopleNum).ZonePtr = (PeopleNum == 1) ? 1 : 2;
+        People(PeopleNum).ActivityLevelPtr = 1;
+        People(PeopleNum).WorkEffPtr = 2;
+        People(PeopleNum).ClothingType = 1;
+        People(PeopleNum).ClothingPtr = (PeopleNum == 3) ? 4 : 3;
+        People(PeopleNum).AirVelocityPtr = 5;
+        People(PeopleNum).MRTCalcType = ZoneAveraged;
+        People(PeopleNum).Fanger = (PeopleNum != 3);
+    }
+
+    IsZoneDV.dimension(NumOfZones, false);
+    IsZoneUI.dimension(NumOfZones, false);
+    IsZoneCV.dimension(NumOfZones, false);
+    QHTRadSysToPerson.dimension(NumOfZones, 0.0);
+    QCoolingPanelToPerson.dimension(NumOfZones, 0.0);
+    QHWBaseboardToPerson.dimension(NumOfZones, 0.0);
+    QSteamBaseboardToPerson.dimension(NumOfZones, 0.0);
+    QElecBaseboardToPerson.dimension(NumOfZones, 0.0);
+    Real64 const Tset = 24.5;
+    ZTAVComf.dimension(NumOfZones, 0.0);
+    MAT.dimension(NumOfZones, 0.0);
+    MRT.dimension(NumOfZones, 0.0);
+    ZoneAirHumRatAvgComf.dimension(NumOfZones, 0.0);
+    ZTAVComf(1) = MAT(1) = 21.0;
+    MRT(1) = 20.0;
+    ZoneAirHumRatAvgComf(1) = 0.006;
+    ZTAVComf(2) = MAT(2) = Tset;
+    MRT(2) = 25.5;
+    ZoneAirHumRatAvgComf(2) = 0.009;
+    OutBaroPress = 101325.0;
+
+    CalcThermalComfortFanger();
+    Real64 const reportedPMV = ThermalComfortData(2).FangerPMV;
+    Real64 const reportedPPD = ThermalComfortData(2).FangerPPD;
+    EXPECT_NE(ThermalComfortData(1).FangerPMV, reportedPMV);
+    EXPECT_EQ(0.0, ThermalComfortData(3).FangerPMV); // not a Fanger object
+
+    for (auto &comfort : ThermalComfortData) {
+        comfort.FangerPMV = -99.0;
+    }
+    Real64 PMV(0.0);
+    CalcThermalComfortFanger(2, Tset, PMV);
+    EXPECT_EQ(reportedPMV, PMV);
+    EXPECT_EQ(reportedPMV, ThermalComfortData(2).FangerPMV);
+    EXPECT_EQ(reportedPPD, ThermalComfortData(2).FangerPPD);
+    EXPECT_EQ(-99.0, ThermalComfortData(1).FangerPMV);
+    EXPECT_EQ(-99.0, ThermalComfortData(3).FangerPMV);
+
+    // an object without Fanger reporting is still evaluated when asked for by thermal comfort control
+    CalcThermalComfortFanger(3, Tset, PMV);
+    EXPECT_EQ(-99.0, ThermalComfortData(1).FangerPMV);
+    EXPECT_EQ(reportedPMV, ThermalComfortData(2).FangerPMV);
+    People(3).Fanger = true;
+    CalcThermalComfortFanger();
+    EXPECT_EQ(PMV, ThermalComfortData(3).FangerPMV);
+    EXPECT_NE(reportedPMV, PMV);
+}
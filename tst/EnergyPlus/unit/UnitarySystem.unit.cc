@@ -53,6 +53,7 @@
 // EnergyPlus Headers
 #include "Fixtures/EnergyPlusFixture.hh"
 #include <EnergyPlus/BranchInputManager.hh>
+#include <EnergyPlus/CurveManager.hh>
 #include <EnergyPlus/DXCoils.hh>
 #include <EnergyPlus/DataAirLoop.hh>
 #include <EnergyPlus/DataAirSystems.hh>
@@ -10869,3 +10870,149 @@ TEST_F(EnergyPlusFixture, UnitarySystemModel_GetInputZoneEquipmentBlankCtrlZone)
     DataZoneEquipment::ZoneEquipList(1).compPointer[1]->getUnitarySystemInputData(compName, zoneEquipment, 0, ErrorsFound); // get UnitarySystem input
     EXPECT_TRUE(ErrorsFound); // expect errors when control zone name is blank and Control Type = Load
 }
+
+TEST_F(EnergyPlusFixture, UnitarySystemModel_DOE2DXCoilDirectPLRMatchesSolveRoot)
+{
+    // the closed form part load ratio of a single speed DX coil must agree with the iterative solution
+
+    std::string const idf_objects = delimited_string({
+        "Curve:Biquadratic,",
+        "	WindACCoolCapFT, !- Name",
+        "	0.942587793,     !- Coefficient1 Constant",
+        "	0.009543347,     !- Coefficient2 x",
+        "	0.000683770,     !- Coefficient3 x**2",
+        "	-0.011042676,    !- Coefficient4 y",
+        "	0.000005249,     !- Coefficient5 y**2",
+        "	-0.000009720,    !- Coefficient6 x*y",
+        "	12.77778,        !- Minimum Value of x",
+        "	23.88889,        !- Maximum Value of x",
+        "	18.0,            !- Minimum Value of y",
+        "	46.11111,        !- Maximum Value of y",
+        "	,                !- Minimum Curve Output",
+        "	,                !- Maximum Curve Output",
+        "	Temperature,     !- Input Unit Type for X",
+        "	Temperature,     !- Input Unit Type for Y",
+        "	Dimensionless;   !- Output Unit Type",
+        "Curve:Biquadratic,",
+        "	WindACEIRFT,   !- Name",
+        "	0.342414409,   !- Coefficient1 Constant",
+        "	0.034885008,   !- Coefficient2 x",
+        "	-0.000623700,  !- Coefficient3 x**2",
+        "	0.004977216,   !- Coefficient4 y",
+        "	0.000437951,   !- Coefficient5 y**2",
+        "	-0.000728028,  !- Coefficient6 x*y",
+        "	12.77778,      !- Minimum Value of x",
+        "	23.88889,      !- Maximum Value of x",
+        "	18.0,          !- Minimum Value of y",
+        "	46.11111,      !- Maximum Value of y",
+        "	,              !- Minimum Curve Output",
+        "	,              !- Maximum Curve Output",
+        "	Temperature,   !- Input Unit Type for X",
+        "	Temperature,   !- Input Unit Type for Y",
+        "	Dimensionless; !- Output Unit Type",
+        "Curve:Quadratic,",
+        "	WindACCoolCapFFF, !- Name",
+        "	0.8,              !- Coefficient1 Constant",
+        "	0.2,              !- Coefficient2 x",
+        "	0.0,              !- Coefficient3 x**2",
+        "	0.5,              !- Minimum Value of x",
+        "	1.5;              !- Maximum Value of x",
+        "Curve:Quadratic,",
+        "	WindACEIRFFF, !- Name",
+        "	1.1552,       !- Coefficient1 Constant",
+        "  -0.1808,       !- Coefficient2 x",
+        "	0.0256,       !- Coefficient3 x**2",
+        "	0.5,          !- Minimum Value of x",
+        "	1.5;          !- Maximum Value of x",
+        "Curve:Quadratic,",
+        "	WindACPLFFPLR, !- Name",
+        "	0.85,          !- Coefficient1 Constant",
+        "	0.15,          !- Coefficient2 x",
+        "	0.0,           !- Coefficient3 x**2",
+        "	0.0,           !- Minimum Value of x",
+        "	1.0;           !- Maximum Value of x",
+        "Coil:Cooling:DX:SingleSpeed,",
+        "	Furnace ACDXCoil 1,   !- Name",
+        " 	,                     !- Availability Schedule Name",
+        "	25000.0,              !- Gross Rated Total Cooling Capacity { W }",
+        "	0.75,                 !- Gross Rated Sensible Heat Ratio",
+        "	4.40,                 !- Gross Rated Cooling COP { W / W }",
+        "	1.30,                 !- Rated Air Flow Rate { m3 / s }",
+        "	,                     !- Rated Evaporator Fan Power Per Volume Flow Rate { W / ( m3 / s ) }",
+        "	DX Cooling Coil Air Inlet Node, !- Air Inlet Node Name",
+        "	Heating Coil Air Inlet Node,    !- Air Outlet Node Name",
+        "	WindACCoolCapFT,      !- Total Cooling Capacity Function of Temperature Curve Name",
+        "	WindACCoolCapFFF,     !- Total Cooling Capacity Function of Flow Fraction Curve Name",
+        "	WindACEIRFT,          !- Energy Input Ratio Function of Temperature Curve Name",
+        "	WindACEIRFFF,         !- Energy Input Ratio Function of Flow Fraction Curve Name",
+        "	WindACPLFFPLR,        !- Part Load Fraction Correlation Curve Name",
+        "	,                     !- Minimum Outdoor Dry-Bulb Temperature for Compressor Operation {C}",
+        "	0.0,                  !- Nominal Time for Condensate Removal to Begin",
+        "	0.0,                  !- Ratio of Initial Moisture Evaporation Rate and Steady State Latent Capacity",
+        "	0.0,                  !- Maximum Cycling Rate",
+        "	0.0,                  !- Latent Capacity Time Constant",
+        "	,                     !- Condenser Air Inlet Node Name",
+        "	AirCooled,            !- Condenser Type",
+        "	0.0,                  !- Evaporative Condenser Effectiveness",
+        "	,                     !- Evaporative Condenser Air Flow Rate",
+        "	0.0,                  !- Evaporative Condenser Pump Rated Power Consumption",
+        "	0.0,                  !- Crankcase Heater Capacity",
+        "	10.0;                 !- Maximum Outdoor DryBulb Temperature for Crankcase Heater Operation",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    ScheduleManager::ProcessScheduleInput();
+    CurveManager::GetCurveInput();
+    DXCoils::GetDXCoils();
+
+    DXCoils::DXCoil(1).RatedAirMassFlowRate(1) = 1.30 * 1.2;
+    DXCoils::DXCoil(1).RatedCBF(1) = 0.05;
+    DXCoils::DXCoil(1).InletAirMassFlowRate = 1.30 * 1.2;
+    DXCoils::DXCoil(1).InletAirTemp = 26.7;
+    DXCoils::DXCoil(1).InletAirHumRat = 0.0111;
+    DXCoils::DXCoil(1).InletAirEnthalpy = Psychrometrics::PsyHFnTdbW(26.7, 0.0111);
+
+    DataEnvironment::OutDryBulbTemp = 35.0;
+    DataEnvironment::OutHumRat = 0.0100;
+    DataEnvironment::OutBaroPress = 101325.0;
+    DataEnvironment::OutWetBulbTemp = Psychrometrics::PsyTwbFnTdbWPb(35.0, 0.0100, 101325.0);
+
+    DXCoils::CalcDoe2DXCoil(1, On, true, 1.0, DataHVACGlobals::ContFanCycCoil);
+    Real64 const FullLoadTemp = DXCoils::DXCoilOutletTemp(1);
+    Real64 const FullLoadHumRat = DXCoils::DXCoilOutletHumRat(1);
+    ASSERT_LT(FullLoadHumRat, 0.0111); // wet coil
+
+    int const MaxIte(500);
+    int SolFla(0);
+    std::vector<Real64> Par(6, 0.0);
+    Par[1] = 1.0;
+    Par[5] = double(DataHVACGlobals::ContFanCycCoil);
+
+    // outlet temperature target
+    Real64 const Acc(1.e-3);
+    Par[2] = 0.5 * (26.7 + FullLoadTemp);
+    Real64 DirectPLR(0.0);
+    ASSERT_TRUE(UnitarySys::DOE2DXCoilDirectPLR(Acc, Par, false, DirectPLR));
+    Real64 IterativePLR(0.0);
+    General::SolveRoot(Acc, MaxIte, SolFla, IterativePLR, UnitarySys::DOE2DXCoilResidual, 0.0, 1.0, Par);
+    EXPECT_GT(SolFla, 0);
+    EXPECT_NEAR(IterativePLR, DirectPLR, 0.001);
+    EXPECT_NEAR(0.0, UnitarySys::DOE2DXCoilResidual(DirectPLR, Par), Acc);
+
+    // outlet humidity ratio target
+    Real64 const HumRatAcc(1.e-6);
+    Par[2] = 0.7 * 0.0111 + 0.3 * FullLoadHumRat;
+    ASSERT_TRUE(UnitarySys::DOE2DXCoilDirectPLR(HumRatAcc, Par, true, DirectPLR));
+    General::SolveRoot(HumRatAcc, MaxIte, SolFla, IterativePLR, UnitarySys::DOE2DXCoilHumRatResidual, 0.0, 1.0, Par);
+    EXPECT_GT(SolFla, 0);
+    EXPECT_NEAR(IterativePLR, DirectPLR, 0.001);
+    EXPECT_NEAR(0.0, UnitarySys::DOE2DXCoilHumRatResidual(DirectPLR, Par), HumRatAcc);
+
+    // targets outside the coil range and a cycling fan are left to SolveRoot
+    Par[2] = FullLoadTemp - 1.0;
+    EXPECT_FALSE(UnitarySys::DOE2DXCoilDirectPLR(Acc, Par, false, DirectPLR));
+    Par[2] = 0.5 * (26.7 + FullLoadTemp);
+    Par[5] = double(DataHVACGlobals::CycFanCycCoil);
+    EXPECT_FALSE(UnitarySys::DOE2DXCoilDirectPLR(Acc, Par, false, DirectPLR));
+}
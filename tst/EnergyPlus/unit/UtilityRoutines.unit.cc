@@ -53,6 +53,7 @@
 #include <EnergyPlus/DataGlobals.hh>
 #include <EnergyPlus/DataStringGlobals.hh>
 #include <EnergyPlus/DisplayRoutines.hh>
+#include <EnergyPlus/GlobalNames.hh>
 #include <EnergyPlus/UtilityRoutines.hh>
 
 #include "Fixtures/EnergyPlusFixture.hh"
@@ -121,6 +122,40 @@ TEST_F(EnergyPlusFixture, RecurringWarningTest)
     EXPECT_EQ(" ** Warning ** " + myMessage4, DataErrorTracking::RecurringErrors(5).Message);
 }
 
+TEST_F(EnergyPlusFixture, RecurringWarningUpdateByIndexTest)
+{
+    int ErrIndex = 0;
+    // an unregistered index records nothing
+    EXPECT_FALSE(UpdateRecurringErrorAtEnd(ErrIndex, 1.0, 1.0));
+    EXPECT_EQ(0, DataErrorTracking::NumRecurringErrors);
+
+    ShowRecurringWarningErrorAtEnd("Test message 1", ErrIndex, 2.0, 2.0);
+    EXPECT_EQ(1, ErrIndex);
+    int const warningsAfterRegistering = DataErrorTracking::TotalWarningErrors;
+
+    EXPECT_TRUE(UpdateRecurringErrorAtEnd(ErrIndex, 5.0, -1.0));
+    EXPECT_EQ(2, DataErrorTracking::RecurringErrors(1).Count);
+    EXPECT_EQ(5.0, DataErrorTracking::RecurringErrors(1).MaxValue);
+    EXPECT_EQ(-1.0, DataErrorTracking::RecurringErrors(1).MinValue);
+    EXPECT_EQ(warningsAfterRegistering + 1, DataErrorTracking::TotalWarningErrors);
+
+    // registering by text again still finds the same message, ignoring case
+    int OtherIndex = 0;
+    ShowRecurringWarningErrorAtEnd("TEST MESSAGE 1", OtherIndex, 3.0, 3.0);
+    EXPECT_EQ(1, OtherIndex);
+    EXPECT_EQ(3, DataErrorTracking::RecurringErrors(1).Count);
+    EXPECT_EQ(1, DataErrorTracking::NumRecurringErrors);
+
+    // updates to a severe message count as severe errors
+    int SevereIndex = 0;
+    ShowRecurringSevereErrorAtEnd("Test message 1", SevereIndex);
+    EXPECT_EQ(2, SevereIndex);
+    int const severesAfterRegistering = DataErrorTracking::TotalSevereErrors;
+    EXPECT_TRUE(UpdateRecurringErrorAtEnd(SevereIndex));
+    EXPECT_EQ(severesAfterRegistering + 1, DataErrorTracking::TotalSevereErrors);
+    EXPECT_EQ(2, DataErrorTracking::RecurringErrors(2).Count);
+}
+
 TEST_F(EnergyPlusFixture, DisplayMessageTest)
 {
     DisplayString("Testing");
@@ -141,3 +176,72 @@ TEST_F(EnergyPlusFixture, DisplayMessageTest)
     DisplayString("Testing");
     EXPECT_TRUE(has_cout_output(true));
 }
+
+TEST_F(EnergyPlusFixture, NameIndex_MatchesFindItemInList)
+{
+    Array1D_string ListOfItems({"NODE A", "NODE B", "NODE A", "NODE C"});
+
+    UtilityRoutines::NameIndex ListIndex;
+    ListIndex.build(ListOfItems);
+    EXPECT_EQ(3, ListIndex.size());
+    for (auto const &Name : {"NODE A", "NODE B", "NODE C", "node a", "NODE D"}) {
+        EXPECT_EQ(UtilityRoutines::FindItemInList(Name, ListOfItems), UtilityRoutines::FindItemInList(Name, ListIndex)) << Name;
+    }
+    EXPECT_EQ(1, ListIndex.find("NODE A")); // first occurrence wins
+    EXPECT_EQ(0, ListIndex.find("node a")); // exact match, as FindItemInList
+
+    // only the first NumItems entries are indexed
+    ListIndex.build(ListOfItems, 2);
+    EXPECT_EQ(0, ListIndex.find("NODE C"));
+    ListIndex.add("NODE C", 4);
+    EXPECT_EQ(4, ListIndex.find("NODE C"));
+
+    struct NamedItem
+    {
+        std::string Name;
+        std::string OtherName;
+    };
+    std::vector<NamedItem> Items({{"FIRST", "ONE"}, {"SECOND", "TWO"}});
+    ListIndex.build(Items, static_cast<int>(Items.size()));
+    EXPECT_EQ(2, ListIndex.find("SECOND"));
+    ListIndex.build(Items, &NamedItem::OtherName, static_cast<int>(Items.size()));
+    EXPECT_EQ(1, ListIndex.find("ONE"));
+    EXPECT_EQ(0, ListIndex.find("SECOND"));
+
+    ListIndex.clear();
+    EXPECT_TRUE(ListIndex.empty());
+}
+
+TEST_F(EnergyPlusFixture, VerifyUniqueName_MatchesVerifyName)
+{
+    // the hashed check must flag the same names, with the same messages, as the array search it replaces
+    std::vector<std::string> const Names({"ZONE A", "ZONE B", "zone a", "", "ZONE B", "ZONE C"});
+    std::vector<std::string> const Errors({"",
+                                           "",
+                                           "   ** Severe  ** Object Name, duplicate name=zone a",
+                                           "   ** Severe  ** Object Name, cannot be blank",
+                                           "   ** Severe  ** Object Name, duplicate name=ZONE B",
+                                           ""});
+    Array1D_string NamesList(Names.size());
+    std::unordered_set<std::string> UniqueNames;
+
+    for (std::size_t i = 0; i < Names.size(); ++i) {
+        bool ErrorFound = false;
+        bool IsBlank = false;
+        UtilityRoutines::VerifyName(Names[i], NamesList, static_cast<int>(i), ErrorFound, IsBlank, "Object Name");
+        bool UniqueErrorFound = false;
+        bool UniqueIsBlank = false;
+        GlobalNames::VerifyUniqueName(UniqueNames, Names[i], UniqueErrorFound, UniqueIsBlank, "Object Name");
+
+        EXPECT_EQ(ErrorFound, UniqueErrorFound) << Names[i];
+        EXPECT_EQ(IsBlank, UniqueIsBlank) << Names[i];
+        if (Errors[i].empty()) {
+            EXPECT_FALSE(ErrorFound) << Names[i];
+            EXPECT_FALSE(has_err_output(true)) << Names[i];
+        } else {
+            EXPECT_TRUE(compare_err_stream(delimited_string({Errors[i], Errors[i]}), true)) << Names[i];
+        }
+        NamesList(i + 1) = Names[i];
+    }
+    EXPECT_EQ(3u, UniqueNames.size());
+}
@@ -1231,3 +1231,91 @@ TEST_F(WaterCoilsTest, HotWaterHeatingCoilAutoSizeTempTest)
     // check heating coil design water flow rate calculated here and sizing results are identical
     EXPECT_DOUBLE_EQ(DesWaterFlowRate, WaterCoil(CoilNum).MaxWaterVolFlowRate);
 }
+
+TEST_F(WaterCoilsTest, SharedDryFinEffCoef)
+{
+    // the shared fit is the CalcDryFinEffCoef fit of the same ratio, computed once per ratio
+    Array1D<Real64> Expected(5);
+    Array1D<Real64> Coefs(5);
+    CalcDryFinEffCoef(0.2, Expected);
+    SharedDryFinEffCoef(0.2, Coefs);
+    for (int i = 1; i <= 5; ++i) {
+        EXPECT_EQ(Expected(i), Coefs(i));
+    }
+    Coefs = 0.0;
+    SharedDryFinEffCoef(0.2, Coefs);
+    for (int i = 1; i <= 5; ++i) {
+        EXPECT_EQ(Expected(i), Coefs(i));
+    }
+
+    // another geometry gets its own fit
+    CalcDryFinEffCoef(0.3, Expected);
+    SharedDryFinEffCoef(0.3, Coefs);
+    for (int i = 1; i <= 5; ++i) {
+        EXPECT_EQ(Expected(i), Coefs(i));
+    }
+}
+
+TEST_F(WaterCoilsTest, CoilPartWetPartDryWarmStart)
+{
+    InitializePsychRoutines();
+    OutBaroPress = 101325.0;
+    PlantLoop(1).FluidName = "WATER";
+    PlantLoop(1).FluidIndex = 1;
+
+    int const CoilNum = 1;
+    WaterCoil(CoilNum).Name = "Test Part Wet Coil";
+    WaterCoil(CoilNum).WaterLoopNum = 1;
+    WaterCoil(CoilNum).TotCoilOutsideSurfArea = 100.0;
+    WaterCoil(CoilNum).UACoilInternalPerUnitArea = 200.0;
+    WaterCoil(CoilNum).UADryExtPerUnitArea = 60.0;
+    WaterCoil(CoilNum).UAWetExtPerUnitArea = 60.0;
+    WaterCoil(CoilNum).InletAirMassFlowRate = 1.5;
+    WaterCoil(CoilNum).InletWaterMassFlowRate = 2.0;
+    WaterCoil(CoilNum).MaxWaterMassFlowRate = 2.0;
+    WaterCoil(CoilNum).InletAirTemp = 26.0;
+    WaterCoil(CoilNum).InletAirHumRat = 0.0082;
+
+    Real64 const InletWaterTemp(7.0);
+    Real64 const InletAirTemp(WaterCoil(CoilNum).InletAirTemp);
+    Real64 const AirDewPointTemp(PsyTdpFnWPb(WaterCoil(CoilNum).InletAirHumRat, OutBaroPress));
+
+    // the first HVAC iteration starts from the crude estimates and saves its solution
+    Real64 OutletWaterTemp(0.0), OutletAirTemp(0.0), OutletAirHumRat(0.0), TotLoad(0.0), SenLoad(0.0), WetFraction(0.0);
+    CoilPartWetPartDry(CoilNum, true, InletWaterTemp, InletAirTemp, AirDewPointTemp, OutletWaterTemp, OutletAirTemp, OutletAirHumRat, TotLoad,
+                       SenLoad, WetFraction, ContFanCycCoil, 1.0);
+    ASSERT_GT(WetFraction, 0.0);
+    ASSERT_LT(WetFraction, 1.0);
+    EXPECT_TRUE(WaterCoil(CoilNum).PartWetSolutionSaved);
+    EXPECT_EQ(OutletWaterTemp, WaterCoil(CoilNum).OutletWaterTempSaved);
+    EXPECT_EQ(WetFraction, WaterCoil(CoilNum).SurfAreaWetFractionSaved);
+
+    // a later iteration started from the saved solution converges to the same solution
+    Real64 WarmOutletWaterTemp(0.0), WarmOutletAirTemp(0.0), WarmOutletAirHumRat(0.0), WarmTotLoad(0.0), WarmSenLoad(0.0), WarmWetFraction(0.0);
+    CoilPartWetPartDry(CoilNum, false, InletWaterTemp, InletAirTemp, AirDewPointTemp, WarmOutletWaterTemp, WarmOutletAirTemp,
+                       WarmOutletAirHumRat, WarmTotLoad, WarmSenLoad, WarmWetFraction, ContFanCycCoil, 1.0);
+    EXPECT_NEAR(OutletWaterTemp, WarmOutletWaterTemp, 0.01);
+    EXPECT_NEAR(OutletAirTemp, WarmOutletAirTemp, 0.01);
+    EXPECT_NEAR(OutletAirHumRat, WarmOutletAirHumRat, 1.0e-5);
+    EXPECT_NEAR(TotLoad, WarmTotLoad, 0.001 * TotLoad);
+    EXPECT_NEAR(SenLoad, WarmSenLoad, 0.001 * SenLoad);
+    EXPECT_NEAR(WetFraction, WarmWetFraction, 0.01);
+
+    // a saved temperature outside the inlet temperatures is ignored, giving the old start from the inlet air temperature
+    Real64 const SavedWetFraction(WaterCoil(CoilNum).SurfAreaWetFractionSaved);
+    Real64 OldOutletWaterTemp(0.0), OldOutletAirTemp(0.0), OldOutletAirHumRat(0.0), OldTotLoad(0.0), OldSenLoad(0.0), OldWetFraction(0.0);
+    WaterCoil(CoilNum).PartWetSolutionSaved = false;
+    CoilPartWetPartDry(CoilNum, false, InletWaterTemp, InletAirTemp, AirDewPointTemp, OldOutletWaterTemp, OldOutletAirTemp, OldOutletAirHumRat,
+                       OldTotLoad, OldSenLoad, OldWetFraction, ContFanCycCoil, 1.0);
+    Real64 NewOutletWaterTemp(0.0), NewOutletAirTemp(0.0), NewOutletAirHumRat(0.0), NewTotLoad(0.0), NewSenLoad(0.0), NewWetFraction(0.0);
+    WaterCoil(CoilNum).SurfAreaWetFractionSaved = SavedWetFraction;
+    WaterCoil(CoilNum).OutletWaterTempSaved = InletAirTemp + 5.0;
+    CoilPartWetPartDry(CoilNum, false, InletWaterTemp, InletAirTemp, AirDewPointTemp, NewOutletWaterTemp, NewOutletAirTemp, NewOutletAirHumRat,
+                       NewTotLoad, NewSenLoad, NewWetFraction, ContFanCycCoil, 1.0);
+    EXPECT_EQ(OldOutletWaterTemp, NewOutletWaterTemp);
+    EXPECT_EQ(OldOutletAirTemp, NewOutletAirTemp);
+    EXPECT_EQ(OldOutletAirHumRat, NewOutletAirHumRat);
+    EXPECT_EQ(OldTotLoad, NewTotLoad);
+    EXPECT_EQ(OldSenLoad, NewSenLoad);
+    EXPECT_EQ(OldWetFraction, NewWetFraction);
+}
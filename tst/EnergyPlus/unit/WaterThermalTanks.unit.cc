@@ -58,6 +58,7 @@
 #include <EnergyPlus/DXCoils.hh>
 #include <EnergyPlus/DataHeatBalFanSys.hh>
 #include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/Fans.hh>
 #include <EnergyPlus/FluidProperties.hh>
 #include <EnergyPlus/General.hh>
@@ -2182,3 +2183,162 @@ TEST_F(EnergyPlusFixture, StratifiedTankSourceFlowRateCalc) {
 
 
 }
+
+TEST_F(EnergyPlusFixture, StratifiedTankImplicitCalc)
+{
+    using DataGlobals::HourOfDay;
+    using DataGlobals::SecInHour;
+    using DataGlobals::TimeStep;
+    using DataGlobals::TimeStepZone;
+    using DataHVACGlobals::SysTimeElapsed;
+    using DataHVACGlobals::TimeStepSys;
+    using WaterThermalTanks::WaterThermalTank;
+
+    std::string const idf_objects = delimited_string({
+        "Schedule:Constant, Hot Water Setpoint Temp Schedule, , 30.0;",
+        "Schedule:Constant, Ambient Temp Schedule, , 22.0;",
+        "Schedule:Constant, Hot Water Demand Schedule, , 0.0;",
+        "WaterHeater:Stratified,",
+        "  Stratified Tank,         !- Name",
+        "  ,                        !- End-Use Subcategory",
+        "  0.17,                    !- Tank Volume {m3}",
+        "  1.4,                     !- Tank Height {m}",
+        "  VerticalCylinder,        !- Tank Shape",
+        "  ,                        !- Tank Perimeter {m}",
+        "  100.0,                   !- Maximum Temperature Limit {C}",
+        "  MasterSlave,             !- Heater Priority Control",
+        "  Hot Water Setpoint Temp Schedule,  !- Heater 1 Setpoint Temperature Schedule Name",
+        "  2.0,                     !- Heater 1 Deadband Temperature Difference {deltaC}",
+        "  4500,                    !- Heater 1 Capacity {W}",
+        "  1.0,                     !- Heater 1 Height {m}",
+        "  Hot Water Setpoint Temp Schedule,  !- Heater 2 Setpoint Temperature Schedule Name",
+        "  5.0,                     !- Heater 2 Deadband Temperature Difference {deltaC}",
+        "  4500,                    !- Heater 2 Capacity {W}",
+        "  0.0,                     !- Heater 2 Height {m}",
+        "  ELECTRICITY,             !- Heater Fuel Type",
+        "  0.98,                    !- Heater Thermal Efficiency",
+        "  ,                        !- Off Cycle Parasitic Fuel Consumption Rate {W}",
+        "  ELECTRICITY,             !- Off Cycle Parasitic Fuel Type",
+        "  ,                        !- Off Cycle Parasitic Heat Fraction to Tank",
+        "  ,                        !- Off Cycle Parasitic Height {m}",
+        "  ,                        !- On Cycle Parasitic Fuel Consumption Rate {W}",
+        "  ELECTRICITY,             !- On Cycle Parasitic Fuel Type",
+        "  ,                        !- On Cycle Parasitic Heat Fraction to Tank",
+        "  ,                        !- On Cycle Parasitic Height {m}",
+        "  SCHEDULE,                !- Ambient Temperature Indicator",
+        "  Ambient Temp Schedule,   !- Ambient Temperature Schedule Name",
+        "  ,                        !- Ambient Temperature Zone Name",
+        "  ,                        !- Ambient Temperature Outdoor Air Node Name",
+        "  0.846,                   !- Uniform Skin Loss Coefficient per Unit Area to Ambient Temperature {W/m2-K}",
+        "  ,                        !- Skin Loss Fraction to Zone",
+        "  ,                        !- Off Cycle Flue Loss Coefficient to Ambient Temperature {W/K}",
+        "  ,                        !- Off Cycle Flue Loss Fraction to Zone",
+        "  0.000189,                !- Peak Use Flow Rate {m3/s}",
+        "  Hot Water Demand Schedule,  !- Use Flow Rate Fraction Schedule Name",
+        "  ,                        !- Cold Water Supply Temperature Schedule Name",
+        "  ,                        !- Use Side Inlet Node Name",
+        "  ,                        !- Use Side Outlet Node Name",
+        "  ,                        !- Use Side Effectiveness",
+        "  ,                        !- Use Side Inlet Height {m}",
+        "  ,                        !- Use Side Outlet Height {m}",
+        "  ,                        !- Source Side Inlet Node Name",
+        "  ,                        !- Source Side Outlet Node Name",
+        "  ,                        !- Source Side Effectiveness",
+        "  ,                        !- Source Side Inlet Height {m}",
+        "  ,                        !- Source Side Outlet Height {m}",
+        "  FIXED,                   !- Inlet Mode",
+        "  ,                        !- Use Side Design Flow Rate {m3/s}",
+        "  ,                        !- Source Side Design Flow Rate {m3/s}",
+        "  ,                        !- Indirect Water Heating Recovery Time {hr}",
+        "  12,                      !- Number of Nodes",
+        "  ;                        !- Additional Destratification Conductivity {W/m-K}",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    bool ErrorsFound = false;
+    EXPECT_FALSE(WaterThermalTanks::GetWaterThermalTankInputData(ErrorsFound));
+
+    HourOfDay = 0;
+    TimeStep = 1;
+    SysTimeElapsed = 0.0;
+    const int TankNum = 1;
+    WaterThermalTanks::WaterThermalTankData &Tank = WaterThermalTank(TankNum);
+
+    // Stratified start: 60 C at the top dropping 2 C per node, with a small draw of 35 C water into the bottom
+    auto ResetTank = [&Tank]() {
+        for (int i = 0; i < Tank.Nodes; ++i) {
+            auto &node = Tank.Node[i];
+            node.Temp = 60.0 - 2.0 * i;
+            node.SavedTemp = node.Temp;
+            node.TempSum = 0.0;
+        }
+        Tank.TankTemp = 49.0;
+        Tank.TimeElapsed = 0.0;
+        Tank.HeaterOn1 = false;
+        Tank.HeaterOn2 = false;
+        Tank.AmbientTemp = 22.0;
+        Tank.UseInletTemp = 35.0;
+        Tank.UseMassFlowRate = 0.2 * 6.30901964e-5 * 997; // 0.2 gal/min
+        Tank.SourceMassFlowRate = 0.0;
+    };
+    std::vector<Real64> StartTemps(Tank.Nodes);
+    std::vector<Real64> ExplicitTemps(Tank.Nodes);
+
+    // With the heaters off over a one minute step the implicit solution reproduces the explicit one
+    TimeStepZone = 1.0 / 60.0;
+    TimeStepSys = TimeStepZone;
+    Tank.SetPointTemp = 30.0;
+    Tank.SetPointTemp2 = Tank.SetPointTemp;
+
+    DataSystemVariables::StratifiedTankImplicit = false;
+    ResetTank();
+    WaterThermalTanks::CalcWaterThermalTankStratified(TankNum);
+    EXPECT_FALSE(Tank.HeaterOn1);
+    EXPECT_FALSE(Tank.HeaterOn2);
+    for (int i = 0; i < Tank.Nodes; ++i) {
+        ExplicitTemps[i] = Tank.Node[i].Temp;
+    }
+    const Real64 ExplicitUseRate = Tank.UseRate;
+
+    DataSystemVariables::StratifiedTankImplicit = true;
+    ResetTank();
+    WaterThermalTanks::CalcWaterThermalTankStratified(TankNum);
+    EXPECT_FALSE(Tank.HeaterOn1);
+    EXPECT_FALSE(Tank.HeaterOn2);
+    for (int i = 0; i < Tank.Nodes; ++i) {
+        EXPECT_NEAR(ExplicitTemps[i], Tank.Node[i].Temp, 0.02);
+    }
+    EXPECT_NEAR(ExplicitUseRate, Tank.UseRate, fabs(ExplicitUseRate) * 0.01);
+
+    // Over a ten minute step with the heaters on the change in stored energy matches the reported heat transfer
+    TimeStepZone = 10.0 / 60.0;
+    TimeStepSys = TimeStepZone;
+    Tank.SetPointTemp = 60.0;
+    Tank.SetPointTemp2 = Tank.SetPointTemp;
+
+    ResetTank();
+    for (int i = 0; i < Tank.Nodes; ++i) {
+        StartTemps[i] = Tank.Node[i].Temp;
+    }
+    int DummyIndex = 1;
+    const Real64 Cp = FluidProperties::GetSpecificHeatGlycol("WATER", Tank.TankTemp, DummyIndex, "StratifiedTankImplicitCalc");
+    WaterThermalTanks::CalcWaterThermalTankStratified(TankNum);
+
+    EXPECT_GT(Tank.HeaterRate, 0.0);
+    EXPECT_LT(Tank.UseRate, 0.0);
+    EXPECT_LT(Tank.LossRate, 0.0);
+    Real64 TankNodeEnergy = 0.0;
+    for (int i = 0; i < Tank.Nodes; ++i) {
+        TankNodeEnergy += Tank.Node[i].Mass * Cp * (Tank.Node[i].Temp - StartTemps[i]);
+    }
+    const Real64 SecInTimeStep = TimeStepSys * SecInHour;
+    const Real64 NetHeatInput = Tank.HeaterRate + Tank.UseRate + Tank.SourceRate + Tank.LossRate + Tank.VentRate;
+    EXPECT_NEAR(Tank.NetHeatTransferRate, NetHeatInput, 1.0e-6 * fabs(Tank.HeaterRate));
+    EXPECT_NEAR(NetHeatInput * SecInTimeStep, TankNodeEnergy, fabs(TankNodeEnergy) * 0.0001);
+
+    // No node is warmer than the node above it after the inversion mixing
+    for (int i = 0; i < Tank.Nodes - 1; ++i) {
+        EXPECT_GE(Tank.Node[i].Temp, Tank.Node[i + 1].Temp);
+    }
+}
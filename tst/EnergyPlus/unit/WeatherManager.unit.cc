@@ -50,16 +50,27 @@
 // Google Test Headers
 #include <gtest/gtest.h>
 
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/gio.hh>
 
 // EnergyPlus Headers
+#include <ConfiguredFunctions.hh>
 #include <DataEnvironment.hh>
 #include <DataGlobals.hh>
 #include <DataIPShortCuts.hh>
+#include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
+#include <ElectricPowerServiceManager.hh>
 #include <OutputReports.hh>
 #include <ScheduleManager.hh>
+#include <SimulationManager.hh>
 #include <SurfaceGeometry.hh>
 #include <WeatherManager.hh>
 
@@ -617,3 +628,171 @@ TEST_F(EnergyPlusFixture, ASHRAE_Tau2017ModelTest)
     EXPECT_EQ(expectedIDifH, DiffRad);
     EXPECT_EQ(expectedIGlbH, GloHorzRad);
 }
+
+namespace {
+// Interprets one weather data line into date, numeric fields and weather codes, in argument order
+std::vector<Real64> interpretTestWeatherLine(std::string &Line)
+{
+    bool ErrorFound(false);
+    Array1D_int Date(5);
+    Array1D<Real64> Fields(27);
+    int PresWeathObs(0);
+    Array1D_int PresWeathConds(9);
+    InterpretWeatherDataLine(Line, ErrorFound, Date(1), Date(2), Date(3), Date(4), Date(5), Fields(1), Fields(2), Fields(3), Fields(4), Fields(5),
+                             Fields(6), Fields(7), Fields(8), Fields(9), Fields(10), Fields(11), Fields(12), Fields(13), Fields(14), Fields(15),
+                             Fields(16), Fields(17), Fields(18), Fields(19), Fields(20), PresWeathObs, PresWeathConds, Fields(22), Fields(23),
+                             Fields(24), Fields(25), Fields(26), Fields(27));
+    EXPECT_FALSE(ErrorFound);
+    std::vector<Real64> Values(Date.begin(), Date.end());
+    Values.insert(Values.end(), Fields.begin(), Fields.end());
+    Values.push_back(PresWeathObs);
+    Values.insert(Values.end(), PresWeathConds.begin(), PresWeathConds.end());
+    return Values;
+}
+} // namespace
+
+TEST_F(EnergyPlusFixture, WeatherManager_WeatherRecordCache)
+{
+    DataStringGlobals::inputWeatherFileName = configured_source_directory() + "/weather/USA_IL_Chicago-OHare.Intl.AP.725300_TMY3.epw";
+    bool ErrorsFound(false);
+    std::string Line;
+    int ReadStatus(0);
+
+    // Reference records read and parsed straight from the weather file
+    std::vector<std::vector<Real64>> Expected;
+    OpenEPlusWeatherFile(ErrorsFound, false);
+    for (int Record = 1; Record <= 3; ++Record) {
+        ReadWeatherDataLine(Line, ReadStatus);
+        ASSERT_EQ(0, ReadStatus);
+        Expected.push_back(interpretTestWeatherLine(Line));
+    }
+    CloseWeatherFile();
+
+    std::ifstream ifs(DataStringGlobals::inputWeatherFileName, std::ios::binary);
+    std::string const WeatherFileText((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    DataSystemVariables::WeatherCacheDirectory = ".";
+    std::string const CacheFileName(WeatherRecordCacheFileName(WeatherFileHash(WeatherFileText)));
+    std::remove(CacheFileName.c_str());
+
+    // The first pass parses the records through the cache, a rewind reuses them
+    OpenEPlusWeatherFile(ErrorsFound, false);
+    for (int Pass = 1; Pass <= 2; ++Pass) {
+        for (int Record = 1; Record <= 3; ++Record) {
+            ReadWeatherDataLine(Line, ReadStatus);
+            ASSERT_EQ(0, ReadStatus);
+            EXPECT_EQ(Expected[Record - 1], interpretTestWeatherLine(Line));
+        }
+        RewindWeatherDataRecords();
+    }
+    ReadWeatherDataLine(Line, ReadStatus);
+    BackspaceWeatherDataRecord();
+    std::string const FirstLine(Line);
+    ReadWeatherDataLine(Line, ReadStatus);
+    EXPECT_EQ(FirstLine, Line);
+    CloseWeatherFile();
+    EXPECT_TRUE(ObjexxFCL::gio::file_exists(CacheFileName));
+
+    // A later run loads the parsed records from the cache file; a restored record leaves the line as it was read
+    WeatherManager::clear_state();
+    OpenEPlusWeatherFile(ErrorsFound, false);
+    ReadWeatherDataLine(Line, ReadStatus);
+    std::string const ReadLine(Line);
+    EXPECT_EQ(Expected[0], interpretTestWeatherLine(Line));
+    EXPECT_EQ(ReadLine, Line);
+    CloseWeatherFile();
+
+    DataSystemVariables::WeatherCacheDirectory.clear();
+    std::remove(CacheFileName.c_str());
+    EXPECT_FALSE(ErrorsFound);
+}
+
+TEST_F(EnergyPlusFixture, WeatherManager_TimeStepWeatherTable)
+{
+    std::string const idf_objects = delimited_string({
+        "Timestep,4;",
+        "SimulationControl, No, No, No, Yes, No;",
+        "Site:Location,",
+        "  CHICAGO_IL_USA TMY2-94846,  !- Name",
+        "  41.78,                   !- Latitude {deg}",
+        "  -87.75,                  !- Longitude {deg}",
+        "  -6.00,                   !- Time Zone {hr}",
+        "  190.00;                  !- Elevation {m}",
+        "SizingPeriod:DesignDay,",
+        "  CHICAGO_IL_USA Annual Cooling 1% Design Conditions DB/MCWB,  !- Name",
+        "  7,                       !- Month",
+        "  21,                      !- Day of Month",
+        "  SummerDesignDay,         !- Day Type",
+        "  31.5,                    !- Maximum Dry-Bulb Temperature {C}",
+        "  10.7,                    !- Daily Dry-Bulb Temperature Range {deltaC}",
+        "  ,                        !- Dry-Bulb Temperature Range Modifier Type",
+        "  ,                        !- Dry-Bulb Temperature Range Modifier Day Schedule Name",
+        "  Wetbulb,                 !- Humidity Condition Type",
+        "  23.0,                    !- Wetbulb or DewPoint at Maximum Dry-Bulb {C}",
+        "  ,                        !- Humidity Condition Day Schedule Name",
+        "  ,                        !- Humidity Ratio at Maximum Dry-Bulb {kgWater/kgDryAir}",
+        "  ,                        !- Enthalpy at Maximum Dry-Bulb {J/kg}",
+        "  ,                        !- Daily Wet-Bulb Temperature Range {deltaC}",
+        "  99063.,                  !- Barometric Pressure {Pa}",
+        "  5.3,                     !- Wind Speed {m/s}",
+        "  230,                     !- Wind Direction {deg}",
+        "  No,                      !- Rain Indicator",
+        "  No,                      !- Snow Indicator",
+        "  No,                      !- Daylight Saving Time Indicator",
+        "  ASHRAEClearSky,          !- Solar Model Indicator",
+        "  ,                        !- Beam Solar Day Schedule Name",
+        "  ,                        !- Diffuse Solar Day Schedule Name",
+        "  ,                        !- ASHRAE Clear Sky Optical Depth for Beam Irradiance (taub) {dimensionless}",
+        "  ,                        !- ASHRAE Clear Sky Optical Depth for Diffuse Irradiance (taud) {dimensionless}",
+        "  1.0;                     !- Sky Clearness",
+    });
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    DataGlobals::BeginSimFlag = true;
+    SimulationManager::GetProjectData();
+    createFacilityElectricPowerServiceObject();
+    bool ErrorsFound(false);
+    SimulationManager::SetupSimulation(ErrorsFound);
+    ASSERT_FALSE(ErrorsFound);
+
+    // Afternoon of the design day: the first call fills in the time step, the repeat restores it
+    WeatherManager::Envrn = 1;
+    DataGlobals::HourOfDay = 14;
+    DataGlobals::TimeStep = 2;
+    UpdateWeatherData();
+    SetCurrentWeather();
+    EXPECT_TRUE(DataEnvironment::SunIsUp);
+    Real64 const WetBulb(DataEnvironment::OutWetBulbTemp);
+    Real64 const Density(DataEnvironment::OutAirDensity);
+    Real64 const CosZenith(DataEnvironment::SOLCOS(3));
+    Real64 const SkyIllum(DataEnvironment::HISKF);
+    Real64 const Azimuth(SolarAzimuthAngle);
+
+    DataEnvironment::OutWetBulbTemp = 0.0;
+    DataEnvironment::OutAirDensity = 0.0;
+    DataEnvironment::SOLCOS = 0.0;
+    DataEnvironment::HISKF = 0.0;
+    SolarAzimuthAngle = 0.0;
+    UpdateWeatherData(); // next warmup day with the same weather
+    SetCurrentWeather();
+    EXPECT_EQ(WetBulb, DataEnvironment::OutWetBulbTemp);
+    EXPECT_EQ(Density, DataEnvironment::OutAirDensity);
+    EXPECT_EQ(CosZenith, DataEnvironment::SOLCOS(3));
+    EXPECT_EQ(SkyIllum, DataEnvironment::HISKF);
+    EXPECT_EQ(Azimuth, SolarAzimuthAngle);
+
+    // An EMS override of the dry bulb is not hidden by the table
+    DataEnvironment::EMSOutDryBulbOverrideOn = true;
+    DataEnvironment::EMSOutDryBulbOverrideValue = DataEnvironment::OutDryBulbTemp + 5.0;
+    SetCurrentWeather();
+    EXPECT_GT(DataEnvironment::OutWetBulbTemp, WetBulb);
+    DataEnvironment::EMSOutDryBulbOverrideOn = false;
+    SetCurrentWeather();
+    EXPECT_EQ(WetBulb, DataEnvironment::OutWetBulbTemp);
+
+    // A different weather day starts the table over
+    TomorrowOutDryBulbTemp(2, 14) += 5.0;
+    UpdateWeatherData();
+    SetCurrentWeather();
+    EXPECT_GT(DataEnvironment::OutWetBulbTemp, WetBulb);
+    EXPECT_EQ(CosZenith, DataEnvironment::SOLCOS(3));
+}
@@ -0,0 +1,321 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::WindowComplexManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/DataBSDFWindow.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataShadowingCombinations.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/WindowComplexManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataBSDFWindow;
+using namespace EnergyPlus::DataHeatBalance;
+using namespace EnergyPlus::WindowComplexManager;
+
+namespace {
+
+// A two layer BSDF construction on a small basis of NBasis elements, with distinct values in every matrix
+void setupBSDFConstruction(int const NBasis, BSDFGeomDescr &Geom)
+{
+    TotConstructs = 1;
+    Construct.allocate(1);
+    auto &Input(Construct(1).BSDFInput);
+    Input.NBasis = NBasis;
+    Input.SolFrtTrans.allocate(NBasis, NBasis);
+    Input.SolBkRefl.allocate(NBasis, NBasis);
+    Input.VisFrtTrans.allocate(NBasis, NBasis);
+    Input.VisBkRefl.allocate(NBasis, NBasis);
+    for (int I = 1; I <= NBasis; ++I) {
+        for (int J = 1; J <= NBasis; ++J) {
+            Input.SolFrtTrans(I, J) = (I == J ? 2.1 : 0.0) + 0.013 * I + 0.007 * J;
+            Input.SolBkRefl(I, J) = 0.011 * I + 0.017 * J + 0.001 * I * J;
+            Input.VisFrtTrans(I, J) = (I == J ? 2.3 : 0.0) + 0.009 * I + 0.005 * J;
+            Input.VisBkRefl(I, J) = 0.012 * I + 0.003 * J;
+        }
+    }
+    Input.NumLayers = 2;
+    Input.Layer.allocate(2);
+    for (int L = 1; L <= 2; ++L) {
+        Input.Layer(L).FrtAbs.allocate(NBasis, 1);
+        Input.Layer(L).BkAbs.allocate(NBasis, 1);
+        for (int J = 1; J <= NBasis; ++J) {
+            Input.Layer(L).FrtAbs(J, 1) = 0.05 * L + 0.01 * J;
+            Input.Layer(L).BkAbs(J, 1) = 0.03 * L + 0.02 * J;
+        }
+    }
+
+    Geom.Inc.NBasis = NBasis;
+    Geom.Inc.Lamda.allocate(NBasis);
+    for (int J = 1; J <= NBasis; ++J) {
+        Geom.Inc.Lamda(J) = 0.4 / J + 0.05 * J;
+    }
+    Geom.Trn = Geom.Inc;
+}
+
+} // namespace
+
+TEST_F(EnergyPlusFixture, WindowComplexManager_ConstructionStaticProperties)
+{
+    int const NBasis = 5;
+    BSDFGeomDescr Geom;
+    setupBSDFConstruction(NBasis, Geom);
+    auto const &Input(Construct(1).BSDFInput);
+
+    BSDFStateDescr First;
+    First.NLayers = 2;
+    CalcConstructionStaticProperties(1, Geom, First);
+
+    // Against the per-window calculation the construction properties were split out of
+    Real64 Sum1 = 0.0;
+    Real64 Sum2 = 0.0;
+    for (int J = 1; J <= NBasis; ++J) {
+        Sum2 += Geom.Inc.Lamda(J);
+        for (int M = 1; M <= NBasis; ++M) {
+            Sum1 += Geom.Inc.Lamda(J) * Geom.Trn.Lamda(M) * Input.SolFrtTrans(M, J);
+        }
+    }
+    EXPECT_EQ(Sum1 / Sum2, First.WinDiffTrans);
+
+    Sum1 = 0.0;
+    for (int J = 1; J <= NBasis; ++J) {
+        for (int M = 1; M <= NBasis; ++M) {
+            Sum1 += Geom.Inc.Lamda(J) * Geom.Trn.Lamda(M) * Input.VisFrtTrans(M, J);
+        }
+    }
+    EXPECT_EQ(Sum1 / Sum2, First.WinDiffVisTrans);
+
+    Sum1 = 0.0;
+    Real64 Sum3 = 0.0;
+    for (int J = 1; J <= NBasis; ++J) {
+        for (int M = 1; M <= NBasis; ++M) {
+            Sum1 += Input.SolBkRefl(M, J) * Geom.Trn.Lamda(J) * Geom.Inc.Lamda(M);
+        }
+    }
+    EXPECT_EQ(Sum1 / Sum2, First.WinBkHemRefl);
+    EXPECT_EQ(First.WinBkHemRefl, Construct(1).ReflectSolDiffBack);
+    for (int L = 1; L <= 2; ++L) {
+        for (int J = 1; J <= NBasis; ++J) {
+            Sum3 += Geom.Trn.Lamda(J) * Input.Layer(L).BkAbs(J, 1);
+        }
+        EXPECT_EQ(Sum3 / Sum2, First.WinBkHemAbs(L));
+        EXPECT_EQ(First.WinBkHemAbs(L), Construct(1).AbsDiffBack(L));
+
+        Sum1 = 0.0;
+        for (int J = 1; J <= NBasis; ++J) {
+            Sum1 += Geom.Inc.Lamda(J) * Input.Layer(L).FrtAbs(J, 1);
+        }
+        EXPECT_EQ(Sum1 / Sum2, First.WinFtHemAbs(L));
+        EXPECT_EQ(First.WinFtHemAbs(L), Construct(1).AbsDiff(L));
+    }
+
+    Sum1 = 0.0;
+    for (int J = 1; J <= NBasis; ++J) {
+        for (int M = 1; M <= NBasis; ++M) {
+            Sum1 += Input.VisBkRefl(M, J) * Geom.Trn.Lamda(J) * Geom.Inc.Lamda(M);
+        }
+    }
+    EXPECT_EQ(Sum1 / Sum2, First.WinBkHemVisRefl);
+
+    for (int J = 1; J <= NBasis; ++J) {
+        Real64 FtAbs = 0.0;
+        Real64 BkAbs = 0.0;
+        Real64 FtTrans = 0.0;
+        Real64 BkRefl = 0.0;
+        for (int L = 1; L <= 2; ++L) {
+            FtAbs += Input.Layer(L).FrtAbs(J, 1);
+            BkAbs += Input.Layer(L).BkAbs(J, 1);
+        }
+        for (int M = 1; M <= NBasis; ++M) {
+            FtTrans += Geom.Trn.Lamda(J) * Input.SolFrtTrans(J, M);
+            BkRefl += Geom.Inc.Lamda(J) * Input.SolBkRefl(J, M);
+        }
+        EXPECT_EQ(FtAbs, First.IntegratedFtAbs(J));
+        EXPECT_EQ(FtTrans, First.IntegratedFtTrans(J));
+        EXPECT_EQ(1 - FtTrans - FtAbs, First.IntegratedFtRefl(J));
+        EXPECT_EQ(BkAbs, First.IntegratedBkAbs(J));
+        EXPECT_EQ(BkRefl, First.IntegratedBkRefl(J));
+        EXPECT_EQ(1 - BkRefl - BkAbs, First.IntegratedBkTrans(J));
+    }
+
+    // A second state on the same construction gets the same properties, so copying the first state's is exact
+    BSDFStateDescr Second;
+    Second.NLayers = 2;
+    CalcConstructionStaticProperties(1, Geom, Second);
+    EXPECT_EQ(First.WinDiffTrans, Second.WinDiffTrans);
+    EXPECT_EQ(First.WinDiffVisTrans, Second.WinDiffVisTrans);
+    EXPECT_EQ(First.WinBkHemRefl, Second.WinBkHemRefl);
+    EXPECT_EQ(First.WinBkHemVisRefl, Second.WinBkHemVisRefl);
+    for (int L = 1; L <= 2; ++L) {
+        EXPECT_EQ(First.WinBkHemAbs(L), Second.WinBkHemAbs(L));
+        EXPECT_EQ(First.WinFtHemAbs(L), Second.WinFtHemAbs(L));
+    }
+    for (int J = 1; J <= NBasis; ++J) {
+        EXPECT_EQ(First.IntegratedFtTrans(J), Second.IntegratedFtTrans(J));
+        EXPECT_EQ(First.IntegratedFtRefl(J), Second.IntegratedFtRefl(J));
+        EXPECT_EQ(First.IntegratedBkRefl(J), Second.IntegratedBkRefl(J));
+        EXPECT_EQ(First.IntegratedBkTrans(J), Second.IntegratedBkTrans(J));
+    }
+}
+
+TEST_F(EnergyPlusFixture, WindowComplexManager_BackSurfaceHourlyDataOnlyForWindows)
+{
+    // Complex window 1 on wall 2, seeing a floor, a window, a glass door and another wall through the zone
+    DataGlobals::NumOfTimeStepInHour = 4;
+    DataSurfaces::TotSurfaces = 6;
+    DataSurfaces::Surface.allocate(6);
+    DataSurfaces::SurfaceWindow.allocate(6);
+    DataSurfaces::Surface(1).Class = DataSurfaces::SurfaceClass_Window;
+    DataSurfaces::Surface(1).BaseSurf = 2;
+    DataSurfaces::Surface(2).Class = DataSurfaces::SurfaceClass_Wall;
+    DataSurfaces::Surface(3).Class = DataSurfaces::SurfaceClass_Floor;
+    DataSurfaces::Surface(4).Class = DataSurfaces::SurfaceClass_Window;
+    DataSurfaces::Surface(5).Class = DataSurfaces::SurfaceClass_GlassDoor;
+    DataSurfaces::Surface(6).Class = DataSurfaces::SurfaceClass_Wall;
+
+    DataShadowingCombinations::ShadowComb.allocate(6);
+    DataShadowingCombinations::ShadowComb(2).NumBackSurf = 4;
+    DataShadowingCombinations::ShadowComb(2).BackSurf.allocate({0, 4});
+    for (int KBkSurf = 1; KBkSurf <= 4; ++KBkSurf) {
+        DataShadowingCombinations::ShadowComb(2).BackSurf(KBkSurf) = KBkSurf + 2;
+    }
+
+    ComplexWind.allocate(6);
+    ComplexWind(1).NBkSurf = 4;
+    ComplexWind(1).Geom.allocate(1);
+    ComplexWind(1).Geom(1).NGnd = 3;
+    DataSurfaces::SurfaceWindow(1).ComplexFen.State.allocate(1);
+    DataSurfaces::SurfaceWindow(1).ComplexFen.State(1).NLayers = 2;
+
+    AllocateCFSStateHourlyData(1, 1);
+
+    auto const &State(DataSurfaces::SurfaceWindow(1).ComplexFen.State(1));
+    ASSERT_EQ(4u, State.BkSurf.size());
+    EXPECT_FALSE(allocated(State.BkSurf(1).WinDHBkRefl)); // floor
+    EXPECT_FALSE(allocated(State.BkSurf(1).WinDirBkAbs));
+    EXPECT_EQ(24u * 4u, State.BkSurf(2).WinDHBkRefl.size()); // window
+    EXPECT_EQ(24u * 4u * 2u, State.BkSurf(2).WinDirBkAbs.size());
+    EXPECT_TRUE(allocated(State.BkSurf(3).WinDHBkRefl)); // glass door
+    EXPECT_TRUE(allocated(State.BkSurf(3).WinDirBkAbs));
+    EXPECT_FALSE(allocated(State.BkSurf(4).WinDHBkRefl)); // wall
+    EXPECT_EQ(24u * 4u * 4u, State.WinToSurfBmTrans.size());
+}
+
+TEST_F(EnergyPlusFixture, WindowComplexManager_DirectionalHemisphericalProperties)
+{
+    int const NBasis = 7;
+    BSDFGeomDescr Geom;
+    setupBSDFConstruction(NBasis, Geom);
+    auto const &Input(Construct(1).BSDFInput);
+
+    BSDFStateDescr State;
+    State.NLayers = 2;
+    CalcConstructionStaticProperties(1, Geom, State);
+
+    // Matrix-vector products against the loops over the outgoing basis they replaced (summation order differs)
+    ASSERT_EQ(static_cast<std::size_t>(NBasis), Input.SolFrtTransHemi.size());
+    ASSERT_EQ(static_cast<std::size_t>(NBasis), Input.SolBkReflHemi.size());
+    for (int IBm = 1; IBm <= NBasis; ++IBm) {
+        Real64 FrtTrans = 0.0;
+        Real64 BkRefl = 0.0;
+        for (int J = 1; J <= NBasis; ++J) {
+            FrtTrans += Geom.Trn.Lamda(J) * Input.SolFrtTrans(IBm, J);
+            BkRefl += Geom.Trn.Lamda(J) * Input.SolBkRefl(IBm, J);
+        }
+        EXPECT_NEAR(FrtTrans, Input.SolFrtTransHemi(IBm), 1.0e-14 * FrtTrans);
+        EXPECT_NEAR(BkRefl, Input.SolBkReflHemi(IBm), 1.0e-14 * BkRefl);
+    }
+}
+
+TEST_F(EnergyPlusFixture, WindowComplexManager_TARCOGSolutionMemo)
+{
+    int const nlayer = 2;
+    Array1D<Real64> Inputs(14 + nlayer);
+    for (int k = 1; k <= Inputs.isize(); ++k) {
+        Inputs(k) = 10.0 * k;
+    }
+    Array1D<Real64> theta(2 * nlayer, {280.0, 285.0, 290.0, 293.0});
+    Array1D<Real64> qv(nlayer + 1, {0.0, 1.5, 0.0});
+
+    TARCOGMemoStruct Memo;
+    Array1D<Real64> thetaOut(2 * nlayer, 0.0);
+    Array1D<Real64> qvOut(nlayer + 1, 0.0);
+    Real64 hcin(0.0);
+    Real64 ufactor(0.0);
+    EXPECT_FALSE(RecallTARCOGSolution(Memo, Inputs, nlayer, thetaOut, qvOut, hcin, ufactor));
+
+    StoreTARCOGSolution(Memo, Inputs, nlayer, theta, qv, 3.2, 1.9);
+
+    // Repeated inputs, and inputs within the relative tolerance, return the stored solution
+    Array1D<Real64> Repeated(Inputs);
+    Repeated(3) *= 1.0 + 1.0e-8;
+    ASSERT_TRUE(RecallTARCOGSolution(Memo, Repeated, nlayer, thetaOut, qvOut, hcin, ufactor));
+    for (int k = 1; k <= 2 * nlayer; ++k) {
+        EXPECT_EQ(theta(k), thetaOut(k));
+    }
+    for (int k = 1; k <= nlayer + 1; ++k) {
+        EXPECT_EQ(qv(k), qvOut(k));
+    }
+    EXPECT_EQ(3.2, hcin);
+    EXPECT_EQ(1.9, ufactor);
+
+    // Any input changing beyond it, or a different number of layers, needs a new TARCOG solution
+    for (int k = 1; k <= Inputs.isize(); ++k) {
+        Array1D<Real64> Changed(Inputs);
+        Changed(k) += 1.0e-3 * Inputs(k);
+        EXPECT_FALSE(RecallTARCOGSolution(Memo, Changed, nlayer, thetaOut, qvOut, hcin, ufactor));
+    }
+    Array1D<Real64> MoreLayers(Inputs.isize() + 1, 0.0);
+    EXPECT_FALSE(RecallTARCOGSolution(Memo, MoreLayers, nlayer + 1, thetaOut, qvOut, hcin, ufactor));
+}
@@ -915,3 +915,180 @@ TEST_F(EnergyPlusFixture, WindowEquivalentLayer_VBBlockBeamSolar)
     Real64 SlateAngleBlockBeamSolar = VB_CriticalSlatAngle(DataGlobals::RadToDeg * ProfAngVer);
     EXPECT_NEAR(SlateAngleBlockBeamSolar, DataSurfaces::SurfaceWindow(SurfNum).SlatAngThisTSDeg, 0.0001);
 }
+
+TEST_F(EnergyPlusFixture, WindowEquivalentLayer_ThermalWarmStart)
+{
+    bool ErrorsFound(false);
+
+    std::string const idf_objects = delimited_string({
+        "Version,9.2;",
+
+        "  Construction:WindowEquivalentLayer,",
+        "  CLR CLR VB,                !- Name",
+        "  GLZCLR,                    !- Outside Layer",
+        "  Air GAP SealedOut 20mm,    !- Layer 2",
+        "  GLZCLR,                    !- Layer 3",
+        "  Air GAP SealedIndoor 20mm, !- Layer 4",
+        "  VBU8D6+45SW1;              !- Layer 5",
+
+        "WindowMaterial:Glazing:EquivalentLayer,",
+        "  GLZCLR,                    !-  Name",
+        "  SpectralAverage,           !-  Optical Data Type",
+        "  ,                          !-  Window Glass Spectral Data Set Name",
+        "  0.83,                      !-  Front Side Beam-Beam Solar Transmittance",
+        "  0.83,                      !-  Back Side Beam-Beam Solar Transmittance",
+        "  0.08,                      !-  Front Side Beam-Beam Solar Reflectance",
+        "  0.08,                      !-  Back Side Beam-Beam Solar Reflectance",
+        "  0.0,                       !-  Front Side Beam-Beam Visible Transmittance",
+        "  0.0,                       !-  Back Side Beam-Beam Visible Transmittance",
+        "  0.0,                       !-  Front Side Beam-Beam Visible Reflectance",
+        "  0.0,                       !-  Back Side Beam-Beam Visible Reflectance",
+        "  0.0,                       !-  Front Side Beam-Diffuse Solar Transmittance",
+        "  0.0,                       !-  Back Side Beam-Diffuse Solar Transmittance",
+        "  0.0,                       !-  Front Side Beam-Diffuse Solar Reflectance",
+        "  0.0,                       !-  Back Side Beam-Diffuse Solar Reflectance",
+        "  0.0,                       !-  Front Side Beam-Diffuse Visible Transmittance",
+        "  0.0,                       !-  Back Side Beam-Diffuse Visible Transmittance",
+        "  0.0,                       !-  Front Side Beam-Diffuse Visible Reflectance",
+        "  0.0,                       !-  Back Side Beam-Diffuse Visible Reflectance",
+        "  0.76,                      !-  Diffuse-Diffuse Solar Transmittance",
+        "  0.14,                      !-  Front Side Diffuse-Diffuse Solar Reflectance",
+        "  0.14,                      !-  Back Side Diffuse-Diffuse Solar Reflectance",
+        "  0.0,                       !-  Diffuse-Diffuse Visible Transmittance",
+        "  0.0,                       !-  Front Side Diffuse-Diffuse Visible Reflectance",
+        "  0.0,                       !-  Back Side Diffuse-Diffuse Visible Reflectance",
+        "  0.0,                       !-  Infrared Transmittance (front and back)",
+        "  0.84,                      !-  Front Side Infrared Emissivity",
+        "  0.84;                      !-  Back Side Infrared Emissivity",
+
+        "WindowMaterial:Blind:EquivalentLayer,",
+        "  VBU8D6+45SW1,           ! - Name",
+        "  Horizontal,             ! - Slat Orientation",
+        "  0.025,                  ! - Slat Width",
+        "  0.025,                  ! - Slat Separation",
+        "  0.0,                    ! - Slat Crown",
+        "  45.0,                   ! - Slat Angle",
+        "  0.0,                    ! - Front Side Slat Beam-Diffuse Solar Transmittance",
+        "  0.0,                    ! - Back Side Slat Beam-Diffuse Solar Transmittance",
+        "  0.0,                    ! - Front Side Slat Beam-Diffuse Solar Reflectance",
+        "  0.0,                    ! - Back Side Slat Beam-Diffuse Solar Reflectance",
+        "  0.0,                    ! - Front Side Slat Beam-Diffuse Visible Solar Transmittance",
+        "  0.0,                    ! - Back Side Slat Beam-Diffuse Visible Solar Transmittance",
+        "  0.0,                    ! - Front Side Slat Beam-Diffuse Visible Solar Reflectance",
+        "  0.0,                    ! - Back Side Slat Beam-Diffuse Visible Solar Reflectance",
+        "  0.0,                    ! - Slat Diffuse-Diffuse Solar Transmittance",
+        "  0.80,                   ! - Front Side Slat Diffuse-Diffuse Solar Reflectance",
+        "  0.60,                   ! - Back Side Slat Diffuse-Diffuse Solar Reflectance",
+        "  0.0,                    ! - Slat Diffuse-Diffuse Visible Transmittance",
+        "  0.0,                    ! - Front Side Slat Diffuse-Diffuse Visible Reflectance",
+        "  0.0,                    ! - Back Side Slat Diffuse-Diffuse Visible Reflectance",
+        "  0.0,                    ! - Slat Infrared Transmittance",
+        "  0.90,                   ! - Front Side Slat Infrared Emissivity",
+        "  0.90,                   ! - Back Side Slat Infrared Emissivity",
+        "  BlockBeamSolar;         ! - Slat Angle Control",
+
+        " WindowMaterial:Gap:EquivalentLayer,",
+        "  Air GAP SealedOut 20mm,    !- Name",
+        "  Air,                       !- Gas Type",
+        "  0.0200,                    !- Thickness",
+        "  Sealed;                    !- Gap Vent Type",
+
+        " WindowMaterial:Gap:EquivalentLayer,",
+        "  Air GAP SealedIndoor 20mm, !- Name",
+        "  Air,                       !- Gas Type",
+        "  0.020,                     !- Thickness",
+        "  Sealed;                    !- Gap Vent Type ",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    HeatBalanceManager::GetMaterialData(ErrorsFound);
+    HeatBalanceManager::GetConstructData(ErrorsFound);
+    InitEquivalentLayerWindowCalculations();
+    int const EQLNum = DataHeatBalance::Construct(1).EQLConsPtr;
+    int const NL = CFS(EQLNum).NL;
+
+    using DataWindowEquivalentLayer::CFSMAXNL;
+    Real64 const TIN(294.15);
+    Real64 const TOUT(268.15);
+    Real64 const TOL(0.0001);
+    Array1D<Real64> Source({1, CFSMAXNL + 1}, 0.0);
+    Source(1) = 40.0;
+    Source(3) = 15.0;
+    Source(NL) = 60.0;
+
+    Array1D<Real64> QOCF(CFSMAXNL);
+    Real64 QOCFRoom(0.0);
+    Array1D<Real64> Q({0, CFSMAXNL});
+    Array1D<Real64> JF({1, CFSMAXNL + 1});
+    Array1D<Real64> JB({0, CFSMAXNL});
+    Array1D<Real64> H({0, CFSMAXNL + 1});
+    Real64 UCG(0.0);
+    Real64 SHGC(0.0);
+
+    // Cold start: layer temperatures interpolated between outdoor and indoor air
+    Array1D<Real64> TCold(CFSMAXNL, 0.0);
+    ASSERT_TRUE(ASHWAT_Thermal(
+        CFS(EQLNum), TIN, TOUT, 3.0, 20.0, TOUT, TIN, 0.0, Source({1, NL + 1}), TOL, QOCF, QOCFRoom, TCold, Q, JF, JB, H, UCG, SHGC));
+    Real64 const UCGCold = UCG;
+
+    // An estimate of zeros (a window not solved yet) is the cold start
+    Array1D<Real64> TInit(CFSMAXNL, 0.0);
+    Array1D<Real64> T(CFSMAXNL, 0.0);
+    ASSERT_TRUE(ASHWAT_Thermal(CFS(EQLNum),
+                               TIN,
+                               TOUT,
+                               3.0,
+                               20.0,
+                               TOUT,
+                               TIN,
+                               0.0,
+                               Source({1, NL + 1}),
+                               TOL,
+                               QOCF,
+                               QOCFRoom,
+                               T,
+                               Q,
+                               JF,
+                               JB,
+                               H,
+                               UCG,
+                               SHGC,
+                               _,
+                               TInit({1, CFSMAXNL})));
+    for (int Lay = 1; Lay <= NL; ++Lay) {
+        EXPECT_EQ(TCold(Lay), T(Lay));
+    }
+
+    // Warm starts from the previous solution, or from a nearby one, converge to it within the solver tolerance
+    for (Real64 const Offset : {0.0, 1.5}) {
+        for (int Lay = 1; Lay <= NL; ++Lay) {
+            TInit(Lay) = TCold(Lay) + Offset;
+        }
+        ASSERT_TRUE(ASHWAT_Thermal(CFS(EQLNum),
+                                   TIN,
+                                   TOUT,
+                                   3.0,
+                                   20.0,
+                                   TOUT,
+                                   TIN,
+                                   0.0,
+                                   Source({1, NL + 1}),
+                                   TOL,
+                                   QOCF,
+                                   QOCFRoom,
+                                   T,
+                                   Q,
+                                   JF,
+                                   JB,
+                                   H,
+                                   UCG,
+                                   SHGC,
+                                   _,
+                                   TInit({1, CFSMAXNL})));
+        for (int Lay = 1; Lay <= NL; ++Lay) {
+            EXPECT_NEAR(TCold(Lay), T(Lay), 0.05);
+        }
+        EXPECT_NEAR(UCGCold, UCG, 0.01);
+    }
+}
@@ -49,6 +49,7 @@
 
 // C++ Headers
 #include <iostream>
+#include <limits>
 
 // Google Test Headers
 #include <gtest/gtest.h>
@@ -66,6 +67,7 @@
 #include <DataHeatBalance.hh>
 #include <DataIPShortCuts.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <ElectricPowerServiceManager.hh>
 #include <EnergyPlus/DataLoopNode.hh>
 #include <EnergyPlus/DataZoneEquipment.hh>
@@ -77,6 +79,7 @@
 #include <Psychrometrics.hh>
 #include <ScheduleManager.hh>
 #include <SolarShading.hh>
+#include <UtilityRoutines.hh>
 #include <WindowManager.hh>
 
 #include "Fixtures/EnergyPlusFixture.hh"
@@ -579,6 +582,282 @@ TEST_F(EnergyPlusFixture, WindowManager_RefAirTempTest)
     EXPECT_NEAR(25.0, DataHeatBalance::TempEffBulkAir(2), 0.0001);
 }
 
+TEST_F(EnergyPlusFixture, WindowManager_NewtonSolveMatchesRelaxedIteration)
+{
+    bool ErrorsFound(false);
+
+    std::string const idf_objects =
+        delimited_string({"Material,",
+                          "  Concrete Block,          !- Name",
+                          "  MediumRough,             !- Roughness",
+                          "  0.1014984,               !- Thickness {m}",
+                          "  0.3805070,               !- Conductivity {W/m-K}",
+                          "  608.7016,                !- Density {kg/m3}",
+                          "  836.8000;                !- Specific Heat {J/kg-K}",
+                          "Construction,",
+                          "  WallConstruction,        !- Name",
+                          "  Concrete Block;          !- Outside Layer",
+                          "WindowMaterial:Glazing,",
+                          "  Clear 3mm,               !- Name",
+                          "  SpectralAverage,         !- Optical Data Type",
+                          "  ,                        !- Window Glass Spectral Data Set Name",
+                          "  0.003,                   !- Thickness {m}",
+                          "  0.837,                   !- Solar Transmittance at Normal Incidence",
+                          "  0.075,                   !- Front Side Solar Reflectance at Normal Incidence",
+                          "  0.075,                   !- Back Side Solar Reflectance at Normal Incidence",
+                          "  0.898,                   !- Visible Transmittance at Normal Incidence",
+                          "  0.081,                   !- Front Side Visible Reflectance at Normal Incidence",
+                          "  0.081,                   !- Back Side Visible Reflectance at Normal Incidence",
+                          "  0,                       !- Infrared Transmittance at Normal Incidence",
+                          "  0.84,                    !- Front Side Infrared Hemispherical Emissivity",
+                          "  0.84,                    !- Back Side Infrared Hemispherical Emissivity",
+                          "  0.9;                     !- Conductivity {W/m-K}",
+                          "WindowMaterial:Glazing,",
+                          "  LoE 3mm,                 !- Name",
+                          "  SpectralAverage,         !- Optical Data Type",
+                          "  ,                        !- Window Glass Spectral Data Set Name",
+                          "  0.003,                   !- Thickness {m}",
+                          "  0.630,                   !- Solar Transmittance at Normal Incidence",
+                          "  0.190,                   !- Front Side Solar Reflectance at Normal Incidence",
+                          "  0.220,                   !- Back Side Solar Reflectance at Normal Incidence",
+                          "  0.850,                   !- Visible Transmittance at Normal Incidence",
+                          "  0.056,                   !- Front Side Visible Reflectance at Normal Incidence",
+                          "  0.079,                   !- Back Side Visible Reflectance at Normal Incidence",
+                          "  0,                       !- Infrared Transmittance at Normal Incidence",
+                          "  0.10,                    !- Front Side Infrared Hemispherical Emissivity",
+                          "  0.84,                    !- Back Side Infrared Hemispherical Emissivity",
+                          "  0.9;                     !- Conductivity {W/m-K}",
+                          "WindowMaterial:Gas,",
+                          "  Air 13mm,                !- Name",
+                          "  Air,                     !- Gas Type",
+                          "  0.0127;                  !- Thickness {m}",
+                          "Construction,",
+                          "  DoubleConstruction,      !- Name",
+                          "  Clear 3mm,               !- Outside Layer",
+                          "  Air 13mm,                !- Layer 2",
+                          "  LoE 3mm;                 !- Layer 3",
+                          "Construction,",
+                          "  TripleConstruction,      !- Name",
+                          "  Clear 3mm,               !- Outside Layer",
+                          "  Air 13mm,                !- Layer 2",
+                          "  Clear 3mm,               !- Layer 3",
+                          "  Air 13mm,                !- Layer 4",
+                          "  LoE 3mm;                 !- Layer 5",
+                          "FenestrationSurface:Detailed,",
+                          "  DoubleWindow,            !- Name",
+                          "  Window,                  !- Surface Type",
+                          "  DoubleConstruction,      !- Construction Name",
+                          "  Wall,                    !- Building Surface Name",
+                          "  ,                        !- Outside Boundary Condition Object",
+                          "  0.5000000,               !- View Factor to Ground",
+                          "  ,                        !- Frame and Divider Name",
+                          "  1.0,                     !- Multiplier",
+                          "  4,                       !- Number of Vertices",
+                          "  0.200000,0.000000,9.900000,  !- X,Y,Z ==> Vertex 1 {m}",
+                          "  0.200000,0.000000,0.1000000,  !- X,Y,Z ==> Vertex 2 {m}",
+                          "  4.900000,0.000000,0.1000000,  !- X,Y,Z ==> Vertex 3 {m}",
+                          "  4.900000,0.000000,9.900000;  !- X,Y,Z ==> Vertex 4 {m}",
+                          "FenestrationSurface:Detailed,",
+                          "  TripleWindow,            !- Name",
+                          "  Window,                  !- Surface Type",
+                          "  TripleConstruction,      !- Construction Name",
+                          "  Wall,                    !- Building Surface Name",
+                          "  ,                        !- Outside Boundary Condition Object",
+                          "  0.5000000,               !- View Factor to Ground",
+                          "  ,                        !- Frame and Divider Name",
+                          "  1.0,                     !- Multiplier",
+                          "  4,                       !- Number of Vertices",
+                          "  5.100000,0.000000,9.900000,  !- X,Y,Z ==> Vertex 1 {m}",
+                          "  5.100000,0.000000,0.1000000,  !- X,Y,Z ==> Vertex 2 {m}",
+                          "  9.900000,0.000000,0.1000000,  !- X,Y,Z ==> Vertex 3 {m}",
+                          "  9.900000,0.000000,9.900000;  !- X,Y,Z ==> Vertex 4 {m}",
+                          "BuildingSurface:Detailed,"
+                          "  Wall,                    !- Name",
+                          "  Wall,                    !- Surface Type",
+                          "  WallConstruction,        !- Construction Name",
+                          "  Zone,                    !- Zone Name",
+                          "  Outdoors,                !- Outside Boundary Condition",
+                          "  ,                        !- Outside Boundary Condition Object",
+                          "  SunExposed,              !- Sun Exposure",
+                          "  WindExposed,             !- Wind Exposure",
+                          "  0.5000000,               !- View Factor to Ground",
+                          "  4,                       !- Number of Vertices",
+                          "  0.000000,0.000000,10.00000,  !- X,Y,Z ==> Vertex 1 {m}",
+                          "  0.000000,0.000000,0,  !- X,Y,Z ==> Vertex 2 {m}",
+                          "  10.00000,0.000000,0,  !- X,Y,Z ==> Vertex 3 {m}",
+                          "  10.00000,0.000000,10.00000;  !- X,Y,Z ==> Vertex 4 {m}",
+                          "BuildingSurface:Detailed,"
+                          "  Floor,                   !- Name",
+                          "  Floor,                   !- Surface Type",
+                          "  WallConstruction,        !- Construction Name",
+                          "  Zone,                    !- Zone Name",
+                          "  Outdoors,                !- Outside Boundary Condition",
+                          "  ,                        !- Outside Boundary Condition Object",
+                          "  NoSun,                   !- Sun Exposure",
+                          "  NoWind,                  !- Wind Exposure",
+                          "  1.0,                     !- View Factor to Ground",
+                          "  4,                       !- Number of Vertices",
+                          "  0.000000,0.000000,0,  !- X,Y,Z ==> Vertex 1 {m}",
+                          "  0.000000,10.000000,0,  !- X,Y,Z ==> Vertex 2 {m}",
+                          "  10.00000,10.000000,0,  !- X,Y,Z ==> Vertex 3 {m}",
+                          "  10.00000,0.000000,0;  !- X,Y,Z ==> Vertex 4 {m}",
+                          "Zone,"
+                          "  Zone,                    !- Name",
+                          "  0,                       !- Direction of Relative North {deg}",
+                          "  6.000000,                !- X Origin {m}",
+                          "  6.000000,                !- Y Origin {m}",
+                          "  0,                       !- Z Origin {m}",
+                          "  1,                       !- Type",
+                          "  1,                       !- Multiplier",
+                          "  autocalculate,           !- Ceiling Height {m}",
+                          "  autocalculate;           !- Volume {m3}"});
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    DataHeatBalance::ZoneIntGain.allocate(1);
+
+    createFacilityElectricPowerServiceObject();
+    HeatBalanceManager::SetPreConstructionInputParameters();
+    HeatBalanceManager::GetProjectControlData(ErrorsFound);
+    HeatBalanceManager::GetFrameAndDividerData(ErrorsFound);
+    HeatBalanceManager::GetMaterialData(ErrorsFound);
+    HeatBalanceManager::GetConstructData(ErrorsFound);
+    HeatBalanceManager::GetBuildingData(ErrorsFound);
+    EXPECT_FALSE(ErrorsFound);
+
+    Psychrometrics::InitializePsychRoutines();
+
+    int const doubleWindow(UtilityRoutines::FindItemInList("DOUBLEWINDOW", DataSurfaces::Surface));
+    int const tripleWindow(UtilityRoutines::FindItemInList("TRIPLEWINDOW", DataSurfaces::Surface));
+    ASSERT_GT(doubleWindow, 0);
+    ASSERT_GT(tripleWindow, 0);
+    EXPECT_EQ(2, DataHeatBalance::Construct(DataSurfaces::Surface(doubleWindow).Construction).TotGlassLayers);
+    EXPECT_EQ(3, DataHeatBalance::Construct(DataSurfaces::Surface(tripleWindow).Construction).TotGlassLayers);
+
+    int const numSurf(DataSurfaces::TotSurfaces);
+
+    DataGlobals::TimeStep = 1;
+    DataGlobals::TimeStepZone = 1;
+    DataGlobals::HourOfDay = 1;
+    DataGlobals::NumOfTimeStepInHour = 1;
+    DataGlobals::BeginSimFlag = true;
+    DataEnvironment::OutBaroPress = 100000;
+    DataEnvironment::SkyTempKelvin = 253.15;
+
+    // Fixed inside film so the only nonlinearity left in the solve is the face emission
+    DataHeatBalance::Zone(1).InsideConvectionAlgo = DataHeatBalance::ASHRAESimple;
+    DataHeatBalance::TempEffBulkAir.allocate(numSurf);
+    DataHeatBalance::TempEffBulkAir = 21.0;
+    DataHeatBalSurface::TempSurfInTmp.allocate(numSurf);
+    DataHeatBalSurface::TempSurfInTmp = 21.0;
+    DataHeatBalance::HConvIn.allocate(numSurf);
+    DataHeatBalance::HConvIn = 3.0;
+    DataHeatBalFanSys::ZoneAirHumRat.allocate(1);
+    DataHeatBalFanSys::ZoneAirHumRat(1) = 0.008;
+    DataHeatBalFanSys::ZoneAirHumRatAvg.allocate(1);
+    DataHeatBalFanSys::ZoneAirHumRatAvg(1) = 0.008;
+    DataHeatBalFanSys::MAT.allocate(1);
+    DataHeatBalFanSys::MAT(1) = 21.0;
+
+    DataHeatBalFanSys::QHTRadSysSurf.dimension(numSurf, 0.0);
+    DataHeatBalFanSys::QHWBaseboardSurf.dimension(numSurf, 0.0);
+    DataHeatBalFanSys::QSteamBaseboardSurf.dimension(numSurf, 0.0);
+    DataHeatBalFanSys::QElecBaseboardSurf.dimension(numSurf, 0.0);
+    DataHeatBalance::QRadSWwinAbs.dimension(3, numSurf, 0.0);
+    DataHeatBalance::QRadThermInAbs.dimension(numSurf, 0.0);
+    DataHeatBalance::QRadSWOutIncident.dimension(numSurf, 0.0);
+    DataSurfaces::WinTransSolar.dimension(numSurf, 0.0);
+    DataHeatBalance::ZoneWinHeatGain.allocate(1);
+    DataHeatBalance::ZoneWinHeatGainRep.allocate(1);
+    DataHeatBalance::ZoneWinHeatGainRepEnergy.allocate(1);
+    DataSurfaces::WinHeatGain.allocate(numSurf);
+    DataSurfaces::WinHeatTransfer.allocate(numSurf);
+    DataSurfaces::WinGainConvGlazToZoneRep.allocate(numSurf);
+    DataSurfaces::WinGainIRGlazToZoneRep.allocate(numSurf);
+    DataSurfaces::WinGapConvHtFlowRep.allocate(numSurf);
+    DataSurfaces::WinGapConvHtFlowRepEnergy.allocate(numSurf);
+    DataHeatBalance::QS.dimension(1, 0.0);
+    DataSurfaces::WinLossSWZoneToOutWinRep.allocate(numSurf);
+    DataSurfaces::WinSysSolTransmittance.allocate(numSurf);
+    DataSurfaces::WinSysSolAbsorptance.allocate(numSurf);
+    DataSurfaces::WinSysSolReflectance.allocate(numSurf);
+    DataSurfaces::InsideGlassCondensationFlag.allocate(numSurf);
+    DataSurfaces::WinGainFrameDividerToZoneRep.allocate(numSurf);
+    DataSurfaces::InsideFrameCondensationFlag.allocate(numSurf);
+    DataSurfaces::InsideDividerCondensationFlag.allocate(numSurf);
+    DataHeatBalSurface::QdotConvOutRep.allocate(numSurf);
+    DataHeatBalSurface::QdotConvOutRepPerArea.allocate(numSurf);
+    DataHeatBalSurface::QConvOutReport.allocate(numSurf);
+    DataHeatBalSurface::QdotRadOutRep.allocate(numSurf);
+    DataHeatBalSurface::QdotRadOutRepPerArea.allocate(numSurf);
+    DataHeatBalSurface::QRadOutReport.allocate(numSurf);
+    DataHeatBalSurface::QRadLWOutSrdSurfs.dimension(numSurf, 0.0);
+
+    // Cold winter afternoon with some solar absorbed in each pane
+    for (int SurfNum : {doubleWindow, tripleWindow}) {
+        DataSurfaces::Surface(SurfNum).OutDryBulbTemp = -10.0;
+        DataSurfaces::Surface(SurfNum).OutWetBulbTemp = -11.0;
+        DataSurfaces::SurfaceWindow(SurfNum).IRfromParentZone = DataGlobals::StefanBoltzmann * pow_4(20.0 + DataGlobals::KelvinConv);
+        DataHeatBalance::QRadSWwinAbs(1, SurfNum) = 40.0;
+        DataHeatBalance::QRadSWwinAbs(2, SurfNum) = 15.0;
+        DataHeatBalance::QRadSWwinAbs(3, SurfNum) = 8.0;
+    }
+
+    Real64 const hExt(20.0);
+    int const maxNewtonIterations(25); // MaxIterations/4 in SolveForWindowTemperatures
+    Real64 inSurfTempRelaxed;
+    Real64 outSurfTempRelaxed;
+    Real64 inSurfTempNewton;
+    Real64 outSurfTempNewton;
+
+    for (int SurfNum : {doubleWindow, tripleWindow}) {
+        auto &window(DataSurfaces::SurfaceWindow(SurfNum));
+        int const numFaces(2 * DataHeatBalance::Construct(DataSurfaces::Surface(SurfNum).Construction).TotGlassLayers);
+
+        // Both solves start from the same resistance-network guess
+        DataGlobals::BeginEnvrnFlag = true;
+        DataSystemVariables::WindowNewtonSolve = false;
+        WindowManager::CalcWindowHeatBalance(SurfNum, hExt, inSurfTempRelaxed, outSurfTempRelaxed);
+        int const relaxedIterations(window.WindowCalcIterationsRep);
+        Array1D<Real64> const thetaRelaxed(window.ThetaFace);
+
+        DataSystemVariables::WindowNewtonSolve = true;
+        WindowManager::CalcWindowHeatBalance(SurfNum, hExt, inSurfTempNewton, outSurfTempNewton);
+        int const newtonIterations(window.WindowCalcIterationsRep);
+
+        EXPECT_LT(newtonIterations, relaxedIterations);
+        EXPECT_LT(newtonIterations, maxNewtonIterations);
+        EXPECT_NEAR(inSurfTempRelaxed, inSurfTempNewton, 0.05);
+        EXPECT_NEAR(outSurfTempRelaxed, outSurfTempNewton, 0.05);
+        for (int face = 1; face <= numFaces; ++face) {
+            EXPECT_NEAR(thetaRelaxed(face), window.ThetaFace(face), 0.05);
+        }
+        // Pane faces sit between the outdoor and zone air temperatures
+        EXPECT_GT(outSurfTempNewton, -10.0);
+        EXPECT_LT(inSurfTempNewton, 21.0);
+
+        // A warm start far from the solution still lands on the same temperatures
+        DataGlobals::BeginEnvrnFlag = false;
+        window.ThetaFace = 60.0 + DataGlobals::KelvinConv;
+        WindowManager::CalcWindowHeatBalance(SurfNum, hExt, inSurfTempNewton, outSurfTempNewton);
+        EXPECT_LT(window.WindowCalcIterationsRep, 100);
+        EXPECT_NEAR(inSurfTempRelaxed, inSurfTempNewton, 0.05);
+        EXPECT_NEAR(outSurfTempRelaxed, outSurfTempNewton, 0.05);
+    }
+
+    // When no iteration can converge the Newton solve reports the same convergence error as the relaxed one
+    // instead of returning unconverged face temperatures
+    has_err_output(true);
+    DataGlobals::BeginEnvrnFlag = true;
+    DataSurfaces::Surface(tripleWindow).OutDryBulbTemp = std::numeric_limits<Real64>::quiet_NaN();
+    DataSystemVariables::WindowNewtonSolve = false;
+    ASSERT_THROW(WindowManager::CalcWindowHeatBalance(tripleWindow, hExt, inSurfTempRelaxed, outSurfTempRelaxed), std::runtime_error);
+    EXPECT_TRUE(has_err_output(true));
+    DataSystemVariables::WindowNewtonSolve = true;
+    ASSERT_THROW(WindowManager::CalcWindowHeatBalance(tripleWindow, hExt, inSurfTempNewton, outSurfTempNewton), std::runtime_error);
+    EXPECT_TRUE(has_err_output(true));
+}
+
 TEST_F(EnergyPlusFixture, SpectralAngularPropertyTest)
 {
     DataIPShortCuts::lAlphaFieldBlanks = true;
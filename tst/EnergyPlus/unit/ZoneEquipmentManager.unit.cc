@@ -54,6 +54,7 @@
 #include <EnergyPlus/DataAirLoop.hh>
 #include <EnergyPlus/DataAirSystems.hh>
 #include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
 #include <EnergyPlus/DataHVACGlobals.hh>
 #include <EnergyPlus/DataHeatBalFanSys.hh>
 #include <EnergyPlus/DataHeatBalance.hh>
@@ -2146,3 +2147,48 @@ TEST_F(EnergyPlusFixture, ZoneEquipmentManager_DistributeSequentialLoad_MixedEqu
     EXPECT_DOUBLE_EQ(energy.RemainingOutputReqToCoolSP, expectedCoolLoad);
 
 }
+
+TEST_F(EnergyPlusFixture, ZoneEquipmentManager_InitSystemOutputRequiredControlledZone)
+{
+    // the equipment list of a zone is found whether or not its equipment configuration is stored at the zone index
+    DataGlobals::NumOfZones = 2;
+    DataHeatBalance::Zone.allocate(2);
+    DataZoneEnergyDemands::ZoneSysEnergyDemand.allocate(2);
+    DataZoneEnergyDemands::ZoneSysMoistureDemand.allocate(2);
+    DataZoneEnergyDemands::CurDeadBandOrSetback.allocate(2);
+    DataZoneEnergyDemands::DeadBandOrSetback.allocate(2);
+    DataZoneEnergyDemands::DeadBandOrSetback = false;
+    ZoneEquipConfig.allocate(2);
+    ZoneEquipList.allocate(2);
+    for (int ControlledZoneNum = 1; ControlledZoneNum <= 2; ++ControlledZoneNum) {
+        auto &thisZEqList(ZoneEquipList(ControlledZoneNum));
+        thisZEqList.NumOfEquipTypes = 1;
+        thisZEqList.EquipType.allocate(1);
+        thisZEqList.EquipType_Num.allocate(1);
+        thisZEqList.EquipName.allocate(1);
+        thisZEqList.CoolingPriority.allocate(1);
+        thisZEqList.HeatingPriority.allocate(1);
+        thisZEqList.EquipType(1) = "ZONEHVAC:IDEALLOADSAIRSYSTEM";
+        thisZEqList.EquipType_Num(1) = PurchasedAir_Num;
+        thisZEqList.EquipName(1) = "EQUIPMENT OF CONFIGURATION " + std::to_string(ControlledZoneNum);
+        thisZEqList.CoolingPriority(1) = 1;
+        thisZEqList.HeatingPriority(1) = 1;
+    }
+    PrioritySimOrder.allocate(1);
+
+    // configurations stored at the zone index
+    ZoneEquipConfig(1).ActualZoneNum = 1;
+    ZoneEquipConfig(2).ActualZoneNum = 2;
+    InitSystemOutputRequired(2, true, true);
+    EXPECT_EQ("EQUIPMENT OF CONFIGURATION 2", PrioritySimOrder(1).EquipName);
+    InitSystemOutputRequired(1, true, true);
+    EXPECT_EQ("EQUIPMENT OF CONFIGURATION 1", PrioritySimOrder(1).EquipName);
+
+    // configurations stored out of zone order are still found by the search
+    ZoneEquipConfig(1).ActualZoneNum = 2;
+    ZoneEquipConfig(2).ActualZoneNum = 1;
+    InitSystemOutputRequired(2, true, true);
+    EXPECT_EQ("EQUIPMENT OF CONFIGURATION 1", PrioritySimOrder(1).EquipName);
+    InitSystemOutputRequired(1, true, true);
+    EXPECT_EQ("EQUIPMENT OF CONFIGURATION 2", PrioritySimOrder(1).EquipName);
+}
@@ -1610,3 +1610,97 @@ TEST_F(EnergyPlusFixture, TempAtPrevTimeStepWithCutoutDeltaT_test)
     SetPointSingleHeatCool.deallocate();
     SetPointDualHeatCool.deallocate();
 }
+
+TEST_F(EnergyPlusFixture, ZoneTempPredictorCorrector_CalcZoneSums_HeatTransferSurfaceList)
+{
+    // The surface convection sums walk a list of the zone's heat transfer surfaces; they must match the scan of the
+    // zone's surface range that skips non-heat transfer surfaces, in the same order
+    int const NumZones = 2;
+    int const NumSurfs = 7;
+    Real64 SumIntGain = 0.0; // Zone sum of convective internal gains
+    Real64 SumHA = 0.0;      // Zone sum of Hc*Area
+    Real64 SumHATsurf = 0.0; // Zone sum of Hc*Area*Tsurf
+    Real64 SumHATref = 0.0;  // Zone sum of Hc*Area*Tref, for ceiling diffuser convection correlation
+    Real64 SumMCp = 0.0;     // Zone sum of MassFlowRate*Cp
+    Real64 SumMCpT = 0.0;    // Zone sum of MassFlowRate*Cp*T
+    Real64 SumSysMCp = 0.0;  // Zone sum of air system MassFlowRate*Cp
+    Real64 SumSysMCpT = 0.0; // Zone sum of air system MassFlowRate*Cp*T
+
+    DataHeatBalance::ZoneIntGain.allocate(NumZones);
+    DataHeatBalFanSys::SumConvHTRadSys.dimension(NumZones, 0.0);
+    DataHeatBalFanSys::SumConvPool.dimension(NumZones, 0.0);
+    DataHeatBalFanSys::MCPI.dimension(NumZones, 0.0);
+    DataHeatBalFanSys::MCPV.dimension(NumZones, 0.0);
+    DataHeatBalFanSys::MCPM.dimension(NumZones, 0.0);
+    DataHeatBalFanSys::MCPE.dimension(NumZones, 0.0);
+    DataHeatBalFanSys::MCPC.dimension(NumZones, 0.0);
+    DataHeatBalFanSys::MCPTI.dimension(NumZones, 0.0);
+    DataHeatBalFanSys::MCPTV.dimension(NumZones, 0.0);
+    DataHeatBalFanSys::MCPTM.dimension(NumZones, 0.0);
+    DataHeatBalFanSys::MCPTE.dimension(NumZones, 0.0);
+    DataHeatBalFanSys::MCPTC.dimension(NumZones, 0.0);
+    DataHeatBalFanSys::MDotCPOA.dimension(NumZones, 0.0);
+    MAT.dimension(NumZones, 0.0);
+    ZoneAirHumRat.dimension(NumZones, 0.008);
+    MAT(1) = 22.0;
+    MAT(2) = 24.0;
+
+    Zone.allocate(NumZones);
+    Zone(1).SurfaceFirst = 1;
+    Zone(1).SurfaceLast = 3;
+    Zone(2).SurfaceFirst = 4;
+    Zone(2).SurfaceLast = NumSurfs;
+
+    Surface.allocate(NumSurfs);
+    HConvIn.allocate(NumSurfs);
+    TempEffBulkAir.allocate(NumSurfs);
+    DataHeatBalSurface::TempSurfInTmp.allocate(NumSurfs);
+    for (int SurfNum = 1; SurfNum <= NumSurfs; ++SurfNum) {
+        Surface(SurfNum).HeatTransSurf = true;
+        Surface(SurfNum).Area = 3.7 * SurfNum;
+        Surface(SurfNum).TAirRef = (SurfNum % 2 == 0) ? AdjacentAirTemp : ZoneMeanAirTemp;
+        HConvIn(SurfNum) = 0.9 + 0.31 * SurfNum;
+        DataHeatBalSurface::TempSurfInTmp(SurfNum) = 14.3 + 1.7 * SurfNum;
+        TempEffBulkAir(SurfNum) = 21.1 + 0.13 * SurfNum;
+    }
+    // not a heat transfer surface, e.g. an internal shading surface; it would dominate the sums if it were included
+    Surface(2).HeatTransSurf = false;
+    Surface(5).HeatTransSurf = false;
+    HConvIn(5) = 1000.0;
+
+    NumZoneReturnPlenums = 0;
+    NumZoneSupplyPlenums = 0;
+
+    auto expectRangeScanSums = [&](int const ZoneNum) {
+        Real64 expectedSumHA = 0.0;
+        Real64 expectedSumHATsurf = 0.0;
+        Real64 expectedSumHATref = 0.0;
+        for (int SurfNum = Zone(ZoneNum).SurfaceFirst; SurfNum <= Zone(ZoneNum).SurfaceLast; ++SurfNum) {
+            if (!Surface(SurfNum).HeatTransSurf) continue;
+            Real64 HA = 0.0;
+            HA += HConvIn(SurfNum) * Surface(SurfNum).Area;
+            expectedSumHATsurf += HConvIn(SurfNum) * Surface(SurfNum).Area * DataHeatBalSurface::TempSurfInTmp(SurfNum);
+            if (Surface(SurfNum).TAirRef == AdjacentAirTemp) {
+                expectedSumHATref += HA * TempEffBulkAir(SurfNum);
+            } else {
+                expectedSumHA += HA;
+            }
+        }
+        SumHA = SumHATsurf = SumHATref = 0.0;
+        CalcZoneSums(ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT);
+        EXPECT_EQ(expectedSumHA, SumHA);
+        EXPECT_EQ(expectedSumHATsurf, SumHATsurf);
+        EXPECT_EQ(expectedSumHATref, SumHATref);
+    };
+
+    expectRangeScanSums(2);
+    expectRangeScanSums(1);
+
+    // the list is built once; later calls with new surface temperatures still match
+    for (int SurfNum = 1; SurfNum <= NumSurfs; ++SurfNum) {
+        DataHeatBalSurface::TempSurfInTmp(SurfNum) += 2.5;
+        TempEffBulkAir(SurfNum) -= 0.75;
+    }
+    expectRangeScanSums(1);
+    expectRangeScanSums(2);
+}